@@ -40,6 +40,25 @@ def testSteps(String buildDir, List environment, String testList) {
   }
 }
 
+// Runs the benchmarks pinned to a CPU and compares them with the results of
+// the last nightly build, which become the baseline of the next one
+def benchmarkSteps(String buildDir, List environment) {
+  withEnv(environment) {
+    def results = "${buildDir}/benchmark_results"
+    def baseline = "${env.BENCHMARK_BASELINE_DIR}"
+    sh "python3 .jenkinsci/helpers/benchmark_regression.py run ${buildDir}/benchmark_bin ${results} || true"
+    archiveArtifacts artifacts: "${results}/*.json", allowEmptyArchive: true
+    if (fileExists(baseline)) {
+      def status = sh(script: "python3 .jenkinsci/helpers/benchmark_regression.py compare ${baseline} ${results} ${buildDir}/benchmark_regressions.xml --fail-on-regression", returnStatus: true)
+      junit testResults: "${buildDir}/benchmark_regressions.xml", allowEmptyResults: true
+      if (status != 0) {
+        currentBuild.result = 'UNSTABLE'
+      }
+    }
+    sh "rm -rf ${baseline} && mkdir -p ${baseline} && cp ${results}/*.json ${baseline}/ || true"
+  }
+}
+
 def buildSteps(int parallelism, List compilerVersions, String build_type, boolean build_shared_libs, boolean specialBranch, boolean coverage,
       boolean testing, String testList, boolean cppcheck, boolean sonar, boolean codestyle, boolean docs, boolean packagebuild, boolean sanitize,
       boolean fuzzing, boolean benchmarking, boolean coredumps, boolean useBTF, boolean use_libursa, boolean forceDockerDevelopBuild, List environment) {
@@ -123,6 +142,13 @@ def buildSteps(int parallelism, List compilerVersions, String build_type, boolea
             coverage = false
           }
         } //end if
+        // The results of one compiler are enough to track the regressions
+        if (benchmarking && params.build_scenario == 'Nightly build'
+            && compiler == compilerVersions[0]) {
+          stage("Benchmarks ${compiler}") {
+            benchmarkSteps(buildDir, environment)
+          }
+        }
       } //end for
       stage("Analysis") {
             cppcheck ? build.cppCheck(buildDir, parallelism) : echo('Skipping Cppcheck...')
@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+#
+# Copyright Soramitsu Co., Ltd. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+
+#
+# Runs the benchmark binaries pinned to a CPU and compares their results with
+# a stored baseline.
+#
+#   run:     every bm_* binary of the directory is run with repetitions, its
+#            Google Benchmark JSON output is written to the output directory
+#   compare: the repetitions of every benchmark are compared with the baseline
+#            by the Mann-Whitney U test, a benchmark is a regression when it
+#            is significantly slower and its median is slower by more than
+#            the threshold; a JUnit report of the comparison is written
+#
+
+import argparse
+import glob
+import json
+import math
+import os
+import subprocess
+import sys
+import xml.etree.ElementTree as ET
+
+
+def run(args):
+    if not os.path.isdir(args.output):
+        os.makedirs(args.output)
+    binaries = sorted(glob.glob(os.path.join(args.benchmark_dir, 'bm_*')))
+    if args.only:
+        binaries = [b for b in binaries if os.path.basename(b) in args.only]
+    failed = []
+    for binary in binaries:
+        name = os.path.basename(binary)
+        command = ['taskset', '-c', args.cpu, binary,
+                   '--benchmark_repetitions=%d' % args.repetitions,
+                   '--benchmark_out=%s' % os.path.join(args.output,
+                                                       name + '.json'),
+                   '--benchmark_out_format=json']
+        if args.filter:
+            command.append('--benchmark_filter=%s' % args.filter)
+        print('Running %s' % ' '.join(command))
+        sys.stdout.flush()
+        if subprocess.call(command) != 0:
+            failed.append(name)
+    if failed:
+        print('Failed benchmarks: %s' % ', '.join(failed))
+        return 1
+    return 0
+
+
+def load_results(directory):
+    """Map of 'binary/benchmark' to the real times of its repetitions in
+    nanoseconds"""
+    units = {'ns': 1., 'us': 1e3, 'ms': 1e6, 's': 1e9}
+    results = {}
+    for path in glob.glob(os.path.join(directory, '*.json')):
+        binary = os.path.splitext(os.path.basename(path))[0]
+        with open(path) as f:
+            report = json.load(f)
+        for benchmark in report.get('benchmarks', []):
+            if benchmark.get('run_type') == 'aggregate' or \
+                    benchmark.get('error_occurred'):
+                continue
+            name = '%s/%s' % (binary, benchmark.get('run_name',
+                                                    benchmark['name']))
+            time = benchmark['real_time'] * units[benchmark['time_unit']]
+            results.setdefault(name, []).append(time)
+    return results
+
+
+def median(values):
+    values = sorted(values)
+    middle = len(values) // 2
+    if len(values) % 2:
+        return values[middle]
+    return (values[middle - 1] + values[middle]) / 2.
+
+
+def mann_whitney_p_value(baseline, current):
+    """One-sided p-value of the current times being greater than the
+    baseline ones, by the normal approximation with the tie correction"""
+    ranked = sorted([(v, 0) for v in baseline] + [(v, 1) for v in current])
+    ranks = [0.] * len(ranked)
+    ties = 0.
+    i = 0
+    while i < len(ranked):
+        j = i
+        while j + 1 < len(ranked) and ranked[j + 1][0] == ranked[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2. + 1
+        count = j - i + 1
+        ties += count ** 3 - count
+        i = j + 1
+    n1 = len(baseline)
+    n2 = len(current)
+    rank_sum = sum(r for r, (_, group) in zip(ranks, ranked) if group == 1)
+    u = rank_sum - n2 * (n2 + 1) / 2.
+    n = n1 + n2
+    variance = n1 * n2 / 12. * ((n + 1) - ties / (n * (n - 1)))
+    if variance <= 0:
+        return 1.
+    z = (u - n1 * n2 / 2. - 0.5) / math.sqrt(variance)
+    return 0.5 * math.erfc(z / math.sqrt(2))
+
+
+def compare(args):
+    baseline = load_results(args.baseline)
+    current = load_results(args.current)
+    suite = ET.Element('testsuite', name='benchmark regressions')
+    regressions = []
+    rows = []
+    for name in sorted(current):
+        case = ET.SubElement(suite, 'testcase', classname='benchmarks',
+                             name=name)
+        if name not in baseline:
+            ET.SubElement(case, 'skipped', message='no baseline')
+            rows.append((name, None, median(current[name]), None, None))
+            continue
+        old = median(baseline[name])
+        new = median(current[name])
+        change = (new - old) / old if old else 0.
+        p_value = mann_whitney_p_value(baseline[name], current[name])
+        rows.append((name, old, new, change, p_value))
+        if p_value < args.alpha and change > args.threshold:
+            message = 'median %.0f ns -> %.0f ns (%+.1f%%), p = %.4f' % (
+                old, new, change * 100, p_value)
+            ET.SubElement(case, 'failure', message=message)
+            regressions.append((name, message))
+    suite.set('tests', str(len(rows)))
+    suite.set('failures', str(len(regressions)))
+    ET.ElementTree(suite).write(args.report)
+
+    print('%-70s %14s %14s %9s %8s' % ('benchmark', 'baseline ns',
+                                       'current ns', 'change', 'p'))
+    for name, old, new, change, p_value in rows:
+        if old is None:
+            print('%-70s %14s %14.0f %9s %8s' % (name, '-', new, '-', '-'))
+        else:
+            print('%-70s %14.0f %14.0f %+8.1f%% %8.4f' % (
+                name, old, new, change * 100, p_value))
+    for name, message in regressions:
+        print('REGRESSION %s: %s' % (name, message))
+    return 1 if regressions and args.fail_on_regression else 0
+
+
+parser = argparse.ArgumentParser(
+    description='Run the benchmarks and compare them with a baseline')
+subparsers = parser.add_subparsers(dest='command')
+
+run_parser = subparsers.add_parser('run', help='run the benchmark binaries')
+run_parser.add_argument('benchmark_dir', help='directory of the bm_* binaries')
+run_parser.add_argument('output', help='directory of the JSON results')
+run_parser.add_argument('--cpu', default='2',
+                        help='CPU list the benchmarks are pinned to')
+run_parser.add_argument('--repetitions', type=int, default=9)
+run_parser.add_argument('--filter', help='Google Benchmark filter regex')
+run_parser.add_argument('--only', nargs='*',
+                        help='names of the binaries to run, all by default')
+
+compare_parser = subparsers.add_parser(
+    'compare', help='compare the results with the baseline')
+compare_parser.add_argument('baseline', help='directory of the baseline JSON')
+compare_parser.add_argument('current', help='directory of the current JSON')
+compare_parser.add_argument('report', help='JUnit report of the comparison')
+compare_parser.add_argument('--alpha', type=float, default=0.01,
+                            help='significance level of a slowdown')
+compare_parser.add_argument('--threshold', type=float, default=0.05,
+                            help='relative slowdown of the median to report')
+compare_parser.add_argument('--fail-on-regression', action='store_true')
+
+args = parser.parse_args()
+if args.command == 'run':
+    sys.exit(run(args))
+elif args.command == 'compare':
+    sys.exit(compare(args))
+parser.print_help()
+sys.exit(2)
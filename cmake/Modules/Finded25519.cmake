@@ -23,7 +23,7 @@ if (NOT ed25519_FOUND)
         -DTESTING=OFF
         -DBUILD=STATIC
         -DHASH=sha3_brainhub
-        -DEDIMPL=ref10
+        -DEDIMPL=${ED25519_IMPL}
         -DHUNTER_ENABLED=OFF
         ${DEPS_CMAKE_ARGS}
       PATCH_COMMAND  ${PATCH_RANDOM}
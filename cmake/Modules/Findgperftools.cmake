@@ -0,0 +1,17 @@
+add_library(gperftools UNKNOWN IMPORTED)
+
+find_path(gperftools_INCLUDE_DIR gperftools/profiler.h)
+mark_as_advanced(gperftools_INCLUDE_DIR)
+
+find_library(gperftools_LIBRARY NAMES profiler)
+mark_as_advanced(gperftools_LIBRARY)
+
+find_package_handle_standard_args(gperftools DEFAULT_MSG
+    gperftools_INCLUDE_DIR
+    gperftools_LIBRARY
+    )
+
+set_target_properties(gperftools PROPERTIES
+    INTERFACE_INCLUDE_DIRECTORIES ${gperftools_INCLUDE_DIR}
+    IMPORTED_LOCATION ${gperftools_LIBRARY}
+    )
@@ -0,0 +1,48 @@
+add_library(zstd UNKNOWN IMPORTED)
+
+find_path(zstd_INCLUDE_DIR zstd.h)
+mark_as_advanced(zstd_INCLUDE_DIR)
+
+find_library(zstd_LIBRARY NAMES zstd zstd_static)
+mark_as_advanced(zstd_LIBRARY)
+
+find_package_handle_standard_args(zstd DEFAULT_MSG
+    zstd_INCLUDE_DIR
+    zstd_LIBRARY
+    )
+
+set(URL https://github.com/facebook/zstd.git)
+set(VERSION v1.4.4)
+set_target_description(zstd "Compression library" ${URL} ${VERSION})
+
+if (NOT zstd_FOUND)
+  externalproject_add(facebook_zstd
+      GIT_REPOSITORY  ${URL}
+      GIT_TAG         ${VERSION}
+      SOURCE_SUBDIR   build/cmake
+      CMAKE_ARGS
+                      ${DEPS_CMAKE_ARGS}
+                      -DZSTD_BUILD_PROGRAMS=OFF
+                      -DZSTD_BUILD_SHARED=OFF
+                      -DZSTD_BUILD_TESTS=OFF
+      BUILD_BYPRODUCTS ${EP_PREFIX}/src/facebook_zstd-build/lib/libzstd.a
+      INSTALL_COMMAND "" # remove install step
+      TEST_COMMAND "" # remove test step
+      UPDATE_COMMAND "" # remove update step
+      )
+  externalproject_get_property(facebook_zstd source_dir binary_dir)
+  set(zstd_INCLUDE_DIR ${source_dir}/lib)
+  set(zstd_LIBRARY ${binary_dir}/lib/libzstd.a)
+  file(MAKE_DIRECTORY ${zstd_INCLUDE_DIR})
+
+  add_dependencies(zstd facebook_zstd)
+endif ()
+
+set_target_properties(zstd PROPERTIES
+    INTERFACE_INCLUDE_DIRECTORIES ${zstd_INCLUDE_DIR}
+    IMPORTED_LOCATION ${zstd_LIBRARY}
+    )
+
+if(ENABLE_LIBS_PACKAGING)
+  add_install_step_for_lib(${zstd_LIBRARY})
+endif()
@@ -132,6 +132,11 @@ find_package(pq)
 ##########################
 find_package(soci)
 
+##########################
+#          zstd          #
+##########################
+find_package(zstd)
+
 ################################
 #            gflags            #
 ################################
@@ -201,6 +206,13 @@ if(USE_LIBURSA)
   find_package(ursa)
 endif()
 
+###################################
+#           gperftools            #
+###################################
+if(USE_GPERFTOOLS)
+  find_package(gperftools REQUIRED)
+endif()
+
 ###################################
 #              fmt                #
 ###################################
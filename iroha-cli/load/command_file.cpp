@@ -0,0 +1,285 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "load/command_file.hpp"
+
+#include <fstream>
+#include <functional>
+#include <unordered_map>
+
+#include <google/protobuf/util/json_util.h>
+#include <rapidjson/document.h>
+#include <rapidjson/istreamwrapper.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/lexical_cast.hpp>
+
+using iroha::expected::makeError;
+using iroha::expected::makeValue;
+using iroha::protocol::Command;
+
+namespace {
+
+  using Fields = std::vector<std::string>;
+
+  /// number of the fields after the command name and the way to fill the
+  /// command with them
+  struct CsvCommand {
+    size_t fields;
+    std::function<bool(const Fields &, Command &)> fill;
+  };
+
+  bool parseNumber(const std::string &field, uint32_t &number) {
+    return boost::conversion::try_lexical_convert(field, number);
+  }
+
+  const std::unordered_map<std::string, CsvCommand> &csvCommands() {
+    static const std::unordered_map<std::string, CsvCommand> commands{
+        {"create_account",
+         {3,
+          [](const Fields &f, Command &c) {
+            auto command = c.mutable_create_account();
+            command->set_account_name(f[0]);
+            command->set_domain_id(f[1]);
+            command->set_public_key(f[2]);
+            return true;
+          }}},
+        {"create_domain",
+         {2,
+          [](const Fields &f, Command &c) {
+            auto command = c.mutable_create_domain();
+            command->set_domain_id(f[0]);
+            command->set_default_role(f[1]);
+            return true;
+          }}},
+        {"create_asset",
+         {3,
+          [](const Fields &f, Command &c) {
+            uint32_t precision;
+            if (not parseNumber(f[2], precision)) {
+              return false;
+            }
+            auto command = c.mutable_create_asset();
+            command->set_asset_name(f[0]);
+            command->set_domain_id(f[1]);
+            command->set_precision(precision);
+            return true;
+          }}},
+        {"add_asset_quantity",
+         {2,
+          [](const Fields &f, Command &c) {
+            auto command = c.mutable_add_asset_quantity();
+            command->set_asset_id(f[0]);
+            command->set_amount(f[1]);
+            return true;
+          }}},
+        {"subtract_asset_quantity",
+         {2,
+          [](const Fields &f, Command &c) {
+            auto command = c.mutable_subtract_asset_quantity();
+            command->set_asset_id(f[0]);
+            command->set_amount(f[1]);
+            return true;
+          }}},
+        {"transfer_asset",
+         {5,
+          [](const Fields &f, Command &c) {
+            auto command = c.mutable_transfer_asset();
+            command->set_src_account_id(f[0]);
+            command->set_dest_account_id(f[1]);
+            command->set_asset_id(f[2]);
+            command->set_amount(f[3]);
+            command->set_description(f[4]);
+            return true;
+          }}},
+        {"set_account_detail",
+         {3,
+          [](const Fields &f, Command &c) {
+            auto command = c.mutable_set_account_detail();
+            command->set_account_id(f[0]);
+            command->set_key(f[1]);
+            command->set_value(f[2]);
+            return true;
+          }}},
+        {"append_role",
+         {2,
+          [](const Fields &f, Command &c) {
+            auto command = c.mutable_append_role();
+            command->set_account_id(f[0]);
+            command->set_role_name(f[1]);
+            return true;
+          }}},
+        {"detach_role",
+         {2,
+          [](const Fields &f, Command &c) {
+            auto command = c.mutable_detach_role();
+            command->set_account_id(f[0]);
+            command->set_role_name(f[1]);
+            return true;
+          }}},
+        {"add_signatory",
+         {2,
+          [](const Fields &f, Command &c) {
+            auto command = c.mutable_add_signatory();
+            command->set_account_id(f[0]);
+            command->set_public_key(f[1]);
+            return true;
+          }}},
+        {"remove_signatory",
+         {2,
+          [](const Fields &f, Command &c) {
+            auto command = c.mutable_remove_signatory();
+            command->set_account_id(f[0]);
+            command->set_public_key(f[1]);
+            return true;
+          }}},
+        {"set_account_quorum",
+         {2,
+          [](const Fields &f, Command &c) {
+            uint32_t quorum;
+            if (not parseNumber(f[1], quorum)) {
+              return false;
+            }
+            auto command = c.mutable_set_account_quorum();
+            command->set_account_id(f[0]);
+            command->set_quorum(quorum);
+            return true;
+          }}},
+    };
+    return commands;
+  }
+
+  /// split the line into at most count fields, the last one takes the rest
+  Fields split(const std::string &line, size_t count) {
+    Fields fields;
+    size_t begin = 0;
+    while (fields.size() + 1 < count) {
+      auto end = line.find(',', begin);
+      if (end == std::string::npos) {
+        break;
+      }
+      fields.push_back(line.substr(begin, end - begin));
+      begin = end + 1;
+    }
+    fields.push_back(line.substr(begin));
+    return fields;
+  }
+
+  iroha::expected::Result<Command, std::string> parseJsonCommand(
+      const rapidjson::Value &value) {
+    if (not value.IsObject()) {
+      return makeError(std::string("a command is not an object"));
+    }
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    value.Accept(writer);
+    Command command;
+    auto status = google::protobuf::util::JsonStringToMessage(
+        buffer.GetString(), &command);
+    if (not status.ok()) {
+      return makeError(status.ToString());
+    }
+    if (command.command_case() == Command::COMMAND_NOT_SET) {
+      return makeError(std::string("unknown command ") + buffer.GetString());
+    }
+    return makeValue(std::move(command));
+  }
+
+}  // namespace
+
+namespace iroha_cli {
+  namespace load {
+
+    iroha::expected::Result<CommandLists, std::string> parseCsvCommands(
+        std::istream &input) {
+      CommandLists transactions;
+      std::string line;
+      for (size_t number = 1; std::getline(input, line); ++number) {
+        if (not line.empty() and line.back() == '\r') {
+          line.pop_back();
+        }
+        if (line.empty() or line.front() == '#') {
+          continue;
+        }
+        auto name_end = line.find(',');
+        auto name = line.substr(0, name_end);
+        auto it = csvCommands().find(name);
+        if (it == csvCommands().end()) {
+          return makeError("line " + std::to_string(number)
+                           + ": unknown command " + name);
+        }
+        auto fields = name_end == std::string::npos
+            ? Fields{}
+            : split(line.substr(name_end + 1), it->second.fields);
+        Command command;
+        if (fields.size() != it->second.fields
+            or not it->second.fill(fields, command)) {
+          return makeError("line " + std::to_string(number)
+                           + ": invalid arguments of " + name);
+        }
+        transactions.push_back({std::move(command)});
+      }
+      return makeValue(std::move(transactions));
+    }
+
+    iroha::expected::Result<CommandLists, std::string> parseJsonCommands(
+        std::istream &input) {
+      rapidjson::IStreamWrapper wrapper(input);
+      rapidjson::Document document;
+      document.ParseStream(wrapper);
+      if (document.HasParseError()) {
+        return makeError("invalid JSON at offset "
+                         + std::to_string(document.GetErrorOffset()));
+      }
+      if (not document.IsArray()) {
+        return makeError(std::string("the file is not an array"));
+      }
+
+      CommandLists transactions;
+      for (rapidjson::SizeType i = 0; i < document.Size(); ++i) {
+        const auto &element = document[i];
+        std::vector<Command> commands;
+        auto add = [&](const rapidjson::Value &value) {
+          return parseJsonCommand(value).match(
+              [&commands](auto &&command) {
+                commands.push_back(std::move(command.value));
+                return std::string{};
+              },
+              [](auto &&error) { return std::move(error.error); });
+        };
+        std::string error;
+        if (element.IsArray()) {
+          for (rapidjson::SizeType j = 0; j < element.Size() and error.empty();
+               ++j) {
+            error = add(element[j]);
+          }
+        } else {
+          error = add(element);
+        }
+        if (error.empty() and commands.empty()) {
+          error = "a transaction without commands";
+        }
+        if (not error.empty()) {
+          return makeError("element " + std::to_string(i) + ": " + error);
+        }
+        transactions.push_back(std::move(commands));
+      }
+      return makeValue(std::move(transactions));
+    }
+
+    iroha::expected::Result<CommandLists, std::string> readCommandFile(
+        const std::string &path) {
+      std::ifstream file(path);
+      if (not file) {
+        return makeError("failed to open " + path);
+      }
+      return boost::algorithm::ends_with(path, ".json")
+          ? parseJsonCommands(file)
+          : parseCsvCommands(file);
+    }
+
+  }  // namespace load
+}  // namespace iroha_cli
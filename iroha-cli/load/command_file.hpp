@@ -0,0 +1,63 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CLI_COMMAND_FILE_HPP
+#define IROHA_CLI_COMMAND_FILE_HPP
+
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "common/result.hpp"
+#include "transaction.pb.h"
+
+namespace iroha_cli {
+  namespace load {
+
+    /// commands of the transactions, one transaction per element
+    using CommandLists = std::vector<std::vector<iroha::protocol::Command>>;
+
+    /**
+     * Read the transactions of a command file in CSV, one transaction of one
+     * command per line:
+     *   create_account,<name>,<domain>,<public key>
+     *   create_domain,<domain>,<default role>
+     *   create_asset,<name>,<domain>,<precision>
+     *   add_asset_quantity,<asset>,<amount>
+     *   subtract_asset_quantity,<asset>,<amount>
+     *   transfer_asset,<source>,<destination>,<asset>,<amount>,<description>
+     *   set_account_detail,<account>,<key>,<value>
+     *   append_role,<account>,<role>
+     *   detach_role,<account>,<role>
+     *   add_signatory,<account>,<public key>
+     *   remove_signatory,<account>,<public key>
+     *   set_account_quorum,<account>,<quorum>
+     * The last field takes the rest of the line, so it may contain commas.
+     * Empty lines and lines starting with # are skipped.
+     * @return the commands or the description of the first invalid line
+     */
+    iroha::expected::Result<CommandLists, std::string> parseCsvCommands(
+        std::istream &input);
+
+    /**
+     * Read the transactions of a command file in JSON, which is an array of
+     * the commands in the protobuf JSON mapping, like
+     *   {"createAccount": {"accountName": "a", "domainId": "test", ...}}
+     * An element which is an array of commands is one transaction of them,
+     * any other element is a transaction of one command.
+     * @return the commands or the description of the first invalid element
+     */
+    iroha::expected::Result<CommandLists, std::string> parseJsonCommands(
+        std::istream &input);
+
+    /// read the command file in JSON if its name ends with .json, in CSV
+    /// otherwise
+    iroha::expected::Result<CommandLists, std::string> readCommandFile(
+        const std::string &path);
+
+  }  // namespace load
+}  // namespace iroha_cli
+
+#endif  // IROHA_CLI_COMMAND_FILE_HPP
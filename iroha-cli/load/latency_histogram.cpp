@@ -0,0 +1,129 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "load/latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+  /// each bucket has 2^11 sub-buckets, the upper half of which is used by
+  /// all buckets but the first one
+  constexpr unsigned kSubBucketBits = 11;
+  constexpr uint64_t kSubBucketHalf = uint64_t{1} << (kSubBucketBits - 1);
+
+  size_t bitLength(uint64_t value) {
+    size_t length = 0;
+    for (; value != 0; value >>= 1) {
+      ++length;
+    }
+    return length;
+  }
+
+  size_t indexOf(uint64_t value) {
+    auto bucket = bitLength(value) > kSubBucketBits
+        ? bitLength(value) - kSubBucketBits
+        : 0;
+    return bucket * kSubBucketHalf + (value >> bucket);
+  }
+
+  /// @return the greatest value counted by the index
+  uint64_t highestValueOf(size_t index) {
+    uint64_t bucket =
+        index < 2 * kSubBucketHalf ? 0 : index / kSubBucketHalf - 1;
+    uint64_t sub_bucket = index - bucket * kSubBucketHalf;
+    return ((sub_bucket + 1) << bucket) - 1;
+  }
+}  // namespace
+
+namespace iroha_cli {
+  namespace load {
+
+    void LatencyHistogram::record(uint64_t value) {
+      auto index = indexOf(value);
+      if (index >= counts_.size()) {
+        counts_.resize(index + 1);
+      }
+      ++counts_[index];
+      min_ = count_ == 0 ? value : std::min(min_, value);
+      max_ = std::max(max_, value);
+      ++count_;
+      sum_ += value;
+    }
+
+    void LatencyHistogram::merge(const LatencyHistogram &other) {
+      if (other.count_ == 0) {
+        return;
+      }
+      if (other.counts_.size() > counts_.size()) {
+        counts_.resize(other.counts_.size());
+      }
+      for (size_t i = 0; i < other.counts_.size(); ++i) {
+        counts_[i] += other.counts_[i];
+      }
+      min_ = count_ == 0 ? other.min_ : std::min(min_, other.min_);
+      max_ = std::max(max_, other.max_);
+      count_ += other.count_;
+      sum_ += other.sum_;
+    }
+
+    uint64_t LatencyHistogram::count() const {
+      return count_;
+    }
+
+    uint64_t LatencyHistogram::min() const {
+      return min_;
+    }
+
+    uint64_t LatencyHistogram::max() const {
+      return max_;
+    }
+
+    double LatencyHistogram::mean() const {
+      return count_ == 0 ? 0. : static_cast<double>(sum_ / count_);
+    }
+
+    uint64_t LatencyHistogram::valueAtPercentile(double percentile) const {
+      return at(percentile).value;
+    }
+
+    LatencyHistogram::Percentile LatencyHistogram::at(
+        double percentile) const {
+      percentile = std::min(std::max(percentile, 0.), 100.);
+      auto target = std::max<uint64_t>(
+          1, static_cast<uint64_t>(std::ceil(percentile / 100. * count_)));
+      uint64_t total = 0;
+      for (size_t i = 0; i < counts_.size(); ++i) {
+        total += counts_[i];
+        if (total >= target) {
+          return {std::min(highestValueOf(i), max_), percentile, total};
+        }
+      }
+      return {0, percentile, 0};
+    }
+
+    std::vector<LatencyHistogram::Percentile> LatencyHistogram::distribution(
+        unsigned ticks_per_half_distance) const {
+      std::vector<Percentile> points;
+      if (count_ == 0) {
+        return points;
+      }
+      ticks_per_half_distance = std::max(ticks_per_half_distance, 1u);
+      double percentile = 0;
+      while (true) {
+        auto point = at(percentile);
+        if (point.total_count == count_) {
+          points.push_back({max_, 100., count_});
+          return points;
+        }
+        points.push_back(point);
+        auto halvings = std::floor(std::log2(100. / (100. - percentile)));
+        percentile +=
+            100. / std::pow(2., halvings + 1) / ticks_per_half_distance;
+      }
+    }
+
+  }  // namespace load
+}  // namespace iroha_cli
@@ -0,0 +1,74 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CLI_LATENCY_HISTOGRAM_HPP
+#define IROHA_CLI_LATENCY_HISTOGRAM_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace iroha_cli {
+  namespace load {
+
+    /**
+     * Histogram of the latencies with the layout of HdrHistogram: the values
+     * are counted in the buckets of the powers of two, each of which is
+     * split into the linear sub-buckets, so any value is kept with the
+     * relative error below 0.1% in the constant space
+     */
+    class LatencyHistogram {
+     public:
+      /// point of the percentile distribution
+      struct Percentile {
+        uint64_t value;
+        /// in range [0, 100]
+        double percentile;
+        /// number of the values up to this one
+        uint64_t total_count;
+      };
+
+      void record(uint64_t value);
+
+      /// add the values of another histogram
+      void merge(const LatencyHistogram &other);
+
+      uint64_t count() const;
+
+      uint64_t min() const;
+
+      uint64_t max() const;
+
+      double mean() const;
+
+      /**
+       * @param percentile - in range [0, 100]
+       * @return the greatest value, which is equivalent to the value at the
+       * percentile, 0 if there are no values
+       */
+      uint64_t valueAtPercentile(double percentile) const;
+
+      /**
+       * Percentile distribution as it is printed by HdrHistogram, in which
+       * the steps of the percentile are halved each time the distance to
+       * 100% halves
+       * @param ticks_per_half_distance - number of the steps between halvings
+       */
+      std::vector<Percentile> distribution(
+          unsigned ticks_per_half_distance = 5) const;
+
+     private:
+      Percentile at(double percentile) const;
+
+      std::vector<uint64_t> counts_;
+      uint64_t count_ = 0;
+      uint64_t min_ = 0;
+      uint64_t max_ = 0;
+      long double sum_ = 0;
+    };
+
+  }  // namespace load
+}  // namespace iroha_cli
+
+#endif  // IROHA_CLI_LATENCY_HISTOGRAM_HPP
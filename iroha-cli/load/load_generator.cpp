@@ -0,0 +1,318 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "load/load_generator.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "backend/protobuf/transaction.hpp"
+#include "cryptography/crypto_provider/crypto_signer.hpp"
+#include "cryptography/hash.hpp"
+#include "datetime/time.hpp"
+#include "logger/logger.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+  /// operation of a call on the completion queue, which is its tag
+  class Operation {
+   public:
+    /// continue the call after the operation completed
+    virtual void proceed(bool ok) = 0;
+
+    virtual ~Operation() = default;
+  };
+
+  /// state of the run, which is changed on the queue thread only
+  struct RunState {
+    iroha::protocol::CommandService_v1::StubInterface &stub;
+    grpc::CompletionQueue &queue;
+    std::chrono::milliseconds status_timeout;
+    iroha_cli::load::LoadReport report;
+    Clock::time_point last_status;
+    logger::LoggerPtr log;
+
+    std::mutex mutex;
+    std::condition_variable calls_done;
+    /// changed from both the sending and the queue threads
+    size_t calls = 0;
+
+    void started(size_t count) {
+      std::lock_guard<std::mutex> lock(mutex);
+      calls += count;
+    }
+
+    void finished() {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (--calls == 0) {
+        calls_done.notify_all();
+      }
+    }
+  };
+
+  /// status stream of a sent transaction, which is read till the final
+  /// status
+  class StatusCall : public Operation {
+   public:
+    StatusCall(RunState &state,
+               const std::string &hash,
+               Clock::time_point sent_at)
+        : state_(state), sent_at_(sent_at) {
+      request_.set_tx_hash(hash);
+      context_.set_deadline(std::chrono::system_clock::now()
+                            + state_.status_timeout);
+      reader_ = state_.stub.AsyncStatusStream(
+          &context_, request_, &state_.queue, this);
+    }
+
+    void proceed(bool ok) override {
+      if (stage_ == Stage::kFinishing) {
+        if (not final_) {
+          ++state_.report.failed;
+        }
+        state_.finished();
+        delete this;
+        return;
+      }
+      if (stage_ == Stage::kReading and ok and not final_) {
+        handleStatus();
+      }
+      if (ok) {
+        stage_ = Stage::kReading;
+        reader_->Read(&response_, this);
+      } else {
+        stage_ = Stage::kFinishing;
+        reader_->Finish(&status_, this);
+      }
+    }
+
+   private:
+    enum class Stage { kStarting, kReading, kFinishing };
+
+    void handleStatus() {
+      using iroha::protocol::TxStatus;
+      switch (response_.tx_status()) {
+        case TxStatus::COMMITTED:
+          ++state_.report.committed;
+          state_.report.commit_latency.record(
+              std::chrono::duration_cast<std::chrono::microseconds>(
+                  Clock::now() - sent_at_)
+                  .count());
+          break;
+        case TxStatus::STATELESS_VALIDATION_FAILED:
+        case TxStatus::STATEFUL_VALIDATION_FAILED:
+        case TxStatus::REJECTED:
+        case TxStatus::MST_EXPIRED:
+          ++state_.report.rejected;
+          state_.log->debug("Transaction {} is not committed: {}",
+                            request_.tx_hash(),
+                            response_.err_or_cmd_name());
+          break;
+        default:
+          return;
+      }
+      final_ = true;
+      state_.last_status = Clock::now();
+    }
+
+    RunState &state_;
+    Clock::time_point sent_at_;
+    grpc::ClientContext context_;
+    iroha::protocol::TxStatusRequest request_;
+    iroha::protocol::ToriiResponse response_;
+    grpc::Status status_;
+    std::unique_ptr<
+        grpc::ClientAsyncReaderInterface<iroha::protocol::ToriiResponse>>
+        reader_;
+    Stage stage_ = Stage::kStarting;
+    bool final_ = false;
+  };
+
+  /// Torii or ListTorii call, which starts the status streams of the sent
+  /// transactions on success
+  class SendCall : public Operation {
+   public:
+    SendCall(RunState &state,
+             const iroha::protocol::TxList &batch,
+             const std::string *hashes)
+        : state_(state), hashes_(hashes), sent_at_(Clock::now()) {
+      size_ = batch.transactions_size();
+      if (size_ == 1) {
+        reader_ = state_.stub.AsyncTorii(
+            &context_, batch.transactions(0), &state_.queue);
+      } else {
+        reader_ = state_.stub.AsyncListTorii(&context_, batch, &state_.queue);
+      }
+      reader_->Finish(&response_, &status_, this);
+    }
+
+    void proceed(bool ok) override {
+      if (ok and status_.ok()) {
+        state_.report.sent += size_;
+        state_.started(size_);
+        for (size_t i = 0; i < size_; ++i) {
+          new StatusCall(state_, hashes_[i], sent_at_);
+        }
+      } else {
+        state_.report.failed += size_;
+        state_.log->warn("Failed to send {} transactions: {}",
+                         size_,
+                         status_.error_message());
+      }
+      state_.finished();
+      delete this;
+    }
+
+   private:
+    RunState &state_;
+    const std::string *hashes_;
+    size_t size_;
+    Clock::time_point sent_at_;
+    grpc::ClientContext context_;
+    google::protobuf::Empty response_;
+    grpc::Status status_;
+    std::unique_ptr<
+        grpc::ClientAsyncResponseReaderInterface<google::protobuf::Empty>>
+        reader_;
+  };
+
+}  // namespace
+
+namespace iroha_cli {
+  namespace load {
+
+    double LoadReport::throughput() const {
+      return duration.count() == 0 ? 0. : committed * 1e6 / duration.count();
+    }
+
+    LoadGenerator::LoadGenerator(
+        std::unique_ptr<iroha::protocol::CommandService_v1::StubInterface>
+            stub,
+        LoadConfig config,
+        shared_model::crypto::Keypair keypair,
+        logger::LoggerPtr log)
+        : stub_(std::move(stub)),
+          config_(std::move(config)),
+          keypair_(std::move(keypair)),
+          log_(std::move(log)) {
+      config_.batch_size = std::max<size_t>(config_.batch_size, 1);
+      config_.signing_threads = std::max<size_t>(config_.signing_threads, 1);
+    }
+
+    void LoadGenerator::prepare() {
+      sign(config_.transactions, [this](size_t i, ReducedPayload &payload) {
+        auto transfer = payload.add_commands()->mutable_transfer_asset();
+        transfer->set_src_account_id(config_.creator_account_id);
+        transfer->set_dest_account_id(config_.dest_account_id);
+        transfer->set_asset_id(config_.asset_id);
+        // the descriptions make the hashes of the transactions different
+        transfer->set_description("load " + std::to_string(i));
+        transfer->set_amount(config_.amount);
+      });
+    }
+
+    void LoadGenerator::prepare(const CommandLists &transactions) {
+      sign(transactions.size(),
+           [&transactions](size_t i, ReducedPayload &payload) {
+             for (const auto &command : transactions[i]) {
+               *payload.add_commands() = command;
+             }
+           });
+    }
+
+    void LoadGenerator::sign(
+        size_t count, std::function<void(size_t, ReducedPayload &)> fill) {
+      auto started = Clock::now();
+      std::vector<iroha::protocol::Transaction> transactions(count);
+      hashes_.resize(count);
+      auto created_time = iroha::time::now();
+
+      auto sign_every = [&](size_t first) {
+        for (size_t i = first; i < transactions.size();
+             i += config_.signing_threads) {
+          iroha::protocol::Transaction proto;
+          auto payload = proto.mutable_payload()->mutable_reduced_payload();
+          payload->set_creator_account_id(config_.creator_account_id);
+          payload->set_created_time(created_time);
+          payload->set_quorum(1);
+          fill(i, *payload);
+
+          shared_model::proto::Transaction transaction(std::move(proto));
+          transaction.addSignature(
+              shared_model::crypto::CryptoSigner<>::sign(
+                  shared_model::crypto::Blob(transaction.payload()), keypair_),
+              keypair_.publicKey());
+          hashes_[i] = transaction.hash().hex();
+          transactions[i] = transaction.getTransport();
+        }
+      };
+      std::vector<std::thread> threads;
+      for (size_t i = 1; i < config_.signing_threads; ++i) {
+        threads.emplace_back(sign_every, i);
+      }
+      sign_every(0);
+      for (auto &thread : threads) {
+        thread.join();
+      }
+
+      batches_.clear();
+      for (size_t i = 0; i < transactions.size(); i += config_.batch_size) {
+        batches_.emplace_back();
+        auto end = std::min(transactions.size(), i + config_.batch_size);
+        for (size_t j = i; j < end; ++j) {
+          batches_.back().add_transactions()->Swap(&transactions[j]);
+        }
+      }
+
+      log_->info("Signed {} transactions in {} ms",
+                 transactions.size(),
+                 std::chrono::duration_cast<std::chrono::milliseconds>(
+                     Clock::now() - started)
+                     .count());
+    }
+
+    LoadReport LoadGenerator::run() {
+      grpc::CompletionQueue queue;
+      RunState state{*stub_, queue, config_.status_timeout, {}, {}, log_};
+      std::thread queue_thread([&queue] {
+        void *tag;
+        bool ok;
+        while (queue.Next(&tag, &ok)) {
+          static_cast<Operation *>(tag)->proceed(ok);
+        }
+      });
+
+      // the batches are sent at the moments evenly spaced by the rate
+      std::chrono::duration<double> period(
+          config_.rate > 0 ? config_.batch_size / config_.rate : 0.);
+      auto started = Clock::now();
+      state.last_status = started;
+      for (size_t i = 0; i < batches_.size(); ++i) {
+        std::this_thread::sleep_until(
+            started
+            + std::chrono::duration_cast<Clock::duration>(period * i));
+        state.started(1);
+        new SendCall(state, batches_[i], &hashes_[i * config_.batch_size]);
+      }
+
+      {
+        std::unique_lock<std::mutex> lock(state.mutex);
+        state.calls_done.wait(lock, [&state] { return state.calls == 0; });
+      }
+      queue.Shutdown();
+      queue_thread.join();
+
+      state.report.duration =
+          std::chrono::duration_cast<std::chrono::microseconds>(
+              state.last_status - started);
+      return std::move(state.report);
+    }
+
+  }  // namespace load
+}  // namespace iroha_cli
@@ -0,0 +1,106 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CLI_LOAD_GENERATOR_HPP
+#define IROHA_CLI_LOAD_GENERATOR_HPP
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <endpoint.grpc.pb.h>
+#include "cryptography/keypair.hpp"
+#include "load/command_file.hpp"
+#include "load/latency_histogram.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha_cli {
+  namespace load {
+
+    /// transactions to be sent and the way to send them
+    struct LoadConfig {
+      std::string creator_account_id;
+      std::string dest_account_id;
+      std::string asset_id;
+      std::string amount;
+      /// number of the transactions
+      size_t transactions;
+      /// number of the transactions sent with one ListTorii call, the
+      /// transactions are sent one by one with Torii if it is 1
+      size_t batch_size;
+      /// transactions per second, 0 to send without a limit
+      double rate;
+      /// number of the threads which sign the transactions
+      size_t signing_threads;
+      /// time to wait for the final status of a transaction
+      std::chrono::milliseconds status_timeout;
+    };
+
+    /// outcome of the load
+    struct LoadReport {
+      size_t sent = 0;
+      size_t committed = 0;
+      /// transactions with a final status other than committed
+      size_t rejected = 0;
+      /// transactions which were not sent or whose status was not received
+      size_t failed = 0;
+      /// from the first transaction sent till the last status received
+      std::chrono::microseconds duration{0};
+      /// microseconds from sending a transaction till its commit
+      LatencyHistogram commit_latency;
+
+      /// @return committed transactions per second
+      double throughput() const;
+    };
+
+    /**
+     * Generator of the load on Torii of a peer. The transactions are signed
+     * in advance, so the signing does not limit the rate, and are sent on
+     * a completion queue, which also receives their status streams
+     */
+    class LoadGenerator {
+     public:
+      LoadGenerator(
+          std::unique_ptr<iroha::protocol::CommandService_v1::StubInterface>
+              stub,
+          LoadConfig config,
+          shared_model::crypto::Keypair keypair,
+          logger::LoggerPtr log);
+
+      /// sign the transactions of the load in parallel
+      void prepare();
+
+      /// sign the transactions of the given commands in parallel instead of
+      /// the transfers of the config
+      void prepare(const CommandLists &transactions);
+
+      /// send the prepared transactions and wait for their final statuses
+      LoadReport run();
+
+     private:
+      using ReducedPayload =
+          iroha::protocol::Transaction::Payload::ReducedPayload;
+
+      /// sign the given number of the transactions, whose commands are set by
+      /// the fill function from the index of a transaction
+      void sign(size_t count,
+                std::function<void(size_t, ReducedPayload &)> fill);
+
+      std::unique_ptr<iroha::protocol::CommandService_v1::StubInterface> stub_;
+      LoadConfig config_;
+      shared_model::crypto::Keypair keypair_;
+      logger::LoggerPtr log_;
+      /// transactions of each call
+      std::vector<iroha::protocol::TxList> batches_;
+      /// hex hashes of all transactions in the order of the batches
+      std::vector<std::string> hashes_;
+    };
+
+  }  // namespace load
+}  // namespace iroha_cli
+
+#endif  // IROHA_CLI_LOAD_GENERATOR_HPP
@@ -0,0 +1,120 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+#include <gflags/gflags.h>
+#include "crypto/keys_manager_impl.hpp"
+#include "load/load_generator.hpp"
+#include "load/report_writer.hpp"
+#include "logger/logger.hpp"
+#include "logger/logger_manager.hpp"
+#include "network/impl/grpc_channel_builder.hpp"
+
+// Iroha peer to load
+DEFINE_string(peer_ip, "0.0.0.0", "Address of the Iroha node");
+DEFINE_int32(torii_port, 50051, "Port of Iroha's Torii");
+
+// Transactions of the load
+DEFINE_string(account_name,
+              "admin@test",
+              "Account which sends the transactions, its keys are loaded "
+              "from the key path");
+DEFINE_string(key_path, ".", "Path to the keys of the account");
+DEFINE_string(dest_account, "test@test", "Receiver of the transfers");
+DEFINE_string(asset_id, "coin#test", "Transferred asset");
+DEFINE_string(amount, "0.01", "Transferred amount");
+DEFINE_uint64(transactions, 10000, "Number of the transactions");
+DEFINE_uint64(batch_size,
+              1,
+              "Number of the transactions sent with one ListTorii call, "
+              "1 to send them with Torii");
+DEFINE_double(rate, 1000, "Transactions per second, 0 for no limit");
+DEFINE_uint64(signing_threads,
+              std::thread::hardware_concurrency(),
+              "Number of the threads signing the transactions");
+DEFINE_uint64(status_timeout_ms,
+              60000,
+              "Time to wait for the final status of a transaction");
+
+// Report
+DEFINE_string(output, "", "File of the report, standard output if empty");
+DEFINE_string(format, "csv", "Format of the report: csv or json");
+
+int main(int argc, char *argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  gflags::ShutDownCommandLineFlags();
+  auto log_manager = std::make_shared<logger::LoggerManagerTree>(
+                         logger::LoggerConfig{logger::LogLevel::kInfo,
+                                              logger::getDefaultLogPatterns()})
+                         ->getChild("Load");
+  auto log = log_manager->getChild("Main")->getLogger();
+
+  if (FLAGS_format != "csv" and FLAGS_format != "json") {
+    log->error("Unknown report format {}", FLAGS_format);
+    return EXIT_FAILURE;
+  }
+
+  auto keypair = iroha::KeysManagerImpl(
+                     FLAGS_account_name,
+                     FLAGS_key_path,
+                     log_manager->getChild("KeysManager")->getLogger())
+                     .loadKeys();
+  if (not keypair) {
+    log->error("Failed to load the keys of {}", FLAGS_account_name);
+    return EXIT_FAILURE;
+  }
+
+  iroha_cli::load::LoadGenerator generator(
+      iroha::network::createClient<iroha::protocol::CommandService_v1>(
+          FLAGS_peer_ip + ":" + std::to_string(FLAGS_torii_port)),
+      iroha_cli::load::LoadConfig{
+          FLAGS_account_name,
+          FLAGS_dest_account,
+          FLAGS_asset_id,
+          FLAGS_amount,
+          FLAGS_transactions,
+          FLAGS_batch_size,
+          FLAGS_rate,
+          FLAGS_signing_threads,
+          std::chrono::milliseconds(FLAGS_status_timeout_ms)},
+      std::move(*keypair),
+      log_manager->getChild("Generator")->getLogger());
+
+  generator.prepare();
+  log->info("Sending {} transactions to {}:{}",
+            FLAGS_transactions,
+            FLAGS_peer_ip,
+            FLAGS_torii_port);
+  auto report = generator.run();
+  log->info(
+      "Committed {} of {} transactions, {} rejected, {} failed, "
+      "{:.1f} tx/s, median commit latency {} us",
+      report.committed,
+      FLAGS_transactions,
+      report.rejected,
+      report.failed,
+      report.throughput(),
+      report.commit_latency.valueAtPercentile(50));
+
+  std::ofstream file;
+  if (not FLAGS_output.empty()) {
+    file.open(FLAGS_output);
+    if (not file) {
+      log->error("Failed to open {}", FLAGS_output);
+      return EXIT_FAILURE;
+    }
+  }
+  auto &out = FLAGS_output.empty() ? std::cout : file;
+  if (FLAGS_format == "json") {
+    iroha_cli::load::writeJson(out, report);
+  } else {
+    iroha_cli::load::writeCsv(out, report);
+  }
+
+  return report.committed == FLAGS_transactions ? EXIT_SUCCESS : EXIT_FAILURE;
+}
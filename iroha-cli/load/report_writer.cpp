@@ -0,0 +1,67 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "load/report_writer.hpp"
+
+#include <iomanip>
+#include <limits>
+
+namespace iroha_cli {
+  namespace load {
+
+    void writeCsv(std::ostream &out, const LoadReport &report) {
+      const auto &latency = report.commit_latency;
+      out << "#sent," << report.sent << "\n#committed," << report.committed
+          << "\n#rejected," << report.rejected << "\n#failed,"
+          << report.failed << "\n#duration_us," << report.duration.count()
+          << "\n#throughput_tps," << report.throughput()
+          << "\n#mean_latency_us," << latency.mean()
+          << "\n\"Value\",\"Percentile\",\"TotalCount\","
+             "\"1/(1-Percentile)\"\n";
+      out << std::fixed;
+      for (const auto &point : latency.distribution()) {
+        auto fraction = point.percentile / 100.;
+        out << point.value << ',' << std::setprecision(12) << fraction << ','
+            << point.total_count << ',' << std::setprecision(2);
+        if (fraction < 1.) {
+          out << 1. / (1. - fraction);
+        } else {
+          out << "Infinity";
+        }
+        out << '\n';
+      }
+      out << std::defaultfloat;
+    }
+
+    void writeJson(std::ostream &out, const LoadReport &report) {
+      const auto &latency = report.commit_latency;
+      out << "{\"sent\":" << report.sent
+          << ",\"committed\":" << report.committed
+          << ",\"rejected\":" << report.rejected
+          << ",\"failed\":" << report.failed
+          << ",\"duration_us\":" << report.duration.count()
+          << ",\"throughput_tps\":" << report.throughput()
+          << ",\"commit_latency_us\":{\"count\":" << latency.count()
+          << ",\"min\":" << latency.min() << ",\"max\":" << latency.max()
+          << ",\"mean\":" << latency.mean();
+      for (auto percentile : {50., 90., 99., 99.9}) {
+        out << ",\"p" << percentile
+            << "\":" << latency.valueAtPercentile(percentile);
+      }
+      out << ",\"distribution\":[";
+      bool first = true;
+      for (const auto &point : latency.distribution()) {
+        out << (first ? "" : ",") << "{\"value\":" << point.value
+            << ",\"percentile\":"
+            << std::setprecision(std::numeric_limits<double>::digits10)
+            << point.percentile << ",\"total_count\":" << point.total_count
+            << '}';
+        first = false;
+      }
+      out << "]}}\n";
+    }
+
+  }  // namespace load
+}  // namespace iroha_cli
@@ -0,0 +1,29 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CLI_REPORT_WRITER_HPP
+#define IROHA_CLI_REPORT_WRITER_HPP
+
+#include <ostream>
+
+#include "load/load_generator.hpp"
+
+namespace iroha_cli {
+  namespace load {
+
+    /**
+     * Write the percentile distribution of the commit latency in the CSV
+     * format of HdrHistogram, preceded by the commented out totals, so the
+     * output is accepted by the HdrHistogram plotters
+     */
+    void writeCsv(std::ostream &out, const LoadReport &report);
+
+    /// write the totals and the percentile distribution as a JSON object
+    void writeJson(std::ostream &out, const LoadReport &report);
+
+  }  // namespace load
+}  // namespace iroha_cli
+
+#endif  // IROHA_CLI_REPORT_WRITER_HPP
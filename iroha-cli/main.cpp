@@ -8,6 +8,7 @@
 #include <rapidjson/rapidjson.h>
 #include <boost/filesystem.hpp>
 #include <iostream>
+#include <thread>
 
 #include "backend/protobuf/proto_block_json_converter.hpp"
 #include "backend/protobuf/queries/proto_query.hpp"
@@ -18,6 +19,7 @@
 #include "crypto/keys_manager_impl.hpp"
 #include "grpc_response_handler.hpp"
 #include "interactive/interactive_cli.hpp"
+#include "load/load_generator.hpp"
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
 #include "model/converters/json_block_factory.hpp"
@@ -27,6 +29,7 @@
 #include "model/converters/pb_transaction_factory.hpp"
 #include "model/generators/block_generator.hpp"
 #include "model/model_crypto_provider_impl.hpp"
+#include "network/impl/grpc_channel_builder.hpp"
 
 // Account information
 DEFINE_bool(new_account,
@@ -58,6 +61,25 @@ DEFINE_string(peers_address,
               "",
               "File with peers address for new Iroha network");
 
+// Send the transactions of a command file on behalf of the account
+DEFINE_string(batch_file,
+              "",
+              "File of the commands to send, JSON if its name ends with "
+              ".json and CSV otherwise");
+DEFINE_uint64(batch_chunk_size,
+              100,
+              "Number of the transactions sent with one ListTorii call");
+DEFINE_double(batch_rate,
+              0,
+              "Transactions per second sent in batch mode, 0 for no limit");
+DEFINE_uint64(signing_threads,
+              std::thread::hardware_concurrency(),
+              "Number of the threads signing the transactions in batch mode");
+DEFINE_uint64(status_timeout_ms,
+              600000,
+              "Time to wait for the final status of a transaction in batch "
+              "mode");
+
 // Run iroha-cli in interactive mode
 DEFINE_bool(interactive, true, "Run iroha-cli in interactive mode");
 
@@ -207,6 +229,67 @@ int main(int argc, char *argv[]) {
       }
     }
   }
+  // Sign the transactions of the command file and send them in chunks
+  else if (not FLAGS_batch_file.empty()) {
+    if (FLAGS_account_name.empty()) {
+      logger->error("Specify your account name");
+      return EXIT_FAILURE;
+    }
+    auto commands = iroha_cli::load::readCommandFile(FLAGS_batch_file);
+    if (auto error = iroha::expected::resultToOptionalError(commands)) {
+      logger->error("Invalid command file {}: {}", FLAGS_batch_file, *error);
+      return EXIT_FAILURE;
+    }
+    const auto transactions =
+        *iroha::expected::resultToOptionalValue(std::move(commands));
+    iroha::KeysManagerImpl manager(
+        (fs::path(FLAGS_key_path) / FLAGS_account_name).string(),
+        keys_manager_log);
+    auto keypair = FLAGS_pass_phrase.size() != 0
+        ? manager.loadKeys(FLAGS_pass_phrase)
+        : manager.loadKeys();
+    if (not keypair) {
+      logger->error("Cannot load the keypair of {} from {}",
+                    FLAGS_account_name,
+                    FLAGS_key_path);
+      return EXIT_FAILURE;
+    }
+
+    iroha_cli::load::LoadGenerator generator(
+        iroha::network::createClient<iroha::protocol::CommandService_v1>(
+            FLAGS_peer_ip + ":" + std::to_string(FLAGS_torii_port)),
+        iroha_cli::load::LoadConfig{
+            FLAGS_account_name,
+            {},
+            {},
+            {},
+            transactions.size(),
+            FLAGS_batch_chunk_size,
+            FLAGS_batch_rate,
+            FLAGS_signing_threads,
+            std::chrono::milliseconds(FLAGS_status_timeout_ms)},
+        std::move(*keypair),
+        log_manager->getChild("Batch")->getLogger());
+    generator.prepare(transactions);
+    logger->info("Sending {} transactions to {}:{}",
+                 transactions.size(),
+                 FLAGS_peer_ip,
+                 FLAGS_torii_port);
+    auto report = generator.run();
+    logger->info(
+        "Committed {} of {} transactions, {} rejected, {} failed in {} ms, "
+        "{:.1f} tx/s, commit latency p50 {} us, p99 {} us",
+        report.committed,
+        transactions.size(),
+        report.rejected,
+        report.failed,
+        report.duration.count() / 1000,
+        report.throughput(),
+        report.commit_latency.valueAtPercentile(50),
+        report.commit_latency.valueAtPercentile(99));
+    return report.committed == transactions.size() ? EXIT_SUCCESS
+                                                   : EXIT_FAILURE;
+  }
   // Run iroha-cli in interactive mode
   else if (FLAGS_interactive) {
     if (FLAGS_account_name.empty()) {
@@ -0,0 +1,45 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BLOCK_HEADER_HPP
+#define IROHA_BLOCK_HEADER_HPP
+
+#include <boost/range/distance.hpp>
+#include "cryptography/hash.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Fields of a block which are checked without its transactions and
+     * signatures
+     */
+    struct BlockHeader {
+      shared_model::interface::types::HeightType height;
+      shared_model::crypto::Hash hash;
+      shared_model::crypto::Hash prev_hash;
+      shared_model::interface::types::TimestampType created_time;
+      shared_model::interface::types::TransactionsNumberType tx_count;
+      size_t rejected_count;
+    };
+
+    /// @return the header of the block
+    inline BlockHeader makeBlockHeader(
+        const shared_model::interface::Block &block) {
+      return BlockHeader{
+          block.height(),
+          block.hash(),
+          block.prevHash(),
+          block.createdTime(),
+          block.txsNumber(),
+          static_cast<size_t>(
+              boost::distance(block.rejected_transactions_hashes()))};
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_BLOCK_HEADER_HPP
@@ -6,7 +6,10 @@
 #ifndef IROHA_BLOCK_QUERY_HPP
 #define IROHA_BLOCK_QUERY_HPP
 
+#include <vector>
+
 #include <boost/optional.hpp>
+#include "ametsuchi/block_header.hpp"
 #include "ametsuchi/tx_cache_response.hpp"
 #include "common/result.hpp"
 #include "interfaces/iroha_internal/block.hpp"
@@ -32,6 +35,11 @@ namespace iroha {
           expected::Result<std::unique_ptr<shared_model::interface::Block>,
                            GetBlockError>;
 
+      using SerializedBlockResult =
+          expected::Result<std::string, GetBlockError>;
+
+      using BlockHeaderResult = expected::Result<BlockHeader, GetBlockError>;
+
       virtual ~BlockQuery() = default;
 
       /**
@@ -42,6 +50,23 @@ namespace iroha {
       virtual BlockResult getBlock(
           shared_model::interface::types::HeightType height) = 0;
 
+      /**
+       * Retrieve block with given height in the protobuf binary form
+       * @param height - height of a block to retrieve
+       * @return serialized block with given height
+       */
+      virtual SerializedBlockResult getSerializedBlock(
+          shared_model::interface::types::HeightType height) = 0;
+
+      /**
+       * Retrieve the header of the block with given height, the headers of
+       * the recent blocks are read without loading the blocks
+       * @param height - height of a block to retrieve
+       * @return header of the block with given height
+       */
+      virtual BlockHeaderResult getBlockHeader(
+          shared_model::interface::types::HeightType height) = 0;
+
       /**
        * Get height of the top block.
        * @return height
@@ -59,6 +84,16 @@ namespace iroha {
        */
       virtual boost::optional<TxCacheStatusType> checkTxPresence(
           const shared_model::crypto::Hash &hash) = 0;
+
+      /**
+       * Synchronously checks whether transactions with given hashes are
+       * present in any block with a single query to the storage
+       * @param hashes - transactions' hashes
+       * @return statuses of the transactions in the order of the hashes if
+       * storage query was successful, boost::none otherwise
+       */
+      virtual boost::optional<std::vector<TxCacheStatusType>> checkTxsPresence(
+          const std::vector<shared_model::crypto::Hash> &hashes) = 0;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -11,7 +11,10 @@
 #include <memory>
 
 #include <boost/optional.hpp>
+#include "ametsuchi/block_header.hpp"
+#include "common/bind.hpp"
 #include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -36,6 +39,50 @@ namespace iroha {
           std::shared_ptr<const shared_model::interface::Block>>
       fetch(shared_model::interface::types::HeightType height) const = 0;
 
+      /**
+       * Get block with given height in the protobuf binary form, which is
+       * sent over the network without rebuilding the block
+       * @return serialized block if exists, boost::none otherwise
+       */
+      virtual boost::optional<std::string> fetchSerialized(
+          shared_model::interface::types::HeightType height) const {
+        return fetch(height) | [](const auto &block) {
+          return boost::make_optional(
+              shared_model::crypto::toBinaryString(block->blob()));
+        };
+      }
+
+      /**
+       * Get header of the block with given height
+       * @return header if the block exists, boost::none otherwise
+       */
+      virtual boost::optional<BlockHeader> fetchHeader(
+          shared_model::interface::types::HeightType height) const {
+        return fetch(height) | [](const auto &block) {
+          return boost::make_optional(makeBlockHeader(*block));
+        };
+      }
+
+      /**
+       * Get transaction of the block with given height by its index in the
+       * block
+       * @return transaction if exists, boost::none otherwise
+       */
+      virtual boost::optional<
+          std::unique_ptr<shared_model::interface::Transaction>>
+      fetchTransaction(shared_model::interface::types::HeightType height,
+                       size_t index) const {
+        auto block = fetch(height);
+        if (not block) {
+          return boost::none;
+        }
+        auto transactions = (*block)->transactions();
+        if (index >= static_cast<size_t>(transactions.size())) {
+          return boost::none;
+        }
+        return boost::make_optional(clone(transactions[index]));
+      }
+
       /**
        * Returns the size of the storage
        */
@@ -55,6 +102,14 @@ namespace iroha {
        */
       virtual void forEach(FunctionType function) const = 0;
 
+      /**
+       * Make the inserted blocks durable
+       * @return true if the blocks are written to the disk
+       */
+      virtual bool flush() {
+        return true;
+      }
+
       virtual ~BlockStorage() = default;
     };
 
@@ -0,0 +1,45 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/account_assets_count_cache.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    AccountAssetsCountCache::AccountAssetsCountCache(size_t capacity)
+        : capacity_(capacity), height_(0) {}
+
+    boost::optional<AccountAssetsCountCache::Entry>
+    AccountAssetsCountCache::find(
+        const shared_model::interface::types::AccountIdType &account_id)
+        const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = counts_.find(account_id);
+      if (it == counts_.end()) {
+        return boost::none;
+      }
+      return Entry{height_, it->second};
+    }
+
+    void AccountAssetsCountCache::put(
+        const shared_model::interface::types::AccountIdType &account_id,
+        shared_model::interface::types::HeightType height,
+        size_t count) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (height < height_) {
+        return;
+      }
+      if (height > height_) {
+        counts_.clear();
+        height_ = height;
+      }
+      if (counts_.size() >= capacity_ and counts_.count(account_id) == 0) {
+        return;
+      }
+      counts_[account_id] = count;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
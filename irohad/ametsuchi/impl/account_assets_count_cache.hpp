@@ -0,0 +1,64 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ACCOUNT_ASSETS_COUNT_CACHE_HPP
+#define IROHA_ACCOUNT_ASSETS_COUNT_CACHE_HPP
+
+#include <mutex>
+#include <unordered_map>
+
+#include <boost/optional.hpp>
+#include "interfaces/common_objects/types.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Numbers of the assets of the accounts, which every page of
+     * GetAccountAssets reports. The committed WSV changes only with the
+     * height of the ledger, so a number read at a height is valid until the
+     * next block. The cache keeps the numbers of the latest height it has
+     * seen, and the query compares the height with the one of its own
+     * snapshot, so a lagging replica never takes a number of another height
+     */
+    class AccountAssetsCountCache {
+     public:
+      struct Entry {
+        shared_model::interface::types::HeightType height;
+        size_t count;
+      };
+
+      /**
+       * @param capacity - maximal number of the accounts of a height
+       */
+      explicit AccountAssetsCountCache(size_t capacity);
+
+      /// @return the number of the assets and its height, or none
+      boost::optional<Entry> find(
+          const shared_model::interface::types::AccountIdType &account_id)
+          const;
+
+      /**
+       * Put the number read at the height. The numbers of the lower heights
+       * are dropped, and the ones of a height lower than the cached one are
+       * not put
+       */
+      void put(const shared_model::interface::types::AccountIdType &account_id,
+               shared_model::interface::types::HeightType height,
+               size_t count);
+
+     private:
+      const size_t capacity_;
+
+      mutable std::mutex mutex_;
+      shared_model::interface::types::HeightType height_;
+      std::unordered_map<shared_model::interface::types::AccountIdType, size_t>
+          counts_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_ACCOUNT_ASSETS_COUNT_CACHE_HPP
@@ -0,0 +1,272 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/block_compressor.hpp"
+
+#include <boost/filesystem.hpp>
+#include <zdict.h>
+#include <zstd.h>
+#include "ametsuchi/impl/block_file_format.hpp"
+#include "logger/logger.hpp"
+
+namespace {
+  /// size of the dictionary id which follows the header of the block file
+  constexpr size_t kDictionaryIdSize = 4;
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    constexpr BlockCompressor::HeightType
+        BlockCompressor::kDefaultSegmentBlocks;
+    constexpr BlockCompressor::HeightType
+        BlockCompressor::kDefaultTrainingBlocks;
+    constexpr size_t BlockCompressor::kDictionaryCapacity;
+    const std::string BlockCompressor::kDictionariesDirectory = "dictionaries";
+
+    void BlockCompressor::Deleter::operator()(ZSTD_CCtx *context) const {
+      ZSTD_freeCCtx(context);
+    }
+
+    void BlockCompressor::Deleter::operator()(ZSTD_DCtx *context) const {
+      ZSTD_freeDCtx(context);
+    }
+
+    void BlockCompressor::Deleter::operator()(ZSTD_CDict *dictionary) const {
+      ZSTD_freeCDict(dictionary);
+    }
+
+    void BlockCompressor::Deleter::operator()(ZSTD_DDict *dictionary) const {
+      ZSTD_freeDDict(dictionary);
+    }
+
+    boost::optional<std::unique_ptr<BlockCompressor>> BlockCompressor::create(
+        const std::string &block_store_path,
+        boost::optional<int32_t> level,
+        logger::LoggerPtr log,
+        HeightType segment_blocks,
+        HeightType training_blocks) {
+      auto path = (boost::filesystem::path(block_store_path)
+                   / kDictionariesDirectory)
+                      .string();
+      auto dictionaries = FlatFile::create(path, log);
+      if (not dictionaries) {
+        return boost::none;
+      }
+      std::unique_ptr<BlockCompressor> compressor(
+          new BlockCompressor(std::move(path),
+                              std::move(*dictionaries),
+                              level,
+                              std::move(log),
+                              segment_blocks,
+                              training_blocks));
+
+      if (auto id = compressor->dictionaries_->last_id()) {
+        auto dictionary = compressor->dictionaries_->get(id);
+        if (not dictionary) {
+          compressor->log_->error("Cannot read dictionary {}", id);
+          return boost::none;
+        }
+        std::lock_guard<std::mutex> lock(compressor->mutex_);
+        compressor->loadCompressionDictionary(id, *dictionary);
+      }
+      return boost::make_optional(std::move(compressor));
+    }
+
+    BlockCompressor::BlockCompressor(std::string dictionaries_path,
+                                     std::unique_ptr<FlatFile> dictionaries,
+                                     boost::optional<int32_t> level,
+                                     logger::LoggerPtr log,
+                                     HeightType segment_blocks,
+                                     HeightType training_blocks)
+        : dictionaries_path_(std::move(dictionaries_path)),
+          dictionaries_(std::move(dictionaries)),
+          level_(level),
+          log_(std::move(log)),
+          segment_blocks_(segment_blocks),
+          training_blocks_(training_blocks),
+          compression_context_(ZSTD_createCCtx()),
+          decompression_context_(ZSTD_createDCtx()),
+          compression_dictionary_id_(0) {}
+
+    BlockCompressor::~BlockCompressor() = default;
+
+    bool BlockCompressor::enabled() const {
+      return static_cast<bool>(level_);
+    }
+
+    BlockCompressor::DictionaryId BlockCompressor::dictionaryId(
+        HeightType height) const {
+      return (height - 1) / segment_blocks_ + 1;
+    }
+
+    boost::optional<
+        std::pair<BlockCompressor::HeightType, BlockCompressor::HeightType>>
+    BlockCompressor::trainingRange(HeightType height) const {
+      if (not enabled() or height == 0) {
+        return boost::none;
+      }
+      auto begin = (dictionaryId(height) - 1) * segment_blocks_ + 1;
+      if (height - begin != training_blocks_
+          or dictionaries_->blockIdentifiers().count(dictionaryId(height))
+              != 0) {
+        return boost::none;
+      }
+      return std::make_pair(begin, height);
+    }
+
+    void BlockCompressor::train(HeightType height,
+                                const std::vector<std::string> &samples) {
+      std::string buffer;
+      std::vector<size_t> sizes;
+      sizes.reserve(samples.size());
+      for (const auto &sample : samples) {
+        buffer.append(sample);
+        sizes.push_back(sample.size());
+      }
+
+      Bytes dictionary(kDictionaryCapacity);
+      auto size = ZDICT_trainFromBuffer(dictionary.data(),
+                                        dictionary.size(),
+                                        buffer.data(),
+                                        sizes.data(),
+                                        sizes.size());
+      auto id = dictionaryId(height);
+      if (ZDICT_isError(size)) {
+        log_->warn("Cannot train dictionary {} on {} blocks: {}",
+                   id,
+                   samples.size(),
+                   ZDICT_getErrorName(size));
+        return;
+      }
+      dictionary.resize(size);
+
+      if (not dictionaries_->add(id, dictionary)) {
+        log_->error("Cannot store dictionary {}", id);
+        return;
+      }
+      std::lock_guard<std::mutex> lock(mutex_);
+      loadCompressionDictionary(id, dictionary);
+      log_->info("Trained dictionary {} of {} bytes on {} blocks",
+                 id,
+                 size,
+                 samples.size());
+    }
+
+    void BlockCompressor::loadCompressionDictionary(DictionaryId id,
+                                                    const Bytes &dictionary) {
+      compression_dictionary_.reset(ZSTD_createCDict(
+          dictionary.data(), dictionary.size(), level_.value_or(0)));
+      compression_dictionary_id_ = compression_dictionary_ ? id : 0;
+    }
+
+    boost::optional<BlockCompressor::Bytes> BlockCompressor::compress(
+        const Bytes &serialized_block) {
+      auto block_file = block_file_format::header(
+          block_file_format::Version::kZstdV1);
+      auto frame_begin = block_file.size() + kDictionaryIdSize;
+      block_file.resize(frame_begin
+                        + ZSTD_compressBound(serialized_block.size()));
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (size_t i = 0; i < kDictionaryIdSize; ++i) {
+        block_file[frame_begin - kDictionaryIdSize + i] =
+            static_cast<uint8_t>(compression_dictionary_id_ >> (8 * i));
+      }
+      auto size = compression_dictionary_
+          ? ZSTD_compress_usingCDict(compression_context_.get(),
+                                     block_file.data() + frame_begin,
+                                     block_file.size() - frame_begin,
+                                     serialized_block.data(),
+                                     serialized_block.size(),
+                                     compression_dictionary_.get())
+          : ZSTD_compressCCtx(compression_context_.get(),
+                              block_file.data() + frame_begin,
+                              block_file.size() - frame_begin,
+                              serialized_block.data(),
+                              serialized_block.size(),
+                              level_.value_or(0));
+      if (ZSTD_isError(size)) {
+        log_->error("Cannot compress block: {}", ZSTD_getErrorName(size));
+        return boost::none;
+      }
+      block_file.resize(frame_begin + size);
+      return block_file;
+    }
+
+    boost::optional<std::string> BlockCompressor::decompress(
+        const Bytes &block_file) const {
+      auto frame_begin = block_file_format::kHeaderSize + kDictionaryIdSize;
+      if (block_file.size() < frame_begin) {
+        return boost::none;
+      }
+      DictionaryId id = 0;
+      for (size_t i = 0; i < kDictionaryIdSize; ++i) {
+        id |= static_cast<DictionaryId>(
+                  block_file[block_file_format::kHeaderSize + i])
+            << (8 * i);
+      }
+      auto frame = block_file.data() + frame_begin;
+      auto frame_size = block_file.size() - frame_begin;
+      auto content_size = ZSTD_getFrameContentSize(frame, frame_size);
+      if (content_size == ZSTD_CONTENTSIZE_UNKNOWN
+          or content_size == ZSTD_CONTENTSIZE_ERROR) {
+        return boost::none;
+      }
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      ZSTD_DDict *dictionary = nullptr;
+      if (id != 0) {
+        auto it = decompression_dictionaries_.find(id);
+        if (it == decompression_dictionaries_.end()) {
+          auto data = dictionaries_->get(id);
+          if (not data) {
+            log_->error("Dictionary {} is missing", id);
+            return boost::none;
+          }
+          std::unique_ptr<ZSTD_DDict, Deleter> loaded(
+              ZSTD_createDDict(data->data(), data->size()));
+          if (not loaded) {
+            log_->error("Cannot load dictionary {}", id);
+            return boost::none;
+          }
+          it = decompression_dictionaries_.emplace(id, std::move(loaded))
+                   .first;
+        }
+        dictionary = it->second.get();
+      }
+
+      std::string serialized_block(content_size, 0);
+      auto size = ZSTD_decompress_usingDDict(decompression_context_.get(),
+                                             &serialized_block[0],
+                                             serialized_block.size(),
+                                             frame,
+                                             frame_size,
+                                             dictionary);
+      if (ZSTD_isError(size) or size != content_size) {
+        log_->warn("Cannot decompress block: {}",
+                   ZSTD_isError(size) ? ZSTD_getErrorName(size)
+                                      : "size mismatch");
+        return boost::none;
+      }
+      return serialized_block;
+    }
+
+    void BlockCompressor::clear() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      compression_dictionary_.reset();
+      compression_dictionary_id_ = 0;
+      decompression_dictionaries_.clear();
+      // the directory may be already removed together with the blocks, so
+      // it is recreated for the following dictionaries
+      boost::system::error_code error_code;
+      boost::filesystem::remove_all(dictionaries_path_, error_code);
+      if (auto dictionaries = FlatFile::create(dictionaries_path_, log_)) {
+        dictionaries_ = std::move(*dictionaries);
+      }
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
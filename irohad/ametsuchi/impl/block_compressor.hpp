@@ -0,0 +1,149 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BLOCK_COMPRESSOR_HPP
+#define IROHA_BLOCK_COMPRESSOR_HPP
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger_fwd.hpp"
+
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Zstd compression of the block files. The blocks are split into
+     * segments of consecutive heights, and a dictionary is trained for every
+     * segment on its first blocks, so the following blocks of the segment,
+     * which share the structure and many of the keys and account ids, are
+     * compressed with it. The dictionaries are stored in a subdirectory of
+     * the block store, a compressed block refers to its dictionary by id.
+     */
+    class BlockCompressor {
+     public:
+      using Bytes = FlatFile::Bytes;
+      using HeightType = shared_model::interface::types::HeightType;
+
+      static constexpr HeightType kDefaultSegmentBlocks = 100000;
+      static constexpr HeightType kDefaultTrainingBlocks = 1000;
+      /// maximal size of a dictionary
+      static constexpr size_t kDictionaryCapacity = 64 * 1024;
+      /// name of the subdirectory of the dictionaries in the block store
+      static const std::string kDictionariesDirectory;
+
+      /**
+       * Create the compressor with the dictionaries of the block store
+       * @param block_store_path - directory of the block files
+       * @param level - zstd compression level of the inserted blocks, none
+       * disables compression while the compressed blocks are still readable
+       * @param log - logger
+       * @param segment_blocks - number of blocks of a segment
+       * @param training_blocks - number of the first blocks of a segment
+       * which are used to train its dictionary
+       * @return created compressor, none if the dictionaries are not
+       * accessible
+       */
+      static boost::optional<std::unique_ptr<BlockCompressor>> create(
+          const std::string &block_store_path,
+          boost::optional<int32_t> level,
+          logger::LoggerPtr log,
+          HeightType segment_blocks = kDefaultSegmentBlocks,
+          HeightType training_blocks = kDefaultTrainingBlocks);
+
+      ~BlockCompressor();
+
+      /// @return true if the inserted blocks are compressed
+      bool enabled() const;
+
+      /**
+       * @param height - height of the block to be inserted
+       * @return heights range [begin, end) of the blocks to train the
+       * dictionary on before the block is compressed, none if the training is
+       * not due
+       */
+      boost::optional<std::pair<HeightType, HeightType>> trainingRange(
+          HeightType height) const;
+
+      /**
+       * Train the dictionary of the segment of the block, the dictionary is
+       * used for the following blocks. Current dictionary is kept if the
+       * training fails
+       * @param height - height of the block to be inserted
+       * @param samples - serialized blocks of the training range
+       */
+      void train(HeightType height, const std::vector<std::string> &samples);
+
+      /**
+       * @param serialized_block - protobuf binary Block_v1
+       * @return compressed block file, none on compression error
+       */
+      boost::optional<Bytes> compress(const Bytes &serialized_block);
+
+      /**
+       * @param block_file - compressed block file
+       * @return protobuf binary Block_v1, none if the file is malformed or
+       * its dictionary is missing
+       */
+      boost::optional<std::string> decompress(const Bytes &block_file) const;
+
+      /// remove all dictionaries
+      void clear();
+
+     private:
+      struct Deleter {
+        void operator()(ZSTD_CCtx_s *context) const;
+        void operator()(ZSTD_DCtx_s *context) const;
+        void operator()(ZSTD_CDict_s *dictionary) const;
+        void operator()(ZSTD_DDict_s *dictionary) const;
+      };
+      using DictionaryId = FlatFile::Identifier;
+
+      BlockCompressor(std::string dictionaries_path,
+                      std::unique_ptr<FlatFile> dictionaries,
+                      boost::optional<int32_t> level,
+                      logger::LoggerPtr log,
+                      HeightType segment_blocks,
+                      HeightType training_blocks);
+
+      /// @return id of the dictionary of the segment of the block
+      DictionaryId dictionaryId(HeightType height) const;
+
+      /// load the compression dictionary, lock must be held
+      void loadCompressionDictionary(DictionaryId id, const Bytes &dictionary);
+
+      std::string dictionaries_path_;
+      std::unique_ptr<FlatFile> dictionaries_;
+      boost::optional<int32_t> level_;
+      logger::LoggerPtr log_;
+      HeightType segment_blocks_;
+      HeightType training_blocks_;
+
+      mutable std::mutex mutex_;
+      std::unique_ptr<ZSTD_CCtx_s, Deleter> compression_context_;
+      std::unique_ptr<ZSTD_DCtx_s, Deleter> decompression_context_;
+      /// id of the dictionary of the inserted blocks, 0 for no dictionary
+      DictionaryId compression_dictionary_id_;
+      std::unique_ptr<ZSTD_CDict_s, Deleter> compression_dictionary_;
+      mutable std::map<DictionaryId, std::unique_ptr<ZSTD_DDict_s, Deleter>>
+          decompression_dictionaries_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_BLOCK_COMPRESSOR_HPP
@@ -0,0 +1,111 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/block_file_format.hpp"
+
+#include <algorithm>
+
+#include "ametsuchi/impl/block_compressor.hpp"
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "backend/protobuf/json_proto_reader.hpp"
+#include "block.pb.h"
+#include "common/byteutils.hpp"
+#include "logger/logger.hpp"
+
+namespace {
+  /// header without the version byte
+  constexpr uint8_t kMagic[] = {0, 'I', 'R', 'B'};
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+    namespace block_file_format {
+
+      Bytes header(Version version) {
+        Bytes block_file(std::begin(kMagic), std::end(kMagic));
+        block_file.push_back(static_cast<uint8_t>(version));
+        return block_file;
+      }
+
+      Bytes encode(const Bytes &serialized_block) {
+        auto block_file = header(Version::kProtobufV1);
+        block_file.reserve(kHeaderSize + serialized_block.size());
+        block_file.insert(block_file.end(),
+                          serialized_block.begin(),
+                          serialized_block.end());
+        return block_file;
+      }
+
+      boost::optional<Version> detect(const Bytes &block_file) {
+        if (block_file.size() < kHeaderSize
+            or not std::equal(
+                   std::begin(kMagic), std::end(kMagic), block_file.begin())) {
+          return Version::kJson;
+        }
+        auto version = block_file[sizeof(kMagic)];
+        if (version != static_cast<uint8_t>(Version::kProtobufV1)
+            and version != static_cast<uint8_t>(Version::kZstdV1)) {
+          return boost::none;
+        }
+        return static_cast<Version>(version);
+      }
+
+      boost::optional<std::string> toSerializedBlock(
+          const Bytes &block_file, const BlockCompressor *compressor) {
+        auto version = detect(block_file);
+        if (not version) {
+          return boost::none;
+        }
+        switch (*version) {
+          case Version::kProtobufV1:
+            return std::string(block_file.begin() + kHeaderSize,
+                               block_file.end());
+          case Version::kZstdV1:
+            if (not compressor) {
+              return boost::none;
+            }
+            return compressor->decompress(block_file);
+          case Version::kJson:
+            break;
+        }
+
+        iroha::protocol::Block block;
+        if (expected::hasError(shared_model::proto::parseJson(
+                bytesToString(block_file), block))) {
+          return boost::none;
+        }
+        return block.block_v1().SerializeAsString();
+      }
+
+      bool convertFlatFile(FlatFile &storage, const logger::LoggerPtr &log) {
+        size_t converted = 0;
+        for (auto id : storage.blockIdentifiers()) {
+          auto block_file = storage.get(id);
+          if (not block_file) {
+            log->error("Cannot read block {}", id);
+            return false;
+          }
+          auto version = detect(*block_file);
+          if (version and *version != Version::kJson) {
+            continue;
+          }
+          auto serialized_block = toSerializedBlock(*block_file);
+          if (not serialized_block) {
+            log->error("Cannot convert block {}", id);
+            return false;
+          }
+          if (not storage.replace(
+                  id, encode(stringToBytes(*serialized_block)))) {
+            return false;
+          }
+          ++converted;
+        }
+        log->info("Converted {} blocks in {}", converted, storage.directory());
+        return true;
+      }
+
+    }  // namespace block_file_format
+  }    // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,83 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BLOCK_FILE_FORMAT_HPP
+#define IROHA_BLOCK_FILE_FORMAT_HPP
+
+#include <string>
+
+#include <boost/optional.hpp>
+#include "ametsuchi/key_value_storage.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    class BlockCompressor;
+    class FlatFile;
+
+    /**
+     * Format of the block files of the flat file block storage. Binary
+     * blocks start with a header of a zero byte, "IRB" and the version,
+     * followed by the serialized protobuf Block_v1, or by the dictionary id
+     * and the zstd frame of it for the compressed blocks. Legacy blocks are
+     * JSON of the protobuf Block without a header.
+     */
+    namespace block_file_format {
+
+      using Bytes = KeyValueStorage::Bytes;
+
+      enum class Version : uint8_t {
+        kJson = 0,
+        kProtobufV1 = 1,
+        kZstdV1 = 2,
+      };
+
+      /// size of the header of the binary blocks
+      constexpr size_t kHeaderSize = 5;
+
+      /**
+       * Create the block file of the current version
+       * @param serialized_block - protobuf binary Block_v1
+       * @return contents of the block file
+       */
+      Bytes encode(const Bytes &serialized_block);
+
+      /**
+       * @return header of the binary block file of the given version
+       */
+      Bytes header(Version version);
+
+      /**
+       * @return version of the block file, none if the header is of unknown
+       * version
+       */
+      boost::optional<Version> detect(const Bytes &block_file);
+
+      /**
+       * Extract the protobuf binary Block_v1 from the block file of any
+       * version
+       * @param compressor - decompressor of the compressed blocks, they are
+       * not readable without it
+       * @return serialized block, none if the file is malformed
+       */
+      boost::optional<std::string> toSerializedBlock(
+          const Bytes &block_file,
+          const BlockCompressor *compressor = nullptr);
+
+      /**
+       * Rewrite the legacy JSON block files of the storage in the binary
+       * format
+       * @param storage - flat file storage of the blocks
+       * @param log - logger of the progress
+       * @return true if all blocks are in the binary format
+       */
+      bool convertFlatFile(FlatFile &storage, const logger::LoggerPtr &log);
+
+    }  // namespace block_file_format
+  }    // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_BLOCK_FILE_FORMAT_HPP
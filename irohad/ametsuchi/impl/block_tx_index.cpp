@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/block_tx_index.hpp"
+
+#include <cstring>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+
+namespace {
+  using google::protobuf::internal::WireFormatLite;
+
+  /// field numbers of Block_v1.payload and Block_v1.Payload.transactions
+  constexpr int kPayloadField = 1;
+  constexpr int kTransactionsField = 1;
+
+  /// @return true if the tag is of the length-delimited field with the number
+  bool isMessageField(uint32_t tag, int field_number) {
+    return WireFormatLite::GetTagFieldNumber(tag) == field_number
+        and WireFormatLite::GetTagWireType(tag)
+        == WireFormatLite::WIRETYPE_LENGTH_DELIMITED;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+    namespace block_tx_index {
+
+      boost::optional<std::vector<Location>> locate(const uint8_t *data,
+                                                    size_t size) {
+        google::protobuf::io::CodedInputStream input(data, size);
+        std::vector<Location> locations;
+        while (auto tag = input.ReadTag()) {
+          if (not isMessageField(tag, kPayloadField)) {
+            if (not WireFormatLite::SkipField(&input, tag)) {
+              return boost::none;
+            }
+            continue;
+          }
+
+          uint32_t payload_size;
+          if (not input.ReadVarint32(&payload_size)) {
+            return boost::none;
+          }
+          auto limit = input.PushLimit(payload_size);
+          while (auto payload_tag = input.ReadTag()) {
+            if (not isMessageField(payload_tag, kTransactionsField)) {
+              if (not WireFormatLite::SkipField(&input, payload_tag)) {
+                return boost::none;
+              }
+              continue;
+            }
+            uint32_t tx_size;
+            if (not input.ReadVarint32(&tx_size)) {
+              return boost::none;
+            }
+            locations.push_back(
+                Location{static_cast<uint32_t>(input.CurrentPosition()),
+                         tx_size});
+            if (not input.Skip(tx_size)) {
+              return boost::none;
+            }
+          }
+          if (not input.ConsumedEntireMessage()) {
+            return boost::none;
+          }
+          input.PopLimit(limit);
+        }
+        if (not input.ConsumedEntireMessage()) {
+          return boost::none;
+        }
+        return locations;
+      }
+
+      Bytes encode(const std::vector<Location> &locations) {
+        Bytes record(locations.size() * sizeof(Location));
+        if (not locations.empty()) {
+          std::memcpy(record.data(), locations.data(), record.size());
+        }
+        return record;
+      }
+
+      boost::optional<Location> find(const Bytes &record, size_t index) {
+        if ((index + 1) * sizeof(Location) > record.size()) {
+          return boost::none;
+        }
+        Location location;
+        std::memcpy(&location,
+                    record.data() + index * sizeof(Location),
+                    sizeof(location));
+        return location;
+      }
+
+    }  // namespace block_tx_index
+  }    // namespace ametsuchi
+}  // namespace iroha
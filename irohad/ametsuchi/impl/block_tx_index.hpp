@@ -0,0 +1,57 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BLOCK_TX_INDEX_HPP
+#define IROHA_BLOCK_TX_INDEX_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include "ametsuchi/key_value_storage.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Index of the transactions inside the protobuf binary Block_v1, which
+     * lets a single transaction be read and parsed without its block. The
+     * index record of a block is the offset and the size of every
+     * transaction in host byte order.
+     */
+    namespace block_tx_index {
+
+      using Bytes = KeyValueStorage::Bytes;
+
+      /// position of the serialized transaction in the serialized block
+      struct Location {
+        uint32_t offset;
+        uint32_t size;
+      };
+
+      /**
+       * Find the transactions in the serialized block
+       * @return locations of the transactions in the order of the block,
+       * none if the block is malformed
+       */
+      boost::optional<std::vector<Location>> locate(const uint8_t *data,
+                                                    size_t size);
+
+      /**
+       * @return index record of the transactions of the block
+       */
+      Bytes encode(const std::vector<Location> &locations);
+
+      /**
+       * @return location of the transaction with the given index in the
+       * block, none if there is no such transaction in the record
+       */
+      boost::optional<Location> find(const Bytes &record, size_t index);
+
+    }  // namespace block_tx_index
+  }    // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_BLOCK_TX_INDEX_HPP
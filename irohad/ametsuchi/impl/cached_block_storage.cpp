@@ -0,0 +1,150 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/cached_block_storage.hpp"
+
+using namespace iroha::ametsuchi;
+
+CachedBlockStorage::CachedBlockStorage(std::unique_ptr<BlockStorage> storage,
+                                       size_t capacity)
+    : storage_(std::move(storage)),
+      capacity_(capacity),
+      cached_size_(0),
+      hits_(std::make_shared<Counter>()),
+      misses_(std::make_shared<Counter>()) {}
+
+bool CachedBlockStorage::insert(
+    std::shared_ptr<const shared_model::interface::Block> block) {
+  if (not storage_->insert(block)) {
+    return false;
+  }
+  put(std::move(block));
+  return true;
+}
+
+boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+CachedBlockStorage::fetch(
+    shared_model::interface::types::HeightType height) const {
+  if (auto block = find(height)) {
+    hits_->increment();
+    return boost::make_optional(std::move(block));
+  }
+  misses_->increment();
+  auto block = storage_->fetch(height);
+  if (block) {
+    put(*block);
+  }
+  return block;
+}
+
+boost::optional<std::string> CachedBlockStorage::fetchSerialized(
+    shared_model::interface::types::HeightType height) const {
+  if (auto block = find(height)) {
+    hits_->increment();
+    return shared_model::crypto::toBinaryString(block->blob());
+  }
+  // the serialized block is not parsed just to be cached
+  misses_->increment();
+  return storage_->fetchSerialized(height);
+}
+
+boost::optional<BlockHeader> CachedBlockStorage::fetchHeader(
+    shared_model::interface::types::HeightType height) const {
+  if (auto block = find(height)) {
+    hits_->increment();
+    return makeBlockHeader(*block);
+  }
+  misses_->increment();
+  return storage_->fetchHeader(height);
+}
+
+boost::optional<std::unique_ptr<shared_model::interface::Transaction>>
+CachedBlockStorage::fetchTransaction(
+    shared_model::interface::types::HeightType height, size_t index) const {
+  if (auto block = find(height)) {
+    hits_->increment();
+    auto transactions = block->transactions();
+    if (index >= static_cast<size_t>(transactions.size())) {
+      return boost::none;
+    }
+    return boost::make_optional(clone(transactions[index]));
+  }
+  // the block is not read just to be cached
+  misses_->increment();
+  return storage_->fetchTransaction(height, index);
+}
+
+size_t CachedBlockStorage::size() const {
+  return storage_->size();
+}
+
+void CachedBlockStorage::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  storage_->clear();
+  entries_.clear();
+  index_.clear();
+  cached_size_ = 0;
+}
+
+void CachedBlockStorage::forEach(
+    iroha::ametsuchi::BlockStorage::FunctionType function) const {
+  // the whole chain is not cached on traversal
+  storage_->forEach(std::move(function));
+}
+
+bool CachedBlockStorage::flush() {
+  return storage_->flush();
+}
+
+std::shared_ptr<const iroha::Counter> CachedBlockStorage::hits() const {
+  return hits_;
+}
+
+std::shared_ptr<const iroha::Counter> CachedBlockStorage::misses() const {
+  return misses_;
+}
+
+size_t CachedBlockStorage::cachedSize() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return cached_size_;
+}
+
+CachedBlockStorage::BlockPtr CachedBlockStorage::find(
+    shared_model::interface::types::HeightType height) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(height);
+  if (it == index_.end()) {
+    return nullptr;
+  }
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return *it->second;
+}
+
+void CachedBlockStorage::setCapacity(size_t capacity) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  capacity_ = capacity;
+  evict(0);
+}
+
+void CachedBlockStorage::put(BlockPtr block) const {
+  auto block_size = block->blob().size();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (block_size > capacity_ or index_.count(block->height()) != 0) {
+    return;
+  }
+  evict(block_size);
+  auto height = block->height();
+  entries_.push_front(std::move(block));
+  index_.emplace(height, entries_.begin());
+  cached_size_ += block_size;
+}
+
+void CachedBlockStorage::evict(size_t size) const {
+  while (cached_size_ + size > capacity_) {
+    cached_size_ -= entries_.back()->blob().size();
+    index_.erase(entries_.back()->height());
+    entries_.pop_back();
+  }
+}
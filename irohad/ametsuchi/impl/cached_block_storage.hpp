@@ -0,0 +1,107 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CACHED_BLOCK_STORAGE_HPP
+#define IROHA_CACHED_BLOCK_STORAGE_HPP
+
+#include "ametsuchi/block_storage.hpp"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "common/counter.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Block storage with the least recently used blocks kept in memory in
+     * front of the other storage, so recent blocks which are requested by
+     * queries and syncing peers are not read and parsed again. The cache is
+     * bounded by the total size of the serialized blocks, and is populated
+     * by the inserted blocks on commit as well as by the fetched ones
+     */
+    class CachedBlockStorage : public BlockStorage {
+     public:
+      /**
+       * @param storage - storage of all blocks
+       * @param capacity - maximal total size of the cached blocks in bytes
+       */
+      CachedBlockStorage(std::unique_ptr<BlockStorage> storage,
+                         size_t capacity);
+
+      bool insert(
+          std::shared_ptr<const shared_model::interface::Block> block) override;
+
+      boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+      fetch(shared_model::interface::types::HeightType height) const override;
+
+      boost::optional<std::string> fetchSerialized(
+          shared_model::interface::types::HeightType height) const override;
+
+      boost::optional<BlockHeader> fetchHeader(
+          shared_model::interface::types::HeightType height) const override;
+
+      boost::optional<std::unique_ptr<shared_model::interface::Transaction>>
+      fetchTransaction(shared_model::interface::types::HeightType height,
+                       size_t index) const override;
+
+      size_t size() const override;
+
+      void clear() override;
+
+      void forEach(FunctionType function) const override;
+
+      bool flush() override;
+
+      /// @return number of the requested blocks which were cached
+      std::shared_ptr<const Counter> hits() const;
+
+      /// @return number of the requested blocks which were read from storage
+      std::shared_ptr<const Counter> misses() const;
+
+      /// @return total size of the cached blocks in bytes
+      size_t cachedSize() const;
+
+      /**
+       * Change the max total size of the cached blocks in bytes, and evict
+       * the least recently used ones over it
+       */
+      void setCapacity(size_t capacity);
+
+     private:
+      using BlockPtr = std::shared_ptr<const shared_model::interface::Block>;
+      using Entries = std::list<BlockPtr>;
+
+      /// @return cached block, which becomes the most recently used one
+      BlockPtr find(shared_model::interface::types::HeightType height) const;
+
+      /// put the block to the cache and evict the least recently used ones
+      void put(BlockPtr block) const;
+
+      /// evict the least recently used blocks till the size fits, the mutex
+      /// is to be locked
+      void evict(size_t size) const;
+
+      std::unique_ptr<BlockStorage> storage_;
+      size_t capacity_;
+
+      mutable std::mutex mutex_;
+      /// cached blocks from the most recently used one
+      mutable Entries entries_;
+      mutable std::unordered_map<shared_model::interface::types::HeightType,
+                                 Entries::iterator>
+          index_;
+      mutable size_t cached_size_;
+
+      std::shared_ptr<Counter> hits_;
+      std::shared_ptr<Counter> misses_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_CACHED_BLOCK_STORAGE_HPP
@@ -5,7 +5,12 @@
 
 #include "ametsuchi/impl/flat_file/flat_file.hpp"
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
 #include <ciso646>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -20,6 +25,43 @@ using namespace iroha::ametsuchi;
 using Identifier = FlatFile::Identifier;
 using BlockIdCollectionType = FlatFile::BlockIdCollectionType;
 
+const char *const FlatFile::kTipFileName = "tip";
+
+namespace {
+  /**
+   * Read the identifiers from the tip file, which has the number of the
+   * ranges followed by the first and last identifiers of each range
+   * @return the identifiers if the tip file is valid, which is checked by
+   * the presence of the ends of the ranges and the absence of the files
+   * adjacent to them
+   */
+  boost::optional<BlockIdCollectionType> readTip(
+      const boost::filesystem::path &directory) {
+    boost::filesystem::ifstream file(directory / FlatFile::kTipFileName);
+    size_t number = 0;
+    if (not(file >> number)) {
+      return boost::none;
+    }
+    auto exists = [&directory](Identifier id) {
+      boost::system::error_code err;
+      return boost::filesystem::exists(
+          directory / FlatFile::id_to_name(id), err);
+    };
+    BlockIdCollectionType::RangesType ranges;
+    for (size_t i = 0; i < number; ++i) {
+      Identifier first, last;
+      if (not(file >> first >> last) or first > last
+          or (not ranges.empty() and ranges.rbegin()->second + 1 >= first)
+          or not exists(first) or not exists(last)
+          or (first > 0 and exists(first - 1)) or exists(last + 1)) {
+        return boost::none;
+      }
+      ranges.emplace_hint(ranges.end(), first, last);
+    }
+    return BlockIdCollectionType(std::move(ranges));
+  }
+}  // namespace
+
 // ----------| public API |----------
 
 std::string FlatFile::id_to_name(Identifier id) {
@@ -49,13 +91,23 @@ boost::optional<std::unique_ptr<FlatFile>> FlatFile::create(
     return boost::none;
   }
 
+  // the tip file is valid until the storage is modified
+  auto tip = readTip(path);
+  boost::filesystem::remove(boost::filesystem::path{path} / kTipFileName, err);
+  if (tip) {
+    log->info("Took {} identifiers from the tip file of {}", tip->size(), path);
+    return std::make_unique<FlatFile>(
+        path, std::move(*tip), private_tag{}, std::move(log));
+  }
+
   BlockIdCollectionType files_found;
   for (auto it = boost::filesystem::directory_iterator{path};
        it != boost::filesystem::directory_iterator{};
        ++it) {
     if (auto id = FlatFile::name_to_id(it->path().filename().string())) {
       files_found.insert(*id);
-    } else {
+    } else if (not boost::filesystem::is_directory(it->path())) {
+      // directories are kept for the auxiliary data of the storage users
       boost::filesystem::remove(it->path());
     }
   }
@@ -89,6 +141,7 @@ bool FlatFile::add(Identifier id, const Bytes &block) {
              block.size() * val_size);
 
   available_blocks_.insert(id);
+  unsynced_.push_back(id);
   return true;
 }
 
@@ -116,18 +169,100 @@ std::string FlatFile::directory() const {
 }
 
 Identifier FlatFile::last_id() const {
-  return (available_blocks_.empty()) ? 0 : *available_blocks_.rbegin();
+  return available_blocks_.last();
 }
 
 void FlatFile::dropAll() {
   iroha::remove_dir_contents(dump_dir_, log_);
   available_blocks_.clear();
+  unsynced_.clear();
+}
+
+bool FlatFile::flush() {
+  if (unsynced_.empty()) {
+    return true;
+  }
+  auto sync = [this](const std::string &path, int flags, auto sync_function) {
+    auto fd = ::open(path.c_str(), flags);
+    if (fd < 0 or sync_function(fd) != 0) {
+      log_->error("Cannot sync {}: {}", path, std::strerror(errno));
+      if (fd >= 0) {
+        ::close(fd);
+      }
+      return false;
+    }
+    ::close(fd);
+    return true;
+  };
+  bool result = true;
+  for (auto id : unsynced_) {
+    result &= sync((boost::filesystem::path{dump_dir_} / id_to_name(id))
+                       .string(),
+                   O_RDONLY,
+                   ::fdatasync);
+  }
+  unsynced_.clear();
+  // entries of the new files are durable after the directory sync
+  result &= sync(dump_dir_, O_RDONLY | O_DIRECTORY, ::fsync);
+  return result;
+}
+
+bool FlatFile::removeLast() {
+  if (available_blocks_.empty()) {
+    return false;
+  }
+  auto id = available_blocks_.last();
+  boost::system::error_code err;
+  boost::filesystem::remove(
+      boost::filesystem::path{dump_dir_} / id_to_name(id), err);
+  if (err) {
+    log_->warn("Cannot remove file by index {}: {}", id, err.message());
+    return false;
+  }
+  available_blocks_.eraseLast();
+  unsynced_.erase(std::remove(unsynced_.begin(), unsynced_.end(), id),
+                  unsynced_.end());
+  return true;
 }
 
 const BlockIdCollectionType &FlatFile::blockIdentifiers() const {
   return available_blocks_;
 }
 
+bool FlatFile::replace(Identifier id, const Bytes &blob) {
+  if (available_blocks_.count(id) == 0) {
+    log_->warn("replacement for {} failed, because file does not exist", id);
+    return false;
+  }
+
+  const auto file_name = boost::filesystem::path{dump_dir_} / id_to_name(id);
+  // temporary file name does not match the identifiers and is removed by
+  // create if the replacement is interrupted
+  auto temp_name = file_name;
+  temp_name += ".tmp";
+  {
+    boost::filesystem::ofstream file(temp_name.native(),
+                                     std::ofstream::binary);
+    if (not file.is_open()) {
+      log_->warn("Cannot open file by index {} for writing", id);
+      return false;
+    }
+    file.write(reinterpret_cast<const char *>(blob.data()), blob.size());
+    if (not file.good()) {
+      log_->warn("Cannot write file by index {}", id);
+      return false;
+    }
+  }
+
+  boost::system::error_code err;
+  boost::filesystem::rename(temp_name, file_name, err);
+  if (err) {
+    log_->warn("Cannot replace file by index {}: {}", id, err.message());
+    return false;
+  }
+  return true;
+}
+
 // ----------| private API |----------
 
 FlatFile::FlatFile(std::string path,
@@ -137,3 +272,32 @@ FlatFile::FlatFile(std::string path,
     : dump_dir_(std::move(path)),
       available_blocks_(std::move(existing_files)),
       log_{std::move(log)} {}
+
+FlatFile::~FlatFile() {
+  boost::system::error_code err;
+  if (not boost::filesystem::is_directory(dump_dir_, err)) {
+    return;
+  }
+  const auto tip_name = boost::filesystem::path{dump_dir_} / kTipFileName;
+  // temporary file name does not match the identifiers and is removed by
+  // create if the writing is interrupted
+  auto temp_name = tip_name;
+  temp_name += ".tmp";
+  {
+    boost::filesystem::ofstream file(temp_name, std::ofstream::trunc);
+    const auto &ranges = available_blocks_.ranges();
+    file << ranges.size() << '\n';
+    for (const auto &range : ranges) {
+      file << range.first << ' ' << range.second << '\n';
+    }
+    if (not file.good()) {
+      log_->warn("Cannot write the tip file of {}", dump_dir_);
+      return;
+    }
+  }
+  boost::filesystem::rename(temp_name, tip_name, err);
+  if (err) {
+    log_->warn(
+        "Cannot write the tip file of {}: {}", dump_dir_, err.message());
+  }
+}
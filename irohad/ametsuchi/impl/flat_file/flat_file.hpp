@@ -9,8 +9,9 @@
 #include "ametsuchi/key_value_storage.hpp"
 
 #include <memory>
-#include <set>
+#include <vector>
 
+#include "ametsuchi/impl/flat_file/id_ranges.hpp"
 #include "logger/logger_fwd.hpp"
 
 namespace iroha {
@@ -29,10 +30,18 @@ namespace iroha {
      public:
       // ----------| public API |----------
 
-      using BlockIdCollectionType = std::set<Identifier>;
+      using BlockIdCollectionType = IdRanges<Identifier>;
 
       static const uint32_t DIGIT_CAPACITY = 16;
 
+      /**
+       * Name of the file with the identifiers of the storage, which is
+       * written when the storage is closed. The storage created on a
+       * directory with a valid tip file takes the identifiers from it and
+       * does not scan the directory
+       */
+      static const char *const kTipFileName;
+
       /**
        * Convert id to a string representation. The string representation is
        * always DIGIT_CAPACITY-character width regardless of the value of `id`.
@@ -55,7 +64,8 @@ namespace iroha {
       static boost::optional<Identifier> name_to_id(const std::string &name);
 
       /**
-       * Create storage in paths
+       * Create storage in paths. The tip file is removed, so the directory
+       * is scanned after a crash
        * @param path - target path for creating
        * @param log - logger
        * @return created storage
@@ -73,11 +83,33 @@ namespace iroha {
 
       void dropAll() override;
 
+      /**
+       * Sync the files added since the last flush and the directory, so
+       * the files of a commit reach the disk with a single barrier
+       */
+      bool flush() override;
+
+      /**
+       * Remove the entity with the greatest identifier, such as the block
+       * which was torn by a crash
+       * @return true if the entity is removed
+       */
+      bool removeLast();
+
       /**
        * @return collection of available block ids
        */
       const BlockIdCollectionType &blockIdentifiers() const;
 
+      /**
+       * Atomically overwrite the data of the existing entity: the data is
+       * written to a temporary file which is renamed to the entity file
+       * @param id - reference key of the existing entity
+       * @param blob - new data associated with key
+       * @return true if the entity is replaced
+       */
+      bool replace(Identifier id, const Bytes &blob);
+
       // ----------| modify operations |----------
 
       FlatFile(const FlatFile &rhs) = delete;
@@ -109,10 +141,14 @@ namespace iroha {
 
       BlockIdCollectionType available_blocks_;
 
+      /// entities added since the last flush
+      std::vector<Identifier> unsynced_;
+
       logger::LoggerPtr log_;
 
      public:
-      ~FlatFile() = default;
+      /// Writes the tip file
+      ~FlatFile();
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -0,0 +1,174 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ID_RANGES_HPP
+#define IROHA_ID_RANGES_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <utility>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Ordered set of identifiers, which keeps the contiguous ranges of them,
+     * so a chain without gaps takes a single node
+     * @tparam Id - unsigned integer type of the identifiers
+     */
+    template <typename Id>
+    class IdRanges {
+     public:
+      /// first and last identifiers of each range
+      using RangesType = std::map<Id, Id>;
+
+      class const_iterator {
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Id;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Id *;
+        using reference = const Id &;
+
+        const_iterator() = default;
+
+        const_iterator(typename RangesType::const_iterator range,
+                       typename RangesType::const_iterator end)
+            : range_(range),
+              end_(end),
+              id_(range == end ? Id{} : range->first) {}
+
+        reference operator*() const {
+          return id_;
+        }
+
+        const_iterator &operator++() {
+          if (id_ < range_->second) {
+            ++id_;
+          } else if (++range_ != end_) {
+            id_ = range_->first;
+          } else {
+            id_ = Id{};
+          }
+          return *this;
+        }
+
+        const_iterator operator++(int) {
+          auto result = *this;
+          ++*this;
+          return result;
+        }
+
+        bool operator==(const const_iterator &other) const {
+          return range_ == other.range_ and id_ == other.id_;
+        }
+
+        bool operator!=(const const_iterator &other) const {
+          return not(*this == other);
+        }
+
+       private:
+        typename RangesType::const_iterator range_;
+        typename RangesType::const_iterator end_;
+        Id id_{};
+      };
+
+      IdRanges() = default;
+
+      /// @param ranges - disjoint and not adjacent ranges
+      explicit IdRanges(RangesType ranges) : ranges_(std::move(ranges)) {
+        for (const auto &range : ranges_) {
+          size_ += range.second - range.first + 1;
+        }
+      }
+
+      /// @return true if the identifier is added, false if it is present
+      bool insert(Id id) {
+        auto next = ranges_.upper_bound(id);
+        if (next != ranges_.begin()) {
+          auto prev = std::prev(next);
+          if (id <= prev->second) {
+            return false;
+          }
+          if (id == prev->second + 1) {
+            prev->second = id;
+            if (next != ranges_.end() and next->first == id + 1) {
+              prev->second = next->second;
+              ranges_.erase(next);
+            }
+            ++size_;
+            return true;
+          }
+        }
+        if (next != ranges_.end() and next->first == id + 1) {
+          auto last = next->second;
+          ranges_.emplace_hint(ranges_.erase(next), id, last);
+        } else {
+          ranges_.emplace_hint(next, id, id);
+        }
+        ++size_;
+        return true;
+      }
+
+      /// remove the greatest identifier, if any
+      void eraseLast() {
+        if (ranges_.empty()) {
+          return;
+        }
+        auto last = std::prev(ranges_.end());
+        if (last->first == last->second) {
+          ranges_.erase(last);
+        } else {
+          --last->second;
+        }
+        --size_;
+      }
+
+      size_t count(Id id) const {
+        auto next = ranges_.upper_bound(id);
+        return next != ranges_.begin() and id <= std::prev(next)->second ? 1
+                                                                          : 0;
+      }
+
+      size_t size() const {
+        return size_;
+      }
+
+      bool empty() const {
+        return ranges_.empty();
+      }
+
+      void clear() {
+        ranges_.clear();
+        size_ = 0;
+      }
+
+      const_iterator begin() const {
+        return const_iterator(ranges_.begin(), ranges_.end());
+      }
+
+      const_iterator end() const {
+        return const_iterator(ranges_.end(), ranges_.end());
+      }
+
+      /// @return the greatest identifier, which is present if not empty
+      Id last() const {
+        return ranges_.empty() ? Id{} : ranges_.rbegin()->second;
+      }
+
+      const RangesType &ranges() const {
+        return ranges_;
+      }
+
+     private:
+      RangesType ranges_;
+      size_t size_ = 0;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_ID_RANGES_HPP
@@ -5,8 +5,7 @@
 
 #include "ametsuchi/impl/flat_file_block_storage.hpp"
 
-#include <boost/filesystem.hpp>
-
+#include "ametsuchi/impl/block_file_format.hpp"
 #include "backend/protobuf/block.hpp"
 #include "common/byteutils.hpp"
 #include "logger/logger.hpp"
@@ -16,22 +15,49 @@ using namespace iroha::ametsuchi;
 FlatFileBlockStorage::FlatFileBlockStorage(
     std::unique_ptr<FlatFile> flat_file,
     std::shared_ptr<shared_model::interface::BlockJsonConverter> json_converter,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    std::unique_ptr<BlockCompressor> compressor)
     : flat_file_storage_(std::move(flat_file)),
       json_converter_(std::move(json_converter)),
-      log_(std::move(log)) {}
+      log_(std::move(log)),
+      compressor_(std::move(compressor)) {
+  const auto &ids = flat_file_storage_->blockIdentifiers();
+  if (not ids.empty()) {
+    auto block_file = flat_file_storage_->get(*ids.begin());
+    if (block_file
+        and block_file_format::detect(*block_file)
+            == block_file_format::Version::kJson) {
+      log_->warn(
+          "Block storage {} contains blocks in the legacy JSON format, "
+          "which are slower to read. Run convert_block_store to convert them",
+          flat_file_storage_->directory());
+    }
+  }
+}
+
+boost::optional<iroha::ametsuchi::FlatFile::Bytes>
+FlatFileBlockStorage::encode(shared_model::interface::types::HeightType height,
+                             const FlatFile::Bytes &serialized_block) {
+  if (not compressor_ or not compressor_->enabled()) {
+    return block_file_format::encode(serialized_block);
+  }
+
+  if (auto range = compressor_->trainingRange(height)) {
+    std::vector<std::string> samples;
+    for (auto id = range->first; id < range->second; ++id) {
+      if (auto sample = fetchSerialized(id)) {
+        samples.push_back(std::move(*sample));
+      }
+    }
+    compressor_->train(height, samples);
+  }
+  return compressor_->compress(serialized_block);
+}
 
 bool FlatFileBlockStorage::insert(
     std::shared_ptr<const shared_model::interface::Block> block) {
-  return json_converter_->serialize(*block).match(
-      [&](const auto &block_json) {
-        return flat_file_storage_->add(block->height(),
-                                       stringToBytes(block_json.value));
-      },
-      [this](const auto &error) {
-        log_->warn("Error while block serialization: {}", error.error);
-        return false;
-      });
+  auto block_file = encode(block->height(), block->blob().blob());
+  return block_file and flat_file_storage_->add(block->height(), *block_file);
 }
 
 boost::optional<std::shared_ptr<const shared_model::interface::Block>>
@@ -42,6 +68,36 @@ FlatFileBlockStorage::fetch(
     return boost::none;
   }
 
+  auto version = block_file_format::detect(*storage_block);
+  if (not version) {
+    log_->warn("Unknown format of block {}", height);
+    return boost::none;
+  }
+  if (*version == block_file_format::Version::kZstdV1) {
+    auto serialized_block =
+        block_file_format::toSerializedBlock(*storage_block, compressor_.get());
+    shared_model::proto::ArenaMessage<iroha::protocol::Block_v1> block;
+    if (not serialized_block or not block->ParseFromString(*serialized_block)) {
+      log_->warn("Error while compressed block {} parsing", height);
+      return boost::none;
+    }
+    return boost::make_optional<
+        std::shared_ptr<const shared_model::interface::Block>>(
+        std::make_shared<shared_model::proto::Block>(std::move(block)));
+  }
+  if (*version == block_file_format::Version::kProtobufV1) {
+    shared_model::proto::ArenaMessage<iroha::protocol::Block_v1> block;
+    if (not block->ParseFromArray(
+            storage_block->data() + block_file_format::kHeaderSize,
+            storage_block->size() - block_file_format::kHeaderSize)) {
+      log_->warn("Error while block {} parsing", height);
+      return boost::none;
+    }
+    return boost::make_optional<
+        std::shared_ptr<const shared_model::interface::Block>>(
+        std::make_shared<shared_model::proto::Block>(std::move(block)));
+  }
+
   return json_converter_->deserialize(bytesToString(*storage_block))
       .match(
           [&](auto &&block) {
@@ -57,12 +113,22 @@ FlatFileBlockStorage::fetch(
           });
 }
 
+boost::optional<std::string> FlatFileBlockStorage::fetchSerialized(
+    shared_model::interface::types::HeightType height) const {
+  return flat_file_storage_->get(height) | [this](const auto &block_file) {
+    return block_file_format::toSerializedBlock(block_file, compressor_.get());
+  };
+}
+
 size_t FlatFileBlockStorage::size() const {
   return flat_file_storage_->blockIdentifiers().size();
 }
 
 void FlatFileBlockStorage::clear() {
   flat_file_storage_->dropAll();
+  if (compressor_) {
+    compressor_->clear();
+  }
 }
 
 void FlatFileBlockStorage::forEach(
@@ -73,3 +139,22 @@ void FlatFileBlockStorage::forEach(
     function(*block);
   }
 }
+
+bool FlatFileBlockStorage::flush() {
+  return flat_file_storage_->flush();
+}
+
+size_t FlatFileBlockStorage::removeTornBlocks() {
+  size_t removed = 0;
+  const auto &ids = flat_file_storage_->blockIdentifiers();
+  while (not ids.empty() and not fetch(ids.last())) {
+    log_->warn("Removing torn block {} from {}",
+               ids.last(),
+               flat_file_storage_->directory());
+    if (not flat_file_storage_->removeLast()) {
+      break;
+    }
+    ++removed;
+  }
+  return removed;
+}
@@ -8,19 +8,32 @@
 
 #include "ametsuchi/block_storage.hpp"
 
+#include "ametsuchi/impl/block_compressor.hpp"
 #include "ametsuchi/impl/flat_file/flat_file.hpp"
 #include "interfaces/iroha_internal/block_json_converter.hpp"
 #include "logger/logger_fwd.hpp"
 
 namespace iroha {
   namespace ametsuchi {
+    /**
+     * Block storage of a file per block. The blocks are written in the
+     * versioned binary format, legacy JSON blocks are read as well
+     */
     class FlatFileBlockStorage : public BlockStorage {
      public:
+      /**
+       * @param flat_file - storage of the block files
+       * @param json_converter - converter of the legacy JSON blocks
+       * @param log - logger
+       * @param compressor - compressor of the blocks, compressed blocks are
+       * not readable without it
+       */
       FlatFileBlockStorage(
           std::unique_ptr<FlatFile> flat_file,
           std::shared_ptr<shared_model::interface::BlockJsonConverter>
               json_converter,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::unique_ptr<BlockCompressor> compressor = nullptr);
 
       bool insert(
           std::shared_ptr<const shared_model::interface::Block> block) override;
@@ -28,17 +41,36 @@ namespace iroha {
       boost::optional<std::shared_ptr<const shared_model::interface::Block>>
       fetch(shared_model::interface::types::HeightType height) const override;
 
+      boost::optional<std::string> fetchSerialized(
+          shared_model::interface::types::HeightType height) const override;
+
       size_t size() const override;
 
       void clear() override;
 
       void forEach(FunctionType function) const override;
 
+      bool flush() override;
+
+      /**
+       * Remove the unreadable blocks from the top of the storage. The blocks
+       * are synced to the disk after they are written, so a crash may leave
+       * the last ones torn, and the peer downloads them again
+       * @return number of the removed blocks
+       */
+      size_t removeTornBlocks();
+
      private:
+      /// @return block file of the serialized block
+      boost::optional<FlatFile::Bytes> encode(
+          shared_model::interface::types::HeightType height,
+          const FlatFile::Bytes &serialized_block);
+
       std::unique_ptr<FlatFile> flat_file_storage_;
       std::shared_ptr<shared_model::interface::BlockJsonConverter>
           json_converter_;
       logger::LoggerPtr log_;
+      std::unique_ptr<BlockCompressor> compressor_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -0,0 +1,92 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/header_indexed_block_storage.hpp"
+
+using namespace iroha::ametsuchi;
+
+HeaderIndexedBlockStorage::HeaderIndexedBlockStorage(
+    std::unique_ptr<BlockStorage> storage, size_t capacity)
+    : storage_(std::move(storage)), capacity_(capacity) {}
+
+bool HeaderIndexedBlockStorage::insert(
+    std::shared_ptr<const shared_model::interface::Block> block) {
+  auto header = makeBlockHeader(*block);
+  if (not storage_->insert(std::move(block))) {
+    return false;
+  }
+  put(std::move(header));
+  return true;
+}
+
+boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+HeaderIndexedBlockStorage::fetch(
+    shared_model::interface::types::HeightType height) const {
+  auto block = storage_->fetch(height);
+  if (block) {
+    put(makeBlockHeader(**block));
+  }
+  return block;
+}
+
+boost::optional<std::string> HeaderIndexedBlockStorage::fetchSerialized(
+    shared_model::interface::types::HeightType height) const {
+  return storage_->fetchSerialized(height);
+}
+
+boost::optional<BlockHeader> HeaderIndexedBlockStorage::fetchHeader(
+    shared_model::interface::types::HeightType height) const {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = headers_.find(height);
+    if (it != headers_.end()) {
+      return it->second;
+    }
+  }
+  auto header = storage_->fetchHeader(height);
+  if (header) {
+    put(*header);
+  }
+  return header;
+}
+
+boost::optional<std::unique_ptr<shared_model::interface::Transaction>>
+HeaderIndexedBlockStorage::fetchTransaction(
+    shared_model::interface::types::HeightType height, size_t index) const {
+  return storage_->fetchTransaction(height, index);
+}
+
+size_t HeaderIndexedBlockStorage::size() const {
+  return storage_->size();
+}
+
+void HeaderIndexedBlockStorage::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  storage_->clear();
+  headers_.clear();
+}
+
+void HeaderIndexedBlockStorage::forEach(
+    iroha::ametsuchi::BlockStorage::FunctionType function) const {
+  storage_->forEach(std::move(function));
+}
+
+bool HeaderIndexedBlockStorage::flush() {
+  return storage_->flush();
+}
+
+size_t HeaderIndexedBlockStorage::indexedSize() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return headers_.size();
+}
+
+void HeaderIndexedBlockStorage::put(BlockHeader header) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto height = header.height;
+  headers_.emplace(height, std::move(header));
+  while (headers_.size() > capacity_) {
+    headers_.erase(headers_.begin());
+  }
+}
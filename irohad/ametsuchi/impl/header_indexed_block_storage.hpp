@@ -0,0 +1,76 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_HEADER_INDEXED_BLOCK_STORAGE_HPP
+#define IROHA_HEADER_INDEXED_BLOCK_STORAGE_HPP
+
+#include "ametsuchi/block_storage.hpp"
+
+#include <map>
+#include <mutex>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Block storage with the headers of the recent blocks kept in memory in
+     * front of the other storage, so the hash, height and the other header
+     * fields are looked up without reading and parsing the blocks. The index
+     * is populated by the inserted blocks on commit as well as by the
+     * fetched ones, and keeps the headers of the highest blocks
+     */
+    class HeaderIndexedBlockStorage : public BlockStorage {
+     public:
+      /**
+       * @param storage - storage of all blocks
+       * @param capacity - maximal number of the indexed headers
+       */
+      HeaderIndexedBlockStorage(std::unique_ptr<BlockStorage> storage,
+                                size_t capacity);
+
+      bool insert(
+          std::shared_ptr<const shared_model::interface::Block> block) override;
+
+      boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+      fetch(shared_model::interface::types::HeightType height) const override;
+
+      boost::optional<std::string> fetchSerialized(
+          shared_model::interface::types::HeightType height) const override;
+
+      boost::optional<BlockHeader> fetchHeader(
+          shared_model::interface::types::HeightType height) const override;
+
+      boost::optional<std::unique_ptr<shared_model::interface::Transaction>>
+      fetchTransaction(shared_model::interface::types::HeightType height,
+                       size_t index) const override;
+
+      size_t size() const override;
+
+      void clear() override;
+
+      void forEach(FunctionType function) const override;
+
+      bool flush() override;
+
+      /// @return number of the indexed headers
+      size_t indexedSize() const;
+
+     private:
+      /// index the header and drop the lowest ones over the capacity
+      void put(BlockHeader header) const;
+
+      std::unique_ptr<BlockStorage> storage_;
+      const size_t capacity_;
+
+      mutable std::mutex mutex_;
+      mutable std::map<shared_model::interface::types::HeightType,
+                       BlockHeader>
+          headers_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_HEADER_INDEXED_BLOCK_STORAGE_HPP
@@ -5,33 +5,70 @@
 
 #include "ametsuchi/impl/k_times_reconnection_strategy.hpp"
 
+#include <algorithm>
+#include <thread>
+
 using namespace iroha::ametsuchi;
 
+namespace {
+  /// the delay stops doubling after this number of attempts
+  const size_t kMaxDelayDoublings = 6;
+}  // namespace
+
 // -------------------- | KTimesReconnectionStrategy | -----------------------
 
 KTimesReconnectionStrategy::KTimesReconnectionStrategy(
-    size_t number_of_reconnections)
+    size_t number_of_reconnections,
+    std::chrono::milliseconds initial_delay,
+    std::shared_ptr<ReconnectionStatistics> statistics)
     : max_number_of_reconnections_(number_of_reconnections),
+      initial_delay_(initial_delay),
+      statistics_(std::move(statistics)),
       current_number_of_reconnections_(0u) {}
 
 bool KTimesReconnectionStrategy::canReconnect() {
   if (current_number_of_reconnections_ > max_number_of_reconnections_) {
     return false;
   }
-  return ++current_number_of_reconnections_ <= max_number_of_reconnections_;
+  if (++current_number_of_reconnections_ > max_number_of_reconnections_) {
+    if (statistics_) {
+      statistics_->exhausted->increment();
+    }
+    return false;
+  }
+  if (current_number_of_reconnections_ > 1
+      and initial_delay_ != std::chrono::milliseconds::zero()) {
+    auto doublings = std::min(current_number_of_reconnections_ - 2,
+                              kMaxDelayDoublings);
+    std::this_thread::sleep_for(initial_delay_ * (1 << doublings));
+  }
+  if (statistics_) {
+    statistics_->attempts->increment();
+  }
+  return true;
 }
 void KTimesReconnectionStrategy::reset() {
   current_number_of_reconnections_ = 0u;
+  if (statistics_) {
+    statistics_->failovers->increment();
+  }
 }
 
 // -------------------- | KTimesReconnectionStrategyFactory | ------------------
 
 KTimesReconnectionStrategyFactory::KTimesReconnectionStrategyFactory(
-    size_t number_of_reconnections)
-    : max_number_of_reconnections_(number_of_reconnections) {}
+    size_t number_of_reconnections, std::chrono::milliseconds initial_delay)
+    : max_number_of_reconnections_(number_of_reconnections),
+      initial_delay_(initial_delay),
+      statistics_(std::make_shared<ReconnectionStatistics>()) {}
 
 std::unique_ptr<ReconnectionStrategy>
 KTimesReconnectionStrategyFactory::create() const {
   return std::make_unique<KTimesReconnectionStrategy>(
-      max_number_of_reconnections_);
+      max_number_of_reconnections_, initial_delay_, statistics_);
+}
+
+std::shared_ptr<const ReconnectionStatistics>
+KTimesReconnectionStrategyFactory::statistics() const {
+  return statistics_;
 }
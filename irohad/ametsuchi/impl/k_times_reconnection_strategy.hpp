@@ -8,18 +8,28 @@
 #ifndef IROHA_K_TIMES_RECONNECTION_STRATEGY_HPP
 #define IROHA_K_TIMES_RECONNECTION_STRATEGY_HPP
 
+#include <chrono>
+
 namespace iroha {
   namespace ametsuchi {
     /**
      * Class provides a strategy for reconnection with the limited number of
-     * attempts
+     * attempts. The attempts after the first one are delayed, and the delay
+     * doubles with each attempt, so that a restarting database is not
+     * flooded with connections.
      */
     class KTimesReconnectionStrategy : public ReconnectionStrategy {
      public:
       /**
        * @param number_of_reconnections - number of attempts for reconnection
+       * @param initial_delay - delay before the second attempt
+       * @param statistics - counters to report the reconnections to
        */
-      KTimesReconnectionStrategy(size_t number_of_reconnections);
+      KTimesReconnectionStrategy(
+          size_t number_of_reconnections,
+          std::chrono::milliseconds initial_delay =
+              std::chrono::milliseconds::zero(),
+          std::shared_ptr<ReconnectionStatistics> statistics = nullptr);
 
       KTimesReconnectionStrategy(const KTimesReconnectionStrategy &) = delete;
       KTimesReconnectionStrategy &operator=(
@@ -30,18 +40,32 @@ namespace iroha {
 
      private:
       const size_t max_number_of_reconnections_;
+      const std::chrono::milliseconds initial_delay_;
+      std::shared_ptr<ReconnectionStatistics> statistics_;
       size_t current_number_of_reconnections_;
     };
 
     class KTimesReconnectionStrategyFactory
         : public ReconnectionStrategyFactory {
      public:
-      KTimesReconnectionStrategyFactory(size_t number_of_reconnections);
+      /**
+       * @param number_of_reconnections - number of attempts for reconnection
+       * @param initial_delay - delay before the second attempt
+       */
+      KTimesReconnectionStrategyFactory(
+          size_t number_of_reconnections,
+          std::chrono::milliseconds initial_delay =
+              std::chrono::milliseconds::zero());
 
       std::unique_ptr<ReconnectionStrategy> create() const override;
 
+      /// Counters of all the strategies made by the factory
+      std::shared_ptr<const ReconnectionStatistics> statistics() const;
+
      private:
       const size_t max_number_of_reconnections_;
+      const std::chrono::milliseconds initial_delay_;
+      std::shared_ptr<ReconnectionStatistics> statistics_;
     };
 
   }  // namespace ametsuchi
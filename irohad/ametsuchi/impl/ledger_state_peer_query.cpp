@@ -0,0 +1,39 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/ledger_state_peer_query.hpp"
+
+#include <algorithm>
+
+#include "cryptography/public_key.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    LedgerStatePeerQuery::LedgerStatePeerQuery(
+        std::shared_ptr<const LedgerState> ledger_state)
+        : ledger_state_(std::move(ledger_state)) {}
+
+    boost::optional<std::vector<PeerQuery::wPeer>>
+    LedgerStatePeerQuery::getLedgerPeers() {
+      return ledger_state_->ledger_peers;
+    }
+
+    boost::optional<PeerQuery::wPeer>
+    LedgerStatePeerQuery::getLedgerPeerByPublicKey(
+        const shared_model::interface::types::PubkeyType &public_key) const {
+      const auto &peers = ledger_state_->ledger_peers;
+      auto it = std::find_if(
+          peers.begin(), peers.end(), [&public_key](const auto &peer) {
+            return peer->pubkey() == public_key;
+          });
+      if (it == peers.end()) {
+        return boost::none;
+      }
+      return *it;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,48 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_LEDGER_STATE_PEER_QUERY_HPP
+#define IROHA_LEDGER_STATE_PEER_QUERY_HPP
+
+#include "ametsuchi/peer_query.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "ametsuchi/ledger_state.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Implementation of PeerQuery interface based on the snapshot of the
+     * ledger state of a commit, which answers without the database
+     */
+    class LedgerStatePeerQuery : public PeerQuery {
+     public:
+      explicit LedgerStatePeerQuery(
+          std::shared_ptr<const LedgerState> ledger_state);
+
+      /**
+       * Fetch peers of the ledger state
+       * @return list of peers in insertion to ledger order
+       */
+      boost::optional<std::vector<wPeer>> getLedgerPeers() override;
+
+      /**
+       * Fetch peer with given public key from the ledger state
+       * @return the peer if found, none otherwise
+       */
+      boost::optional<PeerQuery::wPeer> getLedgerPeerByPublicKey(
+          const shared_model::interface::types::PubkeyType &public_key)
+          const override;
+
+     private:
+      std::shared_ptr<const LedgerState> ledger_state_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+#endif  // IROHA_LEDGER_STATE_PEER_QUERY_HPP
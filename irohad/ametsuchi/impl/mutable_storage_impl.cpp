@@ -9,6 +9,7 @@
 #include <rxcpp/operators/rx-all.hpp>
 #include "ametsuchi/command_executor.hpp"
 #include "ametsuchi/impl/peer_query_wsv.hpp"
+#include "ametsuchi/impl/postgres_bulk_loader.hpp"
 #include "ametsuchi/impl/postgres_block_index.hpp"
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 #include "ametsuchi/impl/postgres_indexer.hpp"
@@ -16,7 +17,9 @@
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
 #include "ametsuchi/ledger_state.hpp"
 #include "ametsuchi/tx_executor.hpp"
+#include "common/visitor.hpp"
 #include "interfaces/commands/command.hpp"
+#include "interfaces/commands/command_variant.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
@@ -27,15 +30,20 @@ namespace iroha {
         boost::optional<std::shared_ptr<const iroha::LedgerState>> ledger_state,
         std::shared_ptr<PostgresCommandExecutor> command_executor,
         std::unique_ptr<BlockStorage> block_storage,
-        logger::LoggerManagerTreePtr log_manager)
+        logger::LoggerManagerTreePtr log_manager,
+        bool index_history,
+        std::shared_ptr<StatementMetrics> statement_metrics)
         : ledger_state_(std::move(ledger_state)),
           sql_(command_executor->getSession()),
           peer_query_(
               std::make_unique<PeerQueryWsv>(std::make_shared<PostgresWsvQuery>(
-                  sql_, log_manager->getChild("WsvQuery")->getLogger()))),
+                  sql_,
+                  log_manager->getChild("WsvQuery")->getLogger(),
+                  statement_metrics))),
           block_index_(std::make_unique<PostgresBlockIndex>(
-              std::make_unique<PostgresIndexer>(sql_),
-              log_manager->getChild("PostgresBlockIndex")->getLogger())),
+              std::make_unique<PostgresIndexer>(sql_, statement_metrics),
+              log_manager->getChild("PostgresBlockIndex")->getLogger(),
+              index_history)),
           transaction_executor_(std::make_unique<TransactionExecutor>(
               std::move(command_executor))),
           block_storage_(std::move(block_storage)),
@@ -61,17 +69,36 @@ namespace iroha {
                  block->height(),
                  block->hash().hex());
 
+      // the genesis block, which may create a lot of accounts, is inserted
+      // table by table when possible
+      auto execute_transactions = [&]() -> bool {
+        if (PostgresBulkLoader::isApplicable(*block)) {
+          auto loaded = PostgresBulkLoader(sql_, log_).load(*block);
+          if (auto error = expected::resultToOptionalError(loaded)) {
+            log_->error("{}", *error);
+            return false;
+          }
+          return true;
+        }
+        return std::all_of(block->transactions().begin(),
+                           block->transactions().end(),
+                           execute_transaction);
+      };
+
       auto block_applied =
           (not ledger_state_ or predicate(block, *ledger_state_.value()))
-          and std::all_of(block->transactions().begin(),
-                          block->transactions().end(),
-                          execute_transaction);
+          and execute_transactions();
       if (block_applied) {
         block_storage_->insert(block);
         block_index_->index(*block);
 
-        auto opt_ledger_peers = peer_query_->getLedgerPeers();
-        if (not opt_ledger_peers) {
+        // the peers are read back only when they are changed, which saves a
+        // round trip to the database for the most of the blocks
+        boost::optional<shared_model::interface::types::PeerList>
+            opt_ledger_peers;
+        if (ledger_state_ and not changesLedgerPeers(*block)) {
+          opt_ledger_peers = ledger_state_.value()->ledger_peers;
+        } else if (not(opt_ledger_peers = peer_query_->getLedgerPeers())) {
           log_->error("Failed to get ledger peers!");
           return false;
         }
@@ -126,6 +153,23 @@ namespace iroha {
       return ledger_state_;
     }
 
+    bool MutableStorageImpl::changesLedgerPeers(
+        const shared_model::interface::Block &block) {
+      for (const auto &transaction : block.transactions()) {
+        for (const auto &command : transaction.commands()) {
+          auto changes_peers = visit_in_place(
+              command.get(),
+              [](const shared_model::interface::AddPeer &) { return true; },
+              [](const shared_model::interface::RemovePeer &) { return true; },
+              [](const auto &) { return false; });
+          if (changes_peers) {
+            return true;
+          }
+        }
+      }
+      return false;
+    }
+
     MutableStorageImpl::~MutableStorageImpl() {
       if (not committed) {
         try {
@@ -19,18 +19,25 @@ namespace iroha {
     class BlockIndex;
     class PeerQuery;
     class PostgresCommandExecutor;
+    class StatementMetrics;
     class TransactionExecutor;
 
     class MutableStorageImpl : public MutableStorage {
       friend class StorageImpl;
 
      public:
+      /**
+       * @param index_history - whether the history of the accounts is
+       * indexed together with the blocks
+       */
       MutableStorageImpl(
           boost::optional<std::shared_ptr<const iroha::LedgerState>>
               ledger_state,
           std::shared_ptr<PostgresCommandExecutor> command_executor,
           std::unique_ptr<BlockStorage> block_storage,
-          logger::LoggerManagerTreePtr log_manager);
+          logger::LoggerManagerTreePtr log_manager,
+          bool index_history = true,
+          std::shared_ptr<StatementMetrics> statement_metrics = nullptr);
 
       bool apply(
           std::shared_ptr<const shared_model::interface::Block> block) override;
@@ -42,6 +49,14 @@ namespace iroha {
       boost::optional<std::shared_ptr<const iroha::LedgerState>>
       getLedgerState() const;
 
+      /**
+       * @return whether the block has AddPeer or RemovePeer commands, so the
+       * ledger peers after the block are to be read from WSV instead of
+       * being taken from the ledger state of the previous block
+       */
+      static bool changesLedgerPeers(
+          const shared_model::interface::Block &block);
+
       ~MutableStorageImpl() override;
 
      private:
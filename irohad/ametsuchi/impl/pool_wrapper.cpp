@@ -13,7 +13,31 @@ using namespace iroha::ametsuchi;
 PoolWrapper::PoolWrapper(
     std::shared_ptr<soci::connection_pool> connection_pool,
     std::unique_ptr<FailoverCallbackHolder> failover_callback_holder,
-    bool enable_prepared_transactions)
+    bool enable_prepared_transactions,
+    std::shared_ptr<soci::connection_pool> query_pool,
+    size_t query_pool_size,
+    std::shared_ptr<soci::connection_pool> restore_pool,
+    size_t restore_pool_size,
+    std::vector<std::shared_ptr<soci::connection_pool>> replica_pools,
+    size_t replica_pool_size)
     : connection_pool_(std::move(connection_pool)),
       failover_callback_holder_(std::move(failover_callback_holder)),
-      enable_prepared_transactions_(enable_prepared_transactions) {}
+      enable_prepared_transactions_(enable_prepared_transactions),
+      query_pool_(query_pool ? query_pool : connection_pool_),
+      restore_pool_(restore_pool ? restore_pool : connection_pool_),
+      query_pool_size_(query_pool ? query_pool_size : 0),
+      restore_pool_size_(restore_pool ? restore_pool_size : 0),
+      replica_pools_(std::move(replica_pools)),
+      replica_pool_size_(replica_pool_size) {}
+
+std::shared_ptr<soci::connection_pool> &PoolWrapper::lane(Lane lane) {
+  switch (lane) {
+    case Lane::kQuery:
+      return query_pool_;
+    case Lane::kRestore:
+      return restore_pool_;
+    case Lane::kCommit:
+    default:
+      return connection_pool_;
+  }
+}
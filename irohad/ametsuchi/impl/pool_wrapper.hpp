@@ -7,6 +7,7 @@
 #define IROHA_POOL_WRAPPER_HPP
 
 #include <memory>
+#include <vector>
 
 namespace soci {
   class connection_pool;
@@ -16,15 +17,63 @@ namespace iroha {
   namespace ametsuchi {
     class FailoverCallbackHolder;
 
+    /**
+     * Connections to the database, partitioned into lanes, so that the slow
+     * queries of one subsystem can not take all the connections needed by
+     * another one
+     */
     struct PoolWrapper {
+      enum class Lane {
+        /// block commits, validation and the rest of the consensus work
+        kCommit,
+        /// client queries
+        kQuery,
+        /// history indexing and WSV snapshots
+        kRestore
+      };
+
+      /**
+       * @param connection_pool - connections of the commit lane
+       * @param failover_callback_holder - reconnection callbacks of all the
+       * connections
+       * @param enable_prepared_transactions - whether the database supports
+       * prepared transactions
+       * @param query_pool - connections of the query lane, or nullptr to
+       * share the commit lane ones
+       * @param query_pool_size - number of connections in query_pool
+       * @param restore_pool - connections of the restore lane, or nullptr to
+       * share the commit lane ones
+       * @param restore_pool_size - number of connections in restore_pool
+       * @param replica_pools - connections to the read replicas of the
+       * database, which serve the query lane when they are up to date
+       * @param replica_pool_size - number of connections in each replica pool
+       */
       PoolWrapper(
           std::shared_ptr<soci::connection_pool> connection_pool,
           std::unique_ptr<FailoverCallbackHolder> failover_callback_holder,
-          bool enable_prepared_transactions);
+          bool enable_prepared_transactions,
+          std::shared_ptr<soci::connection_pool> query_pool = nullptr,
+          size_t query_pool_size = 0,
+          std::shared_ptr<soci::connection_pool> restore_pool = nullptr,
+          size_t restore_pool_size = 0,
+          std::vector<std::shared_ptr<soci::connection_pool>> replica_pools =
+              {},
+          size_t replica_pool_size = 0);
+
+      /// @return connections of the lane
+      std::shared_ptr<soci::connection_pool> &lane(Lane lane);
 
       std::shared_ptr<soci::connection_pool> connection_pool_;
       std::unique_ptr<FailoverCallbackHolder> failover_callback_holder_;
       bool enable_prepared_transactions_;
+      /// pools of the lanes, which point to connection_pool_ when shared
+      std::shared_ptr<soci::connection_pool> query_pool_;
+      std::shared_ptr<soci::connection_pool> restore_pool_;
+      /// number of connections in the own pools of the lanes, 0 when shared
+      size_t query_pool_size_;
+      size_t restore_pool_size_;
+      std::vector<std::shared_ptr<soci::connection_pool>> replica_pools_;
+      size_t replica_pool_size_;
     };
 
   }  // namespace ametsuchi
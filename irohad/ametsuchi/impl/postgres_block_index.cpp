@@ -5,13 +5,7 @@
 
 #include "ametsuchi/impl/postgres_block_index.hpp"
 
-#include <boost/range/adaptor/filtered.hpp>
-#include <boost/range/adaptor/indexed.hpp>
-#include <boost/range/adaptor/transformed.hpp>
 #include "ametsuchi/tx_cache_response.hpp"
-#include "common/visitor.hpp"
-#include "interfaces/commands/command_variant.hpp"
-#include "interfaces/commands/transfer_asset.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "logger/logger.hpp"
 
@@ -20,67 +14,75 @@ using namespace shared_model::interface::types;
 
 using TxPosition = iroha::ametsuchi::Indexer::TxPosition;
 
-namespace {
-  // Return transfer asset if command contains it
-  boost::optional<const shared_model::interface::TransferAsset &>
-  getTransferAsset(const shared_model::interface::Command &cmd) noexcept {
-    using ReturnType =
-        boost::optional<const shared_model::interface::TransferAsset &>;
-    return iroha::visit_in_place(
-        cmd.get(),
-        [](const shared_model::interface::TransferAsset &c) {
-          return ReturnType(c);
-        },
-        [](const auto &) -> ReturnType { return boost::none; });
-  }
-}  // namespace
-
 // Collect all assets belonging to creator, sender, and receiver
 // to make account_id:height:asset_id -> list of tx indexes
 // for transfer asset in command
 void PostgresBlockIndex::makeAccountAssetIndex(
     const AccountIdType &account_id,
     TxPosition position,
-    const shared_model::interface::Transaction::CommandsType &commands) {
-  for (const auto &transfer :
-       commands | boost::adaptors::transformed(getTransferAsset)
-           | boost::adaptors::filtered(
-                 [](const auto &opt_tx) { return static_cast<bool>(opt_tx); })
-           | boost::adaptors::transformed(
-                 [](const auto &opt_tx) -> const auto & { return *opt_tx; })) {
-    const auto &src_id = transfer.srcAccountId();
-    const auto &dest_id = transfer.destAccountId();
-
-    const auto ids = {account_id, src_id, dest_id};
-    const auto &asset_id = transfer.assetId();
+    const shared_model::interface::FlatCommandsType &commands) {
+  for (const auto &command : commands) {
+    const auto *transfer =
+        boost::get<shared_model::interface::flat::TransferAsset>(&command);
+    if (transfer == nullptr) {
+      continue;
+    }
     // flat map accounts to unindexed keys
-    for (const auto &id : ids) {
-      indexer_->accountAssetTxPosition(id, asset_id, position);
+    for (auto id : {boost::string_view(account_id),
+                    transfer->src_account_id,
+                    transfer->dest_account_id}) {
+      indexer_->accountAssetTxPosition(id, transfer->asset_id, position);
     }
   }
 }
 
+void PostgresBlockIndex::makeHistoryIndex(
+    const shared_model::interface::Block &block) {
+  auto height = block.height();
+  const auto transactions = block.transactionsSpan();
+  for (size_t index = 0; index < transactions.size(); ++index) {
+    const auto &tx = transactions[index];
+    const auto &creator_id = tx.creatorAccountId();
+    const TxPosition position{height, index};
+
+    makeAccountAssetIndex(creator_id, position, tx.flatCommands());
+    indexer_->txPositionByCreator(creator_id, position);
+  }
+  indexer_->historyHeight(height);
+}
+
 PostgresBlockIndex::PostgresBlockIndex(std::unique_ptr<Indexer> indexer,
-                                       logger::LoggerPtr log)
-    : indexer_(std::move(indexer)), log_(std::move(log)) {}
+                                       logger::LoggerPtr log,
+                                       bool index_history)
+    : indexer_(std::move(indexer)),
+      log_(std::move(log)),
+      index_history_(index_history) {}
 
 void PostgresBlockIndex::index(const shared_model::interface::Block &block) {
   auto height = block.height();
-  for (const auto &tx : block.transactions() | boost::adaptors::indexed(0)) {
-    const auto &creator_id = tx.value().creatorAccountId();
-    const TxPosition position{height, static_cast<size_t>(tx.index())};
-
-    makeAccountAssetIndex(creator_id, position, tx.value().commands());
-    indexer_->txHashPosition(tx.value().hash(), position);
-    indexer_->committedTxHash(tx.value().hash());
-    indexer_->txPositionByCreator(creator_id, position);
+  const auto transactions = block.transactionsSpan();
+  for (size_t index = 0; index < transactions.size(); ++index) {
+    const auto &hash = transactions[index].hash();
+    indexer_->txHashPosition(hash, TxPosition{height, index});
+    indexer_->committedTxHash(hash);
   }
 
   for (const auto &rejected_tx_hash : block.rejected_transactions_hashes()) {
     indexer_->rejectedTxHash(rejected_tx_hash);
   }
 
+  if (index_history_) {
+    makeHistoryIndex(block);
+  }
+  indexer_->topBlock(height, block.hash());
+
   if (auto e = resultToOptionalError(indexer_->flush())) {
     log_->error(e.value());
   }
 }
+
+iroha::expected::Result<void, std::string> PostgresBlockIndex::indexHistory(
+    const shared_model::interface::Block &block) {
+  makeHistoryIndex(block);
+  return indexer_->flush();
+}
@@ -26,24 +26,45 @@ namespace iroha {
      *     c. destination account
      *   2. account -> block for source and destination accounts
      *   3. (account, height) -> list of txes
+     *
+     * The indices by creator and by account asset form the history of the
+     * accounts, which may be built apart from the commit of the block with
+     * indexHistory, see PostgresHistoryIndexer
      */
     class PostgresBlockIndex : public BlockIndex {
      public:
+      /**
+       * @param index_history - whether the history of the accounts is
+       * indexed together with the block
+       */
       PostgresBlockIndex(std::unique_ptr<Indexer> indexer,
-                         logger::LoggerPtr log);
+                         logger::LoggerPtr log,
+                         bool index_history = true);
 
       /// Index a block.
       void index(const shared_model::interface::Block &block) override;
 
+      /**
+       * Index only the history of the accounts of a block, which is already
+       * indexed without it, and mark the block as the last one with the
+       * indexed history
+       */
+      expected::Result<void, std::string> indexHistory(
+          const shared_model::interface::Block &block);
+
      private:
+      /// Collect the history indices of the block.
+      void makeHistoryIndex(const shared_model::interface::Block &block);
+
       /// Index a transaction.
       void makeAccountAssetIndex(
           const shared_model::interface::types::AccountIdType &account_id,
           Indexer::TxPosition position,
-          const shared_model::interface::Transaction::CommandsType &commands);
+          const shared_model::interface::FlatCommandsType &commands);
 
       std::unique_ptr<Indexer> indexer_;
       logger::LoggerPtr log_;
+      bool index_history_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -5,6 +5,8 @@
 
 #include "ametsuchi/impl/postgres_block_query.hpp"
 
+#include <unordered_map>
+
 #include <boost/format.hpp>
 #include "ametsuchi/impl/soci_utils.hpp"
 #include "common/byteutils.hpp"
@@ -38,6 +40,30 @@ namespace iroha {
       return clone(**block);
     }
 
+    BlockQuery::SerializedBlockResult PostgresBlockQuery::getSerializedBlock(
+        shared_model::interface::types::HeightType height) {
+      auto block = block_storage_.fetchSerialized(height);
+      if (not block) {
+        auto error =
+            boost::format("Failed to retrieve block with height %d") % height;
+        return expected::makeError(
+            GetBlockError{GetBlockError::Code::kNoBlock, error.str()});
+      }
+      return expected::makeValue(std::move(*block));
+    }
+
+    BlockQuery::BlockHeaderResult PostgresBlockQuery::getBlockHeader(
+        shared_model::interface::types::HeightType height) {
+      auto header = block_storage_.fetchHeader(height);
+      if (not header) {
+        auto error =
+            boost::format("Failed to retrieve block with height %d") % height;
+        return expected::makeError(
+            GetBlockError{GetBlockError::Code::kNoBlock, error.str()});
+      }
+      return expected::makeValue(std::move(*header));
+    }
+
     shared_model::interface::types::HeightType
     PostgresBlockQuery::getTopBlockHeight() {
       return block_storage_.size();
@@ -49,7 +75,8 @@ namespace iroha {
       const auto &hash_str = hash.hex();
 
       try {
-        sql_ << "SELECT status FROM tx_status_by_hash WHERE hash = :hash",
+        sql_ << "SELECT status FROM tx_status_by_hash "
+                "WHERE hash = decode(:hash, 'hex')",
             soci::into(res), soci::use(hash_str);
       } catch (const std::exception &e) {
         log_->error("Failed to execute query: {}", e.what());
@@ -70,5 +97,50 @@ namespace iroha {
           tx_cache_status_responses::Missing{hash});
     }
 
+    boost::optional<std::vector<TxCacheStatusType>>
+    PostgresBlockQuery::checkTxsPresence(
+        const std::vector<shared_model::crypto::Hash> &hashes) {
+      std::vector<std::string> hash_strs;
+      hash_strs.reserve(hashes.size());
+      for (const auto &hash : hashes) {
+        hash_strs.push_back(hash.hex());
+      }
+      std::vector<std::string> hash_literals;
+      hash_literals.reserve(hashes.size());
+      for (const auto &hash_str : hash_strs) {
+        hash_literals.push_back(makePgBytea(hash_str));
+      }
+      auto hashes_array = makePgArray(hash_literals);
+
+      std::unordered_map<std::string, int> statuses;
+      try {
+        using T = boost::tuple<std::string, int>;
+        soci::rowset<T> rows = (sql_.prepare << R"(
+            SELECT encode(hash, 'hex'), status FROM tx_status_by_hash
+            WHERE hash = ANY(CAST(:hashes AS bytea[])))",
+                                soci::use(hashes_array, "hashes"));
+        for (const auto &row : rows) {
+          statuses.emplace(row.get<0>(), row.get<1>());
+        }
+      } catch (const std::exception &e) {
+        log_->error("Failed to execute query: {}", e.what());
+        return boost::none;
+      }
+
+      std::vector<TxCacheStatusType> result;
+      result.reserve(hashes.size());
+      for (size_t i = 0; i < hashes.size(); ++i) {
+        auto it = statuses.find(hash_strs[i]);
+        if (it == statuses.end()) {
+          result.emplace_back(tx_cache_status_responses::Missing{hashes[i]});
+        } else if (it->second > 0) {
+          result.emplace_back(tx_cache_status_responses::Committed{hashes[i]});
+        } else {
+          result.emplace_back(tx_cache_status_responses::Rejected{hashes[i]});
+        }
+      }
+      return result;
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -32,11 +32,20 @@ namespace iroha {
       BlockResult getBlock(
           shared_model::interface::types::HeightType height) override;
 
+      SerializedBlockResult getSerializedBlock(
+          shared_model::interface::types::HeightType height) override;
+
+      BlockHeaderResult getBlockHeader(
+          shared_model::interface::types::HeightType height) override;
+
       shared_model::interface::types::HeightType getTopBlockHeight() override;
 
       boost::optional<TxCacheStatusType> checkTxPresence(
           const shared_model::crypto::Hash &hash) override;
 
+      boost::optional<std::vector<TxCacheStatusType>> checkTxsPresence(
+          const std::vector<shared_model::crypto::Hash> &hashes) override;
+
      private:
       std::unique_ptr<soci::session> psql_;
       soci::session &sql_;
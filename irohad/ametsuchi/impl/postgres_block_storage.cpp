@@ -5,6 +5,10 @@
 
 #include "ametsuchi/impl/postgres_block_storage.hpp"
 
+#include <algorithm>
+#include <stdexcept>
+
+#include <soci/postgresql/soci-postgresql.h>
 #include "common/hexutils.hpp"
 #include "logger/logger.hpp"
 
@@ -16,47 +20,163 @@ PostgresBlockStorage::PostgresBlockStorage(
     std::shared_ptr<PoolWrapper> pool_wrapper,
     std::shared_ptr<BlockTransportFactory> block_factory,
     std::string table,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    size_t flush_size)
     : pool_wrapper_(std::move(pool_wrapper)),
       block_factory_(std::move(block_factory)),
       table_(std::move(table)),
-      log_(std::move(log)) {}
+      log_(std::move(log)),
+      flush_size_(std::max<size_t>(flush_size, 1)) {}
+
+PostgresBlockStorage::~PostgresBlockStorage() {
+  flush();
+}
 
 bool PostgresBlockStorage::insert(
     std::shared_ptr<const shared_model::interface::Block> block) {
   auto inserted_height = block->height();
 
-  auto opt_range = getBlockHeightsRange();
-  if (opt_range and inserted_height != opt_range->max + 1) {
+  std::lock_guard<std::mutex> lock(buffer_mutex_);
+  if (not last_height_) {
+    if (auto range = getBlockHeightsRange()) {
+      last_height_ = range->max;
+    }
+  }
+  if (last_height_ and inserted_height != *last_height_ + 1) {
     log_->warn(
         "Only blocks with sequential heights could be inserted. "
         "Last block height: {}, inserting: {}",
-        opt_range->max,
+        *last_height_,
         inserted_height);
     return false;
   }
 
-  auto b = block->blob().hex();
+  log_->debug("insert block {}", inserted_height);
+  buffer_.emplace_back(inserted_height, block->blob().hex());
+  last_height_ = inserted_height;
+  if (buffer_.size() < flush_size_) {
+    return true;
+  }
+  return flushLocked();
+}
+
+bool PostgresBlockStorage::flush() {
+  std::lock_guard<std::mutex> lock(buffer_mutex_);
+  return flushLocked();
+}
 
+bool PostgresBlockStorage::flushLocked() const {
+  if (buffer_.empty()) {
+    return true;
+  }
   soci::session sql(*pool_wrapper_->connection_pool_);
-  soci::statement st = (sql.prepare << "INSERT INTO " << table_
-                                    << " (height, block_data) VALUES(:height, "
-                                       ":block_data)",
-                        soci::use(inserted_height),
-                        soci::use(b));
-  log_->debug("insert block {}: {}", inserted_height, b);
   try {
-    st.execute(true);
+    if (buffer_.size() >= kMinCopyBlocks) {
+      copyRows(sql);
+    } else {
+      insertRows(sql);
+    }
+    buffer_.clear();
     return true;
   } catch (const std::exception &e) {
-    log_->warn(
-        "Failed to insert block {}, reason {}", inserted_height, e.what());
+    log_->warn("Failed to insert blocks {} to {}, reason {}",
+               buffer_.front().first,
+               buffer_.back().first,
+               e.what());
+    // the table decides the next height after the failure
+    buffer_.clear();
+    last_height_ = boost::none;
     return false;
   }
 }
 
+void PostgresBlockStorage::insertRows(soci::session &sql) const {
+  std::vector<std::string> heights, blocks;
+  for (const auto &row : buffer_) {
+    heights.push_back(std::to_string(row.first));
+    blocks.push_back(row.second);
+  }
+  auto heights_array = makePgArray(heights);
+  auto blocks_array = makePgArray(blocks);
+  sql << "INSERT INTO " << table_
+      << " (height, block_data) SELECT * FROM unnest("
+         "CAST(:heights AS bigint[]), CAST(:blocks AS text[]))",
+      soci::use(heights_array), soci::use(blocks_array);
+}
+
+void PostgresBlockStorage::copyRows(soci::session &sql) const {
+  auto *connection =
+      static_cast<soci::postgresql_session_backend *>(sql.get_backend())
+          ->conn_;
+  auto check = [connection](PGresult *result, ExecStatusType expected) {
+    auto status = PQresultStatus(result);
+    PQclear(result);
+    if (status != expected) {
+      throw std::runtime_error(PQerrorMessage(connection));
+    }
+  };
+
+  check(PQexec(connection,
+               ("COPY " + table_ + " (height, block_data) FROM STDIN").c_str()),
+        PGRES_COPY_IN);
+  // the hex of the blocks needs no escaping in the text format
+  std::string data;
+  for (const auto &row : buffer_) {
+    data += std::to_string(row.first);
+    data += '\t';
+    data += row.second;
+    data += '\n';
+  }
+  // the copy is ended in any case, so that the connection is usable after
+  // a failure
+  auto sent =
+      PQputCopyData(connection, data.data(), static_cast<int>(data.size()))
+      == 1;
+  if (PQputCopyEnd(connection, sent ? nullptr : "failed to send the blocks")
+      != 1) {
+    throw std::runtime_error(PQerrorMessage(connection));
+  }
+  auto *result = PQgetResult(connection);
+  auto status = PQresultStatus(result);
+  do {
+    PQclear(result);
+  } while ((result = PQgetResult(connection)));
+  if (status != PGRES_COMMAND_OK) {
+    throw std::runtime_error(PQerrorMessage(connection));
+  }
+}
+
+void PostgresBlockStorage::discardBuffer() {
+  std::lock_guard<std::mutex> lock(buffer_mutex_);
+  buffer_.clear();
+}
+
 boost::optional<std::shared_ptr<const shared_model::interface::Block>>
 PostgresBlockStorage::fetch(HeightType height) const {
+  return fetchSerialized(height) | [&, this](const auto &byte_block) {
+    return block_factory_->createBlock(byte_block.data(), byte_block.size())
+        .match(
+            [&](auto &&v) {
+              return boost::make_optional(
+                  std::shared_ptr<const shared_model::interface::Block>(
+                      std::move(v.value)));
+            },
+            [&](const auto &e)
+                -> boost::optional<
+                    std::shared_ptr<const shared_model::interface::Block>> {
+              log_->error(
+                  "Could not build block at height {}: {}", height, e.error);
+              return boost::none;
+            });
+  };
+}
+
+boost::optional<std::string> PostgresBlockStorage::fetchSerialized(
+    HeightType height) const {
+  {
+    std::lock_guard<std::mutex> lock(buffer_mutex_);
+    flushLocked();
+  }
   soci::session sql(*pool_wrapper_->connection_pool_);
   using QueryTuple = boost::tuple<boost::optional<std::string>>;
   QueryTuple row;
@@ -70,33 +190,16 @@ PostgresBlockStorage::fetch(HeightType height) const {
   return rebind(viewQuery<QueryTuple>(row)) | [&, this](auto row) {
     return iroha::ametsuchi::apply(row, [&, this](auto &block_data) {
       log_->debug("fetched: {}", block_data);
-      return iroha::hexstringToBytestring(block_data) |
-          [&, this](auto byte_block) {
-            iroha::protocol::Block_v1 b1;
-            b1.ParseFromString(byte_block);
-            iroha::protocol::Block block;
-            *block.mutable_block_v1() = b1;
-            return block_factory_->createBlock(std::move(block))
-                .match(
-                    [&](auto &&v) {
-                      return boost::make_optional(
-                          std::shared_ptr<const shared_model::interface::Block>(
-                              std::move(v.value)));
-                    },
-                    [&](const auto &e)
-                        -> boost::optional<std::shared_ptr<
-                            const shared_model::interface::Block>> {
-                      log_->error("Could not build block at height {}: {}",
-                                  height,
-                                  e.error);
-                      return boost::none;
-                    });
-          };
+      return iroha::hexstringToBytestring(block_data);
     });
   };
 }
 
 size_t PostgresBlockStorage::size() const {
+  {
+    std::lock_guard<std::mutex> lock(buffer_mutex_);
+    flushLocked();
+  }
   return (getBlockHeightsRange() |
           [](auto range) {
             return boost::make_optional(range.max - range.min + 1);
@@ -105,6 +208,9 @@ size_t PostgresBlockStorage::size() const {
 }
 
 void PostgresBlockStorage::clear() {
+  std::lock_guard<std::mutex> lock(buffer_mutex_);
+  buffer_.clear();
+  last_height_ = boost::none;
   soci::session sql(*pool_wrapper_->connection_pool_);
   soci::statement st = (sql.prepare << "TRUNCATE " << table_);
   try {
@@ -116,7 +222,10 @@ void PostgresBlockStorage::clear() {
 
 void PostgresBlockStorage::forEach(
     iroha::ametsuchi::BlockStorage::FunctionType function) const {
-  soci::session sql(*pool_wrapper_->connection_pool_);
+  {
+    std::lock_guard<std::mutex> lock(buffer_mutex_);
+    flushLocked();
+  }
   getBlockHeightsRange() | [this, &function](auto range) {
     while (range.min <= range.max) {
       function(*this->fetch(range.min));
@@ -151,13 +260,17 @@ PostgresTemporaryBlockStorage::PostgresTemporaryBlockStorage(
     std::shared_ptr<PoolWrapper> pool_wrapper,
     std::shared_ptr<BlockTransportFactory> block_factory,
     std::string table,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    size_t flush_size)
     : PostgresBlockStorage(std::move(pool_wrapper),
                            std::move(block_factory),
                            std::move(table),
-                           std::move(log)) {}
+                           std::move(log),
+                           flush_size) {}
 
 PostgresTemporaryBlockStorage::~PostgresTemporaryBlockStorage() {
+  // the table is dropped with the blocks
+  discardBuffer();
   soci::session sql(*pool_wrapper_->connection_pool_);
   soci::statement st = (sql.prepare << "DROP TABLE IF EXISTS " << table_);
   try {
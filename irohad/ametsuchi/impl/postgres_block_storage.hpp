@@ -8,6 +8,10 @@
 
 #include "ametsuchi/block_storage.hpp"
 
+#include <mutex>
+#include <utility>
+#include <vector>
+
 #include "ametsuchi/impl/pool_wrapper.hpp"
 #include "ametsuchi/impl/soci_utils.hpp"
 #include "backend/protobuf/block.hpp"
@@ -17,14 +21,31 @@
 
 namespace iroha {
   namespace ametsuchi {
+    /**
+     * Block storage in a table of the database. The inserted blocks are
+     * buffered and written with one statement per flush, a COPY for the
+     * larger flushes, which saves the round trips of the restore and the
+     * synchronization inserting many blocks in a row. The buffer is flushed
+     * before any read, so the storage always reads the inserted blocks
+     */
     class PostgresBlockStorage : public BlockStorage {
      public:
       using BlockTransportFactory = shared_model::proto::ProtoBlockFactory;
 
+      /// flushes of at least this number of blocks are written with COPY
+      static constexpr size_t kMinCopyBlocks = 16;
+
+      /**
+       * @param flush_size - number of the buffered blocks at which they are
+       * written to the table, 1 writes every block on its insertion
+       */
       PostgresBlockStorage(std::shared_ptr<PoolWrapper> pool_wrapper,
                            std::shared_ptr<BlockTransportFactory> block_factory,
                            std::string table,
-                           logger::LoggerPtr log);
+                           logger::LoggerPtr log,
+                           size_t flush_size = 1);
+
+      ~PostgresBlockStorage() override;
 
       bool insert(
           std::shared_ptr<const shared_model::interface::Block> block) override;
@@ -32,12 +53,18 @@ namespace iroha {
       boost::optional<std::shared_ptr<const shared_model::interface::Block>>
       fetch(shared_model::interface::types::HeightType height) const override;
 
+      boost::optional<std::string> fetchSerialized(
+          shared_model::interface::types::HeightType height) const override;
+
       size_t size() const override;
 
       void clear() override;
 
       void forEach(FunctionType function) const override;
 
+      /// write the buffered blocks to the table
+      bool flush() override;
+
      private:
       struct HeightRange {
         shared_model::interface::types::HeightType min;
@@ -47,11 +74,35 @@ namespace iroha {
       /// Get the range of stored block heights.
       boost::optional<HeightRange> getBlockHeightsRange() const;
 
+      /// write the buffered blocks, the buffer mutex has to be held
+      bool flushLocked() const;
+
+      /// insert the rows with one INSERT statement
+      void insertRows(soci::session &sql) const;
+
+      /// insert the rows with COPY
+      void copyRows(soci::session &sql) const;
+
      protected:
+      /// drop the buffered blocks without writing them
+      void discardBuffer();
+
       std::shared_ptr<PoolWrapper> pool_wrapper_;
       std::shared_ptr<BlockTransportFactory> block_factory_;
       std::string table_;
       logger::LoggerPtr log_;
+
+     private:
+      const size_t flush_size_;
+      mutable std::mutex buffer_mutex_;
+      /// heights and hex of the blocks waiting to be written
+      mutable std::vector<
+          std::pair<shared_model::interface::types::HeightType, std::string>>
+          buffer_;
+      /// height of the last inserted block, none if it has to be read from
+      /// the table
+      mutable boost::optional<shared_model::interface::types::HeightType>
+          last_height_;
     };
 
     class PostgresTemporaryBlockStorage : public PostgresBlockStorage {
@@ -60,7 +111,8 @@ namespace iroha {
           std::shared_ptr<PoolWrapper> pool_wrapper,
           std::shared_ptr<BlockTransportFactory> block_factory,
           std::string table,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          size_t flush_size = 1);
       ~PostgresTemporaryBlockStorage() override;
     };
   }  // namespace ametsuchi
@@ -13,11 +13,13 @@ PostgresBlockStorageFactory::PostgresBlockStorageFactory(
     std::shared_ptr<PoolWrapper> pool_wrapper,
     std::shared_ptr<shared_model::proto::ProtoBlockFactory> block_factory,
     std::function<std::string()> table_name_provider,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    size_t flush_size)
     : pool_wrapper_(std::move(pool_wrapper)),
       block_factory_(std::move(block_factory)),
       table_name_provider_(std::move(table_name_provider)),
-      log_(std::move(log)) {}
+      log_(std::move(log)),
+      flush_size_(flush_size) {}
 
 std::unique_ptr<BlockStorage> PostgresBlockStorageFactory::create() {
   soci::session sql(*pool_wrapper_->connection_pool_);
@@ -28,7 +30,7 @@ std::unique_ptr<BlockStorage> PostgresBlockStorageFactory::create() {
   }
 
   return std::make_unique<PostgresTemporaryBlockStorage>(
-      pool_wrapper_, block_factory_, std::move(table), log_);
+      pool_wrapper_, block_factory_, std::move(table), log_, flush_size_);
 }
 
 iroha::expected::Result<void, std::string>
@@ -15,11 +15,16 @@ namespace iroha {
   namespace ametsuchi {
     class PostgresBlockStorageFactory : public BlockStorageFactory {
      public:
+      /**
+       * @param flush_size - number of the blocks buffered by the created
+       * storages before they are written to the table
+       */
       PostgresBlockStorageFactory(
           std::shared_ptr<PoolWrapper> pool_wrapper,
           std::shared_ptr<shared_model::proto::ProtoBlockFactory> block_factory,
           std::function<std::string()> table_name_provider,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          size_t flush_size = 1);
       std::unique_ptr<BlockStorage> create() override;
 
       static iroha::expected::Result<void, std::string> createTable(
@@ -30,6 +35,7 @@ namespace iroha {
       std::shared_ptr<shared_model::proto::ProtoBlockFactory> block_factory_;
       std::function<std::string()> table_name_provider_;
       logger::LoggerPtr log_;
+      size_t flush_size_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -0,0 +1,331 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/postgres_bulk_loader.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <soci/soci.h>
+#include <boost/algorithm/string/join.hpp>
+#include <boost/format.hpp>
+#include <boost/range/iterator_range.hpp>
+#include "common/visitor.hpp"
+#include "cryptography/public_key.hpp"
+#include "interfaces/commands/add_peer.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/append_role.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/create_asset.hpp"
+#include "interfaces/commands/create_domain.hpp"
+#include "interfaces/commands/create_role.hpp"
+#include "interfaces/common_objects/peer.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
+#include "logger/logger.hpp"
+
+using namespace shared_model::interface;
+
+namespace {
+
+  /// @return the value as a JSON string
+  std::string jsonString(const std::string &value) {
+    std::string json;
+    json.reserve(value.size() + 2);
+    json += '"';
+    for (char c : value) {
+      switch (c) {
+        case '"':
+          json += "\\\"";
+          break;
+        case '\\':
+          json += "\\\\";
+          break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[7];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            json += escaped;
+          } else {
+            json += c;
+          }
+      }
+    }
+    json += '"';
+    return json;
+  }
+
+  /// @return JSON object of the columns and their JSON values
+  std::string row(
+      std::initializer_list<std::pair<const char *, std::string>> columns) {
+    std::string json = "{";
+    for (const auto &column : columns) {
+      if (json.size() > 1) {
+        json += ',';
+      }
+      json += '"';
+      json += column.first;
+      json += "\":";
+      json += column.second;
+    }
+    json += '}';
+    return json;
+  }
+
+  /// rows of a WSV table
+  struct Table {
+    const char *name;
+    std::vector<std::string> rows;
+  };
+
+  /**
+   * Collector of the rows, which checks the references the same way the
+   * commands executed in the order of the block would
+   */
+  class RowsCollector {
+   public:
+    /// tables in the order which satisfies their foreign keys
+    std::vector<Table> tables{{"role", {}},
+                              {"role_has_permissions", {}},
+                              {"domain", {}},
+                              {"signatory", {}},
+                              {"account", {}},
+                              {"account_has_signatory", {}},
+                              {"account_has_roles", {}},
+                              {"peer", {}},
+                              {"asset", {}}};
+
+    iroha::expected::Result<void, std::string> operator()(
+        const CreateRole &command) {
+      roles_.insert(command.roleName());
+      add(kRole, row({{"role_id", jsonString(command.roleName())}}));
+      add(kRoleHasPermissions,
+          row({{"role_id", jsonString(command.roleName())},
+               {"permission",
+                jsonString(command.rolePermissions().toBitstring())}}));
+      return iroha::expected::Value<void>();
+    }
+
+    iroha::expected::Result<void, std::string> operator()(
+        const CreateDomain &command) {
+      if (roles_.count(command.userDefaultRole()) == 0) {
+        return iroha::expected::makeError("CreateDomain " + command.domainId()
+                                          + ": no role "
+                                          + command.userDefaultRole());
+      }
+      default_roles_.emplace(command.domainId(), command.userDefaultRole());
+      add(kDomain,
+          row({{"domain_id", jsonString(command.domainId())},
+               {"default_role", jsonString(command.userDefaultRole())}}));
+      return iroha::expected::Value<void>();
+    }
+
+    iroha::expected::Result<void, std::string> operator()(
+        const CreateAccount &command) {
+      auto account_id = command.accountName() + "@" + command.domainId();
+      auto default_role = default_roles_.find(command.domainId());
+      if (default_role == default_roles_.end()) {
+        return iroha::expected::makeError("CreateAccount " + account_id
+                                          + ": no domain");
+      }
+      accounts_.insert(account_id);
+      auto pubkey = command.pubkey().hex();
+      addSignatory(pubkey);
+      add(kAccount,
+          row({{"account_id", jsonString(account_id)},
+               {"domain_id", jsonString(command.domainId())},
+               {"quorum", "1"},
+               {"data", "{}"}}));
+      add(kAccountHasSignatory,
+          row({{"account_id", jsonString(account_id)},
+               {"public_key", jsonString(pubkey)}}));
+      add(kAccountHasRoles,
+          row({{"account_id", jsonString(account_id)},
+               {"role_id", jsonString(default_role->second)}}));
+      return iroha::expected::Value<void>();
+    }
+
+    iroha::expected::Result<void, std::string> operator()(
+        const AddSignatory &command) {
+      if (accounts_.count(command.accountId()) == 0) {
+        return iroha::expected::makeError("AddSignatory: no account "
+                                          + command.accountId());
+      }
+      auto pubkey = command.pubkey().hex();
+      addSignatory(pubkey);
+      add(kAccountHasSignatory,
+          row({{"account_id", jsonString(command.accountId())},
+               {"public_key", jsonString(pubkey)}}));
+      return iroha::expected::Value<void>();
+    }
+
+    iroha::expected::Result<void, std::string> operator()(
+        const AppendRole &command) {
+      if (accounts_.count(command.accountId()) == 0
+          or roles_.count(command.roleName()) == 0) {
+        return iroha::expected::makeError("AppendRole " + command.roleName()
+                                          + ": no role or account "
+                                          + command.accountId());
+      }
+      add(kAccountHasRoles,
+          row({{"account_id", jsonString(command.accountId())},
+               {"role_id", jsonString(command.roleName())}}));
+      return iroha::expected::Value<void>();
+    }
+
+    iroha::expected::Result<void, std::string> operator()(
+        const AddPeer &command) {
+      const auto &peer = command.peer();
+      add(kPeer,
+          row({{"public_key", jsonString(peer.pubkey().hex())},
+               {"address", jsonString(peer.address())},
+               {"tls_certificate",
+                peer.tlsCertificate() ? jsonString(*peer.tlsCertificate())
+                                      : "null"}}));
+      return iroha::expected::Value<void>();
+    }
+
+    iroha::expected::Result<void, std::string> operator()(
+        const CreateAsset &command) {
+      if (default_roles_.count(command.domainId()) == 0) {
+        return iroha::expected::makeError("CreateAsset " + command.assetName()
+                                          + ": no domain "
+                                          + command.domainId());
+      }
+      add(kAsset,
+          row({{"asset_id",
+                jsonString(command.assetName() + "#" + command.domainId())},
+               {"domain_id", jsonString(command.domainId())},
+               {"precision", std::to_string(command.precision())}}));
+      return iroha::expected::Value<void>();
+    }
+
+    template <typename T>
+    iroha::expected::Result<void, std::string> operator()(const T &) {
+      return iroha::expected::makeError(
+          "command is not supported by bulk load");
+    }
+
+   private:
+    enum TableIndex {
+      kRole,
+      kRoleHasPermissions,
+      kDomain,
+      kSignatory,
+      kAccount,
+      kAccountHasSignatory,
+      kAccountHasRoles,
+      kPeer,
+      kAsset
+    };
+
+    void add(TableIndex table, std::string row) {
+      tables[table].rows.push_back(std::move(row));
+    }
+
+    /// the signatories are shared by the accounts
+    void addSignatory(const std::string &pubkey) {
+      if (signatories_.insert(pubkey).second) {
+        add(kSignatory, row({{"public_key", jsonString(pubkey)}}));
+      }
+    }
+
+    std::unordered_set<std::string> roles_;
+    std::unordered_map<std::string, std::string> default_roles_;
+    std::unordered_set<std::string> accounts_;
+    std::unordered_set<std::string> signatories_;
+  };
+
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    constexpr size_t PostgresBulkLoader::kDefaultChunkRows;
+
+    PostgresBulkLoader::PostgresBulkLoader(soci::session &sql,
+                                           logger::LoggerPtr log,
+                                           size_t chunk_rows)
+        : sql_(sql),
+          log_(std::move(log)),
+          chunk_rows_(std::max<size_t>(chunk_rows, 1)) {}
+
+    bool PostgresBulkLoader::isApplicable(
+        const shared_model::interface::Block &block) {
+      if (block.height() != 1) {
+        return false;
+      }
+      for (const auto &transaction : block.transactions()) {
+        for (const auto &command : transaction.commands()) {
+          auto supported = visit_in_place(
+              command.get(),
+              [](const CreateRole &) { return true; },
+              [](const CreateDomain &) { return true; },
+              [](const CreateAccount &) { return true; },
+              [](const AddSignatory &) { return true; },
+              [](const AppendRole &) { return true; },
+              [](const AddPeer &) { return true; },
+              [](const CreateAsset &) { return true; },
+              [](const auto &) { return false; });
+          if (not supported) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    expected::Result<void, std::string> PostgresBulkLoader::load(
+        const shared_model::interface::Block &block) {
+      RowsCollector collector;
+      for (const auto &transaction : block.transactions()) {
+        for (const auto &command : transaction.commands()) {
+          auto collected =
+              visit_in_place(command.get(), [&collector](const auto &concrete) {
+                return collector(concrete);
+              });
+          if (auto error = expected::resultToOptionalError(collected)) {
+            return expected::makeError(std::move(*error));
+          }
+        }
+      }
+
+      size_t rows_count = 0;
+      try {
+        for (const auto &table : collector.tables) {
+          for (auto begin = table.rows.begin(); begin != table.rows.end();) {
+            auto end = begin
+                + std::min<size_t>(chunk_rows_,
+                                   std::distance(begin, table.rows.end()));
+            std::string rows =
+                "[" + boost::algorithm::join(
+                          boost::make_iterator_range(begin, end), ",")
+                + "]";
+            sql_ << (boost::format("INSERT INTO %1% SELECT * FROM "
+                                   "json_populate_recordset(NULL::%1%, "
+                                   "CAST(:rows AS json))")
+                     % table.name)
+                        .str(),
+                soci::use(rows);
+            begin = end;
+          }
+          rows_count += table.rows.size();
+        }
+      } catch (const std::exception &e) {
+        return expected::makeError(std::string{"Failed to bulk load block: "}
+                                   + e.what());
+      }
+
+      log_->info("Bulk loaded {} WSV rows of block {}",
+                 rows_count,
+                 block.height());
+      return expected::Value<void>();
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,71 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_POSTGRES_BULK_LOADER_HPP
+#define IROHA_POSTGRES_BULK_LOADER_HPP
+
+#include "common/result.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace soci {
+  class session;
+}
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Loader of the genesis block into the empty WSV, which collects the rows
+     * of all its commands and inserts each table with a few statements
+     * instead of executing the commands one by one. The genesis commands are
+     * not validated, so the result is the same as of the regular execution
+     */
+    class PostgresBulkLoader {
+     public:
+      /// default number of the rows inserted by one statement
+      static constexpr size_t kDefaultChunkRows = 10000;
+
+      /**
+       * @param sql - session in the transaction of the mutable storage
+       * @param log - logger
+       * @param chunk_rows - maximal number of the rows of one statement
+       */
+      PostgresBulkLoader(soci::session &sql,
+                         logger::LoggerPtr log,
+                         size_t chunk_rows = kDefaultChunkRows);
+
+      /**
+       * @param block - block to be applied
+       * @return whether the block is the genesis one and all of its commands
+       * only create the WSV entities, so the block can be bulk loaded
+       */
+      static bool isApplicable(const shared_model::interface::Block &block);
+
+      /**
+       * Insert the rows of the block commands in the current transaction.
+       * The block must be applicable, the WSV must be empty
+       * @param block - genesis block
+       * @return error message on failure, the transaction is to be rolled
+       * back then
+       */
+      expected::Result<void, std::string> load(
+          const shared_model::interface::Block &block);
+
+     private:
+      soci::session &sql_;
+      logger::LoggerPtr log_;
+      size_t chunk_rows_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_POSTGRES_BULK_LOADER_HPP
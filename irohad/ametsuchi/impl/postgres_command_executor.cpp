@@ -10,8 +10,12 @@
 #include <soci/postgresql/soci-postgresql.h>
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/join.hpp>
+#include <boost/container/small_vector.hpp>
 #include <boost/format.hpp>
+#include <boost/optional.hpp>
 #include "ametsuchi/impl/soci_utils.hpp"
+#include "ametsuchi/impl/statement_metrics.hpp"
+#include "common/visitor.hpp"
 #include "cryptography/public_key.hpp"
 #include "interfaces/commands/add_asset_quantity.hpp"
 #include "interfaces/commands/add_peer.hpp"
@@ -181,12 +185,11 @@ namespace {
       const shared_model::interface::types::AccountIdType &account_id) {
     std::string query = (boost::format(R"(
           SELECT
-              COALESCE(bit_or(rp.permission), '0'::bit(%1%))
+              COALESCE(bit_or(permission), '0'::bit(%1%))
               & (%2%::bit(%1%) | '%3%'::bit(%1%))
               != '0'::bit(%1%)
-          FROM role_has_permissions AS rp
-              JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-              WHERE ar.account_id = %4%)")
+          FROM account_effective_permissions
+              WHERE account_id = %4%)")
                          % kRolePermissionSetSize % permission_bitstring
                          % kRootRolePermStr % account_id)
                             .str();
@@ -261,22 +264,19 @@ namespace {
     boost::format cmd(R"(
     has_root_perm AS (%1%),
     has_indiv_perm AS (
-      SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%2%))
-      & '%4%') = '%4%' FROM role_has_permissions AS rp
-          JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-          WHERE ar.account_id = %3%
+      SELECT (COALESCE(bit_or(permission), '0'::bit(%2%))
+      & '%4%') = '%4%' FROM account_effective_permissions
+          WHERE account_id = %3%
     ),
     has_all_perm AS (
-      SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%2%))
-      & '%5%') = '%5%' FROM role_has_permissions AS rp
-          JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-          WHERE ar.account_id = %3%
+      SELECT (COALESCE(bit_or(permission), '0'::bit(%2%))
+      & '%5%') = '%5%' FROM account_effective_permissions
+          WHERE account_id = %3%
     ),
     has_domain_perm AS (
-      SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%2%))
-      & '%6%') = '%6%' FROM role_has_permissions AS rp
-          JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-          WHERE ar.account_id = %3%
+      SELECT (COALESCE(bit_or(permission), '0'::bit(%2%))
+      & '%6%') = '%6%' FROM account_effective_permissions
+          WHERE account_id = %3%
     ),
     has_query_perm AS (
       SELECT (SELECT * from has_root_perm)
@@ -346,12 +346,21 @@ namespace {
 
 namespace iroha {
   namespace ametsuchi {
+    /**
+     * Statements of a command with and without the permission checks. Each
+     * of them is prepared on the server on its first execution and is reused
+     * by the following ones, so the session of an executor which does not
+     * validate the commands never parses the permission checks, and a
+     * command is parsed and planned once per session instead of being
+     * prepared together with all others whenever an executor is created
+     */
     class PostgresCommandExecutor::CommandStatements {
      public:
       CommandStatements(soci::session &session,
                         const std::string &base_statement,
                         const std::vector<std::string> &permission_checks)
-          : statement_with_validation([&] {
+          : session_(session),
+            statement_with_validation_str_([&] {
               // Create query with validation
               auto with_validation_str = boost::format(base_statement);
 
@@ -360,9 +369,9 @@ namespace iroha {
                 with_validation_str = with_validation_str % check;
               }
 
-              return (session.prepare << with_validation_str);
+              return with_validation_str.str();
             }()),
-            statement_without_validation([&] {
+            statement_without_validation_str_([&] {
               // Create query without validation
               auto without_validation_str = boost::format(base_statement);
 
@@ -372,124 +381,212 @@ namespace iroha {
                 without_validation_str = without_validation_str % "";
               }
 
-              return (session.prepare << without_validation_str);
+              return without_validation_str.str();
             }()) {}
 
       soci::statement &getStatement(bool with_validation) {
-        return with_validation ? statement_with_validation
-                               : statement_without_validation;
+        return with_validation
+            ? prepare(statement_with_validation_,
+                      statement_with_validation_str_)
+            : prepare(statement_without_validation_,
+                      statement_without_validation_str_);
       }
 
      private:
-      soci::statement statement_with_validation;
-      soci::statement statement_without_validation;
+      soci::statement &prepare(boost::optional<soci::statement> &statement,
+                               const std::string &statement_str) {
+        if (not statement) {
+          statement.emplace(session_.prepare << statement_str);
+        }
+        return *statement;
+      }
+
+      soci::session &session_;
+      std::string statement_with_validation_str_;
+      std::string statement_without_validation_str_;
+      boost::optional<soci::statement> statement_with_validation_;
+      boost::optional<soci::statement> statement_without_validation_;
     };
 
+    /**
+     * Binds the arguments of a command to its statement and executes it. The
+     * arguments are kept by reference and are formatted only for the message
+     * of a failed command, so a successful command allocates nothing for it
+     */
     class PostgresCommandExecutor::StatementExecutor {
      public:
       StatementExecutor(
           std::unique_ptr<CommandStatements> &statements,
           bool enable_validation,
-          std::string command_name,
-          std::shared_ptr<shared_model::interface::PermissionToString>
-              perm_converter)
-          : statement_(statements->getStatement(enable_validation)),
-            command_name_(std::move(command_name)),
-            perm_converter_(std::move(perm_converter)) {
-        arguments_string_builder_.init(command_name_)
-            .append("Validation", std::to_string(enable_validation));
+          const char *command_name,
+          const std::shared_ptr<shared_model::interface::PermissionToString>
+              &perm_converter,
+          const std::shared_ptr<StatementMetrics> &statement_metrics)
+          : enable_validation_(enable_validation),
+            command_name_(command_name),
+            perm_converter_(*perm_converter),
+            statement_metrics_(statement_metrics.get()) {
+        // the statement is prepared on its first use, which may fail
+        try {
+          statement_ = &statements->getStatement(enable_validation);
+        } catch (const std::exception &e) {
+          prepare_error_ = e.what();
+        }
       }
 
       template <typename T,
                 typename = decltype(soci::use(std::declval<T>(),
                                               std::string{}))>
-      void use(const std::string &argument_name, const T &value) {
-        statement_.exchange(soci::use(value, argument_name));
-        addArgumentToString(argument_name, value);
+      void use(const char *argument_name, const T &value) {
+        exchange(soci::use(value, argument_name));
+        addArgument(argument_name, value);
       }
 
-      void use(const std::string &argument_name, const Role &permission) {
+      void use(const char *argument_name, const Role &permission) {
         temp_values_.emplace_front(
             shared_model::interface::RolePermissionSet({permission})
                 .toBitstring());
-        statement_.exchange(soci::use(temp_values_.front(), argument_name));
-        addArgumentToString(argument_name,
-                            perm_converter_->toString(permission));
+        exchange(soci::use(temp_values_.front(), argument_name));
+        arguments_.push_back({argument_name, permission});
       }
 
-      void use(const std::string &argument_name, const Grantable &permission) {
+      void use(const char *argument_name, const Grantable &permission) {
         temp_values_.emplace_front(
             shared_model::interface::GrantablePermissionSet({permission})
                 .toBitstring());
-        statement_.exchange(soci::use(temp_values_.front(), argument_name));
-        addArgumentToString(argument_name,
-                            perm_converter_->toString(permission));
+        exchange(soci::use(temp_values_.front(), argument_name));
+        arguments_.push_back({argument_name, permission});
       }
 
       void use(
-          const std::string &argument_name,
+          const char *argument_name,
           const shared_model::interface::RolePermissionSet &permission_set) {
         temp_values_.emplace_front(permission_set.toBitstring());
-        statement_.exchange(soci::use(temp_values_.front(), argument_name));
-        addArgumentToString(
-            argument_name,
-            boost::algorithm::join(perm_converter_->toString(permission_set),
-                                   ", "));
-      }
-
-      void use(const std::string &argument_name, bool value) {
-        statement_.exchange(
-            soci::use(value ? kPgTrue : kPgFalse, argument_name));
-        addArgumentToString(argument_name, std::to_string(value));
+        exchange(soci::use(temp_values_.front(), argument_name));
+        arguments_.push_back({argument_name, &permission_set});
       }
 
-      // TODO IR-597 mboldyrev 2019.08.10: build args string on demand
-      void addArgumentToString(const std::string &argument_name,
-                               const std::string &value) {
-        arguments_string_builder_.append(argument_name, value);
+      void use(const char *argument_name, bool value) {
+        exchange(soci::use(value ? kPgTrue : kPgFalse, argument_name));
+        arguments_.push_back({argument_name, std::to_string(value)});
       }
 
-      void addArgumentToString(const std::string &argument_name,
-                               const boost::optional<std::string> &value) {
-        if (value) {
-          addArgumentToString(argument_name, *value);
+      iroha::ametsuchi::CommandResult execute() noexcept {
+        if (not statement_metrics_) {
+          return executeStatement();
         }
+        const auto start = StatementMetrics::Clock::now();
+        auto result = executeStatement();
+        statement_metrics_->record(
+            "command", command_name_, StatementMetrics::Clock::now() - start);
+        return result;
       }
 
-      template <typename T>
-      std::enable_if_t<std::is_arithmetic<T>::value> addArgumentToString(
-          const std::string &argument_name, const T &value) {
-        addArgumentToString(argument_name, std::to_string(value));
-      }
-
-      iroha::ametsuchi::CommandResult execute() noexcept {
+     private:
+      iroha::ametsuchi::CommandResult executeStatement() noexcept {
+        if (prepare_error_) {
+          return getCommandError(
+              command_name_, *prepare_error_, formatArguments());
+        }
         try {
           soci::row r;
-          statement_.define_and_bind();
-          statement_.exchange_for_rowset(soci::into(r));
-          statement_.execute();
-          auto result = statement_.fetch() ? r.get<int>(0) : 1;
-          statement_.bind_clean_up();
+          statement_->define_and_bind();
+          statement_->exchange_for_rowset(soci::into(r));
+          statement_->execute();
+          auto result = statement_->fetch() ? r.get<int>(0) : 1;
+          statement_->bind_clean_up();
           temp_values_.clear();
           if (result != 0) {
-            return makeCommandError(
-                command_name_, result, arguments_string_builder_.finalize());
+            return makeCommandError(command_name_, result, formatArguments());
           }
           return {};
         } catch (const std::exception &e) {
-          statement_.bind_clean_up();
+          statement_->bind_clean_up();
           temp_values_.clear();
-          return getCommandError(
-              command_name_, e.what(), arguments_string_builder_.finalize());
+          return getCommandError(command_name_, e.what(), formatArguments());
         }
       }
 
-     private:
-      soci::statement &statement_;
-      std::string command_name_;
-      std::shared_ptr<shared_model::interface::PermissionToString>
-          perm_converter_;
-      shared_model::detail::PrettyStringBuilder arguments_string_builder_;
+      /// maximal number of the arguments of a command, so that they are
+      /// stored without allocations
+      static constexpr size_t kInlineArguments = 10;
+
+      /// argument value, referenced if it is a string or a permission set
+      using ArgumentValue =
+          boost::variant<const std::string *,
+                         const boost::optional<std::string> *,
+                         std::string,
+                         Role,
+                         Grantable,
+                         const shared_model::interface::RolePermissionSet *>;
+
+      struct Argument {
+        const char *name;
+        ArgumentValue value;
+      };
+
+      void addArgument(const char *argument_name, const std::string &value) {
+        arguments_.push_back({argument_name, &value});
+      }
+
+      void addArgument(const char *argument_name,
+                       const boost::optional<std::string> &value) {
+        arguments_.push_back({argument_name, &value});
+      }
+
+      template <typename T>
+      std::enable_if_t<std::is_arithmetic<T>::value> addArgument(
+          const char *argument_name, const T &value) {
+        arguments_.push_back({argument_name, std::to_string(value)});
+      }
+
+      /// @return string representation of the arguments for the error
+      std::string formatArguments() const {
+        shared_model::detail::PrettyStringBuilder builder;
+        builder.init(command_name_)
+            .append("Validation", std::to_string(enable_validation_));
+        for (const auto &argument : arguments_) {
+          iroha::visit_in_place(
+              argument.value,
+              [&](const std::string *value) {
+                builder.append(argument.name, *value);
+              },
+              [&](const boost::optional<std::string> *value) {
+                if (*value) {
+                  builder.append(argument.name, **value);
+                }
+              },
+              [&](const std::string &value) {
+                builder.append(argument.name, value);
+              },
+              [&](const auto &permission) {
+                builder.append(argument.name,
+                               perm_converter_.toString(permission));
+              },
+              [&](const shared_model::interface::RolePermissionSet *set) {
+                builder.append(
+                    argument.name,
+                    boost::algorithm::join(perm_converter_.toString(*set),
+                                           ", "));
+              });
+        }
+        return builder.finalize();
+      }
+
+      template <typename UseType>
+      void exchange(UseType &&use) {
+        if (statement_) {
+          statement_->exchange(std::forward<UseType>(use));
+        }
+      }
+
+      soci::statement *statement_ = nullptr;
+      boost::optional<std::string> prepare_error_;
+      bool enable_validation_;
+      const char *command_name_;
+      shared_model::interface::PermissionToString &perm_converter_;
+      StatementMetrics *statement_metrics_;
+      boost::container::small_vector<Argument, kInlineArguments> arguments_;
       std::forward_list<std::string> temp_values_;
     };
 
@@ -648,12 +745,11 @@ namespace iroha {
                 SELECT role_id FROM account_has_roles WHERE account_id = :creator
             ),
             account_has_role_permissions AS (
-                SELECT COALESCE(bit_or(rp.permission), '0'::bit(%3%)) &
+                SELECT COALESCE(bit_or(permission), '0'::bit(%3%)) &
                     (SELECT * FROM role_permissions) =
                     (SELECT * FROM role_permissions)
-                FROM role_has_permissions AS rp
-                JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-                WHERE ar.account_id = :creator
+                FROM account_effective_permissions
+                WHERE account_id = :creator
             ),)")
             % checkAccountRolePermission(Role::kAppendRole, ":creator")
             % checkAccountRolePermission(Role::kRoot, ":creator")
@@ -705,6 +801,15 @@ namespace iroha {
                   AND account_id = :target
                   %s
                 RETURNING (1)
+            ),
+            inserted_detail AS
+            (
+                INSERT INTO account_detail(account_id, writer, key, value)
+                SELECT :target, :creator, :key, :new_value::jsonb
+                WHERE EXISTS (SELECT * FROM inserted)
+                ON CONFLICT (account_id, writer, key)
+                  DO UPDATE SET value = excluded.value
+                RETURNING (1)
             )
           SELECT CASE
               WHEN EXISTS (SELECT * FROM inserted) THEN 0
@@ -804,10 +909,9 @@ namespace iroha {
                  FROM role_has_permissions AS rhp
                  WHERE rhp.role_id = (SELECT * FROM get_domain_default_role)),
            account_permissions AS (
-                 SELECT COALESCE(bit_or(rhp.permission), '0'::bit(%1%)) AS perm
-                 FROM role_has_permissions AS rhp
-                 JOIN account_has_roles AS ar ON ar.role_id = rhp.role_id
-                 WHERE ar.account_id = :creator
+                 SELECT COALESCE(bit_or(permission), '0'::bit(%1%)) AS perm
+                 FROM account_effective_permissions
+                 WHERE account_id = :creator
            ),
            creator_has_enough_permissions AS (
                 SELECT ap.perm & dpb.bits = dpb.bits
@@ -893,11 +997,10 @@ namespace iroha {
           END AS result)",
           {(boost::format(R"(
           account_has_role_permissions AS (
-                SELECT COALESCE(bit_or(rp.permission), '0'::bit(%s)) &
+                SELECT COALESCE(bit_or(permission), '0'::bit(%s)) &
                     :perms = :perms
-                FROM role_has_permissions AS rp
-                JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-                WHERE ar.account_id = :creator),
+                FROM account_effective_permissions
+                WHERE account_id = :creator),
           has_perm AS (%s),
           has_root_perm AS (%s),)")
             % kRolePermissionSetSize
@@ -1115,6 +1218,15 @@ namespace iroha {
                 jsonb_set(data, array[:creator], '{}') END,
                 array[:creator, :key], :value::jsonb) WHERE account_id=:target %s
                 RETURNING (1)
+            ),
+            inserted_detail AS
+            (
+                INSERT INTO account_detail(account_id, writer, key, value)
+                SELECT :target, :creator, :key, :value::jsonb
+                WHERE EXISTS (SELECT * FROM inserted)
+                ON CONFLICT (account_id, writer, key)
+                  DO UPDATE SET value = excluded.value
+                RETURNING (1)
             )
           SELECT CASE
             WHEN EXISTS (SELECT * FROM inserted) THEN 0
@@ -1310,7 +1422,9 @@ namespace iroha {
           SELECT CASE
               WHEN EXISTS (SELECT * FROM insert_dest LIMIT 1) THEN 0
               %s
-              ELSE (SELECT code FROM checks WHERE not result LIMIT 1)
+              -- the first failed check in the order of the batch transfer
+              ELSE (SELECT code FROM checks WHERE not result
+                    ORDER BY code LIMIT 1)
           END AS result)",
           {(boost::format(R"(
               has_role_perm AS (%s),
@@ -1342,6 +1456,109 @@ namespace iroha {
            R"( AND (SELECT * FROM has_perm))",
            R"( WHEN NOT (SELECT * FROM has_perm) THEN 2 )"});
 
+      // same checks as of a single transfer, which are made for each row in
+      // the same order, so the first failed one gives the same error code
+      transfer_asset_batch_statements_ = makeCommandStatements(
+          sql_,
+          R"(
+          WITH transfers AS
+            (
+                SELECT * FROM unnest(
+                    CAST(:creators AS text[]),
+                    CAST(:source_account_ids AS text[]),
+                    CAST(:dest_account_ids AS text[]),
+                    CAST(:asset_ids AS text[]),
+                    CAST(:quantities AS decimal[]),
+                    CAST(:precisions AS int[]))
+                WITH ORDINALITY AS t(creator, source_account_id,
+                    dest_account_id, asset_id, quantity, amount_precision, idx)
+            ),
+            results AS
+            (
+                SELECT
+                    t.idx,
+                    t.source_account_id,
+                    t.dest_account_id,
+                    t.asset_id,
+                    new_src_quantity.value AS src_value,
+                    new_dest_quantity.value AS dest_value,
+                    CASE %s
+                        -- source account exists
+                        WHEN NOT EXISTS (SELECT 1 FROM account
+                            WHERE account_id = t.source_account_id) THEN 3
+
+                        -- dest account exists
+                        WHEN NOT EXISTS (SELECT 1 FROM account
+                            WHERE account_id = t.dest_account_id) THEN 4
+
+                        -- asset exists
+                        WHEN NOT EXISTS (SELECT 1 FROM asset
+                            WHERE asset_id = t.asset_id
+                                AND precision >= t.amount_precision) THEN 5
+
+                        -- enough source quantity
+                        WHEN new_src_quantity.value < 0 THEN 6
+
+                        -- dest quantity overflow
+                        WHEN EXISTS (SELECT 1 FROM asset
+                            WHERE asset_id = t.asset_id
+                                AND new_dest_quantity.value
+                                    >= (2::decimal ^ 256)
+                                        / (10::decimal ^ precision)) THEN 7
+                        ELSE 0
+                    END AS code
+                FROM transfers AS t,
+                LATERAL
+                (
+                    SELECT coalesce(sum(amount), 0) - t.quantity AS value
+                    FROM account_has_asset
+                    WHERE asset_id = t.asset_id
+                        AND account_id = t.source_account_id
+                ) AS new_src_quantity,
+                LATERAL
+                (
+                    SELECT coalesce(sum(amount), 0) + t.quantity AS value
+                    FROM account_has_asset
+                    WHERE asset_id = t.asset_id
+                        AND account_id = t.dest_account_id
+                ) AS new_dest_quantity
+            ),
+            update_src AS
+            (
+                UPDATE account_has_asset
+                SET amount = results.src_value
+                FROM results
+                WHERE results.code = 0
+                    AND account_has_asset.account_id = results.source_account_id
+                    AND account_has_asset.asset_id = results.asset_id
+            ),
+            insert_dest AS
+            (
+                INSERT INTO account_has_asset(account_id, asset_id, amount)
+                (
+                    SELECT dest_account_id, asset_id, dest_value
+                    FROM results
+                    WHERE code = 0
+                )
+                ON CONFLICT (account_id, asset_id)
+                DO UPDATE SET amount = EXCLUDED.amount
+            )
+          SELECT code FROM results ORDER BY idx)",
+          {(boost::format(R"(
+                        WHEN NOT (
+                            CASE WHEN (%s) THEN
+                                CASE WHEN NOT (t.creator = t.source_account_id)
+                                    THEN (%s)
+                                ELSE (%s) END
+                            ELSE false END) THEN 2
+              )")
+            % checkAccountRolePermission(Role::kReceive, "t.dest_account_id")
+            % checkAccountGrantablePermission(Grantable::kTransferMyAssets,
+                                              "t.creator",
+                                              "t.source_account_id")
+            % checkAccountRolePermission(Role::kTransfer, "t.creator"))
+               .str()});
+
       set_setting_value_statements_ = makeCommandStatements(
           sql_,
           R"(INSERT INTO setting(setting_key, setting_value)
@@ -1365,8 +1582,11 @@ namespace iroha {
     PostgresCommandExecutor::PostgresCommandExecutor(
         std::unique_ptr<soci::session> sql,
         std::shared_ptr<shared_model::interface::PermissionToString>
-            perm_converter)
-        : sql_(std::move(sql)), perm_converter_{std::move(perm_converter)} {
+            perm_converter,
+        std::shared_ptr<StatementMetrics> statement_metrics)
+        : sql_(std::move(sql)),
+          perm_converter_{std::move(perm_converter)},
+          statement_metrics_(std::move(statement_metrics)) {
       initStatements();
     }
 
@@ -1398,7 +1618,8 @@ namespace iroha {
       StatementExecutor executor(add_asset_quantity_statements_,
                                  do_validation,
                                  "AddAssetQuantity",
-                                 perm_converter_);
+                                 perm_converter_,
+                                 statement_metrics_);
       executor.use("creator", creator_account_id);
       executor.use("asset_id", asset_id);
       executor.use("precision", precision);
@@ -1413,8 +1634,11 @@ namespace iroha {
         bool do_validation) {
       auto &peer = command.peer();
 
-      StatementExecutor executor(
-          add_peer_statements_, do_validation, "AddPeer", perm_converter_);
+      StatementExecutor executor(add_peer_statements_,
+                                 do_validation,
+                                 "AddPeer",
+                                 perm_converter_,
+                                 statement_metrics_);
       executor.use("creator", creator_account_id);
       executor.use("address", peer.address());
       executor.use("pubkey", peer.pubkey().hex());
@@ -1433,7 +1657,8 @@ namespace iroha {
       StatementExecutor executor(add_signatory_statements_,
                                  do_validation,
                                  "AddSignatory",
-                                 perm_converter_);
+                                 perm_converter_,
+                                 statement_metrics_);
       executor.use("creator", creator_account_id);
       executor.use("target", target);
       executor.use("pubkey", pubkey);
@@ -1451,7 +1676,8 @@ namespace iroha {
       StatementExecutor executor(append_role_statements_,
                                  do_validation,
                                  "AppendRole",
-                                 perm_converter_);
+                                 perm_converter_,
+                                 statement_metrics_);
       executor.use("creator", creator_account_id);
       executor.use("target", target);
       executor.use("role", role);
@@ -1466,11 +1692,14 @@ namespace iroha {
       std::string new_json_value = makeJsonString(command.value());
       const std::string expected_json_value =
           makeJsonString(command.oldValue().value_or(""));
+      const auto creator_domain = getDomainFromName(creator_account_id);
+      const auto target_domain = getDomainFromName(command.accountId());
 
       StatementExecutor executor(compare_and_set_account_detail_statements_,
                                  do_validation,
                                  "CompareAndSetAccountDetail",
-                                 perm_converter_);
+                                 perm_converter_,
+                                 statement_metrics_);
       executor.use("creator", creator_account_id);
       executor.use("target", command.accountId());
       executor.use("key", command.key());
@@ -1478,8 +1707,8 @@ namespace iroha {
       executor.use("have_expected_value",
                    static_cast<bool>(command.oldValue()));
       executor.use("expected_value", expected_json_value);
-      executor.use("creator_domain", getDomainFromName(creator_account_id));
-      executor.use("target_domain", getDomainFromName(command.accountId()));
+      executor.use("creator_domain", creator_domain);
+      executor.use("target_domain", target_domain);
 
       return executor.execute();
     }
@@ -1497,7 +1726,8 @@ namespace iroha {
       StatementExecutor executor(create_account_statements_,
                                  do_validation,
                                  "CreateAccount",
-                                 perm_converter_);
+                                 perm_converter_,
+                                 statement_metrics_);
       executor.use("creator", creator_account_id);
       executor.use("account_id", account_id);
       executor.use("domain", domain_id);
@@ -1517,7 +1747,8 @@ namespace iroha {
       StatementExecutor executor(create_asset_statements_,
                                  do_validation,
                                  "CreateAsset",
-                                 perm_converter_);
+                                 perm_converter_,
+                                 statement_metrics_);
       executor.use("creator", creator_account_id);
       executor.use("asset_id", asset_id);
       executor.use("domain", domain_id);
@@ -1536,7 +1767,8 @@ namespace iroha {
       StatementExecutor executor(create_domain_statements_,
                                  do_validation,
                                  "CreateDomain",
-                                 perm_converter_);
+                                 perm_converter_,
+                                 statement_metrics_);
       executor.use("creator", creator_account_id);
       executor.use("domain", domain_id);
       executor.use("default_role", default_role);
@@ -1555,7 +1787,8 @@ namespace iroha {
       StatementExecutor executor(create_role_statements_,
                                  do_validation,
                                  "CreateRole",
-                                 perm_converter_);
+                                 perm_converter_,
+                                 statement_metrics_);
       executor.use("creator", creator_account_id);
       executor.use("role", role_id);
       executor.use("perms", perm_str);
@@ -1573,7 +1806,8 @@ namespace iroha {
       StatementExecutor executor(detach_role_statements_,
                                  do_validation,
                                  "DetachRole",
-                                 perm_converter_);
+                                 perm_converter_,
+                                 statement_metrics_);
       executor.use("creator", creator_account_id);
       executor.use("target", account_id);
       executor.use("role", role_name);
@@ -1593,7 +1827,8 @@ namespace iroha {
       StatementExecutor executor(grant_permission_statements_,
                                  do_validation,
                                  "GrantPermission",
-                                 perm_converter_);
+                                 perm_converter_,
+                                 statement_metrics_);
       executor.use("creator", creator_account_id);
       executor.use("target", permittee_account_id);
       executor.use("granted_perm", granted_perm);
@@ -1611,7 +1846,8 @@ namespace iroha {
       StatementExecutor executor(remove_peer_statements_,
                                  do_validation,
                                  "RemovePeer",
-                                 perm_converter_);
+                                 perm_converter_,
+                                 statement_metrics_);
       executor.use("creator", creator_account_id);
       executor.use("pubkey", pubkey);
 
@@ -1628,7 +1864,8 @@ namespace iroha {
       StatementExecutor executor(remove_signatory_statements_,
                                  do_validation,
                                  "RemoveSignatory",
-                                 perm_converter_);
+                                 perm_converter_,
+                                 statement_metrics_);
       executor.use("creator", creator_account_id);
       executor.use("target", account_id);
       executor.use("pubkey", pubkey);
@@ -1646,7 +1883,8 @@ namespace iroha {
       StatementExecutor executor(revoke_permission_statements_,
                                  do_validation,
                                  "RevokePermission",
-                                 perm_converter_);
+                                 perm_converter_,
+                                 statement_metrics_);
       executor.use("creator", creator_account_id);
       executor.use("target", permittee_account_id);
       executor.use("revoked_perm", revoked_perm);
@@ -1666,7 +1904,8 @@ namespace iroha {
       StatementExecutor executor(set_account_detail_statements_,
                                  do_validation,
                                  "SetAccountDetail",
-                                 perm_converter_);
+                                 perm_converter_,
+                                 statement_metrics_);
       if (not creator_account_id.empty()) {
         executor.use("creator", creator_account_id);
       } else {
@@ -1688,8 +1927,11 @@ namespace iroha {
       auto &account_id = command.accountId();
       int quorum = command.newQuorum();
 
-      StatementExecutor executor(
-          set_quorum_statements_, do_validation, "SetQuorum", perm_converter_);
+      StatementExecutor executor(set_quorum_statements_,
+                                 do_validation,
+                                 "SetQuorum",
+                                 perm_converter_,
+                                 statement_metrics_);
       executor.use("creator", creator_account_id);
       executor.use("target", account_id);
       executor.use("quorum", quorum);
@@ -1708,7 +1950,8 @@ namespace iroha {
       StatementExecutor executor(subtract_asset_quantity_statements_,
                                  do_validation,
                                  "SubtractAssetQuantity",
-                                 perm_converter_);
+                                 perm_converter_,
+                                 statement_metrics_);
       executor.use("creator", creator_account_id);
       executor.use("asset_id", asset_id);
       executor.use("quantity", quantity);
@@ -1730,7 +1973,8 @@ namespace iroha {
       StatementExecutor executor(transfer_asset_statements_,
                                  do_validation,
                                  "TransferAsset",
-                                 perm_converter_);
+                                 perm_converter_,
+                                 statement_metrics_);
       executor.use("creator", creator_account_id);
       executor.use("source_account_id", src_account_id);
       executor.use("dest_account_id", dest_account_id);
@@ -1741,6 +1985,89 @@ namespace iroha {
       return executor.execute();
     }
 
+    expected::Result<std::vector<CommandResult>, std::string>
+    PostgresCommandExecutor::executeTransfers(
+        const std::vector<CreatedTransferAsset> &transfers,
+        bool do_validation) {
+      std::vector<std::string> creators, source_account_ids, dest_account_ids,
+          asset_ids, quantities, precisions;
+      for (const auto &transfer : transfers) {
+        creators.push_back(transfer.creator_account_id);
+        source_account_ids.push_back(transfer.command.srcAccountId());
+        dest_account_ids.push_back(transfer.command.destAccountId());
+        asset_ids.push_back(transfer.command.assetId());
+        quantities.push_back(transfer.command.amount().toStringRepr());
+        precisions.push_back(
+            std::to_string(transfer.command.amount().precision()));
+      }
+      auto creators_array = makePgArray(creators);
+      auto source_account_ids_array = makePgArray(source_account_ids);
+      auto dest_account_ids_array = makePgArray(dest_account_ids);
+      auto asset_ids_array = makePgArray(asset_ids);
+      auto quantities_array = makePgArray(quantities);
+      auto precisions_array = makePgArray(precisions);
+
+      std::vector<int> codes;
+      codes.reserve(transfers.size());
+      soci::statement *statement = nullptr;
+      try {
+        statement =
+            &transfer_asset_batch_statements_->getStatement(do_validation);
+        statement->exchange(soci::use(creators_array, "creators"));
+        statement->exchange(
+            soci::use(source_account_ids_array, "source_account_ids"));
+        statement->exchange(
+            soci::use(dest_account_ids_array, "dest_account_ids"));
+        statement->exchange(soci::use(asset_ids_array, "asset_ids"));
+        statement->exchange(soci::use(quantities_array, "quantities"));
+        statement->exchange(soci::use(precisions_array, "precisions"));
+
+        soci::row r;
+        statement->define_and_bind();
+        statement->exchange_for_rowset(soci::into(r));
+        statement->execute();
+        while (statement->fetch()) {
+          codes.push_back(r.get<int>(0));
+        }
+        statement->bind_clean_up();
+      } catch (const std::exception &e) {
+        if (statement) {
+          statement->bind_clean_up();
+        }
+        return expected::makeError(
+            std::string{"Failed to execute TransferAsset commands: "}
+            + e.what());
+      }
+      if (codes.size() != transfers.size()) {
+        return expected::makeError(
+            (boost::format("Got %d results of %d TransferAsset commands")
+             % codes.size() % transfers.size())
+                .str());
+      }
+
+      std::vector<CommandResult> results;
+      results.reserve(transfers.size());
+      for (size_t i = 0; i < transfers.size(); ++i) {
+        if (codes[i] == 0) {
+          results.emplace_back();
+          continue;
+        }
+        // the same arguments as are reported for a single transfer
+        shared_model::detail::PrettyStringBuilder arguments;
+        arguments.init("TransferAsset")
+            .append("Validation", std::to_string(do_validation))
+            .append("creator", creators[i])
+            .append("source_account_id", source_account_ids[i])
+            .append("dest_account_id", dest_account_ids[i])
+            .append("asset_id", asset_ids[i])
+            .append("quantity", quantities[i])
+            .append("precision", precisions[i]);
+        results.emplace_back(
+            makeCommandError("TransferAsset", codes[i], arguments.finalize()));
+      }
+      return std::move(results);
+    }
+
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::SetSettingValue &command,
         const shared_model::interface::types::AccountIdType &creator_account_id,
@@ -1751,7 +2078,8 @@ namespace iroha {
       StatementExecutor executor(set_setting_value_statements_,
                                  do_validation,
                                  "SetSettingValue",
-                                 perm_converter_);
+                                 perm_converter_,
+                                 statement_metrics_);
 
       executor.use("setting_key", key);
       executor.use("setting_value", value);
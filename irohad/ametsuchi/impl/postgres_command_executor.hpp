@@ -8,6 +8,8 @@
 
 #include "ametsuchi/command_executor.hpp"
 
+#include <vector>
+
 #include "ametsuchi/impl/soci_utils.hpp"
 
 namespace soci {
@@ -42,12 +44,15 @@ namespace shared_model {
 namespace iroha {
   namespace ametsuchi {
 
+    class StatementMetrics;
+
     class PostgresCommandExecutor final : public CommandExecutor {
      public:
       PostgresCommandExecutor(
           std::unique_ptr<soci::session> sql,
           std::shared_ptr<shared_model::interface::PermissionToString>
-              perm_converter);
+              perm_converter,
+          std::shared_ptr<StatementMetrics> statement_metrics = nullptr);
 
       ~PostgresCommandExecutor();
 
@@ -58,6 +63,28 @@ namespace iroha {
 
       soci::session &getSession();
 
+      /// TransferAsset command together with the account of its creator
+      struct CreatedTransferAsset {
+        const shared_model::interface::TransferAsset &command;
+        const shared_model::interface::types::AccountIdType
+            &creator_account_id;
+      };
+
+      /**
+       * Execute TransferAsset commands in one statement. The commands must be
+       * independent, so none of them changes a balance which another one
+       * reads or changes, then the result of each command is the same as if
+       * they were executed one after another
+       * @param transfers - commands with the accounts of their creators
+       * @param do_validation - whether the permissions are checked
+       * @return result of each command in their order, or error string if
+       * the statement has failed, so the commands are not applied and the
+       * database transaction is to be rolled back
+       */
+      expected::Result<std::vector<CommandResult>, std::string>
+      executeTransfers(const std::vector<CreatedTransferAsset> &transfers,
+                       bool do_validation);
+
       CommandResult operator()(
           const shared_model::interface::AddAssetQuantity &command,
           const shared_model::interface::types::AccountIdType
@@ -188,6 +215,9 @@ namespace iroha {
       std::shared_ptr<shared_model::interface::PermissionToString>
           perm_converter_;
 
+      /// execution time of the commands, may be null
+      std::shared_ptr<StatementMetrics> statement_metrics_;
+
       std::unique_ptr<CommandStatements> add_asset_quantity_statements_;
       std::unique_ptr<CommandStatements> add_peer_statements_;
       std::unique_ptr<CommandStatements> add_signatory_statements_;
@@ -207,6 +237,7 @@ namespace iroha {
       std::unique_ptr<CommandStatements> set_quorum_statements_;
       std::unique_ptr<CommandStatements> subtract_asset_quantity_statements_;
       std::unique_ptr<CommandStatements> transfer_asset_statements_;
+      std::unique_ptr<CommandStatements> transfer_asset_batch_statements_;
       std::unique_ptr<CommandStatements> set_setting_value_statements_;
     };
   }  // namespace ametsuchi
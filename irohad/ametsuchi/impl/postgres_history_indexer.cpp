@@ -0,0 +1,151 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/postgres_history_indexer.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include <soci/soci.h>
+#include "ametsuchi/block_storage.hpp"
+#include "ametsuchi/impl/postgres_block_index.hpp"
+#include "ametsuchi/impl/postgres_indexer.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha::ametsuchi;
+using shared_model::interface::types::HeightType;
+
+namespace {
+  /// Number of the blocks indexed while the storage is locked
+  const size_t kBlocksPerPass = 100;
+  /// Period of the passes without notifications, which retry the failed ones
+  const std::chrono::seconds kRetryPeriod{5};
+}  // namespace
+
+PostgresHistoryIndexer::PostgresHistoryIndexer(
+    std::shared_ptr<soci::connection_pool> &connection,
+    std::shared_timed_mutex &drop_mutex,
+    const BlockStorage &block_store,
+    logger::LoggerPtr log)
+    : connection_(connection),
+      drop_mutex_(drop_mutex),
+      block_store_(block_store),
+      log_(std::move(log)),
+      pending_(true),
+      stopped_(false),
+      thread_(&PostgresHistoryIndexer::run, this) {}
+
+PostgresHistoryIndexer::~PostgresHistoryIndexer() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+  }
+  cv_.notify_one();
+  thread_.join();
+}
+
+void PostgresHistoryIndexer::notify() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_ = true;
+  }
+  cv_.notify_one();
+}
+
+iroha::expected::Result<HeightType, std::string>
+PostgresHistoryIndexer::indexedHeight(soci::session &sql) {
+  try {
+    long long height = 0;
+    sql << "SELECT COALESCE((SELECT height FROM history_index_height), 0)",
+        soci::into(height);
+    return expected::makeValue(static_cast<HeightType>(height));
+  } catch (const std::exception &e) {
+    return expected::makeError(
+        std::string{"Failed to read the height of the indexed history: "}
+        + e.what());
+  }
+}
+
+iroha::expected::Result<HeightType, std::string>
+PostgresHistoryIndexer::indexBlocks(soci::session &sql,
+                                    const BlockStorage &block_store,
+                                    size_t max_blocks,
+                                    const logger::LoggerPtr &log) {
+  auto indexed = indexedHeight(sql);
+  if (auto error = expected::resultToOptionalError(indexed)) {
+    return expected::makeError(std::move(*error));
+  }
+  auto indexed_height = expected::resultToOptionalValue(indexed).value();
+
+  PostgresBlockIndex block_index(
+      std::make_unique<PostgresIndexer>(sql), log, false);
+  const HeightType last_height =
+      std::min<HeightType>(block_store.size(), indexed_height + max_blocks);
+  for (auto height = indexed_height + 1; height <= last_height; ++height) {
+    auto block = block_store.fetch(height);
+    if (not block) {
+      return expected::makeError("Failed to fetch block "
+                                 + std::to_string(height));
+    }
+    try {
+      sql << "BEGIN";
+      if (auto error = expected::resultToOptionalError(
+              block_index.indexHistory(**block))) {
+        sql << "ROLLBACK";
+        return expected::makeError("Failed to index the history of block "
+                                   + std::to_string(height) + ": " + *error);
+      }
+      sql << "COMMIT";
+    } catch (const std::exception &e) {
+      try {
+        sql << "ROLLBACK";
+      } catch (const std::exception &) {
+      }
+      return expected::makeError("Failed to index the history of block "
+                                 + std::to_string(height) + ": " + e.what());
+    }
+    indexed_height = height;
+  }
+  return expected::makeValue(indexed_height);
+}
+
+void PostgresHistoryIndexer::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (not stopped_) {
+    cv_.wait_for(lock, kRetryPeriod, [this] { return pending_ or stopped_; });
+    if (stopped_) {
+      break;
+    }
+    pending_ = false;
+    lock.unlock();
+    while (not stopped_ and not indexNextBlocks()) {
+    }
+    lock.lock();
+  }
+}
+
+bool PostgresHistoryIndexer::indexNextBlocks() {
+  std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
+  if (not connection_) {
+    return true;
+  }
+  try {
+    soci::session sql(*connection_);
+    return indexBlocks(sql, block_store_, kBlocksPerPass, log_)
+        .match(
+            [this](const auto &height) {
+              log_->debug("Indexed history up to block {}", height.value);
+              return height.value >= block_store_.size();
+            },
+            [this](const auto &error) {
+              log_->warn("{}", error.error);
+              return true;
+            });
+  } catch (const std::exception &e) {
+    log_->warn("Failed to index the history: {}", e.what());
+    return true;
+  }
+}
@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_POSTGRES_HISTORY_INDEXER_HPP
+#define IROHA_POSTGRES_HISTORY_INDEXER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+#include "common/result.hpp"
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace soci {
+  class connection_pool;
+  class session;
+}  // namespace soci
+
+namespace iroha {
+  namespace ametsuchi {
+
+    class BlockStorage;
+
+    /**
+     * Builds the history of the accounts, namely the tx positions by creator
+     * and by account asset, of the committed blocks in the background, so
+     * the commit of a block includes only the WSV and the tx statuses. The
+     * history of each block is committed together with the height of the
+     * last block with the indexed history, so the queries of the history
+     * always see all transactions up to that height.
+     */
+    class PostgresHistoryIndexer {
+     public:
+      /**
+       * @param connection - connection pool of the storage, which may be
+       * reset when the storage is dropped
+       * @param drop_mutex - mutex of the storage which guards the connection
+       * @param block_store - storage of the committed blocks
+       */
+      PostgresHistoryIndexer(
+          std::shared_ptr<soci::connection_pool> &connection,
+          std::shared_timed_mutex &drop_mutex,
+          const BlockStorage &block_store,
+          logger::LoggerPtr log);
+
+      /// Waits for the block being indexed
+      ~PostgresHistoryIndexer();
+
+      /// Wake up the indexer after new blocks are committed
+      void notify();
+
+      /**
+       * @return height of the last block with the indexed history
+       */
+      static expected::Result<shared_model::interface::types::HeightType,
+                              std::string>
+      indexedHeight(soci::session &sql);
+
+      /**
+       * Index the history of the stored blocks following the last indexed
+       * one, each block in a separate transaction
+       * @param max_blocks - maximal number of the blocks to index
+       * @return height of the last block with the indexed history
+       */
+      static expected::Result<shared_model::interface::types::HeightType,
+                              std::string>
+      indexBlocks(soci::session &sql,
+                  const BlockStorage &block_store,
+                  size_t max_blocks,
+                  const logger::LoggerPtr &log);
+
+     private:
+      void run();
+
+      /// @return true if all stored blocks are indexed
+      bool indexNextBlocks();
+
+      std::shared_ptr<soci::connection_pool> &connection_;
+      std::shared_timed_mutex &drop_mutex_;
+      const BlockStorage &block_store_;
+      logger::LoggerPtr log_;
+
+      std::mutex mutex_;
+      std::condition_variable cv_;
+      bool pending_;
+      std::atomic_bool stopped_;
+      std::thread thread_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_POSTGRES_HISTORY_INDEXER_HPP
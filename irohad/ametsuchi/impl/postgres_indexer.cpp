@@ -5,34 +5,82 @@
 
 #include "ametsuchi/impl/postgres_indexer.hpp"
 
+#include <algorithm>
+
 #include <soci/soci.h>
-#include <boost/format.hpp>
+#include "ametsuchi/impl/soci_utils.hpp"
+#include "ametsuchi/impl/statement_metrics.hpp"
 #include "cryptography/hash.hpp"
 
 using namespace iroha::ametsuchi;
 using namespace shared_model::interface::types;
 
-PostgresIndexer::PostgresIndexer(soci::session &sql) : sql_(sql) {}
+namespace {
+  /// Inserts the rows of all index tables, which are bound as arrays.
+  const std::string kInsertIndices = R"(
+      WITH position_by_hash_rows AS (
+          INSERT INTO position_by_hash (hash, height, index)
+          SELECT * FROM unnest(
+              CAST(:position_hashes AS bytea[]),
+              CAST(:position_heights AS bigint[]),
+              CAST(:position_indices AS bigint[]))
+      ),
+      tx_status_by_hash_rows AS (
+          INSERT INTO tx_status_by_hash (hash, status)
+          SELECT * FROM unnest(
+              CAST(:status_hashes AS bytea[]),
+              CAST(:statuses AS boolean[]))
+      ),
+      tx_position_by_creator_rows AS (
+          INSERT INTO tx_position_by_creator (creator_key, height, index)
+          SELECT iroha_id_key(creator), height, index FROM unnest(
+              CAST(:creators AS text[]),
+              CAST(:creator_heights AS bigint[]),
+              CAST(:creator_indices AS bigint[])) AS t(creator, height, index)
+      ),
+      position_by_account_asset_rows AS (
+          INSERT INTO position_by_account_asset
+              (account_key, asset_key, height, index)
+          SELECT iroha_id_key(account), iroha_id_key(asset), height, index
+          FROM unnest(
+              CAST(:account_ids AS text[]),
+              CAST(:asset_ids AS text[]),
+              CAST(:account_asset_heights AS bigint[]),
+              CAST(:account_asset_indices AS bigint[]))
+              AS t(account, asset, height, index)
+      ),
+      history_index_height_rows AS (
+          INSERT INTO history_index_height (lock, height)
+          SELECT 'X', * FROM unnest(CAST(:history_heights AS bigint[]))
+          ON CONFLICT (lock) DO UPDATE SET height = EXCLUDED.height
+      )
+      INSERT INTO top_block_info (lock, height, hash)
+      SELECT 'X', * FROM unnest(
+          CAST(:top_block_heights AS bigint[]),
+          CAST(:top_block_hashes AS text[]))
+      ON CONFLICT (lock) DO UPDATE
+      SET height = EXCLUDED.height, hash = EXCLUDED.hash)";
+
+  /// Creates the missing partitions of the history tables for the heights.
+  const std::string kCreatePartitions =
+      "SELECT iroha_history_partitions(:from_height, :to_height)";
+}  // namespace
+
+PostgresIndexer::PostgresIndexer(
+    soci::session &sql, std::shared_ptr<StatementMetrics> statement_metrics)
+    : sql_(sql), statement_metrics_(std::move(statement_metrics)) {}
 
 void PostgresIndexer::txHashPosition(const HashType &hash,
                                      TxPosition position) {
-  boost::format base(
-      "INSERT INTO position_by_hash"
-      "(hash, height, index) VALUES "
-      "('%s', '%s', '%s');\n");
-  statements_.append(
-      (base % hash.hex() % position.height % position.index).str());
+  rows_.position_hashes.push_back(makePgBytea(hash.hex()));
+  rows_.position_heights.push_back(std::to_string(position.height));
+  rows_.position_indices.push_back(std::to_string(position.index));
 }
 
 void PostgresIndexer::txHashStatus(const HashType &rejected_tx_hash,
                                    bool is_committed) {
-  boost::format base(
-      "INSERT INTO tx_status_by_hash"
-      "(hash, status) VALUES "
-      "('%s', '%s');\n");
-  statements_.append(
-      (base % rejected_tx_hash.hex() % (is_committed ? "TRUE" : "FALSE"))
-          .str());
+  rows_.status_hashes.push_back(makePgBytea(rejected_tx_hash.hex()));
+  rows_.statuses.push_back(is_committed ? "TRUE" : "FALSE");
 }
 
 void PostgresIndexer::committedTxHash(const HashType &committed_tx_hash) {
@@ -45,29 +93,112 @@ void PostgresIndexer::rejectedTxHash(const HashType &rejected_tx_hash) {
 
 void PostgresIndexer::txPositionByCreator(const AccountIdType creator,
                                           TxPosition position) {
-  boost::format base(
-      "INSERT INTO tx_position_by_creator"
-      "(creator_id, height, index) VALUES "
-      "('%s', '%s', '%s');\n");
-  statements_.append((base % creator % position.height % position.index).str());
+  historyRow(position.height);
+  rows_.creators.push_back(creator);
+  rows_.creator_heights.push_back(std::to_string(position.height));
+  rows_.creator_indices.push_back(std::to_string(position.index));
 }
 
-void PostgresIndexer::accountAssetTxPosition(const AccountIdType &account_id,
-                                             const AssetIdType &asset_id,
+void PostgresIndexer::accountAssetTxPosition(boost::string_view account_id,
+                                             boost::string_view asset_id,
                                              TxPosition position) {
-  boost::format base(
-      "INSERT INTO position_by_account_asset"
-      "(account_id, asset_id, height, index) VALUES "
-      "('%s', '%s', '%s', '%s');\n");
-  statements_.append(
-      (base % account_id % asset_id % position.height % position.index).str());
+  historyRow(position.height);
+  rows_.account_ids.emplace_back(account_id);
+  rows_.asset_ids.emplace_back(asset_id);
+  rows_.account_asset_heights.push_back(std::to_string(position.height));
+  rows_.account_asset_indices.push_back(std::to_string(position.index));
+}
+
+void PostgresIndexer::topBlock(HeightType height, const HashType &hash) {
+  top_block_ = TopBlock{height, hash.hex()};
+}
+
+void PostgresIndexer::historyHeight(HeightType height) {
+  history_height_ = height;
+}
+
+void PostgresIndexer::historyRow(HeightType height) {
+  if (not history_rows_heights_) {
+    history_rows_heights_ = std::make_pair(height, height);
+    return;
+  }
+  history_rows_heights_->first = std::min(history_rows_heights_->first, height);
+  history_rows_heights_->second =
+      std::max(history_rows_heights_->second, height);
 }
 
 iroha::expected::Result<void, std::string> PostgresIndexer::flush() {
+  if (rows_.position_hashes.empty() and rows_.status_hashes.empty()
+      and rows_.creators.empty() and rows_.account_ids.empty()
+      and not top_block_ and not history_height_) {
+    return {};
+  }
+
+  std::vector<std::string> top_block_heights, top_block_hashes,
+      history_heights;
+  if (top_block_) {
+    top_block_heights.push_back(std::to_string(top_block_->height));
+    top_block_hashes.push_back(top_block_->hash);
+  }
+  if (history_height_) {
+    history_heights.push_back(std::to_string(*history_height_));
+  }
+  auto position_hashes = makePgArray(rows_.position_hashes);
+  auto position_heights = makePgArray(rows_.position_heights);
+  auto position_indices = makePgArray(rows_.position_indices);
+  auto status_hashes = makePgArray(rows_.status_hashes);
+  auto statuses = makePgArray(rows_.statuses);
+  auto creators = makePgArray(rows_.creators);
+  auto creator_heights = makePgArray(rows_.creator_heights);
+  auto creator_indices = makePgArray(rows_.creator_indices);
+  auto account_ids = makePgArray(rows_.account_ids);
+  auto asset_ids = makePgArray(rows_.asset_ids);
+  auto account_asset_heights = makePgArray(rows_.account_asset_heights);
+  auto account_asset_indices = makePgArray(rows_.account_asset_indices);
+  auto top_block_heights_array = makePgArray(top_block_heights);
+  auto top_block_hashes_array = makePgArray(top_block_hashes);
+  auto history_heights_array = makePgArray(history_heights);
+  auto partition_heights = history_rows_heights_;
+  const uint64_t rows = rows_.position_hashes.size()
+      + rows_.status_hashes.size() + rows_.creators.size()
+      + rows_.account_ids.size();
+  clear();
+
+  const auto start = StatementMetrics::Clock::now();
   try {
-    sql_ << statements_;
+    if (partition_heights) {
+      long long from_height = partition_heights->first;
+      long long to_height = partition_heights->second;
+      sql_ << kCreatePartitions, soci::use(from_height, "from_height"),
+          soci::use(to_height, "to_height");
+    }
+    sql_ << kInsertIndices, soci::use(position_hashes, "position_hashes"),
+        soci::use(position_heights, "position_heights"),
+        soci::use(position_indices, "position_indices"),
+        soci::use(status_hashes, "status_hashes"),
+        soci::use(statuses, "statuses"), soci::use(creators, "creators"),
+        soci::use(creator_heights, "creator_heights"),
+        soci::use(creator_indices, "creator_indices"),
+        soci::use(account_ids, "account_ids"),
+        soci::use(asset_ids, "asset_ids"),
+        soci::use(account_asset_heights, "account_asset_heights"),
+        soci::use(account_asset_indices, "account_asset_indices"),
+        soci::use(top_block_heights_array, "top_block_heights"),
+        soci::use(top_block_hashes_array, "top_block_hashes"),
+        soci::use(history_heights_array, "history_heights");
   } catch (const std::exception &e) {
     return e.what();
   }
+  if (statement_metrics_) {
+    statement_metrics_->record(
+        "index", "flush", StatementMetrics::Clock::now() - start, rows);
+  }
   return {};
 }
+
+void PostgresIndexer::clear() {
+  rows_ = Rows{};
+  top_block_ = boost::none;
+  history_height_ = boost::none;
+  history_rows_heights_ = boost::none;
+}
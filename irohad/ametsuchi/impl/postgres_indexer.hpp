@@ -8,6 +8,11 @@
 
 #include "ametsuchi/indexer.hpp"
 
+#include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
+
 namespace soci {
   class session;
 }
@@ -15,9 +20,23 @@ namespace soci {
 namespace iroha {
   namespace ametsuchi {
 
+    class StatementMetrics;
+
+    /**
+     * Indexer which collects the rows of every index table to arrays, and
+     * inserts all of them on flush() with a single statement, so the size of
+     * the statement text does not depend on the number of the transactions
+     */
     class PostgresIndexer : public Indexer {
      public:
-      PostgresIndexer(soci::session &sql);
+      /**
+       * @param sql - session of the indexed transaction
+       * @param statement_metrics - execution time of the flushes, may be
+       * null
+       */
+      PostgresIndexer(
+          soci::session &sql,
+          std::shared_ptr<StatementMetrics> statement_metrics = nullptr);
 
       void txHashPosition(const shared_model::interface::types::HashType &hash,
                           TxPosition position) override;
@@ -32,10 +51,16 @@ namespace iroha {
           const shared_model::interface::types::AccountIdType creator,
           TxPosition position) override;
 
-      void accountAssetTxPosition(
-          const shared_model::interface::types::AccountIdType &account_id,
-          const shared_model::interface::types::AssetIdType &asset_id,
-          TxPosition position) override;
+      void accountAssetTxPosition(boost::string_view account_id,
+                                  boost::string_view asset_id,
+                                  TxPosition position) override;
+
+      void topBlock(
+          shared_model::interface::types::HeightType height,
+          const shared_model::interface::types::HashType &hash) override;
+
+      void historyHeight(
+          shared_model::interface::types::HeightType height) override;
 
       iroha::expected::Result<void, std::string> flush() override;
 
@@ -45,8 +70,40 @@ namespace iroha {
           const shared_model::interface::types::HashType &rejected_tx_hash,
           bool is_committed);
 
+      /// Extend the height range of the collected history rows.
+      void historyRow(shared_model::interface::types::HeightType height);
+
+      /// Clear the collected rows.
+      void clear();
+
       soci::session &sql_;
-      std::string statements_;  ///< A bunch of SQL to be committed on flush().
+      std::shared_ptr<StatementMetrics> statement_metrics_;
+
+      /// Columns of the rows to be inserted on flush(), as PostgreSQL array
+      /// elements.
+      struct Rows {
+        std::vector<std::string> position_hashes, position_heights,
+            position_indices;
+        std::vector<std::string> status_hashes, statuses;
+        std::vector<std::string> creators, creator_heights, creator_indices;
+        std::vector<std::string> account_ids, asset_ids, account_asset_heights,
+            account_asset_indices;
+      } rows_;
+
+      /// The last indexed block, which replaces the top block info.
+      struct TopBlock {
+        shared_model::interface::types::HeightType height;
+        std::string hash;
+      };
+      boost::optional<TopBlock> top_block_;
+      boost::optional<shared_model::interface::types::HeightType>
+          history_height_;
+
+      /// Heights of the collected history rows, which need the partitions
+      /// of the partitioned history tables.
+      boost::optional<std::pair<shared_model::interface::types::HeightType,
+                                shared_model::interface::types::HeightType>>
+          history_rows_heights_;
     };
 
   }  // namespace ametsuchi
@@ -69,14 +69,21 @@ PostgresOptions::PostgresOptions(const std::string &host,
                                  const std::string &password,
                                  const std::string &working_dbname,
                                  const std::string &maintenance_dbname,
-                                 logger::LoggerPtr log)
+                                 logger::LoggerPtr log,
+                                 std::vector<Replica> replicas,
+                                 uint64_t replica_max_lag,
+                                 std::chrono::milliseconds
+                                     slow_statement_threshold)
     : host_(host),
       port_(port),
       user_(user),
       password_(password),
       working_dbname_(working_dbname),
       maintenance_dbname_(maintenance_dbname),
-      prepared_block_name_(kPreparedBlockPrefix + working_dbname_) {
+      prepared_block_name_(kPreparedBlockPrefix + working_dbname_),
+      replicas_(std::move(replicas)),
+      replica_max_lag_(replica_max_lag),
+      slow_statement_threshold_(slow_statement_threshold) {
   if (working_dbname_ == maintenance_dbname_) {
     log->warn(
         "Working database has the same name with maintenance database: '{}'. "
@@ -99,6 +106,25 @@ std::string PostgresOptions::maintenanceConnectionString() const {
   return getConnectionStringWithDbName(maintenance_dbname_);
 }
 
+std::vector<std::string> PostgresOptions::replicaConnectionStrings() const {
+  std::vector<std::string> connection_strings;
+  for (const auto &replica : replicas_) {
+    connection_strings.push_back(
+        (boost::format("host=%1% port=%2% user=%3% password=%4% dbname=%5%")
+         % replica.host % replica.port % user_ % password_ % working_dbname_)
+            .str());
+  }
+  return connection_strings;
+}
+
+uint64_t PostgresOptions::replicaMaxLag() const {
+  return replica_max_lag_;
+}
+
+std::chrono::milliseconds PostgresOptions::slowStatementThreshold() const {
+  return slow_statement_threshold_;
+}
+
 std::string PostgresOptions::getConnectionStringWithDbName(
     const std::string &dbname) const {
   return connectionStringWithoutDbName() + " dbname=" + dbname;
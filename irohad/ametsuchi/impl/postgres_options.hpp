@@ -6,7 +6,9 @@
 #ifndef IROHA_POSTGRES_OPTIONS_HPP
 #define IROHA_POSTGRES_OPTIONS_HPP
 
+#include <chrono>
 #include <unordered_map>
+#include <vector>
 #include "common/result.hpp"
 #include "logger/logger_fwd.hpp"
 
@@ -18,6 +20,12 @@ namespace iroha {
      */
     class PostgresOptions {
      public:
+      /// Address of a streaming replica of the working database
+      struct Replica {
+        std::string host;
+        uint16_t port;
+      };
+
       /**
        * @param pg_opt The connection options string.
        * @param default_dbname The default name of database to use when one is
@@ -40,6 +48,12 @@ namespace iroha {
        * purposes. It will not be altered in any way and is used to manage
        * working database.
        * @param log Logger for internal messages.
+       * @param replicas Streaming replicas of the working database, which are
+       * read with the same credentials.
+       * @param replica_max_lag The number of blocks a replica may be behind
+       * the committed ledger to be read.
+       * @param slow_statement_threshold Execution time from which a statement
+       * is logged, zero disables the log.
        */
       PostgresOptions(const std::string &host,
                       uint16_t port,
@@ -47,7 +61,11 @@ namespace iroha {
                       const std::string &password,
                       const std::string &working_dbname,
                       const std::string &maintenance_dbname,
-                      logger::LoggerPtr log);
+                      logger::LoggerPtr log,
+                      std::vector<Replica> replicas = {},
+                      uint64_t replica_max_lag = 0,
+                      std::chrono::milliseconds slow_statement_threshold =
+                          std::chrono::milliseconds::zero());
 
       /// @return connection string without dbname param
       std::string connectionStringWithoutDbName() const;
@@ -58,6 +76,15 @@ namespace iroha {
       /// @return connection string to maintenance database
       std::string maintenanceConnectionString() const;
 
+      /// @return connection strings to the working database on the replicas
+      std::vector<std::string> replicaConnectionStrings() const;
+
+      /// @return the number of blocks a replica may be behind the ledger
+      uint64_t replicaMaxLag() const;
+
+      /// @return the execution time from which a statement is logged
+      std::chrono::milliseconds slowStatementThreshold() const;
+
       /// @return working database name
       std::string workingDbName() const;
 
@@ -78,6 +105,9 @@ namespace iroha {
       const std::string working_dbname_;
       const std::string maintenance_dbname_;
       const std::string prepared_block_name_;
+      const std::vector<Replica> replicas_;
+      const uint64_t replica_max_lag_;
+      const std::chrono::milliseconds slow_statement_threshold_;
     };
 
   }  // namespace ametsuchi
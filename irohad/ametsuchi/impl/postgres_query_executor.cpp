@@ -62,20 +62,85 @@ namespace iroha {
       return signatories_valid and *signatories_valid;
     }
 
+    bool PostgresQueryExecutor::beginSnapshot() {
+      try {
+        *sql_ << "BEGIN ISOLATION LEVEL REPEATABLE READ READ ONLY";
+      } catch (const std::exception &e) {
+        log_->error("failed to start the snapshot of the query: {}", e.what());
+        return false;
+      }
+      return true;
+    }
+
+    void PostgresQueryExecutor::endSnapshot() {
+      try {
+        // a transaction broken by a failed statement is rolled back
+        *sql_ << "COMMIT";
+      } catch (const std::exception &e) {
+        // the responses are read already, the session is released anyway
+        log_->warn("failed to end the snapshot of the query: {}", e.what());
+      }
+    }
+
     QueryExecutorResult PostgresQueryExecutor::validateAndExecute(
         const shared_model::interface::Query &query,
         const bool validate_signatories = true) {
-      if (validate_signatories and not validateSignatures(query)) {
+      auto fail = [&](const std::string &reason) {
         // TODO [IR-1816] Akvinikym 03.12.18: replace magic number 3
         // with a named constant
         return query_response_factory_->createErrorQueryResponse(
             shared_model::interface::QueryResponseFactory::ErrorQueryType::
                 kStatefulFailed,
-            "query signatories did not pass validation",
+            reason,
             3,
             query.hash());
+      };
+      // the signatories and all statements of the query see the same state
+      if (not beginSnapshot()) {
+        return fail("failed to start the snapshot of the query");
+      }
+      if (validate_signatories and not validateSignatures(query)) {
+        endSnapshot();
+        return fail("query signatories did not pass validation");
       }
-      return specific_query_executor_->execute(query);
+      auto response = specific_query_executor_->execute(query);
+      endSnapshot();
+      return response;
+    }
+
+    std::vector<QueryExecutorResult>
+    PostgresQueryExecutor::validateAndExecuteBatch(
+        const QueryBatchType &queries, const bool validate_signatories) {
+      std::vector<QueryExecutorResult> responses;
+      responses.reserve(queries.size());
+      auto fail = [&](const std::string &reason) {
+        for (const auto &query : queries) {
+          responses.push_back(
+              query_response_factory_->createErrorQueryResponse(
+                  shared_model::interface::QueryResponseFactory::
+                      ErrorQueryType::kStatefulFailed,
+                  reason,
+                  3,
+                  query->hash()));
+        }
+        return std::move(responses);
+      };
+      if (queries.empty()) {
+        return responses;
+      }
+      if (not beginSnapshot()) {
+        return fail("failed to start the snapshot of the batch");
+      }
+      // the queries of a batch have the same creator and signatory
+      if (validate_signatories and not validateSignatures(*queries.front())) {
+        endSnapshot();
+        return fail("query signatories did not pass validation");
+      }
+      for (const auto &query : queries) {
+        responses.push_back(specific_query_executor_->execute(*query));
+      }
+      endSnapshot();
+      return responses;
     }
 
     bool PostgresQueryExecutor::validate(
@@ -94,5 +159,10 @@ namespace iroha {
       return true;
     }
 
+    bool PostgresQueryExecutor::validateSignatories(
+        const shared_model::interface::Query &query) {
+      return validateSignatures(query);
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -35,13 +35,30 @@ namespace iroha {
           const shared_model::interface::Query &query,
           const bool validate_signatories) override;
 
+      std::vector<QueryExecutorResult> validateAndExecuteBatch(
+          const QueryBatchType &queries,
+          const bool validate_signatories) override;
+
       bool validate(const shared_model::interface::BlocksQuery &query,
                     const bool validate_signatories) override;
 
+      bool validateSignatories(
+          const shared_model::interface::Query &query) override;
+
      private:
       template <class Q>
       bool validateSignatures(const Q &query);
 
+      /**
+       * Start the read only transaction, in which all statements of the
+       * queries see the state of the last block committed before it
+       * @return whether the transaction is started
+       */
+      bool beginSnapshot();
+
+      /// End the transaction started by beginSnapshot
+      void endSnapshot();
+
       std::unique_ptr<soci::session> sql_;
       std::shared_ptr<SpecificQueryExecutor> specific_query_executor_;
       std::shared_ptr<shared_model::interface::QueryResponseFactory>
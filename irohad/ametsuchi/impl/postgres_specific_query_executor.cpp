@@ -5,16 +5,18 @@
 
 #include "ametsuchi/impl/postgres_specific_query_executor.hpp"
 
+#include <algorithm>
+
 #include <boost/algorithm/string/classification.hpp>
-#include <boost/algorithm/string/join.hpp>
 #include <boost/algorithm/string/split.hpp>
 #include <boost/format.hpp>
+#include <boost/mpl/size.hpp>
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
-#include <boost/range/algorithm/transform.hpp>
-#include <boost/range/irange.hpp>
 #include "ametsuchi/block_storage.hpp"
+#include "ametsuchi/impl/account_assets_count_cache.hpp"
 #include "ametsuchi/impl/soci_utils.hpp"
+#include "ametsuchi/impl/statement_metrics.hpp"
 #include "backend/plain/account_detail_record_id.hpp"
 #include "backend/plain/peer.hpp"
 #include "common/bind.hpp"
@@ -69,13 +71,12 @@ namespace {
     std::string query = (boost::format(R"(
           SELECT
             (
-              COALESCE(bit_or(rp.permission), '0'::bit(%1%))
+              COALESCE(bit_or(permission), '0'::bit(%1%))
               & ('%2%'::bit(%1%) | '%3%'::bit(%1%))
             ) != '0'::bit(%1%)
             AS perm
-          FROM role_has_permissions AS rp
-          JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-          WHERE ar.account_id = %4%)")
+          FROM account_effective_permissions
+          WHERE account_id = %4%)")
                          % bits % perm_str % kRootRolePermStr % account_alias)
                             .str();
     return query;
@@ -110,22 +111,19 @@ namespace {
     WITH
         has_root_perm AS (%1%),
         has_indiv_perm AS (
-          SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%2%))
-          & '%4%') = '%4%' FROM role_has_permissions AS rp
-              JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-              WHERE ar.account_id = '%3%'
+          SELECT (COALESCE(bit_or(permission), '0'::bit(%2%))
+          & '%4%') = '%4%' FROM account_effective_permissions
+              WHERE account_id = '%3%'
         ),
         has_all_perm AS (
-          SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%2%))
-          & '%5%') = '%5%' FROM role_has_permissions AS rp
-              JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-              WHERE ar.account_id = '%3%'
+          SELECT (COALESCE(bit_or(permission), '0'::bit(%2%))
+          & '%5%') = '%5%' FROM account_effective_permissions
+              WHERE account_id = '%3%'
         ),
         has_domain_perm AS (
-          SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%2%))
-          & '%6%') = '%6%' FROM role_has_permissions AS rp
-              JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-              WHERE ar.account_id = '%3%'
+          SELECT (COALESCE(bit_or(permission), '0'::bit(%2%))
+          & '%6%') = '%6%' FROM account_effective_permissions
+              WHERE account_id = '%3%'
         )
     SELECT (SELECT * from has_root_perm)
         OR ('%3%' = '%7%' AND (SELECT * FROM has_indiv_perm))
@@ -177,6 +175,26 @@ namespace {
         | boost::adaptors::transformed([](auto t) { return *t; });
   }
 
+  /// names of the queries in the order of the query variant
+  const std::string kQueryNames[] = {"GetAccount",
+                                     "GetSignatories",
+                                     "GetAccountTransactions",
+                                     "GetAccountAssetTransactions",
+                                     "GetTransactions",
+                                     "GetAccountAssets",
+                                     "GetAccountDetail",
+                                     "GetRoles",
+                                     "GetRolePermissions",
+                                     "GetAssetInfo",
+                                     "GetPendingTransactions",
+                                     "GetBlock",
+                                     "GetPeers"};
+  static_assert(
+      boost::mpl::size<shared_model::interface::Query::QueryVariantType::
+                           types>::value
+          == sizeof(kQueryNames) / sizeof(kQueryNames[0]),
+      "Every query must have a name");
+
 }  // namespace
 
 namespace iroha {
@@ -190,43 +208,48 @@ namespace iroha {
             response_factory,
         std::shared_ptr<shared_model::interface::PermissionToString>
             perm_converter,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        std::shared_ptr<StatementMetrics> statement_metrics,
+        std::shared_ptr<AccountAssetsCountCache> assets_count_cache)
         : sql_(sql),
           block_store_(block_store),
           pending_txs_storage_(std::move(pending_txs_storage)),
           query_response_factory_{std::move(response_factory)},
           perm_converter_(std::move(perm_converter)),
-          log_(std::move(log)) {}
+          log_(std::move(log)),
+          statement_metrics_(std::move(statement_metrics)),
+          assets_count_cache_(std::move(assets_count_cache)) {}
 
     QueryExecutorResult PostgresSpecificQueryExecutor::execute(
         const shared_model::interface::Query &qry) {
-      return boost::apply_visitor(
+      const auto start = StatementMetrics::Clock::now();
+      auto response = boost::apply_visitor(
           [this, &qry](const auto &query) {
             return (*this)(query, qry.creatorAccountId(), qry.hash());
           },
           qry.get());
+      if (statement_metrics_) {
+        statement_metrics_->record("query",
+                                   kQueryNames[qry.get().which()],
+                                   StatementMetrics::Clock::now() - start);
+      }
+      return response;
     }
 
-    template <typename RangeGen, typename Pred>
     std::vector<std::unique_ptr<shared_model::interface::Transaction>>
-    PostgresSpecificQueryExecutor::getTransactionsFromBlock(
-        uint64_t block_id, RangeGen &&range_gen, Pred &&pred) {
+    PostgresSpecificQueryExecutor::getTransactionsByPositions(
+        uint64_t block_id, const std::vector<uint64_t> &indices) {
       std::vector<std::unique_ptr<shared_model::interface::Transaction>> result;
-      auto block = block_store_.fetch(block_id);
-      if (not block) {
-        log_->error("Failed to retrieve block with id {}", block_id);
-        return result;
+      for (auto index : indices) {
+        auto tx = block_store_.fetchTransaction(block_id, index);
+        if (not tx) {
+          log_->error("Failed to retrieve transaction {} of block {}",
+                      index,
+                      block_id);
+          continue;
+        }
+        result.push_back(std::move(*tx));
       }
-
-      boost::transform(range_gen(boost::size((*block)->transactions()))
-                           | boost::adaptors::transformed(
-                                 [&block](auto i) -> decltype(auto) {
-                                   return (*block)->transactions()[i];
-                                 })
-                           | boost::adaptors::filtered(pred),
-                       std::back_inserter(result),
-                       [&](const auto &tx) { return clone(tx); });
-
       return result;
     }
 
@@ -337,6 +360,7 @@ namespace iroha {
         const shared_model::interface::types::AccountIdType &creator_id,
         const shared_model::interface::types::HashType &query_hash,
         QueryChecker &&qry_checker,
+        const std::string &query_args,
         const std::string &related_txs,
         QueryApplier applier,
         Permissions... perms) {
@@ -349,18 +373,17 @@ namespace iroha {
       // retrieve one extra transaction to populate next_hash
       auto query_size = pagination_info.pageSize() + 1u;
 
-      auto base = boost::format(R"(WITH has_perms AS (%s),
-      my_txs AS (%s),
-      first_hash AS (%s),
+      // the arguments are bound once in the first CTE and read both by the
+      // total size and by the page, which is an index range of the related
+      // txs starting from the tx with the paging hash
+      auto base = boost::format(R"(WITH has_perms AS (%1%),
+      args AS (%2%),%3%
       total_size AS (
-        SELECT COUNT(*) FROM my_txs
+        SELECT COUNT(*) FROM (SELECT DISTINCT height, index %4%) my_txs
       ),
       t AS (
-        SELECT my_txs.height, my_txs.index
-        FROM my_txs JOIN
-        first_hash ON my_txs.height > first_hash.height
-        OR (my_txs.height = first_hash.height AND
-            my_txs.index >= first_hash.index)
+        SELECT DISTINCT height, index %4% %5%
+        ORDER BY height, index ASC
         LIMIT :page_size
       )
       SELECT height, index, count, perm FROM t
@@ -369,22 +392,27 @@ namespace iroha {
       )");
 
       // select tx with specified hash
-      auto first_by_hash = R"(SELECT height, index FROM position_by_hash
-      WHERE hash = :hash LIMIT 1)";
-
-      // select first ever tx
-      auto first_tx = R"(SELECT height, index FROM position_by_hash
-      ORDER BY height, index ASC LIMIT 1)";
-
-      auto cmd = base % hasQueryPermission(creator_id, q.accountId(), perms...)
-          % related_txs;
+      auto first_by_hash = R"(
+      first_tx AS (
+        SELECT height, index FROM position_by_hash
+        WHERE hash = decode(:hash, 'hex') LIMIT 1
+      ),)";
+
+      // the separate height bound prunes the partitions of the history
+      // tables before the first tx
+      auto after_first_tx = R"(AND (height, index) >=
+            ((SELECT height FROM first_tx), (SELECT index FROM first_tx))
+          AND height >= (SELECT height FROM first_tx))";
+
+      base % hasQueryPermission(creator_id, q.accountId(), perms...)
+          % query_args;
       if (first_hash) {
-        cmd = base % first_by_hash;
+        base % first_by_hash % related_txs % after_first_tx;
       } else {
-        cmd = base % first_tx;
+        base % "" % related_txs % "";
       }
 
-      auto query = cmd.str();
+      auto query = base.str();
 
       return executeQuery<QueryTuple, PermissionTuple>(
           applier(query),
@@ -409,10 +437,8 @@ namespace iroha {
                 response_txs;
             // get transactions corresponding to indexes
             for (auto &block : index) {
-              auto txs = this->getTransactionsFromBlock(
-                  block.first,
-                  [&block](auto) { return block.second; },
-                  [](auto &) { return true; });
+              auto txs =
+                  this->getTransactionsByPositions(block.first, block.second);
               std::move(
                   txs.begin(), txs.end(), std::back_inserter(response_txs));
             }
@@ -620,10 +646,12 @@ namespace iroha {
         const shared_model::interface::GetAccountTransactions &q,
         const shared_model::interface::types::AccountIdType &creator_id,
         const shared_model::interface::types::HashType &query_hash) {
-      std::string related_txs = R"(SELECT DISTINCT height, index
-      FROM tx_position_by_creator
-      WHERE creator_id = :account_id
-      ORDER BY height, index ASC)";
+      std::string query_args =
+          R"(SELECT CAST(:account_id AS text) AS account_id)";
+      // consider tx_position_by_creator_index when changing this
+      std::string related_txs = R"(FROM tx_position_by_creator
+      WHERE creator_key = (SELECT key FROM id_dictionary
+          WHERE id = (SELECT account_id FROM args)))";
 
       const auto &pagination_info = q.paginationMeta();
       auto first_hash = pagination_info.firstTxHash();
@@ -658,6 +686,7 @@ namespace iroha {
                                       creator_id,
                                       query_hash,
                                       std::move(check_query),
+                                      query_args,
                                       related_txs,
                                       apply_query,
                                       Role::kGetMyAccTxs,
@@ -669,33 +698,35 @@ namespace iroha {
         const shared_model::interface::GetTransactions &q,
         const shared_model::interface::types::AccountIdType &creator_id,
         const shared_model::interface::types::HashType &query_hash) {
-      std::string hash_str = boost::algorithm::join(
-          q.transactionHashes()
-              | boost::adaptors::transformed(
-                    [](const auto &h) { return "'" + h.hex() + "'"; }),
-          ", ");
+      std::vector<std::string> hash_literals;
+      for (const auto &hash : q.transactionHashes()) {
+        hash_literals.push_back(makePgBytea(hash.hex()));
+      }
+      auto hashes_array = makePgArray(hash_literals);
 
       using QueryTuple =
-          QueryType<shared_model::interface::types::HeightType, std::string>;
+          QueryType<shared_model::interface::types::HeightType, uint64_t>;
       using PermissionTuple = boost::tuple<int, int>;
 
       auto cmd =
           (boost::format(R"(WITH has_my_perm AS (%s),
       has_all_perm AS (%s),
       t AS (
-          SELECT height, hash FROM position_by_hash WHERE hash IN (%s)
+          SELECT height, index FROM position_by_hash
+          WHERE hash = ANY(CAST(:hashes AS bytea[]))
       )
-      SELECT height, hash, has_my_perm.perm, has_all_perm.perm FROM t
+      SELECT height, index, has_my_perm.perm, has_all_perm.perm FROM t
       RIGHT OUTER JOIN has_my_perm ON TRUE
       RIGHT OUTER JOIN has_all_perm ON TRUE
       )") % getAccountRolePermissionCheckSql(Role::kGetMyTxs, ":account_id")
-           % getAccountRolePermissionCheckSql(Role::kGetAllTxs, ":account_id")
-           % hash_str)
+           % getAccountRolePermissionCheckSql(Role::kGetAllTxs, ":account_id"))
               .str();
 
       return executeQuery<QueryTuple, PermissionTuple>(
           [&] {
-            return (sql_.prepare << cmd, soci::use(creator_id, "account_id"));
+            return (sql_.prepare << cmd,
+                    soci::use(creator_id, "account_id"),
+                    soci::use(hashes_array, "hashes"));
           },
           query_hash,
           [&](auto range, auto &my_perm, auto &all_perm) {
@@ -712,29 +743,27 @@ namespace iroha {
                   4,
                   query_hash);
             }
-            std::map<uint64_t, std::unordered_set<std::string>> index;
+            std::map<uint64_t, std::vector<uint64_t>> index;
             for (const auto &t : range_without_nulls) {
-              iroha::ametsuchi::apply(t, [&index](auto &height, auto &hash) {
-                index[height].insert(hash);
+              iroha::ametsuchi::apply(t, [&index](auto &height, auto &idx) {
+                index[height].push_back(idx);
               });
             }
 
             std::vector<std::unique_ptr<shared_model::interface::Transaction>>
                 response_txs;
+            // the transactions are read by their positions, so the blocks
+            // are not parsed if the block storage indexes the transactions
             for (auto &block : index) {
-              auto txs = this->getTransactionsFromBlock(
-                  block.first,
-                  [](auto size) {
-                    return boost::irange(static_cast<decltype(size)>(0), size);
-                  },
-                  [&](auto &tx) {
-                    return block.second.count(tx.hash().hex()) > 0
-                        and (all_perm
-                             or (my_perm
-                                 and tx.creatorAccountId() == creator_id));
-                  });
-              std::move(
-                  txs.begin(), txs.end(), std::back_inserter(response_txs));
+              std::sort(block.second.begin(), block.second.end());
+              auto txs =
+                  this->getTransactionsByPositions(block.first, block.second);
+              for (auto &tx : txs) {
+                if (all_perm
+                    or (my_perm and tx->creatorAccountId() == creator_id)) {
+                  response_txs.push_back(std::move(tx));
+                }
+              }
             }
 
             return query_response_factory_->createTransactionsResponse(
@@ -748,11 +777,15 @@ namespace iroha {
         const shared_model::interface::GetAccountAssetTransactions &q,
         const shared_model::interface::types::AccountIdType &creator_id,
         const shared_model::interface::types::HashType &query_hash) {
-      std::string related_txs = R"(SELECT DISTINCT height, index
-          FROM position_by_account_asset
-          WHERE account_id = :account_id
-          AND asset_id = :asset_id
-          ORDER BY height, index ASC)";  // consider index when changing this
+      std::string query_args = R"(SELECT
+          CAST(:account_id AS text) AS account_id,
+          CAST(:asset_id AS text) AS asset_id)";
+      // consider position_by_account_asset_index when changing this
+      std::string related_txs = R"(FROM position_by_account_asset
+          WHERE account_key = (SELECT key FROM id_dictionary
+              WHERE id = (SELECT account_id FROM args))
+          AND asset_key = (SELECT key FROM id_dictionary
+              WHERE id = (SELECT asset_id FROM args)))";
 
       const auto &pagination_info = q.paginationMeta();
       auto first_hash = pagination_info.firstTxHash();
@@ -795,6 +828,7 @@ namespace iroha {
                                       creator_id,
                                       query_hash,
                                       std::move(check_query),
+                                      query_args,
                                       related_txs,
                                       apply_query,
                                       Role::kGetMyAccAstTxs,
@@ -810,45 +844,55 @@ namespace iroha {
           QueryType<shared_model::interface::types::AccountIdType,
                     shared_model::interface::types::AssetIdType,
                     std::string,
-                    size_t>;
+                    size_t,
+                    shared_model::interface::types::HeightType>;
       using PermissionTuple = boost::tuple<int>;
 
-      // get the assets
+      // get the assets with a seek over the primary key from the first asset
+      // of the page, so the cost of a page does not depend on its offset;
+      // the total number is counted unless it is cached for the same height
       auto cmd = (boost::format(R"(
       with has_perms as (%s),
-      all_data as (
-          select row_number() over () rn, *
-          from (
-              select *
-              from account_has_asset
-              where account_id = :account_id
-              order by asset_id
-          ) t
+      top_height as (
+          select coalesce((select height from top_block_info), 0) height
       ),
       total_number as (
-          select rn total_number
-          from all_data
-          order by rn desc
-          limit 1
-      ),
-      page_start as (
-          select rn
-          from all_data
-          where coalesce(asset_id = :first_asset_id, true)
-          limit 1
+          select
+              case
+                  when top_height.height = :cached_height
+                      then cast(:cached_total as bigint)
+                  else (
+                      select count(*)
+                      from account_has_asset
+                      where account_id = :account_id
+                  )
+              end total_number,
+              top_height.height
+          from top_height
       ),
       page_data as (
-          select * from all_data, page_start, total_number
+          select account_id, asset_id, amount
+          from account_has_asset
           where
-              all_data.rn >= page_start.rn and
-              coalesce( -- TODO remove after pagination is mandatory IR-516
-                  all_data.rn < page_start.rn + :page_size,
-                  true
+              account_id = :account_id and (
+                  cast(:first_asset_id as text) is null or (
+                      asset_id >= :first_asset_id and exists (
+                          select 1
+                          from account_has_asset
+                          where
+                              account_id = :account_id and
+                              asset_id = :first_asset_id
+                      )
+                  )
               )
+          order by asset_id
+          -- null is no limit until pagination is mandatory IR-516
+          limit :page_size
       )
-      select account_id, asset_id, amount, total_number, perm
+      select account_id, asset_id, amount, total_number, height, perm
           from
               page_data
+              cross join total_number
               right join has_perms on true
       )")
                   % hasQueryPermission(creator_id,
@@ -869,13 +913,24 @@ namespace iroha {
           pagination_meta | [](const auto &pagination_meta) {
             return boost::optional<size_t>(pagination_meta.pageSize() + 1);
           };
+      const auto cached = assets_count_cache_
+          ? assets_count_cache_->find(q.accountId())
+          : boost::none;
+      const auto cached_height = cached | [](const auto &cached) {
+        return boost::make_optional(cached.height);
+      };
+      const auto cached_total = cached | [](const auto &cached) {
+        return boost::make_optional(cached.count);
+      };
 
       return executeQuery<QueryTuple, PermissionTuple>(
           [&] {
             return (sql_.prepare << cmd,
                     soci::use(q.accountId(), "account_id"),
                     soci::use(req_first_asset_id, "first_asset_id"),
-                    soci::use(req_page_size, "page_size"));
+                    soci::use(req_page_size, "page_size"),
+                    soci::use(cached_height, "cached_height"),
+                    soci::use(cached_total, "cached_total"));
           },
           query_hash,
           [&](auto range, auto &) {
@@ -886,20 +941,26 @@ namespace iroha {
                            shared_model::interface::Amount>>
                 assets;
             size_t total_number = 0;
+            shared_model::interface::types::HeightType height = 0;
             for (const auto &row : range_without_nulls) {
               iroha::ametsuchi::apply(
                   row,
-                  [&assets, &total_number](auto &account_id,
-                                           auto &asset_id,
-                                           auto &amount,
-                                           auto &total_number_col) {
+                  [&assets, &total_number, &height](auto &account_id,
+                                                    auto &asset_id,
+                                                    auto &amount,
+                                                    auto &total_number_col,
+                                                    auto &height_col) {
                     total_number = total_number_col;
+                    height = height_col;
                     assets.push_back(std::make_tuple(
                         std::move(account_id),
                         std::move(asset_id),
                         shared_model::interface::Amount(amount)));
                   });
             }
+            if (assets_count_cache_ and not assets.empty()) {
+              assets_count_cache_->put(q.accountId(), height, total_number);
+            }
             if (assets.empty() and req_first_asset_id) {
               // nonexistent first_asset_id provided in query request
               return this->logAndReturnErrorResponse(
@@ -942,55 +1003,65 @@ namespace iroha {
       auto cmd = (boost::format(R"(
       with has_perms as (%s),
       detail AS (
-          with filtered_plain_data as (
-              select row_number() over () rn, *
+          with page_start as (
+              (
+                  select writer, key
+                  from account_detail
+                  where
+                      account_id = :account_id and
+                      writer = :first_record_writer and
+                      key = :first_record_key and
+                      coalesce(writer = :writer, true) and
+                      coalesce(key = :key, true)
+              )
+              union all
+              (
+                  select writer, key
+                  from account_detail
+                  where
+                      account_id = :account_id and
+                      :first_record_writer is null and
+                      coalesce(writer = :writer, true) and
+                      coalesce(key = :key, true)
+                  order by writer asc, key asc
+                  limit 1
+              )
+          ),
+          page_data as (
+              select row_number() over (order by writer asc, key asc) rn, *
               from (
-                  select
-                      data_by_writer.key writer,
-                      plain_data.key as key,
-                      plain_data.value as value
-                  from
-                      jsonb_each((
-                          select data
-                          from account
-                          where account_id = :account_id
-                      )) data_by_writer,
-                  jsonb_each(data_by_writer.value) plain_data
+                  select writer, key, value
+                  from account_detail
                   where
-                      coalesce(data_by_writer.key = :writer, true) and
-                      coalesce(plain_data.key = :key, true)
-                  order by data_by_writer.key asc, plain_data.key asc
+                      account_id = :account_id and
+                      (writer, key) >= (select writer, key from page_start) and
+                      coalesce(writer = :writer, true) and
+                      coalesce(key = :key, true)
+                  order by writer asc, key asc
+                  limit :page_size + 1
               ) t
           ),
-          page_limits as (
-              select start.rn as start, start.rn + :page_size as end
-                  from (
-                      select rn
-                      from filtered_plain_data
-                      where
-                          coalesce(writer = :first_record_writer, true) and
-                          coalesce(key = :first_record_key, true)
-                      limit 1
-                  ) start
+          total_number as (
+              select count(1) total_number
+              from account_detail
+              where
+                  account_id = :account_id and
+                  coalesce(writer = :writer, true) and
+                  coalesce(key = :key, true)
           ),
-          total_number as (select count(1) total_number from filtered_plain_data),
           next_record as (
               select writer, key
-              from
-                  filtered_plain_data,
-                  page_limits
-              where rn = page_limits.end
+              from page_data
+              where rn = :page_size + 1
           ),
           page as (
-              select json_object_agg(writer, data_by_writer) json
+              select json_object_agg(writer, data_by_writer order by writer) json
               from (
-                  select writer, json_object_agg(key, value) data_by_writer
-                  from
-                      filtered_plain_data,
-                      page_limits
-                  where
-                      rn >= page_limits.start and
-                      coalesce(rn < page_limits.end, true)
+                  select
+                      writer,
+                      json_object_agg(key, value order by key) data_by_writer
+                  from page_data
+                  where coalesce(rn <= :page_size, true)
                   group by writer
               ) t
           ),
@@ -37,7 +37,9 @@ namespace iroha {
 
   namespace ametsuchi {
 
+    class AccountAssetsCountCache;
     class BlockStorage;
+    class StatementMetrics;
 
     using QueryErrorType =
         shared_model::interface::QueryResponseFactory::ErrorQueryType;
@@ -56,7 +58,10 @@ namespace iroha {
               response_factory,
           std::shared_ptr<shared_model::interface::PermissionToString>
               perm_converter,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::shared_ptr<StatementMetrics> statement_metrics = nullptr,
+          std::shared_ptr<AccountAssetsCountCache> assets_count_cache =
+              nullptr);
 
       QueryExecutorResult execute(
           const shared_model::interface::Query &qry) override;
@@ -132,14 +137,12 @@ namespace iroha {
 
      private:
       /**
-       * Get transactions from block using range from range_gen and filtered by
-       * predicate pred
+       * Get transactions of block by their indices in it, skipping the ones
+       * which can not be retrieved
        */
-      template <typename RangeGen, typename Pred>
       std::vector<std::unique_ptr<shared_model::interface::Transaction>>
-      getTransactionsFromBlock(uint64_t block_id,
-                               RangeGen &&range_gen,
-                               Pred &&pred);
+      getTransactionsByPositions(uint64_t block_id,
+                                 const std::vector<uint64_t> &indices);
 
       /**
        * Execute query and return its response
@@ -190,8 +193,11 @@ namespace iroha {
        * @param query_hash - hash of query
        * @param qry_checker - fallback checker of the query, needed if paging
        * hash is not specified and 0 transaction are returned as a query result
-       * @param related_txs - SQL query which returns transaction relevant
-       * to this query
+       * @param query_args - SQL query which selects the arguments of the
+       * query as the single row of the "args" table
+       * @param related_txs - FROM and WHERE clauses of SQL query which selects
+       * positions of transactions relevant to this query, reading the
+       * arguments from "args"
        * @param applier - function which accepts SQL
        * and returns another function which executes that query
        * @param perms - permissions, necessary to execute the query
@@ -206,6 +212,7 @@ namespace iroha {
           const shared_model::interface::types::AccountIdType &creator_id,
           const shared_model::interface::types::HashType &query_hash,
           QueryChecker &&qry_checker,
+          const std::string &query_args,
           const std::string &related_txs,
           QueryApplier applier,
           Permissions... perms);
@@ -260,6 +267,12 @@ namespace iroha {
       std::shared_ptr<shared_model::interface::PermissionToString>
           perm_converter_;
       logger::LoggerPtr log_;
+
+      /// execution time of the queries, may be null
+      std::shared_ptr<StatementMetrics> statement_metrics_;
+
+      /// numbers of the assets of the accounts, may be null
+      std::shared_ptr<AccountAssetsCountCache> assets_count_cache_;
     };
 
   }  // namespace ametsuchi
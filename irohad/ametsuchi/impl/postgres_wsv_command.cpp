@@ -177,8 +177,14 @@ namespace iroha {
     WsvCommandResult PostgresWsvCommand::insertAccount(
         const shared_model::interface::Account &account) {
       soci::statement st = sql_.prepare
-          << "INSERT INTO account(account_id, domain_id, quorum,"
-             "data) VALUES (:id, :domain_id, :quorum, :data)";
+          << "WITH inserted AS (INSERT INTO account(account_id, domain_id, "
+             "quorum, data) VALUES (:id, :domain_id, :quorum, :data) "
+             "RETURNING account_id, data) "
+             "INSERT INTO account_detail(account_id, writer, key, value) "
+             "SELECT inserted.account_id, data_by_writer.key, plain_data.key, "
+             "plain_data.value FROM inserted, "
+             "jsonb_each(inserted.data) data_by_writer, "
+             "jsonb_each(data_by_writer.value) plain_data";
       uint32_t quorum = account.quorum();
       st.exchange(soci::use(account.accountId()));
       st.exchange(soci::use(account.domainId()));
@@ -381,10 +387,16 @@ namespace iroha {
         const std::string &key,
         const std::string &val) {
       soci::statement st = sql_.prepare
-          << "UPDATE account SET data = jsonb_set("
+          << "WITH updated AS (UPDATE account SET data = jsonb_set("
              "CASE WHEN data ?:creator_account_id THEN data ELSE "
              "jsonb_set(data, :json, :empty_json) END, "
-             " :filled_json, :val) WHERE account_id=:account_id";
+             " :filled_json, :val) WHERE account_id=:account_id "
+             "RETURNING (1)) "
+             "INSERT INTO account_detail(account_id, writer, key, value) "
+             "SELECT :account_id, :creator_account_id, :key, :val::jsonb "
+             "WHERE EXISTS (SELECT * FROM updated) "
+             "ON CONFLICT (account_id, writer, key) "
+             "DO UPDATE SET value = excluded.value";
       std::string json = "{" + creator_account_id + "}";
       std::string empty_json = "{}";
       std::string filled_json = "{" + creator_account_id + ", " + key + "}";
@@ -395,6 +407,7 @@ namespace iroha {
       st.exchange(soci::use(filled_json));
       st.exchange(soci::use(value));
       st.exchange(soci::use(account_id));
+      st.exchange(soci::use(key));
 
       auto msg = [&] {
         return (boost::format(
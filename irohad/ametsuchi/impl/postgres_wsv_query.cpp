@@ -38,13 +38,22 @@ namespace iroha {
     using shared_model::interface::types::PubkeyType;
     using shared_model::interface::types::TLSCertificateType;
 
-    PostgresWsvQuery::PostgresWsvQuery(soci::session &sql,
-                                       logger::LoggerPtr log)
-        : sql_(sql), log_(std::move(log)) {}
+    PostgresWsvQuery::PostgresWsvQuery(
+        soci::session &sql,
+        logger::LoggerPtr log,
+        std::shared_ptr<StatementMetrics> statement_metrics)
+        : sql_(sql),
+          log_(std::move(log)),
+          statement_metrics_(std::move(statement_metrics)) {}
 
-    PostgresWsvQuery::PostgresWsvQuery(std::unique_ptr<soci::session> sql,
-                                       logger::LoggerPtr log)
-        : psql_(std::move(sql)), sql_(*psql_), log_(std::move(log)) {}
+    PostgresWsvQuery::PostgresWsvQuery(
+        std::unique_ptr<soci::session> sql,
+        logger::LoggerPtr log,
+        std::shared_ptr<StatementMetrics> statement_metrics)
+        : psql_(std::move(sql)),
+          sql_(*psql_),
+          log_(std::move(log)),
+          statement_metrics_(std::move(statement_metrics)) {}
 
     template <typename T, typename F>
     auto PostgresWsvQuery::execute(F &&f) -> boost::optional<soci::rowset<T>> {
@@ -56,9 +65,19 @@ namespace iroha {
       }
     }
 
+    void PostgresWsvQuery::record(const char *name,
+                                  StatementMetrics::Clock::time_point start,
+                                  uint64_t rows) const {
+      if (statement_metrics_) {
+        statement_metrics_->record(
+            "wsv", name, StatementMetrics::Clock::now() - start, rows);
+      }
+    }
+
     boost::optional<std::vector<PubkeyType>> PostgresWsvQuery::getSignatories(
         const AccountIdType &account_id) {
       using T = boost::tuple<std::string>;
+      const auto start = StatementMetrics::Clock::now();
       auto result = execute<T>([&] {
         return (sql_.prepare
                     << "SELECT public_key FROM account_has_signatory WHERE "
@@ -66,28 +85,35 @@ namespace iroha {
                 soci::use(account_id));
       });
 
-      return mapValues<std::vector<PubkeyType>>(result, [&](auto &public_key) {
-        return shared_model::crypto::PublicKey{
-            shared_model::crypto::Blob::fromHexString(public_key)};
-      });
+      auto signatories = mapValues<std::vector<PubkeyType>>(
+          result, [&](auto &public_key) {
+            return shared_model::crypto::PublicKey{
+                shared_model::crypto::Blob::fromHexString(public_key)};
+          });
+      record("getSignatories", start, signatories ? signatories->size() : 0);
+      return signatories;
     }
 
     boost::optional<std::vector<std::shared_ptr<shared_model::interface::Peer>>>
     PostgresWsvQuery::getPeers() {
       using T = boost::
           tuple<std::string, AddressType, boost::optional<TLSCertificateType>>;
+      const auto start = StatementMetrics::Clock::now();
       auto result = execute<T>([&] {
         return (sql_.prepare
                 << "SELECT public_key, address, tls_certificate FROM peer");
       });
 
-      return getPeersFromSociRowSet(result);
+      auto peers = getPeersFromSociRowSet(result);
+      record("getPeers", start, peers ? peers->size() : 0);
+      return peers;
     }
 
     boost::optional<std::shared_ptr<shared_model::interface::Peer>>
     PostgresWsvQuery::getPeerByPublicKey(const PubkeyType &public_key) {
       using T = boost::
           tuple<std::string, AddressType, boost::optional<TLSCertificateType>>;
+      const auto start = StatementMetrics::Clock::now();
       auto result = execute<T>([&] {
         return (sql_.prepare << R"(
             SELECT public_key, address, tls_certificate
@@ -96,9 +122,32 @@ namespace iroha {
                 soci::use(public_key.hex(), "public_key"));
       });
 
-      return getPeersFromSociRowSet(result) | [](auto &&peers) {
+      auto peers = getPeersFromSociRowSet(result);
+      record("getPeerByPublicKey", start, peers ? peers->size() : 0);
+      return std::move(peers) | [](auto &&peers) {
         return boost::make_optional(std::move(peers.front()));
       };
     }
+
+    boost::optional<std::string> PostgresWsvQuery::getStateDigest(
+        shared_model::interface::types::HeightType height) {
+      using T = boost::tuple<std::string>;
+      const auto start = StatementMetrics::Clock::now();
+      const long long block_height = height;
+      auto result = execute<T>([&] {
+        return (sql_.prepare << "SELECT CAST(digest AS text) "
+                                "FROM wsv_digest_history "
+                                "WHERE height = :height",
+                soci::use(block_height, "height"));
+      });
+
+      auto digests = mapValues<std::vector<std::string>>(
+          result, [](auto &digest) { return digest; });
+      record("getStateDigest", start, digests ? digests->size() : 0);
+      if (not digests or digests->empty()) {
+        return boost::none;
+      }
+      return std::move(digests->front());
+    }
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -9,16 +9,22 @@
 #include "ametsuchi/wsv_query.hpp"
 
 #include <soci/soci.h>
+#include "ametsuchi/impl/statement_metrics.hpp"
 #include "logger/logger_fwd.hpp"
 
 namespace iroha {
   namespace ametsuchi {
     class PostgresWsvQuery : public WsvQuery {
      public:
-      PostgresWsvQuery(soci::session &sql, logger::LoggerPtr log);
+      PostgresWsvQuery(
+          soci::session &sql,
+          logger::LoggerPtr log,
+          std::shared_ptr<StatementMetrics> statement_metrics = nullptr);
 
-      PostgresWsvQuery(std::unique_ptr<soci::session> sql,
-                       logger::LoggerPtr log);
+      PostgresWsvQuery(
+          std::unique_ptr<soci::session> sql,
+          logger::LoggerPtr log,
+          std::shared_ptr<StatementMetrics> statement_metrics = nullptr);
 
       boost::optional<std::vector<shared_model::interface::types::PubkeyType>>
       getSignatories(const shared_model::interface::types::AccountIdType
@@ -32,6 +38,9 @@ namespace iroha {
       getPeerByPublicKey(const shared_model::interface::types::PubkeyType
                              &public_key) override;
 
+      boost::optional<std::string> getStateDigest(
+          shared_model::interface::types::HeightType height) override;
+
      private:
       /**
        * Executes given lambda of type F, catches exceptions if any, logs the
@@ -40,11 +49,17 @@ namespace iroha {
       template <typename T, typename F>
       auto execute(F &&f) -> boost::optional<soci::rowset<T>>;
 
+      /// Record the execution of the statement, if the metrics are set
+      void record(const char *name,
+                  StatementMetrics::Clock::time_point start,
+                  uint64_t rows) const;
+
       // TODO andrei 24.09.2018: IR-1718 Consistent soci::session fields in
       // storage classes
       std::unique_ptr<soci::session> psql_;
       soci::session &sql_;
       logger::LoggerPtr log_;
+      std::shared_ptr<StatementMetrics> statement_metrics_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -0,0 +1,251 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/postgres_wsv_snapshot.hpp"
+
+#include <algorithm>
+#include <map>
+
+#include <soci/soci.h>
+#include <boost/algorithm/string/join.hpp>
+#include <boost/format.hpp>
+#include "logger/logger.hpp"
+#include "main/impl/pg_connection_init.hpp"
+
+namespace {
+  /// WSV tables in the order which satisfies their foreign keys
+  const std::vector<std::string> kTables = {
+      "role",
+      "domain",
+      "signatory",
+      "account",
+      "account_detail",
+      "account_has_signatory",
+      "peer",
+      "asset",
+      "account_has_asset",
+      "role_has_permissions",
+      "account_has_roles",
+      "account_has_grantable_permissions",
+      "position_by_hash",
+      "tx_status_by_hash",
+      "tx_position_by_creator",
+      "position_by_account_asset",
+      "setting",
+      "top_block_info",
+      "history_index_height",
+  };
+
+  /// Columns of the tables which are in the snapshots in the form they were
+  /// stored before: the tx hashes in hex and the history with the ids instead
+  /// of their keys, so the snapshots do not depend on the id dictionary
+  struct ConvertedTable {
+    /// columns of the snapshot rows
+    const char *select;
+    /// columns of the snapshot rows in json_to_recordset
+    const char *record;
+    /// columns of the inserted rows
+    const char *columns;
+    /// values of the inserted rows
+    const char *insert;
+  };
+  const std::map<std::string, ConvertedTable> kConvertedTables = {
+      {"position_by_hash",
+       {"encode(hash, 'hex') AS hash, height, index",
+        "hash text, height bigint, index bigint",
+        "hash, height, index",
+        "decode(hash, 'hex'), height, index"}},
+      {"tx_status_by_hash",
+       {"encode(hash, 'hex') AS hash, status",
+        "hash text, status boolean",
+        "hash, status",
+        "decode(hash, 'hex'), status"}},
+      {"tx_position_by_creator",
+       {"iroha_key_id(creator_key) AS creator_id, height, index",
+        "creator_id text, height bigint, index bigint",
+        "creator_key, height, index",
+        "iroha_id_key(creator_id), height, index"}},
+      {"position_by_account_asset",
+       {"iroha_key_id(account_key) AS account_id, "
+        "iroha_key_id(asset_key) AS asset_id, height, index",
+        "account_id text, asset_id text, height bigint, index bigint",
+        "account_key, asset_key, height, index",
+        "iroha_id_key(account_id), iroha_id_key(asset_id), height, index"}},
+  };
+
+  /// read the top block of the WSV in the current transaction
+  boost::optional<std::pair<long long, std::string>> readTopBlock(
+      soci::session &sql) {
+    long long height = 0;
+    std::string hash;
+    sql << "SELECT height, hash FROM top_block_info",
+        soci::into(height), soci::into(hash);
+    if (not sql.got_data()) {
+      return boost::none;
+    }
+    return std::make_pair(height, std::move(hash));
+  }
+
+  /// roll back the current transaction, which may be broken already
+  void rollback(soci::session &sql, const logger::LoggerPtr &log) {
+    try {
+      sql << "ROLLBACK";
+    } catch (const std::exception &e) {
+      log->warn("Failed to roll back WSV snapshot transaction: {}", e.what());
+    }
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    constexpr size_t PostgresWsvSnapshot::kDefaultChunkRows;
+
+    PostgresWsvSnapshot::PostgresWsvSnapshot(soci::session &sql,
+                                             logger::LoggerPtr log,
+                                             size_t chunk_rows)
+        : sql_(sql),
+          log_(std::move(log)),
+          chunk_rows_(std::max<size_t>(chunk_rows, 1)) {}
+
+    expected::Result<WsvSnapshot, std::string>
+    PostgresWsvSnapshot::makeSnapshot() {
+      try {
+        // all tables are read from the same state of the database
+        sql_ << "BEGIN TRANSACTION ISOLATION LEVEL REPEATABLE READ READ ONLY";
+        auto top_block = readTopBlock(sql_);
+        if (not top_block) {
+          rollback(sql_, log_);
+          return expected::makeError("There are no applied blocks in WSV");
+        }
+        WsvSnapshot snapshot{
+            static_cast<shared_model::interface::types::HeightType>(
+                top_block->first),
+            shared_model::crypto::Hash::fromHexString(top_block->second),
+            {},
+            {}};
+        // the changes not folded yet are in the rows too
+        sql_ << "SELECT CAST(iroha_wsv_digest_mod(digest + COALESCE("
+                "(SELECT sum(delta) FROM wsv_digest_delta), 0)) AS text) "
+                "FROM wsv_digest",
+            soci::into(snapshot.state_digest);
+
+        std::vector<std::string> rows;
+        for (const auto &table : kTables) {
+          auto converted = kConvertedTables.find(table);
+          sql_ << (boost::format("DECLARE snapshot_rows NO SCROLL CURSOR FOR "
+                                 "SELECT row_to_json(t)::text FROM "
+                                 "(SELECT %s FROM %s) t")
+                   % (converted == kConvertedTables.end()
+                          ? "*"
+                          : converted->second.select)
+                   % table)
+                      .str();
+          while (true) {
+            rows.resize(chunk_rows_);
+            sql_ << "FETCH " + std::to_string(chunk_rows_)
+                    + " FROM snapshot_rows",
+                soci::into(rows);
+            if (rows.empty()) {
+              break;
+            }
+            snapshot.rows.push_back(WsvSnapshot::Rows{
+                table, "[" + boost::algorithm::join(rows, ",") + "]"});
+          }
+          sql_ << "CLOSE snapshot_rows";
+        }
+        sql_ << "ROLLBACK";
+
+        log_->info("Created WSV snapshot of {} parts at block {}",
+                   snapshot.rows.size(),
+                   snapshot.height);
+        return snapshot;
+      } catch (const std::exception &e) {
+        rollback(sql_, log_);
+        return expected::makeError(
+            std::string{"Failed to create WSV snapshot: "} + e.what());
+      }
+    }
+
+    expected::Result<void, std::string> PostgresWsvSnapshot::restoreSnapshot(
+        const WsvSnapshot &snapshot) {
+      auto fail = [this](std::string error) {
+        rollback(sql_, log_);
+        return expected::makeError(std::move(error));
+      };
+
+      try {
+        sql_ << "BEGIN";
+        auto reset = PgConnectionInit::resetWsv(sql_);
+        if (auto error = expected::resultToOptionalError(reset)) {
+          return fail(std::move(*error));
+        }
+        // the height of the indexed history comes with the snapshot
+        sql_ << "DELETE FROM history_index_height";
+        // the partitioned history tables get the partitions of the snapshot
+        long long height = snapshot.height;
+        sql_ << "SELECT iroha_history_partitions(0, :height)",
+            soci::use(height);
+
+        for (const auto &chunk : snapshot.rows) {
+          // the names come from another peer, so only the known tables are
+          // put in the statements
+          if (std::find(kTables.begin(), kTables.end(), chunk.table)
+              == kTables.end()) {
+            return fail("Unknown table in WSV snapshot: " + chunk.table);
+          }
+          auto converted = kConvertedTables.find(chunk.table);
+          if (converted != kConvertedTables.end()) {
+            sql_ << (boost::format("INSERT INTO %1% (%2%) SELECT %3% FROM "
+                                   "json_to_recordset(CAST(:rows AS json)) "
+                                   "AS t(%4%)")
+                     % chunk.table % converted->second.columns
+                     % converted->second.insert % converted->second.record)
+                        .str(),
+                soci::use(chunk.rows);
+            continue;
+          }
+          sql_ << (boost::format("INSERT INTO %1% SELECT * FROM "
+                                 "json_populate_recordset(NULL::%1%, "
+                                 "CAST(:rows AS json))")
+                   % chunk.table)
+                      .str(),
+              soci::use(chunk.rows);
+        }
+        // the snapshots without it are made by the peers which index the
+        // whole history on commit
+        sql_ << "INSERT INTO history_index_height (lock, height) "
+                "VALUES ('X', :height) ON CONFLICT (lock) DO NOTHING",
+            soci::use(height);
+
+        auto top_block = readTopBlock(sql_);
+        if (not top_block
+            or top_block->first != static_cast<long long>(snapshot.height)
+            or top_block->second != snapshot.block_hash.hex()) {
+          return fail("WSV snapshot rows do not match its block");
+        }
+        // the digest is folded when the top block is restored, so the rows
+        // are checked without reading them again
+        if (not snapshot.state_digest.empty()) {
+          int matches = 0;
+          sql_ << "SELECT CAST(digest = CAST(:state_digest AS numeric) "
+                  "AS int) FROM wsv_digest",
+              soci::use(snapshot.state_digest), soci::into(matches);
+          if (matches == 0) {
+            return fail("WSV snapshot rows do not match its state digest");
+          }
+        }
+        sql_ << "COMMIT";
+      } catch (const std::exception &e) {
+        return fail(std::string{"Failed to restore WSV snapshot: "}
+                        + e.what());
+      }
+
+      log_->info("Restored WSV snapshot at block {}", snapshot.height);
+      return expected::Value<void>();
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,64 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_POSTGRES_WSV_SNAPSHOT_HPP
+#define IROHA_POSTGRES_WSV_SNAPSHOT_HPP
+
+#include "ametsuchi/wsv_snapshot.hpp"
+
+#include "common/result.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace soci {
+  class session;
+}
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Export and import of the WSV tables of a Postgres database
+     */
+    class PostgresWsvSnapshot {
+     public:
+      /// default number of the rows in a part of the snapshot
+      static constexpr size_t kDefaultChunkRows = 10000;
+
+      /**
+       * @param sql - session which is not in a transaction
+       * @param log - logger
+       * @param chunk_rows - maximal number of the rows in a part of the
+       * snapshot
+       */
+      PostgresWsvSnapshot(soci::session &sql,
+                          logger::LoggerPtr log,
+                          size_t chunk_rows = kDefaultChunkRows);
+
+      /**
+       * Read all WSV tables in a read only transaction, so the snapshot
+       * corresponds to the last applied block
+       * @return snapshot or error message
+       */
+      expected::Result<WsvSnapshot, std::string> makeSnapshot();
+
+      /**
+       * Replace all WSV tables with the rows of the snapshot in one
+       * transaction. The snapshot is rejected unless its rows contain the top
+       * block of the snapshot
+       * @return error message on failure
+       */
+      expected::Result<void, std::string> restoreSnapshot(
+          const WsvSnapshot &snapshot);
+
+     private:
+      soci::session &sql_;
+      logger::LoggerPtr log_;
+      size_t chunk_rows_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_POSTGRES_WSV_SNAPSHOT_HPP
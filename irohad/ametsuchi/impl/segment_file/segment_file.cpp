@@ -0,0 +1,728 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/segment_file/segment_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <ciso646>
+#include <cstring>
+#include <map>
+
+#include <boost/filesystem.hpp>
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "common/files.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha::ametsuchi;
+using Identifier = SegmentFile::Identifier;
+
+namespace {
+  /// record header: identifier and size of the entity
+  constexpr size_t kHeaderSize = 2 * sizeof(uint32_t);
+
+  /// write the whole buffer at the offset
+  bool writeAll(int fd, const uint8_t *data, size_t size, uint64_t offset) {
+    while (size > 0) {
+      auto written = ::pwrite(fd, data, size, offset);
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return false;
+      }
+      data += written;
+      size -= written;
+      offset += written;
+    }
+    return true;
+  }
+
+  /// write the whole file, it appears complete at the path or not at all
+  bool writeFile(const std::string &path, const uint8_t *data, size_t size) {
+    const auto tmp = path + ".tmp";
+    auto fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+      return false;
+    }
+    bool result = writeAll(fd, data, size, 0) and ::fdatasync(fd) == 0;
+    result = ::close(fd) == 0 and result;
+    if (not result or ::rename(tmp.c_str(), path.c_str()) != 0) {
+      ::unlink(tmp.c_str());
+      return false;
+    }
+    return true;
+  }
+
+  /// copy the file, the copy appears complete at the path or not at all
+  bool copyFile(const std::string &from, const std::string &to) {
+    const auto tmp = to + ".tmp";
+    auto in = ::open(from.c_str(), O_RDONLY);
+    if (in < 0) {
+      return false;
+    }
+    auto out = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (out < 0) {
+      ::close(in);
+      return false;
+    }
+    std::vector<uint8_t> buffer(1024 * 1024);
+    uint64_t offset = 0;
+    bool result = true;
+    while (result) {
+      auto count = ::read(in, buffer.data(), buffer.size());
+      if (count < 0 and errno == EINTR) {
+        continue;
+      }
+      if (count <= 0) {
+        result = count == 0;
+        break;
+      }
+      result = writeAll(out, buffer.data(), count, offset);
+      offset += count;
+    }
+    ::close(in);
+    result = result and ::fdatasync(out) == 0;
+    result = ::close(out) == 0 and result;
+    if (not result or ::rename(tmp.c_str(), to.c_str()) != 0) {
+      ::unlink(tmp.c_str());
+      return false;
+    }
+    return true;
+  }
+
+  /// make the entries of the directory durable
+  bool syncDirectory(const std::string &path) {
+    auto fd = ::open(path.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) {
+      return false;
+    }
+    bool result = ::fsync(fd) == 0;
+    ::close(fd);
+    return result;
+  }
+
+  /// @return identifier of the first record of the file with the extension
+  boost::optional<Identifier> segmentId(const boost::filesystem::path &path,
+                                        const std::string &extension) {
+    if (path.extension().string() != extension) {
+      return boost::none;
+    }
+    return FlatFile::name_to_id(path.stem().string());
+  }
+}  // namespace
+
+const std::string SegmentFile::kSegmentExtension = ".seg";
+const std::string SegmentFile::kArchivedExtension = ".idx";
+const std::string SegmentFile::kCacheDirectory = "archive_cache";
+
+/// segment file with its read-only mapping
+struct SegmentFile::Segment {
+  /// path of the local file, which is in the cache for the archived one
+  std::string path;
+  /// descriptor, -1 for the archived segment which is not fetched
+  int fd;
+  /// size of the written records
+  uint64_t size;
+  const uint8_t *mapping;
+  uint64_t mapped_size;
+  /// identifier of the last record
+  Identifier last_id;
+  bool archived;
+
+  Segment(std::string path, int fd, uint64_t size)
+      : path(std::move(path)),
+        fd(fd),
+        size(size),
+        mapping(nullptr),
+        mapped_size(0),
+        last_id(0),
+        archived(false) {}
+
+  /// map the records written so far
+  bool remap() {
+    unmap();
+    if (size == 0) {
+      return true;
+    }
+    auto address = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED) {
+      return false;
+    }
+    mapping = static_cast<const uint8_t *>(address);
+    mapped_size = size;
+    return true;
+  }
+
+  void unmap() {
+    if (mapping != nullptr) {
+      ::munmap(const_cast<uint8_t *>(mapping), mapped_size);
+      mapping = nullptr;
+      mapped_size = 0;
+    }
+  }
+
+  void close() {
+    unmap();
+    if (fd >= 0) {
+      ::close(fd);
+      fd = -1;
+    }
+  }
+
+  ~Segment() {
+    close();
+  }
+};
+
+// ----------| public API |----------
+
+constexpr uint64_t SegmentFile::kDefaultSegmentSize;
+
+boost::optional<std::unique_ptr<SegmentFile>> SegmentFile::create(
+    const std::string &path,
+    logger::LoggerPtr log,
+    uint64_t segment_size,
+    boost::optional<Archive> archive) {
+  boost::system::error_code err;
+  if (not boost::filesystem::is_directory(path, err)
+      and not boost::filesystem::create_directory(path, err)) {
+    log->error("Cannot create storage dir: {}\n{}", path, err.message());
+    return boost::none;
+  }
+  if (archive) {
+    if (not boost::filesystem::is_directory(archive->path, err)
+        and not boost::filesystem::create_directories(archive->path, err)) {
+      log->error(
+          "Cannot create archive dir: {}\n{}", archive->path, err.message());
+      return boost::none;
+    }
+    // the segments fetched by the previous run are fetched again if read
+    boost::filesystem::remove_all(
+        boost::filesystem::path{path} / kCacheDirectory, err);
+  }
+
+  // segments are ordered by the identifiers of their first records
+  std::map<Identifier, std::string> segments_found;
+  std::map<Identifier, std::string> archived_found;
+  for (auto it = boost::filesystem::directory_iterator{path};
+       it != boost::filesystem::directory_iterator{};
+       ++it) {
+    if (auto id = segmentId(it->path(), kSegmentExtension)) {
+      segments_found.emplace(*id, it->path().filename().string());
+    } else if (auto id = segmentId(it->path(), kArchivedExtension)) {
+      archived_found.emplace(*id, it->path().filename().string());
+    } else if (not boost::filesystem::is_directory(it->path())) {
+      // the subdirectories are of the storages kept along with this one
+      log->warn("Skipping unknown file {} in storage dir",
+                it->path().string());
+    }
+  }
+
+  for (const auto &headers : archived_found) {
+    const auto headers_path = boost::filesystem::path{path} / headers.second;
+    if (segments_found.count(headers.first) != 0) {
+      // the archiving was interrupted before removing the local segment
+      boost::filesystem::remove(headers_path, err);
+    } else if (not archive) {
+      log->error("Segment {} is archived, but the archive is not configured",
+                 headers_path.string());
+      return boost::none;
+    } else {
+      segments_found.emplace(headers.first, headers.second);
+    }
+  }
+
+  auto storage = std::make_unique<SegmentFile>(
+      path, segment_size, std::move(archive), private_tag{}, std::move(log));
+  for (const auto &segment : segments_found) {
+    const bool archived =
+        boost::filesystem::path{segment.second}.extension().string()
+        == kArchivedExtension;
+    if (not(archived ? storage->openArchivedSegment(segment.second)
+                     : storage->openSegment(segment.second))) {
+      return boost::none;
+    }
+  }
+  return boost::make_optional(std::move(storage));
+}
+
+bool SegmentFile::add(Identifier id, const Bytes &blob) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (not index_.empty() and id <= index_.back().id) {
+    log_->warn("insertion for {} failed, because the last stored id is {}",
+               id,
+               index_.back().id);
+    return false;
+  }
+
+  const uint64_t record_size = kHeaderSize + blob.size();
+  if (segments_.empty()
+      or (segments_.back()->size > 0
+          and segments_.back()->size + record_size > segment_size_)) {
+    if (not startSegment(id)) {
+      return false;
+    }
+  }
+
+  auto &segment = *segments_.back();
+  uint8_t header[kHeaderSize];
+  const uint32_t size = blob.size();
+  std::memcpy(header, &id, sizeof(id));
+  std::memcpy(header + sizeof(id), &size, sizeof(size));
+  if (not writeAll(segment.fd, header, kHeaderSize, segment.size)
+      or not writeAll(segment.fd,
+                      blob.data(),
+                      blob.size(),
+                      segment.size + kHeaderSize)) {
+    log_->warn("Cannot write record {} to {}: {}",
+               id,
+               segment.path,
+               std::strerror(errno));
+    // the partial record is overwritten by the next one
+    return false;
+  }
+
+  const uint32_t segment_number = segments_.size() - 1;
+  index_.push_back(Location{id, segment_number, segment.size, size});
+  segment.size += record_size;
+  segment.last_id = id;
+  unflushed_segments_.insert(segment_number);
+  return true;
+}
+
+boost::optional<SegmentFile::Bytes> SegmentFile::get(Identifier id) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto location = find(id);
+  if (location == nullptr) {
+    log_->info("get({}) record not found", id);
+    return boost::none;
+  }
+  return read(*location, 0, location->size);
+}
+
+boost::optional<SegmentFile::Bytes> SegmentFile::get(Identifier id,
+                                                     uint64_t offset,
+                                                     uint64_t size) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto location = find(id);
+  if (location == nullptr) {
+    log_->info("get({}) record not found", id);
+    return boost::none;
+  }
+  if (offset > location->size or size > location->size - offset) {
+    log_->warn("get({}) range {}+{} is out of the record of size {}",
+               id,
+               offset,
+               size,
+               location->size);
+    return boost::none;
+  }
+  return read(*location, offset, size);
+}
+
+std::string SegmentFile::directory() const {
+  return dump_dir_;
+}
+
+Identifier SegmentFile::last_id() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return index_.empty() ? 0 : index_.back().id;
+}
+
+void SegmentFile::dropAll() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto &segment : segments_) {
+    boost::system::error_code err;
+    if (segment->archived
+        and not boost::filesystem::remove(archivePath(*segment), err)
+        and err) {
+      log_->warn("Cannot remove archived {}: {}",
+                 archivePath(*segment),
+                 err.message());
+    }
+  }
+  closeSegments();
+  iroha::remove_dir_contents(dump_dir_, log_);
+}
+
+bool SegmentFile::flush() {
+  bool result = true;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto segment_number : unflushed_segments_) {
+      if (::fdatasync(segments_[segment_number]->fd) != 0) {
+        log_->error("Cannot sync {}: {}",
+                    segments_[segment_number]->path,
+                    std::strerror(errno));
+        result = false;
+      }
+    }
+    unflushed_segments_.clear();
+
+    // entries of the new segments are durable after the directory sync
+    if (directory_changed_) {
+      if (not syncDirectory(dump_dir_)) {
+        log_->error("Cannot sync {}: {}", dump_dir_, std::strerror(errno));
+        result = false;
+      }
+      directory_changed_ = false;
+    }
+  }
+
+  // only the durable segments are archived
+  if (archive_ and result) {
+    result = archiveSegments();
+  }
+  return result;
+}
+
+size_t SegmentFile::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return index_.size();
+}
+
+std::vector<Identifier> SegmentFile::identifiers() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<Identifier> result;
+  result.reserve(index_.size());
+  for (const auto &location : index_) {
+    result.push_back(location.id);
+  }
+  return result;
+}
+
+SegmentFile::SegmentFile(std::string path,
+                         uint64_t segment_size,
+                         boost::optional<Archive> archive,
+                         SegmentFile::private_tag,
+                         logger::LoggerPtr log)
+    : dump_dir_(std::move(path)),
+      segment_size_(segment_size),
+      archive_(std::move(archive)),
+      log_{std::move(log)} {}
+
+SegmentFile::~SegmentFile() {
+  flush();
+  closeSegments();
+}
+
+// ----------| private API |----------
+
+bool SegmentFile::openSegment(const std::string &name) {
+  const auto path = (boost::filesystem::path{dump_dir_} / name).string();
+  auto fd = ::open(path.c_str(), O_RDWR);
+  if (fd < 0) {
+    log_->error("Cannot open {}: {}", path, std::strerror(errno));
+    return false;
+  }
+  struct stat status;
+  if (::fstat(fd, &status) != 0) {
+    log_->error("Cannot stat {}: {}", path, std::strerror(errno));
+    ::close(fd);
+    return false;
+  }
+  auto segment = std::make_unique<Segment>(
+      path, fd, static_cast<uint64_t>(status.st_size));
+  if (not segment->remap()) {
+    log_->error("Cannot map {}: {}", path, std::strerror(errno));
+    return false;
+  }
+
+  // index the records up to the first incomplete or out of order one
+  const uint32_t segment_number = segments_.size();
+  uint64_t offset = 0;
+  while (offset + kHeaderSize <= segment->size) {
+    Identifier id;
+    uint32_t size;
+    std::memcpy(&id, segment->mapping + offset, sizeof(id));
+    std::memcpy(&size, segment->mapping + offset + sizeof(id), sizeof(size));
+    if (offset + kHeaderSize + size > segment->size
+        or (not index_.empty() and id <= index_.back().id)) {
+      break;
+    }
+    index_.push_back(Location{id, segment_number, offset, size});
+    offset += kHeaderSize + size;
+    segment->last_id = id;
+  }
+
+  if (offset != segment->size) {
+    log_->warn("Truncating {} bytes of incomplete record in {}",
+               segment->size - offset,
+               path);
+    if (::ftruncate(fd, offset) != 0) {
+      log_->error("Cannot truncate {}: {}", path, std::strerror(errno));
+      return false;
+    }
+    segment->size = offset;
+    if (not segment->remap()) {
+      log_->error("Cannot map {}: {}", path, std::strerror(errno));
+      return false;
+    }
+    unflushed_segments_.insert(segment_number);
+  }
+
+  segments_.push_back(std::move(segment));
+  return true;
+}
+
+bool SegmentFile::openArchivedSegment(const std::string &name) {
+  const auto path = (boost::filesystem::path{dump_dir_} / name).string();
+  auto headers = iroha::readFile(path);
+  if (auto error = iroha::expected::resultToOptionalError(headers)) {
+    log_->error("Cannot read {}: {}", path, *error);
+    return false;
+  }
+  const auto data =
+      *iroha::expected::resultToOptionalValue(std::move(headers));
+  if (data.size() % kHeaderSize != 0) {
+    log_->error("Headers of {} are incomplete", path);
+    return false;
+  }
+
+  auto segment = std::make_unique<Segment>(
+      (boost::filesystem::path{dump_dir_} / kCacheDirectory
+       / (boost::filesystem::path{name}.stem().string() + kSegmentExtension))
+          .string(),
+      -1,
+      0);
+  segment->archived = true;
+  const uint32_t segment_number = segments_.size();
+  for (size_t position = 0; position < data.size();
+       position += kHeaderSize) {
+    Identifier id;
+    uint32_t size;
+    std::memcpy(&id, data.data() + position, sizeof(id));
+    std::memcpy(&size, data.data() + position + sizeof(id), sizeof(size));
+    if (not index_.empty() and id <= index_.back().id) {
+      log_->error("Headers of {} are out of order", path);
+      return false;
+    }
+    index_.push_back(Location{id, segment_number, segment->size, size});
+    segment->size += kHeaderSize + size;
+    segment->last_id = id;
+  }
+
+  segments_.push_back(std::move(segment));
+  return true;
+}
+
+bool SegmentFile::archiveSegments() {
+  std::lock_guard<std::mutex> archive_lock(archive_mutex_);
+  std::vector<std::pair<uint32_t, std::string>> candidates;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (index_.empty()) {
+      return true;
+    }
+    const auto last_id = index_.back().id;
+    // the last segment is still written
+    for (uint32_t i = 0; i + 1 < segments_.size(); ++i) {
+      const auto &segment = *segments_[i];
+      if (not segment.archived and segment.size > 0
+          and last_id - segment.last_id >= archive_->local_records) {
+        candidates.emplace_back(i, segment.path);
+      }
+    }
+  }
+
+  bool result = true;
+  for (const auto &candidate : candidates) {
+    const auto file_name =
+        boost::filesystem::path{candidate.second}.filename();
+    const auto target =
+        (boost::filesystem::path{archive_->path} / file_name).string();
+    // the sealed segment is not written anymore, so it is copied unlocked
+    if (not copyFile(candidate.second, target)
+        or not syncDirectory(archive_->path)) {
+      log_->error("Cannot archive {} to {}: {}",
+                  candidate.second,
+                  target,
+                  std::strerror(errno));
+      result = false;
+      continue;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto segment_number = candidate.first;
+    if (segment_number >= segments_.size()
+        or segments_[segment_number]->path != candidate.second) {
+      // the storage is dropped meanwhile
+      continue;
+    }
+
+    auto range = std::equal_range(
+        index_.begin(),
+        index_.end(),
+        Location{0, segment_number, 0, 0},
+        [](const auto &a, const auto &b) { return a.segment < b.segment; });
+    std::vector<uint8_t> headers;
+    headers.reserve((range.second - range.first) * kHeaderSize);
+    for (auto it = range.first; it != range.second; ++it) {
+      auto id = reinterpret_cast<const uint8_t *>(&it->id);
+      auto size = reinterpret_cast<const uint8_t *>(&it->size);
+      headers.insert(headers.end(), id, id + sizeof(it->id));
+      headers.insert(headers.end(), size, size + sizeof(it->size));
+    }
+    const auto headers_path =
+        (boost::filesystem::path{dump_dir_}
+         / (file_name.stem().string() + kArchivedExtension))
+            .string();
+    // the local segment is removed after the headers are durable
+    if (not writeFile(headers_path, headers.data(), headers.size())
+        or not syncDirectory(dump_dir_)) {
+      log_->error("Cannot write {}: {}", headers_path, std::strerror(errno));
+      result = false;
+      continue;
+    }
+
+    auto &segment = *segments_[segment_number];
+    segment.close();
+    if (::unlink(segment.path.c_str()) != 0) {
+      log_->warn(
+          "Cannot remove {}: {}", segment.path, std::strerror(errno));
+    }
+    segment.path = (boost::filesystem::path{dump_dir_} / kCacheDirectory
+                    / file_name)
+                       .string();
+    segment.archived = true;
+    log_->info("Archived {} to {}", candidate.second, target);
+  }
+  return result;
+}
+
+bool SegmentFile::startSegment(Identifier id) {
+  const auto path = (boost::filesystem::path{dump_dir_}
+                     / (FlatFile::id_to_name(id) + kSegmentExtension))
+                        .string();
+  auto fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+  if (fd < 0) {
+    log_->error("Cannot create {}: {}", path, std::strerror(errno));
+    return false;
+  }
+  segments_.push_back(std::make_unique<Segment>(path, fd, 0));
+  directory_changed_ = true;
+  return true;
+}
+
+const SegmentFile::Location *SegmentFile::find(Identifier id) const {
+  auto it = std::lower_bound(
+      index_.begin(), index_.end(), id, [](const auto &location, auto id) {
+        return location.id < id;
+      });
+  if (it == index_.end() or it->id != id) {
+    return nullptr;
+  }
+  return &*it;
+}
+
+boost::optional<SegmentFile::Bytes> SegmentFile::read(
+    const Location &location, uint64_t offset, uint64_t size) const {
+  auto &segment = *segments_[location.segment];
+  if (segment.archived) {
+    if (segment.fd < 0 and not fetchSegment(location.segment)) {
+      return boost::none;
+    }
+    auto it = std::find(cached_segments_.begin(),
+                        cached_segments_.end(),
+                        location.segment);
+    cached_segments_.splice(cached_segments_.begin(), cached_segments_, it);
+  }
+  const uint64_t end = location.offset + kHeaderSize + location.size;
+  if (end > segment.mapped_size and not segment.remap()) {
+    log_->warn("get({}) cannot map {}: {}",
+               location.id,
+               segment.path,
+               std::strerror(errno));
+    return boost::none;
+  }
+
+  auto data = segment.mapping + location.offset + kHeaderSize + offset;
+  return Bytes(data, data + size);
+}
+
+bool SegmentFile::fetchSegment(uint32_t segment_number) const {
+  // the segment being read is kept even if the cache is disabled
+  while (not cached_segments_.empty()
+         and cached_segments_.size()
+             >= std::max<size_t>(archive_->cached_segments, 1)) {
+    auto &evicted = *segments_[cached_segments_.back()];
+    evicted.close();
+    ::unlink(evicted.path.c_str());
+    cached_segments_.pop_back();
+  }
+
+  auto &segment = *segments_[segment_number];
+  const auto source = archivePath(segment);
+  boost::system::error_code err;
+  boost::filesystem::create_directories(
+      boost::filesystem::path{segment.path}.parent_path(), err);
+  if (not copyFile(source, segment.path)) {
+    log_->error("Cannot fetch archived {}: {}", source, std::strerror(errno));
+    return false;
+  }
+  // the mapping beyond the end of a truncated copy would fail the reads
+  struct stat status;
+  segment.fd = ::open(segment.path.c_str(), O_RDONLY);
+  if (segment.fd < 0 or ::fstat(segment.fd, &status) != 0
+      or static_cast<uint64_t>(status.st_size) != segment.size) {
+    log_->error("Archived {} does not match its headers", source);
+    segment.close();
+    return false;
+  }
+  if (not segment.remap()) {
+    log_->error("Cannot map {}: {}", segment.path, std::strerror(errno));
+    segment.close();
+    return false;
+  }
+  cached_segments_.push_front(segment_number);
+  log_->info("Fetched archived {}", source);
+  return true;
+}
+
+std::string SegmentFile::archivePath(const Segment &segment) const {
+  return (boost::filesystem::path{archive_->path}
+          / boost::filesystem::path{segment.path}.filename())
+      .string();
+}
+
+void SegmentFile::closeSegments() {
+  cached_segments_.clear();
+  segments_.clear();
+  index_.clear();
+  unflushed_segments_.clear();
+  directory_changed_ = false;
+}
+
+bool iroha::ametsuchi::migrateFlatFile(const FlatFile &source,
+                                       SegmentFile &target,
+                                       const EntityConverter &convert,
+                                       const logger::LoggerPtr &log) {
+  for (auto id : source.blockIdentifiers()) {
+    auto blob = source.get(id);
+    if (not blob) {
+      log->error("Cannot read entity {} from {}", id, source.directory());
+      return false;
+    }
+    auto converted = convert(*blob);
+    if (not converted) {
+      log->error("Cannot convert entity {}", id);
+      return false;
+    }
+    if (not target.add(id, *converted)) {
+      log->error("Cannot write entity {} to {}", id, target.directory());
+      return false;
+    }
+  }
+  log->info("Migrated {} entities from {} to {}",
+            target.size(),
+            source.directory(),
+            target.directory());
+  return target.flush();
+}
@@ -0,0 +1,239 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SEGMENT_FILE_HPP
+#define IROHA_SEGMENT_FILE_HPP
+
+#include "ametsuchi/key_value_storage.hpp"
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    class FlatFile;
+
+    /**
+     * Solid storage which appends the entities to large segment files.
+     * Every record of a segment consists of the identifier and the size of
+     * the entity in host byte order, followed by its data. The offsets of
+     * the records are indexed in memory on creation, the records are read
+     * through memory mapping of the segments. Identifiers are added in
+     * increasing order.
+     *
+     * Optionally the sealed segments which hold only the records older than
+     * the most recent ones are moved to an archive directory, which may be a
+     * mount of an object store. The headers of their records are kept
+     * locally, so the index is restored without reading the archive. An
+     * archived segment is fetched into the local cache on its first read.
+     */
+    class SegmentFile : public KeyValueStorage {
+      /**
+       * Private tag used to construct unique and shared pointers
+       * without new operator
+       */
+      struct private_tag {};
+
+      struct Segment;
+
+     public:
+      /// new segment is started when the current one reaches this size
+      static constexpr uint64_t kDefaultSegmentSize = 64 * 1024 * 1024;
+
+      /// extension of the segment files
+      static const std::string kSegmentExtension;
+
+      /// extension of the local record headers of the archived segments
+      static const std::string kArchivedExtension;
+
+      /// subdirectory of the archived segments fetched for reading
+      static const std::string kCacheDirectory;
+
+      /// offload of the old segments to an archive
+      struct Archive {
+        /// directory of the archive
+        std::string path;
+        /// segments with the records within this number of the last one
+        /// are kept locally
+        uint32_t local_records;
+        /// number of the fetched archived segments kept in the cache
+        size_t cached_segments;
+      };
+
+      /**
+       * Create storage in path, restore the index of the existing segments
+       * and truncate the incomplete record written before a crash
+       * @param path - target path for creating
+       * @param log - logger
+       * @param segment_size - size which starts the next segment
+       * @param archive - offload of the old segments, none keeps them all
+       * locally
+       * @return created storage
+       */
+      static boost::optional<std::unique_ptr<SegmentFile>> create(
+          const std::string &path,
+          logger::LoggerPtr log,
+          uint64_t segment_size = kDefaultSegmentSize,
+          boost::optional<Archive> archive = boost::none);
+
+      bool add(Identifier id, const Bytes &blob) override;
+
+      boost::optional<Bytes> get(Identifier id) const override;
+
+      /**
+       * Get the part of the entity without reading the rest of it
+       * @param id - reference key
+       * @param offset - offset of the part in the entity
+       * @param size - size of the part
+       * @return the part, none if there is no such entity or it is shorter
+       */
+      boost::optional<Bytes> get(Identifier id,
+                                 uint64_t offset,
+                                 uint64_t size) const;
+
+      std::string directory() const override;
+
+      Identifier last_id() const override;
+
+      /// removes the archived segments of the storage as well
+      void dropAll() override;
+
+      /// syncs the written segments, then moves the old ones to the archive
+      bool flush() override;
+
+      /**
+       * @return number of stored entities
+       */
+      size_t size() const;
+
+      /**
+       * @return identifiers of the stored entities in increasing order
+       */
+      std::vector<Identifier> identifiers() const;
+
+      SegmentFile(const SegmentFile &rhs) = delete;
+
+      SegmentFile(SegmentFile &&rhs) = delete;
+
+      SegmentFile &operator=(const SegmentFile &rhs) = delete;
+
+      SegmentFile &operator=(SegmentFile &&rhs) = delete;
+
+      /**
+       * Create storage in path
+       * @param path - folder of storage
+       * @param segment_size - size which starts the next segment
+       * @param archive - offload of the old segments
+       * @param log to print progress
+       */
+      SegmentFile(std::string path,
+                  uint64_t segment_size,
+                  boost::optional<Archive> archive,
+                  SegmentFile::private_tag,
+                  logger::LoggerPtr log);
+
+      ~SegmentFile() override;
+
+     private:
+      /// position of a record in the segments
+      struct Location {
+        Identifier id;
+        uint32_t segment;
+        uint64_t offset;
+        uint32_t size;
+      };
+
+      /**
+       * Open the segment and index its records
+       * @return false if the segment can not be read
+       */
+      bool openSegment(const std::string &name);
+
+      /**
+       * Index the records of the archived segment by its local headers
+       * @return false if the headers can not be read
+       */
+      bool openArchivedSegment(const std::string &name);
+
+      /**
+       * Move the sealed segments older than the local records to the
+       * archive. The segments are copied without holding the lock, so the
+       * reads are not delayed by the archive.
+       * @return false if a segment can not be archived
+       */
+      bool archiveSegments();
+
+      /**
+       * Start the segment for the records beginning with the given one
+       */
+      bool startSegment(Identifier id);
+
+      /// @return the location of the record, nullptr if it is not found
+      const Location *find(Identifier id) const;
+
+      /// @return the part of the entity of the record, mapping it if needed
+      boost::optional<Bytes> read(const Location &location,
+                                  uint64_t offset,
+                                  uint64_t size) const;
+
+      /**
+       * Copy the archived segment to the cache and map it, evicting the
+       * least recently read segment if the cache is full
+       * @return false if the segment can not be fetched
+       */
+      bool fetchSegment(uint32_t segment_number) const;
+
+      /// @return path of the segment in the archive
+      std::string archivePath(const Segment &segment) const;
+
+      void closeSegments();
+
+      const std::string dump_dir_;
+      const uint64_t segment_size_;
+      const boost::optional<Archive> archive_;
+
+      mutable std::mutex mutex_;
+      /// serializes the archiving, which is done without holding mutex_
+      std::mutex archive_mutex_;
+      std::vector<std::unique_ptr<Segment>> segments_;
+      /// locations sorted by identifiers
+      std::vector<Location> index_;
+      /// segments written since the last flush
+      std::set<uint32_t> unflushed_segments_;
+      bool directory_changed_{false};
+      /// fetched archived segments, the most recently read first
+      mutable std::list<uint32_t> cached_segments_;
+
+      logger::LoggerPtr log_;
+    };
+
+    /// conversion of an entity to the format of the target storage
+    using EntityConverter = std::function<boost::optional<
+        KeyValueStorage::Bytes>(const KeyValueStorage::Bytes &)>;
+
+    /**
+     * Copy all entities of the flat file storage to the segment storage
+     * @param source - storage in the layout of one file per entity
+     * @param target - empty storage to fill
+     * @param convert - conversion of the entities, none fails the migration
+     * @param log - logger of the progress
+     * @return true if all entities are copied and flushed
+     */
+    bool migrateFlatFile(const FlatFile &source,
+                         SegmentFile &target,
+                         const EntityConverter &convert,
+                         const logger::LoggerPtr &log);
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_SEGMENT_FILE_HPP
@@ -0,0 +1,135 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/segment_file_block_storage.hpp"
+
+#include <boost/filesystem.hpp>
+#include "ametsuchi/impl/block_tx_index.hpp"
+#include "backend/protobuf/block.hpp"
+#include "backend/protobuf/transaction.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha::ametsuchi;
+
+SegmentFileBlockStorage::SegmentFileBlockStorage(
+    std::unique_ptr<SegmentFile> segment_file,
+    std::shared_ptr<BlockTransportFactory> block_factory,
+    logger::LoggerPtr log,
+    std::unique_ptr<SegmentFile> tx_index)
+    : segment_file_storage_(std::move(segment_file)),
+      block_factory_(std::move(block_factory)),
+      log_(std::move(log)),
+      tx_index_(std::move(tx_index)) {}
+
+bool SegmentFileBlockStorage::insert(
+    std::shared_ptr<const shared_model::interface::Block> block) {
+  const auto &blob = block->blob().blob();
+  if (not segment_file_storage_->add(block->height(), blob)) {
+    return false;
+  }
+  if (tx_index_) {
+    // the transactions of the blocks without the index record are read from
+    // the whole blocks, so the failure to index is not fatal
+    auto locations = block_tx_index::locate(blob.data(), blob.size());
+    if (not locations
+        or not tx_index_->add(block->height(),
+                              block_tx_index::encode(*locations))) {
+      log_->warn("Could not index transactions of block {}", block->height());
+    }
+  }
+  return true;
+}
+
+boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+SegmentFileBlockStorage::fetch(
+    shared_model::interface::types::HeightType height) const {
+  auto storage_block = segment_file_storage_->get(height);
+  if (not storage_block) {
+    return boost::none;
+  }
+
+  return block_factory_
+      ->createBlock(storage_block->data(), storage_block->size())
+      .match(
+          [&](auto &&v) {
+            return boost::make_optional(
+                std::shared_ptr<const shared_model::interface::Block>(
+                    std::move(v.value)));
+          },
+          [&](const auto &e)
+              -> boost::optional<
+                  std::shared_ptr<const shared_model::interface::Block>> {
+            log_->warn(
+                "Could not build block at height {}: {}", height, e.error);
+            return boost::none;
+          });
+}
+
+boost::optional<std::string> SegmentFileBlockStorage::fetchSerialized(
+    shared_model::interface::types::HeightType height) const {
+  return segment_file_storage_->get(height) | [](const auto &bytes) {
+    return boost::make_optional(std::string(bytes.begin(), bytes.end()));
+  };
+}
+
+boost::optional<std::unique_ptr<shared_model::interface::Transaction>>
+SegmentFileBlockStorage::fetchTransaction(
+    shared_model::interface::types::HeightType height, size_t index) const {
+  boost::optional<block_tx_index::Location> location;
+  if (tx_index_) {
+    location = tx_index_->get(height) | [index](const auto &record) {
+      return block_tx_index::find(record, index);
+    };
+  }
+  if (not location) {
+    return BlockStorage::fetchTransaction(height, index);
+  }
+
+  auto storage_tx =
+      segment_file_storage_->get(height, location->offset, location->size);
+  iroha::protocol::Transaction transaction;
+  if (not storage_tx
+      or not transaction.ParseFromArray(storage_tx->data(),
+                                        storage_tx->size())) {
+    log_->warn(
+        "Error while transaction {} of block {} parsing", index, height);
+    return boost::none;
+  }
+  return boost::make_optional<
+      std::unique_ptr<shared_model::interface::Transaction>>(
+      std::make_unique<shared_model::proto::Transaction>(
+          std::move(transaction)));
+}
+
+size_t SegmentFileBlockStorage::size() const {
+  return segment_file_storage_->size();
+}
+
+void SegmentFileBlockStorage::clear() {
+  if (tx_index_) {
+    tx_index_->dropAll();
+  }
+  segment_file_storage_->dropAll();
+  if (tx_index_) {
+    // the index may be kept in a subdirectory of the blocks
+    boost::system::error_code err;
+    boost::filesystem::create_directories(tx_index_->directory(), err);
+  }
+}
+
+void SegmentFileBlockStorage::forEach(
+    iroha::ametsuchi::BlockStorage::FunctionType function) const {
+  for (auto block_id : segment_file_storage_->identifiers()) {
+    auto block = fetch(block_id);
+    BOOST_ASSERT(block);
+    function(*block);
+  }
+}
+
+bool SegmentFileBlockStorage::flush() {
+  // the index is flushed regardless of the blocks
+  bool tx_index_flushed = not tx_index_ or tx_index_->flush();
+  return segment_file_storage_->flush() and tx_index_flushed;
+}
@@ -0,0 +1,70 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SEGMENT_FILE_BLOCK_STORAGE_HPP
+#define IROHA_SEGMENT_FILE_BLOCK_STORAGE_HPP
+
+#include "ametsuchi/block_storage.hpp"
+
+#include "ametsuchi/impl/segment_file/segment_file.hpp"
+#include "backend/protobuf/proto_block_factory.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+    /**
+     * Block storage which appends the blocks in protobuf binary form to the
+     * segment files. The locations of the transactions inside the blocks may
+     * be indexed in separate segment files, so single transactions are read
+     * without the rest of their blocks
+     */
+    class SegmentFileBlockStorage : public BlockStorage {
+     public:
+      using BlockTransportFactory = shared_model::proto::ProtoBlockFactory;
+
+      /**
+       * @param segment_file - storage of the blocks
+       * @param block_factory - factory of the fetched blocks
+       * @param log - logger
+       * @param tx_index - storage of the transaction locations of the
+       * blocks, nullptr if the transactions are read from the whole blocks
+       */
+      SegmentFileBlockStorage(
+          std::unique_ptr<SegmentFile> segment_file,
+          std::shared_ptr<BlockTransportFactory> block_factory,
+          logger::LoggerPtr log,
+          std::unique_ptr<SegmentFile> tx_index = nullptr);
+
+      bool insert(
+          std::shared_ptr<const shared_model::interface::Block> block) override;
+
+      boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+      fetch(shared_model::interface::types::HeightType height) const override;
+
+      boost::optional<std::string> fetchSerialized(
+          shared_model::interface::types::HeightType height) const override;
+
+      boost::optional<std::unique_ptr<shared_model::interface::Transaction>>
+      fetchTransaction(shared_model::interface::types::HeightType height,
+                       size_t index) const override;
+
+      size_t size() const override;
+
+      void clear() override;
+
+      void forEach(FunctionType function) const override;
+
+      bool flush() override;
+
+     private:
+      std::unique_ptr<SegmentFile> segment_file_storage_;
+      std::shared_ptr<BlockTransportFactory> block_factory_;
+      logger::LoggerPtr log_;
+      std::unique_ptr<SegmentFile> tx_index_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_SEGMENT_FILE_BLOCK_STORAGE_HPP
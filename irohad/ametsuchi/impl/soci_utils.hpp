@@ -6,6 +6,9 @@
 #ifndef IROHA_POSTGRES_WSV_COMMON_HPP
 #define IROHA_POSTGRES_WSV_COMMON_HPP
 
+#include <string>
+#include <vector>
+
 #include <soci/soci.h>
 #include <boost/optional.hpp>
 #include <boost/range/adaptor/filtered.hpp>
@@ -17,6 +20,41 @@
 namespace iroha {
   namespace ametsuchi {
 
+    /**
+     * Make a literal of PostgreSQL array, which is bound as a string and is
+     * cast to an array type in the statement
+     * @param values - elements of the array
+     * @return literal with the elements quoted
+     */
+    inline std::string makePgArray(const std::vector<std::string> &values) {
+      std::string array = "{";
+      for (const auto &value : values) {
+        if (array.size() > 1) {
+          array += ',';
+        }
+        array += '"';
+        for (auto c : value) {
+          if (c == '"' or c == '\\') {
+            array += '\\';
+          }
+          array += c;
+        }
+        array += '"';
+      }
+      return array + '}';
+    }
+
+    /**
+     * Make a literal of PostgreSQL bytea in the hex format, which is bound as
+     * a string and is cast to bytea in the statement, alone or as an element
+     * of makePgArray. The server stores and compares the binary value
+     * @param hex - value in hex
+     * @return literal of the value
+     */
+    inline std::string makePgBytea(const std::string &hex) {
+      return "\\x" + hex;
+    }
+
     template <typename ParamType, typename Function>
     inline void processSoci(soci::statement &st,
                             soci::indicator &ind,
@@ -0,0 +1,64 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/statement_metrics.hpp"
+
+#include "logger/logger.hpp"
+
+namespace {
+  /// from 100 us to about 3 s
+  const size_t kTimeBuckets = 16;
+  const uint64_t kFirstTimeBound = 100;
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    StatementMetrics::StatementMetrics(std::chrono::milliseconds slow_threshold,
+                                       logger::LoggerPtr log)
+        : slow_threshold_(slow_threshold), log_(std::move(log)) {}
+
+    void StatementMetrics::record(const char *kind,
+                                  const std::string &name,
+                                  Clock::duration elapsed,
+                                  uint64_t rows) {
+      const auto microseconds =
+          std::chrono::duration_cast<std::chrono::microseconds>(elapsed)
+              .count();
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto &statement = statements_[std::make_pair(kind, name)];
+        if (not statement.time) {
+          statement.time = std::make_shared<Histogram>(
+              Histogram::exponentialBounds(kFirstTimeBound, 2, kTimeBuckets));
+        }
+        statement.time->observe(microseconds);
+        statement.rows.increment(rows);
+      }
+      if (slow_threshold_ != Clock::duration::zero()
+          and elapsed >= slow_threshold_) {
+        log_->warn("slow {} statement {}: {} us, {} rows",
+                   kind,
+                   name,
+                   microseconds,
+                   rows);
+      }
+    }
+
+    std::vector<StatementMetrics::Sample> StatementMetrics::samples() const {
+      std::vector<Sample> samples;
+      std::lock_guard<std::mutex> lock(mutex_);
+      samples.reserve(statements_.size());
+      for (const auto &statement : statements_) {
+        samples.push_back(Sample{statement.first.first,
+                                 statement.first.second,
+                                 statement.second.time,
+                                 statement.second.rows.value()});
+      }
+      return samples;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
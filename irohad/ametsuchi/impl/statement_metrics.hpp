@@ -0,0 +1,85 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_STATEMENT_METRICS_HPP
+#define IROHA_STATEMENT_METRICS_HPP
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/counter.hpp"
+#include "common/histogram.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Execution time and rows of the database statements by their kind
+     * (command, query, index, wsv) and name, e.g. the type of the command.
+     * The statements which take longer than the threshold are logged. The
+     * statistics of a statement are created on its first execution, the
+     * recording may be done from any thread
+     */
+    class StatementMetrics {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      /// statistics of a statement
+      struct Sample {
+        std::string kind;
+        std::string name;
+        /// execution time in microseconds
+        std::shared_ptr<const Histogram> time;
+        /// rows returned or written by the statement, if it reports them
+        uint64_t rows;
+      };
+
+      /**
+       * @param slow_threshold - execution time from which the statement is
+       * logged, zero disables the log
+       * @param log - logger of the slow statements
+       */
+      StatementMetrics(std::chrono::milliseconds slow_threshold,
+                       logger::LoggerPtr log);
+
+      /**
+       * Record the execution of a statement
+       * @param kind - component which executes the statement
+       * @param name - name of the statement in the component
+       * @param elapsed - execution time
+       * @param rows - rows returned or written by the statement
+       */
+      void record(const char *kind,
+                  const std::string &name,
+                  Clock::duration elapsed,
+                  uint64_t rows = 0);
+
+      /// @return statistics of the executed statements ordered by kind and
+      /// name
+      std::vector<Sample> samples() const;
+
+     private:
+      struct Statement {
+        std::shared_ptr<Histogram> time;
+        Counter rows;
+      };
+
+      const Clock::duration slow_threshold_;
+      logger::LoggerPtr log_;
+
+      mutable std::mutex mutex_;
+      std::map<std::pair<std::string, std::string>, Statement> statements_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_STATEMENT_METRICS_HPP
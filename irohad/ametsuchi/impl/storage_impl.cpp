@@ -5,6 +5,7 @@
 
 #include "ametsuchi/impl/storage_impl.hpp"
 
+#include <algorithm>
 #include <utility>
 
 #include <soci/callbacks.h>
@@ -12,6 +13,7 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
 #include <boost/range/algorithm/replace_if.hpp>
+#include "ametsuchi/impl/ledger_state_peer_query.hpp"
 #include "ametsuchi/impl/mutable_storage_impl.hpp"
 #include "ametsuchi/impl/peer_query_wsv.hpp"
 #include "ametsuchi/impl/postgres_block_index.hpp"
@@ -24,15 +26,19 @@
 #include "ametsuchi/impl/postgres_specific_query_executor.hpp"
 #include "ametsuchi/impl/postgres_wsv_command.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/postgres_wsv_snapshot.hpp"
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
 #include "ametsuchi/tx_executor.hpp"
 #include "backend/protobuf/permissions.hpp"
 #include "common/bind.hpp"
 #include "common/byteutils.hpp"
 #include "cryptography/public_key.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
 #include "main/impl/pg_connection_init.hpp"
+#include "maintenance/tracing.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -40,6 +46,8 @@ namespace iroha {
     const char *kCommandExecutorError = "Cannot create CommandExecutorFactory";
     const char *kPsqlBroken = "Connection to PostgreSQL broken: %s";
     const char *kTmpWsv = "TemporaryWsv";
+    /// accounts whose numbers of the assets are cached for a height
+    const size_t kAssetsCountCacheCapacity = 10000;
 
     StorageImpl::StorageImpl(
         boost::optional<std::shared_ptr<const iroha::LedgerState>> ledger_state,
@@ -52,26 +60,49 @@ namespace iroha {
         std::shared_ptr<shared_model::interface::QueryResponseFactory>
             query_response_factory,
         std::unique_ptr<BlockStorageFactory> temporary_block_storage_factory,
+        std::shared_ptr<WsvCache> wsv_cache,
+        bool async_history_index,
         size_t pool_size,
+        size_t block_sync_interval,
+        std::shared_ptr<StatementMetrics> statement_metrics,
         logger::LoggerManagerTreePtr log_manager)
         : postgres_options_(std::move(postgres_options)),
           block_store_(std::move(block_store)),
           pool_wrapper_(std::move(pool_wrapper)),
           connection_(pool_wrapper_->connection_pool_),
+          query_connection_(pool_wrapper_->lane(PoolWrapper::Lane::kQuery)),
+          restore_connection_(
+              pool_wrapper_->lane(PoolWrapper::Lane::kRestore)),
           notifier_(notifier_lifetime_),
           perm_converter_(std::move(perm_converter)),
           pending_txs_storage_(std::move(pending_txs_storage)),
           query_response_factory_(std::move(query_response_factory)),
           temporary_block_storage_factory_(
               std::move(temporary_block_storage_factory)),
+          wsv_cache_(std::move(wsv_cache)),
+          statement_metrics_(std::move(statement_metrics)),
+          assets_count_cache_(std::make_shared<AccountAssetsCountCache>(
+              kAssetsCountCacheCapacity)),
           log_manager_(std::move(log_manager)),
           log_(log_manager_->getLogger()),
           pool_size_(pool_size),
+          block_sync_interval_(std::max<size_t>(block_sync_interval, 1)),
           prepared_blocks_enabled_(
               pool_wrapper_->enable_prepared_transactions_),
           block_is_prepared_(false),
           prepared_block_name_(postgres_options_->preparedBlockName()),
-          ledger_state_(std::move(ledger_state)) {}
+          ledger_state_(std::move(ledger_state)) {
+      if (ledger_state_) {
+        std::atomic_store(&published_ledger_state_, ledger_state_.value());
+      }
+      if (async_history_index) {
+        history_indexer_ = std::make_unique<PostgresHistoryIndexer>(
+            restore_connection_,
+            drop_mutex_,
+            *block_store_,
+            log_manager_->getChild("HistoryIndexer")->getLogger());
+      }
+    }
 
     std::unique_ptr<TemporaryWsv> StorageImpl::createTemporaryWsv(
         std::shared_ptr<CommandExecutor> command_executor) {
@@ -86,6 +117,7 @@ namespace iroha {
       tryRollback(postgres_command_executor->getSession());
       return std::make_unique<TemporaryWsvImpl>(
           std::move(postgres_command_executor),
+          wsv_cache_,
           log_manager_->getChild("TemporaryWorldStateView"));
     }
 
@@ -97,6 +129,10 @@ namespace iroha {
 
     boost::optional<std::shared_ptr<PeerQuery>> StorageImpl::createPeerQuery()
         const {
+      if (auto ledger_state = std::atomic_load(&published_ledger_state_)) {
+        return boost::make_optional<std::shared_ptr<PeerQuery>>(
+            std::make_shared<LedgerStatePeerQuery>(std::move(ledger_state)));
+      }
       auto wsv = getWsvQuery();
       if (not wsv) {
         return boost::none;
@@ -120,12 +156,12 @@ namespace iroha {
         std::shared_ptr<shared_model::interface::QueryResponseFactory>
             response_factory) const {
       std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
-      if (not connection_) {
+      if (not query_connection_) {
         log_->info(
             "createQueryExecutor: connection to database is not initialised");
         return boost::none;
       }
-      auto sql = std::make_unique<soci::session>(*connection_);
+      auto sql = std::make_unique<soci::session>(queryPool());
       auto log_manager = log_manager_->getChild("QueryExecutor");
       return boost::make_optional<std::shared_ptr<QueryExecutor>>(
           std::make_shared<PostgresQueryExecutor>(
@@ -137,10 +173,39 @@ namespace iroha {
                   std::move(pending_txs_storage),
                   response_factory,
                   perm_converter_,
-                  log_manager->getChild("SpecificQueryExecutor")->getLogger()),
+                  log_manager->getChild("SpecificQueryExecutor")->getLogger(),
+                  statement_metrics_,
+                  assets_count_cache_),
               log_manager->getLogger()));
     }
 
+    soci::connection_pool &StorageImpl::queryPool() const {
+      const auto &replicas = pool_wrapper_->replica_pools_;
+      if (replicas.empty() or not ledger_state_) {
+        return *query_connection_;
+      }
+      const auto top_height = ledger_state_.value()->top_block_info.height;
+      const auto first = next_replica_++;
+      for (size_t i = 0; i < replicas.size(); ++i) {
+        auto &replica = replicas[(first + i) % replicas.size()];
+        try {
+          soci::session sql(*replica);
+          long long height = 0;
+          sql << "SELECT height FROM top_block_info", soci::into(height);
+          if (sql.got_data()
+              and static_cast<uint64_t>(height)
+                      + postgres_options_->replicaMaxLag()
+                  >= top_height) {
+            return *replica;
+          }
+          log_->debug("replica is at height {} of {}", height, top_height);
+        } catch (const std::exception &e) {
+          log_->warn("failed to read the height of a replica: {}", e.what());
+        }
+      }
+      return *query_connection_;
+    }
+
     bool StorageImpl::insertBlock(
         std::shared_ptr<const shared_model::interface::Block> block) {
       log_->info("create mutable storage");
@@ -174,8 +239,8 @@ namespace iroha {
         return expected::makeError("Connection was closed");
       }
       auto sql = std::make_unique<soci::session>(*connection_);
-      return std::make_unique<PostgresCommandExecutor>(std::move(sql),
-                                                       perm_converter_);
+      return std::make_unique<PostgresCommandExecutor>(
+          std::move(sql), perm_converter_, statement_metrics_);
     }
 
     std::unique_ptr<MutableStorage> StorageImpl::createMutableStorage(
@@ -194,7 +259,9 @@ namespace iroha {
           ledger_state_,
           std::move(postgres_command_executor),
           storage_factory.create(),
-          log_manager_->getChild("MutableStorageImpl"));
+          log_manager_->getChild("MutableStorageImpl"),
+          not history_indexer_,
+          statement_metrics_);
     }
 
     void StorageImpl::reset() {
@@ -214,14 +281,49 @@ namespace iroha {
         soci::session sql(*connection_);
         // rollback possible prepared transaction
         tryRollback(sql);
+        if (wsv_cache_) {
+          wsv_cache_->clear();
+        }
+        std::atomic_store(&published_ledger_state_, {});
         return PgConnectionInit::resetWsv(sql);
       } catch (std::exception &e) {
         return expected::makeError(e.what());
       }
     }
 
+    CommitResult StorageImpl::restoreWsvSnapshot(const WsvSnapshot &snapshot) {
+      std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
+      if (not restore_connection_) {
+        return expected::makeError(
+            "restoreWsvSnapshot: connection to database is not initialised");
+      }
+      soci::session sql(*restore_connection_);
+      if (wsv_cache_) {
+        wsv_cache_->clear();
+      }
+      auto restored =
+          PostgresWsvSnapshot(
+              sql, log_manager_->getChild("WsvSnapshot")->getLogger())
+              .restoreSnapshot(snapshot);
+      if (auto error = expected::resultToOptionalError(restored)) {
+        return expected::makeError(std::move(*error));
+      }
+
+      auto peers = PostgresWsvQuery(
+                       sql, log_manager_->getChild("WsvQuery")->getLogger())
+                       .getPeers();
+      if (not peers) {
+        return expected::makeError(
+            "Failed to get ledger peers of the WSV snapshot");
+      }
+      setLedgerState(std::make_shared<const LedgerState>(
+          std::move(*peers), snapshot.height, snapshot.block_hash));
+      return expected::makeValue(ledger_state_.value());
+    }
+
     void StorageImpl::resetPeers() {
       log_->info("Remove everything from peers table");
+      std::atomic_store(&published_ledger_state_, {});
       soci::session sql(*connection_);
       expected::resultToOptionalError(PgConnectionInit::resetPeers(sql)) |
           [this](const auto &e) { this->log_->error("{}", e); };
@@ -241,6 +343,10 @@ namespace iroha {
       block_store_->clear();
 
       freeConnections();
+      if (wsv_cache_) {
+        wsv_cache_->clear();
+      }
+      std::atomic_store(&published_ledger_state_, {});
       log_->info("Drop database {}", postgres_options_->workingDbName());
       if (auto e = expected::resultToOptionalError(
               PgConnectionInit::dropWorkingDatabase(*postgres_options_))) {
@@ -248,6 +354,12 @@ namespace iroha {
       }
     }
 
+    void StorageImpl::setLedgerState(
+        std::shared_ptr<const LedgerState> ledger_state) {
+      ledger_state_ = ledger_state;
+      std::atomic_store(&published_ledger_state_, std::move(ledger_state));
+    }
+
     void StorageImpl::freeConnections() {
       if (connection_ == nullptr) {
         log_->warn("Tried to free connections without active connection");
@@ -258,14 +370,30 @@ namespace iroha {
         soci::session sql(*connection_);
         tryRollback(sql);
       }
-      std::vector<std::shared_ptr<soci::session>> sessions;
-      for (size_t i = 0; i < pool_size_; i++) {
-        sessions.push_back(std::make_shared<soci::session>(*connection_));
-        sessions.at(i)->close();
-        log_->debug("Closed connection {}", i);
+      auto close_connections = [this](soci::connection_pool &pool,
+                                      size_t pool_size) {
+        std::vector<std::shared_ptr<soci::session>> sessions;
+        for (size_t i = 0; i < pool_size; i++) {
+          sessions.push_back(std::make_shared<soci::session>(pool));
+          sessions.at(i)->close();
+          log_->debug("Closed connection {}", i);
+        }
+      };
+      close_connections(*connection_, pool_size_);
+      if (pool_wrapper_->query_pool_size_ != 0) {
+        close_connections(*query_connection_, pool_wrapper_->query_pool_size_);
+      }
+      if (pool_wrapper_->restore_pool_size_ != 0) {
+        close_connections(*restore_connection_,
+                          pool_wrapper_->restore_pool_size_);
       }
-      sessions.clear();
+      for (auto &replica : pool_wrapper_->replica_pools_) {
+        close_connections(*replica, pool_wrapper_->replica_pool_size_);
+      }
+      pool_wrapper_->replica_pools_.clear();
       connection_.reset();
+      query_connection_.reset();
+      restore_connection_.reset();
     }
 
     expected::Result<std::shared_ptr<StorageImpl>, std::string>
@@ -280,7 +408,25 @@ namespace iroha {
         std::unique_ptr<BlockStorageFactory> temporary_block_storage_factory,
         std::unique_ptr<BlockStorage> persistent_block_storage,
         logger::LoggerManagerTreePtr log_manager,
-        size_t pool_size) {
+        std::shared_ptr<WsvCache> wsv_cache,
+        bool async_history_index,
+        size_t pool_size,
+        size_t block_sync_interval,
+        std::shared_ptr<StatementMetrics> statement_metrics) {
+      if (not async_history_index) {
+        // the history left behind by the background indexer of the previous
+        // run is completed before the blocks are indexed on commit again
+        soci::session sql{*pool_wrapper->connection_pool_};
+        auto indexed = PostgresHistoryIndexer::indexBlocks(
+            sql,
+            *persistent_block_storage,
+            persistent_block_storage->size(),
+            log_manager->getChild("HistoryIndexer")->getLogger());
+        if (auto error = expected::resultToOptionalError(indexed)) {
+          return expected::makeError(std::move(*error));
+        }
+      }
+
       auto opt_ledger_state = [&] {
         soci::session sql{*pool_wrapper->connection_pool_};
 
@@ -292,11 +438,11 @@ namespace iroha {
               *persistent_block_storage,
               log_manager->getChild("PostgresBlockQuery")->getLogger());
           const auto ledger_height = block_query.getTopBlockHeight();
-          return block_query.getBlock(ledger_height)
+          return block_query.getBlockHeader(ledger_height)
               .match(
-                  [&ledger_height](const auto &block) -> BlockInfoResult {
+                  [&ledger_height](const auto &header) -> BlockInfoResult {
                     return expected::makeValue(iroha::TopBlockInfo{
-                        ledger_height, block.value->hash()});
+                        ledger_height, header.value.hash});
                   },
                   [](auto &&err) -> BlockInfoResult {
                     return std::move(err).error.message;
@@ -345,15 +491,35 @@ namespace iroha {
                           std::move(pending_txs_storage),
                           std::move(query_response_factory),
                           std::move(temporary_block_storage_factory),
+                          std::move(wsv_cache),
+                          async_history_index,
                           pool_size,
+                          block_sync_interval,
+                          std::move(statement_metrics),
                           std::move(log_manager))));
     }
 
     CommitResult StorageImpl::commit(
         std::unique_ptr<MutableStorage> mutable_storage) {
       auto storage = static_cast<MutableStorageImpl *>(mutable_storage.get());
+      tracing::ScopedSpan span("storage.commit");
+
+      // the blocks are written before the database commit, so the WSV,
+      // which is restored from the blocks on startup, is never ahead of them
+      size_t inserted = 0;
+      storage->block_storage_->forEach([this, &inserted](const auto &block) {
+        if (auto error =
+                expected::resultToOptionalError(this->storeBlock(block))) {
+          log_->error("block {}: {}", block->height(), *error);
+        }
+        ++inserted;
+      });
+      syncBlocks(inserted);
 
       try {
+        // the blocks are the durable copy of the ledger, so the commit does
+        // not wait for the write-ahead log of the WSV to be flushed
+        storage->sql_ << "SET LOCAL synchronous_commit TO OFF";
         storage->sql_ << "COMMIT";
       } catch (std::exception &e) {
         storage->committed = false;
@@ -361,11 +527,25 @@ namespace iroha {
       }
       storage->committed = true;
 
-      storage->block_storage_->forEach(
-          [this](const auto &block) { this->storeBlock(block); });
+      storage->block_storage_->forEach([this, &span](const auto &block) {
+        if (span) {
+          for (const auto &tx : block->transactions()) {
+            span.addTransaction(tx.hash());
+          }
+        }
+        // the cache is invalidated after the database commit, so the state
+        // read before it is not cached
+        if (wsv_cache_) {
+          wsv_cache_->invalidate(*block);
+        }
+        notifier_.get_subscriber().on_next(block);
+      });
+      if (history_indexer_) {
+        history_indexer_->notify();
+      }
 
-      ledger_state_ = storage->getLedgerState();
-      if (ledger_state_) {
+      if (auto ledger_state = storage->getLedgerState()) {
+        setLedgerState(std::move(ledger_state.value()));
         return expected::makeValue(ledger_state_.value());
       } else {
         return expected::makeError(
@@ -374,8 +554,19 @@ namespace iroha {
       }
     }
 
-    bool StorageImpl::preparedCommitEnabled() const {
-      return prepared_blocks_enabled_ and block_is_prepared_;
+    bool StorageImpl::preparedCommitEnabled(
+        const shared_model::interface::Block &block) const {
+      if (not prepared_blocks_enabled_ or not block_is_prepared_) {
+        return false;
+      }
+      const auto &transactions = block.transactions();
+      return boost::size(transactions) == prepared_transaction_hashes_.size()
+          and std::equal(prepared_transaction_hashes_.begin(),
+                         prepared_transaction_hashes_.end(),
+                         transactions.begin(),
+                         [](const auto &hash, const auto &transaction) {
+                           return hash == transaction.hash();
+                         });
     }
 
     CommitResult StorageImpl::commitPrepared(
@@ -389,7 +580,19 @@ namespace iroha {
         return expected::makeError("there are no prepared blocks");
       }
 
+      if (not preparedCommitEnabled(*block)) {
+        return expected::makeError(
+            "the prepared state is not of the transactions of block "
+            + block->hash().hex());
+      }
+
       log_->info("applying prepared block");
+      tracing::ScopedSpan span("storage.commit");
+      if (span) {
+        for (const auto &tx : block->transactions()) {
+          span.addTransaction(tx.hash());
+        }
+      }
 
       try {
         std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
@@ -399,30 +602,45 @@ namespace iroha {
           return expected::makeError(std::move(msg));
         }
         soci::session sql(*connection_);
+        // the block is written before the database commit as in commit()
+        if (auto error = expected::resultToOptionalError(storeBlock(block))) {
+          return expected::makeError(std::move(*error));
+        }
+        syncBlocks(1);
         sql << "COMMIT PREPARED '" + prepared_block_name_ + "';";
+        if (wsv_cache_) {
+          wsv_cache_->invalidate(*block);
+        }
         PostgresBlockIndex block_index(
-            std::make_unique<PostgresIndexer>(sql),
-            log_manager_->getChild("BlockIndex")->getLogger());
+            std::make_unique<PostgresIndexer>(sql, statement_metrics_),
+            log_manager_->getChild("BlockIndex")->getLogger(),
+            not history_indexer_);
         block_index.index(*block);
         block_is_prepared_ = false;
+        notifier_.get_subscriber().on_next(block);
 
-        return storeBlock(block) | [this, &sql, &block]() -> CommitResult {
-          decltype(
-              std::declval<PostgresWsvQuery>().getPeers()) opt_ledger_peers;
-          {
-            auto peer_query = PostgresWsvQuery(
-                sql, this->log_manager_->getChild("WsvQuery")->getLogger());
-            if (not(opt_ledger_peers = peer_query.getPeers())) {
-              return expected::makeError(
-                  std::string{"Failed to get ledger peers! Will retry."});
-            }
+        if (history_indexer_) {
+          history_indexer_->notify();
+        }
+        decltype(std::declval<PostgresWsvQuery>().getPeers()) opt_ledger_peers;
+        if (ledger_state_
+            and not MutableStorageImpl::changesLedgerPeers(*block)) {
+          opt_ledger_peers = ledger_state_.value()->ledger_peers;
+        } else {
+          auto peer_query = PostgresWsvQuery(
+              sql,
+              this->log_manager_->getChild("WsvQuery")->getLogger(),
+              statement_metrics_);
+          if (not(opt_ledger_peers = peer_query.getPeers())) {
+            return expected::makeError(
+                std::string{"Failed to get ledger peers! Will retry."});
           }
-          assert(opt_ledger_peers);
+        }
+        assert(opt_ledger_peers);
 
-          ledger_state_ = std::make_shared<const LedgerState>(
-              std::move(*opt_ledger_peers), block->height(), block->hash());
-          return expected::makeValue(ledger_state_.value());
-        };
+        setLedgerState(std::make_shared<const LedgerState>(
+            std::move(*opt_ledger_peers), block->height(), block->hash()));
+        return expected::makeValue(ledger_state_.value());
       } catch (const std::exception &e) {
         std::string msg((boost::format("failed to apply prepared block %s: %s")
                          % block->hash().hex() % e.what())
@@ -439,7 +657,8 @@ namespace iroha {
       }
       return std::make_shared<PostgresWsvQuery>(
           std::make_unique<soci::session>(*connection_),
-          log_manager_->getChild("WsvQuery")->getLogger());
+          log_manager_->getChild("WsvQuery")->getLogger(),
+          statement_metrics_);
     }
 
     std::shared_ptr<BlockQuery> StorageImpl::getBlockQuery() const {
@@ -469,12 +688,28 @@ namespace iroha {
       return boost::make_optional(std::move(setting_query_ptr));
     }
 
+    expected::Result<WsvSnapshot, std::string> StorageImpl::createWsvSnapshot()
+        const {
+      std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
+      if (not restore_connection_) {
+        return expected::makeError(
+            "createWsvSnapshot: connection to database is not initialised");
+      }
+      soci::session sql(*restore_connection_);
+      return PostgresWsvSnapshot(
+                 sql, log_manager_->getChild("WsvSnapshot")->getLogger())
+          .makeSnapshot();
+    }
+
     rxcpp::observable<std::shared_ptr<const shared_model::interface::Block>>
     StorageImpl::on_commit() {
       return notifier_.get_observable();
     }
 
-    void StorageImpl::prepareBlock(std::unique_ptr<TemporaryWsv> wsv) {
+    void StorageImpl::prepareBlock(
+        std::unique_ptr<TemporaryWsv> wsv,
+        std::vector<shared_model::interface::types::HashType>
+            transaction_hashes) {
       auto &wsv_impl = static_cast<TemporaryWsvImpl &>(*wsv);
       if (not prepared_blocks_enabled_) {
         log_->warn("prepared blocks are not enabled");
@@ -488,6 +723,7 @@ namespace iroha {
         soci::session &sql = wsv_impl.sql_;
         try {
           sql << "PREPARE TRANSACTION '" + prepared_block_name_ + "';";
+          prepared_transaction_hashes_ = std::move(transaction_hashes);
           block_is_prepared_ = true;
         } catch (const std::exception &e) {
           log_->warn("failed to prepare state: {}", e.what());
@@ -499,18 +735,30 @@ namespace iroha {
 
     StorageImpl::~StorageImpl() {
       notifier_lifetime_.unsubscribe();
+      history_indexer_.reset();
       freeConnections();
     }
 
     StorageImpl::StoreBlockResult StorageImpl::storeBlock(
         std::shared_ptr<const shared_model::interface::Block> block) {
       if (block_store_->insert(block)) {
-        notifier_.get_subscriber().on_next(block);
         return {};
       }
       return expected::makeError("Block insertion to storage failed");
     }
 
+    void StorageImpl::syncBlocks(size_t inserted) {
+      unsynced_blocks_ += inserted;
+      if (unsynced_blocks_ < block_sync_interval_) {
+        return;
+      }
+      // the blocks written since the last sync reach the disk at once
+      unsynced_blocks_ = 0;
+      if (not block_store_->flush()) {
+        log_->error("failed to flush the committed blocks");
+      }
+    }
+
     void StorageImpl::tryRollback(soci::session &session) {
       // TODO 17.06.2019 luckychess IR-568 split connection and schema
       // initialisation
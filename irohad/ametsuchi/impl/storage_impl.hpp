@@ -15,8 +15,12 @@
 #include <boost/optional.hpp>
 #include <rxcpp/rx-lite.hpp>
 #include "ametsuchi/block_storage_factory.hpp"
+#include "ametsuchi/impl/account_assets_count_cache.hpp"
 #include "ametsuchi/impl/pool_wrapper.hpp"
+#include "ametsuchi/impl/postgres_history_indexer.hpp"
 #include "ametsuchi/impl/postgres_options.hpp"
+#include "ametsuchi/impl/statement_metrics.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
 #include "ametsuchi/key_value_storage.hpp"
 #include "ametsuchi/ledger_state.hpp"
 #include "ametsuchi/reconnection_strategy.hpp"
@@ -49,7 +53,11 @@ namespace iroha {
           std::unique_ptr<BlockStorageFactory> temporary_block_storage_factory,
           std::unique_ptr<BlockStorage> persistent_block_storage,
           logger::LoggerManagerTreePtr log_manager,
-          size_t pool_size = 10);
+          std::shared_ptr<WsvCache> wsv_cache = nullptr,
+          bool async_history_index = false,
+          size_t pool_size = 10,
+          size_t block_sync_interval = 1,
+          std::shared_ptr<StatementMetrics> statement_metrics = nullptr);
 
       expected::Result<std::unique_ptr<CommandExecutor>, std::string>
       createCommandExecutor() override;
@@ -69,6 +77,9 @@ namespace iroha {
       boost::optional<std::unique_ptr<SettingQuery>> createSettingQuery()
           const override;
 
+      expected::Result<WsvSnapshot, std::string> createWsvSnapshot()
+          const override;
+
       boost::optional<std::shared_ptr<QueryExecutor>> createQueryExecutor(
           std::shared_ptr<PendingTransactionStorage> pending_txs_storage,
           std::shared_ptr<shared_model::interface::QueryResponseFactory>
@@ -88,6 +99,8 @@ namespace iroha {
 
       expected::Result<void, std::string> resetWsv() override;
 
+      CommitResult restoreWsvSnapshot(const WsvSnapshot &snapshot) override;
+
       void resetPeers() override;
 
       void dropStorage() override;
@@ -97,7 +110,8 @@ namespace iroha {
       CommitResult commit(
           std::unique_ptr<MutableStorage> mutable_storage) override;
 
-      bool preparedCommitEnabled() const override;
+      bool preparedCommitEnabled(
+          const shared_model::interface::Block &block) const override;
 
       CommitResult commitPrepared(
           std::shared_ptr<const shared_model::interface::Block> block) override;
@@ -109,7 +123,9 @@ namespace iroha {
       rxcpp::observable<std::shared_ptr<const shared_model::interface::Block>>
       on_commit() override;
 
-      void prepareBlock(std::unique_ptr<TemporaryWsv> wsv) override;
+      void prepareBlock(std::unique_ptr<TemporaryWsv> wsv,
+                        std::vector<shared_model::interface::types::HashType>
+                            transaction_hashes) override;
 
       ~StorageImpl() override;
 
@@ -126,7 +142,11 @@ namespace iroha {
           std::shared_ptr<shared_model::interface::QueryResponseFactory>
               query_response_factory,
           std::unique_ptr<BlockStorageFactory> temporary_block_storage_factory,
+          std::shared_ptr<WsvCache> wsv_cache,
+          bool async_history_index,
           size_t pool_size,
+          size_t block_sync_interval,
+          std::shared_ptr<StatementMetrics> statement_metrics,
           logger::LoggerManagerTreePtr log_manager);
 
       // db info
@@ -141,11 +161,29 @@ namespace iroha {
       StoreBlockResult storeBlock(
           std::shared_ptr<const shared_model::interface::Block> block);
 
+      /**
+       * Sync the block storage to the disk once the blocks inserted since
+       * the last sync reach the sync interval
+       * @param inserted - number of the blocks inserted by the commit
+       */
+      void syncBlocks(size_t inserted);
+
       /**
        * Method tries to perform rollback on passed session
        */
       void tryRollback(soci::session &session);
 
+      /**
+       * Select the connections for a query executor: the next replica, which
+       * is at most replicaMaxLag blocks behind the committed ledger, or the
+       * query lane of the primary database. drop_mutex_ must be held.
+       */
+      soci::connection_pool &queryPool() const;
+
+      /// set the ledger state of the last commit and publish it to the peer
+      /// queries
+      void setLedgerState(std::shared_ptr<const LedgerState> ledger_state);
+
       std::unique_ptr<BlockStorage> block_store_;
 
       std::shared_ptr<PoolWrapper> pool_wrapper_;
@@ -153,6 +191,13 @@ namespace iroha {
       /// ref for pool_wrapper_::connection_pool_
       std::shared_ptr<soci::connection_pool> &connection_;
 
+      /// refs for the pools of the query and the restore lanes
+      std::shared_ptr<soci::connection_pool> &query_connection_;
+      std::shared_ptr<soci::connection_pool> &restore_connection_;
+
+      /// replica to try first for the next query executor
+      mutable std::atomic<size_t> next_replica_{0};
+
       rxcpp::composite_subscription notifier_lifetime_;
       rxcpp::subjects::subject<
           std::shared_ptr<const shared_model::interface::Block>>
@@ -168,6 +213,15 @@ namespace iroha {
 
       std::unique_ptr<BlockStorageFactory> temporary_block_storage_factory_;
 
+      /// cache of the committed signatories and quorums, may be nullptr
+      std::shared_ptr<WsvCache> wsv_cache_;
+
+      /// execution time of the statements, may be null
+      std::shared_ptr<StatementMetrics> statement_metrics_;
+
+      /// numbers of the assets of the accounts at the latest height
+      std::shared_ptr<AccountAssetsCountCache> assets_count_cache_;
+
       logger::LoggerManagerTreePtr log_manager_;
       logger::LoggerPtr log_;
 
@@ -175,13 +229,31 @@ namespace iroha {
 
       const size_t pool_size_;
 
+      /// number of the committed blocks per sync of the block storage
+      const size_t block_sync_interval_;
+      size_t unsynced_blocks_ = 0;
+
       bool prepared_blocks_enabled_;
 
       std::atomic<bool> block_is_prepared_;
 
       std::string prepared_block_name_;
 
+      /// hashes of the transactions of the prepared state, set before
+      /// block_is_prepared_
+      std::vector<shared_model::interface::types::HashType>
+          prepared_transaction_hashes_;
+
       boost::optional<std::shared_ptr<const iroha::LedgerState>> ledger_state_;
+
+      /// the ledger state of the last commit, replaced atomically as a whole,
+      /// so the peer queries read it without the database. Empty when the
+      /// state is reset and has to be read from the database
+      std::shared_ptr<const iroha::LedgerState> published_ledger_state_;
+
+      /// builds the history of the committed blocks in the background, or
+      /// nullptr if the history is indexed on commit
+      std::unique_ptr<PostgresHistoryIndexer> history_indexer_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -5,34 +5,171 @@
 
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
 
+#include <algorithm>
+#include <unordered_set>
+
 #include <boost/algorithm/string/join.hpp>
 #include <boost/format.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include "ametsuchi/impl/postgres_command_executor.hpp"
+#include "ametsuchi/impl/soci_utils.hpp"
 #include "ametsuchi/tx_executor.hpp"
+#include "common/visitor.hpp"
 #include "cryptography/public_key.hpp"
 #include "interfaces/commands/command.hpp"
+#include "interfaces/commands/transfer_asset.hpp"
 #include "interfaces/permission_to_string.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
 
+namespace {
+  /// @return the command of a transaction of a single TransferAsset command
+  const shared_model::interface::TransferAsset *getSingleTransfer(
+      const shared_model::interface::Transaction &transaction) {
+    auto commands = transaction.commands();
+    if (boost::size(commands) != 1) {
+      return nullptr;
+    }
+    return iroha::visit_in_place(
+        commands.front().get(),
+        [](const shared_model::interface::TransferAsset &transfer)
+            -> const shared_model::interface::TransferAsset * {
+          return &transfer;
+        },
+        [](const auto &) -> const shared_model::interface::TransferAsset * {
+          return nullptr;
+        });
+  }
+
+  /**
+   * @return whether the transaction has at least quorum signatures of the
+   * account signatories, as the statement of the signatures validation does
+   */
+  bool signaturesMatch(
+      const iroha::ametsuchi::WsvCache::Account &account,
+      const shared_model::interface::Transaction &transaction) {
+    size_t signatures_count = 0;
+    for (const auto &signature : transaction.signatures()) {
+      if (account.signatories.count(signature.publicKey().hex()) == 0) {
+        return false;
+      }
+      ++signatures_count;
+    }
+    return account.quorum <= signatures_count;
+  }
+
+  iroha::expected::Error<iroha::validation::CommandError>
+  makeSignaturesError(const shared_model::interface::Transaction &transaction) {
+    auto error_str = "Transaction " + transaction.toString()
+        + " failed signatures validation";
+    // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic number
+    // with named constant
+    return iroha::expected::makeError(iroha::validation::CommandError{
+        "signatures validation", 2, error_str, false});
+  }
+}  // namespace
+
 namespace iroha {
   namespace ametsuchi {
     TemporaryWsvImpl::TemporaryWsvImpl(
         std::shared_ptr<PostgresCommandExecutor> command_executor,
+        std::shared_ptr<WsvCache> wsv_cache,
         logger::LoggerManagerTreePtr log_manager)
         : sql_(command_executor->getSession()),
+          command_executor_(command_executor),
           transaction_executor_(std::make_unique<TransactionExecutor>(
               std::move(command_executor))),
+          wsv_cache_(std::move(wsv_cache)),
           log_manager_(std::move(log_manager)),
           log_(log_manager_->getLogger()) {
       sql_ << "BEGIN";
     }
 
+    expected::Result<TemporaryWsvImpl::CachedAccounts, std::string>
+    TemporaryWsvImpl::getCachedAccounts(
+        const std::vector<shared_model::interface::types::AccountIdType>
+            &account_ids) {
+      CachedAccounts accounts;
+      std::vector<std::string> missing;
+      for (const auto &account_id : account_ids) {
+        // the state changed in this storage differs from the committed one
+        if (changed_accounts_.count(account_id) != 0
+            or accounts.count(account_id) != 0) {
+          continue;
+        }
+        if (auto account = wsv_cache_->find(account_id)) {
+          accounts.emplace(account_id, std::move(account));
+        } else if (std::find(missing.begin(), missing.end(), account_id)
+                   == missing.end()) {
+          missing.push_back(account_id);
+        }
+      }
+      if (missing.empty()) {
+        return std::move(accounts);
+      }
+
+      // the version is taken before the read, so the state of a block
+      // committed meanwhile is not cached
+      auto version = wsv_cache_->version();
+      auto missing_array = makePgArray(missing);
+      std::unordered_map<shared_model::interface::types::AccountIdType,
+                         std::shared_ptr<WsvCache::Account>>
+          loaded;
+      try {
+        using T = boost::tuple<std::string,
+                               shared_model::interface::types::QuorumType,
+                               boost::optional<std::string>>;
+        soci::rowset<T> rows = (sql_.prepare << R"(
+            SELECT a.account_id, a.quorum, s.public_key
+            FROM account AS a
+            LEFT JOIN account_has_signatory AS s
+                ON s.account_id = a.account_id
+            WHERE a.account_id = ANY(CAST(:account_ids AS text[])))",
+                                soci::use(missing_array, "account_ids"));
+        for (const auto &row : rows) {
+          auto &account = loaded[row.get<0>()];
+          if (not account) {
+            account = std::make_shared<WsvCache::Account>();
+            account->quorum = row.get<1>();
+          }
+          if (row.get<2>()) {
+            account->signatories.insert(*row.get<2>());
+          }
+        }
+      } catch (const std::exception &e) {
+        return expected::makeError(e.what());
+      }
+
+      for (auto &account : loaded) {
+        wsv_cache_->put(account.first, account.second, version);
+        accounts.emplace(account.first, std::move(account.second));
+      }
+      return std::move(accounts);
+    }
+
     expected::Result<void, validation::CommandError>
     TemporaryWsvImpl::validateSignatures(
         const shared_model::interface::Transaction &transaction) {
+      if (wsv_cache_) {
+        auto accounts = getCachedAccounts({transaction.creatorAccountId()});
+        if (auto error = expected::resultToOptionalError(accounts)) {
+          auto error_str = "Transaction " + transaction.toString()
+              + " failed signatures validation with db error: " + *error;
+          return expected::makeError(validation::CommandError{
+              "signatures validation", 1, error_str, false});
+        }
+        const auto &cached =
+            boost::get<expected::ValueOf<decltype(accounts)>>(accounts).value;
+        auto account = cached.find(transaction.creatorAccountId());
+        if (account != cached.end()) {
+          if (signaturesMatch(*account->second, transaction)) {
+            return {};
+          }
+          return makeSignaturesError(transaction);
+        }
+      }
+
       auto keys_range = transaction.signatures()
           | boost::adaptors::transformed(
                             [](const auto &s) { return s.publicKey().hex(); });
@@ -70,17 +207,142 @@ namespace iroha {
       if (signatories_valid and *signatories_valid) {
         return {};
       } else {
-        auto error_str = "Transaction " + transaction.toString()
-            + " failed signatures validation";
-        // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic number
-        // with named constant
-        return expected::makeError(validation::CommandError{
-            "signatures validation", 2, error_str, false});
+        return makeSignaturesError(transaction);
+      }
+    }
+
+    expected::Result<std::vector<bool>, std::string>
+    TemporaryWsvImpl::validateSignatures(const TransactionRefs &transactions) {
+      std::vector<bool> result(transactions.size());
+      // transactions whose creators are not cached, and their indices
+      TransactionRefs uncached;
+      std::vector<size_t> uncached_indices;
+      CachedAccounts cached;
+      if (wsv_cache_) {
+        std::vector<shared_model::interface::types::AccountIdType>
+            account_ids;
+        for (const auto &transaction : transactions) {
+          account_ids.push_back(transaction.get().creatorAccountId());
+        }
+        auto accounts = getCachedAccounts(account_ids);
+        if (auto error = expected::resultToOptionalError(accounts)) {
+          return expected::makeError(
+              std::string{"Failed to validate signatures: "} + *error);
+        }
+        cached = std::move(
+            boost::get<expected::ValueOf<decltype(accounts)>>(accounts)
+                .value);
+      }
+      for (size_t i = 0; i < transactions.size(); ++i) {
+        const auto &transaction = transactions[i].get();
+        auto account = cached.find(transaction.creatorAccountId());
+        if (account != cached.end()) {
+          result[i] = signaturesMatch(*account->second, transaction);
+        } else {
+          uncached.push_back(transactions[i]);
+          uncached_indices.push_back(i);
+        }
+      }
+      if (uncached.empty()) {
+        return std::move(result);
+      }
+
+      // the transactions are numbered from 1, as rows of unnest
+      std::vector<std::string> creators, signatures_counts, key_indices, keys;
+      for (size_t i = 0; i < uncached.size(); ++i) {
+        const auto &transaction = uncached[i].get();
+        creators.push_back(transaction.creatorAccountId());
+        signatures_counts.push_back(
+            std::to_string(boost::size(transaction.signatures())));
+        for (const auto &signature : transaction.signatures()) {
+          key_indices.push_back(std::to_string(i + 1));
+          keys.push_back(signature.publicKey().hex());
+        }
+      }
+      auto creators_array = makePgArray(creators);
+      auto signatures_counts_array = makePgArray(signatures_counts);
+      auto key_indices_array = makePgArray(key_indices);
+      auto keys_array = makePgArray(keys);
+
+      std::vector<int> signatures_valid(uncached.size());
+      try {
+        sql_ << R"(
+            WITH txs AS
+            (
+                SELECT * FROM unnest(
+                    CAST(:creators AS text[]),
+                    CAST(:signatures_counts AS int[]))
+                WITH ORDINALITY AS t(account_id, signatures_count, idx)
+            ),
+            keys AS
+            (
+                SELECT * FROM unnest(
+                    CAST(:key_indices AS bigint[]),
+                    CAST(:keys AS text[])) AS k(idx, public_key)
+            )
+            SELECT coalesce(
+                (SELECT count(1)
+                FROM keys
+                WHERE keys.idx = txs.idx
+                    AND keys.public_key IN
+                        (SELECT public_key
+                        FROM account_has_signatory
+                        WHERE account_id = txs.account_id))
+                    = txs.signatures_count
+                AND (SELECT quorum
+                    FROM account
+                    WHERE account_id = txs.account_id)
+                    <= txs.signatures_count,
+                false)::int
+            FROM txs
+            ORDER BY txs.idx)",
+            soci::into(signatures_valid),
+            soci::use(creators_array, "creators"),
+            soci::use(signatures_counts_array, "signatures_counts"),
+            soci::use(key_indices_array, "key_indices"),
+            soci::use(keys_array, "keys");
+      } catch (const std::exception &e) {
+        return expected::makeError(
+            std::string{"Failed to validate signatures: "} + e.what());
+      }
+      if (signatures_valid.size() != uncached.size()) {
+        return expected::makeError(
+            std::string{"Signatures of some transactions are not validated"});
+      }
+      for (size_t i = 0; i < uncached.size(); ++i) {
+        result[uncached_indices[i]] = signatures_valid[i] != 0;
+      }
+      return std::move(result);
+    }
+
+    void TemporaryWsvImpl::rememberChangedAccounts(
+        const shared_model::interface::Transaction &transaction) {
+      for (const auto &command : transaction.commands()) {
+        if (auto account_id = WsvCache::changedAccount(command)) {
+          changed_accounts_.insert(std::move(*account_id));
+        }
       }
     }
 
+    expected::Result<void, validation::CommandError>
+    TemporaryWsvImpl::execute(
+        const shared_model::interface::Transaction &transaction,
+        bool do_validation) {
+      if (auto error = expected::resultToOptionalError(
+              transaction_executor_->execute(transaction, do_validation))) {
+        return expected::makeError(
+            validation::CommandError{error->command_error.command_name,
+                                     error->command_error.error_code,
+                                     error->command_error.error_extra,
+                                     true,
+                                     error->command_index});
+      }
+      return {};
+    }
+
     expected::Result<void, validation::CommandError> TemporaryWsvImpl::apply(
         const shared_model::interface::Transaction &transaction) {
+      rememberChangedAccounts(transaction);
       auto savepoint_wrapper = createSavepoint("savepoint_temp_wsv");
 
       return validateSignatures(transaction) |
@@ -88,14 +350,9 @@ namespace iroha {
                   savepoint = std::move(savepoint_wrapper),
                   &transaction]()
                  -> expected::Result<void, validation::CommandError> {
-        if (auto error = expected::resultToOptionalError(
-                transaction_executor_->execute(transaction, true))) {
-          return expected::makeError(
-              validation::CommandError{error->command_error.command_name,
-                                       error->command_error.error_code,
-                                       error->command_error.error_extra,
-                                       true,
-                                       error->command_index});
+        if (auto error =
+                expected::resultToOptionalError(execute(transaction, true))) {
+          return expected::makeError(std::move(*error));
         }
         // success
         savepoint->release();
@@ -103,6 +360,196 @@ namespace iroha {
       };
     }
 
+    expected::Result<void, validation::CommandError>
+    TemporaryWsvImpl::applyValidated(
+        const shared_model::interface::Transaction &transaction) {
+      rememberChangedAccounts(transaction);
+      auto savepoint = createSavepoint("savepoint_temp_wsv");
+      if (auto error =
+              expected::resultToOptionalError(execute(transaction, false))) {
+        return expected::makeError(std::move(*error));
+      }
+      savepoint->release();
+      return {};
+    }
+
+    std::vector<expected::Result<void, validation::CommandError>>
+    TemporaryWsvImpl::applyUnderSharedSavepoints(
+        const TransactionRefs &transactions) {
+      std::vector<expected::Result<void, validation::CommandError>> results;
+      results.reserve(transactions.size());
+
+      size_t begin = 0;
+      while (begin < transactions.size()) {
+        auto end =
+            std::min(begin + kTransactionsPerSavepoint, transactions.size());
+        static const std::string kRunSavepoint = "savepoint_temp_wsv_run";
+        auto savepoint = createSavepoint(kRunSavepoint);
+        auto failed = begin;
+        boost::optional<validation::CommandError> error;
+        for (; failed < end and not error; ++failed) {
+          const auto &transaction = transactions[failed].get();
+          rememberChangedAccounts(transaction);
+          error = expected::resultToOptionalError(
+              validateSignatures(transaction) |
+              [&] { return execute(transaction, true); });
+        }
+        if (not error) {
+          savepoint->release();
+          results.resize(results.size() + (end - begin));
+          begin = end;
+          continue;
+        }
+        --failed;
+
+        // the failed transaction may have applied a part of its commands or
+        // aborted the database transaction, so the state is rolled back to
+        // the savepoint and the transactions passed before it are applied
+        // again without validation
+        savepoint.reset();
+        auto replay_savepoint = createSavepoint("savepoint_temp_wsv_replay");
+        bool replayed = true;
+        for (auto i = begin; i < failed and replayed; ++i) {
+          replayed = expected::hasValue(execute(transactions[i], false));
+        }
+        if (replayed) {
+          replay_savepoint->release();
+          results.resize(results.size() + (failed - begin));
+        } else {
+          log_->warn("Failed to apply again the validated transactions");
+          replay_savepoint.reset();
+          for (auto i = begin; i < failed; ++i) {
+            results.push_back(apply(transactions[i]));
+          }
+        }
+        // the rollback keeps the savepoint of the run, so it is released
+        // together with the savepoints created after it
+        try {
+          sql_ << "RELEASE SAVEPOINT " + kRunSavepoint + ";";
+        } catch (const std::exception &e) {
+          log_->error("Failed to release the savepoint: {}", e.what());
+        }
+        results.push_back(expected::makeError(std::move(*error)));
+        begin = failed + 1;
+      }
+      return results;
+    }
+
+    std::vector<expected::Result<void, validation::CommandError>>
+    TemporaryWsvImpl::applyTransactions(const TransactionRefs &transactions) {
+      std::vector<expected::Result<void, validation::CommandError>> results;
+      results.reserve(transactions.size());
+
+      TransactionRefs transfers;
+      // account and asset pairs of the balances changed by the transfers
+      std::unordered_set<std::string> balances;
+      auto apply_transfers = [&] {
+        boost::optional<
+            std::vector<expected::Result<void, validation::CommandError>>>
+            transfer_results;
+        if (transfers.size() > 1) {
+          transfer_results = applyTransfers(transfers);
+        }
+        if (transfer_results) {
+          std::move(transfer_results->begin(),
+                    transfer_results->end(),
+                    std::back_inserter(results));
+        } else {
+          auto sequential_results = applyUnderSharedSavepoints(transfers);
+          std::move(sequential_results.begin(),
+                    sequential_results.end(),
+                    std::back_inserter(results));
+        }
+        transfers.clear();
+        balances.clear();
+      };
+      TransactionRefs others;
+      auto apply_others = [&] {
+        auto others_results = applyUnderSharedSavepoints(others);
+        std::move(others_results.begin(),
+                  others_results.end(),
+                  std::back_inserter(results));
+        others.clear();
+      };
+
+      for (const auto &transaction : transactions) {
+        auto transfer = getSingleTransfer(transaction);
+        if (not transfer) {
+          apply_transfers();
+          others.push_back(transaction);
+          continue;
+        }
+        apply_others();
+        auto source = transfer->srcAccountId() + " " + transfer->assetId();
+        auto dest = transfer->destAccountId() + " " + transfer->assetId();
+        if (balances.count(source) != 0 or balances.count(dest) != 0) {
+          apply_transfers();
+        }
+        balances.insert(std::move(source));
+        balances.insert(std::move(dest));
+        transfers.push_back(transaction);
+      }
+      apply_transfers();
+      apply_others();
+      return results;
+    }
+
+    boost::optional<
+        std::vector<expected::Result<void, validation::CommandError>>>
+    TemporaryWsvImpl::applyTransfers(const TransactionRefs &transactions) {
+      // a failed statement aborts the database transaction, so it is rolled
+      // back to the savepoint, and the transactions are applied one by one
+      auto savepoint = createSavepoint("savepoint_temp_wsv_transfers");
+
+      auto signatures_valid = validateSignatures(transactions);
+      if (auto error = expected::resultToOptionalError(signatures_valid)) {
+        log_->warn("{}", *error);
+        return boost::none;
+      }
+      const auto &valid = boost::get<expected::ValueOf<
+          decltype(signatures_valid)>>(signatures_valid)
+                              .value;
+
+      std::vector<PostgresCommandExecutor::CreatedTransferAsset> transfers;
+      for (size_t i = 0; i < transactions.size(); ++i) {
+        if (valid[i]) {
+          const auto &transaction = transactions[i].get();
+          transfers.push_back({*getSingleTransfer(transaction),
+                               transaction.creatorAccountId()});
+        }
+      }
+      auto transfer_results =
+          command_executor_->executeTransfers(transfers, true);
+      if (auto error = expected::resultToOptionalError(transfer_results)) {
+        log_->warn("{}", *error);
+        return boost::none;
+      }
+      auto transfer_result = boost::get<expected::ValueOf<
+          decltype(transfer_results)>>(transfer_results)
+                                 .value.begin();
+
+      std::vector<expected::Result<void, validation::CommandError>> results;
+      for (size_t i = 0; i < transactions.size(); ++i) {
+        if (not valid[i]) {
+          results.push_back(makeSignaturesError(transactions[i].get()));
+          continue;
+        }
+        if (auto error = expected::resultToOptionalError(*transfer_result)) {
+          results.push_back(expected::makeError(
+              validation::CommandError{error->command_name,
+                                       error->error_code,
+                                       error->error_extra,
+                                       true,
+                                       0}));
+        } else {
+          results.emplace_back();
+        }
+        ++transfer_result;
+      }
+      savepoint->release();
+      return results;
+    }
+
     std::unique_ptr<TemporaryWsv::SavepointWrapper>
     TemporaryWsvImpl::createSavepoint(const std::string &name) {
       return std::make_unique<TemporaryWsvImpl::SavepointWrapperImpl>(
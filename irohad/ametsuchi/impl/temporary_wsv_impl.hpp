@@ -8,8 +8,13 @@
 
 #include "ametsuchi/temporary_wsv.hpp"
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include <soci/soci.h>
+#include <boost/optional.hpp>
 #include "ametsuchi/command_executor.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
 
@@ -45,19 +50,51 @@ namespace iroha {
         logger::LoggerPtr log_;
       };
 
+      /**
+       * @param command_executor - executor of the commands in the session
+       * @param wsv_cache - cache of the committed signatories and quorums,
+       * nullptr if they are always read from the database
+       * @param log_manager - log manager
+       */
       TemporaryWsvImpl(
           std::shared_ptr<PostgresCommandExecutor> command_executor,
+          std::shared_ptr<WsvCache> wsv_cache,
           logger::LoggerManagerTreePtr log_manager);
 
       expected::Result<void, validation::CommandError> apply(
           const shared_model::interface::Transaction &transaction) override;
 
+      /**
+       * Applies transactions one after another. Consecutive transactions of
+       * a single TransferAsset command, which do not change the same
+       * balances, are validated and applied together with a few statements
+       */
+      std::vector<expected::Result<void, validation::CommandError>>
+      applyTransactions(const TransactionRefs &transactions) override;
+
+      expected::Result<void, validation::CommandError> applyValidated(
+          const shared_model::interface::Transaction &transaction) override;
+
       std::unique_ptr<TemporaryWsv::SavepointWrapper> createSavepoint(
           const std::string &name) override;
 
       ~TemporaryWsvImpl() override;
 
      private:
+      using CachedAccounts =
+          std::unordered_map<shared_model::interface::types::AccountIdType,
+                             WsvCache::AccountPtr>;
+
+      /**
+       * Get the signatories and the quorums of the accounts from the cache,
+       * and read the missing ones in one statement to cache them
+       * @return accounts which are not changed in this storage and exist,
+       * or error string if the statement has failed
+       */
+      expected::Result<CachedAccounts, std::string> getCachedAccounts(
+          const std::vector<shared_model::interface::types::AccountIdType>
+              &account_ids);
+
       /**
        * Verifies whether transaction has at least quorum signatures and they
        * are a subset of creator account signatories
@@ -65,8 +102,58 @@ namespace iroha {
       expected::Result<void, validation::CommandError> validateSignatures(
           const shared_model::interface::Transaction &transaction);
 
+      /**
+       * Verifies signatures of the transactions as the one above does
+       * @return whether the signatures of each transaction are valid, or
+       * error string if the query has failed
+       */
+      expected::Result<std::vector<bool>, std::string> validateSignatures(
+          const TransactionRefs &transactions);
+
+      /// maximal number of the transactions applied under one savepoint
+      static constexpr size_t kTransactionsPerSavepoint = 64;
+
+      /// Remember the accounts whose signatories or quorum the transaction
+      /// may change, so they are not read from the cache
+      void rememberChangedAccounts(
+          const shared_model::interface::Transaction &transaction);
+
+      /**
+       * Execute the commands of the transaction
+       * @return error of the first failed command, if any
+       */
+      expected::Result<void, validation::CommandError> execute(
+          const shared_model::interface::Transaction &transaction,
+          bool do_validation);
+
+      /**
+       * Validate and apply the transactions one after another, taking one
+       * savepoint for up to kTransactionsPerSavepoint of them instead of a
+       * savepoint for each. When a transaction fails, the state is rolled
+       * back to the savepoint, and the transactions passed since it are
+       * applied again without validation
+       * @return result of each transaction in their order
+       */
+      std::vector<expected::Result<void, validation::CommandError>>
+      applyUnderSharedSavepoints(const TransactionRefs &transactions);
+
+      /**
+       * Validate and apply each of the transactions of a single independent
+       * TransferAsset command at once
+       * @return result of each transaction, or none if the statements have
+       * failed, so nothing is applied
+       */
+      boost::optional<
+          std::vector<expected::Result<void, validation::CommandError>>>
+      applyTransfers(const TransactionRefs &transactions);
+
       soci::session &sql_;
+      std::shared_ptr<PostgresCommandExecutor> command_executor_;
       std::unique_ptr<TransactionExecutor> transaction_executor_;
+      std::shared_ptr<WsvCache> wsv_cache_;
+      /// accounts whose signatories or quorum may be changed in this storage
+      std::unordered_set<shared_model::interface::types::AccountIdType>
+          changed_accounts_;
 
       logger::LoggerManagerTreePtr log_manager_;
       logger::LoggerPtr log_;
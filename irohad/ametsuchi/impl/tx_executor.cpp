@@ -18,7 +18,7 @@ iroha::expected::Result<void, TxExecutionError> TransactionExecutor::execute(
     const shared_model::interface::Transaction &transaction,
     bool do_validation) const {
   size_t cmd_index = 0;
-  for (const auto &cmd : transaction.commands()) {
+  for (const auto &cmd : transaction.commandsSpan()) {
     if (auto cmd_error =
             iroha::expected::resultToOptionalError(command_executor_->execute(
                 cmd, transaction.creatorAccountId(), do_validation))) {
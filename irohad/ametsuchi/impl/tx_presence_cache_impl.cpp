@@ -5,11 +5,18 @@
 
 #include "ametsuchi/impl/tx_presence_cache_impl.hpp"
 
+#include "ametsuchi/block_query.hpp"
 #include "common/bind.hpp"
 #include "common/visitor.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/transaction.hpp"
 
+namespace {
+  /// heap memory of a cached status: the bytes of the hash in the key and of
+  /// the one in the status
+  constexpr size_t kItemHeapBytes = 2 * 32;
+}  // namespace
+
 namespace iroha {
   namespace ametsuchi {
     TxPresenceCacheImpl::TxPresenceCacheImpl(std::shared_ptr<Storage> storage)
@@ -27,15 +34,47 @@ namespace iroha {
     boost::optional<TxPresenceCache::BatchStatusCollectionType>
     TxPresenceCacheImpl::check(
         const shared_model::interface::TransactionBatch &batch) const {
-      TxPresenceCache::BatchStatusCollectionType batch_statuses;
+      std::vector<shared_model::crypto::Hash> hashes;
+      hashes.reserve(batch.transactions().size());
       for (const auto &tx : batch.transactions()) {
-        if (auto status = check(tx->hash())) {
-          batch_statuses.emplace_back(*status);
+        hashes.push_back(tx->hash());
+      }
+      return check(hashes);
+    }
+
+    boost::optional<TxPresenceCache::BatchStatusCollectionType>
+    TxPresenceCacheImpl::check(
+        const std::vector<shared_model::crypto::Hash> &hashes) const {
+      TxPresenceCache::BatchStatusCollectionType statuses;
+      statuses.reserve(hashes.size());
+      std::vector<size_t> missing;
+      std::vector<shared_model::crypto::Hash> missing_hashes;
+      for (size_t i = 0; i < hashes.size(); ++i) {
+        if (auto status = memory_cache_.findItem(hashes[i])) {
+          statuses.push_back(*status);
         } else {
-          return boost::none;
+          statuses.emplace_back(tx_cache_status_responses::Missing{hashes[i]});
+          missing.push_back(i);
+          missing_hashes.push_back(hashes[i]);
         }
       }
-      return batch_statuses;
+      if (missing.empty()) {
+        return statuses;
+      }
+
+      auto block_query = storage_->getBlockQuery();
+      if (not block_query) {
+        return boost::none;
+      }
+      auto stored = block_query->checkTxsPresence(missing_hashes);
+      if (not stored) {
+        return boost::none;
+      }
+      for (size_t j = 0; j < missing.size(); ++j) {
+        cacheStatus(missing_hashes[j], (*stored)[j]);
+        statuses[missing[j]] = std::move((*stored)[j]);
+      }
+      return statuses;
     }
 
     boost::optional<TxCacheStatusType> TxPresenceCacheImpl::checkInStorage(
@@ -46,16 +85,60 @@ namespace iroha {
       }
       return block_query->checkTxPresence(hash) |
           [this, &hash](const auto &status) {
-            visit_in_place(status,
-                           [](const tx_cache_status_responses::Missing &) {
-                             // don't put this hash into cache since "Missing"
-                             // can become "Committed" or "Rejected" later
-                           },
-                           [this, &hash](const auto &status) {
-                             memory_cache_.addItem(hash, status);
-                           });
+            this->cacheStatus(hash, status);
             return status;
           };
     }
+
+    boost::optional<size_t> TxPresenceCacheImpl::warmUp(
+        shared_model::interface::types::HeightType blocks) {
+      auto block_query = storage_->getBlockQuery();
+      if (not block_query) {
+        return boost::none;
+      }
+      size_t cached = 0;
+      const auto top_height = block_query->getTopBlockHeight();
+      for (auto height = top_height;
+           height > 0 and height + blocks > top_height;
+           --height) {
+        auto block = expected::resultToOptionalValue(
+            block_query->getBlock(height));
+        if (not block) {
+          return boost::none;
+        }
+        for (const auto &tx : (*block)->transactions()) {
+          memory_cache_.addItem(
+              tx.hash(), tx_cache_status_responses::Committed{tx.hash()});
+          ++cached;
+        }
+        for (const auto &hash : (*block)->rejected_transactions_hashes()) {
+          memory_cache_.addItem(hash,
+                                tx_cache_status_responses::Rejected{hash});
+          ++cached;
+        }
+      }
+      return cached;
+    }
+
+    size_t TxPresenceCacheImpl::memoryUsage() const {
+      return memory_cache_.memoryUsage(kItemHeapBytes);
+    }
+
+    void TxPresenceCacheImpl::limitMemory(size_t max_bytes) {
+      memory_cache_.limitMemory(max_bytes, kItemHeapBytes);
+    }
+
+    void TxPresenceCacheImpl::cacheStatus(
+        const shared_model::crypto::Hash &hash,
+        const TxCacheStatusType &status) const {
+      visit_in_place(status,
+                     [](const tx_cache_status_responses::Missing &) {
+                       // don't put this hash into cache since "Missing"
+                       // can become "Committed" or "Rejected" later
+                     },
+                     [this, &hash](const auto &status) {
+                       memory_cache_.addItem(hash, status);
+                     });
+    }
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -8,7 +8,7 @@
 
 #include "ametsuchi/storage.hpp"
 #include "ametsuchi/tx_presence_cache.hpp"
-#include "cache/cache.hpp"
+#include "cache/sharded_cache.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -24,6 +24,30 @@ namespace iroha {
           const shared_model::interface::TransactionBatch &batch)
           const override;
 
+      boost::optional<BatchStatusCollectionType> check(
+          const std::vector<shared_model::crypto::Hash> &hashes)
+          const override;
+
+      /**
+       * Cache the statuses of the transactions of the recent blocks, so the
+       * replay checks after a restart do not query the storage
+       * @param blocks - number of the top blocks to read
+       * @return number of the cached statuses, boost::none if the blocks
+       * cannot be read
+       */
+      boost::optional<size_t> warmUp(
+          shared_model::interface::types::HeightType blocks);
+
+      /// @return approximate memory taken by the cached statuses in bytes
+      size_t memoryUsage() const;
+
+      /**
+       * Limit the cached statuses to approximately the given memory, evicting
+       * the ones over it
+       * @param max_bytes - memory budget of the cache
+       */
+      void limitMemory(size_t max_bytes);
+
      private:
       /**
        * Performs an actual storage request about hash status
@@ -34,10 +58,14 @@ namespace iroha {
       boost::optional<TxCacheStatusType> checkInStorage(
           const shared_model::crypto::Hash &hash) const;
 
+      /// puts the status into the memory cache unless it is Missing
+      void cacheStatus(const shared_model::crypto::Hash &hash,
+                       const TxCacheStatusType &status) const;
+
       std::shared_ptr<Storage> storage_;
-      mutable cache::Cache<shared_model::crypto::Hash,
-                           TxCacheStatusType,
-                           shared_model::crypto::Hash::Hasher>
+      mutable cache::ShardedCache<shared_model::crypto::Hash,
+                                  TxCacheStatusType,
+                                  shared_model::crypto::Hash::Hasher>
           memory_cache_;
     };
   }  // namespace ametsuchi
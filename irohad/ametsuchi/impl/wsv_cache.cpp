@@ -0,0 +1,122 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/wsv_cache.hpp"
+
+#include "common/visitor.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/command_variant.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
+
+using namespace iroha::ametsuchi;
+using shared_model::interface::types::AccountIdType;
+
+WsvCache::WsvCache(size_t capacity)
+    : capacity_(capacity),
+      version_(0),
+      hits_(std::make_shared<Counter>()),
+      misses_(std::make_shared<Counter>()) {}
+
+WsvCache::Version WsvCache::version() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return version_;
+}
+
+WsvCache::AccountPtr WsvCache::find(const AccountIdType &account_id) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(account_id);
+  if (it == index_.end()) {
+    misses_->increment();
+    return nullptr;
+  }
+  hits_->increment();
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return it->second->second;
+}
+
+void WsvCache::put(const AccountIdType &account_id,
+                   AccountPtr account,
+                   Version version) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (capacity_ == 0 or version != version_
+      or index_.count(account_id) != 0) {
+    return;
+  }
+  if (entries_.size() == capacity_) {
+    index_.erase(entries_.back().first);
+    entries_.pop_back();
+  }
+  entries_.emplace_front(account_id, std::move(account));
+  index_.emplace(account_id, entries_.begin());
+}
+
+void WsvCache::invalidate(const shared_model::interface::Block &block) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto &transaction : block.transactions()) {
+    for (const auto &command : transaction.commands()) {
+      if (auto account_id = changedAccount(command)) {
+        auto it = index_.find(*account_id);
+        if (it != index_.end()) {
+          entries_.erase(it->second);
+          index_.erase(it);
+        }
+      }
+    }
+  }
+  ++version_;
+}
+
+void WsvCache::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+  index_.clear();
+  ++version_;
+}
+
+void WsvCache::setCapacity(size_t capacity) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  capacity_ = capacity;
+  while (entries_.size() > capacity_) {
+    index_.erase(entries_.back().first);
+    entries_.pop_back();
+  }
+}
+
+size_t WsvCache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+std::shared_ptr<const iroha::Counter> WsvCache::hits() const {
+  return hits_;
+}
+
+std::shared_ptr<const iroha::Counter> WsvCache::misses() const {
+  return misses_;
+}
+
+boost::optional<AccountIdType> WsvCache::changedAccount(
+    const shared_model::interface::Command &command) {
+  return iroha::visit_in_place(
+      command.get(),
+      [](const shared_model::interface::AddSignatory &command)
+          -> boost::optional<AccountIdType> { return command.accountId(); },
+      [](const shared_model::interface::RemoveSignatory &command)
+          -> boost::optional<AccountIdType> { return command.accountId(); },
+      [](const shared_model::interface::SetQuorum &command)
+          -> boost::optional<AccountIdType> { return command.accountId(); },
+      [](const shared_model::interface::CreateAccount &command)
+          -> boost::optional<AccountIdType> {
+        return command.accountName() + "@" + command.domainId();
+      },
+      [](const auto &) -> boost::optional<AccountIdType> {
+        return boost::none;
+      });
+}
@@ -0,0 +1,124 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_CACHE_HPP
+#define IROHA_WSV_CACHE_HPP
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <boost/optional.hpp>
+#include "common/counter.hpp"
+#include "interfaces/common_objects/types.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+    class Command;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Cache of the signatories and the quorums of the least recently used
+     * accounts in the committed WSV, which are read on validation of the
+     * signatures of every transaction. The entries are evicted when a block
+     * which changes them is committed, and the version of the cache is
+     * changed, so the state read from the database before the commit is not
+     * put to the cache afterwards. The state which is changed by an
+     * uncommitted temporary or mutable storage is never put to the cache, so
+     * nothing is to be rolled back with the storage
+     */
+    class WsvCache {
+     public:
+      struct Account {
+        /// hex encoded public keys
+        std::unordered_set<std::string> signatories;
+        shared_model::interface::types::QuorumType quorum;
+      };
+      using AccountPtr = std::shared_ptr<const Account>;
+      using Version = uint64_t;
+
+      /**
+       * @param capacity - maximal number of the cached accounts
+       */
+      explicit WsvCache(size_t capacity);
+
+      /// @return version of the cache, which is to be passed to put
+      Version version() const;
+
+      /**
+       * @return the cached account, which becomes the most recently used
+       * one, or nullptr
+       */
+      AccountPtr find(
+          const shared_model::interface::types::AccountIdType &account_id)
+          const;
+
+      /**
+       * Put the account read from the committed WSV to the cache, and evict
+       * the least recently used ones
+       * @param version - version of the cache before the account was read,
+       * the account is not put if a block has been committed since then
+       */
+      void put(const shared_model::interface::types::AccountIdType &account_id,
+               AccountPtr account,
+               Version version);
+
+      /// evict the accounts changed by the committed block
+      void invalidate(const shared_model::interface::Block &block);
+
+      void clear();
+
+      /**
+       * Change the max number of the cached accounts, and evict the least
+       * recently used ones over it
+       */
+      void setCapacity(size_t capacity);
+
+      /// @return number of the cached accounts
+      size_t size() const;
+
+      /// @return number of the requested accounts which were cached
+      std::shared_ptr<const Counter> hits() const;
+
+      /// @return number of the requested accounts which were not cached
+      std::shared_ptr<const Counter> misses() const;
+
+      /**
+       * @return account whose signatories or quorum are changed by the
+       * command, or none
+       */
+      static boost::optional<shared_model::interface::types::AccountIdType>
+      changedAccount(const shared_model::interface::Command &command);
+
+     private:
+      using Entries = std::list<
+          std::pair<shared_model::interface::types::AccountIdType,
+                    AccountPtr>>;
+
+      size_t capacity_;
+
+      mutable std::mutex mutex_;
+      Version version_;
+      /// cached accounts from the most recently used one
+      mutable Entries entries_;
+      std::unordered_map<shared_model::interface::types::AccountIdType,
+                         Entries::iterator>
+          index_;
+
+      std::shared_ptr<Counter> hits_;
+      std::shared_ptr<Counter> misses_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_CACHE_HPP
@@ -5,13 +5,22 @@
 
 #include "wsv_restorer_impl.hpp"
 
+#include <algorithm>
+
+#include <soci/soci.h>
+#include <tbb/parallel_for.h>
+#include <boost/format.hpp>
+#include <rxcpp/rx-lite.hpp>
 #include "ametsuchi/block_query.hpp"
 #include "ametsuchi/block_storage.hpp"
 #include "ametsuchi/block_storage_factory.hpp"
 #include "ametsuchi/command_executor.hpp"
+#include "ametsuchi/impl/postgres_command_executor.hpp"
 #include "ametsuchi/mutable_storage.hpp"
 #include "ametsuchi/storage.hpp"
 #include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
+#include "validation/chain_validator.hpp"
 
 namespace {
   /**
@@ -98,7 +107,26 @@ namespace {
 
 namespace iroha {
   namespace ametsuchi {
+
+    constexpr size_t WsvRestorerImpl::kDefaultBlocksPerCommit;
+
+    WsvRestorerImpl::WsvRestorerImpl(
+        std::shared_ptr<BlockValidator> block_validator,
+        std::shared_ptr<validation::ChainValidator> chain_validator,
+        size_t workers,
+        size_t blocks_per_commit,
+        logger::LoggerPtr log)
+        : block_validator_(std::move(block_validator)),
+          chain_validator_(std::move(chain_validator)),
+          workers_(std::make_unique<tbb::task_arena>(
+              static_cast<int>(std::max<size_t>(workers, 1)))),
+          blocks_per_commit_(std::max<size_t>(blocks_per_commit, 1)),
+          log_(std::move(log)) {}
+
     CommitResult WsvRestorerImpl::restoreWsv(Storage &storage) {
+      if (chain_validator_) {
+        return restoreFast(storage);
+      }
       return storage.createCommandExecutor() |
                  [&storage](auto &&command_executor) -> CommitResult {
         BlockStorageStubFactory storage_factory;
@@ -116,5 +144,194 @@ namespace iroha {
             };
       };
     }
+
+    CommitResult WsvRestorerImpl::restoreFast(Storage &storage) {
+      auto block_query = storage.getBlockQuery();
+      if (not block_query) {
+        return expected::makeError("Cannot create BlockQuery");
+      }
+      const auto top_height = block_query->getTopBlockHeight();
+
+      auto checkpoint = readCheckpoint(storage, *block_query, top_height);
+      if (auto error = expected::resultToOptionalError(checkpoint)) {
+        return std::move(*error);
+      }
+      auto resumed = expected::resultToOptionalValue(checkpoint).value();
+
+      if (resumed) {
+        log_->info("Resuming WSV restoration from block {}", resumed->height);
+      } else if (auto error =
+                     expected::resultToOptionalError(storage.resetWsv())) {
+        return std::move(*error);
+      }
+
+      BlockStorageStubFactory storage_factory;
+      auto begin = resumed ? resumed->height + 1 : 1;
+      CommitResult result = expected::makeError("No blocks are committed");
+      do {
+        auto end = std::min<shared_model::interface::types::HeightType>(
+            begin + blocks_per_commit_ - 1, top_height);
+        auto loaded = loadBlocks(*block_query, begin, end);
+        if (auto error = expected::resultToOptionalError(loaded)) {
+          return std::move(*error);
+        }
+        auto blocks =
+            expected::resultToOptionalValue(std::move(loaded)).value();
+        result = commitBlocks(
+            storage, storage_factory, blocks, resumed, end >= top_height);
+        if (expected::hasError(result)) {
+          return result;
+        }
+        // the following blocks are validated against the committed ledger
+        // state
+        resumed = boost::none;
+        log_->info("Restored WSV up to block {} of {}", end, top_height);
+        begin = end + 1;
+      } while (begin <= top_height);
+      return result;
+    }
+
+    expected::Result<boost::optional<WsvRestorerImpl::Checkpoint>, std::string>
+    WsvRestorerImpl::readCheckpoint(
+        Storage &storage,
+        BlockQuery &block_query,
+        shared_model::interface::types::HeightType top_height) {
+      auto command_executor = storage.createCommandExecutor();
+      if (auto error = expected::resultToOptionalError(command_executor)) {
+        return std::move(*error);
+      }
+      auto executor =
+          std::move(expected::resultToOptionalValue(std::move(command_executor))
+                        .value());
+      auto &sql =
+          static_cast<PostgresCommandExecutor &>(*executor).getSession();
+
+      boost::optional<shared_model::interface::types::HeightType> height;
+      boost::optional<std::string> hash;
+      try {
+        sql << "SELECT height, hash FROM wsv_restore_checkpoint",
+            soci::into(height), soci::into(hash);
+      } catch (const std::exception &e) {
+        return expected::makeError(
+            std::string{"Cannot read WSV restore checkpoint: "} + e.what());
+      }
+
+      // the checkpoint is ignored unless it belongs to the stored chain
+      boost::optional<Checkpoint> checkpoint;
+      if (height and hash and *height <= top_height) {
+        if (auto header = expected::resultToOptionalValue(
+                block_query.getBlockHeader(*height))) {
+          if (header->hash.hex() == *hash) {
+            checkpoint = Checkpoint{*height, *hash};
+          }
+        }
+      }
+      return checkpoint;
+    }
+
+    expected::Result<std::vector<WsvRestorerImpl::BlockPtr>, std::string>
+    WsvRestorerImpl::loadBlocks(
+        BlockQuery &block_query,
+        shared_model::interface::types::HeightType begin,
+        shared_model::interface::types::HeightType end) {
+      if (end < begin) {
+        return std::vector<BlockPtr>{};
+      }
+      const size_t size = end - begin + 1;
+      std::vector<BlockPtr> blocks(size);
+      std::vector<std::string> errors(size);
+      workers_->execute([&] {
+        tbb::parallel_for(static_cast<size_t>(0), size, [&](size_t i) {
+          block_query.getBlock(begin + i)
+              .match(
+                  [&](auto &&block) {
+                    if (auto answer = block_validator_->validate(
+                            *block.value)) {
+                      errors[i] = (boost::format("Block %d is invalid: %s")
+                                   % (begin + i) % answer.reason())
+                                      .str();
+                      return;
+                    }
+                    blocks[i] = std::move(block.value);
+                  },
+                  [&](const auto &error) { errors[i] = error.error.message; });
+        });
+      });
+
+      auto error = std::find_if(errors.begin(),
+                                errors.end(),
+                                [](const auto &e) { return not e.empty(); });
+      if (error != errors.end()) {
+        return expected::makeError(*error);
+      }
+      return std::move(blocks);
+    }
+
+    CommitResult WsvRestorerImpl::commitBlocks(
+        Storage &storage,
+        BlockStorageFactory &storage_factory,
+        const std::vector<BlockPtr> &blocks,
+        const boost::optional<Checkpoint> &checkpoint,
+        bool is_last) {
+      auto command_executor = storage.createCommandExecutor();
+      if (auto error = expected::resultToOptionalError(command_executor)) {
+        return std::move(*error);
+      }
+      std::shared_ptr<CommandExecutor> executor =
+          std::move(expected::resultToOptionalValue(std::move(command_executor))
+                        .value());
+      auto &sql =
+          static_cast<PostgresCommandExecutor &>(*executor).getSession();
+      auto mutable_storage =
+          storage.createMutableStorage(executor, storage_factory);
+
+      auto first = blocks.begin();
+      if (first != blocks.end() and (*first)->height() == 1) {
+        // genesis block has no signatories to check
+        if (not mutable_storage->apply(*first)) {
+          return expected::makeError("Cannot apply genesis block");
+        }
+        ++first;
+      } else if (first != blocks.end() and checkpoint
+                 and (*first)->height() == checkpoint->height + 1) {
+        // the ledger state of the storage is not the one of the checkpoint
+        // when the restoration is resumed, so the first block is linked to
+        // the checkpoint explicitly
+        if ((*first)->prevHash().hex() != checkpoint->hash
+            or not mutable_storage->apply(*first)) {
+          return expected::makeError(
+              (boost::format("Cannot apply block %d") % (*first)->height())
+                  .str());
+        }
+        ++first;
+      }
+      if (first != blocks.end()
+          and not chain_validator_->validateAndApply(
+                  rxcpp::observable<>::iterate(std::vector<BlockPtr>(
+                      first, blocks.end())),
+                  *mutable_storage)) {
+        return expected::makeError(
+            (boost::format("Blocks %d to %d are not signed by a supermajority "
+                           "of peers")
+             % (*first)->height() % blocks.back()->height())
+                .str());
+      }
+
+      try {
+        sql << "DELETE FROM wsv_restore_checkpoint";
+        if (not is_last and not blocks.empty()) {
+          auto height = blocks.back()->height();
+          auto hash = blocks.back()->hash().hex();
+          sql << "INSERT INTO wsv_restore_checkpoint (height, hash) "
+                 "VALUES (:height, :hash)",
+              soci::use(height), soci::use(hash);
+        }
+      } catch (const std::exception &e) {
+        return expected::makeError(
+            std::string{"Cannot write WSV restore checkpoint: "} + e.what());
+      }
+      return storage.commit(std::move(mutable_storage));
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -6,28 +6,122 @@
 #ifndef IROHA_WSVRESTORERIMPL_HPP
 #define IROHA_WSVRESTORERIMPL_HPP
 
-#include "ametsuchi/ledger_state.hpp"
 #include "ametsuchi/wsv_restorer.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <tbb/task_arena.h>
+#include <boost/optional.hpp>
 #include "common/result.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger_fwd.hpp"
+#include "validators/abstract_validator.hpp"
 
 namespace iroha {
+  namespace validation {
+    class ChainValidator;
+  }
+
   namespace ametsuchi {
 
+    class BlockQuery;
+    class BlockStorageFactory;
+
     /**
      * Recover WSV (World State View).
      * @return true on success, otherwise false
      */
     class WsvRestorerImpl : public WsvRestorer {
      public:
+      using BlockValidator = shared_model::validation::AbstractValidator<
+          shared_model::interface::Block>;
+
+      static constexpr size_t kDefaultBlocksPerCommit = 1000;
+
+      /// restorer which applies the blocks serially without validation
+      WsvRestorerImpl() = default;
+
+      /**
+       * Restorer of the fast mode. The blocks are read and validated
+       * statelessly, including the signatures, with a pool of workers, and
+       * are applied if they are signed by a supermajority of the peers.
+       * Every blocks_per_commit blocks are committed in a database
+       * transaction together with the checkpoint, from which an interrupted
+       * restoration is resumed.
+       * @param block_validator - stateless validator of the blocks
+       * @param chain_validator - validator of the signatories and the chain
+       * of the blocks, which applies them
+       * @param workers - number of threads which read and validate blocks
+       * @param blocks_per_commit - number of blocks in a database transaction
+       * @param log - logger
+       */
+      WsvRestorerImpl(
+          std::shared_ptr<BlockValidator> block_validator,
+          std::shared_ptr<validation::ChainValidator> chain_validator,
+          size_t workers,
+          size_t blocks_per_commit,
+          logger::LoggerPtr log);
+
       virtual ~WsvRestorerImpl() = default;
+
       /**
        * Recover WSV (World State View).
-       * Drop storage and apply blocks one by one.
+       * Drop storage and apply blocks one by one, or resume the fast
+       * restoration from the checkpoint.
        * @param storage of blocks in ledger
        * @return ledger state after restoration on success, otherwise error
        * string
        */
       CommitResult restoreWsv(Storage &storage) override;
+
+     private:
+      using BlockPtr = std::shared_ptr<shared_model::interface::Block>;
+
+      /// last block applied by an interrupted fast restoration
+      struct Checkpoint {
+        shared_model::interface::types::HeightType height;
+        std::string hash;
+      };
+
+      CommitResult restoreFast(Storage &storage);
+
+      /**
+       * Read the checkpoint of an interrupted restoration
+       * @return checkpoint, or none if there is no one for the stored blocks
+       */
+      expected::Result<boost::optional<Checkpoint>, std::string>
+      readCheckpoint(Storage &storage,
+                     BlockQuery &block_query,
+                     shared_model::interface::types::HeightType top_height);
+
+      /**
+       * Read and validate the blocks of the heights [begin, end] in parallel
+       * @return blocks in the order of the heights, or the first error
+       */
+      expected::Result<std::vector<BlockPtr>, std::string> loadBlocks(
+          BlockQuery &block_query,
+          shared_model::interface::types::HeightType begin,
+          shared_model::interface::types::HeightType end);
+
+      /**
+       * Apply the blocks and update the checkpoint in one transaction
+       * @param checkpoint - checkpoint which the restoration is resumed from,
+       * none if the blocks follow the committed ledger state
+       * @param is_last - whether the blocks are the last ones of the ledger,
+       * so the checkpoint is removed
+       */
+      CommitResult commitBlocks(Storage &storage,
+                                BlockStorageFactory &storage_factory,
+                                const std::vector<BlockPtr> &blocks,
+                                const boost::optional<Checkpoint> &checkpoint,
+                                bool is_last);
+
+      std::shared_ptr<BlockValidator> block_validator_;
+      std::shared_ptr<validation::ChainValidator> chain_validator_;
+      std::unique_ptr<tbb::task_arena> workers_;
+      size_t blocks_per_commit_ = kDefaultBlocksPerCommit;
+      logger::LoggerPtr log_;
     };
 
   }  // namespace ametsuchi
@@ -0,0 +1,25 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/wsv_snapshot.hpp"
+
+#include "cryptography/default_hash_provider.hpp"
+
+using namespace iroha::ametsuchi;
+
+shared_model::crypto::Hash WsvSnapshot::digest() const {
+  using shared_model::crypto::DefaultHashProvider;
+  auto header = std::to_string(height) + '\0' + block_hash.hex();
+  if (not state_digest.empty()) {
+    header += '\0' + state_digest;
+  }
+  auto digest =
+      DefaultHashProvider::makeHash(shared_model::crypto::Blob(header));
+  for (const auto &chunk : rows) {
+    digest = DefaultHashProvider::makeHash(shared_model::crypto::Blob(
+        digest.hex() + '\0' + chunk.table + '\0' + chunk.rows));
+  }
+  return digest;
+}
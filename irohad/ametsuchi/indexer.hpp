@@ -8,6 +8,8 @@
 
 #include <string>
 
+#include <boost/utility/string_view.hpp>
+
 #include "common/result.hpp"
 #include "interfaces/common_objects/types.hpp"
 
@@ -49,10 +51,19 @@ namespace iroha {
           TxPosition position) = 0;
 
       /// Index account asset tx position by involved account and asset.
-      virtual void accountAssetTxPosition(
-          const shared_model::interface::types::AccountIdType &account_id,
-          const shared_model::interface::types::AssetIdType &asset_id,
-          TxPosition position) = 0;
+      virtual void accountAssetTxPosition(boost::string_view account_id,
+                                          boost::string_view asset_id,
+                                          TxPosition position) = 0;
+
+      /// Store the height and the hash of the last indexed block.
+      virtual void topBlock(
+          shared_model::interface::types::HeightType height,
+          const shared_model::interface::types::HashType &hash) = 0;
+
+      /// Store the height of the last block whose tx positions by creator
+      /// and by account asset are indexed.
+      virtual void historyHeight(
+          shared_model::interface::types::HeightType height) = 0;
 
       /**
        * Flush the indices to storage.
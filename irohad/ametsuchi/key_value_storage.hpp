@@ -51,6 +51,14 @@ namespace iroha {
 
       virtual void dropAll() = 0;
 
+      /**
+       * Make the added entities durable
+       * @return true if the data is written to the disk
+       */
+      virtual bool flush() {
+        return true;
+      }
+
       virtual ~KeyValueStorage() = default;
     };
   }  // namespace ametsuchi
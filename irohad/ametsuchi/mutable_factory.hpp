@@ -44,8 +44,14 @@ namespace iroha {
       virtual CommitResult commit(
           std::unique_ptr<MutableStorage> mutableStorage) = 0;
 
-      /// Check if prepared commits are enabled.
-      virtual bool preparedCommitEnabled() const = 0;
+      /**
+       * Check if the prepared state can be committed as the given block
+       * @param block - the block agreed by the consensus
+       * @return whether prepared commits are enabled and the state is prepared
+       * from the transactions of the block
+       */
+      virtual bool preparedCommitEnabled(
+          const shared_model::interface::Block &block) const = 0;
 
       /**
        * Try to apply prepared block to Ametsuchi.
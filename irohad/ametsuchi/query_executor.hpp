@@ -7,6 +7,7 @@
 #define IROHA_QUERY_EXECUTOR_HPP
 
 #include <memory>
+#include <vector>
 
 namespace shared_model {
   namespace interface {
@@ -22,6 +23,9 @@ namespace iroha {
     using QueryExecutorResult =
         std::unique_ptr<shared_model::interface::QueryResponse>;
 
+    using QueryBatchType =
+        std::vector<std::unique_ptr<shared_model::interface::Query>>;
+
     class QueryExecutor {
      public:
       virtual ~QueryExecutor() = default;
@@ -35,6 +39,17 @@ namespace iroha {
           const shared_model::interface::Query &query,
           const bool validate_signatories) = 0;
 
+      /**
+       * Execute and validate the queries of a batch in one read-only
+       * snapshot of the ledger. The queries have the same creator and
+       * signatory, so the signatories are validated once for all of them
+       * @param queries to validate and execute
+       * @param validate_signatories - if signatories should be validated
+       * @return responses in the order of the queries
+       */
+      virtual std::vector<QueryExecutorResult> validateAndExecuteBatch(
+          const QueryBatchType &queries, const bool validate_signatories) = 0;
+
       /**
        * Perform BlocksQuery validation
        * @param query to validate
@@ -43,6 +58,14 @@ namespace iroha {
        */
       virtual bool validate(const shared_model::interface::BlocksQuery &query,
                             const bool validate_signatories) = 0;
+
+      /**
+       * Validate signatories of the query without executing it
+       * @param query to validate
+       * @return true if valid, false otherwise
+       */
+      virtual bool validateSignatories(
+          const shared_model::interface::Query &query) = 0;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -8,8 +8,22 @@
 
 #include <memory>
 
+#include "common/counter.hpp"
+
 namespace iroha {
   namespace ametsuchi {
+    /**
+     * Reconnection counters shared by all the connections of the pools
+     */
+    struct ReconnectionStatistics {
+      /// lost connections, for which reconnection has started
+      std::shared_ptr<Counter> failovers = std::make_shared<Counter>();
+      /// attempts to reconnect
+      std::shared_ptr<Counter> attempts = std::make_shared<Counter>();
+      /// reconnections which have run out of attempts
+      std::shared_ptr<Counter> exhausted = std::make_shared<Counter>();
+    };
+
     /**
      * Class provides an interface for reconnection condition.
      */
@@ -15,6 +15,7 @@
 #include "ametsuchi/query_executor_factory.hpp"
 #include "ametsuchi/setting_query_factory.hpp"
 #include "ametsuchi/temporary_factory.hpp"
+#include "ametsuchi/wsv_snapshot_factory.hpp"
 #include "common/result.hpp"
 
 namespace shared_model {
@@ -40,7 +41,8 @@ namespace iroha {
                     public PeerQueryFactory,
                     public BlockQueryFactory,
                     public QueryExecutorFactory,
-                    public SettingQueryFactory {
+                    public SettingQueryFactory,
+                    public WsvSnapshotFactory {
      public:
       virtual std::shared_ptr<WsvQuery> getWsvQuery() const = 0;
 
@@ -98,6 +100,13 @@ namespace iroha {
        */
       virtual expected::Result<void, std::string> resetWsv() = 0;
 
+      /**
+       * Replace WSV with the snapshot taken by another peer
+       * @param snapshot - verified snapshot
+       * @return ledger state of the snapshot on success, otherwise error
+       */
+      virtual CommitResult restoreWsvSnapshot(const WsvSnapshot &snapshot) = 0;
+
       /**
        * Removes all peers from WSV
        */
@@ -7,7 +7,10 @@
 #define IROHA_TEMPORARY_FACTORY_HPP
 
 #include <memory>
+#include <vector>
+
 #include "common/result.hpp"
+#include "interfaces/common_objects/types.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -32,8 +35,14 @@ namespace iroha {
        * After preparation, this state is not visible until commited.
        *
        * @param wsv - state which will be prepared.
+       * @param transaction_hashes - hashes of the transactions applied to the
+       * state in their order, the state is committed only as the block of the
+       * same transactions
        */
-      virtual void prepareBlock(std::unique_ptr<TemporaryWsv> wsv) = 0;
+      virtual void prepareBlock(
+          std::unique_ptr<TemporaryWsv> wsv,
+          std::vector<shared_model::interface::types::HashType>
+              transaction_hashes) = 0;
 
       virtual ~TemporaryFactory() = default;
     };
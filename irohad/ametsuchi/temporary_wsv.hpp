@@ -7,6 +7,7 @@
 #define IROHA_TEMPORARYWSV_HPP
 
 #include <functional>
+#include <vector>
 
 #include "common/result.hpp"
 #include "validation/stateful_validator_common.hpp"
@@ -26,6 +27,9 @@ namespace iroha {
      */
     class TemporaryWsv {
      public:
+      using TransactionRefs = std::vector<
+          std::reference_wrapper<const shared_model::interface::Transaction>>;
+
       /**
        * Wrapper for savepoints in wsv state; rollbacks to savepoint, if
        * destroyed without explicit release, releases it otherwise
@@ -47,6 +51,33 @@ namespace iroha {
       virtual expected::Result<void, validation::CommandError> apply(
           const shared_model::interface::Transaction &transaction) = 0;
 
+      /**
+       * Applies transactions to current state one after another, each of them
+       * is applied or rejected as by apply
+       * @param transactions - transactions to be applied
+       * @return result of each transaction in their order
+       */
+      virtual std::vector<expected::Result<void, validation::CommandError>>
+      applyTransactions(const TransactionRefs &transactions) {
+        std::vector<expected::Result<void, validation::CommandError>> results;
+        results.reserve(transactions.size());
+        for (const auto &transaction : transactions) {
+          results.push_back(apply(transaction));
+        }
+        return results;
+      }
+
+      /**
+       * Applies a transaction, which has already passed the validation on the
+       * same state, without checking its signatures and permissions again
+       * @param transaction - transaction to be applied
+       * @return error of the first failed command, if any
+       */
+      virtual expected::Result<void, validation::CommandError> applyValidated(
+          const shared_model::interface::Transaction &transaction) {
+        return apply(transaction);
+      }
+
       /**
        * Create a savepoint for wsv state
        * @param name of savepoint to be created
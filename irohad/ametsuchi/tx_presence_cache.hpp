@@ -48,6 +48,14 @@ namespace iroha {
       virtual boost::optional<BatchStatusCollectionType> check(
           const shared_model::interface::TransactionBatch &batch) const = 0;
 
+      /**
+       * Check statuses of many transactions at once
+       * @return a collection with answers about each hash in the order of the
+       * hashes if storage queries were successful, boost::none otherwise
+       */
+      virtual boost::optional<BatchStatusCollectionType> check(
+          const std::vector<shared_model::crypto::Hash> &hashes) const = 0;
+
       // TODO: 09/11/2018 @muratovv add method for processing collection of
       // batches IR-1857
 
@@ -45,6 +45,16 @@ namespace iroha {
       virtual boost::optional<std::shared_ptr<shared_model::interface::Peer>>
       getPeerByPublicKey(
           const shared_model::interface::types::PubkeyType &public_key) = 0;
+
+      /**
+       * Fetch the digest of the WSV state after the block, which is the sum
+       * of the hashes of the rows and does not depend on their order, so the
+       * states of the peers are compared without reading the rows
+       * @param height - height of the block
+       * @return the digest as a decimal number, none if it is not known
+       */
+      virtual boost::optional<std::string> getStateDigest(
+          shared_model::interface::types::HeightType height) = 0;
     };
 
   }  // namespace ametsuchi
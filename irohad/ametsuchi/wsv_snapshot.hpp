@@ -0,0 +1,48 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_SNAPSHOT_HPP
+#define IROHA_WSV_SNAPSHOT_HPP
+
+#include <string>
+#include <vector>
+
+#include "cryptography/hash.hpp"
+#include "interfaces/common_objects/types.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Consistent copy of the WSV tables taken at a block, so a peer can
+     * import it instead of applying all the blocks up to that one
+     */
+    struct WsvSnapshot {
+      /// part of the rows of a table
+      struct Rows {
+        std::string table;
+        /// JSON array of the rows
+        std::string rows;
+      };
+
+      shared_model::interface::types::HeightType height;
+      shared_model::crypto::Hash block_hash;
+      std::vector<Rows> rows;
+      /// digest of the WSV state at the block, as the decimal number kept
+      /// by the database, or empty if the snapshot is made without it
+      std::string state_digest;
+
+      /**
+       * Digest which chains the hashes of the block and of all rows, so the
+       * transferred snapshot is verified
+       * @return snapshot digest
+       */
+      shared_model::crypto::Hash digest() const;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_SNAPSHOT_HPP
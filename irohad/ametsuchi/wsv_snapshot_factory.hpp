@@ -0,0 +1,28 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_SNAPSHOT_FACTORY_HPP
+#define IROHA_WSV_SNAPSHOT_FACTORY_HPP
+
+#include "ametsuchi/wsv_snapshot.hpp"
+#include "common/result.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+    class WsvSnapshotFactory {
+     public:
+      /**
+       * Creates a snapshot of WSV at the last applied block
+       * @return snapshot or error message
+       */
+      virtual expected::Result<WsvSnapshot, std::string>
+      createWsvSnapshot() const = 0;
+
+      virtual ~WsvSnapshotFactory() = default;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_SNAPSHOT_FACTORY_HPP
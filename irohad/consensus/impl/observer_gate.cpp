@@ -0,0 +1,90 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/observer_gate.hpp"
+
+#include "interfaces/common_objects/peer.hpp"
+#include "logger/logger.hpp"
+#include "network/block_loader.hpp"
+
+namespace {
+  /// the polls are scheduled by the gate itself, so the queue holds one
+  constexpr size_t kQueuedPolls = 1;
+}  // namespace
+
+namespace iroha {
+  namespace consensus {
+
+    constexpr std::chrono::milliseconds ObserverGate::kDefaultPollInterval;
+
+    ObserverGate::ObserverGate(
+        std::shared_ptr<network::BlockLoader> block_loader,
+        std::chrono::milliseconds poll_interval,
+        logger::LoggerPtr log)
+        : block_loader_(std::move(block_loader)),
+          poll_interval_(poll_interval),
+          log_(std::move(log)),
+          executor_("observer", kQueuedPolls) {}
+
+    ObserverGate::~ObserverGate() {
+      outcomes_.get_subscriber().on_completed();
+    }
+
+    void ObserverGate::start(std::shared_ptr<const LedgerState> ledger_state) {
+      updateLedgerState(std::move(ledger_state));
+      executor_.post([this] { poll(); });
+    }
+
+    void ObserverGate::updateLedgerState(
+        std::shared_ptr<const LedgerState> ledger_state) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ledger_state_ = std::move(ledger_state);
+    }
+
+    void ObserverGate::vote(const simulator::BlockCreatorEvent &) {
+      log_->debug("Observer does not vote");
+    }
+
+    rxcpp::observable<GateObject> ObserverGate::onOutcome() {
+      return outcomes_.get_observable();
+    }
+
+    void ObserverGate::poll() {
+      std::shared_ptr<const LedgerState> ledger_state;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ledger_state = ledger_state_;
+      }
+      const auto height = ledger_state->top_block_info.height;
+      shared_model::interface::types::PublicKeyCollectionType public_keys;
+      for (const auto &peer : ledger_state->ledger_peers) {
+        public_keys.push_back(peer->pubkey());
+      }
+
+      bool advanced = false;
+      for (const auto &public_key : public_keys) {
+        if (block_loader_->retrieveBlock(public_key, height + 1)) {
+          log_->info("Block {} is committed by the ledger peers", height + 1);
+          // the synchronizer downloads all the blocks the peers have and
+          // updates the ledger state before the emission returns
+          outcomes_.get_subscriber().on_next(Future{
+              Round{height + 2, 0}, ledger_state, std::move(public_keys)});
+          std::lock_guard<std::mutex> lock(mutex_);
+          advanced = ledger_state_ != ledger_state;
+          break;
+        }
+      }
+
+      // the peers are polled again right away while the observer catches up
+      if (advanced) {
+        executor_.post([this] { poll(); });
+      } else {
+        executor_.postAt(StageExecutor::Clock::now() + poll_interval_,
+                         [this] { poll(); });
+      }
+    }
+
+  }  // namespace consensus
+}  // namespace iroha
@@ -0,0 +1,86 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_OBSERVER_GATE_HPP
+#define IROHA_OBSERVER_GATE_HPP
+
+#include "network/consensus_gate.hpp"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+#include <rxcpp/rx-lite.hpp>
+#include "common/stage_executor.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace network {
+    class BlockLoader;
+  }  // namespace network
+
+  namespace consensus {
+
+    /**
+     * Consensus gate of an observer peer, which follows the chain of the
+     * ledger peers without taking part in the consensus. The gate polls the
+     * ledger peers for the block following its top one, and emits the future
+     * outcome, so the synchronizer downloads the new blocks from them. The
+     * votes are ignored
+     */
+    class ObserverGate : public network::ConsensusGate {
+     public:
+      /// time between the polls when the observer is synchronized
+      static constexpr std::chrono::milliseconds kDefaultPollInterval{1000};
+
+      /**
+       * @param block_loader - loader of the blocks of the ledger peers
+       * @param poll_interval - time between the polls
+       * @param log - logger
+       */
+      ObserverGate(std::shared_ptr<network::BlockLoader> block_loader,
+                   std::chrono::milliseconds poll_interval,
+                   logger::LoggerPtr log);
+
+      ~ObserverGate() override;
+
+      /**
+       * Start polling the ledger peers
+       * @param ledger_state - state of the ledger of the top block
+       */
+      void start(std::shared_ptr<const LedgerState> ledger_state);
+
+      /**
+       * Follow the ledger state after the synchronization, the polls request
+       * the block following its top one from its peers
+       */
+      void updateLedgerState(std::shared_ptr<const LedgerState> ledger_state);
+
+      void vote(const simulator::BlockCreatorEvent &event) override;
+
+      rxcpp::observable<GateObject> onOutcome() override;
+
+     private:
+      /// request the next block, emit the outcome if a peer has it
+      void poll();
+
+      std::shared_ptr<network::BlockLoader> block_loader_;
+      const std::chrono::milliseconds poll_interval_;
+      logger::LoggerPtr log_;
+
+      std::mutex mutex_;
+      std::shared_ptr<const LedgerState> ledger_state_;
+
+      rxcpp::subjects::subject<GateObject> outcomes_;
+
+      /// declared last, so the polls complete before the other members are
+      /// destroyed
+      StageExecutor executor_;
+    };
+
+  }  // namespace consensus
+}  // namespace iroha
+
+#endif  // IROHA_OBSERVER_GATE_HPP
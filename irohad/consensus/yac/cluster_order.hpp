@@ -13,6 +13,9 @@
 #include "consensus/yac/yac_types.hpp"
 
 namespace shared_model {
+  namespace crypto {
+    class PublicKey;
+  }
   namespace interface {
     class Peer;
   }
@@ -36,6 +39,29 @@ namespace iroha {
             const std::vector<std::shared_ptr<shared_model::interface::Peer>>
                 &order);
 
+        /**
+         * Creates cluster ordering from the permutation of the peers, which
+         * does not sort the peers by their keys again
+         * @param peers - the peers
+         * @param permutation - indices of the peers in the order
+         * @param peers_by_key - indices of the peers sorted by their public
+         * keys, \see sortByKey
+         * @return none if there are no peers
+         */
+        static boost::optional<ClusterOrdering> create(
+            const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+                &peers,
+            const std::vector<PeersNumberType> &permutation,
+            const std::vector<PeersNumberType> &peers_by_key);
+
+        /**
+         * @param peers - the peers
+         * @return indices of the peers sorted by their public keys
+         */
+        static std::vector<PeersNumberType> sortByKey(
+            const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+                &peers);
+
         /**
          * Provide current leader peer
          */
@@ -57,16 +83,30 @@ namespace iroha {
 
         PeersNumberType getNumberOfPeers() const;
 
+        /**
+         * Find the peer by its public key in O(log n) without allocations
+         * @param pubkey - binary public key of the peer
+         * @return index of the peer in the ordering, or none if the peer is
+         * not in the ordering
+         */
+        boost::optional<PeersNumberType> peerIndex(
+            const shared_model::crypto::PublicKey &pubkey) const;
+        boost::optional<PeersNumberType> peerIndex(const uint8_t *pubkey,
+                                                   size_t size) const;
+
         virtual ~ClusterOrdering() = default;
 
         ClusterOrdering() = delete;
 
        private:
         // prohibit creation of the object not from create method
-        explicit ClusterOrdering(
-            std::vector<std::shared_ptr<shared_model::interface::Peer>> order);
+        ClusterOrdering(
+            std::vector<std::shared_ptr<shared_model::interface::Peer>> order,
+            std::vector<PeersNumberType> sorted_indices);
 
         std::vector<std::shared_ptr<shared_model::interface::Peer>> order_;
+        /// indices of order_ sorted by public keys
+        std::vector<PeersNumberType> sorted_indices_;
         PeersNumberType index_ = 0;
       };
     }  // namespace yac
@@ -0,0 +1,82 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_YAC_COMMIT_CERTIFICATE_HPP
+#define IROHA_YAC_COMMIT_CERTIFICATE_HPP
+
+#include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include "consensus/yac/vote_message.hpp"
+#include "cryptography/public_key.hpp"
+#include "cryptography/signed.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Peer;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      /**
+       * Compact form of a supermajority of votes for the same hash: round and
+       * hashes are stored once, and the signatories are referenced by their
+       * positions in the cluster peers sorted by public key instead of the
+       * public keys
+       */
+      struct CommitCertificate {
+        /// signatures of a single voting peer
+        struct Signatures {
+          shared_model::crypto::Signed vote_signature;
+          boost::optional<shared_model::crypto::Signed> block_signature;
+          /// set only when the block is signed not by the voting peer
+          boost::optional<shared_model::crypto::PublicKey>
+              block_signature_pubkey;
+        };
+
+        /// vote round and hashes, block signature is not set
+        YacHash hash;
+
+        /// signatories flags, indexed by position in the sorted cluster peers
+        std::vector<bool> signers;
+
+        /// signatures in the order of the set signers flags
+        std::vector<Signatures> signatures;
+      };
+
+      /**
+       * Create the certificate from the given votes
+       * @param votes - votes for the same hash
+       * @param peers - cluster peers
+       * @return certificate, or none if the votes are for different hashes,
+       * are signed by the same or unknown peers
+       */
+      boost::optional<CommitCertificate> makeCommitCertificate(
+          const std::vector<VoteMessage> &votes,
+          const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+              &peers);
+
+      /**
+       * Restore the votes from the certificate
+       * @param certificate - the certificate
+       * @param peers - cluster peers of the certificate round
+       * @return votes, or none if signers do not match the peers
+       * Note: signers of a certificate for another set of peers can not be
+       * detected here, such votes fail the signature verification
+       */
+      boost::optional<std::vector<VoteMessage>> expandCommitCertificate(
+          const CommitCertificate &certificate,
+          const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+              &peers);
+
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
+
+#endif  // IROHA_YAC_COMMIT_CERTIFICATE_HPP
@@ -0,0 +1,91 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_YAC_COMPACT_VOTE_HPP
+#define IROHA_YAC_COMPACT_VOTE_HPP
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+#include <boost/optional.hpp>
+#include "consensus/round.hpp"
+#include "consensus/yac/vote_message.hpp"
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      /**
+       * Fixed-size representation of a vote for the default ed25519 keys:
+       * hashes are stored in binary form, and the vote occupies a single
+       * object without heap allocations
+       */
+      struct CompactVote {
+        static constexpr size_t kHashLength = 32;
+        static constexpr size_t kPublicKeyLength = 32;
+        static constexpr size_t kSignatureLength = 64;
+
+        using Hash = std::array<uint8_t, kHashLength>;
+        using PublicKey = std::array<uint8_t, kPublicKeyLength>;
+        using Signature = std::array<uint8_t, kSignatureLength>;
+
+        /// bits of flags field
+        enum Flags : uint8_t {
+          kHasProposalHash = 1,
+          kHasBlockHash = 1 << 1,
+          kHasBlockSignature = 1 << 2,
+        };
+
+        struct SignatureData {
+          PublicKey public_key;
+          Signature signature;
+        };
+
+        BlockRoundType block_round;
+        RejectRoundType reject_round;
+        /// empty hashes and missing block signature are denoted by flags
+        uint8_t flags;
+        Hash proposal_hash;
+        Hash block_hash;
+        SignatureData signature;
+        SignatureData block_signature;
+
+        Round round() const {
+          return Round{block_round, reject_round};
+        }
+      };
+
+      /**
+       * Decode the hash of a vote to the binary form without allocation
+       * @param hex - lowercase hex hash, as produced by the hash provider
+       * @param[out] hash - decoded hash
+       * @return false if the hash is not a lowercase hex string of
+       * CompactVote::kHashLength bytes
+       */
+      bool decodeVoteHash(const std::string &hex, CompactVote::Hash &hash);
+
+      /**
+       * Encode the binary hash to the lowercase hex form of the vote hashes
+       */
+      std::string encodeVoteHash(const CompactVote::Hash &hash);
+
+      /**
+       * Create the compact vote with the same contents
+       * @return compact vote, or none if the vote is not representable,
+       * for instance, has keys of non-default length
+       */
+      boost::optional<CompactVote> makeCompactVote(const VoteMessage &vote);
+
+      /**
+       * Restore the vote which is used by the consensus storage
+       */
+      VoteMessage toVoteMessage(const CompactVote &vote);
+
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
+
+#endif  // IROHA_YAC_COMPACT_VOTE_HPP
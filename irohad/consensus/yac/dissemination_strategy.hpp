@@ -0,0 +1,50 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_YAC_DISSEMINATION_STRATEGY_HPP
+#define IROHA_YAC_DISSEMINATION_STRATEGY_HPP
+
+#include <memory>
+#include <vector>
+
+namespace shared_model {
+  namespace interface {
+    class Peer;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      class ClusterOrdering;
+
+      /**
+       * Interface provide the choice of peers, which receive the collected
+       * outcome of the round
+       */
+      class DisseminationStrategy {
+       public:
+        /**
+         * Select the recipients of the outcome
+         * @param order - cluster order of the round
+         * @return peers to send the outcome
+         */
+        virtual std::vector<std::shared_ptr<shared_model::interface::Peer>>
+        recipients(const ClusterOrdering &order) = 0;
+
+        /**
+         * @return true if the outcome received from another peer has to be
+         * sent further, false if every peer receives it from the collector
+         */
+        virtual bool forwardsReceived() const = 0;
+
+        virtual ~DisseminationStrategy() = default;
+      };
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
+
+#endif  // IROHA_YAC_DISSEMINATION_STRATEGY_HPP
@@ -0,0 +1,104 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/yac/impl/adaptive_timer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "consensus/yac/supermajority_checker.hpp"
+#include "cryptography/public_key.hpp"
+
+namespace {
+  /// gain of the smoothed latency, alpha of RFC 6298
+  constexpr double kLatencyGain = 1. / 8;
+  /// gain of the latency variation, beta of RFC 6298
+  constexpr double kVariationGain = 1. / 4;
+  /// weight of the variation in the timeout, K of RFC 6298
+  constexpr double kVariationWeight = 4;
+}  // namespace
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      double AdaptiveTimer::Estimation::timeout() const {
+        return smoothed_latency + kVariationWeight * latency_variation;
+      }
+
+      AdaptiveTimer::AdaptiveTimer(
+          std::chrono::milliseconds initial_delay,
+          std::chrono::milliseconds min_delay,
+          std::chrono::milliseconds max_delay,
+          std::shared_ptr<SupermajorityChecker> supermajority_checker,
+          rxcpp::observe_on_one_worker coordination)
+          : TimerImpl(initial_delay, std::move(coordination)),
+            min_delay_(min_delay),
+            max_delay_(max_delay),
+            supermajority_checker_(std::move(supermajority_checker)),
+            current_delay_(
+                std::min(std::max(initial_delay, min_delay_), max_delay_)),
+            delays_(Histogram::exponentialBounds(10, 2, 12)) {}
+
+      void AdaptiveTimer::onVoteLatency(
+          const shared_model::crypto::PublicKey &peer,
+          std::chrono::milliseconds latency) {
+        const double sample = latency.count();
+
+        std::lock_guard<std::mutex> lock(estimations_mutex_);
+        auto it = estimations_.find(peer.hex());
+        if (it == estimations_.end()) {
+          estimations_.emplace(peer.hex(), Estimation{sample, sample / 2});
+        } else {
+          auto &estimation = it->second;
+          estimation.latency_variation =
+              (1 - kVariationGain) * estimation.latency_variation
+              + kVariationGain
+                  * std::abs(estimation.smoothed_latency - sample);
+          estimation.smoothed_latency =
+              (1 - kLatencyGain) * estimation.smoothed_latency
+              + kLatencyGain * sample;
+        }
+
+        std::vector<double> timeouts;
+        timeouts.reserve(estimations_.size());
+        for (const auto &estimation : estimations_) {
+          timeouts.push_back(estimation.second.timeout());
+        }
+        std::sort(timeouts.begin(), timeouts.end());
+
+        // the round can not be finished before a supermajority of votes
+        size_t required = timeouts.size();
+        while (required > 1
+               and supermajority_checker_->hasSupermajority(required - 1,
+                                                            timeouts.size())) {
+          --required;
+        }
+
+        std::chrono::milliseconds timeout(
+            static_cast<std::chrono::milliseconds::rep>(
+                std::ceil(timeouts[required - 1])));
+        current_delay_ = std::min(std::max(timeout, min_delay_), max_delay_);
+      }
+
+      std::chrono::milliseconds AdaptiveTimer::currentDelay() const {
+        std::lock_guard<std::mutex> lock(estimations_mutex_);
+        return current_delay_;
+      }
+
+      const Histogram &AdaptiveTimer::delays() const {
+        return delays_;
+      }
+
+      std::chrono::milliseconds AdaptiveTimer::delay() {
+        auto delay = currentDelay();
+        delays_.observe(delay.count());
+        return delay;
+      }
+
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
@@ -0,0 +1,91 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_YAC_ADAPTIVE_TIMER_HPP
+#define IROHA_YAC_ADAPTIVE_TIMER_HPP
+
+#include "consensus/yac/impl/timer_impl.hpp"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "common/histogram.hpp"
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      class SupermajorityChecker;
+
+      /// bounds of the delay of the adaptive timer
+      struct VoteDelayBounds {
+        std::chrono::milliseconds min_delay;
+        std::chrono::milliseconds max_delay;
+      };
+
+      /**
+       * Timer with the delay derived from the measured vote latencies of the
+       * peers. Every peer has the smoothed latency and its variation, which
+       * are updated as the retransmission timeout estimation of TCP
+       * (RFC 6298). The delay is the timeout of the slowest peer among the
+       * fastest ones which form a supermajority, bounded by the configured
+       * minimum and maximum.
+       */
+      class AdaptiveTimer : public TimerImpl {
+       public:
+        /**
+         * @param initial_delay - delay before any latency is measured
+         * @param min_delay - lower bound of the delay
+         * @param max_delay - upper bound of the delay
+         * @param supermajority_checker - defines the number of peers which
+         * votes are awaited
+         * @param coordination - factory for coordinators to run the timer on
+         */
+        AdaptiveTimer(
+            std::chrono::milliseconds initial_delay,
+            std::chrono::milliseconds min_delay,
+            std::chrono::milliseconds max_delay,
+            std::shared_ptr<SupermajorityChecker> supermajority_checker,
+            rxcpp::observe_on_one_worker coordination);
+
+        void onVoteLatency(const shared_model::crypto::PublicKey &peer,
+                           std::chrono::milliseconds latency) override;
+
+        /// @return delay of the next invocation
+        std::chrono::milliseconds currentDelay() const;
+
+        /// @return distribution of the delays of the invocations in ms
+        const Histogram &delays() const;
+
+       protected:
+        std::chrono::milliseconds delay() override;
+
+       private:
+        /// latency estimation of a peer in ms
+        struct Estimation {
+          double smoothed_latency;
+          double latency_variation;
+
+          double timeout() const;
+        };
+
+        std::chrono::milliseconds min_delay_;
+        std::chrono::milliseconds max_delay_;
+        std::shared_ptr<SupermajorityChecker> supermajority_checker_;
+
+        mutable std::mutex estimations_mutex_;
+        /// estimations by hex public keys of the peers
+        std::unordered_map<std::string, Estimation> estimations_;
+        std::chrono::milliseconds current_delay_;
+
+        Histogram delays_;
+      };
+
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
+
+#endif  // IROHA_YAC_ADAPTIVE_TIMER_HPP
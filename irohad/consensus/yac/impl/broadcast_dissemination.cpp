@@ -0,0 +1,19 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/yac/impl/broadcast_dissemination.hpp"
+
+#include "consensus/yac/cluster_order.hpp"
+
+using namespace iroha::consensus::yac;
+
+std::vector<std::shared_ptr<shared_model::interface::Peer>>
+BroadcastDissemination::recipients(const ClusterOrdering &order) {
+  return order.getPeers();
+}
+
+bool BroadcastDissemination::forwardsReceived() const {
+  return false;
+}
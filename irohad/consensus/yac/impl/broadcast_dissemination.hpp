@@ -0,0 +1,27 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_YAC_BROADCAST_DISSEMINATION_HPP
+#define IROHA_YAC_BROADCAST_DISSEMINATION_HPP
+
+#include "consensus/yac/dissemination_strategy.hpp"
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      /// The collector sends the outcome to all peers of the cluster
+      class BroadcastDissemination : public DisseminationStrategy {
+       public:
+        std::vector<std::shared_ptr<shared_model::interface::Peer>>
+        recipients(const ClusterOrdering &order) override;
+
+        bool forwardsReceived() const override;
+      };
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
+
+#endif  // IROHA_YAC_BROADCAST_DISSEMINATION_HPP
@@ -5,6 +5,12 @@
 
 #include "consensus/yac/cluster_order.hpp"
 
+#include <algorithm>
+#include <numeric>
+
+#include "cryptography/public_key.hpp"
+#include "interfaces/common_objects/peer.hpp"
+
 namespace iroha {
   namespace consensus {
     namespace yac {
@@ -15,12 +21,49 @@ namespace iroha {
         if (order.empty()) {
           return boost::none;
         }
-        return ClusterOrdering(order);
+        return ClusterOrdering(order, sortByKey(order));
+      }
+
+      boost::optional<ClusterOrdering> ClusterOrdering::create(
+          const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+              &peers,
+          const std::vector<PeersNumberType> &permutation,
+          const std::vector<PeersNumberType> &peers_by_key) {
+        if (peers.empty()) {
+          return boost::none;
+        }
+        std::vector<std::shared_ptr<shared_model::interface::Peer>> order;
+        order.reserve(permutation.size());
+        // position of every peer in the order
+        std::vector<PeersNumberType> positions(peers.size());
+        for (PeersNumberType i = 0; i < permutation.size(); ++i) {
+          order.push_back(peers[permutation[i]]);
+          positions[permutation[i]] = i;
+        }
+        std::vector<PeersNumberType> sorted_indices;
+        sorted_indices.reserve(peers_by_key.size());
+        for (auto index : peers_by_key) {
+          sorted_indices.push_back(positions[index]);
+        }
+        return ClusterOrdering(std::move(order), std::move(sorted_indices));
+      }
+
+      std::vector<PeersNumberType> ClusterOrdering::sortByKey(
+          const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+              &peers) {
+        std::vector<PeersNumberType> indices(peers.size());
+        std::iota(indices.begin(), indices.end(), 0);
+        std::sort(indices.begin(), indices.end(), [&peers](auto lhs, auto rhs) {
+          return peers[lhs]->pubkey().blob() < peers[rhs]->pubkey().blob();
+        });
+        return indices;
       }
 
       ClusterOrdering::ClusterOrdering(
-          std::vector<std::shared_ptr<shared_model::interface::Peer>> order)
-          : order_(std::move(order)) {}
+          std::vector<std::shared_ptr<shared_model::interface::Peer>> order,
+          std::vector<PeersNumberType> sorted_indices)
+          : order_(std::move(order)),
+            sorted_indices_(std::move(sorted_indices)) {}
 
       // TODO :  24/03/2018 x3medima17: make it const, IR-1164
       const shared_model::interface::Peer &ClusterOrdering::currentLeader() {
@@ -48,6 +91,32 @@ namespace iroha {
         return order_.size();
       }
 
+      boost::optional<PeersNumberType> ClusterOrdering::peerIndex(
+          const shared_model::crypto::PublicKey &pubkey) const {
+        return peerIndex(pubkey.blob().data(), pubkey.blob().size());
+      }
+
+      boost::optional<PeersNumberType> ClusterOrdering::peerIndex(
+          const uint8_t *pubkey, size_t size) const {
+        auto key_less = [this, size](PeersNumberType index,
+                                     const uint8_t *key) {
+          const auto &blob = order_[index]->pubkey().blob();
+          return std::lexicographical_compare(
+              blob.begin(), blob.end(), key, key + size);
+        };
+        auto it = std::lower_bound(
+            sorted_indices_.begin(), sorted_indices_.end(), pubkey, key_less);
+        if (it == sorted_indices_.end()) {
+          return boost::none;
+        }
+        const auto &blob = order_[*it]->pubkey().blob();
+        if (blob.size() != size
+            or not std::equal(blob.begin(), blob.end(), pubkey)) {
+          return boost::none;
+        }
+        return *it;
+      }
+
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
@@ -0,0 +1,123 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/yac/commit_certificate.hpp"
+
+#include <algorithm>
+
+#include "backend/plain/signature.hpp"
+#include "interfaces/common_objects/peer.hpp"
+
+using PeerList = std::vector<std::shared_ptr<shared_model::interface::Peer>>;
+
+namespace {
+  /// cluster peers in the order of certificate signers
+  PeerList sortedPeers(const PeerList &peers) {
+    auto sorted = peers;
+    std::sort(sorted.begin(),
+              sorted.end(),
+              [](const auto &lhs, const auto &rhs) {
+                return lhs->pubkey().blob() < rhs->pubkey().blob();
+              });
+    return sorted;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      boost::optional<CommitCertificate> makeCommitCertificate(
+          const std::vector<VoteMessage> &votes, const PeerList &peers) {
+        if (votes.empty()) {
+          return boost::none;
+        }
+
+        auto sorted = sortedPeers(peers);
+        std::vector<const VoteMessage *> signer_votes(sorted.size(), nullptr);
+        for (const auto &vote : votes) {
+          if (vote.hash != votes.front().hash) {
+            return boost::none;
+          }
+          auto it = std::find_if(
+              sorted.begin(), sorted.end(), [&](const auto &peer) {
+                return peer->pubkey() == vote.signature->publicKey();
+              });
+          if (it == sorted.end()) {
+            return boost::none;
+          }
+          auto &signer_vote = signer_votes[it - sorted.begin()];
+          if (signer_vote != nullptr) {
+            return boost::none;
+          }
+          signer_vote = &vote;
+        }
+
+        CommitCertificate certificate;
+        certificate.hash.vote_round = votes.front().hash.vote_round;
+        certificate.hash.vote_hashes = votes.front().hash.vote_hashes;
+        certificate.signers.reserve(sorted.size());
+        certificate.signatures.reserve(votes.size());
+        for (const auto *vote : signer_votes) {
+          certificate.signers.push_back(vote != nullptr);
+          if (vote == nullptr) {
+            continue;
+          }
+          CommitCertificate::Signatures signatures{
+              vote->signature->signedData(), boost::none, boost::none};
+          if (auto &block_signature = vote->hash.block_signature) {
+            signatures.block_signature = block_signature->signedData();
+            if (block_signature->publicKey() != vote->signature->publicKey()) {
+              signatures.block_signature_pubkey = block_signature->publicKey();
+            }
+          }
+          certificate.signatures.push_back(std::move(signatures));
+        }
+        return certificate;
+      }
+
+      boost::optional<std::vector<VoteMessage>> expandCommitCertificate(
+          const CommitCertificate &certificate, const PeerList &peers) {
+        // signers may be padded with unset flags
+        if (certificate.signers.size() < peers.size()
+            or std::any_of(certificate.signers.begin() + peers.size(),
+                           certificate.signers.end(),
+                           [](bool signer) { return signer; })
+            or static_cast<size_t>(std::count(certificate.signers.begin(),
+                                              certificate.signers.end(),
+                                              true))
+                != certificate.signatures.size()) {
+          return boost::none;
+        }
+
+        auto sorted = sortedPeers(peers);
+        std::vector<VoteMessage> votes;
+        votes.reserve(certificate.signatures.size());
+        auto signatures = certificate.signatures.begin();
+        for (size_t i = 0; i < sorted.size(); ++i) {
+          if (not certificate.signers[i]) {
+            continue;
+          }
+          const auto &pubkey = sorted[i]->pubkey();
+          VoteMessage vote;
+          vote.hash.vote_round = certificate.hash.vote_round;
+          vote.hash.vote_hashes = certificate.hash.vote_hashes;
+          if (signatures->block_signature) {
+            vote.hash.block_signature =
+                std::make_shared<shared_model::plain::Signature>(
+                    *signatures->block_signature,
+                    signatures->block_signature_pubkey.value_or(pubkey));
+          }
+          vote.signature = std::make_shared<shared_model::plain::Signature>(
+              signatures->vote_signature, pubkey);
+          votes.push_back(std::move(vote));
+          ++signatures;
+        }
+        return votes;
+      }
+
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
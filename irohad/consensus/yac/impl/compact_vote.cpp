@@ -0,0 +1,143 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/yac/compact_vote.hpp"
+
+#include <algorithm>
+
+#include "backend/plain/signature.hpp"
+
+using namespace iroha::consensus::yac;
+
+namespace {
+  /// @return value of lowercase hex digit, or -1 for other characters
+  int hexDigit(char c) {
+    if (c >= '0' and c <= '9') {
+      return c - '0';
+    }
+    if (c >= 'a' and c <= 'f') {
+      return c - 'a' + 10;
+    }
+    return -1;
+  }
+
+  template <typename Array>
+  bool copyBytes(const shared_model::crypto::Blob &blob, Array &bytes) {
+    if (blob.size() != bytes.size()) {
+      return false;
+    }
+    std::copy(blob.blob().begin(), blob.blob().end(), bytes.begin());
+    return true;
+  }
+
+  bool copySignature(const shared_model::interface::Signature &signature,
+                     CompactVote::SignatureData &data) {
+    return copyBytes(signature.publicKey(), data.public_key)
+        and copyBytes(signature.signedData(), data.signature);
+  }
+
+  template <typename Blob, typename Array>
+  Blob toBlob(const Array &bytes) {
+    return Blob(shared_model::crypto::Blob(
+        shared_model::crypto::Blob::Bytes(bytes.begin(), bytes.end())));
+  }
+
+  std::shared_ptr<shared_model::interface::Signature> toSignature(
+      const CompactVote::SignatureData &data) {
+    return std::make_shared<shared_model::plain::Signature>(
+        toBlob<shared_model::crypto::Signed>(data.signature),
+        toBlob<shared_model::crypto::PublicKey>(data.public_key));
+  }
+}  // namespace
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      constexpr size_t CompactVote::kHashLength;
+      constexpr size_t CompactVote::kPublicKeyLength;
+      constexpr size_t CompactVote::kSignatureLength;
+
+      bool decodeVoteHash(const std::string &hex, CompactVote::Hash &hash) {
+        if (hex.size() != hash.size() * 2) {
+          return false;
+        }
+        for (size_t i = 0; i < hash.size(); ++i) {
+          auto high = hexDigit(hex[2 * i]), low = hexDigit(hex[2 * i + 1]);
+          if (high < 0 or low < 0) {
+            return false;
+          }
+          hash[i] = static_cast<uint8_t>(high << 4 | low);
+        }
+        return true;
+      }
+
+      std::string encodeVoteHash(const CompactVote::Hash &hash) {
+        static const char kDigits[] = "0123456789abcdef";
+        std::string hex(hash.size() * 2, 0);
+        for (size_t i = 0; i < hash.size(); ++i) {
+          hex[2 * i] = kDigits[hash[i] >> 4];
+          hex[2 * i + 1] = kDigits[hash[i] & 0xf];
+        }
+        return hex;
+      }
+
+      boost::optional<CompactVote> makeCompactVote(const VoteMessage &vote) {
+        CompactVote compact;
+        compact.block_round = vote.hash.vote_round.block_round;
+        compact.reject_round = vote.hash.vote_round.reject_round;
+        compact.flags = 0;
+
+        // empty hash is denoted by the unset flag
+        auto decode = [&compact](const auto &hex, auto &hash, uint8_t flag) {
+          if (hex.empty()) {
+            return true;
+          }
+          compact.flags |= flag;
+          return decodeVoteHash(hex, hash);
+        };
+        if (not decode(vote.hash.vote_hashes.proposal_hash,
+                       compact.proposal_hash,
+                       CompactVote::kHasProposalHash)
+            or not decode(vote.hash.vote_hashes.block_hash,
+                          compact.block_hash,
+                          CompactVote::kHasBlockHash)) {
+          return boost::none;
+        }
+
+        if (not vote.signature
+            or not copySignature(*vote.signature, compact.signature)) {
+          return boost::none;
+        }
+        if (vote.hash.block_signature) {
+          if (not copySignature(*vote.hash.block_signature,
+                                compact.block_signature)) {
+            return boost::none;
+          }
+          compact.flags |= CompactVote::kHasBlockSignature;
+        }
+        return compact;
+      }
+
+      VoteMessage toVoteMessage(const CompactVote &vote) {
+        VoteMessage message;
+        message.hash.vote_round = vote.round();
+        if (vote.flags & CompactVote::kHasProposalHash) {
+          message.hash.vote_hashes.proposal_hash =
+              encodeVoteHash(vote.proposal_hash);
+        }
+        if (vote.flags & CompactVote::kHasBlockHash) {
+          message.hash.vote_hashes.block_hash = encodeVoteHash(vote.block_hash);
+        }
+        if (vote.flags & CompactVote::kHasBlockSignature) {
+          message.hash.block_signature = toSignature(vote.block_signature);
+        }
+        message.signature = toSignature(vote.signature);
+        return message;
+      }
+
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
@@ -0,0 +1,36 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/yac/impl/gossip_dissemination.hpp"
+
+#include <algorithm>
+
+#include "consensus/yac/cluster_order.hpp"
+
+using namespace iroha::consensus::yac;
+
+GossipDissemination::GossipDissemination(size_t fanout,
+                                         std::mt19937::result_type seed)
+    : fanout_(fanout), random_engine_(seed) {}
+
+std::vector<std::shared_ptr<shared_model::interface::Peer>>
+GossipDissemination::recipients(const ClusterOrdering &order) {
+  auto peers = order.getPeers();
+  if (peers.size() <= fanout_) {
+    return peers;
+  }
+
+  // partial Fisher-Yates shuffle of the first fanout peers
+  for (size_t i = 0; i < fanout_; ++i) {
+    std::uniform_int_distribution<size_t> distribution(i, peers.size() - 1);
+    std::swap(peers[i], peers[distribution(random_engine_)]);
+  }
+  peers.resize(fanout_);
+  return peers;
+}
+
+bool GossipDissemination::forwardsReceived() const {
+  return true;
+}
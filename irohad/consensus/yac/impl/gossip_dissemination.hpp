@@ -0,0 +1,47 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_YAC_GOSSIP_DISSEMINATION_HPP
+#define IROHA_YAC_GOSSIP_DISSEMINATION_HPP
+
+#include "consensus/yac/dissemination_strategy.hpp"
+
+#include <random>
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      /**
+       * Every peer sends the outcome to a random subset of the cluster when
+       * it collects or receives the outcome for the first time. With the
+       * fanout of about ln(n) + c peers the outcome reaches all n peers with
+       * the probability of exp(-exp(-c)), the rest receive it back on their
+       * votes for the finalized round.
+       * Note: not thread safe, the caller serializes the calls
+       */
+      class GossipDissemination : public DisseminationStrategy {
+       public:
+        /**
+         * @param fanout - number of peers which receive the outcome from
+         * this peer
+         * @param seed - seed of peers selection
+         */
+        GossipDissemination(size_t fanout, std::mt19937::result_type seed);
+
+        std::vector<std::shared_ptr<shared_model::interface::Peer>>
+        recipients(const ClusterOrdering &order) override;
+
+        bool forwardsReceived() const override;
+
+       private:
+        size_t fanout_;
+        std::mt19937 random_engine_;
+      };
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
+
+#endif  // IROHA_YAC_GOSSIP_DISSEMINATION_HPP
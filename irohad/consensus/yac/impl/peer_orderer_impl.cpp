@@ -5,6 +5,7 @@
 
 #include "consensus/yac/impl/peer_orderer_impl.hpp"
 
+#include <numeric>
 #include <random>
 
 #include "common/bind.hpp"
@@ -21,12 +22,24 @@ namespace iroha {
 
       boost::optional<ClusterOrdering> PeerOrdererImpl::getOrdering(
           const YacHash &hash,
-          std::vector<std::shared_ptr<shared_model::interface::Peer>> peers) {
+          const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+              &peers) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // the peers are sorted by their keys only when they are changed
+        if (peers != peers_) {
+          peers_ = peers;
+          peers_by_key_ = ClusterOrdering::sortByKey(peers_);
+          identity_.resize(peers_.size());
+          std::iota(identity_.begin(), identity_.end(), 0);
+        }
+        // the indices are shuffled in the same way as the peers would be, so
+        // the order is the same on every peer
+        auto permutation = identity_;
         std::seed_seq seed(hash.vote_hashes.block_hash.begin(),
                            hash.vote_hashes.block_hash.end());
         std::default_random_engine gen(seed);
-        std::shuffle(peers.begin(), peers.end(), gen);
-        return ClusterOrdering::create(peers);
+        std::shuffle(permutation.begin(), permutation.end(), gen);
+        return ClusterOrdering::create(peers_, permutation, peers_by_key_);
       }
     }  // namespace yac
   }    // namespace consensus
@@ -7,6 +7,7 @@
 #define IROHA_PEER_ORDERER_IMPL_HPP
 
 #include <memory>
+#include <mutex>
 
 #include "ametsuchi/peer_query_factory.hpp"
 #include "consensus/yac/yac_peer_orderer.hpp"
@@ -27,11 +28,19 @@ namespace iroha {
 
         boost::optional<ClusterOrdering> getOrdering(
             const YacHash &hash,
-            std::vector<std::shared_ptr<shared_model::interface::Peer>> peers)
-            override;
+            const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+                &peers) override;
 
        private:
         std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory_;
+
+        std::mutex mutex_;
+        /// the peers of the last ordering, which change rarely
+        std::vector<std::shared_ptr<shared_model::interface::Peer>> peers_;
+        /// indices of the peers sorted by their public keys
+        std::vector<PeersNumberType> peers_by_key_;
+        /// the initial order of the peers, which is shuffled for a round
+        std::vector<PeersNumberType> identity_;
       };
 
     }  // namespace yac
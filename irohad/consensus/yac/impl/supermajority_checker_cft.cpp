@@ -30,6 +30,14 @@ namespace iroha {
         const PeersNumberType largest_group =
             boost::empty(votes) ? 0 : *boost::max_element(votes);
         const PeersNumberType voted = boost::accumulate(votes, 0);
+
+        return canHaveSupermajority(largest_group, voted, all);
+      }
+
+      bool SupermajorityCheckerCft::canHaveSupermajority(
+          PeersNumberType largest_group,
+          PeersNumberType voted,
+          PeersNumberType all) const {
         const PeersNumberType not_voted = all - voted;
 
         return hasSupermajority(largest_group + not_voted, all);
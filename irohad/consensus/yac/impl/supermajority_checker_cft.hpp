@@ -28,6 +28,10 @@ namespace iroha {
 
         bool canHaveSupermajority(const VoteGroups &votes,
                                   PeersNumberType all) const override;
+
+        bool canHaveSupermajority(PeersNumberType largest_group,
+                                  PeersNumberType voted,
+                                  PeersNumberType all) const override;
       };
     }  // namespace yac
   }    // namespace consensus
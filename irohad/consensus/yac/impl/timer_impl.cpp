@@ -19,7 +19,7 @@ namespace iroha {
       void TimerImpl::invokeAfterDelay(std::function<void()> handler) {
         deny();
         auto timer_lifetime =
-            rxcpp::observable<>::timer(delay_milliseconds_, coordination_)
+            rxcpp::observable<>::timer(delay(), coordination_)
                 .subscribe([handler{std::move(handler)}](auto) { handler(); });
         {
           std::lock_guard<std::mutex> lock(timer_lifetime_mutex);
@@ -36,6 +36,14 @@ namespace iroha {
         timer_lifetime.unsubscribe();
       }
 
+      void TimerImpl::setDelay(std::chrono::milliseconds delay_milliseconds) {
+        delay_milliseconds_ = delay_milliseconds;
+      }
+
+      std::chrono::milliseconds TimerImpl::delay() {
+        return delay_milliseconds_;
+      }
+
       TimerImpl::~TimerImpl() {
         deny();
         coordinator_lifetime_.unsubscribe();
@@ -6,6 +6,7 @@
 #ifndef IROHA_TIMER_IMPL_HPP
 #define IROHA_TIMER_IMPL_HPP
 
+#include <atomic>
 #include <mutex>
 
 #include <rxcpp/rx-lite.hpp>
@@ -31,11 +32,22 @@ namespace iroha {
         void invokeAfterDelay(std::function<void()> handler) override;
         void deny() override;
 
+        /**
+         * Change the delay of the invocations requested afterwards, that is
+         * from the next voting step. The delay of the adaptive timer is
+         * derived from the latencies instead. May be called from any thread
+         */
+        void setDelay(std::chrono::milliseconds delay_milliseconds);
+
         ~TimerImpl() override;
 
+       protected:
+        /// @return delay before the invocation of the handler
+        virtual std::chrono::milliseconds delay();
+
        private:
         std::mutex timer_lifetime_mutex;
-        std::chrono::milliseconds delay_milliseconds_;
+        std::atomic<std::chrono::milliseconds> delay_milliseconds_;
         rxcpp::composite_subscription coordinator_lifetime_;
         rxcpp::observe_on_one_worker coordination_;
         rxcpp::composite_subscription timer_lifetime_;
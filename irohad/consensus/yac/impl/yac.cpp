@@ -9,9 +9,11 @@
 
 #include <boost/algorithm/string/join.hpp>
 #include <boost/range/adaptor/transformed.hpp>
+#include "common/allocation_tracking.hpp"
 #include "common/bind.hpp"
 #include "common/visitor.hpp"
 #include "consensus/yac/cluster_order.hpp"
+#include "consensus/yac/impl/broadcast_dissemination.hpp"
 #include "consensus/yac/storage/yac_proposal_storage.hpp"
 #include "consensus/yac/timer.hpp"
 #include "consensus/yac/yac_crypto_provider.hpp"
@@ -26,6 +28,29 @@ auto &getRound(const std::vector<iroha::consensus::yac::VoteMessage> &state) {
   return state.at(0).hash.vote_round;
 }
 
+namespace {
+  /// 1 .. 128 states
+  const size_t kQueueDepthBuckets = 8;
+
+  /**
+   * Accounts the state in the processing stage while in scope
+   */
+  class StageGuard {
+   public:
+    StageGuard(std::atomic<size_t> &depth, iroha::Histogram &histogram)
+        : depth_(depth) {
+      histogram.observe(++depth_);
+    }
+
+    ~StageGuard() {
+      --depth_;
+    }
+
+   private:
+    std::atomic<size_t> &depth_;
+  };
+}  // namespace
+
 namespace iroha {
   namespace consensus {
     namespace yac {
@@ -38,7 +63,9 @@ namespace iroha {
           ClusterOrdering order,
           Round round,
           rxcpp::observe_on_one_worker worker,
-          logger::LoggerPtr log) {
+          logger::LoggerPtr log,
+          bool commit_certificates,
+          std::shared_ptr<DisseminationStrategy> dissemination) {
         return std::make_shared<Yac>(vote_storage,
                                      network,
                                      crypto,
@@ -46,7 +73,9 @@ namespace iroha {
                                      order,
                                      round,
                                      worker,
-                                     std::move(log));
+                                     std::move(log),
+                                     commit_certificates,
+                                     std::move(dissemination));
       }
 
       Yac::Yac(YacVoteStorage vote_storage,
@@ -56,16 +85,28 @@ namespace iroha {
                ClusterOrdering order,
                Round round,
                rxcpp::observe_on_one_worker worker,
-               logger::LoggerPtr log)
+               logger::LoggerPtr log,
+               bool commit_certificates,
+               std::shared_ptr<DisseminationStrategy> dissemination)
           : log_(std::move(log)),
             cluster_order_(order),
             round_(round),
+            round_start_(std::chrono::steady_clock::now()),
             worker_(worker),
             notifier_(worker_, notifier_lifetime_),
             vote_storage_(std::move(vote_storage)),
             network_(std::move(network)),
             crypto_(std::move(crypto)),
-            timer_(std::move(timer)) {}
+            timer_(std::move(timer)),
+            commit_certificates_(commit_certificates),
+            dissemination_(
+                dissemination
+                    ? std::move(dissemination)
+                    : std::make_shared<BroadcastDissemination>()),
+            verification_queue_depth_(
+                Histogram::exponentialBounds(1, 2, kQueueDepthBuckets)),
+            storage_queue_depth_(
+                Histogram::exponentialBounds(1, 2, kQueueDepthBuckets)) {}
 
       Yac::~Yac() {
         notifier_lifetime_.unsubscribe();
@@ -76,6 +117,7 @@ namespace iroha {
       void Yac::vote(YacHash hash,
                      ClusterOrdering order,
                      boost::optional<ClusterOrdering> alternative_order) {
+        ScopedAllocationTag allocation_tag(AllocationTag::kConsensus);
         log_->info("Order for voting: [{}]",
                    boost::algorithm::join(
                        order.getPeers()
@@ -87,11 +129,24 @@ namespace iroha {
         cluster_order_ = order;
         alternative_order_ = std::move(alternative_order);
         round_ = hash.vote_round;
+        round_start_ = std::chrono::steady_clock::now();
+        measured_peers_.clear();
         lock.unlock();
-        auto vote = crypto_->getVote(hash);
-        // TODO 10.06.2018 andrei: IR-1407 move YAC propagation strategy to a
-        // separate entity
-        votingStep(vote);
+        // the signer may be a remote device, so the vote is sent when the
+        // signature arrives, unless the round has moved on by then
+        crypto_->signVote(hash, [this](VoteMessage vote) {
+          {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (vote.hash.vote_round != round_) {
+              log_->info("Dropping the vote signed for the passed round {}",
+                         vote.hash.vote_round);
+              return;
+            }
+          }
+          // TODO 10.06.2018 andrei: IR-1407 move YAC propagation strategy to a
+          // separate entity
+          votingStep(std::move(vote));
+        });
       }
 
       rxcpp::observable<Answer> Yac::onOutcome() {
@@ -106,82 +161,132 @@ namespace iroha {
                      target.end());
       }
 
-      template <typename CollectionType, typename ElementType>
-      bool contains(const CollectionType &haystack, const ElementType &needle) {
-        return std::find(haystack.begin(), haystack.end(), needle)
-            != haystack.end();
-      }
-
       /// moves the votes not present in known_keys from votes to return value
       void Yac::removeUnknownPeersVotes(std::vector<VoteMessage> &votes,
                                         ClusterOrdering &order) {
-        auto known_keys = order.getPeers()
-            | boost::adaptors::transformed(
-                              [](const auto &peer) { return peer->pubkey(); });
-        removeMatching(
-            votes,
-            [known_keys = std::move(known_keys), this](VoteMessage &vote) {
-              if (not contains(known_keys, vote.signature->publicKey())) {
-                log_->warn("Got a vote from an unknown peer: {}", vote);
-                return true;
-              }
-              return false;
-            });
+        removeMatching(votes, [&order, this](VoteMessage &vote) {
+          if (not order.peerIndex(vote.signature->publicKey())) {
+            log_->warn("Got a vote from an unknown peer: {}", vote);
+            return true;
+          }
+          return false;
+        });
+      }
+
+      void Yac::measureVoteLatency(const std::vector<VoteMessage> &state) {
+        auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - round_start_);
+        for (const auto &vote : state) {
+          const auto &peer = vote.signature->publicKey();
+          if (measured_peers_.insert(peer.hex()).second) {
+            timer_->onVoteLatency(peer, latency);
+          }
+        }
+      }
+
+      const Histogram &Yac::verificationQueueDepth() const {
+        return verification_queue_depth_;
+      }
+
+      const Histogram &Yac::storageQueueDepth() const {
+        return storage_queue_depth_;
+      }
+
+      const Counter &Yac::votingSteps() const {
+        return voting_steps_;
       }
 
       void Yac::onState(std::vector<VoteMessage> state) {
+        ScopedAllocationTag allocation_tag(AllocationTag::kConsensus);
+        {
+          StageGuard stage(verification_depth_, verification_queue_depth_);
+
+          std::unique_lock<std::mutex> lock(mutex_);
+          auto order = getCurrentOrder();
+          lock.unlock();
+
+          removeUnknownPeersVotes(state, order);
+          if (state.empty()) {
+            log_->debug("No votes left in the message.");
+            return;
+          }
+
+          if (not crypto_->verify(state)) {
+            log_->warn(
+                "Crypto verification failed for message. Votes: [{}]",
+                boost::algorithm::join(
+                    state | boost::adaptors::transformed([](const auto &v) {
+                      return v.signature->toString();
+                    }),
+                    ", "));
+            return;
+          }
+        }
+
+        StageGuard stage(storage_depth_, storage_queue_depth_);
         std::unique_lock<std::mutex> guard(mutex_);
 
+        // the order may be changed while the state was verified
         removeUnknownPeersVotes(state, getCurrentOrder());
         if (state.empty()) {
           log_->debug("No votes left in the message.");
           return;
         }
 
-        if (crypto_->verify(state)) {
-          auto &proposal_round = getRound(state);
+        auto &proposal_round = getRound(state);
 
-          if (proposal_round.block_round > round_.block_round) {
-            guard.unlock();
-            log_->info("Pass state from future for {} to pipeline",
-                       proposal_round);
-            notifier_.get_subscriber().on_next(FutureMessage{std::move(state)});
-            return;
-          }
+        if (proposal_round.block_round > round_.block_round) {
+          guard.unlock();
+          log_->info("Pass state from future for {} to pipeline",
+                     proposal_round);
+          notifier_.get_subscriber().on_next(FutureMessage{std::move(state)});
+          return;
+        }
 
-          if (proposal_round.block_round < round_.block_round) {
-            log_->info("Received state from past for {}, try to propagate back",
-                       proposal_round);
-            tryPropagateBack(state);
-            guard.unlock();
+        if (proposal_round.block_round < round_.block_round) {
+          log_->info("Received state from past for {}, try to propagate back",
+                     proposal_round);
+          tryPropagateBack(state);
+          guard.unlock();
+          return;
+        }
+
+        if (alternative_order_) {
+          // filter votes with peers from cluster order to avoid the case when
+          // alternative peer is not present in cluster order
+          removeUnknownPeersVotes(state, cluster_order_);
+          if (state.empty()) {
+            log_->debug("No votes left in the message.");
             return;
           }
+        }
 
-          if (alternative_order_) {
-            // filter votes with peers from cluster order to avoid the case when
-            // alternative peer is not present in cluster order
-            removeUnknownPeersVotes(state, cluster_order_);
-            if (state.empty()) {
-              log_->debug("No votes left in the message.");
-              return;
-            }
-          }
+        if (proposal_round == round_) {
+          measureVoteLatency(state);
+        }
 
-          applyState(state, guard);
-        } else {
-          log_->warn(
-              "Crypto verification failed for message. Votes: [{}]",
-              boost::algorithm::join(
-                  state | boost::adaptors::transformed([](const auto &v) {
-                    return v.signature->toString();
-                  }),
-                  ", "));
+        applyState(state, guard);
+      }
+
+      void Yac::onCertificate(CommitCertificate certificate) {
+        ScopedAllocationTag allocation_tag(AllocationTag::kConsensus);
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto peers = cluster_order_.getPeers();
+        lock.unlock();
+
+        auto state = expandCommitCertificate(certificate, peers);
+        if (not state) {
+          log_->info("Commit certificate for {} does not match current peers",
+                     certificate.hash.vote_round);
+          return;
         }
+        onState(*std::move(state));
       }
 
       // ------|Private interface|------
 
       void Yac::votingStep(VoteMessage vote) {
+        ScopedAllocationTag allocation_tag(AllocationTag::kConsensus);
         std::unique_lock<std::mutex> lock(mutex_);
 
         auto committed = vote_storage_.isCommitted(vote.hash.vote_round);
@@ -200,6 +305,7 @@ namespace iroha {
                    current_leader);
 
         network_->sendState(current_leader, {vote});
+        voting_steps_.increment();
         cluster_order.switchToNext();
         auto has_next = cluster_order.hasNext();
         lock.unlock();
@@ -250,7 +356,8 @@ namespace iroha {
                * not accept our message with valid supermajority because he
                * cannot apply votes from unknown peers.
                */
-              if (state.size() > 1) {
+              if (state.size() > 1
+                  and not dissemination_->forwardsReceived()) {
                 // some peer has already collected commit/reject, so it is sent
                 if (vote_storage_.getProcessingState(proposal_round)
                     == ProposalState::kNotSentNotProcessed) {
@@ -268,21 +375,29 @@ namespace iroha {
               auto votes = [](const auto &state) { return state.votes; };
 
               auto current_round = round_;
+              auto pass_outcome = [&] {
+                vote_storage_.nextProcessingState(proposal_round);
+                log_->info("Pass outcome for {} to pipeline", proposal_round);
+                lock.unlock();
+                if (proposal_round >= current_round) {
+                  this->closeRound();
+                }
+                notifier_.get_subscriber().on_next(answer);
+              };
               switch (processing_state) {
                 case ProposalState::kNotSentNotProcessed:
                   vote_storage_.nextProcessingState(proposal_round);
                   log_->info("Propagate state {} to whole network",
                              proposal_round);
                   this->propagateState(visit_in_place(answer, votes));
+                  // the recipients may not include this peer, so the outcome
+                  // is passed right away
+                  if (dissemination_->forwardsReceived()) {
+                    pass_outcome();
+                  }
                   break;
                 case ProposalState::kSentNotProcessed:
-                  vote_storage_.nextProcessingState(proposal_round);
-                  log_->info("Pass outcome for {} to pipeline", proposal_round);
-                  lock.unlock();
-                  if (proposal_round >= current_round) {
-                    this->closeRound();
-                  }
-                  notifier_.get_subscriber().on_next(answer);
+                  pass_outcome();
                   break;
                 case ProposalState::kSentProcessed:
                   this->tryPropagateBack(state);
@@ -323,8 +438,15 @@ namespace iroha {
       // ------|Propagation|------
 
       void Yac::propagateState(const std::vector<VoteMessage> &msg) {
-        for (const auto &peer : cluster_order_.getPeers()) {
-          propagateStateDirectly(*peer, msg);
+        boost::optional<CommitCertificate> certificate;
+        if (commit_certificates_ and msg.size() > 1) {
+          certificate = makeCommitCertificate(msg, cluster_order_.getPeers());
+        }
+        auto recipients = dissemination_->recipients(cluster_order_);
+        if (certificate) {
+          network_->broadcastCertificate(recipients, *certificate);
+        } else {
+          network_->broadcastState(recipients, msg);
         }
       }
 
@@ -5,49 +5,74 @@
 
 #include "consensus/yac/impl/yac_crypto_provider_impl.hpp"
 
+#include <algorithm>
+#include <future>
+#include <vector>
+
 #include "backend/plain/signature.hpp"
 #include "consensus/yac/transport/yac_pb_converters.hpp"
-#include "cryptography/crypto_provider/crypto_signer.hpp"
 #include "cryptography/crypto_provider/crypto_verifier.hpp"
+#include "cryptography/crypto_provider/keypair_signer.hpp"
 
 namespace iroha {
   namespace consensus {
     namespace yac {
       CryptoProviderImpl::CryptoProviderImpl(
           const shared_model::crypto::Keypair &keypair)
-          : keypair_(keypair) {}
+          : CryptoProviderImpl(
+                std::make_shared<shared_model::crypto::KeypairSigner<>>(
+                    keypair)) {}
+
+      CryptoProviderImpl::CryptoProviderImpl(
+          std::shared_ptr<shared_model::crypto::AsyncSigner> signer)
+          : signer_(std::move(signer)) {}
 
       bool CryptoProviderImpl::verify(const std::vector<VoteMessage> &msg) {
+        // the votes are verified in one batch, the payloads are reserved so
+        // that the references of the batch stay valid
+        std::vector<shared_model::crypto::Blob> payloads;
+        payloads.reserve(msg.size());
+        shared_model::crypto::SignedMessageBatch batch;
+        for (const auto &vote : msg) {
+          payloads.emplace_back(PbConverters::serializeVotePayload(vote)
+                                    .hash()
+                                    .SerializeAsString());
+          batch.push_back(shared_model::crypto::SignedMessageRef{
+              payloads.back(),
+              vote.signature->signedData(),
+              vote.signature->publicKey()});
+        }
+
+        auto valid = shared_model::crypto::CryptoVerifier<>::verifyBatch(batch);
         return std::all_of(
-            std::begin(msg), std::end(msg), [](const auto &vote) {
-              auto serialized =
-                  PbConverters::serializeVote(vote).hash().SerializeAsString();
-              auto blob = shared_model::crypto::Blob(serialized);
-
-              return shared_model::crypto::CryptoVerifier<>::verify(
-                  vote.signature->signedData(),
-                  blob,
-                  vote.signature->publicKey());
-            });
+            valid.begin(), valid.end(), [](bool is_valid) { return is_valid; });
       }
 
       VoteMessage CryptoProviderImpl::getVote(YacHash hash) {
+        std::promise<VoteMessage> vote;
+        signVote(std::move(hash),
+                 [&vote](VoteMessage signed_vote) {
+                   vote.set_value(std::move(signed_vote));
+                 });
+        return vote.get_future().get();
+      }
+
+      void CryptoProviderImpl::signVote(
+          YacHash hash, std::function<void(VoteMessage)> on_vote) {
         VoteMessage vote;
-        vote.hash = hash;
+        vote.hash = std::move(hash);
         auto serialized =
             PbConverters::serializeVotePayload(vote).hash().SerializeAsString();
-        auto blob = shared_model::crypto::Blob(serialized);
-        const auto &pubkey = keypair_.publicKey();
-        const auto &privkey = keypair_.privateKey();
-        auto signature = shared_model::crypto::CryptoSigner<>::sign(
-            blob, shared_model::crypto::Keypair(pubkey, privkey));
-
-        // TODO 30.08.2018 andrei: IR-1670 Remove optional from YAC
-        // CryptoProviderImpl::getVote
-        vote.signature =
-            std::make_shared<shared_model::plain::Signature>(signature, pubkey);
-
-        return vote;
+        signer_->sign(
+            shared_model::crypto::Blob(serialized),
+            [signer = signer_, vote, on_vote = std::move(on_vote)](
+                shared_model::crypto::Signed signature) mutable {
+              // TODO 30.08.2018 andrei: IR-1670 Remove optional from YAC
+              // CryptoProviderImpl::getVote
+              vote.signature = std::make_shared<shared_model::plain::Signature>(
+                  signature, signer->publicKey());
+              on_vote(std::move(vote));
+            });
       }
 
     }  // namespace yac
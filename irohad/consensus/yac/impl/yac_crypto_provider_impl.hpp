@@ -8,6 +8,7 @@
 
 #include "consensus/yac/yac_crypto_provider.hpp"
 
+#include "cryptography/crypto_provider/async_signer.hpp"
 #include "cryptography/keypair.hpp"
 
 namespace iroha {
@@ -17,12 +18,22 @@ namespace iroha {
        public:
         CryptoProviderImpl(const shared_model::crypto::Keypair &keypair);
 
+        /**
+         * @param signer - signer of the votes, which may keep the keys out
+         * of the process
+         */
+        explicit CryptoProviderImpl(
+            std::shared_ptr<shared_model::crypto::AsyncSigner> signer);
+
         bool verify(const std::vector<VoteMessage> &msg) override;
 
         VoteMessage getVote(YacHash hash) override;
 
+        void signVote(YacHash hash,
+                      std::function<void(VoteMessage)> on_vote) override;
+
        private:
-        shared_model::crypto::Keypair keypair_;
+        std::shared_ptr<shared_model::crypto::AsyncSigner> signer_;
       };
     }  // namespace yac
   }    // namespace consensus
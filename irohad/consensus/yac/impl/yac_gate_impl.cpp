@@ -17,6 +17,8 @@
 #include "interfaces/common_objects/signature.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "logger/logger.hpp"
+#include "maintenance/tracing.hpp"
+#include "network/impl/block_fetcher.hpp"
 #include "simulator/block_creator.hpp"
 
 namespace {
@@ -28,6 +30,9 @@ namespace {
           return vote.signature->publicKey();
         }));
   }
+
+  /// number of buckets of the outcome latency from 1 ms to about 1 min
+  constexpr size_t kOutcomeLatencyBuckets = 17;
 }  // namespace
 
 namespace iroha {
@@ -42,7 +47,8 @@ namespace iroha {
           std::shared_ptr<simulator::BlockCreator> block_creator,
           std::shared_ptr<consensus::ConsensusResultCache>
               consensus_result_cache,
-          logger::LoggerPtr log)
+          logger::LoggerPtr log,
+          std::shared_ptr<network::BlockFetcher> block_fetcher)
           : log_(std::move(log)),
             current_hash_(),
             alternative_order_(std::move(alternative_order)),
@@ -66,7 +72,10 @@ namespace iroha {
             hash_provider_(std::move(hash_provider)),
             block_creator_(std::move(block_creator)),
             consensus_result_cache_(std::move(consensus_result_cache)),
-            hash_gate_(std::move(hash_gate)) {
+            hash_gate_(std::move(hash_gate)),
+            block_fetcher_(std::move(block_fetcher)),
+            outcome_latency_(
+                Histogram::exponentialBounds(1, 2, kOutcomeLatencyBuckets)) {
         block_creator_->onBlock().subscribe(
             [this](const auto &event) { this->vote(event); });
       }
@@ -81,6 +90,7 @@ namespace iroha {
           return;
         }
 
+        vote_time_ = std::chrono::steady_clock::now();
         current_ledger_state_ = event.ledger_state;
         current_hash_ = hash_provider_->makeHash(event);
         assert(current_hash_.vote_round.block_round
@@ -118,6 +128,28 @@ namespace iroha {
         return published_events_;
       }
 
+      const Histogram &YacGateImpl::outcomeLatency() const {
+        return outcome_latency_;
+      }
+
+      const Counter &YacGateImpl::commits() const {
+        return commits_;
+      }
+
+      const Counter &YacGateImpl::rejects() const {
+        return rejects_;
+      }
+
+      void YacGateImpl::observeOutcome(const Round &round, Counter &outcomes) {
+        outcomes.increment();
+        if (round == current_hash_.vote_round) {
+          outcome_latency_.observe(
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                  std::chrono::steady_clock::now() - vote_time_)
+                  .count());
+        }
+      }
+
       void YacGateImpl::copySignatures(const CommitMessage &commit) {
         for (const auto &vote : commit.votes) {
           auto sig = vote.hash.block_signature;
@@ -139,12 +171,25 @@ namespace iroha {
 
         assert(hash.vote_round.block_round
                == current_hash_.vote_round.block_round);
+        observeOutcome(hash.vote_round, commits_);
 
         if (hash == current_hash_ and current_block_) {
           // if node has voted for the committed block
           // append signatures of other nodes
           this->copySignatures(msg);
           auto &block = current_block_.value();
+          // the consensus on the block lasts from the vote for it
+          tracing::ScopedSpan span(
+              "consensus.commit",
+              tracing::Clock::now()
+                  - std::chrono::duration_cast<tracing::Clock::duration>(
+                        std::chrono::steady_clock::now() - vote_time_));
+          if (span) {
+            span.setAttribute("round", current_hash_.vote_round.toString());
+            for (const auto &tx : block->transactions()) {
+              span.addTransaction(tx.hash());
+            }
+          }
           log_->info("consensus: commit top block: height {}, hash {}",
                      block->height(),
                      block->hash().hex());
@@ -164,6 +209,13 @@ namespace iroha {
 
         log_->info("Voted for another block, waiting for sync");
         current_block_ = boost::none;
+        if (block_fetcher_) {
+          // the download does not wait for the synchronizer to get the
+          // outcome
+          block_fetcher_->fetch(current_ledger_state_->top_block_info.height,
+                                hash.vote_round.block_round,
+                                public_keys);
+        }
         auto model_hash = hash_provider_->toModelHash(hash);
         return rxcpp::observable<>::just<GateObject>(
             VoteOther(hash.vote_round,
@@ -186,6 +238,7 @@ namespace iroha {
 
         assert(hash.vote_round.block_round
                == current_hash_.vote_round.block_round);
+        observeOutcome(hash.vote_round, rejects_);
 
         auto has_same_proposals =
             std::all_of(std::next(msg.votes.begin()),
@@ -8,9 +8,12 @@
 
 #include "consensus/yac/yac_gate.hpp"
 
+#include <chrono>
 #include <memory>
 
 #include <rxcpp/rx-lite.hpp>
+#include "common/counter.hpp"
+#include "common/histogram.hpp"
 #include "consensus/consensus_block_cache.hpp"
 #include "consensus/yac/yac_hash_provider.hpp"
 #include "logger/logger_fwd.hpp"
@@ -22,7 +25,7 @@ namespace iroha {
   }
 
   namespace network {
-    class BlockLoader;
+    class BlockFetcher;
   }
 
   namespace consensus {
@@ -33,6 +36,10 @@ namespace iroha {
 
       class YacGateImpl : public YacGate {
        public:
+        /**
+         * @param block_fetcher - downloads the block agreed without the vote
+         * of this peer as soon as the outcome is known. Optional
+         */
         YacGateImpl(std::shared_ptr<HashGate> hash_gate,
                     std::shared_ptr<YacPeerOrderer> orderer,
                     boost::optional<ClusterOrdering> alternative_order,
@@ -40,11 +47,22 @@ namespace iroha {
                     std::shared_ptr<simulator::BlockCreator> block_creator,
                     std::shared_ptr<consensus::ConsensusResultCache>
                         consensus_result_cache,
-                    logger::LoggerPtr log);
+                    logger::LoggerPtr log,
+                    std::shared_ptr<network::BlockFetcher> block_fetcher =
+                        nullptr);
         void vote(const simulator::BlockCreatorEvent &event) override;
 
         rxcpp::observable<GateObject> onOutcome() override;
 
+        /// time in ms from the vote to the outcome of the same round
+        const Histogram &outcomeLatency() const;
+
+        /// number of commit outcomes, including agreements on none
+        const Counter &commits() const;
+
+        /// number of reject outcomes
+        const Counter &rejects() const;
+
        private:
         /**
          * Update current block with signatures from commit message
@@ -56,6 +74,13 @@ namespace iroha {
         rxcpp::observable<GateObject> handleReject(const RejectMessage &msg);
         rxcpp::observable<GateObject> handleFuture(const FutureMessage &msg);
 
+        /**
+         * Account the outcome if it belongs to the round of the current vote
+         * @param round - round of the outcome
+         * @param outcomes - counter of the outcomes of the same kind
+         */
+        void observeOutcome(const Round &round, Counter &outcomes);
+
         logger::LoggerPtr log_;
 
         boost::optional<std::shared_ptr<shared_model::interface::Block>>
@@ -71,6 +96,13 @@ namespace iroha {
         std::shared_ptr<consensus::ConsensusResultCache>
             consensus_result_cache_;
         std::shared_ptr<HashGate> hash_gate_;
+        std::shared_ptr<network::BlockFetcher> block_fetcher_;
+
+        // ------|Metrics|------
+        std::chrono::steady_clock::time_point vote_time_;
+        Histogram outcome_latency_;
+        Counter commits_;
+        Counter rejects_;
       };
 
     }  // namespace yac
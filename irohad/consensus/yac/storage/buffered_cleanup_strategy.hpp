@@ -32,6 +32,8 @@ namespace iroha {
 
         bool shouldCreateRound(const RoundType &round) override;
 
+        bool isStale(const RoundType &round) const override;
+
        private:
         /**
          * Remove all rounds before last committed
@@ -39,6 +39,14 @@ namespace iroha {
          */
         virtual bool shouldCreateRound(const Round &round) = 0;
 
+        /**
+         * The method checks whether the round is cleaned up already, so its
+         * votes are rejected without looking for its storage
+         * @param round - round of the votes
+         * @return true if the votes of the round are not required anymore
+         */
+        virtual bool isStale(const Round &round) const = 0;
+
         virtual ~CleanupStrategy() = default;
       };
     }  // namespace yac
@@ -74,6 +74,10 @@ bool BufferedCleanupStrategy::shouldCreateRound(const Round &round) {
   }
 }
 
+bool BufferedCleanupStrategy::isStale(const Round &round) const {
+  return not isRequiredCreation(round);
+}
+
 void BufferedCleanupStrategy::createRound(const Round &round) {
   created_rounds_.push(round);
 }
@@ -5,6 +5,8 @@
 
 #include "consensus/yac/storage/yac_block_storage.hpp"
 
+#include "cryptography/public_key.hpp"
+#include "interfaces/common_objects/signature.hpp"
 #include "logger/logger.hpp"
 
 namespace iroha {
@@ -25,6 +27,7 @@ namespace iroha {
 
       boost::optional<Answer> YacBlockStorage::insert(VoteMessage msg) {
         if (validScheme(msg) and uniqueVote(msg)) {
+          signatories_.insert(signatoryKey(msg));
           votes_.push_back(msg);
 
           log_->info(
@@ -65,7 +68,8 @@ namespace iroha {
       }
 
       bool YacBlockStorage::isContains(const VoteMessage &msg) const {
-        return std::count(votes_.begin(), votes_.end(), msg) != 0;
+        return msg.hash == storage_key_
+            and signatories_.count(signatoryKey(msg)) != 0;
       }
 
       YacHash YacBlockStorage::getStorageKey() const {
@@ -75,10 +79,13 @@ namespace iroha {
       // --------| private api |--------
 
       bool YacBlockStorage::uniqueVote(VoteMessage &msg) {
-        // lookup take O(n) times
-        return std::all_of(votes_.begin(), votes_.end(), [&msg](auto vote) {
-          return vote != msg;
-        });
+        return signatories_.count(signatoryKey(msg)) == 0;
+      }
+
+      std::string YacBlockStorage::signatoryKey(const VoteMessage &vote) {
+        // votes with the same hash are equal when they have the same signatory
+        return shared_model::crypto::toBinaryString(
+            vote.signature->publicKey());
       }
 
       bool YacBlockStorage::validScheme(VoteMessage &vote) {
@@ -5,7 +5,8 @@
 
 #include "consensus/yac/storage/yac_proposal_storage.hpp"
 
-#include <boost/range/adaptor/transformed.hpp>
+#include <algorithm>
+
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
 
@@ -17,27 +18,30 @@ namespace iroha {
 
       // --------| private api |--------
 
-      auto YacProposalStorage::findStore(const YacHash &store_hash) {
+      YacBlockStorage &YacProposalStorage::findStore(
+          const YacHash &store_hash) {
         // find exist
-        auto iter = std::find_if(block_storages_.begin(),
-                                 block_storages_.end(),
-                                 [&store_hash](auto block_storage) {
-                                   auto storage_key =
-                                       block_storage.getStorageKey();
-                                   return storage_key == store_hash;
-                                 });
-        if (iter != block_storages_.end()) {
-          return iter;
+        auto inserted = block_storage_index_.emplace(storeKey(store_hash),
+                                                     block_storages_.size());
+        if (not inserted.second) {
+          return block_storages_[inserted.first->second];
         }
         // insert and return new
-        return block_storages_.emplace(
-            block_storages_.end(),
+        block_storages_.emplace_back(
             YacHash(store_hash.vote_round,
                     store_hash.vote_hashes.proposal_hash,
                     store_hash.vote_hashes.block_hash),
             peers_in_round_,
             supermajority_checker_,
             log_manager_->getChild("BlockStorage")->getLogger());
+        return block_storages_.back();
+      }
+
+      std::string YacProposalStorage::storeKey(const YacHash &store_hash) {
+        // all votes of the storage are for the same round
+        const auto &hashes = store_hash.vote_hashes;
+        return std::to_string(hashes.proposal_hash.size()) + ":"
+            + hashes.proposal_hash + hashes.block_hash;
       }
 
       // --------| public api |--------
@@ -63,8 +67,11 @@ namespace iroha {
                      msg.hash.vote_hashes.proposal_hash,
                      msg.hash.vote_hashes.block_hash);
 
-          auto iter = findStore(msg.hash);
-          auto block_state = iter->insert(msg);
+          auto &block_storage = findStore(msg.hash);
+          auto block_state = block_storage.insert(msg);
+          ++number_of_votes_;
+          largest_group_ = std::max<PeersNumberType>(
+              largest_group_, block_storage.getNumberOfVotes());
 
           // Single BlockStorage always returns CommitMessage because it
           // aggregates votes for a single hash.
@@ -110,24 +117,17 @@ namespace iroha {
         return vote_round == storage_key_;
       }
 
-      bool YacProposalStorage::checkPeerUniqueness(const VoteMessage &msg) {
-        return std::all_of(block_storages_.begin(),
-                           block_storages_.end(),
-                           [&msg](YacBlockStorage &storage) {
-                             if (storage.getStorageKey() != msg.hash) {
-                               return true;
-                             }
-                             return not storage.isContains(msg);
-                           });
+      bool YacProposalStorage::checkPeerUniqueness(
+          const VoteMessage &msg) const {
+        // only the storage of the same hash may contain the vote
+        auto it = block_storage_index_.find(storeKey(msg.hash));
+        return it == block_storage_index_.end()
+            or not block_storages_[it->second].isContains(msg);
       }
 
       boost::optional<Answer> YacProposalStorage::findRejectProof() {
         auto is_reject = not supermajority_checker_->canHaveSupermajority(
-            block_storages_
-                | boost::adaptors::transformed([](const auto &storage) {
-                    return storage.getNumberOfVotes();
-                  }),
-            peers_in_round_);
+            largest_group_, number_of_votes_, peers_in_round_);
 
         if (is_reject) {
           std::vector<VoteMessage> result;
@@ -6,6 +6,7 @@
 #include "consensus/yac/storage/yac_vote_storage.hpp"
 
 #include <algorithm>
+#include <tuple>
 #include <utility>
 
 #include "common/bind.hpp"
@@ -19,60 +20,32 @@ namespace iroha {
 
       // --------| private api |--------
 
-      namespace {
-        /**
-         * Find storage with corresponding key
-         * @tparam T - storage type
-         * @param storage - ref or const ref for the storage
-         * @param round - required round
-         * @return iterator for the storage
-         */
-        template <typename T>
-        auto findStorage(T &storage, const Round &round) {
-          return std::find_if(
-              storage.begin(), storage.end(), [&round](const auto &storage) {
-                return storage.getStorageKey() == round;
-              });
-        }
-      }  // namespace
-
-      auto YacVoteStorage::getProposalStorage(const Round &round) {
-        return findStorage(proposal_storages_, round);
-      }
-
-      auto YacVoteStorage::getProposalStorage(const Round &round) const {
-        return findStorage(proposal_storages_, round);
-      }
-
-      boost::optional<std::vector<YacProposalStorage>::iterator>
+      boost::optional<YacVoteStorage::ProposalStorages::iterator>
       YacVoteStorage::findProposalStorage(const VoteMessage &msg,
                                           PeersNumberType peers_in_round) {
         const auto &round = msg.hash.vote_round;
-        auto val = getProposalStorage(round);
+        auto val = proposal_storages_.find(round);
         if (val != proposal_storages_.end()) {
           return val;
         }
         if (strategy_->shouldCreateRound(round)) {
-          return proposal_storages_.emplace(
-              proposal_storages_.end(),
-              msg.hash.vote_round,
-              peers_in_round,
-              supermajority_checker_,
-              log_manager_->getChild("ProposalStorage"));
+          return proposal_storages_
+              .emplace(std::piecewise_construct,
+                       std::forward_as_tuple(round),
+                       std::forward_as_tuple(
+                           round,
+                           peers_in_round,
+                           supermajority_checker_,
+                           log_manager_->getChild("ProposalStorage")))
+              .first;
         } else {
           return boost::none;
         }
       }
 
       void YacVoteStorage::remove(const iroha::consensus::Round &round) {
-        auto val = getProposalStorage(round);
-        if (val != proposal_storages_.end()) {
-          proposal_storages_.erase(val);
-        }
-        auto state = processing_state_.find(round);
-        if (state != processing_state_.end()) {
-          processing_state_.erase(state);
-        }
+        proposal_storages_.erase(round);
+        processing_state_.erase(round);
       }
 
       // --------| public api |--------
@@ -90,10 +63,15 @@ namespace iroha {
         if (state.empty()) {
           return boost::none;
         }
+        // the votes of the rounds which are cleaned up are rejected at once
+        if (strategy_->isStale(state.at(0).hash.vote_round)) {
+          return boost::none;
+        }
         return findProposalStorage(state.at(0), peers_in_round) |
             [this, &state](auto &&storage) {
-              const auto &round = storage->getStorageKey();
-              return storage->insert(state) |
+              // the storage may be removed by the cleanup below
+              const auto round = storage->first;
+              return storage->second.insert(state) |
                          [this, &round](
                              auto &&insert_outcome) -> boost::optional<Answer> {
                 last_round_ = std::max(last_round_.value_or(round), round);
@@ -110,11 +88,11 @@ namespace iroha {
       }
 
       bool YacVoteStorage::isCommitted(const Round &round) {
-        auto iter = getProposalStorage(round);
+        auto iter = proposal_storages_.find(round);
         if (iter == proposal_storages_.end()) {
           return false;
         }
-        return bool(iter->getState());
+        return bool(iter->second.getState());
       }
 
       ProposalState YacVoteStorage::getProcessingState(const Round &round) {
@@ -141,9 +119,9 @@ namespace iroha {
 
       boost::optional<Answer> YacVoteStorage::getState(
           const Round &round) const {
-        auto proposal_storage = getProposalStorage(round);
+        auto proposal_storage = proposal_storages_.find(round);
         if (proposal_storage != proposal_storages_.end()) {
-          return proposal_storage->getState();
+          return proposal_storage->second.getState();
         } else {
           return boost::none;
         }
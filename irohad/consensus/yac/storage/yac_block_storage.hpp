@@ -7,6 +7,8 @@
 #define IROHA_YAC_BLOCK_VOTE_STORAGE_HPP
 
 #include <memory>
+#include <string>
+#include <unordered_set>
 #include <vector>
 
 #include <boost/optional.hpp>
@@ -91,6 +93,11 @@ namespace iroha {
          */
         bool uniqueVote(VoteMessage &vote);
 
+        /**
+         * @return key of the vote signatory in the set of stored votes
+         */
+        static std::string signatoryKey(const VoteMessage &vote);
+
         /**
          * Verify that vote has the same hash attached as the storage
          * @param vote - vote to be checked
@@ -100,6 +107,12 @@ namespace iroha {
 
         // --------| fields |--------
 
+        /**
+         * Keys of the signatories of stored votes, all of them have the hash
+         * of the storage
+         */
+        std::unordered_set<std::string> signatories_;
+
         /**
          * Key of the storage; currently it's yac hash
          */
@@ -7,6 +7,8 @@
 #define IROHA_YAC_PROPOSAL_STORAGE_HPP
 
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <boost/optional.hpp>
@@ -26,7 +28,10 @@ namespace iroha {
 
       /**
        * Class for storing votes related to given proposal/block round
-       * and gain information about commits/rejects for this round
+       * and gain information about commits/rejects for this round.
+       * Number of votes for every hash and for the most voted one are counted
+       * on insertion, so the insertion does not depend on the number of
+       * stored votes.
        */
       class YacProposalStorage {
        private:
@@ -36,9 +41,14 @@ namespace iroha {
          * Find block index with provided parameters,
          * if those store absent - create new
          * @param store_hash - hash of store of interest
-         * @return iterator to storage
+         * @return storage
          */
-        auto findStore(const YacHash &store_hash);
+        YacBlockStorage &findStore(const YacHash &store_hash);
+
+        /**
+         * @return key of the block storage index for the hash of the round
+         */
+        static std::string storeKey(const YacHash &store_hash);
 
        public:
         // --------| public api |--------
@@ -97,7 +107,7 @@ namespace iroha {
          * Is this peer first time appear in this proposal storage
          * @return true, if peer unique
          */
-        bool checkPeerUniqueness(const VoteMessage &msg);
+        bool checkPeerUniqueness(const VoteMessage &msg) const;
 
         /**
          * Method try to find proof of reject.
@@ -119,6 +129,21 @@ namespace iroha {
          */
         std::vector<YacBlockStorage> block_storages_;
 
+        /**
+         * Positions of block storages by their hashes
+         */
+        std::unordered_map<std::string, size_t> block_storage_index_;
+
+        /**
+         * Number of votes in all block storages
+         */
+        PeersNumberType number_of_votes_{0};
+
+        /**
+         * Number of votes in the block storage with the most votes
+         */
+        PeersNumberType largest_group_{0};
+
         /**
          * Key of the storage
          */
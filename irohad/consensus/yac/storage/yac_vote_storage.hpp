@@ -64,13 +64,9 @@ namespace iroha {
        private:
         // --------| private api |--------
 
-        /**
-         * Retrieve iterator for storage with specified key
-         * @param round - key of that storage
-         * @return iterator to proposal storage
-         */
-        auto getProposalStorage(const Round &round);
-        auto getProposalStorage(const Round &round) const;
+        /// proposal storages indexed by their rounds
+        using ProposalStorages =
+            std::unordered_map<Round, YacProposalStorage, RoundTypeHasher>;
 
         /**
          * Find existed proposal storage or create new if required
@@ -80,9 +76,8 @@ namespace iroha {
          * This parameter used on creation of proposal storage
          * @return - iter for required proposal storage
          */
-        boost::optional<std::vector<YacProposalStorage>::iterator>
-        findProposalStorage(const VoteMessage &msg,
-                            PeersNumberType peers_in_round);
+        boost::optional<ProposalStorages::iterator> findProposalStorage(
+            const VoteMessage &msg, PeersNumberType peers_in_round);
 
         /**
          * Remove proposal storage by round
@@ -159,7 +154,7 @@ namespace iroha {
         /**
          * Active proposal storages
          */
-        std::vector<YacProposalStorage> proposal_storages_;
+        ProposalStorages proposal_storages_;
 
         /**
          * Processing set provide user flags about processing some
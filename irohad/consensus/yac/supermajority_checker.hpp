@@ -66,6 +66,18 @@ namespace iroha {
          */
         virtual bool canHaveSupermajority(const VoteGroups &votes,
                                           PeersNumberType all) const = 0;
+
+        /**
+         * Check if supermajority is possible, using the counters of votes
+         * @param largest_group - number of peers voted for the most voted
+         * option
+         * @param voted - number of peers voted for all options
+         * @param all - number of peers in round
+         * @return true, if reject
+         */
+        virtual bool canHaveSupermajority(PeersNumberType largest_group,
+                                          PeersNumberType voted,
+                                          PeersNumberType all) const = 0;
       };
 
       /// Get a SupermajorityChecker for the given consistency model.
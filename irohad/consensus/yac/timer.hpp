@@ -6,8 +6,15 @@
 #ifndef IROHA_YAC_TIMER_HPP
 #define IROHA_YAC_TIMER_HPP
 
+#include <chrono>
 #include <functional>
 
+namespace shared_model {
+  namespace crypto {
+    class PublicKey;
+  }
+}  // namespace shared_model
+
 namespace iroha {
   namespace consensus {
     namespace yac {
@@ -28,6 +35,14 @@ namespace iroha {
          */
         virtual void deny() = 0;
 
+        /**
+         * Report the arrival of the vote of a peer in the current round
+         * @param peer - public key of the voted peer
+         * @param latency - time since the voting in the round was started
+         */
+        virtual void onVoteLatency(const shared_model::crypto::PublicKey &peer,
+                                   std::chrono::milliseconds latency) {}
+
         virtual ~Timer() = default;
       };
     }  // namespace yac
@@ -37,30 +37,89 @@ namespace iroha {
 
       void NetworkImpl::sendState(const shared_model::interface::Peer &to,
                                   const std::vector<VoteMessage> &state) {
-        createPeerConnection(to);
+        send(to, makeStateRequest(state));
 
-        proto::State request;
-        for (const auto &vote : state) {
-          auto pb_vote = request.add_votes();
-          *pb_vote = PbConverters::serializeVote(vote);
-        }
+        log_->info(
+            "Send votes bundle[size={}] to {}", state.size(), to.address());
+      }
 
-        async_call_->Call([&](auto context, auto cq) {
-          return peers_.at(to.address())->AsyncSendState(context, request, cq);
-        });
+      void NetworkImpl::sendCertificate(
+          const shared_model::interface::Peer &to,
+          const CommitCertificate &certificate) {
+        send(to, makeCertificateRequest(certificate));
+
+        log_->info("Send commit certificate[size={}] to {}",
+                   certificate.signatures.size(),
+                   to.address());
+      }
+
+      void NetworkImpl::broadcastState(
+          const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+              &to,
+          const std::vector<VoteMessage> &state) {
+        // the votes are serialized once, so the calls to all of the peers
+        // are started one after another
+        auto request = makeStateRequest(state);
+        for (const auto &peer : to) {
+          send(*peer, request);
+        }
 
         log_->info(
-            "Send votes bundle[size={}] to {}", state.size(), to.address());
+            "Send votes bundle[size={}] to {} peers", state.size(), to.size());
+      }
+
+      void NetworkImpl::broadcastCertificate(
+          const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+              &to,
+          const CommitCertificate &certificate) {
+        auto request = makeCertificateRequest(certificate);
+        for (const auto &peer : to) {
+          send(*peer, request);
+        }
+
+        log_->info("Send commit certificate[size={}] to {} peers",
+                   certificate.signatures.size(),
+                   to.size());
       }
 
       grpc::Status NetworkImpl::SendState(
           ::grpc::ServerContext *context,
           const ::iroha::consensus::yac::proto::State *request,
           ::google::protobuf::Empty *response) {
+        if (request->has_certificate()) {
+          if (request->votes_size() != 0) {
+            log_->info("Received both votes and commit certificate");
+            return grpc::Status::CANCELLED;
+          }
+          auto certificate =
+              PbConverters::deserializeCertificate(request->certificate());
+          if (not certificate) {
+            log_->info("Received a malformed commit certificate");
+            return grpc::Status::CANCELLED;
+          }
+
+          log_->info("Received commit certificate[size={}] from {}",
+                     certificate->signatures.size(),
+                     context->peer());
+
+          if (auto notifications = handler_.lock()) {
+            notifications->onCertificate(*std::move(certificate));
+          } else {
+            log_->error("Unable to lock the subscriber");
+          }
+          return grpc::Status::OK;
+        }
+
         std::vector<VoteMessage> state;
+        state.reserve(request->votes_size());
         for (const auto &pb_vote : request->votes()) {
-          if (auto vote = PbConverters::deserializeVote(pb_vote, log_)) {
-            state.push_back(*vote);
+          // votes with the default keys and hashes are checked by their
+          // fixed-size form, the rest are validated by the objects factory
+          if (auto compact = PbConverters::deserializeCompactVote(pb_vote)) {
+            state.push_back(toVoteMessage(*compact));
+          } else if (auto vote =
+                         PbConverters::deserializeVote(pb_vote, log_)) {
+            state.push_back(*std::move(vote));
           }
         }
         if (state.empty()) {
@@ -84,6 +143,33 @@ namespace iroha {
         return grpc::Status::OK;
       }
 
+      proto::State NetworkImpl::makeStateRequest(
+          const std::vector<VoteMessage> &state) {
+        proto::State request;
+        for (const auto &vote : state) {
+          auto pb_vote = request.add_votes();
+          *pb_vote = PbConverters::serializeVote(vote);
+        }
+        return request;
+      }
+
+      proto::State NetworkImpl::makeCertificateRequest(
+          const CommitCertificate &certificate) {
+        proto::State request;
+        *request.mutable_certificate() =
+            PbConverters::serializeCertificate(certificate);
+        return request;
+      }
+
+      void NetworkImpl::send(const shared_model::interface::Peer &to,
+                             const proto::State &request) {
+        createPeerConnection(to);
+
+        async_call_->Call(to.address(), [&](auto context, auto cq) {
+          return peers_.at(to.address())->AsyncSendState(context, request, cq);
+        });
+      }
+
       void NetworkImpl::createPeerConnection(
           const shared_model::interface::Peer &peer) {
         if (peers_.count(peer.address()) == 0) {
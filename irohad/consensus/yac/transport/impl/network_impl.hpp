@@ -12,6 +12,7 @@
 #include <memory>
 #include <unordered_map>
 
+#include "consensus/yac/commit_certificate.hpp"
 #include "consensus/yac/outcome_messages.hpp"
 #include "consensus/yac/vote_message.hpp"
 #include "interfaces/common_objects/peer.hpp"
@@ -42,6 +43,19 @@ namespace iroha {
         void sendState(const shared_model::interface::Peer &to,
                        const std::vector<VoteMessage> &state) override;
 
+        void sendCertificate(const shared_model::interface::Peer &to,
+                             const CommitCertificate &certificate) override;
+
+        void broadcastState(
+            const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+                &to,
+            const std::vector<VoteMessage> &state) override;
+
+        void broadcastCertificate(
+            const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+                &to,
+            const CommitCertificate &certificate) override;
+
         /**
          * Receive votes from another peer;
          * Naming is confusing, because this is rpc call that
@@ -60,6 +74,20 @@ namespace iroha {
          */
         void createPeerConnection(const shared_model::interface::Peer &peer);
 
+        /// @return the request with the votes
+        static proto::State makeStateRequest(
+            const std::vector<VoteMessage> &state);
+
+        /// @return the request with the commit certificate
+        static proto::State makeCertificateRequest(
+            const CommitCertificate &certificate);
+
+        /**
+         * Send the request to the given peer
+         */
+        void send(const shared_model::interface::Peer &to,
+                  const proto::State &request);
+
         /**
          * Mapping of peer objects to connections
          */
@@ -19,6 +19,7 @@ namespace iroha {
   namespace consensus {
     namespace yac {
 
+      struct CommitCertificate;
       struct VoteMessage;
 
       class YacNetworkNotifications {
@@ -29,6 +30,12 @@ namespace iroha {
          */
         virtual void onState(std::vector<VoteMessage> state) = 0;
 
+        /**
+         * Callback on receiving compact form of collection of votes
+         * @param certificate - provided message
+         */
+        virtual void onCertificate(CommitCertificate certificate) = 0;
+
         virtual ~YacNetworkNotifications() = default;
       };
 
@@ -45,6 +52,43 @@ namespace iroha {
         virtual void sendState(const shared_model::interface::Peer &to,
                                const std::vector<VoteMessage> &state) = 0;
 
+        /**
+         * Directly share compact form of collection of votes
+         * @param to - peer recipient
+         * @param certificate - message for sending
+         */
+        virtual void sendCertificate(const shared_model::interface::Peer &to,
+                                     const CommitCertificate &certificate) = 0;
+
+        /**
+         * Share collection of votes with the peers. The transports which
+         * prepare a message once for all of the peers override it
+         * @param to - peer recipients
+         * @param state - message for sending
+         */
+        virtual void broadcastState(
+            const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+                &to,
+            const std::vector<VoteMessage> &state) {
+          for (const auto &peer : to) {
+            sendState(*peer, state);
+          }
+        }
+
+        /**
+         * Share compact form of collection of votes with the peers
+         * @param to - peer recipients
+         * @param certificate - message for sending
+         */
+        virtual void broadcastCertificate(
+            const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+                &to,
+            const CommitCertificate &certificate) {
+          for (const auto &peer : to) {
+            sendCertificate(*peer, certificate);
+          }
+        }
+
         /**
          * Virtual destructor required for inheritance
          */
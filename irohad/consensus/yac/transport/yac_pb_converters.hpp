@@ -8,6 +8,8 @@
 
 #include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
 #include "common/byteutils.hpp"
+#include "consensus/yac/commit_certificate.hpp"
+#include "consensus/yac/compact_vote.hpp"
 #include "consensus/yac/outcome_messages.hpp"
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
 #include "interfaces/common_objects/signature.hpp"
@@ -143,6 +145,191 @@ namespace iroha {
 
           return vote;
         }
+
+        static proto::Vote serializeCompactVote(const CompactVote &vote) {
+          proto::Vote pb_vote;
+
+          auto hash = pb_vote.mutable_hash();
+          auto hash_round = hash->mutable_vote_round();
+          hash_round->set_block_round(vote.block_round);
+          hash_round->set_reject_round(vote.reject_round);
+          auto hash_vote_hashes = hash->mutable_vote_hashes();
+          if (vote.flags & CompactVote::kHasProposalHash) {
+            hash_vote_hashes->set_proposal(
+                encodeVoteHash(vote.proposal_hash));
+          }
+          if (vote.flags & CompactVote::kHasBlockHash) {
+            hash_vote_hashes->set_block(encodeVoteHash(vote.block_hash));
+          }
+
+          auto set_signature = [](auto &pb_signature, const auto &data) {
+            pb_signature.set_signature(data.signature.data(),
+                                       data.signature.size());
+            pb_signature.set_pubkey(data.public_key.data(),
+                                    data.public_key.size());
+          };
+          if (vote.flags & CompactVote::kHasBlockSignature) {
+            set_signature(*hash->mutable_block_signature(),
+                          vote.block_signature);
+          }
+          set_signature(*pb_vote.mutable_signature(), vote.signature);
+
+          return pb_vote;
+        }
+
+        /**
+         * Deserialize the vote to the compact form without heap allocations
+         * @return compact vote, or none if the vote is not representable in
+         * the compact form, such votes should be passed to deserializeVote
+         */
+        static boost::optional<CompactVote> deserializeCompactVote(
+            const proto::Vote &pb_vote) {
+          CompactVote vote;
+          vote.block_round = pb_vote.hash().vote_round().block_round();
+          vote.reject_round = pb_vote.hash().vote_round().reject_round();
+          vote.flags = 0;
+
+          auto decode_hash = [&vote](const std::string &hex,
+                                     CompactVote::Hash &hash,
+                                     uint8_t flag) {
+            if (hex.empty()) {
+              return true;
+            }
+            vote.flags |= flag;
+            return decodeVoteHash(hex, hash);
+          };
+          auto copy_signature = [](const auto &pb_signature, auto &data) {
+            const auto &signature = pb_signature.signature();
+            const auto &pubkey = pb_signature.pubkey();
+            if (signature.size() != data.signature.size()
+                or pubkey.size() != data.public_key.size()) {
+              return false;
+            }
+            std::copy(
+                signature.begin(), signature.end(), data.signature.begin());
+            std::copy(pubkey.begin(), pubkey.end(), data.public_key.begin());
+            return true;
+          };
+
+          const auto &hashes = pb_vote.hash().vote_hashes();
+          if (not decode_hash(hashes.proposal(),
+                              vote.proposal_hash,
+                              CompactVote::kHasProposalHash)
+              or not decode_hash(hashes.block(),
+                                 vote.block_hash,
+                                 CompactVote::kHasBlockHash)
+              or not copy_signature(pb_vote.signature(), vote.signature)) {
+            return boost::none;
+          }
+          if (pb_vote.hash().has_block_signature()) {
+            if (not copy_signature(pb_vote.hash().block_signature(),
+                                   vote.block_signature)) {
+              return boost::none;
+            }
+            vote.flags |= CompactVote::kHasBlockSignature;
+          }
+
+          return vote;
+        }
+
+        static proto::CommitCertificate serializeCertificate(
+            const CommitCertificate &certificate) {
+          proto::CommitCertificate pb_certificate;
+
+          auto round = pb_certificate.mutable_vote_round();
+          round->set_block_round(certificate.hash.vote_round.block_round);
+          round->set_reject_round(certificate.hash.vote_round.reject_round);
+          auto hashes = pb_certificate.mutable_vote_hashes();
+          hashes->set_proposal(certificate.hash.vote_hashes.proposal_hash);
+          hashes->set_block(certificate.hash.vote_hashes.block_hash);
+
+          std::string signers((certificate.signers.size() + 7) / 8, 0);
+          for (size_t i = 0; i < certificate.signers.size(); ++i) {
+            if (certificate.signers[i]) {
+              signers[i / 8] |= static_cast<char>(1 << (i % 8));
+            }
+          }
+          pb_certificate.set_signers(std::move(signers));
+
+          for (const auto &signatures : certificate.signatures) {
+            pb_certificate.add_vote_signatures(
+                shared_model::crypto::toBinaryString(
+                    signatures.vote_signature));
+            auto block_signature = pb_certificate.add_block_signatures();
+            if (signatures.block_signature) {
+              block_signature->set_signature(
+                  shared_model::crypto::toBinaryString(
+                      *signatures.block_signature));
+            }
+            if (signatures.block_signature_pubkey) {
+              block_signature->set_pubkey(shared_model::crypto::toBinaryString(
+                  *signatures.block_signature_pubkey));
+            }
+          }
+
+          return pb_certificate;
+        }
+
+        /**
+         * Deserialize the certificate, signers flags are padded to whole bytes
+         * @return certificate, or none if it is malformed or has signatures
+         * of unexpected length
+         */
+        static boost::optional<CommitCertificate> deserializeCertificate(
+            const proto::CommitCertificate &pb_certificate) {
+          const auto &signers = pb_certificate.signers();
+          if (pb_certificate.block_signatures_size()
+                  != pb_certificate.vote_signatures_size()) {
+            return boost::none;
+          }
+
+          CommitCertificate certificate;
+          certificate.hash.vote_round =
+              Round{pb_certificate.vote_round().block_round(),
+                    pb_certificate.vote_round().reject_round()};
+          certificate.hash.vote_hashes =
+              YacHash::VoteHashes{pb_certificate.vote_hashes().proposal(),
+                                  pb_certificate.vote_hashes().block()};
+
+          certificate.signers.reserve(signers.size() * 8);
+          for (size_t i = 0; i < signers.size() * 8; ++i) {
+            certificate.signers.push_back(
+                (static_cast<unsigned char>(signers[i / 8]) >> (i % 8)) & 1);
+          }
+
+          using Algorithm = shared_model::crypto::DefaultCryptoAlgorithmType;
+          auto valid_length = [](const std::string &bytes, size_t length) {
+            return bytes.empty() or bytes.size() == length;
+          };
+          for (int i = 0; i < pb_certificate.vote_signatures_size(); ++i) {
+            const auto &block_signature = pb_certificate.block_signatures(i);
+            if (pb_certificate.vote_signatures(i).size()
+                    != Algorithm::kSignatureLength
+                or not valid_length(block_signature.signature(),
+                                    Algorithm::kSignatureLength)
+                or not valid_length(block_signature.pubkey(),
+                                    Algorithm::kPublicKeyLength)) {
+              return boost::none;
+            }
+
+            CommitCertificate::Signatures signatures{
+                shared_model::crypto::Signed(
+                    pb_certificate.vote_signatures(i)),
+                boost::none,
+                boost::none};
+            if (not block_signature.signature().empty()) {
+              signatures.block_signature =
+                  shared_model::crypto::Signed(block_signature.signature());
+            }
+            if (not block_signature.pubkey().empty()) {
+              signatures.block_signature_pubkey =
+                  shared_model::crypto::PublicKey(block_signature.pubkey());
+            }
+            certificate.signatures.push_back(std::move(signatures));
+          }
+
+          return certificate;
+        }
       };
     }  // namespace yac
   }    // namespace consensus
@@ -9,12 +9,19 @@
 #include "consensus/yac/transport/yac_network_interface.hpp"  // for YacNetworkNotifications
 #include "consensus/yac/yac_gate.hpp"                         // for HashGate
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_set>
 
 #include <boost/optional.hpp>
 #include <rxcpp/rx-lite.hpp>
+#include "common/counter.hpp"
+#include "common/histogram.hpp"
 #include "consensus/yac/cluster_order.hpp"     //  for ClusterOrdering
+#include "consensus/yac/commit_certificate.hpp"
 #include "consensus/yac/outcome_messages.hpp"  // because messages passed by value
 #include "consensus/yac/storage/yac_vote_storage.hpp"  // for VoteStorage
 #include "logger/logger_fwd.hpp"
@@ -25,6 +32,7 @@ namespace iroha {
   namespace consensus {
     namespace yac {
 
+      class DisseminationStrategy;
       class YacCryptoProvider;
       class Timer;
 
@@ -33,6 +41,10 @@ namespace iroha {
         /**
          * Method for creating Yac consensus object
          * @param delay for timer in milliseconds
+         * @param commit_certificates - propagate the collected supermajority
+         * of votes as commit certificate
+         * @param dissemination - choice of the outcome recipients, all peers
+         * receive the outcome from the collector if not set
          */
         static std::shared_ptr<Yac> create(
             YacVoteStorage vote_storage,
@@ -42,7 +54,9 @@ namespace iroha {
             ClusterOrdering order,
             Round round,
             rxcpp::observe_on_one_worker worker,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            bool commit_certificates = false,
+            std::shared_ptr<DisseminationStrategy> dissemination = nullptr);
 
         Yac(YacVoteStorage vote_storage,
             std::shared_ptr<YacNetwork> network,
@@ -51,7 +65,9 @@ namespace iroha {
             ClusterOrdering order,
             Round round,
             rxcpp::observe_on_one_worker worker,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            bool commit_certificates = false,
+            std::shared_ptr<DisseminationStrategy> dissemination = nullptr);
 
         ~Yac() override;
 
@@ -66,8 +82,29 @@ namespace iroha {
 
         // ------|Network notifications|------
 
+        /**
+         * Handle the state in two stages. Peer membership and signatures are
+         * checked without locking, concurrently for the states received by
+         * different transport threads. Only the vote storage update is
+         * serialized.
+         */
         void onState(std::vector<VoteMessage> state) override;
 
+        /**
+         * Restore the votes of the certificate for the peers of the current
+         * round and handle them as the state
+         */
+        void onCertificate(CommitCertificate certificate) override;
+
+        /// number of states in the verification stage, observed on entry
+        const Histogram &verificationQueueDepth() const;
+
+        /// number of states in the storage stage, observed on entry
+        const Histogram &storageQueueDepth() const;
+
+        /// number of votes sent by the voting steps
+        const Counter &votingSteps() const;
+
        private:
         // ------|Private interface|------
 
@@ -97,6 +134,13 @@ namespace iroha {
         void removeUnknownPeersVotes(std::vector<VoteMessage> &votes,
                                      ClusterOrdering &order);
 
+        /**
+         * Report the latencies of the first votes of the peers in the current
+         * round to the timer
+         * @pre mutex_ is locked
+         */
+        void measureVoteLatency(const std::vector<VoteMessage> &state);
+
         // ------|Apply data|------
         /**
          * @pre lock is locked
@@ -120,6 +164,9 @@ namespace iroha {
         ClusterOrdering cluster_order_;
         boost::optional<ClusterOrdering> alternative_order_;
         Round round_;
+        std::chrono::steady_clock::time_point round_start_;
+        /// hex public keys of the peers which votes are measured in the round
+        std::unordered_set<std::string> measured_peers_;
 
         // ------|Fields|------
         rxcpp::observe_on_one_worker worker_;
@@ -129,6 +176,15 @@ namespace iroha {
         std::shared_ptr<YacNetwork> network_;
         std::shared_ptr<YacCryptoProvider> crypto_;
         std::shared_ptr<Timer> timer_;
+        const bool commit_certificates_;
+        std::shared_ptr<DisseminationStrategy> dissemination_;
+
+        // ------|Metrics|------
+        std::atomic<size_t> verification_depth_{0};
+        std::atomic<size_t> storage_depth_{0};
+        Histogram verification_queue_depth_;
+        Histogram storage_queue_depth_;
+        Counter voting_steps_;
       };
     }  // namespace yac
   }    // namespace consensus
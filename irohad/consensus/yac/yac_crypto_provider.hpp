@@ -6,20 +6,22 @@
 #ifndef IROHA_YAC_CRYPTO_PROVIDER_HPP
 #define IROHA_YAC_CRYPTO_PROVIDER_HPP
 
+#include <functional>
+
+#include "consensus/yac/vote_message.hpp"
 #include "consensus/yac/yac_hash_provider.hpp"  // for YacHash (passed by copy)
 
 namespace iroha {
   namespace consensus {
     namespace yac {
 
-      struct VoteMessage;
-
       class YacCryptoProvider {
        public:
         /**
-         * Verify signatory of message
+         * Verify signatories of the votes. Implementations may verify the
+         * signatures of the whole collection in batches
          * @param msg - for verification
-         * @return true if signature correct
+         * @return true if all signatures are correct
          */
         virtual bool verify(const std::vector<VoteMessage> &msg) = 0;
 
@@ -30,6 +32,16 @@ namespace iroha {
          */
         virtual VoteMessage getVote(YacHash hash) = 0;
 
+        /**
+         * Generate vote for provided hash without waiting for the signature
+         * @param hash - hash for signing
+         * @param on_vote - receives the vote, possibly in another thread
+         */
+        virtual void signVote(YacHash hash,
+                              std::function<void(VoteMessage)> on_vote) {
+          on_vote(getVote(std::move(hash)));
+        }
+
         virtual ~YacCryptoProvider() = default;
       };
 
@@ -5,15 +5,25 @@
 
 #include "main/application.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <thread>
+
 #include <boost/filesystem.hpp>
 #include <rxcpp/operators/rx-map.hpp>
+#include "ametsuchi/impl/cached_block_storage.hpp"
 #include "ametsuchi/impl/flat_file_block_storage.hpp"
+#include "ametsuchi/impl/header_indexed_block_storage.hpp"
+#include "ametsuchi/impl/segment_file_block_storage.hpp"
 #include "ametsuchi/impl/k_times_reconnection_strategy.hpp"
 #include "ametsuchi/impl/pool_wrapper.hpp"
 #include "ametsuchi/impl/postgres_block_storage_factory.hpp"
 #include "ametsuchi/impl/storage_impl.hpp"
 #include "ametsuchi/impl/tx_presence_cache_impl.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
 #include "ametsuchi/impl/wsv_restorer_impl.hpp"
+#include "ametsuchi/temporary_wsv.hpp"
 #include "backend/protobuf/proto_block_json_converter.hpp"
 #include "backend/protobuf/proto_permission_to_string.hpp"
 #include "backend/protobuf/proto_proposal_factory.hpp"
@@ -21,7 +31,12 @@
 #include "backend/protobuf/proto_transport_factory.hpp"
 #include "backend/protobuf/proto_tx_status_factory.hpp"
 #include "common/bind.hpp"
+#include "common/named_thread.hpp"
+#include "common/thread_placement.hpp"
+#include "consensus/observer_gate.hpp"
 #include "consensus/yac/consistency_model.hpp"
+#include "consensus/yac/impl/yac_gate_impl.hpp"
+#include "consensus/yac/yac.hpp"
 #include "cryptography/crypto_provider/crypto_model_signer.hpp"
 #include "generator/generator.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory_impl.hpp"
@@ -31,31 +46,47 @@
 #include "main/impl/consensus_init.hpp"
 #include "main/impl/pending_transaction_storage_init.hpp"
 #include "main/impl/pg_connection_init.hpp"
+#include "maintenance/allocation_metrics.hpp"
+#include "maintenance/block_exporter.hpp"
+#include "maintenance/memory_budget.hpp"
+#include "maintenance/metrics_registry.hpp"
+#include "maintenance/metrics_server.hpp"
+#include "maintenance/thread_cpu_usage.hpp"
+#include "maintenance/traffic_capture.hpp"
 #include "main/server_runner.hpp"
 #include "multi_sig_transactions/gossip_propagation_strategy.hpp"
 #include "multi_sig_transactions/mst_processor_impl.hpp"
 #include "multi_sig_transactions/mst_propagation_strategy_stub.hpp"
 #include "multi_sig_transactions/mst_time_provider_impl.hpp"
+#include "multi_sig_transactions/storage/mst_journal.hpp"
 #include "multi_sig_transactions/storage/mst_storage_impl.hpp"
 #include "multi_sig_transactions/transport/mst_transport_grpc.hpp"
 #include "multi_sig_transactions/transport/mst_transport_stub.hpp"
 #include "network/impl/block_loader_impl.hpp"
+#include "network/impl/channel_pool.hpp"
 #include "network/impl/peer_communication_service_impl.hpp"
 #include "network/impl/tls_credentials.hpp"
+#include "ordering/impl/adaptive_proposal_size_strategy.hpp"
 #include "ordering/impl/kick_out_proposal_creation_strategy.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 #include "ordering/impl/on_demand_ordering_gate.hpp"
+#include "ordering/impl/fair_queuing.hpp"
+#include "ordering/impl/on_demand_ordering_service_impl.hpp"
+#include "ordering/impl/on_demand_os_client_grpc.hpp"
+#include "ordering/impl/proposal_request_hedge.hpp"
 #include "simulator/impl/simulator.hpp"
 #include "synchronizer/impl/synchronizer_impl.hpp"
 #include "torii/impl/command_service_impl.hpp"
 #include "torii/impl/command_service_transport_grpc.hpp"
 #include "torii/impl/status_bus_impl.hpp"
 #include "torii/processor/query_processor_impl.hpp"
+#include "torii/processor/query_response_cache.hpp"
 #include "torii/processor/transaction_processor_impl.hpp"
 #include "torii/query_service.hpp"
 #include "torii/tls_params.hpp"
 #include "validation/impl/chain_validator_impl.hpp"
 #include "validation/impl/stateful_validator_impl.hpp"
+#include "validation/validation_pool.hpp"
 #include "validators/always_valid_validator.hpp"
 #include "validators/default_validator.hpp"
 #include "validators/field_validator.hpp"
@@ -79,6 +110,68 @@ using namespace std::chrono_literals;
 static constexpr iroha::consensus::yac::ConsistencyModel
     kConsensusConsistencyModel = iroha::consensus::yac::ConsistencyModel::kCft;
 
+/// priorities of the consumers of the memory budget, the consumers of the
+/// highest one cannot be shrunk and are only reported
+enum MemoryPriority : unsigned {
+  kStatusCachePriority,
+  kPresenceCachePriority,
+  kReportedPriority,
+};
+
+/// heap memory of a transaction status response in the status cache
+static constexpr size_t kStatusCacheItemBytes = 256;
+
+/// time between the enforcements of the memory budget
+static constexpr std::chrono::seconds kMemoryBudgetPeriod{1};
+
+/// number of the recent blocks whose transaction statuses are cached on
+/// startup
+static constexpr shared_model::interface::types::HeightType
+    kPresenceCacheWarmUpBlocks = 1000;
+
+/// number of the recent blocks whose headers are kept in memory
+static constexpr size_t kBlockHeaderIndexSize = 10000;
+
+/// number of the archived block segments fetched for the reads which are
+/// kept locally by default
+static constexpr size_t kDefaultCachedSegments = 4;
+
+/// @return pointer to the metric which shares the ownership of its component
+template <typename Metric, typename Component>
+static std::shared_ptr<const Metric> metricOf(
+    std::shared_ptr<Component> component, const Metric &metric) {
+  return std::shared_ptr<const Metric>(std::move(component), &metric);
+}
+
+/**
+ * Run an init phase and log the time spent in it
+ * @param name - name of the phase
+ * @param phase - function returning the result of the phase
+ */
+template <typename Phase>
+static Irohad::RunResult timedPhase(const logger::LoggerPtr &log,
+                                    const char *name,
+                                    Phase &&phase) {
+  auto start = std::chrono::steady_clock::now();
+  auto result = std::forward<Phase>(phase)();
+  log->info("[Init] {} took {} ms",
+            name,
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start)
+                .count());
+  return result;
+}
+
+/// @return function running the init step of the daemon as a timed phase
+static auto timedInit(Irohad &irohad,
+                      const logger::LoggerPtr &log,
+                      const char *name,
+                      Irohad::RunResult (Irohad::*init)()) {
+  return [&irohad, &log, name, init] {
+    return timedPhase(log, name, [&] { return (irohad.*init)(); });
+  };
+}
+
 /**
  * Configuring iroha daemon
  */
@@ -95,6 +188,50 @@ Irohad::Irohad(
     const shared_model::crypto::Keypair &keypair,
     std::chrono::milliseconds max_rounds_delay,
     size_t stale_stream_max_rounds,
+    bool proposal_streaming,
+    std::chrono::milliseconds batch_flush_delay,
+    size_t batch_flush_size,
+    size_t batch_validation_workers,
+    boost::optional<IrohadConfig::AdaptiveProposalSize> adaptive_proposal_size,
+    bool yac_commit_certificates,
+    size_t yac_gossip_fanout,
+    bool pipelined_consensus,
+    boost::optional<IrohadConfig::AdaptiveVoteDelay> adaptive_vote_delay,
+    boost::optional<uint16_t> metrics_port,
+    bool segmented_block_store,
+    boost::optional<int32_t> block_store_compression_level,
+    size_t block_cache_size,
+    bool fast_wsv_restore,
+    size_t wsv_cache_size,
+    bool async_history_index,
+    size_t query_cache_size,
+    size_t db_pool_size,
+    size_t db_query_pool_size,
+    size_t db_restore_pool_size,
+    size_t stateful_validation_workers,
+    size_t block_loader_max_streams,
+    size_t block_loader_bandwidth,
+    bool torii_async_streams,
+    size_t status_bus_workers,
+    size_t torii_tx_rate_limit,
+    size_t torii_account_tx_rate_limit,
+    size_t torii_max_pending_txs,
+    std::string mst_journal_path,
+    size_t memory_budget,
+    size_t inter_peer_client_threads,
+    size_t inter_peer_max_calls,
+    bool transactions_root,
+    size_t pg_block_flush_size,
+    std::shared_ptr<iroha::maintenance::BlockExporter> block_exporter,
+    size_t pipeline_queue_size,
+    size_t proposal_hedge_percentile,
+    size_t block_sync_interval,
+    boost::optional<IrohadConfig::PeerCompression> peer_compression,
+    boost::optional<IrohadConfig::FairQueuing> fair_queuing,
+    boost::optional<IrohadConfig::BlockArchive> block_archive,
+    size_t torii_server_instances,
+    bool observer,
+    std::shared_ptr<iroha::maintenance::TrafficCapture> traffic_capture,
     boost::optional<shared_model::interface::types::PeerList>
         opt_alternative_peers,
     logger::LoggerManagerTreePtr logger_manager,
@@ -110,10 +247,54 @@ Irohad::Irohad(
       max_proposal_size_(max_proposal_size),
       proposal_delay_(proposal_delay),
       vote_delay_(vote_delay),
-      is_mst_supported_(opt_mst_gossip_params),
+      is_mst_supported_(opt_mst_gossip_params and not observer),
       mst_expiration_time_(mst_expiration_time),
       max_rounds_delay_(max_rounds_delay),
       stale_stream_max_rounds_(stale_stream_max_rounds),
+      proposal_streaming_(proposal_streaming),
+      batch_flush_delay_(batch_flush_delay),
+      batch_flush_size_(batch_flush_size),
+      batch_validation_workers_(batch_validation_workers),
+      adaptive_proposal_size_(std::move(adaptive_proposal_size)),
+      yac_commit_certificates_(yac_commit_certificates),
+      yac_gossip_fanout_(yac_gossip_fanout),
+      pipelined_consensus_(pipelined_consensus),
+      adaptive_vote_delay_(std::move(adaptive_vote_delay)),
+      metrics_port_(metrics_port),
+      segmented_block_store_(segmented_block_store),
+      block_store_compression_level_(block_store_compression_level),
+      block_cache_size_(block_cache_size),
+      fast_wsv_restore_(fast_wsv_restore),
+      wsv_cache_size_(wsv_cache_size),
+      async_history_index_(async_history_index),
+      query_cache_size_(query_cache_size),
+      db_pool_size_(db_pool_size),
+      db_query_pool_size_(db_query_pool_size),
+      db_restore_pool_size_(db_restore_pool_size),
+      stateful_validation_workers_(stateful_validation_workers),
+      block_loader_max_streams_(block_loader_max_streams),
+      block_loader_bandwidth_(block_loader_bandwidth),
+      torii_async_streams_(torii_async_streams),
+      status_bus_workers_(status_bus_workers),
+      torii_tx_rate_limit_(torii_tx_rate_limit),
+      torii_account_tx_rate_limit_(torii_account_tx_rate_limit),
+      torii_max_pending_txs_(torii_max_pending_txs),
+      mst_journal_path_(mst_journal_path),
+      memory_budget_limit_(memory_budget),
+      inter_peer_client_threads_(inter_peer_client_threads),
+      inter_peer_max_calls_(inter_peer_max_calls),
+      transactions_root_(transactions_root),
+      pg_block_flush_size_(pg_block_flush_size),
+      block_exporter_(std::move(block_exporter)),
+      pipeline_queue_size_(pipeline_queue_size),
+      proposal_hedge_percentile_(proposal_hedge_percentile),
+      block_sync_interval_(block_sync_interval),
+      peer_compression_(std::move(peer_compression)),
+      fair_queuing_(std::move(fair_queuing)),
+      block_archive_(std::move(block_archive)),
+      torii_server_instances_(std::max<size_t>(torii_server_instances, 1)),
+      observer_(observer),
+      traffic_capture_(std::move(traffic_capture)),
       opt_alternative_peers_(std::move(opt_alternative_peers)),
       opt_mst_gossip_params_(opt_mst_gossip_params),
       inter_peer_tls_config_(std::move(inter_peer_tls_config)),
@@ -123,9 +304,13 @@ Irohad::Irohad(
       ordering_init(logger_manager->getLogger()),
       yac_init(std::make_unique<iroha::consensus::yac::YacInit>()),
       consensus_gate_objects(consensus_gate_objects_lifetime),
+      metrics_registry_(std::make_shared<maintenance::MetricsRegistry>()),
       log_manager_(std::move(logger_manager)),
       log_(log_manager_->getLogger()) {
   log_->info("created");
+  memory_budget_ = std::make_shared<maintenance::MemoryBudget>(
+      memory_budget_limit_,
+      log_manager_->getChild("MemoryBudget")->getLogger());
   // TODO: rework in a more C++11+ - ish way luckychess 29.06.2019 IR-575
   std::srand(std::time(0));
   // Initializing storage at this point in order to insert genesis block before
@@ -147,34 +332,58 @@ Irohad::~Irohad() {
  * Initializing iroha daemon
  */
 Irohad::RunResult Irohad::init() {
+  auto phase = [this](const char *name, RunResult (Irohad::*init)()) {
+    return timedInit(*this, log_, name, init);
+  };
   // clang-format off
-  return initSettings()
-  | [this]{ return initValidatorsConfigs();}
-  | [this]{ return initWsvRestorer(); // Recover WSV from the existing ledger
-                                      // to be sure it is consistent
-  }
-  | [this]{ return restoreWsv();}
-  | [this]{ return initTlsCredentials();}
-  | [this]{ return initCryptoProvider();}
-  | [this]{ return initBatchParser();}
-  | [this]{ return initValidators();}
-  | [this]{ return initNetworkClient();}
-  | [this]{ return initFactories();}
-  | [this]{ return initPersistentCache();}
-  | [this]{ return initOrderingGate();}
-  | [this]{ return initSimulator();}
-  | [this]{ return initConsensusCache();}
-  | [this]{ return initBlockLoader();}
-  | [this]{ return initConsensusGate();}
-  | [this]{ return initSynchronizer();}
-  | [this]{ return initPeerCommunicationService();}
-  | [this]{ return initStatusBus();}
-  | [this]{ return initMstProcessor();}
+  return phase("settings", &Irohad::initSettings)()
+  | phase("validators configs", &Irohad::initValidatorsConfigs)
+  | phase("WSV restorer", &Irohad::initWsvRestorer)
+  | [this]{ return restoreWsvConcurrently();}
+  | phase("validators", &Irohad::initValidators)
+  | phase("factories", &Irohad::initFactories)
+  | phase("persistent cache", &Irohad::initPersistentCache)
+  | phase("ordering gate", &Irohad::initOrderingGate)
+  | phase("simulator", &Irohad::initSimulator)
+  | phase("consensus cache", &Irohad::initConsensusCache)
+  | phase("block loader", &Irohad::initBlockLoader)
+  | phase("consensus gate", &Irohad::initConsensusGate)
+  | phase("synchronizer", &Irohad::initSynchronizer)
+  | phase("peer communication service",
+          &Irohad::initPeerCommunicationService)
+  | phase("status bus", &Irohad::initStatusBus)
+  | phase("MST processor", &Irohad::initMstProcessor)
 
   // Torii
-  | [this]{ return initTransactionCommandService();}
-  | [this]{ return initQueryService();};
+  | phase("command service", &Irohad::initTransactionCommandService)
+  | phase("query service", &Irohad::initQueryService)
+  | [this] { return presence_cache_warm_up_.get(); };
+  // clang-format on
+}
+
+/**
+ * Recover WSV from the existing ledger to be sure it is consistent. The
+ * replay of the ledger takes the most of the startup, so the components
+ * which depend neither on the WSV nor on each other are initialized
+ * meanwhile
+ */
+Irohad::RunResult Irohad::restoreWsvConcurrently() {
+  auto restored = std::async(
+      std::launch::async,
+      timedInit(*this, log_, "WSV restore", &Irohad::restoreWsv));
+  auto phase = [this](const char *name, RunResult (Irohad::*init)()) {
+    return timedInit(*this, log_, name, init);
+  };
+  // clang-format off
+  auto result = phase("TLS credentials", &Irohad::initTlsCredentials)()
+  | phase("crypto provider", &Irohad::initCryptoProvider)
+  | phase("batch parser", &Irohad::initBatchParser)
+  | phase("network client", &Irohad::initNetworkClient);
   // clang-format on
+  // the restoration is awaited even if the other phases fail, since it uses
+  // the members of the object
+  auto restore_result = restored.get();
+  return result | [&restore_result] { return restore_result; };
 }
 
 /**
@@ -205,19 +414,56 @@ Irohad::RunResult Irohad::initSettings() {
  * Initializing validators' configs
  */
 Irohad::RunResult Irohad::initValidatorsConfigs() {
+  validation_pool_ = std::make_shared<iroha::validation::ValidationPool>(
+      batch_validation_workers_);
+  // the proposals and the blocks of the other peers are validated on the
+  // pool, the transactions of the clients are spread over it by the services
+  auto parallel_for = [pool = validation_pool_](
+                          size_t size, const std::function<void(size_t)> &f) {
+    pool->parallelFor(size, f);
+  };
   validators_config_ =
       std::make_shared<shared_model::validation::ValidatorsConfig>(
           max_proposal_size_, settings_);
   block_validators_config_ =
       std::make_shared<shared_model::validation::ValidatorsConfig>(
-          max_proposal_size_, settings_, true);
+          max_proposal_size_, settings_, true, false, parallel_for);
   proposal_validators_config_ =
       std::make_shared<shared_model::validation::ValidatorsConfig>(
-          max_proposal_size_, settings_, false, true);
+          max_proposal_size_, settings_, false, true, parallel_for);
   log_->info("[Init] => validators configs");
   return {};
 }
 
+rxcpp::observe_on_one_worker Irohad::stageCoordination(
+    const std::string &stage) {
+  if (pipeline_queue_size_ == 0) {
+    return observeOnNamedThread(stage);
+  }
+  auto executor =
+      std::make_shared<iroha::StageExecutor>(stage, pipeline_queue_size_);
+  auto prefix = "iroha_stage_" + stage + "_";
+  std::replace(prefix.begin(), prefix.end(), '-', '_');
+  metrics_registry_->addHistogram(
+      prefix + "wait_microseconds",
+      "Time of the events of the pipeline stage " + stage + " in its queue",
+      metricOf(executor, executor->waitTime()));
+  metrics_registry_->addHistogram(
+      prefix + "run_microseconds",
+      "Time of handling an event by the pipeline stage " + stage,
+      metricOf(executor, executor->runTime()));
+  metrics_registry_->addCounter(
+      prefix + "blocked_posts_total",
+      "Events which waited for the full queue of the pipeline stage "
+          + stage,
+      metricOf(executor, executor->blockedPosts()));
+  metrics_registry_->addGauge(
+      prefix + "queue_depth",
+      "Events in the queue of the pipeline stage " + stage,
+      [executor] { return static_cast<double>(executor->depth()); });
+  return observeOnExecutor(std::move(executor));
+}
+
 /**
  * Initializing iroha daemon storage
  */
@@ -246,12 +492,26 @@ Irohad::RunResult Irohad::initStorage(
     return expected::makeError(string_res.value());
   }
 
-  const int pool_size = 10;
-  auto pool = PgConnectionInit::prepareConnectionPool(
-      iroha::ametsuchi::KTimesReconnectionStrategyFactory{10},
-      *pg_opt,
-      pool_size,
-      log_manager_);
+  iroha::ametsuchi::KTimesReconnectionStrategyFactory reconnection_factory{
+      10, std::chrono::milliseconds(100)};
+  auto reconnection_statistics = reconnection_factory.statistics();
+  metrics_registry_->addCounter(
+      "iroha_db_failovers_total",
+      "Lost database connections, for which reconnection has started",
+      reconnection_statistics->failovers);
+  metrics_registry_->addCounter("iroha_db_reconnection_attempts_total",
+                                "Attempts to reconnect to the database",
+                                reconnection_statistics->attempts);
+  metrics_registry_->addCounter(
+      "iroha_db_reconnections_exhausted_total",
+      "Database reconnections which have run out of attempts",
+      reconnection_statistics->exhausted);
+  auto pool = PgConnectionInit::prepareConnectionPool(reconnection_factory,
+                                                      *pg_opt,
+                                                      db_pool_size_,
+                                                      log_manager_,
+                                                      db_query_pool_size_,
+                                                      db_restore_pool_size_);
 
   if (auto error = resultToOptionalError(pool)) {
     return expected::makeError(std::move(*error));
@@ -264,23 +524,81 @@ Irohad::RunResult Irohad::initStorage(
           pool_wrapper_,
           block_transport_factory,
           []() { return generator::randomString(20); },
-          log_manager_->getChild("TemporaryBlockStorage")->getLogger());
+          log_manager_->getChild("TemporaryBlockStorage")->getLogger(),
+          pg_block_flush_size_);
 
   std::unique_ptr<BlockStorage> persistent_block_storage;
-  if (block_store_dir_) {
+  if (block_archive_ and not segmented_block_store_) {
+    log_->warn("block_archive is ignored without segmented_block_store");
+  }
+  if (block_store_dir_ and segmented_block_store_) {
+    // the transaction index is archived along with the blocks
+    boost::optional<SegmentFile::Archive> archive, tx_index_archive;
+    if (block_archive_) {
+      archive = SegmentFile::Archive{
+          block_archive_->path,
+          block_archive_->local_blocks,
+          block_archive_->cached_segments.value_or(kDefaultCachedSegments)};
+      tx_index_archive = *archive;
+      tx_index_archive->path =
+          (boost::filesystem::path{block_archive_->path} / "tx_index")
+              .string();
+    }
+    auto segment_file = SegmentFile::create(
+        *block_store_dir_,
+        log_manager_->getChild("SegmentFile")->getLogger(),
+        SegmentFile::kDefaultSegmentSize,
+        std::move(archive));
+    if (not segment_file) {
+      return expected::makeError(
+          "Unable to create SegmentFile for persistent storage");
+    }
+    // the locations of the transactions are indexed next to the blocks
+    auto tx_index = SegmentFile::create(
+        (boost::filesystem::path{*block_store_dir_} / "tx_index").string(),
+        log_manager_->getChild("TxIndex")->getLogger(),
+        SegmentFile::kDefaultSegmentSize,
+        std::move(tx_index_archive));
+    if (not tx_index) {
+      return expected::makeError(
+          "Unable to create SegmentFile for transaction index");
+    }
+    persistent_block_storage = std::make_unique<SegmentFileBlockStorage>(
+        std::move(segment_file.get()),
+        block_transport_factory,
+        log_manager_->getChild("SegmentFileBlockStorage")->getLogger(),
+        std::move(tx_index.get()));
+  } else if (block_store_dir_) {
     auto flat_file = FlatFile::create(
         *block_store_dir_, log_manager_->getChild("FlatFile")->getLogger());
     if (not flat_file) {
       return expected::makeError(
           "Unable to create FlatFile for persistent storage");
     }
+    // the compressor is created regardless of the level to read the blocks
+    // which were compressed before
+    auto compressor = BlockCompressor::create(
+        *block_store_dir_,
+        block_store_compression_level_,
+        log_manager_->getChild("BlockCompressor")->getLogger());
+    if (not compressor) {
+      return expected::makeError(
+          "Unable to create BlockCompressor for persistent storage");
+    }
     std::shared_ptr<shared_model::interface::BlockJsonConverter>
         block_converter =
             std::make_shared<shared_model::proto::ProtoBlockJsonConverter>();
-    persistent_block_storage = std::make_unique<FlatFileBlockStorage>(
+    auto flat_file_block_storage = std::make_unique<FlatFileBlockStorage>(
         std::move(flat_file.get()),
         block_converter,
-        log_manager_->getChild("FlatFileBlockStorage")->getLogger());
+        log_manager_->getChild("FlatFileBlockStorage")->getLogger(),
+        std::move(compressor.get()));
+    // the blocks which a crash left unsynced are downloaded from the peers
+    // again, and the WSV is restored from the rest
+    if (auto removed = flat_file_block_storage->removeTornBlocks()) {
+      log_->warn("Removed {} torn blocks from the block store", removed);
+    }
+    persistent_block_storage = std::move(flat_file_block_storage);
   } else {
     auto sql =
         std::make_unique<soci::session>(*pool_wrapper_->connection_pool_);
@@ -291,9 +609,68 @@ Irohad::RunResult Irohad::initStorage(
     if (boost::get<expected::Error<std::string>>(&create_table_result)) {
       return create_table_result;
     }
-    persistent_block_storage = std::make_unique<PostgresBlockStorage>(
-        pool_wrapper_, block_transport_factory, persistent_table, log_);
+    persistent_block_storage =
+        std::make_unique<PostgresBlockStorage>(pool_wrapper_,
+                                               block_transport_factory,
+                                               persistent_table,
+                                               log_,
+                                               pg_block_flush_size_);
+  }
+  if (block_cache_size_ != 0) {
+    auto cached_block_storage = std::make_unique<CachedBlockStorage>(
+        std::move(persistent_block_storage), block_cache_size_);
+    block_cache_ = cached_block_storage.get();
+    metrics_registry_->addCounter("iroha_block_cache_hits_total",
+                                  "Requested blocks found in the block cache",
+                                  cached_block_storage->hits());
+    metrics_registry_->addCounter("iroha_block_cache_misses_total",
+                                  "Requested blocks read from the block store",
+                                  cached_block_storage->misses());
+    persistent_block_storage = std::move(cached_block_storage);
   }
+  persistent_block_storage = std::make_unique<HeaderIndexedBlockStorage>(
+      std::move(persistent_block_storage), kBlockHeaderIndexSize);
+  std::shared_ptr<WsvCache> wsv_cache;
+  if (wsv_cache_size_ != 0) {
+    wsv_cache = std::make_shared<WsvCache>(wsv_cache_size_);
+    wsv_cache_ = wsv_cache;
+    metrics_registry_->addCounter(
+        "iroha_wsv_cache_hits_total",
+        "Transaction creators found in the signatories cache",
+        wsv_cache->hits());
+    metrics_registry_->addCounter(
+        "iroha_wsv_cache_misses_total",
+        "Transaction creators whose signatories are read from the database",
+        wsv_cache->misses());
+  }
+  auto statement_metrics = std::make_shared<StatementMetrics>(
+      pg_opt->slowStatementThreshold(),
+      log_manager_->getChild("Statements")->getLogger());
+  metrics_registry_->addHistogramFamily(
+      "iroha_db_statement_microseconds",
+      "Execution time of the database statements by their kind and name",
+      [statement_metrics] {
+        std::vector<maintenance::MetricsRegistry::LabeledHistogram> histograms;
+        for (auto &sample : statement_metrics->samples()) {
+          histograms.push_back(
+              {{{"kind", std::move(sample.kind)},
+                {"statement", std::move(sample.name)}},
+               std::move(sample.time)});
+        }
+        return histograms;
+      });
+  metrics_registry_->addCounterFamily(
+      "iroha_db_statement_rows_total",
+      "Rows returned or written by the database statements which report them",
+      [statement_metrics] {
+        std::vector<maintenance::MetricsRegistry::Sample> samples;
+        for (auto &sample : statement_metrics->samples()) {
+          samples.push_back({{{"kind", std::move(sample.kind)},
+                              {"statement", std::move(sample.name)}},
+                             static_cast<double>(sample.rows)});
+        }
+        return samples;
+      });
   return StorageImpl::create(std::move(pg_opt),
                              pool_wrapper_,
                              perm_converter,
@@ -301,7 +678,12 @@ Irohad::RunResult Irohad::initStorage(
                              query_response_factory_,
                              std::move(temporary_block_storage_factory),
                              std::move(persistent_block_storage),
-                             log_manager_->getChild("Storage"))
+                             log_manager_->getChild("Storage"),
+                             std::move(wsv_cache),
+                             async_history_index_,
+                             db_pool_size_,
+                             block_sync_interval_,
+                             std::move(statement_metrics))
              | [&](auto &&v) -> RunResult {
     storage = std::move(v);
     log_->info("[Init] => storage");
@@ -379,13 +761,28 @@ Irohad::RunResult Irohad::initValidators() {
   auto factory = std::make_unique<shared_model::proto::ProtoProposalFactory<
       shared_model::validation::DefaultProposalValidator>>(validators_config_);
   auto validators_log_manager = log_manager_->getChild("Validators");
-  stateful_validator = std::make_shared<StatefulValidatorImpl>(
-      std::move(factory),
-      batch_parser,
-      validators_log_manager->getChild("Stateful")->getLogger());
+  auto stateful_log = validators_log_manager->getChild("Stateful")->getLogger();
+  auto worker_wsv_factory = [storage = storage, log = stateful_log]()
+      -> std::unique_ptr<iroha::ametsuchi::TemporaryWsv> {
+    return storage->createCommandExecutor().match(
+        [&storage](auto &&command_executor) {
+          return storage->createTemporaryWsv(
+              std::move(command_executor.value));
+        },
+        [&log](const auto &error) {
+          log->warn("Failed to create a worker WSV: {}", error.error);
+          return std::unique_ptr<iroha::ametsuchi::TemporaryWsv>{};
+        });
+  };
+  stateful_validator =
+      std::make_shared<StatefulValidatorImpl>(std::move(factory),
+                                              stateful_log,
+                                              std::move(worker_wsv_factory),
+                                              stateful_validation_workers_);
   chain_validator = std::make_shared<ChainValidatorImpl>(
       getSupermajorityChecker(kConsensusConsistencyModel),
-      validators_log_manager->getChild("Chain")->getLogger());
+      validators_log_manager->getChild("Chain")->getLogger(),
+      std::thread::hardware_concurrency());
 
   log_->info("[Init] => validators");
   return {};
@@ -397,7 +794,75 @@ Irohad::RunResult Irohad::initValidators() {
 Irohad::RunResult Irohad::initNetworkClient() {
   async_call_ =
       std::make_shared<network::AsyncGrpcClient<google::protobuf::Empty>>(
-          log_manager_->getChild("AsyncNetworkClient")->getLogger());
+          log_manager_->getChild("AsyncNetworkClient")->getLogger(),
+          inter_peer_client_threads_,
+          inter_peer_max_calls_);
+  metrics_registry_->addHistogram(
+      "iroha_inter_peer_call_latency_milliseconds",
+      "Time from the start of an asynchronous call to a peer to its "
+      "completion",
+      metricOf(async_call_, async_call_->callLatency()));
+  metrics_registry_->addCounter(
+      "iroha_inter_peer_dropped_calls_total",
+      "Asynchronous calls dropped due to the limit of the calls to a peer",
+      metricOf(async_call_, async_call_->droppedCalls()));
+  // the inter-peer services share one connection per peer
+  channel_pool_ = std::make_shared<network::ChannelPool>(
+      std::vector<std::string>{
+          consensus::yac::proto::Yac::service_full_name(),
+          ordering::proto::OnDemandOrdering::service_full_name(),
+          network::proto::Loader::service_full_name(),
+          network::transport::MstTransportGrpc::service_full_name()});
+  metrics_registry_->addCounter(
+      "iroha_inter_peer_connections_total",
+      "Connections established to the peers, each with a handshake",
+      metricOf(channel_pool_, channel_pool_->connections()));
+  if (peer_compression_) {
+    // smaller messages barely shrink, while the compression costs the time
+    static const size_t kCompressionMinBytesDefault = 1024;
+    auto min_bytes =
+        peer_compression_->min_bytes.value_or(kCompressionMinBytesDefault);
+    auto policy = [min_bytes](const boost::optional<std::string> &name)
+        -> std::shared_ptr<network::CompressionPolicy> {
+      if (not name) {
+        return nullptr;
+      }
+      auto algorithm = network::CompressionPolicy::parseAlgorithm(*name);
+      if (not algorithm or *algorithm == GRPC_COMPRESS_NONE) {
+        return nullptr;
+      }
+      return std::make_shared<network::CompressionPolicy>(*algorithm,
+                                                          min_bytes);
+    };
+    proposal_compression_ = policy(peer_compression_->proposals);
+    block_compression_ = policy(peer_compression_->blocks);
+    batches_compression_ = policy(peer_compression_->batches);
+    metrics_registry_->addCounterFamily(
+        "iroha_inter_peer_message_bytes_total",
+        "Size of the messages sent to the peers by the compressed services, "
+        "before the compression",
+        [policies = std::vector<std::pair<
+             std::string,
+             std::shared_ptr<network::CompressionPolicy>>>{
+             {"proposals", proposal_compression_},
+             {"blocks", block_compression_},
+             {"batches", batches_compression_}}] {
+          std::vector<maintenance::MetricsRegistry::Sample> samples;
+          for (const auto &policy : policies) {
+            if (policy.second) {
+              samples.push_back(
+                  {{{"service", policy.first}, {"compressed", "true"}},
+                   static_cast<double>(
+                       policy.second->compressedBytes().value())});
+              samples.push_back(
+                  {{{"service", policy.first}, {"compressed", "false"}},
+                   static_cast<double>(
+                       policy.second->uncompressedBytes().value())});
+            }
+          }
+          return samples;
+        });
+  }
   return {};
 }
 
@@ -458,6 +923,13 @@ Irohad::RunResult Irohad::initFactories() {
                                                  shared_model::proto::Query>>(
       std::move(query_validator), std::move(proto_query_validator));
 
+  batch_query_factory = std::make_shared<
+      shared_model::proto::ProtoTransportFactory<shared_model::interface::Query,
+                                                 shared_model::proto::Query>>(
+      std::make_unique<shared_model::validation::DefaultUnsignedQueryValidator>(
+          validators_config_),
+      std::make_unique<shared_model::validation::ProtoQueryValidator>());
+
   auto blocks_query_validator = std::make_unique<
       shared_model::validation::DefaultSignedBlocksQueryValidator>(
       validators_config_);
@@ -479,7 +951,30 @@ Irohad::RunResult Irohad::initFactories() {
  * Initializing persistent cache
  */
 Irohad::RunResult Irohad::initPersistentCache() {
-  persistent_cache = std::make_shared<TxPresenceCacheImpl>(storage);
+  auto presence_cache = std::make_shared<TxPresenceCacheImpl>(storage);
+  memory_budget_->addConsumer(
+      {"tx_presence_cache",
+       kPresenceCachePriority,
+       [presence_cache] { return presence_cache->memoryUsage(); },
+       [presence_cache](size_t bytes) { presence_cache->limitMemory(bytes); }});
+  persistent_cache = presence_cache;
+
+  // the statuses of the recent transactions are read while the other
+  // components are initialized
+  presence_cache_warm_up_ = std::async(
+      std::launch::async, [this, presence_cache]() -> RunResult {
+        return timedPhase(
+            log_, "tx presence cache warm-up", [&]() -> RunResult {
+              if (auto cached =
+                      presence_cache->warmUp(kPresenceCacheWarmUpBlocks)) {
+                log_->info("[Init] => {} statuses in tx presence cache",
+                           *cached);
+              } else {
+                log_->warn("Failed to warm up tx presence cache");
+              }
+              return {};
+            });
+      });
 
   log_->info("[Init] => persistent cache");
   return {};
@@ -508,18 +1003,15 @@ Irohad::RunResult Irohad::initOrderingGate() {
 
   for (decltype(top_height) i = top_height - block_hashes + 1; i <= top_height;
        ++i) {
-    auto block_result = (*block_query)->getBlock(i);
+    auto header_result = (*block_query)->getBlockHeader(i);
 
-    if (auto e = expected::resultToOptionalError(block_result)) {
+    if (auto e = expected::resultToOptionalError(header_result)) {
       return iroha::expected::makeError(std::move(e->message));
     }
 
-    auto &block =
-        boost::get<
-            expected::Value<std::unique_ptr<shared_model::interface::Block>>>(
-            block_result)
-            .value;
-    hashes.push_back(block->hash());
+    hashes.push_back(
+        boost::get<expected::ValueOf<decltype(header_result)>>(header_result)
+            .value.hash);
   }
 
   auto factory = std::make_unique<shared_model::proto::ProtoProposalFactory<
@@ -555,6 +1047,48 @@ Irohad::RunResult Irohad::initOrderingGate() {
   std::shared_ptr<iroha::ordering::ProposalCreationStrategy> proposal_strategy =
       std::make_shared<ordering::KickOutProposalCreationStrategy>(
           getSupermajorityChecker(kConsensusConsistencyModel));
+  if (adaptive_proposal_size_) {
+    proposal_strategy =
+        std::make_shared<ordering::AdaptiveProposalSizeStrategy>(
+            std::move(proposal_strategy),
+            adaptive_proposal_size_->min_size,
+            max_proposal_size_,
+            std::chrono::milliseconds(
+                adaptive_proposal_size_->target_round_time));
+  }
+
+  std::shared_ptr<ordering::FairQueuing> fair_queuing;
+  if (fair_queuing_) {
+    std::vector<ordering::FairQueuing::Group> groups;
+    for (const auto &group :
+         fair_queuing_->groups.value_or(
+             std::vector<IrohadConfig::FairQueuingGroup>{})) {
+      groups.push_back({group.name, group.weight, group.members});
+    }
+    fair_queuing = std::make_shared<ordering::FairQueuing>(std::move(groups));
+    metrics_registry_->addGaugeFamily(
+        "iroha_ordering_pending_txs",
+        "Transactions of the fair queuing groups waiting for a proposal",
+        [fair_queuing] {
+          std::vector<maintenance::MetricsRegistry::Sample> samples;
+          for (const auto &group : fair_queuing->stats()) {
+            samples.push_back({{{"group", group.name}},
+                               static_cast<double>(group.pending_txs)});
+          }
+          return samples;
+        });
+    metrics_registry_->addCounterFamily(
+        "iroha_ordering_packed_txs_total",
+        "Transactions of the fair queuing groups taken into the proposals",
+        [fair_queuing] {
+          std::vector<maintenance::MetricsRegistry::Sample> samples;
+          for (const auto &group : fair_queuing->stats()) {
+            samples.push_back({{{"group", group.name}},
+                               static_cast<double>(group.packed_txs)});
+          }
+          return samples;
+        });
+  }
 
   ordering_gate =
       ordering_init.initOrderingGate(max_proposal_size_,
@@ -564,12 +1098,58 @@ Irohad::RunResult Irohad::initOrderingGate() {
                                      batch_parser,
                                      transaction_batch_factory_,
                                      async_call_,
+                                     channel_pool_,
                                      std::move(factory),
                                      proposal_factory,
                                      persistent_cache,
                                      proposal_strategy,
+                                     std::move(fair_queuing),
                                      delay,
+                                     proposal_streaming_,
+                                     batch_flush_delay_,
+                                     batch_flush_size_,
+                                     validation_pool_,
+                                     proposal_compression_,
+                                     batches_compression_,
+                                     pipelined_consensus_,
+                                     consensus_gate_objects.get_observable(),
+                                     stageCoordination("od-prefetch"),
                                      log_manager_->getChild("Ordering"));
+  const auto &gate = ordering_init.gate;
+  metrics_registry_->addHistogram(
+      "iroha_ordering_proposal_latency_milliseconds",
+      "Time from the round switch to the proposal of the round",
+      metricOf(gate, gate->proposalLatency()));
+  metrics_registry_->addHistogram(
+      "iroha_ordering_proposal_filter_microseconds",
+      "Time of filtering the proposal against the ledger",
+      metricOf(gate, gate->proposalFilterTime()));
+  metrics_registry_->addGauge(
+      "iroha_ordering_gate_cache_bytes",
+      "Size of the transactions resent by the ordering gate",
+      [cache = ordering_init.gate_cache] { return cache->sizeInBytes(); });
+  memory_budget_->addConsumer(
+      {"ordering_gate_cache",
+       kReportedPriority,
+       [cache = ordering_init.gate_cache] { return cache->sizeInBytes(); },
+       {}});
+  if (proposal_hedge_percentile_ > 0) {
+    // the deadline is not shortened below the usual round trip to the peer
+    static const std::chrono::milliseconds kMinHedgeDelay{50};
+    auto hedge = std::make_shared<ordering::ProposalRequestHedge>(
+        proposal_hedge_percentile_, kMinHedgeDelay);
+    ordering_init.client_factory->setProposalRequestHedge(hedge);
+    metrics_registry_->addCounter(
+        "iroha_ordering_proposal_requests_given_up_total",
+        "Proposal requests given up before the timeout as the issuer is slow",
+        metricOf(hedge, hedge->givenUp()));
+    metrics_registry_->addGauge(
+        "iroha_ordering_proposal_request_deadline_milliseconds",
+        "Deadline of the proposal requests derived from their latencies",
+        [hedge, timeout = proposal_delay_] {
+          return static_cast<double>(hedge->delay(timeout).count());
+        });
+  }
   log_->info("[Init] => init ordering gate - [{}]",
              logger::boolRepr(bool(ordering_gate)));
   return {};
@@ -592,8 +1172,21 @@ Irohad::RunResult Irohad::initSimulator() {
             std::make_unique<
                 shared_model::validation::DefaultUnsignedBlockValidator>(
                 block_validators_config_),
-            std::make_unique<shared_model::validation::ProtoBlockValidator>());
-
+            std::make_unique<shared_model::validation::ProtoBlockValidator>(),
+            [pool = validation_pool_](size_t size,
+                                      const std::function<void(size_t)> &f) {
+              pool->parallelFor(size, f);
+            },
+            transactions_root_);
+
+    // the prefetched proposals are validated once their block is committed
+    auto speculative_proposals =
+        ordering_init.gate->onPrefetchedProposal().map([](auto prefetched) {
+          return Simulator::SpeculativeProposal{
+              std::move(prefetched.proposal),
+              prefetched.assumption.next_round,
+              prefetched.assumption.top_hash};
+        });
     simulator = std::make_shared<Simulator>(
         std::move(command_executor),
         ordering_gate,
@@ -601,7 +1194,22 @@ Irohad::RunResult Irohad::initSimulator() {
         storage,
         crypto_signer_,
         std::move(block_factory),
-        log_manager_->getChild("Simulator")->getLogger());
+        log_manager_->getChild("Simulator")->getLogger(),
+        std::move(speculative_proposals),
+        storage->on_commit(),
+        stageCoordination("speculation"));
+    metrics_registry_->addHistogram(
+        "iroha_simulator_validation_milliseconds",
+        "Time of the stateful validation of the proposal",
+        metricOf(simulator, simulator->validationTime()));
+    metrics_registry_->addHistogram(
+        "iroha_simulator_block_creation_milliseconds",
+        "Time of the creation of the block from the verified proposal",
+        metricOf(simulator, simulator->blockCreationTime()));
+    metrics_registry_->addCounter(
+        "iroha_simulator_speculations_reused_total",
+        "Proposals validated before their round and reused by the round",
+        metricOf(simulator, simulator->speculationsReused()));
 
     log_->info("[Init] => init simulator");
     return {};
@@ -626,8 +1234,21 @@ Irohad::RunResult Irohad::initBlockLoader() {
       loader_init.initBlockLoader(storage,
                                   storage,
                                   consensus_result_cache_,
+                                  storage,
                                   block_validators_config_,
+                                  block_loader_max_streams_,
+                                  block_loader_bandwidth_,
+                                  channel_pool_,
+                                  block_compression_,
                                   log_manager_->getChild("BlockLoader"));
+  metrics_registry_->addCounter(
+      "iroha_block_loader_rejected_streams_total",
+      "Block streams rejected due to the limit of the served streams",
+      metricOf(loader_init.service, loader_init.service->rejectedStreams()));
+  metrics_registry_->addCounter(
+      "iroha_block_loader_cached_blocks_total",
+      "Streamed blocks found in the cache of the parsed blocks",
+      metricOf(loader_init.service, loader_init.service->cachedBlockHits()));
 
   log_->info("[Init] => block loader");
   return {};
@@ -637,22 +1258,39 @@ Irohad::RunResult Irohad::initBlockLoader() {
  * Initializing consensus gate
  */
 Irohad::RunResult Irohad::initConsensusGate() {
+  if (observer_) {
+    observer_gate_ = std::make_shared<consensus::ObserverGate>(
+        block_loader,
+        consensus::ObserverGate::kDefaultPollInterval,
+        log_manager_->getChild("ObserverGate")->getLogger());
+    consensus_gate = observer_gate_;
+    subscribeToConsensusGate();
+    log_->info("[Init] => observer gate");
+    return {};
+  }
+
   auto block_query = storage->createBlockQuery();
   if (not block_query) {
     return iroha::expected::makeError<std::string>(
         "Failed to create block query");
   }
-  auto block_var =
-      (*block_query)->getBlock((*block_query)->getTopBlockHeight());
-  if (auto e = expected::resultToOptionalError(block_var)) {
+  auto header_var =
+      (*block_query)->getBlockHeader((*block_query)->getTopBlockHeight());
+  if (auto e = expected::resultToOptionalError(header_var)) {
     return iroha::expected::makeError<std::string>(
         "Failed to get the top block: " + e->message);
   }
 
-  auto &block =
-      boost::get<expected::ValueOf<decltype(block_var)>>(&block_var)->value;
+  auto &header =
+      boost::get<expected::ValueOf<decltype(header_var)>>(&header_var)->value;
+  boost::optional<VoteDelayBounds> adaptive_vote_delay;
+  if (adaptive_vote_delay_) {
+    adaptive_vote_delay = VoteDelayBounds{
+        std::chrono::milliseconds(adaptive_vote_delay_->min_delay),
+        std::chrono::milliseconds(adaptive_vote_delay_->max_delay)};
+  }
   consensus_gate = yac_init->initConsensusGate(
-      {block->height(), ordering::kFirstRejectRound},
+      {header.height, ordering::kFirstRejectRound},
       storage,
       opt_alternative_peers_,
       simulator,
@@ -661,13 +1299,58 @@ Irohad::RunResult Irohad::initConsensusGate() {
       consensus_result_cache_,
       vote_delay_,
       async_call_,
+      channel_pool_,
       kConsensusConsistencyModel,
+      yac_commit_certificates_,
+      yac_gossip_fanout_,
+      std::move(adaptive_vote_delay),
+      stageCoordination("yac"),
       log_manager_->getChild("Consensus"));
+  subscribeToConsensusGate();
+
+  auto yac = yac_init->getYac();
+  auto yac_gate = yac_init->getYacGate();
+  metrics_registry_->addCounter("iroha_yac_voting_steps_total",
+                                "Votes sent by the voting steps",
+                                metricOf(yac, yac->votingSteps()));
+  metrics_registry_->addHistogram(
+      "iroha_yac_verification_queue_depth",
+      "Received states in the verification stage",
+      metricOf(yac, yac->verificationQueueDepth()));
+  metrics_registry_->addHistogram("iroha_yac_storage_queue_depth",
+                                  "Received states in the storage stage",
+                                  metricOf(yac, yac->storageQueueDepth()));
+  metrics_registry_->addHistogram(
+      "iroha_consensus_outcome_latency_milliseconds",
+      "Time from the vote to the consensus outcome of the round",
+      metricOf(yac_gate, yac_gate->outcomeLatency()));
+  metrics_registry_->addCounter("iroha_consensus_commits_total",
+                                "Commit outcomes of the consensus",
+                                metricOf(yac_gate, yac_gate->commits()));
+  metrics_registry_->addCounter("iroha_consensus_rejects_total",
+                                "Reject outcomes of the consensus",
+                                metricOf(yac_gate, yac_gate->rejects()));
+  if (auto timer = yac_init->getAdaptiveTimer()) {
+    metrics_registry_->addHistogram("iroha_yac_vote_delay_milliseconds",
+                                    "Delays of the voting steps",
+                                    metricOf(timer, timer->delays()));
+    metrics_registry_->addGauge(
+        "iroha_yac_current_vote_delay_milliseconds",
+        "Delay of the next voting step",
+        [timer] { return timer->currentDelay().count(); });
+  }
+  log_->info("[Init] => consensus gate");
+  return {};
+}
+
+void Irohad::subscribeToConsensusGate() {
   consensus_gate->onOutcome().subscribe(
       consensus_gate_events_subscription,
       consensus_gate_objects.get_subscriber());
-  log_->info("[Init] => consensus gate");
-  return {};
+  // the reloaded tunables are applied between the rounds
+  consensus_gate_objects.get_observable().subscribe(
+      consensus_gate_events_subscription,
+      [this](const auto &) { applyPendingTunables(); });
 }
 
 /**
@@ -676,14 +1359,52 @@ Irohad::RunResult Irohad::initConsensusGate() {
 Irohad::RunResult Irohad::initSynchronizer() {
   return storage->createCommandExecutor() |
              [this](auto &&command_executor) -> RunResult {
-    synchronizer = std::make_shared<SynchronizerImpl>(
+    auto synchronizer_impl = std::make_shared<SynchronizerImpl>(
         std::move(command_executor),
         consensus_gate,
         chain_validator,
         storage,
         storage,
         block_loader,
-        log_manager_->getChild("Synchronizer")->getLogger());
+        log_manager_->getChild("Synchronizer")->getLogger(),
+        SynchronizerImpl::kDefaultPrefetchedBlocks,
+        SynchronizerImpl::kDefaultRangeDownloadThreshold,
+        observer_ ? nullptr : yac_init->getBlockFetcher());
+    metrics_registry_->addHistogram(
+        "iroha_synchronizer_commit_milliseconds",
+        "Time of applying and committing the agreed block",
+        metricOf(synchronizer_impl, synchronizer_impl->commitTime()));
+    metrics_registry_->addHistogram(
+        "iroha_synchronizer_synchronization_milliseconds",
+        "Time of downloading and committing the missing blocks",
+        metricOf(synchronizer_impl, synchronizer_impl->synchronizationTime()));
+    metrics_registry_->addCounter(
+        "iroha_synchronizer_prepared_commits_total",
+        "Agreed blocks committed from the state prepared by the validation",
+        metricOf(synchronizer_impl, synchronizer_impl->preparedCommits()));
+    metrics_registry_->addCounter(
+        "iroha_synchronizer_applied_commits_total",
+        "Agreed blocks whose transactions were applied again on commit",
+        metricOf(synchronizer_impl, synchronizer_impl->appliedCommits()));
+    metrics_registry_->addCounter(
+        "iroha_synchronizer_downloaded_blocks_total",
+        "Blocks downloaded during the synchronization",
+        metricOf(synchronizer_impl, synchronizer_impl->downloadedBlocks()));
+    metrics_registry_->addCounter(
+        "iroha_synchronizer_fetched_commits_total",
+        "Synchronizations which committed the blocks fetched by the gate",
+        metricOf(synchronizer_impl, synchronizer_impl->fetchedCommits()));
+    metrics_registry_->addGauge(
+        "iroha_synchronizer_prefetched_blocks",
+        "Downloaded blocks waiting to be applied",
+        [synchronizer_impl] { return synchronizer_impl->prefetchedBlocks(); });
+    metrics_registry_->addGauge(
+        "iroha_synchronizer_blocks_per_second",
+        "Blocks per second applied by the current or the last synchronization",
+        [synchronizer_impl] {
+          return synchronizer_impl->synchronizationRate();
+        });
+    synchronizer = std::move(synchronizer_impl);
 
     log_->info("[Init] => synchronizer");
     return {};
@@ -694,11 +1415,35 @@ Irohad::RunResult Irohad::initSynchronizer() {
  * Initializing peer communication service
  */
 Irohad::RunResult Irohad::initPeerCommunicationService() {
+  PeerCommunicationServiceImpl::BatchObserver batch_observer;
+  if (traffic_capture_) {
+    batch_observer = [capture = traffic_capture_](const auto &batch) {
+      capture->batch(batch);
+    };
+  }
   pcs = std::make_shared<PeerCommunicationServiceImpl>(
       ordering_gate,
       synchronizer,
       simulator,
-      log_manager_->getChild("PeerCommunicationService")->getLogger());
+      log_manager_->getChild("PeerCommunicationService")->getLogger(),
+      std::move(batch_observer));
+
+  if (traffic_capture_) {
+    pcs->onProposal().subscribe([capture = traffic_capture_](
+                                    const auto &event) {
+      if (event.proposal) {
+        capture->proposal(event.round, **event.proposal);
+      }
+    });
+    metrics_registry_->addCounter(
+        "iroha_traffic_capture_records_total",
+        "Records written to the traffic capture",
+        metricOf(traffic_capture_, traffic_capture_->written()));
+    metrics_registry_->addCounter(
+        "iroha_traffic_capture_dropped_total",
+        "Records dropped because the traffic capture lagged behind",
+        metricOf(traffic_capture_, traffic_capture_->dropped()));
+  }
 
   pcs->onProposal().subscribe([this](const auto &) {
     log_->info("~~~~~~~~~| PROPOSAL ^_^ |~~~~~~~~~ ");
@@ -728,7 +1473,16 @@ Irohad::RunResult Irohad::initPeerCommunicationService() {
 }
 
 Irohad::RunResult Irohad::initStatusBus() {
-  status_bus_ = std::make_shared<StatusBusImpl>();
+  auto status_bus = std::make_shared<StatusBusImpl>(status_bus_workers_);
+  metrics_registry_->addGauge(
+      "iroha_status_bus_transaction_subscribers",
+      "Subscribers to the statuses of particular transactions",
+      [status_bus] { return status_bus->transactionSubscribers(); });
+  metrics_registry_->addHistogram(
+      "iroha_status_bus_delivery_lag_microseconds",
+      "Time from the publication of a status to its delivery",
+      metricOf(status_bus, status_bus->deliveryLag()));
+  status_bus_ = std::move(status_bus);
   log_->info("[Init] => Tx status bus");
   return {};
 }
@@ -738,10 +1492,28 @@ Irohad::RunResult Irohad::initMstProcessor() {
       log_manager_->getChild("MultiSignatureTransactions");
   auto mst_state_logger = mst_logger_manager->getChild("State")->getLogger();
   auto mst_completer = std::make_shared<DefaultCompleter>(mst_expiration_time_);
+  mst_completer_ = mst_completer;
+  std::shared_ptr<MstJournal> mst_journal;
+  if (not mst_journal_path_.empty()) {
+    auto journal = MstJournal::create(
+        mst_journal_path_,
+        mst_logger_manager->getChild("Journal")->getLogger());
+    if (not journal) {
+      return expected::makeError("Unable to open the MST journal "
+                                 + mst_journal_path_);
+    }
+    mst_journal = std::move(*journal);
+  }
   auto mst_storage = std::make_shared<MstStorageStateImpl>(
       mst_completer,
       mst_state_logger,
-      mst_logger_manager->getChild("Storage")->getLogger());
+      mst_logger_manager->getChild("Storage")->getLogger(),
+      std::move(mst_journal));
+  memory_budget_->addConsumer(
+      {"mst_state",
+       kReportedPriority,
+       [mst_storage] { return mst_storage->memoryUsage(); },
+       {}});
   std::shared_ptr<iroha::PropagationStrategy> mst_propagation;
   if (is_mst_supported_) {
     mst_transport = std::make_shared<iroha::network::MstTransportGrpc>(
@@ -753,9 +1525,17 @@ Irohad::RunResult Irohad::initMstProcessor() {
         mst_completer,
         keypair.publicKey(),
         std::move(mst_state_logger),
-        mst_logger_manager->getChild("Transport")->getLogger());
+        mst_logger_manager->getChild("Transport")->getLogger(),
+        network::MstTransportGrpc::SenderFactory(
+            [pool = channel_pool_](const shared_model::interface::Peer &to) {
+              return pool->createClient<network::transport::MstTransportGrpc>(
+                  to.address(), GRPC_COMPRESS_GZIP);
+            }),
+        validation_pool_);
     mst_propagation = std::make_shared<GossipPropagationStrategy>(
-        storage, rxcpp::observe_on_new_thread(), *opt_mst_gossip_params_);
+        storage,
+        observeOnNamedThread("mst-gossip"),
+        *opt_mst_gossip_params_);
   } else {
     mst_transport = std::make_shared<iroha::network::MstTransportStub>();
     mst_propagation = std::make_shared<iroha::PropagationStrategyStub>();
@@ -780,6 +1560,11 @@ Irohad::RunResult Irohad::initMstProcessor() {
 Irohad::RunResult Irohad::initPendingTxsStorage() {
   pending_txs_storage_ =
       pending_txs_storage_init->createPendingTransactionsStorage();
+  memory_budget_->addConsumer(
+      {"pending_txs_storage",
+       kReportedPriority,
+       [pending = pending_txs_storage_] { return pending->memoryUsage(); },
+       {}});
   log_->info("[Init] => pending transactions storage");
   return {};
 }
@@ -792,6 +1577,13 @@ Irohad::RunResult Irohad::initTransactionCommandService() {
   auto status_factory =
       std::make_shared<shared_model::proto::ProtoTxStatusFactory>();
   auto cs_cache = std::make_shared<::torii::CommandServiceImpl::CacheType>();
+  memory_budget_->addConsumer(
+      {"tx_status_cache",
+       kStatusCachePriority,
+       [cs_cache] { return cs_cache->memoryUsage(kStatusCacheItemBytes); },
+       [cs_cache](size_t bytes) {
+         cs_cache->limitMemory(bytes, kStatusCacheItemBytes);
+       }});
   auto tx_processor = std::make_shared<TransactionProcessorImpl>(
       pcs,
       mst_processor,
@@ -799,6 +1591,17 @@ Irohad::RunResult Irohad::initTransactionCommandService() {
       status_factory,
       storage->on_commit(),
       command_service_log_manager->getChild("Processor")->getLogger());
+  auto admission_control = std::make_shared<::torii::AdmissionControl>(
+      ::torii::AdmissionControl::Limits{torii_tx_rate_limit_,
+                                        torii_account_tx_rate_limit_,
+                                        torii_max_pending_txs_},
+      [ordering_service = ordering_init.ordering_service] {
+        return ordering_service->pendingTxsAmount();
+      });
+  metrics_registry_->addCounter(
+      "iroha_torii_rejected_txs_total",
+      "Transactions rejected by the rate limits of Torii",
+      metricOf(admission_control, admission_control->rejectedTxs()));
   command_service = std::make_shared<::torii::CommandServiceImpl>(
       tx_processor,
       storage,
@@ -806,20 +1609,32 @@ Irohad::RunResult Irohad::initTransactionCommandService() {
       status_factory,
       cs_cache,
       persistent_cache,
-      command_service_log_manager->getLogger());
-  command_service_transport =
-      std::make_shared<::torii::CommandServiceTransportGrpc>(
-          command_service,
-          status_bus_,
-          status_factory,
-          transaction_factory,
-          batch_parser,
-          transaction_batch_factory_,
-          consensus_gate_objects.get_observable().map([](const auto &) {
-            return ::torii::CommandServiceTransportGrpc::ConsensusGateEvent{};
-          }),
-          stale_stream_max_rounds_,
-          command_service_log_manager->getChild("Transport")->getLogger());
+      command_service_log_manager->getLogger(),
+      admission_control,
+      not observer_);
+  // every torii server instance registers a transport of its own, as an
+  // asynchronous service is registered with a single server
+  make_command_service_transport =
+      [this,
+       status_factory,
+       log = command_service_log_manager->getChild("Transport")->getLogger()] {
+        return std::make_shared<::torii::CommandServiceTransportGrpc>(
+            command_service,
+            status_bus_,
+            status_factory,
+            transaction_factory,
+            batch_parser,
+            transaction_batch_factory_,
+            consensus_gate_objects.get_observable().map([](const auto &) {
+              return ::torii::CommandServiceTransportGrpc::
+                  ConsensusGateEvent{};
+            }),
+            stale_stream_max_rounds_,
+            log,
+            torii_async_streams_,
+            validation_pool_);
+      };
+  command_service_transport = make_command_service_transport();
 
   log_->info("[Init] => command service");
   return {};
@@ -830,25 +1645,62 @@ Irohad::RunResult Irohad::initTransactionCommandService() {
  */
 Irohad::RunResult Irohad::initQueryService() {
   auto query_service_log_manager = log_manager_->getChild("QueryService");
+  std::shared_ptr<QueryResponseCache> query_response_cache;
+  if (query_cache_size_ != 0) {
+    query_response_cache =
+        std::make_shared<QueryResponseCache>(query_cache_size_);
+    query_response_cache_ = query_response_cache;
+    metrics_registry_->addCounter("iroha_query_cache_hits_total",
+                                  "Queries answered from the response cache",
+                                  query_response_cache->hits());
+    metrics_registry_->addCounter(
+        "iroha_query_cache_misses_total",
+        "Cacheable queries executed against the database",
+        query_response_cache->misses());
+  }
   auto query_processor = std::make_shared<QueryProcessorImpl>(
       storage,
       storage,
       pending_txs_storage_,
       query_response_factory_,
-      query_service_log_manager->getChild("Processor")->getLogger());
-
-  query_service = std::make_shared<::torii::QueryService>(
-      query_processor,
-      query_factory,
-      blocks_query_factory,
-      query_service_log_manager->getLogger());
+      query_service_log_manager->getChild("Processor")->getLogger(),
+      std::move(query_response_cache));
+
+  make_query_service = [this,
+                        query_processor,
+                        log = query_service_log_manager->getLogger()] {
+    return std::make_shared<::torii::QueryService>(
+        query_processor,
+        query_factory,
+        blocks_query_factory,
+        log,
+        torii_async_streams_,
+        pending_txs_storage_->batchEvents(),
+        storage,
+        ::torii::QueryService::kDefaultStreamChunkBytes,
+        batch_query_factory);
+  };
+  query_service = make_query_service();
 
   log_->info("[Init] => query service");
   return {};
 }
 
 Irohad::RunResult Irohad::initWsvRestorer() {
-  wsv_restorer_ = std::make_shared<iroha::ametsuchi::WsvRestorerImpl>();
+  if (not fast_wsv_restore_) {
+    wsv_restorer_ = std::make_shared<iroha::ametsuchi::WsvRestorerImpl>();
+    return {};
+  }
+  auto restorer_log_manager = log_manager_->getChild("WsvRestorer");
+  wsv_restorer_ = std::make_shared<iroha::ametsuchi::WsvRestorerImpl>(
+      std::make_shared<shared_model::validation::DefaultSignedBlockValidator>(
+          block_validators_config_),
+      std::make_shared<ChainValidatorImpl>(
+          getSupermajorityChecker(kConsensusConsistencyModel),
+          restorer_log_manager->getChild("Chain")->getLogger()),
+      std::thread::hardware_concurrency(),
+      iroha::ametsuchi::WsvRestorerImpl::kDefaultBlocksPerCommit,
+      restorer_log_manager->getLogger());
   return {};
 }
 
@@ -859,11 +1711,11 @@ Irohad::RunResult Irohad::run() {
   using iroha::expected::operator|;
   using iroha::operator|;
 
-  // Initializing torii server
+  // Initializing torii server, its instances share the port
   torii_server = std::make_unique<ServerRunner>(
       listen_ip_ + ":" + std::to_string(torii_port_),
       log_manager_->getChild("ToriiServerRunner")->getLogger(),
-      false);
+      torii_server_instances_ > 1);
 
   // Initializing internal server
   internal_server = std::make_unique<ServerRunner>(
@@ -878,11 +1730,44 @@ Irohad::RunResult Irohad::run() {
     };
   };
 
+  // the threads of the servers are started with the CPUs of the subsystems
+  auto torii_placement =
+      std::make_unique<ScopedThreadPlacement>(placement::kTorii);
+
+  // every torii instance runs on its own part of the torii CPUs
+  auto torii_cpus = cpusOfSubsystem(placement::kTorii);
+  auto torii_instance_cpus = splitCpus(
+      torii_cpus ? *torii_cpus : currentThreadCpus(), torii_server_instances_);
+
   // Run torii server
-  auto run_result = torii_server->append(command_service_transport)
-                        .append(query_service)
-                        .run()
-      | make_port_logger("Torii");
+  auto run_result = [&] {
+    ScopedThreadPlacement instance_placement(torii_instance_cpus.front());
+    return torii_server->append(command_service_transport)
+        .append(query_service)
+        .run();
+  }() | [&, this](auto port) -> RunResult {
+    log_->info("Torii server bound on port {}", port);
+    for (size_t i = 1; i < torii_server_instances_; ++i) {
+      ScopedThreadPlacement instance_placement(torii_instance_cpus[i]);
+      torii_server_instances.push_back(std::make_unique<ServerRunner>(
+          listen_ip_ + ":" + std::to_string(port),
+          log_manager_->getChild("ToriiServerRunner")->getLogger(),
+          true));
+      auto result = torii_server_instances.back()
+                        ->append(make_command_service_transport())
+                        .append(make_query_service())
+                        .run();
+      if (auto error = expected::resultToOptionalError(result)) {
+        return expected::makeError(std::move(*error));
+      }
+    }
+    if (torii_server_instances_ > 1) {
+      log_->info("Torii runs {} server instances on port {}",
+                 torii_server_instances_,
+                 port);
+    }
+    return {};
+  };
 
   // Run torii TLS server
   torii_tls_creds_ | [&, this](const auto &tls_creds) {
@@ -900,19 +1785,49 @@ Irohad::RunResult Irohad::run() {
     };
   };
 
+  torii_placement.reset();
+
   // Run internal server
   run_result |= [&, this] {
+    ScopedThreadPlacement internal_placement(placement::kConsensus);
     if (is_mst_supported_) {
       internal_server->append(
           std::static_pointer_cast<MstTransportGrpc>(mst_transport));
     }
-    return internal_server->append(ordering_init.service)
-               .append(yac_init->getConsensusNetwork())
-               .append(loader_init.service)
-               .run()
+    // the observer serves only the blocks to the other peers
+    if (not observer_) {
+      internal_server->append(ordering_init.service)
+          .append(yac_init->getConsensusNetwork());
+    }
+    return internal_server->append(loader_init.service).run()
         | make_port_logger("Internal");
   };
 
+  // Run metrics server
+  if (metrics_port_) {
+    run_result |= [&, this] {
+      maintenance::addThreadCpuMetrics(*metrics_registry_);
+      maintenance::addAllocationMetrics(*metrics_registry_);
+      metrics_registry_->addGaugeFamily(
+          "iroha_memory_usage_bytes",
+          "Approximate memory taken by the in-memory caches and states",
+          [budget = memory_budget_] {
+            std::vector<maintenance::MetricsRegistry::Sample> samples;
+            for (auto &consumer : budget->usage()) {
+              samples.push_back(
+                  {{{"consumer", std::move(consumer.first)}},
+                   static_cast<double>(consumer.second)});
+            }
+            return samples;
+          });
+      metrics_server_ = std::make_unique<maintenance::MetricsServer>(
+          metrics_registry_,
+          log_manager_->getChild("MetricsServer")->getLogger());
+      return metrics_server_->run(listen_ip_, *metrics_port_)
+          | make_port_logger("Metrics");
+    };
+  }
+
   return run_result | [&]() -> RunResult {
     log_->info("===> iroha initialized");
     // initiate first round
@@ -936,21 +1851,123 @@ Irohad::RunResult Irohad::run() {
       return expected::makeError("Failed to fetch ledger peers!");
     }
 
+    // connect to the peers before the first round needs them
+    auto warm_up = [pool = channel_pool_](const auto &ledger_peers) {
+      std::vector<std::string> addresses;
+      for (const auto &peer : ledger_peers) {
+        addresses.push_back(peer->address());
+      }
+      pool->warmUp(addresses);
+    };
+    warm_up(peers.value());
+
     auto initial_ledger_state = std::make_shared<LedgerState>(
         std::move(peers.value()), block->height(), block->hash());
 
-    pcs->onSynchronization().subscribe(
-        ordering_init.sync_event_notifier.get_subscriber());
+    if (observer_) {
+      // the observer follows the ledger peers without the ordering rounds
+      pcs->onSynchronization().subscribe(
+          [gate = observer_gate_](const auto &event) {
+            gate->updateLedgerState(event.ledger_state);
+          });
+    } else {
+      pcs->onSynchronization().subscribe(
+          ordering_init.sync_event_notifier.get_subscriber());
+    }
+    pcs->onSynchronization().subscribe([warm_up](const auto &event) {
+      warm_up(event.ledger_state->ledger_peers);
+    });
     storage->on_commit().subscribe(
         ordering_init.commit_notifier.get_subscriber());
+    if (traffic_capture_) {
+      // the captured traffic is replayed on top of the current WSV
+      auto snapshot = storage->createWsvSnapshot();
+      if (auto e = expected::resultToOptionalError(snapshot)) {
+        return expected::makeError("Failed to capture the WSV snapshot: "
+                                   + *e);
+      }
+      traffic_capture_->snapshot(
+          boost::get<expected::ValueOf<decltype(snapshot)>>(snapshot).value);
+      storage->on_commit().subscribe(
+          [capture = traffic_capture_](const auto &block) {
+            capture->block(*block);
+          });
+    }
+    if (block_exporter_) {
+      // the missing blocks are exported before the committed ones
+      block_exporter_->backfill(*block_query, block_height);
+      storage->on_commit().subscribe(
+          [exporter = block_exporter_](const auto &block) {
+            exporter->push(block);
+          });
+    }
 
     ordering_init.commit_notifier.get_subscriber().on_next(std::move(block));
 
-    ordering_init.sync_event_notifier.get_subscriber().on_next(
-        synchronizer::SynchronizationEvent{
-            SynchronizationOutcomeType::kCommit,
-            {block_height, ordering::kFirstRejectRound},
-            initial_ledger_state});
+    if (observer_) {
+      observer_gate_->start(initial_ledger_state);
+    } else {
+      ordering_init.sync_event_notifier.get_subscriber().on_next(
+          synchronizer::SynchronizationEvent{
+              SynchronizationOutcomeType::kCommit,
+              {block_height, ordering::kFirstRejectRound},
+              initial_ledger_state});
+    }
+    memory_budget_->start(kMemoryBudgetPeriod);
     return {};
   };
 }
+
+void Irohad::reload(Tunables tunables) {
+  std::lock_guard<std::mutex> lock(tunables_mutex_);
+  pending_tunables_ = std::move(tunables);
+}
+
+void Irohad::applyPendingTunables() {
+  boost::optional<Tunables> tunables;
+  {
+    std::lock_guard<std::mutex> lock(tunables_mutex_);
+    tunables.swap(pending_tunables_);
+  }
+  if (not tunables) {
+    return;
+  }
+
+  if (ordering_init.ordering_service) {
+    ordering_init.ordering_service->setTransactionLimit(
+        tunables->max_proposal_size);
+  }
+  if (ordering_init.client_factory) {
+    ordering_init.client_factory->setProposalRequestTimeout(
+        tunables->proposal_delay);
+  }
+  if (auto timer = observer_ ? nullptr : yac_init->getTimer()) {
+    timer->setDelay(tunables->vote_delay);
+  }
+  if (mst_completer_) {
+    mst_completer_->setExpirationTime(tunables->mst_expiration_time);
+  }
+  if (block_cache_) {
+    block_cache_->setCapacity(tunables->block_cache_size);
+  }
+  if (wsv_cache_) {
+    wsv_cache_->setCapacity(tunables->wsv_cache_size);
+  }
+  if (query_response_cache_) {
+    query_response_cache_->setCapacity(tunables->query_cache_size);
+  }
+  if (tunables->log_levels) {
+    log_manager_->updateLevels(*tunables->log_levels);
+  }
+  log_->info(
+      "Reloaded the tunables: max_proposal_size {}, proposal_delay {} ms, "
+      "vote_delay {} ms, mst_expiration_time {} min, block_cache_size {}, "
+      "wsv_cache_size {}, query_cache_size {}",
+      tunables->max_proposal_size,
+      tunables->proposal_delay.count(),
+      tunables->vote_delay.count(),
+      tunables->mst_expiration_time.count(),
+      tunables->block_cache_size,
+      tunables->wsv_cache_size,
+      tunables->query_cache_size);
+}
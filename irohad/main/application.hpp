@@ -6,6 +6,10 @@
 #ifndef IROHA_APPLICATION_HPP
 #define IROHA_APPLICATION_HPP
 
+#include <functional>
+#include <future>
+#include <mutex>
+
 #include "consensus/consensus_block_cache.hpp"
 #include "consensus/gate_object.hpp"
 #include "cryptography/crypto_provider/abstract_crypto_model_signer.hpp"
@@ -25,7 +29,10 @@ namespace iroha {
   class PendingTransactionStorage;
   class PendingTransactionStorageInit;
   class MstProcessor;
+  class DefaultCompleter;
   namespace ametsuchi {
+    class CachedBlockStorage;
+    class WsvCache;
     class WsvRestorer;
     class TxPresenceCache;
     class Storage;
@@ -34,10 +41,18 @@ namespace iroha {
     struct PoolWrapper;
   }  // namespace ametsuchi
   namespace consensus {
+    class ObserverGate;
     namespace yac {
       class YacInit;
     }  // namespace yac
   }    // namespace consensus
+  namespace maintenance {
+    class BlockExporter;
+    class MemoryBudget;
+    class MetricsRegistry;
+    class MetricsServer;
+    class TrafficCapture;
+  }  // namespace maintenance
   namespace network {
     class BlockLoader;
     class ConsensusGate;
@@ -54,6 +69,7 @@ namespace iroha {
   }
   namespace torii {
     class QueryProcessor;
+    class QueryResponseCache;
     class StatusBus;
     class CommandService;
     class CommandServiceTransportGrpc;
@@ -64,6 +80,7 @@ namespace iroha {
   namespace validation {
     class ChainValidator;
     class StatefulValidator;
+    class ValidationPool;
   }  // namespace validation
 }  // namespace iroha
 
@@ -100,6 +117,104 @@ class Irohad {
    * transactions
    * @param stale_stream_max_rounds - maximum number of rounds between
    * consecutive status emissions
+   * @param proposal_streaming - push proposals of the ordering service to the
+   * subscribed peers and subscribe to the proposals of the other peers
+   * @param batch_flush_delay - time window for coalescing batches sent to the
+   * same ordering service, zero disables coalescing
+   * @param batch_flush_size - size of coalesced transactions in bytes which
+   * triggers sending before the time window elapses
+   * @param batch_validation_workers - number of threads which validate
+   * transactions received by the ordering service from other peers
+   * @param adaptive_proposal_size - adjust the limit of transactions in
+   * proposal to the measured round time (optional). If not provided,
+   * max_proposal_size is always used
+   * @param yac_commit_certificates - send the collected supermajority of
+   * votes in the compact form of commit certificate
+   * @param yac_gossip_fanout - number of random peers which receive the
+   * consensus outcome from every peer, zero sends the outcome from the
+   * collecting peer to all peers
+   * @param pipelined_consensus - request the proposal of the next round when
+   * the consensus commits the block, before the block is applied
+   * @param adaptive_vote_delay - bounds of the vote delay derived from the
+   * measured vote latencies (optional). If not provided, vote_delay is
+   * always used
+   * @param metrics_port - port of the HTTP endpoint exposing the metrics in
+   * the Prometheus format (optional). If not provided, the metrics are not
+   * exposed
+   * @param segmented_block_store - store the blocks in the indexed segment
+   * files instead of a file per block
+   * @param block_store_compression_level - zstd compression level of the
+   * blocks of the flat file block store (optional). If not provided, the
+   * blocks are not compressed
+   * @param block_cache_size - maximal total size in bytes of the recent
+   * blocks which are kept in memory, 0 disables the cache
+   * @param fast_wsv_restore - whether WSV is restored from the blocks signed
+   * by a supermajority of peers without the stateful validation
+   * @param wsv_cache_size - maximal number of the accounts whose committed
+   * signatories and quorum are kept in memory, 0 disables the cache
+   * @param async_history_index - whether the tx positions by creator and by
+   * account asset are indexed in the background instead of on commit
+   * @param query_cache_size - maximal number of the cached responses to the
+   * GetAccountAssets and GetAccountDetail queries, 0 disables the cache
+   * @param db_pool_size - number of database connections of the commit lane
+   * @param db_query_pool_size - number of database connections of the client
+   * queries, 0 makes them share the commit lane connections
+   * @param db_restore_pool_size - number of database connections of the
+   * background history indexing and the WSV snapshots, 0 makes them share the
+   * commit lane connections
+   * @param stateful_validation_workers - maximal number of the groups of the
+   * non-conflicting transactions of a proposal validated concurrently on
+   * separate database connections, 0 validates them sequentially
+   * @param block_loader_max_streams - maximal number of the block streams
+   * served to the synchronizing peers at once, 0 does not limit them
+   * @param block_loader_bandwidth - bytes per second shared by the block
+   * streams served to the synchronizing peers, 0 does not limit them
+   * @param torii_async_streams - whether the status streams and the block
+   * streams of Torii are handled on the completion queues of the server, one
+   * thread per core, instead of a thread per stream
+   * @param status_bus_workers - number of the threads delivering the
+   * transaction statuses, each serving the statuses of a part of the
+   * transactions
+   * @param torii_tx_rate_limit - transactions per second accepted by Torii
+   * from all the clients, 0 for no limit
+   * @param torii_account_tx_rate_limit - transactions per second accepted
+   * by Torii from a single creator account, 0 for no limit
+   * @param torii_max_pending_txs - transactions waiting in the ordering
+   * service at which Torii stops accepting new ones, 0 for no limit
+   * @param mst_journal_path - file of the journal of the pending multisignature
+   * transactions, which are restored from it on startup, empty for none
+   * @param memory_budget - bytes of memory shared by the transaction status
+   * caches, which shrink to fit it besides the pending transactions, 0 for no
+   * limit
+   * @param inter_peer_client_threads - threads completing the asynchronous
+   * calls to the other peers
+   * @param inter_peer_max_calls - asynchronous calls in flight to a peer,
+   * the calls over it are dropped, 0 for no limit
+   * @param transactions_root - whether the created blocks have the Merkle
+   * root of their transactions, which has to be the same on all the peers
+   * @param pg_block_flush_size - blocks buffered by the block storages in
+   * the database before they are written with one statement
+   * @param block_exporter - exporter of the committed blocks for the
+   * analytics, nullptr if they are not exported
+   * @param pipeline_queue_size - events queued by a stage of the pipeline
+   * before it makes the previous stage wait, 0 for the rxcpp threads
+   * @param proposal_hedge_percentile - percentile of the recent latencies
+   * of the proposal requests which, doubled, is the deadline of the
+   * requests, 0 for the proposal request timeout
+   * @param block_sync_interval - number of the committed blocks after which
+   * the block store is synced to the disk
+   * @param peer_compression - compression of the proposals, blocks and
+   * batches sent to the other peers, none to send them uncompressed
+   * @param fair_queuing - fair queuing of the batches by their creators in
+   * the proposals, none to take the batches in arrival order
+   * @param block_archive - offload of the old segments of the segmented
+   * block store, none to keep all of them locally
+   * @param torii_server_instances - number of the torii servers sharing the
+   * port, each with its own part of the torii CPUs
+   * @param observer - whether the peer follows the chain of the ledger peers
+   * without the ordering, the consensus and MST, serving the queries only
+   * @param traffic_capture - recorder of the traffic of the peer for the
+   * offline replay, nullptr if it is not recorded
    * @param opt_alternative_peers - optional alternative initial peers list
    * @param logger_manager - the logger manager to use
    * @param opt_mst_gossip_params - parameters for Gossip MST propagation
@@ -121,6 +236,51 @@ class Irohad {
          const shared_model::crypto::Keypair &keypair,
          std::chrono::milliseconds max_rounds_delay,
          size_t stale_stream_max_rounds,
+         bool proposal_streaming,
+         std::chrono::milliseconds batch_flush_delay,
+         size_t batch_flush_size,
+         size_t batch_validation_workers,
+         boost::optional<IrohadConfig::AdaptiveProposalSize>
+             adaptive_proposal_size,
+         bool yac_commit_certificates,
+         size_t yac_gossip_fanout,
+         bool pipelined_consensus,
+         boost::optional<IrohadConfig::AdaptiveVoteDelay> adaptive_vote_delay,
+         boost::optional<uint16_t> metrics_port,
+         bool segmented_block_store,
+         boost::optional<int32_t> block_store_compression_level,
+         size_t block_cache_size,
+         bool fast_wsv_restore,
+         size_t wsv_cache_size,
+         bool async_history_index,
+         size_t query_cache_size,
+         size_t db_pool_size,
+         size_t db_query_pool_size,
+         size_t db_restore_pool_size,
+         size_t stateful_validation_workers,
+         size_t block_loader_max_streams,
+         size_t block_loader_bandwidth,
+         bool torii_async_streams,
+         size_t status_bus_workers,
+         size_t torii_tx_rate_limit,
+         size_t torii_account_tx_rate_limit,
+         size_t torii_max_pending_txs,
+         std::string mst_journal_path,
+         size_t memory_budget,
+         size_t inter_peer_client_threads,
+         size_t inter_peer_max_calls,
+         bool transactions_root,
+         size_t pg_block_flush_size,
+         std::shared_ptr<iroha::maintenance::BlockExporter> block_exporter,
+         size_t pipeline_queue_size,
+         size_t proposal_hedge_percentile,
+         size_t block_sync_interval,
+         boost::optional<IrohadConfig::PeerCompression> peer_compression,
+         boost::optional<IrohadConfig::FairQueuing> fair_queuing,
+         boost::optional<IrohadConfig::BlockArchive> block_archive,
+         size_t torii_server_instances,
+         bool observer,
+         std::shared_ptr<iroha::maintenance::TrafficCapture> traffic_capture,
          boost::optional<shared_model::interface::types::PeerList>
              opt_alternative_peers,
          logger::LoggerManagerTreePtr logger_manager,
@@ -142,6 +302,13 @@ class Irohad {
    */
   RunResult restoreWsv();
 
+  /**
+   * Restore World State View, initializing the components which do not
+   * depend on it concurrently
+   * @return void value on success, error message otherwise
+   */
+  RunResult restoreWsvConcurrently();
+
   /**
    * Drop wsv and block store
    */
@@ -153,6 +320,28 @@ class Irohad {
    */
   RunResult run();
 
+  /// performance parameters which are changed without restart
+  struct Tunables {
+    size_t max_proposal_size;
+    std::chrono::milliseconds proposal_delay;
+    std::chrono::milliseconds vote_delay;
+    std::chrono::minutes mst_expiration_time;
+    size_t block_cache_size;
+    size_t wsv_cache_size;
+    size_t query_cache_size;
+    /// tree with the new log levels, nullptr keeps the levels
+    logger::LoggerManagerTreePtr log_levels;
+  };
+
+  /**
+   * Change the tunables of the running components. They are applied
+   * between the rounds, on the next outcome of the consensus, so a round
+   * runs with the same parameters on all its stages. The caches which are
+   * disabled at startup are not created by the reload
+   * @param tunables - the new values
+   */
+  void reload(Tunables tunables);
+
   virtual ~Irohad();
 
  protected:
@@ -184,6 +373,9 @@ class Irohad {
 
   virtual RunResult initConsensusGate();
 
+  /// forward the outcomes of the consensus gate to the subscribers
+  void subscribeToConsensusGate();
+
   virtual RunResult initSynchronizer();
 
   virtual RunResult initPeerCommunicationService();
@@ -202,6 +394,16 @@ class Irohad {
 
   virtual RunResult initValidatorsConfigs();
 
+  /**
+   * Thread of a pipeline stage: the stage executor with the metrics of its
+   * queue if the pipeline queue size is set, a new rxcpp thread otherwise
+   * @param stage - name of the thread of the stage
+   */
+  rxcpp::observe_on_one_worker stageCoordination(const std::string &stage);
+
+  /// apply the tunables passed to reload, if any
+  void applyPendingTunables();
+
   /**
    * Initialize WSV restorer
    */
@@ -220,6 +422,50 @@ class Irohad {
   std::chrono::minutes mst_expiration_time_;
   std::chrono::milliseconds max_rounds_delay_;
   size_t stale_stream_max_rounds_;
+  bool proposal_streaming_;
+  std::chrono::milliseconds batch_flush_delay_;
+  size_t batch_flush_size_;
+  size_t batch_validation_workers_;
+  boost::optional<IrohadConfig::AdaptiveProposalSize> adaptive_proposal_size_;
+  bool yac_commit_certificates_;
+  size_t yac_gossip_fanout_;
+  bool pipelined_consensus_;
+  boost::optional<IrohadConfig::AdaptiveVoteDelay> adaptive_vote_delay_;
+  boost::optional<uint16_t> metrics_port_;
+  bool segmented_block_store_;
+  boost::optional<int32_t> block_store_compression_level_;
+  size_t block_cache_size_;
+  bool fast_wsv_restore_;
+  size_t wsv_cache_size_;
+  bool async_history_index_;
+  size_t query_cache_size_;
+  size_t db_pool_size_;
+  size_t db_query_pool_size_;
+  size_t db_restore_pool_size_;
+  size_t stateful_validation_workers_;
+  size_t block_loader_max_streams_;
+  size_t block_loader_bandwidth_;
+  bool torii_async_streams_;
+  size_t status_bus_workers_;
+  size_t torii_tx_rate_limit_;
+  size_t torii_account_tx_rate_limit_;
+  size_t torii_max_pending_txs_;
+  std::string mst_journal_path_;
+  size_t memory_budget_limit_;
+  size_t inter_peer_client_threads_;
+  size_t inter_peer_max_calls_;
+  bool transactions_root_;
+  size_t pg_block_flush_size_;
+  std::shared_ptr<iroha::maintenance::BlockExporter> block_exporter_;
+  size_t pipeline_queue_size_;
+  size_t proposal_hedge_percentile_;
+  size_t block_sync_interval_;
+  boost::optional<IrohadConfig::PeerCompression> peer_compression_;
+  boost::optional<IrohadConfig::FairQueuing> fair_queuing_;
+  boost::optional<IrohadConfig::BlockArchive> block_archive_;
+  size_t torii_server_instances_;
+  bool observer_;
+  std::shared_ptr<iroha::maintenance::TrafficCapture> traffic_capture_;
   const boost::optional<shared_model::interface::types::PeerList>
       opt_alternative_peers_;
   boost::optional<iroha::GossipPropagationStrategyParams>
@@ -277,10 +523,17 @@ class Irohad {
       block_validators_config_;
   std::shared_ptr<iroha::validation::StatefulValidator> stateful_validator;
   std::shared_ptr<iroha::validation::ChainValidator> chain_validator;
+  std::shared_ptr<iroha::validation::ValidationPool> validation_pool_;
 
   // async call
   std::shared_ptr<iroha::network::AsyncGrpcClient<google::protobuf::Empty>>
       async_call_;
+  std::shared_ptr<iroha::network::ChannelPool> channel_pool_;
+
+  // compression of the messages to the peers, nullptr if not compressed
+  std::shared_ptr<iroha::network::CompressionPolicy> proposal_compression_;
+  std::shared_ptr<iroha::network::CompressionPolicy> block_compression_;
+  std::shared_ptr<iroha::network::CompressionPolicy> batches_compression_;
 
   // transaction batch factory
   std::shared_ptr<shared_model::interface::TransactionBatchFactory>
@@ -298,6 +551,12 @@ class Irohad {
       iroha::protocol::Query>>
       query_factory;
 
+  // factory of the queries of the batches, which are signed together
+  std::shared_ptr<shared_model::interface::AbstractTransportFactory<
+      shared_model::interface::Query,
+      iroha::protocol::Query>>
+      batch_query_factory;
+
   // blocks query factory
   std::shared_ptr<shared_model::interface::AbstractTransportFactory<
       shared_model::interface::BlocksQuery,
@@ -343,24 +602,51 @@ class Irohad {
   std::shared_ptr<iroha::torii::CommandService> command_service;
   std::shared_ptr<iroha::torii::CommandServiceTransportGrpc>
       command_service_transport;
+  std::function<std::shared_ptr<iroha::torii::CommandServiceTransportGrpc>()>
+      make_command_service_transport;
 
   // query service
   std::shared_ptr<iroha::torii::QueryService> query_service;
+  std::function<std::shared_ptr<iroha::torii::QueryService>()>
+      make_query_service;
 
   // consensus gate
   std::shared_ptr<iroha::network::ConsensusGate> consensus_gate;
+  /// consensus gate of the observer, nullptr for a validator peer
+  std::shared_ptr<iroha::consensus::ObserverGate> observer_gate_;
   rxcpp::composite_subscription consensus_gate_objects_lifetime;
   rxcpp::subjects::subject<iroha::consensus::GateObject> consensus_gate_objects;
   rxcpp::composite_subscription consensus_gate_events_subscription;
 
   std::unique_ptr<iroha::network::ServerRunner> torii_server;
+  /// torii servers sharing the port with torii_server
+  std::vector<std::unique_ptr<iroha::network::ServerRunner>>
+      torii_server_instances;
   boost::optional<std::unique_ptr<iroha::network::ServerRunner>>
       torii_tls_server = boost::none;
   std::unique_ptr<iroha::network::ServerRunner> internal_server;
 
+  // metrics of the components, released before the components
+  std::shared_ptr<iroha::maintenance::MetricsRegistry> metrics_registry_;
+  std::unique_ptr<iroha::maintenance::MetricsServer> metrics_server_;
+  std::shared_ptr<iroha::maintenance::MemoryBudget> memory_budget_;
+
+  // components of the tunables, nullptr for the disabled ones
+  std::shared_ptr<iroha::DefaultCompleter> mst_completer_;
+  /// owned by the storage
+  iroha::ametsuchi::CachedBlockStorage *block_cache_ = nullptr;
+  std::shared_ptr<iroha::ametsuchi::WsvCache> wsv_cache_;
+  std::shared_ptr<iroha::torii::QueryResponseCache> query_response_cache_;
+  std::mutex tunables_mutex_;
+  boost::optional<Tunables> pending_tunables_;
+
   logger::LoggerManagerTreePtr log_manager_;  ///< application root log manager
 
   logger::LoggerPtr log_;  ///< log for local messages
+
+  /// warm-up of the tx presence cache, which runs during the init, declared
+  /// last so it completes before the other members are destroyed
+  std::future<RunResult> presence_cache_warm_up_;
 };
 
 #endif  // IROHA_APPLICATION_HPP
@@ -0,0 +1,55 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gflags/gflags.h>
+#include "ametsuchi/impl/block_file_format.hpp"
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "logger/logger.hpp"
+#include "logger/logger_manager.hpp"
+
+/**
+ * Gflag validator.
+ * Path is considered to be valid if it is not empty.
+ * @param flag_name - flag name. Must be 'block_store_path' in this case
+ * @param path - path to the block store
+ * @return true if argument is valid
+ */
+bool validate_path(const char *flag_name, std::string const &path) {
+  return not path.empty();
+}
+
+/**
+ * Creating input argument for the block store location.
+ */
+DEFINE_string(block_store_path, "", "Specify the block store to convert");
+DEFINE_validator(block_store_path, &validate_path);
+
+/**
+ * Rewrites the blocks of the flat file block store in the legacy JSON format
+ * to the binary format. Every block is replaced atomically, so the conversion
+ * may be interrupted and run again. The node must be stopped during the
+ * conversion.
+ */
+int main(int argc, char *argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+  auto log_manager =
+      std::make_shared<logger::LoggerManagerTree>(logger::LoggerConfig{
+          logger::LogLevel::kInfo, logger::getDefaultLogPatterns()});
+  auto log = log_manager->getChild("Conversion")->getLogger();
+
+  auto storage = iroha::ametsuchi::FlatFile::create(
+      FLAGS_block_store_path, log_manager->getChild("FlatFile")->getLogger());
+  if (not storage) {
+    log->error("Cannot open the block store {}", FLAGS_block_store_path);
+    return EXIT_FAILURE;
+  }
+
+  if (not iroha::ametsuchi::block_file_format::convertFlatFile(**storage,
+                                                                log)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
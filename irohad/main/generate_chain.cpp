@@ -0,0 +1,385 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <thread>
+
+#include <gflags/gflags.h>
+#include "ametsuchi/impl/block_file_format.hpp"
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "backend/protobuf/block.hpp"
+#include "backend/protobuf/transaction.hpp"
+#include "cryptography/crypto_provider/crypto_signer.hpp"
+#include "cryptography/ed25519_sha3_impl/crypto_provider.hpp"
+#include "logger/logger.hpp"
+#include "logger/logger_manager.hpp"
+
+/**
+ * Gflag validator.
+ * Path is considered to be valid if it is not empty.
+ * @param flag_name - flag name. Must be 'block_store_path' in this case
+ * @param path - path to the block store
+ * @return true if argument is valid
+ */
+bool validate_path(const char *flag_name, std::string const &path) {
+  return not path.empty();
+}
+
+DEFINE_string(block_store_path, "", "Specify the empty block store to fill");
+DEFINE_validator(block_store_path, &validate_path);
+DEFINE_string(keys_path,
+              "",
+              "Directory to write the keys of the peer signing the blocks to, "
+              "the keys are not written if empty");
+DEFINE_string(peer_name, "node0", "Name of the key files of the peer");
+DEFINE_string(peer_address, "127.0.0.1:10001", "Address of the peer");
+
+DEFINE_uint64(blocks, 1000000, "Height of the chain including the genesis");
+DEFINE_uint64(transactions_per_block, 10, "Transactions of every block");
+DEFINE_uint64(accounts, 100000, "Accounts created by the genesis block");
+DEFINE_uint64(assets, 10, "Assets created by the genesis block");
+DEFINE_string(account_distribution,
+              "uniform",
+              "Distribution of the senders and the receivers over the "
+              "accounts: uniform or zipf");
+DEFINE_string(asset_distribution,
+              "uniform",
+              "Distribution of the transfers over the assets: uniform or zipf");
+DEFINE_double(zipf_exponent, 1., "Exponent of the zipf distributions");
+
+DEFINE_uint64(seed, 42, "Seed of the keys and of the transfers");
+DEFINE_uint64(threads,
+              std::thread::hardware_concurrency(),
+              "Threads generating and signing the transactions");
+DEFINE_uint64(start_time,
+              1577836800000,
+              "Creation time of the genesis block in milliseconds");
+DEFINE_uint64(block_interval_ms, 1000, "Time between the blocks");
+
+namespace {
+  using Crypto = shared_model::crypto::CryptoProviderEd25519Sha3;
+  using Signer = shared_model::crypto::CryptoSigner<Crypto>;
+
+  const std::string kDomain = "bench";
+  const std::string kRole = "user";
+  const std::string kAmount = "1.00";
+
+  std::string accountName(size_t index) {
+    return "user" + std::to_string(index);
+  }
+
+  std::string accountId(size_t index) {
+    return accountName(index) + "@" + kDomain;
+  }
+
+  std::string assetName(size_t index) {
+    return "asset" + std::to_string(index);
+  }
+
+  /// the keys are derived from the seed, so the chain is reproducible
+  shared_model::crypto::Keypair makeKeypair(const std::string &name) {
+    return Crypto::generateKeypair(
+        Crypto::generateSeed(std::to_string(FLAGS_seed) + "/" + name));
+  }
+
+  /**
+   * Sampler of the indices in [0, size) from the raw numbers of the engine.
+   * The standard distributions are not used, as their results differ
+   * between the standard libraries.
+   */
+  class IndexDistribution {
+   public:
+    IndexDistribution(size_t size, bool zipf, double exponent)
+        : size_(size) {
+      if (zipf) {
+        cumulative_.reserve(size);
+        double sum = 0;
+        for (size_t i = 1; i <= size; ++i) {
+          sum += 1. / std::pow(i, exponent);
+          cumulative_.push_back(sum);
+        }
+        for (auto &value : cumulative_) {
+          value /= sum;
+        }
+      }
+    }
+
+    size_t operator()(std::mt19937_64 &engine) const {
+      if (cumulative_.empty()) {
+        return engine() % size_;
+      }
+      auto uniform = (engine() >> 11) * 0x1.0p-53;
+      return std::min<size_t>(
+          std::upper_bound(cumulative_.begin(), cumulative_.end(), uniform)
+              - cumulative_.begin(),
+          size_ - 1);
+    }
+
+   private:
+    size_t size_;
+    std::vector<double> cumulative_;
+  };
+
+  /// run the function for the indices in [first, last) on all threads
+  template <typename Function>
+  void parallelFor(size_t first, size_t last, Function function) {
+    std::atomic<size_t> next{first};
+    auto work = [&] {
+      for (size_t i; (i = next++) < last;) {
+        function(i);
+      }
+    };
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < FLAGS_threads; ++i) {
+      threads.emplace_back(work);
+    }
+    work();
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+
+  iroha::protocol::Transaction makeGenesisTransaction(
+      const std::vector<shared_model::crypto::Keypair> &keys,
+      const shared_model::crypto::PublicKey &peer_key) {
+    iroha::protocol::Transaction transaction;
+    auto payload = transaction.mutable_payload()->mutable_reduced_payload();
+    payload->set_created_time(FLAGS_start_time);
+    payload->set_quorum(1);
+
+    auto peer = payload->add_commands()->mutable_add_peer()->mutable_peer();
+    peer->set_address(FLAGS_peer_address);
+    peer->set_peer_key(peer_key.hex());
+
+    auto role = payload->add_commands()->mutable_create_role();
+    role->set_role_name(kRole);
+    role->add_permissions(iroha::protocol::RolePermission::can_add_asset_qty);
+    role->add_permissions(iroha::protocol::RolePermission::can_transfer);
+    role->add_permissions(iroha::protocol::RolePermission::can_receive);
+
+    auto domain = payload->add_commands()->mutable_create_domain();
+    domain->set_domain_id(kDomain);
+    domain->set_default_role(kRole);
+
+    for (size_t i = 0; i < FLAGS_assets; ++i) {
+      auto asset = payload->add_commands()->mutable_create_asset();
+      asset->set_asset_name(assetName(i));
+      asset->set_domain_id(kDomain);
+      asset->set_precision(2);
+    }
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+      auto account = payload->add_commands()->mutable_create_account();
+      account->set_account_name(accountName(i));
+      account->set_domain_id(kDomain);
+      account->set_public_key(keys[i].publicKey().hex());
+    }
+    return transaction;
+  }
+
+  /**
+   * Make the transactions of the block. Every transaction adds the amount to
+   * its creator and transfers it, so it is valid in any state of the ledger.
+   * The transfers of a block depend only on the seed and the height.
+   */
+  std::vector<iroha::protocol::Transaction> makeTransactions(
+      size_t height,
+      const std::vector<shared_model::crypto::Keypair> &keys,
+      const IndexDistribution &accounts,
+      const IndexDistribution &assets) {
+    std::seed_seq seed{static_cast<uint32_t>(FLAGS_seed),
+                       static_cast<uint32_t>(FLAGS_seed >> 32),
+                       static_cast<uint32_t>(height),
+                       static_cast<uint32_t>(height >> 32)};
+    std::mt19937_64 engine(seed);
+    auto block_time = FLAGS_start_time + (height - 1) * FLAGS_block_interval_ms;
+
+    std::vector<iroha::protocol::Transaction> transactions(
+        FLAGS_transactions_per_block);
+    for (size_t i = 0; i < transactions.size(); ++i) {
+      auto source = accounts(engine);
+      auto destination = accounts(engine);
+      if (destination == source) {
+        destination = (destination + 1) % keys.size();
+      }
+      auto asset_id = assetName(assets(engine)) + "#" + kDomain;
+
+      iroha::protocol::Transaction proto;
+      auto payload = proto.mutable_payload()->mutable_reduced_payload();
+      payload->set_creator_account_id(accountId(source));
+      payload->set_created_time(block_time - transactions.size() + i);
+      payload->set_quorum(1);
+      auto add = payload->add_commands()->mutable_add_asset_quantity();
+      add->set_asset_id(asset_id);
+      add->set_amount(kAmount);
+      auto transfer = payload->add_commands()->mutable_transfer_asset();
+      transfer->set_src_account_id(accountId(source));
+      transfer->set_dest_account_id(accountId(destination));
+      transfer->set_asset_id(asset_id);
+      transfer->set_amount(kAmount);
+
+      shared_model::proto::Transaction transaction(std::move(proto));
+      transaction.addSignature(
+          Signer::sign(shared_model::crypto::Blob(transaction.payload()),
+                       keys[source]),
+          keys[source].publicKey());
+      transactions[i] = transaction.getTransport();
+    }
+    return transactions;
+  }
+
+  /// make the block of the transactions, signed by the peer
+  shared_model::proto::Block makeBlock(
+      size_t height,
+      const std::string &prev_hash,
+      std::vector<iroha::protocol::Transaction> transactions,
+      const shared_model::crypto::Keypair &peer_keys) {
+    iroha::protocol::Block_v1 proto;
+    auto payload = proto.mutable_payload();
+    payload->set_height(height);
+    payload->set_prev_block_hash(prev_hash);
+    payload->set_created_time(FLAGS_start_time
+                              + (height - 1) * FLAGS_block_interval_ms);
+    payload->set_tx_number(transactions.size());
+    for (auto &transaction : transactions) {
+      payload->add_transactions()->Swap(&transaction);
+    }
+
+    shared_model::proto::Block block(std::move(proto));
+    // the genesis block is not signed, as the peers are not known before it
+    if (height > 1) {
+      block.addSignature(
+          Signer::sign(shared_model::crypto::Blob(block.payload()), peer_keys),
+          peer_keys.publicKey());
+    }
+    return block;
+  }
+
+  bool writeKeys(const shared_model::crypto::Keypair &keys) {
+    auto path = FLAGS_keys_path + "/" + FLAGS_peer_name;
+    std::ofstream public_key(path + ".pub");
+    std::ofstream private_key(path + ".priv");
+    public_key << keys.publicKey().hex();
+    private_key << keys.privateKey().hex();
+    return public_key.good() and private_key.good();
+  }
+}  // namespace
+
+/**
+ * Generates a chain of the given height into an empty flat file block store.
+ * The genesis block creates the accounts and the assets, every next block
+ * contains the transfers between the accounts drawn from the configured
+ * distributions. The chain depends only on the flags, so the same chain is
+ * generated for the same flags with any number of threads. The WSV matching
+ * the chain is built by irohad, which restores it from the block store.
+ */
+int main(int argc, char *argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+  auto log_manager =
+      std::make_shared<logger::LoggerManagerTree>(logger::LoggerConfig{
+          logger::LogLevel::kInfo, logger::getDefaultLogPatterns()});
+  auto log = log_manager->getChild("Generator")->getLogger();
+
+  if (FLAGS_blocks == 0 or FLAGS_accounts < 2 or FLAGS_assets == 0) {
+    log->error("At least one block, two accounts and one asset are required");
+    return EXIT_FAILURE;
+  }
+  // the transactions of a block take distinct milliseconds before it, so
+  // the transactions with the same transfer have different hashes
+  if (FLAGS_transactions_per_block > FLAGS_block_interval_ms) {
+    log->error("The transactions of a block do not fit the block interval");
+    return EXIT_FAILURE;
+  }
+  for (const auto &distribution :
+       {FLAGS_account_distribution, FLAGS_asset_distribution}) {
+    if (distribution != "uniform" and distribution != "zipf") {
+      log->error("Unknown distribution {}", distribution);
+      return EXIT_FAILURE;
+    }
+  }
+  FLAGS_threads = std::max<uint64_t>(FLAGS_threads, 1);
+
+  auto storage = iroha::ametsuchi::FlatFile::create(
+      FLAGS_block_store_path, log_manager->getChild("FlatFile")->getLogger());
+  if (not storage) {
+    log->error("Cannot open the block store {}", FLAGS_block_store_path);
+    return EXIT_FAILURE;
+  }
+  if ((*storage)->last_id() != 0) {
+    log->error("The block store {} is not empty", FLAGS_block_store_path);
+    return EXIT_FAILURE;
+  }
+
+  auto peer_keys = makeKeypair(FLAGS_peer_name);
+  if (not FLAGS_keys_path.empty() and not writeKeys(peer_keys)) {
+    log->error("Cannot write the keys to {}", FLAGS_keys_path);
+    return EXIT_FAILURE;
+  }
+
+  log->info("Generating the keys of {} accounts", FLAGS_accounts);
+  std::vector<boost::optional<shared_model::crypto::Keypair>> generated_keys(
+      FLAGS_accounts);
+  parallelFor(0, generated_keys.size(), [&generated_keys](size_t i) {
+    generated_keys[i] = makeKeypair(accountId(i));
+  });
+  std::vector<shared_model::crypto::Keypair> keys;
+  keys.reserve(generated_keys.size());
+  for (auto &keypair : generated_keys) {
+    keys.push_back(std::move(*keypair));
+  }
+  generated_keys.clear();
+
+  IndexDistribution accounts(FLAGS_accounts,
+                             FLAGS_account_distribution == "zipf",
+                             FLAGS_zipf_exponent);
+  IndexDistribution assets(
+      FLAGS_assets, FLAGS_asset_distribution == "zipf", FLAGS_zipf_exponent);
+
+  auto write = [&](const shared_model::proto::Block &block) {
+    return (*storage)->add(
+        block.height(),
+        iroha::ametsuchi::block_file_format::encode(block.blob().blob()));
+  };
+
+  std::vector<iroha::protocol::Transaction> genesis_transactions{
+      makeGenesisTransaction(keys, peer_keys.publicKey())};
+  auto genesis = makeBlock(
+      1, std::string(64, '0'), std::move(genesis_transactions), peer_keys);
+  if (not write(genesis)) {
+    log->error("Cannot write the genesis block");
+    return EXIT_FAILURE;
+  }
+  auto prev_hash = genesis.hash().hex();
+
+  // the transactions are generated and signed in parallel for a chunk of
+  // blocks, then the blocks are chained one by one
+  const size_t chunk = FLAGS_threads * 64;
+  std::vector<std::vector<iroha::protocol::Transaction>> transactions(chunk);
+  for (size_t first = 2; first <= FLAGS_blocks; first += chunk) {
+    auto last = std::min<size_t>(first + chunk, FLAGS_blocks + 1);
+    parallelFor(first, last, [&](size_t height) {
+      transactions[height - first] =
+          makeTransactions(height, keys, accounts, assets);
+    });
+    for (auto height = first; height < last; ++height) {
+      auto block = makeBlock(height,
+                             prev_hash,
+                             std::move(transactions[height - first]),
+                             peer_keys);
+      if (not write(block)) {
+        log->error("Cannot write block {}", height);
+        return EXIT_FAILURE;
+      }
+      prev_hash = block.hash().hex();
+    }
+    log->info("Generated {} of {} blocks", last - 1, FLAGS_blocks);
+  }
+  return EXIT_SUCCESS;
+}
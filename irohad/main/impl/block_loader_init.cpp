@@ -16,38 +16,61 @@ using namespace iroha::network;
 auto BlockLoaderInit::createService(
     std::shared_ptr<BlockQueryFactory> block_query_factory,
     std::shared_ptr<consensus::ConsensusResultCache> consensus_result_cache,
+    std::shared_ptr<WsvSnapshotFactory> wsv_snapshot_factory,
+    size_t max_streams,
+    size_t bandwidth,
+    std::shared_ptr<CompressionPolicy> block_compression,
     const logger::LoggerManagerTreePtr &loader_log_manager) {
   return std::make_shared<BlockLoaderService>(
       std::move(block_query_factory),
       std::move(consensus_result_cache),
-      loader_log_manager->getChild("Network")->getLogger());
+      std::move(wsv_snapshot_factory),
+      loader_log_manager->getChild("Network")->getLogger(),
+      max_streams,
+      bandwidth,
+      std::move(block_compression));
 }
 
 auto BlockLoaderInit::createLoader(
     std::shared_ptr<PeerQueryFactory> peer_query_factory,
     std::shared_ptr<shared_model::validation::ValidatorsConfig>
         validators_config,
+    std::shared_ptr<ChannelPool> channel_pool,
     logger::LoggerPtr loader_log) {
   shared_model::proto::ProtoBlockFactory factory(
-      std::make_unique<shared_model::validation::DefaultSignedBlockValidator>(
+      std::make_unique<shared_model::validation::DefaultUnsignedBlockValidator>(
           validators_config),
       std::make_unique<shared_model::validation::ProtoBlockValidator>());
   return std::make_shared<BlockLoaderImpl>(
-      std::move(peer_query_factory), std::move(factory), std::move(loader_log));
+      std::move(peer_query_factory),
+      std::move(factory),
+      std::move(loader_log),
+      BlockLoaderImpl::kDefaultBlocksPerRange,
+      std::move(channel_pool));
 }
 
 std::shared_ptr<BlockLoader> BlockLoaderInit::initBlockLoader(
     std::shared_ptr<PeerQueryFactory> peer_query_factory,
     std::shared_ptr<BlockQueryFactory> block_query_factory,
     std::shared_ptr<consensus::ConsensusResultCache> consensus_result_cache,
+    std::shared_ptr<WsvSnapshotFactory> wsv_snapshot_factory,
     std::shared_ptr<shared_model::validation::ValidatorsConfig>
         validators_config,
+    size_t max_streams,
+    size_t bandwidth,
+    std::shared_ptr<ChannelPool> channel_pool,
+    std::shared_ptr<CompressionPolicy> block_compression,
     const logger::LoggerManagerTreePtr &loader_log_manager) {
   service = createService(std::move(block_query_factory),
                           std::move(consensus_result_cache),
+                          std::move(wsv_snapshot_factory),
+                          max_streams,
+                          bandwidth,
+                          std::move(block_compression),
                           loader_log_manager);
   loader = createLoader(std::move(peer_query_factory),
                         std::move(validators_config),
+                        std::move(channel_pool),
                         loader_log_manager->getLogger());
   return loader;
 }
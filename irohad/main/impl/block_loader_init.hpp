@@ -7,6 +7,7 @@
 #define IROHA_BLOCK_LOADER_INIT_HPP
 
 #include "ametsuchi/block_query_factory.hpp"
+#include "ametsuchi/wsv_snapshot_factory.hpp"
 #include "consensus/consensus_block_cache.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
@@ -25,12 +26,22 @@ namespace iroha {
        * Create block loader service with given storage
        * @param block_query_factory - factory to block query component
        * @param block_cache used to retrieve last block put by consensus
+       * @param wsv_snapshot_factory - factory of the served WSV snapshots
+       * @param max_streams - maximal number of the block streams served at
+       * once, 0 does not limit them
+       * @param bandwidth - bytes per second shared by the served block
+       * streams, 0 does not limit them
+       * @param block_compression - compression of the served blocks
        * @param loader_log - the log of the loader subsystem
        * @return initialized service
        */
       auto createService(
           std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
           std::shared_ptr<consensus::ConsensusResultCache> block_cache,
+          std::shared_ptr<ametsuchi::WsvSnapshotFactory> wsv_snapshot_factory,
+          size_t max_streams,
+          size_t bandwidth,
+          std::shared_ptr<CompressionPolicy> block_compression,
           const logger::LoggerManagerTreePtr &loader_log_manager);
 
       /**
@@ -38,6 +49,7 @@ namespace iroha {
        * block
        * @param peer_query_factory - factory for peer query component creation
        * @param validators_config - a config for underlying validators
+       * @param channel_pool - shared channels to the peers
        * @param loader_log - the log of the loader subsystem
        * @return initialized loader
        */
@@ -45,6 +57,7 @@ namespace iroha {
           std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
           std::shared_ptr<shared_model::validation::ValidatorsConfig>
               validators_config,
+          std::shared_ptr<ChannelPool> channel_pool,
           logger::LoggerPtr loader_log);
 
      public:
@@ -53,7 +66,14 @@ namespace iroha {
        * @param peer_query_factory - factory to peer query component
        * @param block_query_factory - factory to block query component
        * @param block_cache used to retrieve last block put by consensus
+       * @param wsv_snapshot_factory - factory of the served WSV snapshots
        * @param validators_config - a config for underlying validators
+       * @param max_streams - maximal number of the block streams served at
+       * once, 0 does not limit them
+       * @param bandwidth - bytes per second shared by the served block
+       * streams, 0 does not limit them
+       * @param channel_pool - shared channels to the peers
+       * @param block_compression - compression of the served blocks
        * @param loader_log - the log of the loader subsystem
        * @return initialized service
        */
@@ -62,8 +82,13 @@ namespace iroha {
           std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
           std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
           std::shared_ptr<consensus::ConsensusResultCache> block_cache,
+          std::shared_ptr<ametsuchi::WsvSnapshotFactory> wsv_snapshot_factory,
           std::shared_ptr<shared_model::validation::ValidatorsConfig>
               validators_config,
+          size_t max_streams,
+          size_t bandwidth,
+          std::shared_ptr<ChannelPool> channel_pool,
+          std::shared_ptr<CompressionPolicy> block_compression,
           const logger::LoggerManagerTreePtr &loader_log_manager);
 
       std::shared_ptr<BlockLoaderImpl> loader;
@@ -5,8 +5,13 @@
 
 #include "main/impl/consensus_init.hpp"
 
+#include <random>
+
 #include "common/bind.hpp"
+#include "common/named_thread.hpp"
 #include "consensus/yac/consistency_model.hpp"
+#include "consensus/yac/impl/broadcast_dissemination.hpp"
+#include "consensus/yac/impl/gossip_dissemination.hpp"
 #include "consensus/yac/impl/peer_orderer_impl.hpp"
 #include "consensus/yac/impl/timer_impl.hpp"
 #include "consensus/yac/impl/yac_crypto_provider_impl.hpp"
@@ -17,7 +22,6 @@
 #include "consensus/yac/transport/impl/network_impl.hpp"
 #include "consensus/yac/yac.hpp"
 #include "logger/logger_manager.hpp"
-#include "network/impl/grpc_channel_builder.hpp"
 
 using namespace iroha::consensus;
 using namespace iroha::consensus::yac;
@@ -38,6 +42,15 @@ namespace {
     return std::make_shared<YacHashProviderImpl>();
   }
 
+  std::shared_ptr<DisseminationStrategy> createDisseminationStrategy(
+      size_t gossip_fanout) {
+    if (gossip_fanout == 0) {
+      return std::make_shared<BroadcastDissemination>();
+    }
+    return std::make_shared<GossipDissemination>(gossip_fanout,
+                                                 std::random_device{}());
+  }
+
   std::shared_ptr<Yac> createYac(
       ClusterOrdering initial_order,
       Round initial_round,
@@ -45,6 +58,8 @@ namespace {
       std::shared_ptr<Timer> timer,
       std::shared_ptr<YacNetwork> network,
       ConsistencyModel consistency_model,
+      bool commit_certificates,
+      size_t gossip_fanout,
       rxcpp::observe_on_one_worker coordination,
       const logger::LoggerManagerTreePtr &consensus_log_manager) {
     std::shared_ptr<iroha::consensus::yac::CleanupStrategy> cleanup_strategy =
@@ -59,7 +74,9 @@ namespace {
         initial_order,
         initial_round,
         coordination,
-        consensus_log_manager->getChild("HashGate")->getLogger());
+        consensus_log_manager->getChild("HashGate")->getLogger(),
+        commit_certificates,
+        createDisseminationStrategy(gossip_fanout));
   }
 }  // namespace
 
@@ -74,11 +91,56 @@ namespace iroha {
         return consensus_network_;
       }
 
-      auto YacInit::createTimer(std::chrono::milliseconds delay_milliseconds) {
-        return std::make_shared<TimerImpl>(
+      std::shared_ptr<AdaptiveTimer> YacInit::getAdaptiveTimer() const {
+        return adaptive_timer_;
+      }
+
+      std::shared_ptr<TimerImpl> YacInit::getTimer() const {
+        return timer_;
+      }
+
+      std::shared_ptr<Yac> YacInit::getYac() const {
+        BOOST_ASSERT_MSG(initialized_,
+                         "YacInit::initConsensusGate(...) must be called prior "
+                         "to YacInit::getYac()!");
+        return yac_;
+      }
+
+      std::shared_ptr<YacGateImpl> YacInit::getYacGate() const {
+        BOOST_ASSERT_MSG(initialized_,
+                         "YacInit::initConsensusGate(...) must be called prior "
+                         "to YacInit::getYacGate()!");
+        return yac_gate_;
+      }
+
+      std::shared_ptr<network::BlockFetcher> YacInit::getBlockFetcher() const {
+        BOOST_ASSERT_MSG(initialized_,
+                         "YacInit::initConsensusGate(...) must be called prior "
+                         "to YacInit::getBlockFetcher()!");
+        return block_fetcher_;
+      }
+
+      std::shared_ptr<Timer> YacInit::createTimer(
+          std::chrono::milliseconds delay_milliseconds,
+          boost::optional<VoteDelayBounds> adaptive_vote_delay,
+          ConsistencyModel consistency_model) {
+        if (adaptive_vote_delay) {
+          adaptive_timer_ = std::make_shared<AdaptiveTimer>(
+              delay_milliseconds,
+              adaptive_vote_delay->min_delay,
+              adaptive_vote_delay->max_delay,
+              getSupermajorityChecker(consistency_model),
+              // TODO 2019-04-10 andrei: IR-441 Share a thread between MST and
+              // YAC
+              observeOnNamedThread("yac-timer"));
+          timer_ = adaptive_timer_;
+          return timer_;
+        }
+        timer_ = std::make_shared<TimerImpl>(
             delay_milliseconds,
             // TODO 2019-04-10 andrei: IR-441 Share a thread between MST and YAC
-            rxcpp::observe_on_new_thread());
+            observeOnNamedThread("yac-timer"));
+        return timer_;
       }
 
       std::shared_ptr<YacGate> YacInit::initConsensusGate(
@@ -96,7 +158,12 @@ namespace iroha {
           std::shared_ptr<
               iroha::network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
+          std::shared_ptr<network::ChannelPool> channel_pool,
           ConsistencyModel consistency_model,
+          bool commit_certificates,
+          size_t gossip_fanout,
+          boost::optional<VoteDelayBounds> adaptive_vote_delay,
+          rxcpp::observe_on_one_worker yac_coordination,
           const logger::LoggerManagerTreePtr &consensus_log_manager) {
         auto peer_orderer = createPeerOrderer(peer_query_factory);
         auto peers = peer_query_factory->createPeerQuery() |
@@ -104,34 +171,43 @@ namespace iroha {
 
         consensus_network_ = std::make_shared<NetworkImpl>(
             async_call,
-            [](const shared_model::interface::Peer &peer) {
-              return network::createClient<proto::Yac>(peer.address());
+            [channel_pool](const shared_model::interface::Peer &peer) {
+              return channel_pool->createClient<proto::Yac>(peer.address());
             },
             consensus_log_manager->getChild("Network")->getLogger());
 
-        auto yac = createYac(*ClusterOrdering::create(peers.value()),
+        yac_ = createYac(*ClusterOrdering::create(peers.value()),
                              initial_round,
                              keypair,
-                             createTimer(vote_delay_milliseconds),
+                             createTimer(vote_delay_milliseconds,
+                                         std::move(adaptive_vote_delay),
+                                         consistency_model),
                              consensus_network_,
                              consistency_model,
-                             rxcpp::observe_on_new_thread(),
+                             commit_certificates,
+                             gossip_fanout,
+                             std::move(yac_coordination),
                              consensus_log_manager);
-        consensus_network_->subscribe(yac);
+        consensus_network_->subscribe(yac_);
 
         auto hash_provider = createHashProvider();
 
         initialized_ = true;
 
-        return std::make_shared<YacGateImpl>(
-            std::move(yac),
+        block_fetcher_ = std::make_shared<network::BlockFetcher>(
+            std::move(block_loader),
+            consensus_log_manager->getChild("BlockFetcher")->getLogger());
+        yac_gate_ = std::make_shared<YacGateImpl>(
+            yac_,
             std::move(peer_orderer),
             alternative_peers |
                 [](auto &peers) { return ClusterOrdering::create(peers); },
             hash_provider,
             block_creator,
             std::move(consensus_result_cache),
-            consensus_log_manager->getChild("Gate")->getLogger());
+            consensus_log_manager->getChild("Gate")->getLogger(),
+            block_fetcher_);
+        return yac_gate_;
       }
     }  // namespace yac
   }    // namespace consensus
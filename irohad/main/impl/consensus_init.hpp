@@ -11,6 +11,7 @@
 #include "ametsuchi/peer_query_factory.hpp"
 #include "consensus/consensus_block_cache.hpp"
 #include "consensus/yac/consistency_model.hpp"
+#include "consensus/yac/impl/adaptive_timer.hpp"
 #include "consensus/yac/outcome_messages.hpp"
 #include "consensus/yac/timer.hpp"
 #include "consensus/yac/transport/impl/network_impl.hpp"
@@ -20,13 +21,18 @@
 #include "cryptography/keypair.hpp"
 #include "logger/logger_manager_fwd.hpp"
 #include "network/block_loader.hpp"
+#include "network/impl/block_fetcher.hpp"
 #include "network/impl/async_grpc_client.hpp"
+#include "network/impl/channel_pool.hpp"
 #include "simulator/block_creator.hpp"
 
 namespace iroha {
   namespace consensus {
     namespace yac {
 
+      class Yac;
+      class YacGateImpl;
+
       class YacInit {
        public:
         std::shared_ptr<YacGate> initConsensusGate(
@@ -43,16 +49,44 @@ namespace iroha {
             std::shared_ptr<
                 iroha::network::AsyncGrpcClient<google::protobuf::Empty>>
                 async_call,
+            std::shared_ptr<network::ChannelPool> channel_pool,
             ConsistencyModel consistency_model,
+            bool commit_certificates,
+            size_t gossip_fanout,
+            boost::optional<VoteDelayBounds> adaptive_vote_delay,
+            rxcpp::observe_on_one_worker yac_coordination,
             const logger::LoggerManagerTreePtr &consensus_log_manager);
 
         std::shared_ptr<NetworkImpl> getConsensusNetwork() const;
 
+        /// @return the timer of the consensus if it is adaptive, nullptr
+        /// otherwise
+        std::shared_ptr<AdaptiveTimer> getAdaptiveTimer() const;
+
+        /// @return the timer of the consensus
+        std::shared_ptr<TimerImpl> getTimer() const;
+
+        std::shared_ptr<Yac> getYac() const;
+
+        std::shared_ptr<YacGateImpl> getYacGate() const;
+
+        /// @return the download of the blocks agreed without the vote of
+        /// this peer, which is started by the consensus gate
+        std::shared_ptr<network::BlockFetcher> getBlockFetcher() const;
+
        private:
-        auto createTimer(std::chrono::milliseconds delay_milliseconds);
+        std::shared_ptr<Timer> createTimer(
+            std::chrono::milliseconds delay_milliseconds,
+            boost::optional<VoteDelayBounds> adaptive_vote_delay,
+            ConsistencyModel consistency_model);
 
         bool initialized_{false};
         std::shared_ptr<NetworkImpl> consensus_network_;
+        std::shared_ptr<AdaptiveTimer> adaptive_timer_;
+        std::shared_ptr<TimerImpl> timer_;
+        std::shared_ptr<Yac> yac_;
+        std::shared_ptr<YacGateImpl> yac_gate_;
+        std::shared_ptr<network::BlockFetcher> block_fetcher_;
       };
     }  // namespace yac
   }    // namespace consensus
@@ -9,6 +9,7 @@
 
 #include <rxcpp/operators/rx-filter.hpp>
 #include <rxcpp/operators/rx-map.hpp>
+#include <rxcpp/operators/rx-observe_on.hpp>
 #include <rxcpp/operators/rx-skip.hpp>
 #include <rxcpp/operators/rx-start_with.hpp>
 #include <rxcpp/operators/rx-tap.hpp>
@@ -16,12 +17,14 @@
 #include <rxcpp/operators/rx-zip.hpp>
 #include "common/bind.hpp"
 #include "common/delay.hpp"
+#include "common/visitor.hpp"
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
 #include "datetime/time.hpp"
 #include "interfaces/common_objects/peer.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
+#include "ordering/impl/coalescing_notification_factory.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 #include "ordering/impl/on_demand_connection_manager.hpp"
 #include "ordering/impl/on_demand_ordering_gate.hpp"
@@ -41,23 +44,34 @@ namespace iroha {
     auto OnDemandOrderingInit::createNotificationFactory(
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call,
+        std::shared_ptr<network::ChannelPool> channel_pool,
         std::shared_ptr<TransportFactoryType> proposal_transport_factory,
         std::chrono::milliseconds delay,
+        bool proposal_streaming,
+        std::shared_ptr<network::CompressionPolicy> batches_compression,
         const logger::LoggerManagerTreePtr &ordering_log_manager) {
       return std::make_shared<ordering::transport::OnDemandOsClientGrpcFactory>(
           std::move(async_call),
           std::move(proposal_transport_factory),
           [] { return std::chrono::system_clock::now(); },
           delay,
-          ordering_log_manager->getChild("NetworkClient")->getLogger());
+          ordering_log_manager->getChild("NetworkClient")->getLogger(),
+          proposal_streaming,
+          std::move(channel_pool),
+          std::move(batches_compression));
     }
 
     auto OnDemandOrderingInit::createConnectionManager(
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call,
+        std::shared_ptr<network::ChannelPool> channel_pool,
         std::shared_ptr<TransportFactoryType> proposal_transport_factory,
         std::chrono::milliseconds delay,
         std::vector<shared_model::interface::types::HashType> initial_hashes,
+        bool proposal_streaming,
+        std::chrono::milliseconds batch_flush_delay,
+        size_t batch_flush_size,
+        std::shared_ptr<network::CompressionPolicy> batches_compression,
         const logger::LoggerManagerTreePtr &ordering_log_manager) {
       // since top block will be the first in commit_notifier observable,
       // hashes of two previous blocks are prepended
@@ -91,7 +105,7 @@ namespace iroha {
         // hash
         auto generate_permutation = [&](auto round) {
           auto &hash = std::get<round()>(current_hashes);
-          log_->debug("Using hash: {}", hash.toString());
+          log_->debug("Using hash: {}", hash);
           auto &permutation = permutations_[round()];
 
           std::seed_seq seed(hash.blob().begin(), hash.blob().end());
@@ -174,11 +188,26 @@ namespace iroha {
                        .with_latest_from(latest_hashes)
                        .map(map_peers);
 
-      return std::make_shared<ordering::OnDemandConnectionManager>(
+      client_factory =
           createNotificationFactory(std::move(async_call),
+                                    std::move(channel_pool),
                                     std::move(proposal_transport_factory),
                                     delay,
-                                    ordering_log_manager),
+                                    proposal_streaming,
+                                    std::move(batches_compression),
+                                    ordering_log_manager);
+      std::shared_ptr<ordering::transport::OdOsNotificationFactory> factory =
+          client_factory;
+      if (batch_flush_delay.count() > 0) {
+        factory = std::make_shared<ordering::CoalescingNotificationFactory>(
+            std::move(factory),
+            batch_flush_delay,
+            batch_flush_size,
+            ordering_log_manager->getChild("SendQueue")->getLogger());
+      }
+
+      return std::make_shared<ordering::OnDemandConnectionManager>(
+          std::move(factory),
           peers,
           ordering_log_manager->getChild("ConnectionManager")->getLogger());
     }
@@ -194,7 +223,36 @@ namespace iroha {
         std::function<std::chrono::milliseconds(
             const synchronizer::SynchronizationEvent &)> delay_func,
         size_t max_number_of_transactions,
+        rxcpp::observable<consensus::GateObject> consensus_outcomes,
+        rxcpp::observe_on_one_worker prefetch_coordination,
+        ordering::OnDemandOrderingGate::ProposalFetcher fetch_next_proposal,
         const logger::LoggerManagerTreePtr &ordering_log_manager) {
+      using PrefetchEvent = ordering::OnDemandOrderingGate::PrefetchEvent;
+      // commits are known to the consensus before the block is applied
+      auto prefetch_events =
+          consensus_outcomes
+              .map([](const consensus::GateObject &object) {
+                using Result = boost::optional<PrefetchEvent>;
+                return iroha::visit_in_place(
+                    object,
+                    [](const consensus::PairValid &msg) -> Result {
+                      return PrefetchEvent{
+                          ordering::nextCommitRound(msg.round),
+                          msg.block->hash(),
+                          msg.ledger_state};
+                    },
+                    [](const consensus::VoteOther &msg) -> Result {
+                      return PrefetchEvent{ordering::nextCommitRound(msg.round),
+                                           msg.hash,
+                                           msg.ledger_state};
+                    },
+                    [](const auto &) -> Result { return boost::none; });
+              })
+              .filter([](const auto &event) { return bool(event); })
+              .map([](auto event) { return *std::move(event); })
+              // prefetch must not delay the commit of the current block
+              .observe_on(prefetch_coordination);
+
       return std::make_shared<ordering::OnDemandOrderingGate>(
           std::move(ordering_service),
           std::move(network_client),
@@ -282,7 +340,13 @@ namespace iroha {
           std::move(tx_cache),
           std::move(creation_strategy),
           max_number_of_transactions,
-          ordering_log_manager->getChild("Gate")->getLogger());
+          ordering_log_manager->getChild("Gate")->getLogger(),
+          std::make_shared<ordering::ProcessedTxFilter>(
+              ordering::ProcessedTxFilter::kDefaultGenerationCapacity,
+              ordering::ProcessedTxFilter::kDefaultFalsePositiveRate,
+              [] { return iroha::time::now(); }),
+          std::move(prefetch_events),
+          std::move(fetch_next_proposal));
     }
 
     auto OnDemandOrderingInit::createService(
@@ -291,13 +355,17 @@ namespace iroha {
             proposal_factory,
         std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
         std::shared_ptr<ordering::ProposalCreationStrategy> creation_strategy,
+        std::shared_ptr<ordering::FairQueuing> fair_queuing,
         const logger::LoggerManagerTreePtr &ordering_log_manager) {
       return std::make_shared<ordering::OnDemandOrderingServiceImpl>(
           max_number_of_transactions,
           std::move(proposal_factory),
           std::move(tx_cache),
           creation_strategy,
-          ordering_log_manager->getChild("Service")->getLogger());
+          ordering_log_manager->getChild("Service")->getLogger(),
+          ordering::OnDemandOrderingServiceImpl::kDefaultNumberOfProposals,
+          ordering::OnDemandOrderingServiceImpl::kDefaultMaxCarriedOverTxs,
+          std::move(fair_queuing));
     }
 
     OnDemandOrderingInit::~OnDemandOrderingInit() {
@@ -319,39 +387,72 @@ namespace iroha {
             transaction_batch_factory,
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call,
+        std::shared_ptr<network::ChannelPool> channel_pool,
         std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
             proposal_factory,
         std::shared_ptr<TransportFactoryType> proposal_transport_factory,
         std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
         std::shared_ptr<ordering::ProposalCreationStrategy> creation_strategy,
+        std::shared_ptr<ordering::FairQueuing> fair_queuing,
         std::function<std::chrono::milliseconds(
             const synchronizer::SynchronizationEvent &)> delay_func,
+        bool proposal_streaming,
+        std::chrono::milliseconds batch_flush_delay,
+        size_t batch_flush_size,
+        std::shared_ptr<validation::ValidationPool> validation_pool,
+        std::shared_ptr<network::CompressionPolicy> proposal_compression,
+        std::shared_ptr<network::CompressionPolicy> batches_compression,
+        bool pipelined_consensus,
+        rxcpp::observable<consensus::GateObject> consensus_outcomes,
+        rxcpp::observe_on_one_worker prefetch_coordination,
         logger::LoggerManagerTreePtr ordering_log_manager) {
-      auto ordering_service = createService(max_number_of_transactions,
-                                            proposal_factory,
-                                            tx_cache,
-                                            creation_strategy,
-                                            ordering_log_manager);
+      ordering_service = createService(max_number_of_transactions,
+                                       proposal_factory,
+                                       tx_cache,
+                                       creation_strategy,
+                                       std::move(fair_queuing),
+                                       ordering_log_manager);
       service = std::make_shared<ordering::transport::OnDemandOsServerGrpc>(
           ordering_service,
           std::move(transaction_factory),
           std::move(batch_parser),
           std::move(transaction_batch_factory),
-          ordering_log_manager->getChild("Server")->getLogger());
-      return createGate(
-          ordering_service,
+          ordering_log_manager->getChild("Server")->getLogger(),
+          boost::make_optional(proposal_streaming,
+                               ordering_service->onProposalCreated()),
+          std::move(validation_pool),
+          std::move(proposal_compression));
+      auto connection_manager =
           createConnectionManager(std::move(async_call),
+                                  std::move(channel_pool),
                                   std::move(proposal_transport_factory),
                                   delay,
                                   std::move(initial_hashes),
-                                  ordering_log_manager),
-          std::make_shared<ordering::cache::OnDemandCache>(),
-          std::move(proposal_factory),
-          std::move(tx_cache),
-          std::move(creation_strategy),
-          std::move(delay_func),
-          max_number_of_transactions,
-          ordering_log_manager);
+                                  proposal_streaming,
+                                  batch_flush_delay,
+                                  batch_flush_size,
+                                  std::move(batches_compression),
+                                  ordering_log_manager);
+      ordering::OnDemandOrderingGate::ProposalFetcher fetch_next_proposal;
+      if (pipelined_consensus) {
+        fetch_next_proposal = [connection_manager](consensus::Round round) {
+          return connection_manager->onRequestNextCommitProposal(round);
+        };
+      }
+      gate_cache = std::make_shared<ordering::cache::OnDemandCache>();
+      gate = createGate(ordering_service,
+                        std::move(connection_manager),
+                        gate_cache,
+                        std::move(proposal_factory),
+                        std::move(tx_cache),
+                        std::move(creation_strategy),
+                        std::move(delay_func),
+                        max_number_of_transactions,
+                        std::move(consensus_outcomes),
+                        std::move(prefetch_coordination),
+                        std::move(fetch_next_proposal),
+                        ordering_log_manager);
+      return gate;
     }
 
   }  // namespace network
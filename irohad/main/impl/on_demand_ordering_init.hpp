@@ -11,19 +11,31 @@
 #include <rxcpp/rx-lite.hpp>
 #include "ametsuchi/storage.hpp"
 #include "ametsuchi/tx_presence_cache.hpp"
+#include "consensus/gate_object.hpp"
 #include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
 #include "network/impl/async_grpc_client.hpp"
+#include "network/impl/channel_pool.hpp"
+#include "network/impl/compression_policy.hpp"
 #include "network/ordering_gate.hpp"
 #include "network/peer_communication_service.hpp"
 #include "ordering.grpc.pb.h"
+#include "ordering/impl/on_demand_ordering_gate.hpp"
 #include "ordering/impl/on_demand_os_server_grpc.hpp"
-#include "ordering/impl/ordering_gate_cache/ordering_gate_cache.hpp"
+#include "ordering/impl/ordering_gate_cache/on_demand_cache.hpp"
 #include "ordering/on_demand_ordering_service.hpp"
 #include "ordering/ordering_service_proposal_creation_strategy.hpp"
 
 namespace iroha {
+  namespace ordering {
+    class FairQueuing;
+    class OnDemandOrderingServiceImpl;
+    namespace transport {
+      class OnDemandOsClientGrpcFactory;
+    }  // namespace transport
+  }  // namespace ordering
+
   namespace network {
 
     /**
@@ -44,8 +56,11 @@ namespace iroha {
       auto createNotificationFactory(
           std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
+          std::shared_ptr<network::ChannelPool> channel_pool,
           std::shared_ptr<TransportFactoryType> proposal_transport_factory,
           std::chrono::milliseconds delay,
+          bool proposal_streaming,
+          std::shared_ptr<network::CompressionPolicy> batches_compression,
           const logger::LoggerManagerTreePtr &ordering_log_manager);
 
       /**
@@ -56,9 +71,14 @@ namespace iroha {
       auto createConnectionManager(
           std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
+          std::shared_ptr<network::ChannelPool> channel_pool,
           std::shared_ptr<TransportFactoryType> proposal_transport_factory,
           std::chrono::milliseconds delay,
           std::vector<shared_model::interface::types::HashType> initial_hashes,
+          bool proposal_streaming,
+          std::chrono::milliseconds batch_flush_delay,
+          size_t batch_flush_size,
+          std::shared_ptr<network::CompressionPolicy> batches_compression,
           const logger::LoggerManagerTreePtr &ordering_log_manager);
 
       /**
@@ -76,6 +96,9 @@ namespace iroha {
           std::function<std::chrono::milliseconds(
               const synchronizer::SynchronizationEvent &)> delay_func,
           size_t max_number_of_transactions,
+          rxcpp::observable<consensus::GateObject> consensus_outcomes,
+          rxcpp::observe_on_one_worker prefetch_coordination,
+          ordering::OnDemandOrderingGate::ProposalFetcher fetch_next_proposal,
           const logger::LoggerManagerTreePtr &ordering_log_manager);
 
       /**
@@ -88,6 +111,7 @@ namespace iroha {
               proposal_factory,
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           std::shared_ptr<ordering::ProposalCreationStrategy> creation_strategy,
+          std::shared_ptr<ordering::FairQueuing> fair_queuing,
           const logger::LoggerManagerTreePtr &ordering_log_manager);
 
       rxcpp::composite_subscription sync_event_notifier_lifetime_;
@@ -116,10 +140,29 @@ namespace iroha {
        * batch candidates produced by parser
        * @param async_call asynchronous gRPC client required for sending batches
        * requests to ordering service and processing responses
+       * @param channel_pool - shared channels to the peers
        * @param proposal_factory factory required by ordering service to produce
        * proposals
        * @param creation_strategy - provides a strategy for creating proposals
        * in OS
+       * @param fair_queuing - selection of the batches for the proposals of
+       * OS by their creators, arrival order if it is not set
+       * @param proposal_streaming - subscribe to the proposals pushed by the
+       * ordering services of the peers instead of requesting them every round
+       * @param batch_flush_delay - time window for coalescing batches sent to
+       * the same peer. Zero disables coalescing
+       * @param batch_flush_size - size of coalesced transactions which
+       * triggers the flush before the time window elapses
+       * @param validation_pool - workers which validate transactions
+       * received by ordering service network endpoint
+       * @param proposal_compression - compression of the proposals served by
+       * ordering service network endpoint
+       * @param batches_compression - compression of the batches sent to the
+       * ordering services of the peers
+       * @param pipelined_consensus - request the proposal of the next round
+       * when the consensus reaches the commit, before the block is applied
+       * @param consensus_outcomes - outcomes of the consensus gate
+       * @param prefetch_coordination - thread of the proposal prefetch
        * @return initialized ordering gate
        */
       std::shared_ptr<network::OrderingGate> initOrderingGate(
@@ -135,18 +178,43 @@ namespace iroha {
               transaction_batch_factory,
           std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
+          std::shared_ptr<network::ChannelPool> channel_pool,
           std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
               proposal_factory,
           std::shared_ptr<TransportFactoryType> proposal_transport_factory,
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           std::shared_ptr<ordering::ProposalCreationStrategy> creation_strategy,
+          std::shared_ptr<ordering::FairQueuing> fair_queuing,
           std::function<std::chrono::milliseconds(
               const synchronizer::SynchronizationEvent &)> delay_func,
+          bool proposal_streaming,
+          std::chrono::milliseconds batch_flush_delay,
+          size_t batch_flush_size,
+          std::shared_ptr<validation::ValidationPool> validation_pool,
+          std::shared_ptr<network::CompressionPolicy> proposal_compression,
+          std::shared_ptr<network::CompressionPolicy> batches_compression,
+          bool pipelined_consensus,
+          rxcpp::observable<consensus::GateObject> consensus_outcomes,
+          rxcpp::observe_on_one_worker prefetch_coordination,
           logger::LoggerManagerTreePtr ordering_log_manager);
 
       /// gRPC service for ordering service
       std::shared_ptr<ordering::proto::OnDemandOrdering::Service> service;
 
+      /// ordering service created by initOrderingGate
+      std::shared_ptr<ordering::OnDemandOrderingServiceImpl> ordering_service;
+
+      /// ordering gate created by initOrderingGate
+      std::shared_ptr<ordering::OnDemandOrderingGate> gate;
+
+      /// factory of the connections to the ordering services of the peers,
+      /// created by initOrderingGate
+      std::shared_ptr<ordering::transport::OnDemandOsClientGrpcFactory>
+          client_factory;
+
+      /// cache of the batches resent by the gate, created by initOrderingGate
+      std::shared_ptr<ordering::cache::OnDemandCache> gate_cache;
+
       /// commit notifier from peer communication service
       rxcpp::subjects::subject<decltype(std::declval<PeerCommunicationService>()
                                             .onSynchronization())::value_type>
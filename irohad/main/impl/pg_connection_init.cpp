@@ -5,6 +5,8 @@
 
 #include "main/impl/pg_connection_init.hpp"
 
+#include <algorithm>
+
 #include "ametsuchi/impl/pool_wrapper.hpp"
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
@@ -45,7 +47,9 @@ PgConnectionInit::prepareConnectionPool(
     const ReconnectionStrategyFactory &reconnection_strategy_factory,
     const PostgresOptions &options,
     const int pool_size,
-    logger::LoggerManagerTreePtr log_manager) {
+    logger::LoggerManagerTreePtr log_manager,
+    size_t query_pool_size,
+    size_t restore_pool_size) {
   auto options_str = options.workingConnectionString();
 
   auto conn = initPostgresConnection(options_str, pool_size);
@@ -59,6 +63,11 @@ PgConnectionInit::prepareConnectionPool(
 
   soci::session sql(*connection);
   bool enable_prepared_transactions = preparedTransactionsAvailable(sql);
+  if (not enable_prepared_transactions) {
+    log_manager->getLogger()->warn(
+        "max_prepared_transactions of the database is 0, so the transactions "
+        "of every agreed block are applied again on commit");
+  }
   try {
     auto try_rollback = [&](soci::session &session) {
       if (enable_prepared_transactions) {
@@ -77,15 +86,64 @@ PgConnectionInit::prepareConnectionPool(
     initializeConnectionPool(*connection,
                              pool_size,
                              try_rollback,
+                             true,
                              *failover_callback_factory,
                              reconnection_strategy_factory,
                              options.maintenanceConnectionString(),
                              log_manager);
 
+    // the lanes with own connections get pools of their own, the database
+    // is already prepared through the commit lane
+    auto make_lane_pool = [&](std::string &lane_options,
+                              const std::string &reconnection_options,
+                              size_t lane_pool_size)
+        -> std::shared_ptr<soci::connection_pool> {
+      if (lane_pool_size == 0) {
+        return nullptr;
+      }
+      auto lane_pool = initPostgresConnection(lane_options, lane_pool_size);
+      if (auto e = expected::resultToOptionalError(lane_pool)) {
+        throw std::runtime_error(*e);
+      }
+      auto pool = expected::resultToOptionalValue(lane_pool).value();
+      initializeConnectionPool(*pool,
+                               lane_pool_size,
+                               [](auto &) {},
+                               false,
+                               *failover_callback_factory,
+                               reconnection_strategy_factory,
+                               reconnection_options,
+                               log_manager);
+      return pool;
+    };
+    auto query_pool = make_lane_pool(
+        options_str, options.maintenanceConnectionString(), query_pool_size);
+    auto restore_pool = make_lane_pool(
+        options_str, options.maintenanceConnectionString(), restore_pool_size);
+
+    // an unavailable replica only leaves more queries to the primary
+    const size_t replica_pool_size = std::max<size_t>(query_pool_size, 1);
+    std::vector<std::shared_ptr<soci::connection_pool>> replica_pools;
+    for (auto &replica_options : options.replicaConnectionStrings()) {
+      try {
+        replica_pools.push_back(make_lane_pool(
+            replica_options, replica_options, replica_pool_size));
+      } catch (const std::exception &e) {
+        log_manager->getLogger()->warn(
+            "Failed to connect to a database replica: {}", e.what());
+      }
+    }
+
     return expected::makeValue<std::shared_ptr<PoolWrapper>>(
         std::make_shared<PoolWrapper>(std::move(connection),
                                       std::move(failover_callback_factory),
-                                      enable_prepared_transactions));
+                                      enable_prepared_transactions,
+                                      std::move(query_pool),
+                                      query_pool_size,
+                                      std::move(restore_pool),
+                                      restore_pool_size,
+                                      std::move(replica_pools),
+                                      replica_pool_size));
 
   } catch (const std::exception &e) {
     return expected::makeError(e.what());
@@ -159,6 +217,7 @@ void PgConnectionInit::initializeConnectionPool(
     soci::connection_pool &connection_pool,
     size_t pool_size,
     RollbackFunction try_rollback,
+    bool prepare_database,
     FailoverCallbackHolder &callback_factory,
     const ReconnectionStrategyFactory &reconnection_strategy_factory,
     const std::string &pg_reconnection_options,
@@ -207,7 +266,12 @@ void PgConnectionInit::initializeConnectionPool(
 
   assert(pool_size > 0);
 
-  initialize_session(connection_pool.at(0), init_db, init_failover_callback);
+  if (prepare_database) {
+    initialize_session(connection_pool.at(0), init_db, init_failover_callback);
+  } else {
+    initialize_session(
+        connection_pool.at(0), [](auto &) {}, init_failover_callback);
+  }
   for (size_t i = 1; i != pool_size; i++) {
     soci::session &session = connection_pool.at(i);
     initialize_session(session, [](auto &) {}, init_failover_callback);
@@ -236,6 +300,20 @@ CREATE TABLE IF NOT EXISTS account (
     data JSONB,
     PRIMARY KEY (account_id)
 );
+CREATE TABLE IF NOT EXISTS account_detail (
+    account_id character varying(288) NOT NULL REFERENCES account,
+    writer character varying(288) NOT NULL,
+    key text NOT NULL,
+    value JSONB NOT NULL,
+    PRIMARY KEY (account_id, writer, key)
+);
+INSERT INTO account_detail (account_id, writer, key, value)
+SELECT account.account_id, data_by_writer.key, plain_data.key, plain_data.value
+FROM account,
+    jsonb_each(account.data) data_by_writer,
+    jsonb_each(data_by_writer.value) plain_data
+WHERE NOT EXISTS (SELECT * FROM account_detail)
+ON CONFLICT DO NOTHING;
 CREATE TABLE IF NOT EXISTS account_has_signatory (
     account_id character varying(288) NOT NULL REFERENCES account,
     public_key varchar NOT NULL REFERENCES signatory,
@@ -279,39 +357,380 @@ CREATE TABLE IF NOT EXISTS account_has_grantable_permissions (
       + R"() NOT NULL,
     PRIMARY KEY (permittee_account_id, account_id)
 );
+CREATE TABLE IF NOT EXISTS account_effective_permissions (
+    account_id character varying(288) NOT NULL,
+    permission bit()"
+      + std::to_string(shared_model::interface::RolePermissionSet::size())
+      + R"() NOT NULL,
+    PRIMARY KEY (account_id)
+);
+CREATE OR REPLACE FUNCTION iroha_update_effective_permissions(
+    target_account text) RETURNS void AS $$
+BEGIN
+  INSERT INTO account_effective_permissions (account_id, permission)
+  SELECT target_account, COALESCE(bit_or(rp.permission), '0'::bit()"
+      + std::to_string(shared_model::interface::RolePermissionSet::size())
+      + R"())
+  FROM role_has_permissions AS rp
+  JOIN account_has_roles AS ar ON ar.role_id = rp.role_id
+  WHERE ar.account_id = target_account
+  ON CONFLICT (account_id) DO UPDATE SET permission = EXCLUDED.permission;
+END
+$$ LANGUAGE plpgsql;
+CREATE OR REPLACE FUNCTION iroha_account_roles_changed() RETURNS trigger AS $$
+BEGIN
+  IF TG_OP <> 'INSERT' THEN
+    PERFORM iroha_update_effective_permissions(OLD.account_id);
+  END IF;
+  IF TG_OP <> 'DELETE' THEN
+    PERFORM iroha_update_effective_permissions(NEW.account_id);
+  END IF;
+  RETURN NULL;
+END
+$$ LANGUAGE plpgsql;
+CREATE OR REPLACE FUNCTION iroha_role_permissions_changed() RETURNS trigger
+AS $$
+BEGIN
+  IF TG_OP <> 'INSERT' THEN
+    PERFORM iroha_update_effective_permissions(account_id)
+    FROM account_has_roles WHERE role_id = OLD.role_id;
+  END IF;
+  IF TG_OP <> 'DELETE' THEN
+    PERFORM iroha_update_effective_permissions(account_id)
+    FROM account_has_roles WHERE role_id = NEW.role_id;
+  END IF;
+  RETURN NULL;
+END
+$$ LANGUAGE plpgsql;
+DROP TRIGGER IF EXISTS account_roles_changed ON account_has_roles;
+CREATE TRIGGER account_roles_changed
+    AFTER INSERT OR UPDATE OR DELETE ON account_has_roles
+    FOR EACH ROW EXECUTE PROCEDURE iroha_account_roles_changed();
+DROP TRIGGER IF EXISTS role_permissions_changed ON role_has_permissions;
+CREATE TRIGGER role_permissions_changed
+    AFTER INSERT OR UPDATE OR DELETE ON role_has_permissions
+    FOR EACH ROW EXECUTE PROCEDURE iroha_role_permissions_changed();
+-- the databases created before have the roles without the permission sets
+INSERT INTO account_effective_permissions (account_id, permission)
+SELECT ar.account_id, bit_or(rp.permission)
+FROM account_has_roles AS ar
+JOIN role_has_permissions AS rp ON rp.role_id = ar.role_id
+WHERE NOT EXISTS (SELECT 1 FROM account_effective_permissions)
+GROUP BY ar.account_id;
 CREATE TABLE IF NOT EXISTS position_by_hash (
-    hash varchar,
+    hash bytea,
     height bigint,
     index bigint
 );
 CREATE TABLE IF NOT EXISTS tx_status_by_hash (
-    hash varchar,
+    hash bytea,
     status boolean
 );
+DO $$
+BEGIN
+  -- the tx hashes of the databases created before were stored in hex
+  IF EXISTS (SELECT 1 FROM information_schema.columns
+             WHERE table_schema = current_schema()
+                 AND table_name = 'position_by_hash'
+                 AND column_name = 'hash' AND data_type <> 'bytea') THEN
+    ALTER TABLE position_by_hash
+        ALTER COLUMN hash TYPE bytea USING decode(hash, 'hex');
+  END IF;
+  IF EXISTS (SELECT 1 FROM information_schema.columns
+             WHERE table_schema = current_schema()
+                 AND table_name = 'tx_status_by_hash'
+                 AND column_name = 'hash' AND data_type <> 'bytea') THEN
+    ALTER TABLE tx_status_by_hash
+        ALTER COLUMN hash TYPE bytea USING decode(hash, 'hex');
+  END IF;
+END
+$$;
 CREATE INDEX IF NOT EXISTS tx_status_by_hash_hash_index
   ON tx_status_by_hash
   USING hash
   (hash);
+CREATE INDEX IF NOT EXISTS position_by_hash_hash_index
+  ON position_by_hash
+  USING hash
+  (hash);
+-- the history tables refer to the account and asset ids by the integer keys
+-- of the dictionary, which keeps their rows and indexes narrow
+CREATE TABLE IF NOT EXISTS id_dictionary (
+    key serial PRIMARY KEY,
+    id text NOT NULL UNIQUE
+);
+CREATE OR REPLACE FUNCTION iroha_id_key(target_id text) RETURNS integer
+AS $$
+DECLARE
+  found integer;
+BEGIN
+  SELECT key INTO found FROM id_dictionary WHERE id = target_id;
+  IF found IS NULL THEN
+    -- the id may be added by a concurrent transaction in the meantime
+    INSERT INTO id_dictionary (id) VALUES (target_id)
+    ON CONFLICT (id) DO NOTHING
+    RETURNING key INTO found;
+    IF found IS NULL THEN
+      SELECT key INTO found FROM id_dictionary WHERE id = target_id;
+    END IF;
+  END IF;
+  RETURN found;
+END
+$$ LANGUAGE plpgsql;
+CREATE OR REPLACE FUNCTION iroha_key_id(target_key integer) RETURNS text
+AS $$
+  SELECT id FROM id_dictionary WHERE key = target_key
+$$ LANGUAGE sql STABLE;
+DO $$
+BEGIN
+  -- the history tables of the new databases are partitioned by height, when
+  -- the server supports the indexes on the partitioned tables
+  IF CAST(current_setting('server_version_num') AS int) >= 110000 THEN
+    CREATE TABLE IF NOT EXISTS tx_position_by_creator (
+        creator_key integer,
+        height bigint,
+        index bigint
+    ) PARTITION BY RANGE (height);
+    CREATE TABLE IF NOT EXISTS position_by_account_asset (
+        account_key integer,
+        asset_key integer,
+        height bigint,
+        index bigint
+    ) PARTITION BY RANGE (height);
+  END IF;
+END
+$$;
+CREATE OR REPLACE FUNCTION iroha_history_partitions(
+    from_height bigint, to_height bigint) RETURNS void AS $$
+DECLARE
+  -- DEFAULT instead of the assignment, as the colons are the placeholders
+  blocks CONSTANT bigint DEFAULT )"
+      + std::to_string(kHistoryPartitionBlocks) + R"(;
+  parent text;
+  part bigint;
+BEGIN
+  FOR parent IN
+    SELECT relname FROM pg_class
+    WHERE relname IN ('tx_position_by_creator', 'position_by_account_asset')
+        AND relkind = 'p' AND pg_table_is_visible(oid)
+  LOOP
+    -- the next partition is created in advance
+    FOR part IN
+      SELECT generate_series(from_height / blocks, to_height / blocks + 1)
+    LOOP
+      IF NOT EXISTS (SELECT 1 FROM pg_class
+                     WHERE relname = parent || '_' || part
+                         AND pg_table_is_visible(oid)) THEN
+        EXECUTE format('CREATE TABLE %I PARTITION OF %I '
+                       'FOR VALUES FROM (%s) TO (%s)',
+                       parent || '_' || part,
+                       parent,
+                       part * blocks,
+                       (part + 1) * blocks);
+      END IF;
+    END LOOP;
+  END LOOP;
+END
+$$ LANGUAGE plpgsql;
 CREATE TABLE IF NOT EXISTS tx_position_by_creator (
-    creator_id text,
+    creator_key integer,
     height bigint,
     index bigint
 );
 CREATE TABLE IF NOT EXISTS position_by_account_asset (
-    account_id text,
-    asset_id text,
+    account_key integer,
+    asset_key integer,
     height bigint,
     index bigint
 );
+DO $$
+BEGIN
+  -- the history of the databases created before refers to the ids, and their
+  -- indexes are dropped together with the id columns
+  IF EXISTS (SELECT 1 FROM information_schema.columns
+             WHERE table_schema = current_schema()
+                 AND table_name = 'tx_position_by_creator'
+                 AND column_name = 'creator_id') THEN
+    INSERT INTO id_dictionary (id)
+    SELECT DISTINCT creator_id FROM tx_position_by_creator
+    ON CONFLICT (id) DO NOTHING;
+    ALTER TABLE tx_position_by_creator ADD COLUMN creator_key integer;
+    UPDATE tx_position_by_creator SET creator_key = d.key
+    FROM id_dictionary AS d WHERE d.id = creator_id;
+    ALTER TABLE tx_position_by_creator DROP COLUMN creator_id;
+  END IF;
+  IF EXISTS (SELECT 1 FROM information_schema.columns
+             WHERE table_schema = current_schema()
+                 AND table_name = 'position_by_account_asset'
+                 AND column_name = 'account_id') THEN
+    INSERT INTO id_dictionary (id)
+    SELECT account_id FROM position_by_account_asset
+    UNION SELECT asset_id FROM position_by_account_asset
+    ON CONFLICT (id) DO NOTHING;
+    ALTER TABLE position_by_account_asset
+        ADD COLUMN account_key integer, ADD COLUMN asset_key integer;
+    UPDATE position_by_account_asset
+    SET account_key = account.key, asset_key = asset.key
+    FROM id_dictionary AS account, id_dictionary AS asset
+    WHERE account.id = account_id AND asset.id = asset_id;
+    ALTER TABLE position_by_account_asset
+        DROP COLUMN account_id, DROP COLUMN asset_id;
+  END IF;
+END
+$$;
+CREATE INDEX IF NOT EXISTS tx_position_by_creator_index
+    ON tx_position_by_creator
+    USING btree
+    (creator_key, height, index ASC);
 CREATE INDEX IF NOT EXISTS position_by_account_asset_index
     ON position_by_account_asset
     USING btree
-    (account_id, asset_id, height, index ASC);
+    (account_key, asset_key, height, index ASC);
 CREATE TABLE IF NOT EXISTS setting(
     setting_key text,
     setting_value text,
     PRIMARY KEY (setting_key)
-);)";
+);
+CREATE TABLE IF NOT EXISTS top_block_info(
+    lock char(1) DEFAULT 'X' NOT NULL PRIMARY KEY,
+    height bigint NOT NULL,
+    hash varchar(128) NOT NULL,
+    CONSTRAINT single_row CHECK (lock = 'X')
+);
+CREATE TABLE IF NOT EXISTS wsv_restore_checkpoint(
+    height bigint NOT NULL,
+    hash varchar(128) NOT NULL
+);
+CREATE TABLE IF NOT EXISTS history_index_height(
+    lock char(1) DEFAULT 'X' NOT NULL PRIMARY KEY,
+    height bigint NOT NULL,
+    CONSTRAINT single_row CHECK (lock = 'X')
+);
+INSERT INTO history_index_height (lock, height)
+SELECT 'X', COALESCE((SELECT height FROM top_block_info), 0)
+ON CONFLICT (lock) DO NOTHING;
+-- the digest of the WSV is the sum modulo 2^128 of the 128-bit hashes of its
+-- rows, so it does not depend on the order of the rows and is updated by
+-- adding the hashes of the new rows and subtracting the ones of the old rows
+CREATE OR REPLACE FUNCTION iroha_wsv_digest_tables() RETURNS text[] AS $$
+  SELECT ARRAY['role', 'domain', 'signatory', 'account', 'account_detail',
+               'account_has_signatory', 'peer', 'asset', 'account_has_asset',
+               'role_has_permissions', 'account_has_roles',
+               'account_has_grantable_permissions', 'setting']
+$$ LANGUAGE sql IMMUTABLE;
+CREATE OR REPLACE FUNCTION iroha_wsv_digest_mod(value numeric) RETURNS numeric
+AS $$
+  SELECT mod(mod(value, 340282366920938463463374607431768211456)
+             + 340282366920938463463374607431768211456,
+             340282366920938463463374607431768211456)
+$$ LANGUAGE sql IMMUTABLE;
+CREATE OR REPLACE FUNCTION iroha_row_hash(row_text text) RETURNS numeric AS $$
+  SELECT (('x' || substr(h, 1, 16))::bit(64)::bigint::numeric
+          + 9223372036854775808) * 18446744073709551616
+         + ('x' || substr(h, 17, 16))::bit(64)::bigint::numeric
+         + 9223372036854775808
+  FROM (SELECT md5(row_text) AS h) AS row_md5
+$$ LANGUAGE sql IMMUTABLE;
+CREATE OR REPLACE FUNCTION iroha_wsv_digest_scan() RETURNS numeric AS $$
+DECLARE
+  table_name text;
+  table_digest numeric;
+  digest numeric := 0;
+BEGIN
+  FOREACH table_name IN ARRAY iroha_wsv_digest_tables() LOOP
+    EXECUTE format('SELECT COALESCE(sum(iroha_row_hash('
+                   '%L || row_to_json(t)::text)), 0) FROM %I t',
+                   table_name, table_name)
+    INTO table_digest;
+    digest := digest + table_digest;
+  END LOOP;
+  RETURN iroha_wsv_digest_mod(digest);
+END
+$$ LANGUAGE plpgsql;
+-- the changes are summed per transaction in separate rows, so the
+-- concurrent transactions do not wait for each other, and they are folded
+-- into the digest when the top block is written
+CREATE TABLE IF NOT EXISTS wsv_digest_delta(
+    txid bigint NOT NULL PRIMARY KEY,
+    delta numeric NOT NULL
+);
+CREATE TABLE IF NOT EXISTS wsv_digest(
+    lock char(1) DEFAULT 'X' NOT NULL PRIMARY KEY,
+    digest numeric NOT NULL,
+    CONSTRAINT single_row CHECK (lock = 'X')
+);
+CREATE TABLE IF NOT EXISTS wsv_digest_history(
+    height bigint NOT NULL PRIMARY KEY,
+    digest numeric NOT NULL
+);
+CREATE OR REPLACE FUNCTION iroha_wsv_row_changed() RETURNS trigger AS $$
+DECLARE
+  row_delta numeric := 0;
+BEGIN
+  IF TG_OP <> 'INSERT' THEN
+    row_delta := row_delta
+        - iroha_row_hash(TG_TABLE_NAME || row_to_json(OLD)::text);
+  END IF;
+  IF TG_OP <> 'DELETE' THEN
+    row_delta := row_delta
+        + iroha_row_hash(TG_TABLE_NAME || row_to_json(NEW)::text);
+  END IF;
+  INSERT INTO wsv_digest_delta (txid, delta)
+  VALUES (txid_current(), row_delta)
+  ON CONFLICT (txid) DO UPDATE
+  SET delta = wsv_digest_delta.delta + EXCLUDED.delta;
+  RETURN NULL;
+END
+$$ LANGUAGE plpgsql;
+CREATE OR REPLACE FUNCTION iroha_fold_wsv_digest(block_height bigint)
+RETURNS numeric AS $$
+DECLARE
+  folded numeric;
+BEGIN
+  WITH deltas AS (DELETE FROM wsv_digest_delta RETURNING delta)
+  INSERT INTO wsv_digest (lock, digest)
+  SELECT 'X', iroha_wsv_digest_mod(COALESCE(sum(delta), 0)) FROM deltas
+  ON CONFLICT (lock) DO UPDATE
+  SET digest = iroha_wsv_digest_mod(wsv_digest.digest + EXCLUDED.digest)
+  RETURNING digest INTO folded;
+  INSERT INTO wsv_digest_history (height, digest)
+  VALUES (block_height, folded)
+  ON CONFLICT (height) DO UPDATE SET digest = EXCLUDED.digest;
+  RETURN folded;
+END
+$$ LANGUAGE plpgsql;
+CREATE OR REPLACE FUNCTION iroha_top_block_changed() RETURNS trigger AS $$
+BEGIN
+  PERFORM iroha_fold_wsv_digest(NEW.height);
+  RETURN NULL;
+END
+$$ LANGUAGE plpgsql;
+DO $$
+DECLARE
+  table_name text;
+BEGIN
+  FOREACH table_name IN ARRAY iroha_wsv_digest_tables() LOOP
+    EXECUTE format('DROP TRIGGER IF EXISTS wsv_row_changed ON %I',
+                   table_name);
+    EXECUTE format('CREATE TRIGGER wsv_row_changed '
+                   'AFTER INSERT OR UPDATE OR DELETE ON %I '
+                   'FOR EACH ROW EXECUTE PROCEDURE iroha_wsv_row_changed()',
+                   table_name);
+  END LOOP;
+END
+$$;
+DROP TRIGGER IF EXISTS top_block_changed ON top_block_info;
+CREATE TRIGGER top_block_changed
+    AFTER INSERT OR UPDATE ON top_block_info
+    FOR EACH ROW EXECUTE PROCEDURE iroha_top_block_changed();
+-- the databases created before have the rows without the digest
+INSERT INTO wsv_digest (lock, digest)
+SELECT 'X', iroha_wsv_digest_scan()
+WHERE NOT EXISTS (SELECT 1 FROM wsv_digest);
+INSERT INTO wsv_digest_history (height, digest)
+SELECT top_block_info.height, wsv_digest.digest
+FROM top_block_info, wsv_digest
+ON CONFLICT (height) DO NOTHING;)";
 
   session << prepare_tables_sql;
 }
@@ -321,10 +740,12 @@ iroha::expected::Result<void, std::string> PgConnectionInit::resetWsv(
   try {
     static const std::string reset = R"(
       TRUNCATE TABLE account_has_signatory RESTART IDENTITY CASCADE;
+      TRUNCATE TABLE account_detail RESTART IDENTITY CASCADE;
       TRUNCATE TABLE account_has_asset RESTART IDENTITY CASCADE;
       TRUNCATE TABLE role_has_permissions RESTART IDENTITY CASCADE;
       TRUNCATE TABLE account_has_roles RESTART IDENTITY CASCADE;
       TRUNCATE TABLE account_has_grantable_permissions RESTART IDENTITY CASCADE;
+      TRUNCATE TABLE account_effective_permissions RESTART IDENTITY CASCADE;
       TRUNCATE TABLE account RESTART IDENTITY CASCADE;
       TRUNCATE TABLE asset RESTART IDENTITY CASCADE;
       TRUNCATE TABLE domain RESTART IDENTITY CASCADE;
@@ -335,7 +756,15 @@ iroha::expected::Result<void, std::string> PgConnectionInit::resetWsv(
       TRUNCATE TABLE tx_status_by_hash RESTART IDENTITY CASCADE;
       TRUNCATE TABLE tx_position_by_creator RESTART IDENTITY CASCADE;
       TRUNCATE TABLE position_by_account_asset RESTART IDENTITY CASCADE;
+      TRUNCATE TABLE id_dictionary RESTART IDENTITY CASCADE;
       TRUNCATE TABLE setting RESTART IDENTITY CASCADE;
+      TRUNCATE TABLE top_block_info RESTART IDENTITY CASCADE;
+      TRUNCATE TABLE wsv_restore_checkpoint RESTART IDENTITY CASCADE;
+      TRUNCATE TABLE history_index_height RESTART IDENTITY CASCADE;
+      TRUNCATE TABLE wsv_digest_delta RESTART IDENTITY CASCADE;
+      TRUNCATE TABLE wsv_digest RESTART IDENTITY CASCADE;
+      TRUNCATE TABLE wsv_digest_history RESTART IDENTITY CASCADE;
+      INSERT INTO history_index_height (lock, height) VALUES ('X', 0);
     )";
     sql << reset;
   } catch (std::exception &e) {
@@ -18,6 +18,7 @@
 #include "ametsuchi/impl/postgres_options.hpp"
 #include "ametsuchi/reconnection_strategy.hpp"
 #include "common/result.hpp"
+#include "interfaces/common_objects/types.hpp"
 #include "interfaces/permissions.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
@@ -33,12 +34,27 @@ namespace iroha {
                               std::string>
       initPostgresConnection(std::string &options_str, size_t pool_size);
 
+      /**
+       * Open the connections and prepare the working database
+       * @param reconnection_strategy_factory - reconnection strategies of the
+       * connections
+       * @param options - database options
+       * @param pool_size - number of connections of the commit lane
+       * @param log_manager - log manager of storage
+       * @param query_pool_size - number of own connections of the query lane,
+       * 0 to share the commit lane ones
+       * @param restore_pool_size - number of own connections of the restore
+       * lane, 0 to share the commit lane ones
+       * @return the connections or the error message
+       */
       static expected::Result<std::shared_ptr<PoolWrapper>, std::string>
       prepareConnectionPool(
           const ReconnectionStrategyFactory &reconnection_strategy_factory,
           const PostgresOptions &options,
           const int pool_size,
-          logger::LoggerManagerTreePtr log_manager);
+          logger::LoggerManagerTreePtr log_manager,
+          size_t query_pool_size = 0,
+          size_t restore_pool_size = 0);
 
       /**
        * Verify whether postgres supports prepared transactions
@@ -85,6 +101,11 @@ namespace iroha {
        */
       static expected::Result<void, std::string> resetPeers(soci::session &sql);
 
+      /// Blocks in a partition of the history tables, which are partitioned
+      /// by height in the new databases on PostgreSQL 11 and later
+      static constexpr shared_model::interface::types::HeightType
+          kHistoryPartitionBlocks = 1000000;
+
       /// Create tables in the given session. Left public for tests.
       static void prepareTables(soci::session &session);
 
@@ -95,6 +116,8 @@ namespace iroha {
        * @param pool_size - number of connections in pool
        * @param try_rollback - function which performs blocks rollback before
        * initialization
+       * @param prepare_database - whether to roll back and create the tables
+       * through the first connection
        * @param callback_factory - factory for reconnect callbacks
        * @param reconnection_strategy_factory - factory which creates strategies
        * for each connection
@@ -108,6 +131,7 @@ namespace iroha {
           soci::connection_pool &connection_pool,
           size_t pool_size,
           RollbackFunction try_rollback,
+          bool prepare_database,
           FailoverCallbackHolder &callback_factory,
           const ReconnectionStrategyFactory &reconnection_strategy_factory,
           const std::string &pg_reconnection_options,
@@ -20,6 +20,9 @@ namespace config_members {
   const char *Password = "password";
   const char *WorkingDbName = "working database";
   const char *MaintenanceDbName = "maintenance database";
+  const char *Replicas = "replicas";
+  const char *ReplicaMaxLag = "replica_max_lag";
+  const char *SlowStatementThreshold = "slow_statement_threshold";
   const char *MaxProposalSize = "max_proposal_size";
   const char *ProposalDelay = "proposal_delay";
   const char *VoteDelay = "vote_delay";
@@ -27,10 +30,86 @@ namespace config_members {
   const char *MstExpirationTime = "mst_expiration_time";
   const char *MaxRoundsDelay = "max_rounds_delay";
   const char *StaleStreamMaxRounds = "stale_stream_max_rounds";
+  const char *ProposalStreaming = "proposal_streaming";
+  const char *BatchFlushDelay = "batch_flush_delay";
+  const char *BatchFlushSize = "batch_flush_size";
+  const char *BatchValidationWorkers = "batch_validation_workers";
+  const char *AdaptiveProposalSize = "adaptive_proposal_size";
+  const char *MinSize = "min_size";
+  const char *TargetRoundTime = "target_round_time";
+  const char *YacCommitCertificates = "yac_commit_certificates";
+  const char *YacGossipFanout = "yac_gossip_fanout";
+  const char *PipelinedConsensus = "pipelined_consensus";
+  const char *AdaptiveVoteDelay = "adaptive_vote_delay";
+  const char *MinDelay = "min_delay";
+  const char *MaxDelay = "max_delay";
+  const char *MetricsPort = "metrics_port";
+  const char *SegmentedBlockStore = "segmented_block_store";
+  const char *BlockArchive = "block_archive";
+  const char *ArchivePath = "path";
+  const char *ArchiveLocalBlocks = "local_blocks";
+  const char *ArchiveCachedSegments = "cached_segments";
+  const char *BlockStoreCompressionLevel = "block_store_compression_level";
+  const char *BlockCacheSize = "block_cache_size";
+  const char *FastWsvRestore = "fast_wsv_restore";
+  const char *WsvCacheSize = "wsv_cache_size";
+  const char *AsyncHistoryIndex = "async_history_index";
+  const char *QueryCacheSize = "query_cache_size";
+  const char *DbPoolSize = "db_pool_size";
+  const char *DbQueryPoolSize = "db_query_pool_size";
+  const char *DbRestorePoolSize = "db_restore_pool_size";
+  const char *StatefulValidationWorkers = "stateful_validation_workers";
+  const char *BlockLoaderMaxStreams = "block_loader_max_streams";
+  const char *BlockLoaderBandwidth = "block_loader_bandwidth";
+  const char *ToriiAsyncStreams = "torii_async_streams";
+  const char *ToriiServerInstances = "torii_server_instances";
+  const char *StatusBusWorkers = "status_bus_workers";
+  const char *ToriiTxRateLimit = "torii_tx_rate_limit";
+  const char *ToriiAccountTxRateLimit = "torii_account_tx_rate_limit";
+  const char *ToriiMaxPendingTxs = "torii_max_pending_txs";
+  const char *MstJournalPath = "mst_journal_path";
+  const char *MstGossip = "mst_gossip";
+  const char *EmissionPeriodMs = "emission_period_ms";
+  const char *IdleEmissionPeriodMs = "idle_emission_period_ms";
+  const char *MinEmissionPeriodMs = "min_emission_period_ms";
+  const char *AmountPerOnce = "amount_per_once";
+  const char *MaxAmountPerOnce = "max_amount_per_once";
+  const char *BurstBatches = "burst_batches";
+  const char *MemoryBudget = "memory_budget";
+  const char *InterPeerClientThreads = "inter_peer_client_threads";
+  const char *InterPeerMaxCalls = "inter_peer_max_calls";
+  const char *TransactionsRoot = "transactions_root";
+  const char *PgBlockFlushSize = "pg_block_flush_size";
+  const char *Tracing = "tracing";
+  const char *SamplingRate = "sampling_rate";
+  const char *SpansPath = "spans_path";
+  const char *BlockExport = "block_export";
+  const char *ExportPath = "path";
+  const char *RowsPerFile = "rows_per_file";
+  const char *TrafficCapture = "traffic_capture";
+  const char *CapturePath = "path";
+  const char *CaptureMaxQueuedRecords = "max_queued_records";
+  const char *PipelineQueueSize = "pipeline_queue_size";
+  const char *ProposalHedgePercentile = "proposal_hedge_percentile";
+  const char *BlockSyncInterval = "block_sync_interval";
+  const char *PeerCompression = "peer_compression";
+  const char *CompressProposals = "proposals";
+  const char *CompressBlocks = "blocks";
+  const char *CompressBatches = "batches";
+  const char *CompressMinBytes = "min_bytes";
+  const char *CpuAffinity = "cpu_affinity";
+  const char *FairQueuing = "fair_queuing";
+  const char *FairQueuingGroups = "groups";
+  const char *FairQueuingName = "name";
+  const char *FairQueuingWeight = "weight";
+  const char *FairQueuingMembers = "members";
   const char *LogSection = "log";
   const char *LogLevel = "level";
   const char *LogPatternsSection = "patterns";
   const char *LogChildrenSection = "children";
+  const char *LogAsyncSection = "async";
+  const char *LogQueueSize = "queue_size";
+  const char *LogOverrunOldest = "overrun_oldest";
   const std::unordered_map<std::string, logger::LogLevel> LogLevels{
       {"trace", logger::LogLevel::kTrace},
       {"debug", logger::LogLevel::kDebug},
@@ -26,6 +26,9 @@ namespace config_members {
   extern const char *Password;
   extern const char *WorkingDbName;
   extern const char *MaintenanceDbName;
+  extern const char *Replicas;
+  extern const char *ReplicaMaxLag;
+  extern const char *SlowStatementThreshold;
   extern const char *MaxProposalSize;
   extern const char *ProposalDelay;
   extern const char *VoteDelay;
@@ -33,10 +36,86 @@ namespace config_members {
   extern const char *MstExpirationTime;
   extern const char *MaxRoundsDelay;
   extern const char *StaleStreamMaxRounds;
+  extern const char *ProposalStreaming;
+  extern const char *BatchFlushDelay;
+  extern const char *BatchFlushSize;
+  extern const char *BatchValidationWorkers;
+  extern const char *AdaptiveProposalSize;
+  extern const char *MinSize;
+  extern const char *TargetRoundTime;
+  extern const char *YacCommitCertificates;
+  extern const char *YacGossipFanout;
+  extern const char *PipelinedConsensus;
+  extern const char *AdaptiveVoteDelay;
+  extern const char *MinDelay;
+  extern const char *MaxDelay;
+  extern const char *MetricsPort;
+  extern const char *SegmentedBlockStore;
+  extern const char *BlockArchive;
+  extern const char *ArchivePath;
+  extern const char *ArchiveLocalBlocks;
+  extern const char *ArchiveCachedSegments;
+  extern const char *BlockStoreCompressionLevel;
+  extern const char *BlockCacheSize;
+  extern const char *FastWsvRestore;
+  extern const char *WsvCacheSize;
+  extern const char *AsyncHistoryIndex;
+  extern const char *QueryCacheSize;
+  extern const char *DbPoolSize;
+  extern const char *DbQueryPoolSize;
+  extern const char *DbRestorePoolSize;
+  extern const char *StatefulValidationWorkers;
+  extern const char *BlockLoaderMaxStreams;
+  extern const char *BlockLoaderBandwidth;
+  extern const char *ToriiAsyncStreams;
+  extern const char *ToriiServerInstances;
+  extern const char *StatusBusWorkers;
+  extern const char *ToriiTxRateLimit;
+  extern const char *ToriiAccountTxRateLimit;
+  extern const char *ToriiMaxPendingTxs;
+  extern const char *MstJournalPath;
+  extern const char *MstGossip;
+  extern const char *EmissionPeriodMs;
+  extern const char *IdleEmissionPeriodMs;
+  extern const char *MinEmissionPeriodMs;
+  extern const char *AmountPerOnce;
+  extern const char *MaxAmountPerOnce;
+  extern const char *BurstBatches;
+  extern const char *MemoryBudget;
+  extern const char *InterPeerClientThreads;
+  extern const char *InterPeerMaxCalls;
+  extern const char *TransactionsRoot;
+  extern const char *PgBlockFlushSize;
+  extern const char *Tracing;
+  extern const char *SamplingRate;
+  extern const char *SpansPath;
+  extern const char *BlockExport;
+  extern const char *ExportPath;
+  extern const char *RowsPerFile;
+  extern const char *TrafficCapture;
+  extern const char *CapturePath;
+  extern const char *CaptureMaxQueuedRecords;
+  extern const char *PipelineQueueSize;
+  extern const char *ProposalHedgePercentile;
+  extern const char *BlockSyncInterval;
+  extern const char *PeerCompression;
+  extern const char *CompressProposals;
+  extern const char *CompressBlocks;
+  extern const char *CompressBatches;
+  extern const char *CompressMinBytes;
+  extern const char *CpuAffinity;
+  extern const char *FairQueuing;
+  extern const char *FairQueuingGroups;
+  extern const char *FairQueuingName;
+  extern const char *FairQueuingWeight;
+  extern const char *FairQueuingMembers;
   extern const char *LogSection;
   extern const char *LogLevel;
   extern const char *LogPatternsSection;
   extern const char *LogChildrenSection;
+  extern const char *LogAsyncSection;
+  extern const char *LogQueueSize;
+  extern const char *LogOverrunOldest;
   extern const std::unordered_map<std::string, logger::LogLevel> LogLevels;
   extern const char *InitialPeers;
   extern const char *Address;
@@ -5,6 +5,7 @@
 
 #include "main/iroha_conf_loader.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <limits>
 #include <sstream>
@@ -269,6 +270,14 @@ inline void JsonDeserializerImpl::getVal<bool>(const std::string &path,
   dest = src.GetBool();
 }
 
+template <>
+inline void JsonDeserializerImpl::getVal<double>(const std::string &path,
+                                                 double &dest,
+                                                 const rapidjson::Value &src) {
+  assert_fatal(src.IsNumber(), path + " must be a number");
+  dest = src.GetDouble();
+}
+
 template <>
 inline void JsonDeserializerImpl::getVal<std::string>(
     const std::string &path, std::string &dest, const rapidjson::Value &src) {
@@ -310,6 +319,19 @@ inline void JsonDeserializerImpl::getVal<logger::LogPatterns>(
   }
 }
 
+template <>
+inline void JsonDeserializerImpl::getVal<logger::AsyncLogConfig>(
+    const std::string &path,
+    logger::AsyncLogConfig &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " must be a dictionary");
+  const auto obj = src.GetObject();
+  getValByKey(path, dest.queue_size, obj, config_members::LogQueueSize);
+  getValByKey(
+      path, dest.overrun_oldest, obj, config_members::LogOverrunOldest);
+  assert_fatal(dest.queue_size > 0, path + " queue_size must be positive");
+}
+
 template <>
 inline void
 JsonDeserializerImpl::getVal<std::unique_ptr<logger::LoggerManagerTree>>(
@@ -320,6 +342,11 @@ JsonDeserializerImpl::getVal<std::unique_ptr<logger::LoggerManagerTree>>(
   logger::LoggerConfig root_config{logger::kDefaultLogLevel,
                                    logger::LogPatterns{}};
   updateLoggerConfig(path, root_config, src.GetObject());
+  // the queue of the asynchronous logging is common for all of the loggers
+  tryGetValByKey(path,
+                 root_config.async,
+                 src.GetObject(),
+                 config_members::LogAsyncSection);
   dest = std::make_unique<logger::LoggerManagerTree>(
       std::make_shared<const logger::LoggerConfig>(std::move(root_config)));
   addChildrenLoggerConfigs(path, *dest, src.GetObject());
@@ -387,6 +414,197 @@ inline void JsonDeserializerImpl::getVal<IrohadConfig::InterPeerTls>(
   getValByKey(path, dest.my_tls_creds_path, obj, config_members::KeyPairPath);
 }
 
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::AdaptiveProposalSize>(
+    const std::string &path,
+    IrohadConfig::AdaptiveProposalSize &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " must be a dictionary");
+  const auto obj = src.GetObject();
+  getValByKey(path, dest.min_size, obj, config_members::MinSize);
+  getValByKey(
+      path, dest.target_round_time, obj, config_members::TargetRoundTime);
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::AdaptiveVoteDelay>(
+    const std::string &path,
+    IrohadConfig::AdaptiveVoteDelay &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " must be a dictionary");
+  const auto obj = src.GetObject();
+  getValByKey(path, dest.min_delay, obj, config_members::MinDelay);
+  getValByKey(path, dest.max_delay, obj, config_members::MaxDelay);
+  assert_fatal(dest.min_delay <= dest.max_delay,
+               path + " min_delay must not exceed max_delay");
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::Tracing>(
+    const std::string &path,
+    IrohadConfig::Tracing &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " must be a dictionary");
+  const auto obj = src.GetObject();
+  getValByKey(path, dest.sampling_rate, obj, config_members::SamplingRate);
+  getValByKey(path, dest.spans_path, obj, config_members::SpansPath);
+  assert_fatal(dest.sampling_rate >= 0. and dest.sampling_rate <= 1.,
+               path + " sampling_rate must be from 0 to 1");
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::BlockExport>(
+    const std::string &path,
+    IrohadConfig::BlockExport &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " must be a dictionary");
+  const auto obj = src.GetObject();
+  getValByKey(path, dest.path, obj, config_members::ExportPath);
+  getValByKey(path, dest.rows_per_file, obj, config_members::RowsPerFile);
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::MstGossip>(
+    const std::string &path,
+    IrohadConfig::MstGossip &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " must be a dictionary");
+  const auto obj = src.GetObject();
+  getValByKey(
+      path, dest.emission_period_ms, obj, config_members::EmissionPeriodMs);
+  getValByKey(path,
+              dest.idle_emission_period_ms,
+              obj,
+              config_members::IdleEmissionPeriodMs);
+  getValByKey(path,
+              dest.min_emission_period_ms,
+              obj,
+              config_members::MinEmissionPeriodMs);
+  getValByKey(path, dest.amount_per_once, obj, config_members::AmountPerOnce);
+  getValByKey(
+      path, dest.max_amount_per_once, obj, config_members::MaxAmountPerOnce);
+  getValByKey(path, dest.burst_batches, obj, config_members::BurstBatches);
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::TrafficCapture>(
+    const std::string &path,
+    IrohadConfig::TrafficCapture &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " must be a dictionary");
+  const auto obj = src.GetObject();
+  getValByKey(path, dest.path, obj, config_members::CapturePath);
+  getValByKey(path,
+              dest.max_queued_records,
+              obj,
+              config_members::CaptureMaxQueuedRecords);
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::BlockArchive>(
+    const std::string &path,
+    IrohadConfig::BlockArchive &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " must be a dictionary");
+  const auto obj = src.GetObject();
+  getValByKey(path, dest.path, obj, config_members::ArchivePath);
+  getValByKey(path, dest.local_blocks, obj, config_members::ArchiveLocalBlocks);
+  getValByKey(
+      path, dest.cached_segments, obj, config_members::ArchiveCachedSegments);
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::PeerCompression>(
+    const std::string &path,
+    IrohadConfig::PeerCompression &dest,
+    const rapidjson::Value &src) {
+  static const std::vector<std::string> kAlgorithms{"none", "gzip", "deflate"};
+  assert_fatal(src.IsObject(), path + " must be a dictionary");
+  const auto obj = src.GetObject();
+  auto get_algorithm = [&](boost::optional<std::string> &algorithm,
+                           const char *key) {
+    getValByKey(path, algorithm, obj, key);
+    assert_fatal(not algorithm
+                     or std::find(kAlgorithms.begin(),
+                                  kAlgorithms.end(),
+                                  *algorithm)
+                         != kAlgorithms.end(),
+                 sublevelPath(path, key) + " is not an algorithm, allowed are: "
+                     + boost::algorithm::join(kAlgorithms, ", "));
+  };
+  get_algorithm(dest.proposals, config_members::CompressProposals);
+  get_algorithm(dest.blocks, config_members::CompressBlocks);
+  get_algorithm(dest.batches, config_members::CompressBatches);
+  getValByKey(path, dest.min_bytes, obj, config_members::CompressMinBytes);
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::FairQueuingGroup>(
+    const std::string &path,
+    IrohadConfig::FairQueuingGroup &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " must be a dictionary");
+  const auto obj = src.GetObject();
+  getValByKey(path, dest.name, obj, config_members::FairQueuingName);
+  getValByKey(path, dest.weight, obj, config_members::FairQueuingWeight);
+  getValByKey(path, dest.members, obj, config_members::FairQueuingMembers);
+  assert_fatal(dest.weight > 0, path + " weight must be positive");
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::FairQueuing>(
+    const std::string &path,
+    IrohadConfig::FairQueuing &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " must be a dictionary");
+  const auto obj = src.GetObject();
+  getValByKey(path, dest.groups, obj, config_members::FairQueuingGroups);
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<iroha::ThreadPlacement>(
+    const std::string &path,
+    iroha::ThreadPlacement &dest,
+    const rapidjson::Value &src) {
+  static const std::vector<std::string> kSubsystems{
+      iroha::placement::kDefault,
+      iroha::placement::kTorii,
+      iroha::placement::kConsensus,
+      iroha::placement::kOrdering,
+      iroha::placement::kValidation,
+      iroha::placement::kStorage};
+  assert_fatal(src.IsObject(),
+               path + " must be a map from subsystem to list of CPUs");
+  for (const auto &entry : src.GetObject()) {
+    std::string subsystem;
+    std::string cpu_list;
+    getVal(sublevelPath(path, "(subsystem)"), subsystem, entry.name);
+    auto entry_path = sublevelPath(path, subsystem);
+    assert_fatal(std::find(kSubsystems.begin(), kSubsystems.end(), subsystem)
+                     != kSubsystems.end(),
+                 entry_path + " is not a subsystem, allowed are: "
+                     + boost::algorithm::join(kSubsystems, ", "));
+    getVal(entry_path, cpu_list, entry.value);
+    iroha::parseCpuList(cpu_list).match(
+        [&](auto &&cpus) { dest[subsystem] = std::move(cpus.value); },
+        [this, &entry_path](const auto &error) {
+          this->assert_fatal(false, entry_path + ": " + error.error);
+        });
+  }
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::DbReplica>(
+    const std::string &path,
+    IrohadConfig::DbReplica &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(),
+               path + " database replica config must be an object.");
+  const auto obj = src.GetObject();
+  getValByKey(path, dest.host, obj, config_members::Host);
+  getValByKey(path, dest.port, obj, config_members::Port);
+}
+
 template <>
 inline void JsonDeserializerImpl::getVal<IrohadConfig::DbConfig>(
     const std::string &path,
@@ -402,6 +620,12 @@ inline void JsonDeserializerImpl::getVal<IrohadConfig::DbConfig>(
   getValByKey(path, dest.working_dbname, obj, config_members::WorkingDbName);
   getValByKey(
       path, dest.maintenance_dbname, obj, config_members::MaintenanceDbName);
+  getValByKey(path, dest.replicas, obj, config_members::Replicas);
+  getValByKey(path, dest.replica_max_lag, obj, config_members::ReplicaMaxLag);
+  getValByKey(path,
+              dest.slow_statement_threshold,
+              obj,
+              config_members::SlowStatementThreshold);
 }
 
 template <>
@@ -430,6 +654,116 @@ inline void JsonDeserializerImpl::getVal<IrohadConfig>(
               dest.stale_stream_max_rounds,
               obj,
               config_members::StaleStreamMaxRounds);
+  getValByKey(
+      path, dest.proposal_streaming, obj, config_members::ProposalStreaming);
+  getValByKey(
+      path, dest.batch_flush_delay, obj, config_members::BatchFlushDelay);
+  getValByKey(path, dest.batch_flush_size, obj, config_members::BatchFlushSize);
+  getValByKey(path,
+              dest.batch_validation_workers,
+              obj,
+              config_members::BatchValidationWorkers);
+  getValByKey(path,
+              dest.adaptive_proposal_size,
+              obj,
+              config_members::AdaptiveProposalSize);
+  getValByKey(path,
+              dest.yac_commit_certificates,
+              obj,
+              config_members::YacCommitCertificates);
+  getValByKey(
+      path, dest.yac_gossip_fanout, obj, config_members::YacGossipFanout);
+  getValByKey(path,
+              dest.pipelined_consensus,
+              obj,
+              config_members::PipelinedConsensus);
+  getValByKey(path,
+              dest.adaptive_vote_delay,
+              obj,
+              config_members::AdaptiveVoteDelay);
+  getValByKey(path, dest.metrics_port, obj, config_members::MetricsPort);
+  getValByKey(path,
+              dest.segmented_block_store,
+              obj,
+              config_members::SegmentedBlockStore);
+  getValByKey(path, dest.block_archive, obj, config_members::BlockArchive);
+  getValByKey(path,
+              dest.block_store_compression_level,
+              obj,
+              config_members::BlockStoreCompressionLevel);
+  getValByKey(path, dest.block_cache_size, obj, config_members::BlockCacheSize);
+  getValByKey(path, dest.fast_wsv_restore, obj, config_members::FastWsvRestore);
+  getValByKey(path, dest.wsv_cache_size, obj, config_members::WsvCacheSize);
+  getValByKey(
+      path, dest.async_history_index, obj, config_members::AsyncHistoryIndex);
+  getValByKey(path, dest.query_cache_size, obj, config_members::QueryCacheSize);
+  getValByKey(path, dest.db_pool_size, obj, config_members::DbPoolSize);
+  getValByKey(
+      path, dest.db_query_pool_size, obj, config_members::DbQueryPoolSize);
+  getValByKey(
+      path, dest.db_restore_pool_size, obj, config_members::DbRestorePoolSize);
+  getValByKey(path,
+              dest.stateful_validation_workers,
+              obj,
+              config_members::StatefulValidationWorkers);
+  getValByKey(path,
+              dest.block_loader_max_streams,
+              obj,
+              config_members::BlockLoaderMaxStreams);
+  getValByKey(path,
+              dest.block_loader_bandwidth,
+              obj,
+              config_members::BlockLoaderBandwidth);
+  getValByKey(
+      path, dest.torii_async_streams, obj, config_members::ToriiAsyncStreams);
+  getValByKey(path,
+              dest.torii_server_instances,
+              obj,
+              config_members::ToriiServerInstances);
+  getValByKey(
+      path, dest.status_bus_workers, obj, config_members::StatusBusWorkers);
+  getValByKey(
+      path, dest.torii_tx_rate_limit, obj, config_members::ToriiTxRateLimit);
+  getValByKey(path,
+              dest.torii_account_tx_rate_limit,
+              obj,
+              config_members::ToriiAccountTxRateLimit);
+  getValByKey(path,
+              dest.torii_max_pending_txs,
+              obj,
+              config_members::ToriiMaxPendingTxs);
+  getValByKey(path, dest.mst_journal_path, obj, config_members::MstJournalPath);
+  getValByKey(path, dest.mst_gossip, obj, config_members::MstGossip);
+  getValByKey(path, dest.memory_budget, obj, config_members::MemoryBudget);
+  getValByKey(path,
+              dest.inter_peer_client_threads,
+              obj,
+              config_members::InterPeerClientThreads);
+  getValByKey(path,
+              dest.inter_peer_max_calls,
+              obj,
+              config_members::InterPeerMaxCalls);
+  getValByKey(
+      path, dest.transactions_root, obj, config_members::TransactionsRoot);
+  getValByKey(
+      path, dest.pg_block_flush_size, obj, config_members::PgBlockFlushSize);
+  getValByKey(path, dest.tracing, obj, config_members::Tracing);
+  getValByKey(path, dest.block_export, obj, config_members::BlockExport);
+  getValByKey(path, dest.traffic_capture, obj, config_members::TrafficCapture);
+  getValByKey(
+      path, dest.pipeline_queue_size, obj, config_members::PipelineQueueSize);
+  getValByKey(path,
+              dest.proposal_hedge_percentile,
+              obj,
+              config_members::ProposalHedgePercentile);
+  getValByKey(path,
+              dest.block_sync_interval,
+              obj,
+              config_members::BlockSyncInterval);
+  getValByKey(
+      path, dest.peer_compression, obj, config_members::PeerCompression);
+  getValByKey(path, dest.cpu_affinity, obj, config_members::CpuAffinity);
+  getValByKey(path, dest.fair_queuing, obj, config_members::FairQueuing);
   getValByKey(path, dest.logger_manager, obj, config_members::LogSection);
   getValByKey(path, dest.initial_peers, obj, config_members::InitialPeers);
 }
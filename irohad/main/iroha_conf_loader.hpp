@@ -9,12 +9,18 @@
 #include <string>
 #include <unordered_map>
 
+#include "common/thread_placement.hpp"
 #include "interfaces/common_objects/common_objects_factory.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "logger/logger_manager.hpp"
 #include "torii/tls_params.hpp"
 
 struct IrohadConfig {
+  struct DbReplica {
+    std::string host;
+    uint16_t port;
+  };
+
   struct DbConfig {
     std::string host;
     uint16_t port;
@@ -22,12 +28,78 @@ struct IrohadConfig {
     std::string password;
     std::string working_dbname;
     std::string maintenance_dbname;
+    boost::optional<std::vector<DbReplica>> replicas;
+    boost::optional<uint64_t> replica_max_lag;
+    boost::optional<uint32_t> slow_statement_threshold;
   };
 
   struct InterPeerTls {
     boost::optional<std::string> my_tls_creds_path;
   };
 
+  struct AdaptiveProposalSize {
+    uint32_t min_size;
+    uint32_t target_round_time;
+  };
+
+  struct AdaptiveVoteDelay {
+    uint32_t min_delay;
+    uint32_t max_delay;
+  };
+
+  struct Tracing {
+    double sampling_rate;
+    std::string spans_path;
+  };
+
+  struct BlockExport {
+    std::string path;
+    boost::optional<uint32_t> rows_per_file;
+  };
+
+  /// bounds of the adaptive gossip of the multisignature transactions
+  struct MstGossip {
+    boost::optional<uint32_t> emission_period_ms;
+    boost::optional<uint32_t> idle_emission_period_ms;
+    boost::optional<uint32_t> min_emission_period_ms;
+    boost::optional<uint32_t> amount_per_once;
+    boost::optional<uint32_t> max_amount_per_once;
+    boost::optional<uint32_t> burst_batches;
+  };
+
+  /// capture of the traffic of the peer for the offline replay
+  struct TrafficCapture {
+    std::string path;
+    boost::optional<uint32_t> max_queued_records;
+  };
+
+  /// offload of the old segments of the segmented block store
+  struct BlockArchive {
+    std::string path;
+    uint32_t local_blocks;
+    boost::optional<uint32_t> cached_segments;
+  };
+
+  /// compression algorithms of the messages between the peers by service
+  struct PeerCompression {
+    boost::optional<std::string> proposals;
+    boost::optional<std::string> blocks;
+    boost::optional<std::string> batches;
+    boost::optional<uint32_t> min_bytes;
+  };
+
+  /// group of the accounts sharing a queue of the fair queuing
+  struct FairQueuingGroup {
+    std::string name;
+    uint32_t weight;
+    std::vector<std::string> members;
+  };
+
+  /// fair queuing of the batches by their creators in the proposals
+  struct FairQueuing {
+    boost::optional<std::vector<FairQueuingGroup>> groups;
+  };
+
   // TODO: block_store_path is now optional, change docs IR-576
   // luckychess 29.06.2019
   boost::optional<std::string> block_store_path;
@@ -46,6 +118,52 @@ struct IrohadConfig {
   boost::optional<uint32_t> mst_expiration_time;
   boost::optional<uint32_t> max_round_delay_ms;
   boost::optional<uint32_t> stale_stream_max_rounds;
+  boost::optional<bool> proposal_streaming;
+  boost::optional<uint32_t> batch_flush_delay;
+  boost::optional<uint32_t> batch_flush_size;
+  boost::optional<uint32_t> batch_validation_workers;
+  boost::optional<AdaptiveProposalSize> adaptive_proposal_size;
+  boost::optional<bool> yac_commit_certificates;
+  boost::optional<uint32_t> yac_gossip_fanout;
+  boost::optional<bool> pipelined_consensus;
+  boost::optional<AdaptiveVoteDelay> adaptive_vote_delay;
+  boost::optional<uint16_t> metrics_port;
+  boost::optional<bool> segmented_block_store;
+  boost::optional<BlockArchive> block_archive;
+  boost::optional<int32_t> block_store_compression_level;
+  boost::optional<uint64_t> block_cache_size;
+  boost::optional<bool> fast_wsv_restore;
+  boost::optional<uint64_t> wsv_cache_size;
+  boost::optional<bool> async_history_index;
+  boost::optional<uint64_t> query_cache_size;
+  boost::optional<uint64_t> db_pool_size;
+  boost::optional<uint64_t> db_query_pool_size;
+  boost::optional<uint64_t> db_restore_pool_size;
+  boost::optional<uint64_t> stateful_validation_workers;
+  boost::optional<size_t> block_loader_max_streams;
+  boost::optional<size_t> block_loader_bandwidth;
+  boost::optional<bool> torii_async_streams;
+  boost::optional<uint32_t> torii_server_instances;
+  boost::optional<uint64_t> status_bus_workers;
+  boost::optional<uint64_t> torii_tx_rate_limit;
+  boost::optional<uint64_t> torii_account_tx_rate_limit;
+  boost::optional<uint64_t> torii_max_pending_txs;
+  boost::optional<std::string> mst_journal_path;
+  boost::optional<MstGossip> mst_gossip;
+  boost::optional<uint64_t> memory_budget;
+  boost::optional<uint32_t> inter_peer_client_threads;
+  boost::optional<uint32_t> inter_peer_max_calls;
+  boost::optional<bool> transactions_root;
+  boost::optional<uint32_t> pg_block_flush_size;
+  boost::optional<Tracing> tracing;
+  boost::optional<BlockExport> block_export;
+  boost::optional<TrafficCapture> traffic_capture;
+  boost::optional<uint32_t> pipeline_queue_size;
+  boost::optional<uint32_t> proposal_hedge_percentile;
+  boost::optional<uint32_t> block_sync_interval;
+  boost::optional<PeerCompression> peer_compression;
+  boost::optional<FairQueuing> fair_queuing;
+  boost::optional<iroha::ThreadPlacement> cpu_affinity;
   boost::optional<logger::LoggerManagerTreePtr> logger_manager;
   boost::optional<shared_model::interface::types::PeerList> initial_peers;
 };
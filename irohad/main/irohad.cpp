@@ -3,17 +3,21 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <atomic>
 #include <csignal>
 #include <fstream>
+#include <future>
 #include <thread>
 
 #include <gflags/gflags.h>
 #include <grpc++/grpc++.h>
+#include <boost/filesystem.hpp>
 #include "ametsuchi/storage.hpp"
 #include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
 #include "common/bind.hpp"
 #include "common/irohad_version.hpp"
 #include "common/result.hpp"
+#include "common/thread_placement.hpp"
 #include "crypto/keys_manager_impl.hpp"
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
@@ -22,6 +26,9 @@
 #include "main/iroha_conf_literals.hpp"
 #include "main/iroha_conf_loader.hpp"
 #include "main/raw_block_loader.hpp"
+#include "maintenance/block_exporter.hpp"
+#include "maintenance/otlp_json_file_exporter.hpp"
+#include "maintenance/traffic_capture.hpp"
 #include "validators/field_validator.hpp"
 
 static const std::string kListenIp = "0.0.0.0";
@@ -29,7 +36,48 @@ static const std::string kLogSettingsFromConfigFile = "config_file";
 static const uint32_t kMstExpirationTimeDefault = 1440;
 static const uint32_t kMaxRoundsDelayDefault = 3000;
 static const uint32_t kStaleStreamMaxRoundsDefault = 2;
+static const bool kProposalStreamingDefault = false;
+static const uint32_t kBatchFlushDelayDefault = 0;
+static const uint32_t kBatchFlushSizeDefault = 1024 * 1024;
+static const uint32_t kBatchValidationWorkersDefault = 1;
+static const bool kYacCommitCertificatesDefault = false;
+static const uint32_t kYacGossipFanoutDefault = 0;
+static const bool kPipelinedConsensusDefault = false;
+static const bool kSegmentedBlockStoreDefault = false;
+static const size_t kBlockCacheSizeDefault = 32 * 1024 * 1024;
+static const bool kFastWsvRestoreDefault = false;
+static const size_t kWsvCacheSizeDefault = 10000;
+static const bool kAsyncHistoryIndexDefault = false;
+static const size_t kQueryCacheSizeDefault = 1000;
+static const size_t kDbPoolSizeDefault = 10;
+static const size_t kDbQueryPoolSizeDefault = 4;
+static const size_t kDbRestorePoolSizeDefault = 2;
+static const size_t kStatefulValidationWorkersDefault = 0;
+static const size_t kBlockLoaderMaxStreamsDefault = 4;
+static const size_t kBlockLoaderBandwidthDefault = 0;
+static const bool kToriiAsyncStreamsDefault = false;
+static const uint32_t kToriiServerInstancesDefault = 1;
+static const size_t kStatusBusWorkersDefault = 1;
+static const size_t kToriiTxRateLimitDefault = 0;
+static const size_t kToriiAccountTxRateLimitDefault = 0;
+static const size_t kToriiMaxPendingTxsDefault = 0;
+static const std::string kMstJournalPathDefault = "";
+static const size_t kMemoryBudgetDefault = 0;
+static const size_t kInterPeerClientThreadsDefault = 1;
+static const size_t kInterPeerMaxCallsDefault = 0;
+static const bool kTransactionsRootDefault = false;
+static const size_t kPgBlockFlushSizeDefault = 64;
+static const size_t kBlockExportRowsPerFileDefault = 1000000;
+static const size_t kTrafficCaptureMaxQueuedDefault = 10000;
+static const uint32_t kMstGossipIdleEmissionPeriodMsDefault = 20000;
+static const uint32_t kMstGossipMinEmissionPeriodMsDefault = 1000;
+static const uint32_t kMstGossipMaxAmountPerOnceDefault = 4;
+static const size_t kPipelineQueueSizeDefault = 0;
+static const size_t kProposalHedgePercentileDefault = 0;
+static const size_t kBlockSyncIntervalDefault = 1;
 static const std::string kDefaultWorkingDatabaseName{"iroha_default"};
+/// period of checking for the requests to reload the configuration
+static const std::chrono::milliseconds kReloadCheckPeriod{500};
 
 /**
  * Gflag validator.
@@ -83,6 +131,12 @@ DEFINE_validator(keypair_name, &validate_keypair_name);
  */
 DEFINE_bool(overwrite_ledger, false, "Overwrite ledger data if existing");
 
+/**
+ * Creating boolean flag for following the chain of the ledger peers without
+ * taking part in the consensus
+ */
+DEFINE_bool(observer, false, "Follow the ledger without voting for blocks");
+
 static bool validateVerbosity(const char *flagname, const std::string &val) {
   if (val == kLogSettingsFromConfigFile) {
     return true;
@@ -105,6 +159,7 @@ DEFINE_string(verbosity, kLogSettingsFromConfigFile, "Log verbosity");
 DEFINE_validator(verbosity, &validateVerbosity);
 
 std::promise<void> exit_requested;
+std::atomic<bool> reload_requested{false};
 
 logger::LoggerManagerTreePtr getDefaultLogManager() {
   return std::make_shared<logger::LoggerManagerTree>(logger::LoggerConfig{
@@ -119,6 +174,37 @@ getCommonObjectsFactory() {
       shared_model::validation::FieldValidator>>(validators_config);
 }
 
+/**
+ * Read the configuration file again and pass its tunables to the daemon,
+ * the rest of the configuration requires a restart
+ */
+void reloadTunables(Irohad &irohad, const logger::LoggerPtr &log) {
+  IrohadConfig config;
+  try {
+    config = parse_iroha_config(FLAGS_config, getCommonObjectsFactory());
+  } catch (const std::exception &e) {
+    log->error("Failed to reload the configuration, keeping the current: {}",
+               e.what());
+    return;
+  }
+  logger::LoggerManagerTreePtr log_levels;
+  if (FLAGS_verbosity == kLogSettingsFromConfigFile) {
+    log_levels = config.logger_manager.value_or(getDefaultLogManager())
+                     ->getChild("Irohad");
+  }
+  irohad.reload(Irohad::Tunables{
+      config.max_proposal_size,
+      std::chrono::milliseconds(config.proposal_delay),
+      std::chrono::milliseconds(config.vote_delay),
+      std::chrono::minutes(
+          config.mst_expiration_time.value_or(kMstExpirationTimeDefault)),
+      config.block_cache_size.value_or(kBlockCacheSizeDefault),
+      config.wsv_cache_size.value_or(kWsvCacheSizeDefault),
+      config.query_cache_size.value_or(kQueryCacheSizeDefault),
+      std::move(log_levels)});
+  log->info("Configuration reloaded, the tunables apply from the next round");
+}
+
 int main(int argc, char *argv[]) {
   gflags::SetVersionString(iroha::kGitPrettyVersion);
 
@@ -165,6 +251,94 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
+  if (config.cpu_affinity) {
+    // the threads are placed when they are named, the other threads inherit
+    // the CPUs of the main thread
+    iroha::configureThreadPlacement(*config.cpu_affinity);
+    for (const auto &subsystem : *config.cpu_affinity) {
+      log->info("Placing the {} threads on the CPUs {}",
+                subsystem.first,
+                iroha::formatCpuList(subsystem.second));
+    }
+    auto default_cpus = config.cpu_affinity->find(iroha::placement::kDefault);
+    if (default_cpus != config.cpu_affinity->end()
+        and not iroha::bindCurrentThread(default_cpus->second)) {
+      log->warn("Failed to bind the main thread to the CPUs {}",
+                iroha::formatCpuList(default_cpus->second));
+    }
+  }
+
+  if (config.tracing and config.tracing->sampling_rate > 0.) {
+    auto exporter = std::make_shared<iroha::tracing::OtlpJsonFileExporter>(
+        config.tracing->spans_path, "irohad");
+    if (not exporter->isOpen()) {
+      log->critical("Failed to open the spans file {}",
+                    config.tracing->spans_path);
+      return EXIT_FAILURE;
+    }
+    iroha::tracing::setTracer(std::make_shared<iroha::tracing::Tracer>(
+        config.tracing->sampling_rate, std::move(exporter)));
+    log->info("Tracing {} of the transactions to {}",
+              config.tracing->sampling_rate,
+              config.tracing->spans_path);
+  }
+
+  std::shared_ptr<iroha::maintenance::BlockExporter> block_exporter;
+  if (config.block_export) {
+    boost::system::error_code err;
+    boost::filesystem::create_directories(config.block_export->path, err);
+    if (err) {
+      log->critical("Failed to create the block export directory {}: {}",
+                    config.block_export->path,
+                    err.message());
+      return EXIT_FAILURE;
+    }
+    block_exporter = std::make_shared<iroha::maintenance::BlockExporter>(
+        config.block_export->path,
+        config.block_export->rows_per_file.value_or(
+            kBlockExportRowsPerFileDefault),
+        log_manager->getChild("BlockExporter")->getLogger());
+    log->info("Exporting the committed blocks to {}",
+              config.block_export->path);
+  }
+
+  std::shared_ptr<iroha::maintenance::TrafficCapture> traffic_capture;
+  if (config.traffic_capture) {
+    auto capture = iroha::maintenance::TrafficCapture::create(
+        config.traffic_capture->path,
+        config.traffic_capture->max_queued_records.value_or(
+            kTrafficCaptureMaxQueuedDefault),
+        log_manager->getChild("TrafficCapture")->getLogger());
+    if (auto e = iroha::expected::resultToOptionalError(capture)) {
+      log->critical("{}", *e);
+      return EXIT_FAILURE;
+    }
+    traffic_capture = iroha::expected::resultToOptionalValue(capture).value();
+    log->info("Capturing the traffic to {}", config.traffic_capture->path);
+  }
+
+  iroha::GossipPropagationStrategyParams mst_gossip_params;
+  {
+    auto mst_gossip = config.mst_gossip.value_or(IrohadConfig::MstGossip{});
+    if (mst_gossip.emission_period_ms) {
+      mst_gossip_params.emission_period =
+          std::chrono::milliseconds(*mst_gossip.emission_period_ms);
+    }
+    mst_gossip_params.amount_per_once =
+        mst_gossip.amount_per_once.value_or(mst_gossip_params.amount_per_once);
+    mst_gossip_params.idle_emission_period =
+        std::chrono::milliseconds(mst_gossip.idle_emission_period_ms.value_or(
+            kMstGossipIdleEmissionPeriodMsDefault));
+    mst_gossip_params.min_emission_period =
+        std::chrono::milliseconds(mst_gossip.min_emission_period_ms.value_or(
+            kMstGossipMinEmissionPeriodMsDefault));
+    mst_gossip_params.max_amount_per_once =
+        mst_gossip.max_amount_per_once.value_or(
+            kMstGossipMaxAmountPerOnceDefault);
+    mst_gossip_params.burst_batches =
+        mst_gossip.burst_batches.value_or(mst_gossip_params.burst_batches);
+  }
+
   // Reading public and private key files
   iroha::KeysManagerImpl keysManager(
       FLAGS_keypair_name, log_manager->getChild("KeysManager")->getLogger());
@@ -178,6 +352,12 @@ int main(int argc, char *argv[]) {
 
   std::unique_ptr<iroha::ametsuchi::PostgresOptions> pg_opt;
   if (config.database_config) {
+    std::vector<iroha::ametsuchi::PostgresOptions::Replica> replicas;
+    for (const auto &replica :
+         config.database_config->replicas.value_or(
+             std::vector<IrohadConfig::DbReplica>{})) {
+      replicas.push_back({replica.host, replica.port});
+    }
     pg_opt = std::make_unique<iroha::ametsuchi::PostgresOptions>(
         config.database_config->host,
         config.database_config->port,
@@ -185,7 +365,11 @@ int main(int argc, char *argv[]) {
         config.database_config->password,
         config.database_config->working_dbname,
         config.database_config->maintenance_dbname,
-        log);
+        log,
+        std::move(replicas),
+        config.database_config->replica_max_lag.value_or(0),
+        std::chrono::milliseconds(
+            config.database_config->slow_statement_threshold.value_or(0)));
   } else if (config.pg_opt) {
     log->warn("Using deprecated database connection string!");
     pg_opt = std::make_unique<iroha::ametsuchi::PostgresOptions>(
@@ -195,6 +379,22 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
+  // the genesis block is parsed while the storage is initialized
+  std::future<boost::optional<std::shared_ptr<shared_model::interface::Block>>>
+      genesis_block;
+  if (not FLAGS_genesis_block.empty()) {
+    genesis_block = std::async(std::launch::async, [&log_manager] {
+      iroha::main::BlockLoader loader(
+          log_manager->getChild("GenesisBlockLoader")->getLogger());
+      auto file = loader.loadFile(FLAGS_genesis_block);
+      if (not file) {
+        return boost::optional<
+            std::shared_ptr<shared_model::interface::Block>>{};
+      }
+      return loader.parseBlock(file.value());
+    });
+  }
+
   // Configuring iroha daemon
   Irohad irohad(
       config.block_store_path,
@@ -212,10 +412,59 @@ int main(int argc, char *argv[]) {
       std::chrono::milliseconds(
           config.max_round_delay_ms.value_or(kMaxRoundsDelayDefault)),
       config.stale_stream_max_rounds.value_or(kStaleStreamMaxRoundsDefault),
+      config.proposal_streaming.value_or(kProposalStreamingDefault),
+      std::chrono::milliseconds(
+          config.batch_flush_delay.value_or(kBatchFlushDelayDefault)),
+      config.batch_flush_size.value_or(kBatchFlushSizeDefault),
+      config.batch_validation_workers.value_or(kBatchValidationWorkersDefault),
+      config.adaptive_proposal_size,
+      config.yac_commit_certificates.value_or(kYacCommitCertificatesDefault),
+      config.yac_gossip_fanout.value_or(kYacGossipFanoutDefault),
+      config.pipelined_consensus.value_or(kPipelinedConsensusDefault),
+      config.adaptive_vote_delay,
+      config.metrics_port,
+      config.segmented_block_store.value_or(kSegmentedBlockStoreDefault),
+      config.block_store_compression_level,
+      config.block_cache_size.value_or(kBlockCacheSizeDefault),
+      config.fast_wsv_restore.value_or(kFastWsvRestoreDefault),
+      config.wsv_cache_size.value_or(kWsvCacheSizeDefault),
+      config.async_history_index.value_or(kAsyncHistoryIndexDefault),
+      config.query_cache_size.value_or(kQueryCacheSizeDefault),
+      config.db_pool_size.value_or(kDbPoolSizeDefault),
+      config.db_query_pool_size.value_or(kDbQueryPoolSizeDefault),
+      config.db_restore_pool_size.value_or(kDbRestorePoolSizeDefault),
+      config.stateful_validation_workers.value_or(
+          kStatefulValidationWorkersDefault),
+      config.block_loader_max_streams.value_or(
+          kBlockLoaderMaxStreamsDefault),
+      config.block_loader_bandwidth.value_or(kBlockLoaderBandwidthDefault),
+      config.torii_async_streams.value_or(kToriiAsyncStreamsDefault),
+      config.status_bus_workers.value_or(kStatusBusWorkersDefault),
+      config.torii_tx_rate_limit.value_or(kToriiTxRateLimitDefault),
+      config.torii_account_tx_rate_limit.value_or(
+          kToriiAccountTxRateLimitDefault),
+      config.torii_max_pending_txs.value_or(kToriiMaxPendingTxsDefault),
+      config.mst_journal_path.value_or(kMstJournalPathDefault),
+      config.memory_budget.value_or(kMemoryBudgetDefault),
+      config.inter_peer_client_threads.value_or(
+          kInterPeerClientThreadsDefault),
+      config.inter_peer_max_calls.value_or(kInterPeerMaxCallsDefault),
+      config.transactions_root.value_or(kTransactionsRootDefault),
+      config.pg_block_flush_size.value_or(kPgBlockFlushSizeDefault),
+      std::move(block_exporter),
+      config.pipeline_queue_size.value_or(kPipelineQueueSizeDefault),
+      config.proposal_hedge_percentile.value_or(
+          kProposalHedgePercentileDefault),
+      config.block_sync_interval.value_or(kBlockSyncIntervalDefault),
+      config.peer_compression,
+      config.fair_queuing,
+      config.block_archive,
+      config.torii_server_instances.value_or(kToriiServerInstancesDefault),
+      FLAGS_observer,
+      std::move(traffic_capture),
       std::move(config.initial_peers),
       log_manager->getChild("Irohad"),
-      boost::make_optional(config.mst_support,
-                           iroha::GossipPropagationStrategyParams{}),
+      boost::make_optional(config.mst_support, mst_gossip_params),
       config.torii_tls_params);
 
   // Check if iroha daemon storage was successfully initialized
@@ -258,10 +507,7 @@ int main(int argc, char *argv[]) {
           "Passed genesis block will be ignored without --overwrite_ledger "
           "flag. Restoring existing state.");
     } else {
-      iroha::main::BlockLoader loader(
-          log_manager->getChild("GenesisBlockLoader")->getLogger());
-      auto file = loader.loadFile(FLAGS_genesis_block);
-      auto block = loader.parseBlock(file.value());
+      auto block = genesis_block.get();
 
       if (not block) {
         log->error("Failed to parse genesis block.");
@@ -308,7 +554,7 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
   const bool blocks_exist{iroha::expected::hasValue(
-      block_query->getBlock(block_query->getTopBlockHeight()))};
+      block_query->getBlockHeader(block_query->getTopBlockHeight()))};
   block_query.reset();
 
   if (not blocks_exist) {
@@ -335,6 +581,9 @@ int main(int argc, char *argv[]) {
 #ifdef SIGQUIT
   std::signal(SIGQUIT, handler);
 #endif
+#ifdef SIGHUP
+  std::signal(SIGHUP, [](int) { reload_requested = true; });
+#endif
 
   // runs iroha
   log->info("Running iroha");
@@ -344,7 +593,13 @@ int main(int argc, char *argv[]) {
     log->critical("Irohad startup failed: {}", error->error);
     return EXIT_FAILURE;
   }
-  exit_requested.get_future().wait();
+  auto exit_future = exit_requested.get_future();
+  while (exit_future.wait_for(kReloadCheckPeriod)
+         != std::future_status::ready) {
+    if (reload_requested.exchange(false)) {
+      reloadTunables(irohad, log);
+    }
+  }
 
   // We do not care about shutting down grpc servers
   // They do all necessary work in their destructors
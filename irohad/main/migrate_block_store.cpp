@@ -0,0 +1,101 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gflags/gflags.h>
+#include "ametsuchi/impl/block_compressor.hpp"
+#include "ametsuchi/impl/block_file_format.hpp"
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "ametsuchi/impl/segment_file/segment_file.hpp"
+#include "common/bind.hpp"
+#include "common/byteutils.hpp"
+#include "logger/logger.hpp"
+#include "logger/logger_manager.hpp"
+
+/**
+ * Gflag validator.
+ * Path is considered to be valid if it is not empty.
+ * @param flag_name - flag name
+ * @param path - path to the block store
+ * @return true if argument is valid
+ */
+bool validate_path(const char *flag_name, std::string const &path) {
+  return not path.empty();
+}
+
+/**
+ * Creating input argument for the block store of a file per block.
+ */
+DEFINE_string(source, "", "Specify the block store of a file per block");
+DEFINE_validator(source, &validate_path);
+
+/**
+ * Creating input argument for the segmented block store.
+ */
+DEFINE_string(destination, "", "Specify the empty segmented block store");
+DEFINE_validator(destination, &validate_path);
+
+/**
+ * Convert the block from the JSON, binary or compressed file of the flat file
+ * block store to the protobuf binary form of the segmented block store
+ */
+boost::optional<iroha::ametsuchi::KeyValueStorage::Bytes> convertBlock(
+    const iroha::ametsuchi::KeyValueStorage::Bytes &block_file,
+    const iroha::ametsuchi::BlockCompressor &compressor) {
+  return iroha::ametsuchi::block_file_format::toSerializedBlock(block_file,
+                                                                &compressor)
+      | [](const auto &block) {
+          return boost::make_optional(iroha::stringToBytes(block));
+        };
+}
+
+/**
+ * Copies the blocks of the flat file block store to the segmented block store
+ * which is used when segmented_block_store is enabled in the configuration.
+ * The source store is left intact.
+ */
+int main(int argc, char *argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+  auto log_manager =
+      std::make_shared<logger::LoggerManagerTree>(logger::LoggerConfig{
+          logger::LogLevel::kInfo, logger::getDefaultLogPatterns()});
+  auto log = log_manager->getChild("Migration")->getLogger();
+
+  auto source = iroha::ametsuchi::FlatFile::create(
+      FLAGS_source, log_manager->getChild("FlatFile")->getLogger());
+  if (not source) {
+    log->error("Cannot open the source block store {}", FLAGS_source);
+    return EXIT_FAILURE;
+  }
+  auto compressor = iroha::ametsuchi::BlockCompressor::create(
+      FLAGS_source,
+      boost::none,
+      log_manager->getChild("BlockCompressor")->getLogger());
+  if (not compressor) {
+    log->error("Cannot open the dictionaries of {}", FLAGS_source);
+    return EXIT_FAILURE;
+  }
+  auto destination = iroha::ametsuchi::SegmentFile::create(
+      FLAGS_destination, log_manager->getChild("SegmentFile")->getLogger());
+  if (not destination) {
+    log->error("Cannot open the destination block store {}",
+               FLAGS_destination);
+    return EXIT_FAILURE;
+  }
+  if ((*destination)->size() != 0) {
+    log->error("The destination block store {} is not empty",
+               FLAGS_destination);
+    return EXIT_FAILURE;
+  }
+
+  auto convert = [&compressor](const auto &block_file) {
+    return convertBlock(block_file, **compressor);
+  };
+  if (not iroha::ametsuchi::migrateFlatFile(
+          **source, **destination, convert, log)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
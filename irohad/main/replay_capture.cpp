@@ -0,0 +1,354 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <chrono>
+#include <iostream>
+
+#include <boost/range/size.hpp>
+#include <gflags/gflags.h>
+#include "ametsuchi/impl/in_memory_block_storage_factory.hpp"
+#include "ametsuchi/impl/k_times_reconnection_strategy.hpp"
+#include "ametsuchi/impl/postgres_options.hpp"
+#include "ametsuchi/impl/storage_impl.hpp"
+#include "ametsuchi/mutable_storage.hpp"
+#include "backend/protobuf/block.hpp"
+#include "backend/protobuf/proposal.hpp"
+#include "backend/protobuf/proto_block_factory.hpp"
+#include "backend/protobuf/proto_permission_to_string.hpp"
+#include "backend/protobuf/proto_proposal_factory.hpp"
+#include "backend/protobuf/proto_query_response_factory.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "cryptography/crypto_provider/crypto_model_signer.hpp"
+#include "logger/logger.hpp"
+#include "logger/logger_manager.hpp"
+#include "main/impl/pg_connection_init.hpp"
+#include "maintenance/capture_reader.hpp"
+#include "simulator/impl/simulator.hpp"
+#include "validation/impl/stateful_validator_impl.hpp"
+#include "validators/default_validator.hpp"
+#include "validators/protobuf/proto_block_validator.hpp"
+
+/**
+ * Gflag validator.
+ * Argument is considered to be valid if it is not empty.
+ * @param flag_name - flag name
+ * @param value - value of the flag
+ * @return true if argument is valid
+ */
+bool validate_not_empty(const char *flag_name, std::string const &value) {
+  return not value.empty();
+}
+
+DEFINE_string(capture, "", "Specify the capture file of the traffic");
+DEFINE_validator(capture, &validate_not_empty);
+
+DEFINE_string(pg_opt,
+              "",
+              "Specify the PostgreSQL connection options, e.g. "
+              "\"host=localhost port=5432 user=postgres password=postgres\"");
+DEFINE_validator(pg_opt, &validate_not_empty);
+
+DEFINE_string(dbname,
+              "iroha_replay",
+              "Specify the working database, which is dropped before and "
+              "after the replay");
+
+DEFINE_uint64(max_proposal_size,
+              10000,
+              "Specify the max number of the transactions in a proposal");
+
+namespace {
+  using Clock = std::chrono::steady_clock;
+
+  /// connections of the command executors of the validation and the commit
+  /// and of the storage itself
+  const int kPoolSize = 10;
+
+  /**
+   * Proposals come from the capture only, the ordering gate of the
+   * simulator has none
+   */
+  class ReplayOrderingGate : public iroha::network::OrderingGate {
+   public:
+    void propagateBatch(
+        std::shared_ptr<shared_model::interface::TransactionBatch>) override {
+    }
+
+    rxcpp::observable<iroha::network::OrderingEvent> onProposal() override {
+      return rxcpp::observable<>::never<iroha::network::OrderingEvent>();
+    }
+  };
+
+  /// time of a replayed stage
+  struct StageTime {
+    uint64_t count = 0;
+    Clock::duration total = Clock::duration::zero();
+
+    void add(Clock::duration elapsed) {
+      ++count;
+      total += elapsed;
+    }
+
+    void print(const char *name) const {
+      using std::chrono::duration_cast;
+      using std::chrono::microseconds;
+      auto total_us = duration_cast<microseconds>(total).count();
+      std::cout << name << ": " << count << ", total " << total_us / 1000
+                << " ms, mean " << (count == 0 ? 0 : total_us / count)
+                << " us" << std::endl;
+    }
+  };
+
+  template <typename F>
+  auto timed(StageTime &stage, F &&f) {
+    const auto start = Clock::now();
+    auto result = std::forward<F>(f)();
+    stage.add(Clock::now() - start);
+    return result;
+  }
+}  // namespace
+
+/**
+ * Replays the traffic captured by a peer with traffic_capture in its
+ * configuration. The WSV snapshot of the capture is restored to a new
+ * database, then the captured proposals are validated by the simulator and
+ * the captured blocks are committed, as fast as possible. The time of the
+ * validation, of the block creation and of the commit is printed, so the
+ * changes of them are benchmarked on the real workload.
+ */
+int main(int argc, char *argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+  auto log_manager =
+      std::make_shared<logger::LoggerManagerTree>(logger::LoggerConfig{
+          logger::LogLevel::kWarn, logger::getDefaultLogPatterns()});
+  auto log = log_manager->getChild("Replay")->getLogger();
+
+  auto reader = iroha::maintenance::CaptureReader::open(FLAGS_capture);
+  if (auto e = iroha::expected::resultToOptionalError(reader)) {
+    log->error("{}", *e);
+    return EXIT_FAILURE;
+  }
+  auto capture =
+      std::move(iroha::expected::resultToOptionalValue(std::move(reader)))
+          .value();
+
+  // the capture starts with the WSV snapshot
+  iroha::maintenance::proto::CaptureRecord record;
+  auto has_record = capture->next(record);
+  if (auto e = iroha::expected::resultToOptionalError(has_record)) {
+    log->error("{}", *e);
+    return EXIT_FAILURE;
+  }
+  if (not iroha::expected::resultToOptionalValue(has_record).value()
+      or not record.snapshot().has_header()) {
+    log->error("The capture does not start with the WSV snapshot");
+    return EXIT_FAILURE;
+  }
+  iroha::ametsuchi::WsvSnapshot snapshot{
+      record.snapshot().header().height(),
+      shared_model::crypto::Hash(record.snapshot().header().block_hash()),
+      {},
+      record.snapshot().header().state_digest()};
+  boost::optional<shared_model::crypto::Hash> digest;
+  while (not digest) {
+    has_record = capture->next(record);
+    if (not iroha::expected::resultToOptionalValue(has_record).value_or(false)
+        or not record.has_snapshot()) {
+      log->error("The WSV snapshot of the capture is incomplete");
+      return EXIT_FAILURE;
+    }
+    auto &chunk = *record.mutable_snapshot();
+    if (chunk.has_rows()) {
+      snapshot.rows.push_back(iroha::ametsuchi::WsvSnapshot::Rows{
+          std::move(*chunk.mutable_rows()->mutable_table()),
+          std::move(*chunk.mutable_rows()->mutable_rows())});
+    } else {
+      digest = shared_model::crypto::Hash(chunk.digest());
+    }
+  }
+  if (*digest != snapshot.digest()) {
+    log->error("The WSV snapshot of the capture does not match its digest");
+    return EXIT_FAILURE;
+  }
+
+  auto make_options = [&log] {
+    return std::make_unique<iroha::ametsuchi::PostgresOptions>(
+        FLAGS_pg_opt, FLAGS_dbname, log);
+  };
+  auto options = make_options();
+  iroha::ametsuchi::PgConnectionInit::dropWorkingDatabase(*options);
+  if (auto e = iroha::expected::resultToOptionalError(
+          iroha::ametsuchi::PgConnectionInit::createDatabaseIfNotExist(
+              *options))) {
+    log->error("Cannot create the database {}: {}", FLAGS_dbname, *e);
+    return EXIT_FAILURE;
+  }
+  iroha::ametsuchi::KTimesReconnectionStrategyFactory reconnection_factory{0};
+  auto pool = iroha::ametsuchi::PgConnectionInit::prepareConnectionPool(
+      reconnection_factory, *options, kPoolSize, log_manager);
+  if (auto e = iroha::expected::resultToOptionalError(pool)) {
+    log->error("{}", *e);
+    return EXIT_FAILURE;
+  }
+  auto block_storage_factory =
+      std::make_unique<iroha::ametsuchi::InMemoryBlockStorageFactory>();
+  auto block_storage = block_storage_factory->create();
+  auto created = iroha::ametsuchi::StorageImpl::create(
+      make_options(),
+      iroha::expected::resultToOptionalValue(pool).value(),
+      std::make_shared<shared_model::proto::ProtoPermissionToString>(),
+      nullptr,
+      std::make_shared<shared_model::proto::ProtoQueryResponseFactory>(),
+      std::move(block_storage_factory),
+      std::move(block_storage),
+      log_manager->getChild("Storage"));
+  if (auto e = iroha::expected::resultToOptionalError(created)) {
+    log->error("{}", *e);
+    return EXIT_FAILURE;
+  }
+  auto storage = iroha::expected::resultToOptionalValue(created).value();
+  auto cleanup = [&storage, &options] {
+    storage->freeConnections();
+    iroha::ametsuchi::PgConnectionInit::dropWorkingDatabase(*options);
+  };
+
+  auto restored = storage->restoreWsvSnapshot(snapshot);
+  if (auto e = iroha::expected::resultToOptionalError(restored)) {
+    log->error("Cannot restore the WSV snapshot: {}", *e);
+    cleanup();
+    return EXIT_FAILURE;
+  }
+  auto top_block_info =
+      iroha::expected::resultToOptionalValue(restored).value()->top_block_info;
+  std::cout << "Restored the WSV at block " << snapshot.height << std::endl;
+
+  auto commit_executor = iroha::expected::resultToOptionalValue(
+      storage->createCommandExecutor());
+  auto validation_executor = iroha::expected::resultToOptionalValue(
+      storage->createCommandExecutor());
+  if (not commit_executor or not validation_executor) {
+    log->error("Cannot create the command executors");
+    cleanup();
+    return EXIT_FAILURE;
+  }
+  std::shared_ptr<iroha::ametsuchi::CommandExecutor> block_executor =
+      std::move(*commit_executor);
+
+  auto validators_config =
+      std::make_shared<shared_model::validation::ValidatorsConfig>(
+          FLAGS_max_proposal_size);
+  auto stateful_validator =
+      std::make_shared<iroha::validation::StatefulValidatorImpl>(
+          std::make_unique<shared_model::proto::ProtoProposalFactory<
+              shared_model::validation::DefaultProposalValidator>>(
+              validators_config),
+          log_manager->getChild("Stateful")->getLogger());
+  // the blocks of the simulator are signed by a key of the replay, the
+  // captured blocks are committed instead of them
+  auto simulator = std::make_shared<iroha::simulator::Simulator>(
+      std::move(*validation_executor),
+      std::make_shared<ReplayOrderingGate>(),
+      stateful_validator,
+      storage,
+      std::make_shared<shared_model::crypto::CryptoModelSigner<>>(
+          shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair()),
+      std::make_unique<shared_model::proto::ProtoBlockFactory>(
+          std::make_unique<
+              shared_model::validation::DefaultUnsignedBlockValidator>(
+              validators_config),
+          std::make_unique<shared_model::validation::ProtoBlockValidator>()),
+      log_manager->getChild("Simulator")->getLogger());
+
+  StageTime validation, block_creation, commit;
+  uint64_t batches = 0, stale_proposals = 0, transactions = 0;
+  const auto start = Clock::now();
+  while (true) {
+    has_record = capture->next(record);
+    if (auto e = iroha::expected::resultToOptionalError(has_record)) {
+      // the peer may have stopped in the middle of a record
+      log->warn("{}", *e);
+      break;
+    }
+    if (not iroha::expected::resultToOptionalValue(has_record).value()) {
+      break;
+    }
+
+    switch (record.record_case()) {
+      case iroha::maintenance::proto::CaptureRecord::kProposal: {
+        // the proposals of the blocks which are committed already are the
+        // ones the peer has received while catching up
+        if (record.proposal().block_round() != top_block_info.height + 1) {
+          ++stale_proposals;
+          break;
+        }
+        shared_model::proto::Proposal proposal(
+            std::move(*record.mutable_proposal()->mutable_proposal()));
+        auto verified = timed(validation, [&] {
+          return simulator->processProposal(proposal);
+        });
+        timed(block_creation, [&] {
+          return simulator->processVerifiedProposal(verified, top_block_info);
+        });
+        break;
+      }
+      case iroha::maintenance::proto::CaptureRecord::kBatch:
+        ++batches;
+        break;
+      case iroha::maintenance::proto::CaptureRecord::kBlock: {
+        auto block = std::make_shared<shared_model::proto::Block>(
+            std::move(*record.mutable_block()->mutable_block_v1()));
+        if (block->height() <= top_block_info.height) {
+          break;
+        }
+        if (block->height() != top_block_info.height + 1) {
+          log->error("Block {} is missing from the capture, stopped at {}",
+                     top_block_info.height + 1,
+                     block->height());
+          cleanup();
+          return EXIT_FAILURE;
+        }
+        auto committed = timed(commit, [&] {
+          if (storage->preparedCommitEnabled(*block)) {
+            return storage->commitPrepared(block);
+          }
+          auto mutable_storage = storage->createMutableStorage(block_executor);
+          if (not mutable_storage->apply(block)) {
+            return iroha::ametsuchi::CommitResult(
+                iroha::expected::makeError("the block is not applicable"));
+          }
+          return storage->commit(std::move(mutable_storage));
+        });
+        if (auto e = iroha::expected::resultToOptionalError(committed)) {
+          log->error("Cannot commit block {}: {}", block->height(), *e);
+          cleanup();
+          return EXIT_FAILURE;
+        }
+        top_block_info =
+            iroha::expected::resultToOptionalValue(committed).value()
+                ->top_block_info;
+        transactions += boost::size(block->transactions());
+        break;
+      }
+      default:
+        log->warn("Unexpected record in the capture");
+        break;
+    }
+  }
+  const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+      Clock::now() - start);
+
+  std::cout << "Replayed up to block " << top_block_info.height << " in "
+            << elapsed.count() << " ms, " << transactions
+            << " committed transactions, " << batches << " client batches, "
+            << stale_proposals << " proposals of committed blocks skipped"
+            << std::endl;
+  validation.print("Proposal validation");
+  block_creation.print("Block creation");
+  commit.print("Block commit");
+
+  cleanup();
+  return EXIT_SUCCESS;
+}
@@ -5,11 +5,16 @@
 
 #include "main/server_runner.hpp"
 
+#include <algorithm>
 #include <chrono>
 
 #include <grpc/impl/codegen/grpc_types.h>
 #include <boost/format.hpp>
+#include "common/thread_name.hpp"
+#include "common/thread_placement.hpp"
 #include "logger/logger.hpp"
+#include "network/async_call.hpp"
+#include "network/impl/grpc_channel_builder.hpp"
 #include "network/impl/tls_credentials.hpp"
 
 using namespace iroha::network;
@@ -29,6 +34,9 @@ namespace {
     grpc::SslServerCredentialsOptions::PemKeyCertPair keypair = {
         my_tls_creds.value()->private_key, my_tls_creds.value()->certificate};
     options.pem_key_cert_pairs.push_back(keypair);
+    // the credentials are created once per server, so the TLS sessions and
+    // the keys of their tickets live as long as the server, and the clients
+    // reconnecting to it resume their sessions without the full handshake
     std::shared_ptr<grpc::ServerCredentials> credentials =
         grpc::SslServerCredentials(options);
     return credentials;
@@ -48,6 +56,7 @@ ServerRunner::ServerRunner(
 
 ServerRunner::~ServerRunner() {
   shutdown(std::chrono::system_clock::now());
+  stopCompletionQueues();
 }
 
 ServerRunner &ServerRunner::append(std::shared_ptr<grpc::Service> service) {
@@ -65,8 +74,23 @@ iroha::expected::Result<int, std::string> ServerRunner::run() {
 
   builder.AddListeningPort(server_address_, credentials_, &selected_port);
 
+  std::vector<AsyncCallHandler *> async_handlers;
   for (auto &service : services_) {
     builder.RegisterService(service.get());
+    auto handler = dynamic_cast<AsyncCallHandler *>(service.get());
+    if (handler and handler->hasAsyncMethods()) {
+      async_handlers.push_back(handler);
+    }
+  }
+  if (not async_handlers.empty()) {
+    // the threads of the queues inherit the CPUs of the calling thread
+    const auto cpus = iroha::currentThreadCpus().size();
+    const size_t queues = cpus != 0
+        ? cpus
+        : std::max(1u, std::thread::hardware_concurrency());
+    for (size_t i = 0; i < queues; ++i) {
+      completion_queues_.push_back(builder.AddCompletionQueue());
+    }
   }
 
   // in order to bypass built-it limitation of gRPC message size
@@ -76,9 +100,31 @@ iroha::expected::Result<int, std::string> ServerRunner::run() {
   // enable retry policy
   builder.AddChannelArgument(GRPC_ARG_ENABLE_RETRIES, 1);
 
+  // accept the keepalive pings of the idle peer channels, see
+  // iroha::network::details::getChannelArguments
+  builder.AddChannelArgument(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+  builder.AddChannelArgument(
+      GRPC_ARG_HTTP2_MIN_RECV_PING_INTERVAL_WITHOUT_DATA_MS,
+      iroha::network::details::kKeepaliveTimeMs / 2);
+
   server_instance_ = builder.BuildAndStart();
   server_instance_cv_.notify_one();
 
+  for (size_t i = 0; i < completion_queues_.size(); ++i) {
+    auto &queue = completion_queues_[i];
+    for (auto handler : async_handlers) {
+      handler->requestCalls(*queue);
+    }
+    completion_queue_threads_.emplace_back([queue = queue.get(), i] {
+      iroha::setThreadName("grpc-cq-" + std::to_string(i));
+      void *tag;
+      bool ok;
+      while (queue->Next(&tag, &ok)) {
+        static_cast<AsyncCall *>(tag)->proceed(ok);
+      }
+    });
+  }
+
   if (selected_port == 0) {
     return iroha::expected::makeError(
         (boost::format(kPortBindError) % server_address_).str());
@@ -110,3 +156,15 @@ void ServerRunner::shutdown(
     log_->warn("Tried to shutdown without a server instance");
   }
 }
+
+void ServerRunner::stopCompletionQueues() {
+  // the queues are shut down after the server, and drained by their threads
+  for (auto &queue : completion_queues_) {
+    queue->Shutdown();
+  }
+  for (auto &thread : completion_queue_threads_) {
+    thread.join();
+  }
+  completion_queue_threads_.clear();
+  completion_queues_.clear();
+}
@@ -6,6 +6,8 @@
 #ifndef MAIN_SERVER_RUNNER_HPP
 #define MAIN_SERVER_RUNNER_HPP
 
+#include <thread>
+
 #include <grpc++/grpc++.h>
 #include <grpc++/impl/codegen/service_type.h>
 #include "common/result.hpp"
@@ -24,7 +26,8 @@ namespace iroha {
        * Constructor. Initialize a new instance of ServerRunner class.
        * @param address - the address the server will be bind to in URI form
        * @param log to print progress to
-       * @param reuse - allow multiple sockets to bind to the same port
+       * @param reuse - allow multiple sockets to bind to the same port, such
+       * as the ones of the other instances of the server
        * @param my_tls_creds - TLS credentials_ for this server, if required
        */
       explicit ServerRunner(
@@ -37,7 +40,10 @@ namespace iroha {
       ~ServerRunner();
 
       /**
-       * Adds a new grpc service to be run.
+       * Adds a new grpc service to be run. The asynchronous methods of the
+       * services which are network::AsyncCallHandler are handled on the
+       * completion queues, one queue and one thread per core the calling
+       * thread of run() may run on
        * @param service - service to append.
        * @return reference to this with service appended
        */
@@ -65,6 +71,9 @@ namespace iroha {
       void shutdown(const std::chrono::system_clock::time_point &deadline);
 
      private:
+      /// stop the completion queues and wait for their threads
+      void stopCompletionQueues();
+
       logger::LoggerPtr log_;
 
       std::unique_ptr<grpc::Server> server_instance_;
@@ -75,6 +84,9 @@ namespace iroha {
       std::shared_ptr<grpc::ServerCredentials> credentials_;
       bool reuse_;
       std::vector<std::shared_ptr<grpc::Service>> services_;
+      std::vector<std::unique_ptr<grpc::ServerCompletionQueue>>
+          completion_queues_;
+      std::vector<std::thread> completion_queue_threads_;
     };
 
   }  // namespace network
@@ -0,0 +1,26 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ALLOCATION_METRICS_HPP
+#define IROHA_ALLOCATION_METRICS_HPP
+
+namespace iroha {
+  namespace maintenance {
+
+    class MetricsRegistry;
+
+    /**
+     * Expose the heap allocations per subsystem as
+     * iroha_heap_allocations_total and iroha_heap_allocated_bytes_total with
+     * the subsystem label. Nothing is added unless the build tracks the
+     * allocations
+     * @param registry - registry to add the metrics to
+     */
+    void addAllocationMetrics(MetricsRegistry &registry);
+
+  }  // namespace maintenance
+}  // namespace iroha
+
+#endif  // IROHA_ALLOCATION_METRICS_HPP
@@ -0,0 +1,129 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BLOCK_EXPORTER_HPP
+#define IROHA_BLOCK_EXPORTER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "common/result.hpp"
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+    class BlockQuery;
+  }
+
+  namespace maintenance {
+
+    /**
+     * Exports the transactions and the commands of the committed blocks to
+     * rotating CSV segments in a directory, so the analytics read them
+     * instead of the tables of the node. The blocks are written on a
+     * separate thread, in the order they are passed.
+     *
+     * A segment is a pair of transactions-<height>.csv and
+     * commands-<height>.csv files, named by the height of their first block.
+     * The segment being written has the .part suffix and is renamed once it
+     * has the configured number of transactions. The height of the last
+     * exported block is kept in the exported_height file of the directory,
+     * the export resumes from it after a restart.
+     */
+    class BlockExporter {
+     public:
+      /// header of the transactions files
+      static const char *kTransactionsHeader;
+      /// header of the commands files
+      static const char *kCommandsHeader;
+
+      /**
+       * @param directory - existing directory for the segments
+       * @param rows_per_file - transactions in a segment, which is rotated
+       * after the block reaching them
+       * @param log - logger
+       */
+      BlockExporter(std::string directory,
+                    size_t rows_per_file,
+                    logger::LoggerPtr log);
+
+      /// exports the queued blocks and closes the current segment
+      ~BlockExporter();
+
+      /// @return height of the last exported block, 0 if there is none
+      shared_model::interface::types::HeightType exportedHeight() const;
+
+      /**
+       * Queue the export of the committed block, the blocks which are
+       * already exported are skipped
+       * @param block - committed block
+       */
+      void push(std::shared_ptr<const shared_model::interface::Block> block);
+
+      /**
+       * Queue the export of the blocks missing from the directory, which are
+       * read from the block query
+       * @param block_query - source of the blocks
+       * @param top_height - height of the last block to export
+       */
+      void backfill(std::shared_ptr<ametsuchi::BlockQuery> block_query,
+                    shared_model::interface::types::HeightType top_height);
+
+      /**
+       * Write the block to the current segment on the calling thread
+       * @return error if the block is not the next one or cannot be written
+       */
+      expected::Result<void, std::string> exportBlock(
+          const shared_model::interface::Block &block);
+
+     private:
+      void enqueue(std::function<void()> task);
+
+      /// rename the current segment to its final name
+      void closeSegment();
+
+      expected::Result<void, std::string> openSegment(
+          shared_model::interface::types::HeightType height);
+
+      std::string segmentPath(
+          const char *table,
+          shared_model::interface::types::HeightType height) const;
+
+      const std::string directory_;
+      const size_t rows_per_file_;
+      logger::LoggerPtr log_;
+
+      mutable std::mutex segment_mutex_;
+      shared_model::interface::types::HeightType exported_height_;
+      /// height of the first block of the current segment, 0 if it is closed
+      shared_model::interface::types::HeightType segment_height_ = 0;
+      size_t segment_rows_ = 0;
+      std::ofstream transactions_;
+      std::ofstream commands_;
+
+      std::mutex queue_mutex_;
+      std::condition_variable queue_cv_;
+      std::deque<std::function<void()>> queue_;
+      bool stopped_ = false;
+      std::thread thread_;
+    };
+
+  }  // namespace maintenance
+}  // namespace iroha
+
+#endif  // IROHA_BLOCK_EXPORTER_HPP
@@ -0,0 +1,50 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CAPTURE_READER_HPP
+#define IROHA_CAPTURE_READER_HPP
+
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+#include "capture.pb.h"
+#include "common/result.hpp"
+
+namespace iroha {
+  namespace maintenance {
+
+    /**
+     * Reads the records of a capture file written by TrafficCapture
+     */
+    class CaptureReader {
+     public:
+      /**
+       * @param path - capture file
+       * @return reader or the error of opening the file
+       */
+      static expected::Result<std::unique_ptr<CaptureReader>, std::string>
+      open(const std::string &path);
+
+      /**
+       * Read the next record
+       * @param record - the record which is read
+       * @return false at the end of the file, error if the last record is
+       * torn, e.g. the peer has stopped while writing it
+       */
+      expected::Result<bool, std::string> next(proto::CaptureRecord &record);
+
+     private:
+      explicit CaptureReader(std::ifstream file);
+
+      std::ifstream file_;
+      google::protobuf::io::IstreamInputStream input_;
+    };
+
+  }  // namespace maintenance
+}  // namespace iroha
+
+#endif  // IROHA_CAPTURE_READER_HPP
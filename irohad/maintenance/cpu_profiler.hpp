@@ -0,0 +1,59 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CPU_PROFILER_HPP
+#define IROHA_CPU_PROFILER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+
+#include "common/result.hpp"
+
+namespace iroha {
+  namespace maintenance {
+
+    /**
+     * Time-bounded sampling profile of the whole process by the gperftools
+     * CPU profiler. The profiler is available when irohad is built with
+     * USE_GPERFTOOLS, only one profile is collected at a time.
+     */
+    class CpuProfiler {
+     public:
+      struct Error {
+        enum class Code { kUnavailable, kBusy, kFailed };
+        Code code;
+        std::string message;
+      };
+
+      /// @return whether the binary is built with the profiler
+      static bool isAvailable();
+
+      /**
+       * Collect the profile, blocks the calling thread for the duration
+       * @param duration - time of the sampling
+       * @return profile in the pprof format or error
+       */
+      iroha::expected::Result<std::string, Error> profile(
+          std::chrono::seconds duration);
+
+      /**
+       * Finish the current profile with the samples collected so far, and
+       * refuse the further ones
+       */
+      void stop();
+
+     private:
+      std::mutex mutex_;
+      std::condition_variable stopped_cv_;
+      bool running_ = false;
+      bool stopped_ = false;
+    };
+
+  }  // namespace maintenance
+}  // namespace iroha
+
+#endif  // IROHA_CPU_PROFILER_HPP
@@ -0,0 +1,53 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "maintenance/allocation_metrics.hpp"
+
+#include "common/allocation_tracking.hpp"
+#include "maintenance/metrics_registry.hpp"
+
+namespace {
+  using iroha::AllocationCounters;
+  using iroha::maintenance::MetricsRegistry;
+
+  MetricsRegistry::Collector collect(
+      double (*value)(const AllocationCounters &)) {
+    return [value] {
+      std::vector<MetricsRegistry::Sample> samples;
+      for (size_t i = 0;
+           i < static_cast<size_t>(iroha::AllocationTag::kCount);
+           ++i) {
+        auto tag = static_cast<iroha::AllocationTag>(i);
+        samples.push_back({{{"subsystem", iroha::allocationTagName(tag)}},
+                           value(iroha::allocationCounters(tag))});
+      }
+      return samples;
+    };
+  }
+}  // namespace
+
+namespace iroha {
+  namespace maintenance {
+
+    void addAllocationMetrics(MetricsRegistry &registry) {
+      if (not kAllocationTracking) {
+        return;
+      }
+      registry.addCounterFamily(
+          "iroha_heap_allocations_total",
+          "Heap allocations by the subsystem which made them",
+          collect([](const AllocationCounters &counters) {
+            return static_cast<double>(counters.allocations);
+          }));
+      registry.addCounterFamily(
+          "iroha_heap_allocated_bytes_total",
+          "Bytes allocated on the heap by the subsystem which made them",
+          collect([](const AllocationCounters &counters) {
+            return static_cast<double>(counters.bytes);
+          }));
+    }
+
+  }  // namespace maintenance
+}  // namespace iroha
@@ -0,0 +1,277 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "maintenance/block_exporter.hpp"
+
+#include <iomanip>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+#include <boost/range/size.hpp>
+#include "ametsuchi/block_query.hpp"
+#include "common/thread_name.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
+#include "logger/logger.hpp"
+
+namespace {
+  const char *kTransactions = "transactions";
+  const char *kCommands = "commands";
+  const char *kPartSuffix = ".part";
+  const char *kHeightFile = "exported_height";
+
+  /// quote the field if it has the separators or the quotes
+  void writeField(std::ostream &out, const std::string &value) {
+    if (value.find_first_of(",\"\r\n") == std::string::npos) {
+      out << value;
+      return;
+    }
+    out << '"';
+    for (auto c : value) {
+      if (c == '"') {
+        out << '"';
+      }
+      out << c;
+    }
+    out << '"';
+  }
+
+  /// @return name of the command, which starts its string representation
+  std::string commandType(const std::string &command) {
+    return command.substr(0, command.find(':'));
+  }
+}  // namespace
+
+namespace iroha {
+  namespace maintenance {
+
+    const char *BlockExporter::kTransactionsHeader =
+        "height,tx_index,hash,creator_account_id,created_time,quorum,"
+        "commands";
+    const char *BlockExporter::kCommandsHeader =
+        "height,tx_index,command_index,type,command";
+
+    BlockExporter::BlockExporter(std::string directory,
+                                 size_t rows_per_file,
+                                 logger::LoggerPtr log)
+        : directory_(std::move(directory)),
+          rows_per_file_(std::max<size_t>(rows_per_file, 1)),
+          log_(std::move(log)),
+          exported_height_(0) {
+      namespace fs = boost::filesystem;
+      std::ifstream height_file((fs::path(directory_) / kHeightFile).string());
+      height_file >> exported_height_;
+
+      // the segments left by the previous run have the exported blocks only
+      boost::system::error_code err;
+      for (fs::directory_iterator it(directory_, err), end; it != end;
+           it.increment(err)) {
+        auto path = it->path();
+        if (path.extension() == kPartSuffix) {
+          fs::rename(path, fs::path(path).replace_extension(), err);
+        }
+      }
+
+      thread_ = std::thread([this] {
+        setThreadName("block-export");
+        std::unique_lock<std::mutex> lock(queue_mutex_);
+        while (true) {
+          queue_cv_.wait(lock,
+                         [this] { return stopped_ or not queue_.empty(); });
+          if (queue_.empty()) {
+            break;
+          }
+          auto task = std::move(queue_.front());
+          queue_.pop_front();
+          lock.unlock();
+          task();
+          lock.lock();
+        }
+      });
+    }
+
+    BlockExporter::~BlockExporter() {
+      {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        stopped_ = true;
+      }
+      queue_cv_.notify_all();
+      if (thread_.joinable()) {
+        thread_.join();
+      }
+      std::lock_guard<std::mutex> lock(segment_mutex_);
+      closeSegment();
+    }
+
+    shared_model::interface::types::HeightType BlockExporter::exportedHeight()
+        const {
+      std::lock_guard<std::mutex> lock(segment_mutex_);
+      return exported_height_;
+    }
+
+    void BlockExporter::push(
+        std::shared_ptr<const shared_model::interface::Block> block) {
+      enqueue([this, block = std::move(block)] {
+        if (auto e = expected::resultToOptionalError(exportBlock(*block))) {
+          log_->error("Failed to export block {}: {}", block->height(), *e);
+        }
+      });
+    }
+
+    void BlockExporter::backfill(
+        std::shared_ptr<ametsuchi::BlockQuery> block_query,
+        shared_model::interface::types::HeightType top_height) {
+      enqueue([this, block_query = std::move(block_query), top_height] {
+        auto from = exportedHeight() + 1;
+        if (from <= top_height) {
+          log_->info("Exporting blocks from {} to {}", from, top_height);
+        }
+        for (auto height = from; height <= top_height; ++height) {
+          auto block = block_query->getBlock(height);
+          if (auto e = expected::resultToOptionalError(block)) {
+            log_->error("Failed to read block {}: {}", height, e->message);
+            return;
+          }
+          auto result = exportBlock(
+              *boost::get<expected::ValueOf<decltype(block)>>(&block)->value);
+          if (auto e = expected::resultToOptionalError(result)) {
+            log_->error("Failed to export block {}: {}", height, *e);
+            return;
+          }
+        }
+      });
+    }
+
+    expected::Result<void, std::string> BlockExporter::exportBlock(
+        const shared_model::interface::Block &block) {
+      std::lock_guard<std::mutex> lock(segment_mutex_);
+      auto height = block.height();
+      if (height <= exported_height_) {
+        return {};
+      }
+      if (height != exported_height_ + 1) {
+        return expected::makeError(
+            "block " + std::to_string(height)
+            + " does not follow the exported block "
+            + std::to_string(exported_height_));
+      }
+      if (segment_height_ == 0) {
+        if (auto e = expected::resultToOptionalError(openSegment(height))) {
+          return expected::makeError(std::move(*e));
+        }
+      }
+
+      std::ostringstream transactions;
+      std::ostringstream commands;
+      size_t tx_index = 0;
+      for (const auto &tx : block.transactions()) {
+        const auto &tx_commands = tx.commands();
+        transactions << height << ',' << tx_index << ',' << tx.hash().hex()
+                     << ',';
+        writeField(transactions, tx.creatorAccountId());
+        transactions << ',' << tx.createdTime() << ',' << tx.quorum() << ','
+                     << boost::size(tx_commands) << '\n';
+        size_t command_index = 0;
+        for (const auto &command : tx_commands) {
+          auto value = command.toString();
+          commands << height << ',' << tx_index << ',' << command_index++
+                   << ',' << commandType(value) << ',';
+          writeField(commands, value);
+          commands << '\n';
+        }
+        ++tx_index;
+      }
+      transactions_ << transactions.str() << std::flush;
+      commands_ << commands.str() << std::flush;
+      if (not transactions_ or not commands_) {
+        return expected::makeError(
+            "failed to write segment "
+            + segmentPath(kTransactions, segment_height_));
+      }
+
+      auto height_path =
+          (boost::filesystem::path(directory_) / kHeightFile).string();
+      {
+        std::ofstream height_file(height_path + kPartSuffix,
+                                  std::ios::trunc);
+        height_file << height << std::flush;
+        if (not height_file) {
+          return expected::makeError("failed to write " + height_path);
+        }
+      }
+      boost::system::error_code err;
+      boost::filesystem::rename(height_path + kPartSuffix, height_path, err);
+      if (err) {
+        return expected::makeError("failed to write " + height_path + ": "
+                                   + err.message());
+      }
+
+      exported_height_ = height;
+      segment_rows_ += tx_index;
+      if (segment_rows_ >= rows_per_file_) {
+        closeSegment();
+      }
+      return {};
+    }
+
+    void BlockExporter::enqueue(std::function<void()> task) {
+      {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        queue_.push_back(std::move(task));
+      }
+      queue_cv_.notify_one();
+    }
+
+    void BlockExporter::closeSegment() {
+      if (segment_height_ == 0) {
+        return;
+      }
+      transactions_.close();
+      commands_.close();
+      for (auto table : {kTransactions, kCommands}) {
+        auto path = segmentPath(table, segment_height_);
+        boost::system::error_code err;
+        boost::filesystem::rename(path + kPartSuffix, path, err);
+        if (err) {
+          log_->error("Failed to rename {}: {}", path, err.message());
+        }
+      }
+      segment_height_ = 0;
+      segment_rows_ = 0;
+    }
+
+    expected::Result<void, std::string> BlockExporter::openSegment(
+        shared_model::interface::types::HeightType height) {
+      auto open = [&](std::ofstream &file, const char *table, auto header) {
+        auto path = segmentPath(table, height) + kPartSuffix;
+        file.open(path, std::ios::trunc);
+        file << header << '\n';
+        return static_cast<bool>(file);
+      };
+      if (not open(transactions_, kTransactions, kTransactionsHeader)
+          or not open(commands_, kCommands, kCommandsHeader)) {
+        transactions_.close();
+        commands_.close();
+        return expected::makeError("failed to open segment "
+                                   + segmentPath(kTransactions, height));
+      }
+      segment_height_ = height;
+      segment_rows_ = 0;
+      return {};
+    }
+
+    std::string BlockExporter::segmentPath(
+        const char *table,
+        shared_model::interface::types::HeightType height) const {
+      // zero-padded, so the segments are sorted by their names
+      std::ostringstream name;
+      name << table << '-' << std::setw(20) << std::setfill('0') << height
+           << ".csv";
+      return (boost::filesystem::path(directory_) / name.str()).string();
+    }
+
+  }  // namespace maintenance
+}  // namespace iroha
@@ -0,0 +1,42 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "maintenance/capture_reader.hpp"
+
+#include <google/protobuf/util/delimited_message_util.h>
+
+namespace iroha {
+  namespace maintenance {
+
+    expected::Result<std::unique_ptr<CaptureReader>, std::string>
+    CaptureReader::open(const std::string &path) {
+      std::ifstream file(path, std::ios::binary);
+      if (not file) {
+        return expected::makeError("Cannot open the capture file " + path);
+      }
+      return expected::makeValue(
+          std::unique_ptr<CaptureReader>(new CaptureReader(std::move(file))));
+    }
+
+    CaptureReader::CaptureReader(std::ifstream file)
+        : file_(std::move(file)), input_(&file_) {}
+
+    expected::Result<bool, std::string> CaptureReader::next(
+        proto::CaptureRecord &record) {
+      bool clean_eof = false;
+      if (google::protobuf::util::ParseDelimitedFromZeroCopyStream(
+              &record, &input_, &clean_eof)) {
+        return expected::makeValue(true);
+      }
+      if (clean_eof) {
+        return expected::makeValue(false);
+      }
+      return expected::makeError(
+          "The capture file ends with a torn record at byte "
+          + std::to_string(input_.ByteCount()));
+    }
+
+  }  // namespace maintenance
+}  // namespace iroha
@@ -0,0 +1,85 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "maintenance/cpu_profiler.hpp"
+
+#include <fstream>
+#include <iterator>
+
+#include <boost/filesystem.hpp>
+
+#ifdef USE_GPERFTOOLS
+#include <gperftools/profiler.h>
+#endif
+
+namespace iroha {
+  namespace maintenance {
+
+    bool CpuProfiler::isAvailable() {
+#ifdef USE_GPERFTOOLS
+      return true;
+#else
+      return false;
+#endif
+    }
+
+    iroha::expected::Result<std::string, CpuProfiler::Error>
+    CpuProfiler::profile(std::chrono::seconds duration) {
+      if (not isAvailable()) {
+        return iroha::expected::makeError(
+            Error{Error::Code::kUnavailable,
+                  "irohad is built without USE_GPERFTOOLS"});
+      }
+
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (stopped_) {
+        return iroha::expected::makeError(
+            Error{Error::Code::kFailed, "Profiler is stopped"});
+      }
+      if (running_) {
+        return iroha::expected::makeError(
+            Error{Error::Code::kBusy, "Profile is already collected"});
+      }
+      running_ = true;
+
+      auto path = boost::filesystem::temp_directory_path()
+          / boost::filesystem::unique_path("iroha-%%%%-%%%%.prof");
+#ifdef USE_GPERFTOOLS
+      bool started = ProfilerStart(path.string().c_str()) != 0;
+#else
+      bool started = false;
+#endif
+      if (started) {
+        stopped_cv_.wait_for(lock, duration, [this] { return stopped_; });
+#ifdef USE_GPERFTOOLS
+        ProfilerStop();
+#endif
+      }
+      running_ = false;
+      lock.unlock();
+
+      if (not started) {
+        return iroha::expected::makeError(
+            Error{Error::Code::kFailed,
+                  "Failed to start the profiler to " + path.string()});
+      }
+
+      std::ifstream file(path.string(), std::ios::binary);
+      std::string profile((std::istreambuf_iterator<char>(file)),
+                          std::istreambuf_iterator<char>());
+      file.close();
+      boost::system::error_code ignored;
+      boost::filesystem::remove(path, ignored);
+      return iroha::expected::makeValue(std::move(profile));
+    }
+
+    void CpuProfiler::stop() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopped_ = true;
+      stopped_cv_.notify_all();
+    }
+
+  }  // namespace maintenance
+}  // namespace iroha
@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "maintenance/memory_budget.hpp"
+
+#include <algorithm>
+
+#include "common/thread_name.hpp"
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace maintenance {
+
+    MemoryBudget::MemoryBudget(size_t limit_bytes, logger::LoggerPtr log)
+        : limit_bytes_(limit_bytes), log_(std::move(log)) {}
+
+    MemoryBudget::~MemoryBudget() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+      }
+      stop_cv_.notify_all();
+      if (thread_.joinable()) {
+        thread_.join();
+      }
+    }
+
+    void MemoryBudget::addConsumer(Consumer consumer) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      // the order of the enforcement, the most critical consumers first
+      auto position = std::find_if(
+          consumers_.begin(), consumers_.end(), [&](const auto &other) {
+            return other.priority < consumer.priority;
+          });
+      consumers_.insert(position, std::move(consumer));
+    }
+
+    size_t MemoryBudget::limit() const {
+      return limit_bytes_;
+    }
+
+    std::vector<std::pair<std::string, size_t>> MemoryBudget::usage() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      std::vector<std::pair<std::string, size_t>> result;
+      result.reserve(consumers_.size());
+      for (const auto &consumer : consumers_) {
+        result.emplace_back(consumer.name, consumer.usage());
+      }
+      return result;
+    }
+
+    void MemoryBudget::enforce() {
+      if (limit_bytes_ == 0) {
+        return;
+      }
+      std::lock_guard<std::mutex> lock(mutex_);
+      // the consumers which cannot be shrunk take their memory anyway
+      size_t available = limit_bytes_;
+      for (const auto &consumer : consumers_) {
+        if (not consumer.limit) {
+          available -= std::min(available, consumer.usage());
+        }
+      }
+      for (const auto &consumer : consumers_) {
+        if (not consumer.limit) {
+          continue;
+        }
+        auto usage = consumer.usage();
+        if (usage > available) {
+          log_->warn("Shrinking {} from {} to {} bytes to fit the budget",
+                     consumer.name,
+                     usage,
+                     available);
+        }
+        consumer.limit(available);
+        available -= std::min(available, consumer.usage());
+      }
+    }
+
+    void MemoryBudget::start(std::chrono::milliseconds period) {
+      if (limit_bytes_ == 0) {
+        return;
+      }
+      thread_ = std::thread([this, period] {
+        setThreadName("memory-budget");
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (not stop_cv_.wait_for(
+            lock, period, [this] { return stopped_; })) {
+          lock.unlock();
+          enforce();
+          lock.lock();
+        }
+      });
+    }
+
+  }  // namespace maintenance
+}  // namespace iroha
@@ -0,0 +1,177 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "maintenance/metrics_registry.hpp"
+
+#include <sstream>
+
+#include "common/visitor.hpp"
+
+namespace {
+  void writeHeader(std::ostream &out,
+                   const std::string &name,
+                   const std::string &help,
+                   const char *type) {
+    out << "# HELP " << name << ' ' << help << '\n';
+    out << "# TYPE " << name << ' ' << type << '\n';
+  }
+
+  void writeLabels(std::ostream &out,
+                   const iroha::maintenance::MetricsRegistry::Labels &labels) {
+    if (labels.empty()) {
+      return;
+    }
+    out << '{';
+    for (size_t i = 0; i < labels.size(); ++i) {
+      if (i != 0) {
+        out << ',';
+      }
+      out << labels[i].first << "=\"";
+      for (auto c : labels[i].second) {
+        switch (c) {
+          case '\\':
+            out << "\\\\";
+            break;
+          case '"':
+            out << "\\\"";
+            break;
+          case '\n':
+            out << "\\n";
+            break;
+          default:
+            out << c;
+        }
+      }
+      out << '"';
+    }
+    out << '}';
+  }
+
+  void writeHistogram(std::ostream &out,
+                      const std::string &name,
+                      iroha::maintenance::MetricsRegistry::Labels labels,
+                      const iroha::Histogram &histogram) {
+    const auto &bounds = histogram.bounds();
+    const auto counts = histogram.bucketCounts();
+    // buckets are cumulative, and the total is taken from the same snapshot
+    // to keep the exposition consistent
+    uint64_t total = 0;
+    labels.emplace_back("le", std::string{});
+    for (size_t i = 0; i < bounds.size(); ++i) {
+      total += counts[i];
+      labels.back().second = std::to_string(bounds[i]);
+      out << name << "_bucket";
+      writeLabels(out, labels);
+      out << ' ' << total << '\n';
+    }
+    total += counts.back();
+    labels.back().second = "+Inf";
+    out << name << "_bucket";
+    writeLabels(out, labels);
+    out << ' ' << total << '\n';
+    labels.pop_back();
+    out << name << "_sum";
+    writeLabels(out, labels);
+    out << ' ' << histogram.sum() << '\n';
+    out << name << "_count";
+    writeLabels(out, labels);
+    out << ' ' << total << '\n';
+  }
+}  // namespace
+
+namespace iroha {
+  namespace maintenance {
+
+    void MetricsRegistry::addCounter(std::string name,
+                                     std::string help,
+                                     std::shared_ptr<const Counter> counter) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      metrics_.push_back(
+          Metric{std::move(name), std::move(help), std::move(counter)});
+    }
+
+    void MetricsRegistry::addGauge(std::string name,
+                                   std::string help,
+                                   Gauge gauge) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      metrics_.push_back(
+          Metric{std::move(name), std::move(help), std::move(gauge)});
+    }
+
+    void MetricsRegistry::addCounterFamily(std::string name,
+                                           std::string help,
+                                           Collector collector) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      metrics_.push_back(Metric{std::move(name),
+                                std::move(help),
+                                Family{"counter", std::move(collector)}});
+    }
+
+    void MetricsRegistry::addGaugeFamily(std::string name,
+                                         std::string help,
+                                         Collector collector) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      metrics_.push_back(Metric{std::move(name),
+                                std::move(help),
+                                Family{"gauge", std::move(collector)}});
+    }
+
+    void MetricsRegistry::addHistogram(
+        std::string name,
+        std::string help,
+        std::shared_ptr<const Histogram> histogram) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      metrics_.push_back(
+          Metric{std::move(name), std::move(help), std::move(histogram)});
+    }
+
+    void MetricsRegistry::addHistogramFamily(std::string name,
+                                             std::string help,
+                                             HistogramCollector collector) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      metrics_.push_back(
+          Metric{std::move(name), std::move(help), std::move(collector)});
+    }
+
+    std::string MetricsRegistry::serialize() const {
+      std::ostringstream out;
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto &metric : metrics_) {
+        const auto &name = metric.name;
+        iroha::visit_in_place(
+            metric.value,
+            [&](const std::shared_ptr<const Counter> &counter) {
+              writeHeader(out, name, metric.help, "counter");
+              out << name << ' ' << counter->value() << '\n';
+            },
+            [&](const Gauge &gauge) {
+              writeHeader(out, name, metric.help, "gauge");
+              out << name << ' ' << gauge() << '\n';
+            },
+            [&](const std::shared_ptr<const Histogram> &histogram) {
+              writeHeader(out, name, metric.help, "histogram");
+              writeHistogram(out, name, {}, *histogram);
+            },
+            [&](const Family &family) {
+              writeHeader(out, name, metric.help, family.type);
+              for (const auto &sample : family.collector()) {
+                out << name;
+                writeLabels(out, sample.labels);
+                out << ' ' << sample.value << '\n';
+              }
+            },
+            [&](const HistogramCollector &collector) {
+              writeHeader(out, name, metric.help, "histogram");
+              for (const auto &labeled : collector()) {
+                writeHistogram(
+                    out, name, labeled.labels, *labeled.histogram);
+              }
+            });
+      }
+      return out.str();
+    }
+
+  }  // namespace maintenance
+}  // namespace iroha
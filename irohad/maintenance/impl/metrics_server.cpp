@@ -0,0 +1,266 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "maintenance/metrics_server.hpp"
+
+#include <istream>
+#include <sstream>
+#include <tuple>
+#include <utility>
+
+#include <boost/optional.hpp>
+#include "common/thread_name.hpp"
+#include "logger/logger.hpp"
+#include "maintenance/metrics_registry.hpp"
+
+namespace {
+  /// requests with larger headers are dropped
+  constexpr size_t kMaxRequestSize = 8 * 1024;
+
+  const std::string kMetricsPath = "/metrics";
+  const std::string kProfilePath = "/debug/profile";
+
+  constexpr long kDefaultProfileSeconds = 30;
+  constexpr long kMaxProfileSeconds = 300;
+
+  std::string response(const std::string &status,
+                       const std::string &content_type,
+                       const std::string &body) {
+    std::ostringstream out;
+    out << "HTTP/1.1 " << status << "\r\n"
+        << "Content-Type: " << content_type << "\r\n"
+        << "Content-Length: " << body.size() << "\r\n"
+        << "Connection: close\r\n\r\n"
+        << body;
+    return out.str();
+  }
+
+  /// @return the request method and target from the request line
+  std::pair<std::string, std::string> parseRequestLine(
+      const std::string &request_line) {
+    std::istringstream stream(request_line);
+    std::string method, target;
+    stream >> method >> target;
+    return {method, target};
+  }
+
+  std::string targetPath(const std::string &target) {
+    return target.substr(0, target.find('?'));
+  }
+
+  /// @return value of the parameter from the query string of the target
+  boost::optional<std::string> queryParameter(const std::string &target,
+                                              const std::string &name) {
+    auto query_begin = target.find('?');
+    if (query_begin == std::string::npos) {
+      return boost::none;
+    }
+    std::istringstream query(target.substr(query_begin + 1));
+    std::string parameter;
+    while (std::getline(query, parameter, '&')) {
+      if (parameter.compare(0, name.size() + 1, name + "=") == 0) {
+        return parameter.substr(name.size() + 1);
+      }
+    }
+    return boost::none;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace maintenance {
+
+    using boost::asio::ip::tcp;
+
+    MetricsServer::MetricsServer(
+        std::shared_ptr<const MetricsRegistry> registry, logger::LoggerPtr log)
+        : registry_(std::move(registry)),
+          log_(std::move(log)),
+          acceptor_(io_service_) {}
+
+    MetricsServer::~MetricsServer() {
+      profiler_.stop();
+      io_service_.stop();
+      if (thread_.joinable()) {
+        thread_.join();
+      }
+      if (profile_thread_.joinable()) {
+        profile_thread_.join();
+      }
+    }
+
+    iroha::expected::Result<uint16_t, std::string> MetricsServer::run(
+        const std::string &address, uint16_t port) {
+      boost::system::error_code error;
+      auto ip = boost::asio::ip::address::from_string(address, error);
+      if (error) {
+        return iroha::expected::makeError("Invalid metrics address " + address
+                                          + ": " + error.message());
+      }
+
+      tcp::endpoint endpoint(ip, port);
+      acceptor_.open(endpoint.protocol(), error);
+      if (not error) {
+        acceptor_.set_option(tcp::acceptor::reuse_address(true), error);
+      }
+      if (not error) {
+        acceptor_.bind(endpoint, error);
+      }
+      if (not error) {
+        acceptor_.listen(SOMAXCONN, error);
+      }
+      if (error) {
+        return iroha::expected::makeError("Failed to listen for metrics on "
+                                          + address + ": " + error.message());
+      }
+
+      uint16_t bound_port = acceptor_.local_endpoint(error).port();
+      accept();
+      thread_ = std::thread([this] {
+        setThreadName("metrics-http");
+        io_service_.run();
+      });
+      return iroha::expected::makeValue(bound_port);
+    }
+
+    void MetricsServer::accept() {
+      auto socket = std::make_shared<tcp::socket>(io_service_);
+      acceptor_.async_accept(
+          *socket, [this, socket](const boost::system::error_code &error) {
+            if (error == boost::asio::error::operation_aborted) {
+              return;
+            }
+            if (error) {
+              log_->warn("Failed to accept metrics request: {}",
+                         error.message());
+            } else {
+              this->serve(std::move(socket));
+            }
+            this->accept();
+          });
+    }
+
+    void MetricsServer::serve(std::shared_ptr<tcp::socket> socket) {
+      auto request = std::make_shared<boost::asio::streambuf>(kMaxRequestSize);
+      boost::asio::async_read_until(
+          *socket,
+          *request,
+          "\r\n\r\n",
+          [this, socket, request](const boost::system::error_code &error,
+                                  size_t) {
+            if (error) {
+              log_->debug("Failed to read metrics request: {}",
+                          error.message());
+              return;
+            }
+            std::istream stream(request.get());
+            std::string request_line;
+            std::getline(stream, request_line);
+
+            auto request = parseRequestLine(request_line);
+            if (request.first == "GET"
+                and targetPath(request.second) == kProfilePath) {
+              this->profile(std::move(socket), request.second);
+              return;
+            }
+            this->respond(std::move(socket), makeResponse(request_line));
+          });
+    }
+
+    void MetricsServer::respond(std::shared_ptr<tcp::socket> socket,
+                                std::string response) {
+      auto buffer = std::make_shared<std::string>(std::move(response));
+      boost::asio::async_write(
+          *socket,
+          boost::asio::buffer(*buffer),
+          [socket, buffer](const boost::system::error_code &, size_t) {
+            boost::system::error_code ignored;
+            socket->shutdown(tcp::socket::shutdown_both, ignored);
+          });
+    }
+
+    void MetricsServer::profile(std::shared_ptr<tcp::socket> socket,
+                                const std::string &target) {
+      auto seconds = kDefaultProfileSeconds;
+      if (auto parameter = queryParameter(target, "seconds")) {
+        try {
+          seconds = std::stol(*parameter);
+        } catch (const std::exception &) {
+          seconds = 0;
+        }
+      }
+      if (seconds < 1 or seconds > kMaxProfileSeconds) {
+        respond(std::move(socket),
+                response("400 Bad Request",
+                         "text/plain",
+                         "seconds must be from 1 to "
+                             + std::to_string(kMaxProfileSeconds) + "\n"));
+        return;
+      }
+      if (not CpuProfiler::isAvailable()) {
+        respond(std::move(socket),
+                response("501 Not Implemented",
+                         "text/plain",
+                         "irohad is built without USE_GPERFTOOLS\n"));
+        return;
+      }
+      if (profiling_.exchange(true)) {
+        respond(std::move(socket),
+                response("409 Conflict",
+                         "text/plain",
+                         "Profile is already collected\n"));
+        return;
+      }
+
+      // the previous profile thread has finished, since profiling_ was unset
+      if (profile_thread_.joinable()) {
+        profile_thread_.join();
+      }
+      log_->info("Collecting CPU profile for {} s", seconds);
+      profile_thread_ = std::thread([this, socket, seconds] {
+        setThreadName("profiler");
+        auto result = profiler_.profile(std::chrono::seconds(seconds));
+        auto http_response = std::move(result).match(
+            [](auto &&profile) {
+              return response(
+                  "200 OK", "application/octet-stream", profile.value);
+            },
+            [this](const auto &error) {
+              log_->warn("Failed to collect CPU profile: {}",
+                         error.error.message);
+              return response(
+                  error.error.code == CpuProfiler::Error::Code::kBusy
+                      ? "409 Conflict"
+                      : "500 Internal Server Error",
+                  "text/plain",
+                  error.error.message + "\n");
+            });
+        io_service_.post(
+            [this, socket, http_response = std::move(http_response)] {
+              this->respond(socket, http_response);
+            });
+        profiling_ = false;
+      });
+    }
+
+    std::string MetricsServer::makeResponse(
+        const std::string &request_line) const {
+      std::string method, target;
+      std::tie(method, target) = parseRequestLine(request_line);
+      // query string is not used
+      target = targetPath(target);
+
+      if (method != "GET") {
+        return response("405 Method Not Allowed", "text/plain", "");
+      }
+      if (target != kMetricsPath) {
+        return response("404 Not Found", "text/plain", "");
+      }
+      return response("200 OK",
+                      "text/plain; version=0.0.4; charset=utf-8",
+                      registry_->serialize());
+    }
+
+  }  // namespace maintenance
+}  // namespace iroha
@@ -0,0 +1,103 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "maintenance/otlp_json_file_exporter.hpp"
+
+#include <iomanip>
+#include <sstream>
+
+namespace {
+  void writeString(std::ostream &out, const std::string &value) {
+    out << '"';
+    for (unsigned char c : value) {
+      switch (c) {
+        case '"':
+          out << "\\\"";
+          break;
+        case '\\':
+          out << "\\\\";
+          break;
+        default:
+          if (c < 0x20) {
+            out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                << static_cast<int>(c) << std::dec;
+          } else {
+            out << c;
+          }
+      }
+    }
+    out << '"';
+  }
+
+  void writeAttribute(std::ostream &out,
+                      const std::string &key,
+                      const std::string &value) {
+    out << "{\"key\":";
+    writeString(out, key);
+    out << ",\"value\":{\"stringValue\":";
+    writeString(out, value);
+    out << "}}";
+  }
+
+  /// unsigned 64-bit integers are strings in the OTLP JSON
+  std::string unixNanos(iroha::tracing::Clock::time_point time) {
+    return std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              time.time_since_epoch())
+                              .count());
+  }
+}  // namespace
+
+namespace iroha {
+  namespace tracing {
+
+    OtlpJsonFileExporter::OtlpJsonFileExporter(const std::string &path,
+                                               std::string service_name)
+        : service_name_(std::move(service_name)),
+          file_(path, std::ios::app) {}
+
+    bool OtlpJsonFileExporter::isOpen() const {
+      return file_.is_open();
+    }
+
+    void OtlpJsonFileExporter::exportSpans(const std::vector<Span> &spans) {
+      auto line = serialize(spans, service_name_);
+      std::lock_guard<std::mutex> lock(mutex_);
+      file_ << line << std::endl;
+    }
+
+    std::string OtlpJsonFileExporter::serialize(
+        const std::vector<Span> &spans, const std::string &service_name) {
+      std::ostringstream out;
+      out << "{\"resourceSpans\":[{\"resource\":{\"attributes\":[";
+      writeAttribute(out, "service.name", service_name);
+      out << "]},\"scopeSpans\":[{\"scope\":{\"name\":\"iroha\"},\"spans\":[";
+      for (size_t i = 0; i < spans.size(); ++i) {
+        const auto &span = spans[i];
+        if (i != 0) {
+          out << ',';
+        }
+        out << "{\"traceId\":\"" << span.trace_id << "\",\"spanId\":\""
+            << std::hex << std::setw(16) << std::setfill('0') << span.span_id
+            << std::dec << "\",\"name\":";
+        writeString(out, span.name);
+        // SPAN_KIND_INTERNAL
+        out << ",\"kind\":1,\"startTimeUnixNano\":\"" << unixNanos(span.start)
+            << "\",\"endTimeUnixNano\":\"" << unixNanos(span.end)
+            << "\",\"attributes\":[";
+        for (size_t j = 0; j < span.attributes.size(); ++j) {
+          if (j != 0) {
+            out << ',';
+          }
+          writeAttribute(
+              out, span.attributes[j].first, span.attributes[j].second);
+        }
+        out << "]}";
+      }
+      out << "]}]}]}";
+      return out.str();
+    }
+
+  }  // namespace tracing
+}  // namespace iroha
@@ -0,0 +1,92 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "maintenance/thread_cpu_usage.hpp"
+
+#include <unistd.h>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+#include "maintenance/metrics_registry.hpp"
+
+namespace {
+  const char *kTasksPath = "/proc/self/task";
+
+  /// positions of utime and stime after the comm field of the stat file
+  constexpr size_t kUserTimeField = 11;
+  constexpr size_t kSystemTimeField = 12;
+}  // namespace
+
+namespace iroha {
+  namespace maintenance {
+
+    std::vector<ThreadCpuUsage> readThreadCpuUsage() {
+      static const double kTicksPerSecond = sysconf(_SC_CLK_TCK);
+
+      std::map<std::string, ThreadCpuUsage> usage;
+      boost::system::error_code error;
+      for (boost::filesystem::directory_iterator it(kTasksPath, error), end;
+           not error and it != end;
+           it.increment(error)) {
+        // the thread may exit while it is read
+        std::ifstream file((it->path() / "stat").string());
+        std::string stat((std::istreambuf_iterator<char>(file)),
+                         std::istreambuf_iterator<char>());
+        auto comm_begin = stat.find('(');
+        auto comm_end = stat.rfind(')');
+        if (comm_begin == std::string::npos or comm_end == std::string::npos
+            or comm_end < comm_begin) {
+          continue;
+        }
+        auto name = stat.substr(comm_begin + 1, comm_end - comm_begin - 1);
+
+        std::istringstream fields(stat.substr(comm_end + 1));
+        std::vector<std::string> values{
+            std::istream_iterator<std::string>(fields),
+            std::istream_iterator<std::string>()};
+        if (values.size() <= kSystemTimeField) {
+          continue;
+        }
+
+        auto &thread = usage[name];
+        thread.name = name;
+        thread.user_seconds +=
+            std::stoull(values[kUserTimeField]) / kTicksPerSecond;
+        thread.system_seconds +=
+            std::stoull(values[kSystemTimeField]) / kTicksPerSecond;
+      }
+
+      std::vector<ThreadCpuUsage> result;
+      result.reserve(usage.size());
+      for (auto &thread : usage) {
+        result.push_back(std::move(thread.second));
+      }
+      return result;
+    }
+
+    void addThreadCpuMetrics(MetricsRegistry &registry) {
+      registry.addCounterFamily(
+          "iroha_thread_cpu_seconds_total",
+          "CPU time of the live threads by thread name, decreases when a "
+          "thread exits",
+          [] {
+            std::vector<MetricsRegistry::Sample> samples;
+            for (const auto &thread : readThreadCpuUsage()) {
+              samples.push_back(
+                  {{{"thread", thread.name}, {"mode", "user"}},
+                   thread.user_seconds});
+              samples.push_back(
+                  {{{"thread", thread.name}, {"mode", "system"}},
+                   thread.system_seconds});
+            }
+            return samples;
+          });
+    }
+
+  }  // namespace maintenance
+}  // namespace iroha
@@ -0,0 +1,110 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "maintenance/tracing.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <random>
+
+namespace {
+  /// the trace id is made of the first bytes of the hash
+  constexpr size_t kTraceIdSize = 16;
+  /// the sampling uses the last 8 bytes of the trace id
+  constexpr size_t kSamplingOffset = 8;
+
+  std::shared_ptr<iroha::tracing::Tracer> tracer_holder;
+  std::atomic<const iroha::tracing::Tracer *> tracer{nullptr};
+
+  uint64_t samplingValue(const shared_model::crypto::Hash &hash) {
+    const auto &bytes = hash.blob();
+    uint64_t value = 0;
+    for (size_t i = kSamplingOffset;
+         i < std::min(kTraceIdSize, bytes.size());
+         ++i) {
+      value = (value << 8) | bytes[i];
+    }
+    return value;
+  }
+
+  uint64_t randomSpanId() {
+    thread_local std::mt19937_64 engine{std::random_device{}()};
+    uint64_t id;
+    // zero span id is invalid
+    while ((id = engine()) == 0) {
+    }
+    return id;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace tracing {
+
+    Tracer::Tracer(double sampling_rate,
+                   std::shared_ptr<SpanExporter> exporter)
+        : threshold_(sampling_rate >= 1.
+                         ? std::numeric_limits<uint64_t>::max()
+                         : static_cast<uint64_t>(
+                               std::max(sampling_rate, 0.)
+                               * std::numeric_limits<uint64_t>::max())),
+          exporter_(std::move(exporter)) {}
+
+    bool Tracer::isSampled(const shared_model::crypto::Hash &hash) const {
+      return threshold_ != 0 and samplingValue(hash) <= threshold_;
+    }
+
+    void Tracer::exportSpans(const std::vector<Span> &spans) const {
+      exporter_->exportSpans(spans);
+    }
+
+    void setTracer(std::shared_ptr<Tracer> new_tracer) {
+      tracer = new_tracer.get();
+      tracer_holder = std::move(new_tracer);
+    }
+
+    const Tracer *getTracer() {
+      return tracer.load(std::memory_order_relaxed);
+    }
+
+    ScopedSpan::ScopedSpan(const char *name, Clock::time_point start)
+        : tracer_(getTracer()), name_(name) {
+      if (tracer_) {
+        start_ = start == Clock::time_point{} ? Clock::now() : start;
+      }
+    }
+
+    ScopedSpan::~ScopedSpan() {
+      if (trace_ids_.empty()) {
+        return;
+      }
+      const auto end = Clock::now();
+      std::vector<Span> spans;
+      spans.reserve(trace_ids_.size());
+      for (auto &trace_id : trace_ids_) {
+        spans.push_back(Span{std::move(trace_id),
+                             randomSpanId(),
+                             name_,
+                             start_,
+                             end,
+                             attributes_});
+      }
+      tracer_->exportSpans(spans);
+    }
+
+    void ScopedSpan::addTransaction(const shared_model::crypto::Hash &hash) {
+      if (tracer_ and tracer_->isSampled(hash)) {
+        trace_ids_.push_back(hash.hex().substr(0, kTraceIdSize * 2));
+      }
+    }
+
+    void ScopedSpan::setAttribute(std::string key, std::string value) {
+      if (tracer_) {
+        attributes_.emplace_back(std::move(key), std::move(value));
+      }
+    }
+
+  }  // namespace tracing
+}  // namespace iroha
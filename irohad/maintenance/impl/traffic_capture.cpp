@@ -0,0 +1,175 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "maintenance/traffic_capture.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/util/delimited_message_util.h>
+#include "ametsuchi/wsv_snapshot.hpp"
+#include "backend/protobuf/block.hpp"
+#include "backend/protobuf/proposal.hpp"
+#include "backend/protobuf/transaction.hpp"
+#include "capture.pb.h"
+#include "common/thread_name.hpp"
+#include "consensus/round.hpp"
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "logger/logger.hpp"
+
+namespace {
+  using iroha::maintenance::proto::CaptureRecord;
+
+  CaptureRecord makeRecord() {
+    CaptureRecord record;
+    record.set_time(std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::system_clock::now().time_since_epoch())
+                        .count());
+    return record;
+  }
+
+  /// @return record prefixed with its length
+  std::string serialize(const CaptureRecord &record) {
+    std::string serialized;
+    google::protobuf::io::StringOutputStream output(&serialized);
+    google::protobuf::util::SerializeDelimitedToZeroCopyStream(record,
+                                                               &output);
+    return serialized;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace maintenance {
+
+    expected::Result<std::shared_ptr<TrafficCapture>, std::string>
+    TrafficCapture::create(const std::string &path,
+                           size_t max_queued,
+                           logger::LoggerPtr log) {
+      std::ofstream file(path, std::ios::binary | std::ios::trunc);
+      if (not file) {
+        return expected::makeError("Cannot open the capture file " + path);
+      }
+      return expected::makeValue(std::shared_ptr<TrafficCapture>(
+          new TrafficCapture(std::move(file), max_queued, std::move(log))));
+    }
+
+    TrafficCapture::TrafficCapture(std::ofstream file,
+                                   size_t max_queued,
+                                   logger::LoggerPtr log)
+        : file_(std::move(file)),
+          max_queued_(std::max<size_t>(max_queued, 1)),
+          log_(std::move(log)) {
+      thread_ = std::thread([this] {
+        setThreadName("capture");
+        std::unique_lock<std::mutex> lock(queue_mutex_);
+        while (true) {
+          queue_cv_.wait(lock,
+                         [this] { return stopped_ or not queue_.empty(); });
+          if (queue_.empty()) {
+            break;
+          }
+          std::deque<std::string> records;
+          records.swap(queue_);
+          lock.unlock();
+          for (const auto &record : records) {
+            file_.write(record.data(), record.size());
+          }
+          file_.flush();
+          if (not file_) {
+            log_->error("Failed to write {} records to the capture file",
+                        records.size());
+            file_.clear();
+          } else {
+            written_.increment(records.size());
+          }
+          lock.lock();
+        }
+      });
+    }
+
+    TrafficCapture::~TrafficCapture() {
+      {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        stopped_ = true;
+      }
+      queue_cv_.notify_all();
+      if (thread_.joinable()) {
+        thread_.join();
+      }
+    }
+
+    void TrafficCapture::snapshot(const ametsuchi::WsvSnapshot &snapshot) {
+      auto record = makeRecord();
+      auto chunk = record.mutable_snapshot();
+      chunk->mutable_header()->set_height(snapshot.height);
+      chunk->mutable_header()->set_block_hash(
+          shared_model::crypto::toBinaryString(snapshot.block_hash));
+      chunk->mutable_header()->set_state_digest(snapshot.state_digest);
+      enqueue(serialize(record), false);
+      for (const auto &rows : snapshot.rows) {
+        chunk->mutable_rows()->set_table(rows.table);
+        chunk->mutable_rows()->set_rows(rows.rows);
+        enqueue(serialize(record), false);
+      }
+      chunk->set_digest(
+          shared_model::crypto::toBinaryString(snapshot.digest()));
+      enqueue(serialize(record), false);
+    }
+
+    void TrafficCapture::proposal(
+        const consensus::Round &round,
+        const shared_model::interface::Proposal &proposal) {
+      auto record = makeRecord();
+      auto captured = record.mutable_proposal();
+      captured->set_block_round(round.block_round);
+      captured->set_reject_round(round.reject_round);
+      *captured->mutable_proposal() =
+          static_cast<const shared_model::proto::Proposal &>(proposal)
+              .getTransport();
+      enqueue(serialize(record), true);
+    }
+
+    void TrafficCapture::batch(
+        const shared_model::interface::TransactionBatch &batch) {
+      auto record = makeRecord();
+      auto transactions = record.mutable_batch()->mutable_transactions();
+      for (const auto &transaction : batch.transactions()) {
+        *transactions->Add() =
+            static_cast<const shared_model::proto::Transaction &>(*transaction)
+                .getTransport();
+      }
+      enqueue(serialize(record), true);
+    }
+
+    void TrafficCapture::block(const shared_model::interface::Block &block) {
+      auto record = makeRecord();
+      *record.mutable_block()->mutable_block_v1() =
+          static_cast<const shared_model::proto::Block &>(block).getTransport();
+      enqueue(serialize(record), true);
+    }
+
+    const Counter &TrafficCapture::written() const {
+      return written_;
+    }
+
+    const Counter &TrafficCapture::dropped() const {
+      return dropped_;
+    }
+
+    void TrafficCapture::enqueue(std::string record, bool droppable) {
+      {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        if (droppable and queue_.size() >= max_queued_) {
+          dropped_.increment();
+          return;
+        }
+        queue_.push_back(std::move(record));
+      }
+      queue_cv_.notify_one();
+    }
+
+  }  // namespace maintenance
+}  // namespace iroha
@@ -0,0 +1,89 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_MEMORY_BUDGET_HPP
+#define IROHA_MEMORY_BUDGET_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace maintenance {
+
+    /**
+     * Node-wide budget of the memory taken by the in-memory caches and
+     * states. The consumers report their approximate memory, and the ones
+     * which can be shrunk get the limits from the budget left by the others,
+     * the most critical first, so under pressure the least critical consumers
+     * shrink first. The limits are raised back when the pressure falls.
+     */
+    class MemoryBudget {
+     public:
+      struct Consumer {
+        /// name of the consumer in the metrics and in the log
+        std::string name;
+        /// consumers of the higher priority get their memory first
+        unsigned priority;
+        /// @return approximate memory taken by the consumer in bytes
+        std::function<size_t()> usage;
+        /// limits the memory of the consumer in bytes, empty if the consumer
+        /// cannot be shrunk and is only reported
+        std::function<void(size_t)> limit;
+      };
+
+      /**
+       * @param limit_bytes - budget of all the consumers, 0 for no limit
+       * @param log - logger
+       */
+      MemoryBudget(size_t limit_bytes, logger::LoggerPtr log);
+
+      ~MemoryBudget();
+
+      /// add the consumer, which has to outlive the budget
+      void addConsumer(Consumer consumer);
+
+      /// @return the budget of all the consumers, 0 for no limit
+      size_t limit() const;
+
+      /// @return names of the consumers with their approximate memory
+      std::vector<std::pair<std::string, size_t>> usage() const;
+
+      /**
+       * Divide the budget between the consumers and limit the ones which can
+       * be shrunk. Nothing is limited if there is no budget
+       */
+      void enforce();
+
+      /**
+       * Enforce the budget periodically on a separate thread till the budget
+       * is destroyed. Nothing is started if there is no budget
+       * @param period - time between the enforcements
+       */
+      void start(std::chrono::milliseconds period);
+
+     private:
+      const size_t limit_bytes_;
+      logger::LoggerPtr log_;
+
+      mutable std::mutex mutex_;
+      std::vector<Consumer> consumers_;
+
+      std::condition_variable stop_cv_;
+      bool stopped_ = false;
+      std::thread thread_;
+    };
+
+  }  // namespace maintenance
+}  // namespace iroha
+
+#endif  // IROHA_MEMORY_BUDGET_HPP
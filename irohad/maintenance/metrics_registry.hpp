@@ -0,0 +1,144 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_METRICS_REGISTRY_HPP
+#define IROHA_METRICS_REGISTRY_HPP
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/variant.hpp>
+#include "common/counter.hpp"
+#include "common/histogram.hpp"
+
+namespace iroha {
+  namespace maintenance {
+
+    /**
+     * Collection of the metrics of the components which is exposed in the
+     * Prometheus text format. The metrics are owned by the components, and
+     * the registry keeps them alive, so the values are updated without any
+     * interaction with the registry.
+     */
+    class MetricsRegistry {
+     public:
+      /// value of a gauge is calculated on every serialization
+      using Gauge = std::function<double()>;
+
+      /// label names and values of a sample
+      using Labels = std::vector<std::pair<std::string, std::string>>;
+
+      /// sample of a metric family
+      struct Sample {
+        Labels labels;
+        double value;
+      };
+
+      /// samples of a family are collected on every serialization
+      using Collector = std::function<std::vector<Sample>()>;
+
+      /// histogram of a histogram family
+      struct LabeledHistogram {
+        Labels labels;
+        std::shared_ptr<const Histogram> histogram;
+      };
+
+      /// histograms of a family are collected on every serialization
+      using HistogramCollector =
+          std::function<std::vector<LabeledHistogram>()>;
+
+      /**
+       * Add monotonic counter
+       * @param name - name of the metric, unique in the registry
+       * @param help - description of the metric
+       * @param counter - counter to expose
+       */
+      void addCounter(std::string name,
+                      std::string help,
+                      std::shared_ptr<const Counter> counter);
+
+      /**
+       * Add gauge
+       * @param name - name of the metric, unique in the registry
+       * @param help - description of the metric
+       * @param gauge - provider of the current value
+       */
+      void addGauge(std::string name, std::string help, Gauge gauge);
+
+      /**
+       * Add family of monotonic counters distinguished by the labels
+       * @param name - name of the metric, unique in the registry
+       * @param help - description of the metric
+       * @param collector - provider of the current samples
+       */
+      void addCounterFamily(std::string name,
+                            std::string help,
+                            Collector collector);
+
+      /**
+       * Add family of gauges distinguished by the labels
+       * @param name - name of the metric, unique in the registry
+       * @param help - description of the metric
+       * @param collector - provider of the current samples
+       */
+      void addGaugeFamily(std::string name,
+                          std::string help,
+                          Collector collector);
+
+      /**
+       * Add histogram
+       * @param name - name of the metric, unique in the registry
+       * @param help - description of the metric
+       * @param histogram - histogram to expose
+       */
+      void addHistogram(std::string name,
+                        std::string help,
+                        std::shared_ptr<const Histogram> histogram);
+
+      /**
+       * Add family of histograms distinguished by the labels
+       * @param name - name of the metric, unique in the registry
+       * @param help - description of the metric
+       * @param collector - provider of the current histograms
+       */
+      void addHistogramFamily(std::string name,
+                              std::string help,
+                              HistogramCollector collector);
+
+      /**
+       * @return all metrics in the Prometheus text exposition format
+       */
+      std::string serialize() const;
+
+     private:
+      struct Family {
+        /// type of the samples: counter or gauge
+        const char *type;
+        Collector collector;
+      };
+
+      struct Metric {
+        std::string name;
+        std::string help;
+        boost::variant<std::shared_ptr<const Counter>,
+                       Gauge,
+                       std::shared_ptr<const Histogram>,
+                       Family,
+                       HistogramCollector>
+            value;
+      };
+
+      mutable std::mutex mutex_;
+      std::vector<Metric> metrics_;
+    };
+
+  }  // namespace maintenance
+}  // namespace iroha
+
+#endif  // IROHA_METRICS_REGISTRY_HPP
@@ -0,0 +1,90 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_METRICS_SERVER_HPP
+#define IROHA_METRICS_SERVER_HPP
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <boost/asio.hpp>
+#include "common/result.hpp"
+#include "logger/logger_fwd.hpp"
+#include "maintenance/cpu_profiler.hpp"
+
+namespace iroha {
+  namespace maintenance {
+
+    class MetricsRegistry;
+
+    /**
+     * Minimal HTTP server which answers GET /metrics with the serialized
+     * registry, to be scraped by Prometheus. Every connection serves a single
+     * request, the requests are handled in a separate thread.
+     *
+     * GET /debug/profile?seconds=N collects a CPU profile of N seconds and
+     * returns it in the pprof format, when irohad is built with
+     * USE_GPERFTOOLS. The profile is collected in its own thread, so the
+     * metrics are served meanwhile.
+     */
+    class MetricsServer {
+     public:
+      /**
+       * @param registry - metrics to expose
+       * @param log - logger of the server
+       */
+      MetricsServer(std::shared_ptr<const MetricsRegistry> registry,
+                    logger::LoggerPtr log);
+
+      ~MetricsServer();
+
+      /**
+       * Bind the listening socket and start serving the requests
+       * @param address - ip address to listen on
+       * @param port - port to listen on, 0 selects a free port
+       * @return the bound port or error message
+       */
+      iroha::expected::Result<uint16_t, std::string> run(
+          const std::string &address, uint16_t port);
+
+     private:
+      void accept();
+
+      void serve(std::shared_ptr<boost::asio::ip::tcp::socket> socket);
+
+      void respond(std::shared_ptr<boost::asio::ip::tcp::socket> socket,
+                   std::string response);
+
+      /**
+       * Start the profile requested by the target and respond with it when
+       * it is collected
+       */
+      void profile(std::shared_ptr<boost::asio::ip::tcp::socket> socket,
+                   const std::string &target);
+
+      /**
+       * @param request_line - the first line of the HTTP request
+       * @return complete HTTP response
+       */
+      std::string makeResponse(const std::string &request_line) const;
+
+      std::shared_ptr<const MetricsRegistry> registry_;
+      logger::LoggerPtr log_;
+
+      boost::asio::io_service io_service_;
+      boost::asio::ip::tcp::acceptor acceptor_;
+      std::thread thread_;
+
+      CpuProfiler profiler_;
+      std::atomic<bool> profiling_{false};
+      std::thread profile_thread_;
+    };
+
+  }  // namespace maintenance
+}  // namespace iroha
+
+#endif  // IROHA_METRICS_SERVER_HPP
@@ -0,0 +1,52 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_OTLP_JSON_FILE_EXPORTER_HPP
+#define IROHA_OTLP_JSON_FILE_EXPORTER_HPP
+
+#include <fstream>
+#include <mutex>
+
+#include "maintenance/tracing.hpp"
+
+namespace iroha {
+  namespace tracing {
+
+    /**
+     * Appends the spans to a file in the OTLP JSON format, a trace export
+     * request per line, which is read by the otlpjsonfile receiver of the
+     * OpenTelemetry collector
+     */
+    class OtlpJsonFileExporter : public SpanExporter {
+     public:
+      /**
+       * @param path - file to append the spans to
+       * @param service_name - service.name attribute of the resource
+       */
+      OtlpJsonFileExporter(const std::string &path, std::string service_name);
+
+      /// @return whether the file is opened
+      bool isOpen() const;
+
+      void exportSpans(const std::vector<Span> &spans) override;
+
+      /**
+       * @param spans - spans to serialize
+       * @param service_name - service.name attribute of the resource
+       * @return the export request of the spans, without line break
+       */
+      static std::string serialize(const std::vector<Span> &spans,
+                                   const std::string &service_name);
+
+     private:
+      std::string service_name_;
+      std::mutex mutex_;
+      std::ofstream file_;
+    };
+
+  }  // namespace tracing
+}  // namespace iroha
+
+#endif  // IROHA_OTLP_JSON_FILE_EXPORTER_HPP
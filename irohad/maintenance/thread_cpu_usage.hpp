@@ -0,0 +1,43 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_THREAD_CPU_USAGE_HPP
+#define IROHA_THREAD_CPU_USAGE_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace iroha {
+  namespace maintenance {
+
+    class MetricsRegistry;
+
+    /// CPU time consumed by the threads with the same name
+    struct ThreadCpuUsage {
+      std::string name;
+      double user_seconds;
+      double system_seconds;
+    };
+
+    /**
+     * Read the CPU time of the live threads of the process from procfs. The
+     * threads are grouped by name, so the pools of short-living threads do
+     * not produce a sample per thread
+     * @return usage per thread name, empty if procfs is not available
+     */
+    std::vector<ThreadCpuUsage> readThreadCpuUsage();
+
+    /**
+     * Expose the CPU time per thread name as iroha_thread_cpu_seconds_total
+     * with the thread and mode labels
+     * @param registry - registry to add the metric to
+     */
+    void addThreadCpuMetrics(MetricsRegistry &registry);
+
+  }  // namespace maintenance
+}  // namespace iroha
+
+#endif  // IROHA_THREAD_CPU_USAGE_HPP
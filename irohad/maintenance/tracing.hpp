@@ -0,0 +1,125 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TRACING_HPP
+#define IROHA_TRACING_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cryptography/hash.hpp"
+
+namespace iroha {
+  namespace tracing {
+
+    using Clock = std::chrono::system_clock;
+
+    /**
+     * Finished span of a pipeline stage. The trace is keyed by the hash of
+     * the transaction, so the spans of all stages of a transaction make one
+     * trace without passing a context between the peers and the stages.
+     */
+    struct Span {
+      /// 16 bytes of the transaction hash, in hex
+      std::string trace_id;
+      uint64_t span_id;
+      std::string name;
+      Clock::time_point start;
+      Clock::time_point end;
+      std::vector<std::pair<std::string, std::string>> attributes;
+    };
+
+    /**
+     * Destination of the finished spans
+     */
+    class SpanExporter {
+     public:
+      virtual ~SpanExporter() = default;
+
+      /**
+       * Export the spans of one stage. Called concurrently by the stages,
+       * so the implementation must be thread safe
+       */
+      virtual void exportSpans(const std::vector<Span> &spans) = 0;
+    };
+
+    /**
+     * Samples the transactions by their hashes, the same way as the trace id
+     * ratio sampler of OpenTelemetry, so every stage and every peer samples
+     * the same transactions
+     */
+    class Tracer {
+     public:
+      /**
+       * @param sampling_rate - part of the transactions to trace, from 0 to 1
+       * @param exporter - destination of the spans
+       */
+      Tracer(double sampling_rate, std::shared_ptr<SpanExporter> exporter);
+
+      /// @return whether the spans of the transaction are recorded
+      bool isSampled(const shared_model::crypto::Hash &hash) const;
+
+      void exportSpans(const std::vector<Span> &spans) const;
+
+     private:
+      uint64_t threshold_;
+      std::shared_ptr<SpanExporter> exporter_;
+    };
+
+    /**
+     * Set the tracer of the pipeline stages. The tracer must be set before
+     * the pipeline is started, and must not be replaced while it runs
+     * @param tracer - the tracer, nullptr disables the tracing
+     */
+    void setTracer(std::shared_ptr<Tracer> tracer);
+
+    /// @return the tracer of the pipeline, nullptr if the tracing is disabled
+    const Tracer *getTracer();
+
+    /**
+     * Span of a pipeline stage, which lasts until the destruction and is
+     * recorded for every sampled transaction added to it. When the tracing is
+     * disabled, it costs a single check of the tracer.
+     */
+    class ScopedSpan {
+     public:
+      /**
+       * @param name - name of the stage
+       * @param start - start of the stage, if it has begun before the span
+       */
+      explicit ScopedSpan(const char *name, Clock::time_point start = {});
+
+      ~ScopedSpan();
+
+      ScopedSpan(const ScopedSpan &) = delete;
+      ScopedSpan &operator=(const ScopedSpan &) = delete;
+
+      /// @return whether the tracing is enabled, so the span may be recorded
+      explicit operator bool() const {
+        return tracer_ != nullptr;
+      }
+
+      /// Record the span for the transaction if it is sampled
+      void addTransaction(const shared_model::crypto::Hash &hash);
+
+      /// Add attribute to the recorded spans
+      void setAttribute(std::string key, std::string value);
+
+     private:
+      const Tracer *tracer_;
+      const char *name_;
+      Clock::time_point start_;
+      std::vector<std::string> trace_ids_;
+      std::vector<std::pair<std::string, std::string>> attributes_;
+    };
+
+  }  // namespace tracing
+}  // namespace iroha
+
+#endif  // IROHA_TRACING_HPP
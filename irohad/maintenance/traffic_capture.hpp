@@ -0,0 +1,120 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TRAFFIC_CAPTURE_HPP
+#define IROHA_TRAFFIC_CAPTURE_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "common/counter.hpp"
+#include "common/result.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+    class Proposal;
+    class TransactionBatch;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+    struct WsvSnapshot;
+  }
+
+  namespace consensus {
+    struct Round;
+  }
+
+  namespace maintenance {
+
+    /**
+     * Records the traffic of the peer to a capture file, which the
+     * replay_capture tool feeds to the validation and the commit offline:
+     * the WSV snapshot the traffic starts from, the proposals of the rounds,
+     * the batches received from the clients and the committed blocks. The
+     * file is a sequence of the length-delimited CaptureRecord messages of
+     * capture.proto.
+     *
+     * The records are serialized on the calling thread and written on a
+     * separate thread. When the writer lags behind by the configured number
+     * of records, the new proposals, batches and blocks are dropped and
+     * counted, so the capture never slows the peer down. The snapshot is
+     * never dropped.
+     */
+    class TrafficCapture {
+     public:
+      /**
+       * @param path - capture file, which is truncated
+       * @param max_queued - records waiting for the writer, after which the
+       * new ones are dropped
+       * @param log - logger
+       * @return capture or the error of opening the file
+       */
+      static expected::Result<std::shared_ptr<TrafficCapture>, std::string>
+      create(const std::string &path,
+             size_t max_queued,
+             logger::LoggerPtr log);
+
+      /// writes the queued records and closes the file
+      ~TrafficCapture();
+
+      /// record the WSV which the following traffic is applied to
+      void snapshot(const ametsuchi::WsvSnapshot &snapshot);
+
+      /// record the proposal of the round
+      void proposal(const consensus::Round &round,
+                    const shared_model::interface::Proposal &proposal);
+
+      /// record the batch received from a client
+      void batch(const shared_model::interface::TransactionBatch &batch);
+
+      /// record the committed block
+      void block(const shared_model::interface::Block &block);
+
+      /// records written to the file
+      const Counter &written() const;
+
+      /// records dropped because the writer lagged behind
+      const Counter &dropped() const;
+
+     private:
+      TrafficCapture(std::ofstream file,
+                     size_t max_queued,
+                     logger::LoggerPtr log);
+
+      /**
+       * Queue the serialized record for the writer
+       * @param record - length-delimited record
+       * @param droppable - whether the record is dropped if the queue is full
+       */
+      void enqueue(std::string record, bool droppable);
+
+      std::ofstream file_;
+      const size_t max_queued_;
+      logger::LoggerPtr log_;
+
+      std::mutex queue_mutex_;
+      std::condition_variable queue_cv_;
+      std::deque<std::string> queue_;
+      bool stopped_ = false;
+
+      Counter written_;
+      Counter dropped_;
+
+      std::thread thread_;
+    };
+
+  }  // namespace maintenance
+}  // namespace iroha
+
+#endif  // IROHA_TRAFFIC_CAPTURE_HPP
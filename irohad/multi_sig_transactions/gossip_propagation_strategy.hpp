@@ -7,6 +7,7 @@
 #define IROHA_GOSSIP_PROPAGATION_STRATEGY_HPP
 
 #include <boost/optional.hpp>
+#include <atomic>
 #include <chrono>
 #include <mutex>
 
@@ -24,6 +25,12 @@ namespace iroha {
    * Emits exactly (or zero if provider is empty) amount of peers
    * at some period
    * note: it can be inconsistent with the peer provider
+   *
+   * The period and the amount adapt to the reported state: the idle period
+   * is used while the state is empty, and the period shortens towards the
+   * minimal one and the amount grows towards the maximal one with the
+   * pending and the recently changed batches, so the idle peer does not
+   * chatter and the burst of batches converges faster
    */
   class GossipPropagationStrategy : public PropagationStrategy {
    public:
@@ -47,8 +54,31 @@ namespace iroha {
 
     rxcpp::observable<PropagationData> emitter() override;
 
+    void onStateChanged(size_t pending_batches,
+                        size_t changed_batches) override;
+
     // --------------------------| end override |---------------------------
    private:
+    /**
+     * Configuration with the unset bounds replaced by the fixed values
+     */
+    const GossipPropagationStrategyParams params;
+
+    /**
+     * Period of the ticks, at which the emission is considered
+     */
+    const std::chrono::milliseconds tick_period;
+
+    /**
+     * Batches in the own state
+     */
+    std::atomic<size_t> pending_batches{0};
+
+    /**
+     * Batches changed since the last emission
+     */
+    std::atomic<size_t> changed_batches{0};
+
     /**
      * Source of peers for propagation
      */
@@ -90,6 +120,21 @@ namespace iroha {
      * @return following peer
      */
     OptPeer visit();
+
+    /**
+     * @return part of the burst which the reported batches reach, from 0 to 1
+     */
+    double load() const;
+
+    /**
+     * @return period between the emissions for the reported state
+     */
+    std::chrono::milliseconds currentPeriod() const;
+
+    /**
+     * @return amount of peers emitted per once for the reported state
+     */
+    uint32_t currentAmount() const;
   };
 }  // namespace iroha
 
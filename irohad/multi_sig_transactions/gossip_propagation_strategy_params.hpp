@@ -15,6 +15,7 @@
 static constexpr std::chrono::milliseconds kDefaultPeriod =
     std::chrono::seconds(5);
 static constexpr uint32_t kDefaultAmount = 2;
+static constexpr uint32_t kDefaultBurstBatches = 100;
 
 namespace iroha {
   /**
@@ -26,6 +27,23 @@ namespace iroha {
 
     /// amount of data (peers) emitted per once
     uint32_t amount_per_once{kDefaultAmount};
+
+    /// period when the own state has no batches and did not change since
+    /// the last emission, emission_period if not set
+    boost::optional<std::chrono::milliseconds> idle_emission_period;
+
+    /// period of the burst, which emission_period is shortened to as the
+    /// pending and the changed batches grow, emission_period if not set
+    boost::optional<std::chrono::milliseconds> min_emission_period;
+
+    /// amount of peers emitted per once in the burst, which amount_per_once
+    /// is raised to as the pending and the changed batches grow,
+    /// amount_per_once if not set
+    boost::optional<uint32_t> max_amount_per_once;
+
+    /// pending batches and batches changed since the last emission, which
+    /// reach min_emission_period and max_amount_per_once
+    uint32_t burst_batches{kDefaultBurstBatches};
   };
 
 }  // namespace iroha
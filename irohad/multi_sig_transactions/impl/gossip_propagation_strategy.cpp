@@ -5,11 +5,14 @@
 
 #include "multi_sig_transactions/gossip_propagation_strategy.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <numeric>
 #include <random>
 
 #include <boost/assert.hpp>
 #include <boost/range/irange.hpp>
+#include <rxcpp/operators/rx-filter.hpp>
 #include <rxcpp/operators/rx-map.hpp>
 #include "common/bind.hpp"
 
@@ -20,28 +23,65 @@ namespace iroha {
   using PeerProviderFactory = GossipPropagationStrategy::PeerProviderFactory;
   using std::chrono::steady_clock;
 
+  namespace {
+    /// fill the unset bounds with the fixed values and order them
+    GossipPropagationStrategyParams normalize(
+        GossipPropagationStrategyParams params) {
+      params.emission_period =
+          std::max(params.emission_period, std::chrono::milliseconds{1});
+      params.idle_emission_period = std::max(
+          params.idle_emission_period.value_or(params.emission_period),
+          params.emission_period);
+      params.min_emission_period = std::max(
+          std::min(params.min_emission_period.value_or(params.emission_period),
+                   params.emission_period),
+          std::chrono::milliseconds{1});
+      params.max_amount_per_once =
+          std::max(params.max_amount_per_once.value_or(params.amount_per_once),
+                   params.amount_per_once);
+      return params;
+    }
+  }  // namespace
+
   GossipPropagationStrategy::GossipPropagationStrategy(
       PeerProviderFactory peer_factory,
       rxcpp::observe_on_one_worker emit_worker,
       const GossipPropagationStrategyParams &params)
-      : peer_factory(peer_factory),
+      : params(normalize(params)),
+        tick_period(*this->params.min_emission_period),
+        peer_factory(peer_factory),
         non_visited({}),
         emit_worker(emit_worker),
-        emitent(rxcpp::observable<>::interval(
-                    steady_clock::now(), params.emission_period, emit_worker)
-                    .map([this, params](int) {
-                      PropagationData vec;
-                      auto range = boost::irange(0u, params.amount_per_once);
-                      // push until find empty element
-                      std::find_if_not(
-                          range.begin(), range.end(), [this, &vec](int) {
-                            return this->visit() | [&vec](auto e) -> bool {
-                              vec.push_back(e);
-                              return true;  // proceed
-                            };
-                          });
-                      return vec;
-                    })) {}
+        emitent(rxcpp::observable<>::defer([this] {
+          // the ticks since the last emission of this subscription
+          auto idle_ticks = std::make_shared<long>(0);
+          return rxcpp::observable<>::interval(
+                     steady_clock::now(), tick_period, this->emit_worker)
+              .filter([this, idle_ticks](long) {
+                // the first tick emits as the fixed period does
+                if (*idle_ticks != 0
+                    and *idle_ticks * tick_period < currentPeriod()) {
+                  ++*idle_ticks;
+                  return false;
+                }
+                *idle_ticks = 1;
+                return true;
+              })
+              .map([this](long) {
+                PropagationData vec;
+                auto range = boost::irange(0u, currentAmount());
+                changed_batches = 0;
+                // push until find empty element
+                std::find_if_not(
+                    range.begin(), range.end(), [this, &vec](int) {
+                      return this->visit() | [&vec](auto e) -> bool {
+                        vec.push_back(e);
+                        return true;  // proceed
+                      };
+                    });
+                return vec;
+              });
+        })) {}
 
   rxcpp::observable<PropagationData> GossipPropagationStrategy::emitter() {
     return emitent;
@@ -72,6 +112,38 @@ namespace iroha {
     };
   }
 
+  void GossipPropagationStrategy::onStateChanged(size_t pending_batches,
+                                                 size_t changed_batches) {
+    this->pending_batches = pending_batches;
+    this->changed_batches += changed_batches;
+  }
+
+  double GossipPropagationStrategy::load() const {
+    if (params.burst_batches == 0) {
+      return 1.;
+    }
+    return std::min(
+        1.,
+        static_cast<double>(pending_batches + changed_batches)
+            / params.burst_batches);
+  }
+
+  std::chrono::milliseconds GossipPropagationStrategy::currentPeriod() const {
+    if (pending_batches == 0 and changed_batches == 0) {
+      return *params.idle_emission_period;
+    }
+    auto range = params.emission_period - *params.min_emission_period;
+    return params.emission_period
+        - std::chrono::duration_cast<std::chrono::milliseconds>(range
+                                                                * load());
+  }
+
+  uint32_t GossipPropagationStrategy::currentAmount() const {
+    auto range = *params.max_amount_per_once - params.amount_per_once;
+    return params.amount_per_once
+        + static_cast<uint32_t>(std::lround(range * load()));
+  }
+
   OptPeer GossipPropagationStrategy::visit() {
     std::lock_guard<std::mutex> lock(m);
     if (not peer_factory or (non_visited.empty() and not initQueue())) {
@@ -5,11 +5,9 @@
 
 #include "multi_sig_transactions/hash.hpp"
 
-#include <functional>
-#include <string>
-
 #include <boost/functional/hash.hpp>
 #include "cryptography/blob.hpp"
+#include "cryptography/hash.hpp"
 #include "cryptography/public_key.hpp"
 #include "interfaces/common_objects/peer.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
@@ -18,7 +16,7 @@ namespace iroha {
   namespace model {
 
     size_t PointerBatchHasher::operator()(const DataType &batch) const {
-      return std::hash<std::string>{}(batch->reducedHash().hex());
+      return shared_model::crypto::Hash::Hasher{}(batch->reducedHash());
     }
 
     std::size_t BlobHasher::operator()(
@@ -5,6 +5,7 @@
 
 #include <utility>
 
+#include "common/allocation_tracking.hpp"
 #include "logger/logger.hpp"
 #include "multi_sig_transactions/mst_processor_impl.hpp"
 
@@ -33,11 +34,13 @@ namespace iroha {
 
   auto FairMstProcessor::propagateBatchImpl(const iroha::DataType &batch)
       -> decltype(propagateBatch(batch)) {
+    ScopedAllocationTag allocation_tag(AllocationTag::kMst);
     auto state_update = storage_->updateOwnState(batch);
     completedBatchesNotify(*state_update.completed_state_);
     updatedBatchesNotify(*state_update.updated_state_);
     expiredBatchesNotify(
         storage_->extractExpiredTransactions(time_provider_->getCurrentTime()));
+    reportStateChange(state_update);
   }
 
   auto FairMstProcessor::onStateUpdateImpl() const
@@ -87,6 +90,7 @@ namespace iroha {
 
   void FairMstProcessor::onNewState(const shared_model::crypto::PublicKey &from,
                                     MstState new_state) {
+    ScopedAllocationTag allocation_tag(AllocationTag::kMst);
     log_->info("Applying new state");
     auto current_time = time_provider_->getCurrentTime();
 
@@ -105,12 +109,26 @@ namespace iroha {
     // expired batches
     // not nesessary to do it right here, just use the occasion to clean storage
     expiredBatchesNotify(storage_->extractExpiredTransactions(current_time));
+    reportStateChange(state_update);
+  }
+
+  bool FairMstProcessor::isMissing(const BatchDigest &digest) const {
+    return storage_->isMissing(digest);
   }
 
   // -----------------------------| private api |-----------------------------
 
+  void FairMstProcessor::reportStateChange(
+      const StateUpdateResult &state_update) {
+    strategy_->onStateChanged(
+        storage_->pendingBatches(),
+        state_update.completed_state_->batchesQuantity()
+            + state_update.updated_state_->batchesQuantity());
+  }
+
   void FairMstProcessor::onPropagate(
       const PropagationStrategy::PropagationData &data) {
+    ScopedAllocationTag allocation_tag(AllocationTag::kMst);
     auto current_time = time_provider_->getCurrentTime();
     auto size = data.size();
     std::for_each(data.begin(),
@@ -60,6 +60,8 @@ namespace iroha {
     void onNewState(const shared_model::crypto::PublicKey &from,
                     MstState new_state) override;
 
+    bool isMissing(const BatchDigest &digest) const override;
+
     // ----------------------------| end override |-----------------------------
 
    private:
@@ -71,6 +73,12 @@ namespace iroha {
      */
     void onPropagate(const PropagationStrategy::PropagationData &data);
 
+    /**
+     * Report the change of own state to the propagation strategy
+     * @param state_update - batches completed and updated by the change
+     */
+    void reportStateChange(const StateUpdateResult &state_update);
+
     /**
      * Notify subscribers when some of the batches received all necessary
      * signatures and ready to move forward
@@ -26,6 +26,15 @@ namespace iroha {
      * with respect to own strategy
      */
     virtual rxcpp::observable<PropagationData> emitter() = 0;
+
+    /**
+     * Report the change of the own state, which the strategy may adapt the
+     * propagation to
+     * @param pending_batches - batches in the own state after the change
+     * @param changed_batches - batches added, updated or completed by it
+     */
+    virtual void onStateChanged(size_t pending_batches,
+                                size_t changed_batches) {}
   };
 }  // namespace iroha
 
@@ -5,7 +5,7 @@
 
 #include "multi_sig_transactions/state/mst_state.hpp"
 
-#include <numeric>
+#include <cstring>
 #include <utility>
 #include <vector>
 
@@ -15,6 +15,7 @@
 #include <boost/range/algorithm/find.hpp>
 #include <boost/range/combine.hpp>
 #include "common/set.hpp"
+#include "cryptography/public_key.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
 
@@ -45,24 +46,57 @@ namespace iroha {
     return left_tx->reducedHash() == right_tx->reducedHash();
   }
 
+  bool BatchDigest::TransactionDigest::operator==(
+      const TransactionDigest &rhs) const {
+    return signatures == rhs.signatures and signatories == rhs.signatories;
+  }
+
+  BatchDigest makeBatchDigest(const DataType &batch) {
+    BatchDigest digest{batch->reducedHash(), {}};
+    for (const auto &tx : batch->transactions()) {
+      BatchDigest::TransactionDigest tx_digest{0, 0};
+      for (const auto &signature : tx->signatures()) {
+        const auto &public_key = signature.publicKey().blob();
+        uint64_t prefix = 0;
+        std::memcpy(&prefix,
+                    public_key.data(),
+                    std::min(sizeof(prefix), public_key.size()));
+        tx_digest.signatories ^= prefix;
+        ++tx_digest.signatures;
+      }
+      digest.transactions.push_back(tx_digest);
+    }
+    return digest;
+  }
+
   DefaultCompleter::DefaultCompleter(std::chrono::minutes expiration_time)
       : expiration_time_(expiration_time) {}
 
   bool DefaultCompleter::isCompleted(const DataType &batch) const {
-    return std::all_of(batch->transactions().begin(),
-                       batch->transactions().end(),
-                       [](const auto &tx) {
-                         return boost::size(tx->signatures()) >= tx->quorum();
-                       });
+    return std::all_of(
+        batch->transactions().begin(),
+        batch->transactions().end(),
+        [this](const auto &tx) { return missingSignatures(*tx) == 0; });
+  }
+
+  size_t DefaultCompleter::missingSignatures(
+      const shared_model::interface::Transaction &tx) const {
+    auto signatures = boost::size(tx.signatures());
+    return signatures >= tx.quorum() ? 0 : tx.quorum() - signatures;
   }
 
   bool DefaultCompleter::isExpired(const DataType &batch,
                                    const TimeType &current_time) const {
     return oldestTimestamp(batch)
-        + expiration_time_ / std::chrono::milliseconds(1)
+        + expiration_time_.load() / std::chrono::milliseconds(1)
         < current_time;
   }
 
+  void DefaultCompleter::setExpirationTime(
+      std::chrono::minutes expiration_time) {
+    expiration_time_ = expiration_time;
+  }
+
   // ------------------------------| public api |-------------------------------
 
   MstState MstState::empty(logger::LoggerPtr log,
@@ -82,19 +116,18 @@ namespace iroha {
     auto state_update = StateUpdateResult{
         std::make_shared<MstState>(MstState::empty(log_, completer_)),
         std::make_shared<MstState>(MstState::empty(log_, completer_))};
-    for (auto &&rhs_tx : rhs.batches_.right | boost::adaptors::map_keys) {
-      insertOne(state_update, rhs_tx);
+    for (auto &&rhs_tx : rhs.batches_ | boost::adaptors::map_values) {
+      insertOne(state_update, rhs_tx.batch);
     }
     return state_update;
   }
 
   MstState MstState::operator-(const MstState &rhs) const {
-    const auto &my_batches = batches_.right | boost::adaptors::map_keys;
     std::vector<DataType> difference;
-    difference.reserve(boost::size(batches_));
-    for (const auto &batch : my_batches) {
-      if (rhs.batches_.right.find(batch) == rhs.batches_.right.end()) {
-        difference.push_back(batch);
+    difference.reserve(batches_.size());
+    for (const auto &batch : batches_ | boost::adaptors::map_values) {
+      if (rhs.batches_.count(batch.batch->reducedHash()) == 0) {
+        difference.push_back(batch.batch);
       }
     }
     return MstState(this->completer_, difference, log_);
@@ -104,11 +137,38 @@ namespace iroha {
     return batches_.empty();
   }
 
+  size_t MstState::batchesQuantity() const {
+    return batches_.size();
+  }
+
+  size_t MstState::memoryUsage() const {
+    // a node of the map holds the pointer to the next one besides the element
+    constexpr size_t kNodeBytes = sizeof(void *);
+    size_t usage = sizeof(*this) + batches_.bucket_count() * sizeof(void *);
+    for (const auto &entry : batches_) {
+      usage += kNodeBytes + sizeof(entry) + entry.first.blob().size()
+          + entry.second.missing_signatures.capacity() * sizeof(size_t)
+          + sizeof(*entry.second.batch);
+      for (const auto &tx : entry.second.batch->transactions()) {
+        usage += tx->blob().size();
+      }
+    }
+    // the nodes of the tree hold three pointers and the color
+    for (const auto &bucket : expiry_buckets_) {
+      usage += 4 * sizeof(void *) + sizeof(bucket)
+          + bucket.second.batches.capacity() * sizeof(DataType);
+    }
+    return usage;
+  }
+
   std::unordered_set<DataType,
                      iroha::model::PointerBatchHasher,
                      BatchHashEquality>
   MstState::getBatches() const {
-    const auto batches_range = batches_.right | boost::adaptors::map_keys;
+    const auto batches_range =
+        batches_ | boost::adaptors::map_values
+        | boost::adaptors::transformed(
+              [](const BatchEntry &entry) { return entry.batch; });
     return {batches_range.begin(), batches_range.end()};
   }
 
@@ -124,27 +184,25 @@ namespace iroha {
 
   // ------------------------------| private api |------------------------------
 
-  /**
-   * Merge signatures in batches
-   * @param target - batch for inserting
-   * @param donor - batch with transactions to copy signatures from
-   * @return return if at least one new signature was inserted
-   */
-  bool mergeSignaturesInBatch(DataType &target, const DataType &donor) {
+  bool MstState::mergeSignatures(BatchEntry &entry,
+                                 const DataType &donor) {
     auto inserted_new_signatures = false;
+    auto missing_signatures = entry.missing_signatures.begin();
     for (auto zip :
-         boost::combine(target->transactions(), donor->transactions())) {
+         boost::combine(entry.batch->transactions(), donor->transactions())) {
       const auto &target_tx = zip.get<0>();
       const auto &donor_tx = zip.get<1>();
-      inserted_new_signatures = std::accumulate(
-          std::begin(donor_tx->signatures()),
-          std::end(donor_tx->signatures()),
-          inserted_new_signatures,
-          [&target_tx](bool accumulator, const auto &signature) {
-            return target_tx->addSignature(signature.signedData(),
-                                           signature.publicKey())
-                or accumulator;
-          });
+      auto &missing = *missing_signatures++;
+      for (const auto &signature : donor_tx->signatures()) {
+        if (not target_tx->addSignature(signature.signedData(),
+                                        signature.publicKey())) {
+          continue;
+        }
+        inserted_new_signatures = true;
+        if (missing != 0 and --missing == 0) {
+          --entry.incomplete_txs;
+        }
+      }
     }
     return inserted_new_signatures;
   }
@@ -157,57 +215,118 @@ namespace iroha {
                      logger::LoggerPtr log)
       : completer_(completer), log_(std::move(log)) {
     for (const auto &batch : batches) {
-      batches_.insert({oldestTimestamp(batch), batch});
+      rawInsert(batch);
     }
   }
 
   void MstState::insertOne(StateUpdateResult &state_update,
                            const DataType &rhs_batch) {
     log_->info("batch: {}", *rhs_batch);
-    auto corresponding = batches_.right.find(rhs_batch);
-    if (corresponding == batches_.right.end()) {
+    auto corresponding = batches_.find(rhs_batch->reducedHash());
+    if (corresponding == batches_.end()) {
       // when state does not contain transaction
       rawInsert(rhs_batch);
       state_update.updated_state_->rawInsert(rhs_batch);
       return;
     }
 
-    DataType found = corresponding->first;
+    auto &entry = corresponding->second;
     // Append new signatures to the existing state
-    auto inserted_new_signatures = mergeSignaturesInBatch(found, rhs_batch);
+    auto inserted_new_signatures = mergeSignatures(entry, rhs_batch);
 
-    if (completer_->isCompleted(found)) {
+    if (entry.incomplete_txs == 0) {
       // state already has completed transaction,
       // remove from state and return it
-      batches_.right.erase(found);
-      state_update.completed_state_->rawInsert(found);
+      state_update.completed_state_->rawInsert(entry);
+      batches_.erase(corresponding);
       return;
     }
 
     // if batch still isn't completed, return it, if new signatures were
     // inserted
     if (inserted_new_signatures) {
-      state_update.updated_state_->rawInsert(found);
+      state_update.updated_state_->rawInsert(entry);
     }
   }
 
   void MstState::rawInsert(const DataType &rhs_batch) {
-    batches_.insert({oldestTimestamp(rhs_batch), rhs_batch});
+    BatchEntry entry{rhs_batch, {}, 0};
+    entry.missing_signatures.reserve(boost::size(rhs_batch->transactions()));
+    for (const auto &tx : rhs_batch->transactions()) {
+      entry.missing_signatures.push_back(completer_->missingSignatures(*tx));
+      if (entry.missing_signatures.back() != 0) {
+        ++entry.incomplete_txs;
+      }
+    }
+    rawInsert(std::move(entry));
+  }
+
+  void MstState::rawInsert(BatchEntry entry) {
+    auto rhs_batch = entry.batch;
+    if (not batches_.emplace(rhs_batch->reducedHash(), std::move(entry))
+                .second) {
+      return;
+    }
+    auto timestamp = oldestTimestamp(rhs_batch);
+    auto &bucket =
+        expiry_buckets_[timestamp - timestamp % kExpiryBucketWidth];
+    if (not bucket.oldest or timestamp < bucket.oldest_time) {
+      bucket.oldest = rhs_batch;
+      bucket.oldest_time = timestamp;
+    }
+    bucket.batches.push_back(rhs_batch);
   }
 
   bool MstState::contains(const DataType &element) const {
-    return batches_.right.find(element) != batches_.right.end();
+    return batches_.count(element->reducedHash()) != 0;
+  }
+
+  bool MstState::isMissing(const BatchDigest &digest) const {
+    auto it = batches_.find(digest.reduced_hash);
+    if (it == batches_.end()) {
+      return true;
+    }
+    return makeBatchDigest(it->second.batch).transactions
+        != digest.transactions;
   }
 
   void MstState::extractExpiredImpl(const TimeType &current_time,
                                     boost::optional<MstState &> extracted) {
-    for (auto it = batches_.left.begin(); it != batches_.left.end()
-         and completer_->isExpired(it->second, current_time);) {
-      if (extracted) {
-        *extracted += it->second;
+    for (auto bucket_it = expiry_buckets_.begin();
+         bucket_it != expiry_buckets_.end()
+         and completer_->isExpired(bucket_it->second.oldest, current_time);) {
+      auto &bucket = bucket_it->second;
+      auto kept = bucket.batches.begin();
+      for (auto &batch : bucket.batches) {
+        auto it = batches_.find(batch->reducedHash());
+        if (it == batches_.end() or it->second.batch != batch) {
+          // the batch has already left the state
+          continue;
+        }
+        if (not completer_->isExpired(batch, current_time)) {
+          *kept++ = std::move(batch);
+          continue;
+        }
+        if (extracted) {
+          *extracted += batch;
+        }
+        batches_.erase(it);
+      }
+      bucket.batches.erase(kept, bucket.batches.end());
+
+      if (not bucket.batches.empty()) {
+        // the rest of the batches are not expired either
+        auto oldest = std::min_element(
+            bucket.batches.begin(),
+            bucket.batches.end(),
+            [](const auto &lhs, const auto &rhs) {
+              return oldestTimestamp(lhs) < oldestTimestamp(rhs);
+            });
+        bucket.oldest = *oldest;
+        bucket.oldest_time = oldestTimestamp(*oldest);
+        break;
       }
-      it = batches_.left.erase(it);
-      assert(it == batches_.left.begin());
+      bucket_it = expiry_buckets_.erase(bucket_it);
     }
   }
 
@@ -7,14 +7,13 @@
 #define IROHA_MST_STATE_HPP
 
 #include <algorithm>  // std::for_each
+#include <atomic>
 #include <chrono>
-#include <queue>
+#include <map>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
-#include <boost/bimap.hpp>
-#include <boost/bimap/multiset_of.hpp>
-#include <boost/bimap/unordered_set_of.hpp>
 #include <boost/optional/optional.hpp>
 #include <boost/range/adaptor/map.hpp>
 #include <boost/range/any_range.hpp>
@@ -38,6 +37,16 @@ namespace iroha {
      */
     virtual bool isCompleted(const DataType &batch) const = 0;
 
+    /**
+     * Count the signatures the transaction lacks to be completed. The state
+     * tracks the completion of its batches with these counts, assuming that
+     * every new signature of a transaction decreases the count by one
+     * @param tx - target object for verification
+     * @return number of the missing signatures, 0 if complete
+     */
+    virtual size_t missingSignatures(
+        const shared_model::interface::Transaction &tx) const = 0;
+
     /**
      * Check whether the batch has expired
      * @param batch - object for validation
@@ -62,6 +71,31 @@ namespace iroha {
     bool operator()(const DataType &left_tx, const DataType &right_tx) const;
   };
 
+  /**
+   * Compact description of a batch and its signatures, which peers exchange
+   * to find out which batches they miss without sending the batches
+   */
+  struct BatchDigest {
+    struct TransactionDigest {
+      /// number of the signatures of the transaction
+      size_t signatures;
+      /// xor of the first 8 bytes of the public keys of the signatures
+      uint64_t signatories;
+
+      bool operator==(const TransactionDigest &rhs) const;
+    };
+
+    shared_model::crypto::Hash reduced_hash;
+    std::vector<TransactionDigest> transactions;
+  };
+
+  /**
+   * Make the digest of the batch
+   * @param batch - batch to describe
+   * @return digest with the reduced hash and the signatures of the batch
+   */
+  BatchDigest makeBatchDigest(const DataType &batch);
+
   /**
    * Class provides the default behavior for the batch completer.
    * Complete, if all transactions have at least quorum number of signatures.
@@ -77,11 +111,21 @@ namespace iroha {
 
     bool isCompleted(const DataType &batch) const override;
 
+    size_t missingSignatures(
+        const shared_model::interface::Transaction &tx) const override;
+
     bool isExpired(const DataType &tx,
                    const TimeType &current_time) const override;
 
+    /**
+     * Change the expiration time of the batches, which is applied on the
+     * next check of the expired batches. May be called from any thread
+     * @param expiration_time - expiration time in minutes
+     */
+    void setExpirationTime(std::chrono::minutes expiration_time);
+
    private:
-    std::chrono::minutes expiration_time_;
+    std::atomic<std::chrono::minutes> expiration_time_;
   };
 
   using CompleterType = std::shared_ptr<const Completer>;
@@ -128,6 +172,17 @@ namespace iroha {
      */
     bool isEmpty() const;
 
+    /**
+     * @return number of the batches inside
+     */
+    size_t batchesQuantity() const;
+
+    /**
+     * @return approximate memory taken by the batches of the state and its
+     * indices in bytes, the transactions are counted by their serialized size
+     */
+    size_t memoryUsage() const;
+
     /**
      * @return the batches from the state
      */
@@ -156,19 +211,28 @@ namespace iroha {
      */
     bool contains(const DataType &element) const;
 
+    /**
+     * Check, if this MST state lacks the batch or some of its signatures
+     * @param digest of the batch from other peer
+     * @return true, if the state does not contain the batch or the signatures
+     * of its transactions differ
+     */
+    bool isMissing(const BatchDigest &digest) const;
+
     /// Apply visitor to all batches.
     template <typename Visitor>
     inline void iterateBatches(const Visitor &visitor) const {
-      const auto batches_range = batches_.right | boost::adaptors::map_keys;
-      std::for_each(batches_range.begin(), batches_range.end(), visitor);
+      for (const auto &batch : batches_ | boost::adaptors::map_values) {
+        visitor(batch.batch);
+      }
     }
 
     /// Apply visitor to all transactions.
     template <typename Visitor>
     inline void iterateTransactions(const Visitor &visitor) const {
-      for (const auto &batch : batches_.right | boost::adaptors::map_keys) {
-        std::for_each(batch->transactions().begin(),
-                      batch->transactions().end(),
+      for (const auto &batch : batches_ | boost::adaptors::map_values) {
+        std::for_each(batch.batch->transactions().begin(),
+                      batch.batch->transactions().end(),
                       visitor);
       }
     }
@@ -179,12 +243,37 @@ namespace iroha {
     using BatchesForwardCollectionType = boost::
         any_range<BatchPtr, boost::forward_traversal_tag, const BatchPtr &>;
 
-    using BatchesBimap = boost::bimap<
-        boost::bimaps::multiset_of<
-            shared_model::interface::types::TimestampType>,
-        boost::bimaps::unordered_set_of<DataType,
-                                        iroha::model::PointerBatchHasher,
-                                        BatchHashEquality>>;
+    /**
+     * Batch with the counts of the signatures its transactions lack, which
+     * are updated with every new signature
+     */
+    struct BatchEntry {
+      DataType batch;
+      /// signatures each of the transactions lacks to be completed
+      std::vector<size_t> missing_signatures;
+      /// number of the transactions which lack signatures
+      size_t incomplete_txs;
+    };
+
+    using BatchesMap = std::unordered_map<shared_model::crypto::Hash,
+                                          BatchEntry,
+                                          shared_model::crypto::Hash::Hasher>;
+
+    /**
+     * Batches with the oldest timestamps within the same bucket. The entries
+     * of the batches which have left the state are dropped lazily, when the
+     * bucket is checked for the expired batches
+     */
+    struct ExpiryBucket {
+      /// the batch with the oldest timestamp in the bucket
+      DataType oldest;
+      shared_model::interface::types::TimestampType oldest_time;
+      std::vector<DataType> batches;
+    };
+
+    /// width of the expiry buckets in milliseconds
+    static constexpr shared_model::interface::types::TimestampType
+        kExpiryBucketWidth = 1000;
 
     MstState(const CompleterType &completer, logger::LoggerPtr log);
 
@@ -207,7 +296,24 @@ namespace iroha {
     void rawInsert(const DataType &rhs_tx);
 
     /**
-     * Erase expired batches, optionally returning them.
+     * Insert new value in state with the counts of its missing signatures
+     * @param entry - data for insertion
+     */
+    void rawInsert(BatchEntry entry);
+
+    /**
+     * Add the signatures of the donor to the batch of the entry and update
+     * the counts of the missing signatures
+     * @param entry - entry of the batch for inserting
+     * @param donor - batch with transactions to copy signatures from
+     * @return true, if at least one new signature was inserted
+     */
+    static bool mergeSignatures(BatchEntry &entry, const DataType &donor);
+
+    /**
+     * Erase expired batches, optionally returning them. The batches expire
+     * in the order of their oldest timestamps, so only the buckets up to the
+     * first one with an unexpired batch are checked.
      * @param current_time - current time
      * @param extracted - optional storage for extracted batches.
      */
@@ -218,7 +324,12 @@ namespace iroha {
 
     CompleterType completer_;
 
-    BatchesBimap batches_;
+    /// batches by their reduced hashes
+    BatchesMap batches_;
+
+    /// expiry buckets by the start of their time ranges
+    std::map<shared_model::interface::types::TimestampType, ExpiryBucket>
+        expiry_buckets_;
 
     logger::LoggerPtr log_;
   };
@@ -0,0 +1,204 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "multi_sig_transactions/storage/mst_journal.hpp"
+
+#include <unordered_map>
+
+#include <boost/filesystem.hpp>
+#include "backend/protobuf/transaction.hpp"
+#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
+#include "logger/logger.hpp"
+#include "mst.pb.h"
+#include "multi_sig_transactions/state/mst_state.hpp"
+
+namespace {
+  using RecordSizeType = uint32_t;
+
+  /// @return record of the batch, with the transactions unless erased
+  iroha::network::transport::MstJournalRecord makeRecord(
+      const iroha::DataType &batch, bool erased) {
+    iroha::network::transport::MstJournalRecord record;
+    record.set_reduced_hash(
+        shared_model::crypto::toBinaryString(batch->reducedHash()));
+    if (not erased) {
+      for (const auto &tx : batch->transactions()) {
+        *record.add_transactions() =
+            std::static_pointer_cast<shared_model::proto::Transaction>(tx)
+                ->getTransport();
+      }
+    }
+    return record;
+  }
+}  // namespace
+
+namespace iroha {
+
+  boost::optional<std::unique_ptr<MstJournal>> MstJournal::create(
+      const std::string &path, logger::LoggerPtr log) {
+    std::unique_ptr<MstJournal> journal(new MstJournal(path, std::move(log)));
+    if (not journal->load()) {
+      return boost::none;
+    }
+    return boost::make_optional(std::move(journal));
+  }
+
+  const std::vector<DataType> &MstJournal::restoredBatches() const {
+    return restored_batches_;
+  }
+
+  void MstJournal::append(const MstState &state) {
+    if (state.isEmpty()) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    state.iterateBatches([this](const auto &batch) {
+      auto record = makeRecord(batch, false);
+      batches_.insert(record.reduced_hash());
+      this->write(out_, record);
+    });
+    flush();
+  }
+
+  void MstJournal::erase(const MstState &state) {
+    if (state.isEmpty()) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    state.iterateBatches([this](const auto &batch) {
+      auto record = makeRecord(batch, true);
+      batches_.erase(record.reduced_hash());
+      this->write(out_, record);
+    });
+    flush();
+  }
+
+  bool MstJournal::needsCompaction() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return records_ >= kMinCompactionRecords
+        and records_ > 2 * batches_.size();
+  }
+
+  void MstJournal::compact(
+      const std::function<std::vector<DataType>()> &batches) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto temp_path = path_ + ".tmp";
+    std::unordered_set<std::string> written;
+    auto records = records_;
+    {
+      std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+      records_ = 0;
+      for (const auto &batch : batches()) {
+        auto record = makeRecord(batch, false);
+        written.insert(record.reduced_hash());
+        write(out, record);
+      }
+      out.flush();
+      if (not out.good()) {
+        log_->warn("Cannot write the compacted MST journal {}", temp_path);
+        records_ = records;
+        return;
+      }
+    }
+
+    out_.close();
+    boost::system::error_code err;
+    boost::filesystem::rename(temp_path, path_, err);
+    if (err) {
+      log_->warn("Cannot replace the MST journal {}: {}", path_, err.message());
+      records_ = records;
+    } else {
+      log_->info("Compacted the MST journal from {} to {} records",
+                 records,
+                 records_);
+      batches_ = std::move(written);
+    }
+    out_.open(path_, std::ios::binary | std::ios::app);
+  }
+
+  MstJournal::MstJournal(std::string path, logger::LoggerPtr log)
+      : path_(std::move(path)), log_(std::move(log)) {}
+
+  bool MstJournal::load() {
+    // the latest record of a batch has all of its signatures
+    std::unordered_map<std::string, network::transport::MstJournalRecord>
+        records;
+    uint64_t valid_size = 0;
+    {
+      std::ifstream in(path_, std::ios::binary);
+      RecordSizeType size;
+      std::string buffer;
+      while (in.read(reinterpret_cast<char *>(&size), sizeof(size))) {
+        buffer.resize(size);
+        network::transport::MstJournalRecord record;
+        if (not in.read(&buffer[0], size)
+            or not record.ParseFromString(buffer)) {
+          break;
+        }
+        valid_size += sizeof(size) + size;
+        ++records_;
+        if (record.transactions_size() == 0) {
+          records.erase(record.reduced_hash());
+        } else {
+          auto reduced_hash = record.reduced_hash();
+          records[reduced_hash] = std::move(record);
+        }
+      }
+    }
+
+    boost::system::error_code err;
+    if (boost::filesystem::exists(path_, err)
+        and boost::filesystem::file_size(path_, err) > valid_size) {
+      log_->warn("Cutting off the incomplete record of the MST journal {}",
+                 path_);
+      boost::filesystem::resize_file(path_, valid_size, err);
+      if (err) {
+        log_->error(
+            "Cannot cut the MST journal {}: {}", path_, err.message());
+        return false;
+      }
+    }
+
+    out_.open(path_, std::ios::binary | std::ios::app);
+    if (not out_.is_open()) {
+      log_->error("Cannot open the MST journal {}", path_);
+      return false;
+    }
+
+    for (auto &record : records) {
+      shared_model::interface::types::SharedTxsCollectionType transactions;
+      for (auto &tx : *record.second.mutable_transactions()) {
+        transactions.push_back(
+            std::make_shared<shared_model::proto::Transaction>(std::move(tx)));
+      }
+      restored_batches_.push_back(
+          std::make_shared<shared_model::interface::TransactionBatchImpl>(
+              std::move(transactions)));
+      batches_.insert(record.first);
+    }
+    log_->info("Restored {} batches from {} records of the MST journal {}",
+               restored_batches_.size(),
+               records_,
+               path_);
+    return true;
+  }
+
+  void MstJournal::write(std::ofstream &out,
+                         const network::transport::MstJournalRecord &record) {
+    auto size = static_cast<RecordSizeType>(record.ByteSizeLong());
+    out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    record.SerializeToOstream(&out);
+    ++records_;
+  }
+
+  void MstJournal::flush() {
+    out_.flush();
+    if (not out_.good()) {
+      log_->warn("Cannot write to the MST journal {}", path_);
+      out_.clear();
+    }
+  }
+
+}  // namespace iroha
@@ -13,34 +13,37 @@ namespace iroha {
   StateUpdateResult MstStorage::apply(
       const shared_model::crypto::PublicKey &target_peer_key,
       const MstState &new_state) {
-    std::lock_guard<std::mutex> lock{this->mutex_};
     return applyImpl(target_peer_key, new_state);
   }
 
   StateUpdateResult MstStorage::updateOwnState(const DataType &tx) {
-    std::lock_guard<std::mutex> lock{this->mutex_};
     return updateOwnStateImpl(tx);
   }
 
   MstState MstStorage::extractExpiredTransactions(
       const TimeType &current_time) {
-    std::lock_guard<std::mutex> lock{this->mutex_};
     return extractExpiredTransactionsImpl(current_time);
   }
 
   MstState MstStorage::getDiffState(
       const shared_model::crypto::PublicKey &target_peer_key,
       const TimeType &current_time) {
-    std::lock_guard<std::mutex> lock{this->mutex_};
     return getDiffStateImpl(target_peer_key, current_time);
   }
 
   MstState MstStorage::whatsNew(ConstRefState new_state) const {
-    std::lock_guard<std::mutex> lock{this->mutex_};
     return whatsNewImpl(new_state);
   }
 
   bool MstStorage::batchInStorage(const DataType &batch) const {
     return batchInStorageImpl(batch);
   }
+
+  bool MstStorage::isMissing(const BatchDigest &digest) const {
+    return isMissingImpl(digest);
+  }
+
+  size_t MstStorage::pendingBatches() const {
+    return pendingBatchesImpl();
+  }
 }  // namespace iroha
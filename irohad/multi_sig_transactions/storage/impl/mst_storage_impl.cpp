@@ -5,70 +5,205 @@
 
 #include "multi_sig_transactions/storage/mst_storage_impl.hpp"
 
+#include <algorithm>
+
 namespace iroha {
   // ------------------------------| private API |------------------------------
 
+  MstStorageStateImpl::Shard::Shard(const CompleterType &completer,
+                                    logger::LoggerPtr mst_state_logger)
+      : own_state(MstState::empty(std::move(mst_state_logger), completer)) {}
+
   auto MstStorageStateImpl::getState(
-      const shared_model::crypto::PublicKey &target_peer_key) {
-    auto target_state_iter = peer_states_.find(target_peer_key);
-    if (target_state_iter == peer_states_.end()) {
-      return peer_states_
-          .insert(
-              {target_peer_key, MstState::empty(mst_state_logger_, completer_)})
-          .first;
+      Shard &shard,
+      const shared_model::crypto::PublicKey &target_peer_key) const {
+    auto target_state_iter = shard.peer_states.find(target_peer_key);
+    if (target_state_iter == shard.peer_states.end()) {
+      return shard.peer_states.insert({target_peer_key, emptyState()}).first;
     }
     return target_state_iter;
   }
+
+  size_t MstStorageStateImpl::shardIndex(
+      const shared_model::crypto::Hash &reduced_hash) const {
+    return shared_model::crypto::Hash::Hasher{}(reduced_hash) % shards_.size();
+  }
+
+  MstStorageStateImpl::Shard &MstStorageStateImpl::shardOf(
+      const shared_model::crypto::Hash &reduced_hash) const {
+    return *shards_[shardIndex(reduced_hash)];
+  }
+
+  std::vector<MstState> MstStorageStateImpl::split(ConstRefState state) const {
+    std::vector<MstState> states(shards_.size(), emptyState());
+    state.iterateBatches([this, &states](const auto &batch) {
+      states[shardIndex(batch->reducedHash())] += batch;
+    });
+    return states;
+  }
+
+  MstState MstStorageStateImpl::emptyState() const {
+    return MstState::empty(mst_state_logger_, completer_);
+  }
+
+  void MstStorageStateImpl::journal(const StateUpdateResult &result) const {
+    if (journal_) {
+      journal_->append(*result.updated_state_);
+      journal_->erase(*result.completed_state_);
+    }
+  }
+
+  std::vector<DataType> MstStorageStateImpl::ownBatches() const {
+    std::vector<DataType> batches;
+    for (const auto &shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      shard->own_state.iterateBatches(
+          [&batches](const auto &batch) { batches.push_back(batch); });
+    }
+    return batches;
+  }
+
   // -----------------------------| interface API |-----------------------------
 
   MstStorageStateImpl::MstStorageStateImpl(const CompleterType &completer,
                                            logger::LoggerPtr mst_state_logger,
-                                           logger::LoggerPtr log)
+                                           logger::LoggerPtr log,
+                                           std::shared_ptr<MstJournal> journal,
+                                           size_t shards)
       : MstStorage(log),
         completer_(completer),
-        own_state_(MstState::empty(mst_state_logger, completer_)),
-        mst_state_logger_(std::move(mst_state_logger)) {}
+        journal_(std::move(journal)),
+        mst_state_logger_(std::move(mst_state_logger)) {
+    shards_.reserve(std::max<size_t>(shards, 1));
+    for (size_t i = 0; i < std::max<size_t>(shards, 1); ++i) {
+      shards_.push_back(std::make_unique<Shard>(completer_, mst_state_logger_));
+    }
+    if (journal_) {
+      for (const auto &batch : journal_->restoredBatches()) {
+        shardOf(batch->reducedHash()).own_state += batch;
+      }
+    }
+  }
 
   auto MstStorageStateImpl::applyImpl(
       const shared_model::crypto::PublicKey &target_peer_key,
       const MstState &new_state)
       -> decltype(apply(target_peer_key, new_state)) {
-    auto target_state_iter = getState(target_peer_key);
-    target_state_iter->second += new_state;
-    return own_state_ += new_state;
+    StateUpdateResult result{std::make_shared<MstState>(emptyState()),
+                             std::make_shared<MstState>(emptyState())};
+    auto states = split(new_state);
+    for (size_t i = 0; i < shards_.size(); ++i) {
+      if (states[i].isEmpty()) {
+        continue;
+      }
+      auto &shard = *shards_[i];
+      std::unique_lock<std::mutex> lock(shard.mutex);
+      getState(shard, target_peer_key)->second += states[i];
+      auto shard_result = shard.own_state += states[i];
+      lock.unlock();
+      *result.completed_state_ += *shard_result.completed_state_;
+      *result.updated_state_ += *shard_result.updated_state_;
+    }
+    journal(result);
+    return result;
   }
 
   auto MstStorageStateImpl::updateOwnStateImpl(const DataType &tx)
       -> decltype(updateOwnState(tx)) {
-    return own_state_ += tx;
+    auto &shard = shardOf(tx->reducedHash());
+    std::unique_lock<std::mutex> lock(shard.mutex);
+    auto result = shard.own_state += tx;
+    lock.unlock();
+    journal(result);
+    return result;
   }
 
   auto MstStorageStateImpl::extractExpiredTransactionsImpl(
       const TimeType &current_time)
       -> decltype(extractExpiredTransactions(current_time)) {
-    for (auto &peer_and_state : peer_states_) {
-      peer_and_state.second.eraseExpired(current_time);
+    auto result = emptyState();
+    for (auto &shard : shards_) {
+      std::unique_lock<std::mutex> lock(shard->mutex);
+      for (auto &peer_and_state : shard->peer_states) {
+        peer_and_state.second.eraseExpired(current_time);
+      }
+      auto expired = shard->own_state.extractExpired(current_time);
+      lock.unlock();
+      result += expired;
+    }
+    if (journal_) {
+      journal_->erase(result);
+      if (journal_->needsCompaction()) {
+        journal_->compact([this] { return this->ownBatches(); });
+      }
     }
-    return own_state_.extractExpired(current_time);
+    return result;
   }
 
   auto MstStorageStateImpl::getDiffStateImpl(
       const shared_model::crypto::PublicKey &target_peer_key,
       const TimeType &current_time)
       -> decltype(getDiffState(target_peer_key, current_time)) {
-    auto target_current_state_iter = getState(target_peer_key);
-    auto new_diff_state = own_state_ - target_current_state_iter->second;
-    new_diff_state.eraseExpired(current_time);
-    return new_diff_state;
+    auto result = emptyState();
+    for (auto &shard : shards_) {
+      std::unique_lock<std::mutex> lock(shard->mutex);
+      auto diff =
+          shard->own_state - getState(*shard, target_peer_key)->second;
+      lock.unlock();
+      diff.eraseExpired(current_time);
+      result += diff;
+    }
+    return result;
   }
 
   auto MstStorageStateImpl::whatsNewImpl(ConstRefState new_state) const
       -> decltype(whatsNew(new_state)) {
-    return new_state - own_state_;
+    auto result = emptyState();
+    auto states = split(new_state);
+    for (size_t i = 0; i < shards_.size(); ++i) {
+      if (states[i].isEmpty()) {
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(shards_[i]->mutex);
+      auto diff = states[i] - shards_[i]->own_state;
+      lock.unlock();
+      result += diff;
+    }
+    return result;
   }
 
   bool MstStorageStateImpl::batchInStorageImpl(const DataType &batch) const {
-    return own_state_.contains(batch);
+    auto &shard = shardOf(batch->reducedHash());
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.own_state.contains(batch);
+  }
+
+  bool MstStorageStateImpl::isMissingImpl(const BatchDigest &digest) const {
+    auto &shard = shardOf(digest.reduced_hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.own_state.isMissing(digest);
+  }
+
+  size_t MstStorageStateImpl::pendingBatchesImpl() const {
+    size_t batches = 0;
+    for (const auto &shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      batches += shard->own_state.batchesQuantity();
+    }
+    return batches;
+  }
+
+  size_t MstStorageStateImpl::memoryUsage() const {
+    size_t usage = sizeof(*this);
+    for (const auto &shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      usage += shard->own_state.memoryUsage();
+      for (const auto &peer_state : shard->peer_states) {
+        usage += peer_state.first.blob().size()
+            + peer_state.second.memoryUsage();
+      }
+    }
+    return usage;
   }
 
 }  // namespace iroha
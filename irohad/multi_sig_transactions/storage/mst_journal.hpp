@@ -0,0 +1,104 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_MST_JOURNAL_HPP
+#define IROHA_MST_JOURNAL_HPP
+
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include "logger/logger_fwd.hpp"
+#include "multi_sig_transactions/mst_types.hpp"
+
+namespace iroha {
+
+  namespace network {
+    namespace transport {
+      class MstJournalRecord;
+    }  // namespace transport
+  }    // namespace network
+
+  /**
+   * Append-only journal of the own MST state on disk, so that the pending
+   * batches survive a restart of the peer instead of being gossiped again.
+   * Every update of a batch is appended with all the signatures of the
+   * batch, and a batch which leaves the state is appended as an erasure.
+   * The journal is rewritten with the current state, when the outdated
+   * records prevail.
+   */
+  class MstJournal {
+   public:
+    /**
+     * Open the journal and read the batches from it, creating the file if
+     * it does not exist. The incomplete record at the end of the file, if a
+     * write has been interrupted, is cut off.
+     * @param path - file of the journal
+     * @param log - logger
+     * @return the journal, or none if the file cannot be opened
+     */
+    static boost::optional<std::unique_ptr<MstJournal>> create(
+        const std::string &path, logger::LoggerPtr log);
+
+    /// @return the batches read from the journal on its creation
+    const std::vector<DataType> &restoredBatches() const;
+
+    /**
+     * Record the batches of the state with their signatures
+     * @param state - state with the new or updated batches
+     */
+    void append(const MstState &state);
+
+    /**
+     * Record that the batches of the state have left the own state
+     * @param state - state with the completed or expired batches
+     */
+    void erase(const MstState &state);
+
+    /// @return true, if the outdated records prevail in the journal
+    bool needsCompaction() const;
+
+    /**
+     * Rewrite the journal with the batches of the current state
+     * @param batches - returns the batches of the own state, called with the
+     * journal locked, so that no update is lost during the rewrite
+     */
+    void compact(const std::function<std::vector<DataType>()> &batches);
+
+   private:
+    MstJournal(std::string path, logger::LoggerPtr log);
+
+    /// read the records of the file, and cut off the incomplete one
+    bool load();
+
+    void write(std::ofstream &out,
+               const network::transport::MstJournalRecord &record);
+
+    void flush();
+
+    /// journal records from which the compaction is considered
+    static constexpr size_t kMinCompactionRecords = 1024;
+
+    const std::string path_;
+    std::vector<DataType> restored_batches_;
+
+    mutable std::mutex mutex_;
+    std::ofstream out_;
+    /// number of the records in the file
+    size_t records_ = 0;
+    /// reduced hashes of the batches in the journal
+    std::unordered_set<std::string> batches_;
+
+    logger::LoggerPtr log_;
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_MST_JOURNAL_HPP
@@ -6,8 +6,6 @@
 #ifndef IROHA_MST_STORAGE_HPP
 #define IROHA_MST_STORAGE_HPP
 
-#include <mutex>
-
 #include "cryptography/public_key.hpp"
 #include "logger/logger_fwd.hpp"
 #include "multi_sig_transactions/mst_types.hpp"
@@ -17,8 +15,8 @@ namespace iroha {
 
   /**
    * MstStorage responsible for manage own and others MstStates.
-   * All methods of storage covered by mutex, because we assume that mutex
-   * possible to execute in concurrent environment.
+   * All methods of storage have to be thread-safe, because the storage is
+   * accessed by Torii, the transport and the propagation concurrently.
    */
   class MstStorage {
    public:
@@ -29,7 +27,6 @@ namespace iroha {
      * @param target_peer_key - key for for updating state
      * @param new_state - state with new data
      * @return State with completed or updated batches
-     * General note: implementation of method covered by lock
      */
     StateUpdateResult apply(
         const shared_model::crypto::PublicKey &target_peer_key,
@@ -39,14 +36,12 @@ namespace iroha {
      * Provide updating state of current peer with new transaction
      * @param tx - new transaction for insertion in state
      * @return completed and updated mst states
-     * General note: implementation of method covered by lock
      */
     StateUpdateResult updateOwnState(const DataType &tx);
 
     /**
      * Remove expired transactions and return them
      * @return State with expired transactions
-     * General note: implementation of method covered by lock
      */
     MstState extractExpiredTransactions(const TimeType &current_time);
 
@@ -54,7 +49,6 @@ namespace iroha {
      * Make state based on diff of own and target states.
      * All expired transactions will be removed from diff.
      * @return difference between own and target state
-     * General note: implementation of method covered by lock
      */
     MstState getDiffState(
         const shared_model::crypto::PublicKey &target_peer_key,
@@ -64,7 +58,6 @@ namespace iroha {
      * Return diff between own and new state
      * @param new_state - state with new data
      * @return state that contains new data with respect to own state
-     * General note: implementation of method covered by lock
      */
     MstState whatsNew(ConstRefState new_state) const;
 
@@ -75,6 +68,18 @@ namespace iroha {
      */
     bool batchInStorage(const DataType &batch) const;
 
+    /**
+     * Check, if own state lacks the batch or some of its signatures
+     * @param digest of the batch from other peer
+     * @return true, if the batch should be pulled from the peer
+     */
+    bool isMissing(const BatchDigest &digest) const;
+
+    /**
+     * @return number of the batches in own state
+     */
+    size_t pendingBatches() const;
+
     virtual ~MstStorage() = default;
 
    protected:
@@ -107,9 +112,9 @@ namespace iroha {
 
     virtual bool batchInStorageImpl(const DataType &batch) const = 0;
 
-    // -------------------------------| fields |--------------------------------
+    virtual bool isMissingImpl(const BatchDigest &digest) const = 0;
 
-    mutable std::mutex mutex_;
+    virtual size_t pendingBatchesImpl() const = 0;
 
    protected:
     logger::LoggerPtr log_;
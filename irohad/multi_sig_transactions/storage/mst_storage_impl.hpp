@@ -6,29 +6,87 @@
 #ifndef IROHA_MST_STORAGE_IMPL_HPP
 #define IROHA_MST_STORAGE_IMPL_HPP
 
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
+
 #include "logger/logger_fwd.hpp"
 #include "multi_sig_transactions/hash.hpp"
+#include "multi_sig_transactions/storage/mst_journal.hpp"
 #include "multi_sig_transactions/storage/mst_storage.hpp"
 
 namespace iroha {
+  /**
+   * Storage, which is sharded by the reduced hashes of the batches. Every
+   * shard keeps the own state and the states of the peers for its batches
+   * under its own lock, so that the batches of different shards are
+   * processed concurrently.
+   */
   class MstStorageStateImpl : public MstStorage {
    private:
     // -----------------------------| private API |-----------------------------
 
+    struct Shard {
+      Shard(const CompleterType &completer, logger::LoggerPtr mst_state_logger);
+
+      mutable std::mutex mutex;
+      std::unordered_map<shared_model::crypto::PublicKey,
+                         MstState,
+                         iroha::model::BlobHasher>
+          peer_states;
+      MstState own_state;
+    };
+
     /**
-     * Return state of a peer by its public key. If state doesn't exist, create
-     * new empty state and return it.
+     * Return state of a peer in the shard by its public key. If state doesn't
+     * exist, create new empty state and return it.
+     * @param shard - shard for searching, which has to be locked
      * @param target_peer_key - public key of the peer for searching
      * @return valid iterator for state of peer
      */
-    auto getState(const shared_model::crypto::PublicKey &target_peer_key);
+    auto getState(Shard &shard,
+                  const shared_model::crypto::PublicKey &target_peer_key) const;
+
+    /// @return index of the shard of the batch with the reduced hash
+    size_t shardIndex(const shared_model::crypto::Hash &reduced_hash) const;
+
+    /// @return the shard of the batch with the reduced hash
+    Shard &shardOf(const shared_model::crypto::Hash &reduced_hash) const;
+
+    /**
+     * Split the state by the shards of its batches
+     * @return the state of every shard
+     */
+    std::vector<MstState> split(ConstRefState state) const;
+
+    /// @return new empty state
+    MstState emptyState() const;
+
+    /// record the changes of the own state in the journal, if there is one
+    void journal(const StateUpdateResult &result) const;
+
+    /// @return the batches of the own state of all the shards
+    std::vector<DataType> ownBatches() const;
 
    public:
+    /// default number of the shards
+    static constexpr size_t kDefaultShards = 16;
+
     // ----------------------------| interface API |----------------------------
+    /**
+     * @param completer - completer of the states
+     * @param mst_state_logger - logger of the created states
+     * @param log - logger
+     * @param journal - journal of the own state, from which the own state is
+     * restored, or nullptr to keep the state only in memory
+     * @param shards - number of the shards
+     */
     MstStorageStateImpl(const CompleterType &completer,
                         logger::LoggerPtr mst_state_logger,
-                        logger::LoggerPtr log);
+                        logger::LoggerPtr log,
+                        std::shared_ptr<MstJournal> journal = nullptr,
+                        size_t shards = kDefaultShards);
 
     auto applyImpl(const shared_model::crypto::PublicKey &target_peer_key,
                    const MstState &new_state)
@@ -50,15 +108,23 @@ namespace iroha {
 
     bool batchInStorageImpl(const DataType &batch) const override;
 
+    bool isMissingImpl(const BatchDigest &digest) const override;
+
+    size_t pendingBatchesImpl() const override;
+
+    /**
+     * @return approximate memory taken by the own state and the states of the
+     * peers in bytes. A batch known to several peers is counted in each of
+     * their states, so it is an upper estimate
+     */
+    size_t memoryUsage() const;
+
    private:
     // ---------------------------| private fields |----------------------------
 
     const CompleterType completer_;
-    std::unordered_map<shared_model::crypto::PublicKey,
-                       MstState,
-                       iroha::model::BlobHasher>
-        peer_states_;
-    MstState own_state_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::shared_ptr<MstJournal> journal_;
 
     logger::LoggerPtr mst_state_logger_;  ///< Logger for created MstState
                                           ///< objects.
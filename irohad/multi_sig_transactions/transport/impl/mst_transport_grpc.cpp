@@ -3,12 +3,10 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
-#include "common/default_constructible_unary_fn.hpp"  // non-copyable value workaround
-
 #include "multi_sig_transactions/transport/mst_transport_grpc.hpp"
 
-#include <boost/range/adaptor/filtered.hpp>
-#include <boost/range/adaptor/transformed.hpp>
+#include <unordered_map>
+
 #include "ametsuchi/tx_presence_cache.hpp"
 #include "backend/protobuf/transaction.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
@@ -23,9 +21,95 @@ using namespace iroha::network;
 using iroha::ConstRefState;
 namespace {
   auto default_sender_factory = [](const shared_model::interface::Peer &to) {
-    return createClient<transport::MstTransportGrpc>(to.address());
+    return createClient<transport::MstTransportGrpc>(to.address(),
+                                                     GRPC_COMPRESS_GZIP);
   };
-}
+
+  /**
+   * Serialize the batches to the state messages, each of which holds the
+   * batches up to MstTransportGrpc::kMaxStateMessageBytes. The public keys
+   * of the signatures are put to the key table of the message, so that a
+   * key is sent once per message
+   */
+  std::vector<transport::MstState> makeStateMessages(
+      const std::string &sender_key,
+      const std::vector<iroha::DataType> &batches) {
+    std::vector<transport::MstState> messages;
+    std::unordered_map<std::string, uint32_t> key_indices;
+    size_t message_bytes = 0;
+    for (const auto &batch : batches) {
+      std::vector<const iroha::protocol::Transaction *> transactions;
+      size_t batch_bytes = 0;
+      for (const auto &tx : batch->transactions()) {
+        // TODO (@l4l) 04/03/18 simplify with IR-1040
+        transactions.push_back(
+            &std::static_pointer_cast<shared_model::proto::Transaction>(tx)
+                 ->getTransport());
+        batch_bytes += transactions.back()->ByteSizeLong();
+      }
+      if (messages.empty()
+          or (message_bytes != 0
+              and message_bytes + batch_bytes
+                  > MstTransportGrpc::kMaxStateMessageBytes)) {
+        messages.emplace_back();
+        messages.back().set_source_peer_key(sender_key);
+        key_indices.clear();
+        message_bytes = 0;
+      }
+
+      auto &message = messages.back();
+      for (const auto *tx : transactions) {
+        auto proto_tx = message.add_transactions();
+        *proto_tx = *tx;
+        for (auto &signature : *proto_tx->mutable_signatures()) {
+          auto key = key_indices.emplace(signature.public_key(),
+                                         key_indices.size());
+          if (key.second) {
+            message.add_public_keys(signature.public_key());
+          }
+          message.add_signature_keys(key.first->second);
+          signature.clear_public_key();
+        }
+      }
+      message_bytes += batch_bytes;
+    }
+    return messages;
+  }
+
+  /// send the batches to the peer in the state messages
+  void sendBatches(transport::MstTransportGrpc::StubInterface &client,
+                   const std::string &address,
+                   const std::string &sender_key,
+                   const std::vector<iroha::DataType> &batches,
+                   AsyncGrpcClient<google::protobuf::Empty> &async_call) {
+    for (const auto &message : makeStateMessages(sender_key, batches)) {
+      async_call.Call(address, [&](auto context, auto cq) {
+        return client.AsyncSendState(context, message, cq);
+      });
+    }
+  }
+
+  /**
+   * Put the public keys of the key table of the message to the signatures
+   * @return false if the key table does not match the signatures
+   */
+  bool restorePublicKeys(transport::MstState &message) {
+    int signature_index = 0;
+    for (auto &tx : *message.mutable_transactions()) {
+      for (auto &signature : *tx.mutable_signatures()) {
+        if (signature_index >= message.signature_keys_size()) {
+          return false;
+        }
+        auto key_index = message.signature_keys(signature_index++);
+        if (key_index >= static_cast<uint32_t>(message.public_keys_size())) {
+          return false;
+        }
+        signature.set_public_key(message.public_keys(key_index));
+      }
+    }
+    return signature_index == message.signature_keys_size();
+  }
+}  // namespace
 void sendStateAsyncImpl(
     const shared_model::interface::Peer &to,
     ConstRefState state,
@@ -45,7 +129,8 @@ MstTransportGrpc::MstTransportGrpc(
     shared_model::crypto::PublicKey my_key,
     logger::LoggerPtr mst_state_logger,
     logger::LoggerPtr log,
-    boost::optional<SenderFactory> sender_factory)
+    boost::optional<SenderFactory> sender_factory,
+    std::shared_ptr<validation::ValidationPool> validation_pool)
     : async_call_(std::move(async_call)),
       transaction_factory_(std::move(transaction_factory)),
       batch_parser_(std::move(batch_parser)),
@@ -55,31 +140,27 @@ MstTransportGrpc::MstTransportGrpc(
       my_key_(shared_model::crypto::toBinaryString(my_key)),
       mst_state_logger_(std::move(mst_state_logger)),
       log_(std::move(log)),
-      sender_factory_(sender_factory) {}
+      sender_factory_(sender_factory),
+      validation_pool_(validation_pool
+                           ? std::move(validation_pool)
+                           : std::make_shared<validation::ValidationPool>(1)),
+      summary_call_(
+          std::make_shared<AsyncGrpcClient<transport::MstPullRequest>>(log_)),
+      peers_in_flight_(std::make_shared<PeersInFlight>()) {}
 
 shared_model::interface::types::SharedTxsCollectionType
 MstTransportGrpc::deserializeTransactions(const transport::MstState *request) {
-  return boost::copy_range<
-      shared_model::interface::types::SharedTxsCollectionType>(
-      request->transactions()
-      | boost::adaptors::transformed(
-            [&](const auto &tx) { return transaction_factory_->build(tx); })
-      | boost::adaptors::filtered([&](const auto &result) {
-          return result.match(
-              [](const auto &) { return true; },
-              [&](const auto &error) {
-                log_->info("Transaction deserialization failed: hash {}, {}",
-                           error.error.hash,
-                           error.error.error);
-                return false;
-              });
-        })
-      | boost::adaptors::transformed([&](auto result) {
-          return std::move(
-                     boost::get<iroha::expected::ValueOf<decltype(result)>>(
-                         result))
-              .value;
-        }));
+  return validation_pool_
+      ->buildAll<shared_model::interface::types::SharedTxsCollectionType>(
+          request->transactions_size(),
+          [&](size_t i) {
+            return transaction_factory_->build(request->transactions(i));
+          },
+          [&](const auto &error) {
+            log_->info("Transaction deserialization failed: hash {}, {}",
+                       error.hash,
+                       error.error);
+          });
 }
 
 grpc::Status MstTransportGrpc::SendState(
@@ -87,6 +168,15 @@ grpc::Status MstTransportGrpc::SendState(
     const ::iroha::network::transport::MstState *request,
     ::google::protobuf::Empty *response) {
   log_->info("MstState Received");
+  transport::MstState restored;
+  if (request->public_keys_size() != 0) {
+    restored = *request;
+    if (not restorePublicKeys(restored)) {
+      log_->info("Dropping received MST State due to invalid key table");
+      return grpc::Status::OK;
+    }
+    request = &restored;
+  }
   auto transactions = deserializeTransactions(request);
 
   auto batches = batch_parser_->parseBatches(transactions);
@@ -150,6 +240,32 @@ grpc::Status MstTransportGrpc::SendState(
   return grpc::Status::OK;
 }
 
+grpc::Status MstTransportGrpc::SendSummary(
+    ::grpc::ServerContext *context,
+    const ::iroha::network::transport::MstSummary *request,
+    ::iroha::network::transport::MstPullRequest *response) {
+  auto subscriber = subscriber_.lock();
+  if (not subscriber) {
+    log_->warn("No subscriber for MST SendSummary event is set");
+    return grpc::Status::OK;
+  }
+
+  for (const auto &batch : request->batches()) {
+    BatchDigest digest{shared_model::crypto::Hash(batch.reduced_hash()), {}};
+    digest.transactions.reserve(batch.transactions_size());
+    for (const auto &tx : batch.transactions()) {
+      digest.transactions.push_back({tx.signatures(), tx.signatories()});
+    }
+    if (subscriber->isMissing(digest)) {
+      *response->add_reduced_hashes() = batch.reduced_hash();
+    }
+  }
+  log_->info("Pulling {} of {} batches in MstSummary",
+             response->reduced_hashes_size(),
+             request->batches_size());
+  return grpc::Status::OK;
+}
+
 void MstTransportGrpc::subscribe(
     std::shared_ptr<MstTransportNotification> notification) {
   subscriber_ = notification;
@@ -157,12 +273,90 @@ void MstTransportGrpc::subscribe(
 
 void MstTransportGrpc::sendState(const shared_model::interface::Peer &to,
                                  ConstRefState providing_state) {
-  log_->info("Propagate MstState to peer {}", to.address());
-  sendStateAsyncImpl(to,
-                     providing_state,
-                     my_key_,
-                     *async_call_,
-                     sender_factory_.value_or(default_sender_factory));
+  auto peer_key = to.pubkey().hex();
+  {
+    std::lock_guard<std::mutex> lock(peers_in_flight_->mutex);
+    if (not peers_in_flight_->peers.insert(peer_key).second) {
+      log_->info("MstSummary to peer {} is in flight, skipping",
+                 to.address());
+      return;
+    }
+  }
+  // the peer is released when the call of the summary is destroyed,
+  // whether it has succeeded or not
+  std::shared_ptr<void> in_flight(
+      nullptr,
+      [peers_in_flight = peers_in_flight_, peer_key](void *) {
+        std::lock_guard<std::mutex> lock(peers_in_flight->mutex);
+        peers_in_flight->peers.erase(peer_key);
+      });
+
+  log_->info("Propagate MstSummary to peer {}", to.address());
+  std::shared_ptr<transport::MstTransportGrpc::StubInterface> client =
+      sender_factory_.value_or(default_sender_factory)(to);
+
+  transport::MstSummary summary;
+  summary.set_source_peer_key(my_key_);
+  auto batches = std::make_shared<std::unordered_map<std::string, DataType>>();
+  providing_state.iterateBatches([&](const auto &batch) {
+    auto digest = makeBatchDigest(batch);
+    auto proto_digest = summary.add_batches();
+    proto_digest->set_reduced_hash(
+        shared_model::crypto::toBinaryString(digest.reduced_hash));
+    for (const auto &tx : digest.transactions) {
+      auto proto_tx = proto_digest->add_transactions();
+      proto_tx->set_signatures(tx.signatures);
+      proto_tx->set_signatories(tx.signatories);
+    }
+    batches->emplace(proto_digest->reduced_hash(), batch);
+  });
+
+  // the batches are serialized on the reply, so that the signatures added in
+  // the meantime are sent as well
+  summary_call_->Call(
+      to.address(),
+      [&](auto context, auto cq) {
+        return client->AsyncSendSummary(context, summary, cq);
+      },
+      [client,
+       batches,
+       async_call = async_call_,
+       address = to.address(),
+       sender_key = my_key_,
+       in_flight = std::move(in_flight),
+       log = log_](const transport::MstPullRequest &pull_request) {
+        std::vector<DataType> pulled_batches;
+        for (const auto &reduced_hash : pull_request.reduced_hashes()) {
+          auto it = batches->find(reduced_hash);
+          if (it != batches->end()) {
+            pulled_batches.push_back(it->second);
+          }
+        }
+        if (pulled_batches.empty()) {
+          return;
+        }
+        log->info("Propagate {} pulled batches", pulled_batches.size());
+        sendBatches(*client, address, sender_key, pulled_batches, *async_call);
+      },
+      // a peer which does not serve the summaries gets the whole state
+      [client,
+       batches,
+       async_call = async_call_,
+       address = to.address(),
+       sender_key = my_key_,
+       log = log_](const grpc::Status &status) {
+        if (status.error_code() != grpc::StatusCode::UNIMPLEMENTED) {
+          return;
+        }
+        std::vector<DataType> all_batches;
+        for (const auto &batch : *batches) {
+          all_batches.push_back(batch.second);
+        }
+        log->info("Peer {} does not take MstSummary, propagate {} batches",
+                  address,
+                  all_batches.size());
+        sendBatches(*client, address, sender_key, all_batches, *async_call);
+      });
 }
 
 void iroha::network::sendStateAsync(
@@ -180,15 +374,8 @@ void sendStateAsyncImpl(const shared_model::interface::Peer &to,
                         AsyncGrpcClient<google::protobuf::Empty> &async_call,
                         MstTransportGrpc::SenderFactory sender_factory) {
   auto client = sender_factory(to);
-  transport::MstState protoState;
-  protoState.set_source_peer_key(sender_key);
-  state.iterateTransactions([&protoState](const auto &tx) {
-    // TODO (@l4l) 04/03/18 simplify with IR-1040
-    *protoState.add_transactions() =
-        std::static_pointer_cast<shared_model::proto::Transaction>(tx)
-            ->getTransport();
-  });
-  async_call.Call([&](auto context, auto cq) {
-    return client->AsyncSendState(context, protoState, cq);
-  });
+  std::vector<iroha::DataType> batches;
+  state.iterateBatches(
+      [&batches](const auto &batch) { batches.push_back(batch); });
+  sendBatches(*client, to.address(), sender_key, batches, async_call);
 }
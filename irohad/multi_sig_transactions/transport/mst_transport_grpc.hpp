@@ -9,6 +9,9 @@
 #include "mst.grpc.pb.h"
 #include "network/mst_transport.hpp"
 
+#include <mutex>
+#include <unordered_set>
+
 #include "cryptography/public_key.hpp"
 #include "interfaces/common_objects/common_objects_factory.hpp"
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
@@ -17,6 +20,7 @@
 #include "logger/logger_fwd.hpp"
 #include "multi_sig_transactions/state/mst_state.hpp"
 #include "network/impl/async_grpc_client.hpp"
+#include "validation/validation_pool.hpp"
 
 namespace iroha {
 
@@ -36,6 +40,10 @@ namespace iroha {
               shared_model::interface::Transaction,
               iroha::protocol::Transaction>;
 
+      /// size of the transactions of a state message, above which the
+      /// batches are split into several messages
+      static constexpr size_t kMaxStateMessageBytes = 4 * 1024 * 1024;
+
       MstTransportGrpc(
           std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
@@ -49,7 +57,9 @@ namespace iroha {
           shared_model::crypto::PublicKey my_key,
           logger::LoggerPtr mst_state_logger,
           logger::LoggerPtr log,
-          boost::optional<SenderFactory> = boost::none);
+          boost::optional<SenderFactory> = boost::none,
+          std::shared_ptr<validation::ValidationPool> validation_pool =
+              nullptr);
 
       /**
        * Server part of grpc SendState method call
@@ -63,9 +73,26 @@ namespace iroha {
           const ::iroha::network::transport::MstState *request,
           ::google::protobuf::Empty *response) override;
 
+      /**
+       * Server part of grpc SendSummary method call
+       * @param context - server context with information about call
+       * @param request - digests of the batches of other peer
+       * @param response - reduced hashes of the batches to pull from the peer
+       * @return grpc::Status (always OK)
+       */
+      grpc::Status SendSummary(
+          ::grpc::ServerContext *context,
+          const ::iroha::network::transport::MstSummary *request,
+          ::iroha::network::transport::MstPullRequest *response) override;
+
       void subscribe(
           std::shared_ptr<MstTransportNotification> notification) override;
 
+      /**
+       * Send the summary of the state to the peer, and then the batches the
+       * peer pulls. The state is not sent while the previous summary to the
+       * peer is in flight, its batches are sent with the next state instead
+       */
       void sendState(const shared_model::interface::Peer &to,
                      ConstRefState providing_state) override;
 
@@ -94,6 +121,21 @@ namespace iroha {
       logger::LoggerPtr log_;               ///< Logger for local use.
 
       boost::optional<SenderFactory> sender_factory_;
+
+      /// workers which validate the transactions of a received state
+      std::shared_ptr<validation::ValidationPool> validation_pool_;
+
+      /// client of the summaries, which sends the pulled batches on replies
+      /// and the whole state to the peers which do not serve the summaries
+      std::shared_ptr<network::AsyncGrpcClient<transport::MstPullRequest>>
+          summary_call_;
+
+      /// keys of the peers with the summaries in flight
+      struct PeersInFlight {
+        std::mutex mutex;
+        std::unordered_set<std::string> peers;
+      };
+      std::shared_ptr<PeersInFlight> peers_in_flight_;
     };
 
     void sendStateAsync(const shared_model::interface::Peer &to,
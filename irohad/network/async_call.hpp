@@ -0,0 +1,54 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ASYNC_CALL_HPP
+#define IROHA_ASYNC_CALL_HPP
+
+namespace grpc {
+  class ServerCompletionQueue;
+}  // namespace grpc
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Operation of a gRPC call handled on a completion queue. Every tag put
+     * to the completion queues of the server is an AsyncCall
+     */
+    class AsyncCall {
+     public:
+      /**
+       * Continue the call after the operation completed
+       * @param ok - whether the operation succeeded
+       */
+      virtual void proceed(bool ok) = 0;
+
+      virtual ~AsyncCall() = default;
+    };
+
+    /**
+     * gRPC service with the methods handled on the completion queues of the
+     * server instead of the threads of the synchronous server
+     */
+    class AsyncCallHandler {
+     public:
+      /// @return whether any method of the service is asynchronous
+      virtual bool hasAsyncMethods() const = 0;
+
+      /**
+       * Request the first calls of the asynchronous methods, which request
+       * the following calls themselves. Called once for each queue after the
+       * server is started
+       * @param queue - the queue to handle the calls on
+       */
+      virtual void requestCalls(grpc::ServerCompletionQueue &queue) = 0;
+
+      virtual ~AsyncCallHandler() = default;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_ASYNC_CALL_HPP
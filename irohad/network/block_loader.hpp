@@ -9,6 +9,7 @@
 #include <memory>
 #include <rxcpp/rx-observable-fwd.hpp>
 
+#include "ametsuchi/wsv_snapshot.hpp"
 #include "cryptography/public_key.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "interfaces/iroha_internal/block.hpp"
@@ -21,15 +22,52 @@ namespace iroha {
     class BlockLoader {
      public:
       /**
-       * Retrieve block from given peer starting from current top
+       * Retrieve block from given peer starting from current top. A broken
+       * stream is resumed after the last received block from the same or
+       * another ledger peer
        * @param height - top block height in requester's peer storage
        * @param peer_pubkey - peer for requesting blocks
-       * @return
+       * @return consecutive blocks following the height
        */
       virtual rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
       retrieveBlocks(const shared_model::interface::types::HeightType height,
                      const shared_model::crypto::PublicKey &peer_pubkey) = 0;
 
+      /**
+       * Retrieve the blocks up to the target height from several peers
+       * concurrently, each peer sending its own ranges of heights. The range
+       * failed by a peer is retried on the other peers
+       * @param height - top block height in requester's peer storage
+       * @param target_height - height of the last block to retrieve
+       * @param peer_pubkeys - peers for requesting blocks
+       * @return blocks in the order of their heights, the observable completes
+       * before the target height if some range is failed by all the peers
+       */
+      virtual rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      retrieveBlockRanges(
+          const shared_model::interface::types::HeightType height,
+          const shared_model::interface::types::HeightType target_height,
+          const shared_model::interface::types::PublicKeyCollectionType
+              &peer_pubkeys) = 0;
+
+      /**
+       * Retrieve the blocks up to the target height from the first of
+       * several peers which sends all of them. A few peers are requested at
+       * once, a failed peer is replaced by the next one, and the requests to
+       * the slower peers are cancelled once the blocks are received
+       * @param height - top block height in requester's peer storage
+       * @param target_height - height of the last block to retrieve
+       * @param peer_pubkeys - peers for requesting blocks
+       * @return blocks in the order of their heights, nothing if all the
+       * peers failed
+       */
+      virtual rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      retrieveBlocksFromFastest(
+          const shared_model::interface::types::HeightType height,
+          const shared_model::interface::types::HeightType target_height,
+          const shared_model::interface::types::PublicKeyCollectionType
+              &peer_pubkeys) = 0;
+
       /**
        * Retrieve block by its block_height from given peer
        * @param peer_pubkey - peer for requesting blocks
@@ -42,6 +80,15 @@ namespace iroha {
           const shared_model::crypto::PublicKey &peer_pubkey,
           shared_model::interface::types::HeightType block_height) = 0;
 
+      /**
+       * Retrieve the snapshot of WSV from given peer
+       * @param peer_pubkey - peer for requesting the snapshot
+       * @return snapshot which matches the digest sent by the peer, nullopt on
+       * failure
+       */
+      virtual boost::optional<ametsuchi::WsvSnapshot> retrieveWsvSnapshot(
+          const shared_model::crypto::PublicKey &peer_pubkey) = 0;
+
       virtual ~BlockLoader() = default;
     };
   }  // namespace network
@@ -6,53 +6,78 @@
 #ifndef IROHA_ASYNC_GRPC_CLIENT_HPP
 #define IROHA_ASYNC_GRPC_CLIENT_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <ciso646>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include <google/protobuf/empty.pb.h>
 #include <grpc++/grpc++.h>
 #include <grpcpp/impl/codegen/async_unary_call.h>
+#include "common/counter.hpp"
+#include "common/histogram.hpp"
 #include "logger/logger.hpp"
 
 namespace iroha {
   namespace network {
 
     /**
-     * Asynchronous gRPC client which does no processing of server responses
+     * Asynchronous gRPC client which passes successful server responses and
+     * the failures to the callbacks of the calls, if there are any, so the
+     * caller continues on the completion instead of waiting for it. The
+     * calls complete on several completion queues, each polled by its own
+     * thread, and the calls to a peer always complete on the same queue, so
+     * a slow peer does not delay the responses of the others.
      * @tparam Response type of server response
      */
     template <typename Response>
     class AsyncGrpcClient {
      public:
-      explicit AsyncGrpcClient(logger::LoggerPtr log)
-          : thread_(&AsyncGrpcClient::asyncCompleteRpc, this),
-            log_(std::move(log)) {}
+      /// number of the buckets of the call latency in milliseconds
+      static constexpr size_t kCallLatencyBuckets = 14;
 
       /**
-       * Listen to gRPC server responses
+       * @param log - logger
+       * @param threads - number of the completion queues and their threads
+       * @param max_calls_per_peer - calls to a peer in flight at once, the
+       * calls over the limit are dropped. 0 does not limit them
        */
-      void asyncCompleteRpc() {
-        void *got_tag;
-        auto ok = false;
-        while (cq_.Next(&got_tag, &ok)) {
-          auto call = static_cast<AsyncClientCall *>(got_tag);
-          if (not call->status.ok()) {
-            log_->warn("RPC failed: {}", call->status.error_message());
-          }
-          delete call;
+      explicit AsyncGrpcClient(logger::LoggerPtr log,
+                               size_t threads = 1,
+                               size_t max_calls_per_peer = 0)
+          : log_(std::move(log)),
+            max_calls_per_peer_(max_calls_per_peer),
+            call_latency_(std::make_shared<Histogram>(
+                Histogram::exponentialBounds(1, 2, kCallLatencyBuckets))),
+            dropped_calls_(std::make_shared<Counter>()) {
+        threads = std::max<size_t>(threads, 1);
+        for (size_t i = 0; i < threads; ++i) {
+          queues_.push_back(std::make_unique<grpc::CompletionQueue>());
+        }
+        for (auto &queue : queues_) {
+          threads_.emplace_back(
+              [this, queue = queue.get()] { asyncCompleteRpc(*queue); });
         }
       }
 
       ~AsyncGrpcClient() {
-        cq_.Shutdown();
-        if (thread_.joinable()) {
-          thread_.join();
+        for (auto &queue : queues_) {
+          queue->Shutdown();
+        }
+        for (auto &thread : threads_) {
+          if (thread.joinable()) {
+            thread.join();
+          }
         }
       }
 
-      grpc::CompletionQueue cq_;
-      std::thread thread_;
-
       /**
        * State and data information of gRPC call
        */
@@ -63,24 +88,148 @@ namespace iroha {
 
         grpc::Status status;
 
+        std::function<void(const Response &)> on_reply;
+
+        std::function<void(const grpc::Status &)> on_error;
+
         std::unique_ptr<grpc::ClientAsyncResponseReaderInterface<Response>>
             response_reader;
+
+        /// address of the peer, empty if the call is not limited
+        std::string peer;
+
+        std::chrono::steady_clock::time_point started;
       };
 
       /**
        * Universal method to perform all needed sends
        * @tparam lambda which must return unique pointer to
        * ClientAsyncResponseReader<Response> object
+       * @param peer - address of the peer, which selects the completion
+       * queue and counts the call in the limit of the peer
+       * @param on_reply - optional callback for the response of the server
+       * @param on_error - optional callback for the failed or dropped call
        */
       template <typename F>
-      void Call(F &&lambda) {
+      void Call(const std::string &peer,
+                F &&lambda,
+                std::function<void(const Response &)> on_reply = {},
+                std::function<void(const grpc::Status &)> on_error = {}) {
+        if (not acquire(peer)) {
+          dropped_calls_->increment();
+          log_->warn("Dropped the call to {}, {} calls are in flight",
+                     peer,
+                     max_calls_per_peer_);
+          if (on_error) {
+            on_error(grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                                  "too many calls to the peer"));
+          }
+          return;
+        }
         auto call = new AsyncClientCall;
-        call->response_reader = lambda(&call->context, &cq_);
+        call->on_reply = std::move(on_reply);
+        call->on_error = std::move(on_error);
+        call->peer = peer;
+        call->started = std::chrono::steady_clock::now();
+        call->response_reader = lambda(&call->context, &queueOf(peer));
         call->response_reader->Finish(&call->reply, &call->status, call);
       }
 
+      /**
+       * Perform the call which is not bound to a peer, the queues take such
+       * calls in turn
+       * \see Call above
+       */
+      template <typename F>
+      void Call(F &&lambda,
+                std::function<void(const Response &)> on_reply = {},
+                std::function<void(const grpc::Status &)> on_error = {}) {
+        Call(std::string{},
+             std::forward<F>(lambda),
+             std::move(on_reply),
+             std::move(on_error));
+      }
+
+      /// time from the start of a call to its completion in milliseconds
+      const Histogram &callLatency() const {
+        return *call_latency_;
+      }
+
+      /// calls dropped due to the limit of the calls in flight to a peer
+      const Counter &droppedCalls() const {
+        return *dropped_calls_;
+      }
+
      private:
+      /**
+       * Listen to gRPC server responses
+       */
+      void asyncCompleteRpc(grpc::CompletionQueue &queue) {
+        void *got_tag;
+        auto ok = false;
+        while (queue.Next(&got_tag, &ok)) {
+          auto call = static_cast<AsyncClientCall *>(got_tag);
+          call_latency_->observe(
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                  std::chrono::steady_clock::now() - call->started)
+                  .count());
+          release(call->peer);
+          if (not call->status.ok()) {
+            log_->warn("RPC failed: {}", call->status.error_message());
+            if (call->on_error) {
+              call->on_error(call->status);
+            }
+          } else if (call->on_reply) {
+            call->on_reply(call->reply);
+          }
+          delete call;
+        }
+      }
+
+      grpc::CompletionQueue &queueOf(const std::string &peer) {
+        if (peer.empty()) {
+          return *queues_[next_queue_++ % queues_.size()];
+        }
+        return *queues_[std::hash<std::string>{}(peer) % queues_.size()];
+      }
+
+      /// @return false if the peer has the maximal number of calls in flight
+      bool acquire(const std::string &peer) {
+        if (max_calls_per_peer_ == 0 or peer.empty()) {
+          return true;
+        }
+        std::lock_guard<std::mutex> lock(calls_mutex_);
+        auto &calls = calls_per_peer_[peer];
+        if (calls >= max_calls_per_peer_) {
+          return false;
+        }
+        ++calls;
+        return true;
+      }
+
+      void release(const std::string &peer) {
+        if (max_calls_per_peer_ == 0 or peer.empty()) {
+          return;
+        }
+        std::lock_guard<std::mutex> lock(calls_mutex_);
+        auto it = calls_per_peer_.find(peer);
+        if (it != calls_per_peer_.end() and --it->second == 0) {
+          calls_per_peer_.erase(it);
+        }
+      }
+
       logger::LoggerPtr log_;
+      const size_t max_calls_per_peer_;
+
+      std::vector<std::unique_ptr<grpc::CompletionQueue>> queues_;
+      std::vector<std::thread> threads_;
+      std::atomic<size_t> next_queue_{0};
+
+      std::mutex calls_mutex_;
+      std::unordered_map<std::string, size_t> calls_per_peer_;
+
+      std::shared_ptr<Histogram> call_latency_;
+      std::shared_ptr<Counter> dropped_calls_;
     };
   }  // namespace network
 }  // namespace iroha
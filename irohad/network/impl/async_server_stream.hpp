@@ -0,0 +1,217 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ASYNC_SERVER_STREAM_HPP
+#define IROHA_ASYNC_SERVER_STREAM_HPP
+
+#include "network/async_call.hpp"
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include <grpc++/grpc++.h>
+#include <rxcpp/rx-lite.hpp>
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Server streaming call handled on a completion queue. The responses are
+     * written from any thread and are sent one after another, so the call
+     * holds no thread while it waits for the responses.
+     *
+     * The stream keeps itself alive until the call is done and its last
+     * operation has completed. When the queue of the responses is bounded,
+     * the client which does not keep up with it is cancelled.
+     *
+     * The responses may be written as grpc::ByteBuffer, so that a message
+     * serialized once is sent to many streams
+     */
+    template <typename Request, typename Response>
+    class AsyncServerStream
+        : public AsyncCall,
+          public std::enable_shared_from_this<
+              AsyncServerStream<Request, Response>> {
+     public:
+      using Writer = grpc::ServerAsyncWriter<Response>;
+      /// requests the next call of the method from the service
+      using RequestMethod = std::function<void(grpc::ServerContext *,
+                                               Request *,
+                                               Writer *,
+                                               grpc::ServerCompletionQueue *,
+                                               void *)>;
+      /// starts handling of the requested call
+      using Start = std::function<void(
+          const Request &, std::shared_ptr<AsyncServerStream>)>;
+
+      /**
+       * Request the next call of the method, which is started by the given
+       * function and requests the following call in turn
+       * @param max_queued - the number of the responses waiting to be sent,
+       * exceeding which cancels the call; 0 for no limit
+       */
+      static void request(RequestMethod request_method,
+                          grpc::ServerCompletionQueue &queue,
+                          Start start,
+                          size_t max_queued = 0) {
+        std::shared_ptr<AsyncServerStream> stream(
+            new AsyncServerStream(std::move(request_method),
+                                  queue,
+                                  std::move(start),
+                                  max_queued));
+        stream->self_ = stream;
+        stream->context_.AsyncNotifyWhenDone(&stream->done_);
+        stream->request_method_(&stream->context_,
+                                &stream->request_,
+                                &stream->writer_,
+                                &queue,
+                                stream.get());
+      }
+
+      /**
+       * Send the response after the ones written before
+       * @return false if the queue of the responses overflowed and the call
+       * is cancelled
+       */
+      bool write(Response response) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (max_queued_ != 0 and responses_.size() >= max_queued_) {
+          responses_.clear();
+          failed_ = true;
+          lock.unlock();
+          context_.TryCancel();
+          subscription_.unsubscribe();
+          return false;
+        }
+        responses_.push_back(std::move(response));
+        writeNext();
+        return true;
+      }
+
+      /// finish the call after the written responses are sent
+      void finish() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finishing_ = true;
+        writeNext();
+      }
+
+      bool isCancelled() const {
+        return context_.IsCancelled();
+      }
+
+      const grpc::ServerContext &context() const {
+        return context_;
+      }
+
+      /// subscription of the responses, which is cancelled with the call
+      rxcpp::composite_subscription &subscription() {
+        return subscription_;
+      }
+
+      void proceed(bool ok) override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (not started_) {
+          if (not ok) {
+            // the server is shut down
+            auto self = std::move(self_);
+            return;
+          }
+          started_ = true;
+          lock.unlock();
+          request(request_method_, queue_, start_, max_queued_);
+          start_(request_, this->shared_from_this());
+          return;
+        }
+
+        operation_pending_ = false;
+        failed_ = failed_ or not ok;
+        if (finished_ or failed_) {
+          release(lock);
+          return;
+        }
+        writeNext();
+      }
+
+     private:
+      /// tag of the end of the call
+      class Done : public AsyncCall {
+       public:
+        explicit Done(AsyncServerStream &stream) : stream_(stream) {}
+
+        void proceed(bool) override {
+          stream_.subscription_.unsubscribe();
+          std::unique_lock<std::mutex> lock(stream_.mutex_);
+          stream_.done_called_ = true;
+          stream_.release(lock);
+        }
+
+       private:
+        AsyncServerStream &stream_;
+      };
+
+      AsyncServerStream(RequestMethod request_method,
+                        grpc::ServerCompletionQueue &queue,
+                        Start start,
+                        size_t max_queued)
+          : request_method_(std::move(request_method)),
+            queue_(queue),
+            start_(std::move(start)),
+            max_queued_(max_queued),
+            writer_(&context_),
+            done_(*this) {}
+
+      /// start the next operation, if none is pending
+      void writeNext() {
+        if (not started_ or operation_pending_ or finished_ or failed_
+            or done_called_) {
+          return;
+        }
+        if (not responses_.empty()) {
+          writer_.Write(responses_.front(), this);
+          responses_.pop_front();
+          operation_pending_ = true;
+        } else if (finishing_) {
+          writer_.Finish(grpc::Status::OK, this);
+          finished_ = true;
+          operation_pending_ = true;
+        }
+      }
+
+      /// drop the stream when the call is done and no operation is pending
+      void release(std::unique_lock<std::mutex> &lock) {
+        if (done_called_ and not operation_pending_ and self_) {
+          auto self = std::move(self_);
+          lock.unlock();
+        }
+      }
+
+      RequestMethod request_method_;
+      grpc::ServerCompletionQueue &queue_;
+      Start start_;
+      const size_t max_queued_;
+
+      grpc::ServerContext context_;
+      Request request_;
+      Writer writer_;
+      Done done_;
+      rxcpp::composite_subscription subscription_;
+
+      std::mutex mutex_;
+      std::deque<Response> responses_;
+      std::shared_ptr<AsyncServerStream> self_;
+      bool started_ = false;
+      bool operation_pending_ = false;
+      bool finishing_ = false;
+      bool finished_ = false;
+      bool failed_ = false;
+      bool done_called_ = false;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_ASYNC_SERVER_STREAM_HPP
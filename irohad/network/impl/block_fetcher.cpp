@@ -0,0 +1,81 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/block_fetcher.hpp"
+
+#include <rxcpp/rx-lite.hpp>
+#include "logger/logger.hpp"
+
+namespace {
+  /// downloads queued after the one in progress
+  constexpr size_t kQueuedFetches = 4;
+}  // namespace
+
+namespace iroha {
+  namespace network {
+
+    BlockFetcher::BlockFetcher(std::shared_ptr<BlockLoader> block_loader,
+                               logger::LoggerPtr log)
+        : block_loader_(std::move(block_loader)),
+          log_(std::move(log)),
+          executor_("block-fetch", kQueuedFetches) {}
+
+    void BlockFetcher::fetch(
+        shared_model::interface::types::HeightType height,
+        shared_model::interface::types::HeightType target_height,
+        shared_model::interface::types::PublicKeyCollectionType public_keys) {
+      auto task =
+          std::make_shared<std::packaged_task<boost::optional<Blocks>()>>(
+              [this, height, target_height, public_keys] {
+                Blocks blocks;
+                block_loader_
+                    ->retrieveBlocksFromFastest(
+                        height, target_height, public_keys)
+                    .subscribe([&blocks](auto block) {
+                      blocks.push_back(std::move(block));
+                    });
+                if (blocks.empty()
+                    or blocks.back()->height() != target_height) {
+                  log_->warn("Failed to fetch blocks {} to {}",
+                             height + 1,
+                             target_height);
+                  return boost::optional<Blocks>();
+                }
+                return boost::make_optional(std::move(blocks));
+              });
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (fetch_ and fetch_->height == height
+            and fetch_->target_height == target_height) {
+          return;
+        }
+        fetch_ = Fetch{height, target_height, task->get_future().share()};
+      }
+      log_->info("Fetching blocks {} to {}", height + 1, target_height);
+      executor_.post([task] { (*task)(); });
+    }
+
+    boost::optional<BlockFetcher::Blocks> BlockFetcher::take(
+        shared_model::interface::types::HeightType height,
+        shared_model::interface::types::HeightType target_height) {
+      std::shared_future<boost::optional<Blocks>> blocks;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (not fetch_ or fetch_->height != height
+            or fetch_->target_height != target_height) {
+          // the download of the blocks which the peer already has is stale
+          if (fetch_ and fetch_->target_height <= height) {
+            fetch_ = boost::none;
+          }
+          return boost::none;
+        }
+        blocks = std::move(fetch_->blocks);
+        fetch_ = boost::none;
+      }
+      return blocks.get();
+    }
+
+  }  // namespace network
+}  // namespace iroha
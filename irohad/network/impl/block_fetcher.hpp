@@ -0,0 +1,83 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BLOCK_FETCHER_HPP
+#define IROHA_BLOCK_FETCHER_HPP
+
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include "common/stage_executor.hpp"
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger_fwd.hpp"
+#include "network/block_loader.hpp"
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Download of the blocks which the consensus agreed on without the vote
+     * of this peer. The consensus gate starts it as soon as the supermajority
+     * for another block is known, and the synchronizer takes the downloaded
+     * blocks instead of requesting them after the outcome reaches it. The
+     * blocks are retrieved from the fastest of the voted peers on a separate
+     * thread
+     */
+    class BlockFetcher {
+     public:
+      using Blocks =
+          std::vector<std::shared_ptr<shared_model::interface::Block>>;
+
+      BlockFetcher(std::shared_ptr<BlockLoader> block_loader,
+                   logger::LoggerPtr log);
+
+      /**
+       * Start the download of the blocks following the height, it replaces
+       * the download which is not taken yet
+       * @param height - top block height of the peer
+       * @param target_height - height of the agreed block
+       * @param public_keys - peers which voted for the agreed block
+       */
+      void fetch(shared_model::interface::types::HeightType height,
+                 shared_model::interface::types::HeightType target_height,
+                 shared_model::interface::types::PublicKeyCollectionType
+                     public_keys);
+
+      /**
+       * Take the blocks of the started download, waiting till it completes
+       * @param height - top block height of the peer
+       * @param target_height - height of the last required block
+       * @return all the blocks up to the target height, none if the download
+       * of these heights is not started or failed
+       */
+      boost::optional<Blocks> take(
+          shared_model::interface::types::HeightType height,
+          shared_model::interface::types::HeightType target_height);
+
+     private:
+      struct Fetch {
+        shared_model::interface::types::HeightType height;
+        shared_model::interface::types::HeightType target_height;
+        std::shared_future<boost::optional<Blocks>> blocks;
+      };
+
+      std::shared_ptr<BlockLoader> block_loader_;
+      logger::LoggerPtr log_;
+
+      std::mutex mutex_;
+      boost::optional<Fetch> fetch_;
+
+      /// declared last, so the downloads complete before the other members
+      /// are destroyed
+      StageExecutor executor_;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_BLOCK_FETCHER_HPP
@@ -5,7 +5,12 @@
 
 #include "network/impl/block_loader_impl.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
 
 #include <grpc++/create_channel.h>
 #include <rxcpp/rx-lite.hpp>
@@ -26,14 +31,204 @@ namespace {
   const char *kPeerRetrieveFail = "Failed to retrieve peers";
   const char *kPeerFindFail = "Failed to find requested peer";
   const std::chrono::seconds kBlocksRequestTimeout{5};
+  const std::chrono::minutes kWsvSnapshotRequestTimeout{10};
+  /// number of the ranges downloaded ahead of the taken blocks per peer
+  constexpr size_t kRangesAheadPerPeer = 2;
+  /// number of the peers requested at once for the same blocks
+  constexpr size_t kRacedPeers = 3;
+  /// weight of the latest stream in the throughput of a peer
+  constexpr double kThroughputWeight = 0.5;
+
+  /**
+   * Ranges of the block heights shared by the peers downloading them. The
+   * ranges are taken in the order of heights, the failed ones first, and the
+   * downloaded blocks are taken in the order of heights as well
+   */
+  class RangeDownload {
+   public:
+    using Blocks = std::vector<std::shared_ptr<Block>>;
+
+    struct Range {
+      size_t index;
+      types::HeightType first_height;
+      types::HeightType last_height;
+    };
+
+    RangeDownload(types::HeightType first_height,
+                  types::HeightType last_height,
+                  types::HeightType blocks_per_range,
+                  size_t peers)
+        : first_height_(first_height),
+          last_height_(last_height),
+          blocks_per_range_(blocks_per_range),
+          ranges_((last_height - first_height) / blocks_per_range + 1),
+          window_(peers * kRangesAheadPerPeer),
+          active_peers_(peers) {}
+
+    /// @return the next range to download, none when the peer should stop
+    boost::optional<Range> take() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      // the peer waits for the ranges in flight, which may be failed by the
+      // other peers
+      changed_.wait(lock, [this] {
+        return stopped_ or not failed_.empty()
+            or (next_ < ranges_ and next_ < taken_ + window_)
+            or (next_ == ranges_ and in_flight_ == 0);
+      });
+      if (stopped_ or (failed_.empty() and next_ == ranges_)) {
+        return boost::none;
+      }
+      size_t index;
+      if (not failed_.empty()) {
+        index = failed_.back();
+        failed_.pop_back();
+      } else {
+        index = next_++;
+      }
+      ++in_flight_;
+      auto first_height = first_height_ + index * blocks_per_range_;
+      return Range{
+          index,
+          first_height,
+          std::min(last_height_, first_height + blocks_per_range_ - 1)};
+    }
+
+    void complete(const Range &range, Blocks blocks) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --in_flight_;
+        downloaded_.emplace(range.index, std::move(blocks));
+      }
+      changed_.notify_all();
+    }
+
+    /// return the range to be downloaded by another peer, the failed peer
+    /// does not take the ranges anymore
+    void fail(const Range &range) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --in_flight_;
+        --active_peers_;
+        failed_.push_back(range.index);
+      }
+      changed_.notify_all();
+    }
+
+    /// @return blocks of the next range, none after the last downloaded one
+    boost::optional<Blocks> next() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      changed_.wait(lock, [this] {
+        return stopped_ or taken_ == ranges_ or active_peers_ == 0
+            or downloaded_.count(taken_) != 0;
+      });
+      auto it = downloaded_.find(taken_);
+      if (stopped_ or it == downloaded_.end()) {
+        return boost::none;
+      }
+      auto blocks = std::move(it->second);
+      downloaded_.erase(it);
+      ++taken_;
+      lock.unlock();
+      changed_.notify_all();
+      return blocks;
+    }
+
+    /// stop the peers, so that they finish the current ranges only
+    void stop() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+      }
+      changed_.notify_all();
+    }
+
+   private:
+    const types::HeightType first_height_;
+    const types::HeightType last_height_;
+    const types::HeightType blocks_per_range_;
+    const size_t ranges_;
+    const size_t window_;
+
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    size_t next_ = 0;
+    size_t taken_ = 0;
+    size_t in_flight_ = 0;
+    size_t active_peers_;
+    std::vector<size_t> failed_;
+    std::map<size_t, Blocks> downloaded_;
+    bool stopped_ = false;
+  };
+
+  /**
+   * Requests of the same blocks to several peers, the first complete
+   * response wins and the other requests are cancelled
+   */
+  class BlockRace {
+   public:
+    using Blocks = std::vector<std::shared_ptr<Block>>;
+
+    explicit BlockRace(std::vector<proto::Loader::StubInterface *> stubs)
+        : stubs_(std::move(stubs)) {}
+
+    /**
+     * Take the next peer to request, registering the context of the call so
+     * that it is cancelled when another peer wins
+     * @return the stub of the peer, nullptr if the race is over
+     */
+    proto::Loader::StubInterface *start(grpc::ClientContext &context) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (winner_ or next_ == stubs_.size()) {
+        return nullptr;
+      }
+      contexts_.push_back(&context);
+      return stubs_[next_++];
+    }
+
+    /**
+     * Complete the call of the context
+     * @param blocks - the retrieved blocks, none if the call failed
+     * @return true if the race is over
+     */
+    bool finish(grpc::ClientContext &context, boost::optional<Blocks> blocks) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      contexts_.erase(
+          std::find(contexts_.begin(), contexts_.end(), &context));
+      if (blocks and not winner_) {
+        winner_ = std::move(blocks);
+        for (auto other : contexts_) {
+          other->TryCancel();
+        }
+      }
+      return bool(winner_);
+    }
+
+    /// @return blocks of the winner, none if all the peers failed
+    boost::optional<Blocks> takeWinner() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return std::move(winner_);
+    }
+
+   private:
+    const std::vector<proto::Loader::StubInterface *> stubs_;
+
+    std::mutex mutex_;
+    size_t next_ = 0;
+    std::vector<grpc::ClientContext *> contexts_;
+    boost::optional<Blocks> winner_;
+  };
 }  // namespace
 
 BlockLoaderImpl::BlockLoaderImpl(
     std::shared_ptr<PeerQueryFactory> peer_query_factory,
     shared_model::proto::ProtoBlockFactory factory,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    types::HeightType blocks_per_range,
+    std::shared_ptr<ChannelPool> channel_pool)
     : peer_query_factory_(std::move(peer_query_factory)),
       block_factory_(std::move(factory)),
+      blocks_per_range_(blocks_per_range),
+      channel_pool_(std::move(channel_pool)),
       log_(std::move(log)) {}
 
 rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
@@ -48,35 +243,235 @@ rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
           return;
         }
 
-        proto::BlockRequest request;
-        grpc::ClientContext context;
-        protocol::Block block;
-
-        // set a timeout to avoid being hung
-        context.set_deadline(std::chrono::system_clock::now()
-                             + kBlocksRequestTimeout);
-
-        // request next block to our top
-        request.set_height(height + 1);
-
-        auto reader =
-            this->getPeerStub(**peer).retrieveBlocks(&context, request);
-        while (subscriber.is_subscribed() and reader->Read(&block)) {
-          block_factory_.createBlock(std::move(block))
-              .match(
-                  [&subscriber](auto &&result) {
-                    subscriber.on_next(std::move(result.value));
-                  },
-                  [this, &context](const auto &error) {
-                    log_->error("{}", error.error);
-                    context.TryCancel();
-                  });
+        // a broken stream is resumed after the last verified block from the
+        // fastest peer which has not failed yet
+        auto next_height = height + 1;
+        std::vector<types::AddressType> failed;
+        while (peer and subscriber.is_subscribed()) {
+          proto::BlockRequest request;
+          grpc::ClientContext context;
+          protocol::Block block;
+
+          // set a timeout to avoid being hung
+          context.set_deadline(std::chrono::system_clock::now()
+                               + kBlocksRequestTimeout);
+
+          // request next block to our top
+          request.set_height(next_height);
+
+          const auto first_height = next_height;
+          const auto start = std::chrono::steady_clock::now();
+          auto reader =
+              this->getPeerStub(**peer).retrieveBlocks(&context, request);
+          bool valid = true;
+          while (valid and subscriber.is_subscribed()
+                 and reader->Read(&block)) {
+            valid = block_factory_.createBlock(std::move(block))
+                        .match(
+                            [&](auto &&result) {
+                              if (result.value->height() != next_height) {
+                                log_->error("Unexpected block {}",
+                                            result.value->height());
+                                return false;
+                              }
+                              ++next_height;
+                              subscriber.on_next(std::move(result.value));
+                              return true;
+                            },
+                            [this](const auto &error) {
+                              log_->error("{}", error.error);
+                              return false;
+                            });
+          }
+          if (not valid or not subscriber.is_subscribed()) {
+            context.TryCancel();
+          }
+          auto status = reader->Finish();
+          this->observeThroughput((*peer)->address(),
+                                  next_height - first_height,
+                                  std::chrono::steady_clock::now() - start);
+          if (valid and status.ok()) {
+            break;
+          }
+          if (not valid or next_height == first_height) {
+            failed.push_back((*peer)->address());
+          }
+          peer = this->resumeSource(failed);
+          if (peer) {
+            log_->warn("Resuming the block stream at {} from {}",
+                       next_height,
+                       (*peer)->address());
+          }
+        }
+        subscriber.on_completed();
+      });
+}
+
+rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlockRanges(
+    const types::HeightType height,
+    const types::HeightType target_height,
+    const types::PublicKeyCollectionType &peer_pubkeys) {
+  return rxcpp::observable<>::create<std::shared_ptr<Block>>(
+      [this, height, target_height, peer_pubkeys](auto subscriber) {
+        if (target_height <= height) {
+          subscriber.on_completed();
+          return;
+        }
+
+        // the stubs are created before the download, since the connections
+        // are not shared among the threads
+        auto stubs = this->getPeerStubs(peer_pubkeys);
+        if (stubs.empty()) {
+          log_->error("{}", kPeerNotFound);
+          subscriber.on_completed();
+          return;
+        }
+
+        RangeDownload download(
+            height + 1, target_height, blocks_per_range_, stubs.size());
+        std::vector<std::thread> peers;
+        for (auto stub : stubs) {
+          peers.emplace_back([this, stub, &download] {
+            while (auto range = download.take()) {
+              grpc::ClientContext context;
+              if (auto blocks = this->retrieveRange(*stub,
+                                                    range->first_height,
+                                                    range->last_height,
+                                                    context)) {
+                download.complete(*range, std::move(*blocks));
+              } else {
+                log_->warn("Failed to retrieve blocks {} to {}, retrying",
+                           range->first_height,
+                           range->last_height);
+                download.fail(*range);
+                return;
+              }
+            }
+          });
+        }
+
+        while (subscriber.is_subscribed()) {
+          auto blocks = download.next();
+          if (not blocks) {
+            break;
+          }
+          for (auto &block : *blocks) {
+            subscriber.on_next(std::move(block));
+          }
+        }
+        download.stop();
+        for (auto &peer : peers) {
+          peer.join();
         }
-        reader->Finish();
         subscriber.on_completed();
       });
 }
 
+rxcpp::observable<std::shared_ptr<Block>>
+BlockLoaderImpl::retrieveBlocksFromFastest(
+    const types::HeightType height,
+    const types::HeightType target_height,
+    const types::PublicKeyCollectionType &peer_pubkeys) {
+  return rxcpp::observable<>::create<std::shared_ptr<Block>>(
+      [this, height, target_height, peer_pubkeys](auto subscriber) {
+        if (target_height <= height) {
+          subscriber.on_completed();
+          return;
+        }
+
+        auto stubs = this->getPeerStubs(peer_pubkeys);
+        if (stubs.empty()) {
+          log_->error("{}", kPeerNotFound);
+          subscriber.on_completed();
+          return;
+        }
+
+        // a peer which fails is replaced by the next one, so that at most
+        // kRacedPeers requests are in flight
+        const auto racers = std::min(stubs.size(), kRacedPeers);
+        BlockRace race(std::move(stubs));
+        std::vector<std::thread> peers;
+        for (size_t i = 0; i < racers; ++i) {
+          peers.emplace_back([this, height, target_height, &race] {
+            while (true) {
+              grpc::ClientContext context;
+              auto stub = race.start(context);
+              if (not stub) {
+                return;
+              }
+              auto blocks = this->retrieveRange(
+                  *stub, height + 1, target_height, context);
+              if (race.finish(context, std::move(blocks))) {
+                return;
+              }
+            }
+          });
+        }
+        for (auto &peer : peers) {
+          peer.join();
+        }
+
+        if (auto blocks = race.takeWinner()) {
+          for (auto &block : *blocks) {
+            if (not subscriber.is_subscribed()) {
+              break;
+            }
+            subscriber.on_next(std::move(block));
+          }
+        } else {
+          log_->warn("Failed to retrieve blocks {} to {} from all the peers",
+                     height + 1,
+                     target_height);
+        }
+        subscriber.on_completed();
+      });
+}
+
+boost::optional<std::vector<std::shared_ptr<Block>>>
+BlockLoaderImpl::retrieveRange(proto::Loader::StubInterface &stub,
+                               types::HeightType first_height,
+                               types::HeightType last_height,
+                               grpc::ClientContext &context) {
+  proto::BlockRequest request;
+  protocol::Block block;
+
+  context.set_deadline(std::chrono::system_clock::now()
+                       + kBlocksRequestTimeout);
+  request.set_height(first_height);
+  request.set_last_height(last_height);
+
+  std::vector<std::shared_ptr<Block>> blocks;
+  auto reader = stub.retrieveBlocks(&context, request);
+  bool valid = true;
+  while (valid and reader->Read(&block)) {
+    valid = block_factory_.createBlock(std::move(block))
+                .match(
+                    [&](auto &&result) {
+                      if (result.value->height()
+                          != first_height + blocks.size()) {
+                        log_->error("Unexpected block {}",
+                                    result.value->height());
+                        return false;
+                      }
+                      blocks.push_back(std::move(result.value));
+                      return true;
+                    },
+                    [this](const auto &error) {
+                      log_->error("{}", error.error);
+                      return false;
+                    });
+  }
+  if (not valid) {
+    context.TryCancel();
+  }
+  auto status = reader->Finish();
+  if (not valid or not status.ok()
+      or blocks.size() != last_height - first_height + 1) {
+    return boost::none;
+  }
+  return blocks;
+}
+
 boost::optional<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlock(
     const PublicKey &peer_pubkey, types::HeightType block_height) {
   auto peer = findPeer(peer_pubkey);
@@ -110,6 +505,65 @@ boost::optional<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlock(
           });
 }
 
+boost::optional<WsvSnapshot> BlockLoaderImpl::retrieveWsvSnapshot(
+    const PublicKey &peer_pubkey) {
+  auto peer = findPeer(peer_pubkey);
+  if (not peer) {
+    log_->error("{}", kPeerNotFound);
+    return boost::none;
+  }
+
+  proto::WsvSnapshotRequest request;
+  grpc::ClientContext context;
+  context.set_deadline(std::chrono::system_clock::now()
+                       + kWsvSnapshotRequestTimeout);
+  auto reader = getPeerStub(**peer).retrieveWsvSnapshot(&context, request);
+
+  proto::WsvSnapshotChunk chunk;
+  if (not reader->Read(&chunk) or not chunk.has_header()) {
+    log_->error("WSV snapshot does not start with the header");
+    context.TryCancel();
+    reader->Finish();
+    return boost::none;
+  }
+  WsvSnapshot snapshot{chunk.header().height(),
+                       shared_model::crypto::Hash(chunk.header().block_hash()),
+                       {},
+                       chunk.header().state_digest()};
+
+  boost::optional<shared_model::crypto::Hash> digest;
+  while (not digest and reader->Read(&chunk)) {
+    switch (chunk.chunk_case()) {
+      case proto::WsvSnapshotChunk::kRows: {
+        auto &rows = *chunk.mutable_rows();
+        snapshot.rows.push_back(WsvSnapshot::Rows{
+            std::move(*rows.mutable_table()), std::move(*rows.mutable_rows())});
+        break;
+      }
+      case proto::WsvSnapshotChunk::kDigest:
+        digest = shared_model::crypto::Hash(chunk.digest());
+        break;
+      default:
+        log_->error("Unexpected part of WSV snapshot");
+        context.TryCancel();
+        reader->Finish();
+        return boost::none;
+    }
+  }
+  auto status = reader->Finish();
+  if (not status.ok()) {
+    log_->warn("{}", status.error_message());
+    return boost::none;
+  }
+
+  if (not digest or *digest != snapshot.digest()) {
+    log_->error("WSV snapshot at block {} does not match its digest",
+                snapshot.height);
+    return boost::none;
+  }
+  return snapshot;
+}
+
 boost::optional<std::shared_ptr<shared_model::interface::Peer>>
 BlockLoaderImpl::findPeer(const shared_model::crypto::PublicKey &pubkey) {
   auto peers = peer_query_factory_->createPeerQuery() |
@@ -131,15 +585,76 @@ BlockLoaderImpl::findPeer(const shared_model::crypto::PublicKey &pubkey) {
   return *it;
 }
 
+boost::optional<std::shared_ptr<shared_model::interface::Peer>>
+BlockLoaderImpl::resumeSource(const std::vector<types::AddressType> &failed) {
+  auto peers = peer_query_factory_->createPeerQuery() |
+      [](const auto &query) { return query->getLedgerPeers(); };
+  if (not peers) {
+    log_->error("{}", kPeerRetrieveFail);
+    return boost::none;
+  }
+
+  boost::optional<std::shared_ptr<shared_model::interface::Peer>> source;
+  double fastest = 0;
+  for (auto &peer : peers.value()) {
+    if (std::find(failed.begin(), failed.end(), peer->address())
+        != failed.end()) {
+      continue;
+    }
+    auto throughput = throughputOf(peer->address());
+    if (not source or throughput > fastest) {
+      source = peer;
+      fastest = throughput;
+    }
+  }
+  return source;
+}
+
+void BlockLoaderImpl::observeThroughput(const types::AddressType &address,
+                                        types::HeightType blocks,
+                                        std::chrono::nanoseconds elapsed) {
+  if (blocks == 0) {
+    return;
+  }
+  auto seconds = std::max(
+      std::chrono::duration_cast<std::chrono::duration<double>>(elapsed)
+          .count(),
+      1e-3);
+  auto sample = blocks / seconds;
+  std::lock_guard<std::mutex> lock(throughput_mutex_);
+  auto it = throughput_.find(address);
+  if (it == throughput_.end()) {
+    throughput_.emplace(address, sample);
+  } else {
+    it->second += (sample - it->second) * kThroughputWeight;
+  }
+}
+
+double BlockLoaderImpl::throughputOf(const types::AddressType &address) {
+  std::lock_guard<std::mutex> lock(throughput_mutex_);
+  auto it = throughput_.find(address);
+  return it == throughput_.end() ? 0. : it->second;
+}
+
+std::vector<proto::Loader::StubInterface *> BlockLoaderImpl::getPeerStubs(
+    const types::PublicKeyCollectionType &pubkeys) {
+  std::vector<proto::Loader::StubInterface *> stubs;
+  for (const auto &pubkey : pubkeys) {
+    if (auto peer = findPeer(pubkey)) {
+      stubs.push_back(&getPeerStub(**peer));
+    }
+  }
+  return stubs;
+}
+
 proto::Loader::StubInterface &BlockLoaderImpl::getPeerStub(
     const shared_model::interface::Peer &peer) {
   auto it = peer_connections_.find(peer.address());
   if (it == peer_connections_.end()) {
-    it = peer_connections_
-             .insert(std::make_pair(
-                 peer.address(),
-                 network::createClient<proto::Loader>(peer.address())))
-             .first;
+    auto stub = channel_pool_
+        ? channel_pool_->createClient<proto::Loader>(peer.address())
+        : network::createClient<proto::Loader>(peer.address());
+    it = peer_connections_.emplace(peer.address(), std::move(stub)).first;
   }
   return *it->second;
 }
@@ -8,33 +8,62 @@
 
 #include "network/block_loader.hpp"
 
+#include <chrono>
+#include <mutex>
 #include <unordered_map>
 
 #include "ametsuchi/peer_query_factory.hpp"
 #include "backend/protobuf/proto_block_factory.hpp"
 #include "loader.grpc.pb.h"
 #include "logger/logger_fwd.hpp"
+#include "network/impl/channel_pool.hpp"
 
 namespace iroha {
   namespace network {
     class BlockLoaderImpl : public BlockLoader {
      public:
+      /// number of the blocks requested from a peer at once by range download
+      static constexpr shared_model::interface::types::HeightType
+          kDefaultBlocksPerRange = 500;
+
       // TODO 30.01.2019 lebdron: IR-264 Remove PeerQueryFactory
+      /// @param channel_pool - shared channels to the peers, a separate
+      /// channel is created for every peer if it is null
       BlockLoaderImpl(
           std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
           shared_model::proto::ProtoBlockFactory factory,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          shared_model::interface::types::HeightType blocks_per_range =
+              kDefaultBlocksPerRange,
+          std::shared_ptr<ChannelPool> channel_pool = nullptr);
 
       rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
       retrieveBlocks(
           const shared_model::interface::types::HeightType height,
           const shared_model::crypto::PublicKey &peer_pubkey) override;
 
+      rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      retrieveBlockRanges(
+          const shared_model::interface::types::HeightType height,
+          const shared_model::interface::types::HeightType target_height,
+          const shared_model::interface::types::PublicKeyCollectionType
+              &peer_pubkeys) override;
+
+      rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      retrieveBlocksFromFastest(
+          const shared_model::interface::types::HeightType height,
+          const shared_model::interface::types::HeightType target_height,
+          const shared_model::interface::types::PublicKeyCollectionType
+              &peer_pubkeys) override;
+
       boost::optional<std::shared_ptr<shared_model::interface::Block>>
       retrieveBlock(
           const shared_model::crypto::PublicKey &peer_pubkey,
           shared_model::interface::types::HeightType block_height) override;
 
+      boost::optional<ametsuchi::WsvSnapshot> retrieveWsvSnapshot(
+          const shared_model::crypto::PublicKey &peer_pubkey) override;
+
      private:
       /**
        * Retrieve peers from database, and find the requested peer by pubkey
@@ -52,11 +81,69 @@ namespace iroha {
       proto::Loader::StubInterface &getPeerStub(
           const shared_model::interface::Peer &peer);
 
+      /**
+       * Get the stubs of the peers which are found in the ledger
+       * @param pubkeys - public keys of the peers
+       * @return RPC stubs in the order of the keys
+       */
+      std::vector<proto::Loader::StubInterface *> getPeerStubs(
+          const shared_model::interface::types::PublicKeyCollectionType
+              &pubkeys);
+
+      /**
+       * Retrieve the consecutive blocks of the given heights from the peer
+       * @param stub - RPC stub of the peer
+       * @param first_height - height of the first block
+       * @param last_height - height of the last block
+       * @param context - context of the call, which may be cancelled from
+       * another thread
+       * @return all the requested blocks, nullopt on failure
+       */
+      boost::optional<
+          std::vector<std::shared_ptr<shared_model::interface::Block>>>
+      retrieveRange(proto::Loader::StubInterface &stub,
+                    shared_model::interface::types::HeightType first_height,
+                    shared_model::interface::types::HeightType last_height,
+                    grpc::ClientContext &context);
+
+      /**
+       * Choose the peer to resume a broken block stream from
+       * @param failed - addresses of the peers which failed the stream
+       * @return the ledger peer of the highest throughput which has not
+       * failed, nullopt if there is none
+       */
+      boost::optional<std::shared_ptr<shared_model::interface::Peer>>
+      resumeSource(
+          const std::vector<shared_model::interface::types::AddressType>
+              &failed);
+
+      /**
+       * Record the throughput of a block stream from the peer
+       * @param address - address of the peer
+       * @param blocks - number of the verified blocks of the stream
+       * @param elapsed - duration of the stream
+       */
+      void observeThroughput(
+          const shared_model::interface::types::AddressType &address,
+          shared_model::interface::types::HeightType blocks,
+          std::chrono::nanoseconds elapsed);
+
+      /// @return moving average of the blocks per second streamed from the
+      /// peer, zero for a peer which has not streamed blocks yet
+      double throughputOf(
+          const shared_model::interface::types::AddressType &address);
+
       std::unordered_map<shared_model::interface::types::AddressType,
                          std::unique_ptr<proto::Loader::StubInterface>>
           peer_connections_;
       std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory_;
       shared_model::proto::ProtoBlockFactory block_factory_;
+      const shared_model::interface::types::HeightType blocks_per_range_;
+      std::shared_ptr<ChannelPool> channel_pool_;
+
+      std::mutex throughput_mutex_;
+      std::unordered_map<shared_model::interface::types::AddressType, double>
+          throughput_;
 
       logger::LoggerPtr log_;
     };
@@ -5,6 +5,9 @@
 
 #include "network/impl/block_loader_service.hpp"
 
+#include <algorithm>
+#include <thread>
+
 #include "backend/protobuf/block.hpp"
 #include "common/bind.hpp"
 #include "logger/logger.hpp"
@@ -32,19 +35,82 @@ static grpc::Status handleGetBlockError(const BlockQuery::GetBlockError &error,
   }
 }
 
+/**
+ * Fill the message from the serialized block of the storage
+ * @return error status if the block is malformed, none otherwise
+ */
+static boost::optional<grpc::Status> parseBlock(
+    const std::string &serialized_block,
+    protocol::Block &block,
+    const logger::LoggerPtr &log) {
+  if (not block.mutable_block_v1()->ParseFromString(serialized_block)) {
+    log->error("Could not parse a block from block storage");
+    return grpc::Status(grpc::StatusCode::INTERNAL,
+                        "Internal error while parsing block.");
+  }
+  return boost::none;
+}
+
+namespace {
+  /// the longest wait for the bandwidth before checking the cancellation
+  const std::chrono::milliseconds kMaxBandwidthWait{100};
+
+  /// Counts the stream among the served ones while it exists
+  class ServedStream {
+   public:
+    explicit ServedStream(std::atomic<size_t> &streams) : streams_(streams) {
+      count_ = ++streams_;
+    }
+
+    ~ServedStream() {
+      --streams_;
+    }
+
+    /// @return number of the streams served, including this one
+    size_t count() const {
+      return count_;
+    }
+
+   private:
+    std::atomic<size_t> &streams_;
+    size_t count_;
+  };
+}  // namespace
+
 BlockLoaderService::BlockLoaderService(
     std::shared_ptr<BlockQueryFactory> block_query_factory,
     std::shared_ptr<iroha::consensus::ConsensusResultCache>
         consensus_result_cache,
-    logger::LoggerPtr log)
+    std::shared_ptr<WsvSnapshotFactory> wsv_snapshot_factory,
+    logger::LoggerPtr log,
+    size_t max_streams,
+    size_t bandwidth,
+    uint32_t cached_blocks,
+    std::shared_ptr<CompressionPolicy> block_compression)
     : block_query_factory_(std::move(block_query_factory)),
       consensus_result_cache_(std::move(consensus_result_cache)),
-      log_(std::move(log)) {}
+      wsv_snapshot_factory_(std::move(wsv_snapshot_factory)),
+      log_(std::move(log)),
+      max_streams_(max_streams),
+      bandwidth_(bandwidth),
+      available_bytes_(bandwidth),
+      bandwidth_time_(std::chrono::steady_clock::now()),
+      cache_(cached_blocks, cached_blocks / 2),
+      block_compression_(std::move(block_compression)) {}
 
 grpc::Status BlockLoaderService::retrieveBlocks(
     ::grpc::ServerContext *context,
     const proto::BlockRequest *request,
     ::grpc::ServerWriter<::iroha::protocol::Block> *writer) {
+  ServedStream stream(streams_);
+  if (max_streams_ != 0 and stream.count() > max_streams_) {
+    rejected_streams_.increment();
+    log_->info("Rejected block stream, {} streams are served already",
+               max_streams_);
+    return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                        "Too many block streams.");
+  }
+
   auto block_query = block_query_factory_->createBlockQuery();
   if (not block_query) {
     log_->error("Could not create block query to retrieve block from storage");
@@ -52,27 +118,106 @@ grpc::Status BlockLoaderService::retrieveBlocks(
   }
 
   auto top_height = (*block_query)->getTopBlockHeight();
+  if (request->last_height() != 0) {
+    top_height = std::min<decltype(top_height)>(top_height,
+                                                request->last_height());
+  }
+  if (block_compression_) {
+    block_compression_->prepareStream(*context);
+  }
   for (decltype(top_height) i = request->height(); i <= top_height; ++i) {
-    auto block_result = (*block_query)->getBlock(i);
+    CachedBlock proto_block;
+    if (auto status = getStreamedBlock(**block_query, i, proto_block)) {
+      return *status;
+    }
+    const auto block_bytes = proto_block->ByteSizeLong();
+    if (not spendBandwidth(block_bytes, *context)) {
+      return grpc::Status::CANCELLED;
+    }
+
+    writer->Write(*proto_block,
+                  block_compression_
+                      ? block_compression_->writeOptions(block_bytes)
+                      : grpc::WriteOptions{});
+  }
+
+  return grpc::Status::OK;
+}
 
-    if (auto e = expected::resultToOptionalError(block_result)) {
-      return handleGetBlockError(e.value(), log_);
+boost::optional<grpc::Status> BlockLoaderService::getStreamedBlock(
+    BlockQuery &block_query,
+    shared_model::interface::types::HeightType height,
+    CachedBlock &block) {
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    if (auto cached = cache_.findItem(height)) {
+      cached_block_hits_.increment();
+      block = std::move(*cached);
+      return boost::none;
     }
+  }
+
+  auto block_result = block_query.getSerializedBlock(height);
+  if (auto e = expected::resultToOptionalError(block_result)) {
+    return handleGetBlockError(e.value(), log_);
+  }
 
-    auto &block =
-        boost::get<
-            expected::Value<std::unique_ptr<shared_model::interface::Block>>>(
-            block_result)
-            .value;
+  const auto &serialized_block =
+      boost::get<expected::ValueOf<decltype(block_result)>>(block_result)
+          .value;
+  auto parsed_block = std::make_shared<protocol::Block>();
+  if (auto status = parseBlock(serialized_block, *parsed_block, log_)) {
+    return status;
+  }
+  block = parsed_block;
 
-    protocol::Block proto_block;
-    *proto_block.mutable_block_v1() =
-        static_cast<shared_model::proto::Block *>(block.get())->getTransport();
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  cache_.addItem(height, block);
+  return boost::none;
+}
 
-    writer->Write(proto_block);
+bool BlockLoaderService::spendBandwidth(size_t bytes,
+                                        const grpc::ServerContext &context) {
+  if (bandwidth_ == 0) {
+    return true;
   }
 
-  return grpc::Status::OK;
+  std::unique_lock<std::mutex> lock(bandwidth_mutex_);
+  // the bytes are taken at once, so a block larger than the bandwidth is sent
+  // as well, and the next streams wait until the debt is paid
+  const auto now = std::chrono::steady_clock::now();
+  available_bytes_ = std::min<double>(
+      bandwidth_,
+      available_bytes_
+          + bandwidth_
+              * std::chrono::duration<double>(now - bandwidth_time_).count());
+  bandwidth_time_ = now;
+  available_bytes_ -= bytes;
+  if (available_bytes_ >= 0) {
+    return true;
+  }
+  auto wait = std::chrono::duration<double>(-available_bytes_ / bandwidth_);
+  lock.unlock();
+
+  const auto until = now + wait;
+  while (std::chrono::steady_clock::now() < until) {
+    if (context.IsCancelled()) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            until - std::chrono::steady_clock::now()),
+        kMaxBandwidthWait));
+  }
+  return true;
+}
+
+const Counter &BlockLoaderService::rejectedStreams() const {
+  return rejected_streams_;
+}
+
+const Counter &BlockLoaderService::cachedBlockHits() const {
+  return cached_block_hits_;
 }
 
 grpc::Status BlockLoaderService::retrieveBlock(
@@ -111,17 +256,47 @@ grpc::Status BlockLoaderService::retrieveBlock(
     return grpc::Status(grpc::StatusCode::INTERNAL, "internal error happened");
   }
 
-  auto block_result = (*block_query)->getBlock(height);
+  auto block_result = (*block_query)->getSerializedBlock(height);
 
   if (auto e = expected::resultToOptionalError(block_result)) {
     return handleGetBlockError(e.value(), log_);
   }
 
-  auto &block =
+  const auto &serialized_block =
       boost::get<expected::ValueOf<decltype(block_result)>>(block_result).value;
+  return parseBlock(serialized_block, *response, log_)
+      .value_or(grpc::Status::OK);
+}
+
+grpc::Status BlockLoaderService::retrieveWsvSnapshot(
+    ::grpc::ServerContext *context,
+    const proto::WsvSnapshotRequest *request,
+    ::grpc::ServerWriter<proto::WsvSnapshotChunk> *writer) {
+  auto snapshot = wsv_snapshot_factory_->createWsvSnapshot();
+  if (auto e = expected::resultToOptionalError(snapshot)) {
+    log_->error("Could not create WSV snapshot: {}", e.value());
+    return grpc::Status(grpc::StatusCode::INTERNAL,
+                        "Internal error while creating WSV snapshot.");
+  }
+  const auto &value =
+      boost::get<expected::ValueOf<decltype(snapshot)>>(snapshot).value;
+
+  proto::WsvSnapshotChunk chunk;
+  chunk.mutable_header()->set_height(value.height);
+  chunk.mutable_header()->set_block_hash(
+      shared_model::crypto::toBinaryString(value.block_hash));
+  chunk.mutable_header()->set_state_digest(value.state_digest);
+  writer->Write(chunk);
+  for (const auto &rows : value.rows) {
+    if (context->IsCancelled()) {
+      return grpc::Status::CANCELLED;
+    }
+    chunk.mutable_rows()->set_table(rows.table);
+    chunk.mutable_rows()->set_rows(rows.rows);
+    writer->Write(chunk);
+  }
+  chunk.set_digest(shared_model::crypto::toBinaryString(value.digest()));
+  writer->Write(chunk);
 
-  const auto &block_v1 =
-      static_cast<shared_model::proto::Block *>(block.get())->getTransport();
-  *response->mutable_block_v1() = block_v1;
   return grpc::Status::OK;
 }
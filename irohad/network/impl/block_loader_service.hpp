@@ -6,20 +6,52 @@
 #ifndef IROHA_BLOCK_LOADER_SERVICE_HPP
 #define IROHA_BLOCK_LOADER_SERVICE_HPP
 
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
 #include "ametsuchi/block_query_factory.hpp"
+#include "ametsuchi/wsv_snapshot_factory.hpp"
+#include "cache/cache.hpp"
+#include "common/counter.hpp"
 #include "consensus/consensus_block_cache.hpp"
 #include "loader.grpc.pb.h"
 #include "logger/logger_fwd.hpp"
+#include "network/impl/compression_policy.hpp"
 
 namespace iroha {
   namespace network {
+    /**
+     * Service of the blocks and the WSV snapshots to the synchronizing peers.
+     * The streamed blocks are shared by the concurrent streams through the
+     * cache of the parsed messages, and the streams are limited in number and
+     * in bandwidth. The single blocks requested by the consensus are not
+     * limited
+     */
     class BlockLoaderService : public proto::Loader::Service {
      public:
+      /// number of the recently streamed blocks kept parsed
+      static constexpr uint32_t kDefaultCachedBlocks = 512;
+
+      /**
+       * @param max_streams - maximal number of the block streams served at
+       * once, 0 does not limit them
+       * @param bandwidth - bytes per second shared by the block streams, 0
+       * does not limit them
+       * @param cached_blocks - number of the streamed blocks kept parsed
+       * @param block_compression - compression of the streamed blocks, they
+       * are not compressed if it is null
+       */
       BlockLoaderService(
           std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
           std::shared_ptr<iroha::consensus::ConsensusResultCache>
               consensus_result_cache,
-          logger::LoggerPtr log);
+          std::shared_ptr<ametsuchi::WsvSnapshotFactory> wsv_snapshot_factory,
+          logger::LoggerPtr log,
+          size_t max_streams = 0,
+          size_t bandwidth = 0,
+          uint32_t cached_blocks = kDefaultCachedBlocks,
+          std::shared_ptr<CompressionPolicy> block_compression = nullptr);
 
       grpc::Status retrieveBlocks(
           ::grpc::ServerContext *context,
@@ -30,11 +62,62 @@ namespace iroha {
                                  const proto::BlockRequest *request,
                                  protocol::Block *response) override;
 
+      grpc::Status retrieveWsvSnapshot(
+          ::grpc::ServerContext *context,
+          const proto::WsvSnapshotRequest *request,
+          ::grpc::ServerWriter<proto::WsvSnapshotChunk> *writer) override;
+
+      /// block streams rejected due to the limit of the streams
+      const Counter &rejectedStreams() const;
+
+      /// streamed blocks found in the cache of the parsed blocks
+      const Counter &cachedBlockHits() const;
+
      private:
+      using CachedBlock = std::shared_ptr<const protocol::Block>;
+
+      /**
+       * Get the parsed block from the cache or from the storage
+       * @param block_query - query of the storage
+       * @param height - height of the block
+       * @param block - the block on success
+       * @return error status on failure, none otherwise
+       */
+      boost::optional<grpc::Status> getStreamedBlock(
+          ametsuchi::BlockQuery &block_query,
+          shared_model::interface::types::HeightType height,
+          CachedBlock &block);
+
+      /**
+       * Wait until the bandwidth of the streams allows to send the given
+       * number of bytes
+       * @return false if the stream was cancelled while waiting
+       */
+      bool spendBandwidth(size_t bytes, const grpc::ServerContext &context);
+
       std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory_;
       std::shared_ptr<iroha::consensus::ConsensusResultCache>
           consensus_result_cache_;
+      std::shared_ptr<ametsuchi::WsvSnapshotFactory> wsv_snapshot_factory_;
       logger::LoggerPtr log_;
+
+      const size_t max_streams_;
+      std::atomic<size_t> streams_{0};
+
+      const size_t bandwidth_;
+      std::mutex bandwidth_mutex_;
+      /// bytes which may be sent now, negative when the streams are in debt
+      double available_bytes_;
+      std::chrono::steady_clock::time_point bandwidth_time_;
+
+      std::mutex cache_mutex_;
+      cache::Cache<shared_model::interface::types::HeightType, CachedBlock>
+          cache_;
+
+      std::shared_ptr<CompressionPolicy> block_compression_;
+
+      Counter rejected_streams_;
+      Counter cached_block_hits_;
     };
   }  // namespace network
 }  // namespace iroha
@@ -0,0 +1,93 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/channel_pool.hpp"
+
+#include "common/thread_name.hpp"
+#include "network/impl/grpc_channel_builder.hpp"
+
+using namespace iroha::network;
+
+namespace {
+  /// the watches are renewed with this period, which bounds the time the
+  /// pool takes to be destroyed
+  constexpr std::chrono::milliseconds kWatchPeriod{200};
+}  // namespace
+
+ChannelPool::ChannelPool(
+    std::vector<std::string> services,
+    std::shared_ptr<grpc::ChannelCredentials> credentials)
+    : services_(std::move(services)),
+      credentials_(std::move(credentials)),
+      watcher_([this] { watchConnections(); }) {}
+
+ChannelPool::~ChannelPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+    queue_.Shutdown();
+  }
+  watcher_.join();
+}
+
+std::shared_ptr<grpc::Channel> ChannelPool::getChannel(
+    const std::string &address, grpc_compression_algorithm compression) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &channel = channels_[std::make_pair(address, compression)];
+  if (not channel) {
+    channel = grpc::CreateCustomChannel(
+        address,
+        credentials_,
+        details::getChannelArguments(services_, compression));
+    watches_.push_back({channel, channel->GetState(false)});
+    watch(watches_.back());
+  }
+  return channel;
+}
+
+void ChannelPool::warmUp(const std::vector<std::string> &addresses) {
+  for (const auto &address : addresses) {
+    // the state request with try_to_connect starts the connection in the
+    // background
+    getChannel(address)->GetState(true);
+  }
+}
+
+size_t ChannelPool::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return channels_.size();
+}
+
+const iroha::Counter &ChannelPool::connections() const {
+  return connections_;
+}
+
+void ChannelPool::watch(Watch &watch) {
+  if (not stopping_) {
+    watch.channel->NotifyOnStateChange(
+        watch.state,
+        std::chrono::system_clock::now() + kWatchPeriod,
+        &queue_,
+        &watch);
+  }
+}
+
+void ChannelPool::watchConnections() {
+  setThreadName("channel-pool");
+  void *tag;
+  bool changed;
+  while (queue_.Next(&tag, &changed)) {
+    auto &watch = *static_cast<Watch *>(tag);
+    if (changed) {
+      auto state = watch.channel->GetState(false);
+      if (state == GRPC_CHANNEL_READY and watch.state != GRPC_CHANNEL_READY) {
+        connections_.increment();
+      }
+      watch.state = state;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    this->watch(watch);
+  }
+}
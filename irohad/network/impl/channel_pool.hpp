@@ -0,0 +1,111 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CHANNEL_POOL_HPP
+#define IROHA_CHANNEL_POOL_HPP
+
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <grpc++/grpc++.h>
+#include "common/counter.hpp"
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Channels to the peers shared by the inter-peer services, one per peer
+     * address and compression algorithm. Every stub created by the pool for
+     * a peer multiplexes its calls over the same HTTP/2 connection, so the
+     * connection and its handshake are not repeated by every service.
+     * The connections of the channels are watched on a thread of the pool.
+     */
+    class ChannelPool {
+     public:
+      /**
+       * @param services - full names of the services called over the
+       * channels, which get the retry policy and the message size limits
+       * @param credentials - credentials of the channels
+       */
+      explicit ChannelPool(std::vector<std::string> services,
+                           std::shared_ptr<grpc::ChannelCredentials>
+                               credentials = grpc::InsecureChannelCredentials());
+
+      ~ChannelPool();
+
+      /**
+       * @param address - address of the peer, ipv4:port
+       * @param compression - algorithm of the compression of the requests
+       * @return the channel to the peer, which is created on the first call
+       */
+      std::shared_ptr<grpc::Channel> getChannel(
+          const std::string &address,
+          grpc_compression_algorithm compression = GRPC_COMPRESS_NONE);
+
+      /**
+       * Create the stub on the shared channel to the peer
+       * @tparam T type for gRPC stub, e.g. proto::Yac
+       */
+      template <typename T>
+      std::unique_ptr<typename T::Stub> createClient(
+          const std::string &address,
+          grpc_compression_algorithm compression = GRPC_COMPRESS_NONE) {
+        return T::NewStub(getChannel(address, compression));
+      }
+
+      /**
+       * Start connecting the uncompressed channels to the peers, so the
+       * first calls to them do not wait for the connections
+       * @param addresses - addresses of the peers
+       */
+      void warmUp(const std::vector<std::string> &addresses);
+
+      /// @return number of the channels in the pool
+      size_t size() const;
+
+      /// number of the connections the channels have established, each
+      /// with a handshake, which is a TLS one for the secure channels
+      const Counter &connections() const;
+
+     private:
+      /// connectivity of a channel, as last seen by the watcher
+      struct Watch {
+        std::shared_ptr<grpc::Channel> channel;
+        grpc_connectivity_state state;
+      };
+
+      /// wait for the change of the state of the channel, under the mutex
+      void watch(Watch &watch);
+
+      /// count the connections of the channels till the pool is destroyed
+      void watchConnections();
+
+      const std::vector<std::string> services_;
+      const std::shared_ptr<grpc::ChannelCredentials> credentials_;
+
+      mutable std::mutex mutex_;
+      std::map<std::pair<std::string, grpc_compression_algorithm>,
+               std::shared_ptr<grpc::Channel>>
+          channels_;
+      /// the list keeps the addresses of the watches, which are the tags of
+      /// the completion queue
+      std::list<Watch> watches_;
+      bool stopping_ = false;
+
+      Counter connections_;
+      grpc::CompletionQueue queue_;
+      std::thread watcher_;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_CHANNEL_POOL_HPP
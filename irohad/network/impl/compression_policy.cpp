@@ -0,0 +1,51 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/compression_policy.hpp"
+
+using namespace iroha::network;
+
+boost::optional<grpc_compression_algorithm> CompressionPolicy::parseAlgorithm(
+    const std::string &name) {
+  if (name == "none") {
+    return GRPC_COMPRESS_NONE;
+  }
+  if (name == "gzip") {
+    return GRPC_COMPRESS_GZIP;
+  }
+  if (name == "deflate") {
+    return GRPC_COMPRESS_DEFLATE;
+  }
+  return boost::none;
+}
+
+CompressionPolicy::CompressionPolicy(grpc_compression_algorithm algorithm,
+                                     size_t min_bytes)
+    : algorithm_(algorithm), min_bytes_(min_bytes) {}
+
+grpc_compression_algorithm CompressionPolicy::select(size_t message_bytes) {
+  if (algorithm_ == GRPC_COMPRESS_NONE or message_bytes < min_bytes_) {
+    uncompressed_bytes_.increment(message_bytes);
+    return GRPC_COMPRESS_NONE;
+  }
+  compressed_bytes_.increment(message_bytes);
+  return algorithm_;
+}
+
+grpc::WriteOptions CompressionPolicy::writeOptions(size_t message_bytes) {
+  grpc::WriteOptions options;
+  if (select(message_bytes) == GRPC_COMPRESS_NONE) {
+    options.set_no_compression();
+  }
+  return options;
+}
+
+const iroha::Counter &CompressionPolicy::compressedBytes() const {
+  return compressed_bytes_;
+}
+
+const iroha::Counter &CompressionPolicy::uncompressedBytes() const {
+  return uncompressed_bytes_;
+}
@@ -0,0 +1,86 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMPRESSION_POLICY_HPP
+#define IROHA_COMPRESSION_POLICY_HPP
+
+#include <string>
+
+#include <grpc++/grpc++.h>
+#include <boost/optional.hpp>
+#include "common/counter.hpp"
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Compression of the messages of an inter-peer service. The algorithm
+     * is selected per message, so the messages smaller than the threshold,
+     * for which the compression does not pay off, are sent as they are.
+     * May be used from any thread
+     */
+    class CompressionPolicy {
+     public:
+      /**
+       * @param name - "none", "gzip" or "deflate"
+       * @return the algorithm, none if the name is unknown
+       */
+      static boost::optional<grpc_compression_algorithm> parseAlgorithm(
+          const std::string &name);
+
+      /**
+       * @param algorithm - algorithm of the compressed messages
+       * @param min_bytes - size of the smallest message to compress
+       */
+      CompressionPolicy(grpc_compression_algorithm algorithm,
+                        size_t min_bytes);
+
+      /**
+       * Select the compression of a message and count its size
+       * @param message_bytes - serialized size of the message
+       * @return the algorithm of the policy, GRPC_COMPRESS_NONE for the
+       * messages below the threshold
+       */
+      grpc_compression_algorithm select(size_t message_bytes);
+
+      /**
+       * Set the compression of a stream before its first message, the
+       * messages are written with the options of writeOptions
+       * @param context - context of the stream
+       */
+      template <typename Context>
+      void prepareStream(Context &context) const {
+        if (algorithm_ != GRPC_COMPRESS_NONE) {
+          context.set_compression_algorithm(algorithm_);
+        }
+      }
+
+      /**
+       * Select the compression of a message of a stream prepared with
+       * prepareStream and count its size
+       * @param message_bytes - serialized size of the message
+       * @return options of the write, which disable the compression of the
+       * messages below the threshold
+       */
+      grpc::WriteOptions writeOptions(size_t message_bytes);
+
+      /// size of the messages sent compressed, before the compression
+      const Counter &compressedBytes() const;
+
+      /// size of the messages sent uncompressed
+      const Counter &uncompressedBytes() const;
+
+     private:
+      const grpc_compression_algorithm algorithm_;
+      const size_t min_bytes_;
+
+      Counter compressed_bytes_;
+      Counter uncompressed_bytes_;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_COMPRESSION_POLICY_HPP
@@ -8,8 +8,11 @@
 
 #include <limits>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <grpc++/grpc++.h>
+#include <grpc/grpc_security.h>
 #include <boost/format.hpp>
 
 namespace iroha {
@@ -20,15 +23,69 @@ namespace iroha {
       constexpr unsigned int kMaxResponseMessageBytes =
           std::numeric_limits<int>::max();
 
-      template <typename T>
-      grpc::ChannelArguments getChannelArguments() {
+      /// interval of the keepalive pings of an idle connection, the servers
+      /// accept the pings twice as often
+      constexpr int kKeepaliveTimeMs = 30000;
+      /// time to wait for the acknowledgement of a keepalive ping
+      constexpr int kKeepaliveTimeoutMs = 10000;
+      /// initial HTTP/2 flow control window of a stream, the window grows
+      /// further with the bandwidth-delay product probes
+      constexpr int kStreamLookaheadBytes = 4 * 1024 * 1024;
+      /// number of the servers whose TLS sessions are kept for resumption
+      constexpr size_t kTlsSessionCacheCapacity = 1024;
+
+      /**
+       * TLS sessions of the client channels of the process. A channel which
+       * reconnects to a server after a timeout or a restart of the server
+       * resumes the cached session with its ticket, which skips the key
+       * exchange and the verification of the certificate, instead of the
+       * full handshake. The cache is never destroyed, since the channels
+       * may outlive any owner of it
+       */
+      inline grpc_ssl_session_cache *tlsSessionCache() {
+        static auto cache =
+            grpc_ssl_session_cache_create_lru(kTlsSessionCacheCapacity);
+        return cache;
+      }
+
+      /**
+       * @param services - full names of the services called over the channel,
+       * which get the retry policy and the message size limits
+       * @param compression - algorithm of the compression of the requests
+       * @return arguments of the channel
+       */
+      inline grpc::ChannelArguments getChannelArguments(
+          const std::vector<std::string> &services,
+          grpc_compression_algorithm compression = GRPC_COMPRESS_NONE) {
         grpc::ChannelArguments args;
+        if (compression != GRPC_COMPRESS_NONE) {
+          args.SetCompressionAlgorithm(compression);
+        }
+        // the idle connections to the peers are kept alive, so the next
+        // round does not pay for the handshake
+        args.SetInt(GRPC_ARG_KEEPALIVE_TIME_MS, kKeepaliveTimeMs);
+        args.SetInt(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, kKeepaliveTimeoutMs);
+        args.SetInt(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+        args.SetInt(GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA, 0);
+        args.SetInt(GRPC_ARG_HTTP2_BDP_PROBE, 1);
+        args.SetInt(GRPC_ARG_HTTP2_STREAM_LOOKAHEAD_BYTES,
+                    kStreamLookaheadBytes);
+        // the insecure channels ignore the cache
+        auto session_cache =
+            grpc_ssl_session_cache_create_channel_arg(tlsSessionCache());
+        args.SetPointerWithVtable(session_cache.key,
+                                  session_cache.value.pointer.p,
+                                  session_cache.value.pointer.vtable);
+
+        std::string names;
+        for (const auto &service : services) {
+          names += (names.empty() ? "" : ", ")
+              + (boost::format(R"({ "service": "%1%" })") % service).str();
+        }
         args.SetServiceConfigJSON((boost::format(R"(
             {
               "methodConfig": [ {
-                "name": [
-                  { "service": "%1%" }
-                ],
+                "name": [ %1% ],
                 "retryPolicy": {
                   "maxAttempts": 5,
                   "initialBackoff": "5s",
@@ -44,12 +101,17 @@ namespace iroha {
                 "maxRequestMessageBytes": %2%,
                 "maxResponseMessageBytes": %3%
               } ]
-            })") % T::service_full_name()
-                                   % kMaxRequestMessageBytes
+            })") % names % kMaxRequestMessageBytes
                                    % kMaxResponseMessageBytes)
                                       .str());
         return args;
       }
+
+      template <typename T>
+      grpc::ChannelArguments getChannelArguments(
+          grpc_compression_algorithm compression = GRPC_COMPRESS_NONE) {
+        return getChannelArguments({T::service_full_name()}, compression);
+      }
     }  // namespace details
 
     /**
@@ -59,14 +121,16 @@ namespace iroha {
      * @tparam T type for gRPC stub, e.g. proto::Yac
      * @param address ip address for connection, ipv4:port
      * @param credentials credentials for the gRPC channel
+     * @param compression algorithm of the compression of the requests
      * @return gRPC stub of parametrized type
      */
     template <typename T>
     auto createClientWithCredentials(
         const grpc::string &address,
-        std::shared_ptr<grpc::ChannelCredentials> credentials) {
+        std::shared_ptr<grpc::ChannelCredentials> credentials,
+        grpc_compression_algorithm compression = GRPC_COMPRESS_NONE) {
       return T::NewStub(grpc::CreateCustomChannel(
-          address, credentials, details::getChannelArguments<T>()));
+          address, credentials, details::getChannelArguments<T>(compression)));
     }
 
     /**
@@ -74,12 +138,15 @@ namespace iroha {
      * messages of INT_MAX bytes size
      * @tparam T type for gRPC stub, e.g. proto::Yac
      * @param address ip address for connection, ipv4:port
+     * @param compression algorithm of the compression of the requests
      * @return gRPC stub of parametrized type
      */
     template <typename T>
-    auto createClient(const grpc::string &address) {
-      return createClientWithCredentials<T>(address,
-                                            grpc::InsecureChannelCredentials());
+    auto createClient(
+        const grpc::string &address,
+        grpc_compression_algorithm compression = GRPC_COMPRESS_NONE) {
+      return createClientWithCredentials<T>(
+          address, grpc::InsecureChannelCredentials(), compression);
     }
 
     /**
@@ -19,16 +19,21 @@ namespace iroha {
         std::shared_ptr<synchronizer::Synchronizer> synchronizer,
         std::shared_ptr<iroha::simulator::VerifiedProposalCreator>
             proposal_creator,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        BatchObserver batch_observer)
         : ordering_gate_(std::move(ordering_gate)),
           synchronizer_(std::move(synchronizer)),
           proposal_creator_(std::move(proposal_creator)),
-          log_{std::move(log)} {}
+          log_{std::move(log)},
+          batch_observer_(std::move(batch_observer)) {}
 
     void PeerCommunicationServiceImpl::propagate_batch(
         std::shared_ptr<shared_model::interface::TransactionBatch> batch)
         const {
       log_->info("propagate batch");
+      if (batch_observer_) {
+        batch_observer_(*batch);
+      }
       ordering_gate_->propagateBatch(batch);
     }
 
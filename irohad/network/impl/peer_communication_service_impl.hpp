@@ -8,6 +8,8 @@
 
 #include "network/peer_communication_service.hpp"
 
+#include <functional>
+
 #include "logger/logger_fwd.hpp"
 
 namespace iroha {
@@ -24,11 +26,19 @@ namespace iroha {
 
     class PeerCommunicationServiceImpl : public PeerCommunicationService {
      public:
+      using BatchObserver = std::function<void(
+          const shared_model::interface::TransactionBatch &)>;
+
+      /**
+       * @param batch_observer - called with each batch before it is
+       * propagated, e.g. to capture the traffic of the peer
+       */
       PeerCommunicationServiceImpl(
           std::shared_ptr<OrderingGate> ordering_gate,
           std::shared_ptr<synchronizer::Synchronizer> synchronizer,
           std::shared_ptr<simulator::VerifiedProposalCreator> proposal_creator,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          BatchObserver batch_observer = {});
 
       void propagate_batch(
           std::shared_ptr<shared_model::interface::TransactionBatch> batch)
@@ -47,6 +57,7 @@ namespace iroha {
       std::shared_ptr<synchronizer::Synchronizer> synchronizer_;
       std::shared_ptr<simulator::VerifiedProposalCreator> proposal_creator_;
       logger::LoggerPtr log_;
+      BatchObserver batch_observer_;
     };
   }  // namespace network
 }  // namespace iroha
@@ -26,6 +26,13 @@ namespace iroha {
       virtual void onNewState(const shared_model::crypto::PublicKey &from,
                               MstState new_state) = 0;
 
+      /**
+       * Handler method for the summaries of the states of other peers
+       * @param digest - digest of a batch from the summary
+       * @return true, if the batch or some of its signatures should be pulled
+       */
+      virtual bool isMissing(const BatchDigest &digest) const = 0;
+
       virtual ~MstTransportNotification() = default;
     };
 
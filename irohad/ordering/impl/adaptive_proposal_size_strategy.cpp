@@ -0,0 +1,89 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/adaptive_proposal_size_strategy.hpp"
+
+#include <algorithm>
+
+#include "ordering/impl/on_demand_common.hpp"
+
+using namespace iroha::ordering;
+
+constexpr double AdaptiveProposalSizeStrategy::kSmoothingFactor;
+
+AdaptiveProposalSizeStrategy::AdaptiveProposalSizeStrategy(
+    std::shared_ptr<ProposalCreationStrategy> strategy,
+    size_t min_size,
+    size_t max_size,
+    std::chrono::milliseconds target_round_time,
+    std::function<ClockType::time_point()> time_provider)
+    : strategy_(std::move(strategy)),
+      min_size_(std::max<size_t>(1, std::min(min_size, max_size))),
+      max_size_(max_size),
+      target_round_time_(target_round_time),
+      time_provider_(std::move(time_provider)),
+      limit_(max_size_) {}
+
+void AdaptiveProposalSizeStrategy::onCollaborationOutcome(
+    RoundType round, size_t peers_in_round) {
+  strategy_->onCollaborationOutcome(round, peers_in_round);
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto now = time_provider_();
+  if (current_round_) {
+    auto packed = packed_.find(current_round_->first);
+    if (packed != packed_.end() and packed->second > 0) {
+      if (round.reject_round == kFirstRejectRound) {
+        // previous round is committed, update the estimate
+        double elapsed =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                now - current_round_->second)
+                .count();
+        double sample = elapsed / packed->second;
+        time_per_transaction_ = time_per_transaction_
+            ? kSmoothingFactor * sample
+                + (1 - kSmoothingFactor) * *time_per_transaction_
+            : sample;
+        double target =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                target_round_time_)
+                .count();
+        double limit = target / std::max(*time_per_transaction_, 1.);
+        limit_ = limit >= max_size_
+            ? max_size_
+            : std::max(min_size_, static_cast<size_t>(limit));
+      } else {
+        // previous round with the proposal is rejected, back off
+        limit_ = std::max(min_size_, limit_ / 2);
+      }
+    }
+  }
+  current_round_ = std::make_pair(round, now);
+  packed_.erase(packed_.begin(), packed_.lower_bound(round));
+}
+
+bool AdaptiveProposalSizeStrategy::shouldCreateRound(RoundType round) {
+  return strategy_->shouldCreateRound(round);
+}
+
+boost::optional<ProposalCreationStrategy::RoundType>
+AdaptiveProposalSizeStrategy::onProposalRequest(RoundType requested_round) {
+  return strategy_->onProposalRequest(requested_round);
+}
+
+size_t AdaptiveProposalSizeStrategy::proposalSizeLimit(
+    RoundType round, size_t max_transactions) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return std::min(limit_,
+                  strategy_->proposalSizeLimit(round, max_transactions));
+}
+
+void AdaptiveProposalSizeStrategy::onProposalPacked(RoundType round,
+                                                    size_t transactions) {
+  strategy_->onProposalPacked(round, transactions);
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  packed_[round] = transactions;
+}
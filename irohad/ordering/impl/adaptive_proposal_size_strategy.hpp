@@ -0,0 +1,83 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ADAPTIVE_PROPOSAL_SIZE_STRATEGY_HPP
+#define IROHA_ADAPTIVE_PROPOSAL_SIZE_STRATEGY_HPP
+
+#include "ordering/ordering_service_proposal_creation_strategy.hpp"
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Creation strategy which adjusts the size of proposals to the measured
+     * time of a round per transaction: the limit is chosen so that the
+     * proposal is validated and committed within the target round time.
+     * If the round with a non-empty proposal is rejected, the limit is
+     * halved. Decisions whether to create a proposal are delegated to the
+     * underlying strategy.
+     */
+    class AdaptiveProposalSizeStrategy : public ProposalCreationStrategy {
+     public:
+      using ClockType = std::chrono::steady_clock;
+
+      /**
+       * @param strategy - underlying strategy
+       * @param min_size - min limit of transactions in a proposal
+       * @param max_size - max limit of transactions in a proposal
+       * @param target_round_time - desired time of a round
+       * @param time_provider - source of round start times
+       */
+      AdaptiveProposalSizeStrategy(
+          std::shared_ptr<ProposalCreationStrategy> strategy,
+          size_t min_size,
+          size_t max_size,
+          std::chrono::milliseconds target_round_time,
+          std::function<ClockType::time_point()> time_provider =
+              ClockType::now);
+
+      void onCollaborationOutcome(RoundType round,
+                                  size_t peers_in_round) override;
+
+      bool shouldCreateRound(RoundType round) override;
+
+      boost::optional<RoundType> onProposalRequest(
+          RoundType requested_round) override;
+
+      size_t proposalSizeLimit(RoundType round,
+                               size_t max_transactions) override;
+
+      void onProposalPacked(RoundType round, size_t transactions) override;
+
+     private:
+      /// weight of the last measurement in the time per transaction estimate
+      static constexpr double kSmoothingFactor = 0.5;
+
+      std::shared_ptr<ProposalCreationStrategy> strategy_;
+      size_t min_size_;
+      size_t max_size_;
+      std::chrono::milliseconds target_round_time_;
+      std::function<ClockType::time_point()> time_provider_;
+
+      std::mutex mutex_;
+      size_t limit_;
+      /// smoothed round time per transaction in microseconds
+      boost::optional<double> time_per_transaction_;
+      /// current round and its start time
+      boost::optional<std::pair<RoundType, ClockType::time_point>>
+          current_round_;
+      /// number of transactions in the packed proposals
+      std::map<RoundType, size_t> packed_;
+    };
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_ADAPTIVE_PROPOSAL_SIZE_STRATEGY_HPP
@@ -0,0 +1,103 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/batch_send_queue.hpp"
+
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
+
+using namespace iroha::ordering;
+
+namespace {
+  size_t batchBytes(const shared_model::interface::TransactionBatch &batch) {
+    size_t bytes = 0;
+    for (const auto &tx : batch.transactions()) {
+      bytes += tx->blob().size();
+    }
+    return bytes;
+  }
+}  // namespace
+
+BatchSendQueue::BatchSendQueue(std::chrono::milliseconds flush_delay,
+                               size_t flush_bytes,
+                               std::shared_ptr<Histogram> time_in_queue,
+                               std::shared_ptr<Histogram> bytes_per_flush,
+                               std::function<void()> on_window_start)
+    : flush_delay_(flush_delay),
+      flush_bytes_(flush_bytes),
+      time_in_queue_(std::move(time_in_queue)),
+      bytes_per_flush_(std::move(bytes_per_flush)),
+      on_window_start_(std::move(on_window_start)) {}
+
+void BatchSendQueue::setConnection(
+    std::shared_ptr<transport::OdOsNotification> connection) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  connection_ = std::move(connection);
+}
+
+void BatchSendQueue::push(const CollectionType &batches) {
+  bool window_started = false, limit_reached = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    window_started = batches_.empty();
+    auto now = ClockType::now();
+    for (const auto &batch : batches) {
+      if (not index_.insert(batch).second) {
+        continue;
+      }
+      bytes_ += batchBytes(*batch);
+      batches_.push_back(batch);
+      enqueue_times_.push_back(now);
+    }
+    window_started = window_started and not batches_.empty();
+    limit_reached = bytes_ >= flush_bytes_;
+  }
+
+  if (limit_reached) {
+    flush();
+  } else if (window_started) {
+    on_window_start_();
+  }
+}
+
+boost::optional<BatchSendQueue::ClockType::time_point>
+BatchSendQueue::deadline() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (enqueue_times_.empty()) {
+    return boost::none;
+  }
+  return enqueue_times_.front() + flush_delay_;
+}
+
+void BatchSendQueue::flush() {
+  std::lock_guard<std::mutex> flush_lock(flush_mutex_);
+
+  CollectionType batches;
+  std::vector<ClockType::time_point> enqueue_times;
+  std::shared_ptr<transport::OdOsNotification> connection;
+  size_t bytes;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (batches_.empty()) {
+      return;
+    }
+    batches.swap(batches_);
+    enqueue_times.swap(enqueue_times_);
+    index_.clear();
+    bytes = bytes_;
+    bytes_ = 0;
+    connection = connection_;
+  }
+
+  auto now = ClockType::now();
+  for (const auto &time : enqueue_times) {
+    time_in_queue_->observe(
+        std::chrono::duration_cast<std::chrono::microseconds>(now - time)
+            .count());
+  }
+  bytes_per_flush_->observe(bytes);
+
+  connection->onBatches(std::move(batches));
+}
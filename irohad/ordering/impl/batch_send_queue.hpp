@@ -0,0 +1,93 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BATCH_SEND_QUEUE_HPP
+#define IROHA_BATCH_SEND_QUEUE_HPP
+
+#include "ordering/on_demand_os_transport.hpp"
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <unordered_set>
+
+#include "common/histogram.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Queue of batches to be sent to a single peer. Batches are coalesced
+     * into one request until the flush delay elapses since the first batch of
+     * the window, or the size of the queued transactions reaches the flush
+     * limit. Batch which is already in the queue is not queued again.
+     */
+    class BatchSendQueue {
+     public:
+      using ClockType = std::chrono::steady_clock;
+      using CollectionType = transport::OdOsNotification::CollectionType;
+
+      /**
+       * @param flush_delay - max time of the batch in the queue
+       * @param flush_bytes - size of transactions which triggers the flush.
+       * The flush is done on the thread of push, so producers which fill the
+       * queue faster than it is flushed are slowed down
+       * @param time_in_queue - histogram of time in the queue of the sent
+       * batches, in microseconds
+       * @param bytes_per_flush - histogram of size of the flushed requests
+       * @param on_window_start - called when a batch is pushed to the empty
+       * queue, used to schedule the flush
+       */
+      BatchSendQueue(std::chrono::milliseconds flush_delay,
+                     size_t flush_bytes,
+                     std::shared_ptr<Histogram> time_in_queue,
+                     std::shared_ptr<Histogram> bytes_per_flush,
+                     std::function<void()> on_window_start);
+
+      /**
+       * Set the connection used for the following flushes
+       */
+      void setConnection(
+          std::shared_ptr<transport::OdOsNotification> connection);
+
+      /**
+       * Enqueue batches, flushes the queue if the size limit is reached
+       */
+      void push(const CollectionType &batches);
+
+      /**
+       * @return time when the queue has to be flushed, none if it is empty
+       */
+      boost::optional<ClockType::time_point> deadline() const;
+
+      /**
+       * Send all queued batches with a single request
+       */
+      void flush();
+
+     private:
+      std::chrono::milliseconds flush_delay_;
+      size_t flush_bytes_;
+      std::shared_ptr<Histogram> time_in_queue_;
+      std::shared_ptr<Histogram> bytes_per_flush_;
+      std::function<void()> on_window_start_;
+
+      /// guards the queue state
+      mutable std::mutex mutex_;
+      /// keeps the order of the sent requests
+      std::mutex flush_mutex_;
+
+      std::shared_ptr<transport::OdOsNotification> connection_;
+      CollectionType batches_;
+      std::vector<ClockType::time_point> enqueue_times_;
+      std::unordered_set<transport::OdOsNotification::TransactionBatchType>
+          index_;
+      size_t bytes_ = 0;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_BATCH_SEND_QUEUE_HPP
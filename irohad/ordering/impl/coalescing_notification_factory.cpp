@@ -0,0 +1,150 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/coalescing_notification_factory.hpp"
+
+#include "interfaces/common_objects/peer.hpp"
+#include "interfaces/iroha_internal/proposal.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha;
+using namespace iroha::ordering;
+
+namespace {
+  /**
+   * Connection which sends batches with the send queue of the peer
+   */
+  class CoalescingConnection : public transport::OdOsNotification {
+   public:
+    CoalescingConnection(
+        std::shared_ptr<BatchSendQueue> queue,
+        std::shared_ptr<transport::OdOsNotification> connection)
+        : queue_(std::move(queue)), connection_(std::move(connection)) {}
+
+    void onBatches(CollectionType batches) override {
+      queue_->push(batches);
+    }
+
+    boost::optional<std::shared_ptr<const ProposalType>> onRequestProposal(
+        consensus::Round round) override {
+      return connection_->onRequestProposal(round);
+    }
+
+   private:
+    std::shared_ptr<BatchSendQueue> queue_;
+    std::shared_ptr<transport::OdOsNotification> connection_;
+  };
+
+  /// 1us .. ~1s
+  const size_t kTimeInQueueBuckets = 21;
+  /// 64B .. 64MB
+  const size_t kBytesPerFlushBuckets = 21;
+}  // namespace
+
+CoalescingNotificationFactory::CoalescingNotificationFactory(
+    std::shared_ptr<transport::OdOsNotificationFactory> factory,
+    std::chrono::milliseconds flush_delay,
+    size_t flush_bytes,
+    logger::LoggerPtr log)
+    : factory_(std::move(factory)),
+      flush_delay_(flush_delay),
+      flush_bytes_(flush_bytes),
+      log_(std::move(log)),
+      time_in_queue_(std::make_shared<Histogram>(
+          Histogram::exponentialBounds(1, 2, kTimeInQueueBuckets))),
+      bytes_per_flush_(std::make_shared<Histogram>(
+          Histogram::exponentialBounds(64, 2, kBytesPerFlushBuckets))),
+      thread_([this] { run(); }) {}
+
+CoalescingNotificationFactory::~CoalescingNotificationFactory() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+  }
+  cv_.notify_one();
+  thread_.join();
+
+  for (auto &queue : queues_) {
+    queue.second->flush();
+  }
+}
+
+std::unique_ptr<transport::OdOsNotification>
+CoalescingNotificationFactory::create(const shared_model::interface::Peer &to) {
+  std::shared_ptr<transport::OdOsNotification> connection =
+      factory_->create(to);
+
+  std::shared_ptr<BatchSendQueue> queue;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &peer_queue = queues_[to.address()];
+    if (not peer_queue) {
+      peer_queue = std::make_shared<BatchSendQueue>(
+          flush_delay_, flush_bytes_, time_in_queue_, bytes_per_flush_, [this] {
+            {
+              std::lock_guard<std::mutex> lock(mutex_);
+              window_started_ = true;
+            }
+            cv_.notify_one();
+          });
+    }
+    queue = peer_queue;
+  }
+  queue->setConnection(connection);
+
+  return std::make_unique<CoalescingConnection>(std::move(queue),
+                                                std::move(connection));
+}
+
+const Histogram &CoalescingNotificationFactory::timeInQueue() const {
+  return *time_in_queue_;
+}
+
+const Histogram &CoalescingNotificationFactory::bytesPerFlush() const {
+  return *bytes_per_flush_;
+}
+
+void CoalescingNotificationFactory::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (not stopped_) {
+    // reset before the scan, so the window started after the scan is not
+    // missed
+    window_started_ = false;
+
+    auto now = BatchSendQueue::ClockType::now();
+    boost::optional<BatchSendQueue::ClockType::time_point> next_deadline;
+    std::vector<std::shared_ptr<BatchSendQueue>> ready;
+    for (auto &queue : queues_) {
+      if (auto deadline = queue.second->deadline()) {
+        if (*deadline <= now) {
+          ready.push_back(queue.second);
+        } else if (not next_deadline or *deadline < *next_deadline) {
+          next_deadline = deadline;
+        }
+      }
+    }
+
+    if (not ready.empty()) {
+      lock.unlock();
+      for (auto &queue : ready) {
+        queue->flush();
+      }
+      log_->debug("Flushed {} send queues, {} bytes per flush on average",
+                  ready.size(),
+                  bytes_per_flush_->count() == 0
+                      ? 0
+                      : bytes_per_flush_->sum() / bytes_per_flush_->count());
+      lock.lock();
+      continue;
+    }
+
+    auto wake_up = [this] { return stopped_ or window_started_; };
+    if (next_deadline) {
+      cv_.wait_until(lock, *next_deadline, wake_up);
+    } else {
+      cv_.wait(lock, wake_up);
+    }
+  }
+}
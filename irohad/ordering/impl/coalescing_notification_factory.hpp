@@ -0,0 +1,86 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COALESCING_NOTIFICATION_FACTORY_HPP
+#define IROHA_COALESCING_NOTIFICATION_FACTORY_HPP
+
+#include "ordering/on_demand_os_transport.hpp"
+
+#include <condition_variable>
+#include <thread>
+#include <unordered_map>
+
+#include "logger/logger_fwd.hpp"
+#include "ordering/impl/batch_send_queue.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Factory decorator which coalesces batches sent to the same peer into a
+     * single request. Created connections push batches to the send queue of
+     * the peer, which outlives the connections, and request proposals with
+     * the connections of the underlying factory. Queues are flushed by a
+     * separate thread when the flush delay elapses.
+     */
+    class CoalescingNotificationFactory
+        : public transport::OdOsNotificationFactory {
+     public:
+      /**
+       * @param factory - factory of the connections used for sending
+       * @param flush_delay - max time of the batch in the queue
+       * @param flush_bytes - size of transactions which triggers the flush
+       * @param log - logger
+       */
+      CoalescingNotificationFactory(
+          std::shared_ptr<transport::OdOsNotificationFactory> factory,
+          std::chrono::milliseconds flush_delay,
+          size_t flush_bytes,
+          logger::LoggerPtr log);
+
+      /**
+       * Flushes all queues
+       */
+      ~CoalescingNotificationFactory() override;
+
+      std::unique_ptr<transport::OdOsNotification> create(
+          const shared_model::interface::Peer &to) override;
+
+      /// time in the queue of the sent batches, in microseconds
+      const Histogram &timeInQueue() const;
+
+      /// size of transactions in the flushed requests, in bytes
+      const Histogram &bytesPerFlush() const;
+
+     private:
+      /**
+       * Flush the queues with the elapsed delay until stopped
+       */
+      void run();
+
+      std::shared_ptr<transport::OdOsNotificationFactory> factory_;
+      std::chrono::milliseconds flush_delay_;
+      size_t flush_bytes_;
+      logger::LoggerPtr log_;
+
+      std::shared_ptr<Histogram> time_in_queue_;
+      std::shared_ptr<Histogram> bytes_per_flush_;
+
+      std::mutex mutex_;
+      std::condition_variable cv_;
+      bool stopped_ = false;
+      bool window_started_ = false;
+
+      /// send queues by peer address
+      std::unordered_map<std::string, std::shared_ptr<BatchSendQueue>>
+          queues_;
+
+      std::thread thread_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_COALESCING_NOTIFICATION_FACTORY_HPP
@@ -0,0 +1,177 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/fair_queuing.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+#include <boost/range/size.hpp>
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
+
+using namespace iroha::ordering;
+
+const std::string FairQueuing::kOtherGroup = "other";
+
+/// queue of a configured group or of a single account
+struct FairQueuing::Queue {
+  uint32_t weight = 1;
+  /// index in stats_
+  size_t stats_index = 0;
+  /// indices of the batches in arrival order
+  std::vector<size_t> batches;
+  /// index of the first batch which is not taken
+  size_t head = 0;
+  /// amount of transactions the queue may take
+  uint64_t deficit = 0;
+  bool active = true;
+};
+
+FairQueuing::FairQueuing(std::vector<Group> groups)
+    : groups_(std::move(groups)), stats_(groups_.size() + 1) {
+  for (const auto &group : groups_) {
+    for (const auto &member : group.members) {
+      members_.emplace(member, &group);
+    }
+  }
+}
+
+std::vector<size_t> FairQueuing::select(
+    const std::vector<TransactionBatchType> &batches,
+    size_t requested_tx_amount) {
+  auto size_of = [&batches](size_t index) {
+    return static_cast<uint64_t>(
+        boost::size(batches[index]->transactions()));
+  };
+
+  constexpr auto kNoQueue = std::numeric_limits<size_t>::max();
+  std::vector<Queue> queues;
+  std::vector<size_t> group_queues(groups_.size(), kNoQueue);
+  std::unordered_map<std::reference_wrapper<const std::string>,
+                     size_t,
+                     std::hash<std::string>,
+                     std::equal_to<std::string>>
+      account_queues;
+  for (size_t i = 0; i < batches.size(); ++i) {
+    const auto &creator =
+        batches[i]->transactions().front()->creatorAccountId();
+    size_t *queue_index;
+    Queue queue;
+    // the queues of the accounts without a group share the last stats
+    queue.stats_index = groups_.size();
+    if (auto group = groupOf(creator)) {
+      queue.weight = group->weight;
+      queue.stats_index = group - groups_.data();
+      queue_index = &group_queues[queue.stats_index];
+    } else {
+      queue_index =
+          &account_queues.emplace(creator, kNoQueue).first->second;
+    }
+    if (*queue_index == kNoQueue) {
+      *queue_index = queues.size();
+      queues.push_back(std::move(queue));
+    }
+    queues[*queue_index].batches.push_back(i);
+  }
+
+  std::vector<bool> selected(batches.size(), false);
+  uint64_t taken_txs_amount = 0;
+  auto active_queues = queues.size();
+  while (active_queues > 0) {
+    // skip the rounds in which no queue gains enough to take its head batch
+    auto rounds = std::numeric_limits<uint64_t>::max();
+    for (const auto &queue : queues) {
+      if (queue.active) {
+        auto size = size_of(queue.batches[queue.head]);
+        rounds = std::min<uint64_t>(
+            rounds,
+            size > queue.deficit
+                ? (size - queue.deficit + queue.weight - 1) / queue.weight
+                : 0);
+      }
+    }
+    for (auto &queue : queues) {
+      if (not queue.active) {
+        continue;
+      }
+      queue.deficit += rounds * queue.weight;
+      while (queue.head < queue.batches.size()) {
+        auto index = queue.batches[queue.head];
+        auto size = size_of(index);
+        if (size > queue.deficit) {
+          break;
+        }
+        // the batches of a queue are not reordered, so the queue stops on
+        // the first batch which does not fit into the proposal
+        if (taken_txs_amount + size > requested_tx_amount) {
+          queue.active = false;
+          break;
+        }
+        selected[index] = true;
+        taken_txs_amount += size;
+        queue.deficit -= size;
+        ++queue.head;
+      }
+      if (queue.head == queue.batches.size()) {
+        queue.active = false;
+      }
+      if (not queue.active) {
+        --active_queues;
+      }
+    }
+  }
+
+  std::vector<size_t> pending_txs(stats_.size(), 0);
+  std::vector<size_t> result;
+  for (const auto &queue : queues) {
+    for (auto index : queue.batches) {
+      if (selected[index]) {
+        stats_[queue.stats_index].packed_txs.increment(size_of(index));
+      } else {
+        pending_txs[queue.stats_index] += size_of(index);
+      }
+    }
+  }
+  for (size_t i = 0; i < stats_.size(); ++i) {
+    stats_[i].pending_txs = pending_txs[i];
+  }
+  for (size_t i = 0; i < selected.size(); ++i) {
+    if (selected[i]) {
+      result.push_back(i);
+    }
+  }
+  return result;
+}
+
+std::vector<FairQueuing::GroupStats> FairQueuing::stats() const {
+  std::vector<GroupStats> result;
+  for (size_t i = 0; i < stats_.size(); ++i) {
+    result.push_back({i < groups_.size() ? groups_[i].name : kOtherGroup,
+                      stats_[i].pending_txs.load(),
+                      stats_[i].packed_txs.value()});
+  }
+  return result;
+}
+
+const FairQueuing::Group *FairQueuing::groupOf(
+    const std::string &creator) const {
+  if (members_.empty()) {
+    return nullptr;
+  }
+  auto member = members_.find(creator);
+  if (member == members_.end()) {
+    auto at = creator.find('@');
+    if (at == std::string::npos) {
+      return nullptr;
+    }
+    member = members_.find(creator.substr(at + 1));
+    if (member == members_.end()) {
+      return nullptr;
+    }
+  }
+  return member->second;
+}
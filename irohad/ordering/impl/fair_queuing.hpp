@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_FAIR_QUEUING_HPP
+#define IROHA_FAIR_QUEUING_HPP
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/counter.hpp"
+#include "ordering/on_demand_os_transport.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Weighted fair queuing of the pending batches by their creator. The
+     * batches of the accounts of a configured group share the group queue,
+     * any other account has a queue of its own. The proposal takes the
+     * transactions of the queues in proportion to their weights (deficit
+     * round robin), so a creator with many batches does not delay the
+     * batches of the others for many rounds. The batches of a queue are
+     * taken in their arrival order.
+     */
+    class FairQueuing {
+     public:
+      using TransactionBatchType =
+          transport::OdOsNotification::TransactionBatchType;
+
+      /// name of the queues of the accounts out of the configured groups in
+      /// the statistics
+      static const std::string kOtherGroup;
+
+      struct Group {
+        std::string name;
+        /// share of the group relative to a single account queue
+        uint32_t weight;
+        /// account ids and domain ids, the latter include all the accounts
+        /// of the domain
+        std::vector<std::string> members;
+      };
+
+      /// statistics of a configured group or of the other accounts
+      struct GroupStats {
+        std::string name;
+        /// transactions waiting for a proposal after the last packing
+        size_t pending_txs;
+        /// transactions taken into the proposals
+        uint64_t packed_txs;
+      };
+
+      explicit FairQueuing(std::vector<Group> groups);
+
+      /**
+       * Select the batches for a proposal
+       * Note: method is not thread-safe, only the consumer may call it
+       * @param batches - pending batches in arrival order
+       * @param requested_tx_amount - max amount of the transactions
+       * @return indices of the selected batches in ascending order
+       */
+      std::vector<size_t> select(
+          const std::vector<TransactionBatchType> &batches,
+          size_t requested_tx_amount);
+
+      /**
+       * @return statistics of the configured groups and of the other
+       * accounts, may be called from any thread
+       */
+      std::vector<GroupStats> stats() const;
+
+     private:
+      struct Queue;
+
+      struct Stats {
+        std::atomic<size_t> pending_txs{0};
+        Counter packed_txs;
+      };
+
+      /// @return configured group of the creator, nullptr if there is none
+      const Group *groupOf(const std::string &creator) const;
+
+      std::vector<Group> groups_;
+
+      /// configured group of the account ids and of the domain ids
+      std::unordered_map<std::string, const Group *> members_;
+
+      /// statistics of the configured groups followed by the other accounts
+      std::vector<Stats> stats_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_FAIR_QUEUING_HPP
@@ -5,36 +5,113 @@
 
 #include "ordering/impl/kick_out_proposal_creation_strategy.hpp"
 
+#include <algorithm>
 #include <utility>
 
 using namespace iroha::ordering;
 
+namespace {
+  constexpr uint64_t kRejectBits = 16;
+  constexpr uint64_t kMaxRejectRound = (uint64_t{1} << kRejectBits) - 1;
+
+  /// @return the round packed into a single word, the reject rounds above
+  /// 2^16 - 1 are saturated, so the requests for them are not counted
+  uint64_t packRound(const iroha::consensus::Round &round) {
+    return (round.block_round << kRejectBits)
+        | std::min<uint64_t>(round.reject_round, kMaxRejectRound);
+  }
+}  // namespace
+
+constexpr size_t KickOutProposalCreationStrategy::kBlockRounds;
+constexpr size_t KickOutProposalCreationStrategy::kRejectRounds;
+
 KickOutProposalCreationStrategy::KickOutProposalCreationStrategy(
     std::shared_ptr<SupermajorityCheckerType> tolerance_checker)
     : tolerance_checker_(std::move(tolerance_checker)) {}
 
 void KickOutProposalCreationStrategy::onCollaborationOutcome(
     RoundType round, size_t peers_in_round) {
-  std::lock_guard<std::mutex> guard(mutex_);
-  peers_in_round_ = peers_in_round;
-  while (not requested_count_.empty()
-         and requested_count_.begin()->first <= round) {
-    requested_count_.erase(requested_count_.begin());
+  peers_in_round_.store(peers_in_round, std::memory_order_relaxed);
+  if (not(last_outcome_ < round)) {
+    return;
+  }
+  // publish the window first, so the requests for the passed rounds stop
+  // touching the counters which are reset below
+  outcome_.store(packRound(round), std::memory_order_release);
+
+  // the counters of the passed rounds become the ones of the rounds which
+  // enter the window
+  if (round.block_round == last_outcome_.block_round) {
+    auto last = std::min<uint64_t>(
+        round.reject_round,
+        uint64_t{last_outcome_.reject_round} + kRejectRounds);
+    for (uint64_t reject = last_outcome_.reject_round + 1; reject <= last;
+         ++reject) {
+      reset(round.block_round, reject);
+    }
+  } else {
+    auto first_block =
+        std::max(last_outcome_.block_round,
+                 round.block_round - std::min<uint64_t>(round.block_round,
+                                                        kBlockRounds));
+    for (auto block = first_block; block < round.block_round; ++block) {
+      for (consensus::RejectRoundType reject = 0; reject < kRejectRounds;
+           ++reject) {
+        reset(block, reject);
+      }
+    }
+    auto last = std::min<uint64_t>(round.reject_round, kRejectRounds - 1);
+    for (uint64_t reject = 0; reject <= last; ++reject) {
+      reset(round.block_round, reject);
+    }
   }
+  last_outcome_ = round;
 }
 
 bool KickOutProposalCreationStrategy::shouldCreateRound(RoundType round) {
-  std::lock_guard<std::mutex> guard(mutex_);
-  return not tolerance_checker_->isTolerated(requested_count_[round],
-                                             peers_in_round_);
+  auto counter = counterOf(round);
+  auto requested =
+      counter ? counter->load(std::memory_order_relaxed) : size_t{0};
+  return not tolerance_checker_->isTolerated(
+      requested, peers_in_round_.load(std::memory_order_relaxed));
 }
 
 boost::optional<ProposalCreationStrategy::RoundType>
 KickOutProposalCreationStrategy::onProposalRequest(RoundType requested_round) {
-  {
-    std::lock_guard<std::mutex> guard(mutex_);
-    requested_count_[requested_round]++;
+  if (auto counter = counterOf(requested_round)) {
+    counter->fetch_add(1, std::memory_order_relaxed);
   }
 
   return boost::none;
 }
+
+std::atomic<size_t> *KickOutProposalCreationStrategy::counterOf(
+    const RoundType &round) {
+  auto outcome = outcome_.load(std::memory_order_acquire);
+  RoundType current{outcome >> kRejectBits,
+                    static_cast<consensus::RejectRoundType>(
+                        outcome & kMaxRejectRound)};
+  if (round.reject_round >= kMaxRejectRound or not(current < round)) {
+    return nullptr;
+  }
+  if (round.block_round == current.block_round) {
+    // the reject rounds after the outcome one, the counter of the outcome
+    // round itself is reused by the last of them
+    if (round.reject_round - current.reject_round > kRejectRounds) {
+      return nullptr;
+    }
+  } else if (round.block_round - current.block_round >= kBlockRounds
+             or round.reject_round >= kRejectRounds) {
+    return nullptr;
+  }
+  return &requested_count_[(round.block_round % kBlockRounds) * kRejectRounds
+                           + round.reject_round % kRejectRounds];
+}
+
+void KickOutProposalCreationStrategy::reset(
+    consensus::BlockRoundType block_round,
+    consensus::RejectRoundType reject_round) {
+  requested_count_[(block_round % kBlockRounds) * kRejectRounds
+                   + reject_round % kRejectRounds]
+      .store(0, std::memory_order_relaxed);
+}
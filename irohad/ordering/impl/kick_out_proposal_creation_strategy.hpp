@@ -8,9 +8,9 @@
 
 #include "ordering/ordering_service_proposal_creation_strategy.hpp"
 
-#include <map>
+#include <array>
+#include <atomic>
 #include <memory>
-#include <mutex>
 
 #include "consensus/yac/supermajority_checker.hpp"
 
@@ -18,12 +18,25 @@ namespace iroha {
   namespace ordering {
 
     /**
-     * Creation strategy based on supermajority checker tolerance condition
+     * Creation strategy based on supermajority checker tolerance condition.
+     *
+     * The requests are counted in a fixed array of atomic counters indexed
+     * by the block and reject rounds following the last outcome, so
+     * onProposalRequest is wait-free. The requests for the rounds out of
+     * the window are not counted. onCollaborationOutcome must not be called
+     * concurrently with itself
      */
     class KickOutProposalCreationStrategy : public ProposalCreationStrategy {
      public:
       using SupermajorityCheckerType =
           iroha::consensus::yac::SupermajorityChecker;
+
+      /// number of the block rounds counted, starting from the outcome one
+      static constexpr size_t kBlockRounds = 4;
+
+      /// number of the reject rounds counted in each block round
+      static constexpr size_t kRejectRounds = 16;
+
       KickOutProposalCreationStrategy(
           std::shared_ptr<SupermajorityCheckerType> tolerance_checker);
 
@@ -36,12 +49,23 @@ namespace iroha {
           RoundType requested_round) override;
 
      private:
-      using RoundCollectionType = std::map<RoundType, size_t>;
+      /// @return counter of the round, nullptr if it is out of the window
+      std::atomic<size_t> *counterOf(const RoundType &round);
+
+      /// reset the counter of the round
+      void reset(consensus::BlockRoundType block_round,
+                 consensus::RejectRoundType reject_round);
 
-      std::mutex mutex_;
       std::shared_ptr<SupermajorityCheckerType> tolerance_checker_;
-      size_t peers_in_round_;
-      RoundCollectionType requested_count_;
+      std::atomic<size_t> peers_in_round_{0};
+
+      /// last outcome round packed by packRound, read by the requests
+      std::atomic<uint64_t> outcome_{0};
+      /// last outcome round, accessed by onCollaborationOutcome only
+      RoundType last_outcome_{0, 0};
+
+      std::array<std::atomic<size_t>, kBlockRounds * kRejectRounds>
+          requested_count_{};
     };
   }  // namespace ordering
 }  // namespace iroha
@@ -70,6 +70,16 @@ OnDemandConnectionManager::onRequestProposal(consensus::Round round) {
   return connections_.peers[kIssuer]->onRequestProposal(round);
 }
 
+boost::optional<std::shared_ptr<const OnDemandConnectionManager::ProposalType>>
+OnDemandConnectionManager::onRequestNextCommitProposal(
+    consensus::Round round) {
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+  log_->debug("onRequestNextCommitProposal, {}", round);
+
+  return connections_.peers[kRejectCommitConsumer]->onRequestProposal(round);
+}
+
 void OnDemandConnectionManager::initializeConnections(
     const CurrentPeers &peers) {
   auto create_assign = [this](auto &ptr, auto &peer) {
@@ -68,6 +68,15 @@ namespace iroha {
       boost::optional<std::shared_ptr<const ProposalType>> onRequestProposal(
           consensus::Round round) override;
 
+      /**
+       * Request the proposal of the round following the commit of the current
+       * round. Its issuer is the consumer of the batches of that round, so
+       * the request can be sent before the connections are switched
+       * @param round - next commit round
+       */
+      boost::optional<std::shared_ptr<const ProposalType>>
+      onRequestNextCommitProposal(consensus::Round round);
+
      private:
       /**
        * Corresponding connections created by OdOsNotificationFactory
@@ -5,6 +5,8 @@
 
 #include "ordering/impl/on_demand_ordering_gate.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <iterator>
 
 #include <boost/range/adaptor/filtered.hpp>
@@ -14,13 +16,20 @@
 #include "ametsuchi/tx_presence_cache.hpp"
 #include "common/visitor.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
-#include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
 #include "logger/logger.hpp"
+#include "maintenance/tracing.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 
 using namespace iroha;
 using namespace iroha::ordering;
 
+namespace {
+  /// number of buckets of the proposal latency from 1 ms to about 1 min
+  constexpr size_t kProposalLatencyBuckets = 17;
+  /// number of buckets of the filter time from 1 us to about 1 s
+  constexpr size_t kFilterTimeBuckets = 21;
+}  // namespace
+
 OnDemandOrderingGate::OnDemandOrderingGate(
     std::shared_ptr<OnDemandOrderingService> ordering_service,
     std::shared_ptr<transport::OdOsNotification> network_client,
@@ -33,9 +42,16 @@ OnDemandOrderingGate::OnDemandOrderingGate(
     std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
     std::shared_ptr<ProposalCreationStrategy> proposal_creation_strategy,
     size_t transaction_limit,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    std::shared_ptr<ProcessedTxFilter> tx_filter,
+    rxcpp::observable<PrefetchEvent> prefetch_events,
+    ProposalFetcher fetch_next_proposal)
     : log_(std::move(log)),
       transaction_limit_(transaction_limit),
+      proposal_latency_(
+          Histogram::exponentialBounds(1, 2, kProposalLatencyBuckets)),
+      proposal_filter_time_(
+          Histogram::exponentialBounds(1, 2, kFilterTimeBuckets)),
       ordering_service_(std::move(ordering_service)),
       network_client_(std::move(network_client)),
       processed_tx_hashes_subscription_(
@@ -44,12 +60,20 @@ OnDemandOrderingGate::OnDemandOrderingGate(
             log_->debug("Asking to remove {} transactions from cache.",
                         hashes->size());
             cache_->remove(*hashes);
+            if (tx_filter_) {
+              for (const auto &hash : *hashes) {
+                tx_filter_->insert(hash);
+              }
+            }
+            std::lock_guard<std::mutex> lock(prefetch_mutex_);
+            last_committed_hashes_ = hashes;
           })),
       round_switch_subscription_(round_switch_events.subscribe(
           [this,
            proposal_creation_strategy =
                std::move(proposal_creation_strategy)](auto event) {
             log_->debug("Current: {}", event.next_round);
+            const auto round_start = std::chrono::steady_clock::now();
 
             // notify our ordering service about new round
             proposal_creation_strategy->onCollaborationOutcome(
@@ -58,9 +82,16 @@ OnDemandOrderingGate::OnDemandOrderingGate(
 
             this->sendCachedTransactions();
 
-            // request proposal for the current round
-            auto proposal = this->processProposalRequest(
-                network_client_->onRequestProposal(event.next_round));
+            // request proposal for the current round, unless it is prefetched
+            auto proposal = this->takePrefetchedProposal(event);
+            if (not proposal) {
+              proposal = this->processProposalRequest(
+                  network_client_->onRequestProposal(event.next_round));
+            }
+            proposal_latency_.observe(
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - round_start)
+                    .count());
             // vote for the object received from the network
             proposal_notifier_.get_subscriber().on_next(
                 network::OrderingEvent{std::move(proposal),
@@ -70,9 +101,19 @@ OnDemandOrderingGate::OnDemandOrderingGate(
       cache_(std::move(cache)),
       proposal_factory_(std::move(factory)),
       tx_cache_(std::move(tx_cache)),
-      proposal_notifier_(proposal_notifier_lifetime_) {}
+      tx_filter_(std::move(tx_filter)),
+      fetch_next_proposal_(std::move(fetch_next_proposal)),
+      proposal_notifier_(proposal_notifier_lifetime_),
+      prefetched_notifier_(prefetched_notifier_lifetime_) {
+  if (fetch_next_proposal_) {
+    prefetch_subscription_ = prefetch_events.subscribe(
+        [this](const auto &event) { this->prefetchProposal(event); });
+  }
+}
 
 OnDemandOrderingGate::~OnDemandOrderingGate() {
+  prefetch_subscription_.unsubscribe();
+  prefetched_notifier_lifetime_.unsubscribe();
   proposal_notifier_lifetime_.unsubscribe();
   processed_tx_hashes_subscription_.unsubscribe();
   round_switch_subscription_.unsubscribe();
@@ -80,6 +121,13 @@ OnDemandOrderingGate::~OnDemandOrderingGate() {
 
 void OnDemandOrderingGate::propagateBatch(
     std::shared_ptr<shared_model::interface::TransactionBatch> batch) {
+  iroha::tracing::ScopedSpan span("ordering.propagate_batch");
+  if (span) {
+    for (const auto &tx : batch->transactions()) {
+      span.addTransaction(tx->hash());
+    }
+  }
+
   cache_->addToBack({batch});
 
   network_client_->onBatches(
@@ -90,16 +138,34 @@ rxcpp::observable<network::OrderingEvent> OnDemandOrderingGate::onProposal() {
   return proposal_notifier_.get_observable();
 }
 
+rxcpp::observable<OnDemandOrderingGate::PrefetchedProposal>
+OnDemandOrderingGate::onPrefetchedProposal() {
+  return prefetched_notifier_.get_observable();
+}
+
+const Histogram &OnDemandOrderingGate::proposalLatency() const {
+  return proposal_latency_;
+}
+
+const Histogram &OnDemandOrderingGate::proposalFilterTime() const {
+  return proposal_filter_time_;
+}
+
 boost::optional<std::shared_ptr<const shared_model::interface::Proposal>>
 OnDemandOrderingGate::processProposalRequest(
     boost::optional<
-        std::shared_ptr<const OnDemandOrderingService::ProposalType>> proposal)
-    const {
+        std::shared_ptr<const OnDemandOrderingService::ProposalType>>
+        proposal) {
   if (not proposal) {
     return boost::none;
   }
+  const auto start = std::chrono::steady_clock::now();
   auto proposal_without_replays =
       removeReplaysAndDuplicates(*std::move(proposal));
+  proposal_filter_time_.observe(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - start)
+          .count());
   // no need to check empty proposal
   if (boost::empty(proposal_without_replays->transactions())) {
     return boost::none;
@@ -107,6 +173,68 @@ OnDemandOrderingGate::processProposalRequest(
   return proposal_without_replays;
 }
 
+void OnDemandOrderingGate::prefetchProposal(const PrefetchEvent &event) {
+  log_->debug("Prefetching proposal for {}", event.next_round);
+  // transactions committed before the current block are filtered here, the
+  // ones of the current block are checked on the round switch
+  auto proposal =
+      processProposalRequest(fetch_next_proposal_(event.next_round));
+  if (not proposal) {
+    return;
+  }
+
+  PrefetchedProposal prefetched{event, *std::move(proposal)};
+  {
+    std::lock_guard<std::mutex> lock(prefetch_mutex_);
+    prefetched_ = prefetched;
+  }
+  prefetched_notifier_.get_subscriber().on_next(std::move(prefetched));
+}
+
+boost::optional<std::shared_ptr<const shared_model::interface::Proposal>>
+OnDemandOrderingGate::takePrefetchedProposal(const RoundSwitch &event) {
+  std::unique_lock<std::mutex> lock(prefetch_mutex_);
+  if (not prefetched_) {
+    return boost::none;
+  }
+  auto prefetched = *std::move(prefetched_);
+  prefetched_ = boost::none;
+  auto committed_hashes = last_committed_hashes_;
+  lock.unlock();
+
+  const auto &assumed_state = *prefetched.assumption.ledger_state;
+  auto same_peers = [](const auto &lhs, const auto &rhs) {
+    return std::equal(
+        lhs.begin(),
+        lhs.end(),
+        rhs.begin(),
+        rhs.end(),
+        [](const auto &lhs, const auto &rhs) { return *lhs == *rhs; });
+  };
+  if (prefetched.assumption.next_round != event.next_round
+      or prefetched.assumption.top_hash
+          != event.ledger_state->top_block_info.top_hash
+      or not same_peers(assumed_state.ledger_peers,
+                        event.ledger_state->ledger_peers)) {
+    log_->debug("Dropping proposal prefetched for {}",
+                prefetched.assumption.next_round);
+    return boost::none;
+  }
+
+  // the proposal may contain transactions of the block committed meanwhile
+  auto committed = [&committed_hashes](const auto &tx) {
+    return committed_hashes and committed_hashes->count(tx.hash()) != 0;
+  };
+  const auto &txs = prefetched.proposal->transactions();
+  if (std::any_of(txs.begin(), txs.end(), committed)) {
+    log_->debug("Revalidating proposal prefetched for {}", event.next_round);
+    return processProposalRequest(std::move(prefetched.proposal));
+  }
+
+  log_->debug("Using proposal prefetched for {}", event.next_round);
+  return std::move(prefetched.proposal);
+}
+
 void OnDemandOrderingGate::sendCachedTransactions() {
   // TODO mboldyrev 22.03.2019 IR-425
   // make cache_->getBatchesForRound(current_round) that respects sync
@@ -135,23 +263,47 @@ std::shared_ptr<const shared_model::interface::Proposal>
 OnDemandOrderingGate::removeReplaysAndDuplicates(
     std::shared_ptr<const shared_model::interface::Proposal> proposal) const {
   std::vector<bool> proposal_txs_validation_results;
-  auto tx_is_not_processed = [this](const auto &tx) {
-    auto tx_result = tx_cache_->check(tx.hash());
-    if (not tx_result) {
-      // TODO andrei 30.11.18 IR-51 Handle database error
-      return false;
+  // the transactions not covered by the filter are checked in the storage
+  // with a single query
+  std::vector<bool> txs_not_processed;
+  std::vector<size_t> checked_txs;
+  std::vector<ProcessedTxFilter::Lookup> checked_lookups;
+  std::vector<shared_model::crypto::Hash> checked_hashes;
+  for (const auto &tx : proposal->transactions()) {
+    auto lookup = tx_filter_
+        ? tx_filter_->lookup(tx.hash(), tx.createdTime())
+        : ProcessedTxFilter::Lookup::kNotCovered;
+    if (lookup != ProcessedTxFilter::Lookup::kNotProcessed) {
+      checked_txs.push_back(txs_not_processed.size());
+      checked_lookups.push_back(lookup);
+      checked_hashes.push_back(tx.hash());
     }
-    return iroha::visit_in_place(
-        *tx_result,
-        [](const ametsuchi::tx_cache_status_responses::Missing &) {
-          return true;
-        },
-        [](const auto &status) {
-          // TODO nickaleks 21.11.18: IR-1887 log replayed transactions
-          // when log is added
-          return false;
-        });
-  };
+    txs_not_processed.push_back(true);
+  }
+  if (not checked_hashes.empty()) {
+    auto tx_results = tx_cache_->check(checked_hashes);
+    for (size_t i = 0; i < checked_txs.size(); ++i) {
+      if (not tx_results) {
+        // TODO andrei 30.11.18 IR-51 Handle database error
+        txs_not_processed[checked_txs[i]] = false;
+        continue;
+      }
+      auto not_processed = iroha::visit_in_place(
+          (*tx_results)[i],
+          [](const ametsuchi::tx_cache_status_responses::Missing &) {
+            return true;
+          },
+          [](const auto &status) {
+            // TODO nickaleks 21.11.18: IR-1887 log replayed transactions
+            // when log is added
+            return false;
+          });
+      if (checked_lookups[i] == ProcessedTxFilter::Lookup::kMaybeProcessed) {
+        tx_filter_->onExactCheck(not not_processed);
+      }
+      txs_not_processed[checked_txs[i]] = not_processed;
+    }
+  }
 
   std::unordered_set<std::string> hashes;
   auto tx_is_unique = [&hashes](const auto &tx) {
@@ -165,20 +317,26 @@ OnDemandOrderingGate::removeReplaysAndDuplicates(
     }
   };
 
-  shared_model::interface::TransactionBatchParserImpl batch_parser;
-
   bool has_invalid_txs = false;
-  auto batches = batch_parser.parseBatches(proposal->transactions());
-  for (auto &batch : batches) {
-    bool txs_are_valid =
-        std::all_of(batch.begin(), batch.end(), [&](const auto &tx) {
-          return tx_is_not_processed(tx) and tx_is_unique(tx);
-        });
+  auto transactions = proposal->transactions();
+  for (const auto &batch : proposal->batchBoundaries()) {
+    bool txs_are_valid = true;
+    for (auto i = batch.begin; i < batch.end; ++i) {
+      txs_are_valid = txs_are_valid and txs_not_processed[i]
+          and tx_is_unique(transactions[i]);
+    }
     proposal_txs_validation_results.insert(
-        proposal_txs_validation_results.end(), batch.size(), txs_are_valid);
+        proposal_txs_validation_results.end(),
+        batch.end - batch.begin,
+        txs_are_valid);
     has_invalid_txs |= not txs_are_valid;
   }
 
+  if (tx_filter_) {
+    log_->debug("Processed transactions filter false positive rate: {}",
+                tx_filter_->falsePositiveRate());
+  }
+
   if (not has_invalid_txs) {
     return std::move(proposal);
   }
@@ -8,15 +8,19 @@
 
 #include "network/ordering_gate.hpp"
 
+#include <functional>
+#include <mutex>
 #include <shared_mutex>
 
 #include <boost/variant.hpp>
 #include <rxcpp/rx-lite.hpp>
+#include "common/histogram.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
 #include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger_fwd.hpp"
 #include "ordering/impl/ordering_gate_cache/ordering_gate_cache.hpp"
+#include "ordering/impl/processed_tx_filter.hpp"
 #include "ordering/on_demand_ordering_service.hpp"
 #include "ordering/ordering_service_proposal_creation_strategy.hpp"
 
@@ -43,6 +47,30 @@ namespace iroha {
               ledger_state(std::move(ledger_state)) {}
       };
 
+      /**
+       * Commit reached by the consensus before the block is applied, which
+       * allows to request the proposal of the next round in advance
+       */
+      struct PrefetchEvent {
+        /// commit round following the consensus round
+        consensus::Round next_round;
+        /// hash of the block which is being committed
+        shared_model::interface::types::HashType top_hash;
+        /// ledger state before the commit
+        std::shared_ptr<const LedgerState> ledger_state;
+      };
+
+      /// proposal filtered against the ledger state before the commit
+      struct PrefetchedProposal {
+        PrefetchEvent assumption;
+        std::shared_ptr<const shared_model::interface::Proposal> proposal;
+      };
+
+      /// requests the proposal of the next commit round from its issuer
+      using ProposalFetcher = std::function<boost::optional<
+          std::shared_ptr<const OnDemandOrderingService::ProposalType>>(
+          consensus::Round)>;
+
       OnDemandOrderingGate(
           std::shared_ptr<OnDemandOrderingService> ordering_service,
           std::shared_ptr<transport::OdOsNotification> network_client,
@@ -58,7 +86,11 @@ namespace iroha {
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           std::shared_ptr<ProposalCreationStrategy> proposal_creation_strategy,
           size_t transaction_limit,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::shared_ptr<ProcessedTxFilter> tx_filter = nullptr,
+          rxcpp::observable<PrefetchEvent> prefetch_events =
+              rxcpp::observable<>::never<PrefetchEvent>(),
+          ProposalFetcher fetch_next_proposal = nullptr);
 
       ~OnDemandOrderingGate() override;
 
@@ -68,6 +100,19 @@ namespace iroha {
 
       rxcpp::observable<network::OrderingEvent> onProposal() override;
 
+      /**
+       * Proposals of the next commit rounds prefetched while the current
+       * block is being committed. The proposal is emitted by onProposal
+       * only if the commit matches the assumption
+       */
+      rxcpp::observable<PrefetchedProposal> onPrefetchedProposal();
+
+      /// time in ms from the round switch to the proposal of the round
+      const Histogram &proposalLatency() const;
+
+      /// time in us of filtering the proposal against the ledger
+      const Histogram &proposalFilterTime() const;
+
      private:
       /**
        * Handle an incoming proposal from ordering service
@@ -76,10 +121,24 @@ namespace iroha {
       processProposalRequest(
           boost::optional<
               std::shared_ptr<const OnDemandOrderingService::ProposalType>>
-              proposal) const;
+              proposal);
 
       void sendCachedTransactions();
 
+      /**
+       * Request and filter the proposal of the next commit round while the
+       * current block is being committed
+       */
+      void prefetchProposal(const PrefetchEvent &event);
+
+      /**
+       * Take the prefetched proposal for the round switch
+       * @return the proposal, or none if there is no prefetched proposal for
+       * the round or the ledger state differs from the assumed one
+       */
+      boost::optional<std::shared_ptr<const shared_model::interface::Proposal>>
+      takePrefetchedProposal(const RoundSwitch &event);
+
       /**
        * remove already processed transactions from proposal
        */
@@ -92,6 +151,11 @@ namespace iroha {
 
       /// max number of transactions passed to one ordering service
       size_t transaction_limit_;
+
+      // metrics are constructed before the subscriptions which feed them
+      Histogram proposal_latency_;
+      Histogram proposal_filter_time_;
+
       std::shared_ptr<OnDemandOrderingService> ordering_service_;
       std::shared_ptr<transport::OdOsNotification> network_client_;
       rxcpp::composite_subscription processed_tx_hashes_subscription_;
@@ -100,9 +164,21 @@ namespace iroha {
       std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
           proposal_factory_;
       std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache_;
+      /// in-memory pre-filter of the tx_cache_ checks, optional
+      std::shared_ptr<ProcessedTxFilter> tx_filter_;
+
+      ProposalFetcher fetch_next_proposal_;
+      std::mutex prefetch_mutex_;
+      boost::optional<PrefetchedProposal> prefetched_;
+      /// transactions of the latest committed block
+      std::shared_ptr<const cache::OrderingGateCache::HashesSetType>
+          last_committed_hashes_;
+      rxcpp::composite_subscription prefetch_subscription_;
 
       rxcpp::composite_subscription proposal_notifier_lifetime_;
       rxcpp::subjects::subject<network::OrderingEvent> proposal_notifier_;
+      rxcpp::composite_subscription prefetched_notifier_lifetime_;
+      rxcpp::subjects::subject<PrefetchedProposal> prefetched_notifier_;
     };
 
   }  // namespace ordering
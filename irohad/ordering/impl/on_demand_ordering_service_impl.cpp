@@ -15,12 +15,14 @@
 #include <boost/range/size.hpp>
 #include "ametsuchi/tx_presence_cache.hpp"
 #include "ametsuchi/tx_presence_cache_utils.hpp"
+#include "common/allocation_tracking.hpp"
 #include "common/visitor.hpp"
 #include "datetime/time.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
+#include "maintenance/tracing.hpp"
 
 using namespace iroha;
 using namespace iroha::ordering;
@@ -33,9 +35,14 @@ OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
     std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
     std::shared_ptr<ProposalCreationStrategy> proposal_creation_strategy,
     logger::LoggerPtr log,
-    size_t number_of_proposals)
+    size_t number_of_proposals,
+    size_t max_carried_over_txs,
+    std::shared_ptr<FairQueuing> fair_queuing)
     : transaction_limit_(transaction_limit),
       number_of_proposals_(number_of_proposals),
+      max_carried_over_txs_(max_carried_over_txs),
+      proposals_(number_of_proposals + kLiveRounds),
+      pending_batches_(std::move(fair_queuing)),
       proposal_factory_(std::move(proposal_factory)),
       tx_cache_(std::move(tx_cache)),
       proposal_creation_strategy_(std::move(proposal_creation_strategy)),
@@ -45,6 +52,7 @@ OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
 
 void OnDemandOrderingServiceImpl::onCollaborationOutcome(
     consensus::Round round) {
+  ScopedAllocationTag allocation_tag(AllocationTag::kOrdering);
   log_->info("onCollaborationOutcome => {}", round);
 
   packNextProposals(round);
@@ -54,38 +62,26 @@ void OnDemandOrderingServiceImpl::onCollaborationOutcome(
 // ----------------------------| OdOsNotification |-----------------------------
 
 void OnDemandOrderingServiceImpl::onBatches(CollectionType batches) {
+  ScopedAllocationTag allocation_tag(AllocationTag::kOrdering);
   auto unprocessed_batches =
       boost::adaptors::filter(batches, [this](const auto &batch) {
         log_->debug("check batch {} for already processed transactions",
-                    batch->reducedHash().hex());
+                    logger::lazy([&] { return batch->reducedHash().hex(); }));
         return not this->batchAlreadyProcessed(*batch);
       });
   std::for_each(
       unprocessed_batches.begin(),
       unprocessed_batches.end(),
-      [this](auto &obj) {
-        std::shared_lock<std::shared_timed_mutex> lock(batches_mutex_);
-        pending_batches_.insert(std::move(obj));
-      });
+      [this](auto &obj) { pending_batches_.push(std::move(obj)); });
   log_->info("onBatches => collection size = {}", batches.size());
 }
 
 boost::optional<
     std::shared_ptr<const OnDemandOrderingServiceImpl::ProposalType>>
 OnDemandOrderingServiceImpl::onRequestProposal(consensus::Round round) {
-  boost::optional<
-      std::shared_ptr<const OnDemandOrderingServiceImpl::ProposalType>>
-      result;
-  {
-    // tryCreateProposal will not be able to aquire the lock and access the map
-    std::shared_lock<std::shared_timed_mutex> lock(proposals_mutex_);
-    proposal_creation_strategy_->onProposalRequest(round);
-    // TODO 2019-08-01 lebdron: IR-487 good case optimization
-    auto it = proposal_map_.find(round);
-    if (it != proposal_map_.end()) {
-      result = it->second;
-    }
-  }
+  ScopedAllocationTag allocation_tag(AllocationTag::kOrdering);
+  proposal_creation_strategy_->onProposalRequest(round);
+  auto result = proposals_.get(round);
   // space between '{}' and 'returning' is not missing, since either nothing, or
   // NOT with space is printed
   log_->debug("onRequestProposal, {}, {}returning a proposal.",
@@ -94,114 +90,105 @@ OnDemandOrderingServiceImpl::onRequestProposal(consensus::Round round) {
   return result;
 }
 
-// ---------------------------------| Private |---------------------------------
+size_t OnDemandOrderingServiceImpl::carriedOverTxsAmount() const {
+  return carried_over_txs_amount_;
+}
 
-/**
- * Get transactions from the given batches queue. Does not break batches -
- * continues getting all the transactions from the ongoing batch until the
- * required amount is collected.
- * @param requested_tx_amount - amount of transactions to get
- * @param batch_collection - the collection to get transactions from
- * @param discarded_txs_amount - the amount of discarded txs
- * @return transactions
- */
-static std::vector<std::shared_ptr<shared_model::interface::Transaction>>
-getTransactions(size_t requested_tx_amount,
-                detail::BatchSetType &batch_collection,
-                boost::optional<size_t &> discarded_txs_amount) {
-  std::vector<std::shared_ptr<shared_model::interface::Transaction>> collection;
-
-  auto it = batch_collection.begin();
-  for (; it != batch_collection.end()
-       and collection.size() + boost::size((*it)->transactions())
-           <= requested_tx_amount;
-       ++it) {
-    collection.insert(std::end(collection),
-                      std::begin((*it)->transactions()),
-                      std::end((*it)->transactions()));
-  }
+size_t OnDemandOrderingServiceImpl::pendingTxsAmount() const {
+  return pending_batches_.pendingTxsAmount();
+}
 
-  if (discarded_txs_amount) {
-    *discarded_txs_amount = 0;
-    for (; it != batch_collection.end(); ++it) {
-      *discarded_txs_amount += boost::size((*it)->transactions());
-    }
-  }
+rxcpp::observable<transport::ProposalEvent>
+OnDemandOrderingServiceImpl::onProposalCreated() {
+  return proposal_created_subject_.get_observable();
+}
 
-  return collection;
+void OnDemandOrderingServiceImpl::setTransactionLimit(
+    size_t transaction_limit) {
+  transaction_limit_ = transaction_limit;
 }
 
+// ---------------------------------| Private |---------------------------------
+
 void OnDemandOrderingServiceImpl::packNextProposals(
     const consensus::Round &round) {
   if (not pending_batches_.empty()) {
+    consensus::Round next_reject_round{round.block_round,
+                                       round.reject_round + 1};
+    consensus::Round next_commit_round{round.block_round + 1,
+                                       kFirstRejectRound};
     size_t discarded_txs_quantity;
-    auto txs = getTransactions(
-        transaction_limit_, pending_batches_, discarded_txs_quantity);
+    auto txs = pending_batches_.getTransactions(
+        proposal_creation_strategy_->proposalSizeLimit(next_commit_round,
+                                                       transaction_limit_),
+        discarded_txs_quantity);
     log_->debug("Discarded {} transactions", discarded_txs_quantity);
     auto now = iroha::time::now();
-    // create proposals for the next commit and reject rounds
-    tryCreateProposal({round.block_round, round.reject_round + 1}, txs, now);
-    tryCreateProposal({round.block_round + 1, kFirstRejectRound}, txs, now);
+    // create proposals for the next commit and reject rounds, which differ
+    // only in the height, so the second one is derived from the first
+    auto proposal = tryCreateProposal(next_reject_round, txs, now, nullptr);
+    tryCreateProposal(next_commit_round, txs, now, proposal);
+    proposal_creation_strategy_->onProposalPacked(next_reject_round,
+                                                  txs.size());
+    proposal_creation_strategy_->onProposalPacked(next_commit_round,
+                                                  txs.size());
   }
 
   if (round.reject_round == kFirstRejectRound) {
-    std::lock_guard<std::shared_timed_mutex> lock(batches_mutex_);
-    pending_batches_.clear();
+    pending_batches_.carryOver(
+        max_carried_over_txs_, [this](const auto &batch) {
+          return this->batchAlreadyProcessed(batch);
+        });
+    carried_over_txs_amount_ = pending_batches_.size();
+    log_->info("Carried over {} transactions to the next round",
+               carried_over_txs_amount_.load());
   }
 }
 
-void OnDemandOrderingServiceImpl::tryCreateProposal(
+std::shared_ptr<const OnDemandOrderingServiceImpl::ProposalType>
+OnDemandOrderingServiceImpl::tryCreateProposal(
     iroha::consensus::Round round,
     const TransactionsCollectionType &txs,
-    shared_model::interface::types::TimestampType created_time) {
+    shared_model::interface::types::TimestampType created_time,
+    const std::shared_ptr<const ProposalType> &base) {
   if (not txs.empty()) {
-    // onRequestProposal will not be able to aquire the lock and access the map
-    std::lock_guard<std::shared_timed_mutex> lock(proposals_mutex_);
-    if (proposal_creation_strategy_->shouldCreateRound(round)) {
-      auto proposal = proposal_factory_->unsafeCreateProposal(
-          round.block_round, created_time, txs | boost::adaptors::indirected);
-      proposal_map_.erase(round);
-      proposal_map_.emplace(round, std::move(proposal));
-      log_->debug(
-          "packNextProposal: data has been fetched for {}. "
-          "Number of transactions in proposal = {}.",
-          round,
-          txs.size());
-    } else {
+    if (not proposal_creation_strategy_->shouldCreateRound(round)) {
       log_->debug("Proposal for {} not created by the strategy", round);
+      return nullptr;
+    }
+    iroha::tracing::ScopedSpan span("ordering.include");
+    if (span) {
+      span.setAttribute("round", round.toString());
+      for (const auto &tx : txs) {
+        span.addTransaction(tx->hash());
+      }
     }
-  } else {
-    log_->debug("No transactions to create a proposal for {}", round);
+    auto height = round.block_round;
+    std::shared_ptr<const ProposalType> proposal = base
+        ? proposal_factory_->unsafeCreateProposalAtHeight(*base, height)
+        : proposal_factory_->unsafeCreateProposal(
+              height, created_time, txs | boost::adaptors::indirected);
+    proposals_.set(round, proposal);
+    log_->debug(
+        "packNextProposal: data has been fetched for {}. "
+        "Number of transactions in proposal = {}.",
+        round,
+        txs.size());
+    proposal_created_subject_.get_subscriber().on_next(
+        transport::ProposalEvent{round, proposal});
+    return proposal;
   }
+  log_->debug("No transactions to create a proposal for {}", round);
+  return nullptr;
 }
 
 void OnDemandOrderingServiceImpl::tryErase(
     const consensus::Round &current_round) {
-  // find first round that is not less than current_round
-  auto current_proposal_it = proposal_map_.lower_bound(current_round);
   // save at most number_of_proposals_ rounds that are less than current_round
-  for (size_t i = 0; i < number_of_proposals_
-       and current_proposal_it != proposal_map_.begin();
-       ++i) {
-    current_proposal_it--;
-  }
-
-  // do not proceed if there is nothing to remove
-  if (current_proposal_it == proposal_map_.begin()) {
-    return;
-  }
-
-  detail::ProposalMapType proposal_map{current_proposal_it,
-                                       proposal_map_.end()};
-
-  {
-    std::lock_guard<std::shared_timed_mutex> lock(proposals_mutex_);
-    proposal_map_.swap(proposal_map);
-  }
-
-  for (auto it = proposal_map.begin(); it != current_proposal_it; ++it) {
-    log_->debug("tryErase: erased {}", it->first);
-  }
+  proposals_.eraseBefore(
+      current_round, number_of_proposals_, [this](const auto &round) {
+        log_->debug("tryErase: erased {}", round);
+      });
 }
 
 bool OnDemandOrderingServiceImpl::batchAlreadyProcessed(
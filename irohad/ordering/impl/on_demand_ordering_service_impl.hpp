@@ -8,16 +8,14 @@
 
 #include "ordering/on_demand_ordering_service.hpp"
 
-#include <map>
-#include <shared_mutex>
+#include <atomic>
 
-#include <tbb/concurrent_unordered_set.h>
+#include <rxcpp/rx-lite.hpp>
 #include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger_fwd.hpp"
-#include "multi_sig_transactions/hash.hpp"
-// TODO 2019-03-15 andrei: IR-403 Separate BatchHashEquality and MstState
-#include "multi_sig_transactions/state/mst_state.hpp"
 #include "ordering/impl/on_demand_common.hpp"
+#include "ordering/impl/pending_batch_queue.hpp"
+#include "ordering/impl/proposal_ring.hpp"
 #include "ordering/ordering_service_proposal_creation_strategy.hpp"
 
 namespace iroha {
@@ -25,17 +23,6 @@ namespace iroha {
     class TxPresenceCache;
   }
   namespace ordering {
-    namespace detail {
-      using BatchSetType = tbb::concurrent_unordered_set<
-          transport::OdOsNotification::TransactionBatchType,
-          model::PointerBatchHasher,
-          BatchHashEquality>;
-
-      using ProposalMapType = std::map<
-          consensus::Round,
-          std::shared_ptr<const transport::OdOsNotification::ProposalType>>;
-    }  // namespace detail
-
     class OnDemandOrderingServiceImpl : public OnDemandOrderingService {
      public:
       /**
@@ -47,7 +34,12 @@ namespace iroha {
        * @param log to print progress
        * @param number_of_proposals - number of stored proposals, older will be
        * removed. Default value is 3
+       * @param max_carried_over_txs - max number of transactions which did not
+       * fit into the proposal and are kept for the next round
        * @param creation_strategy - provides a strategy for creating proposals
+       * @param fair_queuing - selection of the batches for the proposals by
+       * their creators, the batches are taken in arrival order if it is not
+       * set
        */
       OnDemandOrderingServiceImpl(
           size_t transaction_limit,
@@ -56,7 +48,15 @@ namespace iroha {
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           std::shared_ptr<ProposalCreationStrategy> proposal_creation_strategy,
           logger::LoggerPtr log,
-          size_t number_of_proposals = 3);
+          size_t number_of_proposals = kDefaultNumberOfProposals,
+          size_t max_carried_over_txs = kDefaultMaxCarriedOverTxs,
+          std::shared_ptr<FairQueuing> fair_queuing = nullptr);
+
+      /// default number of stored proposals
+      static constexpr size_t kDefaultNumberOfProposals = 3;
+
+      /// default max number of carried over transactions
+      static constexpr size_t kDefaultMaxCarriedOverTxs = 10000;
 
       // --------------------- | OnDemandOrderingService |_---------------------
 
@@ -69,7 +69,37 @@ namespace iroha {
       boost::optional<std::shared_ptr<const ProposalType>> onRequestProposal(
           consensus::Round round) override;
 
+      /**
+       * @return number of transactions carried over to the current round
+       */
+      size_t carriedOverTxsAmount() const;
+
+      /**
+       * @return number of transactions waiting for a proposal, may be called
+       * from any thread
+       */
+      size_t pendingTxsAmount() const;
+
+      /**
+       * @return observable of proposals which are emitted right after they
+       * are created by packNextProposals
+       */
+      rxcpp::observable<transport::ProposalEvent> onProposalCreated();
+
+      /**
+       * Change the max number of transactions in a proposal, which is
+       * applied to the proposals packed afterwards. May be called from any
+       * thread
+       */
+      void setTransactionLimit(size_t transaction_limit);
+
      private:
+      /**
+       * Number of rounds not less than the current one which may have a
+       * proposal: the current round, the next reject and commit rounds
+       */
+      static constexpr size_t kLiveRounds = 3;
+
       /**
        * Packs new proposals and creates new rounds
        * Note: method is not thread-safe
@@ -77,16 +107,23 @@ namespace iroha {
       void packNextProposals(const consensus::Round &round);
 
       using TransactionsCollectionType =
-          std::vector<std::shared_ptr<shared_model::interface::Transaction>>;
+          PendingBatchQueue::TransactionsCollectionType;
 
-      void tryCreateProposal(
+      /**
+       * Create the proposal for the round, if the strategy allows it
+       * @param base - proposal of the same transactions and time for another
+       * round, which the created one is derived from, if not null
+       * @return the created proposal, null if it is not created
+       */
+      std::shared_ptr<const ProposalType> tryCreateProposal(
           consensus::Round round,
           const TransactionsCollectionType &txs,
-          shared_model::interface::types::TimestampType created_time);
+          shared_model::interface::types::TimestampType created_time,
+          const std::shared_ptr<const ProposalType> &base);
 
       /**
-       * Removes last elements if it is required
-       * Method removes the oldest commit or chain of the oldest rejects
+       * Removes proposals of the rounds older than the last
+       * number_of_proposals_ rounds before the current one
        * Note: method is not thread-safe
        */
       void tryErase(const consensus::Round &current_round);
@@ -100,7 +137,7 @@ namespace iroha {
       /**
        * Max number of transaction in one proposal
        */
-      size_t transaction_limit_;
+      std::atomic<size_t> transaction_limit_;
 
       /**
        * Max number of available proposals in one OS
@@ -108,19 +145,30 @@ namespace iroha {
       size_t number_of_proposals_;
 
       /**
-       * Map of available proposals
+       * Max number of transactions carried over to the next round
+       */
+      size_t max_carried_over_txs_;
+
+      /**
+       * Number of transactions carried over to the current round
+       */
+      std::atomic<size_t> carried_over_txs_amount_{0};
+
+      /**
+       * Available proposals, read without locking
        */
-      detail::ProposalMapType proposal_map_;
+      ProposalRing proposals_;
 
       /**
        * Collections of batches for current round
        */
-      detail::BatchSetType pending_batches_;
+      PendingBatchQueue pending_batches_;
 
       /**
-       * Batches and proposal collection mutexes for public methods
+       * Created proposals, emitted from the thread of packNextProposals
        */
-      std::shared_timed_mutex batches_mutex_, proposals_mutex_;
+      rxcpp::subjects::subject<transport::ProposalEvent>
+          proposal_created_subject_;
 
       std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
           proposal_factory_;
@@ -23,40 +23,84 @@ OnDemandOsClientGrpc::OnDemandOsClientGrpc(
     std::shared_ptr<TransportFactoryType> proposal_factory,
     std::function<TimepointType()> time_provider,
     std::chrono::milliseconds proposal_request_timeout,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    std::shared_ptr<OnDemandOsProposalStream> proposal_stream,
+    std::string peer_address,
+    std::shared_ptr<ProposalRequestHedge> hedge,
+    std::shared_ptr<network::CompressionPolicy> batches_compression)
     : log_(std::move(log)),
       stub_(std::move(stub)),
       async_call_(std::move(async_call)),
       proposal_factory_(std::move(proposal_factory)),
       time_provider_(std::move(time_provider)),
-      proposal_request_timeout_(proposal_request_timeout) {}
+      proposal_request_timeout_(proposal_request_timeout),
+      proposal_stream_(std::move(proposal_stream)),
+      peer_address_(std::move(peer_address)),
+      hedge_(std::move(hedge)),
+      batches_compression_(std::move(batches_compression)) {}
 
 void OnDemandOsClientGrpc::onBatches(CollectionType batches) {
+  // the request references the transactions instead of copying them for
+  // each of the peers, it is serialized when the call starts, after which
+  // the transactions are released from the request
   proto::BatchesRequest request;
+  auto transactions = request.mutable_transactions();
   for (auto &batch : batches) {
     for (auto &transaction : batch->transactions()) {
-      *request.add_transactions() = std::move(
-          static_cast<shared_model::proto::Transaction *>(transaction.get())
-              ->getTransport());
+      transactions->UnsafeArenaAddAllocated(
+          const_cast<iroha::protocol::Transaction *>(
+              &static_cast<const shared_model::proto::Transaction &>(
+                   *transaction)
+                   .getTransport()));
     }
   }
 
-  log_->debug("Propagating: '{}'", request.DebugString());
+  log_->debug("Propagating {} transactions", transactions->size());
 
-  async_call_->Call([&](auto context, auto cq) {
+  async_call_->Call(peer_address_, [&](auto context, auto cq) {
+    if (batches_compression_) {
+      context->set_compression_algorithm(
+          batches_compression_->select(request.ByteSizeLong()));
+    }
     return stub_->AsyncSendBatches(context, request, cq);
   });
+  transactions->UnsafeArenaExtractSubrange(0, transactions->size(), nullptr);
 }
 
 boost::optional<std::shared_ptr<const OdOsNotification::ProposalType>>
 OnDemandOsClientGrpc::onRequestProposal(consensus::Round round) {
+  if (proposal_stream_) {
+    if (auto proposal = proposal_stream_->getProposal(round)) {
+      log_->debug("Using pushed proposal for {}", round);
+      return proposal;
+    }
+  }
+  // fallback to request if the proposal is not pushed yet
+  auto timeout = proposal_request_timeout_;
+  if (hedge_) {
+    timeout = hedge_->delay(proposal_request_timeout_);
+  }
   grpc::ClientContext context;
-  context.set_deadline(time_provider_() + proposal_request_timeout_);
+  context.set_deadline(time_provider_() + timeout);
   proto::ProposalRequest request;
   request.mutable_round()->set_block_round(round.block_round);
   request.mutable_round()->set_reject_round(round.reject_round);
   proto::ProposalResponse response;
+  auto start = std::chrono::steady_clock::now();
   auto status = stub_->RequestProposal(&context, request, &response);
+  if (hedge_) {
+    if (status.ok()) {
+      hedge_->observe(std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - start));
+    } else if (status.error_code() == grpc::StatusCode::DEADLINE_EXCEEDED
+               and timeout < proposal_request_timeout_) {
+      hedge_->countGivenUp();
+      log_->info("Gave up the proposal request for {} after {} ms",
+                 round,
+                 timeout.count());
+      return boost::none;
+    }
+  }
   if (not status.ok()) {
     log_->warn("RPC failed: {}", status.error_message());
     return boost::none;
@@ -84,20 +128,61 @@ OnDemandOsClientGrpcFactory::OnDemandOsClientGrpcFactory(
     std::shared_ptr<TransportFactoryType> proposal_factory,
     std::function<OnDemandOsClientGrpc::TimepointType()> time_provider,
     OnDemandOsClientGrpc::TimeoutType proposal_request_timeout,
-    logger::LoggerPtr client_log)
+    logger::LoggerPtr client_log,
+    bool proposal_streaming,
+    std::shared_ptr<network::ChannelPool> channel_pool,
+    std::shared_ptr<network::CompressionPolicy> batches_compression)
     : async_call_(std::move(async_call)),
       proposal_factory_(std::move(proposal_factory)),
       time_provider_(time_provider),
       proposal_request_timeout_(proposal_request_timeout),
-      client_log_(std::move(client_log)) {}
+      client_log_(std::move(client_log)),
+      proposal_streaming_(proposal_streaming),
+      channel_pool_(std::move(channel_pool)),
+      batches_compression_(std::move(batches_compression)) {}
+
+std::unique_ptr<proto::OnDemandOrdering::StubInterface>
+OnDemandOsClientGrpcFactory::createStub(const std::string &address) {
+  if (channel_pool_) {
+    return channel_pool_->createClient<proto::OnDemandOrdering>(address);
+  }
+  return network::createClient<proto::OnDemandOrdering>(address);
+}
+
+void OnDemandOsClientGrpcFactory::setProposalRequestTimeout(
+    OnDemandOsClientGrpc::TimeoutType proposal_request_timeout) {
+  proposal_request_timeout_ = proposal_request_timeout;
+}
+
+void OnDemandOsClientGrpcFactory::setProposalRequestHedge(
+    std::shared_ptr<ProposalRequestHedge> hedge) {
+  std::atomic_store(&hedge_, std::move(hedge));
+}
 
 std::unique_ptr<OdOsNotification> OnDemandOsClientGrpcFactory::create(
     const shared_model::interface::Peer &to) {
+  std::shared_ptr<OnDemandOsProposalStream> proposal_stream;
+  if (proposal_streaming_) {
+    std::lock_guard<std::mutex> lock(streams_mutex_);
+    auto &stream = proposal_streams_[to.address()];
+    if (not stream) {
+      stream = std::make_shared<OnDemandOsProposalStream>(
+          createStub(to.address()),
+          proposal_factory_,
+          proposal_request_timeout_,
+          client_log_);
+    }
+    proposal_stream = stream;
+  }
   return std::make_unique<OnDemandOsClientGrpc>(
-      network::createClient<proto::OnDemandOrdering>(to.address()),
+      createStub(to.address()),
       async_call_,
       proposal_factory_,
       time_provider_,
       proposal_request_timeout_,
-      client_log_);
+      client_log_,
+      std::move(proposal_stream),
+      to.address(),
+      std::atomic_load(&hedge_),
+      batches_compression_);
 }
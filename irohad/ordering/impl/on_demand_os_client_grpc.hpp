@@ -8,10 +8,18 @@
 
 #include "ordering/on_demand_os_transport.hpp"
 
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
 #include "logger/logger_fwd.hpp"
 #include "network/impl/async_grpc_client.hpp"
+#include "network/impl/channel_pool.hpp"
+#include "network/impl/compression_policy.hpp"
 #include "ordering.grpc.pb.h"
+#include "ordering/impl/on_demand_os_proposal_stream.hpp"
+#include "ordering/impl/proposal_request_hedge.hpp"
 
 namespace iroha {
   namespace ordering {
@@ -32,6 +40,14 @@ namespace iroha {
         /**
          * Constructor is left public because testing required passing a mock
          * stub interface
+         * @param proposal_stream - subscription to the proposals pushed by
+         * the peer, which are returned without a request. Optional
+         * @param peer_address - address of the peer, which bounds the batches
+         * in flight to it by the limit of the async client. Optional
+         * @param hedge - shortens the deadline of the proposal request to
+         * the one derived from the recent latencies. Optional
+         * @param batches_compression - compression of the batches sent to
+         * the peer. Optional
          */
         OnDemandOsClientGrpc(
             std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub,
@@ -40,7 +56,13 @@ namespace iroha {
             std::shared_ptr<TransportFactoryType> proposal_factory,
             std::function<TimepointType()> time_provider,
             std::chrono::milliseconds proposal_request_timeout,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            std::shared_ptr<OnDemandOsProposalStream> proposal_stream =
+                nullptr,
+            std::string peer_address = {},
+            std::shared_ptr<ProposalRequestHedge> hedge = nullptr,
+            std::shared_ptr<network::CompressionPolicy> batches_compression =
+                nullptr);
 
         void onBatches(CollectionType batches) override;
 
@@ -55,35 +77,83 @@ namespace iroha {
         std::shared_ptr<TransportFactoryType> proposal_factory_;
         std::function<TimepointType()> time_provider_;
         std::chrono::milliseconds proposal_request_timeout_;
+        std::shared_ptr<OnDemandOsProposalStream> proposal_stream_;
+        std::string peer_address_;
+        std::shared_ptr<ProposalRequestHedge> hedge_;
+        std::shared_ptr<network::CompressionPolicy> batches_compression_;
       };
 
       class OnDemandOsClientGrpcFactory : public OdOsNotificationFactory {
        public:
         using TransportFactoryType = OnDemandOsClientGrpc::TransportFactoryType;
+        /**
+         * @param proposal_streaming - subscribe to the proposals pushed by
+         * the peers. Subscriptions outlive the created connections, since
+         * connections are recreated on every round
+         * @param channel_pool - shared channels to the peers, a separate
+         * channel is created for every connection if it is null
+         * @param batches_compression - compression of the batches sent by
+         * the connections, they are not compressed if it is null
+         */
         OnDemandOsClientGrpcFactory(
             std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
                 async_call,
             std::shared_ptr<TransportFactoryType> proposal_factory,
             std::function<OnDemandOsClientGrpc::TimepointType()> time_provider,
             OnDemandOsClientGrpc::TimeoutType proposal_request_timeout,
-            logger::LoggerPtr client_log);
+            logger::LoggerPtr client_log,
+            bool proposal_streaming = false,
+            std::shared_ptr<network::ChannelPool> channel_pool = nullptr,
+            std::shared_ptr<network::CompressionPolicy> batches_compression =
+                nullptr);
 
         /**
-         * Create connection with insecure gRPC channel defined by
-         * network::createClient method
+         * Create connection over the channel from the pool, or with insecure
+         * gRPC channel defined by network::createClient method without a pool
          * @see network/impl/grpc_channel_builder.hpp
          * This factory method can be used in production code
          */
         std::unique_ptr<OdOsNotification> create(
             const shared_model::interface::Peer &to) override;
 
+        /**
+         * Change the timeout of the proposal requests of the connections
+         * created afterwards, that is from the next round. May be called from
+         * any thread
+         */
+        void setProposalRequestTimeout(
+            OnDemandOsClientGrpc::TimeoutType proposal_request_timeout);
+
+        /**
+         * Give up the proposal requests of the connections created
+         * afterwards at the deadline derived from the recent latencies
+         * instead of the timeout. May be called from any thread
+         * @param hedge - deadline of the requests, nullptr disables it
+         */
+        void setProposalRequestHedge(
+            std::shared_ptr<ProposalRequestHedge> hedge);
+
        private:
+        std::unique_ptr<proto::OnDemandOrdering::StubInterface> createStub(
+            const std::string &address);
+
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call_;
         std::shared_ptr<TransportFactoryType> proposal_factory_;
         std::function<OnDemandOsClientGrpc::TimepointType()> time_provider_;
-        std::chrono::milliseconds proposal_request_timeout_;
+        std::atomic<std::chrono::milliseconds> proposal_request_timeout_;
         logger::LoggerPtr client_log_;
+        bool proposal_streaming_;
+        std::shared_ptr<network::ChannelPool> channel_pool_;
+        std::shared_ptr<network::CompressionPolicy> batches_compression_;
+        /// accessed with the atomic functions of shared_ptr
+        std::shared_ptr<ProposalRequestHedge> hedge_;
+
+        std::mutex streams_mutex_;
+        /// proposal subscriptions by peer address
+        std::unordered_map<std::string,
+                           std::shared_ptr<OnDemandOsProposalStream>>
+            proposal_streams_;
       };
 
     }  // namespace transport
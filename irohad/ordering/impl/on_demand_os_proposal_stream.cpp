@@ -0,0 +1,102 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/on_demand_os_proposal_stream.hpp"
+
+#include "backend/protobuf/proposal.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha;
+using namespace iroha::ordering;
+using namespace iroha::ordering::transport;
+
+OnDemandOsProposalStream::OnDemandOsProposalStream(
+    std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub,
+    std::shared_ptr<TransportFactoryType> proposal_factory,
+    std::chrono::milliseconds resubscribe_delay,
+    logger::LoggerPtr log,
+    size_t number_of_proposals)
+    : stub_(std::move(stub)),
+      proposal_factory_(std::move(proposal_factory)),
+      resubscribe_delay_(resubscribe_delay),
+      log_(std::move(log)),
+      number_of_proposals_(number_of_proposals),
+      thread_([this] { run(); }) {}
+
+OnDemandOsProposalStream::~OnDemandOsProposalStream() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+    if (context_) {
+      context_->TryCancel();
+    }
+  }
+  stop_cv_.notify_one();
+  thread_.join();
+}
+
+boost::optional<std::shared_ptr<const OnDemandOsProposalStream::ProposalType>>
+OnDemandOsProposalStream::getProposal(const consensus::Round &round) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = proposals_.find(round);
+  if (it == proposals_.end()) {
+    return boost::none;
+  }
+  return it->second;
+}
+
+void OnDemandOsProposalStream::run() {
+  while (true) {
+    std::shared_ptr<grpc::ClientContext> context;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_) {
+        return;
+      }
+      context_ = context = std::make_shared<grpc::ClientContext>();
+    }
+
+    auto reader =
+        stub_->SubscribeProposals(context.get(), google::protobuf::Empty{});
+    proto::RoundProposal message;
+    while (reader->Read(&message)) {
+      onProposal(std::move(message));
+    }
+    auto status = reader->Finish();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    context_.reset();
+    if (stopped_) {
+      return;
+    }
+    log_->debug("proposal stream closed: {}, resubscribing",
+                status.error_message());
+    if (stop_cv_.wait_for(
+            lock, resubscribe_delay_, [this] { return stopped_; })) {
+      return;
+    }
+  }
+}
+
+void OnDemandOsProposalStream::onProposal(proto::RoundProposal message) {
+  consensus::Round round{message.round().block_round(),
+                         message.round().reject_round()};
+  proposal_factory_->build(message.proposal())
+      .match(
+          [&](auto &&v) {
+            std::shared_ptr<const ProposalType> proposal = std::move(v).value;
+            std::lock_guard<std::mutex> lock(mutex_);
+            proposals_[round] = std::move(proposal);
+            while (proposals_.size() > number_of_proposals_) {
+              proposals_.erase(proposals_.begin());
+            }
+            log_->debug("Received pushed proposal for {}", round);
+          },
+          [&](const auto &error) {
+            log_->info("Pushed proposal for {} is invalid: {}",
+                       round,
+                       error.error.error);
+          });
+}
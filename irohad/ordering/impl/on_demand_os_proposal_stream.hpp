@@ -0,0 +1,98 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ON_DEMAND_OS_PROPOSAL_STREAM_HPP
+#define IROHA_ON_DEMAND_OS_PROPOSAL_STREAM_HPP
+
+#include "ordering/on_demand_os_transport.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include "interfaces/iroha_internal/abstract_transport_factory.hpp"
+#include "logger/logger_fwd.hpp"
+#include "ordering.grpc.pb.h"
+
+namespace iroha {
+  namespace ordering {
+    namespace transport {
+
+      /**
+       * Subscription to the proposals pushed by a peer with SubscribeProposals
+       * stream. Received proposals are kept for the last rounds, so the
+       * proposal can be taken without a request to the peer. Subscription is
+       * renewed when the stream is closed.
+       */
+      class OnDemandOsProposalStream {
+       public:
+        using ProposalType = OdOsNotification::ProposalType;
+        using TransportFactoryType =
+            shared_model::interface::AbstractTransportFactory<
+                shared_model::interface::Proposal,
+                iroha::protocol::Proposal>;
+
+        /**
+         * @param stub - stub of the peer to subscribe
+         * @param proposal_factory - factory for received proposals
+         * @param resubscribe_delay - delay before the subscription is renewed
+         * @param log - logger
+         * @param number_of_proposals - number of stored proposals, older will
+         * be removed
+         */
+        OnDemandOsProposalStream(
+            std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub,
+            std::shared_ptr<TransportFactoryType> proposal_factory,
+            std::chrono::milliseconds resubscribe_delay,
+            logger::LoggerPtr log,
+            size_t number_of_proposals = 3);
+
+        ~OnDemandOsProposalStream();
+
+        /**
+         * Get the proposal pushed by the peer for the round
+         * @param round - round of the proposal
+         * @return proposal if it is already received
+         */
+        boost::optional<std::shared_ptr<const ProposalType>> getProposal(
+            const consensus::Round &round);
+
+       private:
+        /**
+         * Read the stream until the subscription is stopped
+         */
+        void run();
+
+        /**
+         * Build and store the received proposal
+         */
+        void onProposal(proto::RoundProposal message);
+
+        std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub_;
+        std::shared_ptr<TransportFactoryType> proposal_factory_;
+        std::chrono::milliseconds resubscribe_delay_;
+        logger::LoggerPtr log_;
+        size_t number_of_proposals_;
+
+        std::mutex mutex_;
+        std::condition_variable stop_cv_;
+        bool stopped_ = false;
+
+        /// context of the current subscription, used to cancel it
+        std::shared_ptr<grpc::ClientContext> context_;
+
+        std::map<consensus::Round, std::shared_ptr<const ProposalType>>
+            proposals_;
+
+        std::thread thread_;
+      };
+
+    }  // namespace transport
+  }    // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_ON_DEMAND_OS_PROPOSAL_STREAM_HPP
@@ -3,14 +3,11 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
-#include "common/default_constructible_unary_fn.hpp"  // non-copyable value workaround
-
 #include "ordering/impl/on_demand_os_server_grpc.hpp"
 
-#include <boost/range/adaptor/filtered.hpp>
-#include <boost/range/adaptor/transformed.hpp>
-#include "backend/protobuf/proposal.hpp"
 #include "common/bind.hpp"
+#include "common/run_loop_handler.hpp"
+#include "interfaces/iroha_internal/proposal.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "logger/logger.hpp"
 
@@ -24,37 +21,49 @@ OnDemandOsServerGrpc::OnDemandOsServerGrpc(
         batch_parser,
     std::shared_ptr<shared_model::interface::TransactionBatchFactory>
         transaction_batch_factory,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    boost::optional<rxcpp::observable<ProposalEvent>> proposals,
+    std::shared_ptr<validation::ValidationPool> validation_pool,
+    std::shared_ptr<network::CompressionPolicy> proposal_compression)
     : ordering_service_(ordering_service),
       transaction_factory_(std::move(transaction_factory)),
       batch_parser_(std::move(batch_parser)),
       batch_factory_(std::move(transaction_batch_factory)),
+      proposals_(std::move(proposals)),
+      validation_pool_(
+          validation_pool
+              ? std::move(validation_pool)
+              : std::make_shared<validation::ValidationPool>(1)),
+      proposal_compression_(std::move(proposal_compression)),
       log_(std::move(log)) {}
 
 shared_model::interface::types::SharedTxsCollectionType
 OnDemandOsServerGrpc::deserializeTransactions(
     const proto::BatchesRequest *request) {
-  return boost::copy_range<
-      shared_model::interface::types::SharedTxsCollectionType>(
-      request->transactions()
-      | boost::adaptors::transformed(
-            [&](const auto &tx) { return transaction_factory_->build(tx); })
-      | boost::adaptors::filtered([&](const auto &result) {
-          return result.match(
-              [](const auto &) { return true; },
-              [&](const auto &error) {
-                log_->info("Transaction deserialization failed: hash {}, {}",
-                           error.error.hash,
-                           error.error.error);
-                return false;
-              });
-        })
-      | boost::adaptors::transformed([](auto result) {
-          return std::move(
-                     boost::get<iroha::expected::ValueOf<decltype(result)>>(
-                         result))
-              .value;
-        }));
+  return validation_pool_
+      ->buildAll<shared_model::interface::types::SharedTxsCollectionType>(
+          request->transactions_size(),
+          [&](size_t i) {
+            return transaction_factory_->build(request->transactions(i));
+          },
+          [&](const auto &error) {
+            log_->info("Transaction deserialization failed: hash {}, {}",
+                       error.hash,
+                       error.error);
+          });
+}
+
+OdOsNotification::CollectionType OnDemandOsServerGrpc::createBatches(
+    const std::vector<shared_model::interface::types::SharedTxsCollectionType>
+        &candidates) {
+  return validation_pool_->buildAll<OdOsNotification::CollectionType>(
+      candidates.size(),
+      [&](size_t i) {
+        return batch_factory_->createTransactionBatch(candidates[i]);
+      },
+      [&](const auto &error) {
+        log_->warn("Batch deserialization failed: {}", error);
+      });
 }
 
 grpc::Status OnDemandOsServerGrpc::SendBatches(
@@ -65,16 +74,7 @@ grpc::Status OnDemandOsServerGrpc::SendBatches(
 
   auto batch_candidates = batch_parser_->parseBatches(std::move(transactions));
 
-  OdOsNotification::CollectionType batches;
-  for (auto &cand : batch_candidates) {
-    batch_factory_->createTransactionBatch(cand).match(
-        [&](auto &&value) { batches.push_back(std::move(value).value); },
-        [&](const auto &error) {
-          log_->warn("Batch deserialization failed: {}", error.error);
-        });
-  }
-
-  ordering_service_->onBatches(std::move(batches));
+  ordering_service_->onBatches(createBatches(batch_candidates));
 
   return ::grpc::Status::OK;
 }
@@ -86,9 +86,74 @@ grpc::Status OnDemandOsServerGrpc::RequestProposal(
   ordering_service_->onRequestProposal(
       {request->round().block_round(), request->round().reject_round()})
       | [&](auto &&proposal) {
-          *response->mutable_proposal() =
-              static_cast<const shared_model::proto::Proposal *>(proposal.get())
-                  ->getTransport();
+          // proposal blob is the wire encoding built once on proposal
+          // creation, so it is not serialized again for every request
+          const auto &blob = proposal->blob().blob();
+          response->set_proposal(blob.data(), blob.size());
         };
+  if (proposal_compression_) {
+    context->set_compression_algorithm(
+        proposal_compression_->select(response->ByteSizeLong()));
+  }
+  return ::grpc::Status::OK;
+}
+
+grpc::Status OnDemandOsServerGrpc::SubscribeProposals(
+    ::grpc::ServerContext *context,
+    const ::google::protobuf::Empty *request,
+    ::grpc::ServerWriter<proto::RoundProposal> *writer) {
+  if (not proposals_) {
+    return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED,
+                          "proposal streaming is disabled");
+  }
+
+  rxcpp::schedulers::run_loop rl;
+
+  auto current_thread =
+      rxcpp::synchronize_in_one_worker(rxcpp::schedulers::make_run_loop(rl));
+
+  rxcpp::composite_subscription subscription;
+
+  const auto client_id = context->peer();
+  log_->debug("proposal stream subscribed, {}", client_id);
+  if (proposal_compression_) {
+    proposal_compression_->prepareStream(*context);
+  }
+
+  proposals_->observe_on(current_thread)
+      // complete the observable if client is disconnected
+      .take_while([&](const ProposalEvent &event) {
+        if (context->IsCancelled()) {
+          log_->debug("client unsubscribed, {}", client_id);
+          return false;
+        }
+
+        proto::RoundProposal response;
+        response.mutable_round()->set_block_round(event.round.block_round);
+        response.mutable_round()->set_reject_round(event.round.reject_round);
+        const auto &blob = event.proposal->blob().blob();
+        response.set_proposal(blob.data(), blob.size());
+
+        auto options = proposal_compression_
+            ? proposal_compression_->writeOptions(response.ByteSizeLong())
+            : grpc::WriteOptions{};
+        if (not writer->Write(response, options)) {
+          log_->debug("write to proposal stream has failed, {}", client_id);
+          return false;
+        }
+        log_->debug("proposal for {} written, {}", event.round, client_id);
+        return true;
+      })
+      .subscribe(subscription,
+                 [](const auto &) {},
+                 [&](std::exception_ptr ep) {
+                   log_->error("proposal stream failed, {}", client_id);
+                 },
+                 [&] { log_->debug("proposal stream done, {}", client_id); });
+
+  // run loop while subscription is active or there are pending events in the
+  // queue
+  iroha::schedulers::handleEvents(subscription, rl);
+
   return ::grpc::Status::OK;
 }
@@ -8,11 +8,14 @@
 
 #include "ordering/on_demand_os_transport.hpp"
 
+#include <rxcpp/rx-lite.hpp>
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser.hpp"
 #include "logger/logger_fwd.hpp"
+#include "network/impl/compression_policy.hpp"
 #include "ordering.grpc.pb.h"
+#include "validation/validation_pool.hpp"
 
 namespace iroha {
   namespace ordering {
@@ -28,6 +31,16 @@ namespace iroha {
                 shared_model::interface::Transaction,
                 iroha::protocol::Transaction>;
 
+        /**
+         * @param proposals - proposals created by the ordering service, which
+         * are pushed to the subscribers of SubscribeProposals. If not
+         * provided, proposal streaming is disabled
+         * @param validation_pool - workers which deserialize and validate
+         * transactions of a SendBatches request, the calling thread if not
+         * provided
+         * @param proposal_compression - compression of the requested and
+         * the pushed proposals. Optional
+         */
         OnDemandOsServerGrpc(
             std::shared_ptr<OdOsNotification> ordering_service,
             std::shared_ptr<TransportFactoryType> transaction_factory,
@@ -35,7 +48,13 @@ namespace iroha {
                 batch_parser,
             std::shared_ptr<shared_model::interface::TransactionBatchFactory>
                 transaction_batch_factory,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            boost::optional<rxcpp::observable<ProposalEvent>> proposals =
+                boost::none,
+            std::shared_ptr<validation::ValidationPool> validation_pool =
+                nullptr,
+            std::shared_ptr<network::CompressionPolicy> proposal_compression =
+                nullptr);
 
         grpc::Status SendBatches(::grpc::ServerContext *context,
                                  const proto::BatchesRequest *request,
@@ -46,6 +65,11 @@ namespace iroha {
             const proto::ProposalRequest *request,
             proto::ProposalResponse *response) override;
 
+        grpc::Status SubscribeProposals(
+            ::grpc::ServerContext *context,
+            const ::google::protobuf::Empty *request,
+            ::grpc::ServerWriter<proto::RoundProposal> *writer) override;
+
        private:
         /**
          * Flat map transport transactions to shared model
@@ -53,6 +77,14 @@ namespace iroha {
         shared_model::interface::types::SharedTxsCollectionType
         deserializeTransactions(const proto::BatchesRequest *request);
 
+        /**
+         * Create batches from the candidates, invalid candidates are skipped
+         */
+        OdOsNotification::CollectionType createBatches(
+            const std::vector<
+                shared_model::interface::types::SharedTxsCollectionType>
+                &candidates);
+
         std::shared_ptr<OdOsNotification> ordering_service_;
 
         std::shared_ptr<TransportFactoryType> transaction_factory_;
@@ -61,6 +93,12 @@ namespace iroha {
         std::shared_ptr<shared_model::interface::TransactionBatchFactory>
             batch_factory_;
 
+        boost::optional<rxcpp::observable<ProposalEvent>> proposals_;
+
+        std::shared_ptr<validation::ValidationPool> validation_pool_;
+
+        std::shared_ptr<network::CompressionPolicy> proposal_compression_;
+
         logger::LoggerPtr log_;
       };
 
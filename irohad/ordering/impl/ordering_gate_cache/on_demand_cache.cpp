@@ -16,24 +16,34 @@ using namespace iroha::ordering::cache;
 void OnDemandCache::addToBack(
     const OrderingGateCache::BatchesSetType &batches) {
   std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-  circ_buffer.back().insert(batches.begin(), batches.end());
+  const auto tail_slot = head_slot_ + circ_buffer.size() - 1;
+  for (const auto &batch : batches) {
+    // a batch resent by the gate stays in the slot it was first added to
+    auto inserted =
+        batches_.emplace(batch->reducedHash(), Entry{batch, tail_slot, 0});
+    if (not inserted.second) {
+      continue;
+    }
+    auto &entry = inserted.first->second;
+    for (const auto &tx : batch->transactions()) {
+      transactions_.emplace(tx->hash(), batch->reducedHash());
+      entry.bytes += tx->blob().size();
+    }
+    bytes_ += entry.bytes;
+    circ_buffer.back().insert(batch);
+  }
 }
 
 void OnDemandCache::remove(const OrderingGateCache::HashesSetType &hashes) {
   std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-  for (auto &batches : circ_buffer) {
-    for (auto it = batches.begin(); it != batches.end();) {
-      if (std::any_of(it->get()->transactions().begin(),
-                      it->get()->transactions().end(),
-                      [&hashes](const auto &tx) {
-                        return hashes.find(tx->hash()) != hashes.end();
-                      })) {
-        // returns iterator following the last removed element
-        // hence there is no increment in loop iteration_expression
-        it = batches.erase(it);
-      } else {
-        ++it;
-      }
+  for (const auto &hash : hashes) {
+    auto tx = transactions_.find(hash);
+    if (tx == transactions_.end()) {
+      continue;
+    }
+    auto entry = batches_.find(tx->second);
+    if (entry != batches_.end()) {
+      erase(entry);
     }
   }
 }
@@ -42,8 +52,17 @@ OrderingGateCache::BatchesSetType OnDemandCache::pop() {
   std::unique_lock<std::shared_timed_mutex> lock(mutex_);
   BatchesSetType res;
   std::swap(res, circ_buffer.front());
+  for (const auto &batch : res) {
+    auto entry = batches_.find(batch->reducedHash());
+    for (const auto &tx : batch->transactions()) {
+      transactions_.erase(tx->hash());
+    }
+    bytes_ -= entry->second.bytes;
+    batches_.erase(entry);
+  }
   // push empty set to remove front element
   circ_buffer.push_back(BatchesSetType{});
+  ++head_slot_;
   return res;
 }
 
@@ -56,3 +75,22 @@ const OrderingGateCache::BatchesSetType &OnDemandCache::tail() const {
   std::shared_lock<std::shared_timed_mutex> lock(mutex_);
   return circ_buffer.back();
 }
+
+size_t OnDemandCache::sizeInBytes() const {
+  return bytes_.load(std::memory_order_relaxed);
+}
+
+OrderingGateCache::BatchesSetType &OnDemandCache::slotOf(
+    uint64_t sequence_number) {
+  return circ_buffer[sequence_number - head_slot_];
+}
+
+void OnDemandCache::erase(Entries::iterator entry) {
+  const auto &batch = entry->second.batch;
+  slotOf(entry->second.slot).erase(batch);
+  for (const auto &tx : batch->transactions()) {
+    transactions_.erase(tx->hash());
+  }
+  bytes_ -= entry->second.bytes;
+  batches_.erase(entry);
+}
@@ -8,7 +8,10 @@
 
 #include "ordering/impl/ordering_gate_cache/ordering_gate_cache.hpp"
 
+#include <atomic>
+#include <mutex>
 #include <shared_mutex>
+#include <unordered_map>
 
 #include <boost/circular_buffer.hpp>
 
@@ -16,22 +19,73 @@ namespace iroha {
   namespace ordering {
     namespace cache {
 
+      /**
+       * Cache of the batches in three slots, which are the rounds the batches
+       * are resent in. The batches are indexed by their reduced hashes and
+       * by the hashes of their transactions, so a batch is kept in one slot
+       * at most, and the committed ones are removed without scanning the
+       * slots.
+       */
       class OnDemandCache : public OrderingGateCache {
        public:
+        /**
+         * Concatenates batches from the tail of the queue with provided
+         * batches, skipping the ones which are already in any slot
+         */
         void addToBack(const BatchesSetType &batches) override;
 
         BatchesSetType pop() override;
 
+        /**
+         * Removes the batches having a transaction with one of the hashes
+         * from all the slots
+         */
         void remove(const HashesSetType &hashes) override;
 
         virtual const BatchesSetType &head() const override;
 
         virtual const BatchesSetType &tail() const override;
 
+        /// @return serialized size of the cached transactions in bytes
+        size_t sizeInBytes() const;
+
        private:
+        using BatchPtr =
+            std::shared_ptr<shared_model::interface::TransactionBatch>;
+
+        /// cached batch with its position
+        struct Entry {
+          BatchPtr batch;
+          /// sequence number of the slot of the batch
+          uint64_t slot;
+          /// serialized size of the transactions of the batch
+          size_t bytes;
+        };
+
+        using Entries = std::unordered_map<shared_model::crypto::Hash,
+                                           Entry,
+                                           shared_model::crypto::Hash::Hasher>;
+
+        /// @return the slot with the sequence number
+        BatchesSetType &slotOf(uint64_t sequence_number);
+
+        /// remove the batch of the entry from its slot and from the indices
+        void erase(Entries::iterator entry);
+
         mutable std::shared_timed_mutex mutex_;
         using BatchesQueueType = boost::circular_buffer<BatchesSetType>;
         BatchesQueueType circ_buffer{3, BatchesSetType{}};
+
+        /// sequence number of the head slot, the slots behind it follow
+        uint64_t head_slot_ = 0;
+        /// cached batches by their reduced hashes
+        Entries batches_;
+        /// reduced hashes of the cached batches by their transaction hashes
+        std::unordered_map<shared_model::crypto::Hash,
+                           shared_model::crypto::Hash,
+                           shared_model::crypto::Hash::Hasher>
+            transactions_;
+        std::atomic<size_t> bytes_{0};
       };
 
     }  // namespace cache
@@ -0,0 +1,111 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/pending_batch_queue.hpp"
+
+#include <algorithm>
+
+#include <boost/range/size.hpp>
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
+
+using namespace iroha::ordering;
+
+PendingBatchQueue::PendingBatchQueue(std::shared_ptr<FairQueuing> fair_queuing)
+    : fair_queuing_(std::move(fair_queuing)) {}
+
+void PendingBatchQueue::push(TransactionBatchType batch) {
+  incoming_txs_amount_ += boost::size(batch->transactions());
+  incoming_.push(std::move(batch));
+}
+
+PendingBatchQueue::TransactionsCollectionType
+PendingBatchQueue::getTransactions(size_t requested_tx_amount,
+                                   size_t &discarded_txs_amount) {
+  drain();
+
+  TransactionsCollectionType collection;
+  taken_.assign(batches_.size(), false);
+  auto take = [&](size_t index) {
+    const auto &batch = batches_[index];
+    collection.insert(std::end(collection),
+                      std::begin(batch->transactions()),
+                      std::end(batch->transactions()));
+    taken_[index] = true;
+  };
+  if (fair_queuing_) {
+    for (auto index : fair_queuing_->select(batches_, requested_tx_amount)) {
+      take(index);
+    }
+  } else {
+    for (size_t i = 0; i < batches_.size(); ++i) {
+      if (collection.size() + boost::size(batches_[i]->transactions())
+          > requested_tx_amount) {
+        break;
+      }
+      take(i);
+    }
+  }
+
+  discarded_txs_amount = txs_amount_ - collection.size();
+  return collection;
+}
+
+void PendingBatchQueue::clear() {
+  batches_.clear();
+  index_.clear();
+  txs_amount_ = 0;
+  taken_.clear();
+}
+
+void PendingBatchQueue::carryOver(
+    size_t max_txs_amount,
+    const std::function<bool(const shared_model::interface::TransactionBatch &)>
+        &is_processed) {
+  std::vector<TransactionBatchType> carried_over;
+  size_t carried_over_txs_amount = 0;
+  for (size_t i = 0; i < batches_.size(); ++i) {
+    if (i < taken_.size() and taken_[i]) {
+      continue;
+    }
+    auto batch_size = boost::size(batches_[i]->transactions());
+    if (carried_over_txs_amount + batch_size > max_txs_amount) {
+      break;
+    }
+    if (is_processed(*batches_[i])) {
+      continue;
+    }
+    carried_over_txs_amount += batch_size;
+    carried_over.push_back(std::move(batches_[i]));
+  }
+
+  clear();
+  index_.insert(carried_over.begin(), carried_over.end());
+  batches_ = std::move(carried_over);
+  txs_amount_ = carried_over_txs_amount;
+}
+
+bool PendingBatchQueue::empty() const {
+  return batches_.empty() and incoming_.empty();
+}
+
+size_t PendingBatchQueue::size() const {
+  return txs_amount_;
+}
+
+size_t PendingBatchQueue::pendingTxsAmount() const {
+  return txs_amount_ + incoming_txs_amount_;
+}
+
+void PendingBatchQueue::drain() {
+  TransactionBatchType batch;
+  while (incoming_.try_pop(batch)) {
+    incoming_txs_amount_ -= boost::size(batch->transactions());
+    if (index_.insert(batch).second) {
+      txs_amount_ += boost::size(batch->transactions());
+      batches_.push_back(std::move(batch));
+    }
+  }
+}
@@ -0,0 +1,144 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PENDING_BATCH_QUEUE_HPP
+#define IROHA_PENDING_BATCH_QUEUE_HPP
+
+#include <atomic>
+#include <functional>
+#include <unordered_set>
+#include <vector>
+
+#include <tbb/concurrent_queue.h>
+#include "multi_sig_transactions/hash.hpp"
+#include "ordering/impl/fair_queuing.hpp"
+// TODO 2019-03-15 andrei: IR-403 Separate BatchHashEquality and MstState
+#include "multi_sig_transactions/state/mst_state.hpp"
+#include "ordering/on_demand_os_transport.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Transaction;
+    class TransactionBatch;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Arrival-ordered collection of batches waiting for a proposal.
+     * Producers push batches without locking into a multi-producer queue,
+     * the single consumer (proposal packing) moves them into an ordered
+     * sequence, dropping duplicates with a separate hash index. The batches
+     * are taken in arrival order, or by the fair queuing of their creators
+     * if it is set.
+     */
+    class PendingBatchQueue {
+     public:
+      using TransactionBatchType =
+          transport::OdOsNotification::TransactionBatchType;
+      using TransactionsCollectionType =
+          std::vector<std::shared_ptr<shared_model::interface::Transaction>>;
+
+      /**
+       * @param fair_queuing - selection of the batches for a proposal, the
+       * batches are taken in arrival order if it is not set
+       */
+      explicit PendingBatchQueue(
+          std::shared_ptr<FairQueuing> fair_queuing = nullptr);
+
+      /**
+       * Enqueue the batch. Lock-free, may be called from any thread
+       * @param batch - batch to enqueue
+       */
+      void push(TransactionBatchType batch);
+
+      /**
+       * Get transactions from the pending batches in arrival order. Does not
+       * break batches - stops on the first batch which does not fit into the
+       * requested amount. With the fair queuing the batches are selected by
+       * it and are returned in arrival order. Batches are left in the queue.
+       * Note: method is not thread-safe, only the consumer may call it
+       * @param requested_tx_amount - amount of transactions to get
+       * @param discarded_txs_amount - the amount of transactions which did
+       * not fit
+       * @return transactions
+       */
+      TransactionsCollectionType getTransactions(size_t requested_tx_amount,
+                                                 size_t &discarded_txs_amount);
+
+      /**
+       * Remove all batches which have been seen by the consumer. Batches
+       * which are pushed concurrently are kept for the next call of
+       * getTransactions.
+       * Note: method is not thread-safe, only the consumer may call it
+       */
+      void clear();
+
+      /**
+       * Keep the batches which were not taken by the last call of
+       * getTransactions for the next round. Carried over batches which are
+       * already processed are evicted, and only the oldest batches within
+       * max_txs_amount transactions are kept.
+       * Note: method is not thread-safe, only the consumer may call it
+       * @param max_txs_amount - max amount of carried over transactions
+       * @param is_processed - predicate for batch eviction
+       */
+      void carryOver(
+          size_t max_txs_amount,
+          const std::function<bool(
+              const shared_model::interface::TransactionBatch &)>
+              &is_processed);
+
+      /**
+       * @return true if there are no pending batches
+       */
+      bool empty() const;
+
+      /**
+       * @return amount of transactions seen by the consumer
+       */
+      size_t size() const;
+
+      /**
+       * @return amount of the pending transactions, including the ones not
+       * seen by the consumer yet. May be called from any thread
+       */
+      size_t pendingTxsAmount() const;
+
+     private:
+      /**
+       * Move enqueued batches to the ordered sequence, skipping duplicates
+       */
+      void drain();
+
+      tbb::concurrent_queue<TransactionBatchType> incoming_;
+
+      /// batches in arrival order, owned by the consumer
+      std::vector<TransactionBatchType> batches_;
+
+      /// hash index of batches_ used for deduplication
+      std::unordered_set<TransactionBatchType,
+                         model::PointerBatchHasher,
+                         BatchHashEquality>
+          index_;
+
+      /// number of transactions in batches_
+      std::atomic<size_t> txs_amount_{0};
+
+      /// number of transactions in incoming_
+      std::atomic<size_t> incoming_txs_amount_{0};
+
+      std::shared_ptr<FairQueuing> fair_queuing_;
+
+      /// flags of batches_ taken by the last call of getTransactions
+      std::vector<bool> taken_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_PENDING_BATCH_QUEUE_HPP
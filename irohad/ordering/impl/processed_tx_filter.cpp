@@ -0,0 +1,126 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/processed_tx_filter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "cryptography/hash.hpp"
+
+using namespace iroha::ordering;
+using shared_model::interface::types::TimestampType;
+
+constexpr size_t ProcessedTxFilter::kDefaultGenerationCapacity;
+constexpr double ProcessedTxFilter::kDefaultFalsePositiveRate;
+constexpr TimestampType ProcessedTxFilter::kFutureGap;
+
+namespace {
+  const double kLn2 = std::log(2.);
+  const size_t kBitsPerWord = 64;
+}  // namespace
+
+ProcessedTxFilter::ProcessedTxFilter(size_t generation_capacity,
+                                     double false_positive_rate,
+                                     TimeFunction time_provider)
+    : generation_capacity_(std::max<size_t>(1, generation_capacity)),
+      // optimal bloom filter parameters for the given capacity and rate
+      number_of_bits_(std::max<size_t>(
+          kBitsPerWord,
+          static_cast<size_t>(std::ceil(-std::log(false_positive_rate)
+                                        * generation_capacity_
+                                        / (kLn2 * kLn2))))),
+      number_of_hashes_(std::max<size_t>(
+          1,
+          static_cast<size_t>(std::round(
+              static_cast<double>(number_of_bits_) / generation_capacity_
+              * kLn2)))),
+      time_provider_(std::move(time_provider)),
+      coverage_start_(time_provider_() + kFutureGap) {
+  auto words = (number_of_bits_ + kBitsPerWord - 1) / kBitsPerWord;
+  current_.bits.resize(words);
+  previous_.bits.resize(words);
+}
+
+void ProcessedTxFilter::insert(
+    const shared_model::interface::types::HashType &hash) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (current_.size >= generation_capacity_) {
+    auto now = time_provider_();
+    // the dropped generation has been filled until the last rotation
+    if (last_rotation_) {
+      coverage_start_ = std::max(coverage_start_, *last_rotation_ + kFutureGap);
+    }
+    last_rotation_ = now;
+    std::swap(previous_, current_);
+    std::fill(current_.bits.begin(), current_.bits.end(), 0);
+    current_.size = 0;
+  }
+
+  forEachBit(hash, [this](size_t bit) {
+    current_.bits[bit / kBitsPerWord] |= uint64_t{1} << (bit % kBitsPerWord);
+  });
+  ++current_.size;
+}
+
+ProcessedTxFilter::Lookup ProcessedTxFilter::lookup(
+    const shared_model::interface::types::HashType &hash,
+    TimestampType created_time) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (created_time <= coverage_start_) {
+    return Lookup::kNotCovered;
+  }
+  if (contains(current_, hash) or contains(previous_, hash)) {
+    ++positives_;
+    return Lookup::kMaybeProcessed;
+  }
+  return Lookup::kNotProcessed;
+}
+
+void ProcessedTxFilter::onExactCheck(bool processed) {
+  if (not processed) {
+    ++false_positives_;
+  }
+}
+
+double ProcessedTxFilter::falsePositiveRate() const {
+  auto positives = positives_.load();
+  return positives == 0
+      ? 0.
+      : static_cast<double>(false_positives_.load()) / positives;
+}
+
+template <typename Visitor>
+void ProcessedTxFilter::forEachBit(
+    const shared_model::interface::types::HashType &hash,
+    Visitor &&visitor) const {
+  // double hashing on the words of the hash, which is already uniform
+  uint64_t h1 = 0, h2 = 0;
+  const auto &bytes = hash.blob();
+  if (bytes.size() >= sizeof(h1) + sizeof(h2)) {
+    std::memcpy(&h1, bytes.data(), sizeof(h1));
+    std::memcpy(&h2, bytes.data() + sizeof(h1), sizeof(h2));
+  } else {
+    h1 = shared_model::crypto::Hash::Hasher{}(hash);
+    h2 = h1 * 0x9e3779b97f4a7c15ull;
+  }
+  h2 |= 1;
+  for (size_t i = 0; i < number_of_hashes_; ++i) {
+    visitor(static_cast<size_t>((h1 + i * h2) % number_of_bits_));
+  }
+}
+
+bool ProcessedTxFilter::contains(
+    const Generation &generation,
+    const shared_model::interface::types::HashType &hash) const {
+  bool result = true;
+  forEachBit(hash, [&](size_t bit) {
+    result = result
+        and (generation.bits[bit / kBitsPerWord]
+             & (uint64_t{1} << (bit % kBitsPerWord)));
+  });
+  return result;
+}
@@ -0,0 +1,135 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROCESSED_TX_FILTER_HPP
+#define IROHA_PROCESSED_TX_FILTER_HPP
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include "interfaces/common_objects/types.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Rolling bloom filter of the processed transaction hashes, which are
+     * taken from the committed blocks. Answers "definitely not processed"
+     * in memory, so the exact presence check is only required for positive
+     * answers.
+     *
+     * A negative answer can only be trusted for transactions created after
+     * the filter has seen all commits which may have processed them: since
+     * a transaction is committed not earlier than its creation time minus
+     * the future gap, the filter covers transactions created later than the
+     * time of its oldest stored generation plus the future gap.
+     *
+     * The filter keeps two generations. When the current one is full, the
+     * previous one is dropped, and the coverage moves forward past the time
+     * when the dropped generation was filled.
+     */
+    class ProcessedTxFilter {
+     public:
+      using TimeFunction =
+          std::function<shared_model::interface::types::TimestampType()>;
+
+      /// result of the filter lookup
+      enum class Lookup {
+        /// transaction is definitely not processed
+        kNotProcessed,
+        /// transaction may be processed, exact check is required
+        kMaybeProcessed,
+        /// transaction is too old for the filter, exact check is required
+        kNotCovered
+      };
+
+      /// default max number of hashes in one generation
+      static constexpr size_t kDefaultGenerationCapacity = 1000000;
+      /// default target false positive rate of one generation
+      static constexpr double kDefaultFalsePositiveRate = 0.01;
+      /// max gap for future transactions, field validator default
+      static constexpr shared_model::interface::types::TimestampType
+          kFutureGap = 5 * 60 * 1000;
+
+      /**
+       * @param generation_capacity - max number of hashes in one generation
+       * @param false_positive_rate - target false positive rate
+       * @param time_provider - source of current time
+       */
+      ProcessedTxFilter(size_t generation_capacity,
+                        double false_positive_rate,
+                        TimeFunction time_provider);
+
+      /**
+       * Add processed transaction hash
+       * @param hash - hash of committed or rejected transaction
+       */
+      void insert(const shared_model::interface::types::HashType &hash);
+
+      /**
+       * Check whether the transaction may be processed
+       * @param hash - transaction hash
+       * @param created_time - transaction creation time
+       * @return lookup result
+       */
+      Lookup lookup(const shared_model::interface::types::HashType &hash,
+                    shared_model::interface::types::TimestampType created_time)
+          const;
+
+      /**
+       * Account the result of the exact check after a kMaybeProcessed
+       * lookup
+       * @param processed - whether the transaction turned out processed
+       */
+      void onExactCheck(bool processed);
+
+      /**
+       * @return share of kMaybeProcessed lookups which turned out not
+       * processed on the exact check
+       */
+      double falsePositiveRate() const;
+
+     private:
+      struct Generation {
+        std::vector<uint64_t> bits;
+        size_t size = 0;
+      };
+
+      /**
+       * Compute bit positions of the hash
+       * Note: hashes are expected to be uniformly distributed
+       */
+      template <typename Visitor>
+      void forEachBit(const shared_model::interface::types::HashType &hash,
+                      Visitor &&visitor) const;
+
+      bool contains(const Generation &generation,
+                    const shared_model::interface::types::HashType &hash) const;
+
+      size_t generation_capacity_;
+      size_t number_of_bits_;
+      size_t number_of_hashes_;
+      TimeFunction time_provider_;
+
+      mutable std::mutex mutex_;
+      Generation current_;
+      Generation previous_;
+      /// transactions created after this time are covered
+      shared_model::interface::types::TimestampType coverage_start_;
+      /// time when the current generation was started
+      boost::optional<shared_model::interface::types::TimestampType>
+          last_rotation_;
+
+      mutable std::atomic<uint64_t> positives_{0};
+      std::atomic<uint64_t> false_positives_{0};
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_PROCESSED_TX_FILTER_HPP
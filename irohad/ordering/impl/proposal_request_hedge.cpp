@@ -0,0 +1,66 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/proposal_request_hedge.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+  /// the percentile is multiplied by it, so the usual jitter of the
+  /// latencies does not make the requests given up
+  constexpr int kMargin = 2;
+}  // namespace
+
+namespace iroha {
+  namespace ordering {
+
+    constexpr size_t ProposalRequestHedge::kWindow;
+    constexpr size_t ProposalRequestHedge::kMinSamples;
+
+    ProposalRequestHedge::ProposalRequestHedge(double percentile,
+                                               DelayType min_delay)
+        : percentile_(std::min(std::max(percentile, 0.), 100.)),
+          min_delay_(min_delay) {
+      latencies_.reserve(kWindow);
+    }
+
+    void ProposalRequestHedge::observe(DelayType latency) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (latencies_.size() < kWindow) {
+        latencies_.push_back(latency);
+      } else {
+        latencies_[next_] = latency;
+      }
+      next_ = (next_ + 1) % kWindow;
+    }
+
+    ProposalRequestHedge::DelayType ProposalRequestHedge::delay(
+        DelayType timeout) const {
+      std::vector<DelayType> latencies;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (latencies_.size() < kMinSamples) {
+          return timeout;
+        }
+        latencies = latencies_;
+      }
+      auto rank = static_cast<size_t>(
+          std::ceil(percentile_ / 100. * latencies.size()));
+      auto nth = latencies.begin() + std::max<size_t>(rank, 1) - 1;
+      std::nth_element(latencies.begin(), nth, latencies.end());
+      return std::min(std::max(*nth * kMargin, min_delay_), timeout);
+    }
+
+    void ProposalRequestHedge::countGivenUp() {
+      given_up_.increment();
+    }
+
+    const Counter &ProposalRequestHedge::givenUp() const {
+      return given_up_;
+    }
+
+  }  // namespace ordering
+}  // namespace iroha
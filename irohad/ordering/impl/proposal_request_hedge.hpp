@@ -0,0 +1,79 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROPOSAL_REQUEST_HEDGE_HPP
+#define IROHA_PROPOSAL_REQUEST_HEDGE_HPP
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#include "common/counter.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Deadline of the proposal requests derived from the latencies of the
+     * recent successful requests. A request which takes much longer than
+     * the given percentile of them is given up before the timeout, so the
+     * consensus learns early that the issuer of the round is degraded and
+     * proceeds to the next reject round, whose issuer has packed its
+     * proposal already, instead of waiting for the whole timeout.
+     * Shared by the connections of all rounds, may be used from any thread
+     */
+    class ProposalRequestHedge {
+     public:
+      using DelayType = std::chrono::milliseconds;
+
+      /// number of the recent latencies the delay is derived from
+      static constexpr size_t kWindow = 100;
+
+      /// number of the latencies required to derive the delay
+      static constexpr size_t kMinSamples = 20;
+
+      /**
+       * @param percentile - percentile of the recent latencies, in (0, 100]
+       * @param min_delay - lower bound of the delay
+       */
+      ProposalRequestHedge(double percentile, DelayType min_delay);
+
+      /**
+       * Record the latency of a successful request
+       * @param latency - time from the start of the request to the response
+       */
+      void observe(DelayType latency);
+
+      /**
+       * @param timeout - timeout of the proposal requests
+       * @return time after which the request is given up: the percentile of
+       * the recent latencies multiplied by a margin, bounded by the minimal
+       * delay and the timeout. The timeout while there are not enough
+       * latencies
+       */
+      DelayType delay(DelayType timeout) const;
+
+      /// record the request given up before the timeout
+      void countGivenUp();
+
+      /// number of the requests given up before the timeout
+      const Counter &givenUp() const;
+
+     private:
+      const double percentile_;
+      const DelayType min_delay_;
+
+      mutable std::mutex mutex_;
+      /// ring of the recent latencies
+      std::vector<DelayType> latencies_;
+      size_t next_ = 0;
+
+      Counter given_up_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_PROPOSAL_REQUEST_HEDGE_HPP
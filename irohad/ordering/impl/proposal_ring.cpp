@@ -0,0 +1,72 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/proposal_ring.hpp"
+
+#include <algorithm>
+
+using namespace iroha::ordering;
+
+ProposalRing::ProposalRing(size_t capacity)
+    : slots_(std::max<size_t>(1, capacity)) {}
+
+boost::optional<std::shared_ptr<const ProposalRing::ProposalType>>
+ProposalRing::get(const consensus::Round &round) const {
+  for (auto &slot : slots_) {
+    auto entry = std::atomic_load(&slot);
+    if (entry and entry->round == round) {
+      return entry->proposal;
+    }
+  }
+  return boost::none;
+}
+
+void ProposalRing::set(const consensus::Round &round,
+                       std::shared_ptr<const ProposalType> proposal) {
+  // only the writer modifies the slots, so plain reads are consistent here
+  auto target = std::find_if(slots_.begin(), slots_.end(), [&](auto &slot) {
+    return slot and slot->round == round;
+  });
+  if (target == slots_.end()) {
+    target = std::find_if(slots_.begin(), slots_.end(), [](auto &slot) {
+      return not slot;
+    });
+  }
+  if (target == slots_.end()) {
+    target = std::min_element(
+        slots_.begin(), slots_.end(), [](auto &lhs, auto &rhs) {
+          return lhs->round < rhs->round;
+        });
+  }
+  std::atomic_store(
+      &*target,
+      std::shared_ptr<const Entry>(
+          std::make_shared<Entry>(Entry{round, std::move(proposal)})));
+}
+
+void ProposalRing::eraseBefore(
+    const consensus::Round &round,
+    size_t keep,
+    const std::function<void(const consensus::Round &)> &on_erase) {
+  std::vector<std::shared_ptr<const Entry> *> older;
+  for (auto &slot : slots_) {
+    if (slot and slot->round < round) {
+      older.push_back(&slot);
+    }
+  }
+  if (older.size() <= keep) {
+    return;
+  }
+
+  // latest rounds first
+  std::sort(older.begin(), older.end(), [](auto lhs, auto rhs) {
+    return (*rhs)->round < (*lhs)->round;
+  });
+  std::for_each(older.begin() + keep, older.end(), [&](auto slot) {
+    auto erased = (*slot)->round;
+    std::atomic_store(slot, std::shared_ptr<const Entry>());
+    on_erase(erased);
+  });
+}
@@ -0,0 +1,80 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROPOSAL_RING_HPP
+#define IROHA_PROPOSAL_RING_HPP
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "consensus/round.hpp"
+#include "ordering/on_demand_os_transport.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Fixed-capacity storage of proposals by round. Each slot is an atomic
+     * shared pointer to an immutable entry, so readers never block and
+     * never observe a partially written slot. A slot is found by scanning
+     * the ring, which is short: it only contains the live rounds.
+     * Writers are not synchronized with each other, only a single writer
+     * may modify the ring.
+     */
+    class ProposalRing {
+     public:
+      using ProposalType = transport::OdOsNotification::ProposalType;
+
+      /**
+       * @param capacity - max number of stored proposals
+       */
+      explicit ProposalRing(size_t capacity);
+
+      /**
+       * Get the proposal of the round. Lock-free, may be called from any
+       * thread
+       * @param round - round of the proposal
+       * @return proposal if it is stored
+       */
+      boost::optional<std::shared_ptr<const ProposalType>> get(
+          const consensus::Round &round) const;
+
+      /**
+       * Store the proposal, replacing the proposal of the same round. If
+       * there is no free slot, the proposal of the oldest round is evicted
+       * Note: method is not thread-safe, only the writer may call it
+       * @param round - round of the proposal
+       * @param proposal - proposal to store
+       */
+      void set(const consensus::Round &round,
+               std::shared_ptr<const ProposalType> proposal);
+
+      /**
+       * Remove proposals of the rounds less than the given one, except for
+       * the given number of the latest of them
+       * Note: method is not thread-safe, only the writer may call it
+       * @param round - first round which is always kept
+       * @param keep - number of kept rounds less than the given one
+       * @param on_erase - called with the round of each removed proposal
+       */
+      void eraseBefore(
+          const consensus::Round &round,
+          size_t keep,
+          const std::function<void(const consensus::Round &)> &on_erase);
+
+     private:
+      struct Entry {
+        consensus::Round round;
+        std::shared_ptr<const ProposalType> proposal;
+      };
+
+      std::vector<std::shared_ptr<const Entry>> slots_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_PROPOSAL_RING_HPP
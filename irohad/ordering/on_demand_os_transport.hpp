@@ -64,6 +64,14 @@ namespace iroha {
         virtual ~OdOsNotification() = default;
       };
 
+      /**
+       * Proposal created by the ordering service for the round
+       */
+      struct ProposalEvent {
+        consensus::Round round;
+        std::shared_ptr<const OdOsNotification::ProposalType> proposal;
+      };
+
       /**
        * Factory for creating communication interface to a specific peer
        */
@@ -43,6 +43,24 @@ namespace iroha {
       virtual boost::optional<RoundType> onProposalRequest(
           RoundType requested_round) = 0;
 
+      /**
+       * Get the limit of transactions for the proposal of the round
+       * @param round - round of the proposal to be packed
+       * @param max_transactions - configured limit of transactions
+       * @return limit of transactions not greater than max_transactions
+       */
+      virtual size_t proposalSizeLimit(RoundType round,
+                                       size_t max_transactions) {
+        return max_transactions;
+      }
+
+      /**
+       * Notify the strategy about packed proposal
+       * @param round - round of the proposal
+       * @param transactions - number of transactions in the proposal
+       */
+      virtual void onProposalPacked(RoundType round, size_t transactions) {}
+
       virtual ~ProposalCreationStrategy() = default;
     };
   }  // namespace ordering
@@ -5,6 +5,8 @@
 
 #include "pending_txs_storage/impl/pending_txs_storage_impl.hpp"
 
+#include <algorithm>
+
 #include "interfaces/transaction.hpp"
 #include "multi_sig_transactions/state/mst_state.hpp"
 
@@ -38,6 +40,38 @@ namespace iroha {
     prepared_batch_subscription_.unsubscribe();
     expired_batch_subscription_.unsubscribe();
     prepared_transactions_subscription_.unsubscribe();
+    batch_events_.get_subscriber().on_completed();
+  }
+
+  rxcpp::observable<PendingTransactionStorage::BatchEvent>
+  PendingTransactionStorageImpl::batchEvents() const {
+    return batch_events_.get_observable();
+  }
+
+  size_t PendingTransactionStorageImpl::memoryUsage() const {
+    // a node of a hash map or a list holds up to two pointers besides the
+    // element, the hashes keep their bytes on the heap
+    constexpr size_t kNodeBytes = 2 * sizeof(void *);
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    size_t usage = sizeof(*this)
+        + (storage_.bucket_count() + batches_.bucket_count()) * sizeof(void *);
+    for (const auto &account : storage_) {
+      const auto &batches = account.second;
+      usage += kNodeBytes + sizeof(account) + account.first.capacity()
+          + batches.batches.size() * (kNodeBytes + sizeof(SharedBatch))
+          + batches.index.bucket_count() * sizeof(void *);
+      for (const auto &entry : batches.index) {
+        usage += kNodeBytes + sizeof(entry) + entry.first.blob().size();
+      }
+    }
+    for (const auto &batch : batches_) {
+      usage += kNodeBytes + sizeof(batch) + batch.first.blob().size()
+          + batch.second.creators.capacity() * sizeof(AccountIdType);
+      for (const auto &creator : batch.second.creators) {
+        usage += creator.capacity();
+      }
+    }
+    return usage;
   }
 
   PendingTransactionStorageImpl::SharedTxsCollectionType
@@ -126,91 +160,90 @@ namespace iroha {
     std::unique_lock<std::shared_timed_mutex> lock(mutex_);
     updated_batches->iterateBatches([this](const auto &batch) {
       auto first_tx_hash = batch->transactions().front()->hash();
-      auto batch_creators = batchCreators(*batch);
-      auto batch_size = batch->transactions().size();
-      for (const auto &creator : batch_creators) {
-        auto account_batches_iterator = storage_.find(creator);
-        if (storage_.end() == account_batches_iterator) {
-          auto insertion_result = storage_.emplace(
-              creator, PendingTransactionStorageImpl::AccountBatches{});
-          BOOST_ASSERT(insertion_result.second);
-          account_batches_iterator = insertion_result.first;
+      auto batch_info_iterator = batches_.find(first_tx_hash);
+      if (batch_info_iterator != batches_.end()) {
+        // updating batch
+        for (const auto &creator : batch_info_iterator->second.creators) {
+          auto &account_batches = storage_[creator];
+          auto index_iterator = account_batches.index.find(first_tx_hash);
+          BOOST_ASSERT(index_iterator != account_batches.index.end());
+          *index_iterator->second = batch;
         }
+        batch_events_.get_subscriber().on_next(
+            BatchEvent{BatchEvent::Type::kUpdated,
+                       batch,
+                       batch_info_iterator->second.creators});
+        return;
+      }
 
-        auto &account_batches = account_batches_iterator->second;
-        auto index_iterator = account_batches.index.find(first_tx_hash);
-        if (index_iterator == account_batches.index.end()) {
-          // inserting the batch
-          account_batches.all_transactions_quantity += batch_size;
-          account_batches.batches.push_back(batch);
-          auto inserted_batch_iterator =
-              std::prev(account_batches.batches.end());
-          account_batches.index.emplace(first_tx_hash, inserted_batch_iterator);
-        } else {
-          // updating batch
-          auto &account_batch = index_iterator->second;
-          *account_batch = batch;
-        }
+      // inserting the batch
+      auto batch_creators = batchCreators(*batch);
+      uint64_t batch_size = batch->transactions().size();
+      for (const auto &creator : batch_creators) {
+        auto &account_batches = storage_[creator];
+        account_batches.all_transactions_quantity += batch_size;
+        account_batches.batches.push_back(batch);
+        auto inserted_batch_iterator = std::prev(account_batches.batches.end());
+        account_batches.index.emplace(first_tx_hash, inserted_batch_iterator);
       }
+      auto &batch_info =
+          batches_
+              .emplace(first_tx_hash,
+                       BatchInfo{{batch_creators.begin(), batch_creators.end()},
+                                 batch_size})
+              .first->second;
+      batch_events_.get_subscriber().on_next(
+          BatchEvent{BatchEvent::Type::kAdded, batch, batch_info.creators});
     });
   }
 
   inline void PendingTransactionStorageImpl::removeFromStorage(
-      const HashType &first_tx_hash,
-      const std::set<AccountIdType> &batch_creators,
-      uint64_t batch_size) {
-    // outer scope has to acquire unique lock over mutex_
-    for (const auto &creator : batch_creators) {
+      const HashType &first_tx_hash) {
+    auto batch_info_iterator = batches_.find(first_tx_hash);
+    if (batch_info_iterator == batches_.end()) {
+      return;
+    }
+    const auto &batch_info = batch_info_iterator->second;
+    SharedBatch batch;
+    for (const auto &creator : batch_info.creators) {
       auto account_batches_iterator = storage_.find(creator);
-      if (account_batches_iterator != storage_.end()) {
-        auto &account_batches = account_batches_iterator->second;
-        auto index_iterator = account_batches.index.find(first_tx_hash);
-        if (index_iterator != account_batches.index.end()) {
-          auto &batch_iterator = index_iterator->second;
-          BOOST_ASSERT(batch_iterator != account_batches.batches.end());
-          account_batches.batches.erase(batch_iterator);
-          account_batches.index.erase(index_iterator);
-          account_batches.all_transactions_quantity -= batch_size;
-        }
-        if (0 == account_batches.all_transactions_quantity) {
-          storage_.erase(account_batches_iterator);
-        }
+      BOOST_ASSERT(account_batches_iterator != storage_.end());
+      auto &account_batches = account_batches_iterator->second;
+      auto index_iterator = account_batches.index.find(first_tx_hash);
+      BOOST_ASSERT(index_iterator != account_batches.index.end());
+      batch = *index_iterator->second;
+      account_batches.batches.erase(index_iterator->second);
+      account_batches.index.erase(index_iterator);
+      account_batches.all_transactions_quantity -=
+          batch_info.transactions_quantity;
+      if (0 == account_batches.all_transactions_quantity) {
+        storage_.erase(account_batches_iterator);
       }
     }
+    batch_events_.get_subscriber().on_next(BatchEvent{
+        BatchEvent::Type::kRemoved, std::move(batch), batch_info.creators});
+    batches_.erase(batch_info_iterator);
   }
 
   void PendingTransactionStorageImpl::removeBatch(const SharedBatch &batch) {
-    auto creators = batchCreators(*batch);
     auto first_tx_hash = batch->transactions().front()->hash();
-    auto batch_size = batch->transactions().size();
     std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-    removeFromStorage(first_tx_hash, creators, batch_size);
+    removeFromStorage(first_tx_hash);
   }
 
   void PendingTransactionStorageImpl::removeBatch(
       const PreparedTransactionDescriptor &prepared_transaction) {
-    boost::optional<std::set<AccountIdType>> creators = boost::none;
-    boost::optional<uint64_t> batch_size = boost::none;
     auto &creator_id = prepared_transaction.first;
     auto &first_transaction_hash = prepared_transaction.second;
-    {
-      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-      auto account_batches_iterator = storage_.find(creator_id);
-      if (account_batches_iterator != storage_.end()) {
-        auto &account_batches = account_batches_iterator->second;
-        auto index_iterator =
-            account_batches.index.find(first_transaction_hash);
-        if (index_iterator != account_batches.index.end()) {
-          auto &batch_iterator = index_iterator->second;
-          BOOST_ASSERT(batch_iterator != account_batches.batches.end());
-          creators = batchCreators(**batch_iterator);
-          batch_size = boost::size((*batch_iterator)->transactions());
-        }
-      }
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    auto batch_info_iterator = batches_.find(first_transaction_hash);
+    if (batch_info_iterator == batches_.end()) {
+      return;
     }
-    if (creators and batch_size) {
-      std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-      removeFromStorage(first_transaction_hash, *creators, *batch_size);
+    const auto &creators = batch_info_iterator->second.creators;
+    if (std::find(creators.begin(), creators.end(), creator_id)
+        != creators.end()) {
+      removeFromStorage(first_transaction_hash);
     }
   }
 
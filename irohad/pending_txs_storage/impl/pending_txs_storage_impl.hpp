@@ -10,6 +10,7 @@
 #include <set>
 #include <shared_mutex>
 #include <unordered_map>
+#include <vector>
 
 #include <rxcpp/rx-lite.hpp>
 #include "interfaces/iroha_internal/transaction_batch.hpp"
@@ -50,6 +51,10 @@ namespace iroha {
         const boost::optional<shared_model::interface::types::HashType>
             &first_tx_hash) const override;
 
+    rxcpp::observable<BatchEvent> batchEvents() const override;
+
+    size_t memoryUsage() const override;
+
    private:
     void updatedBatchesHandler(const SharedState &updated_batches);
 
@@ -57,9 +62,12 @@ namespace iroha {
 
     void removeBatch(const PreparedTransactionDescriptor &prepared_transaction);
 
-    void removeFromStorage(const HashType &first_tx_hash,
-                           const std::set<AccountIdType> &batch_creators,
-                           uint64_t batch_size);
+    /**
+     * Remove the batch from the storages of all its creators, outer scope has
+     * to acquire unique lock over mutex_
+     * @param first_tx_hash - hash of the first transaction of the batch
+     */
+    void removeFromStorage(const HashType &first_tx_hash);
 
     static std::set<AccountIdType> batchCreators(const TransactionBatch &batch);
 
@@ -102,6 +110,26 @@ namespace iroha {
      * Maps account names with its storages of pending transactions or batches.
      */
     std::unordered_map<AccountIdType, AccountBatches> storage_;
+
+    /**
+     * The creators and the number of transactions of a stored batch, which
+     * are computed once on the insertion of the batch
+     */
+    struct BatchInfo {
+      std::vector<AccountIdType> creators;
+      uint64_t transactions_quantity;
+    };
+
+    /**
+     * Maps the hashes of the first transactions of the stored batches with
+     * their creators
+     */
+    std::unordered_map<HashType, BatchInfo, HashType::Hasher> batches_;
+
+    /**
+     * Changes of the batches, emitted under the unique lock over mutex_
+     */
+    rxcpp::subjects::subject<BatchEvent> batch_events_;
   };
 
 }  // namespace iroha
@@ -6,12 +6,22 @@
 #ifndef IROHA_PENDING_TXS_STORAGE_HPP
 #define IROHA_PENDING_TXS_STORAGE_HPP
 
+#include <memory>
+#include <vector>
+
 #include <boost/optional.hpp>
+#include <rxcpp/rx-lite.hpp>
 #include "common/result.hpp"
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "interfaces/query_responses/pending_transactions_page_response.hpp"
 
+namespace shared_model {
+  namespace interface {
+    class TransactionBatch;
+  }  // namespace interface
+}  // namespace shared_model
+
 namespace iroha {
 
   /**
@@ -72,6 +82,30 @@ namespace iroha {
         const boost::optional<shared_model::interface::types::HashType>
             &first_tx_hash) const = 0;
 
+    /**
+     * Change of a pending batch of the storage
+     */
+    struct BatchEvent {
+      enum class Type { kAdded, kUpdated, kRemoved };
+
+      Type type;
+      std::shared_ptr<shared_model::interface::TransactionBatch> batch;
+      /// creators of the transactions of the batch
+      std::vector<shared_model::interface::types::AccountIdType> creators;
+    };
+
+    /**
+     * @return the changes of the pending batches, which are emitted in the
+     * order they are applied to the storage
+     */
+    virtual rxcpp::observable<BatchEvent> batchEvents() const = 0;
+
+    /**
+     * @return approximate memory taken by the storage in bytes, besides the
+     * batches, which are shared with the MST state
+     */
+    virtual size_t memoryUsage() const = 0;
+
     virtual ~PendingTransactionStorage() = default;
   };
 
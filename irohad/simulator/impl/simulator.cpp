@@ -5,12 +5,30 @@
 
 #include "simulator/impl/simulator.hpp"
 
+#include <chrono>
+#include <future>
+
 #include <boost/range/adaptor/transformed.hpp>
 #include "ametsuchi/command_executor.hpp"
 #include "common/bind.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
 #include "logger/logger.hpp"
+#include "maintenance/tracing.hpp"
+
+namespace {
+  /// number of buckets of the phase times from 1 ms to about 1 min
+  constexpr size_t kTimeBuckets = 17;
+  /// blocks with smaller payloads are hashed and signed on one thread
+  constexpr size_t kMinConcurrentHashBytes = 64 * 1024;
+
+  /// @return milliseconds elapsed since the given time
+  uint64_t millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+  }
+}  // namespace
 
 namespace iroha {
   namespace simulator {
@@ -23,7 +41,10 @@ namespace iroha {
         std::shared_ptr<CryptoSignerType> crypto_signer,
         std::unique_ptr<shared_model::interface::UnsafeBlockFactory>
             block_factory,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        rxcpp::observable<SpeculativeProposal> speculative_proposals,
+        rxcpp::observable<CommittedBlock> committed_blocks,
+        rxcpp::observe_on_one_worker speculation_coordination)
         : command_executor_(std::move(command_executor)),
           notifier_(notifier_lifetime_),
           block_notifier_(block_notifier_lifetime_),
@@ -31,12 +52,18 @@ namespace iroha {
           ametsuchi_factory_(std::move(factory)),
           crypto_signer_(std::move(crypto_signer)),
           block_factory_(std::move(block_factory)),
-          log_(std::move(log)) {
+          log_(std::move(log)),
+          speculation_notifier_(speculation_notifier_lifetime_),
+          validation_time_(Histogram::exponentialBounds(1, 2, kTimeBuckets)),
+          block_creation_time_(
+              Histogram::exponentialBounds(1, 2, kTimeBuckets)) {
       ordering_gate->onProposal().subscribe(
           proposal_subscription_, [this](const network::OrderingEvent &event) {
             if (event.proposal) {
-              auto validated_proposal_and_errors =
-                  this->processProposal(*getProposalUnsafe(event));
+              auto validated_proposal_and_errors = this->processRoundProposal(
+                  *getProposalUnsafe(event),
+                  event.round,
+                  event.ledger_state->top_block_info.top_hash);
 
               notifier_.get_subscriber().on_next(
                   VerifiedProposalCreatorEvent{validated_proposal_and_errors,
@@ -66,9 +93,34 @@ namespace iroha {
                   boost::none, event.round, event.ledger_state});
             }
           });
+
+      // the validation must not delay the commit which starts it
+      speculation_notifier_.get_observable()
+          .observe_on(speculation_coordination)
+          .subscribe(speculation_subscription_,
+                     [this](const SpeculativeProposal &proposal) {
+                       this->speculate(proposal);
+                     });
+      speculative_proposals.subscribe(
+          speculative_proposal_subscription_,
+          [this](SpeculativeProposal proposal) {
+            std::lock_guard<std::mutex> lock(speculation_mutex_);
+            awaiting_speculation_ = std::move(proposal);
+            this->startSpeculation();
+          });
+      committed_blocks.subscribe(
+          commit_subscription_, [this](const CommittedBlock &block) {
+            std::lock_guard<std::mutex> lock(speculation_mutex_);
+            last_committed_hash_ = block->hash();
+            this->startSpeculation();
+          });
     }
 
     Simulator::~Simulator() {
+      commit_subscription_.unsubscribe();
+      speculative_proposal_subscription_.unsubscribe();
+      speculation_subscription_.unsubscribe();
+      speculation_notifier_lifetime_.unsubscribe();
       notifier_lifetime_.unsubscribe();
       block_notifier_lifetime_.unsubscribe();
       proposal_subscription_.unsubscribe();
@@ -83,15 +135,77 @@ namespace iroha {
     std::shared_ptr<validation::VerifiedProposalAndErrors>
     Simulator::processProposal(
         const shared_model::interface::Proposal &proposal) {
+      std::lock_guard<std::mutex> lock(validation_mutex_);
+      return validate(proposal);
+    }
+
+    std::shared_ptr<validation::VerifiedProposalAndErrors>
+    Simulator::processRoundProposal(
+        const shared_model::interface::Proposal &proposal,
+        const consensus::Round &round,
+        const shared_model::crypto::Hash &top_hash) {
+      std::lock_guard<std::mutex> lock(validation_mutex_);
+      last_round_ = round;
+      auto speculation = std::move(speculation_);
+      speculation_ = boost::none;
+      if (speculation and speculation->round == round
+          and speculation->top_hash == top_hash
+          and speculation->proposal_hash == proposal.hash()) {
+        log_->info("reuse proposal validated before {}", round);
+        speculations_reused_.increment();
+        return std::move(speculation->result);
+      }
+      return validate(proposal);
+    }
+
+    void Simulator::startSpeculation() {
+      if (awaiting_speculation_ and last_committed_hash_
+          and awaiting_speculation_->top_hash == *last_committed_hash_) {
+        speculation_notifier_.get_subscriber().on_next(
+            *std::move(awaiting_speculation_));
+        awaiting_speculation_ = boost::none;
+      }
+    }
+
+    void Simulator::speculate(const SpeculativeProposal &proposal) {
+      std::lock_guard<std::mutex> lock(validation_mutex_);
+      // the round has already started with its own validation
+      if (last_round_ and not(*last_round_ < proposal.round)) {
+        return;
+      }
+      log_->info("validate proposal of {} before the round", proposal.round);
+      speculation_ = Speculation{proposal.proposal->hash(),
+                                 proposal.round,
+                                 proposal.top_hash,
+                                 validate(*proposal.proposal)};
+    }
+
+    std::shared_ptr<validation::VerifiedProposalAndErrors>
+    Simulator::validate(const shared_model::interface::Proposal &proposal) {
       log_->info("process proposal");
+      const auto start = std::chrono::steady_clock::now();
+      iroha::tracing::ScopedSpan span("simulator.validate");
+      if (span) {
+        span.setAttribute("height", std::to_string(proposal.height()));
+        for (const auto &tx : proposal.transactions()) {
+          span.addTransaction(tx.hash());
+        }
+      }
 
       auto storage = ametsuchi_factory_->createTemporaryWsv(command_executor_);
 
       std::shared_ptr<iroha::validation::VerifiedProposalAndErrors>
           validated_proposal_and_errors =
               validator_->validate(proposal, *storage);
-      ametsuchi_factory_->prepareBlock(std::move(storage));
+      std::vector<shared_model::interface::types::HashType> transaction_hashes;
+      for (const auto &transaction :
+           validated_proposal_and_errors->verified_proposal->transactions()) {
+        transaction_hashes.push_back(transaction.hash());
+      }
+      ametsuchi_factory_->prepareBlock(std::move(storage),
+                                       std::move(transaction_hashes));
 
+      validation_time_.observe(millisecondsSince(start));
       return validated_proposal_and_errors;
     }
 
@@ -101,6 +215,7 @@ namespace iroha {
             &verified_proposal_and_errors,
         const TopBlockInfo &top_block_info) {
       log_->info("process verified proposal");
+      const auto start = std::chrono::steady_clock::now();
 
       const auto &proposal = verified_proposal_and_errors->verified_proposal;
       std::vector<shared_model::crypto::Hash> rejected_hashes;
@@ -114,8 +229,17 @@ namespace iroha {
                                             proposal->createdTime(),
                                             proposal->transactions(),
                                             rejected_hashes);
-      crypto_signer_->sign(*block);
+      if (block->payload().size() >= kMinConcurrentHashBytes) {
+        // both the hash and the signature read the payload only
+        auto hashed =
+            std::async(std::launch::async, [&block] { block->hash(); });
+        crypto_signer_->sign(*block);
+        hashed.get();
+      } else {
+        crypto_signer_->sign(*block);
+      }
 
+      block_creation_time_.observe(millisecondsSince(start));
       return block;
     }
 
@@ -123,5 +247,17 @@ namespace iroha {
       return block_notifier_.get_observable();
     }
 
+    const Histogram &Simulator::validationTime() const {
+      return validation_time_;
+    }
+
+    const Histogram &Simulator::blockCreationTime() const {
+      return block_creation_time_;
+    }
+
+    const Counter &Simulator::speculationsReused() const {
+      return speculations_reused_;
+    }
+
   }  // namespace simulator
 }  // namespace iroha
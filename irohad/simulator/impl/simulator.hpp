@@ -9,9 +9,15 @@
 #include "simulator/block_creator.hpp"
 #include "simulator/verified_proposal_creator.hpp"
 
+#include <mutex>
+
 #include <boost/optional.hpp>
 #include <rxcpp/rx-lite.hpp>
 #include "ametsuchi/temporary_factory.hpp"
+#include "common/counter.hpp"
+#include "common/histogram.hpp"
+#include "common/named_thread.hpp"
+#include "consensus/round.hpp"
 #include "cryptography/crypto_provider/abstract_crypto_model_signer.hpp"
 #include "interfaces/iroha_internal/unsafe_block_factory.hpp"
 #include "logger/logger_fwd.hpp"
@@ -30,6 +36,26 @@ namespace iroha {
       using CryptoSignerType = shared_model::crypto::AbstractCryptoModelSigner<
           shared_model::interface::Block>;
 
+      using CommittedBlock =
+          std::shared_ptr<const shared_model::interface::Block>;
+
+      /// proposal of the round which follows the block being committed
+      struct SpeculativeProposal {
+        std::shared_ptr<const shared_model::interface::Proposal> proposal;
+        consensus::Round round;
+        /// hash of the block which the proposal follows
+        shared_model::interface::types::HashType top_hash;
+      };
+
+      /**
+       * @param speculative_proposals - proposals of the next rounds, which
+       * are validated as soon as the block they follow is committed, before
+       * their round starts. The result is reused if the round starts with the
+       * same proposal on top of the same block, and discarded otherwise
+       * @param committed_blocks - blocks committed to the storage
+       * @param speculation_coordination - thread of the speculative
+       * validation
+       */
       Simulator(
           // TODO IR-598 mboldyrev 2019.08.10: remove command_executor from
           // Simulator
@@ -40,7 +66,13 @@ namespace iroha {
           std::shared_ptr<CryptoSignerType> crypto_signer,
           std::unique_ptr<shared_model::interface::UnsafeBlockFactory>
               block_factory,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          rxcpp::observable<SpeculativeProposal> speculative_proposals =
+              rxcpp::observable<>::never<SpeculativeProposal>(),
+          rxcpp::observable<CommittedBlock> committed_blocks =
+              rxcpp::observable<>::never<CommittedBlock>(),
+          rxcpp::observe_on_one_worker speculation_coordination =
+              observeOnNamedThread("speculation"));
 
       ~Simulator() override;
 
@@ -58,7 +90,44 @@ namespace iroha {
 
       rxcpp::observable<BlockCreatorEvent> onBlock() override;
 
+      /// time in ms of the stateful validation of proposals
+      const Histogram &validationTime() const;
+
+      /// time in ms of the creation of blocks from verified proposals
+      const Histogram &blockCreationTime() const;
+
+      /// proposals validated before their round and reused by the round
+      const Counter &speculationsReused() const;
+
      private:
+      /// validated proposal of a round which has not started yet
+      struct Speculation {
+        shared_model::interface::types::HashType proposal_hash;
+        consensus::Round round;
+        shared_model::interface::types::HashType top_hash;
+        std::shared_ptr<validation::VerifiedProposalAndErrors> result;
+      };
+
+      /**
+       * Validate the proposal of the round, or take the result of its
+       * speculative validation if it was made on top of the same block
+       */
+      std::shared_ptr<validation::VerifiedProposalAndErrors>
+      processRoundProposal(const shared_model::interface::Proposal &proposal,
+                           const consensus::Round &round,
+                           const shared_model::crypto::Hash &top_hash);
+
+      /// validate the proposal, validation_mutex_ must be held
+      std::shared_ptr<validation::VerifiedProposalAndErrors> validate(
+          const shared_model::interface::Proposal &proposal);
+
+      /// start the validation of the awaiting speculative proposal if the
+      /// block it follows is committed, speculation_mutex_ must be held
+      void startSpeculation();
+
+      /// validate the proposal before its round starts
+      void speculate(const SpeculativeProposal &proposal);
+
       // internal
       std::shared_ptr<iroha::ametsuchi::CommandExecutor> command_executor_;
 
@@ -77,6 +146,28 @@ namespace iroha {
           block_factory_;
 
       logger::LoggerPtr log_;
+
+      /// serializes the validations, which share the command executor
+      std::mutex validation_mutex_;
+      /// the latest round whose proposal is validated
+      boost::optional<consensus::Round> last_round_;
+      boost::optional<Speculation> speculation_;
+
+      std::mutex speculation_mutex_;
+      /// speculative proposal awaiting the commit of the block it follows
+      boost::optional<SpeculativeProposal> awaiting_speculation_;
+      boost::optional<shared_model::interface::types::HashType>
+          last_committed_hash_;
+      rxcpp::composite_subscription speculation_notifier_lifetime_;
+      rxcpp::subjects::subject<SpeculativeProposal> speculation_notifier_;
+      rxcpp::composite_subscription speculative_proposal_subscription_;
+      rxcpp::composite_subscription commit_subscription_;
+      rxcpp::composite_subscription speculation_subscription_;
+
+      // ------|Metrics|------
+      Histogram validation_time_;
+      Histogram block_creation_time_;
+      Counter speculations_reused_;
     };
   }  // namespace simulator
 }  // namespace iroha
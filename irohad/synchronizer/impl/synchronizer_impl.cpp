@@ -5,17 +5,121 @@
 
 #include "synchronizer/impl/synchronizer_impl.hpp"
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <utility>
+#include <vector>
 
+#include <boost/range/distance.hpp>
+#include <boost/range/iterator_range_core.hpp>
 #include <rxcpp/operators/rx-tap.hpp>
 #include "ametsuchi/block_query_factory.hpp"
 #include "ametsuchi/command_executor.hpp"
 #include "ametsuchi/mutable_storage.hpp"
 #include "common/bind.hpp"
+#include "common/thread_name.hpp"
 #include "common/visitor.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "logger/logger.hpp"
 
+namespace {
+  /// number of buckets of the phase times from 1 ms to about 1 min
+  constexpr size_t kTimeBuckets = 17;
+
+  /// @return milliseconds elapsed since the given time
+  uint64_t millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+  }
+
+  using BlockPtr = std::shared_ptr<shared_model::interface::Block>;
+
+  /**
+   * Bounded buffer of the downloaded blocks. The block stream is read on a
+   * separate thread, so the download goes on while the blocks taken from the
+   * buffer are applied
+   */
+  class PrefetchedBlocks {
+   public:
+    PrefetchedBlocks(rxcpp::observable<BlockPtr> blocks,
+                     size_t capacity,
+                     std::atomic<size_t> &occupancy)
+        : capacity_(capacity), occupancy_(occupancy) {
+      reader_ = std::thread([this, blocks] {
+        iroha::setThreadName("sync-prefetch");
+        blocks.subscribe(lifetime_,
+                         [this](BlockPtr block) {
+                           std::unique_lock<std::mutex> lock(mutex_);
+                           space_.wait(lock, [this] {
+                             return stopped_ or blocks_.size() < capacity_;
+                           });
+                           if (stopped_) {
+                             lifetime_.unsubscribe();
+                             return;
+                           }
+                           blocks_.push_back(std::move(block));
+                           occupancy_ = blocks_.size();
+                           lock.unlock();
+                           available_.notify_one();
+                         },
+                         [this](std::exception_ptr) { finish(); },
+                         [this] { finish(); });
+      });
+    }
+
+    ~PrefetchedBlocks() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+      }
+      space_.notify_all();
+      lifetime_.unsubscribe();
+      reader_.join();
+      occupancy_ = 0;
+    }
+
+    /// @return the next downloaded block, or nullptr after the last one
+    BlockPtr next() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      available_.wait(lock,
+                      [this] { return finished_ or not blocks_.empty(); });
+      if (blocks_.empty()) {
+        return nullptr;
+      }
+      auto block = std::move(blocks_.front());
+      blocks_.pop_front();
+      occupancy_ = blocks_.size();
+      lock.unlock();
+      space_.notify_one();
+      return block;
+    }
+
+   private:
+    void finish() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finished_ = true;
+      }
+      available_.notify_one();
+    }
+
+    const size_t capacity_;
+    std::atomic<size_t> &occupancy_;
+    std::mutex mutex_;
+    std::condition_variable space_;
+    std::condition_variable available_;
+    std::deque<BlockPtr> blocks_;
+    bool stopped_ = false;
+    bool finished_ = false;
+    rxcpp::composite_subscription lifetime_;
+    std::thread reader_;
+  };
+}  // namespace
+
 namespace iroha {
   namespace synchronizer {
 
@@ -26,14 +130,27 @@ namespace iroha {
         std::shared_ptr<ametsuchi::MutableFactory> mutable_factory,
         std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
         std::shared_ptr<network::BlockLoader> block_loader,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        size_t prefetched_blocks,
+        shared_model::interface::types::HeightType range_download_threshold,
+        std::shared_ptr<network::BlockFetcher> block_fetcher,
+        size_t commit_blocks,
+        size_t commit_transactions)
         : command_executor_(std::move(command_executor)),
           validator_(std::move(validator)),
           mutable_factory_(std::move(mutable_factory)),
           block_query_factory_(std::move(block_query_factory)),
           block_loader_(std::move(block_loader)),
+          block_fetcher_(std::move(block_fetcher)),
+          prefetch_capacity_(prefetched_blocks),
+          range_download_threshold_(range_download_threshold),
+          commit_blocks_(commit_blocks),
+          commit_transactions_(commit_transactions),
           notifier_(notifier_lifetime_),
-          log_(std::move(log)) {
+          log_(std::move(log)),
+          commit_time_(Histogram::exponentialBounds(1, 2, kTimeBuckets)),
+          synchronization_time_(
+              Histogram::exponentialBounds(1, 2, kTimeBuckets)) {
       consensus_gate->onOutcome().subscribe(
           subscription_, [this](consensus::GateObject object) {
             this->processOutcome(object);
@@ -87,41 +204,143 @@ namespace iroha {
         const shared_model::interface::types::HeightType start_height,
         const shared_model::interface::types::HeightType target_height,
         const PublicKeysRange &public_keys) {
+      Progress progress{start_height, nullptr};
+      if (block_fetcher_) {
+        if (auto blocks = block_fetcher_->take(start_height, target_height)) {
+          auto commit_result = commitDownloadedBlocks(
+              rxcpp::observable<>::iterate(std::move(*blocks)),
+              progress,
+              target_height);
+          if (commit_result) {
+            fetched_commits_.increment();
+            return std::move(*commit_result);
+          }
+          log_->warn("Failed to commit the fetched blocks");
+        }
+      }
       // TODO andrei 17.10.18 IR-1763 Add delay strategy for loading blocks
+      if (boost::distance(public_keys) > 1
+          and target_height - progress.height >= range_download_threshold_) {
+        auto commit_result = commitDownloadedBlocks(
+            block_loader_->retrieveBlockRanges(
+                progress.height,
+                target_height,
+                boost::copy_range<shared_model::interface::types::
+                                      PublicKeyCollectionType>(public_keys)),
+            progress,
+            target_height);
+        if (commit_result) {
+          return std::move(*commit_result);
+        }
+        log_->warn("Failed to download blocks from several peers at once");
+      }
       for (const auto &public_key : public_keys) {
-        auto storage = getStorage();
-
-        shared_model::interface::types::HeightType my_height = start_height;
-        auto network_chain =
-            block_loader_->retrieveBlocks(start_height, public_key)
-                .tap([&my_height](
-                         const std::shared_ptr<shared_model::interface::Block>
-                             &block) { my_height = block->height(); });
-
-        if (validator_->validateAndApply(network_chain, *storage)
-            and my_height >= target_height) {
-          return mutable_factory_->commit(std::move(storage));
+        auto commit_result = commitDownloadedBlocks(
+            block_loader_->retrieveBlocks(progress.height, public_key),
+            progress,
+            target_height);
+        if (commit_result) {
+          return std::move(*commit_result);
         }
       }
+      if (progress.ledger_state) {
+        log_->warn("Synchronized up to the block {} of {}",
+                   progress.height,
+                   target_height);
+        return expected::makeValue(std::move(progress.ledger_state));
+      }
       return expected::makeError(
           "Failed to download and commit blocks from given peers");
     }
 
+    boost::optional<ametsuchi::CommitResult>
+    SynchronizerImpl::commitDownloadedBlocks(
+        rxcpp::observable<BlockPtr> blocks,
+        Progress &progress,
+        const shared_model::interface::types::HeightType target_height) {
+      const auto start = std::chrono::steady_clock::now();
+      const auto start_height = progress.height;
+      auto downloaded_chain = blocks.tap(
+          [this](const BlockPtr &) { downloaded_blocks_.increment(); });
+      PrefetchedBlocks prefetched(
+          downloaded_chain, prefetch_capacity_, prefetched_blocks_);
+      bool exhausted = false;
+      do {
+        // the blocks taken from the buffer are kept till the chunk is
+        // committed, so every subscription to the chunk gets all of them
+        std::vector<BlockPtr> chunk;
+        auto chunk_chain =
+            rxcpp::observable<>::create<BlockPtr>([&](auto subscriber) {
+              size_t transactions = 0;
+              for (size_t i = 0; subscriber.is_subscribed(); ++i) {
+                if (i == chunk.size()) {
+                  if (exhausted or i >= commit_blocks_
+                      or transactions >= commit_transactions_) {
+                    break;
+                  }
+                  auto block = prefetched.next();
+                  if (not block) {
+                    exhausted = true;
+                    break;
+                  }
+                  chunk.push_back(std::move(block));
+                }
+                transactions += chunk[i]->txsNumber();
+                subscriber.on_next(chunk[i]);
+              }
+              subscriber.on_completed();
+            })
+                .tap([this, start_height, start](const BlockPtr &block) {
+                  const auto elapsed = std::chrono::duration<double>(
+                                           std::chrono::steady_clock::now()
+                                           - start)
+                                           .count();
+                  if (elapsed > 0) {
+                    synchronization_rate_ =
+                        (block->height() - start_height) / elapsed;
+                  }
+                });
+
+        auto storage = getStorage();
+        if (not validator_->validateAndApply(chunk_chain, *storage)) {
+          return boost::none;
+        }
+        if (chunk.empty()) {
+          break;
+        }
+        auto commit_result = mutable_factory_->commit(std::move(storage));
+        if (expected::hasError(commit_result)) {
+          return std::move(commit_result);
+        }
+        progress.height = chunk.back()->height();
+        progress.ledger_state =
+            *expected::resultToOptionalValue(std::move(commit_result));
+      } while (not exhausted);
+
+      if (progress.height >= target_height) {
+        return expected::makeValue(progress.ledger_state);
+      }
+      return boost::none;
+    }
+
     std::unique_ptr<ametsuchi::MutableStorage> SynchronizerImpl::getStorage() {
       return mutable_factory_->createMutableStorage(command_executor_);
     }
 
     void SynchronizerImpl::processNext(const consensus::PairValid &msg) {
       log_->info("at handleNext");
+      const auto start = std::chrono::steady_clock::now();
       const auto notify =
-          [this,
-           &msg](std::shared_ptr<const iroha::LedgerState> &&ledger_state) {
+          [this, &msg, start](
+              std::shared_ptr<const iroha::LedgerState> &&ledger_state) {
+            commit_time_.observe(millisecondsSince(start));
             this->notifier_.get_subscriber().on_next(
                 SynchronizationEvent{SynchronizationOutcomeType::kCommit,
                                      msg.round,
                                      std::move(ledger_state)});
           };
-      const bool committed_prepared = mutable_factory_->preparedCommitEnabled()
+      const bool committed_prepared =
+          mutable_factory_->preparedCommitEnabled(*msg.block)
           and mutable_factory_->commitPrepared(msg.block).match(
                   [&notify](auto &&value) {
                     notify(std::move(value.value));
@@ -132,7 +351,10 @@ namespace iroha {
                                       error.error);
                     return false;
                   });
-      if (not committed_prepared) {
+      if (committed_prepared) {
+        prepared_commits_.increment();
+      } else {
+        applied_commits_.increment();
         auto storage = getStorage();
         if (storage->apply(msg.block)) {
           mutable_factory_->commit(std::move(storage))
@@ -152,11 +374,13 @@ namespace iroha {
         const consensus::Synchronizable &msg,
         shared_model::interface::types::HeightType required_height) {
       log_->info("at handleDifferent");
+      const auto start = std::chrono::steady_clock::now();
 
       auto commit_result = downloadAndCommitMissingBlocks(
           msg.ledger_state->top_block_info.height,
           required_height,
           msg.public_keys);
+      synchronization_time_.observe(millisecondsSince(start));
 
       commit_result.match(
           [this, &msg](auto &value) {
@@ -180,6 +404,38 @@ namespace iroha {
       return notifier_.get_observable();
     }
 
+    const Histogram &SynchronizerImpl::commitTime() const {
+      return commit_time_;
+    }
+
+    const Counter &SynchronizerImpl::preparedCommits() const {
+      return prepared_commits_;
+    }
+
+    const Counter &SynchronizerImpl::appliedCommits() const {
+      return applied_commits_;
+    }
+
+    const Histogram &SynchronizerImpl::synchronizationTime() const {
+      return synchronization_time_;
+    }
+
+    const Counter &SynchronizerImpl::downloadedBlocks() const {
+      return downloaded_blocks_;
+    }
+
+    const Counter &SynchronizerImpl::fetchedCommits() const {
+      return fetched_commits_;
+    }
+
+    size_t SynchronizerImpl::prefetchedBlocks() const {
+      return prefetched_blocks_;
+    }
+
+    double SynchronizerImpl::synchronizationRate() const {
+      return synchronization_rate_;
+    }
+
     SynchronizerImpl::~SynchronizerImpl() {
       notifier_lifetime_.unsubscribe();
       subscription_.unsubscribe();
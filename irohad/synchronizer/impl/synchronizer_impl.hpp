@@ -8,12 +8,18 @@
 
 #include "synchronizer/synchronizer.hpp"
 
+#include <atomic>
+
+#include <boost/optional.hpp>
 #include <rxcpp/rx-lite.hpp>
 #include "ametsuchi/commit_result.hpp"
 #include "ametsuchi/mutable_factory.hpp"
 #include "ametsuchi/peer_query_factory.hpp"
+#include "common/counter.hpp"
+#include "common/histogram.hpp"
 #include "logger/logger_fwd.hpp"
 #include "network/block_loader.hpp"
+#include "network/impl/block_fetcher.hpp"
 #include "network/consensus_gate.hpp"
 #include "validation/chain_validator.hpp"
 
@@ -28,6 +34,29 @@ namespace iroha {
 
     class SynchronizerImpl : public Synchronizer {
      public:
+      /// maximal number of the downloaded blocks waiting to be applied
+      static constexpr size_t kDefaultPrefetchedBlocks = 256;
+
+      /// minimal number of the missing blocks downloaded from several peers
+      static constexpr shared_model::interface::types::HeightType
+          kDefaultRangeDownloadThreshold = 1000;
+
+      /// maximal number of the downloaded blocks committed at once
+      static constexpr size_t kDefaultCommitBlocks = 500;
+
+      /// number of the transactions of the downloaded blocks after which
+      /// they are committed
+      static constexpr size_t kDefaultCommitTransactions = 50000;
+
+      /**
+       * @param block_fetcher - downloads started by the consensus gate,
+       * whose blocks are taken before requesting the peers. Optional
+       * @param commit_blocks - maximal number of the downloaded blocks
+       * applied to one mutable storage and committed at once
+       * @param commit_transactions - number of the transactions of the
+       * downloaded blocks applied to one mutable storage after which they
+       * are committed
+       */
       SynchronizerImpl(
           std::unique_ptr<iroha::ametsuchi::CommandExecutor> command_executor,
           std::shared_ptr<network::ConsensusGate> consensus_gate,
@@ -35,31 +64,87 @@ namespace iroha {
           std::shared_ptr<ametsuchi::MutableFactory> mutable_factory,
           std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
           std::shared_ptr<network::BlockLoader> block_loader,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          size_t prefetched_blocks = kDefaultPrefetchedBlocks,
+          shared_model::interface::types::HeightType range_download_threshold =
+              kDefaultRangeDownloadThreshold,
+          std::shared_ptr<network::BlockFetcher> block_fetcher = nullptr,
+          size_t commit_blocks = kDefaultCommitBlocks,
+          size_t commit_transactions = kDefaultCommitTransactions);
 
       ~SynchronizerImpl() override;
 
       void processOutcome(consensus::GateObject object) override;
       rxcpp::observable<SynchronizationEvent> on_commit_chain() override;
 
+      /// time in ms of applying and committing the agreed block
+      const Histogram &commitTime() const;
+
+      /// agreed blocks committed from the state prepared by the validation
+      const Counter &preparedCommits() const;
+
+      /// agreed blocks whose transactions were applied again to be committed
+      const Counter &appliedCommits() const;
+
+      /// time in ms of downloading and committing the missing blocks
+      const Histogram &synchronizationTime() const;
+
+      /// blocks downloaded during the synchronization
+      const Counter &downloadedBlocks() const;
+
+      /// synchronizations which committed the blocks fetched in advance
+      const Counter &fetchedCommits() const;
+
+      /// downloaded blocks waiting to be applied
+      size_t prefetchedBlocks() const;
+
+      /// blocks per second applied by the current or the last synchronization
+      double synchronizationRate() const;
+
      private:
       using PublicKeysRange =
           boost::any_range<shared_model::interface::types::PubkeyType,
                            boost::forward_traversal_tag,
                            const shared_model::interface::types::PubkeyType &>;
+
+      /// blocks committed by the synchronization so far
+      struct Progress {
+        /// top block height
+        shared_model::interface::types::HeightType height;
+        /// ledger state after the last commit, nullptr before the first one
+        std::shared_ptr<const LedgerState> ledger_state;
+      };
       /**
        * Iterate through the peers which signed the commit message, load and
        * apply the missing blocks
        * @param start_height - the block from which to start synchronization
        * @param target_height - the block height that must be reached
        * @param public_keys - public keys of peers from which to ask the blocks
-       * @return Result of committing the downloaded blocks.
+       * @return Result of committing the downloaded blocks. The ledger state
+       * of the blocks committed before all the peers failed, if they were
        */
       ametsuchi::CommitResult downloadAndCommitMissingBlocks(
           const shared_model::interface::types::HeightType start_height,
           const shared_model::interface::types::HeightType target_height,
           const PublicKeysRange &public_keys);
 
+      /**
+       * Apply the downloaded blocks and commit them. The blocks are committed
+       * in chunks limited by the number of the blocks and the transactions,
+       * so a long catch-up costs one database commit per chunk, and the
+       * chunks committed before a failure are kept
+       * @param blocks - blocks following the progress height
+       * @param progress - the committed blocks, updated after every chunk
+       * @param target_height - the block height that must be reached
+       * @return result of committing the blocks, nullopt if the chain is
+       * invalid or does not reach the target height
+       */
+      boost::optional<ametsuchi::CommitResult> commitDownloadedBlocks(
+          rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+              blocks,
+          Progress &progress,
+          const shared_model::interface::types::HeightType target_height);
+
       void processNext(const consensus::PairValid &msg);
 
       /**
@@ -79,6 +164,12 @@ namespace iroha {
       std::shared_ptr<ametsuchi::MutableFactory> mutable_factory_;
       std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory_;
       std::shared_ptr<network::BlockLoader> block_loader_;
+      std::shared_ptr<network::BlockFetcher> block_fetcher_;
+      const size_t prefetch_capacity_;
+      const shared_model::interface::types::HeightType
+          range_download_threshold_;
+      const size_t commit_blocks_;
+      const size_t commit_transactions_;
 
       // internal
       rxcpp::composite_subscription notifier_lifetime_;
@@ -86,6 +177,16 @@ namespace iroha {
       rxcpp::composite_subscription subscription_;
 
       logger::LoggerPtr log_;
+
+      // ------|Metrics|------
+      Histogram commit_time_;
+      Histogram synchronization_time_;
+      Counter prepared_commits_;
+      Counter applied_commits_;
+      Counter downloaded_blocks_;
+      Counter fetched_commits_;
+      std::atomic<size_t> prefetched_blocks_{0};
+      std::atomic<double> synchronization_rate_{0};
     };
 
   }  // namespace synchronizer
@@ -46,6 +46,14 @@ namespace torii {
     grpc::Status Status(const iroha::protocol::TxStatusRequest &tx,
                         iroha::protocol::ToriiResponse &response) const;
 
+    /**
+     * @param request - hashes of the transactions
+     * @param response returns the statuses of the transactions if succeeded
+     * @return grpc::Status - returns connection is success or not.
+     */
+    grpc::Status StatusList(const iroha::protocol::TxStatusListRequest &request,
+                            iroha::protocol::TxStatusList &response) const;
+
     /**
      * Acquires stream of transaction statuses from the request
      * moment until final.
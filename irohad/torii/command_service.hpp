@@ -6,6 +6,9 @@
 #ifndef TORII_COMMAND_SERVICE_HPP
 #define TORII_COMMAND_SERVICE_HPP
 
+#include <memory>
+#include <vector>
+
 #include <rxcpp/rx-observable-fwd.hpp>
 #include "interfaces/common_objects/types.hpp"
 
@@ -44,6 +47,18 @@ namespace iroha {
       virtual std::shared_ptr<shared_model::interface::TransactionResponse>
       getStatus(const shared_model::crypto::Hash &request) = 0;
 
+      /**
+       * Request to retrieve the statuses of many transactions at once, the
+       * transactions missing in the cache are checked in the storage with a
+       * single query
+       * @param hashes - hashes of the transactions
+       * @return current states of the requested transactions in the order of
+       * the hashes
+       */
+      virtual std::vector<
+          std::shared_ptr<shared_model::interface::TransactionResponse>>
+      getStatuses(const std::vector<shared_model::crypto::Hash> &hashes) = 0;
+
       /**
        * Streaming call which will repeatedly send all statuses of requested
        * transaction from its status at the moment of receiving this request to
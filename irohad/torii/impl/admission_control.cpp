@@ -0,0 +1,134 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/admission_control.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/range/size.hpp>
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace iroha {
+  namespace torii {
+
+    AdmissionControl::AdmissionControl(
+        Limits limits,
+        std::function<size_t()> pending_txs,
+        std::function<Clock::time_point()> now)
+        : limits_(limits),
+          pending_txs_(std::move(pending_txs)),
+          now_(std::move(now)),
+          global_{static_cast<double>(limits_.tx_rate), now_()} {}
+
+    bool AdmissionControl::admit(
+        const shared_model::interface::TransactionBatch &batch) {
+      if (limits_.tx_rate == 0 and limits_.account_tx_rate == 0
+          and limits_.max_pending_txs == 0) {
+        return true;
+      }
+
+      const auto &transactions = batch.transactions();
+      auto txs_amount = boost::size(transactions);
+      auto reject = [this, txs_amount] {
+        rejected_txs_.increment(txs_amount);
+        return false;
+      };
+
+      // the rates decrease linearly down to zero at the max pending amount
+      double scale = 1.;
+      if (limits_.max_pending_txs != 0) {
+        auto pending = pending_txs_();
+        if (pending >= limits_.max_pending_txs) {
+          return reject();
+        }
+        scale -= static_cast<double>(pending) / limits_.max_pending_txs;
+      }
+
+      std::unordered_map<std::string, size_t> txs_of_account;
+      if (limits_.account_tx_rate != 0) {
+        for (const auto &transaction : transactions) {
+          ++txs_of_account[transaction->creatorAccountId()];
+        }
+      }
+
+      auto now = now_();
+      std::lock_guard<std::mutex> lock(mutex_);
+      // a batch larger than a bucket is admitted by the full bucket, which
+      // goes into debt
+      auto enough = [](const Bucket &bucket, double capacity, size_t amount) {
+        return bucket.tokens >= std::min(capacity, double(amount));
+      };
+
+      if (limits_.tx_rate != 0) {
+        refill(global_, limits_.tx_rate * scale, limits_.tx_rate, now);
+        if (not enough(global_, limits_.tx_rate, txs_amount)) {
+          return reject();
+        }
+      }
+
+      std::vector<std::pair<Bucket *, size_t>> account_buckets;
+      if (limits_.account_tx_rate != 0) {
+        if (accounts_.size() > kMaxAccounts) {
+          evictIdleAccounts(limits_.account_tx_rate * scale, now);
+        }
+        for (const auto &account : txs_of_account) {
+          auto &bucket =
+              accounts_
+                  .emplace(account.first,
+                           Bucket{double(limits_.account_tx_rate), now})
+                  .first->second;
+          refill(bucket,
+                 limits_.account_tx_rate * scale,
+                 limits_.account_tx_rate,
+                 now);
+          if (not enough(bucket, limits_.account_tx_rate, account.second)) {
+            return reject();
+          }
+          account_buckets.emplace_back(&bucket, account.second);
+        }
+      }
+
+      if (limits_.tx_rate != 0) {
+        global_.tokens -= txs_amount;
+      }
+      for (const auto &bucket : account_buckets) {
+        bucket.first->tokens -= bucket.second;
+      }
+      return true;
+    }
+
+    const Counter &AdmissionControl::rejectedTxs() const {
+      return rejected_txs_;
+    }
+
+    void AdmissionControl::refill(Bucket &bucket,
+                                  double rate,
+                                  double capacity,
+                                  Clock::time_point now) const {
+      if (now <= bucket.updated) {
+        return;
+      }
+      std::chrono::duration<double> elapsed = now - bucket.updated;
+      bucket.tokens =
+          std::min(capacity, bucket.tokens + rate * elapsed.count());
+      bucket.updated = now;
+    }
+
+    void AdmissionControl::evictIdleAccounts(double rate,
+                                             Clock::time_point now) {
+      for (auto it = accounts_.begin(); it != accounts_.end();) {
+        refill(it->second, rate, limits_.account_tx_rate, now);
+        if (it->second.tokens >= limits_.account_tx_rate) {
+          it = accounts_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+
+  }  // namespace torii
+}  // namespace iroha
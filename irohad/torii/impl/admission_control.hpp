@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_ADMISSION_CONTROL_HPP
+#define TORII_ADMISSION_CONTROL_HPP
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/counter.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class TransactionBatch;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * Admission control of the transactions received by Torii. The
+     * transactions are admitted by token buckets, a global one and one per
+     * creator account, which are refilled at the configured rates. The rates
+     * are lowered in proportion to the transactions pending in the ordering
+     * service, so that a peer which does not keep up with the load rejects
+     * the excess right away instead of dropping it in the ordering
+     */
+    class AdmissionControl {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      struct Limits {
+        /// transactions per second from all the accounts, 0 for no limit
+        size_t tx_rate;
+        /// transactions per second from one account, 0 for no limit
+        size_t account_tx_rate;
+        /// pending transactions at which nothing is admitted, 0 for no limit
+        size_t max_pending_txs;
+      };
+
+      /**
+       * @param limits - rate limits, the buckets hold a second of their rates
+       * @param pending_txs - returns the number of the transactions pending
+       * in the ordering service
+       * @param now - current time
+       */
+      AdmissionControl(Limits limits,
+                       std::function<size_t()> pending_txs,
+                       std::function<Clock::time_point()> now = Clock::now);
+
+      /**
+       * Take the tokens for all the transactions of the batch, if there are
+       * enough of them in every bucket the batch needs
+       * @return true if the batch is admitted
+       */
+      bool admit(const shared_model::interface::TransactionBatch &batch);
+
+      /// @return the number of the rejected transactions
+      const Counter &rejectedTxs() const;
+
+     private:
+      struct Bucket {
+        double tokens;
+        Clock::time_point updated;
+      };
+
+      /// add the tokens accumulated since the last update
+      void refill(Bucket &bucket,
+                  double rate,
+                  double capacity,
+                  Clock::time_point now) const;
+
+      /// forget the idle accounts, whose buckets are full
+      void evictIdleAccounts(double rate, Clock::time_point now);
+
+      /// accounts, after which the idle ones are forgotten
+      static constexpr size_t kMaxAccounts = 100000;
+
+      const Limits limits_;
+      std::function<size_t()> pending_txs_;
+      std::function<Clock::time_point()> now_;
+
+      std::mutex mutex_;
+      Bucket global_;
+      std::unordered_map<std::string, Bucket> accounts_;
+
+      Counter rejected_txs_;
+    };
+
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // TORII_ADMISSION_CONTROL_HPP
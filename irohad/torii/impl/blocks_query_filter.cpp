@@ -0,0 +1,176 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/blocks_query_filter.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/algorithm/string/join.hpp>
+#include <boost/algorithm/string/predicate.hpp>
+#include "backend/protobuf/util.hpp"
+#include "cryptography/default_hash_provider.hpp"
+
+namespace {
+  /// @return the sorted elements joined to a string
+  std::string joinSorted(const std::unordered_set<std::string> &set) {
+    std::vector<std::string> elements(set.begin(), set.end());
+    std::sort(elements.begin(), elements.end());
+    return boost::algorithm::join(elements, ",");
+  }
+
+  /**
+   * Call the function with every account and asset of the command, which are
+   * the string fields named as *account_id and *asset_id respectively
+   */
+  template <typename AccountFunction, typename AssetFunction>
+  void forEachId(const google::protobuf::Message &command,
+                 AccountFunction &&on_account,
+                 AssetFunction &&on_asset) {
+    const auto *descriptor = command.GetDescriptor();
+    const auto *reflection = command.GetReflection();
+    for (int i = 0; i < descriptor->field_count(); ++i) {
+      const auto *field = descriptor->field(i);
+      if (field->is_repeated()
+          or field->cpp_type()
+              != google::protobuf::FieldDescriptor::CPPTYPE_STRING) {
+        continue;
+      }
+      if (boost::algorithm::ends_with(field->name(), "account_id")) {
+        on_account(reflection->GetString(command, field));
+      } else if (boost::algorithm::ends_with(field->name(), "asset_id")) {
+        on_asset(reflection->GetString(command, field));
+      }
+    }
+  }
+}  // namespace
+
+namespace iroha {
+  namespace torii {
+
+    boost::optional<shared_model::crypto::MerkleTree> transactionsTree(
+        const protocol::Block_v1::Payload &payload) {
+      if (not payload.has_transactions_root()
+          or payload.transactions_root().version()
+              != shared_model::crypto::MerkleTree::kVersion) {
+        return boost::none;
+      }
+      std::vector<shared_model::crypto::Hash> hashes;
+      hashes.reserve(payload.transactions_size());
+      for (const auto &transaction : payload.transactions()) {
+        hashes.push_back(shared_model::crypto::DefaultHashProvider::makeHash(
+            shared_model::proto::makeBlob(transaction.payload())));
+      }
+      shared_model::crypto::MerkleTree tree(hashes);
+      if (tree.root().hex() != payload.transactions_root().root()) {
+        return boost::none;
+      }
+      return tree;
+    }
+
+    protocol::TransactionProof makeTransactionProof(
+        const shared_model::crypto::MerkleTree &tree, size_t index) {
+      protocol::TransactionProof proof;
+      proof.set_index(index);
+      for (const auto &sibling : tree.proof(index)) {
+        proof.add_siblings(sibling.hex());
+      }
+      return proof;
+    }
+
+    BlocksQueryFilter::BlocksQueryFilter(
+        const protocol::BlocksQueryFilter &filter)
+        : account_ids_(filter.account_ids().begin(),
+                       filter.account_ids().end()),
+          asset_ids_(filter.asset_ids().begin(), filter.asset_ids().end()),
+          command_types_(filter.command_types().begin(),
+                         filter.command_types().end()),
+          summary_(filter.summary()),
+          key_(joinSorted(account_ids_) + ";" + joinSorted(asset_ids_) + ";"
+               + joinSorted(command_types_) + ";"
+               + (summary_ ? "summary" : "blocks")) {}
+
+    bool BlocksQueryFilter::empty() const {
+      return account_ids_.empty() and asset_ids_.empty()
+          and command_types_.empty() and not summary_;
+    }
+
+    const std::string &BlocksQueryFilter::key() const {
+      return key_;
+    }
+
+    bool BlocksQueryFilter::matches(
+        const protocol::Transaction &transaction) const {
+      const auto &payload = transaction.payload().reduced_payload();
+      bool account_matched = account_ids_.empty()
+          or account_ids_.count(payload.creator_account_id()) > 0;
+      bool asset_matched = asset_ids_.empty();
+      bool type_matched = command_types_.empty();
+      for (const auto &command : payload.commands()) {
+        const auto *field = command.GetDescriptor()->FindFieldByNumber(
+            command.command_case());
+        if (field == nullptr) {
+          continue;
+        }
+        if (not type_matched) {
+          type_matched = command_types_.count(field->name()) > 0;
+        }
+        if (not account_matched or not asset_matched) {
+          forEachId(
+              command.GetReflection()->GetMessage(command, field),
+              [this, &account_matched](const std::string &account_id) {
+                account_matched =
+                    account_matched or account_ids_.count(account_id) > 0;
+              },
+              [this, &asset_matched](const std::string &asset_id) {
+                asset_matched =
+                    asset_matched or asset_ids_.count(asset_id) > 0;
+              });
+        }
+      }
+      return account_matched and asset_matched and type_matched;
+    }
+
+    std::shared_ptr<const protocol::BlockQueryResponse>
+    BlocksQueryFilter::apply(const protocol::Block_v1 &block) const {
+      const auto &payload = block.payload();
+      auto response = std::make_shared<protocol::BlockQueryResponse>();
+      if (not summary_) {
+        auto matched = std::any_of(
+            payload.transactions().begin(),
+            payload.transactions().end(),
+            [this](const auto &transaction) { return matches(transaction); });
+        if (not matched) {
+          return nullptr;
+        }
+        *response->mutable_block_response()
+             ->mutable_block()
+             ->mutable_block_v1() = block;
+        return response;
+      }
+
+      auto summary = response->mutable_block_summary_response();
+      summary->set_height(payload.height());
+      summary->set_prev_block_hash(payload.prev_block_hash());
+      summary->set_created_time(payload.created_time());
+      summary->set_tx_number(payload.tx_number());
+      auto tree = transactionsTree(payload);
+      if (tree) {
+        *summary->mutable_transactions_root() = payload.transactions_root();
+      }
+      for (int i = 0; i < payload.transactions_size(); ++i) {
+        const auto &transaction = payload.transactions(i);
+        if (matches(transaction)) {
+          *summary->add_transactions() = transaction;
+          if (tree) {
+            *summary->add_proofs() = makeTransactionProof(*tree, i);
+          }
+        }
+      }
+      return response;
+    }
+
+  }  // namespace torii
+}  // namespace iroha
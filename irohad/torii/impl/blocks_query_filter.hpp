@@ -0,0 +1,89 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_BLOCKS_QUERY_FILTER_HPP
+#define TORII_BLOCKS_QUERY_FILTER_HPP
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include "block.pb.h"
+#include "cryptography/merkle_tree.hpp"
+#include "qry_responses.pb.h"
+#include "queries.pb.h"
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * Build the Merkle tree of the transactions of the block, if the block has
+     * its root of a known version
+     * @param payload - payload of the block
+     * @return the tree, none if the block has no root or the root of the
+     * block does not match its transactions
+     */
+    boost::optional<shared_model::crypto::MerkleTree> transactionsTree(
+        const protocol::Block_v1::Payload &payload);
+
+    /**
+     * @param tree - tree of the transactions of a block
+     * @param index - index of the transaction in the block
+     * @return proof of the transaction
+     */
+    protocol::TransactionProof makeTransactionProof(
+        const shared_model::crypto::MerkleTree &tree, size_t index);
+
+    /**
+     * Server side filter of the FetchCommits stream. A transaction matches
+     * the filter when every non-empty criterion has a match: the creator or
+     * an account of a command is among the accounts, an asset of a command is
+     * among the assets, and a command type is among the command types
+     */
+    class BlocksQueryFilter {
+     public:
+      explicit BlocksQueryFilter(const protocol::BlocksQueryFilter &filter);
+
+      /**
+       * @return true if the filter passes the blocks as they are
+       */
+      bool empty() const;
+
+      /**
+       * @return string which is equal for the filters with the same criteria
+       */
+      const std::string &key() const;
+
+      /**
+       * Filter a committed block
+       * @param block - the block to be filtered
+       * @return the whole block if some of its transactions match, so that
+       * its signatures stay verifiable, or the header of the block with the
+       * matching transactions if the summary is requested, which are proved
+       * by the root of the transactions of the block if it has one; nullptr
+       * if the block has to be skipped
+       */
+      std::shared_ptr<const protocol::BlockQueryResponse> apply(
+          const protocol::Block_v1 &block) const;
+
+      /**
+       * @return true if the transaction matches the filter
+       */
+      bool matches(const protocol::Transaction &transaction) const;
+
+     private:
+      std::unordered_set<std::string> account_ids_;
+      std::unordered_set<std::string> asset_ids_;
+      std::unordered_set<std::string> command_types_;
+      bool summary_;
+      std::string key_;
+    };
+
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // TORII_BLOCKS_QUERY_FILTER_HPP
@@ -42,6 +42,13 @@ namespace torii {
     return stub_->Status(&context, request, &response);
   }
 
+  grpc::Status CommandSyncClient::StatusList(
+      const iroha::protocol::TxStatusListRequest &request,
+      iroha::protocol::TxStatusList &response) const {
+    grpc::ClientContext context;
+    return stub_->StatusList(&context, request, &response);
+  }
+
   void CommandSyncClient::StatusStream(
       const iroha::protocol::TxStatusRequest &tx,
       std::vector<iroha::protocol::ToriiResponse> &response) const {
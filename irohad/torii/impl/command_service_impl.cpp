@@ -5,7 +5,6 @@
 
 #include "torii/impl/command_service_impl.hpp"
 
-#include <rxcpp/operators/rx-filter.hpp>
 #include <rxcpp/operators/rx-start_with.hpp>
 #include "ametsuchi/block_query.hpp"
 #include "common/byteutils.hpp"
@@ -15,6 +14,7 @@
 #include "interfaces/transaction.hpp"
 #include "interfaces/transaction_responses/not_received_tx_response.hpp"
 #include "logger/logger.hpp"
+#include "maintenance/tracing.hpp"
 
 namespace iroha {
   namespace torii {
@@ -27,13 +27,17 @@ namespace iroha {
             status_factory,
         std::shared_ptr<iroha::torii::CommandServiceImpl::CacheType> cache,
         std::shared_ptr<iroha::ametsuchi::TxPresenceCache> tx_presence_cache,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        std::shared_ptr<AdmissionControl> admission_control,
+        bool accept_transactions)
         : tx_processor_(std::move(tx_processor)),
           storage_(std::move(storage)),
           status_bus_(std::move(status_bus)),
           cache_(std::move(cache)),
           status_factory_(std::move(status_factory)),
           tx_presence_cache_(std::move(tx_presence_cache)),
+          admission_control_(std::move(admission_control)),
+          accept_transactions_(accept_transactions),
           log_(std::move(log)) {
       // Notifier for all clients
       status_subscription_ = status_bus_->statuses().subscribe(
@@ -60,6 +64,43 @@ namespace iroha {
 
     void CommandServiceImpl::handleTransactionBatch(
         std::shared_ptr<shared_model::interface::TransactionBatch> batch) {
+      iroha::tracing::ScopedSpan span("torii.handle_batch");
+      if (span) {
+        for (const auto &tx : batch->transactions()) {
+          span.addTransaction(tx->hash());
+        }
+      }
+
+      if (not accept_transactions_) {
+        log_->warn("Batch {} is rejected by the observer",
+                   batch->reducedHash().hex());
+        for (const auto &tx : batch->transactions()) {
+          pushStatus(
+              "ToriiObserver",
+              status_factory_->makeStatelessFail(
+                  tx->hash(),
+                  shared_model::interface::TxStatusFactory::TransactionError{
+                      "the peer is an observer, send the transactions to a "
+                      "validator peer",
+                      0,
+                      0}));
+        }
+        return;
+      }
+
+      if (admission_control_ and not admission_control_->admit(*batch)) {
+        log_->warn("Batch {} is rejected by the rate limits",
+                   batch->reducedHash().hex());
+        for (const auto &tx : batch->transactions()) {
+          pushStatus(
+              "ToriiAdmissionControl",
+              status_factory_->makeStatelessFail(
+                  tx->hash(),
+                  shared_model::interface::TxStatusFactory::TransactionError{
+                      "the peer is overloaded, retry later", 0, 0}));
+        }
+        return;
+      }
       processBatch(batch);
     }
 
@@ -100,6 +141,70 @@ namespace iroha {
           });
     }
 
+    std::vector<std::shared_ptr<shared_model::interface::TransactionResponse>>
+    CommandServiceImpl::getStatuses(
+        const std::vector<shared_model::crypto::Hash> &hashes) {
+      std::vector<std::shared_ptr<shared_model::interface::TransactionResponse>>
+          responses(hashes.size());
+      std::vector<size_t> missing;
+      for (size_t i = 0; i < hashes.size(); ++i) {
+        if (auto cached = cache_->findItem(hashes[i])) {
+          responses[i] = std::move(*cached);
+        } else {
+          missing.push_back(i);
+        }
+      }
+      if (missing.empty()) {
+        return responses;
+      }
+
+      auto make_not_received = [&] {
+        for (auto i : missing) {
+          responses[i] = status_factory_->makeNotReceived(hashes[i]);
+        }
+        return responses;
+      };
+      auto block_query = storage_->getBlockQuery();
+      if (not block_query) {
+        // TODO andrei 30.11.18 IR-51 Handle database error
+        log_->warn("Could not create block query. Txs: {}", missing.size());
+        return make_not_received();
+      }
+
+      std::vector<shared_model::crypto::Hash> missing_hashes;
+      missing_hashes.reserve(missing.size());
+      for (auto i : missing) {
+        missing_hashes.push_back(hashes[i]);
+      }
+      auto statuses = block_query->checkTxsPresence(missing_hashes);
+      if (not statuses) {
+        // TODO andrei 30.11.18 IR-51 Handle database error
+        log_->warn("Check txs presence database error. Txs: {}",
+                   missing.size());
+        return make_not_received();
+      }
+
+      for (size_t j = 0; j < missing.size(); ++j) {
+        const auto &hash = hashes[missing[j]];
+        responses[missing[j]] = iroha::visit_in_place(
+            (*statuses)[j],
+            [this, &hash](
+                const iroha::ametsuchi::tx_cache_status_responses::Missing &)
+                -> std::shared_ptr<
+                    shared_model::interface::TransactionResponse> {
+              log_->warn("Asked non-existing tx: {}", hash.hex());
+              return status_factory_->makeNotReceived(hash);
+            },
+            [this, &hash](const auto &) {
+              std::shared_ptr<shared_model::interface::TransactionResponse>
+                  response = status_factory_->makeCommitted(hash);
+              cache_->addItem(hash, response);
+              return response;
+            });
+      }
+      return responses;
+    }
+
     /**
      * Statuses considered final for streaming. Observable stops value emission
      * after receiving a value of one of the following types
@@ -157,13 +262,9 @@ namespace iroha {
             });
       }());
       return status_bus_
-          ->statuses()
+          ->statuses(hash)
           // prepend initial status
           .start_with(initial_status)
-          // select statuses with requested hash
-          .filter([hash](auto response) {
-            return response->transactionHash() == hash;
-          })
           // successfully complete the observable if final status is received.
           // final status is included in the observable
           .template lift<ResponsePtrType>(
@@ -11,10 +11,11 @@
 #include <rxcpp/rx-lite.hpp>
 #include "ametsuchi/storage.hpp"
 #include "ametsuchi/tx_presence_cache.hpp"
-#include "cache/cache.hpp"
+#include "cache/sharded_cache.hpp"
 #include "cryptography/hash.hpp"
 #include "interfaces/iroha_internal/tx_status_factory.hpp"
 #include "logger/logger_fwd.hpp"
+#include "torii/impl/admission_control.hpp"
 #include "torii/processor/transaction_processor.hpp"
 #include "torii/status_bus.hpp"
 
@@ -26,7 +27,7 @@ namespace iroha {
     class CommandServiceImpl : public CommandService {
      public:
       // TODO: 2019-03-13 @muratovv fix with abstract cache type IR-397
-      using CacheType = iroha::cache::Cache<
+      using CacheType = iroha::cache::ShardedCache<
           shared_model::crypto::Hash,
           std::shared_ptr<shared_model::interface::TransactionResponse>,
           shared_model::crypto::Hash::Hasher>;
@@ -40,6 +41,10 @@ namespace iroha {
        * CommandServiceImpl::CacheType
        * @param tx_presence_cache a cache over persistent storage
        * @param log to print progress
+       * @param admission_control - rejects the transactions over the rate
+       * limits, nullptr to accept everything
+       * @param accept_transactions - whether the transactions are processed,
+       * an observer peer rejects them and serves only their statuses
        */
       CommandServiceImpl(
           std::shared_ptr<iroha::torii::TransactionProcessor> tx_processor,
@@ -49,7 +54,9 @@ namespace iroha {
               status_factory,
           std::shared_ptr<iroha::torii::CommandServiceImpl::CacheType> cache,
           std::shared_ptr<iroha::ametsuchi::TxPresenceCache> tx_presence_cache,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::shared_ptr<AdmissionControl> admission_control = nullptr,
+          bool accept_transactions = true);
 
       ~CommandServiceImpl() override;
 
@@ -66,6 +73,9 @@ namespace iroha {
 
       std::shared_ptr<shared_model::interface::TransactionResponse> getStatus(
           const shared_model::crypto::Hash &request) override;
+      std::vector<std::shared_ptr<shared_model::interface::TransactionResponse>>
+      getStatuses(
+          const std::vector<shared_model::crypto::Hash> &hashes) override;
       rxcpp::observable<
           std::shared_ptr<shared_model::interface::TransactionResponse>>
       getStatusStream(const shared_model::crypto::Hash &hash) override;
@@ -104,6 +114,8 @@ namespace iroha {
       std::shared_ptr<CacheType> cache_;
       std::shared_ptr<shared_model::interface::TxStatusFactory> status_factory_;
       std::shared_ptr<iroha::ametsuchi::TxPresenceCache> tx_presence_cache_;
+      std::shared_ptr<AdmissionControl> admission_control_;
+      const bool accept_transactions_;
 
       rxcpp::composite_subscription status_subscription_;
 
@@ -8,6 +8,7 @@
 #include "torii/impl/command_service_transport_grpc.hpp"
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <iterator>
 
@@ -18,6 +19,7 @@
 #include <rxcpp/operators/rx-start_with.hpp>
 #include <rxcpp/operators/rx-take_while.hpp>
 #include "backend/protobuf/transaction_responses/proto_tx_response.hpp"
+#include "common/allocation_tracking.hpp"
 #include "common/combine_latest_until_first_completed.hpp"
 #include "common/run_loop_handler.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
@@ -26,6 +28,7 @@
 #include "interfaces/iroha_internal/tx_status_factory.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
+#include "network/impl/async_server_stream.hpp"
 #include "torii/status_bus.hpp"
 
 namespace iroha {
@@ -43,7 +46,9 @@ namespace iroha {
             transaction_batch_factory,
         rxcpp::observable<ConsensusGateEvent> consensus_gate_objects,
         int maximum_rounds_without_update,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        bool async_status_streams,
+        std::shared_ptr<validation::ValidationPool> validation_pool)
         : command_service_(std::move(command_service)),
           status_bus_(std::move(status_bus)),
           status_factory_(std::move(status_factory)),
@@ -52,15 +57,31 @@ namespace iroha {
           batch_factory_(std::move(transaction_batch_factory)),
           log_(std::move(log)),
           consensus_gate_objects_(std::move(consensus_gate_objects)),
-          maximum_rounds_without_update_(maximum_rounds_without_update) {}
+          maximum_rounds_without_update_(maximum_rounds_without_update),
+          async_status_streams_(async_status_streams),
+          validation_pool_(
+              validation_pool
+                  ? std::move(validation_pool)
+                  : std::make_shared<validation::ValidationPool>(1)) {
+      if (async_status_streams_) {
+        MarkMethodAsync(kStatusStreamMethod);
+      }
+    }
 
     grpc::Status CommandServiceTransportGrpc::Torii(
         grpc::ServerContext *context,
         const iroha::protocol::Transaction *request,
         google::protobuf::Empty *response) {
-      iroha::protocol::TxList single_tx_list;
-      *single_tx_list.add_transactions() = *request;
-      return ListTorii(context, &single_tx_list, response);
+      ScopedAllocationTag allocation_tag(AllocationTag::kTorii);
+      // the transaction is copied once, by its deserialization
+      shared_model::interface::types::SharedTxsCollectionType transactions;
+      if (auto transaction = deserializeTransaction(*request)) {
+        transactions.push_back(std::move(*transaction));
+      }
+      for (auto &batch : batch_parser_->parseBatches(transactions)) {
+        handleBatch(batch);
+      }
+      return grpc::Status::OK;
     }
 
     namespace {
@@ -98,54 +119,136 @@ namespace iroha {
     shared_model::interface::types::SharedTxsCollectionType
     CommandServiceTransportGrpc::deserializeTransactions(
         const iroha::protocol::TxList *request) {
-      shared_model::interface::types::SharedTxsCollectionType tx_collection;
-      for (const auto &tx : request->transactions()) {
-        transaction_factory_->build(tx).match(
-            [&tx_collection](auto &&v) {
-              tx_collection.emplace_back(std::move(v).value);
-            },
-            [this](const auto &error) {
-              status_bus_->publish(status_factory_->makeStatelessFail(
-                  error.error.hash,
-                  shared_model::interface::TxStatusFactory::TransactionError{
-                      error.error.error, 0, 0}));
-            });
-      }
-      return tx_collection;
+      return validation_pool_->buildAll<
+          shared_model::interface::types::SharedTxsCollectionType>(
+          request->transactions_size(),
+          [&](size_t i) {
+            return transaction_factory_->build(request->transactions(i));
+          },
+          [this](const auto &error) { this->publishStatelessFail(error); });
+    }
+
+    boost::optional<std::shared_ptr<shared_model::interface::Transaction>>
+    CommandServiceTransportGrpc::deserializeTransaction(
+        iroha::protocol::Transaction tx) {
+      return transaction_factory_->build(std::move(tx)).match(
+          [](auto &&v) {
+            return boost::make_optional<
+                std::shared_ptr<shared_model::interface::Transaction>>(
+                std::move(v).value);
+          },
+          [this](const auto &error)
+              -> boost::optional<
+                  std::shared_ptr<shared_model::interface::Transaction>> {
+            this->publishStatelessFail(error.error);
+            return boost::none;
+          });
+    }
+
+    void CommandServiceTransportGrpc::publishStatelessFail(
+        const TransportFactoryType::Error &error) {
+      status_bus_->publish(status_factory_->makeStatelessFail(
+          error.hash,
+          shared_model::interface::TxStatusFactory::TransactionError{
+              error.error, 0, 0}));
+    }
+
+    void CommandServiceTransportGrpc::handleBatch(
+        const shared_model::interface::types::SharedTxsCollectionType &batch) {
+      ScopedAllocationTag allocation_tag(AllocationTag::kTorii);
+      handleBatch(batch, batch_factory_->createTransactionBatch(batch));
+    }
+
+    void CommandServiceTransportGrpc::handleBatch(
+        const shared_model::interface::types::SharedTxsCollectionType &batch,
+        BatchResult result) {
+      ScopedAllocationTag allocation_tag(AllocationTag::kTorii);
+      std::move(result).match(
+          [&](auto &&value) {
+            this->command_service_->handleTransactionBatch(
+                std::move(value).value);
+          },
+          [&](const auto &error) {
+            std::vector<shared_model::crypto::Hash> hashes;
+
+            std::transform(batch.begin(),
+                           batch.end(),
+                           std::back_inserter(hashes),
+                           [](const auto &tx) { return tx->hash(); });
+
+            auto error_msg = formErrorMessage(hashes, error.error);
+            // set error response for each transaction in a batch candidate
+            std::for_each(
+                hashes.begin(), hashes.end(), [this, &error_msg](auto &hash) {
+                  status_bus_->publish(status_factory_->makeStatelessFail(
+                      hash,
+                      shared_model::interface::TxStatusFactory::
+                          TransactionError{error_msg, 0, 0}));
+                });
+          });
     }
 
     grpc::Status CommandServiceTransportGrpc::ListTorii(
         grpc::ServerContext *context,
         const iroha::protocol::TxList *request,
         google::protobuf::Empty *response) {
+      ScopedAllocationTag allocation_tag(AllocationTag::kTorii);
       auto transactions = deserializeTransactions(request);
 
       auto batches = batch_parser_->parseBatches(transactions);
 
-      for (auto &batch : batches) {
-        batch_factory_->createTransactionBatch(batch).match(
-            [&](auto &&value) {
-              this->command_service_->handleTransactionBatch(
-                  std::move(value).value);
-            },
-            [&](const auto &error) {
-              std::vector<shared_model::crypto::Hash> hashes;
-
-              std::transform(batch.begin(),
-                             batch.end(),
-                             std::back_inserter(hashes),
-                             [](const auto &tx) { return tx->hash(); });
-
-              auto error_msg = formErrorMessage(hashes, error.error);
-              // set error response for each transaction in a batch candidate
-              std::for_each(
-                  hashes.begin(), hashes.end(), [this, &error_msg](auto &hash) {
-                    status_bus_->publish(status_factory_->makeStatelessFail(
-                        hash,
-                        shared_model::interface::TxStatusFactory::
-                            TransactionError{error_msg, 0, 0}));
-                  });
-            });
+      // the batches of large uploads are validated with the workers as well
+      // and handled in the order of the request
+      auto results = validation_pool_->map(batches.size(), [&](size_t i) {
+        return batch_factory_->createTransactionBatch(batches[i]);
+      });
+      for (size_t i = 0; i < batches.size(); ++i) {
+        handleBatch(batches[i], std::move(results[i]));
+      }
+
+      return grpc::Status::OK;
+    }
+
+    grpc::Status CommandServiceTransportGrpc::TransactionStream(
+        grpc::ServerContext *context,
+        grpc::ServerReader<iroha::protocol::Transaction> *reader,
+        google::protobuf::Empty *response) {
+      ScopedAllocationTag allocation_tag(AllocationTag::kTorii);
+      // whether all transactions of the batch candidate have arrived
+      auto is_complete = [](const auto &batch) {
+        auto meta = batch.front()->batchMeta();
+        return not meta or (*meta)->reducedHashes().size() <= batch.size();
+      };
+
+      // transactions of the batch candidate which is not complete yet
+      shared_model::interface::types::SharedTxsCollectionType pending;
+      iroha::protocol::Transaction tx;
+      while (reader->Read(&tx)) {
+        // the read transaction is moved, Read overwrites it
+        auto transaction = deserializeTransaction(std::move(tx));
+        if (not transaction) {
+          continue;
+        }
+        pending.push_back(std::move(*transaction));
+
+        // only the last batch candidate may lack the transactions
+        auto batches = batch_parser_->parseBatches(pending);
+        auto complete = batches.size();
+        if (not is_complete(batches.back())) {
+          --complete;
+        }
+        for (size_t i = 0; i < complete; ++i) {
+          handleBatch(batches[i]);
+        }
+        pending = complete == batches.size()
+            ? shared_model::interface::types::SharedTxsCollectionType{}
+            : std::move(batches.back());
+      }
+
+      // the rest is handled as is, so the statuses of its transactions
+      // are published
+      for (auto &batch : batch_parser_->parseBatches(pending)) {
+        handleBatch(batch);
       }
 
       return grpc::Status::OK;
@@ -155,6 +258,7 @@ namespace iroha {
         grpc::ServerContext *context,
         const iroha::protocol::TxStatusRequest *request,
         iroha::protocol::ToriiResponse *response) {
+      ScopedAllocationTag allocation_tag(AllocationTag::kTorii);
       *response =
           std::static_pointer_cast<shared_model::proto::TransactionResponse>(
               command_service_->getStatus(
@@ -164,10 +268,164 @@ namespace iroha {
       return grpc::Status::OK;
     }
 
+    grpc::Status CommandServiceTransportGrpc::StatusList(
+        grpc::ServerContext *context,
+        const iroha::protocol::TxStatusListRequest *request,
+        iroha::protocol::TxStatusList *response) {
+      ScopedAllocationTag allocation_tag(AllocationTag::kTorii);
+      std::vector<shared_model::crypto::Hash> hashes;
+      hashes.reserve(request->tx_hashes_size());
+      for (const auto &tx_hash : request->tx_hashes()) {
+        hashes.push_back(shared_model::crypto::Hash::fromHexString(tx_hash));
+      }
+      for (const auto &status : command_service_->getStatuses(hashes)) {
+        *response->add_statuses() =
+            std::static_pointer_cast<shared_model::proto::TransactionResponse>(
+                status)
+                ->getTransport();
+      }
+      return grpc::Status::OK;
+    }
+
+    namespace {
+      /// Statuses of a stream written to the client, as it requested
+      struct StatusCoalescing {
+        /// write the final status only, or the last one if the stream ends
+        /// without it
+        bool final_only;
+        /// minimal interval between the written changes of the status
+        std::chrono::milliseconds min_interval;
+      };
+
+      StatusCoalescing coalescingOf(
+          const iroha::protocol::TxStatusRequest &request) {
+        return {request.coalescing()
+                    == iroha::protocol::TxStatusRequest::FINAL_ONLY,
+                std::chrono::milliseconds(request.min_interval_ms())};
+      }
+
+      /// @return whether the status is the last one of the transaction
+      bool isFinalStatus(iroha::protocol::TxStatus status) {
+        return status == iroha::protocol::TxStatus::STATELESS_VALIDATION_FAILED
+            or status == iroha::protocol::TxStatus::REJECTED
+            or status == iroha::protocol::TxStatus::COMMITTED;
+      }
+
+      /**
+       * Statuses of the transaction to be written to the client. The stream
+       * completes when the client is disconnected or too many rounds have
+       * passed without the status change. A change which is held back by
+       * the coalescing is written once the interval passes, which is checked
+       * on every round, or when the stream completes
+       * @param statuses - the statuses of the transaction
+       * @param consensus_gate_objects - events of the consensus rounds
+       * @param coordination - the scheduler of the events
+       * @param maximum_rounds_without_update - rounds without the status
+       * change before the stream is completed
+       * @param coalescing - statuses to be written
+       * @param is_cancelled - whether the client is disconnected
+       */
+      template <typename Coordination>
+      auto makeStatusUpdates(
+          rxcpp::observable<
+              std::shared_ptr<shared_model::interface::TransactionResponse>>
+              statuses,
+          rxcpp::observable<CommandServiceTransportGrpc::ConsensusGateEvent>
+              consensus_gate_objects,
+          Coordination coordination,
+          int maximum_rounds_without_update,
+          StatusCoalescing coalescing,
+          std::function<bool()> is_cancelled) {
+        using ResponsePtrType =
+            std::shared_ptr<shared_model::interface::TransactionResponse>;
+        struct State {
+          boost::optional<iroha::protocol::TxStatus> last_tx_status;
+          int rounds_counter = 0;
+          /// the status written last and the time it was written at
+          boost::optional<iroha::protocol::TxStatus> written_tx_status;
+          std::chrono::steady_clock::time_point written_time;
+          /// the latest change which is not written yet
+          boost::optional<iroha::protocol::ToriiResponse> unwritten;
+        };
+        auto state = std::make_shared<State>();
+        return makeCombineLatestUntilFirstCompleted(
+                   statuses,
+                   coordination,
+                   [](auto status, auto) { return status; },
+                   // a dummy start_with lets us don't wait for the consensus
+                   // event on further combine_latest
+                   consensus_gate_objects.start_with(
+                       CommandServiceTransportGrpc::ConsensusGateEvent{}))
+            .template lift<iroha::protocol::ToriiResponse>(
+                [state,
+                 maximum_rounds_without_update,
+                 coalescing,
+                 is_cancelled](
+                    rxcpp::subscriber<iroha::protocol::ToriiResponse> dest) {
+                  auto complete = [state, dest] {
+                    if (state->unwritten) {
+                      dest.on_next(std::move(*state->unwritten));
+                      state->unwritten = boost::none;
+                    }
+                    dest.on_completed();
+                  };
+                  return rxcpp::make_subscriber<ResponsePtrType>(
+                      dest,
+                      [=](const ResponsePtrType &response) {
+                        if (is_cancelled()) {
+                          dest.on_completed();
+                          return;
+                        }
+                        auto update = std::static_pointer_cast<
+                                          shared_model::proto::
+                                              TransactionResponse>(response)
+                                          ->getTransport();
+                        // increment round counter when the same status
+                        // arrived again
+                        auto status = update.tx_status();
+                        bool proceed = true;
+                        if (state->last_tx_status
+                            and status == *state->last_tx_status) {
+                          ++state->rounds_counter;
+                          proceed = state->rounds_counter
+                              < maximum_rounds_without_update;
+                        } else {
+                          state->rounds_counter = 0;
+                          state->last_tx_status = status;
+                        }
+
+                        if (not state->written_tx_status
+                            or status != *state->written_tx_status) {
+                          state->unwritten = std::move(update);
+                        }
+                        auto now = std::chrono::steady_clock::now();
+                        if (state->unwritten
+                            and (isFinalStatus(status)
+                                 or (not coalescing.final_only
+                                     and (not state->written_tx_status
+                                          or now - state->written_time
+                                              >= coalescing.min_interval)))) {
+                          state->written_tx_status = status;
+                          state->written_time = now;
+                          dest.on_next(std::move(*state->unwritten));
+                          state->unwritten = boost::none;
+                        }
+
+                        if (not proceed) {
+                          complete();
+                        }
+                      },
+                      [dest](std::exception_ptr ep) { dest.on_error(ep); },
+                      complete);
+                });
+      }
+    }  // namespace
+
     grpc::Status CommandServiceTransportGrpc::StatusStream(
         grpc::ServerContext *context,
         const iroha::protocol::TxStatusRequest *request,
         grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer) {
+      ScopedAllocationTag allocation_tag(AllocationTag::kTorii);
       rxcpp::schedulers::run_loop rl;
 
       auto current_thread = rxcpp::synchronize_in_one_worker(
@@ -180,53 +438,16 @@ namespace iroha {
       auto client_id_format = boost::format("Peer: '%s', %s");
       std::string client_id =
           (client_id_format % context->peer() % hash.toString()).str();
-      auto status_bus = command_service_->getStatusStream(hash);
-      auto consensus_gate_observable =
-          consensus_gate_objects_
-              // a dummy start_with lets us don't wait for the consensus event
-              // on further combine_latest
-              .start_with(ConsensusGateEvent{});
-
-      boost::optional<iroha::protocol::TxStatus> last_tx_status;
-      auto rounds_counter{0};
-      makeCombineLatestUntilFirstCompleted(
-          status_bus,
-          current_thread,
-          [](auto status, auto) { return status; },
-          consensus_gate_observable)
-          // complete the observable if client is disconnected or too many
-          // rounds have passed without tx status change
-          .take_while([=, &rounds_counter, &last_tx_status](
-                          const auto &response) {
-            const auto &proto_response =
-                std::static_pointer_cast<
-                    shared_model::proto::TransactionResponse>(response)
-                    ->getTransport();
-
-            if (context->IsCancelled()) {
-              log_->debug("client unsubscribed, {}", client_id);
-              return false;
-            }
-
-            // increment round counter when the same status arrived again.
-            auto status = proto_response.tx_status();
-            auto status_is_same =
-                last_tx_status and (status == *last_tx_status);
-            if (status_is_same) {
-              ++rounds_counter;
-              if (rounds_counter >= maximum_rounds_without_update_) {
-                // we stop the stream when round counter is greater than
-                // allowed.
-                return false;
-              }
-              // omit the received status, but do not stop the stream
-              return true;
-            }
-            rounds_counter = 0;
-            last_tx_status = status;
 
+      makeStatusUpdates(command_service_->getStatusStream(hash),
+                        consensus_gate_objects_,
+                        current_thread,
+                        maximum_rounds_without_update_,
+                        coalescingOf(*request),
+                        [context] { return context->IsCancelled(); })
+          .take_while([&](const auto &response) {
             // write a new status to the stream
-            if (not response_writer->Write(proto_response)) {
+            if (not response_writer->Write(response)) {
               log_->error("write to stream has failed to client {}", client_id);
               return false;
             }
@@ -248,5 +469,60 @@ namespace iroha {
       log_->debug("status stream done, {}", client_id);
       return grpc::Status::OK;
     }
+
+    bool CommandServiceTransportGrpc::hasAsyncMethods() const {
+      return async_status_streams_;
+    }
+
+    void CommandServiceTransportGrpc::requestCalls(
+        grpc::ServerCompletionQueue &queue) {
+      if (not async_status_streams_) {
+        return;
+      }
+      using Stream =
+          network::AsyncServerStream<iroha::protocol::TxStatusRequest,
+                                     iroha::protocol::ToriiResponse>;
+      Stream::request(
+          [this](auto context,
+                 auto request,
+                 auto writer,
+                 auto call_queue,
+                 auto tag) {
+            this->RequestAsyncServerStreaming(kStatusStreamMethod,
+                                              context,
+                                              request,
+                                              writer,
+                                              call_queue,
+                                              call_queue,
+                                              tag);
+          },
+          queue,
+          [this](const auto &request, std::shared_ptr<Stream> stream) {
+            auto hash =
+                shared_model::crypto::Hash::fromHexString(request.tx_hash());
+            auto client_id = (boost::format("Peer: '%s', %s")
+                              % stream->context().peer() % hash.toString())
+                                 .str();
+            makeStatusUpdates(command_service_->getStatusStream(hash),
+                              consensus_gate_objects_,
+                              rxcpp::synchronize_event_loop(),
+                              maximum_rounds_without_update_,
+                              coalescingOf(request),
+                              [stream] { return stream->isCancelled(); })
+                .subscribe(stream->subscription(),
+                           [stream](auto response) {
+                             stream->write(std::move(response));
+                           },
+                           [this, stream, client_id](std::exception_ptr) {
+                             log_->error("something bad happened, client_id {}",
+                                         client_id);
+                             stream->finish();
+                           },
+                           [this, stream, client_id] {
+                             log_->debug("stream done, {}", client_id);
+                             stream->finish();
+                           });
+          });
+    }
   }  // namespace torii
 }  // namespace iroha
@@ -8,12 +8,16 @@
 
 #include "torii/command_service.hpp"
 
+#include <boost/optional.hpp>
 #include <rxcpp/rx-lite.hpp>
 #include "endpoint.grpc.pb.h"
 #include "endpoint.pb.h"
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
+#include "interfaces/iroha_internal/transaction_batch_factory.hpp"
 #include "logger/logger_fwd.hpp"
+#include "network/async_call.hpp"
+#include "validation/validation_pool.hpp"
 
 namespace iroha {
   namespace torii {
@@ -32,7 +36,8 @@ namespace shared_model {
 namespace iroha {
   namespace torii {
     class CommandServiceTransportGrpc
-        : public iroha::protocol::CommandService_v1::Service {
+        : public iroha::protocol::CommandService_v1::Service,
+          public network::AsyncCallHandler {
      public:
       using TransportFactoryType =
           shared_model::interface::AbstractTransportFactory<
@@ -53,6 +58,10 @@ namespace iroha {
        * @param maximum_rounds_without_update - defines how long tx status
        * stream is kept alive when no new tx statuses appear
        * @param log to print progress
+       * @param async_status_streams - whether the status streams are handled
+       * on the completion queues of the server instead of a thread per stream
+       * @param validation_pool - workers which validate the transactions of
+       * a list, the calling thread if not provided
        */
       CommandServiceTransportGrpc(
           std::shared_ptr<CommandService> command_service,
@@ -66,7 +75,10 @@ namespace iroha {
               transaction_batch_factory,
           rxcpp::observable<ConsensusGateEvent> consensus_gate_objects,
           int maximum_rounds_without_update,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          bool async_status_streams = false,
+          std::shared_ptr<validation::ValidationPool> validation_pool =
+              nullptr);
 
       /**
        * Torii call via grpc
@@ -90,6 +102,21 @@ namespace iroha {
                              const iroha::protocol::TxList *request,
                              google::protobuf::Empty *response) override;
 
+      /**
+       * TransactionStream call via grpc. The transactions are grouped into
+       * batches and handled as soon as each batch is complete, without
+       * waiting for the rest of the stream
+       * @param context - call context
+       * @param reader - grpc::ServerReader which reads the transactions one
+       * by one, so the client sends no faster than they are handled
+       * @param response - no actual response (grpc stub for empty answer)
+       * @return status
+       */
+      grpc::Status TransactionStream(
+          grpc::ServerContext *context,
+          grpc::ServerReader<iroha::protocol::Transaction> *reader,
+          google::protobuf::Empty *response) override;
+
       /**
        * Status call via grpc
        * @param context - call context
@@ -103,6 +130,19 @@ namespace iroha {
                           const iroha::protocol::TxStatusRequest *request,
                           iroha::protocol::ToriiResponse *response) override;
 
+      /**
+       * StatusList call via grpc
+       * @param context - call context
+       * @param request - hashes of the transactions
+       * @param response - current states of the requested transactions in
+       * the order of the hashes
+       * @return status
+       */
+      grpc::Status StatusList(
+          grpc::ServerContext *context,
+          const iroha::protocol::TxStatusListRequest *request,
+          iroha::protocol::TxStatusList *response) override;
+
       /**
        * StatusStream call via grpc
        * @param context - call context
@@ -118,13 +158,55 @@ namespace iroha {
           grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer)
           override;
 
+      bool hasAsyncMethods() const override;
+
+      /// request the status streams when they are asynchronous
+      void requestCalls(grpc::ServerCompletionQueue &queue) override;
+
      private:
+      /// index of StatusStream among the methods of the service
+      static constexpr int kStatusStreamMethod = 3;
+
       /**
        * Flat map transport transactions to shared model
        */
       shared_model::interface::types::SharedTxsCollectionType
       deserializeTransactions(const iroha::protocol::TxList *request);
 
+      /**
+       * Map transport transaction to shared model, the stateless failed
+       * status is published for an invalid one
+       * @return the transaction if it is valid, boost::none otherwise
+       */
+      boost::optional<std::shared_ptr<shared_model::interface::Transaction>>
+      deserializeTransaction(iroha::protocol::Transaction tx);
+
+      /// publish the stateless failed status of the invalid transaction
+      void publishStatelessFail(const TransportFactoryType::Error &error);
+
+      /**
+       * Create the batch from the transactions and pass it to the command
+       * service, the stateless failed statuses are published for the
+       * transactions of an invalid batch
+       */
+      void handleBatch(
+          const shared_model::interface::types::SharedTxsCollectionType
+              &batch);
+
+      using BatchResult =
+          shared_model::interface::TransactionBatchFactory::FactoryResult<
+              std::unique_ptr<shared_model::interface::TransactionBatch>>;
+
+      /**
+       * Pass the batch created from the transactions to the command service,
+       * or publish the stateless failed statuses of the transactions
+       * @param batch - transactions of the batch candidate
+       * @param result - the batch or the error of its creation
+       */
+      void handleBatch(
+          const shared_model::interface::types::SharedTxsCollectionType &batch,
+          BatchResult result);
+
       std::shared_ptr<CommandService> command_service_;
       std::shared_ptr<iroha::torii::StatusBus> status_bus_;
       std::shared_ptr<shared_model::interface::TxStatusFactory> status_factory_;
@@ -137,6 +219,8 @@ namespace iroha {
 
       rxcpp::observable<ConsensusGateEvent> consensus_gate_objects_;
       const int maximum_rounds_without_update_;
+      const bool async_status_streams_;
+      std::shared_ptr<validation::ValidationPool> validation_pool_;
     };
   }  // namespace torii
 }  // namespace iroha
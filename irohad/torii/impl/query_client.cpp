@@ -49,6 +49,26 @@ namespace torii_utils {
     return stub_->Find(&context, query, &response);
   }
 
+  std::vector<QueryResponse> QuerySyncClient::FindStream(
+      const iroha::protocol::Query &query) const {
+    grpc::ClientContext context;
+    auto reader = stub_->FindStream(&context, query);
+    std::vector<QueryResponse> responses;
+    QueryResponse resp;
+    while (reader->Read(&resp)) {
+      responses.push_back(resp);
+    }
+    reader->Finish();
+    return responses;
+  }
+
+  grpc::Status QuerySyncClient::FindBatch(
+      const iroha::protocol::QueryBatch &batch,
+      iroha::protocol::QueryBatchResponse &response) const {
+    grpc::ClientContext context;
+    return stub_->FindBatch(&context, batch, &response);
+  }
+
   std::vector<iroha::protocol::BlockQueryResponse>
   QuerySyncClient::FetchCommits(
       const iroha::protocol::BlocksQuery &blocks_query) const {
@@ -0,0 +1,117 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/query_response_chunks.hpp"
+
+namespace {
+  /// upper bound of the tag and the length prefix of an element
+  constexpr size_t kElementOverhead = 6;
+
+  size_t elementBytes(const google::protobuf::Message &element) {
+    return element.ByteSizeLong() + kElementOverhead;
+  }
+
+  size_t elementBytes(const std::string &element) {
+    return element.size() + kElementOverhead;
+  }
+
+  /**
+   * Split the repeated field of the response among the chunks
+   * @param mutable_inner - accessor of the set response of the oneof
+   * @param mutable_elements - accessor of the collection of the response
+   */
+  template <typename Inner, typename Element>
+  bool splitElements(
+      iroha::protocol::QueryResponse response,
+      Inner *(iroha::protocol::QueryResponse::*mutable_inner)(),
+      google::protobuf::RepeatedPtrField<Element> *(Inner::*mutable_elements)(),
+      size_t max_bytes,
+      const iroha::torii::QueryResponseChunkWriter &write) {
+    auto &elements = *((response.*mutable_inner)()->*mutable_elements)();
+    google::protobuf::RepeatedPtrField<Element> all;
+    all.Swap(&elements);
+    const auto base_bytes = response.ByteSizeLong();
+
+    int next = 0;
+    do {
+      elements.Clear();
+      auto bytes = base_bytes;
+      while (next < all.size()) {
+        auto element_bytes = elementBytes(all.Get(next));
+        if (not elements.empty() and bytes + element_bytes > max_bytes) {
+          break;
+        }
+        bytes += element_bytes;
+        *elements.Add() = std::move(*all.Mutable(next++));
+      }
+      if (not write(response)) {
+        return false;
+      }
+    } while (next < all.size());
+    return true;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace torii {
+
+    bool splitQueryResponse(protocol::QueryResponse response,
+                            size_t max_bytes,
+                            const QueryResponseChunkWriter &write) {
+      using protocol::QueryResponse;
+      switch (response.response_case()) {
+        case QueryResponse::kAccountAssetsResponse:
+          return splitElements(std::move(response),
+                               &QueryResponse::mutable_account_assets_response,
+                               &protocol::AccountAssetResponse::
+                                   mutable_account_assets,
+                               max_bytes,
+                               write);
+        case QueryResponse::kSignatoriesResponse:
+          return splitElements(std::move(response),
+                               &QueryResponse::mutable_signatories_response,
+                               &protocol::SignatoriesResponse::mutable_keys,
+                               max_bytes,
+                               write);
+        case QueryResponse::kTransactionsResponse:
+          return splitElements(
+              std::move(response),
+              &QueryResponse::mutable_transactions_response,
+              &protocol::TransactionsResponse::mutable_transactions,
+              max_bytes,
+              write);
+        case QueryResponse::kRolesResponse:
+          return splitElements(std::move(response),
+                               &QueryResponse::mutable_roles_response,
+                               &protocol::RolesResponse::mutable_roles,
+                               max_bytes,
+                               write);
+        case QueryResponse::kTransactionsPageResponse:
+          return splitElements(
+              std::move(response),
+              &QueryResponse::mutable_transactions_page_response,
+              &protocol::TransactionsPageResponse::mutable_transactions,
+              max_bytes,
+              write);
+        case QueryResponse::kPendingTransactionsPageResponse:
+          return splitElements(
+              std::move(response),
+              &QueryResponse::mutable_pending_transactions_page_response,
+              &protocol::PendingTransactionsPageResponse::mutable_transactions,
+              max_bytes,
+              write);
+        case QueryResponse::kPeersResponse:
+          return splitElements(std::move(response),
+                               &QueryResponse::mutable_peers_response,
+                               &protocol::PeersResponse::mutable_peers,
+                               max_bytes,
+                               write);
+        default:
+          return write(response);
+      }
+    }
+
+  }  // namespace torii
+}  // namespace iroha
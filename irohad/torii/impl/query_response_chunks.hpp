@@ -0,0 +1,40 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TORII_QUERY_RESPONSE_CHUNKS_HPP
+#define IROHA_TORII_QUERY_RESPONSE_CHUNKS_HPP
+
+#include <functional>
+
+#include "qry_responses.pb.h"
+
+namespace iroha {
+  namespace torii {
+
+    /// receives a chunk of the response, returns false to stop the split
+    using QueryResponseChunkWriter =
+        std::function<bool(const protocol::QueryResponse &)>;
+
+    /**
+     * Split the query response into the messages of bounded size. The
+     * collection of the response, such as the transactions or the account
+     * assets, is split among the chunks, each of which repeats the other
+     * fields of the response, so the client concatenates the collections of
+     * the chunks. A response without a collection, and an element larger
+     * than the limit, are sent in a chunk of their own
+     * @param response - the response to split, its collection is moved to
+     * the chunks
+     * @param max_bytes - size limit of a chunk
+     * @param write - receives the chunks in the order of the collection
+     * @return false if the writer has stopped the split
+     */
+    bool splitQueryResponse(protocol::QueryResponse response,
+                            size_t max_bytes,
+                            const QueryResponseChunkWriter &write);
+
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // IROHA_TORII_QUERY_RESPONSE_CHUNKS_HPP
@@ -5,17 +5,35 @@
 
 #include "torii/query_service.hpp"
 
+#include <algorithm>
+
+#include <rxcpp/operators/rx-filter.hpp>
 #include <rxcpp/operators/rx-observe_on.hpp>
 #include <rxcpp/operators/rx-take_while.hpp>
 #include "backend/protobuf/query_responses/proto_block_query_response.hpp"
 #include "backend/protobuf/query_responses/proto_query_response.hpp"
+#include "backend/protobuf/transaction.hpp"
 #include "backend/protobuf/util.hpp"
+#include "common/allocation_tracking.hpp"
 #include "common/run_loop_handler.hpp"
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
 #include "cryptography/default_hash_provider.hpp"
+#include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
 #include "logger/logger.hpp"
+#include "network/impl/async_server_stream.hpp"
+#include "torii/impl/blocks_query_filter.hpp"
+#include "torii/impl/query_response_chunks.hpp"
 #include "validators/default_validator.hpp"
 
+namespace {
+  /// @return the message serialized to a buffer which can be sent many times
+  grpc::ByteBuffer serialize(const google::protobuf::Message &message) {
+    grpc::Slice slice(message.SerializeAsString());
+    return grpc::ByteBuffer(&slice, 1);
+  }
+}  // namespace
+
 namespace iroha {
   namespace torii {
 
@@ -23,14 +41,29 @@ namespace iroha {
         std::shared_ptr<iroha::torii::QueryProcessor> query_processor,
         std::shared_ptr<QueryFactoryType> query_factory,
         std::shared_ptr<BlocksQueryFactoryType> blocks_query_factory,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        bool async_block_streams,
+        PendingBatchEvents pending_batch_events,
+        std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
+        size_t stream_chunk_bytes,
+        std::shared_ptr<QueryFactoryType> batch_query_factory)
         : query_processor_{std::move(query_processor)},
           query_factory_{std::move(query_factory)},
           blocks_query_factory_{std::move(blocks_query_factory)},
-          log_{std::move(log)} {}
+          log_{std::move(log)},
+          async_block_streams_(async_block_streams),
+          pending_batch_events_(std::move(pending_batch_events)),
+          block_query_factory_(std::move(block_query_factory)),
+          stream_chunk_bytes_(stream_chunk_bytes),
+          batch_query_factory_(std::move(batch_query_factory)) {
+      if (async_block_streams_) {
+        MarkMethodAsync(kFetchCommitsMethod);
+      }
+    }
 
     void QueryService::Find(iroha::protocol::Query const &request,
                             iroha::protocol::QueryResponse &response) {
+      ScopedAllocationTag allocation_tag(AllocationTag::kTorii);
       shared_model::crypto::Hash hash;
       auto blobPayload = shared_model::proto::makeBlob(request.payload());
       hash = shared_model::crypto::DefaultHashProvider::makeHash(blobPayload);
@@ -68,10 +101,122 @@ namespace iroha {
       return grpc::Status::OK;
     }
 
+    grpc::Status QueryService::FindStream(
+        grpc::ServerContext *context,
+        const iroha::protocol::Query *request,
+        grpc::ServerWriter<iroha::protocol::QueryResponse> *writer) {
+      ScopedAllocationTag allocation_tag(AllocationTag::kTorii);
+      iroha::protocol::QueryResponse response;
+      Find(*request, response);
+      auto client_id = (boost::format("Peer: '%s'") % context->peer()).str();
+      if (not splitQueryResponse(
+              std::move(response),
+              stream_chunk_bytes_,
+              [context, writer](const auto &chunk) {
+                return not context->IsCancelled() and writer->Write(chunk);
+              })) {
+        log_->error("write to query stream has failed to client {}",
+                    client_id);
+      }
+      return grpc::Status::OK;
+    }
+
+    grpc::Status QueryService::FindBatch(
+        grpc::ServerContext *context,
+        const iroha::protocol::QueryBatch *request,
+        iroha::protocol::QueryBatchResponse *response) {
+      ScopedAllocationTag allocation_tag(AllocationTag::kTorii);
+      if (not batch_query_factory_) {
+        return grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                            "Query batches are not served.");
+      }
+      const auto &payload = request->payload();
+      if (payload.queries().empty()) {
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                            "The batch has no queries.");
+      }
+      if (static_cast<size_t>(payload.queries_size()) > kMaxBatchQueries) {
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                            "The batch has too many queries.");
+      }
+      const auto &creator = payload.queries(0).meta().creator_account_id();
+      for (const auto &query : payload.queries()) {
+        if (query.meta().creator_account_id() != creator) {
+          return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                              "The queries have different creators.");
+        }
+      }
+
+      auto blob = shared_model::proto::makeBlob(payload);
+      auto hash = shared_model::crypto::DefaultHashProvider::makeHash(blob);
+      if (cache_.findItem(hash)) {
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                            "The batch was already processed.");
+      }
+
+      using shared_model::crypto::DefaultCryptoAlgorithmType;
+      shared_model::crypto::PublicKey public_key{
+          shared_model::crypto::PublicKey::fromHexString(
+              request->signature().public_key())};
+      shared_model::crypto::Signed signed_data{
+          shared_model::crypto::Signed::fromHexString(
+              request->signature().signature())};
+      if (public_key.size() != DefaultCryptoAlgorithmType::kPublicKeyLength
+          or signed_data.size() != DefaultCryptoAlgorithmType::kSignatureLength
+          or not shared_model::crypto::CryptoVerifier<>::verify(
+                 signed_data, blob, public_key)) {
+        return grpc::Status(grpc::StatusCode::UNAUTHENTICATED,
+                            "The signature of the batch is invalid.");
+      }
+
+      // every query carries the signature of the batch, by which its
+      // signatory is validated against the creator
+      std::vector<std::unique_ptr<shared_model::interface::Query>> queries;
+      queries.reserve(payload.queries_size());
+      for (const auto &query_payload : payload.queries()) {
+        iroha::protocol::Query query;
+        *query.mutable_payload() = query_payload;
+        *query.mutable_signature() = request->signature();
+        auto error = batch_query_factory_->build(std::move(query))
+                         .match(
+                             [&queries](auto &&query) {
+                               queries.push_back(std::move(query.value));
+                               return std::string{};
+                             },
+                             [](auto &&error) {
+                               return std::move(error.error.error);
+                             });
+        if (not error.empty()) {
+          return grpc::Status(
+              grpc::StatusCode::INVALID_ARGUMENT,
+              "Query " + std::to_string(queries.size()) + " is invalid: "
+                  + error);
+        }
+      }
+
+      auto responses = query_processor_->queryBatchHandle(queries);
+      if (responses.size() != queries.size()) {
+        log_->error("Could not execute the batch of {} queries",
+                    queries.size());
+        return grpc::Status(grpc::StatusCode::INTERNAL,
+                            "Internal error while executing the batch.");
+      }
+      // TODO 18.02.2019 lebdron: IR-336 Replace cache
+      // 0 is used as a dummy value
+      cache_.addItem(hash, 0);
+      for (const auto &query_response : responses) {
+        *response->add_responses() =
+            static_cast<shared_model::proto::QueryResponse &>(*query_response)
+                .getTransport();
+      }
+      return grpc::Status::OK;
+    }
+
     grpc::Status QueryService::FetchCommits(
         grpc::ServerContext *context,
         const iroha::protocol::BlocksQuery *request,
         grpc::ServerWriter<iroha::protocol::BlockQueryResponse> *writer) {
+      ScopedAllocationTag allocation_tag(AllocationTag::kTorii);
       log_->debug("Fetching commits");
 
       rxcpp::schedulers::run_loop run_loop;
@@ -84,9 +229,11 @@ namespace iroha {
             rxcpp::composite_subscription subscription;
             std::string client_id =
                 (boost::format("Peer: '%s'") % context->peer()).str();
-            query_processor_->blocksQueryHandle(*query.value)
+            BlocksQueryFilter filter(request->filter());
+            query_processor_
+                ->blocksQueryHandle(*query.value, request->start_height(), 0)
                 .observe_on(current_thread)
-                .take_while([this, context, request, writer, client_id](
+                .take_while([this, context, request, writer, client_id, filter](
                                 const std::shared_ptr<
                                     shared_model::interface::BlockQueryResponse>
                                     response) {
@@ -99,12 +246,13 @@ namespace iroha {
                               request->meta().creator_account_id(),
                               *response);
 
-                  const auto &proto_response =
-                      std::static_pointer_cast<
-                          shared_model::proto::BlockQueryResponse>(response)
-                          ->getTransport();
+                  auto proto_response = filterResponse(filter, response);
+                  if (not proto_response) {
+                    // no transactions of the block match the filter
+                    return true;
+                  }
 
-                  if (not writer->Write(proto_response)) {
+                  if (not writer->Write(*proto_response)) {
                     log_->error("write to stream has failed to client {}",
                                 client_id);
                     return false;
@@ -143,5 +291,311 @@ namespace iroha {
       return grpc::Status::OK;
     }
 
+    grpc::Status QueryService::FetchPendingTransactions(
+        grpc::ServerContext *context,
+        const iroha::protocol::Query *request,
+        grpc::ServerWriter<iroha::protocol::PendingTransactionsStreamResponse>
+            *writer) {
+      ScopedAllocationTag allocation_tag(AllocationTag::kTorii);
+      log_->debug("Fetching pending transactions");
+      iroha::protocol::PendingTransactionsStreamResponse response;
+      auto &query_response = *response.mutable_query_response();
+      if (not request->payload().has_get_pending_transactions()) {
+        query_response.mutable_error_response()->set_reason(
+            iroha::protocol::ErrorResponse::STATELESS_INVALID);
+        query_response.mutable_error_response()->set_message(
+            "GetPendingTransactions query is expected");
+        writer->WriteLast(response, grpc::WriteOptions());
+        return grpc::Status::OK;
+      }
+
+      rxcpp::schedulers::run_loop run_loop;
+      auto current_thread = rxcpp::synchronize_in_one_worker(
+          rxcpp::schedulers::make_run_loop(run_loop));
+      // the events are buffered by the run loop from the moment of the
+      // subscription, so that none is lost while the query is executed
+      const auto &account_id = request->payload().meta().creator_account_id();
+      auto client_id = (boost::format("Peer: '%s'") % context->peer()).str();
+      rxcpp::composite_subscription subscription;
+      pending_batch_events_
+          .filter([account_id](const auto &event) {
+            return std::find(event.creators.begin(),
+                             event.creators.end(),
+                             account_id)
+                != event.creators.end();
+          })
+          .observe_on(current_thread)
+          .take_while([this, context, writer, client_id](const auto &event) {
+            if (context->IsCancelled()) {
+              log_->debug("Unsubscribed from pending transactions stream");
+              return false;
+            }
+
+            iroha::protocol::PendingTransactionsStreamResponse response;
+            auto &batch_event = *response.mutable_batch_event();
+            batch_event.set_batch_hash(event.batch->reducedHash().hex());
+            switch (event.type) {
+              case PendingTransactionStorage::BatchEvent::Type::kAdded:
+                batch_event.set_type(iroha::protocol::PendingBatchEvent::ADDED);
+                break;
+              case PendingTransactionStorage::BatchEvent::Type::kUpdated:
+                batch_event.set_type(
+                    iroha::protocol::PendingBatchEvent::UPDATED);
+                break;
+              case PendingTransactionStorage::BatchEvent::Type::kRemoved:
+                batch_event.set_type(
+                    iroha::protocol::PendingBatchEvent::REMOVED);
+                break;
+            }
+            if (event.type
+                != PendingTransactionStorage::BatchEvent::Type::kRemoved) {
+              for (const auto &tx : event.batch->transactions()) {
+                *batch_event.add_transactions() =
+                    std::static_pointer_cast<shared_model::proto::Transaction>(
+                        tx)
+                        ->getTransport();
+              }
+            }
+
+            if (not writer->Write(response)) {
+              log_->error("write to stream has failed to client {}",
+                          client_id);
+              return false;
+            }
+            return true;
+          })
+          .subscribe(subscription,
+                     [](const auto &) {},
+                     [this, &client_id](std::exception_ptr) {
+                       log_->error(
+                           "something bad happened during pending "
+                           "transactions streaming, client_id {}",
+                           client_id);
+                     },
+                     [this, &client_id] {
+                       log_->debug("pending transactions stream done, {}",
+                                   client_id);
+                     });
+
+      Find(*request, query_response);
+      if (query_response.has_error_response()) {
+        subscription.unsubscribe();
+        writer->WriteLast(response, grpc::WriteOptions());
+        return grpc::Status::OK;
+      }
+      if (not writer->Write(response)) {
+        subscription.unsubscribe();
+        return grpc::Status::OK;
+      }
+
+      iroha::schedulers::handleEvents(subscription, run_loop);
+      return grpc::Status::OK;
+    }
+
+    grpc::Status QueryService::GetTransactionProof(
+        grpc::ServerContext *context,
+        const iroha::protocol::TransactionProofRequest *request,
+        iroha::protocol::TransactionProofResponse *response) {
+      ScopedAllocationTag allocation_tag(AllocationTag::kTorii);
+      if (not block_query_factory_) {
+        return grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                            "Transaction proofs are not served.");
+      }
+      auto block_query = block_query_factory_->createBlockQuery();
+      if (not block_query) {
+        log_->error("Could not create block query to prove a transaction");
+        return grpc::Status(grpc::StatusCode::INTERNAL,
+                            "Internal error while retrieving block.");
+      }
+
+      auto block_result =
+          (*block_query)->getSerializedBlock(request->height());
+      if (auto e = expected::resultToOptionalError(block_result)) {
+        return e->code == ametsuchi::BlockQuery::GetBlockError::Code::kNoBlock
+            ? grpc::Status(grpc::StatusCode::NOT_FOUND, "No such block.")
+            : grpc::Status(grpc::StatusCode::INTERNAL,
+                           "Internal error while retrieving block.");
+      }
+      iroha::protocol::Block_v1 block;
+      if (not block.ParseFromString(
+              boost::get<expected::ValueOf<decltype(block_result)>>(
+                  block_result)
+                  .value)) {
+        log_->error("Could not parse a block from block storage");
+        return grpc::Status(grpc::StatusCode::INTERNAL,
+                            "Internal error while parsing block.");
+      }
+
+      const auto &payload = block.payload();
+      auto tree = transactionsTree(payload);
+      if (not tree) {
+        return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION,
+                            "The block has no root of its transactions.");
+      }
+      for (int i = 0; i < payload.transactions_size(); ++i) {
+        auto hash = shared_model::crypto::DefaultHashProvider::makeHash(
+            shared_model::proto::makeBlob(payload.transactions(i).payload()));
+        if (hash.hex() == request->tx_hash()) {
+          *response->mutable_transactions_root() = payload.transactions_root();
+          response->set_tx_number(payload.transactions_size());
+          *response->mutable_proof() = makeTransactionProof(*tree, i);
+          return grpc::Status::OK;
+        }
+      }
+      return grpc::Status(grpc::StatusCode::NOT_FOUND,
+                          "The block has no such transaction.");
+    }
+
+    std::shared_ptr<const iroha::protocol::BlockQueryResponse>
+    QueryService::filterResponse(
+        const BlocksQueryFilter &filter,
+        const std::shared_ptr<shared_model::interface::BlockQueryResponse>
+            &response) {
+      auto proto_response =
+          std::static_pointer_cast<shared_model::proto::BlockQueryResponse>(
+              response);
+      std::shared_ptr<const iroha::protocol::BlockQueryResponse> transport(
+          proto_response, &proto_response->getTransport());
+      if (filter.empty() or not transport->has_block_response()) {
+        return transport;
+      }
+
+      const auto &block = transport->block_response().block().block_v1();
+      auto key = blockKey(filter, block.payload().height());
+      if (auto filtered = filtered_blocks_.findItem(key)) {
+        return *filtered;
+      }
+      auto filtered = filter.apply(block);
+      filtered_blocks_.addItem(key, filtered);
+      return filtered;
+    }
+
+    std::shared_ptr<const grpc::ByteBuffer> QueryService::serializedResponse(
+        const BlocksQueryFilter &filter,
+        const std::shared_ptr<shared_model::interface::BlockQueryResponse>
+            &response) {
+      const auto &transport =
+          std::static_pointer_cast<shared_model::proto::BlockQueryResponse>(
+              response)
+              ->getTransport();
+      if (not transport.has_block_response()) {
+        return std::make_shared<const grpc::ByteBuffer>(serialize(transport));
+      }
+
+      auto key = blockKey(
+          filter,
+          transport.block_response().block().block_v1().payload().height());
+      if (auto serialized = serialized_blocks_.findItem(key)) {
+        return *serialized;
+      }
+      std::shared_ptr<const grpc::ByteBuffer> serialized;
+      if (auto filtered = filterResponse(filter, response)) {
+        serialized = std::make_shared<const grpc::ByteBuffer>(
+            serialize(*filtered));
+      }
+      serialized_blocks_.addItem(key, serialized);
+      return serialized;
+    }
+
+    std::string QueryService::blockKey(const BlocksQueryFilter &filter,
+                                       uint64_t height) {
+      return filter.key() + ":" + std::to_string(height);
+    }
+
+    bool QueryService::hasAsyncMethods() const {
+      return async_block_streams_;
+    }
+
+    void QueryService::requestCalls(grpc::ServerCompletionQueue &queue) {
+      if (not async_block_streams_) {
+        return;
+      }
+      // the blocks are serialized once for all the streams
+      using Stream = network::AsyncServerStream<iroha::protocol::BlocksQuery,
+                                                grpc::ByteBuffer>;
+      Stream::request(
+          [this](auto context,
+                 auto request,
+                 auto writer,
+                 auto call_queue,
+                 auto tag) {
+            this->RequestAsyncServerStreaming(kFetchCommitsMethod,
+                                              context,
+                                              request,
+                                              writer,
+                                              call_queue,
+                                              call_queue,
+                                              tag);
+          },
+          queue,
+          [this](const auto &request, std::shared_ptr<Stream> stream) {
+            log_->debug("Fetching commits");
+            blocks_query_factory_->build(request).match(
+                [this, &request, &stream](const auto &query) {
+                  auto client_id =
+                      (boost::format("Peer: '%s'") % stream->context().peer())
+                          .str();
+                  auto creator = request.meta().creator_account_id();
+                  BlocksQueryFilter filter(request.filter());
+                  // the committed blocks are written at once, so they
+                  // leave the half of the queue to the new ones
+                  query_processor_
+                      ->blocksQueryHandle(*query.value,
+                                          request.start_height(),
+                                          kMaxQueuedBlocks / 2)
+                      .take_while([stream](const auto &) {
+                        return not stream->isCancelled();
+                      })
+                      .subscribe(
+                          stream->subscription(),
+                          [this, stream, creator, filter](
+                              const auto &response) {
+                            log_->debug("{} receives {}", creator, *response);
+                            auto serialized =
+                                serializedResponse(filter, response);
+                            if (not serialized) {
+                              return;
+                            }
+                            if (not stream->write(*serialized)) {
+                              log_->warn("client {} is too slow, dropped",
+                                         creator);
+                              return;
+                            }
+                            // the stream ends with the error response
+                            if (not iroha::visit_in_place(
+                                    response->get(),
+                                    [](const shared_model::interface::
+                                           BlockResponse &) { return true; },
+                                    [](const shared_model::interface::
+                                           BlockErrorResponse &) {
+                                      return false;
+                                    })) {
+                              stream->finish();
+                            }
+                          },
+                          [this, stream, client_id](std::exception_ptr) {
+                            log_->error(
+                                "something bad happened during block "
+                                "streaming, client_id {}",
+                                client_id);
+                            stream->finish();
+                          },
+                          [this, stream, client_id] {
+                            log_->debug("block stream done, {}", client_id);
+                            stream->finish();
+                          });
+                },
+                [this, &stream](auto &&error) {
+                  log_->debug("Stateless invalid: {}", error.error.error);
+                  iroha::protocol::BlockQueryResponse response;
+                  response.mutable_block_error_response()->set_message(
+                      std::move(error.error.error));
+                  stream->write(serialize(response));
+                  stream->finish();
+                });
+          },
+          kMaxQueuedBlocks);
+    }
+
   }  // namespace torii
 }  // namespace iroha
@@ -5,21 +5,132 @@
 
 #include "torii/impl/status_bus_impl.hpp"
 
+#include <algorithm>
+
+namespace {
+  constexpr size_t kDeliveryLagBuckets = 16;
+}  // namespace
+
 namespace iroha {
   namespace torii {
     StatusBusImpl::StatusBusImpl(rxcpp::observe_on_one_worker worker)
-        : worker_(worker), subject_(worker_, cs_) {}
+        : StatusBusImpl(
+              std::vector<rxcpp::observe_on_one_worker>{std::move(worker)}) {}
+
+    StatusBusImpl::StatusBusImpl(size_t workers)
+        : StatusBusImpl([workers] {
+            std::vector<rxcpp::observe_on_one_worker> new_threads;
+            for (size_t i = 0; i < std::max<size_t>(workers, 1); ++i) {
+              new_threads.push_back(
+                  observeOnNamedThread("status-bus-" + std::to_string(i)));
+            }
+            return new_threads;
+          }()) {}
+
+    StatusBusImpl::StatusBusImpl(
+        std::vector<rxcpp::observe_on_one_worker> workers)
+        : subject_(cs_),
+          subscribers_(std::make_shared<Subscribers>()),
+          delivery_lag_(
+              Histogram::exponentialBounds(1, 4, kDeliveryLagBuckets)) {
+      shards_.reserve(workers.size());
+      for (auto &worker : workers) {
+        shards_.emplace_back(std::move(worker), cs_);
+        shards_.back().get_observable().subscribe(
+            cs_,
+            [this](const Published &published) { this->deliver(published); });
+      }
+    }
 
     StatusBusImpl::~StatusBusImpl() {
       cs_.unsubscribe();
     }
 
     void StatusBusImpl::publish(StatusBus::Objects resp) {
-      subject_.get_subscriber().on_next(resp);
+      auto &shard = shards_[shared_model::crypto::Hash::Hasher{}(
+                                resp->transactionHash())
+                            % shards_.size()];
+      shard.get_subscriber().on_next(
+          Published{std::move(resp), std::chrono::steady_clock::now()});
     }
 
     rxcpp::observable<StatusBus::Objects> StatusBusImpl::statuses() {
       return subject_.get_observable();
     }
+
+    rxcpp::observable<StatusBus::Objects> StatusBusImpl::statuses(
+        const shared_model::crypto::Hash &hash) {
+      return rxcpp::observable<>::create<StatusBus::Objects>(
+          [subscribers = subscribers_,
+           hash](rxcpp::subscriber<StatusBus::Objects> subscriber) {
+            {
+              std::lock_guard<std::mutex> lock(subscribers->mutex);
+              subscribers->by_hash[hash].push_back(subscriber);
+              ++subscribers->count;
+            }
+            subscriber.add([weak_subscribers = std::weak_ptr<Subscribers>(
+                                subscribers),
+                            hash,
+                            subscription = subscriber.get_subscription()] {
+              auto subscribers = weak_subscribers.lock();
+              if (not subscribers) {
+                return;
+              }
+              std::lock_guard<std::mutex> lock(subscribers->mutex);
+              auto it = subscribers->by_hash.find(hash);
+              if (it == subscribers->by_hash.end()) {
+                return;
+              }
+              auto &hash_subscribers = it->second;
+              auto removed = std::remove_if(
+                  hash_subscribers.begin(),
+                  hash_subscribers.end(),
+                  [&subscription](const auto &hash_subscriber) {
+                    return hash_subscriber.get_subscription() == subscription;
+                  });
+              subscribers->count -=
+                  std::distance(removed, hash_subscribers.end());
+              hash_subscribers.erase(removed, hash_subscribers.end());
+              if (hash_subscribers.empty()) {
+                subscribers->by_hash.erase(it);
+              }
+            });
+          });
+    }
+
+    size_t StatusBusImpl::transactionSubscribers() const {
+      std::lock_guard<std::mutex> lock(subscribers_->mutex);
+      return subscribers_->count;
+    }
+
+    const Histogram &StatusBusImpl::deliveryLag() const {
+      return delivery_lag_;
+    }
+
+    void StatusBusImpl::deliver(const Published &published) {
+      delivery_lag_.observe(
+          std::chrono::duration_cast<std::chrono::microseconds>(
+              std::chrono::steady_clock::now() - published.time)
+              .count());
+      {
+        std::lock_guard<std::mutex> lock(subject_mutex_);
+        subject_.get_subscriber().on_next(published.object);
+      }
+
+      // the subscribers are copied, since they may unsubscribe on delivery
+      std::vector<rxcpp::subscriber<StatusBus::Objects>> hash_subscribers;
+      {
+        std::lock_guard<std::mutex> lock(subscribers_->mutex);
+        auto it =
+            subscribers_->by_hash.find(published.object->transactionHash());
+        if (it == subscribers_->by_hash.end()) {
+          return;
+        }
+        hash_subscribers = it->second;
+      }
+      for (auto &subscriber : hash_subscribers) {
+        subscriber.on_next(published.object);
+      }
+    }
   }  // namespace torii
 }  // namespace iroha
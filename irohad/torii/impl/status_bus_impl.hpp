@@ -8,31 +8,84 @@
 
 #include "torii/status_bus.hpp"
 
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 #include <rxcpp/rx-lite.hpp>
 
 #include <rxcpp/operators/rx-observe_on.hpp>
+#include "common/histogram.hpp"
+#include "common/named_thread.hpp"
 
 namespace iroha {
   namespace torii {
     /**
-     * StatusBus implementation
+     * StatusBus implementation. The statuses are delivered by the workers,
+     * each serving the statuses of a part of the transaction hashes, so the
+     * statuses of one transaction are delivered in the order of publication
      */
     class StatusBusImpl : public StatusBus {
      public:
-      StatusBusImpl(
-          rxcpp::observe_on_one_worker worker = rxcpp::observe_on_new_thread());
+      StatusBusImpl(rxcpp::observe_on_one_worker worker =
+                        observeOnNamedThread("status-bus"));
+
+      /**
+       * @param workers - number of the threads delivering the statuses
+       */
+      explicit StatusBusImpl(size_t workers);
+
+      /**
+       * @param workers - workers delivering the statuses, at least one
+       */
+      explicit StatusBusImpl(std::vector<rxcpp::observe_on_one_worker> workers);
 
       ~StatusBusImpl() override;
 
       void publish(StatusBus::Objects) override;
       /// Subscribers will be invoked in separate thread
       rxcpp::observable<StatusBus::Objects> statuses() override;
+      /// Subscribers will be invoked in separate thread
+      rxcpp::observable<StatusBus::Objects> statuses(
+          const shared_model::crypto::Hash &hash) override;
+
+      /// number of the subscribers to the statuses of particular transactions
+      size_t transactionSubscribers() const;
+
+      /// time in us from the publication of a status to its delivery
+      const Histogram &deliveryLag() const;
+
+     private:
+      /// status with the time of its publication
+      struct Published {
+        StatusBus::Objects object;
+        std::chrono::steady_clock::time_point time;
+      };
+
+      /// subscribers to the statuses of particular transactions
+      struct Subscribers {
+        std::mutex mutex;
+        std::unordered_map<shared_model::crypto::Hash,
+                           std::vector<rxcpp::subscriber<StatusBus::Objects>>,
+                           shared_model::crypto::Hash::Hasher>
+            by_hash;
+        size_t count = 0;
+      };
+
+      void deliver(const Published &published);
+
+      using Shard =
+          rxcpp::subjects::synchronize<Published, rxcpp::observe_on_one_worker>;
 
-      // Need to create once, otherwise will create thread for each subscriber
-      rxcpp::observe_on_one_worker worker_;
       rxcpp::composite_subscription cs_;
-      rxcpp::subjects::synchronize<StatusBus::Objects, decltype(worker_)>
-          subject_;
+      // Need to create once, otherwise will create thread for each subscriber
+      std::vector<Shard> shards_;
+      /// serializes the deliveries to the subscribers of all statuses
+      std::mutex subject_mutex_;
+      rxcpp::subjects::subject<StatusBus::Objects> subject_;
+      std::shared_ptr<Subscribers> subscribers_;
+      Histogram delivery_lag_;
     };
   }  // namespace torii
 }  // namespace iroha
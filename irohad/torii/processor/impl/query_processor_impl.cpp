@@ -5,8 +5,12 @@
 
 #include "torii/processor/query_processor_impl.hpp"
 
+#include <mutex>
+
 #include <boost/range/size.hpp>
+#include "ametsuchi/block_query.hpp"
 #include "common/bind.hpp"
+#include "common/visitor.hpp"
 #include "interfaces/queries/blocks_query.hpp"
 #include "interfaces/queries/query.hpp"
 #include "interfaces/query_responses/block_query_response.hpp"
@@ -15,6 +19,22 @@
 #include "logger/logger.hpp"
 #include "validation/utils.hpp"
 
+namespace {
+  /// @return height of the block of the response, none for the error
+  boost::optional<shared_model::interface::types::HeightType> blockHeight(
+      const shared_model::interface::BlockQueryResponse &response) {
+    return iroha::visit_in_place(
+        response.get(),
+        [](const shared_model::interface::BlockResponse &response) {
+          return boost::make_optional(response.block().height());
+        },
+        [](const auto &)
+            -> boost::optional<shared_model::interface::types::HeightType> {
+          return boost::none;
+        });
+  }
+}  // namespace
+
 namespace iroha {
   namespace torii {
 
@@ -24,14 +44,19 @@ namespace iroha {
         std::shared_ptr<iroha::PendingTransactionStorage> pending_transactions,
         std::shared_ptr<shared_model::interface::QueryResponseFactory>
             response_factory,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        std::shared_ptr<QueryResponseCache> response_cache)
         : storage_{std::move(storage)},
           qry_exec_{std::move(qry_exec)},
           pending_transactions_{std::move(pending_transactions)},
           response_factory_{std::move(response_factory)},
-          log_{std::move(log)} {
+          log_{std::move(log)},
+          response_cache_{std::move(response_cache)} {
       storage_->on_commit().subscribe(
           [this](std::shared_ptr<const shared_model::interface::Block> block) {
+            if (response_cache_) {
+              response_cache_->invalidate();
+            }
             auto block_response =
                 response_factory_->createBlockQueryResponse(block);
             blocks_query_subject_.get_subscriber().on_next(
@@ -48,13 +73,48 @@ namespace iroha {
         return nullptr;
       }
 
-      return executor.value()->validateAndExecute(qry, true);
+      auto key = response_cache_ ? QueryResponseCache::makeKey(qry)
+                                 : boost::none;
+      if (not key) {
+        return executor.value()->validateAndExecute(qry, true);
+      }
+
+      // the signatories are validated for every query, and the invalid ones
+      // get the error response of the executor
+      if (auto response = response_cache_->find(*key, qry.hash())) {
+        if (executor.value()->validateSignatories(qry)) {
+          return response;
+        }
+      }
+      auto version = response_cache_->version();
+      auto response = executor.value()->validateAndExecute(qry, true);
+      if (response) {
+        response_cache_->put(*key, *response, version);
+      }
+      return response;
+    }
+
+    std::vector<std::unique_ptr<shared_model::interface::QueryResponse>>
+    QueryProcessorImpl::queryBatchHandle(
+        const std::vector<std::unique_ptr<shared_model::interface::Query>>
+            &queries) {
+      auto executor = qry_exec_->createQueryExecutor(pending_transactions_,
+                                                     response_factory_);
+      if (not executor) {
+        log_->error("Cannot create query executor");
+        return {};
+      }
+      // the cached responses are not used, since they may be of other
+      // snapshots than the one of the batch
+      return executor.value()->validateAndExecuteBatch(queries, true);
     }
 
     rxcpp::observable<
         std::shared_ptr<shared_model::interface::BlockQueryResponse>>
     QueryProcessorImpl::blocksQueryHandle(
-        const shared_model::interface::BlocksQuery &qry) {
+        const shared_model::interface::BlocksQuery &qry,
+        shared_model::interface::types::HeightType start_height,
+        size_t max_backlog) {
       auto exec = qry_exec_->createQueryExecutor(pending_transactions_,
                                                  response_factory_);
       if (not exec or not(exec | [&qry](const auto &executor) {
@@ -64,7 +124,102 @@ namespace iroha {
             response_factory_->createBlockQueryResponse("stateful invalid");
         return rxcpp::observable<>::just(std::move(response));
       }
-      return blocks_query_subject_.get_observable();
+      if (start_height == 0) {
+        return blocks_query_subject_.get_observable();
+      }
+      return catchUp(start_height, max_backlog);
+    }
+
+    rxcpp::observable<
+        std::shared_ptr<shared_model::interface::BlockQueryResponse>>
+    QueryProcessorImpl::catchUp(
+        shared_model::interface::types::HeightType start_height,
+        size_t max_backlog) {
+      using Response =
+          std::shared_ptr<shared_model::interface::BlockQueryResponse>;
+      struct State {
+        std::mutex mutex;
+        bool caught_up = false;
+        shared_model::interface::types::HeightType next_height;
+        std::vector<Response> pending;
+      };
+
+      return rxcpp::observable<>::create<Response>(
+          [this, start_height, max_backlog](auto subscriber) {
+            auto state = std::make_shared<State>();
+            state->next_height = start_height;
+            // must be called with the mutex locked
+            auto emit = [subscriber, state](const Response &response) {
+              if (not subscriber.is_subscribed()) {
+                return;
+              }
+              if (auto height = blockHeight(*response)) {
+                if (*height < state->next_height) {
+                  return;
+                }
+                state->next_height = *height + 1;
+              }
+              subscriber.on_next(response);
+            };
+            auto fail = [this, subscriber](std::string message) {
+              log_->warn("Blocks stream from height failed: {}", message);
+              subscriber.on_next(
+                  Response(response_factory_->createBlockQueryResponse(
+                      std::move(message))));
+              subscriber.on_completed();
+            };
+
+            // the blocks committed from now on are buffered until the committed
+            // ones are streamed, so none of them is missed
+            blocks_query_subject_.get_observable().subscribe(
+                subscriber.get_subscription(),
+                [state, emit](const Response &response) {
+                  std::lock_guard<std::mutex> lock(state->mutex);
+                  if (state->caught_up) {
+                    emit(response);
+                  } else {
+                    state->pending.push_back(response);
+                  }
+                });
+
+            auto block_query = storage_->getBlockQuery();
+            if (not block_query) {
+              fail("could not read the committed blocks");
+              return;
+            }
+            const auto top_height = block_query->getTopBlockHeight();
+            if (max_backlog != 0 and top_height >= start_height
+                and top_height - start_height >= max_backlog) {
+              fail("the start height is more than "
+                   + std::to_string(max_backlog) + " blocks behind");
+              return;
+            }
+            for (auto height = start_height;
+                 height <= top_height and subscriber.is_subscribed();
+                 ++height) {
+              auto block = block_query->getBlock(height);
+              if (auto e = expected::resultToOptionalError(block)) {
+                fail("could not read the block " + std::to_string(height) + ": "
+                     + e->message);
+                return;
+              }
+              std::shared_ptr<const shared_model::interface::Block> value =
+                  std::move(boost::get<expected::ValueOf<decltype(block)>>(
+                                block)
+                                .value);
+              Response response(response_factory_->createBlockQueryResponse(
+                  std::move(value)));
+              std::lock_guard<std::mutex> lock(state->mutex);
+              emit(response);
+            }
+
+            std::lock_guard<std::mutex> lock(state->mutex);
+            for (const auto &response : state->pending) {
+              emit(response);
+            }
+            state->pending.clear();
+            state->caught_up = true;
+          });
     }
 
   }  // namespace torii
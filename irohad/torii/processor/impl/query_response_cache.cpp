@@ -0,0 +1,120 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/processor/query_response_cache.hpp"
+
+#include <boost/variant.hpp>
+#include "backend/protobuf/query_responses/proto_query_response.hpp"
+#include "common/visitor.hpp"
+#include "interfaces/queries/get_account_assets.hpp"
+#include "interfaces/queries/get_account_detail.hpp"
+#include "interfaces/queries/query.hpp"
+
+using namespace iroha::torii;
+
+QueryResponseCache::QueryResponseCache(size_t capacity)
+    : capacity_(capacity),
+      version_(0),
+      hits_(std::make_shared<Counter>()),
+      misses_(std::make_shared<Counter>()) {}
+
+boost::optional<std::string> QueryResponseCache::makeKey(
+    const shared_model::interface::Query &query) {
+  auto arguments = iroha::visit_in_place(
+      query.get(),
+      [](const shared_model::interface::GetAccountAssets &q)
+          -> boost::optional<std::string> { return q.toString(); },
+      [](const shared_model::interface::GetAccountDetail &q)
+          -> boost::optional<std::string> { return q.toString(); },
+      [](const auto &) -> boost::optional<std::string> {
+        return boost::none;
+      });
+  if (not arguments) {
+    return boost::none;
+  }
+  return query.creatorAccountId() + "\n" + *arguments;
+}
+
+QueryResponseCache::Version QueryResponseCache::version() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return version_;
+}
+
+std::unique_ptr<shared_model::interface::QueryResponse>
+QueryResponseCache::find(
+    const std::string &key,
+    const shared_model::interface::types::HashType &query_hash) const {
+  iroha::protocol::QueryResponse response;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      misses_->increment();
+      return nullptr;
+    }
+    hits_->increment();
+    entries_.splice(entries_.begin(), entries_, it->second);
+    response = it->second->second;
+  }
+  response.set_query_hash(query_hash.hex());
+  return std::make_unique<shared_model::proto::QueryResponse>(
+      std::move(response));
+}
+
+void QueryResponseCache::put(
+    const std::string &key,
+    const shared_model::interface::QueryResponse &response,
+    Version version) {
+  auto proto_response =
+      dynamic_cast<const shared_model::proto::QueryResponse *>(&response);
+  if (proto_response == nullptr) {
+    return;
+  }
+  const auto &transport = proto_response->getTransport();
+  if (not transport.has_account_assets_response()
+      and not transport.has_account_detail_response()) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (capacity_ == 0 or version != version_ or index_.count(key) != 0) {
+    return;
+  }
+  if (entries_.size() == capacity_) {
+    index_.erase(entries_.back().first);
+    entries_.pop_back();
+  }
+  entries_.emplace_front(key, transport);
+  index_.emplace(key, entries_.begin());
+}
+
+void QueryResponseCache::invalidate() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+  index_.clear();
+  ++version_;
+}
+
+void QueryResponseCache::setCapacity(size_t capacity) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  capacity_ = capacity;
+  while (entries_.size() > capacity_) {
+    index_.erase(entries_.back().first);
+    entries_.pop_back();
+  }
+}
+
+size_t QueryResponseCache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+std::shared_ptr<const iroha::Counter> QueryResponseCache::hits() const {
+  return hits_;
+}
+
+std::shared_ptr<const iroha::Counter> QueryResponseCache::misses() const {
+  return misses_;
+}
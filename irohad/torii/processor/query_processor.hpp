@@ -9,6 +9,9 @@
 #include <rxcpp/rx-observable-fwd.hpp>
 
 #include <memory>
+#include <vector>
+
+#include "interfaces/common_objects/types.hpp"
 
 namespace shared_model {
   namespace interface {
@@ -34,14 +37,34 @@ namespace iroha {
        */
       virtual std::unique_ptr<shared_model::interface::QueryResponse>
       queryHandle(const shared_model::interface::Query &qry) = 0;
+      /**
+       * Perform the client queries of a batch on one snapshot of the ledger
+       * @param queries - client intents of the same creator and signatory
+       * @return resulted responses in the order of the queries, empty if
+       * the queries could not be performed
+       */
+      virtual std::vector<
+          std::unique_ptr<shared_model::interface::QueryResponse>>
+      queryBatchHandle(
+          const std::vector<std::unique_ptr<shared_model::interface::Query>>
+              &queries) = 0;
       /**
        * Register client blocks query
        * @param query - client intent
+       * @param start_height - height of the first block to stream, the
+       * committed blocks from it are streamed before the new ones without a
+       * gap or a duplicate; 0 streams only the new blocks
+       * @param max_backlog - the most committed blocks the stream may start
+       * with, the query with a longer backlog gets the error response;
+       * 0 for no limit
        * @return observable with block query responses
        */
       virtual rxcpp::observable<
           std::shared_ptr<shared_model::interface::BlockQueryResponse>>
-      blocksQueryHandle(const shared_model::interface::BlocksQuery &qry) = 0;
+      blocksQueryHandle(
+          const shared_model::interface::BlocksQuery &qry,
+          shared_model::interface::types::HeightType start_height,
+          size_t max_backlog) = 0;
 
       virtual ~QueryProcessor(){};
     };
@@ -12,6 +12,7 @@
 #include "ametsuchi/storage.hpp"
 #include "interfaces/iroha_internal/query_response_factory.hpp"
 #include "logger/logger_fwd.hpp"
+#include "torii/processor/query_response_cache.hpp"
 
 namespace iroha {
   namespace torii {
@@ -21,6 +22,10 @@ namespace iroha {
      */
     class QueryProcessorImpl : public QueryProcessor {
      public:
+      /**
+       * @param response_cache - cache of the responses to the read-heavy
+       * queries, which is invalidated on commit, nullptr disables the cache
+       */
       QueryProcessorImpl(
           std::shared_ptr<ametsuchi::Storage> storage,
           std::shared_ptr<ametsuchi::QueryExecutorFactory> qry_exec,
@@ -28,17 +33,35 @@ namespace iroha {
               pending_transactions,
           std::shared_ptr<shared_model::interface::QueryResponseFactory>
               response_factory,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::shared_ptr<QueryResponseCache> response_cache = nullptr);
 
       std::unique_ptr<shared_model::interface::QueryResponse> queryHandle(
           const shared_model::interface::Query &qry) override;
 
+      std::vector<std::unique_ptr<shared_model::interface::QueryResponse>>
+      queryBatchHandle(
+          const std::vector<std::unique_ptr<shared_model::interface::Query>>
+              &queries) override;
+
       rxcpp::observable<
           std::shared_ptr<shared_model::interface::BlockQueryResponse>>
       blocksQueryHandle(
-          const shared_model::interface::BlocksQuery &qry) override;
+          const shared_model::interface::BlocksQuery &qry,
+          shared_model::interface::types::HeightType start_height,
+          size_t max_backlog) override;
 
      private:
+      /**
+       * Stream the committed blocks from the start height and then the new
+       * ones. The new blocks are buffered while the committed ones are read,
+       * and the heights already streamed are skipped
+       */
+      rxcpp::observable<
+          std::shared_ptr<shared_model::interface::BlockQueryResponse>>
+      catchUp(shared_model::interface::types::HeightType start_height,
+              size_t max_backlog);
+
       rxcpp::subjects::subject<
           std::shared_ptr<shared_model::interface::BlockQueryResponse>>
           blocks_query_subject_;
@@ -49,6 +72,7 @@ namespace iroha {
           response_factory_;
 
       logger::LoggerPtr log_;
+      std::shared_ptr<QueryResponseCache> response_cache_;
     };
 
   }  // namespace torii
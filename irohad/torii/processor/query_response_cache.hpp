@@ -0,0 +1,111 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_QUERY_RESPONSE_CACHE_HPP
+#define IROHA_QUERY_RESPONSE_CACHE_HPP
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <boost/optional.hpp>
+#include "common/counter.hpp"
+#include "interfaces/common_objects/types.hpp"
+#include "qry_responses.pb.h"
+
+namespace shared_model {
+  namespace interface {
+    class Query;
+    class QueryResponse;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * Cache of the successful responses to the read-heavy GetAccountAssets
+     * and GetAccountDetail queries of the least recently used accounts at
+     * the current ledger height. The responses are keyed by the creator and
+     * the arguments of the query: the permissions of the creator change only
+     * on commit, and the whole cache is invalidated on every commit, so a
+     * response is never returned to a creator whose permissions differ. The
+     * version of the cache is changed on invalidation, so the responses
+     * executed before the commit are not put to the cache afterwards
+     */
+    class QueryResponseCache {
+     public:
+      using Version = uint64_t;
+
+      /**
+       * @param capacity - maximal number of the cached responses
+       */
+      explicit QueryResponseCache(size_t capacity);
+
+      /// @return key of the response to the query, none if it is not cached
+      static boost::optional<std::string> makeKey(
+          const shared_model::interface::Query &query);
+
+      /// @return version of the cache, which is to be passed to put
+      Version version() const;
+
+      /**
+       * @return the cached response, which becomes the most recently used
+       * one, made for the query with the given hash, or nullptr
+       */
+      std::unique_ptr<shared_model::interface::QueryResponse> find(
+          const std::string &key,
+          const shared_model::interface::types::HashType &query_hash) const;
+
+      /**
+       * Put the successful response to the cache, and evict the least
+       * recently used ones
+       * @param version - version of the cache before the query was executed,
+       * the response is not put if a block has been committed since then
+       */
+      void put(const std::string &key,
+               const shared_model::interface::QueryResponse &response,
+               Version version);
+
+      /// drop all responses after the ledger is changed
+      void invalidate();
+
+      /**
+       * Change the max number of the cached responses, and evict the least
+       * recently used ones over it
+       */
+      void setCapacity(size_t capacity);
+
+      /// @return number of the cached responses
+      size_t size() const;
+
+      /// @return number of the cacheable queries answered from the cache
+      std::shared_ptr<const Counter> hits() const;
+
+      /// @return number of the cacheable queries which were executed
+      std::shared_ptr<const Counter> misses() const;
+
+     private:
+      using Entries =
+          std::list<std::pair<std::string, iroha::protocol::QueryResponse>>;
+
+      size_t capacity_;
+
+      mutable std::mutex mutex_;
+      Version version_;
+      /// cached responses from the most recently used one
+      mutable Entries entries_;
+      std::unordered_map<std::string, Entries::iterator> index_;
+
+      std::shared_ptr<Counter> hits_;
+      std::shared_ptr<Counter> misses_;
+    };
+
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // IROHA_QUERY_RESPONSE_CACHE_HPP
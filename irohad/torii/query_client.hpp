@@ -35,6 +35,25 @@ namespace torii_utils {
     grpc::Status Find(const iroha::protocol::Query &query,
                       iroha::protocol::QueryResponse &response) const;
 
+    /**
+     * requests query to a torii server and returns the chunks of its
+     * response (blocking, sync)
+     * @param query - contains Query what clients request.
+     * @return chunks of the response in the order they are streamed
+     */
+    std::vector<iroha::protocol::QueryResponse> FindStream(
+        const iroha::protocol::Query &query) const;
+
+    /**
+     * requests the queries of a batch to a torii server and returns their
+     * responses (blocking, sync)
+     * @param batch - queries signed together
+     * @param response - responses in the order of the queries
+     * @return grpc::Status
+     */
+    grpc::Status FindBatch(const iroha::protocol::QueryBatch &batch,
+                           iroha::protocol::QueryBatchResponse &response) const;
+
     std::vector<iroha::protocol::BlockQueryResponse> FetchCommits(
         const iroha::protocol::BlocksQuery &blocks_query) const;
 
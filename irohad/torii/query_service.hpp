@@ -11,11 +11,15 @@
 #include "endpoint.pb.h"
 #include "qry_responses.pb.h"
 
+#include "ametsuchi/block_query_factory.hpp"
 #include "backend/protobuf/queries/proto_blocks_query.hpp"
 #include "backend/protobuf/queries/proto_query.hpp"
 #include "builders/protobuf/transport_builder.hpp"
 #include "cache/cache.hpp"
+#include "cache/sharded_cache.hpp"
 #include "logger/logger_fwd.hpp"
+#include "network/async_call.hpp"
+#include "pending_txs_storage/pending_txs_storage.hpp"
 #include "torii/processor/query_processor.hpp"
 
 namespace shared_model {
@@ -27,12 +31,15 @@ namespace shared_model {
 
 namespace iroha {
   namespace torii {
+    class BlocksQueryFilter;
+
     /**
      * Actual implementation of async QueryService.
      * ToriiServiceHandler::(SomeMethod)Handler calls a corresponding method in
      * this class.
      */
-    class QueryService : public iroha::protocol::QueryService_v1::Service {
+    class QueryService : public iroha::protocol::QueryService_v1::Service,
+                         public network::AsyncCallHandler {
      public:
       using QueryFactoryType =
           shared_model::interface::AbstractTransportFactory<
@@ -43,11 +50,43 @@ namespace iroha {
               shared_model::interface::BlocksQuery,
               iroha::protocol::BlocksQuery>;
 
+      using PendingBatchEvents =
+          rxcpp::observable<PendingTransactionStorage::BatchEvent>;
+
+      /// size limit of a message of FindStream
+      static constexpr size_t kDefaultStreamChunkBytes = 1024 * 1024;
+
+      /// limit of the number of the queries of a FindBatch request
+      static constexpr size_t kMaxBatchQueries = 256;
+
+      /**
+       * @param async_block_streams - whether the FetchCommits streams are
+       * handled on the completion queues of the server instead of a thread
+       * per stream
+       * @param pending_batch_events - changes of the pending batches, which
+       * are streamed by FetchPendingTransactions
+       * @param block_query_factory - committed blocks, by which the
+       * transactions are proved, GetTransactionProof is unimplemented without
+       * it
+       * @param stream_chunk_bytes - size limit of a message of FindStream
+       * @param batch_query_factory - factory of the queries of FindBatch,
+       * which validates them without their signatures, since the signature
+       * of the batch is verified by the service. FindBatch is unimplemented
+       * without it
+       */
       QueryService(
           std::shared_ptr<iroha::torii::QueryProcessor> query_processor,
           std::shared_ptr<QueryFactoryType> query_factory,
           std::shared_ptr<BlocksQueryFactoryType> blocks_query_factory,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          bool async_block_streams = false,
+          PendingBatchEvents pending_batch_events =
+              rxcpp::observable<>::never<
+                  PendingTransactionStorage::BatchEvent>(),
+          std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory =
+              nullptr,
+          size_t stream_chunk_bytes = kDefaultStreamChunkBytes,
+          std::shared_ptr<QueryFactoryType> batch_query_factory = nullptr);
 
       QueryService(const QueryService &) = delete;
       QueryService &operator=(const QueryService &) = delete;
@@ -70,7 +109,94 @@ namespace iroha {
           grpc::ServerWriter<::iroha::protocol::BlockQueryResponse> *writer)
           override;
 
+      /**
+       * Stream the changes of the pending batches of the creator of the
+       * GetPendingTransactions query, after the response of the query
+       * @param context - server context
+       * @param request - GetPendingTransactions query
+       * @param writer - stream of the query response and the batch events
+       */
+      grpc::Status FetchPendingTransactions(
+          grpc::ServerContext *context,
+          const iroha::protocol::Query *request,
+          grpc::ServerWriter<iroha::protocol::PendingTransactionsStreamResponse>
+              *writer) override;
+
+      /**
+       * Prove that the committed block has the transaction by the Merkle
+       * root of the transactions of the block
+       * @param context - server context
+       * @param request - height of the block and hash of the transaction
+       * @param response - root of the block with the proof
+       */
+      grpc::Status GetTransactionProof(
+          grpc::ServerContext *context,
+          const iroha::protocol::TransactionProofRequest *request,
+          iroha::protocol::TransactionProofResponse *response) override;
+
+      /**
+       * Execute the query and stream its response split into the messages
+       * of bounded size, so large collections are not sent at once
+       * @param context - server context
+       * @param request - query
+       * @param writer - stream of the chunks of the response
+       */
+      grpc::Status FindStream(
+          grpc::ServerContext *context,
+          const iroha::protocol::Query *request,
+          grpc::ServerWriter<iroha::protocol::QueryResponse> *writer) override;
+
+      /**
+       * Execute the queries of the batch on one snapshot of the ledger. The
+       * signature of the batch is verified once for all its queries
+       * @param context - server context
+       * @param request - queries of the same creator with their signature
+       * @param response - responses in the order of the queries
+       */
+      grpc::Status FindBatch(
+          grpc::ServerContext *context,
+          const iroha::protocol::QueryBatch *request,
+          iroha::protocol::QueryBatchResponse *response) override;
+
+      bool hasAsyncMethods() const override;
+
+      /// request the FetchCommits streams when they are asynchronous
+      void requestCalls(grpc::ServerCompletionQueue &queue) override;
+
      private:
+      /// index of FetchCommits among the methods of the service
+      static constexpr int kFetchCommitsMethod = 1;
+      /// blocks waiting to be sent to an asynchronous stream, after which
+      /// the client is considered too slow and its stream is cancelled
+      static constexpr size_t kMaxQueuedBlocks = 64;
+
+      /**
+       * Apply the filter of a blocks query to the response. The filtered
+       * blocks are memoized, so that every committed block is filtered once
+       * for all the subscribers with the same filter
+       * @return the response to be sent, nullptr if it has to be skipped
+       */
+      std::shared_ptr<const iroha::protocol::BlockQueryResponse>
+      filterResponse(
+          const BlocksQueryFilter &filter,
+          const std::shared_ptr<shared_model::interface::BlockQueryResponse>
+              &response);
+
+      /**
+       * Serialize the filtered response. The serialized blocks are memoized,
+       * so that every committed block is serialized once for all the streams
+       * with the same filter
+       * @return the buffer to be sent, nullptr if it has to be skipped
+       */
+      std::shared_ptr<const grpc::ByteBuffer> serializedResponse(
+          const BlocksQueryFilter &filter,
+          const std::shared_ptr<shared_model::interface::BlockQueryResponse>
+              &response);
+
+      /// @return the key of the block filtered by the filter
+      static std::string blockKey(const BlocksQueryFilter &filter,
+                                  uint64_t height);
+
       std::shared_ptr<iroha::torii::QueryProcessor> query_processor_;
       std::shared_ptr<QueryFactoryType> query_factory_;
       std::shared_ptr<BlocksQueryFactoryType> blocks_query_factory_;
@@ -81,7 +207,22 @@ namespace iroha {
                           shared_model::crypto::Hash::Hasher>
           cache_;
 
+      /// filtered blocks by the filter key and the height
+      iroha::cache::ShardedCache<
+          std::string,
+          std::shared_ptr<const iroha::protocol::BlockQueryResponse>>
+          filtered_blocks_{1024, 512};
+      /// serialized filtered blocks by the filter key and the height
+      iroha::cache::ShardedCache<std::string,
+                                 std::shared_ptr<const grpc::ByteBuffer>>
+          serialized_blocks_{1024, 512};
+
       logger::LoggerPtr log_;
+      const bool async_block_streams_;
+      PendingBatchEvents pending_batch_events_;
+      std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory_;
+      const size_t stream_chunk_bytes_;
+      std::shared_ptr<QueryFactoryType> batch_query_factory_;
     };
   }  // namespace torii
 }  // namespace iroha
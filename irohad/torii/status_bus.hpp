@@ -7,6 +7,7 @@
 #define TORII_STATUS_BUS
 
 #include <rxcpp/rx-observable-fwd.hpp>
+#include "cryptography/hash.hpp"
 #include "interfaces/transaction_responses/tx_response.hpp"
 
 namespace iroha {
@@ -33,6 +34,15 @@ namespace iroha {
        * @return observable over objects in bus
        */
       virtual rxcpp::observable<Objects> statuses() = 0;
+
+      /**
+       * @param hash - hash of the transaction
+       * @return observable over objects in bus with the given transaction
+       * hash, which are routed to the subscriber without checking the objects
+       * of other transactions
+       */
+      virtual rxcpp::observable<Objects> statuses(
+          const shared_model::crypto::Hash &hash) = 0;
     };
   }  // namespace torii
 }  // namespace iroha
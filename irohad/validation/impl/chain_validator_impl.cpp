@@ -5,24 +5,149 @@
 
 #include "validation/impl/chain_validator_impl.hpp"
 
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+
 #include <boost/algorithm/string/join.hpp>
+#include <boost/optional.hpp>
 #include <rxcpp/rx-lite.hpp>
 #include "ametsuchi/ledger_state.hpp"
 #include "ametsuchi/mutable_storage.hpp"
+#include "common/thread_name.hpp"
 #include "consensus/yac/supermajority_checker.hpp"
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
 #include "cryptography/public_key.hpp"
 #include "interfaces/common_objects/peer.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "logger/logger.hpp"
 #include "validation/utils.hpp"
 
+namespace {
+  using BlockPtr = std::shared_ptr<shared_model::interface::Block>;
+
+  /// number of the blocks verified ahead per verification thread
+  constexpr size_t kBlocksAheadPerThread = 4;
+
+  /**
+   * Blocks of the observable with their signatures verified on the worker
+   * threads. The observable is read on a separate thread up to the window
+   * ahead of the block taken last, so the blocks are downloaded and verified
+   * while the previous ones are applied
+   */
+  class VerifiedBlocks {
+   public:
+    template <typename Verify>
+    VerifiedBlocks(rxcpp::observable<BlockPtr> blocks,
+                   Verify verify,
+                   tbb::task_arena &workers,
+                   size_t window)
+        : window_(window) {
+      reader_ = std::thread([this, blocks, verify, &workers] {
+        iroha::setThreadName("chain-reader");
+        blocks.subscribe(
+            lifetime_,
+            [this, verify, &workers](BlockPtr block) {
+              std::unique_lock<std::mutex> lock(mutex_);
+              space_.wait(lock, [this] {
+                return stopped_ or pending_.size() < window_;
+              });
+              if (stopped_) {
+                lifetime_.unsubscribe();
+                return;
+              }
+              auto verified = std::make_shared<std::promise<bool>>();
+              pending_.push_back({block, verified->get_future()});
+              lock.unlock();
+              available_.notify_one();
+              workers.enqueue([block, verify, verified] {
+                // the hash is computed here as well, so it is ready when the
+                // block is applied
+                block->hash();
+                verified->set_value(verify(*block));
+              });
+            },
+            [this](std::exception_ptr) { finish(); },
+            [this] { finish(); });
+      });
+    }
+
+    ~VerifiedBlocks() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+      }
+      space_.notify_all();
+      lifetime_.unsubscribe();
+      reader_.join();
+      // the verification tasks of the blocks which are not taken must not
+      // outlive the validator
+      for (auto &block : pending_) {
+        block.verified.wait();
+      }
+    }
+
+    /**
+     * Wait for the next block and its verification
+     * @return the block and whether its signatures are valid, or none after
+     * the last block
+     */
+    boost::optional<std::pair<BlockPtr, bool>> next() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      available_.wait(lock,
+                      [this] { return finished_ or not pending_.empty(); });
+      if (pending_.empty()) {
+        return boost::none;
+      }
+      auto block = std::move(pending_.front());
+      pending_.pop_front();
+      lock.unlock();
+      space_.notify_one();
+      return std::make_pair(std::move(block.block), block.verified.get());
+    }
+
+   private:
+    struct PendingBlock {
+      BlockPtr block;
+      std::future<bool> verified;
+    };
+
+    void finish() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finished_ = true;
+      }
+      available_.notify_one();
+    }
+
+    const size_t window_;
+    std::mutex mutex_;
+    std::condition_variable space_;
+    std::condition_variable available_;
+    std::deque<PendingBlock> pending_;
+    bool stopped_ = false;
+    bool finished_ = false;
+    rxcpp::composite_subscription lifetime_;
+    std::thread reader_;
+  };
+}  // namespace
+
 namespace iroha {
   namespace validation {
     ChainValidatorImpl::ChainValidatorImpl(
         std::shared_ptr<consensus::yac::SupermajorityChecker>
             supermajority_checker,
-        logger::LoggerPtr log)
-        : supermajority_checker_(supermajority_checker), log_(std::move(log)) {}
+        logger::LoggerPtr log,
+        size_t verification_threads)
+        : supermajority_checker_(supermajority_checker),
+          log_(std::move(log)),
+          verification_workers_(
+              verification_threads == 0
+                  ? nullptr
+                  : std::make_unique<tbb::task_arena>(verification_threads)),
+          verification_window_(verification_threads * kBlocksAheadPerThread) {}
 
     bool ChainValidatorImpl::validateAndApply(
         rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
@@ -30,10 +155,54 @@ namespace iroha {
         ametsuchi::MutableStorage &storage) const {
       log_->info("validate chain...");
 
-      return storage.apply(blocks,
-                           [this](auto block, const auto &ledger_state) {
-                             return this->validateBlock(block, ledger_state);
-                           });
+      if (not verification_workers_) {
+        return storage.apply(blocks,
+                             [this](auto block, const auto &ledger_state) {
+                               return this->validateBlock(block,
+                                                          ledger_state);
+                             });
+      }
+
+      // the signatures are verified ahead, while the peers of the signatories
+      // are checked against the ledger state after the previous block
+      VerifiedBlocks verified_blocks(
+          blocks,
+          [this](const auto &block) { return this->validateSignatures(block); },
+          *verification_workers_,
+          verification_window_);
+      bool signatures_valid = true;
+      return storage.apply(
+          rxcpp::observable<>::create<BlockPtr>([&](auto subscriber) {
+            while (subscriber.is_subscribed()) {
+              auto next = verified_blocks.next();
+              if (not next) {
+                break;
+              }
+              signatures_valid = next->second;
+              subscriber.on_next(std::move(next->first));
+            }
+            subscriber.on_completed();
+          }),
+          [this, &signatures_valid](auto block, const auto &ledger_state) {
+            return signatures_valid
+                and this->validateBlock(block, ledger_state);
+          });
+    }
+
+    bool ChainValidatorImpl::validateSignatures(
+        const shared_model::interface::Block &block) const {
+      shared_model::crypto::SignatureBatch signatures;
+      for (const auto &signature : block.signatures()) {
+        signatures.push_back(shared_model::crypto::SignatureRef{
+            signature.signedData(), signature.publicKey()});
+      }
+      auto valid = not signatures.empty()
+          and shared_model::crypto::CryptoVerifier<>::verifyBatch(
+                       block.payload(), signatures);
+      if (not valid) {
+        log_->info("Block {} has invalid signatures", block.height());
+      }
+      return valid;
     }
 
     bool ChainValidatorImpl::validatePreviousHash(
@@ -10,6 +10,7 @@
 
 #include <memory>
 
+#include <tbb/task_arena.h>
 #include "interfaces/common_objects/types.hpp"
 #include "logger/logger_fwd.hpp"
 
@@ -32,9 +33,18 @@ namespace iroha {
   namespace validation {
     class ChainValidatorImpl : public ChainValidator {
      public:
+      /**
+       * @param supermajority_checker - checker of the peers supermajority
+       * @param log - logger
+       * @param verification_threads - number of the threads verifying the
+       * cryptographic signatures of the upcoming blocks while the previous
+       * ones are applied, 0 if the signatures are verified before the blocks
+       * are passed to the validator
+       */
       ChainValidatorImpl(std::shared_ptr<consensus::yac::SupermajorityChecker>
                              supermajority_checker,
-                         logger::LoggerPtr log);
+                         logger::LoggerPtr log,
+                         size_t verification_threads = 0);
 
       bool validateAndApply(
           rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
@@ -58,6 +68,9 @@ namespace iroha {
           const std::vector<std::shared_ptr<shared_model::interface::Peer>>
               &peers) const;
 
+      /// Verifies the cryptographic signatures of the block over its payload
+      bool validateSignatures(const shared_model::interface::Block &block) const;
+
       /**
        * Verifies previous hash and whether the block is signed by supermajority
        * of ledger peers
@@ -73,6 +86,11 @@ namespace iroha {
           supermajority_checker_;
 
       logger::LoggerPtr log_;
+
+      /// threads verifying the signatures, nullptr if they are not verified
+      std::unique_ptr<tbb::task_arena> verification_workers_;
+      /// maximal number of the blocks verified ahead of the applied one
+      size_t verification_window_;
     };
   }  // namespace validation
 }  // namespace iroha
@@ -5,16 +5,22 @@
 
 #include "validation/impl/stateful_validator_impl.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <string>
+#include <thread>
 
 #include <boost/algorithm/cxx11/all_of.hpp>
 #include <boost/format.hpp>
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/indexed.hpp>
+#include <boost/range/adaptor/sliced.hpp>
 #include <boost/range/adaptor/transformed.hpp>
+#include "common/allocation_tracking.hpp"
 #include "common/result.hpp"
 #include "interfaces/iroha_internal/batch_meta.hpp"
 #include "logger/logger.hpp"
+#include "validation/impl/transaction_conflicts.hpp"
 #include "validation/utils.hpp"
 
 namespace iroha {
@@ -40,30 +46,162 @@ namespace iroha {
           });
     };
 
+    /**
+     * Applies independent transactions, validating the groups of the
+     * non-conflicting ones concurrently on the worker WSVs. The transactions
+     * which passed the validation are then applied to the given WSV in their
+     * order without the repeated signatures and permissions checks, so its
+     * state is the same as after the sequential validation
+     * @param transactions - transactions to be applied
+     * @param temporary_wsv - WSV of the proposal
+     * @param worker_wsv_factory - factory of the worker WSVs
+     * @param workers - maximal number of the worker WSVs, must be 0 if any
+     * transaction is already applied to the WSV of the proposal, since the
+     * worker WSVs contain only the committed state
+     * @param log - logger
+     * @return result of each transaction in their order
+     */
+    static std::vector<expected::Result<void, validation::CommandError>>
+    applyIndependentTransactions(
+        const ametsuchi::TemporaryWsv::TransactionRefs &transactions,
+        ametsuchi::TemporaryWsv &temporary_wsv,
+        const StatefulValidatorImpl::WorkerWsvFactory &worker_wsv_factory,
+        size_t workers,
+        const logger::LoggerPtr &log) {
+      if (workers == 0 or not worker_wsv_factory or transactions.size() < 2) {
+        return temporary_wsv.applyTransactions(transactions);
+      }
+      auto groups = partitionConflictingTransactions(transactions);
+      if (groups.size() < 2) {
+        return temporary_wsv.applyTransactions(transactions);
+      }
+
+      std::vector<std::unique_ptr<ametsuchi::TemporaryWsv>> worker_wsvs;
+      while (worker_wsvs.size() < std::min(workers, groups.size())) {
+        auto worker_wsv = worker_wsv_factory();
+        if (not worker_wsv) {
+          break;
+        }
+        worker_wsvs.push_back(std::move(worker_wsv));
+      }
+      if (worker_wsvs.empty()) {
+        log->warn("no worker WSV is available, validating {} transactions "
+                  "sequentially",
+                  transactions.size());
+        return temporary_wsv.applyTransactions(transactions);
+      }
+
+      // groups do not read the state written by each other, so a worker
+      // validates its groups one after another on the same WSV
+      std::vector<boost::optional<validation::CommandError>> worker_errors(
+          transactions.size());
+      std::atomic<size_t> next_group{0};
+      auto validate_groups = [&](ametsuchi::TemporaryWsv &worker_wsv) {
+        // the tag of the validation does not pass to the worker threads
+        ScopedAllocationTag allocation_tag(AllocationTag::kValidation);
+        for (auto group = next_group++; group < groups.size();
+             group = next_group++) {
+          ametsuchi::TemporaryWsv::TransactionRefs group_transactions;
+          for (auto i : groups[group]) {
+            group_transactions.push_back(transactions[i]);
+          }
+          auto results = worker_wsv.applyTransactions(group_transactions);
+          for (size_t i = 0; i < results.size(); ++i) {
+            if (auto error = expected::resultToOptionalError(results[i])) {
+              worker_errors[groups[group][i]] = std::move(*error);
+            }
+          }
+        }
+      };
+      std::vector<std::thread> threads;
+      for (size_t i = 1; i < worker_wsvs.size(); ++i) {
+        threads.emplace_back(validate_groups, std::ref(*worker_wsvs[i]));
+      }
+      validate_groups(*worker_wsvs.front());
+      for (auto &thread : threads) {
+        thread.join();
+      }
+      log->debug("validated {} transactions in {} groups on {} workers",
+                 transactions.size(),
+                 groups.size(),
+                 worker_wsvs.size());
+
+      std::vector<expected::Result<void, validation::CommandError>> results;
+      results.reserve(transactions.size());
+      for (size_t i = 0; i < transactions.size(); ++i) {
+        if (worker_errors[i]) {
+          results.push_back(expected::makeError(std::move(*worker_errors[i])));
+        } else {
+          results.push_back(temporary_wsv.applyValidated(transactions[i]));
+        }
+      }
+      return results;
+    }
+
     /**
      * Validate all transactions supplied; includes special rules, such as batch
      * validation etc
      * @param txs to be validated
      * @param temporary_wsv to apply transactions on
      * @param transactions_errors_log to write errors to
-     * @param batch_parser to parse batches from transaction range
+     * @param batches - index ranges of the batches of the transactions
+     * @param worker_wsv_factory to create the WSVs of the concurrent validation
+     * @param workers - maximal number of the concurrently validated groups
+     * @param log to write the validation details to
      * @return range of transactions, which passed stateful validation
      */
     static auto validateTransactions(
-        const shared_model::interface::types::TransactionsCollectionType &txs,
+        const shared_model::interface::types::TransactionsSpanType &txs,
         ametsuchi::TemporaryWsv &temporary_wsv,
         validation::TransactionsErrors &transactions_errors_log,
-        const shared_model::interface::TransactionBatchParser &batch_parser) {
+        const shared_model::interface::types::BatchBoundariesType &batches,
+        const StatefulValidatorImpl::WorkerWsvFactory &worker_wsv_factory,
+        size_t workers,
+        const logger::LoggerPtr &log) {
       std::vector<bool> validation_results;
-      validation_results.reserve(boost::size(txs));
+      validation_results.reserve(txs.size());
+
+      // transactions of not atomic batches are independent, so they are
+      // applied together, which lets the storage group them
+      ametsuchi::TemporaryWsv::TransactionRefs independent_txs;
+      // the worker WSVs see only the committed state, so the transactions
+      // are validated concurrently only until the first one is applied to
+      // the WSV of the proposal
+      bool state_changed = false;
+      auto validate_independent_txs = [&] {
+        auto results =
+            applyIndependentTransactions(independent_txs,
+                                         temporary_wsv,
+                                         worker_wsv_factory,
+                                         state_changed ? 0 : workers,
+                                         log);
+        for (size_t i = 0; i < independent_txs.size(); ++i) {
+          validation_results.push_back(results.at(i).match(
+              [&state_changed](const auto &) {
+                state_changed = true;
+                return true;
+              },
+              [&](auto &&error) {
+                transactions_errors_log.emplace_back(
+                    validation::TransactionError{
+                        independent_txs[i].get().hash(),
+                        std::move(error.error)});
+                return false;
+              }));
+        }
+        independent_txs.clear();
+      };
 
-      for (auto batch : batch_parser.parseBatches(txs)) {
+      for (const auto &boundary : batches) {
+        auto batch =
+            txs | boost::adaptors::sliced(boundary.begin, boundary.end);
         auto validation = [&](auto &tx) {
           return checkTransactions(temporary_wsv, transactions_errors_log, tx);
         };
         if (batch.front().batchMeta()
             and batch.front().batchMeta()->get()->type()
                 == shared_model::interface::types::BatchType::ATOMIC) {
+          validate_independent_txs();
           // check all batch's transactions for validness
           auto savepoint = temporary_wsv.createSavepoint(
               "batch_" + batch.front().hash().hex());
@@ -72,6 +210,7 @@ namespace iroha {
           if (boost::algorithm::all_of(batch, validation)) {
             // batch is successful; release savepoint
             validation_result = true;
+            state_changed = true;
             savepoint->release();
           } else {
             auto failed_tx_hash = transactions_errors_log.back().tx_hash;
@@ -96,10 +235,11 @@ namespace iroha {
               validation_results.end(), boost::size(batch), validation_result);
         } else {
           for (const auto &tx : batch) {
-            validation_results.push_back(validation(tx));
+            independent_txs.push_back(tx);
           }
         }
       }
+      validate_independent_txs();
 
       return txs | boost::adaptors::indexed()
           | boost::adaptors::filtered(
@@ -113,26 +253,31 @@ namespace iroha {
 
     StatefulValidatorImpl::StatefulValidatorImpl(
         std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory,
-        std::shared_ptr<shared_model::interface::TransactionBatchParser>
-            batch_parser,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        WorkerWsvFactory worker_wsv_factory,
+        size_t workers)
         : factory_(std::move(factory)),
-          batch_parser_(std::move(batch_parser)),
-          log_(std::move(log)) {}
+          log_(std::move(log)),
+          worker_wsv_factory_(std::move(worker_wsv_factory)),
+          workers_(workers) {}
 
     std::unique_ptr<validation::VerifiedProposalAndErrors>
     StatefulValidatorImpl::validate(
         const shared_model::interface::Proposal &proposal,
         ametsuchi::TemporaryWsv &temporaryWsv) {
-      log_->info("transactions in proposal: {}",
-                 proposal.transactions().size());
+      ScopedAllocationTag allocation_tag(AllocationTag::kValidation);
+      const auto transactions = proposal.transactionsSpan();
+      log_->info("transactions in proposal: {}", transactions.size());
 
       auto validation_result = std::make_unique<VerifiedProposalAndErrors>();
       auto valid_txs =
-          validateTransactions(proposal.transactions(),
+          validateTransactions(transactions,
                                temporaryWsv,
                                validation_result->rejected_transactions,
-                               *batch_parser_);
+                               proposal.batchBoundaries(),
+                               worker_wsv_factory_,
+                               workers_,
+                               log_);
 
       // Since proposal came from ordering gate it was already validated.
       // All transactions are validated as well
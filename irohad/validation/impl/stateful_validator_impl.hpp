@@ -8,7 +8,8 @@
 
 #include "validation/stateful_validator.hpp"
 
-#include "interfaces/iroha_internal/transaction_batch_parser.hpp"
+#include <functional>
+
 #include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger_fwd.hpp"
 
@@ -20,12 +21,26 @@ namespace iroha {
      */
     class StatefulValidatorImpl : public StatefulValidator {
      public:
+      /// Creates a temporary WSV on a separate database connection, returns
+      /// nullptr if no connection is available
+      using WorkerWsvFactory =
+          std::function<std::unique_ptr<ametsuchi::TemporaryWsv>()>;
+
+      /**
+       * @param factory - factory of the verified proposals
+       * @param log - logger
+       * @param worker_wsv_factory - factory of the temporary WSVs, on which
+       * the groups of the non-conflicting transactions are validated
+       * concurrently
+       * @param workers - maximal number of the concurrently validated groups,
+       * 0 validates all transactions one after another
+       */
       StatefulValidatorImpl(
           std::unique_ptr<shared_model::interface::UnsafeProposalFactory>
               factory,
-          std::shared_ptr<shared_model::interface::TransactionBatchParser>
-              batch_parser,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          WorkerWsvFactory worker_wsv_factory = {},
+          size_t workers = 0);
 
       std::unique_ptr<validation::VerifiedProposalAndErrors> validate(
           const shared_model::interface::Proposal &proposal,
@@ -33,9 +48,9 @@ namespace iroha {
 
      private:
       std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory_;
-      std::shared_ptr<shared_model::interface::TransactionBatchParser>
-          batch_parser_;
       logger::LoggerPtr log_;
+      WorkerWsvFactory worker_wsv_factory_;
+      size_t workers_;
     };
 
   }  // namespace validation
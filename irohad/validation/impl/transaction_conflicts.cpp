@@ -0,0 +1,250 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validation/impl/transaction_conflicts.hpp"
+
+#include <numeric>
+#include <unordered_map>
+
+#include <boost/optional.hpp>
+#include "common/visitor.hpp"
+#include "cryptography/public_key.hpp"
+#include "interfaces/commands/add_asset_quantity.hpp"
+#include "interfaces/commands/add_peer.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/append_role.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/compare_and_set_account_detail.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/create_asset.hpp"
+#include "interfaces/commands/create_domain.hpp"
+#include "interfaces/commands/create_role.hpp"
+#include "interfaces/commands/detach_role.hpp"
+#include "interfaces/commands/grant_permission.hpp"
+#include "interfaces/commands/remove_peer.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/revoke_permission.hpp"
+#include "interfaces/commands/set_account_detail.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/commands/set_setting_value.hpp"
+#include "interfaces/commands/subtract_asset_quantity.hpp"
+#include "interfaces/commands/transfer_asset.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace {
+  /// the key read by every transaction and written by the unknown commands
+  const std::string kWholeState = "*";
+  const std::string kPeers = "peers";
+  const std::string kSettings = "settings";
+
+  std::string accountKey(const std::string &account_id) {
+    return "account:" + account_id;
+  }
+
+  std::string detailKey(const std::string &account_id) {
+    return "detail:" + account_id;
+  }
+
+  std::string assetKey(const std::string &asset_id) {
+    return "asset:" + asset_id;
+  }
+
+  std::string balanceKey(const std::string &account_id,
+                         const std::string &asset_id) {
+    return "balance:" + account_id + "/" + asset_id;
+  }
+
+  std::string domainKey(const std::string &domain_id) {
+    return "domain:" + domain_id;
+  }
+
+  std::string roleKey(const std::string &role_id) {
+    return "role:" + role_id;
+  }
+
+  std::string signatoryKey(
+      const shared_model::interface::types::PubkeyType &pubkey) {
+    return "signatory:" + pubkey.hex();
+  }
+
+  /// Disjoint sets of the transaction indices
+  class DisjointSets {
+   public:
+    explicit DisjointSets(size_t size) : parents_(size) {
+      std::iota(parents_.begin(), parents_.end(), 0);
+    }
+
+    size_t find(size_t index) {
+      while (parents_[index] != index) {
+        parents_[index] = parents_[parents_[index]];
+        index = parents_[index];
+      }
+      return index;
+    }
+
+    void unite(size_t lhs, size_t rhs) {
+      lhs = find(lhs);
+      rhs = find(rhs);
+      // the smaller index is kept as the root to make the result independent
+      // of the order of the unions
+      if (lhs < rhs) {
+        parents_[rhs] = lhs;
+      } else {
+        parents_[lhs] = rhs;
+      }
+    }
+
+   private:
+    std::vector<size_t> parents_;
+  };
+
+  /// Transactions which accessed a key so far
+  struct KeyAccess {
+    boost::optional<size_t> writer;
+    std::vector<size_t> readers;
+  };
+}  // namespace
+
+namespace iroha {
+  namespace validation {
+
+    TransactionAccess getTransactionAccess(
+        const shared_model::interface::Transaction &transaction) {
+      using namespace shared_model::interface;
+      const auto &creator = transaction.creatorAccountId();
+      TransactionAccess access;
+      // signatures and permissions of the creator are checked for every
+      // transaction
+      access.reads.push_back(kWholeState);
+      access.reads.push_back(accountKey(creator));
+
+      auto read = [&access](std::string key) {
+        access.reads.push_back(std::move(key));
+      };
+      auto write = [&access](std::string key) {
+        access.writes.push_back(std::move(key));
+      };
+      for (const auto &command : transaction.commands()) {
+        iroha::visit_in_place(
+            command.get(),
+            [&](const AddAssetQuantity &command) {
+              read(assetKey(command.assetId()));
+              write(balanceKey(creator, command.assetId()));
+            },
+            [&](const SubtractAssetQuantity &command) {
+              read(assetKey(command.assetId()));
+              write(balanceKey(creator, command.assetId()));
+            },
+            [&](const TransferAsset &command) {
+              read(kSettings);
+              read(assetKey(command.assetId()));
+              read(accountKey(command.srcAccountId()));
+              read(accountKey(command.destAccountId()));
+              write(balanceKey(command.srcAccountId(), command.assetId()));
+              write(balanceKey(command.destAccountId(), command.assetId()));
+            },
+            [&](const AddPeer &) { write(kPeers); },
+            [&](const RemovePeer &) { write(kPeers); },
+            [&](const SetSettingValue &) { write(kSettings); },
+            [&](const AddSignatory &command) {
+              write(accountKey(command.accountId()));
+              write(signatoryKey(command.pubkey()));
+            },
+            [&](const RemoveSignatory &command) {
+              write(accountKey(command.accountId()));
+              write(signatoryKey(command.pubkey()));
+            },
+            [&](const SetQuorum &command) {
+              write(accountKey(command.accountId()));
+            },
+            [&](const AppendRole &command) {
+              read(roleKey(command.roleName()));
+              write(accountKey(command.accountId()));
+            },
+            [&](const DetachRole &command) {
+              read(roleKey(command.roleName()));
+              write(accountKey(command.accountId()));
+            },
+            [&](const GrantPermission &command) {
+              write(accountKey(command.accountId()));
+              write(accountKey(creator));
+            },
+            [&](const RevokePermission &command) {
+              write(accountKey(command.accountId()));
+              write(accountKey(creator));
+            },
+            [&](const CreateAccount &command) {
+              read(domainKey(command.domainId()));
+              write(accountKey(command.accountName() + "@"
+                               + command.domainId()));
+              write(signatoryKey(command.pubkey()));
+            },
+            [&](const CreateAsset &command) {
+              read(domainKey(command.domainId()));
+              write(assetKey(command.assetName() + "#" + command.domainId()));
+            },
+            [&](const CreateDomain &command) {
+              read(roleKey(command.userDefaultRole()));
+              write(domainKey(command.domainId()));
+            },
+            [&](const CreateRole &command) {
+              write(roleKey(command.roleName()));
+            },
+            [&](const SetAccountDetail &command) {
+              read(accountKey(command.accountId()));
+              write(detailKey(command.accountId()));
+            },
+            [&](const CompareAndSetAccountDetail &command) {
+              read(accountKey(command.accountId()));
+              write(detailKey(command.accountId()));
+            },
+            [&](const auto &) { write(kWholeState); });
+      }
+      return access;
+    }
+
+    std::vector<std::vector<size_t>> partitionConflictingTransactions(
+        const ametsuchi::TemporaryWsv::TransactionRefs &transactions) {
+      DisjointSets sets(transactions.size());
+      std::unordered_map<std::string, KeyAccess> keys;
+      for (size_t i = 0; i < transactions.size(); ++i) {
+        auto access = getTransactionAccess(transactions[i]);
+        for (const auto &key : access.reads) {
+          auto &key_access = keys[key];
+          if (key_access.writer) {
+            sets.unite(*key_access.writer, i);
+          } else {
+            key_access.readers.push_back(i);
+          }
+        }
+        for (const auto &key : access.writes) {
+          auto &key_access = keys[key];
+          if (key_access.writer) {
+            sets.unite(*key_access.writer, i);
+          }
+          for (auto reader : key_access.readers) {
+            sets.unite(reader, i);
+          }
+          key_access.readers.clear();
+          key_access.writer = i;
+        }
+      }
+
+      std::vector<std::vector<size_t>> groups;
+      std::unordered_map<size_t, size_t> group_of_root;
+      for (size_t i = 0; i < transactions.size(); ++i) {
+        auto root = sets.find(i);
+        auto it = group_of_root.find(root);
+        if (it == group_of_root.end()) {
+          it = group_of_root.emplace(root, groups.size()).first;
+          groups.emplace_back();
+        }
+        groups[it->second].push_back(i);
+      }
+      return groups;
+    }
+
+  }  // namespace validation
+}  // namespace iroha
@@ -0,0 +1,54 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TRANSACTION_CONFLICTS_HPP
+#define IROHA_TRANSACTION_CONFLICTS_HPP
+
+#include <string>
+#include <vector>
+
+#include "ametsuchi/temporary_wsv.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Transaction;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace validation {
+
+    /**
+     * Keys of the state which a transaction reads and writes, deduced from
+     * the types and the arguments of its commands. Every row which a command
+     * inserts, updates or locks must be covered by a written key, otherwise
+     * the transactions validated concurrently may block each other
+     */
+    struct TransactionAccess {
+      std::vector<std::string> reads;
+      std::vector<std::string> writes;
+    };
+
+    /**
+     * @return the keys of the state accessed by the transaction
+     */
+    TransactionAccess getTransactionAccess(
+        const shared_model::interface::Transaction &transaction);
+
+    /**
+     * Splits the transactions into the groups, so that the transactions of
+     * different groups neither write the same key nor read a key written by
+     * the other group
+     * @param transactions - transactions to be split
+     * @return indices of the transactions of each group in increasing order,
+     * the groups are ordered by their first transaction
+     */
+    std::vector<std::vector<size_t>> partitionConflictingTransactions(
+        const ametsuchi::TemporaryWsv::TransactionRefs &transactions);
+
+  }  // namespace validation
+}  // namespace iroha
+
+#endif  // IROHA_TRANSACTION_CONFLICTS_HPP
@@ -0,0 +1,56 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validation/validation_pool.hpp"
+
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_scheduler_observer.h>
+#include "common/thread_name.hpp"
+
+namespace iroha {
+  namespace validation {
+
+    class ValidationPool::WorkerObserver : public tbb::task_scheduler_observer {
+     public:
+      explicit WorkerObserver(tbb::task_arena &arena)
+          : tbb::task_scheduler_observer(arena) {
+        observe(true);
+      }
+
+      ~WorkerObserver() override {
+        observe(false);
+      }
+
+      void on_scheduler_entry(bool is_worker) override {
+        if (is_worker) {
+          setThreadName("validation");
+        }
+      }
+    };
+
+    ValidationPool::ValidationPool(size_t workers)
+        : arena_(workers > 1 ? std::make_unique<tbb::task_arena>(
+                                   static_cast<int>(workers))
+                             : nullptr),
+          observer_(arena_ ? std::make_unique<WorkerObserver>(*arena_)
+                           : nullptr) {}
+
+    ValidationPool::~ValidationPool() = default;
+
+    void ValidationPool::parallelFor(size_t size,
+                                     const std::function<void(size_t)> &f) {
+      if (not arena_ or size < 2) {
+        for (size_t i = 0; i < size; ++i) {
+          f(i);
+        }
+        return;
+      }
+      arena_->execute(
+          [&] { tbb::parallel_for(static_cast<size_t>(0), size, f); });
+    }
+
+  }  // namespace validation
+}  // namespace iroha
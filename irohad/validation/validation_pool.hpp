@@ -0,0 +1,89 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_VALIDATION_POOL_HPP
+#define IROHA_VALIDATION_POOL_HPP
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tbb {
+  class task_arena;
+}  // namespace tbb
+
+namespace iroha {
+  namespace validation {
+
+    /**
+     * Workers validating the received transactions, shared by all the
+     * network services of the peer. A collection is validated on all the
+     * workers at once, while the calling thread takes part in the work, so
+     * a single worker means validation on the calling thread only. The
+     * workers are named "validation" and placed with the subsystem
+     */
+    class ValidationPool {
+     public:
+      /**
+       * @param workers - number of threads which validate a collection
+       */
+      explicit ValidationPool(size_t workers);
+
+      ~ValidationPool();
+
+      /**
+       * Call f for every index in [0, size) with the workers
+       */
+      void parallelFor(size_t size, const std::function<void(size_t)> &f);
+
+      /**
+       * Call f for every index in [0, size) with the workers
+       * @return the results of f in the order of the indices
+       */
+      template <typename F>
+      auto map(size_t size, F &&f) {
+        std::vector<std::decay_t<decltype(f(size_t{}))>> results(size);
+        parallelFor(size, [&](size_t i) { results[i] = f(i); });
+        return results;
+      }
+
+      /**
+       * Build the objects of the received transports with the workers. The
+       * stateless validation including the signatures verification is the
+       * most of the work, and the objects keep the order of the request
+       * @tparam Collection - collection of the built objects
+       * @param size - number of the transports
+       * @param build - returns the result of building the object of an index
+       * @param on_error - is called with the error of every failed object
+       * @return the objects which are built
+       */
+      template <typename Collection, typename Build, typename OnError>
+      Collection buildAll(size_t size, Build &&build, OnError &&on_error) {
+        auto results = map(size, std::forward<Build>(build));
+        Collection objects;
+        objects.reserve(results.size());
+        for (auto &result : results) {
+          std::move(result).match(
+              [&](auto &&value) { objects.push_back(std::move(value).value); },
+              [&](const auto &error) { on_error(error.error); });
+        }
+        return objects;
+      }
+
+     private:
+      /// names the worker threads of the arena
+      class WorkerObserver;
+
+      /// arena of the workers, none if there is a single worker
+      std::unique_ptr<tbb::task_arena> arena_;
+      std::unique_ptr<WorkerObserver> observer_;
+    };
+
+  }  // namespace validation
+}  // namespace iroha
+
+#endif  // IROHA_VALIDATION_POOL_HPP
@@ -52,6 +52,27 @@ namespace iroha {
         return constUnderlying().getCacheItemCountImpl();
       }
 
+      /**
+       * @param item_heap_bytes - heap memory owned by a key and a value, which
+       * the cache does not see, like the contents of a pointed object
+       * @return approximate memory taken by the cache in bytes
+       */
+      size_t memoryUsage(size_t item_heap_bytes = 0) const {
+        std::shared_lock<std::shared_timed_mutex> lock(access_mutex_);
+        return constUnderlying().memoryUsageImpl(item_heap_bytes);
+      }
+
+      /**
+       * Lowers the high border of the cache limit to the given amount of
+       * items, evicting the items over it, and scales the low border along.
+       * A limit above the constructed high border restores the latter.
+       * @param max_items - new high border
+       */
+      void limitItems(uint32_t max_items) {
+        std::lock_guard<std::shared_timed_mutex> lock(access_mutex_);
+        underlying().limitItemsImpl(max_items);
+      }
+
       /**
        * Adds new item to cache. When amount of cache records reaches
        * getIndexSizeHigh() a procedure of clean starts until getIndexSizeLow()
@@ -8,6 +8,7 @@
 
 #include "cache/abstract_cache.hpp"
 
+#include <algorithm>
 #include <unordered_map>
 
 namespace iroha {
@@ -29,14 +30,20 @@ namespace iroha {
       Cache(uint32_t max_handler_map_size_high = 20000,
             uint32_t max_handler_map_size_low = 10000)
           : max_handler_map_size_high_(max_handler_map_size_high),
-            max_handler_map_size_low_(max_handler_map_size_low) {}
+            max_handler_map_size_low_(max_handler_map_size_low),
+            item_limit_(max_handler_map_size_high) {}
 
       uint32_t getIndexSizeHighImpl() const {
-        return max_handler_map_size_high_;
+        return item_limit_;
       }
 
       uint32_t getIndexSizeLowImpl() const {
-        return max_handler_map_size_low_;
+        if (item_limit_ == max_handler_map_size_high_) {
+          return max_handler_map_size_low_;
+        }
+        return static_cast<uint32_t>(uint64_t{max_handler_map_size_low_}
+                                     * item_limit_
+                                     / max_handler_map_size_high_);
       }
 
       uint32_t getCacheItemCountImpl() const {
@@ -64,6 +71,26 @@ namespace iroha {
         }
       }
 
+      size_t memoryUsageImpl(size_t item_heap_bytes) const {
+        // the nodes of the map and of the index hold two pointers besides the
+        // items
+        constexpr size_t kMapNodeBytes =
+            sizeof(typename decltype(handler_map_)::value_type)
+            + sizeof(void *);
+        constexpr size_t kIndexNodeBytes = sizeof(KeyType) + 2 * sizeof(void *);
+        return sizeof(*this) + handler_map_.bucket_count() * sizeof(void *)
+            + handler_map_.size() * (kMapNodeBytes + item_heap_bytes)
+            + handler_map_index_.size() * kIndexNodeBytes;
+      }
+
+      void limitItemsImpl(uint32_t max_items) {
+        item_limit_ = std::min(max_items, max_handler_map_size_high_);
+        while (handler_map_.size() > item_limit_) {
+          handler_map_.erase(handler_map_index_.front());
+          handler_map_index_.pop_front();
+        }
+      }
+
      private:
       std::unordered_map<KeyType, ValueType, KeyHash> handler_map_;
       std::list<KeyType> handler_map_index_;
@@ -75,6 +102,8 @@ namespace iroha {
        */
       const uint32_t max_handler_map_size_high_;
       const uint32_t max_handler_map_size_low_;
+      /// high border lowered by limitItems
+      uint32_t item_limit_;
     };
   }  // namespace cache
 }  // namespace iroha
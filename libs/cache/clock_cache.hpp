@@ -0,0 +1,181 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CLOCK_CACHE_HPP
+#define IROHA_CLOCK_CACHE_HPP
+
+#include "cache/abstract_cache.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace iroha {
+  namespace cache {
+
+    /**
+     * Cache for arbitrary types, which evicts the least recently used items
+     * approximately by the CLOCK algorithm: a found item is marked as
+     * referenced, and the eviction hand skips and unmarks the referenced
+     * items. Marking is atomic, so the lookups share the lock of the cache.
+     * The items are kept in the slots preallocated for getIndexSizeHigh()
+     * items, which are reused after eviction.
+     * @tparam KeyType type of key objects
+     * @tparam ValueType type of value objects
+     * @tparam KeyHash hasher for keys
+     */
+    template <typename KeyType,
+              typename ValueType,
+              typename KeyHash = std::hash<KeyType>>
+    class ClockCache
+        : public AbstractCache<KeyType,
+                               ValueType,
+                               ClockCache<KeyType, ValueType, KeyHash>> {
+     public:
+      ClockCache(uint32_t max_handler_map_size_high = 20000,
+                 uint32_t max_handler_map_size_low = 10000)
+          : max_handler_map_size_high_(max_handler_map_size_high),
+            max_handler_map_size_low_(max_handler_map_size_low),
+            item_limit_(max_handler_map_size_high),
+            slots_(max_handler_map_size_high + 1) {
+        // the map holds at most one item per slot, so it is never rehashed
+        // and the iterators kept in the slots stay valid
+        handler_map_.reserve(slots_.size());
+        free_slots_.reserve(slots_.size());
+        for (size_t i = slots_.size(); i > 0; --i) {
+          free_slots_.push_back(i - 1);
+        }
+      }
+
+      uint32_t getIndexSizeHighImpl() const {
+        return item_limit_;
+      }
+
+      uint32_t getIndexSizeLowImpl() const {
+        if (item_limit_ == max_handler_map_size_high_) {
+          return max_handler_map_size_low_;
+        }
+        return static_cast<uint32_t>(uint64_t{max_handler_map_size_low_}
+                                     * item_limit_
+                                     / max_handler_map_size_high_);
+      }
+
+      uint32_t getCacheItemCountImpl() const {
+        return (uint32_t)handler_map_.size();
+      }
+
+      void addItemImpl(const KeyType &key, const ValueType &value) {
+        // elements with the same hash should be replaced
+        auto found = handler_map_.find(key);
+        if (found != handler_map_.end()) {
+          slots_[found->second].value = value;
+          slots_[found->second].referenced.store(true,
+                                                 std::memory_order_relaxed);
+          return;
+        }
+
+        auto slot = free_slots_.back();
+        free_slots_.pop_back();
+        slots_[slot].value = value;
+        slots_[slot].taken = true;
+        slots_[slot].referenced.store(false, std::memory_order_relaxed);
+        slots_[slot].key = handler_map_.emplace(key, slot).first;
+        if (handler_map_.size() > getIndexSizeHighImpl()) {
+          // the new item is kept, as the caller is about to find it
+          while (handler_map_.size()
+                 > std::max<size_t>(getIndexSizeLowImpl(), 1)) {
+            evictOne(slot);
+          }
+        }
+      }
+
+      boost::optional<ValueType> findItemImpl(const KeyType &key) const {
+        auto found = handler_map_.find(key);
+        if (found == handler_map_.end()) {
+          return boost::none;
+        }
+        const auto &slot = slots_[found->second];
+        slot.referenced.store(true, std::memory_order_relaxed);
+        return slot.value;
+      }
+
+      size_t memoryUsageImpl(size_t item_heap_bytes) const {
+        return sizeof(*this) + slots_.capacity() * sizeof(Slot)
+            + free_slots_.capacity() * sizeof(size_t)
+            + handler_map_.bucket_count() * sizeof(void *)
+            + handler_map_.size() * itemMemoryUsage(item_heap_bytes);
+      }
+
+      /**
+       * @param item_heap_bytes - heap memory owned by a key and a value
+       * @return memory taken by an item besides its preallocated slot
+       */
+      static size_t itemMemoryUsage(size_t item_heap_bytes) {
+        // a node of the map holds the key, the slot index and the pointer to
+        // the next node
+        return sizeof(typename HandlerMap::value_type) + sizeof(void *)
+            + item_heap_bytes;
+      }
+
+      void limitItemsImpl(uint32_t max_items) {
+        // the slots are preallocated, so the limit cannot grow past them
+        item_limit_ = std::min(max_items, max_handler_map_size_high_);
+        while (handler_map_.size() > item_limit_) {
+          evictOne();
+        }
+      }
+
+     private:
+      using HandlerMap = std::unordered_map<KeyType, size_t, KeyHash>;
+
+      /// storage of a cached item
+      struct Slot {
+        /// position of the item in the map, valid while the slot is taken
+        typename HandlerMap::iterator key;
+        ValueType value;
+        bool taken = false;
+        mutable std::atomic<bool> referenced{false};
+      };
+
+      /// evicts the first unreferenced item starting from the hand, except
+      /// the one in the kept slot
+      void evictOne(size_t kept = std::numeric_limits<size_t>::max()) {
+        while (true) {
+          auto current = hand_;
+          auto &slot = slots_[current];
+          hand_ = (hand_ + 1) % slots_.size();
+          if (not slot.taken or current == kept
+              or slot.referenced.exchange(false, std::memory_order_relaxed)) {
+            continue;
+          }
+          handler_map_.erase(slot.key);
+          slot.value = ValueType{};
+          slot.taken = false;
+          free_slots_.push_back(current);
+          return;
+        }
+      }
+
+      HandlerMap handler_map_;
+
+      /**
+       * Protection from handler map overflow.
+       */
+      const uint32_t max_handler_map_size_high_;
+      const uint32_t max_handler_map_size_low_;
+      /// high border lowered by limitItems
+      uint32_t item_limit_;
+
+      std::vector<Slot> slots_;
+      std::vector<size_t> free_slots_;
+      /// position of the eviction hand in the slots
+      size_t hand_ = 0;
+    };
+  }  // namespace cache
+}  // namespace iroha
+
+#endif  // IROHA_CLOCK_CACHE_HPP
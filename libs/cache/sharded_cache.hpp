@@ -0,0 +1,148 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARDED_CACHE_HPP
+#define IROHA_SHARDED_CACHE_HPP
+
+#include "cache/clock_cache.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace iroha {
+  namespace cache {
+
+    /**
+     * Cache for arbitrary types split into the shards by the key hash, each
+     * shard being a ClockCache with its own lock, so the concurrent accesses
+     * to different keys rarely wait for each other. The limits of the cache
+     * are divided between the shards.
+     * @tparam KeyType type of key objects
+     * @tparam ValueType type of value objects
+     * @tparam KeyHash hasher for keys
+     */
+    template <typename KeyType,
+              typename ValueType,
+              typename KeyHash = std::hash<KeyType>>
+    class ShardedCache {
+     public:
+      using Shard = ClockCache<KeyType, ValueType, KeyHash>;
+
+      static constexpr size_t kDefaultShards = 16;
+
+      ShardedCache(uint32_t max_handler_map_size_high = 20000,
+                   uint32_t max_handler_map_size_low = 10000,
+                   size_t shards = kDefaultShards)
+          : max_handler_map_size_high_(max_handler_map_size_high),
+            max_handler_map_size_low_(max_handler_map_size_low) {
+        shards = std::max<size_t>(shards, 1);
+        shards_.reserve(shards);
+        for (size_t i = 0; i < shards; ++i) {
+          shards_.push_back(std::make_unique<Shard>(
+              (max_handler_map_size_high + shards - 1) / shards,
+              max_handler_map_size_low / shards));
+        }
+      }
+
+      /**
+       * @return high border of cache limit (@see AbstractCache#addItem)
+       */
+      uint32_t getIndexSizeHigh() const {
+        return max_handler_map_size_high_;
+      }
+
+      /**
+       * @return low border of cache limit (@see AbstractCache#addItem)
+       */
+      uint32_t getIndexSizeLow() const {
+        return max_handler_map_size_low_;
+      }
+
+      /**
+       * @return amount of items in cache
+       */
+      uint32_t getCacheItemCount() const {
+        uint32_t count = 0;
+        for (const auto &shard : shards_) {
+          count += shard->getCacheItemCount();
+        }
+        return count;
+      }
+
+      /**
+       * Adds new item to the shard of the key, see AbstractCache#addItem
+       * @param key - key to insert
+       * @param value - value to insert
+       */
+      void addItem(const KeyType &key, const ValueType &value) {
+        shardOf(key).addItem(key, value);
+      }
+
+      /**
+       * Performs a search for an item with a specific key.
+       * @param key - key to find
+       * @return Optional of ValueType
+       */
+      boost::optional<ValueType> findItem(const KeyType &key) const {
+        return shardOf(key).findItem(key);
+      }
+
+      /**
+       * @param item_heap_bytes - heap memory owned by a key and a value, which
+       * the cache does not see
+       * @return approximate memory taken by the cache in bytes
+       */
+      size_t memoryUsage(size_t item_heap_bytes = 0) const {
+        size_t usage = sizeof(*this) + shards_.capacity() * sizeof(void *);
+        for (const auto &shard : shards_) {
+          usage += shard->memoryUsage(item_heap_bytes);
+        }
+        return usage;
+      }
+
+      /**
+       * Lowers the limit of the items, so that the cache takes approximately
+       * at most the given memory, evicting the items over it. The memory of
+       * the preallocated slots is not released, so the cache takes it even if
+       * it is over the budget.
+       * @param max_bytes - memory budget of the cache
+       * @param item_heap_bytes - heap memory owned by a key and a value
+       */
+      void limitMemory(size_t max_bytes, size_t item_heap_bytes = 0) {
+        auto per_shard = max_bytes / shards_.size();
+        for (const auto &shard : shards_) {
+          // the memory of an empty shard is fixed, the rest is taken by the
+          // items
+          auto usage = shard->memoryUsage();
+          auto items_usage =
+              shard->getCacheItemCount() * Shard::itemMemoryUsage(0);
+          auto fixed = usage > items_usage ? usage - items_usage : 0;
+          auto items = per_shard > fixed
+              ? (per_shard - fixed) / Shard::itemMemoryUsage(item_heap_bytes)
+              : 0;
+          shard->limitItems(static_cast<uint32_t>(std::min<size_t>(
+              items, std::numeric_limits<uint32_t>::max())));
+        }
+      }
+
+     private:
+      Shard &shardOf(const KeyType &key) const {
+        // the hash is mixed, so that the shards do not take the same low bits
+        // as the buckets of their maps
+        auto hash =
+            static_cast<uint64_t>(KeyHash{}(key)) * 0x9E3779B97F4A7C15ull;
+        return *shards_[(hash >> 32) % shards_.size()];
+      }
+
+      const uint32_t max_handler_map_size_high_;
+      const uint32_t max_handler_map_size_low_;
+      std::vector<std::unique_ptr<Shard>> shards_;
+    };
+  }  // namespace cache
+}  // namespace iroha
+
+#endif  // IROHA_SHARDED_CACHE_HPP
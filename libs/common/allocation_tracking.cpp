@@ -0,0 +1,201 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/allocation_tracking.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+
+#ifdef IROHA_ALLOCATION_TRACKING
+#include <cstdlib>
+#include <new>
+#endif
+
+namespace {
+
+  constexpr size_t kTags = static_cast<size_t>(iroha::AllocationTag::kCount);
+
+#ifdef IROHA_ALLOCATION_TRACKING
+  /// counters of a tag, on their own cache line, as every allocating thread
+  /// changes them
+  struct alignas(64) TagCounters {
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> bytes{0};
+  };
+
+  // constant initialized, so they are usable by the allocations made before
+  // main and during the dynamic initialization
+  std::array<TagCounters, kTags> tag_counters;
+  thread_local iroha::AllocationTag thread_tag = iroha::AllocationTag::kOther;
+  thread_local iroha::AllocationCounters thread_counters;
+
+  void count(size_t size) {
+    auto &counters = tag_counters[static_cast<size_t>(thread_tag)];
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.bytes.fetch_add(size, std::memory_order_relaxed);
+    ++thread_counters.allocations;
+    thread_counters.bytes += size;
+  }
+
+  void *allocate(size_t size) {
+    count(size);
+    return std::malloc(size == 0 ? 1 : size);
+  }
+
+  void *allocate(size_t size, std::align_val_t alignment) {
+    count(size);
+    auto align = std::max(static_cast<size_t>(alignment), sizeof(void *));
+    void *pointer = nullptr;
+    return posix_memalign(&pointer, align, size == 0 ? 1 : size) == 0
+        ? pointer
+        : nullptr;
+  }
+
+  template <typename... Alignment>
+  void *allocateOrThrow(size_t size, Alignment... alignment) {
+    if (auto pointer = allocate(size, alignment...)) {
+      return pointer;
+    }
+    throw std::bad_alloc();
+  }
+#endif
+
+  const std::array<const char *, kTags> kTagNames{
+      {"other", "torii", "ordering", "consensus", "validation", "mst"}};
+
+}  // namespace
+
+namespace iroha {
+
+  const char *allocationTagName(AllocationTag tag) {
+    return kTagNames[static_cast<size_t>(tag)];
+  }
+
+#ifdef IROHA_ALLOCATION_TRACKING
+  AllocationCounters allocationCounters(AllocationTag tag) {
+    const auto &counters = tag_counters[static_cast<size_t>(tag)];
+    AllocationCounters result;
+    result.allocations = counters.allocations.load(std::memory_order_relaxed);
+    result.bytes = counters.bytes.load(std::memory_order_relaxed);
+    return result;
+  }
+
+  AllocationCounters threadAllocationCounters() {
+    return thread_counters;
+  }
+
+  ScopedAllocationTag::ScopedAllocationTag(AllocationTag tag)
+      : previous_(thread_tag) {
+    thread_tag = tag;
+  }
+
+  ScopedAllocationTag::~ScopedAllocationTag() {
+    thread_tag = previous_;
+  }
+#else
+  AllocationCounters allocationCounters(AllocationTag) {
+    return {};
+  }
+
+  AllocationCounters threadAllocationCounters() {
+    return {};
+  }
+#endif
+
+}  // namespace iroha
+
+#ifdef IROHA_ALLOCATION_TRACKING
+// the replacements of the global allocation functions, which are linked into
+// every binary using the tags
+
+void *operator new(size_t size) {
+  return allocateOrThrow(size);
+}
+
+void *operator new[](size_t size) {
+  return allocateOrThrow(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+  return allocate(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+  return allocate(size);
+}
+
+void *operator new(size_t size, std::align_val_t alignment) {
+  return allocateOrThrow(size, alignment);
+}
+
+void *operator new[](size_t size, std::align_val_t alignment) {
+  return allocateOrThrow(size, alignment);
+}
+
+void *operator new(size_t size,
+                   std::align_val_t alignment,
+                   const std::nothrow_t &) noexcept {
+  return allocate(size, alignment);
+}
+
+void *operator new[](size_t size,
+                     std::align_val_t alignment,
+                     const std::nothrow_t &) noexcept {
+  return allocate(size, alignment);
+}
+
+void operator delete(void *pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void *pointer, size_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void *pointer, size_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void *pointer, const std::nothrow_t &) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void *pointer, std::align_val_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void *pointer, std::align_val_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void *pointer, size_t, std::align_val_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void *pointer, size_t, std::align_val_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void *pointer,
+                     std::align_val_t,
+                     const std::nothrow_t &) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void *pointer,
+                       std::align_val_t,
+                       const std::nothrow_t &) noexcept {
+  std::free(pointer);
+}
+#endif
@@ -0,0 +1,76 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMMON_ALLOCATION_TRACKING_HPP
+#define IROHA_COMMON_ALLOCATION_TRACKING_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace iroha {
+
+  /// whether the global allocator of the build counts the allocations, it
+  /// is enabled with the USE_ALLOCATION_TRACKING build option
+#ifdef IROHA_ALLOCATION_TRACKING
+  constexpr bool kAllocationTracking = true;
+#else
+  constexpr bool kAllocationTracking = false;
+#endif
+
+  /// subsystem the heap allocations are attributed to
+  enum class AllocationTag : uint8_t {
+    kOther,
+    kTorii,
+    kOrdering,
+    kConsensus,
+    kValidation,
+    kMst,
+    kCount
+  };
+
+  /// @return name of the tag in the metrics
+  const char *allocationTagName(AllocationTag tag);
+
+  /// heap allocations made through the global operator new
+  struct AllocationCounters {
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+  };
+
+  /// @return allocations made under the tag since the start of the process,
+  /// zeros if the build does not track the allocations
+  AllocationCounters allocationCounters(AllocationTag tag);
+
+  /// @return allocations made by the calling thread since its start, zeros if
+  /// the build does not track the allocations
+  AllocationCounters threadAllocationCounters();
+
+#ifdef IROHA_ALLOCATION_TRACKING
+  /**
+   * Attributes the allocations of the calling thread to the tag till the end
+   * of the scope, the scopes may be nested
+   */
+  class ScopedAllocationTag {
+   public:
+    explicit ScopedAllocationTag(AllocationTag tag);
+    ~ScopedAllocationTag();
+
+    ScopedAllocationTag(const ScopedAllocationTag &) = delete;
+    ScopedAllocationTag &operator=(const ScopedAllocationTag &) = delete;
+
+   private:
+    AllocationTag previous_;
+  };
+#else
+  /// the allocations are not tracked, so the tag costs nothing
+  class ScopedAllocationTag {
+   public:
+    explicit ScopedAllocationTag(AllocationTag) {}
+  };
+#endif
+
+}  // namespace iroha
+
+#endif  // IROHA_COMMON_ALLOCATION_TRACKING_HPP
@@ -0,0 +1,34 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COUNTER_HPP
+#define IROHA_COUNTER_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace iroha {
+
+  /**
+   * Monotonic counter of events. Increment is lock-free and may be done from
+   * any thread.
+   */
+  class Counter {
+   public:
+    void increment(uint64_t value = 1) {
+      value_.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    uint64_t value() const {
+      return value_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    std::atomic<uint64_t> value_{0};
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_COUNTER_HPP
@@ -6,32 +6,299 @@
 #define IROHA_HEXUTILS_HPP
 
 #include <ciso646>
-#include <iomanip>
-#include <sstream>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 #include <boost/optional.hpp>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace iroha {
 
+  /**
+   * The conversions process the bulk of the string with the vector
+   * instructions the compiler targets, which are AVX2, SSSE3 or SSE2 on x86
+   * and NEON on ARM, and the rest of it with the scalar code. All of them
+   * give the same results: the hex digits are lower case on encoding, and
+   * either case on decoding
+   */
+  namespace detail {
+
+    constexpr char kHexDigits[] = "0123456789abcdef";
+
+    /// @return the value of the hex digit, or -1
+    inline int hexDigitValue(char c) {
+      if (c >= '0' and c <= '9') {
+        return c - '0';
+      }
+      if (c >= 'a' and c <= 'f') {
+        return c - 'a' + 10;
+      }
+      if (c >= 'A' and c <= 'F') {
+        return c - 'A' + 10;
+      }
+      return -1;
+    }
+
+    inline void hexEncodeScalar(const uint8_t *in, size_t size, char *out) {
+      for (size_t i = 0; i < size; ++i) {
+        out[2 * i] = kHexDigits[in[i] >> 4];
+        out[2 * i + 1] = kHexDigits[in[i] & 0x0f];
+      }
+    }
+
+    /// @return false if the input has a character which is not a hex digit
+    inline bool hexDecodeScalar(const char *in, size_t size, uint8_t *out) {
+      for (size_t i = 0; i < size; ++i) {
+        auto high = hexDigitValue(in[2 * i]);
+        auto low = hexDigitValue(in[2 * i + 1]);
+        if (high < 0 or low < 0) {
+          return false;
+        }
+        out[i] = static_cast<uint8_t>(high << 4 | low);
+      }
+      return true;
+    }
+
+#if defined(__SSE2__)
+    /// @return the hex digits of the nibbles
+    inline __m128i hexDigits128(__m128i nibbles) {
+#if defined(__SSSE3__)
+      return _mm_shuffle_epi8(
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(kHexDigits)),
+          nibbles);
+#else
+      auto letters = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+      return _mm_add_epi8(
+          _mm_add_epi8(nibbles, _mm_set1_epi8('0')),
+          _mm_and_si128(letters, _mm_set1_epi8('a' - '0' - 10)));
+#endif
+    }
+
+    /**
+     * @param valid - all ones for the hex digits, zeros for the others
+     * @return the values of the hex digits
+     */
+    inline __m128i hexValues128(__m128i chars, __m128i &valid) {
+      auto digits = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+      auto letters = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)),
+                                  _mm_set1_epi8('a'));
+      auto is_digit = _mm_cmpeq_epi8(
+          _mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+      auto is_letter = _mm_cmpeq_epi8(
+          _mm_min_epu8(letters, _mm_set1_epi8(5)), letters);
+      valid = _mm_or_si128(is_digit, is_letter);
+      return _mm_or_si128(
+          _mm_and_si128(digits, is_digit),
+          _mm_and_si128(_mm_add_epi8(letters, _mm_set1_epi8(10)), is_letter));
+    }
+
+    /// @return the bytes of the pairs of the nibbles in the 16-bit lanes
+    inline __m128i hexPairs128(__m128i values) {
+#if defined(__SSSE3__)
+      return _mm_maddubs_epi16(values, _mm_set1_epi16(0x0110));
+#else
+      return _mm_or_si128(
+          _mm_slli_epi16(_mm_and_si128(values, _mm_set1_epi16(0x00ff)), 4),
+          _mm_srli_epi16(values, 8));
+#endif
+    }
+#endif
+
+#if defined(__AVX2__)
+    inline __m256i hexDigits256(__m256i nibbles) {
+      return _mm256_shuffle_epi8(
+          _mm256_broadcastsi128_si256(
+              _mm_loadu_si128(reinterpret_cast<const __m128i *>(kHexDigits))),
+          nibbles);
+    }
+
+    inline __m256i hexValues256(__m256i chars, __m256i &valid) {
+      auto digits = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+      auto letters = _mm256_sub_epi8(
+          _mm256_or_si256(chars, _mm256_set1_epi8(0x20)),
+          _mm256_set1_epi8('a'));
+      auto is_digit = _mm256_cmpeq_epi8(
+          _mm256_min_epu8(digits, _mm256_set1_epi8(9)), digits);
+      auto is_letter = _mm256_cmpeq_epi8(
+          _mm256_min_epu8(letters, _mm256_set1_epi8(5)), letters);
+      valid = _mm256_or_si256(is_digit, is_letter);
+      return _mm256_or_si256(
+          _mm256_and_si256(digits, is_digit),
+          _mm256_and_si256(_mm256_add_epi8(letters, _mm256_set1_epi8(10)),
+                           is_letter));
+    }
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    inline uint8x16_t hexDigitsNeon(uint8x16_t nibbles) {
+      auto letters = vcgtq_u8(nibbles, vdupq_n_u8(9));
+      return vaddq_u8(vaddq_u8(nibbles, vdupq_n_u8('0')),
+                      vandq_u8(letters, vdupq_n_u8('a' - '0' - 10)));
+    }
+
+    inline uint8x16_t hexValuesNeon(uint8x16_t chars, uint8x16_t &valid) {
+      auto digits = vsubq_u8(chars, vdupq_n_u8('0'));
+      auto letters =
+          vsubq_u8(vorrq_u8(chars, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+      auto is_digit = vcltq_u8(digits, vdupq_n_u8(10));
+      auto is_letter = vcltq_u8(letters, vdupq_n_u8(6));
+      valid = vorrq_u8(is_digit, is_letter);
+      return vorrq_u8(
+          vandq_u8(digits, is_digit),
+          vandq_u8(vaddq_u8(letters, vdupq_n_u8(10)), is_letter));
+    }
+
+    inline bool allSetNeon(uint8x16_t mask) {
+      auto half = vand_u8(vget_low_u8(mask), vget_high_u8(mask));
+      return vget_lane_u64(vreinterpret_u64_u8(half), 0) == ~uint64_t{0};
+    }
+#endif
+
+    /**
+     * Encode the bytes to the hex digits, two per byte
+     * @param out - buffer of 2 * size characters
+     */
+    inline void hexEncode(const uint8_t *in, size_t size, char *out) {
+      size_t i = 0;
+#if defined(__AVX2__)
+      for (; i + 32 <= size; i += 32) {
+        auto bytes =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+        auto mask = _mm256_set1_epi8(0x0f);
+        auto high =
+            hexDigits256(_mm256_and_si256(_mm256_srli_epi16(bytes, 4), mask));
+        auto low = hexDigits256(_mm256_and_si256(bytes, mask));
+        // the unpacks interleave the 128-bit lanes separately
+        auto first = _mm256_unpacklo_epi8(high, low);
+        auto second = _mm256_unpackhi_epi8(high, low);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 2 * i),
+                            _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 2 * i + 32),
+                            _mm256_permute2x128_si256(first, second, 0x31));
+      }
+#endif
+#if defined(__SSE2__)
+      for (; i + 16 <= size; i += 16) {
+        auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        auto mask = _mm_set1_epi8(0x0f);
+        auto high = hexDigits128(_mm_and_si128(_mm_srli_epi16(bytes, 4), mask));
+        auto low = hexDigits128(_mm_and_si128(bytes, mask));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2 * i),
+                         _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2 * i + 16),
+                         _mm_unpackhi_epi8(high, low));
+      }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+      for (; i + 16 <= size; i += 16) {
+        auto bytes = vld1q_u8(in + i);
+        uint8x16x2_t digits;
+        digits.val[0] = hexDigitsNeon(vshrq_n_u8(bytes, 4));
+        digits.val[1] = hexDigitsNeon(vandq_u8(bytes, vdupq_n_u8(0x0f)));
+        vst2q_u8(reinterpret_cast<uint8_t *>(out + 2 * i), digits);
+      }
+#endif
+      hexEncodeScalar(in + i, size - i, out + 2 * i);
+    }
+
+    /**
+     * Decode the pairs of the hex digits to the bytes
+     * @param in - 2 * size characters
+     * @return false if the input has a character which is not a hex digit
+     */
+    inline bool hexDecode(const char *in, size_t size, uint8_t *out) {
+      size_t i = 0;
+#if defined(__AVX2__)
+      for (; i + 32 <= size; i += 32) {
+        __m256i first_valid, second_valid;
+        auto first = hexValues256(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + 2 * i)),
+            first_valid);
+        auto second = hexValues256(_mm256_loadu_si256(
+                                       reinterpret_cast<const __m256i *>(
+                                           in + 2 * i + 32)),
+                                   second_valid);
+        if (_mm256_movemask_epi8(_mm256_and_si256(first_valid, second_valid))
+            != -1) {
+          return false;
+        }
+        auto pairs = _mm256_set1_epi16(0x0110);
+        // the pack interleaves the 128-bit lanes of its arguments
+        auto bytes = _mm256_packus_epi16(_mm256_maddubs_epi16(first, pairs),
+                                         _mm256_maddubs_epi16(second, pairs));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i),
+                            _mm256_permute4x64_epi64(bytes, 0xd8));
+      }
+#endif
+#if defined(__SSE2__)
+      for (; i + 16 <= size; i += 16) {
+        __m128i first_valid, second_valid;
+        auto first = hexValues128(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 2 * i)),
+            first_valid);
+        auto second = hexValues128(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 2 * i + 16)),
+            second_valid);
+        if (_mm_movemask_epi8(_mm_and_si128(first_valid, second_valid))
+            != 0xffff) {
+          return false;
+        }
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i *>(out + i),
+            _mm_packus_epi16(hexPairs128(first), hexPairs128(second)));
+      }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+      for (; i + 16 <= size; i += 16) {
+        auto chars = vld2q_u8(reinterpret_cast<const uint8_t *>(in + 2 * i));
+        uint8x16_t high_valid, low_valid;
+        auto high = hexValuesNeon(chars.val[0], high_valid);
+        auto low = hexValuesNeon(chars.val[1], low_valid);
+        if (not allSetNeon(vandq_u8(high_valid, low_valid))) {
+          return false;
+        }
+        vst1q_u8(out + i, vorrq_u8(vshlq_n_u8(high, 4), low));
+      }
+#endif
+      return hexDecodeScalar(in + 2 * i, size - i, out + i);
+    }
+
+  }  // namespace detail
+
+  /**
+   * Convert raw bytes to printable hex string
+   * @param data - raw bytes to convert
+   * @param size - number of the bytes
+   * @return - converted hex string
+   */
+  inline std::string bytesToHexstring(const void *data, size_t size) {
+    std::string result(2 * size, 0);
+    detail::hexEncode(static_cast<const uint8_t *>(data), size, &result[0]);
+    return result;
+  }
+
   /**
    * Convert string of raw bytes to printable hex string
    * @param str - raw bytes string to convert
    * @return - converted hex string
    */
   inline std::string bytestringToHexstring(const std::string &str) {
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-    for (const auto &c : str) {
-      ss << std::setw(2) << (static_cast<int>(c) & 0xff);
-    }
-    return ss.str();
+    return bytesToHexstring(str.data(), str.size());
   }
 
   /**
    * Convert printable hex string to string of raw bytes
    * @param str - hex string to convert
-   * @return - raw bytes converted string or boost::noneif provided string
+   * @return - raw bytes converted string or boost::none if provided string
    * was not a correct hex string
    */
   inline boost::optional<std::string> hexstringToBytestring(
@@ -40,20 +307,10 @@ namespace iroha {
       return boost::none;
     }
     std::string result(str.size() / 2, 0);
-    for (size_t i = 0; i < result.length(); ++i) {
-      std::string byte = str.substr(i * 2, 2);
-      size_t pos = 0;  // processed characters count
-      try {
-        result.at(i) =
-            static_cast<std::string::value_type>(std::stoul(byte, &pos, 16));
-      } catch (const std::invalid_argument &) {
-        return boost::none;
-      } catch (const std::out_of_range &) {
-        return boost::none;
-      }
-      if (pos != byte.size()) {
-        return boost::none;
-      }
+    if (not detail::hexDecode(str.data(),
+                              result.size(),
+                              reinterpret_cast<uint8_t *>(&result[0]))) {
+      return boost::none;
     }
     return result;
   }
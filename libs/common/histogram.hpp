@@ -0,0 +1,95 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_HISTOGRAM_HPP
+#define IROHA_HISTOGRAM_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace iroha {
+
+  /**
+   * Histogram of observed values with fixed upper bounds of the buckets.
+   * The value falls into the first bucket with the bound not less than the
+   * value, the last bucket counts the values which exceed all bounds.
+   * Observation is lock-free and may be done from any thread.
+   */
+  class Histogram {
+   public:
+    /**
+     * @param bounds - sorted upper bounds of the buckets
+     */
+    explicit Histogram(std::vector<uint64_t> bounds)
+        : bounds_(std::move(bounds)),
+          buckets_(new std::atomic<uint64_t>[bounds_.size() + 1]) {
+      for (size_t i = 0; i <= bounds_.size(); ++i) {
+        buckets_[i] = 0;
+      }
+    }
+
+    /**
+     * Bounds start, start * factor, start * factor^2, ...
+     * @param start - bound of the first bucket
+     * @param factor - ratio of the consequent bounds
+     * @param count - number of bounds
+     */
+    static std::vector<uint64_t> exponentialBounds(uint64_t start,
+                                                   uint64_t factor,
+                                                   size_t count) {
+      std::vector<uint64_t> bounds;
+      bounds.reserve(count);
+      for (auto bound = start; bounds.size() < count; bound *= factor) {
+        bounds.push_back(bound);
+      }
+      return bounds;
+    }
+
+    void observe(uint64_t value) {
+      auto bucket = std::lower_bound(bounds_.begin(), bounds_.end(), value)
+          - bounds_.begin();
+      buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+      count_.fetch_add(1, std::memory_order_relaxed);
+      sum_.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /// upper bounds of the buckets
+    const std::vector<uint64_t> &bounds() const {
+      return bounds_;
+    }
+
+    /// number of observed values for each bucket, including the last one
+    std::vector<uint64_t> bucketCounts() const {
+      std::vector<uint64_t> counts;
+      counts.reserve(bounds_.size() + 1);
+      for (size_t i = 0; i <= bounds_.size(); ++i) {
+        counts.push_back(buckets_[i].load(std::memory_order_relaxed));
+      }
+      return counts;
+    }
+
+    /// number of observed values
+    uint64_t count() const {
+      return count_.load(std::memory_order_relaxed);
+    }
+
+    /// sum of observed values
+    uint64_t sum() const {
+      return sum_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    std::vector<uint64_t> bounds_;
+    std::unique_ptr<std::atomic<uint64_t>[]> buckets_;
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_HISTOGRAM_HPP
@@ -0,0 +1,112 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMMON_NAMED_THREAD_HPP
+#define IROHA_COMMON_NAMED_THREAD_HPP
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <rxcpp/rx-lite.hpp>
+#include <rxcpp/operators/rx-observe_on.hpp>
+#include "common/stage_executor.hpp"
+#include "common/thread_name.hpp"
+
+namespace iroha {
+
+  /**
+   * Same as rxcpp::observe_on_new_thread, but the thread of the worker is
+   * named, so it can be told apart in a profile and in the CPU metrics
+   * @param name - name of the worker thread
+   * @return coordination with a single worker in a new named thread
+   */
+  inline rxcpp::observe_on_one_worker observeOnNamedThread(std::string name) {
+    return rxcpp::observe_on_one_worker(rxcpp::schedulers::make_new_thread(
+        [name = std::move(name)](std::function<void()> start) {
+          return std::thread([name, start = std::move(start)] {
+            setThreadName(name);
+            start();
+          });
+        }));
+  }
+
+  /**
+   * Scheduler of rxcpp which runs the actions of all its workers on the
+   * thread of the stage executor instead of a thread per worker
+   */
+  class StageExecutorScheduler
+      : public rxcpp::schedulers::scheduler_interface {
+   public:
+    explicit StageExecutorScheduler(std::shared_ptr<StageExecutor> executor)
+        : executor_(std::move(executor)) {}
+
+    clock_type::time_point now() const override {
+      return clock_type::now();
+    }
+
+    rxcpp::schedulers::worker create_worker(
+        rxcpp::composite_subscription lifetime) const override {
+      return rxcpp::schedulers::worker(std::move(lifetime),
+                                       std::make_shared<Worker>(executor_));
+    }
+
+   private:
+    class Worker : public rxcpp::schedulers::worker_interface {
+     public:
+      explicit Worker(std::shared_ptr<StageExecutor> executor)
+          : executor_(std::move(executor)) {}
+
+      clock_type::time_point now() const override {
+        return clock_type::now();
+      }
+
+      void schedule(
+          const rxcpp::schedulers::schedulable &action) const override {
+        executor_->post([action] { run(action); });
+      }
+
+      void schedule(
+          clock_type::time_point when,
+          const rxcpp::schedulers::schedulable &action) const override {
+        if (when <= now()) {
+          schedule(action);
+        } else {
+          executor_->postAt(when, [action] { run(action); });
+        }
+      }
+
+     private:
+      static void run(const rxcpp::schedulers::schedulable &action) {
+        if (not action.is_subscribed()) {
+          return;
+        }
+        rxcpp::schedulers::recursion recursion(true);
+        action(recursion.get_recurse());
+      }
+
+      std::shared_ptr<StageExecutor> executor_;
+    };
+
+    std::shared_ptr<StageExecutor> executor_;
+  };
+
+  /**
+   * Same as observeOnNamedThread, but the events are passed through the
+   * bounded queue of the stage executor
+   * @param executor - executor of the stage
+   * @return coordination with a single worker on the thread of the executor
+   */
+  inline rxcpp::observe_on_one_worker observeOnExecutor(
+      std::shared_ptr<StageExecutor> executor) {
+    return rxcpp::observe_on_one_worker(
+        rxcpp::schedulers::make_scheduler<StageExecutorScheduler>(
+            std::move(executor)));
+  }
+
+}  // namespace iroha
+
+#endif  // IROHA_COMMON_NAMED_THREAD_HPP
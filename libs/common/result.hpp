@@ -43,9 +43,13 @@ namespace iroha {
       Value(Args &&... args) : value(std::forward<Args>(args)...) {}
       T value;
       template <typename V>
-      operator Value<V>() {
+      operator Value<V>() const & {
         return {value};
       }
+      template <typename V>
+      operator Value<V>() && {
+        return {std::move(value)};
+      }
     };
 
     template <>
@@ -62,9 +66,13 @@ namespace iroha {
       Error(Args &&... args) : error(std::forward<Args>(args)...) {}
       E error;
       template <typename V>
-      operator Error<V>() {
+      operator Error<V>() const & {
         return {error};
       }
+      template <typename V>
+      operator Error<V>() && {
+        return {std::move(error)};
+      }
     };
 
     template <>
@@ -150,8 +158,8 @@ namespace iroha {
           noexcept {
         return visit_in_place(
             *this,
-            [res = new_res](ValueType) { return res; },
-            [](ErrorType err) -> Result<Value, E> { return err; });
+            [&new_res](const ValueType &) { return new_res; },
+            [](const ErrorType &err) -> Result<Value, E> { return err; });
       }
 
       /**
@@ -170,8 +178,8 @@ namespace iroha {
           noexcept {
         return visit_in_place(
             *this,
-            [](ValueType val) -> Result<Value, E> { return val; },
-            [res = new_res](ErrorType) { return res; });
+            [](const ValueType &val) -> Result<Value, E> { return val; },
+            [&new_res](const ErrorType &) { return new_res; });
       }
     };
 
@@ -188,11 +196,12 @@ namespace iroha {
      */
     template <typename Err1, typename Err2, typename V, typename Fn>
     Result<V, Err1> map_error(const Result<V, Err2> &res, Fn &&map) noexcept {
-      return visit_in_place(res,
-                            [](Value<V> val) -> Result<V, Err1> { return val; },
-                            [map](Error<Err2> err) -> Result<V, Err1> {
-                              return Error<Err1>{map(err.error)};
-                            });
+      return visit_in_place(
+          res,
+          [](const Value<V> &val) -> Result<V, Err1> { return val; },
+          [&map](const Error<Err2> &err) -> Result<V, Err1> {
+            return Error<Err1>{map(err.error)};
+          });
     }
 
     // Factory methods for avoiding type specification
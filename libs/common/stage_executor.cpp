@@ -0,0 +1,159 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/stage_executor.hpp"
+
+#include <algorithm>
+#include <ciso646>
+
+#include "common/thread_name.hpp"
+
+namespace {
+  /// number of buckets of the times from 1 us to about 8 s
+  constexpr size_t kTimeBuckets = 24;
+
+  uint64_t microsecondsSince(iroha::StageExecutor::Clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               iroha::StageExecutor::Clock::now() - start)
+        .count();
+  }
+}  // namespace
+
+namespace iroha {
+
+  StageExecutor::State::State(std::string name, size_t capacity)
+      : name(std::move(name)),
+        capacity(std::max<size_t>(capacity, 1)),
+        wait_time(Histogram::exponentialBounds(1, 2, kTimeBuckets)),
+        run_time(Histogram::exponentialBounds(1, 2, kTimeBuckets)) {}
+
+  void StageExecutor::State::run() {
+    setThreadName(name);
+    std::unique_lock<std::mutex> lock(mutex);
+    thread_id = std::this_thread::get_id();
+    while (true) {
+      if (not delayed.empty() and delayed.begin()->first <= Clock::now()) {
+        auto due = delayed.begin()->first;
+        auto task = std::move(delayed.begin()->second);
+        delayed.erase(delayed.begin());
+        lock.unlock();
+        runTask(task, due);
+        lock.lock();
+        continue;
+      }
+      if (not queue.empty()) {
+        auto queued = std::move(queue.front());
+        queue.pop_front();
+        lock.unlock();
+        not_full.notify_one();
+        runTask(queued.task, queued.posted);
+        lock.lock();
+        continue;
+      }
+      if (stopped) {
+        break;
+      }
+      if (delayed.empty()) {
+        not_empty.wait(lock);
+      } else {
+        not_empty.wait_until(lock, delayed.begin()->first);
+      }
+    }
+  }
+
+  void StageExecutor::State::runTask(Task &task, Clock::time_point posted) {
+    wait_time.observe(microsecondsSince(posted));
+    auto start = Clock::now();
+    task();
+    // the captures of the task are released before the next one starts
+    task = nullptr;
+    run_time.observe(microsecondsSince(start));
+  }
+
+  StageExecutor::StageExecutor(std::string name, size_t capacity)
+      : state_(std::make_shared<State>(std::move(name), capacity)),
+        thread_([state = state_] { state->run(); }) {}
+
+  StageExecutor::~StageExecutor() {
+    bool own_thread;
+    // the dropped tasks are destroyed after the lock is released
+    decltype(state_->delayed) dropped;
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex);
+      state_->stopped = true;
+      dropped.swap(state_->delayed);
+      own_thread = state_->thread_id == std::this_thread::get_id();
+    }
+    state_->not_empty.notify_one();
+    state_->not_full.notify_all();
+    if (own_thread) {
+      // the last task of the thread destroys the executor, the state is
+      // kept by the thread until it drains the queue
+      thread_.detach();
+    } else {
+      thread_.join();
+    }
+  }
+
+  bool StageExecutor::post(Task task) {
+    auto posted = Clock::now();
+    {
+      std::unique_lock<std::mutex> lock(state_->mutex);
+      if (state_->queue.size() >= state_->capacity
+          and state_->thread_id != std::this_thread::get_id()) {
+        state_->blocked_posts.increment();
+        state_->not_full.wait(lock, [this] {
+          return state_->stopped
+              or state_->queue.size() < state_->capacity;
+        });
+      }
+      if (state_->stopped) {
+        return false;
+      }
+      state_->queue.push_back(Queued{std::move(task), posted});
+    }
+    state_->not_empty.notify_one();
+    return true;
+  }
+
+  bool StageExecutor::postAt(Clock::time_point when, Task task) {
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex);
+      if (state_->stopped) {
+        return false;
+      }
+      state_->delayed.emplace(when, std::move(task));
+    }
+    state_->not_empty.notify_one();
+    return true;
+  }
+
+  const std::string &StageExecutor::name() const {
+    return state_->name;
+  }
+
+  size_t StageExecutor::depth() const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->queue.size();
+  }
+
+  bool StageExecutor::isStageThread() const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->thread_id == std::this_thread::get_id();
+  }
+
+  const Histogram &StageExecutor::waitTime() const {
+    return state_->wait_time;
+  }
+
+  const Histogram &StageExecutor::runTime() const {
+    return state_->run_time;
+  }
+
+  const Counter &StageExecutor::blockedPosts() const {
+    return state_->blocked_posts;
+  }
+
+}  // namespace iroha
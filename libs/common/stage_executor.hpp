@@ -0,0 +1,117 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_STAGE_EXECUTOR_HPP
+#define IROHA_STAGE_EXECUTOR_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "common/counter.hpp"
+#include "common/histogram.hpp"
+
+namespace iroha {
+
+  /**
+   * Named thread of a pipeline stage which runs the tasks posted by any
+   * number of producers in their order. The queue is bounded: a producer
+   * waits while it is full, so a slow stage slows down the stages which
+   * feed it instead of accumulating their events. The tasks posted by the
+   * stage itself are never delayed, as it would wait for itself.
+   *
+   * The time the tasks spend in the queue and the time they run are
+   * observed in microseconds.
+   */
+  class StageExecutor {
+   public:
+    using Clock = std::chrono::steady_clock;
+    using Task = std::function<void()>;
+
+    /**
+     * @param name - name of the thread of the stage
+     * @param capacity - number of the queued tasks which makes the
+     * producers wait
+     */
+    StageExecutor(std::string name, size_t capacity);
+
+    /// runs the queued tasks, the delayed ones are dropped
+    ~StageExecutor();
+
+    StageExecutor(const StageExecutor &) = delete;
+    StageExecutor &operator=(const StageExecutor &) = delete;
+
+    /**
+     * Queue the task, waits while the queue is full
+     * @return false if the executor is stopped and the task is dropped
+     */
+    bool post(Task task);
+
+    /**
+     * Run the task not earlier than the given time. The delayed tasks are
+     * not bounded, as they are the timers of the stage.
+     * @return false if the executor is stopped and the task is dropped
+     */
+    bool postAt(Clock::time_point when, Task task);
+
+    const std::string &name() const;
+
+    /// number of the tasks in the queue, without the delayed ones
+    size_t depth() const;
+
+    /// @return whether the caller runs on the thread of the stage
+    bool isStageThread() const;
+
+    /// microseconds from posting the task to its start
+    const Histogram &waitTime() const;
+
+    /// microseconds of running the task
+    const Histogram &runTime() const;
+
+    /// posts which waited for the space in the queue
+    const Counter &blockedPosts() const;
+
+   private:
+    struct Queued {
+      Task task;
+      Clock::time_point posted;
+    };
+
+    /// state is shared with the thread, which may outlive the executor
+    /// when it is destroyed by its own task
+    struct State {
+      State(std::string name, size_t capacity);
+
+      void run();
+
+      void runTask(Task &task, Clock::time_point posted);
+
+      const std::string name;
+      const size_t capacity;
+      mutable std::mutex mutex;
+      std::condition_variable not_empty;
+      std::condition_variable not_full;
+      std::deque<Queued> queue;
+      std::multimap<Clock::time_point, Task> delayed;
+      bool stopped = false;
+      std::thread::id thread_id;
+      Histogram wait_time;
+      Histogram run_time;
+      Counter blocked_posts;
+    };
+
+    std::shared_ptr<State> state_;
+    std::thread thread_;
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_STAGE_EXECUTOR_HPP
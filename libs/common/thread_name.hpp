@@ -0,0 +1,40 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMMON_THREAD_NAME_HPP
+#define IROHA_COMMON_THREAD_NAME_HPP
+
+#include <string>
+
+#include "common/thread_placement.hpp"
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+namespace iroha {
+
+  /// names longer than this are truncated by the kernel
+  constexpr size_t kMaxThreadNameLength = 15;
+
+  /**
+   * Set the name of the calling thread, which is shown by top, perf and gdb
+   * and is used to account the CPU time of the thread in the metrics. The
+   * thread is bound to the CPUs of its subsystem, see subsystemOfThread
+   * @param name - name of the thread, truncated to kMaxThreadNameLength
+   */
+  inline void setThreadName(const std::string &name) {
+#ifdef __linux__
+    pthread_setname_np(pthread_self(),
+                       name.substr(0, kMaxThreadNameLength).c_str());
+    placeCurrentThread(name);
+#else
+    (void)name;
+#endif
+  }
+
+}  // namespace iroha
+
+#endif  // IROHA_COMMON_THREAD_NAME_HPP
@@ -0,0 +1,286 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMMON_THREAD_PLACEMENT_HPP
+#define IROHA_COMMON_THREAD_PLACEMENT_HPP
+
+#include <algorithm>
+#include <cctype>
+#include <ciso646>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include "common/result.hpp"
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace iroha {
+
+  /// sorted ids of the CPUs
+  using CpuSet = std::vector<size_t>;
+
+  /// CPU sets of the subsystems by their names
+  using ThreadPlacement = std::map<std::string, CpuSet>;
+
+  /// subsystems of the peer which can be placed on their CPUs
+  namespace placement {
+    /// the main thread and the threads which are not of a subsystem
+    const char *const kDefault = "default";
+    const char *const kTorii = "torii";
+    const char *const kConsensus = "consensus";
+    const char *const kOrdering = "ordering";
+    const char *const kValidation = "validation";
+    const char *const kStorage = "storage";
+  }  // namespace placement
+
+  /**
+   * Parse the list of CPUs in the format of taskset and cpusets, such as
+   * "0-3,8,10-11"
+   * @return the set of the CPUs or the error for an invalid or empty list
+   */
+  inline expected::Result<CpuSet, std::string> parseCpuList(
+      const std::string &list) {
+    CpuSet cpus;
+    auto error = [&list] {
+      return expected::makeError("invalid list of CPUs '" + list + "'");
+    };
+    size_t pos = 0;
+    auto number = [&]() -> boost::optional<size_t> {
+      auto begin = pos;
+      while (pos < list.size()
+             and std::isdigit(static_cast<unsigned char>(list[pos]))) {
+        ++pos;
+      }
+      if (pos == begin or pos - begin > 4) {
+        return boost::none;
+      }
+      return std::stoul(list.substr(begin, pos - begin));
+    };
+    while (pos < list.size()) {
+      auto first = number();
+      if (not first) {
+        return error();
+      }
+      auto last = first;
+      if (pos < list.size() and list[pos] == '-') {
+        ++pos;
+        last = number();
+        if (not last or *last < *first) {
+          return error();
+        }
+      }
+      for (auto cpu = *first; cpu <= *last; ++cpu) {
+        cpus.push_back(cpu);
+      }
+      if (pos < list.size() and (list[pos] != ',' or ++pos == list.size())) {
+        return error();
+      }
+    }
+    if (cpus.empty()) {
+      return error();
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return expected::makeValue(std::move(cpus));
+  }
+
+  /// @return the set of the CPUs in the format of parseCpuList
+  inline std::string formatCpuList(const CpuSet &cpus) {
+    std::string list;
+    for (size_t i = 0; i < cpus.size();) {
+      auto j = i;
+      while (j + 1 < cpus.size() and cpus[j + 1] == cpus[j] + 1) {
+        ++j;
+      }
+      if (not list.empty()) {
+        list += ",";
+      }
+      list += std::to_string(cpus[i]);
+      if (j > i) {
+        list += "-" + std::to_string(cpus[j]);
+      }
+      i = j + 1;
+    }
+    return list;
+  }
+
+  /**
+   * Divide the CPUs into the parts of nearly equal sizes, each of adjacent
+   * CPUs. If there are less CPUs than parts, the parts share the CPUs
+   * @return the parts, which are empty if the CPUs are
+   */
+  inline std::vector<CpuSet> splitCpus(const CpuSet &cpus, size_t parts) {
+    std::vector<CpuSet> result(parts);
+    if (cpus.empty()) {
+      return result;
+    }
+    if (cpus.size() < parts) {
+      for (size_t i = 0; i < parts; ++i) {
+        result[i].push_back(cpus[i % cpus.size()]);
+      }
+      return result;
+    }
+    for (size_t i = 0; i < cpus.size(); ++i) {
+      result[i * parts / cpus.size()].push_back(cpus[i]);
+    }
+    return result;
+  }
+
+  /**
+   * Subsystem of a thread of the peer by the prefix of its name. The threads
+   * of the gRPC servers are not named by the subsystems, they get the CPUs
+   * of the thread which starts the server, see ScopedThreadPlacement
+   * @return the name of the subsystem or none for the default placement
+   */
+  inline boost::optional<std::string> subsystemOfThread(
+      const std::string &name) {
+    static const std::vector<std::pair<std::string, const char *>> kPrefixes{
+        {"status-bus", placement::kTorii},
+        {"yac", placement::kConsensus},
+        {"od-", placement::kOrdering},
+        {"mst-", placement::kOrdering},
+        {"speculation", placement::kValidation},
+        {"chain-reader", placement::kValidation},
+        {"validation", placement::kValidation},
+        {"pg-async", placement::kStorage},
+        {"block-export", placement::kStorage},
+        {"sync-prefetch", placement::kStorage}};
+    for (const auto &prefix : kPrefixes) {
+      if (name.compare(0, prefix.first.size(), prefix.first) == 0) {
+        return std::string(prefix.second);
+      }
+    }
+    return boost::none;
+  }
+
+  namespace detail {
+    struct ThreadPlacementState {
+      std::mutex mutex;
+      ThreadPlacement placement;
+    };
+
+    /// the placement of the process, which is empty till it is configured
+    inline ThreadPlacementState &threadPlacementState() {
+      static ThreadPlacementState state;
+      return state;
+    }
+  }  // namespace detail
+
+  /**
+   * Set the placement of the threads of the process. The threads which are
+   * named afterwards are bound to the CPUs of their subsystems
+   * @param placement - CPU sets of the subsystems
+   */
+  inline void configureThreadPlacement(ThreadPlacement placement) {
+    auto &state = detail::threadPlacementState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.placement = std::move(placement);
+  }
+
+  /// @return CPUs of the subsystem, none if it is not placed
+  inline boost::optional<CpuSet> cpusOfSubsystem(
+      const std::string &subsystem) {
+    auto &state = detail::threadPlacementState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto it = state.placement.find(subsystem);
+    if (it == state.placement.end()) {
+      return boost::none;
+    }
+    return it->second;
+  }
+
+  /// @return CPUs the calling thread may run on, empty if it is unknown
+  inline CpuSet currentThreadCpus() {
+    CpuSet cpus;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+      for (size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &set)) {
+          cpus.push_back(cpu);
+        }
+      }
+    }
+#endif
+    return cpus;
+  }
+
+  /**
+   * Bind the calling thread to the CPUs. The threads it creates afterwards
+   * inherit the binding
+   * @return true if the thread is bound
+   */
+  inline bool bindCurrentThread(const CpuSet &cpus) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (auto cpu : cpus) {
+      if (cpu < CPU_SETSIZE) {
+        CPU_SET(cpu, &set);
+      }
+    }
+    return CPU_COUNT(&set) > 0
+        and sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void)cpus;
+    return false;
+#endif
+  }
+
+  /**
+   * Bind the calling thread to the CPUs of the subsystem of its name, if
+   * the subsystem is placed
+   */
+  inline void placeCurrentThread(const std::string &name) {
+    if (auto subsystem = subsystemOfThread(name)) {
+      if (auto cpus = cpusOfSubsystem(*subsystem)) {
+        bindCurrentThread(*cpus);
+      }
+    }
+  }
+
+  /**
+   * Binds the calling thread to the CPUs of the subsystem for the lifetime
+   * of the object, so the threads started in the meantime, such as the ones
+   * of a gRPC server, are placed with the subsystem
+   */
+  class ScopedThreadPlacement {
+   public:
+    explicit ScopedThreadPlacement(const std::string &subsystem)
+        : ScopedThreadPlacement(
+            cpusOfSubsystem(subsystem).value_or(CpuSet{})) {}
+
+    /// binds to the CPUs, the empty set keeps the current binding
+    explicit ScopedThreadPlacement(const CpuSet &cpus) {
+      if (not cpus.empty()) {
+        auto previous = currentThreadCpus();
+        if (not previous.empty() and bindCurrentThread(cpus)) {
+          previous_ = std::move(previous);
+        }
+      }
+    }
+
+    ~ScopedThreadPlacement() {
+      if (previous_) {
+        bindCurrentThread(*previous_);
+      }
+    }
+
+    ScopedThreadPlacement(const ScopedThreadPlacement &) = delete;
+    ScopedThreadPlacement &operator=(const ScopedThreadPlacement &) = delete;
+
+   private:
+    boost::optional<CpuSet> previous_;
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_COMMON_THREAD_PLACEMENT_HPP
@@ -9,6 +9,8 @@
 #include "logger/logger_fwd.hpp"
 
 #include <string>
+#include <type_traits>
+#include <utility>
 
 #include <fmt/core.h>
 // Windows includes transitively included by format.h define interface as
@@ -53,6 +55,28 @@ namespace logger {
     kCritical,
   };
 
+#ifndef IROHA_MIN_LOG_LEVEL
+#define IROHA_MIN_LOG_LEVEL 0
+#endif
+
+  /// The least severe level of the log calls which are compiled in, the
+  /// calls of the less severe levels are no-ops regardless of the config
+  constexpr LogLevel kMinLogLevel = static_cast<LogLevel>(IROHA_MIN_LOG_LEVEL);
+
+  /**
+   * Argument of a log call, which is evaluated only if the message is
+   * formatted, e.g. log.debug("{}", lazy([&] { return batch.reducedHash(); }))
+   */
+  template <typename F>
+  struct LazyArg {
+    F evaluate;
+  };
+
+  template <typename F>
+  LazyArg<F> lazy(F evaluate) {
+    return LazyArg<F>{std::move(evaluate)};
+  }
+
   class Logger {
    public:
     using Level = LogLevel;
@@ -63,32 +87,32 @@ namespace logger {
 
     template <typename... Args>
     void trace(const std::string &format, const Args &... args) const {
-      log(LogLevel::kTrace, format, args...);
+      logCompiled<LogLevel::kTrace>(format, args...);
     }
 
     template <typename... Args>
     void debug(const std::string &format, const Args &... args) const {
-      log(LogLevel::kDebug, format, args...);
+      logCompiled<LogLevel::kDebug>(format, args...);
     }
 
     template <typename... Args>
     void info(const std::string &format, const Args &... args) const {
-      log(LogLevel::kInfo, format, args...);
+      logCompiled<LogLevel::kInfo>(format, args...);
     }
 
     template <typename... Args>
     void warn(const std::string &format, const Args &... args) const {
-      log(LogLevel::kWarn, format, args...);
+      logCompiled<LogLevel::kWarn>(format, args...);
     }
 
     template <typename... Args>
     void error(const std::string &format, const Args &... args) const {
-      log(LogLevel::kError, format, args...);
+      logCompiled<LogLevel::kError>(format, args...);
     }
 
     template <typename... Args>
     void critical(const std::string &format, const Args &... args) const {
-      log(LogLevel::kCritical, format, args...);
+      logCompiled<LogLevel::kCritical>(format, args...);
     }
 
     template <typename... Args>
@@ -106,6 +130,30 @@ namespace logger {
     }
 
    protected:
+    /// Log, if the level is compiled in
+    template <Level kLevel, typename... Args>
+    void logCompiled(const std::string &format, const Args &... args) const {
+      logCompiled(std::integral_constant<bool, (kLevel >= kMinLogLevel)>{},
+                  kLevel,
+                  format,
+                  args...);
+    }
+
+    template <typename... Args>
+    void logCompiled(std::true_type,
+                     Level level,
+                     const std::string &format,
+                     const Args &... args) const {
+      log(level, format, args...);
+    }
+
+    /// The levels which are not compiled in are not even formatted
+    template <typename... Args>
+    void logCompiled(std::false_type,
+                     Level,
+                     const std::string &,
+                     const Args &...) const {}
+
     virtual void logInternal(Level level, const std::string &s) const = 0;
 
     /// Whether the configured logging level is at least as verbose as the
@@ -122,4 +170,21 @@ namespace logger {
 
 }  // namespace logger
 
+namespace fmt {
+  /// Formats the value of the lazy argument
+  template <typename F>
+  struct formatter<logger::LazyArg<F>, char> {
+    template <typename ParseContext>
+    typename ParseContext::iterator parse(ParseContext &ctx) {
+      return ctx.begin();
+    }
+
+    template <typename FormatContext>
+    auto format(const logger::LazyArg<F> &arg, FormatContext &ctx)
+        -> decltype(ctx.out()) {
+      return format_to(ctx.out(), "{}", arg.evaluate());
+    }
+  };
+}  // namespace fmt
+
 #endif  // IROHA_LOGGER_LOGGER_HPP
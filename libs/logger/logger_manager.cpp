@@ -18,26 +18,29 @@ static inline std::string joinTags(const std::string &parent,
 namespace logger {
 
   LoggerManagerTree::LoggerManagerTree(ConstLoggerConfigPtr config)
-      : config_(std::move(config)){};
+      : config_(std::move(config)), level_(config_->log_level){};
 
   LoggerManagerTree::LoggerManagerTree(LoggerConfig config)
-      : config_(std::make_shared<const LoggerConfig>(std::move(config))){};
+      : config_(std::make_shared<const LoggerConfig>(std::move(config))),
+        level_(config_->log_level){};
 
   LoggerManagerTree::LoggerManagerTree(std::string full_tag,
                                        std::string node_tag,
                                        ConstLoggerConfigPtr config)
       : node_tag_(std::move(node_tag)),
         full_tag_(std::move(full_tag)),
-        config_(std::move(config)){};
+        config_(std::move(config)),
+        level_(config_->log_level){};
 
   LoggerManagerTreePtr LoggerManagerTree::registerChild(
       std::string tag,
       boost::optional<LogLevel> log_level,
       boost::optional<LogPatterns> patterns) {
     LoggerConfig child_config{
-        log_level.value_or(config_->log_level),
+        log_level.value_or(level_.load()),
         patterns ? std::move(patterns)->inherit(config_->patterns)
-                 : config_->patterns};
+                 : config_->patterns,
+        config_->async};
     // Operator new is employed due to private visibility of used constructor.
     LoggerManagerTreePtr child(new LoggerManagerTree(
         joinTags(full_tag_, tag),
@@ -50,10 +53,10 @@ namespace logger {
   }
 
   LoggerPtr LoggerManagerTree::getLogger() {
-    LoggerPtr logger =
+    auto logger =
         std::atomic_load_explicit(&logger_, std::memory_order_acquire);
     if (not logger) {
-      LoggerPtr new_logger = std::make_shared<LoggerSpdlog>(full_tag_, config_);
+      auto new_logger = std::make_shared<LoggerSpdlog>(full_tag_, config_);
       while (not logger) {
         if (std::atomic_compare_exchange_weak_explicit(
                 &logger_,
@@ -61,6 +64,10 @@ namespace logger {
                 new_logger,
                 std::memory_order_release,
                 std::memory_order_acquire)) {
+          // the level may have been changed after the config was read
+          if (level_ != config_->log_level) {
+            new_logger->setLevel(level_);
+          }
           return new_logger;
         }
       }
@@ -78,8 +85,29 @@ namespace logger {
     // new standalone logger using this logger's settings.
     LoggerManagerTreePtr new_child(
         new LoggerManagerTree(joinTags(full_tag_, tag), tag, config_));
+    new_child->level_ = level_.load();
     return children_.emplace(std::make_pair(tag, std::move(new_child)))
         .first->second;
   }
 
+  void LoggerManagerTree::updateLevels(LoggerManagerTree &levels) {
+    setLevel(levels.level_);
+    std::vector<std::pair<std::string, LoggerManagerTreePtr>> children;
+    {
+      std::lock_guard<std::mutex> lock(children_mutex_);
+      children.assign(children_.begin(), children_.end());
+    }
+    for (const auto &child : children) {
+      child.second->updateLevels(*levels.getChild(child.first));
+    }
+  }
+
+  void LoggerManagerTree::setLevel(LogLevel level) {
+    level_ = level;
+    if (auto logger =
+            std::atomic_load_explicit(&logger_, std::memory_order_acquire)) {
+      logger->setLevel(level);
+    }
+  }
+
 }  // namespace logger
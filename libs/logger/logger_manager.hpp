@@ -8,10 +8,12 @@
 
 #include "logger/logger_manager_fwd.hpp"
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <boost/optional.hpp>
 #include "logger/logger_spdlog.hpp"
@@ -47,7 +49,21 @@ namespace logger {
     /// Get non-const child node by tag, if present. Thread safe.
     LoggerManagerTreePtr getChild(const std::string &tag);
 
+    /**
+     * Change the log levels of this node and its children to the ones of
+     * the corresponding nodes of the other tree, such as the one parsed
+     * from the reloaded configuration. The children which are not in the
+     * other tree take the level of their parent. The patterns and the other
+     * parameters are kept. Thread safe.
+     *
+     * @param levels - the tree with the new log levels
+     */
+    void updateLevels(LoggerManagerTree &levels);
+
    private:
+    /// Set the log level of this node and its logger.
+    void setLevel(LogLevel level);
+
     LoggerManagerTree(std::string full_tag,
                       std::string node_tag,
                       ConstLoggerConfigPtr config);
@@ -55,7 +71,8 @@ namespace logger {
     const std::string node_tag_;
     const std::string full_tag_;
     const ConstLoggerConfigPtr config_;
-    std::shared_ptr<Logger> logger_;
+    std::atomic<LogLevel> level_;
+    std::shared_ptr<LoggerSpdlog> logger_;
     std::unordered_map<std::string, LoggerManagerTreePtr> children_;
     std::mutex children_mutex_;
   };
@@ -11,6 +11,7 @@
 
 #define SPDLOG_FMT_EXTERNAL
 
+#include <spdlog/async.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
 #include <boost/assert.hpp>
@@ -37,10 +38,26 @@ namespace {
     }
   }
 
-  std::shared_ptr<spdlog::logger> getOrCreateLogger(const std::string tag) {
+  std::shared_ptr<spdlog::logger> createLogger(
+      const std::string &tag, const logger::LoggerConfig &config) {
+    if (not config.async) {
+      return spdlog::stdout_color_mt(tag);
+    }
+    static std::once_flag thread_pool_created;
+    std::call_once(thread_pool_created, [&config] {
+      spdlog::init_thread_pool(config.async->queue_size, 1);
+    });
+    if (config.async->overrun_oldest) {
+      return spdlog::stdout_color_mt<spdlog::async_factory_nonblock>(tag);
+    }
+    return spdlog::stdout_color_mt<spdlog::async_factory>(tag);
+  }
+
+  std::shared_ptr<spdlog::logger> getOrCreateLogger(
+      const std::string tag, const logger::LoggerConfig &config) {
     std::shared_ptr<spdlog::logger> logger;
     try {
-      logger = spdlog::stdout_color_mt(tag);
+      logger = createLogger(tag, config);
     } catch (const spdlog::spdlog_ex &) {
       logger = spdlog::get(tag);
     }
@@ -91,13 +108,22 @@ namespace logger {
   }
 
   LoggerSpdlog::LoggerSpdlog(std::string tag, ConstLoggerConfigPtr config)
-      : tag_(tag), config_(std::move(config)), logger_(getOrCreateLogger(tag)) {
+      : tag_(tag),
+        config_(std::move(config)),
+        level_(config_->log_level),
+        logger_(getOrCreateLogger(tag, *config_)) {
+    setupLogger();
+  }
+
+  void LoggerSpdlog::setLevel(LogLevel level) {
+    level_ = level;
     setupLogger();
   }
 
   void LoggerSpdlog::setupLogger() {
-    logger_->set_level(getSpdlogLogLevel(config_->log_level));
-    logger_->set_pattern(config_->patterns.getPattern(config_->log_level));
+    auto level = level_.load();
+    logger_->set_level(getSpdlogLogLevel(level));
+    logger_->set_pattern(config_->patterns.getPattern(level));
   }
 
   void LoggerSpdlog::logInternal(Level level, const std::string &s) const {
@@ -105,6 +131,6 @@ namespace logger {
   }
 
   bool LoggerSpdlog::shouldLog(Level level) const {
-    return config_->log_level <= level;
+    return level_.load() <= level;
   }
 }  // namespace logger
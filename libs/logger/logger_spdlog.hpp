@@ -8,10 +8,13 @@
 
 #include "logger/logger.hpp"
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
 
+#include <boost/optional.hpp>
+
 namespace spdlog {
   class logger;
 }
@@ -45,10 +48,24 @@ namespace logger {
     std::map<LogLevel, std::string> patterns_;
   };
 
+  /**
+   * Asynchronous logging: the messages are put to a bounded queue and are
+   * formatted by the patterns and written by a background thread. The queue
+   * is shared by all asynchronous loggers and is sized by the first of them
+   */
+  struct AsyncLogConfig {
+    /// number of the messages the queue holds
+    size_t queue_size;
+    /// whether a message overwrites the oldest one when the queue is full,
+    /// otherwise the logging thread waits for a free place
+    bool overrun_oldest;
+  };
+
   // TODO mboldyrev 29.12.2018 IR-188 Add sink options (console, file, syslog)
   struct LoggerConfig {
     LogLevel log_level;
     LogPatterns patterns;
+    boost::optional<AsyncLogConfig> async = boost::none;
   };
 
   class LoggerSpdlog : public Logger {
@@ -59,6 +76,9 @@ namespace logger {
      */
     LoggerSpdlog(std::string tag, ConstLoggerConfigPtr config);
 
+    /// Change the logging level and the pattern of the level. Thread safe.
+    void setLevel(LogLevel level);
+
    private:
     void logInternal(Level level, const std::string &s) const override;
 
@@ -71,6 +91,7 @@ namespace logger {
 
     const std::string tag_;
     const ConstLoggerConfigPtr config_;
+    std::atomic<LogLevel> level_;
     const std::shared_ptr<spdlog::logger> logger_;
   };
 
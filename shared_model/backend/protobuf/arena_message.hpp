@@ -0,0 +1,65 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROTO_ARENA_MESSAGE_HPP
+#define IROHA_PROTO_ARENA_MESSAGE_HPP
+
+#include <memory>
+
+#include <google/protobuf/arena.h>
+
+namespace shared_model {
+  namespace proto {
+
+    /**
+     * Message allocated on an arena of its own. All of the submessages, which
+     * are parsed into it, are allocated on the arena as well, so that a
+     * large message, e.g. a block, is allocated in a few chunks and freed at
+     * once.
+     * @tparam Message - protobuf message with arenas enabled
+     */
+    template <typename Message>
+    class ArenaMessage {
+     public:
+      ArenaMessage() : ArenaMessage(makeArena()) {}
+
+      /**
+       * Create the message on a shared arena, e.g. on the arena of a message,
+       * whose submessages it references
+       */
+      explicit ArenaMessage(std::shared_ptr<google::protobuf::Arena> arena)
+          : arena_(std::move(arena)),
+            message_(google::protobuf::Arena::CreateMessage<Message>(
+                arena_.get())) {}
+
+      Message &operator*() const {
+        return *message_;
+      }
+
+      Message *operator->() const {
+        return message_;
+      }
+
+      const std::shared_ptr<google::protobuf::Arena> &arena() const {
+        return arena_;
+      }
+
+     private:
+      static std::shared_ptr<google::protobuf::Arena> makeArena() {
+        google::protobuf::ArenaOptions options;
+        // the messages parsed into arenas are blocks and proposals of up to
+        // megabytes, so the chunks grow larger than by default
+        options.max_block_size = 64 * 1024;
+        return std::make_shared<google::protobuf::Arena>(options);
+      }
+
+      std::shared_ptr<google::protobuf::Arena> arena_;
+      Message *message_;
+    };
+
+  }  // namespace proto
+}  // namespace shared_model
+
+#endif  // IROHA_PROTO_ARENA_MESSAGE_HPP
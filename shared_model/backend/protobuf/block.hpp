@@ -8,6 +8,7 @@
 
 #include "interfaces/iroha_internal/block.hpp"
 
+#include "backend/protobuf/arena_message.hpp"
 #include "block.pb.h"
 #include "interfaces/common_objects/types.hpp"
 
@@ -22,9 +23,29 @@ namespace shared_model {
       explicit Block(const TransportType &ref);
       explicit Block(TransportType &&ref);
 
+      /**
+       * Create the block, which owns the arena of the message, so that all
+       * of its messages are freed at once
+       */
+      explicit Block(ArenaMessage<TransportType> message);
+
+      /**
+       * Create the block with its payload already serialized, so that the
+       * payload is not serialized again
+       * @param payload_blob - serialized payload of the message
+       */
+      Block(TransportType &&ref, interface::types::BlobType payload_blob);
+
+      /// \see the constructors above
+      Block(ArenaMessage<TransportType> message,
+            interface::types::BlobType payload_blob);
+
       interface::types::TransactionsCollectionType transactions()
           const override;
 
+      interface::types::TransactionsSpanType transactionsSpan()
+          const override;
+
       interface::types::HeightType height() const override;
 
       const interface::types::HashType &prevHash() const override;
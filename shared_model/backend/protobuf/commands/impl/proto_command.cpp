@@ -24,6 +24,7 @@
 #include "backend/protobuf/commands/proto_set_setting_value.hpp"
 #include "backend/protobuf/commands/proto_subtract_asset_quantity.hpp"
 #include "backend/protobuf/commands/proto_transfer_asset.hpp"
+#include "backend/protobuf/util.hpp"
 #include "utils/variant_deserializer.hpp"
 
 namespace {
@@ -63,8 +64,7 @@ namespace shared_model {
 
       ProtoCommandVariantType variant_{[this] {
         auto &ar = proto_;
-        int which =
-            ar.GetDescriptor()->FindFieldByNumber(ar.command_case())->index();
+        int which = oneofIndex<TransportType>(ar.command_case());
         return shared_model::detail::variant_impl<ProtoCommandListType>::
             template load<ProtoCommandVariantType>(ar, which);
       }()};
@@ -0,0 +1,124 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "backend/protobuf/commands/proto_flat_command.hpp"
+
+#include "backend/protobuf/permissions.hpp"
+
+namespace shared_model {
+  namespace proto {
+
+    interface::FlatCommand makeFlatCommand(
+        const iroha::protocol::Command &command) {
+      namespace flat = interface::flat;
+      using Command = iroha::protocol::Command;
+
+      switch (command.command_case()) {
+        case Command::kAddAssetQuantity: {
+          const auto &c = command.add_asset_quantity();
+          return flat::AddAssetQuantity{c.asset_id(), c.amount()};
+        }
+        case Command::kAddPeer: {
+          const auto &peer = command.add_peer().peer();
+          return flat::AddPeer{peer.address(),
+                               peer.peer_key(),
+                               peer.certificate_case()
+                                   == iroha::protocol::Peer::kTlsCertificate,
+                               peer.tls_certificate()};
+        }
+        case Command::kAddSignatory: {
+          const auto &c = command.add_signatory();
+          return flat::AddSignatory{c.account_id(), c.public_key()};
+        }
+        case Command::kAppendRole: {
+          const auto &c = command.append_role();
+          return flat::AppendRole{c.account_id(), c.role_name()};
+        }
+        case Command::kCreateAccount: {
+          const auto &c = command.create_account();
+          return flat::CreateAccount{
+              c.account_name(), c.domain_id(), c.public_key()};
+        }
+        case Command::kCreateAsset: {
+          const auto &c = command.create_asset();
+          return flat::CreateAsset{
+              c.asset_name(), c.domain_id(), c.precision()};
+        }
+        case Command::kCreateDomain: {
+          const auto &c = command.create_domain();
+          return flat::CreateDomain{c.domain_id(), c.default_role()};
+        }
+        case Command::kCreateRole: {
+          const auto &c = command.create_role();
+          flat::CreateRole result{c.role_name(), {}};
+          for (auto permission : c.permissions()) {
+            result.permissions.set(permissions::fromTransport(
+                static_cast<iroha::protocol::RolePermission>(permission)));
+          }
+          return result;
+        }
+        case Command::kDetachRole: {
+          const auto &c = command.detach_role();
+          return flat::DetachRole{c.account_id(), c.role_name()};
+        }
+        case Command::kGrantPermission: {
+          const auto &c = command.grant_permission();
+          return flat::GrantPermission{
+              c.account_id(), permissions::fromTransport(c.permission())};
+        }
+        case Command::kRemoveSignatory: {
+          const auto &c = command.remove_signatory();
+          return flat::RemoveSignatory{c.account_id(), c.public_key()};
+        }
+        case Command::kRevokePermission: {
+          const auto &c = command.revoke_permission();
+          return flat::RevokePermission{
+              c.account_id(), permissions::fromTransport(c.permission())};
+        }
+        case Command::kSetAccountDetail: {
+          const auto &c = command.set_account_detail();
+          return flat::SetAccountDetail{c.account_id(), c.key(), c.value()};
+        }
+        case Command::kSetAccountQuorum: {
+          const auto &c = command.set_account_quorum();
+          return flat::SetQuorum{c.account_id(), c.quorum()};
+        }
+        case Command::kSubtractAssetQuantity: {
+          const auto &c = command.subtract_asset_quantity();
+          return flat::SubtractAssetQuantity{c.asset_id(), c.amount()};
+        }
+        case Command::kTransferAsset: {
+          const auto &c = command.transfer_asset();
+          return flat::TransferAsset{c.src_account_id(),
+                                     c.dest_account_id(),
+                                     c.asset_id(),
+                                     c.description(),
+                                     c.amount()};
+        }
+        case Command::kRemovePeer:
+          return flat::RemovePeer{command.remove_peer().public_key()};
+        case Command::kCompareAndSetAccountDetail: {
+          const auto &c = command.compare_and_set_account_detail();
+          return flat::CompareAndSetAccountDetail{
+              c.account_id(),
+              c.key(),
+              c.value(),
+              c.opt_old_value_case()
+                  != iroha::protocol::CompareAndSetAccountDetail::
+                         OPT_OLD_VALUE_NOT_SET,
+              c.old_value()};
+        }
+        case Command::kSetSettingValue: {
+          const auto &c = command.set_setting_value();
+          return flat::SetSettingValue{c.key(), c.value()};
+        }
+        case Command::COMMAND_NOT_SET:
+          break;
+      }
+      return boost::blank{};
+    }
+
+  }  // namespace proto
+}  // namespace shared_model
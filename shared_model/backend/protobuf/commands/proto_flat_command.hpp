@@ -0,0 +1,26 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROTO_FLAT_COMMAND_HPP
+#define IROHA_PROTO_FLAT_COMMAND_HPP
+
+#include "interfaces/commands/flat_command.hpp"
+
+#include "commands.pb.h"
+
+namespace shared_model {
+  namespace proto {
+
+    /**
+     * @return flat representation of the command, which refers to the
+     * strings of the message
+     */
+    interface::FlatCommand makeFlatCommand(
+        const iroha::protocol::Command &command);
+
+  }  // namespace proto
+}  // namespace shared_model
+
+#endif  // IROHA_PROTO_FLAT_COMMAND_HPP
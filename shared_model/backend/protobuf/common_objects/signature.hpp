@@ -21,9 +21,17 @@ namespace shared_model {
       explicit Signature(SignatureType &&signature)
           : TrivialProto(std::forward<SignatureType>(signature)) {}
 
-      Signature(const Signature &o) : Signature(o.proto_) {}
-
-      Signature(Signature &&o) noexcept : Signature(std::move(o.proto_)) {}
+      /// the copies take the decoded key and signature of the original, so
+      /// the hex fields are decoded once per signature
+      Signature(const Signature &o)
+          : TrivialProto(o.proto_),
+            public_key_(o.public_key_),
+            signed_(o.signed_) {}
+
+      Signature(Signature &&o) noexcept
+          : TrivialProto(std::move(o.proto_)),
+            public_key_(o.public_key_),
+            signed_(o.signed_) {}
 
       const PublicKeyType &publicKey() const override {
         return public_key_;
@@ -35,7 +43,7 @@ namespace shared_model {
 
      private:
       interface::Signature *clone() const override {
-        return new Signature(proto_);
+        return new Signature(*this);
       }
 
       const PublicKeyType public_key_{
@@ -5,39 +5,80 @@
 
 #include "backend/protobuf/block.hpp"
 
+#include <algorithm>
+#include <mutex>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <boost/optional.hpp>
 #include <boost/range/adaptors.hpp>
 #include "backend/protobuf/common_objects/signature.hpp"
-#include "backend/protobuf/transaction.hpp"
+#include "backend/protobuf/transaction_views.hpp"
 #include "backend/protobuf/util.hpp"
 #include "common/byteutils.hpp"
+#include "utils/reference_holder.hpp"
 
 namespace shared_model {
   namespace proto {
 
     struct Block::Impl {
       explicit Impl(TransportType &&ref) : proto_(std::move(ref)) {}
-      explicit Impl(const TransportType &ref) : proto_(ref) {}
+      explicit Impl(const TransportType &ref) : proto_(TransportType(ref)) {}
+      explicit Impl(ArenaMessage<TransportType> message)
+          : arena_message_(std::move(message)), proto_(**arena_message_) {}
+      Impl(TransportType &&ref, interface::types::BlobType payload_blob)
+          : proto_(std::move(ref)), payload_blob_(std::move(payload_blob)) {}
+      Impl(ArenaMessage<TransportType> message,
+           interface::types::BlobType payload_blob)
+          : arena_message_(std::move(message)),
+            proto_(**arena_message_),
+            payload_blob_(std::move(payload_blob)) {}
       Impl(Impl &&o) noexcept = delete;
       Impl &operator=(Impl &&o) noexcept = delete;
 
-      TransportType proto_;
-      iroha::protocol::Block_v1::Payload &payload_{*proto_.mutable_payload()};
+      /// owns the message, if it is allocated on an arena
+      boost::optional<ArenaMessage<TransportType>> arena_message_;
+      detail::ReferenceHolder<TransportType> proto_;
+      iroha::protocol::Block_v1::Payload &payload_{
+          *proto_->mutable_payload()};
 
-      std::vector<proto::Transaction> transactions_{[this] {
-        return std::vector<proto::Transaction>(
-            payload_.mutable_transactions()->begin(),
-            payload_.mutable_transactions()->end());
-      }()};
+      std::vector<proto::Transaction> transactions_{makeTransactionViews(
+          *payload_.mutable_transactions(),
+          arena_message_ ? arena_message_->arena() : nullptr)};
 
-      interface::types::BlobType blob_{[this] { return makeBlob(proto_); }()};
+      interface::types::BlobType payload_blob_{
+          [this] { return makeBlob(payload_); }()};
+
+      /// the serialized block is made of the serialized payload, so that the
+      /// transactions are not serialized twice
+      interface::types::BlobType blob_{[this] {
+        using google::protobuf::internal::WireFormatLite;
+        using google::protobuf::io::CodedOutputStream;
+        TransportType signatures;
+        *signatures.mutable_signatures() = proto_->signatures();
+        const auto &payload = payload_blob_.blob();
+        const auto signatures_size = signatures.ByteSizeLong();
+        crypto::Blob::Bytes data(
+            1 + CodedOutputStream::VarintSize32(payload.size())
+            + payload.size() + signatures_size);
+        auto *out = CodedOutputStream::WriteTagToArray(
+            WireFormatLite::MakeTag(
+                TransportType::kPayloadFieldNumber,
+                WireFormatLite::WIRETYPE_LENGTH_DELIMITED),
+            data.data());
+        out = CodedOutputStream::WriteVarint32ToArray(payload.size(), out);
+        out = std::copy(payload.begin(), payload.end(), out);
+        signatures.SerializeToArray(out, signatures_size);
+        return crypto::Blob(std::move(data));
+      }()};
 
       interface::types::HashType prev_hash_{[this] {
         return interface::types::HashType(
-            crypto::Hash::fromHexString(proto_.payload().prev_block_hash()));
+            crypto::Hash::fromHexString(proto_->payload().prev_block_hash()));
       }()};
 
       SignatureSetType<proto::Signature> signatures_{[this] {
-        auto signatures = *proto_.mutable_signatures()
+        auto signatures = *proto_->mutable_signatures()
             | boost::adaptors::transformed(
                   [](auto &x) { return proto::Signature(x); });
         return SignatureSetType<proto::Signature>(signatures.begin(),
@@ -55,10 +96,16 @@ namespace shared_model {
             return hashes;
           }()};
 
-      interface::types::BlobType payload_blob_{
-          [this] { return makeBlob(payload_); }()};
+      /// hash of the payload, computed on the first access, so that it may
+      /// be computed while the block is being signed
+      const interface::types::HashType &hash() {
+        std::call_once(hash_flag_,
+                       [this] { hash_ = makeHash(payload_blob_); });
+        return hash_;
+      }
 
-      interface::types::HashType hash_ = makeHash(payload_blob_);
+      std::once_flag hash_flag_;
+      interface::types::HashType hash_;
     };
 
     Block::Block(Block &&o) noexcept = default;
@@ -71,10 +118,30 @@ namespace shared_model {
       impl_ = std::make_unique<Block::Impl>(std::move(ref));
     }
 
+    Block::Block(ArenaMessage<TransportType> message) {
+      impl_ = std::make_unique<Block::Impl>(std::move(message));
+    }
+
+    Block::Block(TransportType &&ref,
+                 interface::types::BlobType payload_blob) {
+      impl_ = std::make_unique<Block::Impl>(std::move(ref),
+                                            std::move(payload_blob));
+    }
+
+    Block::Block(ArenaMessage<TransportType> message,
+                 interface::types::BlobType payload_blob) {
+      impl_ = std::make_unique<Block::Impl>(std::move(message),
+                                            std::move(payload_blob));
+    }
+
     interface::types::TransactionsCollectionType Block::transactions() const {
       return impl_->transactions_;
     }
 
+    interface::types::TransactionsSpanType Block::transactionsSpan() const {
+      return interface::types::TransactionsSpanType(impl_->transactions_);
+    }
+
     interface::types::HeightType Block::height() const {
       return impl_->payload_.height();
     }
@@ -103,12 +170,12 @@ namespace shared_model {
         return false;
       }
 
-      auto sig = impl_->proto_.add_signatures();
+      auto sig = impl_->proto_->add_signatures();
       sig->set_signature(signed_blob.hex());
       sig->set_public_key(public_key.hex());
 
       impl_->signatures_ = [this] {
-        auto signatures = *impl_->proto_.mutable_signatures()
+        auto signatures = *impl_->proto_->mutable_signatures()
             | boost::adaptors::transformed(
                   [](auto &x) { return proto::Signature(x); });
         return SignatureSetType<proto::Signature>(signatures.begin(),
@@ -118,7 +185,7 @@ namespace shared_model {
     }
 
     const interface::types::HashType &Block::hash() const {
-      return impl_->hash_;
+      return impl_->hash();
     }
 
     interface::types::TimestampType Block::createdTime() const {
@@ -139,11 +206,11 @@ namespace shared_model {
     }
 
     const iroha::protocol::Block_v1 &Block::getTransport() const {
-      return impl_->proto_;
+      return *impl_->proto_;
     }
 
     Block::ModelType *Block::clone() const {
-      return new Block(impl_->proto_);
+      return new Block(*impl_->proto_);
     }
 
     Block::~Block() = default;
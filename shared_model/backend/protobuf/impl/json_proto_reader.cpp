@@ -0,0 +1,362 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "backend/protobuf/json_proto_reader.hpp"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include <rapidjson/error/en.h>
+#include <rapidjson/reader.h>
+
+using google::protobuf::FieldDescriptor;
+using google::protobuf::Message;
+
+namespace {
+
+  /// @return whether the value is representable by To, which is then set
+  template <typename To, typename From>
+  bool narrow(From from, To &to) {
+    to = static_cast<To>(from);
+    return static_cast<From>(to) == from and (to < To{}) == (from < From{});
+  }
+
+  static_assert(sizeof(long long) == sizeof(int64_t)
+                    and sizeof(unsigned long long) == sizeof(uint64_t),
+                "strtoll and strtoull must parse the 64-bit integers");
+
+  bool isDigit(char c) {
+    return c >= '0' and c <= '9';
+  }
+
+  /**
+   * Parse the whole string as a negative decimal integer. The spaces and the
+   * signs which strtoll skips are not accepted
+   * @return whether the integer is in the range of the value, which is then
+   * set
+   */
+  bool parseInteger(const std::string &str, int64_t &value) {
+    if (str.size() < 2 or str[0] != '-' or not isDigit(str[1])) {
+      return false;
+    }
+    char *end = nullptr;
+    errno = 0;
+    auto result = std::strtoll(str.c_str(), &end, 10);
+    if (errno == ERANGE or end != str.c_str() + str.size()) {
+      return false;
+    }
+    value = result;
+    return true;
+  }
+
+  /**
+   * Parse the whole string as an unsigned decimal integer. The spaces and
+   * the signs which strtoull skips are not accepted
+   * @return whether the integer is in the range of the value, which is then
+   * set
+   */
+  bool parseInteger(const std::string &str, uint64_t &value) {
+    if (str.empty() or not isDigit(str[0])) {
+      return false;
+    }
+    char *end = nullptr;
+    errno = 0;
+    auto result = std::strtoull(str.c_str(), &end, 10);
+    if (errno == ERANGE or end != str.c_str() + str.size()) {
+      return false;
+    }
+    value = result;
+    return true;
+  }
+
+  /**
+   * SAX handler, which keeps the stack of the messages being read. The field
+   * of a message is set by its key and is reset once its value is read, the
+   * elements of a repeated field are added until the end of the array
+   */
+  class ProtoHandler
+      : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, ProtoHandler> {
+   public:
+    explicit ProtoHandler(Message &message) : root_(message) {}
+
+    const std::string &error() const {
+      return error_;
+    }
+
+    bool Null() {
+      if (frames_.empty() or frames_.back().in_array) {
+        return fail("unexpected null");
+      }
+      return valueRead();
+    }
+
+    bool Bool(bool value) {
+      auto field = valueField();
+      if (field == nullptr) {
+        return false;
+      }
+      if (field->cpp_type() != FieldDescriptor::CPPTYPE_BOOL) {
+        return fail("unexpected bool for " + field->full_name());
+      }
+      auto &message = *frames_.back().message;
+      if (field->is_repeated()) {
+        message.GetReflection()->AddBool(&message, field, value);
+      } else {
+        message.GetReflection()->SetBool(&message, field, value);
+      }
+      return valueRead();
+    }
+
+    bool Int(int value) {
+      return setInteger(static_cast<int64_t>(value));
+    }
+
+    bool Uint(unsigned value) {
+      return setInteger(static_cast<uint64_t>(value));
+    }
+
+    bool Int64(int64_t value) {
+      return setInteger(value);
+    }
+
+    bool Uint64(uint64_t value) {
+      return setInteger(value);
+    }
+
+    bool Double(double) {
+      return fail("unsupported floating point value");
+    }
+
+    bool String(const char *str, rapidjson::SizeType length, bool) {
+      auto field = valueField();
+      if (field == nullptr) {
+        return false;
+      }
+      auto &message = *frames_.back().message;
+      auto reflection = message.GetReflection();
+      switch (field->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_STRING:
+          if (field->type() == FieldDescriptor::TYPE_BYTES) {
+            return fail("unsupported bytes field " + field->full_name());
+          }
+          if (field->is_repeated()) {
+            reflection->AddString(&message, field, std::string(str, length));
+          } else {
+            reflection->SetString(&message, field, std::string(str, length));
+          }
+          return valueRead();
+        case FieldDescriptor::CPPTYPE_ENUM: {
+          auto value =
+              field->enum_type()->FindValueByName(std::string(str, length));
+          if (value == nullptr) {
+            return fail("unknown value of " + field->full_name());
+          }
+          if (field->is_repeated()) {
+            reflection->AddEnum(&message, field, value);
+          } else {
+            reflection->SetEnum(&message, field, value);
+          }
+          return valueRead();
+        }
+        default:
+          // 64-bit integers are strings in JSON, the rest may also be
+          break;
+      }
+      // the copy ends with the null, which strtoll expects
+      const std::string number(str, length);
+      if (length > 0 and *str == '-') {
+        int64_t value;
+        if (parseInteger(number, value)) {
+          return setInteger(value);
+        }
+      } else {
+        uint64_t value;
+        if (parseInteger(number, value)) {
+          return setInteger(value);
+        }
+      }
+      return fail("unexpected string for " + field->full_name());
+    }
+
+    bool StartObject() {
+      if (frames_.empty()) {
+        frames_.push_back({&root_, nullptr, false});
+        return true;
+      }
+      auto field = valueField();
+      if (field == nullptr) {
+        return false;
+      }
+      if (field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE) {
+        return fail("unexpected object for " + field->full_name());
+      }
+      auto &message = *frames_.back().message;
+      auto nested = field->is_repeated()
+          ? message.GetReflection()->AddMessage(&message, field)
+          : message.GetReflection()->MutableMessage(&message, field);
+      frames_.push_back({nested, nullptr, false});
+      return true;
+    }
+
+    bool Key(const char *str, rapidjson::SizeType length, bool) {
+      auto &frame = frames_.back();
+      std::string name(str, length);
+      auto descriptor = frame.message->GetDescriptor();
+      frame.field = descriptor->FindFieldByCamelcaseName(name);
+      if (frame.field == nullptr) {
+        frame.field = descriptor->FindFieldByName(name);
+      }
+      if (frame.field == nullptr) {
+        return fail("unknown field " + name + " of "
+                    + descriptor->full_name());
+      }
+      return true;
+    }
+
+    bool EndObject(rapidjson::SizeType) {
+      frames_.pop_back();
+      return frames_.empty() or valueRead();
+    }
+
+    bool StartArray() {
+      auto field = valueField();
+      if (field == nullptr) {
+        return false;
+      }
+      if (not field->is_repeated() or frames_.back().in_array) {
+        return fail("unexpected array for " + field->full_name());
+      }
+      frames_.back().in_array = true;
+      return true;
+    }
+
+    bool EndArray(rapidjson::SizeType) {
+      frames_.back().in_array = false;
+      return valueRead();
+    }
+
+   private:
+    struct Frame {
+      Message *message;
+      const FieldDescriptor *field;
+      bool in_array;
+    };
+
+    bool fail(std::string error) {
+      error_ = std::move(error);
+      return false;
+    }
+
+    /// @return field of the value being read, nullptr if there is none
+    const FieldDescriptor *valueField() {
+      if (frames_.empty() or frames_.back().field == nullptr) {
+        fail("value without a field");
+        return nullptr;
+      }
+      return frames_.back().field;
+    }
+
+    bool valueRead() {
+      auto &frame = frames_.back();
+      if (not frame.in_array) {
+        frame.field = nullptr;
+      }
+      return true;
+    }
+
+    template <typename T>
+    bool setInteger(T value) {
+      auto field = valueField();
+      if (field == nullptr) {
+        return false;
+      }
+      auto &message = *frames_.back().message;
+      auto reflection = message.GetReflection();
+      bool repeated = field->is_repeated();
+      bool fits = false;
+      switch (field->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_INT32: {
+          int32_t number;
+          if ((fits = narrow(value, number))) {
+            repeated ? reflection->AddInt32(&message, field, number)
+                     : reflection->SetInt32(&message, field, number);
+          }
+          break;
+        }
+        case FieldDescriptor::CPPTYPE_INT64: {
+          int64_t number;
+          if ((fits = narrow(value, number))) {
+            repeated ? reflection->AddInt64(&message, field, number)
+                     : reflection->SetInt64(&message, field, number);
+          }
+          break;
+        }
+        case FieldDescriptor::CPPTYPE_UINT32: {
+          uint32_t number;
+          if ((fits = narrow(value, number))) {
+            repeated ? reflection->AddUInt32(&message, field, number)
+                     : reflection->SetUInt32(&message, field, number);
+          }
+          break;
+        }
+        case FieldDescriptor::CPPTYPE_UINT64: {
+          uint64_t number;
+          if ((fits = narrow(value, number))) {
+            repeated ? reflection->AddUInt64(&message, field, number)
+                     : reflection->SetUInt64(&message, field, number);
+          }
+          break;
+        }
+        case FieldDescriptor::CPPTYPE_ENUM: {
+          int number;
+          auto enum_value = narrow(value, number)
+              ? field->enum_type()->FindValueByNumber(number)
+              : nullptr;
+          if ((fits = enum_value != nullptr)) {
+            repeated ? reflection->AddEnum(&message, field, enum_value)
+                     : reflection->SetEnum(&message, field, enum_value);
+          }
+          break;
+        }
+        default:
+          return fail("unexpected number for " + field->full_name());
+      }
+      if (not fits) {
+        return fail("number out of range for " + field->full_name());
+      }
+      return valueRead();
+    }
+
+    Message &root_;
+    std::vector<Frame> frames_;
+    std::string error_;
+  };
+
+}  // namespace
+
+namespace shared_model {
+  namespace proto {
+
+    iroha::expected::Result<void, std::string> parseJson(
+        const std::string &json, google::protobuf::Message &message) {
+      ProtoHandler handler(message);
+      rapidjson::Reader reader;
+      rapidjson::StringStream stream(json.c_str());
+      auto result = reader.Parse(stream, handler);
+      if (result) {
+        return iroha::expected::Value<void>();
+      }
+      if (not handler.error().empty()) {
+        return iroha::expected::makeError(handler.error());
+      }
+      return iroha::expected::makeError(
+          std::string(rapidjson::GetParseError_En(result.Code()))
+          + " at offset " + std::to_string(result.Offset()));
+    }
+
+  }  // namespace proto
+}  // namespace shared_model
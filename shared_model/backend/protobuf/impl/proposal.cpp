@@ -5,8 +5,24 @@
 
 #include "backend/protobuf/proposal.hpp"
 
-#include "backend/protobuf/transaction.hpp"
+#include <boost/optional.hpp>
+#include "backend/protobuf/transaction_views.hpp"
 #include "backend/protobuf/util.hpp"
+#include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
+#include "utils/reference_holder.hpp"
+
+namespace {
+  /**
+   * Serialize the height field, which is the first field of the message, so
+   * it prefixes the serialized proposal. It is empty for the zero height
+   */
+  std::string serializeHeight(
+      shared_model::interface::types::HeightType height) {
+    iroha::protocol::Proposal header;
+    header.set_height(height);
+    return header.SerializeAsString();
+  }
+}  // namespace
 
 namespace shared_model {
   namespace proto {
@@ -15,17 +31,37 @@ namespace shared_model {
     struct Proposal::Impl {
       explicit Impl(TransportType &&ref) : proto_(std::move(ref)) {}
 
-      explicit Impl(const TransportType &ref) : proto_(ref) {}
+      explicit Impl(const TransportType &ref) : proto_(TransportType(ref)) {}
 
-      TransportType proto_;
+      explicit Impl(ArenaMessage<TransportType> message)
+          : arena_message_(std::move(message)), proto_(**arena_message_) {}
 
-      const std::vector<proto::Transaction> transactions_{[this] {
-        return std::vector<proto::Transaction>(
-            proto_.mutable_transactions()->begin(),
-            proto_.mutable_transactions()->end());
-      }()};
+      Impl(ArenaMessage<TransportType> message, BlobType blob)
+          : arena_message_(std::move(message)),
+            proto_(**arena_message_),
+            serialized_(std::move(blob)) {}
+
+      Impl(TransportType &&ref, BlobType blob)
+          : proto_(std::move(ref)), serialized_(std::move(blob)) {}
+
+      /// owns the message, if it is allocated on an arena
+      boost::optional<ArenaMessage<TransportType>> arena_message_;
+      detail::ReferenceHolder<TransportType> proto_;
+
+      /// serialized message, if it is known at the construction
+      boost::optional<BlobType> serialized_;
 
-      interface::types::BlobType blob_{[this] { return makeBlob(proto_); }()};
+      const std::vector<proto::Transaction> transactions_{makeTransactionViews(
+          *proto_->mutable_transactions(),
+          arena_message_ ? arena_message_->arena() : nullptr)};
+
+      const interface::types::BatchBoundariesType batch_boundaries_{
+          interface::TransactionBatchParserImpl().batchBoundaries(
+              transactions_)};
+
+      interface::types::BlobType blob_{[this] {
+        return serialized_ ? std::move(*serialized_) : makeBlob(*proto_);
+      }()};
 
       const interface::types::HashType hash_{
           [this] { return crypto::DefaultHashProvider::makeHash(blob_); }()};
@@ -41,16 +77,30 @@ namespace shared_model {
       impl_ = std::make_unique<Proposal::Impl>(std::move(ref));
     }
 
+    Proposal::Proposal(ArenaMessage<TransportType> message) {
+      impl_ = std::make_unique<Proposal::Impl>(std::move(message));
+    }
+
+    Proposal::Proposal(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
     TransactionsCollectionType Proposal::transactions() const {
       return impl_->transactions_;
     }
 
+    TransactionsSpanType Proposal::transactionsSpan() const {
+      return TransactionsSpanType(impl_->transactions_);
+    }
+
+    BatchBoundariesType Proposal::batchBoundaries() const {
+      return impl_->batch_boundaries_;
+    }
+
     TimestampType Proposal::createdTime() const {
-      return impl_->proto_.created_time();
+      return impl_->proto_->created_time();
     }
 
     HeightType Proposal::height() const {
-      return impl_->proto_.height();
+      return impl_->proto_->height();
     }
 
     const interface::types::BlobType &Proposal::blob() const {
@@ -58,13 +108,43 @@ namespace shared_model {
     }
 
     const Proposal::TransportType &Proposal::getTransport() const {
-      return impl_->proto_;
+      return *impl_->proto_;
     }
 
     const interface::types::HashType &Proposal::hash() const {
       return impl_->hash_;
     }
 
+    std::unique_ptr<Proposal> Proposal::withHeight(HeightType height) const {
+      // the fields following the height are serialized the same way
+      const auto &bytes = impl_->blob_.blob();
+      auto prefix_size = serializeHeight(impl_->proto_->height()).size();
+      auto header = serializeHeight(height);
+      BlobType::Bytes serialized(header.begin(), header.end());
+      serialized.insert(
+          serialized.end(), bytes.begin() + prefix_size, bytes.end());
+      BlobType blob(std::move(serialized));
+
+      auto fill = [&](TransportType &proposal, google::protobuf::Arena *arena) {
+        proposal.set_height(height);
+        proposal.set_created_time(impl_->proto_->created_time());
+        addTransactions(
+            *proposal.mutable_transactions(), arena, impl_->transactions_);
+      };
+
+      if (impl_->arena_message_) {
+        ArenaMessage<TransportType> message(impl_->arena_message_->arena());
+        fill(*message, message.arena().get());
+        return std::unique_ptr<Proposal>(new Proposal(
+            std::make_unique<Impl>(std::move(message), std::move(blob))));
+      }
+
+      TransportType message;
+      fill(message, nullptr);
+      return std::unique_ptr<Proposal>(new Proposal(
+          std::make_unique<Impl>(std::move(message), std::move(blob))));
+    }
+
     Proposal::~Proposal() = default;
 
   }  // namespace proto
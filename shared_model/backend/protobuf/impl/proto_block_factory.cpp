@@ -5,22 +5,97 @@
 
 #include "backend/protobuf/proto_block_factory.hpp"
 
+#include <algorithm>
 #include <sstream>
+#include <vector>
 
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <boost/assert.hpp>
+#include <boost/optional.hpp>
+#include <boost/range/size.hpp>
 #include "backend/protobuf/block.hpp"
+#include "backend/protobuf/transaction_views.hpp"
+#include "cryptography/merkle_tree.hpp"
 
 using namespace shared_model;
 using namespace shared_model::proto;
 
+namespace {
+  /// blocks of fewer transactions are serialized on the calling thread
+  constexpr size_t kMinParallelTransactions = 256;
+
+  /**
+   * Serialize the payload of the block, the transactions of which are
+   * serialized in parallel. The transactions are the first field of the
+   * payload, so the payload is the transactions followed by the other fields
+   * @param payload - payload of the block
+   * @param txs - transactions of the payload
+   * @param parallel_for - runs the serialization of the transactions
+   * @return the serialized payload
+   */
+  interface::types::BlobType serializePayload(
+      const iroha::protocol::Block_v1::Payload &payload,
+      const interface::types::TransactionsCollectionType &txs,
+      const ProtoBlockFactory::ParallelFor &parallel_for) {
+    using google::protobuf::internal::WireFormatLite;
+    using google::protobuf::io::CodedOutputStream;
+
+    std::vector<const interface::Transaction *> transactions;
+    for (const auto &tx : txs) {
+      transactions.push_back(&tx);
+    }
+    // the serialized transactions are kept by the transactions
+    parallel_for(transactions.size(),
+                 [&transactions](size_t i) { transactions[i]->blob(); });
+
+    const auto tag = WireFormatLite::MakeTag(
+        iroha::protocol::Block_v1::Payload::kTransactionsFieldNumber,
+        WireFormatLite::WIRETYPE_LENGTH_DELIMITED);
+    size_t size = 0;
+    for (const auto *tx : transactions) {
+      const auto tx_size = tx->blob().size();
+      size += CodedOutputStream::VarintSize32(tag)
+          + CodedOutputStream::VarintSize32(tx_size) + tx_size;
+    }
+
+    iroha::protocol::Block_v1::Payload other_fields;
+    other_fields.set_tx_number(payload.tx_number());
+    other_fields.set_height(payload.height());
+    other_fields.set_prev_block_hash(payload.prev_block_hash());
+    other_fields.set_created_time(payload.created_time());
+    *other_fields.mutable_rejected_transactions_hashes() =
+        payload.rejected_transactions_hashes();
+    if (payload.has_transactions_root()) {
+      *other_fields.mutable_transactions_root() = payload.transactions_root();
+    }
+    const auto other_fields_size = other_fields.ByteSizeLong();
+
+    crypto::Blob::Bytes data(size + other_fields_size);
+    auto *out = data.data();
+    for (const auto *tx : transactions) {
+      const auto &blob = tx->blob().blob();
+      out = CodedOutputStream::WriteTagToArray(tag, out);
+      out = CodedOutputStream::WriteVarint32ToArray(blob.size(), out);
+      out = std::copy(blob.begin(), blob.end(), out);
+    }
+    other_fields.SerializeToArray(out, other_fields_size);
+    return crypto::Blob(std::move(data));
+  }
+}  // namespace
+
 ProtoBlockFactory::ProtoBlockFactory(
     std::unique_ptr<shared_model::validation::AbstractValidator<
         shared_model::interface::Block>> interface_validator,
     std::unique_ptr<
         shared_model::validation::AbstractValidator<iroha::protocol::Block>>
-        proto_validator)
+        proto_validator,
+    ParallelFor parallel_for,
+    bool transactions_root)
     : interface_validator_{std::move(interface_validator)},
-      proto_validator_{std::move(proto_validator)} {}
+      proto_validator_{std::move(proto_validator)},
+      parallel_for_{std::move(parallel_for)},
+      transactions_root_{transactions_root} {}
 
 std::unique_ptr<shared_model::interface::Block>
 ProtoBlockFactory::unsafeCreateBlock(
@@ -29,18 +104,23 @@ ProtoBlockFactory::unsafeCreateBlock(
     interface::types::TimestampType created_time,
     const interface::types::TransactionsCollectionType &txs,
     const interface::types::HashCollectionType &rejected_hashes) {
-  iroha::protocol::Block_v1 block;
+  // the block is created on the arena of the transactions, if they are
+  // views of a proposal, so that they are referenced instead of being copied
+  auto arena = transactionsArena(txs);
+  boost::optional<ArenaMessage<Block::TransportType>> arena_block;
+  Block::TransportType heap_block;
+  if (arena) {
+    arena_block = ArenaMessage<Block::TransportType>(arena);
+  }
+  auto &block = arena_block ? **arena_block : heap_block;
+
   auto *block_payload = block.mutable_payload();
   block_payload->set_height(height);
   block_payload->set_prev_block_hash(prev_hash.hex());
   block_payload->set_created_time(created_time);
 
   // set accepted transactions
-  std::for_each(
-      std::begin(txs), std::end(txs), [block_payload](const auto &tx) {
-        auto *transaction = block_payload->add_transactions();
-        (*transaction) = static_cast<const Transaction &>(tx).getTransport();
-      });
+  addTransactions(*block_payload->mutable_transactions(), arena.get(), txs);
 
   // set rejected transactions
   std::for_each(std::begin(rejected_hashes),
@@ -51,14 +131,37 @@ ProtoBlockFactory::unsafeCreateBlock(
                   (*next_hash) = hash.hex();
                 });
 
+  if (transactions_root_) {
+    std::vector<crypto::Hash> hashes;
+    for (const auto &tx : txs) {
+      hashes.push_back(tx.hash());
+    }
+    crypto::MerkleTree tree(hashes);
+    auto *root = block_payload->mutable_transactions_root();
+    root->set_version(crypto::MerkleTree::kVersion);
+    root->set_root(tree.root().hex());
+  }
+
+  // the container does not take the ownership of the block
   iroha::protocol::Block proto_block_container;
-  proto_block_container.set_allocated_block_v1(&block);
+  proto_block_container.unsafe_arena_set_allocated_block_v1(&block);
   auto proto_block_validation_result =
       proto_validator_->validate(proto_block_container);
-  proto_block_container.release_block_v1();
+  proto_block_container.unsafe_arena_release_block_v1();
 
-  auto model_proto_block =
-      std::make_unique<shared_model::proto::Block>(std::move(block));
+  std::unique_ptr<shared_model::proto::Block> model_proto_block;
+  if (parallel_for_ and boost::size(txs) >= kMinParallelTransactions) {
+    auto payload = serializePayload(*block_payload, txs, parallel_for_);
+    model_proto_block = arena_block
+        ? std::make_unique<shared_model::proto::Block>(std::move(*arena_block),
+                                                       std::move(payload))
+        : std::make_unique<shared_model::proto::Block>(std::move(heap_block),
+                                                       std::move(payload));
+  } else {
+    model_proto_block = arena_block
+        ? std::make_unique<shared_model::proto::Block>(std::move(*arena_block))
+        : std::make_unique<shared_model::proto::Block>(std::move(heap_block));
+  }
   auto interface_block_validation_result =
       interface_validator_->validate(*model_proto_block);
 
@@ -84,7 +187,33 @@ ProtoBlockFactory::createBlock(iroha::protocol::Block block) {
   }
 
   std::unique_ptr<shared_model::interface::Block> proto_block =
-      std::make_unique<Block>(std::move(block.block_v1()));
+      std::make_unique<Block>(std::move(*block.mutable_block_v1()));
+  if (auto errors = interface_validator_->validate(*proto_block)) {
+    return iroha::expected::makeError(errors.reason());
+  }
+
+  return iroha::expected::makeValue(std::move(proto_block));
+}
+
+iroha::expected::Result<std::unique_ptr<shared_model::interface::Block>,
+                        std::string>
+ProtoBlockFactory::createBlock(const void *data, size_t size) {
+  ArenaMessage<Block::TransportType> block_v1;
+  if (not block_v1->ParseFromArray(data, static_cast<int>(size))) {
+    return iroha::expected::makeError("Cannot parse the block");
+  }
+
+  // the container does not take the ownership of the arena message
+  iroha::protocol::Block block;
+  block.unsafe_arena_set_allocated_block_v1(&*block_v1);
+  auto proto_errors = proto_validator_->validate(block);
+  block.unsafe_arena_release_block_v1();
+  if (proto_errors) {
+    return iroha::expected::makeError(proto_errors.reason());
+  }
+
+  std::unique_ptr<shared_model::interface::Block> proto_block =
+      std::make_unique<Block>(std::move(block_v1));
   if (auto errors = interface_validator_->validate(*proto_block)) {
     return iroha::expected::makeError(errors.reason());
   }
@@ -9,6 +9,7 @@
 #include <string>
 
 #include "backend/protobuf/block.hpp"
+#include "backend/protobuf/json_proto_reader.hpp"
 
 using namespace shared_model;
 using namespace shared_model::proto;
@@ -33,9 +34,9 @@ iroha::expected::Result<std::unique_ptr<interface::Block>, std::string>
 ProtoBlockJsonConverter::deserialize(
     const interface::types::JsonType &json) const noexcept {
   iroha::protocol::Block block;
-  auto status = google::protobuf::util::JsonStringToMessage(json, &block);
-  if (not status.ok()) {
-    return iroha::expected::makeError(status.error_message());
+  if (auto error =
+          iroha::expected::resultToOptionalError(parseJson(json, block))) {
+    return iroha::expected::makeError(std::move(*error));
   }
   std::unique_ptr<interface::Block> result =
       std::make_unique<Block>(std::move(block.block_v1()));
@@ -5,9 +5,12 @@
 
 #include "backend/protobuf/transaction.hpp"
 
+#include <mutex>
+
 #include <boost/range/adaptor/transformed.hpp>
 #include "backend/protobuf/batch_meta.hpp"
 #include "backend/protobuf/commands/proto_command.hpp"
+#include "backend/protobuf/commands/proto_flat_command.hpp"
 #include "backend/protobuf/common_objects/signature.hpp"
 #include "backend/protobuf/util.hpp"
 #include "utils/reference_holder.hpp"
@@ -16,33 +19,104 @@ namespace shared_model {
   namespace proto {
 
     struct Transaction::Impl {
+      /// serialized message and its hash, computed on the first access
+      struct Digest {
+        std::once_flag flag;
+        interface::types::BlobType blob;
+        interface::types::HashType hash;
+      };
+
+      /**
+       * Digests of the payload, which does not change after the construction.
+       * They are shared by the copies and the clones of the transaction, so
+       * that the payload is hashed once however many times it is copied
+       */
+      struct PayloadDigests {
+        Digest payload;
+        Digest reduced_payload;
+      };
+
       explicit Impl(const TransportType &ref) : proto_{ref} {}
 
       explicit Impl(TransportType &&ref) : proto_{std::move(ref)} {}
 
       explicit Impl(TransportType &ref) : proto_{ref} {}
 
+      Impl(TransportType &ref, std::shared_ptr<google::protobuf::Arena> arena)
+          : proto_{ref}, arena_{std::move(arena)} {}
+
+      Impl(TransportType &&ref, std::shared_ptr<PayloadDigests> digests)
+          : proto_{std::move(ref)}, digests_{std::move(digests)} {}
+
+      template <typename Message>
+      static const Digest &digest(Digest &result, const Message &message) {
+        std::call_once(result.flag, [&result, &message] {
+          result.blob = makeBlob(message);
+          result.hash = makeHash(result.blob);
+        });
+        return result;
+      }
+
+      const Digest &payloadDigest() {
+        return digest(digests_->payload, payload_);
+      }
+
+      const Digest &reducedPayloadDigest() {
+        return digest(digests_->reduced_payload, reduced_payload_);
+      }
+
+      const std::vector<proto::Command> &commands() {
+        std::call_once(commands_flag_, [this] {
+          commands_ = std::vector<proto::Command>(
+              reduced_payload_.mutable_commands()->begin(),
+              reduced_payload_.mutable_commands()->end());
+        });
+        return commands_;
+      }
+
+      const interface::FlatCommandsType &flatCommands() {
+        std::call_once(flat_commands_flag_, [this] {
+          flat_commands_.reserve(reduced_payload_.commands_size());
+          for (const auto &command : reduced_payload_.commands()) {
+            flat_commands_.push_back(makeFlatCommand(command));
+          }
+        });
+        return flat_commands_;
+      }
+
+      const interface::types::BlobType &blob() {
+        std::lock_guard<std::mutex> lock(blob_mutex_);
+        if (not blob_) {
+          blob_ = makeBlob(*proto_);
+        }
+        return *blob_;
+      }
+
       detail::ReferenceHolder<TransportType> proto_;
 
+      /// arena of the referenced message, which is kept alive by the view
+      std::shared_ptr<google::protobuf::Arena> arena_;
+
+      std::shared_ptr<PayloadDigests> digests_{
+          std::make_shared<PayloadDigests>()};
+
       iroha::protocol::Transaction::Payload &payload_{
           *proto_->mutable_payload()};
 
       iroha::protocol::Transaction::Payload::ReducedPayload &reduced_payload_{
           *proto_->mutable_payload()->mutable_reduced_payload()};
 
-      interface::types::BlobType blob_{[this] { return makeBlob(*proto_); }()};
+      /// serialized transaction, computed on the first access and reset when
+      /// a signature is added
+      boost::optional<interface::types::BlobType> blob_;
+      std::mutex blob_mutex_;
 
-      interface::types::BlobType payload_blob_{
-          [this] { return makeBlob(payload_); }()};
-
-      interface::types::BlobType reduced_payload_blob_{
-          [this] { return makeBlob(reduced_payload_); }()};
-
-      interface::types::HashType reduced_hash_{makeHash(reduced_payload_blob_)};
-
-      std::vector<proto::Command> commands_{
-          reduced_payload_.mutable_commands()->begin(),
-          reduced_payload_.mutable_commands()->end()};
+      /// command wrappers and flat commands, built on the first access, so
+      /// that the transactions which are only passed around do not build them
+      std::once_flag commands_flag_;
+      std::vector<proto::Command> commands_;
+      std::once_flag flat_commands_flag_;
+      interface::FlatCommandsType flat_commands_;
 
       boost::optional<std::shared_ptr<interface::BatchMeta>> meta_{
           [this]() -> boost::optional<std::shared_ptr<interface::BatchMeta>> {
@@ -61,8 +135,6 @@ namespace shared_model {
         return SignatureSetType<proto::Signature>(signatures.begin(),
                                                   signatures.end());
       }()};
-
-      interface::types::HashType hash_{makeHash(payload_blob_)};
     };
 
     Transaction::Transaction(const TransportType &transaction) {
@@ -77,11 +149,18 @@ namespace shared_model {
       impl_ = std::make_unique<Transaction::Impl>(transaction);
     }
 
+    Transaction::Transaction(TransportType &transaction,
+                             std::shared_ptr<google::protobuf::Arena> arena) {
+      impl_ =
+          std::make_unique<Transaction::Impl>(transaction, std::move(arena));
+    }
+
     // TODO [IR-1866] Akvinikym 13.11.18: remove the copy ctor and fix fallen
     // tests
     Transaction::Transaction(const Transaction &transaction)
-        : Transaction(
-              static_cast<const TransportType &>(*transaction.impl_->proto_)) {}
+        : impl_{std::make_unique<Transaction::Impl>(
+              TransportType(*transaction.impl_->proto_),
+              transaction.impl_->digests_)} {}
 
     Transaction::Transaction(Transaction &&transaction) noexcept = default;
 
@@ -93,19 +172,27 @@ namespace shared_model {
     }
 
     Transaction::CommandsType Transaction::commands() const {
-      return impl_->commands_;
+      return impl_->commands();
+    }
+
+    Transaction::CommandsSpanType Transaction::commandsSpan() const {
+      return CommandsSpanType(impl_->commands());
+    }
+
+    const interface::FlatCommandsType &Transaction::flatCommands() const {
+      return impl_->flatCommands();
     }
 
     const interface::types::BlobType &Transaction::blob() const {
-      return impl_->blob_;
+      return impl_->blob();
     }
 
     const interface::types::BlobType &Transaction::payload() const {
-      return impl_->payload_blob_;
+      return impl_->payloadDigest().blob;
     }
 
     const interface::types::BlobType &Transaction::reducedPayload() const {
-      return impl_->reduced_payload_blob_;
+      return impl_->reducedPayloadDigest().blob;
     }
 
     interface::types::SignatureRangeType Transaction::signatures() const {
@@ -113,18 +200,15 @@ namespace shared_model {
     }
 
     const interface::types::HashType &Transaction::reducedHash() const {
-      return impl_->reduced_hash_;
+      return impl_->reducedPayloadDigest().hash;
     }
 
     bool Transaction::addSignature(const crypto::Signed &signed_blob,
                                    const crypto::PublicKey &public_key) {
       // if already has such signature
-      if (std::find_if(impl_->signatures_.begin(),
-                       impl_->signatures_.end(),
-                       [&public_key](const auto &signature) {
-                         return signature.publicKey() == public_key;
-                       })
-          != impl_->signatures_.end()) {
+      iroha::protocol::Signature probe;
+      probe.set_public_key(public_key.hex());
+      if (impl_->signatures_.count(proto::Signature(probe)) > 0) {
         return false;
       }
 
@@ -132,25 +216,29 @@ namespace shared_model {
       sig->set_signature(signed_blob.hex());
       sig->set_public_key(public_key.hex());
 
-      impl_->signatures_ = [this] {
-        auto signatures = *impl_->proto_->mutable_signatures()
-            | boost::adaptors::transformed(
-                  [](auto &x) { return proto::Signature(x); });
-        return SignatureSetType<proto::Signature>(signatures.begin(),
-                                                  signatures.end());
-      }();
+      // the elements of the repeated field are not moved by the insertion, so
+      // the set is extended instead of being rebuilt
+      impl_->signatures_.emplace(*sig);
+
+      std::lock_guard<std::mutex> lock(impl_->blob_mutex_);
+      impl_->blob_ = boost::none;
 
       return true;
     }
 
     const interface::types::HashType &Transaction::hash() const {
-      return impl_->hash_;
+      return impl_->payloadDigest().hash;
     }
 
     const Transaction::TransportType &Transaction::getTransport() const {
       return *impl_->proto_;
     }
 
+    const std::shared_ptr<google::protobuf::Arena> &Transaction::arena()
+        const {
+      return impl_->arena_;
+    }
+
     interface::types::TimestampType Transaction::createdTime() const {
       return impl_->reduced_payload_.created_time();
     }
@@ -165,7 +253,7 @@ namespace shared_model {
     }
 
     Transaction::ModelType *Transaction::clone() const {
-      return new Transaction(TransportType(*impl_->proto_));
+      return new Transaction(*this);
     }
 
   }  // namespace proto
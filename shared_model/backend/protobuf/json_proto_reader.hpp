@@ -0,0 +1,33 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_JSON_PROTO_READER_HPP
+#define IROHA_SHARED_MODEL_JSON_PROTO_READER_HPP
+
+#include <string>
+
+#include <google/protobuf/message.h>
+#include "common/result.hpp"
+
+namespace shared_model {
+  namespace proto {
+
+    /**
+     * Parse the JSON of a message in a single pass, setting the fields of the
+     * message as they are read, without the intermediate JSON tree and type
+     * resolution of google::protobuf::util::JsonStringToMessage. Supports the
+     * canonical JSON of the messages with string, integer, bool, enum and
+     * message fields, which are all of the block schema
+     * @param json - JSON of the message
+     * @param message - message to be filled, which should be empty
+     * @return nothing or the error message
+     */
+    iroha::expected::Result<void, std::string> parseJson(
+        const std::string &json, google::protobuf::Message &message);
+
+  }  // namespace proto
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_JSON_PROTO_READER_HPP
@@ -6,6 +6,7 @@
 #ifndef IROHA_SHARED_MODEL_PROTO_PROPOSAL_HPP
 #define IROHA_SHARED_MODEL_PROTO_PROPOSAL_HPP
 
+#include "backend/protobuf/arena_message.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
 #include "proposal.pb.h"
@@ -22,9 +23,21 @@ namespace shared_model {
       explicit Proposal(const TransportType &ref);
       explicit Proposal(TransportType &&ref);
 
+      /**
+       * Create the proposal, which owns the arena of the message, so that all
+       * of its messages are freed at once
+       */
+      explicit Proposal(ArenaMessage<TransportType> message);
+
       interface::types::TransactionsCollectionType transactions()
           const override;
 
+      interface::types::TransactionsSpanType transactionsSpan()
+          const override;
+
+      /// @return the batch boundaries found once at the construction
+      interface::types::BatchBoundariesType batchBoundaries() const override;
+
       interface::types::TimestampType createdTime() const override;
 
       interface::types::HeightType height() const override;
@@ -35,10 +48,22 @@ namespace shared_model {
 
       const interface::types::HashType &hash() const override;
 
+      /**
+       * Create the same proposal for another height. The transactions are
+       * shared, if the proposal is on an arena, and the serialized form is
+       * derived from the one of this proposal instead of being built again
+       * @param height - height of the created proposal
+       */
+      std::unique_ptr<Proposal> withHeight(
+          interface::types::HeightType height) const;
+
       ~Proposal() override;
 
      private:
       struct Impl;
+
+      explicit Proposal(std::unique_ptr<Impl> impl);
+
       std::unique_ptr<Impl> impl_;
     };
   }  // namespace proto
@@ -6,6 +6,8 @@
 #ifndef IROHA_PROTO_BLOCK_FACTORY_HPP
 #define IROHA_PROTO_BLOCK_FACTORY_HPP
 
+#include <functional>
+
 #include "backend/protobuf/transaction.hpp"
 #include "block.pb.h"
 #include "common/result.hpp"
@@ -19,11 +21,25 @@ namespace shared_model {
      */
     class ProtoBlockFactory : public interface::UnsafeBlockFactory {
      public:
+      /// calls the function for every index in [0, size), possibly on
+      /// several threads at once
+      using ParallelFor =
+          std::function<void(size_t, const std::function<void(size_t)> &)>;
+
+      /**
+       * @param parallel_for - serializes the transactions of the created
+       * blocks on several threads, the blocks are serialized on the calling
+       * thread if it is empty
+       * @param transactions_root - whether the created blocks have the Merkle
+       * root of their transactions
+       */
       ProtoBlockFactory(
           std::unique_ptr<shared_model::validation::AbstractValidator<
               shared_model::interface::Block>> interface_validator,
           std::unique_ptr<shared_model::validation::AbstractValidator<
-              iroha::protocol::Block>> proto_validator);
+              iroha::protocol::Block>> proto_validator,
+          ParallelFor parallel_for = nullptr,
+          bool transactions_root = false);
 
       std::unique_ptr<interface::Block> unsafeCreateBlock(
           interface::types::HeightType height,
@@ -42,6 +58,18 @@ namespace shared_model {
       iroha::expected::Result<std::unique_ptr<interface::Block>, std::string>
       createBlock(iroha::protocol::Block block);
 
+      /**
+       * Create block variant from the serialized message, which is parsed
+       * into an arena owned by the block
+       *
+       * @param data - serialized Block_v1
+       * @param size - size of the data
+       * @return Pointer to block.
+       *         Error if the data cannot be parsed or the block is invalid
+       */
+      iroha::expected::Result<std::unique_ptr<interface::Block>, std::string>
+      createBlock(const void *data, size_t size);
+
      private:
       std::unique_ptr<shared_model::validation::AbstractValidator<
           shared_model::interface::Block>>
@@ -49,6 +77,8 @@ namespace shared_model {
       std::unique_ptr<
           shared_model::validation::AbstractValidator<iroha::protocol::Block>>
           proto_validator_;
+      ParallelFor parallel_for_;
+      const bool transactions_root_;
     };
   }  // namespace proto
 }  // namespace shared_model
@@ -11,7 +11,7 @@
 #include "validators/validators_common.hpp"
 
 #include "backend/protobuf/proposal.hpp"
-#include "backend/protobuf/transaction.hpp"
+#include "backend/protobuf/transaction_views.hpp"
 #include "proposal.pb.h"
 
 namespace shared_model {
@@ -32,7 +32,7 @@ namespace shared_model {
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           TransactionsCollectionType transactions) override {
-        return createProposal(
+        return validate(
             createProtoProposal(height, created_time, transactions));
       }
 
@@ -42,8 +42,13 @@ namespace shared_model {
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           UnsafeTransactionsCollectionType transactions) override {
-        return std::make_unique<Proposal>(
-            createProtoProposal(height, created_time, transactions));
+        return createProtoProposal(height, created_time, transactions);
+      }
+
+      std::unique_ptr<interface::Proposal> unsafeCreateProposalAtHeight(
+          const interface::Proposal &proposal,
+          interface::types::HeightType height) override {
+        return static_cast<const Proposal &>(proposal).withHeight(height);
       }
 
       /**
@@ -55,22 +60,29 @@ namespace shared_model {
       }
 
      private:
-      iroha::protocol::Proposal createProtoProposal(
+      /**
+       * Create the proposal on the arena of the transactions, if they are
+       * views of a block or a proposal, so that they are referenced instead
+       * of being copied. Otherwise the proposal gets its own arena, so that
+       * the proposals derived from it for other heights share its copies
+       */
+      std::unique_ptr<Proposal> createProtoProposal(
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           UnsafeTransactionsCollectionType transactions) {
-        iroha::protocol::Proposal proposal;
-
-        proposal.set_height(height);
-        proposal.set_created_time(created_time);
-
-        for (const auto &tx : transactions) {
-          *proposal.add_transactions() =
-              static_cast<const shared_model::proto::Transaction &>(tx)
-                  .getTransport();
-        }
-
-        return proposal;
+        auto fill = [&](iroha::protocol::Proposal &proposal,
+                        google::protobuf::Arena *arena) {
+          proposal.set_height(height);
+          proposal.set_created_time(created_time);
+          addTransactions(
+              *proposal.mutable_transactions(), arena, transactions);
+        };
+
+        auto arena = transactionsArena(transactions);
+        auto proposal = arena ? ArenaMessage<iroha::protocol::Proposal>(arena)
+                              : ArenaMessage<iroha::protocol::Proposal>();
+        fill(*proposal, proposal.arena().get());
+        return std::make_unique<Proposal>(std::move(proposal));
       }
 
       FactoryResult<std::unique_ptr<interface::Proposal>> validate(
@@ -8,6 +8,10 @@
 
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
 
+#include <type_traits>
+
+#include <boost/optional.hpp>
+#include "backend/protobuf/arena_message.hpp"
 #include "backend/protobuf/util.hpp"
 #include "cryptography/hash_providers/sha3_256.hpp"
 #include "validators/abstract_validator.hpp"
@@ -41,22 +45,69 @@ namespace shared_model {
 
       iroha::expected::Result<std::unique_ptr<Interface>, Error> build(
           typename Proto::TransportType m) const override {
-        if (auto answer = proto_validator_->validate(m)) {
-          auto payload_field_descriptor =
-              m.GetDescriptor()->FindFieldByLowercaseName("payload");
-          shared_model::crypto::Hash hash;
-          if (payload_field_descriptor) {
-            const auto &payload =
-                m.GetReflection()->GetMessage(m, payload_field_descriptor);
-            // TODO: 2019-03-21 @muratovv refactor with template parameter
-            // IR-422
-            hash = HashProvider::makeHash(makeBlob(payload));
-          }
-          return iroha::expected::makeError(Error{hash, answer.reason()});
+        if (auto error = validateTransport(m)) {
+          return iroha::expected::makeError(std::move(*error));
+        }
+        return validateModel(std::make_unique<Proto>(std::move(m)));
+      }
+
+      /**
+       * Parse the transport into an arena owned by the object, if the object
+       * can own it
+       */
+      iroha::expected::Result<std::unique_ptr<Interface>, Error> build(
+          const std::string &serialized) const override {
+        return build(serialized,
+                     std::is_constructible<
+                         Proto,
+                         ArenaMessage<typename Proto::TransportType>>{});
+      }
+
+     private:
+      /// the object takes the arena with the parsed transport
+      iroha::expected::Result<std::unique_ptr<Interface>, Error> build(
+          const std::string &serialized, std::true_type) const {
+        ArenaMessage<typename Proto::TransportType> m;
+        if (not m->ParseFromString(serialized)) {
+          return iroha::expected::makeError(
+              Error{crypto::Hash{}, "Deserialization failed"});
         }
+        if (auto error = validateTransport(*m)) {
+          return iroha::expected::makeError(std::move(*error));
+        }
+        return validateModel(std::make_unique<Proto>(std::move(m)));
+      }
+
+      /// the object can not own an arena
+      iroha::expected::Result<std::unique_ptr<Interface>, Error> build(
+          const std::string &serialized, std::false_type) const {
+        return interface::AbstractTransportFactory<
+            Interface,
+            typename Proto::TransportType>::build(serialized);
+      }
 
-        std::unique_ptr<Interface> result =
-            std::make_unique<Proto>(std::move(m));
+      /// @return error with the payload hash if the transport is invalid
+      boost::optional<Error> validateTransport(
+          const typename Proto::TransportType &m) const {
+        auto answer = proto_validator_->validate(m);
+        if (not answer) {
+          return boost::none;
+        }
+        auto payload_field_descriptor =
+            m.GetDescriptor()->FindFieldByLowercaseName("payload");
+        shared_model::crypto::Hash hash;
+        if (payload_field_descriptor) {
+          const auto &payload =
+              m.GetReflection()->GetMessage(m, payload_field_descriptor);
+          // TODO: 2019-03-21 @muratovv refactor with template parameter
+          // IR-422
+          hash = HashProvider::makeHash(makeBlob(payload));
+        }
+        return Error{hash, answer.reason()};
+      }
+
+      iroha::expected::Result<std::unique_ptr<Interface>, Error> validateModel(
+          std::unique_ptr<Interface> result) const {
         if (auto answer = interface_validator_->validate(*result)) {
           return iroha::expected::makeError(
               Error{result->hash(), answer.reason()});
@@ -65,7 +116,6 @@ namespace shared_model {
         return iroha::expected::makeValue(std::move(result));
       }
 
-     private:
       using HashProvider = shared_model::crypto::Sha3_256;
 
       ValidatorType interface_validator_;
@@ -54,10 +54,8 @@ namespace shared_model {
 
       ProtoQueryVariantType variant_{[this] {
         auto &ar = proto_;
-        int which = ar.payload()
-                        .GetDescriptor()
-                        ->FindFieldByNumber(ar.payload().query_case())
-                        ->index_in_oneof();
+        int which = oneofIndex<iroha::protocol::Query::Payload>(
+            ar.payload().query_case());
         return shared_model::detail::variant_impl<
             ProtoQueryListType>::template load<ProtoQueryVariantType>(ar,
                                                                       which);
@@ -8,6 +8,7 @@
 #include "backend/protobuf/query_responses/proto_block_error_response.hpp"
 #include "backend/protobuf/query_responses/proto_block_response.hpp"
 #include "common/hexutils.hpp"
+#include "backend/protobuf/util.hpp"
 #include "utils/variant_deserializer.hpp"
 
 namespace {
@@ -27,8 +28,7 @@ namespace shared_model {
 
       const ProtoQueryResponseVariantType variant_{[this] {
         auto &ar = proto_;
-        int which =
-            ar.GetDescriptor()->FindFieldByNumber(ar.response_case())->index();
+        int which = oneofIndex<TransportType>(ar.response_case());
         return shared_model::detail::
             variant_impl<ProtoQueryResponseVariantType::types>::template load<
                 ProtoQueryResponseVariantType>(ar, which);
@@ -19,6 +19,7 @@
 #include "backend/protobuf/query_responses/proto_transaction_response.hpp"
 #include "backend/protobuf/query_responses/proto_transactions_page_response.hpp"
 #include "common/byteutils.hpp"
+#include "backend/protobuf/util.hpp"
 #include "utils/variant_deserializer.hpp"
 
 namespace {
@@ -52,8 +53,7 @@ namespace shared_model {
 
       const ProtoQueryResponseVariantType variant_{[this] {
         auto &ar = proto_;
-        int which =
-            ar.GetDescriptor()->FindFieldByNumber(ar.response_case())->index();
+        int which = oneofIndex<TransportType>(ar.response_case());
         return shared_model::detail::variant_impl<ProtoQueryResponseListType>::
             template load<ProtoQueryResponseVariantType>(ar, which);
       }()};
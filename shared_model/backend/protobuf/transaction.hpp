@@ -6,6 +6,8 @@
 #ifndef IROHA_SHARED_MODEL_PROTO_TRANSACTION_HPP
 #define IROHA_SHARED_MODEL_PROTO_TRANSACTION_HPP
 
+#include <memory>
+
 #include "interfaces/transaction.hpp"
 #include "transaction.pb.h"
 
@@ -21,6 +23,15 @@ namespace shared_model {
 
       explicit Transaction(TransportType &transaction);
 
+      /**
+       * Create a view of a transaction allocated on an arena, e.g. of a
+       * transaction of a block or a proposal. The view keeps the arena alive,
+       * so that the transaction can be referenced by other messages on the
+       * same arena without being copied
+       */
+      Transaction(TransportType &transaction,
+                  std::shared_ptr<google::protobuf::Arena> arena);
+
       Transaction(const Transaction &transaction);
 
       Transaction(Transaction &&o) noexcept;
@@ -31,6 +42,10 @@ namespace shared_model {
 
       Transaction::CommandsType commands() const override;
 
+      Transaction::CommandsSpanType commandsSpan() const override;
+
+      const interface::FlatCommandsType &flatCommands() const override;
+
       const interface::types::BlobType &blob() const override;
 
       const interface::types::BlobType &payload() const override;
@@ -48,6 +63,10 @@ namespace shared_model {
 
       const TransportType &getTransport() const;
 
+      /// @return arena of the transaction if it is a view of one, nullptr
+      /// otherwise
+      const std::shared_ptr<google::protobuf::Arena> &arena() const;
+
       interface::types::TimestampType createdTime() const override;
 
       interface::types::QuorumType quorum() const override;
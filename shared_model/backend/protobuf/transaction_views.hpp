@@ -0,0 +1,81 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROTO_TRANSACTION_VIEWS_HPP
+#define IROHA_PROTO_TRANSACTION_VIEWS_HPP
+
+#include <memory>
+#include <vector>
+
+#include <google/protobuf/arena.h>
+#include <google/protobuf/repeated_field.h>
+#include "backend/protobuf/transaction.hpp"
+
+namespace shared_model {
+  namespace proto {
+
+    using TransactionsField =
+        google::protobuf::RepeatedPtrField<Transaction::TransportType>;
+
+    /**
+     * @param transactions - transactions of a message
+     * @param arena - arena of the message, nullptr if it is on the heap
+     * @return views of the transactions, which keep the arena alive
+     */
+    inline std::vector<Transaction> makeTransactionViews(
+        TransactionsField &transactions,
+        const std::shared_ptr<google::protobuf::Arena> &arena) {
+      std::vector<Transaction> views;
+      views.reserve(transactions.size());
+      for (auto &transaction : transactions) {
+        views.emplace_back(transaction, arena);
+      }
+      return views;
+    }
+
+    /**
+     * @param transactions - range of proto transactions
+     * @return arena of the first transaction, on which a message referencing
+     * the transactions is to be created, nullptr if there is none
+     */
+    template <typename Transactions>
+    std::shared_ptr<google::protobuf::Arena> transactionsArena(
+        const Transactions &transactions) {
+      auto begin = std::begin(transactions);
+      if (begin == std::end(transactions)) {
+        return nullptr;
+      }
+      return static_cast<const Transaction &>(*begin).arena();
+    }
+
+    /**
+     * Add the transactions to the field of a message. The transactions on the
+     * arena of the message are referenced by the field, the rest are copied
+     * @param field - transactions of the message
+     * @param arena - arena of the message, nullptr if it is on the heap
+     * @param transactions - range of proto transactions
+     */
+    template <typename Transactions>
+    void addTransactions(TransactionsField &field,
+                         google::protobuf::Arena *arena,
+                         const Transactions &transactions) {
+      for (const auto &tx : transactions) {
+        const auto &transaction = static_cast<const Transaction &>(tx);
+        if (arena != nullptr and transaction.arena().get() == arena) {
+          // the transaction is owned by the arena and is not modified
+          // through the views, so the messages can share it
+          field.UnsafeArenaAddAllocated(
+              const_cast<Transaction::TransportType *>(
+                  &transaction.getTransport()));
+        } else {
+          *field.Add() = transaction.getTransport();
+        }
+      }
+    }
+
+  }  // namespace proto
+}  // namespace shared_model
+
+#endif  // IROHA_PROTO_TRANSACTION_VIEWS_HPP
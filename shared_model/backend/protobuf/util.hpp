@@ -6,6 +6,7 @@
 #ifndef IROHA_SHARED_MODEL_PROTO_UTIL_HPP
 #define IROHA_SHARED_MODEL_PROTO_UTIL_HPP
 
+#include <google/protobuf/descriptor.h>
 #include <google/protobuf/message.h>
 #include <vector>
 #include "cryptography/blob.hpp"
@@ -21,6 +22,38 @@ namespace shared_model {
       return crypto::Blob(std::move(data));
     }
 
+    /**
+     * Index of the field in its oneof by the number of the field, which is
+     * the case of the oneof. The indices of the fields of the message type
+     * are tabulated from its descriptor once, so the lookup is indexed
+     * @tparam Message - protobuf message type
+     * @param number - number of the field
+     * @return index of the field in its oneof, -1 if the message has no such
+     * field of a oneof
+     */
+    template <typename Message>
+    int oneofIndex(int number) {
+      static const std::vector<int> kIndices = [] {
+        const auto *descriptor = Message::descriptor();
+        std::vector<int> indices;
+        for (int i = 0; i < descriptor->field_count(); ++i) {
+          const auto *field = descriptor->field(i);
+          if (field->containing_oneof() == nullptr) {
+            continue;
+          }
+          auto field_number = static_cast<size_t>(field->number());
+          if (indices.size() <= field_number) {
+            indices.resize(field_number + 1, -1);
+          }
+          indices[field_number] = field->index_in_oneof();
+        }
+        return indices;
+      }();
+      return number >= 0 and static_cast<size_t>(number) < kIndices.size()
+          ? kIndices[number]
+          : -1;
+    }
+
   }  // namespace proto
 }  // namespace shared_model
 
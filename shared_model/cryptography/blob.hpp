@@ -6,6 +6,7 @@
 #ifndef IROHA_SHARED_MODEL_BLOB_HPP
 #define IROHA_SHARED_MODEL_BLOB_HPP
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -42,6 +43,12 @@ namespace shared_model {
 
       explicit Blob(Bytes &&blob) noexcept;
 
+      /// the copies share the hex representation once it is made
+      Blob(const Blob &other);
+      Blob(Blob &&other) noexcept = default;
+      Blob &operator=(const Blob &other);
+      Blob &operator=(Blob &&other) noexcept = default;
+
       /**
        * Creates new Blob object from provided hex string
        * @param hex - string in hex format to create Blob from
@@ -57,7 +64,8 @@ namespace shared_model {
 
       /**
        * @return provides human-readable representation of blob without leading
-       * 0x
+       * 0x, which is made on the first call, as most of the blobs are never
+       * printed
        */
       virtual const std::string &hex() const;
 
@@ -75,7 +83,9 @@ namespace shared_model {
 
      private:
       Bytes blob_;
-      std::string hex_;
+      /// accessed atomically, as hex() of a shared blob may be called
+      /// concurrently
+      mutable std::shared_ptr<const std::string> hex_;
     };
 
   }  // namespace crypto
@@ -0,0 +1,44 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ASYNC_SIGNER_HPP
+#define IROHA_ASYNC_SIGNER_HPP
+
+#include <functional>
+
+#include "cryptography/blob.hpp"
+#include "cryptography/public_key.hpp"
+#include "cryptography/signed.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /**
+     * Signer which does not block the caller until the signature is ready,
+     * so that the keys may be kept out of the process, e.g. in a hardware
+     * security module
+     */
+    class AsyncSigner {
+     public:
+      using Callback = std::function<void(Signed)>;
+
+      virtual ~AsyncSigner() = default;
+
+      /// @return public key of the signatures
+      virtual const PublicKey &publicKey() const = 0;
+
+      /**
+       * Request the signature of the blob
+       * @param blob - data for signing
+       * @param callback - receives the signature, either in the calling
+       * thread or in a thread of the signer
+       */
+      virtual void sign(Blob blob, Callback callback) = 0;
+    };
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // IROHA_ASYNC_SIGNER_HPP
@@ -6,7 +6,12 @@
 #ifndef IROHA_CRYPTO_VERIFIER_HPP
 #define IROHA_CRYPTO_VERIFIER_HPP
 
+#include <string>
+#include <vector>
+
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "cryptography/signature_batch.hpp"
+#include "cryptography/verified_signature_cache.hpp"
 
 namespace shared_model {
   namespace crypto {
@@ -17,7 +22,8 @@ namespace shared_model {
 
     /**
      * CryptoVerifier - adapter for generalization verification of cryptographic
-     * signatures
+     * signatures. The valid signatures are remembered by the verified
+     * signature cache of the process and are not verified again
      * @tparam Algorithm - cryptographic algorithm for verification
      */
     template <typename Algorithm = DefaultCryptoAlgorithmType>
@@ -33,11 +39,118 @@ namespace shared_model {
       static bool verify(const Signed &signedData,
                          const Blob &source,
                          const PublicKey &pubKey) {
-        return Algorithm::verify(signedData, source, pubKey);
+        if (not hasValidLengths(signedData, pubKey)) {
+          return false;
+        }
+        auto &cache = VerifiedSignatureCache::instance();
+        auto digest = VerifiedSignatureCache::digest(source);
+        if (cache.contains(digest, pubKey, signedData)) {
+          return true;
+        }
+        if (not Algorithm::verify(signedData, source, pubKey)) {
+          return false;
+        }
+        cache.insert(digest, pubKey, signedData);
+        return true;
+      }
+
+      /**
+       * Verify signatures of the same source data together
+       * @param source - data that was signed
+       * @param signatures - cryptographic signatures with public keys of
+       * signatories
+       * @return true if all signatures are correct
+       */
+      static bool verifyBatch(const Blob &source,
+                              const SignatureBatch &signatures) {
+        for (const auto &signature : signatures) {
+          if (not hasValidLengths(signature.signed_data,
+                                  signature.public_key)) {
+            return false;
+          }
+        }
+        auto &cache = VerifiedSignatureCache::instance();
+        auto digest = VerifiedSignatureCache::digest(source);
+        SignatureBatch unverified;
+        for (const auto &signature : signatures) {
+          if (not cache.contains(
+                  digest, signature.public_key, signature.signed_data)) {
+            unverified.push_back(signature);
+          }
+        }
+        if (unverified.empty()) {
+          return true;
+        }
+        if (not Algorithm::verifyBatch(source, unverified)) {
+          return false;
+        }
+        for (const auto &signature : unverified) {
+          cache.insert(digest, signature.public_key, signature.signed_data);
+        }
+        return true;
+      }
+
+      /**
+       * Verify signatures of different data together. If the batch fails,
+       * its signatures are verified one by one to find the invalid ones
+       * @param batch - data with cryptographic signatures and public keys of
+       * signatories
+       * @return validity of every signature of the batch in its order
+       */
+      static std::vector<bool> verifyBatch(const SignedMessageBatch &batch) {
+        auto &cache = VerifiedSignatureCache::instance();
+        std::vector<bool> valid(batch.size(), false);
+        SignedMessageBatch unverified;
+        std::vector<size_t> unverified_indices;
+        std::vector<std::string> digests;
+        for (size_t i = 0; i < batch.size(); ++i) {
+          const auto &signature = batch[i];
+          if (not hasValidLengths(signature.signed_data,
+                                  signature.public_key)) {
+            continue;
+          }
+          auto digest = VerifiedSignatureCache::digest(signature.source);
+          if (cache.contains(
+                  digest, signature.public_key, signature.signed_data)) {
+            valid[i] = true;
+            continue;
+          }
+          unverified.push_back(signature);
+          unverified_indices.push_back(i);
+          digests.push_back(std::move(digest));
+        }
+        if (unverified.empty()) {
+          return valid;
+        }
+
+        auto batch_valid = Algorithm::verifyBatch(unverified);
+        for (size_t i = 0; i < unverified.size(); ++i) {
+          const auto &signature = unverified[i];
+          if (batch_valid
+              or Algorithm::verify(signature.signed_data,
+                                   signature.source,
+                                   signature.public_key)) {
+            valid[unverified_indices[i]] = true;
+            cache.insert(
+                digests[i], signature.public_key, signature.signed_data);
+          }
+        }
+        return valid;
       }
 
       /// close constructor for forbidding instantiation
       CryptoVerifier() = delete;
+
+     private:
+      /**
+       * @return true if the signature and the public key have the lengths of
+       * the algorithm, which the verified signature cache relies on
+       */
+      static bool hasValidLengths(const Signed &signed_data,
+                                  const PublicKey &public_key) {
+        return signed_data.blob().size() == Algorithm::kSignatureLength
+            and public_key.blob().size() == Algorithm::kPublicKeyLength;
+      }
     };
   }  // namespace crypto
 }  // namespace shared_model
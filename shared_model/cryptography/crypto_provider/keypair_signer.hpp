@@ -0,0 +1,39 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_KEYPAIR_SIGNER_HPP
+#define IROHA_KEYPAIR_SIGNER_HPP
+
+#include "cryptography/crypto_provider/async_signer.hpp"
+
+#include "cryptography/crypto_provider/crypto_signer.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /**
+     * Signer with the keypair in memory, signs in the calling thread
+     */
+    template <typename Algorithm = CryptoSigner<>>
+    class KeypairSigner : public AsyncSigner {
+     public:
+      explicit KeypairSigner(Keypair keypair) : keypair_(std::move(keypair)) {}
+
+      const PublicKey &publicKey() const override {
+        return keypair_.publicKey();
+      }
+
+      void sign(Blob blob, Callback callback) override {
+        callback(Algorithm::sign(blob, keypair_));
+      }
+
+     private:
+      Keypair keypair_;
+    };
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // IROHA_KEYPAIR_SIGNER_HPP
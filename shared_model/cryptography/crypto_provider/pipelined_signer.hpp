@@ -0,0 +1,73 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PIPELINED_SIGNER_HPP
+#define IROHA_PIPELINED_SIGNER_HPP
+
+#include "cryptography/crypto_provider/async_signer.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace shared_model {
+  namespace crypto {
+
+    /**
+     * Signer over a blocking signing function, e.g. a session of a PKCS#11
+     * token or a request to a key management service. The requests are
+     * queued and signed by a pool of workers, so that as many requests as
+     * there are workers are in flight at once, and the latency of the device
+     * is not paid by the callers.
+     */
+    class PipelinedSigner : public AsyncSigner {
+     public:
+      /// blocking signing function, it is called by several workers at once
+      using SignFunction = std::function<Signed(const Blob &)>;
+
+      /**
+       * @param public_key - public key of the signatures
+       * @param sign - signing function
+       * @param depth - number of the requests in flight
+       */
+      PipelinedSigner(PublicKey public_key, SignFunction sign, size_t depth);
+
+      /**
+       * Signs the queued requests and stops the workers
+       */
+      ~PipelinedSigner() override;
+
+      const PublicKey &publicKey() const override;
+
+      void sign(Blob blob, Callback callback) override;
+
+     private:
+      struct Request {
+        Blob blob;
+        Callback callback;
+      };
+
+      /**
+       * Sign the queued requests until stopped
+       */
+      void run();
+
+      PublicKey public_key_;
+      SignFunction sign_;
+
+      std::mutex mutex_;
+      std::condition_variable cv_;
+      bool stopped_ = false;
+      std::deque<Request> requests_;
+
+      std::vector<std::thread> workers_;
+    };
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // IROHA_PIPELINED_SIGNER_HPP
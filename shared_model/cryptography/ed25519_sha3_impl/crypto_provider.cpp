@@ -22,6 +22,16 @@ namespace shared_model {
       return Verifier::verify(signedData, orig, publicKey);
     }
 
+    bool CryptoProviderEd25519Sha3::verifyBatch(
+        const Blob &orig, const SignatureBatch &signatures) {
+      return Verifier::verifyBatch(orig, signatures);
+    }
+
+    bool CryptoProviderEd25519Sha3::verifyBatch(
+        const SignedMessageBatch &batch) {
+      return Verifier::verifyBatch(batch);
+    }
+
     Seed CryptoProviderEd25519Sha3::generateSeed() {
       return Seed(iroha::create_seed().to_string());
     }
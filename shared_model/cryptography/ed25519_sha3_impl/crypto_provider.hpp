@@ -8,6 +8,7 @@
 
 #include "cryptography/keypair.hpp"
 #include "cryptography/seed.hpp"
+#include "cryptography/signature_batch.hpp"
 #include "cryptography/signed.hpp"
 
 namespace shared_model {
@@ -35,6 +36,24 @@ namespace shared_model {
       static bool verify(const Signed &signedData,
                          const Blob &orig,
                          const PublicKey &publicKey);
+
+      /**
+       * Verifies signatures of the same message. Cheaper than separate
+       * verification of each signature, since the message is processed once
+       * @param orig - original message
+       * @param signatures - signatures with public keys
+       * @return true if all signatures are correct or false otherwise
+       */
+      static bool verifyBatch(const Blob &orig,
+                              const SignatureBatch &signatures);
+
+      /**
+       * Verifies signatures of different messages together
+       * @param batch - messages with signatures and public keys
+       * @return true if all signatures are correct or false otherwise
+       */
+      static bool verifyBatch(const SignedMessageBatch &batch);
+
       /**
        * Generates new seed
        * @return Seed generated
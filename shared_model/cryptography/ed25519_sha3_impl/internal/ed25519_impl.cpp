@@ -40,11 +40,18 @@ namespace iroha {
               size_t msgsize,
               const pubkey_t &pub,
               const sig_t &sig) {
+    return verify(msg, msgsize, pub.data(), sig.data());
+  }
+
+  bool verify(const uint8_t *msg,
+              size_t msgsize,
+              const uint8_t *pub,
+              const uint8_t *sig) {
     return 1
-        == ed25519_verify(reinterpret_cast<const signature_t *>(sig.data()),
+        == ed25519_verify(reinterpret_cast<const signature_t *>(sig),
                           msg,
                           msgsize,
-                          reinterpret_cast<const public_key_t *>(pub.data()));
+                          reinterpret_cast<const public_key_t *>(pub));
   }
 
   bool verify(const std::string &msg, const pubkey_t &pub, const sig_t &sig) {
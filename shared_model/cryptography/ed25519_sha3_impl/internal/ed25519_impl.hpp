@@ -44,6 +44,20 @@ namespace iroha {
 
   bool verify(const std::string &msg, const pubkey_t &pub, const sig_t &sig);
 
+  /**
+   * Verify signature of ed25519 crypto algorithm without copying the key and
+   * the signature
+   * @param msg
+   * @param msgsize
+   * @param pub - public key of pubkey_t::size() bytes
+   * @param sig - signature of sig_t::size() bytes
+   * @return true if signature is valid, false otherwise
+   */
+  bool verify(const uint8_t *msg,
+              size_t msgsize,
+              const uint8_t *pub,
+              const uint8_t *sig);
+
   /**
    * Generate random seed reading from /dev/urandom
    */
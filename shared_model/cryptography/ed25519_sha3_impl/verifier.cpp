@@ -4,18 +4,61 @@
  */
 
 #include "verifier.hpp"
+
+#include <algorithm>
+
 #include "cryptography/ed25519_sha3_impl/internal/ed25519_impl.hpp"
 #include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
 
+namespace {
+  /**
+   * Verify the signature of the digest reading the bytes of the key and of
+   * the signature in place
+   * @return true if the signature is valid, false otherwise or if the key or
+   * the signature is of wrong size
+   */
+  bool verifyDigest(const iroha::hash256_t &digest,
+                    const shared_model::crypto::PublicKey &public_key,
+                    const shared_model::crypto::Signed &signed_data) {
+    const auto &pub = public_key.blob();
+    const auto &sig = signed_data.blob();
+    if (pub.size() != iroha::pubkey_t::size()
+        or sig.size() != iroha::sig_t::size()) {
+      return false;
+    }
+    return iroha::verify(
+        digest.data(), digest.size(), pub.data(), sig.data());
+  }
+
+  iroha::hash256_t digestOf(const shared_model::crypto::Blob &orig) {
+    const auto &bytes = orig.blob();
+    return iroha::sha3_256(bytes.data(), bytes.size());
+  }
+}  // namespace
+
 namespace shared_model {
   namespace crypto {
     bool Verifier::verify(const Signed &signedData,
                           const Blob &orig,
                           const PublicKey &publicKey) {
-      return iroha::verify(
-          iroha::sha3_256(crypto::toBinaryString(orig)).to_string(),
-          iroha::pubkey_t::from_string(toBinaryString(publicKey)),
-          iroha::sig_t::from_string(toBinaryString(signedData)));
+      return verifyDigest(digestOf(orig), publicKey, signedData);
+    }
+
+    bool Verifier::verifyBatch(const Blob &orig,
+                               const SignatureBatch &signatures) {
+      auto digest = digestOf(orig);
+      return std::all_of(
+          signatures.begin(), signatures.end(), [&digest](const auto &sig) {
+            return verifyDigest(digest, sig.public_key, sig.signed_data);
+          });
+    }
+
+    bool Verifier::verifyBatch(const SignedMessageBatch &batch) {
+      // the ed25519 library has no multi-scalar multiplication, so the
+      // signatures are checked one by one
+      return std::all_of(batch.begin(), batch.end(), [](const auto &sig) {
+        return verify(sig.signed_data, sig.source, sig.public_key);
+      });
     }
   }  // namespace crypto
 }  // namespace shared_model
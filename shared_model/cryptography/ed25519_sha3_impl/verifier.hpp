@@ -7,6 +7,7 @@
 #define IROHA_SHARED_MODEL_VERIFIER_HPP
 
 #include "cryptography/public_key.hpp"
+#include "cryptography/signature_batch.hpp"
 #include "cryptography/signed.hpp"
 
 namespace shared_model {
@@ -19,6 +20,17 @@ namespace shared_model {
       static bool verify(const Signed &signedData,
                          const Blob &orig,
                          const PublicKey &publicKey);
+
+      /**
+       * Verify signatures of the same message, which is hashed once
+       */
+      static bool verifyBatch(const Blob &orig,
+                              const SignatureBatch &signatures);
+
+      /**
+       * Verify signatures of different messages
+       */
+      static bool verifyBatch(const SignedMessageBatch &batch);
     };
 
   }  // namespace crypto
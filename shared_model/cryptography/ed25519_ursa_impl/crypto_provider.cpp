@@ -5,6 +5,8 @@
 
 #include "cryptography/ed25519_ursa_impl/crypto_provider.hpp"
 
+#include <algorithm>
+
 #include "ursa_crypto.h"
 
 namespace shared_model {
@@ -60,6 +62,38 @@ namespace shared_model {
       }
     }
 
+    bool CryptoProviderEd25519Ursa::verifyBatch(
+        const Blob &orig, const SignatureBatch &signatures) {
+      const ByteBuffer kMessage = {(int64_t)orig.blob().size(),
+                                   const_cast<uint8_t *>(orig.blob().data())};
+
+      for (const auto &signature : signatures) {
+        ExternError err;
+
+        const ByteBuffer kSignature = {
+            (int64_t)signature.signed_data.blob().size(),
+            const_cast<uint8_t *>(signature.signed_data.blob().data())};
+
+        const ByteBuffer kPublicKey = {
+            (int64_t)signature.public_key.blob().size(),
+            const_cast<uint8_t *>(signature.public_key.blob().data())};
+
+        if (!ursa_ed25519_verify(&kMessage, &kSignature, &kPublicKey, &err)) {
+          ursa_ed25519_string_free(err.message);
+          return false;
+        }
+      }
+      return true;
+    }
+
+    bool CryptoProviderEd25519Ursa::verifyBatch(
+        const SignedMessageBatch &batch) {
+      // ursa has no batch verification of ed25519 signatures
+      return std::all_of(batch.begin(), batch.end(), [](const auto &sig) {
+        return verify(sig.signed_data, sig.source, sig.public_key);
+      });
+    }
+
     Keypair CryptoProviderEd25519Ursa::generateKeypair() {
       ByteBuffer public_key;
       ByteBuffer private_key;
@@ -10,6 +10,7 @@
 #include "cryptography/private_key.hpp"
 #include "cryptography/public_key.hpp"
 #include "cryptography/seed.hpp"
+#include "cryptography/signature_batch.hpp"
 #include "cryptography/signed.hpp"
 
 namespace shared_model {
@@ -38,6 +39,22 @@ namespace shared_model {
                          const Blob &orig,
                          const PublicKey &public_key);
 
+      /**
+       * Verifies signatures of the same message
+       * @param orig - original message
+       * @param signatures - signatures with public keys
+       * @return true if all signatures are correct or false otherwise
+       */
+      static bool verifyBatch(const Blob &orig,
+                              const SignatureBatch &signatures);
+
+      /**
+       * Verifies signatures of different messages together
+       * @param batch - messages with signatures and public keys
+       * @return true if all signatures are correct or false otherwise
+       */
+      static bool verifyBatch(const SignedMessageBatch &batch);
+
       /**
        * Generates new keypair with a default seed
        * @return Keypair generated
@@ -6,6 +6,8 @@
 #ifndef IROHA_SHARED_MODEL_SHA3_256_HPP
 #define IROHA_SHARED_MODEL_SHA3_256_HPP
 
+#include <vector>
+
 #include "crypto/hash_types.hpp"
 #include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
 #include "cryptography/hash.hpp"
@@ -17,6 +19,31 @@ namespace shared_model {
       static Hash makeHash(const Blob &blob) {
         return Hash(iroha::sha3_256(blob.blob()).to_string());
       }
+
+      /**
+       * Hash several independent buffers in one call. The digests are
+       * written into one preallocated buffer, so the only allocations are
+       * those of the resulting hashes
+       * @param blobs - buffers to hash
+       * @return hashes in the order of the buffers
+       */
+      static std::vector<Hash> makeHashes(
+          const std::vector<const Blob *> &blobs) {
+        constexpr auto kSize = iroha::hash256_t::size();
+        std::vector<uint8_t> digests(blobs.size() * kSize);
+        for (size_t i = 0; i < blobs.size(); ++i) {
+          const auto &bytes = blobs[i]->blob();
+          iroha::sha3_256(
+              digests.data() + i * kSize, bytes.data(), bytes.size());
+        }
+
+        std::vector<Hash> hashes;
+        hashes.reserve(blobs.size());
+        for (auto it = digests.begin(); it != digests.end(); it += kSize) {
+          hashes.emplace_back(Blob(Blob::Bytes(it, it + kSize)));
+        }
+        return hashes;
+      }
     };
   }  // namespace crypto
 }  // namespace shared_model
@@ -0,0 +1,75 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_MERKLE_TREE_HPP
+#define IROHA_SHARED_MODEL_MERKLE_TREE_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "cryptography/hash.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /**
+     * Merkle tree over the hashes of the transactions of a block, which lets
+     * a client check that a transaction is in the block by its proof instead
+     * of the whole block.
+     *
+     * Version 1 hashes a leaf as sha3_256(0x00 || transaction hash) and an
+     * inner node as sha3_256(0x01 || left || right), so that a node cannot be
+     * passed for a leaf. The last node of an odd level is promoted to the
+     * next level as it is. The root of no transactions is the hash of an
+     * empty message
+     */
+    class MerkleTree {
+     public:
+      /// version of the tree which is built
+      static constexpr uint32_t kVersion = 1;
+
+      /// @param transaction_hashes - hashes of the transactions in the order
+      /// of the block
+      explicit MerkleTree(const std::vector<Hash> &transaction_hashes);
+
+      /// @return the root of the tree
+      const Hash &root() const;
+
+      /// @return number of the transactions in the tree
+      size_t size() const;
+
+      /**
+       * @param index - index of the transaction in the block, which is less
+       * than the size
+       * @return the siblings of the path from the leaf to the root, from the
+       * bottom up
+       */
+      std::vector<Hash> proof(size_t index) const;
+
+      /**
+       * Check the proof of the transaction against the root
+       * @param transaction_hash - hash of the transaction
+       * @param index - index of the transaction in the block
+       * @param size - number of the transactions in the block
+       * @param siblings - proof of the transaction
+       * @param root - root of the tree of the block
+       * @return true if the transaction is at the index in the tree
+       */
+      static bool verify(const Hash &transaction_hash,
+                         size_t index,
+                         size_t size,
+                         const std::vector<Hash> &siblings,
+                         const Hash &root);
+
+     private:
+      size_t size_;
+      /// levels of the tree from the leaves to the root
+      std::vector<std::vector<Hash>> levels_;
+    };
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_MERKLE_TREE_HPP
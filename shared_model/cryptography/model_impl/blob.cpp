@@ -19,8 +19,17 @@ namespace shared_model {
 
     Blob::Blob(const Bytes &blob) : Blob(Bytes(blob)) {}
 
-    Blob::Blob(Bytes &&blob) noexcept : blob_(std::move(blob)) {
-      hex_ = iroha::bytestringToHexstring(toBinaryString(*this));
+    Blob::Blob(Bytes &&blob) noexcept : blob_(std::move(blob)) {}
+
+    Blob::Blob(const Blob &other)
+        : blob_(other.blob_), hex_(std::atomic_load(&other.hex_)) {}
+
+    Blob &Blob::operator=(const Blob &other) {
+      if (this != &other) {
+        blob_ = other.blob_;
+        hex_ = std::atomic_load(&other.hex_);
+      }
+      return *this;
     }
 
     Blob *Blob::clone() const {
@@ -43,7 +52,17 @@ namespace shared_model {
     }
 
     const std::string &Blob::hex() const {
-      return hex_;
+      auto hex = std::atomic_load(&hex_);
+      if (not hex) {
+        auto made = std::make_shared<const std::string>(
+            iroha::bytesToHexstring(blob_.data(), blob_.size()));
+        // the representation made by another thread is kept, so the
+        // returned references stay valid
+        if (std::atomic_compare_exchange_strong(&hex_, &hex, made)) {
+          hex = std::move(made);
+        }
+      }
+      return *hex;
     }
 
     size_t Blob::size() const {
@@ -5,6 +5,8 @@
 
 #include "cryptography/hash.hpp"
 
+#include <cstring>
+
 #include <boost/functional/hash.hpp>
 
 #include "common/byteutils.hpp"
@@ -29,11 +31,20 @@ namespace shared_model {
     }
 
     std::size_t Hash::Hasher::operator()(const Hash &h) const {
+      const auto &blob = h.blob();
+      // the bytes of a hash are already uniformly distributed, so a prefix
+      // of a full hash is used as is
+      if (blob.size() >= sizeof(std::size_t)) {
+        std::size_t prefix;
+        std::memcpy(&prefix, blob.data(), sizeof(prefix));
+        return prefix;
+      }
+
       using boost::hash_combine;
       using boost::hash_value;
 
       std::size_t seed = 0;
-      hash_combine(seed, hash_value(h.blob()));
+      hash_combine(seed, hash_value(blob));
 
       return seed;
     }
@@ -0,0 +1,108 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cryptography/merkle_tree.hpp"
+
+#include "cryptography/hash_providers/sha3_256.hpp"
+
+namespace {
+  using shared_model::crypto::Blob;
+  using shared_model::crypto::Hash;
+
+  constexpr uint8_t kLeafPrefix = 0x00;
+  constexpr uint8_t kNodePrefix = 0x01;
+
+  Hash leafHash(const Hash &transaction_hash) {
+    Blob::Bytes bytes{kLeafPrefix};
+    const auto &hash = transaction_hash.blob();
+    bytes.insert(bytes.end(), hash.begin(), hash.end());
+    return shared_model::crypto::Sha3_256::makeHash(Blob(std::move(bytes)));
+  }
+
+  Hash nodeHash(const Hash &left, const Hash &right) {
+    Blob::Bytes bytes{kNodePrefix};
+    bytes.insert(bytes.end(), left.blob().begin(), left.blob().end());
+    bytes.insert(bytes.end(), right.blob().begin(), right.blob().end());
+    return shared_model::crypto::Sha3_256::makeHash(Blob(std::move(bytes)));
+  }
+}  // namespace
+
+namespace shared_model {
+  namespace crypto {
+
+    MerkleTree::MerkleTree(const std::vector<Hash> &transaction_hashes)
+        : size_(transaction_hashes.size()) {
+      if (transaction_hashes.empty()) {
+        levels_.push_back({Sha3_256::makeHash(Blob(Blob::Bytes{}))});
+        return;
+      }
+
+      std::vector<Hash> leaves;
+      leaves.reserve(transaction_hashes.size());
+      for (const auto &hash : transaction_hashes) {
+        leaves.push_back(leafHash(hash));
+      }
+      levels_.push_back(std::move(leaves));
+      while (levels_.back().size() > 1) {
+        const auto &level = levels_.back();
+        std::vector<Hash> next;
+        next.reserve((level.size() + 1) / 2);
+        for (size_t i = 0; i + 1 < level.size(); i += 2) {
+          next.push_back(nodeHash(level[i], level[i + 1]));
+        }
+        if (level.size() % 2 == 1) {
+          next.push_back(level.back());
+        }
+        levels_.push_back(std::move(next));
+      }
+    }
+
+    const Hash &MerkleTree::root() const {
+      return levels_.back().front();
+    }
+
+    size_t MerkleTree::size() const {
+      return size_;
+    }
+
+    std::vector<Hash> MerkleTree::proof(size_t index) const {
+      std::vector<Hash> siblings;
+      for (size_t level = 0; level + 1 < levels_.size(); ++level) {
+        auto sibling = index ^ 1;
+        if (sibling < levels_[level].size()) {
+          siblings.push_back(levels_[level][sibling]);
+        }
+        index /= 2;
+      }
+      return siblings;
+    }
+
+    bool MerkleTree::verify(const Hash &transaction_hash,
+                            size_t index,
+                            size_t size,
+                            const std::vector<Hash> &siblings,
+                            const Hash &root) {
+      if (index >= size) {
+        return false;
+      }
+      auto node = leafHash(transaction_hash);
+      auto sibling = siblings.begin();
+      for (; size > 1; index /= 2, size = (size + 1) / 2) {
+        if ((index ^ 1) >= size) {
+          // the promoted last node
+          continue;
+        }
+        if (sibling == siblings.end()) {
+          return false;
+        }
+        node = index % 2 == 0 ? nodeHash(node, *sibling)
+                              : nodeHash(*sibling, node);
+        ++sibling;
+      }
+      return sibling == siblings.end() and node == root;
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
@@ -0,0 +1,63 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cryptography/crypto_provider/pipelined_signer.hpp"
+
+#include <algorithm>
+
+namespace shared_model {
+  namespace crypto {
+
+    PipelinedSigner::PipelinedSigner(PublicKey public_key,
+                                     SignFunction sign,
+                                     size_t depth)
+        : public_key_(std::move(public_key)), sign_(std::move(sign)) {
+      depth = std::max<size_t>(depth, 1);
+      workers_.reserve(depth);
+      for (size_t i = 0; i < depth; ++i) {
+        workers_.emplace_back([this] { run(); });
+      }
+    }
+
+    PipelinedSigner::~PipelinedSigner() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+      }
+      cv_.notify_all();
+      for (auto &worker : workers_) {
+        worker.join();
+      }
+    }
+
+    const PublicKey &PipelinedSigner::publicKey() const {
+      return public_key_;
+    }
+
+    void PipelinedSigner::sign(Blob blob, Callback callback) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        requests_.push_back(Request{std::move(blob), std::move(callback)});
+      }
+      cv_.notify_one();
+    }
+
+    void PipelinedSigner::run() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (true) {
+        cv_.wait(lock, [this] { return stopped_ or not requests_.empty(); });
+        if (requests_.empty()) {
+          return;
+        }
+        auto request = std::move(requests_.front());
+        requests_.pop_front();
+        lock.unlock();
+        request.callback(sign_(request.blob));
+        lock.lock();
+      }
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
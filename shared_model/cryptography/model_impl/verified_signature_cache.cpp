@@ -0,0 +1,69 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cryptography/verified_signature_cache.hpp"
+
+#include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
+#include "cryptography/public_key.hpp"
+#include "cryptography/signed.hpp"
+
+namespace {
+  /**
+   * Appends the bytes to the key after their length, so the same bytes split
+   * between the public key and the signature in another way give another key
+   */
+  void appendWithLength(std::string &key,
+                        const shared_model::crypto::Blob::Bytes &bytes) {
+    const auto size = static_cast<uint32_t>(bytes.size());
+    key.append(reinterpret_cast<const char *>(&size), sizeof(size));
+    key.append(bytes.begin(), bytes.end());
+  }
+}  // namespace
+
+namespace shared_model {
+  namespace crypto {
+
+    VerifiedSignatureCache::VerifiedSignatureCache(uint32_t capacity)
+        : signatures_(capacity, capacity - capacity / 4) {}
+
+    VerifiedSignatureCache &VerifiedSignatureCache::instance() {
+      static VerifiedSignatureCache cache;
+      return cache;
+    }
+
+    std::string VerifiedSignatureCache::digest(const Blob &source) {
+      const auto &bytes = source.blob();
+      return iroha::sha3_256(bytes.data(), bytes.size()).to_string();
+    }
+
+    bool VerifiedSignatureCache::contains(const std::string &digest,
+                                          const PublicKey &public_key,
+                                          const Signed &signed_data) const {
+      return static_cast<bool>(
+          signatures_.findItem(key(digest, public_key, signed_data)));
+    }
+
+    void VerifiedSignatureCache::insert(const std::string &digest,
+                                        const PublicKey &public_key,
+                                        const Signed &signed_data) {
+      signatures_.addItem(key(digest, public_key, signed_data), true);
+    }
+
+    std::string VerifiedSignatureCache::key(const std::string &digest,
+                                            const PublicKey &public_key,
+                                            const Signed &signed_data) {
+      const auto &pub = public_key.blob();
+      const auto &sig = signed_data.blob();
+      std::string key;
+      key.reserve(digest.size() + 2 * sizeof(uint32_t) + pub.size()
+                  + sig.size());
+      key.append(digest);
+      appendWithLength(key, pub);
+      appendWithLength(key, sig);
+      return key;
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
@@ -0,0 +1,44 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_SIGNATURE_BATCH_HPP
+#define IROHA_SHARED_MODEL_SIGNATURE_BATCH_HPP
+
+#include <vector>
+
+#include "cryptography/blob.hpp"
+#include "cryptography/public_key.hpp"
+#include "cryptography/signed.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /**
+     * Signature with the public key of its signatory
+     */
+    struct SignatureRef {
+      const Signed &signed_data;
+      const PublicKey &public_key;
+    };
+
+    /// signatures of the same data, which are verified together
+    using SignatureBatch = std::vector<SignatureRef>;
+
+    /**
+     * Signature of the data with the public key of its signatory
+     */
+    struct SignedMessageRef {
+      const Blob &source;
+      const Signed &signed_data;
+      const PublicKey &public_key;
+    };
+
+    /// signatures of different data, which are verified together
+    using SignedMessageBatch = std::vector<SignedMessageRef>;
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_SIGNATURE_BATCH_HPP
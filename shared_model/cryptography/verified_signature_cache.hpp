@@ -0,0 +1,68 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_VERIFIED_SIGNATURE_CACHE_HPP
+#define IROHA_SHARED_MODEL_VERIFIED_SIGNATURE_CACHE_HPP
+
+#include <string>
+
+#include "cache/sharded_cache.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    class Blob;
+    class PublicKey;
+    class Signed;
+
+    /**
+     * Bounded cache of the signatures which passed verification, keyed by
+     * the digest of the signed data, the public key and the signature, the
+     * last two with their lengths. The same signature is checked by Torii, by
+     * the ordering service and the MST of every peer which receives the
+     * transaction, and by the chain validation, so the node verifies it once
+     * and looks it up afterwards.
+     *
+     * Only valid signatures are stored, so a hit never accepts a signature
+     * which was not verified
+     */
+    class VerifiedSignatureCache {
+     public:
+      /// signatures kept by the cache of the process
+      static constexpr uint32_t kDefaultCapacity = 100000;
+
+      explicit VerifiedSignatureCache(uint32_t capacity = kDefaultCapacity);
+
+      /// @return the cache shared by all the verifications of the process
+      static VerifiedSignatureCache &instance();
+
+      /// @return the digest of the signed data, a part of the cache key
+      static std::string digest(const Blob &source);
+
+      /**
+       * @return true if the signature of the data with the given digest was
+       * verified
+       */
+      bool contains(const std::string &digest,
+                    const PublicKey &public_key,
+                    const Signed &signed_data) const;
+
+      /// remember the verified signature
+      void insert(const std::string &digest,
+                  const PublicKey &public_key,
+                  const Signed &signed_data);
+
+     private:
+      static std::string key(const std::string &digest,
+                             const PublicKey &public_key,
+                             const Signed &signed_data);
+
+      iroha::cache::ShardedCache<std::string, bool> signatures_;
+    };
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_VERIFIED_SIGNATURE_CACHE_HPP
@@ -0,0 +1,164 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_FLAT_COMMAND_HPP
+#define IROHA_SHARED_MODEL_FLAT_COMMAND_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <boost/utility/string_view.hpp>
+#include <boost/variant.hpp>
+#include "interfaces/permissions.hpp"
+
+namespace shared_model {
+  namespace interface {
+
+    /**
+     * Compact representation of the commands for the hot paths, which read
+     * a few fields of many commands, e.g. the block indexing. The fields are
+     * views of the transaction payload, so a flat command is valid as long
+     * as its transaction is. The public keys are hex strings and the amounts
+     * are decimal strings as they are in the payload.
+     */
+    namespace flat {
+
+      using View = boost::string_view;
+
+      struct AddAssetQuantity {
+        View asset_id;
+        View amount;
+      };
+
+      struct AddPeer {
+        View address;
+        View pubkey;
+        bool has_tls_certificate;
+        View tls_certificate;
+      };
+
+      struct AddSignatory {
+        View account_id;
+        View pubkey;
+      };
+
+      struct AppendRole {
+        View account_id;
+        View role_name;
+      };
+
+      struct CreateAccount {
+        View account_name;
+        View domain_id;
+        View pubkey;
+      };
+
+      struct CreateAsset {
+        View asset_name;
+        View domain_id;
+        uint32_t precision;
+      };
+
+      struct CreateDomain {
+        View domain_id;
+        View user_default_role;
+      };
+
+      struct CreateRole {
+        View role_name;
+        RolePermissionSet permissions;
+      };
+
+      struct DetachRole {
+        View account_id;
+        View role_name;
+      };
+
+      struct GrantPermission {
+        View account_id;
+        permissions::Grantable permission;
+      };
+
+      struct RemoveSignatory {
+        View account_id;
+        View pubkey;
+      };
+
+      struct RevokePermission {
+        View account_id;
+        permissions::Grantable permission;
+      };
+
+      struct SetAccountDetail {
+        View account_id;
+        View key;
+        View value;
+      };
+
+      struct SetQuorum {
+        View account_id;
+        uint32_t quorum;
+      };
+
+      struct SubtractAssetQuantity {
+        View asset_id;
+        View amount;
+      };
+
+      struct TransferAsset {
+        View src_account_id;
+        View dest_account_id;
+        View asset_id;
+        View description;
+        View amount;
+      };
+
+      struct RemovePeer {
+        View pubkey;
+      };
+
+      struct CompareAndSetAccountDetail {
+        View account_id;
+        View key;
+        View value;
+        bool has_old_value;
+        View old_value;
+      };
+
+      struct SetSettingValue {
+        View key;
+        View value;
+      };
+
+    }  // namespace flat
+
+    /// command of one of the flat types, blank if the command is not set
+    using FlatCommand = boost::variant<boost::blank,
+                                       flat::AddAssetQuantity,
+                                       flat::AddPeer,
+                                       flat::AddSignatory,
+                                       flat::AppendRole,
+                                       flat::CreateAccount,
+                                       flat::CreateAsset,
+                                       flat::CreateDomain,
+                                       flat::CreateRole,
+                                       flat::DetachRole,
+                                       flat::GrantPermission,
+                                       flat::RemoveSignatory,
+                                       flat::RevokePermission,
+                                       flat::SetAccountDetail,
+                                       flat::SetQuorum,
+                                       flat::SubtractAssetQuantity,
+                                       flat::TransferAsset,
+                                       flat::RemovePeer,
+                                       flat::CompareAndSetAccountDetail,
+                                       flat::SetSettingValue>;
+
+    using FlatCommandsType = std::vector<FlatCommand>;
+
+  }  // namespace interface
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_FLAT_COMMAND_HPP
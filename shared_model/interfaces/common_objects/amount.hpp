@@ -8,18 +8,35 @@
 
 #include "interfaces/base/model_primitive.hpp"
 
+#include <array>
+
+#include <boost/optional.hpp>
 #include "interfaces/common_objects/types.hpp"
 
 namespace shared_model {
   namespace interface {
 
     /**
-     * Representation of fixed point number
+     * Representation of fixed point number, which is an unsigned 256-bit
+     * integer of the units of its precision. The value is kept inline, so
+     * the amounts are copied and summed without the allocations.
      */
     class Amount final : public ModelPrimitive<Amount> {
      public:
+      /// number of the 64-bit words of the value
+      static constexpr size_t kWords = 4;
+      /// size of the binary encoding: the precision and the value
+      static constexpr size_t kEncodedSize = 1 + kWords * sizeof(uint64_t);
+
       explicit Amount(const std::string &amount);
 
+      /**
+       * Decode the amount from its binary representation
+       * @param encoded - bytes made by encode()
+       * @return the amount, none if the size does not match
+       */
+      static boost::optional<Amount> decode(const std::string &encoded);
+
       /**
        * Returns a value less than zero if Amount is negative, a value greater
        * than zero if Amount is positive, and zero if Amount is zero.
@@ -38,6 +55,26 @@ namespace shared_model {
        */
       std::string toStringRepr() const;
 
+      /**
+       * Binary representation of the amount: the precision byte followed by
+       * the value in big-endian order
+       * @return kEncodedSize bytes
+       */
+      std::string encode() const;
+
+      /**
+       * Sum of the amounts in the greater precision of them
+       * @return the sum, none if it overflows or an amount is invalid
+       */
+      boost::optional<Amount> add(const Amount &rhs) const;
+
+      /**
+       * Difference of the amounts in the greater precision of them
+       * @return the difference, none if it is negative or an amount is
+       * invalid
+       */
+      boost::optional<Amount> subtract(const Amount &rhs) const;
+
       /**
        * Checks equality of objects inside
        * @param rhs - other wrapped value
@@ -52,9 +89,18 @@ namespace shared_model {
       std::string toString() const override;
 
      private:
-      struct Impl;
+      /// value words, the least significant first
+      using Words = std::array<uint64_t, kWords>;
+
+      Amount(Words value, types::PrecisionType precision);
+
+      /// @return value in the given precision, none if it overflows
+      boost::optional<Words> rescaled(types::PrecisionType precision) const;
 
-      const std::shared_ptr<const Impl> impl_;
+      Words value_;
+      types::PrecisionType precision_;
+      /// false if the amount was parsed from an invalid string
+      bool valid_;
     };
   }  // namespace interface
 }  // namespace shared_model
@@ -5,7 +5,9 @@
 
 #include "interfaces/common_objects/amount.hpp"
 
-#include <regex>
+#include <algorithm>
+#include <iomanip>
+#include <limits>
 
 #include <boost/multiprecision/cpp_int.hpp>
 #include "utils/string_builder.hpp"
@@ -15,69 +17,190 @@ static const char *kDigits = "0123456789";
 
 using namespace shared_model::interface;
 
-struct Amount::Impl {
-  Impl(const std::string &amount)
-      : string_repr_("NaN"), precision_(0), multiprecision_repr_(0) {
-    const auto dot_pos = amount.find_first_not_of(kDigits);
-    if (dot_pos != std::string::npos) {
-      // fail, if:
-      if (amount[dot_pos]
-              != kDecimalSeparator  // string contains an invalid character
-          or amount.find_first_not_of(kDigits, dot_pos + 1)
-              != std::string::npos  // string contains more than one non-digit
-          or dot_pos == 0  // dot is the first symbol (for compatibility)
-          or dot_pos == amount.size() - 1  // dot is the last symbol
-      ) {
-        return;
-      }
-      std::string amount_without_dot = amount.substr(0, dot_pos);
-      amount_without_dot.append(amount.substr(dot_pos + 1));
-      precision_ = amount.size() - dot_pos - 1;
-      multiprecision_repr_ =
-          boost::multiprecision::uint256_t(amount_without_dot);
-    } else {
-      multiprecision_repr_ = boost::multiprecision::uint256_t(amount);
-    }
+namespace {
+  /// throws on the overflow, so the amounts which do not fit are rejected
+  using Number = boost::multiprecision::checked_uint256_t;
+
+  constexpr size_t kWordBits = std::numeric_limits<uint64_t>::digits;
 
-    // make the string representation
-    std::stringstream ss;
-    ss << std::setw(precision_ + 1) << std::setfill('0')
-       << std::setiosflags(std::ios::right) << multiprecision_repr_;
-    string_repr_ = ss.str();
-    if (precision_ > 0) {
-      const auto dot_pos = string_repr_.end() - precision_;
-      string_repr_.insert(dot_pos, '.');
+  template <typename Words>
+  Number toNumber(const Words &words) {
+    Number number = 0;
+    for (auto word = words.rbegin(); word != words.rend(); ++word) {
+      number <<= kWordBits;
+      number |= *word;
     }
+    return number;
   }
 
-  std::string string_repr_;
-  interface::types::PrecisionType precision_;
-  boost::multiprecision::uint256_t multiprecision_repr_;
-};
+  template <typename Words>
+  Words toWords(Number number) {
+    Words words;
+    for (auto &word : words) {
+      word = static_cast<uint64_t>(number
+                                   & std::numeric_limits<uint64_t>::max());
+      number >>= kWordBits;
+    }
+    return words;
+  }
+}  // namespace
 
 Amount::Amount(const std::string &amount)
-    : impl_(std::make_shared<Impl>(amount)) {}
+    : value_{}, precision_(0), valid_(false) {
+  if (amount.empty()) {
+    return;
+  }
+  types::PrecisionType precision = 0;
+  std::string digits = amount;
+  const auto dot_pos = amount.find_first_not_of(kDigits);
+  if (dot_pos != std::string::npos) {
+    // fail, if:
+    if (amount[dot_pos]
+            != kDecimalSeparator  // string contains an invalid character
+        or amount.find_first_not_of(kDigits, dot_pos + 1)
+            != std::string::npos  // string contains more than one non-digit
+        or dot_pos == 0  // dot is the first symbol (for compatibility)
+        or dot_pos == amount.size() - 1  // dot is the last symbol
+    ) {
+      return;
+    }
+    digits = amount.substr(0, dot_pos);
+    digits.append(amount.substr(dot_pos + 1));
+    precision = amount.size() - dot_pos - 1;
+  }
+  try {
+    value_ = toWords<Words>(Number(digits));
+  } catch (const std::exception &) {
+    // the value does not fit
+    return;
+  }
+  precision_ = precision;
+  valid_ = true;
+}
+
+Amount::Amount(Words value, types::PrecisionType precision)
+    : value_(value), precision_(precision), valid_(true) {}
+
+boost::optional<Amount> Amount::decode(const std::string &encoded) {
+  if (encoded.size() != kEncodedSize) {
+    return boost::none;
+  }
+  Words value;
+  auto byte = encoded.begin() + 1;
+  for (auto word = value.rbegin(); word != value.rend(); ++word) {
+    *word = 0;
+    for (size_t i = 0; i < sizeof(uint64_t); ++i) {
+      *word = (*word << 8) | static_cast<uint8_t>(*byte++);
+    }
+  }
+  return Amount(value, static_cast<uint8_t>(encoded[0]));
+}
 
 int Amount::sign() const {
-  return impl_->multiprecision_repr_.sign();
+  return valid_ and std::any_of(value_.begin(),
+                                value_.end(),
+                                [](auto word) { return word != 0; });
 }
 
 types::PrecisionType Amount::precision() const {
-  return impl_->precision_;
+  return precision_;
 }
 
 std::string Amount::toStringRepr() const {
-  return impl_->string_repr_;
+  if (not valid_) {
+    return "NaN";
+  }
+  std::stringstream ss;
+  ss << std::setw(precision_ + 1) << std::setfill('0')
+     << std::setiosflags(std::ios::right) << toNumber(value_);
+  auto string_repr = ss.str();
+  if (precision_ > 0) {
+    const auto dot_pos = string_repr.end() - precision_;
+    string_repr.insert(dot_pos, kDecimalSeparator);
+  }
+  return string_repr;
+}
+
+std::string Amount::encode() const {
+  std::string encoded;
+  encoded.reserve(kEncodedSize);
+  encoded.push_back(static_cast<char>(precision_));
+  for (auto word = value_.rbegin(); word != value_.rend(); ++word) {
+    for (size_t shift = kWordBits; shift > 0; shift -= 8) {
+      encoded.push_back(static_cast<char>(*word >> (shift - 8)));
+    }
+  }
+  return encoded;
+}
+
+boost::optional<Amount::Words> Amount::rescaled(
+    types::PrecisionType precision) const {
+  if (precision == precision_) {
+    return value_;
+  }
+  try {
+    return toWords<Words>(
+        toNumber(value_)
+        * boost::multiprecision::pow(Number(10), precision - precision_));
+  } catch (const std::exception &) {
+    return boost::none;
+  }
+}
+
+boost::optional<Amount> Amount::add(const Amount &rhs) const {
+  if (not valid_ or not rhs.valid_) {
+    return boost::none;
+  }
+  const auto precision = std::max(precision_, rhs.precision_);
+  auto lhs_value = rescaled(precision);
+  auto rhs_value = rhs.rescaled(precision);
+  if (not lhs_value or not rhs_value) {
+    return boost::none;
+  }
+  Words sum;
+  uint64_t carry = 0;
+  for (size_t i = 0; i < kWords; ++i) {
+    const auto partial = (*lhs_value)[i] + (*rhs_value)[i];
+    sum[i] = partial + carry;
+    carry = partial < (*lhs_value)[i] or sum[i] < partial;
+  }
+  if (carry != 0) {
+    return boost::none;
+  }
+  return Amount(sum, precision);
+}
+
+boost::optional<Amount> Amount::subtract(const Amount &rhs) const {
+  if (not valid_ or not rhs.valid_) {
+    return boost::none;
+  }
+  const auto precision = std::max(precision_, rhs.precision_);
+  auto lhs_value = rescaled(precision);
+  auto rhs_value = rhs.rescaled(precision);
+  if (not lhs_value or not rhs_value) {
+    return boost::none;
+  }
+  Words difference;
+  uint64_t borrow = 0;
+  for (size_t i = 0; i < kWords; ++i) {
+    const auto partial = (*lhs_value)[i] - (*rhs_value)[i];
+    difference[i] = partial - borrow;
+    borrow = (*lhs_value)[i] < (*rhs_value)[i] or partial < borrow;
+  }
+  if (borrow != 0) {
+    return boost::none;
+  }
+  return Amount(difference, precision);
 }
 
 bool Amount::operator==(const ModelType &rhs) const {
-  return impl_->precision_ == rhs.impl_->precision_
-      and impl_->multiprecision_repr_ == rhs.impl_->multiprecision_repr_;
+  return valid_ == rhs.valid_ and precision_ == rhs.precision_
+      and value_ == rhs.value_;
 }
 
 std::string Amount::toString() const {
   return detail::PrettyStringBuilder()
       .init("Amount")
-      .append(impl_->string_repr_)
+      .append(toStringRepr())
       .finalize();
 }
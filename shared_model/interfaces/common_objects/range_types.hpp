@@ -7,6 +7,7 @@
 #define IROHA_SHARED_MODEL_RANGE_TYPES_HPP
 
 #include <boost/range/any_range.hpp>
+#include "interfaces/common_objects/strided_span.hpp"
 #include "interfaces/common_objects/types.hpp"
 
 namespace shared_model {
@@ -27,6 +28,8 @@ namespace shared_model {
           boost::any_range<Transaction,
                            boost::random_access_traversal_tag,
                            const Transaction &>;
+      /// Type of transactions stored contiguously
+      using TransactionsSpanType = StridedSpan<Transaction>;
       using AccountAssetCollectionType =
           boost::any_range<AccountAsset,
                            boost::random_access_traversal_tag,
@@ -0,0 +1,121 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_STRIDED_SPAN_HPP
+#define IROHA_SHARED_MODEL_STRIDED_SPAN_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <boost/iterator/iterator_facade.hpp>
+
+namespace shared_model {
+  namespace interface {
+
+    /**
+     * Non-owning view of the interface objects, which are stored in a
+     * contiguous array of their implementation. Unlike the type-erased
+     * ranges, its iteration is not virtual and is inlined.
+     * @tparam T - interface type of the elements
+     */
+    template <typename T>
+    class StridedSpan {
+     public:
+      class Iterator : public boost::iterator_facade<
+                           Iterator,
+                           const T,
+                           boost::random_access_traversal_tag> {
+       public:
+        Iterator() = default;
+
+       private:
+        friend class boost::iterator_core_access;
+        friend class StridedSpan;
+
+        Iterator(const char *element, size_t stride)
+            : element_(element), stride_(stride) {}
+
+        const T &dereference() const {
+          return *reinterpret_cast<const T *>(element_);
+        }
+
+        bool equal(const Iterator &other) const {
+          return element_ == other.element_;
+        }
+
+        void increment() {
+          element_ += stride_;
+        }
+
+        void decrement() {
+          element_ -= stride_;
+        }
+
+        void advance(std::ptrdiff_t n) {
+          element_ += n * static_cast<std::ptrdiff_t>(stride_);
+        }
+
+        std::ptrdiff_t distance_to(const Iterator &other) const {
+          return (other.element_ - element_)
+              / static_cast<std::ptrdiff_t>(stride_);
+        }
+
+        const char *element_ = nullptr;
+        size_t stride_ = 0;
+      };
+
+      using iterator = Iterator;
+      using const_iterator = Iterator;
+
+      StridedSpan() = default;
+
+      /**
+       * @param elements - implementation objects, which outlive the span
+       * @tparam Impl - implementation type of the elements
+       */
+      template <typename Impl>
+      explicit StridedSpan(const std::vector<Impl> &elements)
+          : data_(elements.empty()
+                      ? nullptr
+                      : reinterpret_cast<const char *>(
+                            static_cast<const T *>(elements.data()))),
+            stride_(sizeof(Impl)),
+            size_(elements.size()) {
+        static_assert(std::is_base_of<T, Impl>::value,
+                      "elements must implement the interface");
+      }
+
+      Iterator begin() const {
+        return Iterator(data_, stride_);
+      }
+
+      Iterator end() const {
+        return Iterator(data_ + size_ * stride_, stride_);
+      }
+
+      const T &operator[](size_t index) const {
+        return *reinterpret_cast<const T *>(data_ + index * stride_);
+      }
+
+      size_t size() const {
+        return size_;
+      }
+
+      bool empty() const {
+        return size_ == 0;
+      }
+
+     private:
+      /// interface subobject of the first element
+      const char *data_ = nullptr;
+      size_t stride_ = 0;
+      size_t size_ = 0;
+    };
+
+  }  // namespace interface
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_STRIDED_SPAN_HPP
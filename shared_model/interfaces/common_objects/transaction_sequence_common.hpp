@@ -28,6 +28,15 @@ namespace shared_model {
 
       using BatchesCollectionType =
           std::vector<std::shared_ptr<TransactionBatch>>;
+
+      /// half-open range of the indices of the transactions of a batch
+      struct BatchBoundary {
+        size_t begin;
+        size_t end;
+      };
+
+      /// boundaries of the consecutive batches of a transaction sequence
+      using BatchBoundariesType = std::vector<BatchBoundary>;
     }  // namespace types
   }    // namespace interface
 }  // namespace shared_model
@@ -26,6 +26,23 @@ namespace shared_model {
       virtual iroha::expected::Result<std::unique_ptr<Interface>, Error> build(
           Transport transport) const = 0;
 
+      /**
+       * Build the object from the serialized transport. Implementations may
+       * parse it in the way which is cheaper to allocate and free
+       * @param serialized - serialized transport
+       * @return the object, or an error if the data cannot be parsed or the
+       * object is invalid
+       */
+      virtual iroha::expected::Result<std::unique_ptr<Interface>, Error> build(
+          const std::string &serialized) const {
+        Transport transport;
+        if (not transport.ParseFromString(serialized)) {
+          return iroha::expected::makeError(
+              Error{types::HashType{}, "Deserialization failed"});
+        }
+        return build(std::move(transport));
+      }
+
       virtual ~AbstractTransportFactory() = default;
     };
 
@@ -34,6 +34,11 @@ namespace shared_model {
        */
       virtual types::TransactionsCollectionType transactions() const = 0;
 
+      /**
+       * @return the transactions, which are iterated without the type erasure
+       */
+      virtual types::TransactionsSpanType transactionsSpan() const = 0;
+
       /**
        * @return collection of rejected transactions' hashes
        */
@@ -8,6 +8,7 @@
 
 #include "cryptography/default_hash_provider.hpp"
 #include "interfaces/base/model_primitive.hpp"
+#include "interfaces/common_objects/transaction_sequence_common.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "interfaces/transaction.hpp"
 
@@ -21,6 +22,18 @@ namespace shared_model {
        */
       virtual types::TransactionsCollectionType transactions() const = 0;
 
+      /**
+       * @return the transactions, which are iterated without the type erasure
+       */
+      virtual types::TransactionsSpanType transactionsSpan() const = 0;
+
+      /**
+       * @return index ranges of the batches of the transactions. The proposals
+       * which are passed through the pipeline find them once, so that the
+       * transactions are not parsed into batches at each stage
+       */
+      virtual types::BatchBoundariesType batchBoundaries() const;
+
       /**
        * @return the height
        */
@@ -6,7 +6,7 @@
 #ifndef IROHA_TRANSACTION_BATCH_HELPERS_HPP
 #define IROHA_TRANSACTION_BATCH_HELPERS_HPP
 
-#include <sstream>
+#include <boost/range/size.hpp>
 
 #include "cryptography/hash.hpp"
 
@@ -28,11 +28,18 @@ namespace shared_model {
       template <typename Collection>
       static types::HashType calculateReducedBatchHash(
           const Collection &reduced_hashes) {
-        std::stringstream concatenated_hash;
+        crypto::Blob::Bytes concatenated_hash;
+        auto hashes = boost::size(reduced_hashes);
+        if (hashes != 0) {
+          concatenated_hash.reserve(hashes
+                                    * (*std::begin(reduced_hashes)).size());
+        }
         for (const auto &hash : reduced_hashes) {
-          concatenated_hash << hash.hex();
+          concatenated_hash.insert(concatenated_hash.end(),
+                                   hash.blob().begin(),
+                                   hash.blob().end());
         }
-        return types::HashType::fromHexString(concatenated_hash.str());
+        return types::HashType(crypto::Blob(std::move(concatenated_hash)));
       }
     };
   }  // namespace interface
@@ -27,6 +27,13 @@ namespace shared_model {
       virtual std::vector<types::SharedTxsCollectionType> parseBatches(
           const types::SharedTxsCollectionType &txs) const noexcept = 0;
 
+      /**
+       * Find the batches in a single pass without creating the ranges
+       * @return index ranges of the batches in txs
+       */
+      virtual types::BatchBoundariesType batchBoundaries(
+          types::TransactionsCollectionType txs) const noexcept = 0;
+
       virtual ~TransactionBatchParser() = default;
     };
 
@@ -61,5 +61,23 @@ namespace shared_model {
       return parseBatchesImpl(txs | boost::adaptors::indirected, txs);
     }
 
+    types::BatchBoundariesType TransactionBatchParserImpl::batchBoundaries(
+        types::TransactionsCollectionType txs) const noexcept {
+      types::BatchBoundariesType boundaries;
+      boost::optional<std::shared_ptr<BatchMeta>> batch_meta;
+      size_t index = 0;
+      for (const auto &tx : txs) {
+        auto meta = tx.batchMeta();
+        // a transaction continues the batch if both have the same meta
+        if (boundaries.empty() or not(meta and batch_meta)
+            or **meta != **batch_meta) {
+          boundaries.push_back({index, index});
+          batch_meta = std::move(meta);
+        }
+        boundaries.back().end = ++index;
+      }
+      return boundaries;
+    }
+
   }  // namespace interface
 }  // namespace shared_model
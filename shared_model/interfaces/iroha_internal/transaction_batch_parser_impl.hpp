@@ -21,6 +21,9 @@ namespace shared_model {
 
       std::vector<types::SharedTxsCollectionType> parseBatches(
           const types::SharedTxsCollectionType &txs) const noexcept override;
+
+      types::BatchBoundariesType batchBoundaries(
+          types::TransactionsCollectionType txs) const noexcept override;
     };
   }  // namespace interface
 }  // namespace shared_model
@@ -5,6 +5,7 @@
 
 #include "interfaces/iroha_internal/transaction_sequence_factory.hpp"
 
+#include <algorithm>
 #include <unordered_map>
 
 #include "interfaces/iroha_internal/batch_meta.hpp"
@@ -36,20 +37,19 @@ namespace shared_model {
         const validation::TransactionsCollectionValidator<TransactionValidator>
             &validator,
         const FieldValidator &field_validator) {
-      std::unordered_map<interface::types::HashType,
-                         std::vector<std::shared_ptr<Transaction>>,
-                         interface::types::HashType::Hasher>
-          extracted_batches;
+      // batch candidates in the order of their first transactions, the
+      // transactions without batch meta form their own candidates
+      std::vector<std::shared_ptr<BatchMeta>> metas;
+      std::vector<types::SharedTxsCollectionType> candidates;
+      // reduced hashes listed in the meta of a candidate to the candidate, so
+      // a transaction finds its batch without concatenating the hashes
+      std::unordered_multimap<types::HashType,
+                              size_t,
+                              types::HashType::Hasher>
+          slots;
 
       const auto &transaction_validator = validator.getTransactionValidator();
 
-      types::BatchesCollectionType batches;
-      auto insert_batch =
-          [&batches](iroha::expected::Value<std::unique_ptr<TransactionBatch>>
-                         &&value) {
-            batches.push_back(std::move(value.value));
-          };
-
       validation::Answer result;
       if (transactions.empty()) {
         result.addReason(std::make_pair(
@@ -77,29 +77,44 @@ namespace shared_model {
           continue;
         }
 
-        // if transaction is valid, try to form batch out of it
-        if (auto meta = tx->batchMeta()) {
-          auto hashes = meta.get()->reducedHashes();
-          auto batch_hash =
-              TransactionBatchHelpers::calculateReducedBatchHash(hashes);
-          extracted_batches[batch_hash].push_back(tx);
-        } else {
-          batch_factory->createTransactionBatch(tx).match(
-              insert_batch, [&tx, &result](const auto &err) {
-                result.addReason(std::make_pair(
-                    std::string("Error in transaction with reduced hash: ")
-                        + tx->reducedHash().hex(),
-                    std::vector<std::string>{err.error}));
+        // if transaction is valid, add it to the candidate of its batch
+        auto meta = tx->batchMeta();
+        if (meta) {
+          auto range = slots.equal_range(tx->reducedHash());
+          auto slot = std::find_if(
+              range.first, range.second, [&](const auto &slot) {
+                return *metas[slot.second] == **meta;
               });
+          if (slot != range.second) {
+            candidates[slot->second].push_back(tx);
+            continue;
+          }
+          for (const auto &hash : meta.get()->reducedHashes()) {
+            slots.emplace(hash, candidates.size());
+          }
         }
+        metas.push_back(meta ? std::move(*meta) : nullptr);
+        candidates.push_back({tx});
       }
 
-      for (const auto &it : extracted_batches) {
-        batch_factory->createTransactionBatch(it.second).match(
-            insert_batch, [&it, &result](const auto &err) {
-              result.addReason(std::make_pair(
-                  it.first.toString(), std::vector<std::string>{err.error}));
-            });
+      types::BatchesCollectionType batches;
+      batches.reserve(candidates.size());
+      for (size_t i = 0; i < candidates.size(); ++i) {
+        batch_factory->createTransactionBatch(candidates[i])
+            .match(
+                [&batches](auto &&value) {
+                  batches.push_back(std::move(value.value));
+                },
+                [&](const auto &err) {
+                  auto name = metas[i]
+                      ? TransactionBatchHelpers::calculateReducedBatchHash(
+                            metas[i]->reducedHashes())
+                            .toString()
+                      : std::string("Error in transaction with reduced hash: ")
+                          + candidates[i].front()->reducedHash().hex();
+                  result.addReason(std::make_pair(
+                      std::move(name), std::vector<std::string>{err.error}));
+                });
       }
 
       if (result.hasErrors()) {
@@ -31,6 +31,19 @@ namespace shared_model {
           types::TimestampType created_time,
           TransactionsCollectionType transactions) = 0;
 
+      /**
+       * Create the proposal with the transactions and the creation time of
+       * the given one for another height. Implementations may share the
+       * transactions and the serialized form of the given proposal
+       * @param proposal - proposal to take the contents from
+       * @param height - height of the created proposal
+       */
+      virtual std::unique_ptr<Proposal> unsafeCreateProposalAtHeight(
+          const Proposal &proposal, types::HeightType height) {
+        return unsafeCreateProposal(
+            height, proposal.createdTime(), proposal.transactions());
+      }
+
       virtual ~UnsafeProposalFactory() = default;
     };
   }  // namespace interface
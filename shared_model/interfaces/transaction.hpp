@@ -8,6 +8,8 @@
 
 #include "common/cloneable.hpp"
 #include "interfaces/base/signable.hpp"
+#include "interfaces/commands/flat_command.hpp"
+#include "interfaces/common_objects/strided_span.hpp"
 #include "interfaces/common_objects/types.hpp"
 
 namespace shared_model {
@@ -43,6 +45,20 @@ namespace shared_model {
        */
       virtual CommandsType commands() const = 0;
 
+      /// Type of commands stored contiguously
+      using CommandsSpanType = StridedSpan<Command>;
+
+      /**
+       * @return the commands, which are iterated without the type erasure
+       */
+      virtual CommandsSpanType commandsSpan() const = 0;
+
+      /**
+       * @return flat representation of the commands, which is built once
+       * and is valid as long as the transaction is
+       */
+      virtual const FlatCommandsType &flatCommands() const = 0;
+
       /**
        * @return object payload (everything except signatures)
        */
@@ -6,79 +6,67 @@
 #ifndef IROHA_VARIANT_DESERIALIZER_HPP
 #define IROHA_VARIANT_DESERIALIZER_HPP
 
-#include <boost/serialization/variant.hpp>
+#include <cstdlib>
+#include <utility>
 
-#define NORETURN [[noreturn]]
+#include <boost/assert.hpp>
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/size.hpp>
+#include <boost/serialization/variant.hpp>
 
 namespace shared_model {
   namespace detail {
     /**
      * Helper for variant deserialization
-     * Iterate through type list to use type specified by type index in list
+     * Construct the type specified by type index in list with a table of the
+     * constructors of the types, which is generated at compile time
      * @tparam S list of types
      */
     template <class S>
     struct variant_impl {
-      /**
-       * Dummy deserializer for empty list
-       */
-      struct load_null {
-        /**
-         * Dummy deserializer
-         * @tparam V variant type for deserialization
-         * @tparam Archive container type
-         */
-        template <class V, class Archive>
-        NORETURN static V invoke(Archive &&, int) {
-          BOOST_ASSERT_MSG(false, "Required type not found");
-          std::abort();
-        }
-      };
-
-      /**
-       * Deserializer implementation
-       */
-      struct load_impl {
-        /**
-         * Deserialize container in variant using type in list by specified
-         * index
-         * If type selector is 0, head type is required type, and it is used
-         * Otherwise call helper without front element in type list
-         * @tparam V variant type for deserialization
-         * @tparam Archive container type
-         * @param ar container to be deserialized
-         * @param which type index in list
-         * @param v result variant
-         */
-        template <class V, class Archive>
-        static V invoke(Archive &&ar, int which) {
-          if (which == 0) {
-            using head_type = typename boost::mpl::front<S>::type;
-            return head_type(std::forward<Archive>(ar));
-          } else {
-            using type = typename boost::mpl::pop_front<S>::type;
-            return variant_impl<type>::template load<V>(
-                std::forward<Archive>(ar), which - 1);
-          }
-        }
-      };
-
       /**
        * Deserialize container in variant using type in list by specified index
-       * Choose dummy or concrete deserializer depending on type list size
+       * The index selects the constructor in the table, so the construction
+       * does not depend on the position of the type in list
        * @tparam V variant type for deserialization
        * @tparam Archive container type
        * @param ar container to be deserialized
        * @param which type index in list
-       * @param v result variant
+       * @return result variant
        */
       template <class V, class Archive>
       static V load(Archive &&ar, int which) {
-        using typex =
-            typename boost::mpl::eval_if<boost::mpl::empty<S>,
-                                         boost::mpl::identity<load_null>,
-                                         boost::mpl::identity<load_impl>>::type;
-        return typex::template invoke<V>(std::forward<Archive>(ar), which);
+        return loadByIndex<V>(
+            std::forward<Archive>(ar),
+            which,
+            std::make_index_sequence<boost::mpl::size<S>::value>{});
+      }
+
+     private:
+      /**
+       * Construct the type of the index in list from container
+       * @tparam V variant type for deserialization
+       * @tparam Archive container type
+       * @tparam Index type index in list
+       */
+      template <class V, class Archive, size_t Index>
+      static V construct(Archive &&ar) {
+        using type = typename boost::mpl::at_c<S, Index>::type;
+        return type(std::forward<Archive>(ar));
+      }
+
+      template <class V, class Archive, size_t... Indices>
+      static V loadByIndex(Archive &&ar,
+                           int which,
+                           std::index_sequence<Indices...>) {
+        static_assert(sizeof...(Indices) > 0, "Type list is empty");
+        static constexpr V (*kConstructors[])(Archive &&) = {
+            &construct<V, Archive, Indices>...};
+        if (which < 0 or static_cast<size_t>(which) >= sizeof...(Indices)) {
+          BOOST_ASSERT_MSG(false, "Required type not found");
+          std::abort();
+        }
+        return kConstructors[which](std::forward<Archive>(ar));
       }
     };
   }  // namespace detail
@@ -26,7 +26,7 @@ namespace shared_model {
      protected:
       void validateTransactions(
           ReasonsGroupType &reason,
-          const interface::types::TransactionsCollectionType &transactions,
+          const interface::types::TransactionsSpanType &transactions,
           interface::types::TimestampType current_timestamp) const {
         auto answer = transactions_collection_validator_.validate(
             transactions, current_timestamp);
@@ -62,7 +62,8 @@ namespace shared_model {
         field_validator_.validateHeight(reason, cont.height());
         std::forward<Validator>(validator)(reason, cont);
 
-        validateTransactions(reason, cont.transactions(), cont.createdTime());
+        validateTransactions(
+            reason, cont.transactionsSpan(), cont.createdTime());
         if (not reason.second.empty()) {
           answer.addReason(std::move(reason));
         }
@@ -0,0 +1,131 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validators/field_matchers.hpp"
+
+#include <algorithm>
+
+namespace {
+  // the character classes do not depend on the locale, unlike <cctype>
+  bool isLower(char c) {
+    return c >= 'a' and c <= 'z';
+  }
+
+  bool isAlpha(char c) {
+    return isLower(c) or (c >= 'A' and c <= 'Z');
+  }
+
+  bool isDigit(char c) {
+    return c >= '0' and c <= '9';
+  }
+
+  bool isAlnum(char c) {
+    return isAlpha(c) or isDigit(c);
+  }
+
+  /// @return true if str is 1 to max_size characters matching predicate
+  template <typename Predicate>
+  bool isRepeated(boost::string_view str,
+                  size_t max_size,
+                  Predicate predicate) {
+    return not str.empty() and str.size() <= max_size
+        and std::all_of(str.begin(), str.end(), predicate);
+  }
+
+  /// [a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?
+  bool isLabel(boost::string_view str) {
+    return not str.empty() and str.size() <= 63 and isAlpha(str.front())
+        and isAlnum(str.back())
+        and std::all_of(str.begin(), str.end(), [](char c) {
+              return isAlnum(c) or c == '-';
+            });
+  }
+
+  /// decimal without leading zeros from 0 to max
+  bool isDecimal(boost::string_view str, unsigned max) {
+    if (str.empty() or str.size() > 5
+        or not std::all_of(str.begin(), str.end(), isDigit)
+        or (str.size() > 1 and str.front() == '0')) {
+      return false;
+    }
+    unsigned value = 0;
+    for (auto c : str) {
+      value = value * 10 + (c - '0');
+    }
+    return value <= max;
+  }
+
+  /// @return true if str is a name, the separator and a domain
+  bool isNameAtDomain(boost::string_view str, char separator) {
+    auto position = str.find(separator);
+    return position != boost::string_view::npos
+        and shared_model::validation::matchers::isName(
+                str.substr(0, position))
+        and shared_model::validation::matchers::isDomain(
+                str.substr(position + 1));
+  }
+}  // namespace
+
+namespace shared_model {
+  namespace validation {
+    namespace matchers {
+
+      bool isName(boost::string_view str) {
+        return isRepeated(str, 32, [](char c) {
+          return isLower(c) or isDigit(c) or c == '_';
+        });
+      }
+
+      bool isDetailKey(boost::string_view str) {
+        return isRepeated(
+            str, 64, [](char c) { return isAlnum(c) or c == '_'; });
+      }
+
+      bool isDomain(boost::string_view str) {
+        while (true) {
+          auto position = str.find('.');
+          if (not isLabel(str.substr(0, position))) {
+            return false;
+          }
+          if (position == boost::string_view::npos) {
+            return true;
+          }
+          str.remove_prefix(position + 1);
+        }
+      }
+
+      bool isIpV4(boost::string_view str) {
+        for (int octet = 0; octet < 3; ++octet) {
+          auto position = str.find('.');
+          if (position == boost::string_view::npos
+              or not isDecimal(str.substr(0, position), 255)) {
+            return false;
+          }
+          str.remove_prefix(position + 1);
+        }
+        return isDecimal(str, 255);
+      }
+
+      bool isPeerAddress(boost::string_view str) {
+        auto position = str.find(':');
+        if (position == boost::string_view::npos) {
+          return false;
+        }
+        auto host = str.substr(0, position);
+        return (isIpV4(host) or isDomain(host))
+            and isDecimal(str.substr(position + 1), 65535);
+      }
+
+      bool isAccountId(boost::string_view str) {
+        return isNameAtDomain(str, '@');
+      }
+
+      bool isAssetId(boost::string_view str) {
+        return isNameAtDomain(str, '#');
+      }
+
+    }  // namespace matchers
+  }    // namespace validation
+}  // namespace shared_model
@@ -0,0 +1,50 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_FIELD_MATCHERS_HPP
+#define IROHA_FIELD_MATCHERS_HPP
+
+#include <boost/utility/string_view.hpp>
+
+namespace shared_model {
+  namespace validation {
+
+    /**
+     * Hand-written matchers of the grammars of the fields. Each of them
+     * accepts exactly the strings which match the regex of FieldValidator
+     * named in its description, without allocations and backtracking.
+     */
+    namespace matchers {
+
+      /// [a-z_0-9]{1,32}, the name of an account or an asset, or a role
+      bool isName(boost::string_view str);
+
+      /// [A-Za-z0-9_]{1,64}
+      bool isDetailKey(boost::string_view str);
+
+      /**
+       * dot separated labels of a hostname following RFC1035 and RFC1123:
+       * ([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?\.)*
+       * [a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?
+       */
+      bool isDomain(boost::string_view str);
+
+      /// four dot separated decimals from 0 to 255 without leading zeros
+      bool isIpV4(boost::string_view str);
+
+      /// host:port, the host is IPv4 or a domain, the port is from 0 to 65535
+      bool isPeerAddress(boost::string_view str);
+
+      /// name@domain
+      bool isAccountId(boost::string_view str);
+
+      /// name#domain
+      bool isAssetId(boost::string_view str);
+
+    }  // namespace matchers
+  }    // namespace validation
+}  // namespace shared_model
+
+#endif  // IROHA_FIELD_MATCHERS_HPP
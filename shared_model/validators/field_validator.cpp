@@ -7,7 +7,6 @@
 
 #include <limits>
 
-#include <boost/algorithm/string_regex.hpp>
 #include <boost/format.hpp>
 #include "common/bind.hpp"
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
@@ -18,7 +17,7 @@
 #include "interfaces/queries/asset_pagination_meta.hpp"
 #include "interfaces/queries/query_payload_meta.hpp"
 #include "interfaces/queries/tx_pagination_meta.hpp"
-#include "validators/field_validator.hpp"
+#include "validators/field_matchers.hpp"
 
 // TODO: 15.02.18 nickaleks Change structure to compositional IR-978
 
@@ -56,16 +55,6 @@ namespace shared_model {
     /// limit for the set account detail size in bytes
     const size_t FieldValidator::value_size = 4 * 1024 * 1024;
 
-    const std::regex FieldValidator::account_name_regex_(account_name_pattern_);
-    const std::regex FieldValidator::asset_name_regex_(asset_name_pattern_);
-    const std::regex FieldValidator::domain_regex_(domain_pattern_);
-    const std::regex FieldValidator::ip_v4_regex_(ip_v4_pattern_);
-    const std::regex FieldValidator::peer_address_regex_(peer_address_pattern_);
-    const std::regex FieldValidator::account_id_regex_(account_id_pattern_);
-    const std::regex FieldValidator::asset_id_regex_(asset_id_pattern_);
-    const std::regex FieldValidator::detail_key_regex_(detail_key_pattern_);
-    const std::regex FieldValidator::role_id_regex_(role_id_pattern_);
-
     FieldValidator::FieldValidator(std::shared_ptr<ValidatorsConfig> config,
                                    time_t future_gap,
                                    TimeFunction time_provider)
@@ -76,7 +65,7 @@ namespace shared_model {
     void FieldValidator::validateAccountId(
         ReasonsGroupType &reason,
         const interface::types::AccountIdType &account_id) const {
-      if (not std::regex_match(account_id, account_id_regex_)) {
+      if (not matchers::isAccountId(account_id)) {
         auto message =
             (boost::format("Wrongly formed account_id, passed value: '%s'. "
                            "Field should match regex '%s'")
@@ -89,7 +78,7 @@ namespace shared_model {
     void FieldValidator::validateAssetId(
         ReasonsGroupType &reason,
         const interface::types::AssetIdType &asset_id) const {
-      if (not std::regex_match(asset_id, asset_id_regex_)) {
+      if (not matchers::isAssetId(asset_id)) {
         auto message = (boost::format("Wrongly formed asset_id, passed value: "
                                       "'%s'. Field should match regex '%s'")
                         % asset_id % asset_id_pattern_)
@@ -124,7 +113,7 @@ namespace shared_model {
     void FieldValidator::validatePeerAddress(
         ReasonsGroupType &reason,
         const interface::types::AddressType &address) const {
-      if (not std::regex_match(address, peer_address_regex_)) {
+      if (not matchers::isPeerAddress(address)) {
         auto message =
             (boost::format("Wrongly formed peer address, passed value: '%s'. "
                            "Field should have a valid 'host:port' format where "
@@ -139,7 +128,7 @@ namespace shared_model {
     void FieldValidator::validateRoleId(
         ReasonsGroupType &reason,
         const interface::types::RoleIdType &role_id) const {
-      if (not std::regex_match(role_id, role_id_regex_)) {
+      if (not matchers::isName(role_id)) {
         auto message = (boost::format("Wrongly formed role_id, passed value: "
                                       "'%s'. Field should match regex '%s'")
                         % role_id % role_id_pattern_)
@@ -151,7 +140,7 @@ namespace shared_model {
     void FieldValidator::validateAccountName(
         ReasonsGroupType &reason,
         const interface::types::AccountNameType &account_name) const {
-      if (not std::regex_match(account_name, account_name_regex_)) {
+      if (not matchers::isName(account_name)) {
         auto message =
             (boost::format("Wrongly formed account_name, passed value: '%s'. "
                            "Field should match regex '%s'")
@@ -164,7 +153,7 @@ namespace shared_model {
     void FieldValidator::validateDomainId(
         ReasonsGroupType &reason,
         const interface::types::DomainIdType &domain_id) const {
-      if (not std::regex_match(domain_id, domain_regex_)) {
+      if (not matchers::isDomain(domain_id)) {
         auto message = (boost::format("Wrongly formed domain_id, passed value: "
                                       "'%s'. Field should match regex '%s'")
                         % domain_id % domain_pattern_)
@@ -176,7 +165,7 @@ namespace shared_model {
     void FieldValidator::validateAssetName(
         ReasonsGroupType &reason,
         const interface::types::AssetNameType &asset_name) const {
-      if (not std::regex_match(asset_name, asset_name_regex_)) {
+      if (not matchers::isName(asset_name)) {
         auto message =
             (boost::format("Wrongly formed asset_name, passed value: '%s'. "
                            "Field should match regex '%s'")
@@ -189,7 +178,7 @@ namespace shared_model {
     void FieldValidator::validateAccountDetailKey(
         ReasonsGroupType &reason,
         const interface::types::AccountDetailKeyType &key) const {
-      if (not std::regex_match(key, detail_key_regex_)) {
+      if (not matchers::isDetailKey(key)) {
         auto message = (boost::format("Wrongly formed key, passed value: '%s'. "
                                       "Field should match regex '%s'")
                         % key % detail_key_pattern_)
@@ -266,7 +255,7 @@ namespace shared_model {
     void FieldValidator::validateCreatorAccountId(
         ReasonsGroupType &reason,
         const interface::types::AccountIdType &account_id) const {
-      if (not std::regex_match(account_id, account_id_regex_)) {
+      if (not matchers::isAccountId(account_id)) {
         auto message =
             (boost::format("Wrongly formed creator_account_id, passed value: "
                            "'%s'. Field should match regex '%s'")
@@ -9,6 +9,7 @@
 
 #include <boost/format.hpp>
 #include <boost/range/adaptor/indirected.hpp>
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
 #include "interfaces/iroha_internal/transaction_batch_impl.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
@@ -18,6 +19,52 @@
 #include "validators/transaction_validator.hpp"
 #include "validators/transactions_collection/batch_order_validator.hpp"
 
+namespace {
+  /// transactions of a signature batch, which is verified on one thread
+  constexpr size_t kSignatureBatchTransactions = 64;
+
+  /**
+   * Verify the signatures of the transactions in batches, after which the
+   * validation of every transaction finds them in the verified signature
+   * cache. The batches are verified concurrently with the parallel_for, all
+   * the signatures are verified in one batch if it is empty
+   */
+  void verifySignatures(
+      const std::vector<const shared_model::interface::Transaction *>
+          &transactions,
+      const shared_model::validation::ParallelFor &parallel_for) {
+    const size_t batch_transactions = parallel_for
+        ? kSignatureBatchTransactions
+        : std::max<size_t>(transactions.size(), 1);
+    auto verify = [&](size_t batch_index) {
+      shared_model::crypto::SignedMessageBatch batch;
+      const auto begin = batch_index * batch_transactions;
+      const auto end =
+          std::min(begin + batch_transactions, transactions.size());
+      for (auto i = begin; i < end; ++i) {
+        for (const auto &signature : transactions[i]->signatures()) {
+          batch.push_back(shared_model::crypto::SignedMessageRef{
+              transactions[i]->payload(),
+              signature.signedData(),
+              signature.publicKey()});
+        }
+      }
+      if (batch.size() > 1) {
+        shared_model::crypto::CryptoVerifier<>::verifyBatch(batch);
+      }
+    };
+    const auto batches =
+        (transactions.size() + batch_transactions - 1) / batch_transactions;
+    if (parallel_for) {
+      parallel_for(batches, verify);
+    } else {
+      for (size_t i = 0; i < batches; ++i) {
+        verify(i);
+      }
+    }
+  }
+}  // namespace
+
 namespace shared_model {
   namespace validation {
 
@@ -29,14 +76,14 @@ namespace shared_model {
             TransactionValidator transactions_validator)
         : transaction_validator_(std::move(transactions_validator)),
           batch_validator_(std::make_shared<BatchValidator>(config)),
-          txs_duplicates_allowed_(config->txs_duplicates_allowed) {}
+          txs_duplicates_allowed_(config->txs_duplicates_allowed),
+          parallel_for_(config->parallel_for) {}
 
     template <typename TransactionValidator, bool CollectionCanBeEmpty>
-    template <typename Validator>
+    template <typename Collection, typename Validator>
     Answer TransactionsCollectionValidator<TransactionValidator,
                                            CollectionCanBeEmpty>::
-        validateImpl(const interface::types::TransactionsForwardCollectionType
-                         &transactions,
+        validateImpl(const Collection &transactions,
                      Validator &&validator) const {
       Answer res;
       ReasonsGroupType reason;
@@ -52,12 +99,26 @@ namespace shared_model {
         return res;
       }
 
+      std::vector<const interface::Transaction *> txs;
       for (const auto &tx : transactions) {
-        auto answer = std::forward<Validator>(validator)(tx);
-        if (answer.hasErrors()) {
-          auto message =
-              (boost::format("Tx %s : %s") % tx.hash().hex() % answer.reason())
-                  .str();
+        txs.push_back(&tx);
+      }
+      verifySignatures(txs, parallel_for_);
+
+      std::vector<Answer> answers(txs.size());
+      auto validate_tx = [&](size_t i) { answers[i] = validator(*txs[i]); };
+      if (parallel_for_) {
+        parallel_for_(txs.size(), validate_tx);
+      } else {
+        for (size_t i = 0; i < txs.size(); ++i) {
+          validate_tx(i);
+        }
+      }
+      for (size_t i = 0; i < txs.size(); ++i) {
+        if (answers[i].hasErrors()) {
+          auto message = (boost::format("Tx %s : %s") % txs[i]->hash().hex()
+                          % answers[i].reason())
+                             .str();
           reason.second.push_back(message);
         }
       }
@@ -79,7 +140,8 @@ namespace shared_model {
       }
 
       interface::TransactionBatchParserImpl batch_parser;
-      auto batches = batch_parser.parseBatches(transactions);
+      auto batches = batch_parser.parseBatches(
+          interface::types::TransactionsForwardCollectionType(transactions));
       for (auto &batch : batches) {
         interface::types::SharedTxsCollectionType batch_transactions;
         for (auto &tx : batch) {
@@ -139,6 +201,17 @@ namespace shared_model {
                       current_timestamp);
     }
 
+    template <typename TransactionValidator, bool CollectionCanBeEmpty>
+    Answer TransactionsCollectionValidator<TransactionValidator,
+                                           CollectionCanBeEmpty>::
+        validate(const interface::types::TransactionsSpanType &transactions,
+                 interface::types::TimestampType current_timestamp) const {
+      return validateImpl(
+          transactions, [this, current_timestamp](const auto &tx) {
+            return transaction_validator_.validate(tx, current_timestamp);
+          });
+    }
+
     template <typename TransactionValidator, bool CollectionCanBeEmpty>
     const TransactionValidator &TransactionsCollectionValidator<
         TransactionValidator,
@@ -6,6 +6,7 @@
 #ifndef IROHA_TRANSACTIONS_COLLECTION_VALIDATOR_HPP
 #define IROHA_TRANSACTIONS_COLLECTION_VALIDATOR_HPP
 
+#include "interfaces/common_objects/range_types.hpp"
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "validators/answer.hpp"
@@ -15,8 +16,9 @@ namespace shared_model {
   namespace validation {
 
     /**
-     * Validator of transaction's collection, this is not fair implementation
-     * now, it always returns empty answer
+     * Validator of transaction's collection. The transactions are validated
+     * concurrently with the parallel_for of the config if it has one, the
+     * errors are reported in the order of the transactions anyway
      */
     template <typename TransactionValidator, bool CollectionCanBeEmpty = false>
     class TransactionsCollectionValidator {
@@ -25,13 +27,12 @@ namespace shared_model {
       std::shared_ptr<AbstractValidator<interface::TransactionBatch>>
           batch_validator_;
       bool txs_duplicates_allowed_;
+      ParallelFor parallel_for_;
 
      private:
-      template <typename Validator>
-      Answer validateImpl(
-          const interface::types::TransactionsForwardCollectionType
-              &transactions,
-          Validator &&validator) const;
+      template <typename Collection, typename Validator>
+      Answer validateImpl(const Collection &transactions,
+                          Validator &&validator) const;
 
       explicit TransactionsCollectionValidator(
           std::shared_ptr<ValidatorsConfig> config,
@@ -64,6 +65,11 @@ namespace shared_model {
           const interface::types::SharedTxsCollectionType &transactions,
           interface::types::TimestampType current_timestamp) const;
 
+      /// validate the contiguous transactions of a block or a proposal
+      Answer validate(
+          const interface::types::TransactionsSpanType &transactions,
+          interface::types::TimestampType current_timestamp) const;
+
       const TransactionValidator &getTransactionValidator() const;
     };
 
@@ -5,7 +5,7 @@
 
 #include "validators/validators_common.hpp"
 
-#include <regex>
+#include <algorithm>
 
 namespace shared_model {
   namespace validation {
@@ -13,15 +13,19 @@ namespace shared_model {
     ValidatorsConfig::ValidatorsConfig(uint64_t max_batch_size,
                                        std::shared_ptr<const Settings> settings,
                                        bool partial_ordered_batches_are_valid,
-                                       bool txs_duplicates_allowed)
+                                       bool txs_duplicates_allowed,
+                                       ParallelFor parallel_for)
         : max_batch_size(max_batch_size),
           partial_ordered_batches_are_valid(partial_ordered_batches_are_valid),
           settings(settings),
-          txs_duplicates_allowed(txs_duplicates_allowed) {}
+          txs_duplicates_allowed(txs_duplicates_allowed),
+          parallel_for(std::move(parallel_for)) {}
 
     bool validateHexString(const std::string &str) {
-      static const std::regex hex_regex{R"([0-9a-fA-F]*)"};
-      return std::regex_match(str, hex_regex);
+      return std::all_of(str.begin(), str.end(), [](char c) {
+        return (c >= '0' and c <= '9') or (c >= 'a' and c <= 'f')
+            or (c >= 'A' and c <= 'F');
+      });
     }
 
   }  // namespace validation
@@ -6,12 +6,18 @@
 #ifndef IROHA_VALIDATORS_COMMON_HPP
 #define IROHA_VALIDATORS_COMMON_HPP
 
+#include <functional>
 #include <memory>
 #include <string>
 #include "validators/settings.hpp"
 
 namespace shared_model {
   namespace validation {
+    /// calls the function for every index in [0, size), possibly on several
+    /// threads at once
+    using ParallelFor =
+        std::function<void(size_t, const std::function<void(size_t)> &)>;
+
     /**
      * A struct that contains configuration parameters for all validators.
      * A validator may read only specific fields.
@@ -21,7 +27,8 @@ namespace shared_model {
           uint64_t max_batch_size,
           std::shared_ptr<const Settings> settings = getDefaultSettings(),
           bool partial_ordered_batches_are_valid = false,
-          bool txs_duplicates_allowed = false);
+          bool txs_duplicates_allowed = false,
+          ParallelFor parallel_for = nullptr);
 
       /// Maximum allowed amount of transactions within a batch
       const uint64_t max_batch_size;
@@ -41,6 +48,11 @@ namespace shared_model {
        * - BlockLoader
        */
       const bool txs_duplicates_allowed;
+
+      /// Validates the transactions of a collection concurrently, they are
+      /// validated on the calling thread if it is empty. Used for the
+      /// proposals and the blocks received from the other peers
+      const ParallelFor parallel_for;
     };
 
     /**
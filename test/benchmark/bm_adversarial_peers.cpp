@@ -0,0 +1,336 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/optional.hpp>
+#include "backend/protobuf/transaction.hpp"
+#include "builders/protobuf/unsigned_proto.hpp"
+#include "consensus/yac/vote_message.hpp"
+#include "datetime/time.hpp"
+#include "framework/common_constants.hpp"
+#include "framework/integration_framework/fake_peer/behaviour/honest.hpp"
+#include "framework/integration_framework/integration_test_framework.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace common_constants;
+using integration_framework::fake_peer::FakePeer;
+using iroha::consensus::yac::YacHash;
+using Clock = std::chrono::steady_clock;
+
+const auto kProposalSize = 100;
+const auto kTransactionsPerIteration = 100;
+/// period of the messages of every misbehaving peer
+const std::chrono::microseconds kFloodPeriod(500);
+/// how many rounds back the stale votes are
+const auto kStaleRounds = 5;
+/// transactions of a single oversized SendBatches request
+const auto kOversizedRequestSize = 20 * kProposalSize;
+
+/**
+ * Misbehaviour of the flooding peers:
+ * - kNone: the peers are honest, the baseline
+ * - kValidVotes: the valid votes of the current round are repeated
+ * - kStaleVotes: the votes for the rounds long committed
+ * - kConflictingVotes: the votes for other hashes in the current round
+ * - kOversizedBatches: SendBatches requests many times over the proposal
+ *   size, of the transactions which fail the stateful validation
+ * - kAll: all of the above in turn
+ */
+enum Attack {
+  kNone,
+  kValidVotes,
+  kStaleVotes,
+  kConflictingVotes,
+  kOversizedBatches,
+  kAll
+};
+
+namespace {
+  /// CPU time of the process
+  std::chrono::microseconds processCpuTime() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    auto time = [](const timeval &tv) {
+      return std::chrono::seconds(tv.tv_sec)
+          + std::chrono::microseconds(tv.tv_usec);
+    };
+    return time(usage.ru_utime) + time(usage.ru_stime);
+  }
+
+  /// CPU time of the calling thread
+  std::chrono::microseconds threadCpuTime() {
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::seconds(ts.tv_sec)
+        + std::chrono::nanoseconds(ts.tv_nsec));
+  }
+
+  /**
+   * Peer which votes honestly and floods the real peer from its own thread.
+   * The round of the flood follows the last vote received from the real
+   * peer, so the votes target the rounds the real peer is busy with
+   */
+  class Flooder {
+   public:
+    Flooder(std::shared_ptr<FakePeer> peer,
+            Attack attack,
+            std::vector<std::shared_ptr<shared_model::interface::Transaction>>
+                oversized_request)
+        : peer_(std::move(peer)),
+          attack_(attack),
+          oversized_request_(std::move(oversized_request)) {
+      subscription_ = peer_->getYacStatesObservable().subscribe(
+          [this](const auto &message) {
+            if (message and not message->empty()) {
+              std::lock_guard<std::mutex> lock(mutex_);
+              last_hash_ = message->front().hash;
+            }
+          });
+      thread_ = std::thread([this] { run(); });
+    }
+
+    ~Flooder() {
+      stop();
+    }
+
+    void stop() {
+      stopped_ = true;
+      if (thread_.joinable()) {
+        thread_.join();
+      }
+      subscription_.unsubscribe();
+    }
+
+    size_t sent() const {
+      return sent_;
+    }
+
+    /// CPU time spent by the flood, which is not the real peer's
+    std::chrono::microseconds cpuTime() const {
+      return std::chrono::microseconds(cpu_time_us_.load());
+    }
+
+   private:
+    void run() {
+      auto cpu_begin = threadCpuTime();
+      size_t step = 0;
+      while (not stopped_) {
+        std::this_thread::sleep_for(kFloodPeriod);
+        // the attacks of kAll take turns
+        auto kind = attack_ == kAll
+            ? static_cast<Attack>(kValidVotes
+                                  + step++ % (kAll - kValidVotes))
+            : attack_;
+        if (kind == kOversizedBatches) {
+          peer_->proposeTransactions(oversized_request_);
+          ++sent_;
+          continue;
+        }
+        boost::optional<YacHash> hash;
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          hash = last_hash_;
+        }
+        if (not hash) {
+          continue;
+        }
+        if (kind == kStaleVotes) {
+          auto &round = hash->vote_round;
+          round.block_round -= std::min<decltype(round.block_round)>(
+              round.block_round, kStaleRounds);
+        } else if (kind == kConflictingVotes) {
+          auto conflict = "conflict" + std::to_string(sent_);
+          hash = YacHash(hash->vote_round, conflict, conflict);
+        }
+        peer_->sendYacState({peer_->makeVote(*hash)});
+        ++sent_;
+      }
+      cpu_time_us_ = (threadCpuTime() - cpu_begin).count();
+    }
+
+    std::shared_ptr<FakePeer> peer_;
+    const Attack attack_;
+    const std::vector<std::shared_ptr<shared_model::interface::Transaction>>
+        oversized_request_;
+
+    std::mutex mutex_;
+    boost::optional<YacHash> last_hash_;
+    rxcpp::composite_subscription subscription_;
+
+    std::atomic_bool stopped_{false};
+    std::atomic<size_t> sent_{0};
+    std::atomic<int64_t> cpu_time_us_{0};
+    std::thread thread_;
+  };
+
+  /**
+   * Transactions of a well formed request which are valid statelessly, but
+   * their creator does not exist, so they never get into a block
+   */
+  std::vector<std::shared_ptr<shared_model::interface::Transaction>>
+  makeOversizedRequest() {
+    std::vector<std::shared_ptr<shared_model::interface::Transaction>> txs;
+    txs.reserve(kOversizedRequestSize);
+    for (int i = 0; i < kOversizedRequestSize; ++i) {
+      txs.push_back(std::make_shared<shared_model::proto::Transaction>(
+          TestUnsignedTransactionBuilder()
+              .creatorAccountId("flood@" + kDomain)
+              .createdTime(iroha::time::now())
+              .setAccountDetail(kAdminId, "flood", std::to_string(i))
+              .quorum(1)
+              .build()
+              .signAndAddSignature(kUserKeypair)
+              .finish()));
+    }
+    return txs;
+  }
+}  // namespace
+
+/**
+ * This benchmark runs a network of one real peer and fake peers, where
+ * f = (N - 1) / 3 of the fake peers misbehave while voting honestly, so
+ * every round still commits. It measures how much the adversarial load
+ * costs the real peer in the commit latency and in the CPU time, so the
+ * robustness of YAC and the ordering can be compared before and after a
+ * change. The CPU time is of the whole process without the flooding
+ * threads, so it includes the gRPC servers of the fake peers, which are the
+ * same for every attack.
+ *
+ * The arguments are the number of peers and the attack.
+ * @param state
+ */
+static void BM_AdversarialPeers(benchmark::State &state) {
+  const auto num_peers = static_cast<size_t>(state.range(0));
+  const auto attack = static_cast<Attack>(state.range(1));
+
+  integration_framework::IntegrationTestFramework itf(
+      kProposalSize,
+      boost::none,
+      true,
+      false,
+      (boost::filesystem::temp_directory_path()
+       / boost::filesystem::unique_path())
+          .string(),
+      std::chrono::hours(1),
+      std::chrono::hours(1));
+  itf.initPipeline(kAdminKeypair);
+  auto fake_peers = itf.addFakePeers(num_peers - 1);
+  for (auto &peer : fake_peers) {
+    peer->setBehaviour(
+        std::make_shared<integration_framework::fake_peer::HonestBehaviour>());
+  }
+  itf.setGenesisBlock(itf.defaultBlock()).subscribeQueuesAndRun();
+
+  std::vector<std::unique_ptr<Flooder>> flooders;
+  if (attack != kNone) {
+    auto oversized_request = makeOversizedRequest();
+    const auto num_adversaries = (num_peers - 1) / 3;
+    for (size_t i = 0; i < num_adversaries; ++i) {
+      flooders.push_back(std::make_unique<Flooder>(
+          fake_peers[i], attack, oversized_request));
+    }
+  }
+
+  // the details make the hashes of the transactions different
+  size_t tx_counter = 0;
+  auto make_tx = [&tx_counter] {
+    return TestUnsignedTransactionBuilder()
+        .creatorAccountId(kAdminId)
+        .createdTime(iroha::time::now())
+        .setAccountDetail(kAdminId, "bench", std::to_string(tx_counter++))
+        .quorum(1)
+        .build()
+        .signAndAddSignature(kAdminKeypair)
+        .finish();
+  };
+
+  // commit latency of every transaction, in milliseconds
+  std::vector<double> latencies;
+  size_t committed = 0;
+  auto wall_begin = Clock::now();
+  auto cpu_begin = processCpuTime();
+  while (state.KeepRunning()) {
+    auto sent_at = Clock::now();
+    for (int i = 0; i < kTransactionsPerIteration; ++i) {
+      itf.sendTx(make_tx());
+    }
+
+    // the transactions may be spread among several rounds
+    size_t pending = kTransactionsPerIteration;
+    while (pending > 0) {
+      itf.checkBlock([&](const auto &block) {
+        auto size = std::min(block->transactions().size(), pending);
+        std::chrono::duration<double, std::milli> latency =
+            Clock::now() - sent_at;
+        latencies.insert(latencies.end(), size, latency.count());
+        pending -= size;
+      });
+    }
+    committed += kTransactionsPerIteration;
+  }
+
+  size_t flood_messages = 0;
+  auto cpu_time = processCpuTime() - cpu_begin;
+  for (auto &flooder : flooders) {
+    flooder->stop();
+    flood_messages += flooder->sent();
+    cpu_time -= flooder->cpuTime();
+  }
+  std::chrono::duration<double> wall_time = Clock::now() - wall_begin;
+  itf.done();
+
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&latencies](double p) {
+    if (latencies.empty()) {
+      return 0.;
+    }
+    return latencies[std::min(latencies.size() - 1,
+                              static_cast<size_t>(p * latencies.size()))];
+  };
+  std::chrono::duration<double, std::milli> cpu_ms = cpu_time;
+  state.counters["tx/s"] =
+      benchmark::Counter(committed, benchmark::Counter::kIsRate);
+  state.counters["p50_ms"] = percentile(.5);
+  state.counters["p99_ms"] = percentile(.99);
+  state.counters["cpu_ms/tx"] = committed ? cpu_ms.count() / committed : 0.;
+  state.counters["cpu_cores"] =
+      wall_time.count() > 0 ? cpu_ms.count() / 1000 / wall_time.count() : 0.;
+  state.counters["flood/s"] =
+      benchmark::Counter(flood_messages, benchmark::Counter::kIsRate);
+}
+
+static void AdversarialPeersArguments(benchmark::internal::Benchmark *b) {
+  for (auto peers : {4, 7}) {
+    for (auto attack : {kNone,
+                        kValidVotes,
+                        kStaleVotes,
+                        kConflictingVotes,
+                        kOversizedBatches,
+                        kAll}) {
+      b->Args({peers, attack});
+    }
+  }
+}
+
+BENCHMARK(BM_AdversarialPeers)
+    ->Apply(AdversarialPeersArguments)
+    ->ArgNames({"peers", "attack"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
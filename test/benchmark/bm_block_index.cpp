@@ -0,0 +1,103 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Every committed block is indexed in the database by the transaction
+ * hashes, statuses, creators and the account assets of the transfers. The
+ * purpose of this benchmark is to measure the time of indexing a single
+ * block depending on the number of its transactions.
+ *
+ * The argument of the benchmark is the number of transactions in the block.
+ * A PostgreSQL database is required, its credentials are taken from the
+ * environment as in the integration tests.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <soci/soci.h>
+#include "ametsuchi/impl/postgres_block_index.hpp"
+#include "ametsuchi/impl/postgres_indexer.hpp"
+#include "datetime/time.hpp"
+#include "framework/test_db_manager.hpp"
+#include "framework/test_logger.hpp"
+#include "logger/dummy_logger.hpp"
+#include "logger/logger_manager.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using iroha::integration_framework::TestDbManager;
+
+class BlockIndexBenchmark : public benchmark::Fixture {
+ public:
+  void SetUp(benchmark::State &st) override {
+    auto db_manager = TestDbManager::createWithRandomDbName(
+        1, getTestLoggerManager()->getChild("TestDbManager"));
+    if (auto error = iroha::expected::resultToOptionalError(db_manager)) {
+      st.SkipWithError(error->c_str());
+      return;
+    }
+    db_manager_ =
+        std::move(iroha::expected::resultToOptionalValue(std::move(db_manager))
+                      .value());
+    sql_ = db_manager_->getSession();
+
+    std::vector<shared_model::proto::Transaction> txs;
+    for (int i = 0; i < st.range(0); i++) {
+      txs.push_back(
+          TestTransactionBuilder()
+              .creatorAccountId("player" + std::to_string(i) + "@one")
+              .createdTime(iroha::time::now() + i)
+              .quorum(1)
+              .transferAsset("player" + std::to_string(i) + "@one",
+                             "player@two",
+                             "coin#one",
+                             "",
+                             "5.00")
+              .build());
+    }
+    block_ = createBlock(txs, 1);
+  }
+
+  void TearDown(benchmark::State &st) override {
+    block_.reset();
+    sql_.reset();
+    db_manager_.reset();
+  }
+
+  std::unique_ptr<TestDbManager> db_manager_;
+  std::unique_ptr<soci::session> sql_;
+  std::shared_ptr<const shared_model::interface::Block> block_;
+};
+
+/**
+ * Benchmark indexing of a block, which is rolled back after each iteration
+ */
+BENCHMARK_DEFINE_F(BlockIndexBenchmark, IndexBlock)(benchmark::State &st) {
+  if (not sql_) {
+    return;
+  }
+  iroha::ametsuchi::PostgresBlockIndex block_index(
+      std::make_unique<iroha::ametsuchi::PostgresIndexer>(*sql_),
+      logger::getDummyLoggerPtr());
+  while (st.KeepRunning()) {
+    st.PauseTiming();
+    *sql_ << "BEGIN";
+    st.ResumeTiming();
+
+    block_index.index(*block_);
+
+    st.PauseTiming();
+    *sql_ << "ROLLBACK";
+    st.ResumeTiming();
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+BENCHMARK_REGISTER_F(BlockIndexBenchmark, IndexBlock)
+    ->RangeMultiplier(10)
+    ->Range(10, 10000)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
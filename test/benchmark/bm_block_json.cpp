@@ -0,0 +1,75 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * The blocks of the legacy JSON block storage are parsed on start. The
+ * purpose of this benchmark is to compare the generic JSON parser of
+ * protobuf with the single pass parser of shared_model::proto::parseJson.
+ *
+ * The argument of the benchmarks is the number of transactions in the block.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <google/protobuf/util/json_util.h>
+#include "backend/protobuf/json_proto_reader.hpp"
+#include "datetime/time.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+namespace {
+
+  /// number of commands in a single transaction
+  constexpr int kCommands = 5;
+
+  /// @return JSON of a block with the given number of transactions
+  std::string blockJson(size_t transactions) {
+    TestTransactionBuilder builder;
+    auto base_tx = builder.createdTime(iroha::time::now()).quorum(1);
+    for (int i = 0; i < kCommands; ++i) {
+      base_tx.transferAsset("player@one", "player@two", "coin", "", "5.00");
+    }
+    std::vector<shared_model::proto::Transaction> txs;
+    for (size_t i = 0; i < transactions; ++i) {
+      txs.push_back(base_tx.build());
+    }
+
+    iroha::protocol::Block block;
+    *block.mutable_block_v1() = TestBlockBuilder()
+                                    .createdTime(iroha::time::now())
+                                    .height(1)
+                                    .transactions(txs)
+                                    .build()
+                                    .getTransport();
+    std::string json;
+    google::protobuf::util::MessageToJsonString(block, &json);
+    return json;
+  }
+
+  void BM_JsonStringToMessage(benchmark::State &state) {
+    const auto json = blockJson(state.range(0));
+    for (auto _ : state) {
+      iroha::protocol::Block block;
+      benchmark::DoNotOptimize(
+          google::protobuf::util::JsonStringToMessage(json, &block));
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+  }
+
+  void BM_ParseJson(benchmark::State &state) {
+    const auto json = blockJson(state.range(0));
+    for (auto _ : state) {
+      iroha::protocol::Block block;
+      benchmark::DoNotOptimize(shared_model::proto::parseJson(json, block));
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+  }
+
+}  // namespace
+
+BENCHMARK(BM_JsonStringToMessage)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BM_ParseJson)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,139 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * On start the ledger state is restored by reading every block of the block
+ * storage. The purpose of this benchmark is to compare the time of reading
+ * the whole chain from the flat file block storage in the legacy JSON and in
+ * the binary block file formats.
+ *
+ * The argument of the benchmarks is the number of blocks in the chain; the
+ * largest chain of 1M blocks takes several minutes to prepare and can be
+ * skipped with --benchmark_filter.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <boost/filesystem.hpp>
+#include <google/protobuf/util/json_util.h>
+#include "ametsuchi/impl/block_file_format.hpp"
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "ametsuchi/impl/flat_file_block_storage.hpp"
+#include "backend/protobuf/proto_block_json_converter.hpp"
+#include "common/byteutils.hpp"
+#include "datetime/time.hpp"
+#include "logger/dummy_logger.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+/// number of commands in a single transaction
+constexpr int number_of_commands = 5;
+
+/// number of transactions in a single block
+constexpr int number_of_txs = 10;
+
+class BlockStorageBenchmark : public benchmark::Fixture {
+ public:
+  const std::string block_store_path =
+      (boost::filesystem::temp_directory_path()
+       / boost::filesystem::unique_path())
+          .string();
+
+  /// template of the stored blocks, which differ in height only
+  iroha::protocol::Block block;
+
+  void SetUp(benchmark::State &st) override {
+    TestTransactionBuilder txbuilder;
+    auto base_tx = txbuilder.createdTime(iroha::time::now()).quorum(1);
+    for (int i = 0; i < number_of_commands; i++) {
+      base_tx.transferAsset("player@one", "player@two", "coin", "", "5.00");
+    }
+
+    std::vector<shared_model::proto::Transaction> txs;
+    for (int i = 0; i < number_of_txs; i++) {
+      txs.push_back(base_tx.build());
+    }
+
+    *block.mutable_block_v1() = TestBlockBuilder()
+                                    .createdTime(iroha::time::now())
+                                    .height(1)
+                                    .transactions(txs)
+                                    .build()
+                                    .getTransport();
+  }
+
+  void TearDown(benchmark::State &st) override {
+    boost::filesystem::remove_all(block_store_path);
+  }
+
+  /**
+   * Fill the flat file storage with the blocks
+   * @param encode - block file of the protobuf block
+   */
+  template <typename Encoder>
+  void prepareStorage(size_t blocks_number, Encoder &&encode) {
+    auto flat_file = std::move(*iroha::ametsuchi::FlatFile::create(
+        block_store_path, logger::getDummyLoggerPtr()));
+    for (size_t height = 1; height <= blocks_number; ++height) {
+      block.mutable_block_v1()->mutable_payload()->set_height(height);
+      flat_file->add(height, encode(block));
+    }
+  }
+
+  /**
+   * Read all blocks of the prepared storage as it is done on restore
+   */
+  void restore(benchmark::State &st) {
+    while (st.KeepRunning()) {
+      auto flat_file = std::move(*iroha::ametsuchi::FlatFile::create(
+          block_store_path, logger::getDummyLoggerPtr()));
+      iroha::ametsuchi::FlatFileBlockStorage storage(
+          std::move(flat_file),
+          std::make_shared<shared_model::proto::ProtoBlockJsonConverter>(),
+          logger::getDummyLoggerPtr());
+      storage.forEach([](const auto &block) {
+        for (const auto &tx : block->transactions()) {
+          benchmark::DoNotOptimize(tx.commands());
+        }
+      });
+    }
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+  }
+};
+
+/**
+ * Benchmark reading of the blocks in the legacy JSON format
+ */
+BENCHMARK_DEFINE_F(BlockStorageBenchmark, JsonRestore)(benchmark::State &st) {
+  prepareStorage(st.range(0), [](const auto &block) {
+    std::string json;
+    google::protobuf::util::MessageToJsonString(block, &json);
+    return iroha::stringToBytes(json);
+  });
+  restore(st);
+}
+
+/**
+ * Benchmark reading of the blocks in the binary format
+ */
+BENCHMARK_DEFINE_F(BlockStorageBenchmark, BinaryRestore)
+(benchmark::State &st) {
+  prepareStorage(st.range(0), [](const auto &block) {
+    return iroha::ametsuchi::block_file_format::encode(
+        iroha::stringToBytes(block.block_v1().SerializeAsString()));
+  });
+  restore(st);
+}
+
+BENCHMARK_REGISTER_F(BlockStorageBenchmark, JsonRestore)
+    ->RangeMultiplier(100)
+    ->Range(100, 1000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(BlockStorageBenchmark, BinaryRestore)
+    ->RangeMultiplier(100)
+    ->Range(100, 1000000)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
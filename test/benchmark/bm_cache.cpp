@@ -0,0 +1,83 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Runtime and transaction presence caches are accessed by every Torii and
+ * ordering thread. The purpose of this benchmark is to compare the FIFO
+ * cache with a single lock and the sharded CLOCK cache on a mix of lookups
+ * and insertions, with the key space exceeding the cache limits.
+ *
+ * The benchmarks are run with 1 to 8 threads sharing the cache.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "cache/cache.hpp"
+#include "cache/sharded_cache.hpp"
+#include "cryptography/hash.hpp"
+
+namespace {
+  using Key = shared_model::crypto::Hash;
+  using Value = std::shared_ptr<int>;
+
+  /// limits of the benchmarked caches
+  constexpr uint32_t kHigh = 20000;
+  constexpr uint32_t kLow = 10000;
+
+  /// number of distinct keys accessed by the benchmarks
+  constexpr size_t kKeys = 40000;
+
+  /// every n-th access is an insertion, the rest are lookups
+  constexpr size_t kInsertionPeriod = 8;
+
+  const std::vector<Key> &keys() {
+    static const std::vector<Key> keys = [] {
+      std::vector<Key> keys;
+      keys.reserve(kKeys);
+      for (size_t i = 0; i < kKeys; ++i) {
+        keys.emplace_back(std::to_string(i));
+      }
+      return keys;
+    }();
+    return keys;
+  }
+
+  template <typename CacheType>
+  void accessCache(benchmark::State &state) {
+    static std::unique_ptr<CacheType> cache;
+    if (state.thread_index == 0) {
+      cache = std::make_unique<CacheType>(kHigh, kLow);
+    }
+    const auto &all_keys = keys();
+    auto value = std::make_shared<int>(0);
+    // the threads start at different keys to access different items
+    size_t i = state.thread_index * 7919;
+    for (auto _ : state) {
+      const auto &key = all_keys[i % kKeys];
+      if (i % kInsertionPeriod == 0) {
+        cache->addItem(key, value);
+      } else {
+        benchmark::DoNotOptimize(cache->findItem(key));
+      }
+      ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void BM_FifoCache(benchmark::State &state) {
+    accessCache<iroha::cache::Cache<Key, Value, Key::Hasher>>(state);
+  }
+
+  void BM_ShardedClockCache(benchmark::State &state) {
+    accessCache<iroha::cache::ShardedCache<Key, Value, Key::Hasher>>(state);
+  }
+}  // namespace
+
+BENCHMARK(BM_FifoCache)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_ShardedClockCache)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_MAIN();
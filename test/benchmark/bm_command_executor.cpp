@@ -0,0 +1,345 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * The commands of the committed transactions are applied to the WSV by the
+ * command executor. The purpose of these benchmarks is to measure the
+ * execution time of every command type with the stateful validation, so a
+ * regression of a single command is visible apart from the pipeline.
+ *
+ * The argument of the benchmarks is the number of the accounts in the WSV,
+ * which is populated once per size and shared by all the commands. Every
+ * command is executed in a transaction which is rolled back, so the WSV does
+ * not change between the iterations. A PostgreSQL database is required, its
+ * credentials are taken from the environment as in the integration tests.
+ *
+ * The results are compared between runs in the JSON format:
+ *   bm_command_executor --benchmark_out=result.json
+ *     --benchmark_out_format=json
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <map>
+
+#include <soci/soci.h>
+#include "ametsuchi/impl/postgres_command_executor.hpp"
+#include "backend/protobuf/proto_permission_to_string.hpp"
+#include "backend/protobuf/transaction.hpp"
+#include "datetime/time.hpp"
+#include "framework/common_constants.hpp"
+#include "framework/test_db_manager.hpp"
+#include "framework/test_logger.hpp"
+#include "interfaces/commands/command.hpp"
+#include "logger/logger_manager.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using iroha::integration_framework::TestDbManager;
+using shared_model::interface::permissions::Grantable;
+using shared_model::interface::permissions::Role;
+
+namespace {
+  const std::string kDomain = "bench";
+  const std::string kAdmin = "admin@" + kDomain;
+  const std::string kAsset = "coin#" + kDomain;
+  const std::string kUserRole = "user";
+  const std::string kExtraRole = "extra";
+
+  /// number of the prepared transactions, which are executed in turn
+  constexpr size_t kPreparedTransactions = 1000;
+
+  std::string userId(size_t index) {
+    return "user" + std::to_string(index) + "@" + kDomain;
+  }
+
+  /// WSV of the given number of accounts with the executor over it
+  struct World {
+    std::unique_ptr<TestDbManager> db_manager;
+    std::unique_ptr<iroha::ametsuchi::PostgresCommandExecutor> executor;
+  };
+
+  iroha::expected::Result<void, std::string> execute(
+      iroha::ametsuchi::PostgresCommandExecutor &executor,
+      const shared_model::proto::Transaction &transaction,
+      bool do_validation) {
+    for (const auto &command : transaction.commands()) {
+      if (auto error = iroha::expected::resultToOptionalError(
+              executor.execute(command, kAdmin, do_validation))) {
+        return iroha::expected::makeError(error->toString());
+      }
+    }
+    return {};
+  }
+
+  /**
+   * Create the admin and the asset with the commands, then insert the user
+   * accounts with the assets in bulk, as the commands would take hours for
+   * millions of the accounts
+   */
+  iroha::expected::Result<std::unique_ptr<World>, std::string> makeWorld(
+      size_t accounts) {
+    auto db_manager = TestDbManager::createWithRandomDbName(
+        1, getTestLoggerManager()->getChild("TestDbManager"));
+    if (auto error = iroha::expected::resultToOptionalError(db_manager)) {
+      return iroha::expected::makeError(*error);
+    }
+    auto world = std::make_unique<World>();
+    world->db_manager = std::move(
+        iroha::expected::resultToOptionalValue(std::move(db_manager)).value());
+    world->executor =
+        std::make_unique<iroha::ametsuchi::PostgresCommandExecutor>(
+            world->db_manager->getSession(),
+            std::make_shared<shared_model::proto::ProtoPermissionToString>());
+
+    shared_model::interface::RolePermissionSet all_permissions;
+    all_permissions.setAll();
+    auto genesis =
+        TestTransactionBuilder()
+            .creatorAccountId(kAdmin)
+            .createdTime(iroha::time::now())
+            .quorum(1)
+            .createRole("admin", all_permissions)
+            .createRole(kUserRole, {Role::kReceive, Role::kTransfer})
+            .createRole(kExtraRole, {Role::kGetMyAccount})
+            .createDomain(kDomain, kUserRole)
+            .createAsset("coin", kDomain, 2)
+            .createAccount("admin",
+                           kDomain,
+                           common_constants::kAdminKeypair.publicKey())
+            .appendRole(kAdmin, "admin")
+            .addAssetQuantity(kAsset, "1000000000.00")
+            .build();
+    if (auto error = iroha::expected::resultToOptionalError(
+            execute(*world->executor, genesis, false))) {
+      return iroha::expected::makeError(*error);
+    }
+
+    auto &sql = world->executor->getSession();
+    auto count = static_cast<long long>(accounts);
+    auto public_key = common_constants::kUserKeypair.publicKey().hex();
+    try {
+      sql << "INSERT INTO signatory (public_key) VALUES (:key)",
+          soci::use(public_key);
+      sql << "INSERT INTO account (account_id, domain_id, quorum, data) "
+             "SELECT 'user' || i || '@' || :domain, :domain, 1, '{}' "
+             "FROM generate_series(0, :count - 1) i",
+          soci::use(kDomain, "domain"), soci::use(count, "count");
+      sql << "INSERT INTO account_has_signatory (account_id, public_key) "
+             "SELECT account_id, :key FROM account WHERE account_id <> :admin",
+          soci::use(public_key, "key"), soci::use(kAdmin, "admin");
+      sql << "INSERT INTO account_has_roles (account_id, role_id) "
+             "SELECT account_id, :role FROM account "
+             "WHERE account_id <> :admin",
+          soci::use(kUserRole, "role"), soci::use(kAdmin, "admin");
+      sql << "INSERT INTO account_has_asset (account_id, asset_id, amount) "
+             "SELECT account_id, :asset, 1000.00 FROM account "
+             "WHERE account_id <> :admin",
+          soci::use(kAsset, "asset"), soci::use(kAdmin, "admin");
+      sql << "ANALYZE";
+    } catch (const std::exception &e) {
+      return iroha::expected::makeError(e.what());
+    }
+    return world;
+  }
+
+  /// WSVs by their sizes, which are populated on the first use
+  std::map<size_t, std::unique_ptr<World>> worlds;
+}  // namespace
+
+class CommandExecutorBenchmark : public benchmark::Fixture {
+ public:
+  void SetUp(benchmark::State &st) override {
+    auto accounts = static_cast<size_t>(st.range(0));
+    auto &world = worlds[accounts];
+    if (not world) {
+      auto result = makeWorld(accounts);
+      if (auto error = iroha::expected::resultToOptionalError(result)) {
+        st.SkipWithError(error->c_str());
+        return;
+      }
+      world = std::move(
+          iroha::expected::resultToOptionalValue(std::move(result)).value());
+    }
+    world_ = world.get();
+  }
+
+  void TearDown(benchmark::State &st) override {
+    world_ = nullptr;
+  }
+
+  /**
+   * Execute the prepared transactions of a single command in turn, each in
+   * a database transaction, which is rolled back after the iteration
+   * @param make_transaction - makes the unsigned builder of the transaction
+   * with the given index, whose users are spread over the WSV
+   */
+  template <typename MakeTransaction>
+  void run(benchmark::State &st, MakeTransaction make_transaction) {
+    if (not world_) {
+      return;
+    }
+    auto accounts = static_cast<size_t>(st.range(0));
+    std::vector<shared_model::proto::Transaction> transactions;
+    transactions.reserve(kPreparedTransactions);
+    for (size_t i = 0; i < kPreparedTransactions; ++i) {
+      // a prime step spreads the accounts of the neighbouring iterations
+      auto user = [&](size_t offset) {
+        return userId((i * 7919 + offset) % accounts);
+      };
+      transactions.push_back(make_transaction(
+                                 TestTransactionBuilder()
+                                     .creatorAccountId(kAdmin)
+                                     .createdTime(iroha::time::now())
+                                     .quorum(1),
+                                 i,
+                                 user)
+                                 .build());
+    }
+
+    auto &executor = *world_->executor;
+    auto &sql = executor.getSession();
+    size_t i = 0;
+    while (st.KeepRunning()) {
+      st.PauseTiming();
+      sql << "BEGIN";
+      st.ResumeTiming();
+
+      auto result =
+          execute(executor, transactions[i++ % transactions.size()], true);
+
+      st.PauseTiming();
+      sql << "ROLLBACK";
+      if (auto error = iroha::expected::resultToOptionalError(result)) {
+        st.SkipWithError(error->c_str());
+        break;
+      }
+      st.ResumeTiming();
+    }
+  }
+
+ private:
+  World *world_ = nullptr;
+};
+
+BENCHMARK_DEFINE_F(CommandExecutorBenchmark, TransferAsset)
+(benchmark::State &st) {
+  run(st, [](auto builder, size_t i, auto user) {
+    return builder.transferAsset(user(0), user(1), kAsset, "", "1.00");
+  });
+}
+
+BENCHMARK_DEFINE_F(CommandExecutorBenchmark, AddAssetQuantity)
+(benchmark::State &st) {
+  run(st, [](auto builder, size_t i, auto user) {
+    return builder.addAssetQuantity(kAsset, "1.00");
+  });
+}
+
+BENCHMARK_DEFINE_F(CommandExecutorBenchmark, SubtractAssetQuantity)
+(benchmark::State &st) {
+  run(st, [](auto builder, size_t i, auto user) {
+    return builder.subtractAssetQuantity(kAsset, "1.00");
+  });
+}
+
+BENCHMARK_DEFINE_F(CommandExecutorBenchmark, CreateAccount)
+(benchmark::State &st) {
+  run(st, [](auto builder, size_t i, auto user) {
+    return builder.createAccount("new" + std::to_string(i),
+                                 kDomain,
+                                 common_constants::kUserKeypair.publicKey());
+  });
+}
+
+BENCHMARK_DEFINE_F(CommandExecutorBenchmark, SetAccountDetail)
+(benchmark::State &st) {
+  run(st, [](auto builder, size_t i, auto user) {
+    return builder.setAccountDetail(user(0), "key", std::to_string(i));
+  });
+}
+
+BENCHMARK_DEFINE_F(CommandExecutorBenchmark, AppendRole)
+(benchmark::State &st) {
+  run(st, [](auto builder, size_t i, auto user) {
+    return builder.appendRole(user(0), kExtraRole);
+  });
+}
+
+BENCHMARK_DEFINE_F(CommandExecutorBenchmark, DetachRole)
+(benchmark::State &st) {
+  run(st, [](auto builder, size_t i, auto user) {
+    return builder.detachRole(user(0), kUserRole);
+  });
+}
+
+BENCHMARK_DEFINE_F(CommandExecutorBenchmark, CreateRole)
+(benchmark::State &st) {
+  run(st, [](auto builder, size_t i, auto user) {
+    return builder.createRole("role" + std::to_string(i),
+                              {Role::kReceive, Role::kTransfer});
+  });
+}
+
+BENCHMARK_DEFINE_F(CommandExecutorBenchmark, GrantPermission)
+(benchmark::State &st) {
+  run(st, [](auto builder, size_t i, auto user) {
+    return builder.grantPermission(user(0), Grantable::kSetMyQuorum);
+  });
+}
+
+BENCHMARK_DEFINE_F(CommandExecutorBenchmark, AddSignatory)
+(benchmark::State &st) {
+  run(st, [](auto builder, size_t i, auto user) {
+    return builder.addSignatory(user(0),
+                                common_constants::kAdminKeypair.publicKey());
+  });
+}
+
+BENCHMARK_DEFINE_F(CommandExecutorBenchmark, SetAccountQuorum)
+(benchmark::State &st) {
+  run(st, [](auto builder, size_t i, auto user) {
+    return builder.setAccountQuorum(user(0), 1);
+  });
+}
+
+BENCHMARK_DEFINE_F(CommandExecutorBenchmark, CreateAsset)
+(benchmark::State &st) {
+  run(st, [](auto builder, size_t i, auto user) {
+    return builder.createAsset("asset" + std::to_string(i), kDomain, 2);
+  });
+}
+
+BENCHMARK_DEFINE_F(CommandExecutorBenchmark, CreateDomain)
+(benchmark::State &st) {
+  run(st, [](auto builder, size_t i, auto user) {
+    return builder.createDomain("domain" + std::to_string(i), kUserRole);
+  });
+}
+
+/// the sizes of the WSV in accounts, from 10 thousand to 10 million
+static void WsvSizes(benchmark::internal::Benchmark *b) {
+  b->RangeMultiplier(10)->Range(10000, 10000000)->Unit(benchmark::kMicrosecond);
+}
+
+BENCHMARK_REGISTER_F(CommandExecutorBenchmark, TransferAsset)->Apply(WsvSizes);
+BENCHMARK_REGISTER_F(CommandExecutorBenchmark, AddAssetQuantity)
+    ->Apply(WsvSizes);
+BENCHMARK_REGISTER_F(CommandExecutorBenchmark, SubtractAssetQuantity)
+    ->Apply(WsvSizes);
+BENCHMARK_REGISTER_F(CommandExecutorBenchmark, CreateAccount)->Apply(WsvSizes);
+BENCHMARK_REGISTER_F(CommandExecutorBenchmark, SetAccountDetail)
+    ->Apply(WsvSizes);
+BENCHMARK_REGISTER_F(CommandExecutorBenchmark, AppendRole)->Apply(WsvSizes);
+BENCHMARK_REGISTER_F(CommandExecutorBenchmark, DetachRole)->Apply(WsvSizes);
+BENCHMARK_REGISTER_F(CommandExecutorBenchmark, CreateRole)->Apply(WsvSizes);
+BENCHMARK_REGISTER_F(CommandExecutorBenchmark, GrantPermission)
+    ->Apply(WsvSizes);
+BENCHMARK_REGISTER_F(CommandExecutorBenchmark, AddSignatory)->Apply(WsvSizes);
+BENCHMARK_REGISTER_F(CommandExecutorBenchmark, SetAccountQuorum)
+    ->Apply(WsvSizes);
+BENCHMARK_REGISTER_F(CommandExecutorBenchmark, CreateAsset)->Apply(WsvSizes);
+BENCHMARK_REGISTER_F(CommandExecutorBenchmark, CreateDomain)->Apply(WsvSizes);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,93 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Benchmark of the stateless validation of a proposal of 5000 signed
+ * transactions, which the peers do for every proposal they receive, on the
+ * calling thread and on the validation pool.
+ *
+ * The purpose of this benchmark is to keep track of the speedup of the
+ * parallel validation of the transactions and their signatures. The
+ * transactions are signed with a new key for every iteration, so the
+ * signatures are not found in the verified signature cache.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <thread>
+
+#include "backend/protobuf/proposal.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "datetime/time.hpp"
+#include "module/irohad/common/validators_config.hpp"
+#include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "validation/validation_pool.hpp"
+#include "validators/default_validator.hpp"
+
+namespace {
+
+  /// number of transactions in a proposal
+  constexpr size_t kTransactions = 5000;
+
+  shared_model::proto::Proposal makeProposal() {
+    auto keypair =
+        shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+    auto now = iroha::time::now();
+    std::vector<shared_model::proto::Transaction> txs;
+    txs.reserve(kTransactions);
+    for (size_t i = 0; i < kTransactions; ++i) {
+      txs.push_back(TestUnsignedTransactionBuilder()
+                        .creatorAccountId("admin@test")
+                        .createdTime(now + i)
+                        .quorum(1)
+                        .transferAsset("admin@test",
+                                       "user@test",
+                                       "coin#test",
+                                       "payment",
+                                       "1.00")
+                        .build()
+                        .signAndAddSignature(keypair)
+                        .finish());
+    }
+    return TestProposalBuilder()
+        .height(2)
+        .createdTime(now)
+        .transactions(txs)
+        .build();
+  }
+
+  /// state.range(0) is the number of the workers of the pool
+  void BM_ValidateProposal(benchmark::State &state) {
+    auto pool = std::make_shared<iroha::validation::ValidationPool>(
+        static_cast<size_t>(state.range(0)));
+    shared_model::validation::DefaultProposalValidator validator(
+        std::make_shared<shared_model::validation::ValidatorsConfig>(
+            iroha::test::getTestsMaxBatchSize(),
+            shared_model::validation::getDefaultSettings(),
+            false,
+            false,
+            [pool](size_t size, const std::function<void(size_t)> &f) {
+              pool->parallelFor(size, f);
+            }));
+
+    for (auto _ : state) {
+      state.PauseTiming();
+      auto proposal = makeProposal();
+      state.ResumeTiming();
+      benchmark::DoNotOptimize(validator.validate(proposal));
+    }
+    state.SetItemsProcessed(state.iterations() * kTransactions);
+  }
+}  // namespace
+
+BENCHMARK(BM_ValidateProposal)
+    ->Arg(1)
+    ->Arg(std::max(std::thread::hardware_concurrency(), 2u))
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,61 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Benchmark of the stateless validation of a transaction with 10 commands,
+ * which check account and asset ids, domains, names, detail keys and peer
+ * addresses.
+ *
+ * The purpose of this benchmark is to keep track of the cost of the field
+ * matchers, which run on every ingress path.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "backend/protobuf/transaction.hpp"
+#include "datetime/time.hpp"
+#include "module/irohad/common/validators_config.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "validators/default_validator.hpp"
+
+namespace {
+
+  shared_model::proto::Transaction transaction() {
+    return TestTransactionBuilder()
+        .createdTime(iroha::time::now())
+        .creatorAccountId("admin@test.domain")
+        .quorum(1)
+        .createDomain("sub.test.domain", "user")
+        .createAccountRaw("account", "sub.test.domain", std::string(64, '0'))
+        .createAsset("coin", "sub.test.domain", 2)
+        .addAssetQuantity("coin#sub.test.domain", "100.00")
+        .transferAsset("admin@test.domain",
+                       "account@sub.test.domain",
+                       "coin#sub.test.domain",
+                       "payment",
+                       "5.00")
+        .setAccountDetail("account@sub.test.domain", "detail_key", "value")
+        .appendRole("account@sub.test.domain", "user")
+        .setAccountQuorum("account@sub.test.domain", 1)
+        .addPeerRaw("peer.test.domain:10001", std::string(64, '1'))
+        .addPeerRaw("10.0.0.1:10001", std::string(64, '2'))
+        .build();
+  }
+
+  void BM_ValidateTransaction(benchmark::State &state) {
+    shared_model::validation::DefaultUnsignedTransactionValidator validator(
+        iroha::test::kTestsValidatorsConfig);
+    auto tx = transaction();
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(validator.validate(tx));
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+}  // namespace
+
+BENCHMARK(BM_ValidateTransaction);
+
+BENCHMARK_MAIN();
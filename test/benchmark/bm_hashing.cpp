@@ -0,0 +1,88 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Benchmarks of the hashing of the transactions:
+ * - SHA3-256 of the payloads one by one and in one multi-buffer call
+ * - reduced hash of a batch, which concatenates the reduced hashes of its
+ * transactions
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "backend/protobuf/transaction.hpp"
+#include "cryptography/hash_providers/sha3_256.hpp"
+#include "datetime/time.hpp"
+#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace shared_model;
+
+namespace {
+
+  /// @return transactions with distinct payloads
+  interface::types::SharedTxsCollectionType transactions(size_t number) {
+    interface::types::SharedTxsCollectionType result;
+    for (size_t i = 0; i < number; ++i) {
+      result.push_back(std::make_shared<proto::Transaction>(
+          TestTransactionBuilder()
+              .createdTime(iroha::time::now() + i)
+              .creatorAccountId("account@domain")
+              .setAccountQuorum("account@domain", 2)
+              .quorum(1)
+              .build()));
+    }
+    return result;
+  }
+
+  std::vector<const crypto::Blob *> payloads(
+      const interface::types::SharedTxsCollectionType &transactions) {
+    std::vector<const crypto::Blob *> result;
+    for (const auto &tx : transactions) {
+      result.push_back(&tx->payload());
+    }
+    return result;
+  }
+
+  void BM_HashOneByOne(benchmark::State &state) {
+    auto txs = transactions(state.range(0));
+    auto blobs = payloads(txs);
+
+    for (auto _ : state) {
+      std::vector<crypto::Hash> hashes;
+      hashes.reserve(blobs.size());
+      for (const auto blob : blobs) {
+        hashes.push_back(crypto::Sha3_256::makeHash(*blob));
+      }
+      benchmark::DoNotOptimize(hashes);
+    }
+    state.SetItemsProcessed(state.iterations() * blobs.size());
+  }
+
+  void BM_MakeHashes(benchmark::State &state) {
+    auto txs = transactions(state.range(0));
+    auto blobs = payloads(txs);
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(crypto::Sha3_256::makeHashes(blobs));
+    }
+    state.SetItemsProcessed(state.iterations() * blobs.size());
+  }
+
+  void BM_ReducedBatchHash(benchmark::State &state) {
+    auto txs = transactions(state.range(0));
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(interface::TransactionBatchImpl(txs));
+    }
+    state.SetItemsProcessed(state.iterations() * txs.size());
+  }
+}  // namespace
+
+BENCHMARK(BM_HashOneByOne)->Arg(1)->Arg(16)->Arg(256);
+BENCHMARK(BM_MakeHashes)->Arg(1)->Arg(16)->Arg(256);
+BENCHMARK(BM_ReducedBatchHash)->Arg(1)->Arg(16)->Arg(256);
+
+BENCHMARK_MAIN();
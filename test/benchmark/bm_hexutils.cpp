@@ -0,0 +1,126 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Benchmarks of the hex conversions of hexutils, which are vectorized for
+ * the instruction set the build targets, against the scalar loops and the
+ * stream formatting the conversions used before. The sizes are the ones of
+ * the hashes and the keys, of the signatures and of a small payload
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <iomanip>
+#include <sstream>
+
+#include "common/hexutils.hpp"
+
+namespace {
+
+  std::string bytes(size_t size) {
+    std::string result;
+    for (size_t i = 0; i < size; ++i) {
+      result.push_back(static_cast<char>(i * 131 + 7));
+    }
+    return result;
+  }
+
+  std::string streamEncode(const std::string &str) {
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0');
+    for (const auto &c : str) {
+      ss << std::setw(2) << (static_cast<int>(c) & 0xff);
+    }
+    return ss.str();
+  }
+
+  boost::optional<std::string> streamDecode(const std::string &str) {
+    std::string result(str.size() / 2, 0);
+    for (size_t i = 0; i < result.length(); ++i) {
+      std::string byte = str.substr(i * 2, 2);
+      size_t pos = 0;
+      try {
+        result.at(i) =
+            static_cast<std::string::value_type>(std::stoul(byte, &pos, 16));
+      } catch (const std::exception &) {
+        return boost::none;
+      }
+      if (pos != byte.size()) {
+        return boost::none;
+      }
+    }
+    return result;
+  }
+
+  void BM_EncodeStream(benchmark::State &state) {
+    auto bin = bytes(state.range(0));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(streamEncode(bin));
+    }
+    state.SetBytesProcessed(state.iterations() * bin.size());
+  }
+
+  void BM_EncodeScalar(benchmark::State &state) {
+    auto bin = bytes(state.range(0));
+    for (auto _ : state) {
+      std::string hex(2 * bin.size(), 0);
+      iroha::detail::hexEncodeScalar(
+          reinterpret_cast<const uint8_t *>(bin.data()), bin.size(), &hex[0]);
+      benchmark::DoNotOptimize(hex);
+    }
+    state.SetBytesProcessed(state.iterations() * bin.size());
+  }
+
+  void BM_Encode(benchmark::State &state) {
+    auto bin = bytes(state.range(0));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(iroha::bytestringToHexstring(bin));
+    }
+    state.SetBytesProcessed(state.iterations() * bin.size());
+  }
+
+  void BM_DecodeStream(benchmark::State &state) {
+    auto hex = iroha::bytestringToHexstring(bytes(state.range(0)));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(streamDecode(hex));
+    }
+    state.SetBytesProcessed(state.iterations() * hex.size() / 2);
+  }
+
+  void BM_DecodeScalar(benchmark::State &state) {
+    auto hex = iroha::bytestringToHexstring(bytes(state.range(0)));
+    for (auto _ : state) {
+      std::string bin(hex.size() / 2, 0);
+      benchmark::DoNotOptimize(iroha::detail::hexDecodeScalar(
+          hex.data(), bin.size(), reinterpret_cast<uint8_t *>(&bin[0])));
+      benchmark::DoNotOptimize(bin);
+    }
+    state.SetBytesProcessed(state.iterations() * hex.size() / 2);
+  }
+
+  void BM_Decode(benchmark::State &state) {
+    auto hex = iroha::bytestringToHexstring(bytes(state.range(0)));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(iroha::hexstringToBytestring(hex));
+    }
+    state.SetBytesProcessed(state.iterations() * hex.size() / 2);
+  }
+
+  void sizes(benchmark::internal::Benchmark *b) {
+    for (auto size : {32, 64, 1024}) {
+      b->Arg(size);
+    }
+  }
+
+}  // namespace
+
+BENCHMARK(BM_EncodeStream)->Apply(sizes);
+BENCHMARK(BM_EncodeScalar)->Apply(sizes);
+BENCHMARK(BM_Encode)->Apply(sizes);
+BENCHMARK(BM_DecodeStream)->Apply(sizes);
+BENCHMARK(BM_DecodeScalar)->Apply(sizes);
+BENCHMARK(BM_Decode)->Apply(sizes);
+
+BENCHMARK_MAIN();
@@ -10,6 +10,10 @@
 
 #include <benchmark/benchmark.h>
 
+#ifndef ED25519_IMPL
+#define ED25519_IMPL "unknown"
+#endif
+
 auto ConstructRandomVector(size_t size) {
   using T = unsigned char;
   std::vector<T> v;
@@ -53,6 +57,8 @@ static void BM_Verify(benchmark::State &state) {
   signature_t sig{};
 
   ed25519_create_keypair(&priv, &pub);
+  // the results of the builds with different ED25519_IMPL are compared
+  state.SetLabel(ED25519_IMPL);
 
   while (state.KeepRunning()) {
     state.PauseTiming();
@@ -0,0 +1,108 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Benchmarks of the MST state:
+ * - merge of a state received from other peer, half of which batches are
+ * already in the own state
+ * - extraction of the expired batches, half of the state being expired
+ *
+ * The purpose of these benchmarks is to compare the changes of the batch
+ * index and the expiry structure of MstState.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <map>
+
+#include "backend/protobuf/transaction.hpp"
+#include "datetime/time.hpp"
+#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
+#include "logger/dummy_logger.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "multi_sig_transactions/state/mst_state.hpp"
+
+using namespace iroha;
+
+namespace {
+
+  /// time between the batches of a state in milliseconds
+  constexpr TimeType kBatchInterval = 10;
+
+  const auto kExpirationTime = std::chrono::minutes(1);
+
+  const TimeType kCreatedTime = iroha::time::now();
+
+  /**
+   * @param number - number of the batches
+   * @return batches of single transactions, which need two signatures and
+   * are created kBatchInterval apart
+   */
+  const std::vector<DataType> &batches(size_t number) {
+    static std::map<size_t, std::vector<DataType>> batches;
+    auto &result = batches[number];
+    for (size_t i = result.size(); i < number; ++i) {
+      result.push_back(
+          std::make_shared<shared_model::interface::TransactionBatchImpl>(
+              shared_model::interface::types::SharedTxsCollectionType{
+                  std::make_shared<shared_model::proto::Transaction>(
+                      TestTransactionBuilder()
+                          .createdTime(kCreatedTime + i * kBatchInterval)
+                          .creatorAccountId("account@domain")
+                          .setAccountQuorum("account@domain", 2)
+                          .quorum(2)
+                          .build())}));
+    }
+    return result;
+  }
+
+  MstState makeState(std::vector<DataType>::const_iterator begin,
+                     std::vector<DataType>::const_iterator end) {
+    auto state =
+        MstState::empty(logger::getDummyLoggerPtr(),
+                        std::make_shared<DefaultCompleter>(kExpirationTime));
+    std::for_each(begin, end, [&state](const auto &batch) { state += batch; });
+    return state;
+  }
+
+  void BM_MergeStates(benchmark::State &state) {
+    const auto number = static_cast<size_t>(state.range(0));
+    const auto &all_batches = batches(number + number / 2);
+    auto own_state =
+        makeState(all_batches.begin(), all_batches.begin() + number);
+    auto received_state =
+        makeState(all_batches.begin() + number / 2, all_batches.end());
+
+    for (auto _ : state) {
+      state.PauseTiming();
+      auto merged_state = own_state;
+      state.ResumeTiming();
+      benchmark::DoNotOptimize(merged_state += received_state);
+    }
+    state.SetItemsProcessed(state.iterations() * number);
+  }
+
+  void BM_ExtractExpired(benchmark::State &state) {
+    const auto number = static_cast<size_t>(state.range(0));
+    const auto &all_batches = batches(number);
+    auto own_state = makeState(all_batches.begin(), all_batches.end());
+    const auto current_time = kCreatedTime + number / 2 * kBatchInterval
+        + kExpirationTime / std::chrono::milliseconds(1);
+
+    for (auto _ : state) {
+      state.PauseTiming();
+      auto expiring_state = own_state;
+      state.ResumeTiming();
+      benchmark::DoNotOptimize(expiring_state.extractExpired(current_time));
+    }
+    state.SetItemsProcessed(state.iterations() * number / 2);
+  }
+}  // namespace
+
+BENCHMARK(BM_MergeStates)->Arg(1000)->Arg(10000)->Arg(50000);
+BENCHMARK(BM_ExtractExpired)->Arg(1000)->Arg(10000)->Arg(50000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,130 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include "backend/protobuf/transaction.hpp"
+#include "builders/protobuf/unsigned_proto.hpp"
+#include "datetime/time.hpp"
+#include "framework/common_constants.hpp"
+#include "framework/integration_framework/fake_peer/behaviour/unreliable.hpp"
+#include "framework/integration_framework/integration_test_framework.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace common_constants;
+using Clock = std::chrono::steady_clock;
+
+const auto kProposalSize = 100;
+const auto kTransactionsPerIteration = 100;
+
+/**
+ * This benchmark runs a network of one real peer and fake peers, which vote
+ * for the real peer's blocks and serve the ordering requests, in order to
+ * measure how the throughput and the commit latency of the ordering and the
+ * consensus scale with the number of peers.
+ *
+ * The arguments are the number of peers, the latency of every fake peer link
+ * in milliseconds and the loss probability in per mille. The loss is applied
+ * to at most f = (N - 1) / 3 fake peers, so the supermajority is still
+ * reachable and every round commits.
+ * @param state
+ */
+static void BM_MultiPeerCommit(benchmark::State &state) {
+  const auto num_peers = static_cast<size_t>(state.range(0));
+  const std::chrono::milliseconds latency(state.range(1));
+  const auto loss_probability = state.range(2) / 1000.;
+
+  integration_framework::IntegrationTestFramework itf(
+      kProposalSize,
+      boost::none,
+      true,
+      false,
+      (boost::filesystem::temp_directory_path()
+       / boost::filesystem::unique_path())
+          .string(),
+      std::chrono::hours(1),
+      std::chrono::hours(1));
+  itf.initPipeline(kAdminKeypair);
+  auto fake_peers = itf.addFakePeers(num_peers - 1);
+  const auto num_lossy = (num_peers - 1) / 3;
+  for (size_t i = 0; i < fake_peers.size(); ++i) {
+    fake_peers[i]->setBehaviour(
+        std::make_shared<integration_framework::fake_peer::UnreliableBehaviour>(
+            latency, i < num_lossy ? loss_probability : 0., i));
+  }
+  itf.setGenesisBlock(itf.defaultBlock()).subscribeQueuesAndRun();
+
+  // the details make the hashes of the transactions different
+  size_t tx_counter = 0;
+  auto make_tx = [&tx_counter] {
+    return TestUnsignedTransactionBuilder()
+        .creatorAccountId(kAdminId)
+        .createdTime(iroha::time::now())
+        .setAccountDetail(kAdminId, "bench", std::to_string(tx_counter++))
+        .quorum(1)
+        .build()
+        .signAndAddSignature(kAdminKeypair)
+        .finish();
+  };
+
+  // commit latency of every transaction, in milliseconds
+  std::vector<double> latencies;
+  size_t committed = 0;
+  while (state.KeepRunning()) {
+    auto sent_at = Clock::now();
+    for (int i = 0; i < kTransactionsPerIteration; ++i) {
+      itf.sendTx(make_tx());
+    }
+
+    // the transactions may be spread among several rounds
+    size_t pending = kTransactionsPerIteration;
+    while (pending > 0) {
+      itf.checkBlock([&](const auto &block) {
+        auto size = std::min(block->transactions().size(), pending);
+        std::chrono::duration<double, std::milli> latency =
+            Clock::now() - sent_at;
+        latencies.insert(latencies.end(), size, latency.count());
+        pending -= size;
+      });
+    }
+    committed += kTransactionsPerIteration;
+  }
+  itf.done();
+
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&latencies](double p) {
+    if (latencies.empty()) {
+      return 0.;
+    }
+    return latencies[std::min(latencies.size() - 1,
+                              static_cast<size_t>(p * latencies.size()))];
+  };
+  state.counters["tx/s"] =
+      benchmark::Counter(committed, benchmark::Counter::kIsRate);
+  state.counters["p50_ms"] = percentile(.5);
+  state.counters["p99_ms"] = percentile(.99);
+}
+
+static void MultiPeerArguments(benchmark::internal::Benchmark *b) {
+  for (auto peers : {4, 7, 16, 32}) {
+    b->Args({peers, 0, 0});
+    b->Args({peers, 10, 0});
+    b->Args({peers, 10, 50});
+  }
+}
+
+BENCHMARK(BM_MultiPeerCommit)
+    ->Apply(MultiPeerArguments)
+    ->ArgNames({"peers", "latency_ms", "loss_permille"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
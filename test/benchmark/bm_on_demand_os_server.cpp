@@ -0,0 +1,118 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Every peer requests the proposal of the round from the ordering service, so
+ * the cost of a single RequestProposal call is paid number of peers times per
+ * round.
+ *
+ * The purpose of this benchmark is to keep track of the per-request cost of
+ * answering with the pre-encoded proposal compared to copying and serializing
+ * the proposal transport for each request.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "backend/protobuf/proposal.hpp"
+#include "datetime/time.hpp"
+#include "logger/dummy_logger.hpp"
+#include "module/irohad/ordering/mock_on_demand_os_notification.hpp"
+#include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "ordering/impl/on_demand_os_server_grpc.hpp"
+
+using namespace iroha::ordering;
+using namespace iroha::ordering::transport;
+
+using testing::NiceMock;
+using testing::Return;
+
+/// number of commands in a single transaction
+constexpr int number_of_commands = 5;
+
+/// number of transactions in a single proposal
+constexpr int number_of_txs = 100;
+
+class RequestProposalBenchmark : public benchmark::Fixture {
+ public:
+  std::shared_ptr<const shared_model::proto::Proposal> proposal;
+  std::shared_ptr<NiceMock<MockOdOsNotification>> notification;
+  std::shared_ptr<OnDemandOsServerGrpc> server;
+  proto::ProposalRequest request;
+
+  void SetUp(benchmark::State &st) override {
+    TestTransactionBuilder txbuilder;
+
+    auto base_tx = txbuilder.createdTime(iroha::time::now()).quorum(1);
+
+    for (int i = 0; i < number_of_commands; i++) {
+      base_tx.transferAsset("player@one", "player@two", "coin", "", "5.00");
+    }
+
+    std::vector<shared_model::proto::Transaction> txs;
+
+    for (int i = 0; i < number_of_txs; i++) {
+      txs.push_back(base_tx.build());
+    }
+
+    proposal = std::make_shared<const shared_model::proto::Proposal>(
+        TestProposalBuilder()
+            .createdTime(iroha::time::now())
+            .height(1)
+            .transactions(txs)
+            .build());
+
+    std::shared_ptr<const OdOsNotification::ProposalType> iproposal =
+        proposal;
+    notification = std::make_shared<NiceMock<MockOdOsNotification>>();
+    ON_CALL(*notification, onRequestProposal(testing::_))
+        .WillByDefault(Return(boost::make_optional(iproposal)));
+
+    server = std::make_shared<OnDemandOsServerGrpc>(
+        notification, nullptr, nullptr, nullptr, logger::getDummyLoggerPtr());
+
+    request.mutable_round()->set_block_round(1);
+    request.mutable_round()->set_reject_round(0);
+  }
+
+  void TearDown(benchmark::State &st) override {
+    server.reset();
+    notification.reset();
+    proposal.reset();
+  }
+};
+
+/**
+ * Benchmark the reply built by copying and serializing the proposal transport,
+ * which was done for every request before the proposal encoding was reused
+ */
+BENCHMARK_DEFINE_F(RequestProposalBenchmark, ReserializeTest)
+(benchmark::State &st) {
+  std::string wire;
+  while (st.KeepRunning()) {
+    iroha::protocol::Proposal copy = proposal->getTransport();
+    copy.SerializeToString(&wire);
+    benchmark::DoNotOptimize(wire);
+  }
+}
+
+/**
+ * Benchmark the reply of the server built from the pre-encoded proposal
+ */
+BENCHMARK_DEFINE_F(RequestProposalBenchmark, PreEncodedTest)
+(benchmark::State &st) {
+  std::string wire;
+  while (st.KeepRunning()) {
+    proto::ProposalResponse response;
+    server->RequestProposal(nullptr, &request, &response);
+    response.SerializeToString(&wire);
+    benchmark::DoNotOptimize(wire);
+  }
+}
+
+BENCHMARK_REGISTER_F(RequestProposalBenchmark, ReserializeTest);
+BENCHMARK_REGISTER_F(RequestProposalBenchmark, PreEncodedTest);
+
+BENCHMARK_MAIN();
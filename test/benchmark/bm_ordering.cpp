@@ -0,0 +1,322 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Benchmarks of the ordering layer:
+ * - onBatches of the ordering service under concurrent producers, which is
+ * the path of every batch received from the network
+ * - proposal packing on the collaboration outcome with a large number of
+ * pending batches
+ * - request/response path of the ordering service gRPC server over the
+ * in-process channel
+ *
+ * The purpose of these benchmarks is to compare the changes of the pending
+ * batch queue, proposal storage and transport.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <limits>
+
+#include <grpc++/grpc++.h>
+#include "ametsuchi/tx_presence_cache.hpp"
+#include "backend/protobuf/proto_proposal_factory.hpp"
+#include "backend/protobuf/proto_transport_factory.hpp"
+#include "backend/protobuf/transaction.hpp"
+#include "common/allocation_tracking.hpp"
+#include "datetime/time.hpp"
+#include "interfaces/iroha_internal/transaction_batch_factory_impl.hpp"
+#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
+#include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
+#include "logger/dummy_logger.hpp"
+#include "module/irohad/common/validators_config.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "module/shared_model/validators/validators.hpp"
+#include "ordering/impl/on_demand_common.hpp"
+#include "ordering/impl/on_demand_ordering_service_impl.hpp"
+#include "ordering/impl/on_demand_os_server_grpc.hpp"
+
+using namespace iroha;
+using namespace iroha::ordering;
+
+namespace {
+
+  /// number of batches in a single onBatches call
+  constexpr size_t kBatchesPerCall = 10;
+
+  /**
+   * Cache which reports every transaction as new without locking, so the
+   * measurements are not affected by mock synchronization
+   */
+  class MissingTxPresenceCache : public ametsuchi::TxPresenceCache {
+   public:
+    boost::optional<ametsuchi::TxCacheStatusType> check(
+        const shared_model::crypto::Hash &hash) const override {
+      return ametsuchi::TxCacheStatusType(
+          ametsuchi::tx_cache_status_responses::Missing(hash));
+    }
+
+    boost::optional<BatchStatusCollectionType> check(
+        const shared_model::interface::TransactionBatch &batch)
+        const override {
+      BatchStatusCollectionType result;
+      for (const auto &tx : batch.transactions()) {
+        result.push_back(ametsuchi::tx_cache_status_responses::Missing(
+            tx->hash()));
+      }
+      return result;
+    }
+
+    boost::optional<BatchStatusCollectionType> check(
+        const std::vector<shared_model::crypto::Hash> &hashes) const override {
+      BatchStatusCollectionType result;
+      for (const auto &hash : hashes) {
+        result.push_back(ametsuchi::tx_cache_status_responses::Missing(hash));
+      }
+      return result;
+    }
+  };
+
+  /**
+   * Strategy which creates proposals for every round
+   */
+  class AlwaysCreateStrategy : public ProposalCreationStrategy {
+   public:
+    void onCollaborationOutcome(RoundType, size_t) override {}
+
+    bool shouldCreateRound(RoundType) override {
+      return true;
+    }
+
+    boost::optional<RoundType> onProposalRequest(RoundType) override {
+      return boost::none;
+    }
+  };
+
+  /**
+   * Validator which accepts everything without locking
+   */
+  template <typename T>
+  class AcceptingValidator
+      : public shared_model::validation::AbstractValidator<T> {
+   public:
+    shared_model::validation::Answer validate(const T &) const override {
+      return {};
+    }
+  };
+
+  std::shared_ptr<shared_model::proto::Transaction> makeTx(
+      shared_model::interface::types::TimestampType created_time) {
+    return std::make_shared<shared_model::proto::Transaction>(
+        TestTransactionBuilder()
+            .createdTime(created_time)
+            .creatorAccountId("account@domain")
+            .setAccountQuorum("account@domain", 1)
+            .quorum(1)
+            .build());
+  }
+
+  /**
+   * Create batches of single transactions with unique hashes
+   * @param number - number of batches
+   * @param created_time - creation time of the first transaction
+   */
+  transport::OdOsNotification::CollectionType makeBatches(
+      size_t number,
+      shared_model::interface::types::TimestampType created_time) {
+    transport::OdOsNotification::CollectionType batches;
+    batches.reserve(number);
+    for (size_t i = 0; i < number; ++i) {
+      batches.push_back(
+          std::make_shared<shared_model::interface::TransactionBatchImpl>(
+              shared_model::interface::types::SharedTxsCollectionType{
+                  makeTx(created_time + i)}));
+    }
+    return batches;
+  }
+
+  std::shared_ptr<OnDemandOrderingServiceImpl> makeService(
+      size_t transaction_limit) {
+    return std::make_shared<OnDemandOrderingServiceImpl>(
+        transaction_limit,
+        std::make_shared<shared_model::proto::ProtoProposalFactory<
+            shared_model::validation::AlwaysValidValidator>>(
+            iroha::test::kTestsValidatorsConfig),
+        std::make_shared<MissingTxPresenceCache>(),
+        std::make_shared<AlwaysCreateStrategy>(),
+        logger::getDummyLoggerPtr());
+  }
+
+}  // namespace
+
+/**
+ * Benchmark onBatches called concurrently by the benchmark threads, every
+ * call passes kBatchesPerCall batches
+ */
+static void BM_OnBatches(benchmark::State &state) {
+  static std::shared_ptr<OnDemandOrderingServiceImpl> os;
+  if (state.thread_index == 0) {
+    os = makeService(std::numeric_limits<uint32_t>::max());
+  }
+
+  // every thread sends its own transactions
+  auto batches = makeBatches(
+      kBatchesPerCall,
+      iroha::time::now() + state.thread_index * kBatchesPerCall);
+
+  auto allocations = iroha::threadAllocationCounters();
+  while (state.KeepRunning()) {
+    os->onBatches(batches);
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchesPerCall);
+  // the allocations per call of the first thread, in the builds which track
+  // them, as the counters of the threads are summed
+  if (iroha::kAllocationTracking and state.thread_index == 0
+      and state.iterations() > 0) {
+    auto made = iroha::threadAllocationCounters();
+    state.counters["allocs/call"] =
+        double(made.allocations - allocations.allocations)
+        / state.iterations();
+    state.counters["bytes/call"] =
+        double(made.bytes - allocations.bytes) / state.iterations();
+  }
+
+  if (state.thread_index == 0) {
+    os.reset();
+  }
+}
+
+BENCHMARK(BM_OnBatches)->ThreadRange(1, 16)->UseRealTime();
+
+/**
+ * Benchmark the collaboration outcome, which packs the proposals from the
+ * given number of pending batches
+ */
+static void BM_PackNextProposals(benchmark::State &state) {
+  const size_t number_of_batches = state.range(0);
+  auto os = makeService(number_of_batches);
+  consensus::Round round{1, kFirstRejectRound};
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    os->onBatches(makeBatches(number_of_batches, iroha::time::now()));
+    state.ResumeTiming();
+
+    // commit outcome packs the pending batches and removes the packed
+    // ones from the queue
+    os->onCollaborationOutcome(round);
+    round = nextCommitRound(round);
+  }
+  state.SetItemsProcessed(state.iterations() * number_of_batches);
+}
+
+BENCHMARK(BM_PackNextProposals)
+    ->RangeMultiplier(10)
+    ->Range(10000, 100000)
+    ->Arg(50000)
+    ->Unit(benchmark::kMillisecond);
+
+/**
+ * Ordering service behind the gRPC server on the in-process channel
+ */
+class OrderingServerBenchmark : public benchmark::Fixture {
+ public:
+  /// number of transactions in the proposal and in SendBatches request
+  static constexpr size_t kNumberOfTxs = 100;
+
+  std::shared_ptr<OnDemandOrderingServiceImpl> os;
+  std::shared_ptr<transport::OnDemandOsServerGrpc> service;
+  std::unique_ptr<grpc::Server> server;
+  std::unique_ptr<proto::OnDemandOrdering::Stub> stub;
+  consensus::Round round{1, kFirstRejectRound};
+
+  void SetUp(benchmark::State &st) override {
+    os = makeService(kNumberOfTxs);
+    service = std::make_shared<transport::OnDemandOsServerGrpc>(
+        os,
+        std::make_shared<shared_model::proto::ProtoTransportFactory<
+            shared_model::interface::Transaction,
+            shared_model::proto::Transaction>>(
+            std::make_unique<
+                AcceptingValidator<shared_model::interface::Transaction>>(),
+            std::make_unique<AcceptingValidator<protocol::Transaction>>()),
+        std::make_shared<shared_model::interface::TransactionBatchParserImpl>(),
+        std::make_shared<shared_model::interface::TransactionBatchFactoryImpl>(
+            std::make_shared<AcceptingValidator<
+                shared_model::interface::TransactionBatch>>()),
+        logger::getDummyLoggerPtr());
+
+    grpc::ServerBuilder builder;
+    builder.RegisterService(service.get());
+    server = builder.BuildAndStart();
+    stub = proto::OnDemandOrdering::NewStub(
+        server->InProcessChannel(grpc::ChannelArguments()));
+  }
+
+  void TearDown(benchmark::State &st) override {
+    stub.reset();
+    server->Shutdown();
+    server.reset();
+    service.reset();
+    os.reset();
+  }
+
+  /**
+   * Create the request with kNumberOfTxs unique transactions
+   */
+  proto::BatchesRequest makeRequest() {
+    proto::BatchesRequest request;
+    auto created_time = iroha::time::now();
+    for (size_t i = 0; i < kNumberOfTxs; ++i) {
+      *request.add_transactions() = makeTx(created_time + i)->getTransport();
+    }
+    return request;
+  }
+};
+
+/**
+ * Benchmark the SendBatches call with kNumberOfTxs transactions
+ */
+BENCHMARK_DEFINE_F(OrderingServerBenchmark, SendBatchesTest)
+(benchmark::State &st) {
+  auto request = makeRequest();
+  while (st.KeepRunning()) {
+    grpc::ClientContext context;
+    google::protobuf::Empty response;
+    stub->SendBatches(&context, request, &response);
+  }
+  st.SetItemsProcessed(st.iterations() * kNumberOfTxs);
+}
+
+/**
+ * Benchmark the RequestProposal call of the round with the packed proposal
+ * of kNumberOfTxs transactions
+ */
+BENCHMARK_DEFINE_F(OrderingServerBenchmark, RequestProposalTest)
+(benchmark::State &st) {
+  grpc::ClientContext send_context;
+  google::protobuf::Empty send_response;
+  stub->SendBatches(&send_context, makeRequest(), &send_response);
+  os->onCollaborationOutcome(round);
+
+  proto::ProposalRequest request;
+  auto next_round = nextCommitRound(round);
+  request.mutable_round()->set_block_round(next_round.block_round);
+  request.mutable_round()->set_reject_round(next_round.reject_round);
+  while (st.KeepRunning()) {
+    grpc::ClientContext context;
+    proto::ProposalResponse response;
+    stub->RequestProposal(&context, request, &response);
+    if (not response.has_proposal()) {
+      st.SkipWithError("Proposal is not created");
+      break;
+    }
+  }
+}
+
+BENCHMARK_REGISTER_F(OrderingServerBenchmark, SendBatchesTest);
+BENCHMARK_REGISTER_F(OrderingServerBenchmark, RequestProposalTest);
+
+BENCHMARK_MAIN();
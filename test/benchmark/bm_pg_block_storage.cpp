@@ -0,0 +1,162 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * On the WSV restore and on the synchronization the applied blocks are
+ * inserted into the temporary block storage one by one and read back on the
+ * commit. The purpose of this benchmark is to compare the time of this for
+ * the block storage in the database with different flush sizes, with the
+ * in-memory block storage as the upper bound.
+ *
+ * The argument of the Postgres benchmark is the flush size: 1 inserts every
+ * block with its own statement, the sizes below
+ * PostgresBlockStorage::kMinCopyBlocks insert the buffered blocks with one
+ * statement, and the larger ones with COPY. A PostgreSQL database is
+ * required, its credentials are taken from the environment as in the
+ * integration tests.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "ametsuchi/impl/in_memory_block_storage.hpp"
+#include "ametsuchi/impl/k_times_reconnection_strategy.hpp"
+#include "ametsuchi/impl/postgres_block_storage_factory.hpp"
+#include "ametsuchi/impl/postgres_options.hpp"
+#include "datetime/time.hpp"
+#include "framework/config_helper.hpp"
+#include "framework/test_logger.hpp"
+#include "logger/dummy_logger.hpp"
+#include "logger/logger_manager.hpp"
+#include "main/impl/pg_connection_init.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "validators/always_valid_validator.hpp"
+
+using namespace iroha::ametsuchi;
+
+/// number of blocks inserted in every iteration
+constexpr size_t number_of_blocks = 1000;
+
+/// number of transactions in a single block
+constexpr int number_of_txs = 10;
+
+class PgBlockStorageBenchmark : public benchmark::Fixture {
+ public:
+  void SetUp(benchmark::State &st) override {
+    auto created = PgConnectionInit::createDatabaseIfNotExist(options_);
+    if (auto error = iroha::expected::resultToOptionalError(created)) {
+      st.SkipWithError(error->c_str());
+      return;
+    }
+    KTimesReconnectionStrategyFactory reconnection_strategy_factory(0);
+    auto pool = PgConnectionInit::prepareConnectionPool(
+        reconnection_strategy_factory,
+        options_,
+        2,
+        getTestLoggerManager()->getChild("Storage"));
+    if (auto error = iroha::expected::resultToOptionalError(pool)) {
+      st.SkipWithError(error->c_str());
+      return;
+    }
+    pool_wrapper_ =
+        std::move(iroha::expected::resultToOptionalValue(pool).value());
+    block_factory_ = std::make_shared<shared_model::proto::ProtoBlockFactory>(
+        std::make_unique<shared_model::validation::AlwaysValidValidator<
+            shared_model::interface::Block>>(),
+        std::make_unique<shared_model::validation::AlwaysValidValidator<
+            iroha::protocol::Block>>());
+
+    TestTransactionBuilder txbuilder;
+    auto base_tx = txbuilder.createdTime(iroha::time::now()).quorum(1);
+    base_tx.transferAsset("player@one", "player@two", "coin", "", "5.00");
+    std::vector<shared_model::proto::Transaction> txs;
+    for (int i = 0; i < number_of_txs; i++) {
+      txs.push_back(base_tx.build());
+    }
+    for (size_t height = 1; height <= number_of_blocks; ++height) {
+      blocks_.push_back(clone(TestBlockBuilder()
+                                  .createdTime(iroha::time::now())
+                                  .height(height)
+                                  .transactions(txs)
+                                  .build()));
+    }
+  }
+
+  void TearDown(benchmark::State &st) override {
+    blocks_.clear();
+    pool_wrapper_.reset();
+    PgConnectionInit::dropWorkingDatabase(options_);
+  }
+
+  /**
+   * Insert the blocks into the storage and read them back as the commit of
+   * the mutable storage does
+   */
+  static void insertAndRead(
+      BlockStorage &storage,
+      const std::vector<std::shared_ptr<const shared_model::interface::Block>>
+          &blocks) {
+    for (const auto &block : blocks) {
+      storage.insert(block);
+    }
+    storage.forEach(
+        [](const auto &block) { benchmark::DoNotOptimize(block->height()); });
+  }
+
+  std::string dbname_ = integration_framework::getRandomDbName();
+  std::string pgopt_ = "dbname=" + dbname_ + " "
+      + integration_framework::getPostgresCredsOrDefault();
+  PostgresOptions options_{pgopt_, dbname_, logger::getDummyLoggerPtr()};
+  std::shared_ptr<PoolWrapper> pool_wrapper_;
+  std::shared_ptr<shared_model::proto::ProtoBlockFactory> block_factory_;
+  std::vector<std::shared_ptr<const shared_model::interface::Block>> blocks_;
+};
+
+/**
+ * Benchmark the temporary block storage in the database with the flush size
+ * of the argument
+ */
+BENCHMARK_DEFINE_F(PgBlockStorageBenchmark, Postgres)(benchmark::State &st) {
+  if (not pool_wrapper_) {
+    return;
+  }
+  size_t table = 0;
+  while (st.KeepRunning()) {
+    PostgresBlockStorageFactory factory(
+        pool_wrapper_,
+        block_factory_,
+        [&table] { return "bm_blocks_" + std::to_string(table++); },
+        logger::getDummyLoggerPtr(),
+        st.range(0));
+    auto storage = factory.create();
+    insertAndRead(*storage, blocks_);
+    st.PauseTiming();
+    storage.reset();
+    st.ResumeTiming();
+  }
+  st.SetItemsProcessed(st.iterations() * number_of_blocks);
+}
+
+/**
+ * Benchmark the in-memory block storage, the upper bound of the others
+ */
+BENCHMARK_DEFINE_F(PgBlockStorageBenchmark, InMemory)(benchmark::State &st) {
+  while (st.KeepRunning()) {
+    InMemoryBlockStorage storage;
+    insertAndRead(storage, blocks_);
+  }
+  st.SetItemsProcessed(st.iterations() * number_of_blocks);
+}
+
+BENCHMARK_REGISTER_F(PgBlockStorageBenchmark, Postgres)
+    ->Arg(1)
+    ->Arg(8)
+    ->Arg(64)
+    ->Arg(1000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(PgBlockStorageBenchmark, InMemory)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -10,7 +10,7 @@
  * which can be visibly slow.
  *
  * The purpose of this benchmark is to keep track of performance costs related
- * to blocks and proposals copying/moving.
+ * to blocks, proposals and transactions copying/moving.
  *
  * Each benchmark runs transaction() and commands() call to
  * initialize possibly lazy fields.
@@ -19,10 +19,12 @@
 #include <benchmark/benchmark.h>
 
 #include "backend/protobuf/block.hpp"
+#include "backend/protobuf/proto_block_factory.hpp"
 #include "datetime/time.hpp"
 #include "module/shared_model/builders/protobuf/test_block_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "module/shared_model/validators/validators.hpp"
 
 /// number of commands in a single transaction
 constexpr int number_of_commands = 5;
@@ -85,6 +87,24 @@ class ProposalBenchmark : public benchmark::Fixture {
   }
 };
 
+class TransactionBenchmark : public benchmark::Fixture {
+ public:
+  std::unique_ptr<shared_model::proto::Transaction> transaction;
+
+  void SetUp(benchmark::State &st) override {
+    TestTransactionBuilder txbuilder;
+
+    auto base_tx = txbuilder.createdTime(iroha::time::now()).quorum(1);
+
+    for (int i = 0; i < number_of_commands; i++) {
+      base_tx.transferAsset("player@one", "player@two", "coin", "", "5.00");
+    }
+
+    transaction =
+        std::make_unique<shared_model::proto::Transaction>(base_tx.build());
+  }
+};
+
 /**
  * calls getters of a given object (block or proposal),
  * so that lazy fields are initialized.
@@ -169,6 +189,38 @@ BENCHMARK_DEFINE_F(BlockBenchmark, CloneTest)(benchmark::State &st) {
   }
 }
 
+/**
+ * Benchmark block creation by parsing it from the serialized data
+ */
+BENCHMARK_DEFINE_F(BlockBenchmark, ParseTest)(benchmark::State &st) {
+  auto serialized = complete_builder.build().getTransport().SerializeAsString();
+
+  for (auto _ : st) {
+    runBenchmark(st, [&serialized] {
+      iroha::protocol::Block_v1 proto_block;
+      proto_block.ParseFromString(serialized);
+      shared_model::proto::Block block(std::move(proto_block));
+      checkLoop(block);
+    });
+  }
+}
+
+/**
+ * Benchmark block creation by parsing it into an arena
+ */
+BENCHMARK_DEFINE_F(BlockBenchmark, ArenaParseTest)(benchmark::State &st) {
+  auto serialized = complete_builder.build().getTransport().SerializeAsString();
+
+  for (auto _ : st) {
+    runBenchmark(st, [&serialized] {
+      shared_model::proto::ArenaMessage<iroha::protocol::Block_v1> proto_block;
+      proto_block->ParseFromString(serialized);
+      shared_model::proto::Block block(std::move(proto_block));
+      checkLoop(block);
+    });
+  }
+}
+
 /**
  * Benchmark proposal creation by copying protobuf object
  */
@@ -212,12 +264,78 @@ BENCHMARK_DEFINE_F(ProposalBenchmark, MoveTest)(benchmark::State &st) {
   }
 }
 
+/**
+ * Creates a block of the transactions of a proposal as the simulator does
+ */
+template <typename Proposal>
+void createBlock(const Proposal &proposal) {
+  using shared_model::validation::MockValidator;
+  static shared_model::proto::ProtoBlockFactory factory(
+      std::make_unique<
+          testing::NiceMock<MockValidator<shared_model::interface::Block>>>(),
+      std::make_unique<
+          testing::NiceMock<MockValidator<iroha::protocol::Block>>>());
+  auto block = factory.unsafeCreateBlock(
+      2,
+      shared_model::crypto::Hash(""),
+      0,
+      proposal.transactions(),
+      std::vector<shared_model::interface::types::HashType>{});
+  checkLoop(*block);
+}
+
+/**
+ * Benchmark block creation from a proposal on the heap, the transactions of
+ * which are copied
+ */
+BENCHMARK_DEFINE_F(ProposalBenchmark, HeapToBlockTest)(benchmark::State &st) {
+  auto proposal = complete_builder.build();
+
+  for (auto _ : st) {
+    runBenchmark(st, [&proposal] { createBlock(proposal); });
+  }
+}
+
+/**
+ * Benchmark block creation from a proposal parsed into an arena, the
+ * transactions of which are referenced by the block
+ */
+BENCHMARK_DEFINE_F(ProposalBenchmark, ArenaToBlockTest)(benchmark::State &st) {
+  shared_model::proto::ArenaMessage<iroha::protocol::Proposal> proto_proposal;
+  proto_proposal->ParseFromString(
+      complete_builder.build().getTransport().SerializeAsString());
+  shared_model::proto::Proposal proposal(std::move(proto_proposal));
+
+  for (auto _ : st) {
+    runBenchmark(st, [&proposal] { createBlock(proposal); });
+  }
+}
+
+/**
+ * Benchmark transaction cloning, each clone is hashed as transactions are
+ * on their way through Torii, MST and ordering
+ */
+BENCHMARK_DEFINE_F(TransactionBenchmark, CloneTest)(benchmark::State &st) {
+  for (auto _ : st) {
+    runBenchmark(st, [this] {
+      auto copy = clone(*transaction);
+      benchmark::DoNotOptimize(copy->hash());
+      benchmark::DoNotOptimize(copy->reducedHash());
+    });
+  }
+}
+
 BENCHMARK_REGISTER_F(BlockBenchmark, MoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(BlockBenchmark, CloneTest)->UseManualTime();
 BENCHMARK_REGISTER_F(BlockBenchmark, TransportMoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(BlockBenchmark, TransportCopyTest)->UseManualTime();
+BENCHMARK_REGISTER_F(BlockBenchmark, ParseTest)->UseManualTime();
+BENCHMARK_REGISTER_F(BlockBenchmark, ArenaParseTest)->UseManualTime();
 BENCHMARK_REGISTER_F(ProposalBenchmark, MoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(ProposalBenchmark, TransportMoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(ProposalBenchmark, TransportCopyTest)->UseManualTime();
+BENCHMARK_REGISTER_F(ProposalBenchmark, HeapToBlockTest)->UseManualTime();
+BENCHMARK_REGISTER_F(ProposalBenchmark, ArenaToBlockTest)->UseManualTime();
+BENCHMARK_REGISTER_F(TransactionBenchmark, CloneTest)->UseManualTime();
 
 BENCHMARK_MAIN();
@@ -0,0 +1,426 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * The history queries read the block store through the transaction positions
+ * indexed in the database, so their cost depends on the length of the chain
+ * and on how the transactions of an account are spread over it. The purpose
+ * of these benchmarks is to measure the queries against a generated chain of
+ * a realistic length instead of an almost empty ledger.
+ *
+ * The argument of the benchmarks is the number of the blocks in the chain.
+ * The chain is generated once per length: every block contains transfers
+ * between the users, it is stored in the flat file block storage and indexed
+ * as a committed block would be. A PostgreSQL database is required, its
+ * credentials are taken from the environment as in the integration tests.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <map>
+
+#include <boost/filesystem.hpp>
+#include <rxcpp/rx-lite.hpp>
+#include <soci/soci.h>
+#include "ametsuchi/impl/flat_file_block_storage_factory.hpp"
+#include "ametsuchi/impl/postgres_block_index.hpp"
+#include "ametsuchi/impl/postgres_command_executor.hpp"
+#include "ametsuchi/impl/postgres_indexer.hpp"
+#include "ametsuchi/impl/postgres_specific_query_executor.hpp"
+#include "backend/plain/account_detail_record_id.hpp"
+#include "backend/protobuf/proto_block_json_converter.hpp"
+#include "backend/protobuf/proto_permission_to_string.hpp"
+#include "backend/protobuf/proto_query_response_factory.hpp"
+#include "backend/protobuf/queries/proto_query.hpp"
+#include "common/visitor.hpp"
+#include "framework/common_constants.hpp"
+#include "framework/test_db_manager.hpp"
+#include "framework/test_logger.hpp"
+#include "interfaces/query_responses/error_query_response.hpp"
+#include "logger/dummy_logger.hpp"
+#include "logger/logger_manager.hpp"
+#include "module/irohad/multi_sig_transactions/mst_test_helpers.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_query_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "pending_txs_storage/impl/pending_txs_storage_impl.hpp"
+
+using iroha::integration_framework::TestDbManager;
+using shared_model::interface::permissions::Role;
+
+namespace {
+  const std::string kDomain = "bench";
+  const std::string kAdmin = "admin@" + kDomain;
+  const std::string kAsset = "coin#" + kDomain;
+  const std::string kUserRole = "user";
+
+  /// users transferring the asset to each other in the chain
+  constexpr size_t kUsers = 100;
+  constexpr size_t kTransactionsPerBlock = 5;
+  /// details of the queried user and pending transactions of it
+  constexpr size_t kDetails = 100000;
+  constexpr size_t kPendingBatches = 1000;
+  /// transactions of a page of the paginated queries
+  constexpr size_t kPageSize = 100;
+  /// transactions of a GetTransactions query
+  constexpr size_t kRequestedHashes = 100;
+  /// blocks indexed in a single database transaction
+  constexpr size_t kIndexedTogether = 1000;
+
+  std::string userId(size_t index) {
+    return "user" + std::to_string(index) + "@" + kDomain;
+  }
+
+  /// queried user, whose transactions are spread over the whole chain
+  const std::string kUser = userId(0);
+
+  /// ledger of the given height with the query executor over it
+  struct Ledger {
+    std::unique_ptr<TestDbManager> db_manager;
+    boost::filesystem::path block_store_path;
+    std::unique_ptr<soci::session> sql;
+    std::unique_ptr<iroha::ametsuchi::BlockStorage> block_store;
+    std::shared_ptr<iroha::PendingTransactionStorage> pending_txs_storage;
+    std::unique_ptr<iroha::ametsuchi::PostgresSpecificQueryExecutor> executor;
+    /// hashes of the user's transactions, a sample of the whole chain
+    std::vector<shared_model::crypto::Hash> hashes;
+
+    ~Ledger() {
+      executor.reset();
+      block_store.reset();
+      boost::filesystem::remove_all(block_store_path);
+    }
+  };
+
+  iroha::expected::Result<void, std::string> createWsv(
+      TestDbManager &db_manager, soci::session &sql) {
+    iroha::ametsuchi::PostgresCommandExecutor executor(
+        db_manager.getSession(),
+        std::make_shared<shared_model::proto::ProtoPermissionToString>());
+    shared_model::interface::RolePermissionSet all_permissions;
+    all_permissions.setAll();
+    auto builder =
+        TestTransactionBuilder()
+            .creatorAccountId(kAdmin)
+            .createdTime(iroha::time::now())
+            .quorum(1)
+            .createRole("admin", all_permissions)
+            .createRole(kUserRole, {Role::kReceive, Role::kTransfer})
+            .createDomain(kDomain, kUserRole)
+            .createAsset("coin", kDomain, 2)
+            .createAccount("admin",
+                           kDomain,
+                           common_constants::kAdminKeypair.publicKey())
+            .appendRole(kAdmin, "admin");
+    for (size_t i = 0; i < kUsers; ++i) {
+      builder = builder.createAccount(
+          "user" + std::to_string(i),
+          kDomain,
+          common_constants::kUserKeypair.publicKey());
+    }
+    auto genesis = builder.build();
+    for (const auto &command : genesis.commands()) {
+      if (auto error = iroha::expected::resultToOptionalError(
+              executor.execute(command, kAdmin, false))) {
+        return iroha::expected::makeError(error->toString());
+      }
+    }
+
+    auto details = static_cast<long long>(kDetails);
+    try {
+      sql << "INSERT INTO account_detail (account_id, writer, key, value) "
+             "SELECT :account, :writer, 'key' || i, to_jsonb('value' || i) "
+             "FROM generate_series(0, :count - 1) i",
+          soci::use(kUser, "account"), soci::use(kAdmin, "writer"),
+          soci::use(details, "count");
+    } catch (const std::exception &e) {
+      return iroha::expected::makeError(e.what());
+    }
+    return {};
+  }
+
+  /// generate, store and index the chain, keeping a sample of the hashes
+  iroha::expected::Result<void, std::string> createChain(Ledger &ledger,
+                                                         size_t height) {
+    iroha::ametsuchi::PostgresBlockIndex block_index(
+        std::make_unique<iroha::ametsuchi::PostgresIndexer>(*ledger.sql),
+        logger::getDummyLoggerPtr());
+    auto prev_hash = shared_model::crypto::Hash(std::string(32, '0'));
+    size_t tx_number = 0;
+    try {
+      for (size_t block_height = 1; block_height <= height; ++block_height) {
+        std::vector<shared_model::proto::Transaction> transactions;
+        for (size_t i = 0; i < kTransactionsPerBlock; ++i, ++tx_number) {
+          // a prime step spreads the transfers of every user over the chain
+          auto source = userId(tx_number % kUsers);
+          auto destination = userId((tx_number * 7 + 1) % kUsers);
+          transactions.push_back(
+              TestTransactionBuilder()
+                  .creatorAccountId(source)
+                  .createdTime(iroha::time::now() + tx_number)
+                  .quorum(1)
+                  .transferAsset(source, destination, kAsset, "", "1.00")
+                  .build());
+          if (source == kUser) {
+            ledger.hashes.push_back(transactions.back().hash());
+          }
+        }
+        auto block = createBlock(transactions, block_height, prev_hash);
+        prev_hash = block->hash();
+        if (not ledger.block_store->insert(block)) {
+          return iroha::expected::makeError(
+              "Failed to store block " + std::to_string(block_height));
+        }
+
+        if (block_height % kIndexedTogether == 1) {
+          *ledger.sql << "BEGIN";
+        }
+        block_index.index(*block);
+        if (block_height % kIndexedTogether == 0 or block_height == height) {
+          *ledger.sql << "COMMIT";
+        }
+      }
+      *ledger.sql << "ANALYZE";
+    } catch (const std::exception &e) {
+      return iroha::expected::makeError(e.what());
+    }
+    return {};
+  }
+
+  std::shared_ptr<iroha::PendingTransactionStorage> createPendingStorage() {
+    auto completer =
+        std::make_shared<iroha::DefaultCompleter>(std::chrono::minutes(0));
+    auto state = std::make_shared<iroha::MstState>(
+        iroha::MstState::empty(logger::getDummyLoggerPtr(), completer));
+    for (size_t i = 0; i < kPendingBatches; ++i) {
+      *state += addSignatures(
+          makeTestBatch(txBuilder(2, iroha::time::now() + i, 2, kUser)),
+          0,
+          makeSignature("1", "pub_key_1"));
+    }
+    using Batch = std::shared_ptr<shared_model::interface::TransactionBatch>;
+    return std::make_shared<iroha::PendingTransactionStorageImpl>(
+        rxcpp::observable<>::just(state),
+        rxcpp::observable<>::empty<Batch>(),
+        rxcpp::observable<>::empty<Batch>(),
+        rxcpp::observable<>::empty<iroha::PendingTransactionStorageImpl::
+                                       PreparedTransactionDescriptor>());
+  }
+
+  iroha::expected::Result<std::unique_ptr<Ledger>, std::string> makeLedger(
+      size_t height) {
+    auto db_manager = TestDbManager::createWithRandomDbName(
+        2, getTestLoggerManager()->getChild("TestDbManager"));
+    if (auto error = iroha::expected::resultToOptionalError(db_manager)) {
+      return iroha::expected::makeError(*error);
+    }
+    auto ledger = std::make_unique<Ledger>();
+    ledger->db_manager = std::move(
+        iroha::expected::resultToOptionalValue(std::move(db_manager)).value());
+    ledger->sql = ledger->db_manager->getSession();
+
+    ledger->block_store_path = boost::filesystem::temp_directory_path()
+        / boost::filesystem::unique_path();
+    auto block_store_path = ledger->block_store_path.string();
+    ledger->block_store =
+        iroha::ametsuchi::FlatFileBlockStorageFactory(
+            [block_store_path] { return block_store_path; },
+            std::make_shared<shared_model::proto::ProtoBlockJsonConverter>(),
+            getTestLoggerManager()->getChild("BlockStorage"))
+            .create();
+    if (not ledger->block_store) {
+      return iroha::expected::makeError("Failed to create block storage");
+    }
+
+    if (auto error = iroha::expected::resultToOptionalError(
+            createWsv(*ledger->db_manager, *ledger->sql))) {
+      return iroha::expected::makeError(*error);
+    }
+    if (auto error = iroha::expected::resultToOptionalError(
+            createChain(*ledger, height))) {
+      return iroha::expected::makeError(*error);
+    }
+
+    ledger->pending_txs_storage = createPendingStorage();
+    ledger->executor =
+        std::make_unique<iroha::ametsuchi::PostgresSpecificQueryExecutor>(
+            *ledger->sql,
+            *ledger->block_store,
+            ledger->pending_txs_storage,
+            std::make_shared<shared_model::proto::ProtoQueryResponseFactory>(),
+            std::make_shared<shared_model::proto::ProtoPermissionToString>(),
+            logger::getDummyLoggerPtr());
+    return ledger;
+  }
+
+  /// ledgers by their heights, which are generated on the first use
+  std::map<size_t, std::unique_ptr<Ledger>> ledgers;
+}  // namespace
+
+class QueryExecutorBenchmark : public benchmark::Fixture {
+ public:
+  void SetUp(benchmark::State &st) override {
+    auto height = static_cast<size_t>(st.range(0));
+    auto &ledger = ledgers[height];
+    if (not ledger) {
+      auto result = makeLedger(height);
+      if (auto error = iroha::expected::resultToOptionalError(result)) {
+        st.SkipWithError(error->c_str());
+        return;
+      }
+      ledger = std::move(
+          iroha::expected::resultToOptionalValue(std::move(result)).value());
+    }
+    ledger_ = ledger.get();
+  }
+
+  void TearDown(benchmark::State &st) override {
+    ledger_ = nullptr;
+  }
+
+  /**
+   * Execute the query on every iteration
+   * @param make_query - makes the unsigned builder of the query from the
+   * builder with the creator and the ledger
+   */
+  template <typename MakeQuery>
+  void run(benchmark::State &st, MakeQuery make_query) {
+    if (not ledger_) {
+      return;
+    }
+    auto query = make_query(TestQueryBuilder()
+                                .creatorAccountId(kAdmin)
+                                .createdTime(iroha::time::now())
+                                .queryCounter(1),
+                            *ledger_)
+                     .build();
+
+    auto error = iroha::visit_in_place(
+        ledger_->executor->execute(query)->get(),
+        [](const shared_model::interface::ErrorQueryResponse &response) {
+          return boost::make_optional(response.toString());
+        },
+        [](const auto &) { return boost::optional<std::string>{}; });
+    if (error) {
+      st.SkipWithError(error->c_str());
+      return;
+    }
+
+    while (st.KeepRunning()) {
+      benchmark::DoNotOptimize(ledger_->executor->execute(query));
+    }
+  }
+
+ private:
+  Ledger *ledger_ = nullptr;
+};
+
+/// the first page of the user's transactions, which are the latest ones
+BENCHMARK_DEFINE_F(QueryExecutorBenchmark, GetAccountTransactions)
+(benchmark::State &st) {
+  run(st, [](auto builder, const Ledger &ledger) {
+    return builder.getAccountTransactions(kUser, kPageSize);
+  });
+}
+
+/// a page from the middle of the user's history
+BENCHMARK_DEFINE_F(QueryExecutorBenchmark, GetAccountTransactionsMiddlePage)
+(benchmark::State &st) {
+  run(st, [](auto builder, const Ledger &ledger) {
+    return builder.getAccountTransactions(
+        kUser, kPageSize, ledger.hashes[ledger.hashes.size() / 2]);
+  });
+}
+
+BENCHMARK_DEFINE_F(QueryExecutorBenchmark, GetAccountAssetTransactions)
+(benchmark::State &st) {
+  run(st, [](auto builder, const Ledger &ledger) {
+    return builder.getAccountAssetTransactions(kUser, kAsset, kPageSize);
+  });
+}
+
+BENCHMARK_DEFINE_F(QueryExecutorBenchmark,
+                   GetAccountAssetTransactionsMiddlePage)
+(benchmark::State &st) {
+  run(st, [](auto builder, const Ledger &ledger) {
+    return builder.getAccountAssetTransactions(
+        kUser, kAsset, kPageSize, ledger.hashes[ledger.hashes.size() / 2]);
+  });
+}
+
+/// the transactions spread evenly over the chain
+BENCHMARK_DEFINE_F(QueryExecutorBenchmark, GetTransactions)
+(benchmark::State &st) {
+  run(st, [](auto builder, const Ledger &ledger) {
+    std::vector<shared_model::crypto::Hash> hashes;
+    auto step = std::max<size_t>(ledger.hashes.size() / kRequestedHashes, 1);
+    for (size_t i = 0; i < ledger.hashes.size(); i += step) {
+      hashes.push_back(ledger.hashes[i]);
+    }
+    hashes.resize(std::min(hashes.size(), kRequestedHashes));
+    return builder.getTransactions(hashes);
+  });
+}
+
+BENCHMARK_DEFINE_F(QueryExecutorBenchmark, GetAccountDetail)
+(benchmark::State &st) {
+  run(st, [](auto builder, const Ledger &ledger) {
+    return builder.getAccountDetail(kPageSize, kUser);
+  });
+}
+
+/// a page of the details starting from the middle of them
+BENCHMARK_DEFINE_F(QueryExecutorBenchmark, GetAccountDetailMiddlePage)
+(benchmark::State &st) {
+  run(st, [](auto builder, const Ledger &ledger) {
+    return builder.getAccountDetail(
+        kPageSize,
+        kUser,
+        "",
+        "",
+        shared_model::plain::AccountDetailRecordId(
+            kAdmin, "key" + std::to_string(kDetails / 2)));
+  });
+}
+
+BENCHMARK_DEFINE_F(QueryExecutorBenchmark, GetPendingTransactions)
+(benchmark::State &st) {
+  run(st, [](auto builder, const Ledger &ledger) {
+    return builder.creatorAccountId(kUser).getPendingTransactions(kPageSize);
+  });
+}
+
+BENCHMARK_DEFINE_F(QueryExecutorBenchmark, GetBlock)
+(benchmark::State &st) {
+  run(st, [](auto builder, const Ledger &ledger) {
+    return builder.getBlock(ledger.block_store->size() / 2);
+  });
+}
+
+/// the lengths of the chain in blocks
+static void ChainHeights(benchmark::internal::Benchmark *b) {
+  b->Arg(100000)->Unit(benchmark::kMicrosecond);
+}
+
+BENCHMARK_REGISTER_F(QueryExecutorBenchmark, GetAccountTransactions)
+    ->Apply(ChainHeights);
+BENCHMARK_REGISTER_F(QueryExecutorBenchmark, GetAccountTransactionsMiddlePage)
+    ->Apply(ChainHeights);
+BENCHMARK_REGISTER_F(QueryExecutorBenchmark, GetAccountAssetTransactions)
+    ->Apply(ChainHeights);
+BENCHMARK_REGISTER_F(QueryExecutorBenchmark,
+                     GetAccountAssetTransactionsMiddlePage)
+    ->Apply(ChainHeights);
+BENCHMARK_REGISTER_F(QueryExecutorBenchmark, GetTransactions)
+    ->Apply(ChainHeights);
+BENCHMARK_REGISTER_F(QueryExecutorBenchmark, GetAccountDetail)
+    ->Apply(ChainHeights);
+BENCHMARK_REGISTER_F(QueryExecutorBenchmark, GetAccountDetailMiddlePage)
+    ->Apply(ChainHeights);
+BENCHMARK_REGISTER_F(QueryExecutorBenchmark, GetPendingTransactions)
+    ->Apply(ChainHeights);
+BENCHMARK_REGISTER_F(QueryExecutorBenchmark, GetBlock)->Apply(ChainHeights);
+
+BENCHMARK_MAIN();
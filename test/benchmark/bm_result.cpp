@@ -0,0 +1,79 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Benchmark of the chaining of the results on the success path, as it is
+ * done by the command execution and the validation.
+ *
+ * The purpose of this benchmark is to keep track of the copies of the
+ * values and errors made by the chaining, which are allocations for the
+ * values and errors with the heap storage.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/result.hpp"
+
+namespace {
+
+  struct Error {
+    uint32_t code;
+    std::string message;
+  };
+
+  using Values = std::vector<std::string>;
+  using ValuesResult = iroha::expected::Result<Values, Error>;
+  using VoidResult = iroha::expected::Result<void, Error>;
+
+  Values makeValues() {
+    return Values(16, std::string(64, 'v'));
+  }
+
+  void BM_BindChain(benchmark::State &state) {
+    auto values = makeValues();
+
+    for (auto _ : state) {
+      ValuesResult result = iroha::expected::makeValue(Values(values));
+      auto size = std::move(result) | [](Values v) -> ValuesResult {
+        return iroha::expected::makeValue(std::move(v));
+      } | [](Values v) -> ValuesResult {
+        return iroha::expected::makeValue(std::move(v));
+      } | [](Values v) {
+        return v.size();
+      };
+      benchmark::DoNotOptimize(size);
+    }
+  }
+
+  void BM_AndRes(benchmark::State &state) {
+    VoidResult first{};
+    ValuesResult second = iroha::expected::makeValue(makeValues());
+
+    for (auto _ : state) {
+      auto result = first.and_res(second);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+
+  void BM_MapError(benchmark::State &state) {
+    ValuesResult result = iroha::expected::makeValue(makeValues());
+
+    for (auto _ : state) {
+      auto mapped = iroha::expected::map_error<std::string>(
+          result, [](const Error &e) { return e.message; });
+      benchmark::DoNotOptimize(mapped);
+    }
+  }
+}  // namespace
+
+BENCHMARK(BM_BindChain);
+BENCHMARK(BM_AndRes);
+BENCHMARK(BM_MapError);
+
+BENCHMARK_MAIN();
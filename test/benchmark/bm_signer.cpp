@@ -0,0 +1,83 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Benchmarks of the signing throughput:
+ * - signer with the keypair in memory
+ * - pipelined signer over a device, which takes a millisecond per
+ * signature, with a varying number of the requests in flight
+ *
+ * The purpose of these benchmarks is to choose the pipeline depth for a
+ * hardware security module, and to compare it to the keys in memory.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <future>
+
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "cryptography/crypto_provider/keypair_signer.hpp"
+#include "cryptography/crypto_provider/pipelined_signer.hpp"
+
+using namespace shared_model::crypto;
+
+namespace {
+
+  /// signatures requested at once
+  constexpr size_t kRequests = 64;
+
+  /// latency of the simulated device
+  constexpr auto kDeviceLatency = std::chrono::milliseconds(1);
+
+  const Keypair &keypair() {
+    static const Keypair keypair =
+        DefaultCryptoAlgorithmType::generateKeypair();
+    return keypair;
+  }
+
+  /// request kRequests signatures and wait for all of them
+  void signAll(AsyncSigner &signer, const Blob &blob) {
+    std::vector<std::promise<Signed>> signatures(kRequests);
+    for (auto &signature : signatures) {
+      signer.sign(blob, [&signature](Signed signed_blob) {
+        signature.set_value(std::move(signed_blob));
+      });
+    }
+    for (auto &signature : signatures) {
+      benchmark::DoNotOptimize(signature.get_future().get());
+    }
+  }
+
+  void BM_KeypairSigner(benchmark::State &state) {
+    KeypairSigner<> signer(keypair());
+    Blob blob("vote payload");
+
+    for (auto _ : state) {
+      signAll(signer, blob);
+    }
+    state.SetItemsProcessed(state.iterations() * kRequests);
+  }
+
+  void BM_PipelinedSigner(benchmark::State &state) {
+    PipelinedSigner signer(
+        keypair().publicKey(),
+        [](const Blob &blob) {
+          std::this_thread::sleep_for(kDeviceLatency);
+          return DefaultCryptoAlgorithmType::sign(blob, keypair());
+        },
+        state.range(0));
+    Blob blob("vote payload");
+
+    for (auto _ : state) {
+      signAll(signer, blob);
+    }
+    state.SetItemsProcessed(state.iterations() * kRequests);
+  }
+}  // namespace
+
+BENCHMARK(BM_KeypairSigner);
+BENCHMARK(BM_PipelinedSigner)->Arg(1)->Arg(4)->Arg(16)->UseRealTime();
+
+BENCHMARK_MAIN();
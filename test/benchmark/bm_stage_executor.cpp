@@ -0,0 +1,94 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Benchmark of passing 10000 events from one thread to a pipeline stage on
+ * another thread: through observe_on with a new rxcpp thread, through
+ * observe_on with the stage executor, and by posting to the stage executor
+ * directly.
+ *
+ * The purpose of this benchmark is to compare the overhead of an emission
+ * between the threads of the pipeline, which is paid for every proposal,
+ * vote and commit. The events are handled as soon as they arrive, so the
+ * bounded queue of the executor does not make the producer wait.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <future>
+
+#include <rxcpp/rx-lite.hpp>
+#include "common/named_thread.hpp"
+#include "common/stage_executor.hpp"
+
+namespace {
+
+  /// number of events passed in an iteration
+  constexpr int kEvents = 10000;
+
+  /// capacity of the queue of the stage executor
+  constexpr size_t kQueueSize = 1024;
+
+  /// emit the events to the coordination and wait till all are handled
+  void emitEvents(benchmark::State &state,
+                  rxcpp::observe_on_one_worker coordination) {
+    for (auto _ : state) {
+      rxcpp::subjects::subject<int> subject;
+      std::promise<void> done;
+      int handled = 0;
+      auto subscription =
+          subject.get_observable().observe_on(coordination).subscribe(
+              [&](int) {
+                if (++handled == kEvents) {
+                  done.set_value();
+                }
+              });
+      auto subscriber = subject.get_subscriber();
+      for (int i = 0; i < kEvents; ++i) {
+        subscriber.on_next(i);
+      }
+      done.get_future().wait();
+      subscription.unsubscribe();
+    }
+    state.SetItemsProcessed(state.iterations() * kEvents);
+  }
+
+}  // namespace
+
+static void BM_ObserveOnNewThread(benchmark::State &state) {
+  emitEvents(state, iroha::observeOnNamedThread("bm-new-thread"));
+}
+
+static void BM_ObserveOnStageExecutor(benchmark::State &state) {
+  emitEvents(state,
+             iroha::observeOnExecutor(std::make_shared<iroha::StageExecutor>(
+                 "bm-stage", kQueueSize)));
+}
+
+static void BM_StageExecutorPost(benchmark::State &state) {
+  iroha::StageExecutor executor("bm-stage", kQueueSize);
+  for (auto _ : state) {
+    std::promise<void> done;
+    std::atomic<int> handled{0};
+    for (int i = 0; i < kEvents; ++i) {
+      executor.post([&] {
+        if (++handled == kEvents) {
+          done.set_value();
+        }
+      });
+    }
+    done.get_future().wait();
+  }
+  state.SetItemsProcessed(state.iterations() * kEvents);
+}
+
+BENCHMARK(BM_ObserveOnNewThread)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_ObserveOnStageExecutor)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_StageExecutorPost)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,51 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Benchmark of the construction of the command wrappers of a transaction
+ * with commands of mixed types, including the ones at the end of the
+ * command variant.
+ *
+ * The purpose of this benchmark is to keep track of the cost of selecting
+ * the wrapper type by the case of the command oneof, which is paid for
+ * every command of every transaction.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "backend/protobuf/commands/proto_command.hpp"
+#include "commands.pb.h"
+
+namespace {
+
+  std::vector<iroha::protocol::Command> mixedCommands() {
+    std::vector<iroha::protocol::Command> commands(8);
+    commands[0].mutable_add_asset_quantity()->set_asset_id("coin#test");
+    commands[1].mutable_transfer_asset()->set_src_account_id("admin@test");
+    commands[2].mutable_set_account_detail()->set_key("key");
+    commands[3].mutable_create_account()->set_account_name("account");
+    commands[4].mutable_grant_permission()->set_account_id("user@test");
+    commands[5].mutable_subtract_asset_quantity()->set_asset_id("coin#test");
+    commands[6].mutable_compare_and_set_account_detail()->set_key("key");
+    commands[7].mutable_set_setting_value()->set_key("setting");
+    return commands;
+  }
+
+  void BM_LoadCommands(benchmark::State &state) {
+    auto commands = mixedCommands();
+
+    for (auto _ : state) {
+      for (auto &command : commands) {
+        shared_model::proto::Command wrapper(command);
+        benchmark::DoNotOptimize(&wrapper.get());
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * commands.size());
+  }
+}  // namespace
+
+BENCHMARK(BM_LoadCommands);
+
+BENCHMARK_MAIN();
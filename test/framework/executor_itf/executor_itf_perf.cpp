@@ -0,0 +1,344 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "framework/executor_itf/executor_itf_perf.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#include <boost/variant/get.hpp>
+#include "framework/common_constants.hpp"
+#include "framework/executor_itf/executor_itf.hpp"
+#include "interfaces/permissions.hpp"
+#include "interfaces/query_responses/error_query_response.hpp"
+#include "interfaces/query_responses/query_response.hpp"
+#include "module/shared_model/mock_objects_factories/mock_command_factory.hpp"
+#include "module/shared_model/mock_objects_factories/mock_query_factory.hpp"
+
+using namespace iroha::integration_framework;
+using namespace iroha::expected;
+
+using shared_model::interface::Amount;
+using shared_model::interface::permissions::Role;
+
+namespace {
+  const std::string kPerfDomain = "perf";
+  const std::string kPerfRole = "perf_user";
+  const std::string kPerfAsset = "coin#" + kPerfDomain;
+  const Amount kInitialBalance{"1000.00"};
+  const Amount kOperationAmount{"0.01"};
+
+  std::string perfAccountName(size_t index) {
+    return "perf" + std::to_string(index);
+  }
+
+  std::string perfAccountId(size_t index) {
+    return perfAccountName(index) + "@" + kPerfDomain;
+  }
+
+  /// timed operation, which is built before the stage
+  class Operation {
+   public:
+    virtual ~Operation() = default;
+
+    /// @return whether the operation succeeded
+    virtual bool execute(const ExecutorItf &itf) const = 0;
+  };
+
+  template <typename SpecificCommand>
+  class CommandOperation : public Operation {
+   public:
+    CommandOperation(std::unique_ptr<SpecificCommand> specific_command,
+                     std::string account_id)
+        : specific_command_(std::move(specific_command)),
+          variant_(*specific_command_),
+          account_id_(std::move(account_id)) {
+      EXPECT_CALL(command_, get())
+          .WillRepeatedly(::testing::ReturnRef(variant_));
+    }
+
+    bool execute(const ExecutorItf &itf) const override {
+      return hasValue(
+          itf.executeCommandAsAccount(command_, account_id_, true));
+    }
+
+   private:
+    std::unique_ptr<SpecificCommand> specific_command_;
+    shared_model::interface::Command::CommandVariantType variant_;
+    shared_model::interface::MockCommand command_;
+    std::string account_id_;
+  };
+
+  template <typename SpecificQuery>
+  class QueryOperation : public Operation {
+   public:
+    QueryOperation(std::unique_ptr<SpecificQuery> specific_query,
+                   shared_model::interface::types::CounterType counter)
+        : specific_query_(std::move(specific_query)),
+          variant_(detail::getInterfaceQueryRef(*specific_query_)) {
+      EXPECT_CALL(query_, get()).WillRepeatedly(::testing::ReturnRef(variant_));
+      EXPECT_CALL(query_, creatorAccountId())
+          .WillRepeatedly(::testing::ReturnRef(common_constants::kAdminId));
+      EXPECT_CALL(query_, queryCounter())
+          .WillRepeatedly(::testing::Return(counter));
+      EXPECT_CALL(query_, hash())
+          .WillRepeatedly(::testing::ReturnRefOfCopy(
+              shared_model::interface::types::HashType{query_.toString()}));
+    }
+
+    bool execute(const ExecutorItf &itf) const override {
+      auto response = itf.executeQuery(query_);
+      return boost::strict_get<
+                 const shared_model::interface::ErrorQueryResponse &>(
+                 &response->get())
+          == nullptr;
+    }
+
+   private:
+    std::unique_ptr<SpecificQuery> specific_query_;
+    shared_model::interface::Query::QueryVariantType variant_;
+    shared_model::interface::MockQuery query_;
+  };
+
+  template <typename SpecificCommand>
+  std::unique_ptr<Operation> makeCommand(
+      std::unique_ptr<SpecificCommand> command, std::string account_id) {
+    return std::make_unique<CommandOperation<SpecificCommand>>(
+        std::move(command), std::move(account_id));
+  }
+
+  template <typename SpecificQuery>
+  std::unique_ptr<Operation> makeQuery(
+      std::unique_ptr<SpecificQuery> query,
+      shared_model::interface::types::CounterType counter) {
+    return std::make_unique<QueryOperation<SpecificQuery>>(std::move(query),
+                                                           counter);
+  }
+
+  /// collect the errors of the maintenance commands of a setup step
+  class Setup {
+   public:
+    explicit Setup(const ExecutorItf &itf) : itf_(itf) {}
+
+    template <typename SpecificCommand>
+    void operator()(const SpecificCommand &command) {
+      if (error_) {
+        return;
+      }
+      if (auto e = resultToOptionalError(
+              itf_.executeMaintenanceCommand(command))) {
+        error_ = e->toString();
+      }
+    }
+
+    Result<void, std::string> result() const {
+      if (error_) {
+        return makeError(*error_);
+      }
+      return {};
+    }
+
+   private:
+    const ExecutorItf &itf_;
+    boost::optional<std::string> error_;
+  };
+
+  Result<void, std::string> prepareDomain(const ExecutorItf &itf) {
+    const auto &factory = itf.getMockCommandFactory();
+    Setup setup(itf);
+    setup(*factory->constructCreateRole(
+        kPerfRole, {Role::kTransfer, Role::kReceive}));
+    setup(*factory->constructCreateDomain(kPerfDomain, kPerfRole));
+    setup(*factory->constructCreateAsset("coin", kPerfDomain, 2));
+    return setup.result();
+  }
+
+  /// create the accounts [begin, end) of the domain with their balances
+  Result<void, std::string> addAccounts(const ExecutorItf &itf,
+                                        size_t begin,
+                                        size_t end) {
+    const auto &factory = itf.getMockCommandFactory();
+    Setup setup(itf);
+    for (size_t i = begin; i < end; ++i) {
+      setup(*factory->constructCreateAccount(
+          perfAccountName(i),
+          kPerfDomain,
+          common_constants::kUserKeypair.publicKey()));
+      setup(*factory->constructAddAssetQuantity(kPerfAsset, kInitialBalance));
+      setup(*factory->constructTransferAsset(common_constants::kAdminId,
+                                             perfAccountId(i),
+                                             kPerfAsset,
+                                             "initial balance",
+                                             kInitialBalance));
+    }
+    return setup.result();
+  }
+
+  /**
+   * Build the mixed operations over the given number of accounts. A prime
+   * step spreads the accounts of the neighbouring operations over the WSV
+   */
+  std::vector<std::unique_ptr<Operation>> makeOperations(
+      const ExecutorItf &itf,
+      size_t accounts,
+      size_t quantity,
+      shared_model::interface::types::CounterType &query_counter) {
+    const auto &commands = itf.getMockCommandFactory();
+    const auto &queries = itf.getMockQueryFactory();
+    std::vector<std::unique_ptr<Operation>> operations;
+    operations.reserve(quantity);
+    for (size_t i = 0; i < quantity; ++i) {
+      auto account = perfAccountId(i * 7919 % accounts);
+      auto another_account = perfAccountId((i * 7919 + 1) % accounts);
+      switch (i % 6) {
+        case 0:
+          operations.push_back(
+              makeCommand(commands->constructTransferAsset(account,
+                                                           another_account,
+                                                           kPerfAsset,
+                                                           "",
+                                                           kOperationAmount),
+                          account));
+          break;
+        case 1:
+          operations.push_back(makeCommand(
+              commands->constructSetAccountDetail(
+                  account, "key", "value" + std::to_string(i)),
+              account));
+          break;
+        case 2:
+          operations.push_back(makeCommand(
+              commands->constructAddAssetQuantity(kPerfAsset,
+                                                  kOperationAmount),
+              common_constants::kAdminId));
+          break;
+        case 3:
+          operations.push_back(makeQuery(queries->constructGetAccount(account),
+                                         ++query_counter));
+          break;
+        case 4:
+          operations.push_back(makeQuery(
+              queries->constructGetAccountAssets(account, boost::none),
+              ++query_counter));
+          break;
+        default:
+          operations.push_back(
+              makeQuery(queries->constructGetAccountDetail(
+                            account, boost::none, boost::none, boost::none),
+                        ++query_counter));
+          break;
+      }
+    }
+    return operations;
+  }
+
+  PerfStageReport runStage(
+      const ExecutorItf &itf,
+      const std::vector<std::unique_ptr<Operation>> &operations) {
+    PerfStageReport report;
+    report.operations = operations.size();
+    std::vector<std::chrono::nanoseconds> latencies;
+    latencies.reserve(operations.size());
+    for (const auto &operation : operations) {
+      auto begin = std::chrono::steady_clock::now();
+      bool succeeded = operation->execute(itf);
+      latencies.push_back(std::chrono::steady_clock::now() - begin);
+      report.total += latencies.back();
+      if (not succeeded) {
+        ++report.failures;
+      }
+    }
+    if (not latencies.empty()) {
+      std::sort(latencies.begin(), latencies.end());
+      report.median = latencies[latencies.size() / 2];
+      report.p99 = latencies[latencies.size() * 99 / 100];
+      report.max = latencies.back();
+    }
+    return report;
+  }
+
+  std::string formatDuration(std::chrono::nanoseconds duration) {
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(2)
+           << std::chrono::duration<double, std::milli>(duration).count()
+           << "ms";
+    return stream.str();
+  }
+}  // namespace
+
+double PerfStageReport::throughput() const {
+  auto seconds = std::chrono::duration<double>(total).count();
+  return seconds > 0 ? operations / seconds : 0;
+}
+
+Result<std::vector<PerfStageReport>, std::string>
+iroha::integration_framework::runPerfWorkload(const ExecutorItf &itf,
+                                              const PerfWorkload &workload) {
+  if (auto e = resultToOptionalError(prepareDomain(itf))) {
+    return makeError("Could not prepare the domain: " + *e);
+  }
+  std::vector<PerfStageReport> reports;
+  shared_model::interface::types::CounterType query_counter = 0;
+  size_t accounts = 0;
+  for (size_t stage = 0; stage < workload.stages; ++stage) {
+    auto begin = accounts;
+    accounts += workload.accounts_per_stage;
+    if (auto e = resultToOptionalError(addAccounts(itf, begin, accounts))) {
+      return makeError("Could not add the accounts: " + *e);
+    }
+    if (accounts == 0) {
+      continue;
+    }
+    auto operations = makeOperations(
+        itf, accounts, workload.operations_per_stage, query_counter);
+    reports.push_back(runStage(itf, operations));
+    reports.back().accounts = accounts;
+  }
+  return reports;
+}
+
+std::string iroha::integration_framework::formatPerfRuns(
+    const std::vector<PerfRun> &runs) {
+  constexpr int kColumn = 40;
+  std::ostringstream stream;
+  stream << std::left << std::setw(10) << "accounts";
+  for (const auto &run : runs) {
+    stream << std::setw(kColumn) << run.first;
+  }
+  stream << "\n" << std::setw(10) << "";
+  for (size_t i = 0; i < runs.size(); ++i) {
+    stream << std::setw(kColumn) << "ops/s median p99 max failed";
+  }
+  stream << "\n";
+
+  size_t stages = 0;
+  for (const auto &run : runs) {
+    stages = std::max(stages, run.second.size());
+  }
+  for (size_t stage = 0; stage < stages; ++stage) {
+    // the workload is the same for all the runs, so are the state sizes
+    auto with_stage = std::find_if(
+        runs.begin(), runs.end(), [stage](const auto &run) {
+          return stage < run.second.size();
+        });
+    stream << std::setw(10) << with_stage->second[stage].accounts;
+    for (const auto &run : runs) {
+      if (stage >= run.second.size()) {
+        stream << std::setw(kColumn) << "-";
+        continue;
+      }
+      const auto &report = run.second[stage];
+      std::ostringstream cell;
+      cell << std::fixed << std::setprecision(0) << report.throughput() << " "
+           << formatDuration(report.median) << " "
+           << formatDuration(report.p99) << " " << formatDuration(report.max)
+           << " " << report.failures;
+      stream << std::setw(kColumn) << cell.str();
+    }
+    stream << "\n";
+  }
+  return stream.str();
+}
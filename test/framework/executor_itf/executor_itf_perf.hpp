@@ -0,0 +1,78 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TEST_FRAMEWORK_EXECUTOR_ITF_PERF_HPP
+#define IROHA_TEST_FRAMEWORK_EXECUTOR_ITF_PERF_HPP
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/result.hpp"
+
+namespace iroha {
+  namespace integration_framework {
+
+    class ExecutorItf;
+
+    /**
+     * Scripted workload of the performance mode. It is the same for every
+     * backend, so the backends are compared by their executors only. The
+     * workload runs in stages, every stage adds the accounts to the WSV and
+     * then executes the timed mix of the commands and the queries over all
+     * the accounts created so far
+     */
+    struct PerfWorkload {
+      /// number of the stages
+      size_t stages = 4;
+      /// accounts added to the WSV before each stage
+      size_t accounts_per_stage = 250;
+      /// timed commands and queries of each stage
+      size_t operations_per_stage = 1200;
+    };
+
+    /// Measurements of a single stage of the workload
+    struct PerfStageReport {
+      /// number of the accounts in the WSV during the stage
+      size_t accounts = 0;
+      /// number of the executed operations
+      size_t operations = 0;
+      /// number of the operations which returned an error
+      size_t failures = 0;
+      /// time of all the operations of the stage
+      std::chrono::nanoseconds total{0};
+      /// latencies of the operations
+      std::chrono::nanoseconds median{0};
+      std::chrono::nanoseconds p99{0};
+      std::chrono::nanoseconds max{0};
+
+      /// @return executed operations per second
+      double throughput() const;
+    };
+
+    /// Reports of the stages of a workload run with a named backend
+    using PerfRun = std::pair<std::string, std::vector<PerfStageReport>>;
+
+    /**
+     * Run the workload with the executors of the given ExecutorItf, whose
+     * WSV is expected to contain only the state prepared by ExecutorItf
+     * itself. Only the execution of the timed operations is measured, they
+     * are built before the stage
+     * @return the reports of the stages or the error of the state setup
+     */
+    iroha::expected::Result<std::vector<PerfStageReport>, std::string>
+    runPerfWorkload(const ExecutorItf &itf, const PerfWorkload &workload);
+
+    /**
+     * Format the reports of the backends side by side, a row per stage with
+     * the throughput and the latencies of every backend
+     */
+    std::string formatPerfRuns(const std::vector<PerfRun> &runs);
+
+  }  // namespace integration_framework
+}  // namespace iroha
+
+#endif  // IROHA_TEST_FRAMEWORK_EXECUTOR_ITF_PERF_HPP
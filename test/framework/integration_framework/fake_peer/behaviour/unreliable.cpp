@@ -0,0 +1,51 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "framework/integration_framework/fake_peer/behaviour/unreliable.hpp"
+
+#include <thread>
+
+namespace integration_framework {
+  namespace fake_peer {
+
+    UnreliableBehaviour::UnreliableBehaviour(
+        std::chrono::milliseconds latency,
+        double loss_probability,
+        std::mt19937::result_type seed)
+        : latency_(latency), loss_(loss_probability), random_(seed) {}
+
+    void UnreliableBehaviour::processYacMessage(
+        std::shared_ptr<const YacMessage> message) {
+      if (deliver()) {
+        HonestBehaviour::processYacMessage(std::move(message));
+      }
+    }
+
+    OrderingProposalRequestResult
+    UnreliableBehaviour::processOrderingProposalRequest(
+        const OrderingProposalRequest &request) {
+      if (deliver()) {
+        return HonestBehaviour::processOrderingProposalRequest(request);
+      }
+      return {};
+    }
+
+    void UnreliableBehaviour::processOrderingBatches(
+        const BatchesCollection &batches) {
+      if (deliver()) {
+        HonestBehaviour::processOrderingBatches(batches);
+      }
+    }
+
+    bool UnreliableBehaviour::deliver() {
+      if (latency_.count() > 0) {
+        std::this_thread::sleep_for(latency_);
+      }
+      std::lock_guard<std::mutex> lock(random_mutex_);
+      return not loss_(random_);
+    }
+
+  }  // namespace fake_peer
+}  // namespace integration_framework
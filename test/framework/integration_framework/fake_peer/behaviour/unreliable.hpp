@@ -0,0 +1,55 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INTEGRATION_FRAMEWORK_FAKE_PEER_BEHAVIOUR_UNRELIABLE_HPP_
+#define INTEGRATION_FRAMEWORK_FAKE_PEER_BEHAVIOUR_UNRELIABLE_HPP_
+
+#include "framework/integration_framework/fake_peer/behaviour/honest.hpp"
+
+#include <chrono>
+#include <mutex>
+#include <random>
+
+namespace integration_framework {
+  namespace fake_peer {
+
+    /**
+     * Honest behaviour behind a bad link: the consensus and ordering
+     * messages are delayed by the given latency and dropped with the given
+     * probability. The delay is taken on the thread handling the message, so
+     * the responses to the real peer are delayed too.
+     */
+    class UnreliableBehaviour : public HonestBehaviour {
+     public:
+      /**
+       * @param latency - delay of every message
+       * @param loss_probability - probability in [0, 1] to drop a message
+       * @param seed - seed of the drop decisions, to repeat a run
+       */
+      UnreliableBehaviour(std::chrono::milliseconds latency,
+                          double loss_probability,
+                          std::mt19937::result_type seed =
+                              std::mt19937::default_seed);
+
+      void processYacMessage(
+          std::shared_ptr<const YacMessage> message) override;
+      OrderingProposalRequestResult processOrderingProposalRequest(
+          const OrderingProposalRequest &request) override;
+      void processOrderingBatches(const BatchesCollection &batches) override;
+
+     private:
+      /// delay the current message and decide whether it is delivered
+      bool deliver();
+
+      std::chrono::milliseconds latency_;
+      std::bernoulli_distribution loss_;
+      std::mutex random_mutex_;
+      std::mt19937 random_;
+    };
+
+  }  // namespace fake_peer
+}  // namespace integration_framework
+
+#endif /* INTEGRATION_FRAMEWORK_FAKE_PEER_BEHAVIOUR_UNRELIABLE_HPP_ */
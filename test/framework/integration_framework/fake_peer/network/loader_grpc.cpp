@@ -100,6 +100,10 @@ namespace integration_framework {
       }
       auto blocks = behaviour->processLoaderBlocksRequest(height);
       for (auto &block : blocks) {
+        if (request->last_height() != 0
+            and block->height() > request->last_height()) {
+          break;
+        }
         iroha::protocol::Block proto_block;
         *proto_block.mutable_block_v1() = block->getTransport();
         writer->Write(proto_block);
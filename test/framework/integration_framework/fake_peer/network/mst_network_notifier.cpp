@@ -16,6 +16,11 @@ namespace integration_framework {
           std::make_shared<MstMessage>(from, std::move(new_state)));
     }
 
+    bool MstNetworkNotifier::isMissing(const iroha::BatchDigest &) const {
+      // the fake peer keeps no state, so it pulls everything it is offered
+      return true;
+    }
+
     rxcpp::observable<std::shared_ptr<MstMessage>>
     MstNetworkNotifier::getObservable() {
       return mst_subject_.get_observable();
@@ -23,6 +23,8 @@ namespace integration_framework {
       void onNewState(const shared_model::crypto::PublicKey &from,
                       iroha::MstState new_state) override;
 
+      bool isMissing(const iroha::BatchDigest &digest) const override;
+
       rxcpp::observable<std::shared_ptr<MstMessage>> getObservable();
 
      private:
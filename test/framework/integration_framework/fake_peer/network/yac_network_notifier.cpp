@@ -5,6 +5,7 @@
 
 #include "framework/integration_framework/fake_peer/network/yac_network_notifier.hpp"
 
+#include "consensus/yac/commit_certificate.hpp"
 #include "consensus/yac/transport/impl/network_impl.hpp"
 #include "consensus/yac/transport/yac_network_interface.hpp"
 #include "consensus/yac/vote_message.hpp"
@@ -18,6 +19,9 @@ namespace integration_framework {
       votes_subject_.get_subscriber().on_next(state_ptr);
     }
 
+    void YacNetworkNotifier::onCertificate(
+        iroha::consensus::yac::CommitCertificate certificate) {}
+
     rxcpp::observable<std::shared_ptr<const YacMessage>>
     YacNetworkNotifier::getObservable() {
       return votes_subject_.get_observable();
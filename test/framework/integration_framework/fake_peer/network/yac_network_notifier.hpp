@@ -23,6 +23,10 @@ namespace integration_framework {
 
       void onState(StateMessage state) override;
 
+      /// fake peer does not keep the cluster order, certificates are dropped
+      void onCertificate(
+          iroha::consensus::yac::CommitCertificate certificate) override;
+
       rxcpp::observable<std::shared_ptr<const YacMessage>> getObservable();
 
      private:
@@ -110,6 +110,50 @@ namespace integration_framework {
         key_pair,
         max_rounds_delay_,
         stale_stream_max_rounds_,
+        false,
+        0ms,
+        0,
+        1,
+        boost::none,
+        false,
+        0,
+        false,
+        boost::none,
+        boost::none,
+        false,
+        boost::none,
+        0,
+        false,
+        0,
+        false,
+        0,
+        3,
+        0,
+        0,
+        0,
+        0,
+        0,
+        false,
+        1,
+        0,
+        0,
+        0,
+        "",
+        0,
+        1,
+        0,
+        false,
+        1,
+        nullptr,
+        0,
+        0,
+        1,
+        boost::none,
+        boost::none,
+        boost::none,
+        1,
+        false,
+        nullptr,
         boost::none,
         irohad_log_manager_,
         log_,
@@ -28,6 +28,55 @@ namespace integration_framework {
                const shared_model::crypto::Keypair &keypair,
                std::chrono::milliseconds max_rounds_delay,
                size_t stale_stream_max_rounds,
+               bool proposal_streaming,
+               std::chrono::milliseconds batch_flush_delay,
+               size_t batch_flush_size,
+               size_t batch_validation_workers,
+               boost::optional<IrohadConfig::AdaptiveProposalSize>
+                   adaptive_proposal_size,
+               bool yac_commit_certificates,
+               size_t yac_gossip_fanout,
+               bool pipelined_consensus,
+               boost::optional<IrohadConfig::AdaptiveVoteDelay>
+                   adaptive_vote_delay,
+               boost::optional<uint16_t> metrics_port,
+               bool segmented_block_store,
+               boost::optional<int32_t> block_store_compression_level,
+               size_t block_cache_size,
+               bool fast_wsv_restore,
+               size_t wsv_cache_size,
+               bool async_history_index,
+               size_t query_cache_size,
+               size_t db_pool_size,
+               size_t db_query_pool_size,
+               size_t db_restore_pool_size,
+               size_t stateful_validation_workers,
+               size_t block_loader_max_streams,
+               size_t block_loader_bandwidth,
+               bool torii_async_streams,
+               size_t status_bus_workers,
+               size_t torii_tx_rate_limit,
+               size_t torii_account_tx_rate_limit,
+               size_t torii_max_pending_txs,
+               std::string mst_journal_path,
+               size_t memory_budget,
+               size_t inter_peer_client_threads,
+               size_t inter_peer_max_calls,
+               bool transactions_root,
+               size_t pg_block_flush_size,
+               std::shared_ptr<iroha::maintenance::BlockExporter>
+                   block_exporter,
+               size_t pipeline_queue_size,
+               size_t proposal_hedge_percentile,
+               size_t block_sync_interval,
+               boost::optional<IrohadConfig::PeerCompression>
+                   peer_compression,
+               boost::optional<IrohadConfig::FairQueuing> fair_queuing,
+               boost::optional<IrohadConfig::BlockArchive> block_archive,
+               size_t torii_server_instances,
+               bool observer,
+               std::shared_ptr<iroha::maintenance::TrafficCapture>
+                   traffic_capture,
                boost::optional<shared_model::interface::types::PeerList>
                    opt_alternative_peers,
                logger::LoggerManagerTreePtr irohad_log_manager,
@@ -48,6 +97,50 @@ namespace integration_framework {
                  keypair,
                  max_rounds_delay,
                  stale_stream_max_rounds,
+                 proposal_streaming,
+                 batch_flush_delay,
+                 batch_flush_size,
+                 batch_validation_workers,
+                 adaptive_proposal_size,
+                 yac_commit_certificates,
+                 yac_gossip_fanout,
+                 pipelined_consensus,
+                 adaptive_vote_delay,
+                 metrics_port,
+                 segmented_block_store,
+                 block_store_compression_level,
+                 block_cache_size,
+                 fast_wsv_restore,
+                 wsv_cache_size,
+                 async_history_index,
+                 query_cache_size,
+                 db_pool_size,
+                 db_query_pool_size,
+                 db_restore_pool_size,
+                 stateful_validation_workers,
+                 block_loader_max_streams,
+                 block_loader_bandwidth,
+                 torii_async_streams,
+                 status_bus_workers,
+                 torii_tx_rate_limit,
+                 torii_account_tx_rate_limit,
+                 torii_max_pending_txs,
+                 mst_journal_path,
+                 memory_budget,
+                 inter_peer_client_threads,
+                 inter_peer_max_calls,
+                 transactions_root,
+                 pg_block_flush_size,
+                 std::move(block_exporter),
+                 pipeline_queue_size,
+                 proposal_hedge_percentile,
+                 block_sync_interval,
+                 std::move(peer_compression),
+                 std::move(fair_queuing),
+                 std::move(block_archive),
+                 torii_server_instances,
+                 observer,
+                 std::move(traffic_capture),
                  std::move(opt_alternative_peers),
                  std::move(irohad_log_manager),
                  opt_mst_gossip_params,
@@ -15,6 +15,7 @@
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
 #include "logger/dummy_logger.hpp"
 #include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+#include "module/irohad/ametsuchi/mock_wsv_snapshot_factory.hpp"
 #include "module/shared_model/builders/protobuf/test_block_builder.hpp"
 #include "network/impl/block_loader_service.hpp"
 
@@ -36,14 +37,20 @@ namespace fuzzing {
       block_cache_ = std::make_shared<iroha::consensus::ConsensusResultCache>();
       block_loader_service_ =
           std::make_shared<iroha::network::BlockLoaderService>(
-              block_query_factory_, block_cache_, logger::getDummyLoggerPtr());
+              block_query_factory_,
+              block_cache_,
+              std::make_shared<
+                  NiceMock<iroha::ametsuchi::MockWsvSnapshotFactory>>(),
+              logger::getDummyLoggerPtr());
       EXPECT_CALL(*block_query_factory_, createBlockQuery())
           .WillRepeatedly(Return(boost::make_optional(
               std::shared_ptr<iroha::ametsuchi::BlockQuery>(storage_))));
-      EXPECT_CALL(*storage_, getBlock(_)).WillRepeatedly(Invoke([](auto) {
-        return iroha::expected::makeValue(
-            clone<shared_model::interface::Block>(TestBlockBuilder().build()));
-      }));
+      EXPECT_CALL(*storage_, getSerializedBlock(_))
+          .WillRepeatedly(Invoke([](auto) {
+            return iroha::expected::makeValue(
+                shared_model::crypto::toBinaryString(
+                    TestBlockBuilder().build().blob()));
+          }));
     }
   };
 
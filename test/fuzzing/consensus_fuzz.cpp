@@ -16,6 +16,7 @@
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
 #include "framework/test_logger.hpp"
 #include "fuzzing/grpc_servercontext_dtor_segv_workaround.hpp"
+#include "fuzzing/performance_budget.hpp"
 #include "logger/dummy_logger.hpp"
 #include "logger/logger_manager.hpp"
 #include "module/irohad/common/validators_config.hpp"
@@ -110,6 +111,7 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, std::size_t size) {
     return 0;
   }
 
+  fuzzing::PerformanceBudget budget(size);
   iroha::consensus::yac::proto::State request;
   if (protobuf_mutator::libfuzzer::LoadProtoInput(true, data, size, &request)) {
     grpc::ServerContext context;
@@ -9,6 +9,7 @@
 #include <memory>
 #include "backend/protobuf/proto_query_response_factory.hpp"
 #include "backend/protobuf/proto_transport_factory.hpp"
+#include "fuzzing/performance_budget.hpp"
 #include "libfuzzer/libfuzzer_macro.h"
 #include "logger/dummy_logger.hpp"
 #include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
@@ -85,6 +86,7 @@ struct QueryFixture {
 
 DEFINE_BINARY_PROTO_FUZZER(const iroha::protocol::Query &qry) {
   static QueryFixture handler;
+  fuzzing::PerformanceBudget budget(qry.ByteSizeLong());
   iroha::protocol::QueryResponse resp;
   handler.service_->Find(nullptr, &qry, &resp);
 }
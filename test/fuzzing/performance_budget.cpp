@@ -0,0 +1,116 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "fuzzing/performance_budget.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+
+extern "C" {
+// provided by the sanitizer runtimes only
+int __sanitizer_install_malloc_and_free_hooks(
+    void (*malloc_hook)(const volatile void *, size_t),
+    void (*free_hook)(const volatile void *)) __attribute__((weak));
+}
+
+namespace {
+  std::atomic<uint64_t> allocations{0};
+
+  void countAllocation(const volatile void *, size_t) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void ignoreFree(const volatile void *) {}
+
+  struct Budget {
+    bool check_time;
+    double ns_per_byte;
+    double base_ns;
+    bool check_allocations;
+    double allocations_per_byte;
+    double base_allocations;
+  };
+
+  double readLimit(const char *name, bool *set) {
+    const char *value = std::getenv(name);
+    if (set) {
+      *set = value != nullptr;
+    }
+    return value ? std::atof(value) : 0.;
+  }
+
+  const Budget &budget() {
+    static const Budget budget = [] {
+      Budget result{};
+      result.ns_per_byte =
+          readLimit("IROHA_FUZZ_NS_PER_BYTE", &result.check_time);
+      result.base_ns = readLimit("IROHA_FUZZ_BASE_NS", nullptr);
+      result.allocations_per_byte = readLimit("IROHA_FUZZ_ALLOCS_PER_BYTE",
+                                              &result.check_allocations);
+      result.base_allocations = readLimit("IROHA_FUZZ_BASE_ALLOCS", nullptr);
+      if (result.check_allocations) {
+        if (__sanitizer_install_malloc_and_free_hooks) {
+          __sanitizer_install_malloc_and_free_hooks(countAllocation,
+                                                    ignoreFree);
+        } else {
+          std::fprintf(stderr,
+                       "IROHA_FUZZ_ALLOCS_PER_BYTE is ignored without a "
+                       "sanitizer runtime\n");
+          result.check_allocations = false;
+        }
+      }
+      return result;
+    }();
+    return budget;
+  }
+}  // namespace
+
+namespace fuzzing {
+
+  PerformanceBudget::PerformanceBudget(size_t size)
+      : size_(size),
+        start_(std::chrono::steady_clock::now()),
+        allocations_(allocations.load(std::memory_order_relaxed)) {
+    // the hooks are installed before the first measured input
+    budget();
+  }
+
+  PerformanceBudget::~PerformanceBudget() {
+    const auto &limits = budget();
+    if (limits.check_time) {
+      const double elapsed =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+              std::chrono::steady_clock::now() - start_)
+              .count();
+      const double limit = limits.base_ns + limits.ns_per_byte * size_;
+      if (elapsed > limit) {
+        std::fprintf(stderr,
+                     "==PERFORMANCE BUDGET== %zu byte input took %.0f ns, "
+                     "the budget is %.0f ns\n",
+                     size_,
+                     elapsed,
+                     limit);
+        std::abort();
+      }
+    }
+    if (limits.check_allocations) {
+      const double count =
+          allocations.load(std::memory_order_relaxed) - allocations_;
+      const double limit =
+          limits.base_allocations + limits.allocations_per_byte * size_;
+      if (count > limit) {
+        std::fprintf(stderr,
+                     "==PERFORMANCE BUDGET== %zu byte input made %.0f "
+                     "allocations, the budget is %.0f\n",
+                     size_,
+                     count,
+                     limit);
+        std::abort();
+      }
+    }
+  }
+
+}  // namespace fuzzing
@@ -0,0 +1,49 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_FUZZING_PERFORMANCE_BUDGET_HPP
+#define IROHA_FUZZING_PERFORMANCE_BUDGET_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace fuzzing {
+
+  /**
+   * Checks that processing of a fuzzer input fits a budget linear in the
+   * input size, so the inputs triggering the algorithmic complexity blowups
+   * are reported like the crashes. The budget is set by the environment:
+   *
+   *   IROHA_FUZZ_NS_PER_BYTE      wall time per input byte, in nanoseconds
+   *   IROHA_FUZZ_ALLOCS_PER_BYTE  heap allocations per input byte
+   *   IROHA_FUZZ_BASE_NS          wall time allowed for any input
+   *   IROHA_FUZZ_BASE_ALLOCS      allocations allowed for any input
+   *
+   * A limit is not checked when its per byte variable is not set, so by
+   * default the harnesses detect only the crashes. An input over the budget
+   * aborts the process, and libFuzzer saves it as a crash artifact.
+   * Allocations are counted with the sanitizer allocator hooks, so they are
+   * checked only in the sanitized builds.
+   */
+  class PerformanceBudget {
+   public:
+    /// @param size - size of the input in bytes
+    explicit PerformanceBudget(size_t size);
+
+    ~PerformanceBudget();
+
+    PerformanceBudget(const PerformanceBudget &) = delete;
+    PerformanceBudget &operator=(const PerformanceBudget &) = delete;
+
+   private:
+    size_t size_;
+    std::chrono::steady_clock::time_point start_;
+    uint64_t allocations_;
+  };
+
+}  // namespace fuzzing
+
+#endif  // IROHA_FUZZING_PERFORMANCE_BUDGET_HPP
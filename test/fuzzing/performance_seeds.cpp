@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <boost/filesystem.hpp>
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "datetime/time.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "mst.pb.h"
+#include "ordering.pb.h"
+
+/**
+ * Writes the seed corpora of the inputs which are expensive to process per
+ * byte, so the fuzzers run with a performance budget start the search for the
+ * complexity blowups from them:
+ *
+ *   send_batches_fuzz/many_tiny_batches  thousands of one transaction batches
+ *   mst_fuzz/equal_created_time          pending transactions created at once
+ *   mst_fuzz/descending_created_time     each transaction expires before the
+ *                                        previous ones
+ *
+ * Usage: performance_seeds <corpus directory>
+ */
+
+namespace {
+  const size_t kTransactions = 2000;
+  const auto kCreatorId = "admin@test";
+
+  auto makeTransaction(size_t index,
+                       shared_model::interface::types::TimestampType time,
+                       shared_model::interface::types::QuorumType quorum,
+                       const shared_model::crypto::Keypair &keypair) {
+    return TestUnsignedTransactionBuilder()
+        .creatorAccountId(kCreatorId)
+        .createdTime(time)
+        .setAccountDetail(kCreatorId, "seed", std::to_string(index))
+        .quorum(quorum)
+        .build()
+        .signAndAddSignature(keypair)
+        .finish()
+        .getTransport();
+  }
+
+  bool write(const boost::filesystem::path &path,
+             const std::string &prefix,
+             const google::protobuf::Message &message) {
+    boost::filesystem::create_directories(path.parent_path());
+    std::ofstream file(path.string(), std::ios::binary);
+    file << prefix << message.SerializeAsString();
+    if (not file) {
+      std::cerr << "Failed to write " << path << std::endl;
+      return false;
+    }
+    std::cout << "Wrote " << path << std::endl;
+    return true;
+  }
+}  // namespace
+
+int main(int argc, char **argv) {
+  if (argc != 2) {
+    std::cerr << "Usage: " << argv[0] << " <corpus directory>" << std::endl;
+    return 1;
+  }
+  const boost::filesystem::path corpus(argv[1]);
+  const auto keypair =
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+  const auto now = iroha::time::now();
+
+  iroha::ordering::proto::BatchesRequest batches;
+  for (size_t i = 0; i < kTransactions; ++i) {
+    *batches.add_transactions() = makeTransaction(i, now, 1, keypair);
+  }
+
+  // quorum of the pending transactions is not reached by one signature
+  iroha::network::transport::MstState equal_time;
+  iroha::network::transport::MstState descending_time;
+  for (size_t i = 0; i < kTransactions; ++i) {
+    *equal_time.add_transactions() = makeTransaction(i, now, 2, keypair);
+    *descending_time.add_transactions() =
+        makeTransaction(i, now - i, 2, keypair);
+  }
+
+  // the first byte of the ordering service input is the transaction limit
+  const std::string max_limit(1, '\xff');
+  bool written =
+      write(corpus / "send_batches_fuzz" / "many_tiny_batches",
+            max_limit,
+            batches)
+      and write(corpus / "mst_fuzz" / "equal_created_time", {}, equal_time)
+      and write(corpus / "mst_fuzz" / "descending_created_time",
+                {},
+                descending_time);
+  return written ? 0 : 1;
+}
@@ -8,6 +8,7 @@
 #include "ametsuchi/impl/tx_presence_cache_impl.hpp"
 #include "backend/protobuf/proto_proposal_factory.hpp"
 #include "fuzzing/grpc_servercontext_dtor_segv_workaround.hpp"
+#include "fuzzing/performance_budget.hpp"
 #include "logger/dummy_logger.hpp"
 #include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
 #include "module/irohad/ordering/mock_proposal_creation_strategy.hpp"
@@ -43,6 +44,7 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, std::size_t size) {
                                              fixture.transaction_batch_factory_,
                                              logger::getDummyLoggerPtr());
 
+  fuzzing::PerformanceBudget budget(size);
   proto::BatchesRequest request;
   if (protobuf_mutator::libfuzzer::LoadProtoInput(
           true, data + 1, size - 1, &request)) {
@@ -12,6 +12,7 @@
 #include "backend/protobuf/proto_transport_factory.hpp"
 #include "backend/protobuf/proto_tx_status_factory.hpp"
 #include "backend/protobuf/transaction.hpp"
+#include "fuzzing/performance_budget.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory_impl.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
 #include "logger/dummy_logger.hpp"
@@ -142,5 +143,6 @@ struct CommandFixture {
 
 DEFINE_BINARY_PROTO_FUZZER(const iroha::protocol::Transaction &tx) {
   static CommandFixture handler;
+  fuzzing::PerformanceBudget budget(tx.ByteSizeLong());
   handler.service_transport_->Torii(nullptr, &tx, nullptr);
 }
@@ -0,0 +1,62 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Performance mode of the executor ITF. The same scripted workload is run
+ * against every backend configuration of the executor tests, which are
+ * registered in executor_fixture_param_provider, and the throughput and the
+ * latencies of each are reported side by side.
+ *
+ * The workload is changed with the environment variables
+ * IROHA_PERF_STAGES, IROHA_PERF_ACCOUNTS_PER_STAGE and
+ * IROHA_PERF_OPERATIONS_PER_STAGE. The PostgreSQL credentials are taken from
+ * the environment as in the integration tests.
+ */
+
+#include <cstdlib>
+#include <iostream>
+
+#include <gtest/gtest.h>
+#include "framework/executor_itf/executor_itf.hpp"
+#include "framework/executor_itf/executor_itf_perf.hpp"
+#include "framework/result_gtest_checkers.hpp"
+#include "integration/executor/executor_fixture_param.hpp"
+#include "integration/executor/executor_fixture_param_provider.hpp"
+
+using namespace framework::expected;
+using namespace iroha::integration_framework;
+using namespace iroha::expected;
+
+namespace {
+  void setFromEnvironment(const char *name, size_t &value) {
+    if (auto env = std::getenv(name)) {
+      value = std::strtoull(env, nullptr, 10);
+    }
+  }
+}  // namespace
+
+TEST(ExecutorPerf, CompareBackends) {
+  PerfWorkload workload;
+  setFromEnvironment("IROHA_PERF_STAGES", workload.stages);
+  setFromEnvironment("IROHA_PERF_ACCOUNTS_PER_STAGE",
+                     workload.accounts_per_stage);
+  setFromEnvironment("IROHA_PERF_OPERATIONS_PER_STAGE",
+                     workload.operations_per_stage);
+
+  std::vector<PerfRun> runs;
+  for (const auto &param : executor_testing::getExecutorTestParamsVector()) {
+    SCOPED_TRACE(param->toString());
+    param->clearBackendState();
+    auto itf_result = ExecutorItf::create(param->getExecutorItfParam());
+    assertResultValue(itf_result);
+    auto itf = resultToOptionalValue(std::move(itf_result)).value();
+    auto reports = runPerfWorkload(*itf, workload);
+    assertResultValue(reports);
+    runs.emplace_back(param->toString(),
+                      resultToOptionalValue(std::move(reports)).value());
+  }
+
+  std::cout << formatPerfRuns(runs);
+}
@@ -446,6 +446,24 @@ TEST_P(GetAccountDetailRecordIdTest, LastPage) {
                                2);
 }
 
+/**
+ * @given account with 4 details from 2 writers, 2 unique keys from each,
+ * and all related permissions
+ * @when one of the details is set again with a new value
+ * @and queried account details with page size of 3 and first record unset
+ * @then the overwritten detail is returned once with the new value
+ */
+TEST_P(GetAccountDetailRecordIdTest, OverwrittenDetail) {
+  ASSERT_NO_FATAL_FAILURE(prepareState(2, 2));
+  assertResultValue(getItf().executeCommandAsAccount(
+      *getItf().getMockCommandFactory()->constructSetAccountDetail(
+          kUserId, makeKey(1), "new_value"),
+      makeAccountId(1),
+      true));
+  added_data_[makeAccountId(1)][makeKey(1)] = "new_value";
+  queryPageAndValidateResponse(boost::none, 3);
+}
+
 INSTANTIATE_TEST_CASE_P(
     Base,
     GetAccountDetailRecordIdTest,
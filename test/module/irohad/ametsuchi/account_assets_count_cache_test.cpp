@@ -0,0 +1,47 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/account_assets_count_cache.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace iroha::ametsuchi;
+
+/**
+ * @given a cache with the numbers of the assets at a height
+ * @when the numbers of a higher and then of a lower height are put
+ * @then only the numbers of the highest height are returned
+ */
+TEST(AccountAssetsCountCacheTest, KeepsLatestHeight) {
+  AccountAssetsCountCache cache(10);
+  cache.put("alice@test", 2, 5);
+  cache.put("bob@test", 2, 7);
+
+  cache.put("alice@test", 3, 6);
+  cache.put("bob@test", 2, 8);
+
+  auto alice = cache.find("alice@test");
+  ASSERT_TRUE(alice);
+  EXPECT_EQ(3, alice->height);
+  EXPECT_EQ(6, alice->count);
+  EXPECT_FALSE(cache.find("bob@test"));
+}
+
+/**
+ * @given a full cache
+ * @when the number of another account is put
+ * @then it is not cached, and the cached accounts are still updated
+ */
+TEST(AccountAssetsCountCacheTest, RespectsCapacity) {
+  AccountAssetsCountCache cache(1);
+  cache.put("alice@test", 1, 5);
+  cache.put("bob@test", 1, 7);
+  cache.put("alice@test", 1, 6);
+
+  EXPECT_FALSE(cache.find("bob@test"));
+  auto alice = cache.find("alice@test");
+  ASSERT_TRUE(alice);
+  EXPECT_EQ(6, alice->count);
+}
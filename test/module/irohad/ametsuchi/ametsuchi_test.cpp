@@ -5,9 +5,12 @@
 
 #include "module/irohad/ametsuchi/ametsuchi_fixture.hpp"
 
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <boost/optional/optional_io.hpp>
 
 #include "ametsuchi/impl/postgres_block_query.hpp"
+#include "ametsuchi/impl/postgres_command_executor.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
 #include "ametsuchi/impl/wsv_restorer_impl.hpp"
 #include "ametsuchi/mutable_storage.hpp"
@@ -16,14 +19,20 @@
 #include "framework/result_fixture.hpp"
 #include "framework/test_logger.hpp"
 #include "framework/test_subscriber.hpp"
+#include "module/irohad/validation/validation_mocks.hpp"
 #include "module/shared_model/builders/protobuf/test_block_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "module/shared_model/validators/validators.hpp"
 
 using namespace iroha::ametsuchi;
 using namespace framework::test_subscriber;
 using namespace shared_model::interface::permissions;
 using framework::expected::err;
 using framework::expected::val;
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
 
 auto zero_string = std::string(32, '0');
 auto fake_hash = shared_model::crypto::Hash(zero_string);
@@ -146,6 +155,54 @@ TEST_F(AmetsuchiTest, SampleTest) {
   }
 }
 
+/**
+ * @given genesis block which creates the accounts sharing a signatory
+ * @when the block is applied
+ * @then the accounts, their roles and signatories are in WSV
+ */
+TEST_F(AmetsuchiTest, GenesisBulkLoad) {
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(TestTransactionBuilder()
+                    .creatorAccountId("admin1")
+                    .createRole("user", {Role::kGetMyAccount})
+                    .createRole("admin", {Role::kCreateAccount})
+                    .createDomain("ru", "user")
+                    .createAccount("userone", "ru", fake_pubkey)
+                    .createAccount("usertwo", "ru", fake_pubkey)
+                    .appendRole("usertwo@ru", "admin")
+                    .build());
+  auto block = createBlock(txs, 1, fake_hash);
+
+  apply(storage, block);
+
+  validateAccount(sql_query, "userone@ru", "ru");
+  validateAccount(sql_query, "usertwo@ru", "ru");
+  auto signatories = storage->getWsvQuery()->getSignatories("usertwo@ru");
+  ASSERT_TRUE(signatories);
+  EXPECT_EQ(signatories->size(), 1);
+  auto roles = sql_query->getAccountRoles("usertwo@ru");
+  ASSERT_TRUE(roles);
+  EXPECT_EQ(roles->size(), 2);
+}
+
+/**
+ * @given genesis block which creates an account before its domain
+ * @when the block is applied
+ * @then the block is rejected as it is by the command execution
+ */
+TEST_F(AmetsuchiTest, GenesisBulkLoadKeepsCommandOrder) {
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(TestTransactionBuilder()
+                    .creatorAccountId("admin1")
+                    .createRole("user", {Role::kGetMyAccount})
+                    .createAccount("userone", "ru", fake_pubkey)
+                    .createDomain("ru", "user")
+                    .build());
+  auto block = createBlock(txs, 1, fake_hash);
+
+  EXPECT_FALSE(createMutableStorage()->apply(block));
+}
+
 TEST_F(AmetsuchiTest, PeerTest) {
   auto wsv = storage->getWsvQuery();
 
@@ -166,6 +223,45 @@ TEST_F(AmetsuchiTest, PeerTest) {
   ASSERT_EQ(peers->at(0)->pubkey(), fake_pubkey);
 }
 
+/**
+ * @given storage with a peer added by the first block
+ * @when a block without peer commands @and a block adding a peer are
+ * committed
+ * @then the ledger state of each commit has the peers of the ledger
+ */
+TEST_F(AmetsuchiTest, LedgerPeersFollowPeerCommands) {
+  auto block1 = createBlock({TestTransactionBuilder()
+                                 .addPeer("192.168.9.1:50051", fake_pubkey)
+                                 .build()},
+                            1,
+                            fake_hash);
+  apply(storage, block1);
+
+  auto commit = [&](std::shared_ptr<const shared_model::interface::Block>
+                        block) -> size_t {
+    auto ms = createMutableStorage();
+    EXPECT_TRUE(ms->apply(block));
+    auto ledger_state = val(storage->commit(std::move(ms)));
+    EXPECT_TRUE(ledger_state);
+    return ledger_state ? ledger_state->value->ledger_peers.size() : 0;
+  };
+
+  auto block2 = createBlock({TestTransactionBuilder()
+                                 .createRole("user", {Role::kAddPeer})
+                                 .build()},
+                            2,
+                            block1->hash());
+  EXPECT_EQ(1, commit(block2));
+
+  shared_model::crypto::PublicKey pubkey(std::string(32, '2'));
+  auto block3 = createBlock({TestTransactionBuilder()
+                                 .addPeer("192.168.9.2:50051", pubkey)
+                                 .build()},
+                            3,
+                            block2->hash());
+  EXPECT_EQ(2, commit(block3));
+}
+
 TEST_F(AmetsuchiTest, AddSignatoryTest) {
   ASSERT_TRUE(storage);
   auto wsv = storage->getWsvQuery();
@@ -447,6 +543,123 @@ TEST_F(AmetsuchiTest, TestRestoreWSV) {
   EXPECT_TRUE(res);
 }
 
+class FastWsvRestoreTest : public AmetsuchiTest {
+ public:
+  void SetUp() override {
+    AmetsuchiTest::SetUp();
+    ON_CALL(*chain_validator, validateAndApply(_, _))
+        .WillByDefault(Invoke(applyBlocks));
+  }
+
+  /// apply the blocks to the storage without the validation
+  static bool applyBlocks(
+      rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+          blocks,
+      MutableStorage &storage) {
+    return storage.apply(blocks, [](const auto &, const auto &) {
+      return true;
+    });
+  }
+
+  /// @return block of the given height which creates the domain
+  std::shared_ptr<const shared_model::interface::Block> makeBlock(
+      const std::string &domain,
+      size_t height,
+      shared_model::crypto::Hash prev_hash) {
+    std::vector<shared_model::proto::Transaction> txs;
+    auto tx = TestTransactionBuilder().creatorAccountId("admin@test");
+    if (height == 1) {
+      txs.push_back(tx.createRole("admin", {Role::kCreateDomain})
+                        .createDomain(domain, "admin")
+                        .build());
+    } else {
+      txs.push_back(tx.createDomain(domain, "admin").build());
+    }
+    return createBlock(txs, height, prev_hash);
+  }
+
+  /// @return restorer which trusts all blocks
+  std::unique_ptr<WsvRestorerImpl> makeRestorer() {
+    return std::make_unique<WsvRestorerImpl>(
+        std::make_shared<::testing::NiceMock<
+            shared_model::validation::MockValidator<
+                shared_model::interface::Block>>>(),
+        chain_validator,
+        2,
+        1,
+        getTestLogger("WsvRestorer"));
+  }
+
+  /// @return height of the restoration checkpoint
+  boost::optional<long long> checkpoint() {
+    long long height = 0;
+    *sql << "SELECT height FROM wsv_restore_checkpoint", soci::into(height);
+    if (not sql->got_data()) {
+      return boost::none;
+    }
+    return height;
+  }
+
+  std::shared_ptr<iroha::validation::MockChainValidator> chain_validator =
+      std::make_shared<NiceMock<iroha::validation::MockChainValidator>>();
+};
+
+/**
+ * @given spoiled WSV of two blocks
+ * @when WSV is restored in the fast mode
+ * @then WSV is valid @and the blocks after the genesis are applied through
+ * the chain validator @and no checkpoint is left
+ */
+TEST_F(FastWsvRestoreTest, RestoreWsv) {
+  auto block1 = makeBlock("test", 1, fake_hash);
+  auto block2 = makeBlock("second", 2, block1->hash());
+  apply(storage, block1);
+  apply(storage, block2);
+
+  *sql << "DELETE FROM domain";
+  ASSERT_FALSE(sql_query->getDomain("test"));
+
+  EXPECT_CALL(*chain_validator, validateAndApply(_, _));
+  ASSERT_TRUE(val(makeRestorer()->restoreWsv(*storage)));
+
+  EXPECT_TRUE(sql_query->getDomain("test"));
+  EXPECT_TRUE(sql_query->getDomain("second"));
+  EXPECT_FALSE(checkpoint());
+}
+
+/**
+ * @given ledger of three blocks @and the chain validator rejects the third
+ * one
+ * @when WSV is restored in the fast mode @and it is restored again after the
+ * rejection
+ * @then the first restoration fails leaving the checkpoint of the second
+ * block @and the second restoration resumes from the checkpoint without
+ * applying the committed blocks again
+ */
+TEST_F(FastWsvRestoreTest, ResumeFromCheckpoint) {
+  auto block1 = makeBlock("test", 1, fake_hash);
+  auto block2 = makeBlock("second", 2, block1->hash());
+  auto block3 = makeBlock("third", 3, block2->hash());
+  apply(storage, block1);
+  apply(storage, block2);
+  apply(storage, block3);
+
+  EXPECT_CALL(*chain_validator, validateAndApply(_, _))
+      .WillOnce(Invoke(applyBlocks))
+      .WillOnce(Return(false));
+  ASSERT_TRUE(err(makeRestorer()->restoreWsv(*storage)));
+  EXPECT_EQ(checkpoint(), boost::make_optional<long long>(2));
+  EXPECT_TRUE(sql_query->getDomain("second"));
+  EXPECT_FALSE(sql_query->getDomain("third"));
+
+  // the block following the checkpoint is linked to it directly
+  EXPECT_CALL(*chain_validator, validateAndApply(_, _)).Times(0);
+  ASSERT_TRUE(val(makeRestorer()->restoreWsv(*storage)));
+  EXPECT_TRUE(sql_query->getDomain("test"));
+  EXPECT_TRUE(sql_query->getDomain("third"));
+  EXPECT_FALSE(checkpoint());
+}
+
 /**
  * @given created storage
  *        @and a subscribed observer on on_commit() event
@@ -580,7 +793,7 @@ TEST_F(PreparedBlockTest, PrepareBlockNoStateChanged) {
 
   auto result = temp_wsv->apply(*initial_tx);
   ASSERT_FALSE(framework::expected::err(result));
-  storage->prepareBlock(std::move(temp_wsv));
+  storage->prepareBlock(std::move(temp_wsv), {initial_tx->hash()});
 
   // balance remains unchanged
   validateAccountAsset(sql_query, "admin@test", "coin#test", base_balance);
@@ -592,14 +805,13 @@ TEST_F(PreparedBlockTest, PrepareBlockNoStateChanged) {
  * @then state of the ledger is changed
  */
 TEST_F(PreparedBlockTest, CommitPreparedStateChanged) {
-  auto other_tx = createAddAsset("5.00");
-
-  auto block = createBlock({other_tx}, 2);
+  auto block = createBlock({*initial_tx}, 2);
 
   auto result = temp_wsv->apply(*initial_tx);
   ASSERT_FALSE(framework::expected::err(result));
-  storage->prepareBlock(std::move(temp_wsv));
+  storage->prepareBlock(std::move(temp_wsv), {initial_tx->hash()});
 
+  EXPECT_TRUE(storage->preparedCommitEnabled(*block));
   auto commited = storage->commitPrepared(block);
 
   ASSERT_TRUE(val(commited))
@@ -610,6 +822,25 @@ TEST_F(PreparedBlockTest, CommitPreparedStateChanged) {
   validateAccountAsset(sql_query, "admin@test", "coin#test", resultingAmount);
 }
 
+/**
+ * @given Storage with prepared state
+ * @when a block of other transactions is agreed
+ * @then the prepared state can not be committed as the block @and the ledger
+ * state remains unchanged
+ */
+TEST_F(PreparedBlockTest, CommitPreparedFailsForOtherBlock) {
+  auto other_tx = createAddAsset("10.00");
+  auto block = createBlock({other_tx}, 2);
+
+  auto result = temp_wsv->apply(*initial_tx);
+  ASSERT_TRUE(val(result));
+  storage->prepareBlock(std::move(temp_wsv), {initial_tx->hash()});
+
+  EXPECT_FALSE(storage->preparedCommitEnabled(*block));
+  EXPECT_TRUE(err(storage->commitPrepared(block)));
+  validateAccountAsset(sql_query, "admin@test", "coin#test", base_balance);
+}
+
 /**
  * @given Storage with prepared state
  * @when another block is applied
@@ -624,7 +855,7 @@ TEST_F(PreparedBlockTest, PrepareBlockCommitDifferentBlock) {
 
   auto result = temp_wsv->apply(*initial_tx);
   ASSERT_TRUE(val(result));
-  storage->prepareBlock(std::move(temp_wsv));
+  storage->prepareBlock(std::move(temp_wsv), {initial_tx->hash()});
 
   apply(storage, block);
 
@@ -648,7 +879,7 @@ TEST_F(PreparedBlockTest, CommitPreparedFailsAfterCommit) {
 
   auto result = temp_wsv->apply(*initial_tx);
   ASSERT_FALSE(framework::expected::err(result));
-  storage->prepareBlock(std::move(temp_wsv));
+  storage->prepareBlock(std::move(temp_wsv), {initial_tx->hash()});
 
   apply(storage, block);
 
@@ -668,11 +899,163 @@ TEST_F(PreparedBlockTest, CommitPreparedFailsAfterCommit) {
 TEST_F(PreparedBlockTest, TemporaryWsvUnlocks) {
   auto result = temp_wsv->apply(*initial_tx);
   ASSERT_TRUE(val(result));
-  storage->prepareBlock(std::move(temp_wsv));
+  storage->prepareBlock(std::move(temp_wsv), {initial_tx->hash()});
 
   temp_wsv = storage->createTemporaryWsv(command_executor);
 
   result = temp_wsv->apply(*initial_tx);
   ASSERT_TRUE(val(result));
-  storage->prepareBlock(std::move(temp_wsv));
+  storage->prepareBlock(std::move(temp_wsv), {initial_tx->hash()});
+}
+
+/**
+ * @given temporary WSV with accounts
+ * @when transfers are applied together, which include one of an account
+ * without the asset @and one of the asset received by a previous transfer
+ * @then each transfer is applied or rejected as if they were applied one by
+ * one
+ */
+TEST_F(PreparedBlockTest, TransfersAreAppliedTogether) {
+  auto accounts_tx = shared_model::proto::TransactionBuilder()
+                         .creatorAccountId("admin@test")
+                         .createdTime(iroha::time::now())
+                         .quorum(1)
+                         .createAccount("alice", "test", key.publicKey())
+                         .createAccount("bob", "test", key.publicKey())
+                         .createAccount("carol", "test", key.publicKey())
+                         .build()
+                         .signAndAddSignature(key)
+                         .finish();
+  ASSERT_TRUE(val(temp_wsv->apply(accounts_tx)));
+
+  auto transfer = [this](const std::string &source,
+                         const std::string &dest,
+                         const std::string &amount) {
+    return shared_model::proto::TransactionBuilder()
+        .creatorAccountId(source)
+        .createdTime(iroha::time::now())
+        .quorum(1)
+        .transferAsset(source, dest, "coin#test", "transfer", amount)
+        .build()
+        .signAndAddSignature(key)
+        .finish();
+  };
+  std::vector<shared_model::proto::Transaction> txs{
+      transfer("admin@test", "alice@test", "2.00"),
+      transfer("bob@test", "carol@test", "1.00"),
+      transfer("alice@test", "bob@test", "1.00"),
+      transfer("admin@test", "carol@test", "1.00")};
+  TemporaryWsv::TransactionRefs tx_refs(txs.begin(), txs.end());
+
+  auto results = temp_wsv->applyTransactions(tx_refs);
+  ASSERT_EQ(txs.size(), results.size());
+  EXPECT_TRUE(val(results[0]));
+  auto error = err(results[1]);
+  ASSERT_TRUE(error);
+  EXPECT_EQ("TransferAsset", error->error.name);
+  EXPECT_EQ(6, error->error.error_code);
+  EXPECT_TRUE(val(results[2]));
+  EXPECT_TRUE(val(results[3]));
+
+  framework::ametsuchi::SqlQuery temp_query(
+      std::static_pointer_cast<PostgresCommandExecutor>(command_executor)
+          ->getSession(),
+      factory);
+  auto query = &temp_query;
+  shared_model::interface::Amount one("1.00"), two("2.00");
+  validateAccountAsset(query, "admin@test", "coin#test", two);
+  validateAccountAsset(query, "alice@test", "coin#test", one);
+  validateAccountAsset(query, "bob@test", "coin#test", one);
+  validateAccountAsset(query, "carol@test", "coin#test", one);
+}
+
+/**
+ * @given temporary WSV with accounts
+ * @when a transfer, which fails both the asset precision and the source
+ * quantity checks, is applied alone @and together with another transfer
+ * @then it is rejected with the error code of the asset check both times
+ */
+TEST_F(PreparedBlockTest, TransferErrorCodesDoNotDependOnBatching) {
+  auto accounts_tx = shared_model::proto::TransactionBuilder()
+                         .creatorAccountId("admin@test")
+                         .createdTime(iroha::time::now())
+                         .quorum(1)
+                         .createAccount("alice", "test", key.publicKey())
+                         .createAccount("bob", "test", key.publicKey())
+                         .createAccount("carol", "test", key.publicKey())
+                         .build()
+                         .signAndAddSignature(key)
+                         .finish();
+  ASSERT_TRUE(val(temp_wsv->apply(accounts_tx)));
+
+  auto created_time = iroha::time::now();
+  auto transfer = [this, &created_time](const std::string &source,
+                                        const std::string &dest,
+                                        const std::string &amount) {
+    return shared_model::proto::TransactionBuilder()
+        .creatorAccountId(source)
+        .createdTime(created_time++)
+        .quorum(1)
+        .transferAsset(source, dest, "coin#test", "transfer", amount)
+        .build()
+        .signAndAddSignature(key)
+        .finish();
+  };
+  const std::string failed_amount = "1000000.000";
+  std::vector<shared_model::proto::Transaction> txs{
+      transfer("admin@test", "alice@test", failed_amount),
+      transfer("bob@test", "carol@test", "1.00")};
+  TemporaryWsv::TransactionRefs tx_refs(txs.begin(), txs.end());
+
+  auto results = temp_wsv->applyTransactions(tx_refs);
+  ASSERT_EQ(txs.size(), results.size());
+  auto batch_error = err(results[0]);
+  ASSERT_TRUE(batch_error);
+  EXPECT_EQ(5, batch_error->error.error_code);
+
+  auto single_error =
+      err(temp_wsv->apply(transfer("admin@test", "alice@test", failed_amount)));
+  ASSERT_TRUE(single_error);
+  EXPECT_EQ(5, single_error->error.error_code);
+}
+
+/**
+ * @given temporary WSV
+ * @when transactions are applied together, one of which fails after its
+ * first command has been applied
+ * @then the failed transaction is rejected with the index of its failed
+ * command @and its first command is not applied @and the other transactions
+ * are applied
+ */
+TEST_F(PreparedBlockTest, FailedTransactionIsRolledBackAmongOthers) {
+  auto failing_tx = shared_model::proto::TransactionBuilder()
+                        .creatorAccountId("admin@test")
+                        .createdTime(iroha::time::now())
+                        .quorum(1)
+                        .addAssetQuantity("coin#test", "2.00")
+                        .subtractAssetQuantity("coin#test", "100.00")
+                        .build()
+                        .signAndAddSignature(key)
+                        .finish();
+  std::vector<shared_model::proto::Transaction> txs{
+      createAddAsset("1.00"), failing_tx, createAddAsset("3.00")};
+  TemporaryWsv::TransactionRefs tx_refs(txs.begin(), txs.end());
+
+  auto results = temp_wsv->applyTransactions(tx_refs);
+  ASSERT_EQ(txs.size(), results.size());
+  EXPECT_TRUE(val(results[0]));
+  auto error = err(results[1]);
+  ASSERT_TRUE(error);
+  EXPECT_EQ("SubtractAssetQuantity", error->error.name);
+  EXPECT_EQ(1, error->error.index);
+  EXPECT_TRUE(val(results[2]));
+
+  framework::ametsuchi::SqlQuery temp_query(
+      std::static_pointer_cast<PostgresCommandExecutor>(command_executor)
+          ->getSession(),
+      factory);
+  validateAccountAsset(&temp_query,
+                       "admin@test",
+                       "coin#test",
+                       shared_model::interface::Amount("9.00"));
 }
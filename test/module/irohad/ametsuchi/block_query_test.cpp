@@ -169,6 +169,53 @@ TEST_F(BlockQueryTest, GetZeroBlock) {
       });
 }
 
+/**
+ * @given block store with 2 blocks
+ * @when serialized block with height=2 is requested @and a nonexistent one
+ * @then the serialized form of the stored block is returned @and nothing is
+ * returned for the nonexistent block
+ */
+TEST_F(BlockQueryTest, GetSerializedBlock) {
+  auto block = framework::expected::val(blocks->getBlock(2));
+  ASSERT_TRUE(block);
+  auto serialized_block =
+      framework::expected::val(blocks->getSerializedBlock(2));
+  ASSERT_TRUE(serialized_block);
+  EXPECT_EQ(shared_model::crypto::toBinaryString(block->value->blob()),
+            serialized_block->value);
+
+  auto nonexistent_block =
+      framework::expected::err(blocks->getSerializedBlock(1000));
+  ASSERT_TRUE(nonexistent_block);
+  EXPECT_EQ(BlockQuery::GetBlockError::Code::kNoBlock,
+            nonexistent_block->error.code);
+}
+
+/**
+ * @given block store with 2 blocks
+ * @when the header of the block with height=2 is requested @and the one of a
+ * nonexistent block
+ * @then the header fields match the stored block @and nothing is returned
+ * for the nonexistent block
+ */
+TEST_F(BlockQueryTest, GetBlockHeader) {
+  auto block = framework::expected::val(blocks->getBlock(2));
+  ASSERT_TRUE(block);
+  auto header = framework::expected::val(blocks->getBlockHeader(2));
+  ASSERT_TRUE(header);
+  EXPECT_EQ(2, header->value.height);
+  EXPECT_EQ(block->value->hash(), header->value.hash);
+  EXPECT_EQ(block->value->prevHash(), header->value.prev_hash);
+  EXPECT_EQ(block->value->createdTime(), header->value.created_time);
+  EXPECT_EQ(block->value->txsNumber(), header->value.tx_count);
+
+  auto nonexistent_header =
+      framework::expected::err(blocks->getBlockHeader(1000));
+  ASSERT_TRUE(nonexistent_header);
+  EXPECT_EQ(BlockQuery::GetBlockError::Code::kNoBlock,
+            nonexistent_header->error.code);
+}
+
 // TODO: luckychess 05.08.2019 IR-595 Unit tests for ProtoBlockJsonConverter
 /**
  * @given block store with 2 blocks totally containing 3 txs created by
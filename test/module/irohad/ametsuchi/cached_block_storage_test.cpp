@@ -0,0 +1,144 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/cached_block_storage.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/optional/optional_io.hpp>
+#include "module/irohad/ametsuchi/mock_block_storage.hpp"
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha::ametsuchi;
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRefOfCopy;
+
+class CachedBlockStorageTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    auto storage = std::make_unique<NiceMock<MockBlockStorage>>();
+    storage_ = storage.get();
+    ON_CALL(*storage_, insert(_)).WillByDefault(Return(true));
+    cache_ =
+        std::make_unique<CachedBlockStorage>(std::move(storage), kCapacity);
+  }
+
+  /// @return block of the given height with kBlockSize bytes blob
+  std::shared_ptr<MockBlock> makeBlock(
+      shared_model::interface::types::HeightType height) {
+    auto block = std::make_shared<NiceMock<MockBlock>>();
+    ON_CALL(*block, height()).WillByDefault(Return(height));
+    ON_CALL(*block, blob())
+        .WillByDefault(ReturnRefOfCopy(shared_model::crypto::Blob(
+            shared_model::crypto::Blob::Bytes(kBlockSize, height))));
+    return block;
+  }
+
+  static constexpr size_t kBlockSize = 100;
+  static constexpr size_t kCapacity = 2 * kBlockSize + kBlockSize / 2;
+
+  MockBlockStorage *storage_;
+  std::unique_ptr<CachedBlockStorage> cache_;
+};
+
+constexpr size_t CachedBlockStorageTest::kBlockSize;
+constexpr size_t CachedBlockStorageTest::kCapacity;
+
+/**
+ * @given cache in front of the storage
+ * @when a block is inserted and fetched
+ * @then the block is returned without reading the storage @and a hit is
+ * counted
+ */
+TEST_F(CachedBlockStorageTest, InsertedBlockIsCached) {
+  auto block = makeBlock(1);
+  EXPECT_CALL(*storage_, insert(_)).WillOnce(Return(true));
+  EXPECT_CALL(*storage_, fetch(_)).Times(0);
+  ASSERT_TRUE(cache_->insert(block));
+
+  auto fetched = cache_->fetch(1);
+  ASSERT_TRUE(fetched);
+  EXPECT_EQ(block, *fetched);
+  EXPECT_EQ(shared_model::crypto::toBinaryString(block->blob()),
+            cache_->fetchSerialized(1));
+  EXPECT_EQ(2, cache_->hits()->value());
+  EXPECT_EQ(0, cache_->misses()->value());
+  EXPECT_EQ(kBlockSize, cache_->cachedSize());
+}
+
+/**
+ * @given cache in front of the storage
+ * @when insertion to the storage fails
+ * @then the block is not cached
+ */
+TEST_F(CachedBlockStorageTest, FailedInsertIsNotCached) {
+  EXPECT_CALL(*storage_, insert(_)).WillOnce(Return(false));
+  ASSERT_FALSE(cache_->insert(makeBlock(1)));
+
+  EXPECT_CALL(*storage_, fetch(1)).WillOnce(Return(boost::none));
+  EXPECT_FALSE(cache_->fetch(1));
+  EXPECT_EQ(1, cache_->misses()->value());
+  EXPECT_EQ(0, cache_->cachedSize());
+}
+
+/**
+ * @given cache full of blocks 1 and 2, block 1 is used recently
+ * @when block 3 is inserted @and evicted block 2 is fetched
+ * @then block 2 is read from the storage and cached instead of block 1
+ */
+TEST_F(CachedBlockStorageTest, LeastRecentlyUsedIsEvicted) {
+  ASSERT_TRUE(cache_->insert(makeBlock(1)));
+  ASSERT_TRUE(cache_->insert(makeBlock(2)));
+  ASSERT_TRUE(cache_->fetch(1));
+  ASSERT_TRUE(cache_->insert(makeBlock(3)));
+  EXPECT_EQ(2 * kBlockSize, cache_->cachedSize());
+
+  std::shared_ptr<const shared_model::interface::Block> block = makeBlock(2);
+  EXPECT_CALL(*storage_, fetch(2)).WillOnce(Return(block));
+  EXPECT_EQ(block, *cache_->fetch(2));
+  EXPECT_EQ(block, *cache_->fetch(2));
+
+  EXPECT_CALL(*storage_, fetch(1)).WillOnce(Return(boost::none));
+  EXPECT_FALSE(cache_->fetch(1));
+  EXPECT_EQ(2, cache_->hits()->value());
+  EXPECT_EQ(2, cache_->misses()->value());
+}
+
+/**
+ * @given cache with a block
+ * @when the storage is cleared
+ * @then the block is not cached anymore
+ */
+TEST_F(CachedBlockStorageTest, Clear) {
+  ASSERT_TRUE(cache_->insert(makeBlock(1)));
+  EXPECT_CALL(*storage_, clear());
+  cache_->clear();
+  EXPECT_EQ(0, cache_->cachedSize());
+
+  EXPECT_CALL(*storage_, fetch(1)).WillOnce(Return(boost::none));
+  EXPECT_FALSE(cache_->fetch(1));
+}
+
+/**
+ * @given cache full of blocks 1 and 2, block 1 is used recently
+ * @when the capacity is reduced to one block @and then increased to three
+ * @then block 2 is evicted @and three blocks are cached afterwards
+ */
+TEST_F(CachedBlockStorageTest, SetCapacity) {
+  ASSERT_TRUE(cache_->insert(makeBlock(1)));
+  ASSERT_TRUE(cache_->insert(makeBlock(2)));
+  ASSERT_TRUE(cache_->fetch(1));
+
+  cache_->setCapacity(kBlockSize);
+  EXPECT_EQ(kBlockSize, cache_->cachedSize());
+  EXPECT_CALL(*storage_, fetch(2)).WillOnce(Return(boost::none));
+  EXPECT_FALSE(cache_->fetch(2));
+
+  cache_->setCapacity(3 * kBlockSize);
+  ASSERT_TRUE(cache_->insert(makeBlock(2)));
+  ASSERT_TRUE(cache_->insert(makeBlock(3)));
+  EXPECT_EQ(3 * kBlockSize, cache_->cachedSize());
+}
@@ -8,28 +8,101 @@
 
 #include <gtest/gtest.h>
 #include <boost/filesystem.hpp>
+#include <boost/optional/optional_io.hpp>
+#include "ametsuchi/impl/block_compressor.hpp"
+#include "ametsuchi/impl/block_file_format.hpp"
+#include "backend/protobuf/proto_block_json_converter.hpp"
+#include "common/byteutils.hpp"
 #include "framework/test_logger.hpp"
-#include "module/shared_model/interface_mocks.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
 
 using namespace iroha::ametsuchi;
 using namespace boost::filesystem;
 
-using ::testing::_;
-using ::testing::Invoke;
-using ::testing::NiceMock;
-using ::testing::Return;
-
 class FlatFileBlockStorageTest : public ::testing::Test {
- public:
-  FlatFileBlockStorageTest() {
-    ON_CALL(*block_, height()).WillByDefault(Return(height_));
-  }
-
  protected:
   void SetUp() override {
     create_directory(path_provider_());
   }
 
+  void TearDown() override {
+    remove_all(block_store_path_);
+  }
+
+  std::unique_ptr<BlockStorage> createStorage() {
+    return FlatFileBlockStorageFactory(path_provider_, converter_, log_manager_)
+        .create();
+  }
+
+  /// create the storage which compresses the blocks with the given level
+  std::unique_ptr<BlockStorage> createCompressedStorage(
+      boost::optional<int32_t> level) {
+    auto compressor = BlockCompressor::create(block_store_path_,
+                                              level,
+                                              getTestLogger("BlockCompressor"),
+                                              kSegmentBlocks,
+                                              kTrainingBlocks);
+    EXPECT_TRUE(compressor);
+    return std::make_unique<FlatFileBlockStorage>(
+        createFlatFile(),
+        converter_,
+        getTestLogger("FlatFileBlockStorage"),
+        std::move(*compressor));
+  }
+
+  /// @return block with a transaction of the given height
+  std::shared_ptr<shared_model::proto::Block> makeBlock(
+      shared_model::interface::types::HeightType height) {
+    return std::make_shared<shared_model::proto::Block>(
+        TestBlockBuilder()
+            .height(height)
+            .createdTime(height)
+            .transactions(std::vector<shared_model::proto::Transaction>{
+                TestTransactionBuilder()
+                    .creatorAccountId("admin@test")
+                    .createdTime(height)
+                    .quorum(1)
+                    .transferAsset("admin@test",
+                                   "user" + std::to_string(height % 7)
+                                       + "@test",
+                                   "coin#test",
+                                   "transfer",
+                                   std::to_string(height) + ".00")
+                    .build()})
+            .build());
+  }
+
+  /// @return dictionary id of the compressed block
+  uint32_t dictionaryId(const FlatFile::Bytes &block_file) {
+    uint32_t id = 0;
+    for (size_t i = 0; i < 4; ++i) {
+      id |= uint32_t{block_file[block_file_format::kHeaderSize + i]}
+          << (8 * i);
+    }
+    return id;
+  }
+
+  static constexpr shared_model::interface::types::HeightType kSegmentBlocks =
+      100;
+  static constexpr shared_model::interface::types::HeightType
+      kTrainingBlocks = 50;
+
+  std::unique_ptr<FlatFile> createFlatFile() {
+    return std::move(*FlatFile::create(block_store_path_, getTestLogger("FF")));
+  }
+
+  /// write the block in the legacy JSON format
+  void writeJsonBlock(const shared_model::proto::Block &block) {
+    auto json = converter_->serialize(block);
+    ASSERT_TRUE(iroha::expected::hasValue(json));
+    ASSERT_TRUE(createFlatFile()->add(
+        block.height(),
+        iroha::stringToBytes(
+            boost::get<iroha::expected::ValueOf<decltype(json)>>(json)
+                .value)));
+  }
+
   const std::string block_store_path_ =
       (temp_directory_path() / unique_path()).string();
 
@@ -37,11 +110,13 @@ class FlatFileBlockStorageTest : public ::testing::Test {
     return block_store_path_;
   };
 
-  std::shared_ptr<MockBlockJsonConverter> converter_ =
-      std::make_shared<NiceMock<MockBlockJsonConverter>>();
+  std::shared_ptr<shared_model::interface::BlockJsonConverter> converter_ =
+      std::make_shared<shared_model::proto::ProtoBlockJsonConverter>();
   logger::LoggerManagerTreePtr log_manager_ = getTestLoggerManager();
-  std::shared_ptr<MockBlock> block_ = std::make_shared<NiceMock<MockBlock>>();
   shared_model::interface::types::HeightType height_ = 1;
+  std::shared_ptr<shared_model::proto::Block> block_ =
+      std::make_shared<shared_model::proto::Block>(
+          TestBlockBuilder().height(height_).createdTime(42).build());
 };
 
 /**
@@ -50,9 +125,7 @@ class FlatFileBlockStorageTest : public ::testing::Test {
  * @then block storage is created
  */
 TEST_F(FlatFileBlockStorageTest, Creation) {
-  auto block_storage =
-      FlatFileBlockStorageFactory(path_provider_, converter_, log_manager_)
-          .create();
+  auto block_storage = createStorage();
   ASSERT_TRUE(block_storage);
 }
 
@@ -62,9 +135,7 @@ TEST_F(FlatFileBlockStorageTest, Creation) {
  * @then second insertion fails
  */
 TEST_F(FlatFileBlockStorageTest, Insert) {
-  auto block_storage =
-      FlatFileBlockStorageFactory(path_provider_, converter_, log_manager_)
-          .create();
+  auto block_storage = createStorage();
   ASSERT_TRUE(block_storage->insert(block_));
   ASSERT_FALSE(block_storage->insert(block_));
 }
@@ -72,31 +143,22 @@ TEST_F(FlatFileBlockStorageTest, Insert) {
 /**
  * @given initialized block storage, single block with height_ inserted
  * @when block with height_ is fetched
- * @then it is returned
+ * @then it is returned @and the block file is in the binary format
  */
 TEST_F(FlatFileBlockStorageTest, FetchExisting) {
-  auto block_storage =
-      FlatFileBlockStorageFactory(path_provider_, converter_, log_manager_)
-          .create();
+  auto block_storage = createStorage();
   ASSERT_TRUE(block_storage->insert(block_));
 
-  shared_model::interface::Block *raw_block;
-
-  EXPECT_CALL(*converter_, deserialize(_))
-      .WillOnce(Invoke([&](const shared_model::interface::types::JsonType &)
-                           -> iroha::expected::Result<
-                               std::unique_ptr<shared_model::interface::Block>,
-                               std::string> {
-        auto return_block = std::make_unique<MockBlock>();
-        raw_block = return_block.get();
-        return iroha::expected::makeValue<
-            std::unique_ptr<shared_model::interface::Block>>(
-            std::move(return_block));
-      }));
-  std::shared_ptr<const shared_model::interface::Block> block_var =
-      *(block_storage->fetch(height_));
-
-  ASSERT_EQ(raw_block, block_var.get());
+  auto block = block_storage->fetch(height_);
+  ASSERT_TRUE(block);
+  EXPECT_EQ(*block_, **block);
+
+  auto block_file = createFlatFile()->get(height_);
+  ASSERT_TRUE(block_file);
+  EXPECT_TRUE(block_file_format::detect(*block_file)
+              == block_file_format::Version::kProtobufV1);
+  EXPECT_EQ(shared_model::crypto::toBinaryString(block_->blob()),
+            block_storage->fetchSerialized(height_));
 }
 
 /**
@@ -105,11 +167,173 @@ TEST_F(FlatFileBlockStorageTest, FetchExisting) {
  * @then nothing is returned
  */
 TEST_F(FlatFileBlockStorageTest, FetchNonexistent) {
-  auto block_storage =
-      FlatFileBlockStorageFactory(path_provider_, converter_, log_manager_)
-          .create();
+  auto block_storage = createStorage();
   auto block_var = block_storage->fetch(height_);
   ASSERT_FALSE(block_var);
+  ASSERT_FALSE(block_storage->fetchSerialized(height_));
+}
+
+/**
+ * @given block file in the legacy JSON format
+ * @when the block is fetched
+ * @then the same block is returned in both forms
+ */
+TEST_F(FlatFileBlockStorageTest, FetchLegacyJson) {
+  writeJsonBlock(*block_);
+  auto block_storage = createStorage();
+
+  auto block = block_storage->fetch(height_);
+  ASSERT_TRUE(block);
+  EXPECT_EQ(*block_, **block);
+  EXPECT_EQ(shared_model::crypto::toBinaryString(block_->blob()),
+            block_storage->fetchSerialized(height_));
+}
+
+/**
+ * @given block file with the header of unknown version
+ * @when the block is fetched
+ * @then nothing is returned
+ */
+TEST_F(FlatFileBlockStorageTest, FetchUnknownVersion) {
+  auto block_file = block_file_format::encode(block_->blob().blob());
+  block_file[block_file_format::kHeaderSize - 1] = 42;
+  ASSERT_TRUE(createFlatFile()->add(height_, block_file));
+  auto block_storage = createStorage();
+
+  EXPECT_FALSE(block_storage->fetch(height_));
+  EXPECT_FALSE(block_storage->fetchSerialized(height_));
+}
+
+/**
+ * @given block storage with a block and a torn block file above it
+ * @when the torn blocks are removed
+ * @then only the torn block is removed @and the storage accepts it again
+ */
+TEST_F(FlatFileBlockStorageTest, RemoveTornBlocks) {
+  auto block_file = block_file_format::encode(block_->blob().blob());
+  ASSERT_TRUE(createFlatFile()->add(height_, block_file));
+  block_file.resize(block_file_format::kHeaderSize + 1);
+  ASSERT_TRUE(createFlatFile()->add(height_ + 1, block_file));
+  FlatFileBlockStorage block_storage(
+      createFlatFile(), converter_, getTestLogger("FlatFileBlockStorage"));
+
+  EXPECT_EQ(1, block_storage.removeTornBlocks());
+  EXPECT_EQ(1, block_storage.size());
+  EXPECT_TRUE(block_storage.fetch(height_));
+  EXPECT_TRUE(block_storage.insert(makeBlock(height_ + 1)));
+  EXPECT_TRUE(block_storage.flush());
+}
+
+/**
+ * @given block storage with a JSON block and a binary block
+ * @when the storage is converted
+ * @then both blocks are in the binary format @and they are fetched
+ */
+TEST_F(FlatFileBlockStorageTest, ConvertLegacyJson) {
+  writeJsonBlock(*block_);
+  auto next_block = std::make_shared<shared_model::proto::Block>(
+      TestBlockBuilder().height(height_ + 1).createdTime(43).build());
+  ASSERT_TRUE(createStorage()->insert(next_block));
+
+  auto flat_file = createFlatFile();
+  ASSERT_TRUE(
+      block_file_format::convertFlatFile(*flat_file, getTestLogger("Convert")));
+  for (auto height : {height_, height_ + 1}) {
+    auto block_file = flat_file->get(height);
+    ASSERT_TRUE(block_file);
+    EXPECT_TRUE(block_file_format::detect(*block_file)
+                == block_file_format::Version::kProtobufV1);
+  }
+
+  auto block_storage = createStorage();
+  EXPECT_EQ(*block_, **block_storage->fetch(height_));
+  EXPECT_EQ(*next_block, **block_storage->fetch(height_ + 1));
+}
+
+/**
+ * @given block storage with compression enabled
+ * @when blocks are inserted
+ * @then the block files are compressed @and the blocks are fetched in both
+ * forms
+ */
+TEST_F(FlatFileBlockStorageTest, Compressed) {
+  auto block_storage = createCompressedStorage(3);
+  auto block = makeBlock(height_);
+  ASSERT_TRUE(block_storage->insert(block));
+
+  auto block_file = createFlatFile()->get(height_);
+  ASSERT_TRUE(block_file);
+  EXPECT_TRUE(block_file_format::detect(*block_file)
+              == block_file_format::Version::kZstdV1);
+  EXPECT_EQ(0, dictionaryId(*block_file));
+  EXPECT_EQ(*block, **block_storage->fetch(height_));
+  EXPECT_EQ(shared_model::crypto::toBinaryString(block->blob()),
+            block_storage->fetchSerialized(height_));
+}
+
+/**
+ * @given block storage with compression enabled
+ * @when blocks of two segments are inserted
+ * @then a dictionary is trained after the training blocks of every segment
+ * @and the following blocks are compressed with it @and all blocks are read
+ * after the storage is reopened with compression disabled
+ */
+TEST_F(FlatFileBlockStorageTest, DictionaryTraining) {
+  const auto last_height = kSegmentBlocks + kTrainingBlocks + 10;
+  std::vector<std::shared_ptr<shared_model::proto::Block>> blocks;
+  {
+    auto block_storage = createCompressedStorage(3);
+    for (auto height = height_; height <= last_height; ++height) {
+      blocks.push_back(makeBlock(height));
+      ASSERT_TRUE(block_storage->insert(blocks.back()));
+    }
+  }
+
+  auto flat_file = createFlatFile();
+  auto dictionary = [&](auto height) {
+    return dictionaryId(*flat_file->get(height));
+  };
+  EXPECT_EQ(0, dictionary(kTrainingBlocks));
+  EXPECT_EQ(1, dictionary(kTrainingBlocks + 1));
+  EXPECT_EQ(1, dictionary(kSegmentBlocks + kTrainingBlocks));
+  EXPECT_EQ(2, dictionary(kSegmentBlocks + kTrainingBlocks + 1));
+
+  auto block_storage = createCompressedStorage(boost::none);
+  for (const auto &block : blocks) {
+    auto fetched = block_storage->fetch(block->height());
+    ASSERT_TRUE(fetched);
+    EXPECT_EQ(*block, **fetched);
+  }
+
+  auto next_block = makeBlock(last_height + 1);
+  ASSERT_TRUE(block_storage->insert(next_block));
+  EXPECT_TRUE(block_file_format::detect(*flat_file->get(last_height + 1))
+              == block_file_format::Version::kProtobufV1);
+}
+
+/**
+ * @given block storage with compressed blocks and dictionaries
+ * @when the storage is cleared @and blocks are inserted again
+ * @then the blocks are compressed and read again @and the storage without
+ * the compressor does not read the compressed blocks
+ */
+TEST_F(FlatFileBlockStorageTest, CompressedClear) {
+  auto block_storage = createCompressedStorage(3);
+  for (auto height = height_; height <= kTrainingBlocks + 1; ++height) {
+    ASSERT_TRUE(block_storage->insert(makeBlock(height)));
+  }
+
+  block_storage->clear();
+  EXPECT_EQ(0, block_storage->size());
+  for (auto height = height_; height <= kTrainingBlocks + 1; ++height) {
+    ASSERT_TRUE(block_storage->insert(makeBlock(height)));
+  }
+  EXPECT_EQ(*makeBlock(kTrainingBlocks + 1),
+            **block_storage->fetch(kTrainingBlocks + 1));
+  EXPECT_TRUE(is_directory(path(block_store_path_)
+                           / BlockCompressor::kDictionariesDirectory));
+
+  EXPECT_FALSE(createStorage()->fetch(height_));
 }
 
 /**
@@ -118,9 +342,7 @@ TEST_F(FlatFileBlockStorageTest, FetchNonexistent) {
  * @then 1 is returned
  */
 TEST_F(FlatFileBlockStorageTest, Size) {
-  auto block_storage =
-      FlatFileBlockStorageFactory(path_provider_, converter_, log_manager_)
-          .create();
+  auto block_storage = createStorage();
   ASSERT_TRUE(block_storage->insert(block_));
 
   ASSERT_EQ(1, block_storage->size());
@@ -132,9 +354,7 @@ TEST_F(FlatFileBlockStorageTest, Size) {
  * @then no blocks are left in storage
  */
 TEST_F(FlatFileBlockStorageTest, Clear) {
-  auto block_storage =
-      FlatFileBlockStorageFactory(path_provider_, converter_, log_manager_)
-          .create();
+  auto block_storage = createStorage();
   ASSERT_TRUE(block_storage->insert(block_));
 
   block_storage->clear();
@@ -150,30 +370,14 @@ TEST_F(FlatFileBlockStorageTest, Clear) {
  * @then block with height_ is visited, lambda is invoked once
  */
 TEST_F(FlatFileBlockStorageTest, ForEach) {
-  auto block_storage =
-      FlatFileBlockStorageFactory(path_provider_, converter_, log_manager_)
-          .create();
+  auto block_storage = createStorage();
   ASSERT_TRUE(block_storage->insert(block_));
 
-  shared_model::interface::Block *raw_block;
-
-  EXPECT_CALL(*converter_, deserialize(_))
-      .WillOnce(Invoke([&](const shared_model::interface::types::JsonType &)
-                           -> iroha::expected::Result<
-                               std::unique_ptr<shared_model::interface::Block>,
-                               std::string> {
-        auto return_block = std::make_unique<MockBlock>();
-        raw_block = return_block.get();
-        return iroha::expected::makeValue<
-            std::unique_ptr<shared_model::interface::Block>>(
-            std::move(return_block));
-      }));
-
   size_t count = 0;
 
-  block_storage->forEach([&count, &raw_block](const auto &block) {
+  block_storage->forEach([this, &count](const auto &block) {
     ++count;
-    ASSERT_EQ(raw_block, block.get());
+    ASSERT_EQ(*block_, *block);
   });
 
   ASSERT_EQ(1, count);
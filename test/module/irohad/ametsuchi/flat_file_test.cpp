@@ -259,3 +259,163 @@ TEST_F(BlStore_Test, RemoveAndCreateNew) {
   ASSERT_TRUE(bl_store->get(7));
   ASSERT_FALSE(bl_store->get(1));
 }
+
+/**
+ * @given initialized FlatFile storage with a block
+ * @when the block is replaced @and a missing block is replaced
+ * @then the new data is read @and the missing block is not created
+ */
+TEST_F(BlStore_Test, Replace) {
+  auto store = FlatFile::create(block_store_path, flat_file_log_);
+  ASSERT_TRUE(store);
+  auto bl_store = std::move(*store);
+  ASSERT_TRUE(bl_store->add(1, block));
+
+  std::vector<uint8_t> new_block(10, 7);
+  ASSERT_TRUE(bl_store->replace(1, new_block));
+  ASSERT_EQ(new_block, *bl_store->get(1));
+
+  ASSERT_FALSE(bl_store->replace(2, new_block));
+  ASSERT_FALSE(bl_store->get(2));
+  ASSERT_EQ(1,
+            std::distance(fs::directory_iterator{block_store_path},
+                          fs::directory_iterator{}));
+}
+
+/**
+ * @given storage directory with a block, a subdirectory and a foreign file,
+ * which was not closed cleanly
+ * @when FlatFile is created on the directory
+ * @then the foreign file is removed @and the subdirectory is kept
+ */
+TEST_F(BlStore_Test, KeepSubdirectories) {
+  {
+    auto store = FlatFile::create(block_store_path, flat_file_log_);
+    ASSERT_TRUE(store);
+    ASSERT_TRUE((*store)->add(1, block));
+  }
+  fs::remove(fs::path(block_store_path) / FlatFile::kTipFileName);
+  auto subdirectory = fs::path(block_store_path) / "dictionaries";
+  fs::create_directory(subdirectory);
+  fs::ofstream(fs::path(block_store_path) / "foreign") << "data";
+
+  auto store = FlatFile::create(block_store_path, flat_file_log_);
+  ASSERT_TRUE(store);
+  EXPECT_EQ(1, (*store)->blockIdentifiers().size());
+  EXPECT_TRUE(fs::is_directory(subdirectory));
+  EXPECT_FALSE(fs::exists(fs::path(block_store_path) / "foreign"));
+}
+
+/**
+ * @given storage with the ranges of blocks, which is closed
+ * @when FlatFile is created on the directory
+ * @then the identifiers are taken from the tip file @and the tip file is
+ * removed, so the directory is scanned if the storage is not closed
+ */
+TEST_F(BlStore_Test, TipFile) {
+  {
+    auto store = FlatFile::create(block_store_path, flat_file_log_);
+    ASSERT_TRUE(store);
+    for (auto id : {1u, 2u, 3u, 7u, 9u, 10u}) {
+      ASSERT_TRUE((*store)->add(id, block));
+    }
+  }
+  // a file added while the storage is closed is not seen
+  fs::ofstream(fs::path(block_store_path) / FlatFile::id_to_name(5u))
+      << "data";
+
+  auto store = FlatFile::create(block_store_path, flat_file_log_);
+  ASSERT_TRUE(store);
+  EXPECT_FALSE(fs::exists(fs::path(block_store_path) / FlatFile::kTipFileName));
+  const auto &ids = (*store)->blockIdentifiers();
+  EXPECT_EQ((std::vector<Identifier>{1, 2, 3, 7, 9, 10}),
+            std::vector<Identifier>(ids.begin(), ids.end()));
+  EXPECT_EQ(6, ids.size());
+  EXPECT_EQ(3, ids.ranges().size());
+  EXPECT_EQ(10, (*store)->last_id());
+
+  store->reset();
+  fs::remove(fs::path(block_store_path) / FlatFile::kTipFileName);
+  store = FlatFile::create(block_store_path, flat_file_log_);
+  ASSERT_TRUE(store);
+  EXPECT_EQ(7, (*store)->blockIdentifiers().size());
+}
+
+/**
+ * @given storage with a tip file
+ * @when the last block is removed while the storage is closed
+ * @then the tip file is not valid @and the directory is scanned
+ */
+TEST_F(BlStore_Test, InvalidTipFile) {
+  {
+    auto store = FlatFile::create(block_store_path, flat_file_log_);
+    ASSERT_TRUE(store);
+    ASSERT_TRUE((*store)->add(1, block));
+    ASSERT_TRUE((*store)->add(2, block));
+  }
+  fs::remove(fs::path(block_store_path) / FlatFile::id_to_name(2u));
+
+  auto store = FlatFile::create(block_store_path, flat_file_log_);
+  ASSERT_TRUE(store);
+  EXPECT_EQ(1, (*store)->last_id());
+  EXPECT_EQ(1, (*store)->blockIdentifiers().size());
+}
+
+/**
+ * @given empty identifier ranges
+ * @when the identifiers are inserted in any order
+ * @then the adjacent ones are merged into a range
+ */
+TEST(IdRangesTest, Insert) {
+  IdRanges<Identifier> ids;
+  for (auto id : {5u, 3u, 1u, 2u, 4u, 8u, 7u, 10u}) {
+    EXPECT_TRUE(ids.insert(id));
+  }
+  EXPECT_FALSE(ids.insert(4));
+
+  EXPECT_EQ((IdRanges<Identifier>::RangesType{{1, 5}, {7, 8}, {10, 10}}),
+            ids.ranges());
+  EXPECT_EQ(8, ids.size());
+  EXPECT_EQ(1, ids.count(8));
+  EXPECT_EQ(0, ids.count(9));
+  EXPECT_EQ(10, ids.last());
+}
+
+/**
+ * @given identifier ranges
+ * @when the last identifiers are erased
+ * @then the last range shrinks @and the empty range is removed
+ */
+TEST(IdRangesTest, EraseLast) {
+  IdRanges<Identifier> ids;
+  for (auto id : {1u, 2u, 4u, 5u}) {
+    ASSERT_TRUE(ids.insert(id));
+  }
+
+  ids.eraseLast();
+  EXPECT_EQ((IdRanges<Identifier>::RangesType{{1, 2}, {4, 4}}), ids.ranges());
+  ids.eraseLast();
+  EXPECT_EQ((IdRanges<Identifier>::RangesType{{1, 2}}), ids.ranges());
+  EXPECT_EQ(2, ids.size());
+  EXPECT_EQ(2, ids.last());
+}
+
+/**
+ * @given storage with added blocks
+ * @when the storage is flushed @and the last block is removed
+ * @then the flush succeeds @and the last block is not available
+ */
+TEST_F(BlStore_Test, FlushAndRemoveLast) {
+  auto store = FlatFile::create(block_store_path, flat_file_log_);
+  ASSERT_TRUE(store);
+  ASSERT_TRUE((*store)->add(1, block));
+  ASSERT_TRUE((*store)->add(2, block));
+  EXPECT_TRUE((*store)->flush());
+
+  ASSERT_TRUE((*store)->removeLast());
+  EXPECT_EQ(1, (*store)->last_id());
+  EXPECT_FALSE((*store)->get(2));
+  EXPECT_FALSE(
+      fs::exists(fs::path(block_store_path) / FlatFile::id_to_name(2u)));
+  EXPECT_TRUE((*store)->add(2, block));
+}
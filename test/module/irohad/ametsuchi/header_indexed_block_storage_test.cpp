@@ -0,0 +1,125 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/header_indexed_block_storage.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/optional/optional_io.hpp>
+#include "module/irohad/ametsuchi/mock_block_storage.hpp"
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha::ametsuchi;
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRefOfCopy;
+
+class HeaderIndexedBlockStorageTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    auto storage = std::make_unique<NiceMock<MockBlockStorage>>();
+    storage_ = storage.get();
+    ON_CALL(*storage_, insert(_)).WillByDefault(Return(true));
+    index_ = std::make_unique<HeaderIndexedBlockStorage>(std::move(storage),
+                                                         kCapacity);
+  }
+
+  /// @return block of the given height with one rejected transaction
+  std::shared_ptr<MockBlock> makeBlock(
+      shared_model::interface::types::HeightType height) {
+    auto block = std::make_shared<NiceMock<MockBlock>>();
+    ON_CALL(*block, height()).WillByDefault(Return(height));
+    ON_CALL(*block, hash())
+        .WillByDefault(ReturnRefOfCopy(makeHash(height)));
+    ON_CALL(*block, prevHash())
+        .WillByDefault(ReturnRefOfCopy(makeHash(height - 1)));
+    ON_CALL(*block, createdTime()).WillByDefault(Return(height * 1000));
+    ON_CALL(*block, txsNumber()).WillByDefault(Return(2));
+    ON_CALL(*block, rejected_transactions_hashes())
+        .WillByDefault(Return(rejected_));
+    return block;
+  }
+
+  static shared_model::crypto::Hash makeHash(
+      shared_model::interface::types::HeightType height) {
+    return shared_model::crypto::Hash(std::to_string(height));
+  }
+
+  static constexpr size_t kCapacity = 2;
+
+  std::vector<shared_model::crypto::Hash> rejected_{makeHash(0)};
+  MockBlockStorage *storage_;
+  std::unique_ptr<HeaderIndexedBlockStorage> index_;
+};
+
+constexpr size_t HeaderIndexedBlockStorageTest::kCapacity;
+
+/**
+ * @given header index in front of the storage
+ * @when a block is inserted @and its header is fetched
+ * @then the header fields match the block @and the storage is not read
+ */
+TEST_F(HeaderIndexedBlockStorageTest, InsertedBlockIsIndexed) {
+  EXPECT_CALL(*storage_, fetch(_)).Times(0);
+  ASSERT_TRUE(index_->insert(makeBlock(5)));
+
+  auto header = index_->fetchHeader(5);
+  ASSERT_TRUE(header);
+  EXPECT_EQ(5, header->height);
+  EXPECT_EQ(makeHash(5), header->hash);
+  EXPECT_EQ(makeHash(4), header->prev_hash);
+  EXPECT_EQ(5000, header->created_time);
+  EXPECT_EQ(2, header->tx_count);
+  EXPECT_EQ(1, header->rejected_count);
+}
+
+/**
+ * @given header index in front of the storage
+ * @when insertion to the storage fails
+ * @then the header is not indexed
+ */
+TEST_F(HeaderIndexedBlockStorageTest, FailedInsertIsNotIndexed) {
+  EXPECT_CALL(*storage_, insert(_)).WillOnce(Return(false));
+  ASSERT_FALSE(index_->insert(makeBlock(1)));
+
+  EXPECT_CALL(*storage_, fetch(1)).WillOnce(Return(boost::none));
+  EXPECT_FALSE(index_->fetchHeader(1));
+  EXPECT_EQ(0, index_->indexedSize());
+}
+
+/**
+ * @given header index with the capacity of two headers
+ * @when blocks 1 to 3 are inserted @and the header of block 1 is fetched
+ * @then block 1 is read from the storage @and the headers of the highest
+ * blocks are kept
+ */
+TEST_F(HeaderIndexedBlockStorageTest, LowestHeadersAreDropped) {
+  std::shared_ptr<const shared_model::interface::Block> first = makeBlock(1);
+  for (auto height = 1u; height <= 3; ++height) {
+    ASSERT_TRUE(index_->insert(height == 1 ? first : makeBlock(height)));
+  }
+  EXPECT_EQ(kCapacity, index_->indexedSize());
+
+  EXPECT_CALL(*storage_, fetch(1)).WillOnce(Return(first));
+  auto header = index_->fetchHeader(1);
+  ASSERT_TRUE(header);
+  EXPECT_EQ(makeHash(1), header->hash);
+  EXPECT_EQ(kCapacity, index_->indexedSize());
+
+  EXPECT_CALL(*storage_, fetch(3)).Times(0);
+  EXPECT_TRUE(index_->fetchHeader(3));
+}
+
+/**
+ * @given header index with an indexed block
+ * @when the storage is cleared
+ * @then the index is cleared as well
+ */
+TEST_F(HeaderIndexedBlockStorageTest, Clear) {
+  ASSERT_TRUE(index_->insert(makeBlock(1)));
+  EXPECT_CALL(*storage_, clear());
+  index_->clear();
+  EXPECT_EQ(0, index_->indexedSize());
+}
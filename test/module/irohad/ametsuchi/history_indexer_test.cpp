@@ -0,0 +1,145 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/postgres_history_indexer.hpp"
+
+#include "ametsuchi/impl/in_memory_block_storage.hpp"
+#include "ametsuchi/impl/postgres_block_index.hpp"
+#include "ametsuchi/impl/postgres_indexer.hpp"
+#include "framework/result_fixture.hpp"
+#include "framework/test_logger.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_fixture.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::ametsuchi;
+using framework::expected::val;
+
+class HistoryIndexerTest : public AmetsuchiTest {
+ protected:
+  void SetUp() override {
+    AmetsuchiTest::SetUp();
+
+    // the blocks are committed without their history
+    PostgresBlockIndex block_index(std::make_unique<PostgresIndexer>(*sql),
+                                   getTestLogger("BlockIndex"),
+                                   false);
+    for (size_t height = 1; height <= kBlocks; ++height) {
+      auto block = createBlock(
+          {TestTransactionBuilder().creatorAccountId("user@domain").build()},
+          height);
+      block_index.index(*block);
+      block_storage_.insert(block);
+    }
+  }
+
+  /// @return number of the indexed tx positions by creator
+  size_t creatorPositions() {
+    int count = 0;
+    *sql << "SELECT COUNT(*) FROM tx_position_by_creator", soci::into(count);
+    return static_cast<size_t>(count);
+  }
+
+  /// @return height of the last block with the indexed history
+  shared_model::interface::types::HeightType indexBlocks(size_t max_blocks) {
+    return val(PostgresHistoryIndexer::indexBlocks(*sql,
+                                                   block_storage_,
+                                                   max_blocks,
+                                                   getTestLogger("Indexer")))
+        ->value;
+  }
+
+  static constexpr size_t kBlocks = 3;
+
+  InMemoryBlockStorage block_storage_;
+};
+
+constexpr size_t HistoryIndexerTest::kBlocks;
+
+/**
+ * @given blocks committed without the history
+ * @when the history is not indexed yet
+ * @then there are no tx positions by creator @and the indexed height is 0
+ */
+TEST_F(HistoryIndexerTest, NoHistoryOnCommit) {
+  EXPECT_EQ(0, creatorPositions());
+  EXPECT_EQ(0, val(PostgresHistoryIndexer::indexedHeight(*sql))->value);
+}
+
+/**
+ * @given blocks committed without the history
+ * @when the history is indexed by parts
+ * @then each part continues from the last indexed block
+ */
+TEST_F(HistoryIndexerTest, IndexedByParts) {
+  EXPECT_EQ(2, indexBlocks(2));
+  EXPECT_EQ(2, creatorPositions());
+
+  EXPECT_EQ(kBlocks, indexBlocks(kBlocks));
+  EXPECT_EQ(kBlocks, creatorPositions());
+  EXPECT_EQ(kBlocks, val(PostgresHistoryIndexer::indexedHeight(*sql))->value);
+}
+
+/**
+ * @given blocks with the indexed history
+ * @when the history is indexed again
+ * @then nothing is indexed twice
+ */
+TEST_F(HistoryIndexerTest, IndexedOnce) {
+  ASSERT_EQ(kBlocks, indexBlocks(kBlocks));
+  EXPECT_EQ(kBlocks, indexBlocks(kBlocks));
+  EXPECT_EQ(kBlocks, creatorPositions());
+}
+
+/**
+ * @given history tables, which are partitioned on PostgreSQL 11 and later
+ * @when the history of a block in a partition which does not exist yet is
+ * indexed
+ * @then the partition of the block and the next one are created
+ * @and the history is indexed into them
+ */
+TEST_F(HistoryIndexerTest, CreatesPartitions) {
+  int version = 0;
+  *sql << "SELECT CAST(current_setting('server_version_num') AS int)",
+      soci::into(version);
+  if (version < 110000) {
+    return;
+  }
+  auto partitions = [this] {
+    int count = 0;
+    *sql << "SELECT COUNT(*) FROM pg_class WHERE relname IN "
+            "('tx_position_by_creator_2', 'tx_position_by_creator_3')",
+        soci::into(count);
+    return count;
+  };
+  auto height = 2 * PgConnectionInit::kHistoryPartitionBlocks + 1;
+
+  PostgresIndexer indexer(*sql);
+  indexer.txPositionByCreator("user@domain", {height, 0});
+  ASSERT_FALSE(iroha::expected::hasError(indexer.flush()));
+
+  EXPECT_EQ(2, partitions());
+  EXPECT_EQ(1, creatorPositions());
+  int count = 0;
+  *sql << "SELECT COUNT(*) FROM tx_position_by_creator_2", soci::into(count);
+  EXPECT_EQ(1, count);
+}
+
+/**
+ * @given blocks committed without the history, all of the same creator
+ * @when the history is indexed
+ * @then the positions refer to the single key of the creator id
+ */
+TEST_F(HistoryIndexerTest, CreatorKeyedByDictionary) {
+  EXPECT_EQ(kBlocks, indexBlocks(kBlocks));
+
+  int keys = 0;
+  std::string id;
+  *sql << "SELECT COUNT(DISTINCT creator_key), MIN(iroha_key_id(creator_key)) "
+          "FROM tx_position_by_creator",
+      soci::into(keys), soci::into(id);
+  EXPECT_EQ(1, keys);
+  EXPECT_EQ("user@domain", id);
+}
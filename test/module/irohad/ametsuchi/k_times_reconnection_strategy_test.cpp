@@ -45,3 +45,28 @@ TEST(KTimesReconnectionStrategyTest, UseAfterReset) {
   }
   ASSERT_FALSE(strategy.canReconnect());
 }
+
+/**
+ * @given strategies with k limit made by the same factory
+ * @when  both of them are reset
+ *        @and canReconnect is invoked k + 1 times on each
+ * @then  the factory statistics count two failovers, 2k attempts
+ *        @and two exhausted reconnections
+ */
+TEST(KTimesReconnectionStrategyTest, FactoryStatistics) {
+  size_t K = 3;
+  KTimesReconnectionStrategyFactory factory(K);
+  auto first = factory.create();
+  auto second = factory.create();
+  for (auto *strategy : {first.get(), second.get()}) {
+    strategy->reset();
+    for (size_t i = 0; i < K + 1; ++i) {
+      strategy->canReconnect();
+    }
+  }
+
+  auto statistics = factory.statistics();
+  EXPECT_EQ(2, statistics->failovers->value());
+  EXPECT_EQ(2 * K, statistics->attempts->value());
+  EXPECT_EQ(2, statistics->exhausted->value());
+}
@@ -0,0 +1,58 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/ledger_state_peer_query.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <backend/plain/peer.hpp>
+
+class LedgerStatePeerQueryTest : public ::testing::Test {
+  void SetUp() override {
+    peers_.push_back(std::make_shared<shared_model::plain::Peer>(
+        "some-address",
+        shared_model::crypto::PublicKey("some-public-key"),
+        boost::none));
+    peers_.push_back(std::make_shared<shared_model::plain::Peer>(
+        "another-address",
+        shared_model::crypto::PublicKey("another-public-key"),
+        boost::none));
+    peer_query_ = std::make_unique<iroha::ametsuchi::LedgerStatePeerQuery>(
+        std::make_shared<const iroha::LedgerState>(
+            peers_, 1, shared_model::crypto::Hash("hash")));
+  }
+
+ protected:
+  shared_model::interface::types::PeerList peers_;
+  std::unique_ptr<iroha::ametsuchi::PeerQuery> peer_query_;
+};
+
+/**
+ * @given ledger state with peers
+ * @when trying to get all peers in the ledger
+ * @then get a vector with all peers of the ledger state
+ */
+TEST_F(LedgerStatePeerQueryTest, GetPeers) {
+  auto result = peer_query_->getLedgerPeers();
+  ASSERT_TRUE(result);
+  ASSERT_THAT(result.get(),
+              testing::ElementsAreArray(peers_.cbegin(), peers_.cend()));
+}
+
+/**
+ * @given ledger state with peers
+ * @when trying to get the peers by their public keys
+ * @then the peer of the ledger state is found
+ * @and the unknown key is not found
+ */
+TEST_F(LedgerStatePeerQueryTest, GetPeerByPublicKey) {
+  auto result = peer_query_->getLedgerPeerByPublicKey(
+      shared_model::crypto::PublicKey("another-public-key"));
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result.get(), peers_[1]);
+
+  EXPECT_FALSE(peer_query_->getLedgerPeerByPublicKey(
+      shared_model::crypto::PublicKey("unknown-public-key")));
+}
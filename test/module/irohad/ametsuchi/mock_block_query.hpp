@@ -18,9 +18,18 @@ namespace iroha {
       MOCK_METHOD1(
           getBlock,
           BlockQuery::BlockResult(shared_model::interface::types::HeightType));
+      MOCK_METHOD1(getSerializedBlock,
+                   BlockQuery::SerializedBlockResult(
+                       shared_model::interface::types::HeightType));
+      MOCK_METHOD1(getBlockHeader,
+                   BlockQuery::BlockHeaderResult(
+                       shared_model::interface::types::HeightType));
       MOCK_METHOD1(checkTxPresence,
                    boost::optional<TxCacheStatusType>(
                        const shared_model::crypto::Hash &));
+      MOCK_METHOD1(checkTxsPresence,
+                   boost::optional<std::vector<TxCacheStatusType>>(
+                       const std::vector<shared_model::crypto::Hash> &));
       MOCK_METHOD0(getTopBlockHeight,
                    shared_model::interface::types::HeightType());
     };
@@ -9,6 +9,7 @@
 #include "ametsuchi/mutable_factory.hpp"
 
 #include <gmock/gmock.h>
+#include "interfaces/iroha_internal/block.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -25,7 +26,8 @@ namespace iroha {
         return commit_(mutableStorage);
       }
 
-      MOCK_CONST_METHOD0(preparedCommitEnabled, bool());
+      MOCK_CONST_METHOD1(preparedCommitEnabled,
+                         bool(const shared_model::interface::Block &));
       MOCK_METHOD1(
           commitPrepared,
           CommitResult(std::shared_ptr<const shared_model::interface::Block>));
@@ -23,9 +23,14 @@ namespace iroha {
           bool validate_signatories = true) override {
         return QueryExecutorResult(validateAndExecute_(q));
       }
+      MOCK_METHOD2(validateAndExecuteBatch,
+                   std::vector<QueryExecutorResult>(const QueryBatchType &,
+                                                    const bool));
       MOCK_METHOD2(validate,
                    bool(const shared_model::interface::BlocksQuery &,
                         const bool validate_signatories));
+      MOCK_METHOD1(validateSignatories,
+                   bool(const shared_model::interface::Query &));
     };
 
   }  // namespace ametsuchi
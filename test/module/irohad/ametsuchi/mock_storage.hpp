@@ -13,6 +13,7 @@
 #include "ametsuchi/block_storage_factory.hpp"
 #include "ametsuchi/mutable_storage.hpp"
 #include "ametsuchi/temporary_wsv.hpp"
+#include "interfaces/iroha_internal/block.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -36,13 +37,16 @@ namespace iroha {
                          boost::optional<std::shared_ptr<BlockQuery>>());
       MOCK_CONST_METHOD0(createSettingQuery,
                          boost::optional<std::unique_ptr<SettingQuery>>());
+      MOCK_CONST_METHOD0(createWsvSnapshot,
+                         expected::Result<WsvSnapshot, std::string>());
       MOCK_CONST_METHOD2(
           createQueryExecutor,
           boost::optional<std::shared_ptr<QueryExecutor>>(
               std::shared_ptr<PendingTransactionStorage>,
               std::shared_ptr<shared_model::interface::QueryResponseFactory>));
       MOCK_METHOD1(doCommit, CommitResult(MutableStorage *storage));
-      MOCK_CONST_METHOD0(preparedCommitEnabled, bool());
+      MOCK_CONST_METHOD1(preparedCommitEnabled,
+                         bool(const shared_model::interface::Block &));
       MOCK_METHOD1(
           commitPrepared,
           CommitResult(std::shared_ptr<const shared_model::interface::Block>));
@@ -58,12 +62,15 @@ namespace iroha {
                        const shared_model::interface::Peer &));
       MOCK_METHOD0(reset, void());
       MOCK_METHOD0(resetWsv, expected::Result<void, std::string>());
+      MOCK_METHOD1(restoreWsvSnapshot, CommitResult(const WsvSnapshot &));
       MOCK_METHOD0(resetPeers, void());
       MOCK_METHOD0(dropStorage, void());
       MOCK_METHOD0(freeConnections, void());
       MOCK_METHOD1(prepareBlock_, void(std::unique_ptr<TemporaryWsv> &));
 
-      void prepareBlock(std::unique_ptr<TemporaryWsv> wsv) override {
+      void prepareBlock(std::unique_ptr<TemporaryWsv> wsv,
+                        std::vector<shared_model::interface::types::HashType>)
+          override {
         // gmock workaround for non-copyable parameters
         prepareBlock_(wsv);
       }
@@ -20,7 +20,9 @@ namespace iroha {
           std::unique_ptr<TemporaryWsv>(std::shared_ptr<CommandExecutor>));
       MOCK_METHOD1(prepareBlock_, void(std::unique_ptr<TemporaryWsv> &));
 
-      void prepareBlock(std::unique_ptr<TemporaryWsv> wsv) override {
+      void prepareBlock(std::unique_ptr<TemporaryWsv> wsv,
+                        std::vector<shared_model::interface::types::HashType>)
+          override {
         // gmock workaround for non-copyable parameters
         prepareBlock_(wsv);
       }
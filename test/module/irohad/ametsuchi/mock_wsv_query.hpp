@@ -28,6 +28,10 @@ namespace iroha {
           getPeerByPublicKey,
           boost::optional<std::shared_ptr<shared_model::interface::Peer>>(
               const shared_model::interface::types::PubkeyType &public_key));
+
+      MOCK_METHOD1(getStateDigest,
+                   boost::optional<std::string>(
+                       shared_model::interface::types::HeightType height));
     };
 
   }  // namespace ametsuchi
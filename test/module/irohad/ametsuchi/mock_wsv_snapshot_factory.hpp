@@ -0,0 +1,25 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_MOCK_WSV_SNAPSHOT_FACTORY_HPP
+#define IROHA_MOCK_WSV_SNAPSHOT_FACTORY_HPP
+
+#include "ametsuchi/wsv_snapshot_factory.hpp"
+
+#include <gmock/gmock.h>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    class MockWsvSnapshotFactory : public WsvSnapshotFactory {
+     public:
+      MOCK_CONST_METHOD0(createWsvSnapshot,
+                         expected::Result<WsvSnapshot, std::string>());
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_MOCK_WSV_SNAPSHOT_FACTORY_HPP
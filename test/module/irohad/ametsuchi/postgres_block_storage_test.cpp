@@ -209,3 +209,62 @@ TEST_F(PostgresBlockStorageTest, ForEach) {
 
   ASSERT_EQ(2, count);
 }
+
+/**
+ * @given block storage which buffers the inserted blocks
+ * @when fewer blocks than the flush size are inserted
+ * @then they are read back before the flush
+ * @and a block of a non-sequential height is rejected while buffered
+ */
+TEST_F(PostgresBlockStorageTest, BufferedInsert) {
+  block_storage_ = PostgresBlockStorageFactory(
+                       pool_wrapper_,
+                       block_factory_,
+                       [&]() { return test_table_ + "_buffered"; },
+                       getTestLogger("PostgresBlockStorage"),
+                       64)
+                       .create();
+  auto tx = TestTransactionBuilder().creatorAccountId(creator_).build();
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(std::move(tx));
+  for (auto height = height_; height < height_ + 3; ++height) {
+    ASSERT_TRUE(block_storage_->insert(
+        clone(TestBlockBuilder().height(height).transactions(txs).build())));
+  }
+  ASSERT_FALSE(block_storage_->insert(mock_other_block_));
+
+  ASSERT_EQ(3, block_storage_->size());
+  ASSERT_TRUE(block_storage_->fetch(height_ + 2));
+}
+
+/**
+ * @given block storage which buffers the inserted blocks
+ * @when enough blocks are inserted to be written with COPY
+ * @then all of them are stored in order
+ */
+TEST_F(PostgresBlockStorageTest, CopyInsert) {
+  const auto blocks = PostgresBlockStorage::kMinCopyBlocks;
+  block_storage_ = PostgresBlockStorageFactory(
+                       pool_wrapper_,
+                       block_factory_,
+                       [&]() { return test_table_ + "_copy"; },
+                       getTestLogger("PostgresBlockStorage"),
+                       blocks)
+                       .create();
+  auto tx = TestTransactionBuilder().creatorAccountId(creator_).build();
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(std::move(tx));
+  std::vector<shared_model::proto::Block> inserted;
+  for (size_t i = 0; i < blocks; ++i) {
+    inserted.push_back(
+        TestBlockBuilder().height(height_ + i).transactions(txs).build());
+    ASSERT_TRUE(block_storage_->insert(clone(inserted.back())));
+  }
+
+  ASSERT_EQ(blocks, block_storage_->size());
+  for (const auto &block : inserted) {
+    auto stored = block_storage_->fetch(block.height());
+    ASSERT_TRUE(stored);
+    EXPECT_EQ(block.blob(), (*stored)->blob());
+  }
+}
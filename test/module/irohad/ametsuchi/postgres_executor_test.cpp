@@ -2364,5 +2364,40 @@ namespace iroha {
       ASSERT_EQ(setting_value.get(), value);
     }
 
+    class PreparedStatementsTest : public CommandExecutorTest {
+     public:
+      /// @return number of the statements prepared in the executor session
+      int preparedStatements() {
+        int count = 0;
+        executor->getSession()
+            << "SELECT count(*) FROM pg_prepared_statements",
+            soci::into(count);
+        return count;
+      }
+    };
+
+    /**
+     * @given command executor
+     * @when commands are executed with and without validation
+     * @then a statement is prepared only on the first execution of the
+     * command with the same validation
+     */
+    TEST_F(PreparedStatementsTest, StatementIsPreparedOnFirstUse) {
+      EXPECT_EQ(0, preparedStatements());
+
+      createDefaultRole();
+      EXPECT_EQ(1, preparedStatements());
+
+      CHECK_SUCCESSFUL_RESULT(execute(
+          *mock_command_factory->constructCreateRole("role2", role_permissions),
+          true));
+      EXPECT_EQ(1, preparedStatements());
+
+      // the creator has no permissions, so only the preparation matters
+      execute(*mock_command_factory->constructCreateRole("role3",
+                                                         role_permissions));
+      EXPECT_EQ(2, preparedStatements());
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -164,3 +164,38 @@ TEST(PostgresOptionsTest, SeparateParams) {
               default_working_dbname,
               "maintenance_dbname");
 }
+
+/**
+ * @given PostgresOptions initialized with two replicas
+ * @when replica connection strings are requested
+ * @then each of them connects to the working database of the replica with the
+ * credentials of the primary
+ */
+TEST(PostgresOptionsTest, Replicas) {
+  auto pg_opt = PostgresOptions("down",
+                                1991,
+                                "whales",
+                                "donald",
+                                default_working_dbname,
+                                "maintenance_dbname",
+                                test_log,
+                                {{"replica1", 1992}, {"replica2", 1993}},
+                                2,
+                                std::chrono::milliseconds(50));
+  auto replicas = pg_opt.replicaConnectionStrings();
+  ASSERT_EQ(2, replicas.size());
+  checkConnString(replicas[0],
+                  "replica1",
+                  "1992",
+                  "whales",
+                  "donald",
+                  default_working_dbname);
+  checkConnString(replicas[1],
+                  "replica2",
+                  "1993",
+                  "whales",
+                  "donald",
+                  default_working_dbname);
+  EXPECT_EQ(2, pg_opt.replicaMaxLag());
+  EXPECT_EQ(std::chrono::milliseconds(50), pg_opt.slowStatementThreshold());
+}
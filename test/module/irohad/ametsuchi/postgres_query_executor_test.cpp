@@ -1446,6 +1446,37 @@ namespace iroha {
           });
     }
 
+    /**
+     * @given initialized storage, user has many transactions committed
+     * @when query contains one of the last transactions as a starting hash
+     * @then response contains the last page
+     * @and it is read not much slower than the first page, as the page is an
+     * index range instead of a scan of all the transactions of the user
+     */
+    TYPED_TEST(GetPagedTransactionsExecutorTest, DeepPageTime) {
+      const size_t kTransactions = 1000;
+      const types::TransactionsNumberType kPageSize = 10;
+      this->createTransactionsAndCommit(kTransactions);
+
+      auto measure = [this, kPageSize](const auto &first_hash) {
+        auto start = std::chrono::steady_clock::now();
+        auto query_response = this->queryPage(kPageSize, first_hash);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        checkSuccessfulResult<TransactionsPageResponse>(
+            std::move(query_response),
+            [this, kPageSize, &first_hash](const auto &tx_page_response) {
+              this->generalTransactionsPageResponseCheck(
+                  tx_page_response, kPageSize, first_hash);
+            });
+        return elapsed;
+      };
+
+      auto first_page = measure(boost::optional<types::HashType>{});
+      auto deep_page = measure(boost::make_optional(
+          this->tx_hashes_.at(kTransactions - kPageSize)));
+      EXPECT_LT(deep_page, first_page * 10 + std::chrono::milliseconds(100));
+    }
+
     // --------------------\ end of tx pagination tests /-------------------- //
 
     class GetTransactionsHashExecutorTest : public GetTransactionsExecutorTest {
@@ -0,0 +1,164 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/segment_file_block_storage.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include "ametsuchi/impl/block_tx_index.hpp"
+#include "backend/protobuf/block.hpp"
+#include "framework/test_logger.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "module/shared_model/validators/validators.hpp"
+
+using namespace iroha::ametsuchi;
+namespace fs = boost::filesystem;
+using shared_model::validation::MockValidator;
+
+class SegmentFileBlockStorageTest : public ::testing::Test {
+ protected:
+  void TearDown() override {
+    storage_.reset();
+    fs::remove_all(block_store_path_);
+  }
+
+  /// create the storage of the blocks, with the transaction index if needed
+  void createStorage(bool index_transactions) {
+    auto segment_file =
+        SegmentFile::create(block_store_path_, getTestLogger("SegmentFile"));
+    ASSERT_TRUE(segment_file);
+    std::unique_ptr<SegmentFile> tx_index;
+    if (index_transactions) {
+      auto tx_index_file = SegmentFile::create(
+          (fs::path{block_store_path_} / "tx_index").string(),
+          getTestLogger("TxIndex"));
+      ASSERT_TRUE(tx_index_file);
+      tx_index = std::move(*tx_index_file);
+    }
+    storage_ = std::make_unique<SegmentFileBlockStorage>(
+        std::move(*segment_file),
+        std::make_shared<shared_model::proto::ProtoBlockFactory>(
+            std::make_unique<MockValidator<shared_model::interface::Block>>(),
+            std::make_unique<MockValidator<iroha::protocol::Block>>()),
+        getTestLogger("SegmentFileBlockStorage"),
+        std::move(tx_index));
+  }
+
+  /// @return block of the given height with several transactions
+  std::shared_ptr<shared_model::proto::Block> makeBlock(
+      shared_model::interface::types::HeightType height) {
+    std::vector<shared_model::proto::Transaction> transactions;
+    for (size_t i = 0; i < kTransactions; ++i) {
+      transactions.push_back(TestTransactionBuilder()
+                                 .creatorAccountId("admin@test")
+                                 .createdTime(height * kTransactions + i)
+                                 .setAccountDetail("admin@test",
+                                                   "key" + std::to_string(i),
+                                                   "value")
+                                 .build());
+    }
+    return std::make_shared<shared_model::proto::Block>(
+        TestBlockBuilder()
+            .height(height)
+            .createdTime(height)
+            .transactions(transactions)
+            .build());
+  }
+
+  /// check that all transactions of the block are fetched by their indices
+  void checkTransactions(const shared_model::interface::Block &block) {
+    auto transactions = block.transactions();
+    for (size_t i = 0; i < kTransactions; ++i) {
+      auto tx = storage_->fetchTransaction(block.height(), i);
+      ASSERT_TRUE(tx);
+      EXPECT_EQ(transactions[i], **tx);
+    }
+    EXPECT_FALSE(storage_->fetchTransaction(block.height(), kTransactions));
+  }
+
+  static constexpr size_t kTransactions = 3;
+
+  std::string block_store_path_ =
+      (fs::temp_directory_path() / fs::unique_path()).string();
+  std::unique_ptr<SegmentFileBlockStorage> storage_;
+};
+
+constexpr size_t SegmentFileBlockStorageTest::kTransactions;
+
+/**
+ * @given serialized block
+ * @when its transactions are located
+ * @then every location holds the serialized transaction
+ */
+TEST_F(SegmentFileBlockStorageTest, LocateTransactions) {
+  auto block = makeBlock(1);
+  const auto &blob = block->blob().blob();
+
+  auto locations = block_tx_index::locate(blob.data(), blob.size());
+  ASSERT_TRUE(locations);
+  ASSERT_EQ(kTransactions, locations->size());
+  const auto &payload = block->getTransport().payload();
+  for (size_t i = 0; i < kTransactions; ++i) {
+    auto location = (*locations)[i];
+    EXPECT_EQ(payload.transactions(i).SerializeAsString(),
+              std::string(blob.begin() + location.offset,
+                          blob.begin() + location.offset + location.size));
+  }
+}
+
+/**
+ * @given storage with the transaction index
+ * @when the transactions are fetched by their indices
+ * @then they are the transactions of the inserted blocks
+ */
+TEST_F(SegmentFileBlockStorageTest, FetchIndexedTransaction) {
+  createStorage(true);
+  auto block1 = makeBlock(1);
+  auto block2 = makeBlock(2);
+  ASSERT_TRUE(storage_->insert(block1));
+  ASSERT_TRUE(storage_->insert(block2));
+
+  checkTransactions(*block1);
+  checkTransactions(*block2);
+}
+
+/**
+ * @given storage with blocks inserted without the transaction index
+ * @when the storage is reopened with the index @and the transactions are
+ * fetched
+ * @then the transactions of the blocks without the index records are read
+ * from the whole blocks
+ */
+TEST_F(SegmentFileBlockStorageTest, FetchNotIndexedTransaction) {
+  createStorage(false);
+  auto block1 = makeBlock(1);
+  ASSERT_TRUE(storage_->insert(block1));
+  ASSERT_TRUE(storage_->flush());
+  storage_.reset();
+
+  createStorage(true);
+  auto block2 = makeBlock(2);
+  ASSERT_TRUE(storage_->insert(block2));
+
+  checkTransactions(*block1);
+  checkTransactions(*block2);
+}
+
+/**
+ * @given storage with the transaction index
+ * @when the storage is cleared @and the blocks are inserted again
+ * @then the transactions are fetched from the new blocks
+ */
+TEST_F(SegmentFileBlockStorageTest, ClearIndexedStorage) {
+  createStorage(true);
+  ASSERT_TRUE(storage_->insert(makeBlock(1)));
+  storage_->clear();
+  EXPECT_FALSE(storage_->fetchTransaction(1, 0));
+
+  auto block = makeBlock(1);
+  ASSERT_TRUE(storage_->insert(block));
+  checkTransactions(*block);
+}
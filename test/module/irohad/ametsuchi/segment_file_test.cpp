@@ -0,0 +1,312 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/segment_file/segment_file.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "framework/test_logger.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha::ametsuchi;
+namespace fs = boost::filesystem;
+using Identifier = SegmentFile::Identifier;
+using Bytes = SegmentFile::Bytes;
+
+class SegmentFileTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    fs::create_directory(block_store_path);
+  }
+  void TearDown() override {
+    fs::remove_all(block_store_path);
+    fs::remove_all(archive_path);
+  }
+
+  std::unique_ptr<SegmentFile> createStore(uint64_t segment_size = 1000) {
+    auto store = SegmentFile::create(block_store_path, log_, segment_size);
+    EXPECT_TRUE(store);
+    return store ? std::move(*store) : nullptr;
+  }
+
+  /// @return block of the size filled with the id
+  static Bytes makeBlock(Identifier id, size_t size = 100) {
+    return Bytes(size, static_cast<uint8_t>(id));
+  }
+
+  /// @return number of segment files in the storage directory
+  size_t segmentsCount() const {
+    return std::count_if(fs::directory_iterator{block_store_path},
+                         fs::directory_iterator{},
+                         [](const auto &entry) {
+                           return entry.path().extension()
+                               == SegmentFile::kSegmentExtension;
+                         });
+  }
+
+  std::string block_store_path =
+      (fs::temp_directory_path() / fs::unique_path()).string();
+  std::string archive_path =
+      (fs::temp_directory_path() / fs::unique_path()).string();
+
+  logger::LoggerPtr log_ = getTestLogger("SegmentFile");
+};
+
+/**
+ * @given empty storage
+ * @when blocks are added
+ * @then the same blocks are read @and the identifiers are indexed
+ */
+TEST_F(SegmentFileTest, ReadWrite) {
+  auto store = createStore();
+  ASSERT_TRUE(store->add(1, makeBlock(1)));
+  ASSERT_TRUE(store->add(2, makeBlock(2, 0)));
+  ASSERT_TRUE(store->add(3, makeBlock(3)));
+
+  EXPECT_TRUE(store->get(1) == makeBlock(1));
+  EXPECT_TRUE(store->get(2) == makeBlock(2, 0));
+  EXPECT_TRUE(store->get(3) == makeBlock(3));
+  EXPECT_FALSE(store->get(4));
+  EXPECT_EQ(3, store->last_id());
+  EXPECT_EQ(std::vector<Identifier>({1, 2, 3}), store->identifiers());
+  EXPECT_TRUE(store->flush());
+}
+
+/**
+ * @given storage with a block
+ * @when the block with the same or lower identifier is added
+ * @then it is not added
+ */
+TEST_F(SegmentFileTest, AppendOnly) {
+  auto store = createStore();
+  ASSERT_TRUE(store->add(2, makeBlock(2)));
+
+  EXPECT_FALSE(store->add(2, makeBlock(3)));
+  EXPECT_FALSE(store->add(1, makeBlock(1)));
+  EXPECT_TRUE(store->get(2) == makeBlock(2));
+  EXPECT_EQ(1, store->size());
+}
+
+/**
+ * @given storage with segments limited to 1000 bytes
+ * @when 20 blocks of 100 bytes are added
+ * @then they are written to several segments @and all of them are read
+ */
+TEST_F(SegmentFileTest, SegmentRollover) {
+  auto store = createStore();
+  for (Identifier id = 1; id <= 20; ++id) {
+    ASSERT_TRUE(store->add(id, makeBlock(id)));
+  }
+
+  // 9 records with headers fit in a segment
+  EXPECT_EQ(3, segmentsCount());
+  for (Identifier id = 1; id <= 20; ++id) {
+    EXPECT_TRUE(store->get(id) == makeBlock(id));
+  }
+}
+
+/**
+ * @given storage with blocks in several segments
+ * @when the storage is created again in the same directory
+ * @then the index is restored @and new blocks are appended
+ */
+TEST_F(SegmentFileTest, Reopen) {
+  {
+    auto store = createStore();
+    for (Identifier id = 1; id <= 15; ++id) {
+      ASSERT_TRUE(store->add(id, makeBlock(id)));
+    }
+    ASSERT_TRUE(store->flush());
+  }
+
+  auto store = createStore();
+  EXPECT_EQ(15, store->size());
+  EXPECT_EQ(15, store->last_id());
+  for (Identifier id = 1; id <= 15; ++id) {
+    EXPECT_TRUE(store->get(id) == makeBlock(id));
+  }
+  ASSERT_TRUE(store->add(16, makeBlock(16)));
+  EXPECT_TRUE(store->get(16) == makeBlock(16));
+}
+
+/**
+ * @given storage with blocks @and the last record is cut in the middle
+ * @and unknown file in the directory
+ * @when the storage is created again in the same directory
+ * @then the incomplete block is dropped @and it can be added again
+ * @and the unknown file is kept
+ */
+TEST_F(SegmentFileTest, IncompleteRecord) {
+  fs::path segment;
+  {
+    auto store = createStore(100000);
+    for (Identifier id = 1; id <= 3; ++id) {
+      ASSERT_TRUE(store->add(id, makeBlock(id)));
+    }
+    segment = fs::path{block_store_path}
+        / (FlatFile::id_to_name(1) + SegmentFile::kSegmentExtension);
+  }
+  fs::resize_file(segment, fs::file_size(segment) - 50);
+  const auto unknown_file = fs::path{block_store_path} / "unknown";
+  fs::ofstream(unknown_file) << "data";
+
+  auto store = createStore(100000);
+  EXPECT_EQ(2, store->last_id());
+  EXPECT_FALSE(store->get(3));
+  ASSERT_TRUE(store->add(3, makeBlock(3)));
+  EXPECT_TRUE(store->get(3) == makeBlock(3));
+  EXPECT_TRUE(fs::exists(unknown_file));
+}
+
+/**
+ * @given storage with blocks
+ * @when all blocks are dropped
+ * @then the storage is empty @and new blocks are added
+ */
+TEST_F(SegmentFileTest, DropAll) {
+  auto store = createStore();
+  for (Identifier id = 1; id <= 10; ++id) {
+    ASSERT_TRUE(store->add(id, makeBlock(id)));
+  }
+
+  store->dropAll();
+  EXPECT_EQ(0, store->size());
+  EXPECT_EQ(0, segmentsCount());
+  ASSERT_TRUE(store->add(1, makeBlock(5)));
+  EXPECT_TRUE(store->get(1) == makeBlock(5));
+}
+
+/**
+ * @given flat file storage with blocks
+ * @when it is migrated to the empty segment storage
+ * @then the segment storage contains the converted blocks
+ */
+TEST_F(SegmentFileTest, Migration) {
+  const auto flat_file_path = (fs::path{block_store_path} / "flat").string();
+  auto flat_file = FlatFile::create(flat_file_path, log_);
+  ASSERT_TRUE(flat_file);
+  for (Identifier id = 1; id <= 12; ++id) {
+    ASSERT_TRUE((*flat_file)->add(id, makeBlock(id)));
+  }
+
+  const auto segments_path = (fs::path{block_store_path} / "seg").string();
+  auto store = SegmentFile::create(segments_path, log_, 1000);
+  ASSERT_TRUE(store);
+  auto convert = [](const Bytes &block) {
+    return boost::make_optional(Bytes(block.size() / 2, block.front()));
+  };
+  ASSERT_TRUE(migrateFlatFile(**flat_file, **store, convert, log_));
+
+  EXPECT_EQ(12, (*store)->size());
+  for (Identifier id = 1; id <= 12; ++id) {
+    EXPECT_TRUE((*store)->get(id) == makeBlock(id, 50));
+  }
+}
+
+/**
+ * @given flat file storage with blocks
+ * @when it is migrated with the conversion failing for a block
+ * @then the migration fails
+ */
+TEST_F(SegmentFileTest, MigrationFailure) {
+  const auto flat_file_path = (fs::path{block_store_path} / "flat").string();
+  auto flat_file = FlatFile::create(flat_file_path, log_);
+  ASSERT_TRUE(flat_file);
+  for (Identifier id = 1; id <= 3; ++id) {
+    ASSERT_TRUE((*flat_file)->add(id, makeBlock(id)));
+  }
+
+  const auto segments_path = (fs::path{block_store_path} / "seg").string();
+  auto store = SegmentFile::create(segments_path, log_);
+  ASSERT_TRUE(store);
+  auto convert = [](const Bytes &block) -> boost::optional<Bytes> {
+    if (block.front() == 2) {
+      return boost::none;
+    }
+    return block;
+  };
+  EXPECT_FALSE(migrateFlatFile(**flat_file, **store, convert, log_));
+  EXPECT_EQ(1, (*store)->last_id());
+}
+
+/**
+ * @given storage with an archive keeping 2 records locally
+ * @and the cache of a single segment
+ * @when 20 blocks are added and flushed
+ * @then the segments older than the last 2 blocks are moved to the archive
+ * @and all blocks are read, the archived ones through the cache
+ * @and the storage is restored from the local headers after a restart
+ */
+TEST_F(SegmentFileTest, Archive) {
+  const SegmentFile::Archive archive{archive_path, 2, 1};
+  auto create = [&] {
+    auto store = SegmentFile::create(block_store_path, log_, 1000, archive);
+    EXPECT_TRUE(store);
+    return store ? std::move(*store) : nullptr;
+  };
+  auto count = [](const std::string &path, const std::string &extension) {
+    return std::count_if(
+        fs::directory_iterator{path},
+        fs::directory_iterator{},
+        [&](const auto &entry) {
+          return entry.path().extension() == extension;
+        });
+  };
+
+  {
+    auto store = create();
+    for (Identifier id = 1; id <= 20; ++id) {
+      ASSERT_TRUE(store->add(id, makeBlock(id)));
+    }
+    ASSERT_TRUE(store->flush());
+
+    // segments of 1-9 and 10-18 are archived, 19-20 are written
+    EXPECT_EQ(1, segmentsCount());
+    EXPECT_EQ(2, count(block_store_path, SegmentFile::kArchivedExtension));
+    EXPECT_EQ(2, count(archive_path, SegmentFile::kSegmentExtension));
+    for (Identifier id = 1; id <= 20; ++id) {
+      EXPECT_TRUE(store->get(id) == makeBlock(id));
+    }
+    EXPECT_TRUE(store->get(12, 10, 20) == makeBlock(12, 20));
+    EXPECT_EQ(1,
+              count((fs::path{block_store_path} / SegmentFile::kCacheDirectory)
+                        .string(),
+                    SegmentFile::kSegmentExtension));
+  }
+
+  auto store = create();
+  EXPECT_EQ(20, store->size());
+  for (Identifier id = 1; id <= 20; ++id) {
+    EXPECT_TRUE(store->get(id) == makeBlock(id));
+  }
+  ASSERT_TRUE(store->add(21, makeBlock(21)));
+
+  store->dropAll();
+  EXPECT_EQ(0, count(archive_path, SegmentFile::kSegmentExtension));
+}
+
+/**
+ * @given storage with archived segments
+ * @when the storage is created again without the archive
+ * @then the creation fails
+ */
+TEST_F(SegmentFileTest, ArchiveNotConfigured) {
+  {
+    auto store = SegmentFile::create(
+        block_store_path,
+        log_,
+        1000,
+        SegmentFile::Archive{archive_path, 0, 1});
+    ASSERT_TRUE(store);
+    for (Identifier id = 1; id <= 20; ++id) {
+      ASSERT_TRUE((*store)->add(id, makeBlock(id)));
+    }
+    ASSERT_TRUE((*store)->flush());
+  }
+
+  EXPECT_FALSE(SegmentFile::create(block_store_path, log_, 1000));
+}
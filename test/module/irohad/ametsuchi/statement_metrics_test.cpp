@@ -0,0 +1,37 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/statement_metrics.hpp"
+
+#include <gtest/gtest.h>
+#include "framework/test_logger.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace std::chrono_literals;
+
+/**
+ * @given statement metrics
+ * @when statements of different kinds are executed
+ * @then every statement has its own execution time histogram and rows
+ * @and the statements are ordered by kind and name
+ */
+TEST(StatementMetricsTest, RecordsEveryStatement) {
+  StatementMetrics metrics(0ms, getTestLogger("StatementMetrics"));
+  metrics.record("query", "GetAccount", 300us);
+  metrics.record("index", "flush", 2ms, 7);
+  metrics.record("index", "flush", 1ms, 3);
+
+  auto samples = metrics.samples();
+  ASSERT_EQ(2, samples.size());
+  EXPECT_EQ("index", samples[0].kind);
+  EXPECT_EQ("flush", samples[0].name);
+  EXPECT_EQ(2, samples[0].time->count());
+  EXPECT_EQ(3000, samples[0].time->sum());
+  EXPECT_EQ(10, samples[0].rows);
+  EXPECT_EQ("query", samples[1].kind);
+  EXPECT_EQ("GetAccount", samples[1].name);
+  EXPECT_EQ(1, samples[1].time->count());
+  EXPECT_EQ(0, samples[1].rows);
+}
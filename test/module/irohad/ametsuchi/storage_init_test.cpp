@@ -19,6 +19,7 @@
 #include "common/result.hpp"
 #include "framework/config_helper.hpp"
 #include "framework/test_logger.hpp"
+#include "interfaces/permissions.hpp"
 #include "logger/logger_manager.hpp"
 #include "main/impl/pg_connection_init.hpp"
 #include "module/irohad/pending_txs_storage/pending_txs_storage_mock.hpp"
@@ -160,3 +161,90 @@ TEST_F(StorageInitTest, CreateStorageWithInvalidPgOpt) {
   pool.match([](const auto &) { FAIL() << "storage created, but should not"; },
              [](const auto &) { SUCCEED(); });
 }
+
+/**
+ * @given database created before the tx hashes were stored as bytea, with
+ * the hashes in hex
+ * @when the tables are prepared
+ * @then the hash columns are converted to bytea @and keep the hashes
+ */
+TEST_F(StorageInitTest, MigratesHexHashes) {
+  PostgresOptions options(pgopt_,
+                          integration_framework::kDefaultWorkingDatabaseName,
+                          storage_log_manager_->getLogger());
+  PgConnectionInit::createDatabaseIfNotExist(options).match(
+      [](auto &&val) {}, [&](auto &&error) { FAIL() << error.error; });
+
+  soci::session sql(*soci::factory_postgresql(), pgopt_);
+  sql << R"(
+      CREATE TABLE position_by_hash (hash varchar, height bigint, index bigint);
+      CREATE TABLE tx_status_by_hash (hash varchar, status boolean);
+      INSERT INTO position_by_hash VALUES ('0a0b', 1, 0);
+      INSERT INTO tx_status_by_hash VALUES ('0a0b', TRUE);)";
+  PgConnectionInit::prepareTables(sql);
+
+  for (const std::string table : {"position_by_hash", "tx_status_by_hash"}) {
+    std::string type, hash;
+    sql << "SELECT data_type FROM information_schema.columns "
+           "WHERE table_name = :table AND column_name = 'hash'",
+        soci::into(type), soci::use(table);
+    EXPECT_EQ(type, "bytea");
+    sql << "SELECT encode(hash, 'hex') FROM " + table, soci::into(hash);
+    EXPECT_EQ(hash, "0a0b");
+  }
+  sql.close();
+}
+
+/**
+ * @given database with an account of two roles
+ * @when the permissions of a role are changed and a role is detached
+ * @then the effective permissions of the account follow the roles
+ * @and they are filled for the roles of the databases created before
+ */
+TEST_F(StorageInitTest, MaintainsEffectivePermissions) {
+  PostgresOptions options(pgopt_,
+                          integration_framework::kDefaultWorkingDatabaseName,
+                          storage_log_manager_->getLogger());
+  PgConnectionInit::createDatabaseIfNotExist(options).match(
+      [](auto &&val) {}, [&](auto &&error) { FAIL() << error.error; });
+
+  soci::session sql(*soci::factory_postgresql(), pgopt_);
+  PgConnectionInit::prepareTables(sql);
+  auto role_bits = [&](size_t bit) {
+    std::string value(shared_model::interface::RolePermissionSet::size(), '0');
+    value[bit] = '1';
+    return value;
+  };
+  auto effective = [&] {
+    std::string value;
+    sql << "SELECT CAST(permission AS text) FROM account_effective_permissions "
+           "WHERE account_id = 'user@test'",
+        soci::into(value);
+    return value;
+  };
+  sql << "INSERT INTO role VALUES ('first'), ('second')";
+  sql << "INSERT INTO role_has_permissions VALUES ('first', '" + role_bits(0)
+          + "'), ('second', '" + role_bits(1) + "')";
+  sql << "INSERT INTO domain VALUES ('test', 'first')";
+  sql << "INSERT INTO account VALUES ('user@test', 'test', 1)";
+  sql << "INSERT INTO account_has_roles VALUES "
+         "('user@test', 'first'), ('user@test', 'second')";
+
+  auto both = role_bits(0);
+  both[1] = '1';
+  EXPECT_EQ(effective(), both);
+
+  sql << "UPDATE role_has_permissions SET permission = '" + role_bits(2)
+          + "' WHERE role_id = 'first'";
+  auto changed = role_bits(1);
+  changed[2] = '1';
+  EXPECT_EQ(effective(), changed);
+
+  sql << "DELETE FROM account_has_roles WHERE role_id = 'second'";
+  EXPECT_EQ(effective(), role_bits(2));
+
+  sql << "DELETE FROM account_effective_permissions";
+  PgConnectionInit::prepareTables(sql);
+  EXPECT_EQ(effective(), role_bits(2));
+  sql.close();
+}
@@ -32,6 +32,17 @@ namespace iroha {
                        [](auto &tx) { return T{tx->hash()}; });
         return result;
       }
+
+      boost::optional<BatchStatusCollectionType> check(
+          const std::vector<shared_model::crypto::Hash> &hashes)
+          const override {
+        BatchStatusCollectionType result;
+        std::transform(hashes.begin(),
+                       hashes.end(),
+                       std::back_inserter(result),
+                       [](auto &hash) { return T{hash}; });
+        return result;
+      }
     };
 
   }  // namespace ametsuchi
@@ -4,6 +4,10 @@
  */
 
 #include <gtest/gtest.h>
+#include <boost/make_shared.hpp>
+#include <boost/optional/optional_io.hpp>
+#include <boost/range/adaptor/indirected.hpp>
+#include <boost/shared_container_iterator.hpp>
 
 #include "ametsuchi/impl/tx_presence_cache_impl.hpp"
 #include "cryptography/public_key.hpp"
@@ -116,15 +120,12 @@ TEST_F(TxPresenceCacheTest, BatchHashTest) {
   shared_model::crypto::Hash hash3("3");
   shared_model::crypto::Hash reduced_hash_3("r3");
 
-  EXPECT_CALL(*mock_block_query, checkTxPresence(hash1))
-      .WillOnce(Return(boost::make_optional<TxCacheStatusType>(
-          tx_cache_status_responses::Rejected(hash1))));
-  EXPECT_CALL(*mock_block_query, checkTxPresence(hash2))
-      .WillOnce(Return(boost::make_optional<TxCacheStatusType>(
-          tx_cache_status_responses::Committed(hash2))));
-  EXPECT_CALL(*mock_block_query, checkTxPresence(hash3))
-      .WillOnce(Return(boost::make_optional<TxCacheStatusType>(
-          tx_cache_status_responses::Missing(hash3))));
+  std::vector<shared_model::crypto::Hash> hashes{hash1, hash2, hash3};
+  EXPECT_CALL(*mock_block_query, checkTxsPresence(hashes))
+      .WillOnce(Return(std::vector<TxCacheStatusType>{
+          tx_cache_status_responses::Rejected(hash1),
+          tx_cache_status_responses::Committed(hash2),
+          tx_cache_status_responses::Missing(hash3)}));
   auto tx1 = std::make_shared<MockTransaction>();
   EXPECT_CALL(*tx1, hash()).WillOnce(ReturnRefOfCopy(hash1));
   EXPECT_CALL(*tx1, reducedHash()).WillOnce(ReturnRefOfCopy(reduced_hash_1));
@@ -172,3 +173,75 @@ TEST_F(TxPresenceCacheTest, BatchHashTest) {
       },
       [&](const auto &error) { FAIL() << error.error; });
 }
+
+/**
+ * @given hashes, one of which has a status in the memory cache
+ * @when cache asked for the statuses of the hashes
+ * @then the other hashes are checked in storage with a single query
+ * @and statuses are returned in the order of the hashes
+ */
+TEST_F(TxPresenceCacheTest, HashesCheckedInStorageOnce) {
+  shared_model::crypto::Hash hash1("1"), hash2("2"), hash3("3");
+  EXPECT_CALL(*mock_block_query, checkTxPresence(hash2))
+      .WillOnce(Return(boost::make_optional<TxCacheStatusType>(
+          tx_cache_status_responses::Committed(hash2))));
+  EXPECT_CALL(*mock_block_query,
+              checkTxsPresence(
+                  std::vector<shared_model::crypto::Hash>{hash1, hash3}))
+      .WillOnce(Return(std::vector<TxCacheStatusType>{
+          tx_cache_status_responses::Missing(hash1),
+          tx_cache_status_responses::Rejected(hash3)}));
+  TxPresenceCacheImpl cache(mock_storage);
+  cache.check(hash2);
+
+  auto statuses = *cache.check(
+      std::vector<shared_model::crypto::Hash>{hash1, hash2, hash3});
+
+  ASSERT_EQ(3, statuses.size());
+  EXPECT_NO_THROW(
+      boost::get<tx_cache_status_responses::Missing>(statuses.at(0)));
+  EXPECT_NO_THROW(
+      boost::get<tx_cache_status_responses::Committed>(statuses.at(1)));
+  EXPECT_NO_THROW(
+      boost::get<tx_cache_status_responses::Rejected>(statuses.at(2)));
+}
+
+/**
+ * @given storage with the top block containing a committed and a rejected
+ * transaction
+ * @when cache is warmed up with the top block @and asked for the statuses
+ * of the transactions
+ * @then the statuses are returned without querying storage
+ */
+TEST_F(TxPresenceCacheTest, WarmUpCachesRecentBlocks) {
+  shared_model::crypto::Hash committed_hash("1"), rejected_hash("2");
+  auto tx = std::make_shared<MockTransaction>();
+  EXPECT_CALL(*tx, hash()).WillRepeatedly(ReturnRefOfCopy(committed_hash));
+  auto block = std::make_unique<MockBlock>();
+  EXPECT_CALL(*block, transactions())
+      .WillOnce(Return(
+          boost::make_shared_container_range(
+              boost::make_shared<std::vector<std::shared_ptr<MockTransaction>>>(
+                  1, tx))
+          | boost::adaptors::indirected));
+  std::vector<shared_model::crypto::Hash> rejected_hashes{rejected_hash};
+  EXPECT_CALL(*block, rejected_transactions_hashes())
+      .WillOnce(Return(
+          shared_model::interface::types::HashCollectionType(rejected_hashes)));
+  EXPECT_CALL(*mock_block_query, getTopBlockHeight()).WillOnce(Return(5));
+  EXPECT_CALL(*mock_block_query, getBlock(5))
+      .WillOnce(Return(ByMove(BlockQuery::BlockResult(
+          iroha::expected::makeValue<
+              std::unique_ptr<shared_model::interface::Block>>(
+              std::move(block))))));
+  EXPECT_CALL(*mock_block_query, checkTxPresence(_)).Times(0);
+  EXPECT_CALL(*mock_block_query, checkTxsPresence(_)).Times(0);
+  TxPresenceCacheImpl cache(mock_storage);
+
+  ASSERT_EQ(boost::make_optional<size_t>(2), cache.warmUp(1));
+
+  EXPECT_NO_THROW(boost::get<tx_cache_status_responses::Committed>(
+      *cache.check(committed_hash)));
+  EXPECT_NO_THROW(boost::get<tx_cache_status_responses::Rejected>(
+      *cache.check(rejected_hash)));
+}
@@ -0,0 +1,153 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/wsv_cache.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/optional/optional_io.hpp>
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::ametsuchi;
+
+class WsvCacheTest : public ::testing::Test {
+ public:
+  /// @return account with a single signatory and quorum 1
+  WsvCache::AccountPtr makeAccount(const std::string &public_key) {
+    auto account = std::make_shared<WsvCache::Account>();
+    account->signatories.insert(public_key);
+    account->quorum = 1;
+    return account;
+  }
+
+  static constexpr size_t kCapacity = 2;
+
+  WsvCache cache_{kCapacity};
+};
+
+constexpr size_t WsvCacheTest::kCapacity;
+
+/**
+ * @given empty cache
+ * @when an account is put with the current version @and requested
+ * @then the account is returned @and a miss and a hit are counted
+ */
+TEST_F(WsvCacheTest, PutAccountIsCached) {
+  EXPECT_FALSE(cache_.find("user@domain"));
+  auto account = makeAccount("key");
+  cache_.put("user@domain", account, cache_.version());
+
+  EXPECT_EQ(account, cache_.find("user@domain"));
+  EXPECT_EQ(1, cache_.hits()->value());
+  EXPECT_EQ(1, cache_.misses()->value());
+}
+
+/**
+ * @given version of the cache taken before an account is read
+ * @when a block is committed @and the account is put afterwards
+ * @then the account is not cached
+ */
+TEST_F(WsvCacheTest, StaleAccountIsNotCached) {
+  auto version = cache_.version();
+  cache_.invalidate(*createBlock({}));
+  cache_.put("user@domain", makeAccount("key"), version);
+
+  EXPECT_FALSE(cache_.find("user@domain"));
+  EXPECT_EQ(0, cache_.size());
+}
+
+/**
+ * @given cache full of two accounts, the first one is used recently
+ * @when the third account is put
+ * @then the second account is evicted
+ */
+TEST_F(WsvCacheTest, LeastRecentlyUsedIsEvicted) {
+  cache_.put("first@domain", makeAccount("key"), cache_.version());
+  cache_.put("second@domain", makeAccount("key"), cache_.version());
+  ASSERT_TRUE(cache_.find("first@domain"));
+  cache_.put("third@domain", makeAccount("key"), cache_.version());
+
+  EXPECT_EQ(kCapacity, cache_.size());
+  EXPECT_TRUE(cache_.find("first@domain"));
+  EXPECT_FALSE(cache_.find("second@domain"));
+  EXPECT_TRUE(cache_.find("third@domain"));
+}
+
+/**
+ * @given cache full of two accounts, the first one is used recently
+ * @when the capacity is reduced to one account @and then increased to three
+ * @then the second account is evicted @and three accounts are cached
+ * afterwards
+ */
+TEST_F(WsvCacheTest, SetCapacity) {
+  cache_.put("first@domain", makeAccount("key"), cache_.version());
+  cache_.put("second@domain", makeAccount("key"), cache_.version());
+  ASSERT_TRUE(cache_.find("first@domain"));
+
+  cache_.setCapacity(1);
+  EXPECT_EQ(1, cache_.size());
+  EXPECT_TRUE(cache_.find("first@domain"));
+  EXPECT_FALSE(cache_.find("second@domain"));
+
+  cache_.setCapacity(3);
+  cache_.put("second@domain", makeAccount("key"), cache_.version());
+  cache_.put("third@domain", makeAccount("key"), cache_.version());
+  EXPECT_EQ(3, cache_.size());
+}
+
+/**
+ * @given cache with two accounts
+ * @when a block which sets the quorum of one of them is committed
+ * @then only that account is evicted
+ */
+TEST_F(WsvCacheTest, ChangedAccountIsInvalidated) {
+  cache_.put("changed@domain", makeAccount("key"), cache_.version());
+  cache_.put("kept@domain", makeAccount("key"), cache_.version());
+
+  cache_.invalidate(*createBlock({TestTransactionBuilder()
+                                      .creatorAccountId("kept@domain")
+                                      .setAccountQuorum("changed@domain", 2)
+                                      .build()}));
+
+  EXPECT_FALSE(cache_.find("changed@domain"));
+  EXPECT_TRUE(cache_.find("kept@domain"));
+}
+
+/**
+ * @given commands of a transaction
+ * @when the changed accounts are requested
+ * @then the accounts of the signatories and quorum changes are returned
+ */
+TEST_F(WsvCacheTest, ChangedAccount) {
+  auto transaction =
+      TestTransactionBuilder()
+          .creatorAccountId("admin@domain")
+          .createAccount("user", "domain", shared_model::crypto::PublicKey(""))
+          .setAccountQuorum("quorum@domain", 2)
+          .transferAsset("admin@domain", "user@domain", "coin#domain", "", "1")
+          .build();
+  std::vector<boost::optional<std::string>> accounts;
+  for (const auto &command : transaction.commands()) {
+    accounts.push_back(WsvCache::changedAccount(command));
+  }
+
+  ASSERT_EQ(3, accounts.size());
+  EXPECT_EQ(std::string{"user@domain"}, accounts[0]);
+  EXPECT_EQ(std::string{"quorum@domain"}, accounts[1]);
+  EXPECT_EQ(boost::none, accounts[2]);
+}
+
+/**
+ * @given cache with an account
+ * @when the cache is cleared
+ * @then the account is not cached anymore
+ */
+TEST_F(WsvCacheTest, Clear) {
+  cache_.put("user@domain", makeAccount("key"), cache_.version());
+  cache_.clear();
+
+  EXPECT_EQ(0, cache_.size());
+  EXPECT_FALSE(cache_.find("user@domain"));
+}
@@ -35,6 +35,22 @@ namespace iroha {
         AmetsuchiTest::TearDown();
       }
 
+      /// write the top block, which folds the changes into the digest
+      void setTopBlock(long long height) {
+        *sql << "INSERT INTO top_block_info (lock, height, hash) "
+                "VALUES ('X', :height, 'hash') "
+                "ON CONFLICT (lock) DO UPDATE SET height = EXCLUDED.height",
+            soci::use(height);
+      }
+
+      /// @return digest computed from all the rows of the WSV
+      std::string scanStateDigest() {
+        std::string digest;
+        *sql << "SELECT CAST(iroha_wsv_digest_scan() AS text)",
+            soci::into(digest);
+        return digest;
+      }
+
       std::unique_ptr<soci::session> sql;
 
       std::unique_ptr<WsvCommand> command;
@@ -93,5 +109,34 @@ namespace iroha {
                   testing::UnorderedElementsAre(pub_key1, pub_key2));
     }
 
+    /**
+     * @given storage with the rows written in three blocks, the last of which
+     * deletes the rows of the second one
+     * @when the state digests of the blocks are fetched
+     * @then each of them is the digest computed from all the rows
+     * @and the digest of the last block is the one of the first block
+     */
+    TEST_F(WsvQueryTest, GetStateDigest) {
+      command->insertRole("role");
+      shared_model::plain::Domain domain("domain", "role");
+      command->insertDomain(domain);
+      setTopBlock(1);
+      auto first = query->getStateDigest(1);
+      ASSERT_TRUE(first);
+      EXPECT_EQ(*first, scanStateDigest());
+
+      command->insertRole("another_role");
+      setTopBlock(2);
+      auto second = query->getStateDigest(2);
+      ASSERT_TRUE(second);
+      EXPECT_EQ(*second, scanStateDigest());
+      EXPECT_NE(*second, *first);
+
+      *sql << "DELETE FROM role WHERE role_id = 'another_role'";
+      setTopBlock(3);
+      EXPECT_EQ(query->getStateDigest(3), first);
+      EXPECT_FALSE(query->getStateDigest(4));
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -0,0 +1,96 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/yac/impl/adaptive_timer.hpp"
+
+#include <gtest/gtest.h>
+#include <rxcpp/rx-test.hpp>
+#include "consensus/yac/supermajority_checker.hpp"
+#include "cryptography/public_key.hpp"
+
+using namespace iroha::consensus::yac;
+using namespace std::chrono_literals;
+
+class AdaptiveTimerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    timer = std::make_shared<AdaptiveTimer>(
+        500ms,
+        10ms,
+        5000ms,
+        getSupermajorityChecker(ConsistencyModel::kBft),
+        coordination);
+  }
+
+  /// report the latency of the peer with the given key
+  void vote(char key, std::chrono::milliseconds latency) {
+    timer->onVoteLatency(shared_model::crypto::PublicKey(std::string(32, key)),
+                         latency);
+  }
+
+ public:
+  rxcpp::schedulers::test::test_worker worker =
+      rxcpp::schedulers::make_test().create_worker();
+  rxcpp::observe_on_one_worker coordination{
+      rxcpp::schedulers::make_same_worker(worker)};
+  std::shared_ptr<AdaptiveTimer> timer;
+};
+
+/**
+ * @given adaptive timer without measurements
+ * @when the handler is invoked
+ * @then the initial delay is used @and exported
+ */
+TEST_F(AdaptiveTimerTest, InitialDelay) {
+  EXPECT_EQ(500ms, timer->currentDelay());
+
+  int status = 0;
+  timer->invokeAfterDelay([&status] { status = 1; });
+  worker.start();
+  EXPECT_EQ(1, status);
+  EXPECT_EQ(1, timer->delays().count());
+  EXPECT_EQ(500, timer->delays().sum());
+}
+
+/**
+ * @given adaptive timer
+ * @when the latency of a peer is measured twice
+ * @then the delay is the smoothed latency with four variations
+ */
+TEST_F(AdaptiveTimerTest, SmoothedLatency) {
+  vote('a', 100ms);
+  // 100 + 4 * 50
+  EXPECT_EQ(300ms, timer->currentDelay());
+
+  vote('a', 200ms);
+  // 0.875 * 100 + 0.125 * 200 + 4 * (0.75 * 50 + 0.25 * 100)
+  EXPECT_EQ(363ms, timer->currentDelay());
+}
+
+/**
+ * @given adaptive timer
+ * @when the latencies of four peers are measured @and one of them is slow
+ * @then the delay is defined by the fastest supermajority of the peers
+ */
+TEST_F(AdaptiveTimerTest, SupermajorityOfPeers) {
+  vote('a', 100ms);
+  vote('b', 100ms);
+  vote('c', 200ms);
+  vote('d', 1000ms);
+  EXPECT_EQ(600ms, timer->currentDelay());
+}
+
+/**
+ * @given adaptive timer
+ * @when measured latencies exceed the bounds of the delay
+ * @then the delay is bounded
+ */
+TEST_F(AdaptiveTimerTest, BoundedDelay) {
+  vote('a', 1ms);
+  EXPECT_EQ(10ms, timer->currentDelay());
+
+  vote('b', 4000ms);
+  EXPECT_EQ(5000ms, timer->currentDelay());
+}
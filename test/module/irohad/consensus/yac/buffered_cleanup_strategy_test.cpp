@@ -89,3 +89,20 @@ TEST_F(BufferedCleanupStrategyTest, FinalizeWhenManyRounds) {
     ASSERT_EQ((Round{1, i + 1}), removed->at(i));
   }
 }
+
+/**
+ * Stale rounds
+ * @given strategy with committed (2, 1) round
+ * @when  rounds before and after it are checked
+ * @then  only the rounds before the committed one are stale
+ */
+TEST_F(BufferedCleanupStrategyTest, StaleRounds) {
+  ASSERT_FALSE(strategy_->isStale({1, 1}));
+
+  strategy_->shouldCreateRound({2, 1});
+  strategy_->finalize({2, 1}, makeMockCommit());
+
+  ASSERT_TRUE(strategy_->isStale({1, 5}));
+  ASSERT_FALSE(strategy_->isStale({2, 1}));
+  ASSERT_FALSE(strategy_->isStale({2, 2}));
+}
@@ -52,3 +52,51 @@ TEST_F(ClusterOrderTest, ClusterOrderOnNext) {
   ASSERT_EQ("2", order->switchToNext().currentLeader().address());
   ASSERT_EQ("1", order->switchToNext().currentLeader().address());
 }
+
+/**
+ * @given cluster order
+ * @when peers are looked up by public keys
+ * @then indices in the order are returned for the peers of the cluster, and
+ * none for the other keys
+ */
+TEST_F(ClusterOrderTest, PeerIndex) {
+  auto p3 = iroha::consensus::yac::makePeer("0");
+  peers_list.push_back(p3);
+  auto order = iroha::consensus::yac::ClusterOrdering::create(peers_list);
+  ASSERT_TRUE(order);
+
+  auto index = [&order](const auto &peer) {
+    return order->peerIndex(peer->pubkey()).value_or(order->getNumberOfPeers());
+  };
+  EXPECT_EQ(0, index(p1));
+  EXPECT_EQ(1, index(p2));
+  EXPECT_EQ(2, index(p3));
+  EXPECT_FALSE(
+      order->peerIndex(iroha::consensus::yac::makePeer("3")->pubkey()));
+  EXPECT_FALSE(order->peerIndex(nullptr, 0));
+}
+
+/**
+ * @given peers and their permutation
+ * @when cluster order is created from the permutation
+ * @then it has the permuted peers and finds them by public keys as the order
+ * created from the permuted peers does
+ */
+TEST_F(ClusterOrderTest, PermutationOrder) {
+  peers_list.push_back(iroha::consensus::yac::makePeer("0"));
+  std::vector<iroha::consensus::yac::PeersNumberType> permutation{2, 0, 1};
+  auto order = iroha::consensus::yac::ClusterOrdering::create(
+      peers_list,
+      permutation,
+      iroha::consensus::yac::ClusterOrdering::sortByKey(peers_list));
+  auto expected = iroha::consensus::yac::ClusterOrdering::create(
+      {peers_list[2], peers_list[0], peers_list[1]});
+  ASSERT_TRUE(order);
+  ASSERT_TRUE(expected);
+
+  EXPECT_EQ(expected->getPeers(), order->getPeers());
+  for (const auto &peer : peers_list) {
+    EXPECT_EQ(expected->peerIndex(peer->pubkey()),
+              order->peerIndex(peer->pubkey()));
+  }
+}
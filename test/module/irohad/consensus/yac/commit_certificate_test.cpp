@@ -0,0 +1,88 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/yac/commit_certificate.hpp"
+
+#include <gtest/gtest.h>
+#include "module/irohad/consensus/yac/yac_test_util.hpp"
+
+using namespace iroha::consensus::yac;
+
+class CommitCertificateTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    // the certificate does not depend on the order of peers
+    for (auto address : {"c", "a", "d", "b"}) {
+      peers.push_back(makePeer(address));
+    }
+  }
+
+  std::vector<std::shared_ptr<shared_model::interface::Peer>> peers;
+  YacHash hash{iroha::consensus::Round{1, 0}, "proposal", "block"};
+};
+
+/**
+ * @given votes of a part of peers for the same hash
+ * @when certificate is created and expanded
+ * @then signers are set for the voted peers @and the same votes are restored
+ */
+TEST_F(CommitCertificateTest, RoundTrip) {
+  std::vector<VoteMessage> votes{
+      createVote(hash, "d"), createVote(hash, "a"), createVote(hash, "b")};
+
+  auto certificate = makeCommitCertificate(votes, peers);
+  ASSERT_TRUE(certificate);
+  EXPECT_EQ(std::vector<bool>({true, true, false, true}),
+            certificate->signers);
+  EXPECT_EQ(3, certificate->signatures.size());
+  for (const auto &signatures : certificate->signatures) {
+    ASSERT_TRUE(signatures.block_signature);
+    EXPECT_FALSE(signatures.block_signature_pubkey);
+  }
+
+  auto restored = expandCommitCertificate(*certificate, peers);
+  ASSERT_TRUE(restored);
+  ASSERT_EQ(3, restored->size());
+  // votes are restored in the order of signers
+  for (const auto &vote : *restored) {
+    auto it = std::find(votes.begin(), votes.end(), vote);
+    ASSERT_NE(votes.end(), it);
+    EXPECT_EQ(*it->hash.block_signature, *vote.hash.block_signature);
+  }
+}
+
+/**
+ * @given votes for different hashes, from an unknown peer, and a repeated
+ * vote
+ * @when certificates are created
+ * @then none of them is created
+ */
+TEST_F(CommitCertificateTest, InvalidVotes) {
+  auto other_hash = hash;
+  other_hash.vote_hashes.block_hash = "other";
+
+  EXPECT_FALSE(makeCommitCertificate({}, peers));
+  EXPECT_FALSE(makeCommitCertificate(
+      {createVote(hash, "a"), createVote(other_hash, "b")}, peers));
+  EXPECT_FALSE(makeCommitCertificate(
+      {createVote(hash, "a"), createVote(hash, "e")}, peers));
+  EXPECT_FALSE(makeCommitCertificate(
+      {createVote(hash, "a"), createVote(hash, "a")}, peers));
+}
+
+/**
+ * @given certificate of the votes of 4 peers
+ * @when it is expanded for the peers without one of the signers
+ * @then votes are not restored
+ */
+TEST_F(CommitCertificateTest, OtherPeers) {
+  auto certificate = makeCommitCertificate(
+      {createVote(hash, "a"), createVote(hash, "b"), createVote(hash, "d")},
+      peers);
+  ASSERT_TRUE(certificate);
+
+  peers.pop_back();
+  EXPECT_FALSE(expandCommitCertificate(*certificate, peers));
+}
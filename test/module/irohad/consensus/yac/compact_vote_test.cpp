@@ -0,0 +1,97 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/yac/compact_vote.hpp"
+
+#include <gtest/gtest.h>
+#include "backend/plain/signature.hpp"
+#include "consensus/yac/transport/yac_pb_converters.hpp"
+
+using namespace iroha::consensus::yac;
+
+class CompactVoteTest : public ::testing::Test {
+ public:
+  std::shared_ptr<shared_model::interface::Signature> makeSignature(
+      char key, size_t pubkey_length = CompactVote::kPublicKeyLength) {
+    return std::make_shared<shared_model::plain::Signature>(
+        shared_model::crypto::Signed(
+            std::string(CompactVote::kSignatureLength, key + 1)),
+        shared_model::crypto::PublicKey(std::string(pubkey_length, key)));
+  }
+
+  void SetUp() override {
+    vote.hash = YacHash{iroha::consensus::Round{5, 2},
+                        std::string(64, 'a'),
+                        "0123456789abcdef0123456789abcdef"
+                        "0123456789abcdef0123456789abcdef"};
+    vote.hash.block_signature = makeSignature('b');
+    vote.signature = makeSignature('s');
+  }
+
+  void expectEqual(const VoteMessage &expected, const VoteMessage &actual) {
+    EXPECT_EQ(expected, actual);
+    ASSERT_EQ(bool(expected.hash.block_signature),
+              bool(actual.hash.block_signature));
+    if (expected.hash.block_signature) {
+      EXPECT_EQ(*expected.hash.block_signature, *actual.hash.block_signature);
+    }
+  }
+
+  VoteMessage vote;
+};
+
+/**
+ * @given vote with hex hashes and default length keys
+ * @when it is converted to the compact form and back
+ * @then the same vote is restored
+ */
+TEST_F(CompactVoteTest, RoundTrip) {
+  auto compact = makeCompactVote(vote);
+  ASSERT_TRUE(compact);
+  EXPECT_EQ(0xab, compact->block_hash[5]);
+  expectEqual(vote, toVoteMessage(*compact));
+
+  vote.hash.vote_hashes = {};
+  vote.hash.block_signature = nullptr;
+  compact = makeCompactVote(vote);
+  ASSERT_TRUE(compact);
+  EXPECT_EQ(0, compact->flags);
+  expectEqual(vote, toVoteMessage(*compact));
+}
+
+/**
+ * @given vote serialized to protobuf
+ * @when it is deserialized to the compact form and serialized back
+ * @then the votes are the same
+ */
+TEST_F(CompactVoteTest, ProtobufRoundTrip) {
+  auto compact =
+      PbConverters::deserializeCompactVote(PbConverters::serializeVote(vote));
+  ASSERT_TRUE(compact);
+  expectEqual(vote, toVoteMessage(*compact));
+
+  auto pb_vote = PbConverters::serializeCompactVote(*compact);
+  EXPECT_EQ(PbConverters::serializeVote(vote).SerializeAsString(),
+            pb_vote.SerializeAsString());
+}
+
+/**
+ * @given votes with non-hex hashes and keys of other length
+ * @when they are converted to the compact form
+ * @then the conversion fails
+ */
+TEST_F(CompactVoteTest, NotRepresentable) {
+  auto non_hex = vote;
+  non_hex.hash.vote_hashes.proposal_hash = std::string(64, 'A');
+  EXPECT_FALSE(makeCompactVote(non_hex));
+  EXPECT_FALSE(PbConverters::deserializeCompactVote(
+      PbConverters::serializeVote(non_hex)));
+
+  auto other_key = vote;
+  other_key.signature = makeSignature('s', 33);
+  EXPECT_FALSE(makeCompactVote(other_key));
+  EXPECT_FALSE(PbConverters::deserializeCompactVote(
+      PbConverters::serializeVote(other_key)));
+}
@@ -0,0 +1,64 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/yac/impl/gossip_dissemination.hpp"
+
+#include <set>
+
+#include <gtest/gtest.h>
+#include "consensus/yac/cluster_order.hpp"
+#include "module/irohad/consensus/yac/yac_test_util.hpp"
+
+using namespace iroha::consensus::yac;
+
+class GossipDisseminationTest : public ::testing::Test {
+ public:
+  ClusterOrdering makeOrder(size_t number_of_peers) {
+    std::vector<std::shared_ptr<shared_model::interface::Peer>> peers;
+    for (size_t i = 0; i < number_of_peers; ++i) {
+      peers.push_back(makePeer(std::to_string(i)));
+    }
+    return *ClusterOrdering::create(peers);
+  }
+};
+
+/**
+ * @given gossip dissemination with fanout 3
+ * @when recipients of 10 peers are selected several times
+ * @then 3 distinct peers of the cluster are selected every time
+ * @and the selection changes
+ */
+TEST_F(GossipDisseminationTest, RandomRecipients) {
+  GossipDissemination dissemination(3, 42);
+  auto order = makeOrder(10);
+  std::set<std::shared_ptr<shared_model::interface::Peer>> cluster(
+      order.getPeers().begin(), order.getPeers().end());
+
+  std::set<std::shared_ptr<shared_model::interface::Peer>> selected;
+  for (int i = 0; i < 10; ++i) {
+    auto recipients = dissemination.recipients(order);
+    std::set<std::shared_ptr<shared_model::interface::Peer>> unique(
+        recipients.begin(), recipients.end());
+    ASSERT_EQ(3, unique.size());
+    for (const auto &peer : recipients) {
+      ASSERT_EQ(1, cluster.count(peer));
+    }
+    selected.insert(recipients.begin(), recipients.end());
+  }
+  EXPECT_LT(3, selected.size());
+  EXPECT_TRUE(dissemination.forwardsReceived());
+}
+
+/**
+ * @given gossip dissemination with fanout 3
+ * @when recipients of 2 peers are selected
+ * @then all peers are selected
+ */
+TEST_F(GossipDisseminationTest, SmallCluster) {
+  GossipDissemination dissemination(3, 42);
+  auto order = makeOrder(2);
+
+  EXPECT_EQ(order.getPeers(), dissemination.recipients(order));
+}
@@ -8,6 +8,7 @@
 
 #include <gmock/gmock.h>
 
+#include "consensus/yac/commit_certificate.hpp"
 #include "consensus/yac/transport/yac_network_interface.hpp"
 
 namespace iroha {
@@ -29,6 +30,10 @@ namespace iroha {
                      void(const shared_model::interface::Peer &,
                           const std::vector<VoteMessage> &));
 
+        MOCK_METHOD2(sendCertificate,
+                     void(const shared_model::interface::Peer &,
+                          const CommitCertificate &));
+
         MockYacNetwork() = default;
 
         MockYacNetwork(const MockYacNetwork &rhs)
@@ -54,6 +59,7 @@ namespace iroha {
       class MockYacNetworkNotifications : public YacNetworkNotifications {
        public:
         MOCK_METHOD1(onState, void(std::vector<VoteMessage>));
+        MOCK_METHOD1(onCertificate, void(CommitCertificate));
       };
 
     }  // namespace yac
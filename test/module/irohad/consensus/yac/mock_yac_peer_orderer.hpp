@@ -20,7 +20,8 @@ namespace iroha {
             getOrdering,
             boost::optional<ClusterOrdering>(
                 const YacHash &,
-                std::vector<std::shared_ptr<shared_model::interface::Peer>>));
+                const std::vector<
+                    std::shared_ptr<shared_model::interface::Peer>> &));
 
         MockYacPeerOrderer() = default;
 
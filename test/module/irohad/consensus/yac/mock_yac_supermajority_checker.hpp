@@ -21,6 +21,10 @@ namespace iroha {
         MOCK_CONST_METHOD2(isTolerated, bool(PeersNumberType, PeersNumberType));
         MOCK_CONST_METHOD2(canHaveSupermajority,
                            bool(const VoteGroups &, PeersNumberType));
+        MOCK_CONST_METHOD3(canHaveSupermajority,
+                           bool(PeersNumberType,
+                                PeersNumberType,
+                                PeersNumberType));
       };
 
     }  // namespace yac
@@ -84,6 +84,28 @@ namespace iroha {
         ASSERT_EQ(request.votes_size(), 1);
       }
 
+      /**
+       * @given initialized network
+       * @when votes are broadcast to the peers
+       * @then the same request is sent to every peer
+       */
+      TEST_F(YacNetworkTest, BroadcastState) {
+        proto::State first, second;
+        auto r1 = std::make_unique<grpc::testing::MockClientAsyncResponseReader<
+            google::protobuf::Empty>>();
+        auto r2 = std::make_unique<grpc::testing::MockClientAsyncResponseReader<
+            google::protobuf::Empty>>();
+        // both recipients share the stub of the address
+        EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _))
+            .WillOnce(DoAll(SaveArg<1>(&first), Return(r1.get())))
+            .WillOnce(DoAll(SaveArg<1>(&second), Return(r2.get())));
+
+        network->broadcastState({peer, peer}, {message, message});
+
+        ASSERT_EQ(first.votes_size(), 2);
+        EXPECT_EQ(first.SerializeAsString(), second.SerializeAsString());
+      }
+
       /**
        * @given initialized network
        * @when send request with one vote
@@ -111,6 +133,56 @@ namespace iroha {
         auto response = network->SendState(&context, &request, nullptr);
         ASSERT_EQ(response.error_code(), grpc::StatusCode::CANCELLED);
       }
+
+      /**
+       * @given initialized network
+       * @when commit certificate is sent @and the request is received
+       * @then the same certificate is passed to the subscriber
+       */
+      TEST_F(YacNetworkTest, SendCertificate) {
+        using Algorithm = shared_model::crypto::DefaultCryptoAlgorithmType;
+        CommitCertificate certificate;
+        certificate.hash = message.hash;
+        certificate.signers = {true, false, true};
+        certificate.signatures = {
+            {shared_model::crypto::Signed(
+                 std::string(Algorithm::kSignatureLength, '1')),
+             shared_model::crypto::Signed(
+                 std::string(Algorithm::kSignatureLength, '2')),
+             boost::none},
+            {shared_model::crypto::Signed(
+                 std::string(Algorithm::kSignatureLength, '3')),
+             boost::none,
+             boost::none}};
+
+        proto::State request;
+        auto r = std::make_unique<grpc::testing::MockClientAsyncResponseReader<
+            google::protobuf::Empty>>();
+        EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _))
+            .WillOnce(DoAll(SaveArg<1>(&request), Return(r.get())));
+        network->sendCertificate(*peer, certificate);
+        ASSERT_TRUE(request.has_certificate());
+        ASSERT_EQ(request.votes_size(), 0);
+
+        CommitCertificate received;
+        EXPECT_CALL(*notifications, onCertificate(_))
+            .WillOnce(SaveArg<0>(&received));
+        grpc::ServerContext context;
+        auto response = network->SendState(&context, &request, nullptr);
+        ASSERT_EQ(response.error_code(), grpc::StatusCode::OK);
+
+        EXPECT_EQ(certificate.hash, received.hash);
+        // signers are padded to whole bytes
+        EXPECT_EQ(std::vector<bool>({true, false, true, false, false, false,
+                                     false, false}),
+                  received.signers);
+        ASSERT_EQ(2, received.signatures.size());
+        EXPECT_EQ(certificate.signatures[0].vote_signature,
+                  received.signatures[0].vote_signature);
+        EXPECT_EQ(certificate.signatures[0].block_signature,
+                  received.signatures[0].block_signature);
+        EXPECT_FALSE(received.signatures[1].block_signature);
+      }
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
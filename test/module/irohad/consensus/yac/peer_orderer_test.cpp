@@ -6,6 +6,7 @@
 #include "consensus/yac/impl/peer_orderer_impl.hpp"
 
 #include <iostream>
+#include <random>
 #include <unordered_map>
 
 #include <boost/accumulators/accumulators.hpp>
@@ -74,6 +75,27 @@ TEST_F(YacPeerOrdererTest, PeerOrdererOrderingWhenInvokeNormalCase) {
   ASSERT_EQ(order.value().getPeers().size(), peers.size());
 }
 
+/**
+ * @given the peers
+ * @when the orderings are requested for the hashes
+ * @then the peers are shuffled with the block hash as the seed, so that the
+ * order is the same for all versions of the peers
+ */
+TEST_F(YacPeerOrdererTest, SameOrderAsShuffledPeers) {
+  for (auto i = 0; i < 10; ++i) {
+    std::string hash = std::to_string(i);
+    auto order = orderer.getOrdering(
+        YacHash(iroha::consensus::Round{1, 1}, hash, hash), s_peers);
+    ASSERT_TRUE(order);
+
+    auto expected = s_peers;
+    std::seed_seq seed(hash.begin(), hash.end());
+    std::default_random_engine gen(seed);
+    std::shuffle(expected.begin(), expected.end(), gen);
+    EXPECT_EQ(expected, order->getPeers());
+  }
+}
+
 TEST_F(YacPeerOrdererTest, PeerOrdererOrderingWhenEmptyPeerList) {
   auto order = orderer.getOrdering(YacHash(), {});
   ASSERT_EQ(order, boost::none);
@@ -67,6 +67,12 @@ class SupermajorityCheckerTest
     return checker->canHaveSupermajority(votes, all);
   }
 
+  bool canHaveSupermajority(PeersNumberType largest_group,
+                            PeersNumberType voted,
+                            PeersNumberType all) const override {
+    return checker->canHaveSupermajority(largest_group, voted, all);
+  }
+
   std::unique_ptr<SupermajorityChecker> checker{
       getSupermajorityChecker(GetParam())};
 };
@@ -196,6 +202,9 @@ TEST_P(CftAndBftSupermajorityCheckerTest, OneLargeAndManySingleVoteGroups) {
           L              // the votes we know
           + N;           // the peers that we have no votes from
       // Check if any peer on the network can get supermajority:
+      // the counters give the same answer as the vote groups
+      EXPECT_EQ(canHaveSupermajority(vote_groups, c.A),
+                canHaveSupermajority(L, c.V, c.A));
       if (Lp >= S) {
         EXPECT_TRUE(canHaveSupermajority(vote_groups, c.A))
             << "if " << N << " not yet voted peers "
@@ -6,9 +6,11 @@
 #include "consensus/yac/impl/yac_crypto_provider_impl.hpp"
 
 #include <gtest/gtest.h>
+#include <future>
 
 #include "consensus/yac/outcome_messages.hpp"
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "cryptography/crypto_provider/pipelined_signer.hpp"
 
 #include "module/shared_model/interface_mocks.hpp"
 
@@ -75,6 +77,74 @@ namespace iroha {
         ASSERT_FALSE(crypto_provider->verify({vote}));
       }
 
+      /**
+       * @given votes of several peers for the same hash @and a vote for
+       * another hash
+       * @when the votes are verified together
+       * @then verification succeeds
+       */
+      TEST_F(YacCryptoProviderTest, ValidWhenSeveralVotes) {
+        YacHash hash(Round{1, 1}, "1", "1");
+        YacHash other_hash(Round{1, 1}, "2", "2");
+
+        std::vector<VoteMessage> votes;
+        for (int i = 0; i < 4; ++i) {
+          CryptoProviderImpl provider(
+              shared_model::crypto::DefaultCryptoAlgorithmType::
+                  generateKeypair());
+          votes.push_back(provider.getVote(hash));
+        }
+        votes.push_back(crypto_provider->getVote(other_hash));
+
+        ASSERT_TRUE(crypto_provider->verify(votes));
+      }
+
+      /**
+       * @given votes of several peers for the same hash
+       * @when the signature of one vote is replaced @and the votes are
+       * verified together
+       * @then verification fails
+       */
+      TEST_F(YacCryptoProviderTest, InvalidWhenOneVoteInvalid) {
+        YacHash hash(Round{1, 1}, "1", "1");
+
+        std::vector<VoteMessage> votes;
+        for (int i = 0; i < 4; ++i) {
+          CryptoProviderImpl provider(
+              shared_model::crypto::DefaultCryptoAlgorithmType::
+                  generateKeypair());
+          votes.push_back(provider.getVote(hash));
+        }
+        votes.at(2).signature = makeSignature();
+
+        ASSERT_FALSE(crypto_provider->verify(votes));
+      }
+
+      /**
+       * @given crypto provider with a pipelined signer
+       * @when a vote is signed asynchronously
+       * @then the vote signed in the thread of the signer is valid
+       */
+      TEST_F(YacCryptoProviderTest, ValidWhenSignedAsync) {
+        YacHash hash(Round{1, 1}, "1", "1");
+        auto keypair = this->keypair;
+        CryptoProviderImpl provider(
+            std::make_shared<shared_model::crypto::PipelinedSigner>(
+                keypair.publicKey(),
+                [keypair](const shared_model::crypto::Blob &blob) {
+                  return shared_model::crypto::DefaultCryptoAlgorithmType::
+                      sign(blob, keypair);
+                },
+                2));
+
+        std::promise<VoteMessage> vote;
+        provider.signVote(hash, [&vote](VoteMessage signed_vote) {
+          vote.set_value(std::move(signed_vote));
+        });
+
+        ASSERT_TRUE(crypto_provider->verify({vote.get_future().get()}));
+      }
+
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
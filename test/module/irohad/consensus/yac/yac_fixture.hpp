@@ -60,7 +60,9 @@ namespace iroha {
           network->release();
         }
 
-        void initYac(ClusterOrdering ordering) {
+        void initYac(ClusterOrdering ordering,
+                     std::shared_ptr<DisseminationStrategy> dissemination =
+                         nullptr) {
           yac = Yac::create(
               YacVoteStorage(
                   std::make_shared<
@@ -74,7 +76,9 @@ namespace iroha {
               initial_round,
               rxcpp::observe_on_one_worker(
                   rxcpp::schedulers::make_current_thread()),
-              getTestLogger("Yac"));
+              getTestLogger("Yac"),
+              false,
+              std::move(dissemination));
           network->subscribe(yac);
         }
       };
@@ -48,7 +48,7 @@ class YacProposalStorageTest : public ::testing::Test {
     EXPECT_CALL(*supermajority_checker, hasSupermajority(_, _))
         .WillRepeatedly(
             Invoke([this](auto c, auto) { return c >= supermajority; }));
-    EXPECT_CALL(*supermajority_checker, canHaveSupermajority(_, _))
+    EXPECT_CALL(*supermajority_checker, canHaveSupermajority(_, _, _))
         .WillRepeatedly(Return(true));
   }
 };
@@ -97,10 +97,12 @@ TEST_F(YacProposalStorageTest, YacProposalStorageWhenRejectCase) {
 
   EXPECT_CALL(*supermajority_checker, hasSupermajority(_, _))
       .WillRepeatedly(Return(false));
-  EXPECT_CALL(*supermajority_checker, canHaveSupermajority(_, _))
-      .WillRepeatedly(Invoke([&num_inserted, &super_reject](auto, auto) {
-        return num_inserted < super_reject;
-      }));
+  EXPECT_CALL(*supermajority_checker, canHaveSupermajority(_, _, _))
+      .WillRepeatedly(
+          Invoke([&num_inserted, &super_reject](auto, auto voted, auto) {
+            EXPECT_EQ(num_inserted, voted);
+            return num_inserted < super_reject;
+          }));
 
   while (num_inserted < number_of_peers) {
     auto insert_result = storage.insert(valid_votes.at(num_inserted++));
@@ -120,3 +122,34 @@ TEST_F(YacProposalStorageTest, YacProposalStorageWhenRejectCase) {
     }
   }
 }
+
+/**
+ * @given storage
+ * @when votes for two hashes and a repeated vote are inserted
+ * @then supermajority checker gets the number of votes for the most voted
+ * hash and the number of all votes after every new vote
+ */
+TEST_F(YacProposalStorageTest, VoteCounters) {
+  const YacHash other_hash =
+      YacHash(iroha::consensus::Round{1, 1}, "proposal", "other");
+
+  EXPECT_CALL(*supermajority_checker, hasSupermajority(_, _))
+      .WillRepeatedly(Return(false));
+  std::vector<std::pair<PeersNumberType, PeersNumberType>> counters;
+  EXPECT_CALL(*supermajority_checker, canHaveSupermajority(_, _, _))
+      .WillRepeatedly(Invoke([&counters](auto largest_group, auto voted, auto) {
+        counters.emplace_back(largest_group, voted);
+        return true;
+      }));
+
+  storage.insert(createVote(hash, "0"));
+  storage.insert(createVote(other_hash, "1"));
+  storage.insert(createVote(other_hash, "2"));
+  storage.insert(createVote(other_hash, "2"));
+  storage.insert(createVote(hash, "3"));
+  storage.insert(createVote(hash, "4"));
+
+  EXPECT_EQ((std::vector<std::pair<PeersNumberType, PeersNumberType>>{
+                {1, 1}, {1, 2}, {2, 3}, {2, 4}, {3, 5}}),
+            counters);
+}
@@ -64,6 +64,26 @@ TEST_F(YacTest, YacWhenColdStartAndAchieveOneVote) {
   ASSERT_TRUE(wrapper.validate());
 }
 
+/**
+ * @given yac
+ * @when a state with a valid signature and a state with an invalid one are
+ * received
+ * @then both states pass the verification stage @and only the valid one
+ * passes the storage stage
+ */
+TEST_F(YacTest, StateProcessingStages) {
+  EXPECT_CALL(*crypto, verify(_))
+      .WillOnce(Return(true))
+      .WillOnce(Return(false));
+
+  YacHash received_hash(initial_round, "my_proposal", "my_block");
+  network->notification->onState({crypto->getVote(received_hash, "0")});
+  network->notification->onState({crypto->getVote(received_hash, "1")});
+
+  EXPECT_EQ(2, yac->verificationQueueDepth().count());
+  EXPECT_EQ(1, yac->storageQueueDepth().count());
+}
+
 /**
  * Test provide scenario
  * when yac cold started and achieve supermajority of votes
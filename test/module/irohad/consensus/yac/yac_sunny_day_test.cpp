@@ -6,6 +6,7 @@
 #include <string>
 #include <utility>
 
+#include "consensus/yac/impl/gossip_dissemination.hpp"
 #include "consensus/yac/storage/yac_proposal_storage.hpp"
 
 #include "framework/test_subscriber.hpp"
@@ -85,6 +86,43 @@ TEST_F(YacTest, ValidCaseWhenReceiveCommit) {
   ASSERT_TRUE(wrapper.validate());
 }
 
+/**
+ * @given initialized YAC with gossip dissemination of fanout 2
+ * @when vote for hash
+ * AND receive commit for voted hash twice
+ * @then commit is forwarded to 2 peers once
+ * AND commit is emitted once
+ */
+TEST_F(YacTest, GossipForwardsReceivedCommitOnce) {
+  auto my_peers = decltype(default_peers)(
+      {default_peers.begin(), default_peers.begin() + 4});
+  auto my_order = ClusterOrdering::create(my_peers);
+  ASSERT_TRUE(my_order);
+
+  EXPECT_CALL(*timer, deny()).Times(1);
+
+  initYac(my_order.value(), std::make_shared<GossipDissemination>(2, 42));
+
+  YacHash my_hash(iroha::consensus::Round{1, 1}, "proposal_hash", "block_hash");
+  auto wrapper = make_test_subscriber<CallExact>(yac->onOutcome(), 1);
+  wrapper.subscribe();
+
+  // the own vote to every peer and the forwarded commit to 2 peers
+  EXPECT_CALL(*network, sendState(_, _)).Times(my_peers.size() + 2);
+
+  EXPECT_CALL(*crypto, verify(_)).WillRepeatedly(Return(true));
+
+  yac->vote(my_hash, my_order.value());
+
+  auto votes = std::vector<VoteMessage>();
+  for (auto i = 0; i < 4; ++i) {
+    votes.push_back(createVote(my_hash, std::to_string(i)));
+  };
+  yac->onState(votes);
+  yac->onState(votes);
+  ASSERT_TRUE(wrapper.validate());
+}
+
 /**
  * @given initialized YAC with empty state
  * @when vote for hash
@@ -21,3 +21,36 @@ TEST(LoggerTest, boolReprTest) {
   ASSERT_EQ("true", logger::boolRepr(true));
   ASSERT_EQ("false", logger::boolRepr(false));
 }
+
+/**
+ * @given logger tree with a child logger at the info level
+ * @when the levels are updated from a tree with the debug level of the child
+ * @and then from a tree without the child and with the warning level
+ * @then the child logs the debug messages after the first update
+ * @and the child takes the level of the parent after the second update, as
+ * well as the child which is created afterwards
+ */
+TEST(LoggerTest, UpdatesLevels) {
+  auto makeTree = [](logger::LogLevel level) {
+    return std::make_shared<logger::LoggerManagerTree>(
+        logger::LoggerConfig{level, logger::getDefaultLogPatterns()});
+  };
+  auto manager = makeTree(logger::LogLevel::kInfo);
+  manager->registerChild("child", logger::LogLevel::kInfo, boost::none);
+  auto child = manager->getChild("child")->getLogger();
+
+  auto debug_levels = makeTree(logger::LogLevel::kInfo);
+  debug_levels->registerChild("child", logger::LogLevel::kDebug, boost::none);
+  manager->updateLevels(*debug_levels);
+  testing::internal::CaptureStdout();
+  child->debug("debug after the update");
+  auto output = testing::internal::GetCapturedStdout();
+  EXPECT_NE(output.find("debug after the update"), std::string::npos);
+
+  manager->updateLevels(*makeTree(logger::LogLevel::kWarn));
+  testing::internal::CaptureStdout();
+  child->info("info of the child");
+  manager->getChild("new child")->getLogger()->info("info of the new child");
+  output = testing::internal::GetCapturedStdout();
+  EXPECT_EQ(output.find("info of"), std::string::npos);
+}
@@ -0,0 +1,169 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "maintenance/block_exporter.hpp"
+
+#include <fstream>
+#include <sstream>
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include "ametsuchi/block_query.hpp"
+#include "framework/result_gtest_checkers.hpp"
+#include "framework/test_logger.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::maintenance;
+using namespace boost::filesystem;
+
+/// block query of the blocks made by the function, which counts the reads
+class TestBlockQuery : public iroha::ametsuchi::BlockQuery {
+ public:
+  explicit TestBlockQuery(
+      std::function<std::unique_ptr<shared_model::interface::Block>(
+          shared_model::interface::types::HeightType)> make_block)
+      : make_block_(std::move(make_block)) {}
+
+  BlockResult getBlock(
+      shared_model::interface::types::HeightType height) override {
+    ++reads;
+    return make_block_(height);
+  }
+
+  SerializedBlockResult getSerializedBlock(
+      shared_model::interface::types::HeightType) override {
+    return iroha::expected::makeError(GetBlockError{
+        GetBlockError::Code::kInternalError, "not implemented"});
+  }
+
+  shared_model::interface::types::HeightType getTopBlockHeight() override {
+    return 0;
+  }
+
+  boost::optional<iroha::ametsuchi::TxCacheStatusType> checkTxPresence(
+      const shared_model::crypto::Hash &) override {
+    return boost::none;
+  }
+
+  boost::optional<std::vector<iroha::ametsuchi::TxCacheStatusType>>
+  checkTxsPresence(const std::vector<shared_model::crypto::Hash> &) override {
+    return boost::none;
+  }
+
+  size_t reads = 0;
+
+ private:
+  std::function<std::unique_ptr<shared_model::interface::Block>(
+      shared_model::interface::types::HeightType)>
+      make_block_;
+};
+
+class BlockExporterTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    create_directory(directory_);
+  }
+
+  void TearDown() override {
+    remove_all(directory_);
+  }
+
+  std::unique_ptr<BlockExporter> createExporter() {
+    return std::make_unique<BlockExporter>(
+        directory_, 2, getTestLogger("BlockExporter"));
+  }
+
+  /// @return block with a transfer of the given height
+  std::shared_ptr<shared_model::proto::Block> makeBlock(
+      shared_model::interface::types::HeightType height) {
+    return std::make_shared<shared_model::proto::Block>(
+        TestBlockBuilder()
+            .height(height)
+            .createdTime(height)
+            .transactions(std::vector<shared_model::proto::Transaction>{
+                TestTransactionBuilder()
+                    .creatorAccountId("admin@test")
+                    .createdTime(height)
+                    .quorum(1)
+                    .transferAsset("admin@test",
+                                   "user@test",
+                                   "coin#test",
+                                   "transfer",
+                                   std::to_string(height) + ".00")
+                    .build()})
+            .build());
+  }
+
+  /// @return content of the file in the export directory
+  std::string read(const std::string &name) {
+    std::ifstream file((path(directory_) / name).string());
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+  }
+
+  std::string directory_ = (temp_directory_path() / unique_path()).string();
+};
+
+/**
+ * @given exporter with two transactions per segment
+ * @when three blocks of a transaction are exported
+ * @then the first segment has the first two blocks and is renamed
+ * @and the second segment is renamed when the exporter is destroyed
+ */
+TEST_F(BlockExporterTest, RotatesSegments) {
+  auto exporter = createExporter();
+  std::vector<std::shared_ptr<shared_model::proto::Block>> blocks;
+  for (size_t height = 1; height <= 3; ++height) {
+    blocks.push_back(makeBlock(height));
+    framework::expected::assertResultValue(
+        exporter->exportBlock(*blocks.back()));
+  }
+  EXPECT_TRUE(exists(path(directory_)
+                     / "transactions-00000000000000000001.csv"));
+  EXPECT_TRUE(exists(path(directory_)
+                     / "transactions-00000000000000000003.csv.part"));
+  exporter.reset();
+
+  auto transactions = read("transactions-00000000000000000001.csv");
+  EXPECT_EQ(transactions.find(BlockExporter::kTransactionsHeader), 0);
+  auto hash = blocks[1]->transactions()[0].hash().hex();
+  EXPECT_NE(transactions.find("2,0," + hash + ",admin@test,2,1,1\n"),
+            std::string::npos);
+  auto commands = read("commands-00000000000000000003.csv");
+  EXPECT_EQ(commands.find(BlockExporter::kCommandsHeader), 0);
+  EXPECT_NE(commands.find("\n3,0,0,TransferAsset,\"TransferAsset: "),
+            std::string::npos);
+  EXPECT_EQ(read("exported_height"), "3");
+}
+
+/**
+ * @given exporter which has exported the first block before the restart
+ * @when the blocks up to the third one are backfilled from the block query
+ * @then the export resumes from the second block
+ * @and the block which does not follow the exported ones is rejected
+ */
+TEST_F(BlockExporterTest, ResumesAndBackfills) {
+  auto exporter = createExporter();
+  exporter->push(makeBlock(1));
+  exporter.reset();
+
+  exporter = createExporter();
+  EXPECT_EQ(exporter->exportedHeight(), 1);
+  auto block_query = std::make_shared<TestBlockQuery>([this](auto height) {
+    return clone(*makeBlock(height));
+  });
+  exporter->backfill(block_query, 3);
+  exporter.reset();
+  EXPECT_EQ(block_query->reads, 2);
+
+  exporter = createExporter();
+  EXPECT_EQ(exporter->exportedHeight(), 3);
+  framework::expected::expectResultError(
+      exporter->exportBlock(*makeBlock(5)));
+  EXPECT_TRUE(exists(path(directory_)
+                     / "commands-00000000000000000002.csv"));
+}
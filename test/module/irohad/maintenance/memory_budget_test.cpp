@@ -0,0 +1,74 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "maintenance/memory_budget.hpp"
+
+#include <gtest/gtest.h>
+#include "framework/test_logger.hpp"
+
+using namespace iroha::maintenance;
+
+/**
+ * Consumer which takes the memory it is given up to its demand
+ */
+struct FakeConsumer {
+  size_t demand;
+  size_t usage = demand;
+
+  MemoryBudget::Consumer consumer(std::string name, unsigned priority) {
+    return {std::move(name),
+            priority,
+            [this] { return usage; },
+            [this](size_t limit) { usage = std::min(demand, limit); }};
+  }
+};
+
+/**
+ * @given budget with a reported consumer and two shrinkable ones, which
+ * together exceed the budget
+ * @when the budget is enforced
+ * @then the reported consumer is not limited, the more critical consumer
+ * keeps its memory, and the less critical one gets the rest
+ */
+TEST(MemoryBudgetTest, ShrinksLeastCriticalFirst) {
+  MemoryBudget budget(1000, getTestLogger("MemoryBudget"));
+  size_t reported = 300;
+  FakeConsumer critical{400};
+  FakeConsumer expendable{600};
+  budget.addConsumer({"reported", 0, [&] { return reported; }, {}});
+  budget.addConsumer(expendable.consumer("expendable", 1));
+  budget.addConsumer(critical.consumer("critical", 2));
+
+  budget.enforce();
+
+  EXPECT_EQ(400, critical.usage);
+  EXPECT_EQ(300, expendable.usage);
+
+  // the limits are raised back when the pressure falls
+  reported = 0;
+  budget.enforce();
+
+  EXPECT_EQ(400, critical.usage);
+  EXPECT_EQ(600, expendable.usage);
+}
+
+/**
+ * @given budget without a limit
+ * @when the budget is enforced
+ * @then the consumers are not limited, and their memory is reported
+ */
+TEST(MemoryBudgetTest, NoLimit) {
+  MemoryBudget budget(0, getTestLogger("MemoryBudget"));
+  FakeConsumer consumer{600};
+  budget.addConsumer(consumer.consumer("consumer", 1));
+
+  budget.enforce();
+
+  EXPECT_EQ(600, consumer.usage);
+  auto usage = budget.usage();
+  ASSERT_EQ(1, usage.size());
+  EXPECT_EQ("consumer", usage[0].first);
+  EXPECT_EQ(600, usage[0].second);
+}
@@ -0,0 +1,126 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "maintenance/metrics_registry.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace iroha;
+using namespace iroha::maintenance;
+
+/**
+ * @given registry with a counter and a gauge
+ * @when the counter is incremented after registration
+ * @then serialized metrics contain the current values
+ */
+TEST(MetricsRegistryTest, CounterAndGauge) {
+  MetricsRegistry registry;
+  auto counter = std::make_shared<Counter>();
+  registry.addCounter("votes_total", "Sent votes", counter);
+  registry.addGauge("delay_ms", "Current delay", [] { return 250.; });
+
+  counter->increment(3);
+
+  EXPECT_EQ(
+      "# HELP votes_total Sent votes\n"
+      "# TYPE votes_total counter\n"
+      "votes_total 3\n"
+      "# HELP delay_ms Current delay\n"
+      "# TYPE delay_ms gauge\n"
+      "delay_ms 250\n",
+      registry.serialize());
+}
+
+/**
+ * @given registry with a histogram
+ * @when values are observed in different buckets
+ * @then serialized buckets are cumulative @and the count equals the last
+ * bucket
+ */
+TEST(MetricsRegistryTest, Histogram) {
+  MetricsRegistry registry;
+  auto histogram = std::make_shared<Histogram>(std::vector<uint64_t>{1, 10});
+  registry.addHistogram("phase_ms", "Phase time", histogram);
+
+  histogram->observe(1);
+  histogram->observe(5);
+  histogram->observe(7);
+  histogram->observe(100);
+
+  EXPECT_EQ(
+      "# HELP phase_ms Phase time\n"
+      "# TYPE phase_ms histogram\n"
+      "phase_ms_bucket{le=\"1\"} 1\n"
+      "phase_ms_bucket{le=\"10\"} 3\n"
+      "phase_ms_bucket{le=\"+Inf\"} 4\n"
+      "phase_ms_sum 113\n"
+      "phase_ms_count 4\n",
+      registry.serialize());
+}
+
+/**
+ * @given registry with a counter family
+ * @when the samples have labels with special characters
+ * @then every sample is serialized with the escaped labels
+ */
+TEST(MetricsRegistryTest, CounterFamily) {
+  MetricsRegistry registry;
+  registry.addCounterFamily("cpu_seconds_total", "CPU time", [] {
+    return std::vector<MetricsRegistry::Sample>{
+        {{{"thread", "yac"}, {"mode", "user"}}, 1.5},
+        {{{"thread", "a\"b\\c"}}, 2}};
+  });
+
+  EXPECT_EQ(
+      "# HELP cpu_seconds_total CPU time\n"
+      "# TYPE cpu_seconds_total counter\n"
+      "cpu_seconds_total{thread=\"yac\",mode=\"user\"} 1.5\n"
+      "cpu_seconds_total{thread=\"a\\\"b\\\\c\"} 2\n",
+      registry.serialize());
+}
+
+/**
+ * @given registry with a gauge family
+ * @when it is serialized
+ * @then the samples are exposed with the gauge type
+ */
+TEST(MetricsRegistryTest, GaugeFamily) {
+  MetricsRegistry registry;
+  registry.addGaugeFamily("memory_bytes", "Memory", [] {
+    return std::vector<MetricsRegistry::Sample>{{{{"consumer", "cache"}}, 10}};
+  });
+
+  EXPECT_EQ(
+      "# HELP memory_bytes Memory\n"
+      "# TYPE memory_bytes gauge\n"
+      "memory_bytes{consumer=\"cache\"} 10\n",
+      registry.serialize());
+}
+
+/**
+ * @given registry with a histogram family
+ * @when it is serialized
+ * @then the buckets of every histogram have its labels followed by the bound
+ */
+TEST(MetricsRegistryTest, HistogramFamily) {
+  MetricsRegistry registry;
+  auto histogram = std::make_shared<Histogram>(std::vector<uint64_t>{10});
+  registry.addHistogramFamily("statement_us", "Statement time", [histogram] {
+    return std::vector<MetricsRegistry::LabeledHistogram>{
+        {{{"kind", "query"}}, histogram}};
+  });
+
+  histogram->observe(5);
+  histogram->observe(50);
+
+  EXPECT_EQ(
+      "# HELP statement_us Statement time\n"
+      "# TYPE statement_us histogram\n"
+      "statement_us_bucket{kind=\"query\",le=\"10\"} 1\n"
+      "statement_us_bucket{kind=\"query\",le=\"+Inf\"} 2\n"
+      "statement_us_sum{kind=\"query\"} 55\n"
+      "statement_us_count{kind=\"query\"} 2\n",
+      registry.serialize());
+}
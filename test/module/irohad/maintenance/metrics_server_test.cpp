@@ -0,0 +1,102 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "maintenance/metrics_server.hpp"
+
+#include <gtest/gtest.h>
+#include "framework/test_logger.hpp"
+#include "maintenance/metrics_registry.hpp"
+
+using namespace iroha;
+using namespace iroha::maintenance;
+using boost::asio::ip::tcp;
+
+class MetricsServerTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    auto counter = std::make_shared<Counter>();
+    counter->increment();
+    registry->addCounter("commits_total", "Commits", counter);
+
+    auto result = server.run("127.0.0.1", 0);
+    ASSERT_TRUE(iroha::expected::hasValue(result));
+    port = boost::get<iroha::expected::Value<uint16_t>>(result).value;
+  }
+
+  /// @return complete response of the server to the request
+  std::string request(const std::string &request_line) {
+    boost::asio::io_service io_service;
+    tcp::socket socket(io_service);
+    socket.connect(
+        tcp::endpoint(boost::asio::ip::address::from_string("127.0.0.1"),
+                      port));
+    boost::asio::write(socket,
+                       boost::asio::buffer(request_line + "\r\n\r\n"));
+
+    std::string response;
+    boost::system::error_code error;
+    std::array<char, 1024> buffer;
+    while (not error) {
+      auto size = socket.read_some(boost::asio::buffer(buffer), error);
+      response.append(buffer.data(), size);
+    }
+    return response;
+  }
+
+  std::shared_ptr<MetricsRegistry> registry =
+      std::make_shared<MetricsRegistry>();
+  MetricsServer server{registry, getTestLogger("MetricsServer")};
+  uint16_t port = 0;
+};
+
+/**
+ * @given running server
+ * @when the metrics are requested
+ * @then the serialized registry is returned
+ */
+TEST_F(MetricsServerTest, Metrics) {
+  auto response = request("GET /metrics HTTP/1.1");
+  EXPECT_EQ(0, response.find("HTTP/1.1 200 OK\r\n"));
+  EXPECT_NE(std::string::npos,
+            response.find("\r\n\r\n" + registry->serialize()));
+}
+
+/**
+ * @given running server
+ * @when other path is requested
+ * @then not found is returned
+ */
+TEST_F(MetricsServerTest, OtherPath) {
+  EXPECT_EQ(0, request("GET / HTTP/1.1").find("HTTP/1.1 404 Not Found\r\n"));
+}
+
+/**
+ * @given running server
+ * @when a profile with invalid duration is requested
+ * @then bad request is returned
+ */
+TEST_F(MetricsServerTest, ProfileInvalidDuration) {
+  EXPECT_EQ(0,
+            request("GET /debug/profile?seconds=0 HTTP/1.1")
+                .find("HTTP/1.1 400 Bad Request\r\n"));
+  EXPECT_EQ(0,
+            request("GET /debug/profile?seconds=abc HTTP/1.1")
+                .find("HTTP/1.1 400 Bad Request\r\n"));
+}
+
+/**
+ * @given running server
+ * @when a profile of one second is requested
+ * @then the profile is returned if the profiler is built in, otherwise not
+ * implemented is returned
+ */
+TEST_F(MetricsServerTest, Profile) {
+  auto response = request("GET /debug/profile?seconds=1 HTTP/1.1");
+  if (CpuProfiler::isAvailable()) {
+    EXPECT_EQ(0, response.find("HTTP/1.1 200 OK\r\n"));
+  } else {
+    EXPECT_EQ(0, response.find("HTTP/1.1 501 Not Implemented\r\n"));
+  }
+}
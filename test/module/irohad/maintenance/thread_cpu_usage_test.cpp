@@ -0,0 +1,47 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "maintenance/thread_cpu_usage.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include "common/thread_name.hpp"
+
+using namespace iroha;
+using namespace iroha::maintenance;
+
+/**
+ * @given named thread which keeps running
+ * @when the CPU usage of the threads is read
+ * @then the usage of the thread is reported under its name
+ */
+TEST(ThreadCpuUsageTest, NamedThread) {
+  std::atomic<bool> named{false};
+  std::atomic<bool> done{false};
+  std::thread thread([&] {
+    setThreadName("cpu-usage-test");
+    named = true;
+    while (not done) {
+      std::this_thread::yield();
+    }
+  });
+  while (not named) {
+    std::this_thread::yield();
+  }
+
+  auto usage = readThreadCpuUsage();
+  done = true;
+  thread.join();
+
+  auto it = std::find_if(usage.begin(), usage.end(), [](const auto &thread) {
+    return thread.name == "cpu-usage-test";
+  });
+  ASSERT_NE(usage.end(), it);
+  EXPECT_GE(it->user_seconds, 0.);
+  EXPECT_GE(it->system_seconds, 0.);
+}
@@ -0,0 +1,119 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "maintenance/tracing.hpp"
+
+#include <mutex>
+
+#include <gtest/gtest.h>
+#include "maintenance/otlp_json_file_exporter.hpp"
+
+using namespace iroha::tracing;
+
+namespace {
+  class StoringExporter : public SpanExporter {
+   public:
+    void exportSpans(const std::vector<Span> &new_spans) override {
+      std::lock_guard<std::mutex> lock(mutex);
+      spans.insert(spans.end(), new_spans.begin(), new_spans.end());
+    }
+
+    std::mutex mutex;
+    std::vector<Span> spans;
+  };
+
+  /// @return hash with the given byte of the sampled part of the trace id
+  shared_model::crypto::Hash makeHash(uint8_t sampling_byte) {
+    std::vector<uint8_t> bytes(32, 0xab);
+    bytes[8] = sampling_byte;
+    return shared_model::crypto::Hash(shared_model::crypto::Blob(bytes));
+  }
+}  // namespace
+
+class TracingTest : public ::testing::Test {
+ public:
+  void TearDown() override {
+    setTracer(nullptr);
+  }
+
+  std::shared_ptr<StoringExporter> exporter =
+      std::make_shared<StoringExporter>();
+};
+
+/**
+ * @given tracer with the half of the transactions sampled
+ * @when the sampling of the hashes is checked
+ * @then the hashes are sampled by the bytes of their trace ids
+ */
+TEST_F(TracingTest, Sampling) {
+  Tracer half(.5, exporter);
+  EXPECT_TRUE(half.isSampled(makeHash(0x10)));
+  EXPECT_FALSE(half.isSampled(makeHash(0xf0)));
+
+  EXPECT_TRUE(Tracer(1., exporter).isSampled(makeHash(0xff)));
+  EXPECT_FALSE(Tracer(0., exporter).isSampled(makeHash(0)));
+}
+
+/**
+ * @given tracer with the half of the transactions sampled
+ * @when a span is recorded for a sampled and a not sampled transaction
+ * @then a span of the sampled transaction is exported
+ */
+TEST_F(TracingTest, ScopedSpan) {
+  setTracer(std::make_shared<Tracer>(.5, exporter));
+  {
+    ScopedSpan span("stage");
+    ASSERT_TRUE(span);
+    span.setAttribute("round", "(1, 0)");
+    span.addTransaction(makeHash(0x10));
+    span.addTransaction(makeHash(0xf0));
+  }
+
+  ASSERT_EQ(1, exporter->spans.size());
+  const auto &span = exporter->spans.front();
+  EXPECT_EQ(makeHash(0x10).hex().substr(0, 32), span.trace_id);
+  EXPECT_EQ("stage", span.name);
+  EXPECT_LE(span.start, span.end);
+  EXPECT_EQ((std::vector<std::pair<std::string, std::string>>{
+                {"round", "(1, 0)"}}),
+            span.attributes);
+}
+
+/**
+ * @given no tracer
+ * @when a span is recorded
+ * @then the span is disabled @and nothing is exported
+ */
+TEST_F(TracingTest, Disabled) {
+  ScopedSpan span("stage");
+  EXPECT_FALSE(span);
+  span.addTransaction(makeHash(0));
+  EXPECT_TRUE(exporter->spans.empty());
+}
+
+/**
+ * @given span
+ * @when it is serialized for the OTLP file
+ * @then the export request contains the span with the string timestamps
+ */
+TEST_F(TracingTest, OtlpJson) {
+  Span span{"0123456789abcdef0123456789abcdef",
+            0x1f,
+            "stage",
+            Clock::time_point(std::chrono::seconds(1)),
+            Clock::time_point(std::chrono::seconds(2)),
+            {{"round", "(1, 0)"}}};
+
+  EXPECT_EQ(
+      "{\"resourceSpans\":[{\"resource\":{\"attributes\":[{\"key\":"
+      "\"service.name\",\"value\":{\"stringValue\":\"irohad\"}}]},"
+      "\"scopeSpans\":[{\"scope\":{\"name\":\"iroha\"},\"spans\":[{"
+      "\"traceId\":\"0123456789abcdef0123456789abcdef\","
+      "\"spanId\":\"000000000000001f\",\"name\":\"stage\",\"kind\":1,"
+      "\"startTimeUnixNano\":\"1000000000\","
+      "\"endTimeUnixNano\":\"2000000000\",\"attributes\":[{\"key\":"
+      "\"round\",\"value\":{\"stringValue\":\"(1, 0)\"}}]}]}]}]}",
+      OtlpJsonFileExporter::serialize({span}, "irohad"));
+}
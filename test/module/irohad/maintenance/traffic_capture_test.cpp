@@ -0,0 +1,158 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "maintenance/traffic_capture.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include "ametsuchi/wsv_snapshot.hpp"
+#include "consensus/round.hpp"
+#include "framework/batch_helper.hpp"
+#include "framework/result_gtest_checkers.hpp"
+#include "framework/test_logger.hpp"
+#include "maintenance/capture_reader.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::maintenance;
+using namespace boost::filesystem;
+
+class TrafficCaptureTest : public ::testing::Test {
+ protected:
+  void TearDown() override {
+    remove(path_);
+  }
+
+  std::shared_ptr<TrafficCapture> createCapture() {
+    auto capture =
+        TrafficCapture::create(path_, 100, getTestLogger("TrafficCapture"));
+    framework::expected::assertResultValue(capture);
+    return iroha::expected::resultToOptionalValue(capture).value();
+  }
+
+  std::unique_ptr<CaptureReader> openReader() {
+    auto reader = CaptureReader::open(path_);
+    framework::expected::assertResultValue(reader);
+    return std::move(
+               iroha::expected::resultToOptionalValue(std::move(reader)))
+        .value();
+  }
+
+  /// read the next record, which has to be in the file
+  void readRecord(CaptureReader &reader, proto::CaptureRecord &record) {
+    auto result = reader.next(record);
+    framework::expected::assertResultValue(result);
+    ASSERT_TRUE(iroha::expected::resultToOptionalValue(result).value());
+  }
+
+  shared_model::proto::Transaction makeTransaction() {
+    return TestTransactionBuilder()
+        .creatorAccountId("admin@test")
+        .createdTime(1)
+        .quorum(1)
+        .transferAsset(
+            "admin@test", "user@test", "coin#test", "transfer", "1.00")
+        .build();
+  }
+
+  iroha::ametsuchi::WsvSnapshot makeSnapshot() {
+    return iroha::ametsuchi::WsvSnapshot{
+        3,
+        shared_model::crypto::Hash(std::string(32, 'h')),
+        {{"account", "[1]"}, {"domain", "[2]"}},
+        "12345"};
+  }
+
+  std::string path_ = (temp_directory_path() / unique_path()).string();
+};
+
+/**
+ * @given capture of a snapshot, a proposal, a batch and a block
+ * @when the capture file is read
+ * @then the records are read in the order they are made
+ * @and they have the captured snapshot, proposal, batch and block
+ */
+TEST_F(TrafficCaptureTest, RecordsTheTraffic) {
+  auto snapshot = makeSnapshot();
+  auto proposal =
+      TestProposalBuilder()
+          .height(4)
+          .createdTime(1)
+          .transactions(
+              std::vector<shared_model::proto::Transaction>{makeTransaction()})
+          .build();
+  auto batch = framework::batch::createValidBatch(2);
+  auto block =
+      TestBlockBuilder()
+          .height(4)
+          .createdTime(1)
+          .transactions(
+              std::vector<shared_model::proto::Transaction>{makeTransaction()})
+          .build();
+
+  auto capture = createCapture();
+  capture->snapshot(snapshot);
+  capture->proposal(iroha::consensus::Round{4, 1}, proposal);
+  capture->batch(*batch);
+  capture->block(block);
+  capture.reset();
+
+  auto reader = openReader();
+  proto::CaptureRecord record;
+  readRecord(*reader, record);
+  EXPECT_EQ(record.snapshot().header().height(), snapshot.height);
+  EXPECT_EQ(record.snapshot().header().block_hash(),
+            shared_model::crypto::toBinaryString(snapshot.block_hash));
+  EXPECT_EQ(record.snapshot().header().state_digest(), snapshot.state_digest);
+  for (const auto &rows : snapshot.rows) {
+    readRecord(*reader, record);
+    EXPECT_EQ(record.snapshot().rows().table(), rows.table);
+    EXPECT_EQ(record.snapshot().rows().rows(), rows.rows);
+  }
+  readRecord(*reader, record);
+  EXPECT_EQ(record.snapshot().digest(),
+            shared_model::crypto::toBinaryString(snapshot.digest()));
+
+  readRecord(*reader, record);
+  EXPECT_EQ(record.proposal().block_round(), 4u);
+  EXPECT_EQ(record.proposal().reject_round(), 1u);
+  EXPECT_EQ(shared_model::proto::Proposal(record.proposal().proposal()).hash(),
+            proposal.hash());
+
+  readRecord(*reader, record);
+  ASSERT_EQ(record.batch().transactions_size(), 2);
+  EXPECT_EQ(shared_model::proto::Transaction(record.batch().transactions(1))
+                .hash(),
+            batch->transactions()[1]->hash());
+
+  readRecord(*reader, record);
+  EXPECT_EQ(shared_model::proto::Block(record.block().block_v1()).hash(),
+            block.hash());
+
+  EXPECT_GT(record.time(), 0u);
+
+  auto end = reader->next(record);
+  framework::expected::assertResultValue(end);
+  EXPECT_FALSE(iroha::expected::resultToOptionalValue(end).value());
+}
+
+/**
+ * @given capture file of a snapshot with the last byte cut off
+ * @when the capture file is read
+ * @then the records before the last one are read
+ * @and the last one is reported as torn
+ */
+TEST_F(TrafficCaptureTest, ReportsTornRecord) {
+  createCapture()->snapshot(makeSnapshot());
+  resize_file(path_, file_size(path_) - 1);
+
+  auto reader = openReader();
+  proto::CaptureRecord record;
+  for (size_t i = 0; i < makeSnapshot().rows.size() + 1; ++i) {
+    readRecord(*reader, record);
+  }
+  EXPECT_TRUE(iroha::expected::hasError(reader->next(record)));
+}
@@ -215,3 +215,37 @@ TEST(GossipPropagationStrategyTest, MultipleSubsEmission) {
     ASSERT_TRUE(validateEmitted(result[i], peersId));
   });
 }
+
+/**
+ * @given list of peers and strategy which emits one peer per hour when idle
+ * and up to three peers per millisecond in the burst
+ * @when the state of the burst size is reported
+ * @then the strategy emits three peers per millisecond
+ */
+TEST(GossipPropagationStrategyTest, AdaptsToTheState) {
+  auto peers_size = 10, take = 3;
+  std::vector<std::string> peersId;
+  PropagationData peers = generate(peersId, peers_size);
+
+  auto query = std::make_shared<MockPeerQuery>();
+  EXPECT_CALL(*query, getLedgerPeers()).WillRepeatedly(testing::Return(peers));
+  auto pbfactory = std::make_shared<MockPeerQueryFactory>();
+  EXPECT_CALL(*pbfactory, createPeerQuery())
+      .WillRepeatedly(testing::Return(boost::make_optional(
+          std::shared_ptr<iroha::ametsuchi::PeerQuery>(query))));
+  iroha::GossipPropagationStrategyParams gossip_params;
+  gossip_params.emission_period = 1h;
+  gossip_params.idle_emission_period = 1h;
+  gossip_params.min_emission_period = 1ms;
+  gossip_params.amount_per_once = 1;
+  gossip_params.max_amount_per_once = 3;
+  gossip_params.burst_batches = 4;
+  GossipPropagationStrategy strategy(
+      pbfactory, rxcpp::observe_on_event_loop(), gossip_params);
+  strategy.onStateChanged(4, 0);
+
+  auto emitted = subscribeAndEmit(strategy, take);
+
+  ASSERT_EQ(emitted.size(), take * 3);
+  ASSERT_TRUE(validateEmitted(emitted, peersId));
+}
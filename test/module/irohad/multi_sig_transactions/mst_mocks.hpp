@@ -34,6 +34,7 @@ namespace iroha {
     MOCK_METHOD2(onNewState,
                  void(const shared_model::crypto::PublicKey &from,
                       MstState state));
+    MOCK_CONST_METHOD1(isMissing, bool(const BatchDigest &digest));
   };
 
   /**
@@ -42,6 +43,8 @@ namespace iroha {
   class MockPropagationStrategy : public PropagationStrategy {
    public:
     MOCK_METHOD0(emitter, rxcpp::observable<PropagationData>());
+    MOCK_METHOD2(onStateChanged,
+                 void(size_t pending_batches, size_t changed_batches));
   };
 
   /**
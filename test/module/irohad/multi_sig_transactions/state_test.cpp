@@ -377,3 +377,105 @@ TEST(StateTest, RemovingTestWhenByTimeHasExpired) {
 
   ASSERT_EQ(2, diff_state.getBatches().size());
 }
+
+/**
+ * @given a state with a batch
+ * @when  the digests of the batches of other peer are checked
+ * @then  the unknown batch and the batch with other signatures are missing,
+ * and the batch with the same signatures is not
+ */
+TEST(StateTest, IsMissing) {
+  auto time = iroha::time::now();
+  auto state = MstState::empty(mst_state_log_, completer_);
+  state += addSignatures(makeTestBatch(txBuilder(1, time)),
+                         0,
+                         makeSignature("1", "pub_key_1"));
+
+  auto same = addSignatures(makeTestBatch(txBuilder(1, time)),
+                            0,
+                            makeSignature("1", "pub_key_1"));
+  EXPECT_FALSE(state.isMissing(makeBatchDigest(same)));
+
+  auto more_signatures = addSignatures(makeTestBatch(txBuilder(1, time)),
+                                       0,
+                                       makeSignature("1", "pub_key_1"),
+                                       makeSignature("2", "pub_key_2"));
+  EXPECT_TRUE(state.isMissing(makeBatchDigest(more_signatures)));
+
+  auto unknown = addSignatures(makeTestBatch(txBuilder(2, time)),
+                               0,
+                               makeSignature("1", "pub_key_1"));
+  EXPECT_TRUE(state.isMissing(makeBatchDigest(unknown)));
+}
+
+/**
+ * @given a state with batches created close to each other and a batch
+ * created much later
+ * AND   a batch which has been completed and left the state
+ * @when  the expired batches are extracted at the times between the batches
+ * @then  only the batches older than the time are extracted each time, and
+ * the completed batch is not extracted
+ */
+TEST(StateTest, ExtractExpiredInOrder) {
+  auto quorum = 2u;
+  auto time = iroha::time::now();
+  auto state = MstState::empty(mst_state_log_, completer_);
+  state += addSignatures(makeTestBatch(txBuilder(1, time, quorum)),
+                         0,
+                         makeSignature("1", "1"));
+  state += addSignatures(makeTestBatch(txBuilder(2, time + 1, quorum)),
+                         0,
+                         makeSignature("1", "1"));
+  state += addSignatures(makeTestBatch(txBuilder(3, time + 5000, quorum)),
+                         0,
+                         makeSignature("1", "1"));
+  state += addSignatures(makeTestBatch(txBuilder(4, time, quorum)),
+                         0,
+                         makeSignature("1", "1"));
+  auto completed = state += addSignatures(
+      makeTestBatch(txBuilder(4, time, quorum)), 0, makeSignature("2", "2"));
+  ASSERT_EQ(1, completed.completed_state_->getBatches().size());
+  ASSERT_EQ(3, state.getBatches().size());
+
+  EXPECT_EQ(1, state.extractExpired(time + 1).getBatches().size());
+  EXPECT_EQ(2, state.getBatches().size());
+  EXPECT_EQ(1, state.extractExpired(time + 2).getBatches().size());
+  EXPECT_EQ(1, state.getBatches().size());
+  EXPECT_TRUE(state.extractExpired(time + 2).isEmpty());
+  EXPECT_EQ(1, state.extractExpired(time + 5001).getBatches().size());
+  EXPECT_TRUE(state.isEmpty());
+}
+
+/**
+ * @given a state with a batch of two transactions with quorum 2
+ * @when  the signatures of the transactions are received one by one, some of
+ * them repeatedly
+ * @then  the batch is updated with every new signature and completed only
+ * when both transactions have got the quorum
+ */
+TEST(StateTest, CompletesWhenAllTransactionsHaveQuorum) {
+  auto quorum = 2u;
+  auto time = iroha::time::now();
+  auto batch = [&] {
+    return makeTestBatch(txBuilder(1, time, quorum),
+                         txBuilder(2, time, quorum));
+  };
+  auto state = MstState::empty(mst_state_log_, completer_);
+  state += addSignatures(batch(), 0, makeSignature("1", "1"));
+
+  auto result = state += addSignatures(batch(), 1, makeSignature("1", "1"));
+  EXPECT_EQ(1, result.updated_state_->getBatches().size());
+  EXPECT_TRUE(result.completed_state_->isEmpty());
+
+  result = state += addSignatures(batch(), 0, makeSignature("2", "2"));
+  EXPECT_EQ(1, result.updated_state_->getBatches().size());
+  EXPECT_TRUE(result.completed_state_->isEmpty());
+
+  result = state += addSignatures(batch(), 0, makeSignature("2", "2"));
+  EXPECT_TRUE(result.updated_state_->isEmpty());
+  EXPECT_TRUE(result.completed_state_->isEmpty());
+
+  result = state += addSignatures(batch(), 1, makeSignature("2", "2"));
+  EXPECT_EQ(1, result.completed_state_->getBatches().size());
+  EXPECT_TRUE(state.isEmpty());
+}
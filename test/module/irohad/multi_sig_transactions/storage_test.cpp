@@ -4,10 +4,14 @@
  */
 
 #include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <fstream>
 #include <memory>
+#include <thread>
 #include "framework/test_logger.hpp"
 #include "logger/logger.hpp"
 #include "module/irohad/multi_sig_transactions/mst_test_helpers.hpp"
+#include "multi_sig_transactions/storage/mst_journal.hpp"
 #include "multi_sig_transactions/storage/mst_storage_impl.hpp"
 
 using namespace iroha;
@@ -117,3 +121,120 @@ TEST_F(StorageTest, StorageDoesNotFindNonExistingBatch) {
   auto distinct_batch = makeTestBatch(txBuilder(4, creation_time));
   EXPECT_FALSE(storage->batchInStorage(distinct_batch));
 }
+
+/**
+ * @given storage with three batches
+ * @when other batches are added concurrently from several threads, and
+ * the diff for a peer is taken after its state is applied
+ * @then all the batches are in the storage, and the diff contains only the
+ * batches the peer does not have
+ */
+TEST_F(StorageTest, ConcurrentUpdates) {
+  constexpr size_t kThreads = 4;
+  constexpr size_t kBatchesPerThread = 25;
+  std::vector<DataType> batches;
+  for (size_t i = 0; i < kThreads * kBatchesPerThread; ++i) {
+    batches.push_back(makeTestBatch(txBuilder(10 + i, creation_time)));
+  }
+
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < kThreads; ++t) {
+    threads.emplace_back([this, &batches, t] {
+      for (size_t i = t; i < batches.size(); i += kThreads) {
+        storage->updateOwnState(batches[i]);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (const auto &batch : batches) {
+    EXPECT_TRUE(storage->batchInStorage(batch));
+  }
+
+  auto peer_state = MstState::empty(getTestLogger("MstState"), completer_);
+  for (size_t i = 0; i < batches.size(); i += 2) {
+    peer_state += batches[i];
+  }
+  storage->apply(absent_peer_key, peer_state);
+  ASSERT_EQ(3 + batches.size() / 2,
+            storage->getDiffState(absent_peer_key, creation_time)
+                .getBatches()
+                .size());
+}
+
+class StorageJournalTest : public StorageTest {
+ public:
+  void SetUp() override {
+    completer_ = std::make_shared<TestCompleter>();
+    storage = makeStorage();
+  }
+
+  void TearDown() override {
+    boost::filesystem::remove(journal_path);
+  }
+
+  std::shared_ptr<MstStorage> makeStorage() {
+    auto journal = MstJournal::create(journal_path, getTestLogger("Journal"));
+    EXPECT_TRUE(journal);
+    return std::make_shared<MstStorageStateImpl>(completer_,
+                                                 getTestLogger("MstState"),
+                                                 getTestLogger("MstStorage"),
+                                                 std::move(*journal));
+  }
+
+  const std::string journal_path = (boost::filesystem::temp_directory_path()
+                                    / boost::filesystem::unique_path())
+                                       .string();
+};
+
+/**
+ * @given storage with a journal, to which batches are added, and from which
+ * one of them expires
+ * @when a new storage is created with the same journal
+ * @then the new storage has the batches which have not expired
+ */
+TEST_F(StorageJournalTest, RestoresOwnState) {
+  auto expiring = makeTestBatch(txBuilder(1, creation_time));
+  auto pending = makeTestBatch(txBuilder(2, creation_time + 10));
+  storage->updateOwnState(expiring);
+  storage->updateOwnState(pending);
+  ASSERT_EQ(1,
+            storage->extractExpiredTransactions(creation_time + 1)
+                .getBatches()
+                .size());
+
+  storage.reset();
+  storage = makeStorage();
+  EXPECT_FALSE(storage->batchInStorage(expiring));
+  EXPECT_TRUE(storage->batchInStorage(pending));
+}
+
+/**
+ * @given journal with a batch, to which an incomplete record is appended
+ * @when a new storage is created with the journal
+ * @then the batch is restored, and the journal accepts new records
+ */
+TEST_F(StorageJournalTest, CutsOffIncompleteRecord) {
+  auto batch = makeTestBatch(txBuilder(1, creation_time));
+  storage->updateOwnState(batch);
+  storage.reset();
+  {
+    std::ofstream out(journal_path, std::ios::binary | std::ios::app);
+    // the size of a record, which is longer than the rest of the file
+    uint32_t size = 16;
+    out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    out << "abc";
+  }
+
+  storage = makeStorage();
+  EXPECT_TRUE(storage->batchInStorage(batch));
+  auto other_batch = makeTestBatch(txBuilder(2, creation_time));
+  storage->updateOwnState(other_batch);
+
+  storage.reset();
+  storage = makeStorage();
+  EXPECT_TRUE(storage->batchInStorage(batch));
+  EXPECT_TRUE(storage->batchInStorage(other_batch));
+}
@@ -129,7 +129,8 @@ static bool statesEqual(const iroha::MstState &a, const iroha::MstState &b) {
  *
  * @given Initialized transport
  * AND MstState for transfer
- * @when Send state via transport
+ * @when Send state via transport, which sends the summary of the state, and
+ * the batches pulled by the receiver
  * @then Assume that received state same as sent
  */
 TEST_F(TransportTest, SendAndReceive) {
@@ -148,18 +149,21 @@ TEST_F(TransportTest, SendAndReceive) {
         return result;
       }));
   auto time = iroha::time::now();
+  auto shared_key = makeKey();
   auto state = iroha::MstState::empty(getTestLogger("MstState"), completer_);
   state += addSignaturesFromKeyPairs(
-      makeTestBatch(txBuilder(1, time)), 0, makeKey());
+      makeTestBatch(txBuilder(1, time)), 0, shared_key);
   state += addSignaturesFromKeyPairs(
-      makeTestBatch(txBuilder(2, time)), 0, makeKey());
+      makeTestBatch(txBuilder(2, time)), 0, shared_key);
   state += addSignaturesFromKeyPairs(
-      makeTestBatch(txBuilder(3, time)), 0, makeKey());
+      makeTestBatch(txBuilder(3, time)), 0, shared_key);
   state += addSignaturesFromKeyPairs(
       makeTestBatch(txBuilder(3, time)), 0, makeKey());
   ASSERT_EQ(3, state.getBatches().size());
   // we want to ensure that server side will call onNewState()
   // with same parameters as on the client side
+  EXPECT_CALL(*mst_notification_transport_, isMissing(_))
+      .WillRepeatedly(Return(true));
   EXPECT_CALL(*mst_notification_transport_, onNewState(_, _))
       .WillOnce(Invoke(
           [this, &state](const auto &from_key, auto const &target_state) {
@@ -168,16 +172,133 @@ TEST_F(TransportTest, SendAndReceive) {
           }));
 
   ::grpc::ServerContext context;
+  transport::MstSummary summary;
+  // owned by the call of the summary
+  auto summary_reader = new grpc::testing::MockClientAsyncResponseReader<
+      transport::MstPullRequest>();
+  void *summary_tag = nullptr;
+  EXPECT_CALL(*stub, AsyncSendSummaryRaw(_, _, _))
+      .WillOnce(DoAll(SaveArg<1>(&summary), Return(summary_reader)));
+  EXPECT_CALL(*summary_reader, Finish(_, _, _))
+      .WillOnce(SaveArg<2>(&summary_tag));
+  transport->sendState(*peer, state);
+  ASSERT_EQ(3, summary.batches_size());
+
+  transport::MstPullRequest pull_request;
+  auto response = transport->SendSummary(&context, &summary, &pull_request);
+  ASSERT_EQ(response.error_code(), grpc::StatusCode::OK);
+  ASSERT_EQ(3, pull_request.reduced_hashes_size());
+
+  // complete the call of the summary with the pull request
   ::iroha::network::transport::MstState request;
   auto r = std::make_unique<
       grpc::testing::MockClientAsyncResponseReader<google::protobuf::Empty>>();
   EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _))
       .WillOnce(DoAll(SaveArg<1>(&request), Return(r.get())));
-  transport->sendState(*peer, state);
-  auto response = transport->SendState(&context, &request, nullptr);
+  ASSERT_NE(nullptr, summary_tag);
+  std::unique_ptr<AsyncGrpcClient<transport::MstPullRequest>::AsyncClientCall>
+      call(static_cast<
+           AsyncGrpcClient<transport::MstPullRequest>::AsyncClientCall *>(
+          summary_tag));
+  call->on_reply(pull_request);
+  call.reset();
+  // the key shared by the batches is sent once
+  EXPECT_EQ(2, request.public_keys_size());
+  EXPECT_EQ(4, request.signature_keys_size());
+
+  response = transport->SendState(&context, &request, nullptr);
   ASSERT_EQ(response.error_code(), grpc::StatusCode::OK);
 }
 
+/**
+ * @given Initialized transport
+ * @when a state is sent to the peer twice, before the summary of the first
+ * state is replied
+ * @then only one summary is sent, and the peer is released after the call
+ */
+TEST_F(TransportTest, SkipsPeerWithSummaryInFlight) {
+  auto state = iroha::MstState::empty(getTestLogger("MstState"), completer_);
+  state += makeTestBatch(txBuilder(1));
+
+  // owned by the call of the summary
+  auto summary_reader = new grpc::testing::MockClientAsyncResponseReader<
+      transport::MstPullRequest>();
+  void *summary_tag = nullptr;
+  EXPECT_CALL(*stub, AsyncSendSummaryRaw(_, _, _))
+      .WillOnce(Return(summary_reader));
+  EXPECT_CALL(*summary_reader, Finish(_, _, _))
+      .WillOnce(SaveArg<2>(&summary_tag));
+  transport->sendState(*peer, state);
+  transport->sendState(*peer, state);
+  ASSERT_NE(nullptr, summary_tag);
+  delete static_cast<
+      AsyncGrpcClient<transport::MstPullRequest>::AsyncClientCall *>(
+      summary_tag);
+}
+
+/**
+ * @given Initialized transport
+ * @when the call of the summary of a state fails, because the peer does not
+ * serve the summaries
+ * @then the whole state is sent to the peer
+ */
+TEST_F(TransportTest, SendsStateToPeerWithoutSummaries) {
+  auto state = iroha::MstState::empty(getTestLogger("MstState"), completer_);
+  state += makeTestBatch(txBuilder(1));
+  state += makeTestBatch(txBuilder(2));
+
+  // owned by the call of the summary
+  auto summary_reader = new grpc::testing::MockClientAsyncResponseReader<
+      transport::MstPullRequest>();
+  void *summary_tag = nullptr;
+  EXPECT_CALL(*stub, AsyncSendSummaryRaw(_, _, _))
+      .WillOnce(Return(summary_reader));
+  EXPECT_CALL(*summary_reader, Finish(_, _, _))
+      .WillOnce(SaveArg<2>(&summary_tag));
+  transport->sendState(*peer, state);
+
+  ::iroha::network::transport::MstState request;
+  auto r = std::make_unique<
+      grpc::testing::MockClientAsyncResponseReader<google::protobuf::Empty>>();
+  EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _))
+      .WillOnce(DoAll(SaveArg<1>(&request), Return(r.get())));
+  ASSERT_NE(nullptr, summary_tag);
+  std::unique_ptr<AsyncGrpcClient<transport::MstPullRequest>::AsyncClientCall>
+      call(static_cast<
+           AsyncGrpcClient<transport::MstPullRequest>::AsyncClientCall *>(
+          summary_tag));
+  call->on_error(grpc::Status(grpc::StatusCode::UNIMPLEMENTED, ""));
+  EXPECT_EQ(2, request.transactions_size());
+}
+
+/**
+ * @given Initialized transport
+ * AND a summary of two batches
+ * @when the receiver already has one of the batches
+ * @then only the other batch is pulled
+ */
+TEST_F(TransportTest, PullsOnlyMissingBatches) {
+  auto known = makeTestBatch(txBuilder(1));
+  auto unknown = makeTestBatch(txBuilder(2));
+  transport::MstSummary summary;
+  for (const auto &batch : {known, unknown}) {
+    summary.add_batches()->set_reduced_hash(
+        shared_model::crypto::toBinaryString(batch->reducedHash()));
+  }
+
+  EXPECT_CALL(*mst_notification_transport_, isMissing(_))
+      .WillRepeatedly(Invoke([&known](const iroha::BatchDigest &digest) {
+        return digest.reduced_hash != known->reducedHash();
+      }));
+
+  ::grpc::ServerContext context;
+  transport::MstPullRequest pull_request;
+  transport->SendSummary(&context, &summary, &pull_request);
+  ASSERT_EQ(1, pull_request.reduced_hashes_size());
+  EXPECT_EQ(shared_model::crypto::toBinaryString(unknown->reducedHash()),
+            pull_request.reduced_hashes(0));
+}
+
 /**
  * Checks that replayed transactions would not pass MST
  * (receiving of already processed transactions would not cause new state
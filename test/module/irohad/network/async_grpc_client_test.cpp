@@ -0,0 +1,146 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/async_grpc_client.hpp"
+
+#include <gtest/gtest.h>
+#include <grpcpp/alarm.h>
+#include "framework/mock_stream.h"
+#include "framework/test_logger.hpp"
+
+using namespace iroha::network;
+using namespace std::chrono_literals;
+
+using ::testing::_;
+using ::testing::Invoke;
+
+using Reader =
+    grpc::testing::MockClientAsyncResponseReader<google::protobuf::Empty>;
+
+class AsyncGrpcClientTest : public ::testing::Test {
+ public:
+  /**
+   * Start the call to the peer, which completes with the given status
+   * @return whether the call is started
+   */
+  bool call(const std::string &peer,
+            grpc::Status result = grpc::Status::OK,
+            std::function<void(const google::protobuf::Empty &)> on_reply = {},
+            std::function<void(const grpc::Status &)> on_error = {}) {
+    bool started = false;
+    client.Call(
+        peer,
+        [&](auto, grpc::CompletionQueue *queue) {
+          started = true;
+          // owned by the call
+          auto reader = new Reader();
+          EXPECT_CALL(*reader, Finish(_, _, _))
+              .WillOnce(Invoke(
+                  [this, queue, result](auto, grpc::Status *status, void *tag) {
+                    *status = result;
+                    pending.emplace_back(queue, tag);
+                  }));
+          return std::unique_ptr<grpc::ClientAsyncResponseReaderInterface<
+              google::protobuf::Empty>>(reader);
+        },
+        std::move(on_reply),
+        std::move(on_error));
+    return started;
+  }
+
+  /// complete the started calls and wait till the client handles them
+  void completeCalls() {
+    for (auto &call : pending) {
+      alarms.push_back(std::make_unique<grpc::Alarm>());
+      alarms.back()->Set(
+          call.first, std::chrono::system_clock::now(), call.second);
+    }
+    pending.clear();
+    for (auto start = std::chrono::steady_clock::now();
+         client.callLatency().count() < alarms.size()
+         and std::chrono::steady_clock::now() - start < 5s;) {
+      std::this_thread::sleep_for(1ms);
+    }
+    ASSERT_EQ(client.callLatency().count(), alarms.size());
+  }
+
+  std::vector<std::pair<grpc::CompletionQueue *, void *>> pending;
+  std::vector<std::unique_ptr<grpc::Alarm>> alarms;
+  AsyncGrpcClient<google::protobuf::Empty> client{
+      getTestLogger("AsyncCall"), 2, 1};
+};
+
+/**
+ * @given async client with the limit of one call per peer
+ * @when two calls to the peer are started at once
+ * @then the second one is dropped
+ * @and the calls to the peer are started again after the first one completes
+ */
+TEST_F(AsyncGrpcClientTest, LimitsCallsPerPeer) {
+  EXPECT_TRUE(call("127.0.0.1:10001"));
+  EXPECT_FALSE(call("127.0.0.1:10001"));
+  EXPECT_EQ(client.droppedCalls().value(), 1);
+
+  completeCalls();
+  EXPECT_TRUE(call("127.0.0.1:10001"));
+  completeCalls();
+}
+
+/**
+ * @given async client with the limit of one call per peer
+ * @when the calls to the different peers and without a peer are started
+ * @then all of them are started
+ */
+TEST_F(AsyncGrpcClientTest, DoesNotLimitOtherCalls) {
+  EXPECT_TRUE(call("127.0.0.1:10001"));
+  EXPECT_TRUE(call("127.0.0.1:10002"));
+  EXPECT_TRUE(call({}));
+  EXPECT_TRUE(call({}));
+  EXPECT_EQ(client.droppedCalls().value(), 0);
+
+  completeCalls();
+}
+
+/**
+ * @given async client with the limit of one call per peer
+ * @when a call succeeds, a call fails and a call is dropped
+ * @then the reply callback gets the response of the first one, and the
+ * error callback gets the status of the others
+ */
+TEST_F(AsyncGrpcClientTest, CompletesWithReplyOrError) {
+  std::atomic<int> replies{0};
+  std::vector<grpc::StatusCode> errors;
+  std::mutex errors_mutex;
+  auto on_reply = [&](const auto &) { ++replies; };
+  auto on_error = [&](const grpc::Status &status) {
+    std::lock_guard<std::mutex> lock(errors_mutex);
+    errors.push_back(status.error_code());
+  };
+
+  EXPECT_TRUE(call("127.0.0.1:10001", grpc::Status::OK, on_reply, on_error));
+  EXPECT_FALSE(
+      call("127.0.0.1:10001", grpc::Status::OK, on_reply, on_error));
+  EXPECT_TRUE(call("127.0.0.1:10002",
+                   grpc::Status(grpc::StatusCode::UNAVAILABLE, "down"),
+                   on_reply,
+                   on_error));
+  completeCalls();
+
+  // the latency of a call is observed before its callback
+  auto completed = [&] {
+    std::lock_guard<std::mutex> lock(errors_mutex);
+    return replies == 1 and errors.size() == 2;
+  };
+  for (auto start = std::chrono::steady_clock::now();
+       not completed() and std::chrono::steady_clock::now() - start < 5s;) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_EQ(replies, 1);
+  std::lock_guard<std::mutex> lock(errors_mutex);
+  EXPECT_EQ(errors,
+            (std::vector<grpc::StatusCode>{
+                grpc::StatusCode::RESOURCE_EXHAUSTED,
+                grpc::StatusCode::UNAVAILABLE}));
+}
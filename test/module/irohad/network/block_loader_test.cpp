@@ -19,6 +19,7 @@
 #include "module/irohad/ametsuchi/mock_block_query_factory.hpp"
 #include "module/irohad/ametsuchi/mock_peer_query.hpp"
 #include "module/irohad/ametsuchi/mock_peer_query_factory.hpp"
+#include "module/irohad/ametsuchi/mock_wsv_snapshot_factory.hpp"
 #include "module/shared_model/builders/protobuf/test_block_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
 #include "module/shared_model/interface_mocks.hpp"
@@ -34,7 +35,6 @@ using namespace shared_model::validation;
 
 using testing::_;
 using testing::A;
-using testing::ByMove;
 using testing::Return;
 
 using wPeer = std::shared_ptr<shared_model::interface::Peer>;
@@ -53,6 +53,7 @@ class BlockLoaderTest : public testing::Test {
         .WillRepeatedly(testing::Return(boost::make_optional(
             std::shared_ptr<iroha::ametsuchi::BlockQuery>(storage))));
     block_cache = std::make_shared<iroha::consensus::ConsensusResultCache>();
+    wsv_snapshot_factory = std::make_shared<MockWsvSnapshotFactory>();
     auto validator_ptr =
         std::make_unique<MockValidator<shared_model::interface::Block>>();
     validator = validator_ptr.get();
@@ -63,7 +64,10 @@ class BlockLoaderTest : public testing::Test {
             std::make_unique<MockValidator<iroha::protocol::Block>>()),
         getTestLogger("BlockLoader"));
     service = std::make_shared<BlockLoaderService>(
-        block_query_factory, block_cache, getTestLogger("BlockLoaderService"));
+        block_query_factory,
+        block_cache,
+        wsv_snapshot_factory,
+        getTestLogger("BlockLoaderService"));
 
     grpc::ServerBuilder builder;
     int port = 0;
@@ -116,6 +120,7 @@ class BlockLoaderTest : public testing::Test {
   std::shared_ptr<BlockLoaderService> service;
   std::unique_ptr<grpc::Server> server;
   std::shared_ptr<iroha::consensus::ConsensusResultCache> block_cache;
+  std::shared_ptr<MockWsvSnapshotFactory> wsv_snapshot_factory;
   MockValidator<shared_model::interface::Block> *validator;
 };
 
@@ -165,9 +170,9 @@ TEST_F(BlockLoaderTest, ValidWhenOneBlock) {
       .WillOnce(Return(std::vector<wPeer>{peer}));
   EXPECT_CALL(*storage, getTopBlockHeight())
       .WillOnce(Return(top_block.height()));
-  EXPECT_CALL(*storage, getBlock(top_block.height()))
-      .WillOnce(Return(ByMove(iroha::expected::makeValue(
-          clone<shared_model::interface::Block>(top_block)))));
+  EXPECT_CALL(*storage, getSerializedBlock(top_block.height()))
+      .WillOnce(Return(iroha::expected::makeValue(
+          shared_model::crypto::toBinaryString(top_block.blob()))));
   auto wrapper =
       make_test_subscriber<CallExact>(loader->retrieveBlocks(1, peer_key), 1);
   wrapper.subscribe([&top_block](auto block) { ASSERT_EQ(*block, top_block); });
@@ -202,9 +207,9 @@ TEST_F(BlockLoaderTest, ValidWhenMultipleBlocks) {
                    .signAndAddSignature(key)
                    .finish();
 
-    EXPECT_CALL(*storage, getBlock(i))
-        .WillOnce(Return(ByMove(iroha::expected::makeValue(
-            clone<shared_model::interface::Block>(blk)))));
+    EXPECT_CALL(*storage, getSerializedBlock(i))
+        .WillOnce(Return(iroha::expected::makeValue(
+            shared_model::crypto::toBinaryString(blk.blob()))));
   }
 
   EXPECT_CALL(*peer_query, getLedgerPeers())
@@ -218,6 +223,159 @@ TEST_F(BlockLoaderTest, ValidWhenMultipleBlocks) {
   ASSERT_TRUE(wrapper.validate());
 }
 
+/**
+ * @given block loader @and a peer whose stream breaks after the first block
+ * @when retrieveBlocks is called
+ * @then the stream is resumed after the received block @and all the blocks
+ * are returned once in the order of their heights
+ */
+TEST_F(BlockLoaderTest, ResumesBrokenStream) {
+  auto block2 = getBaseBlockBuilder()
+                    .height(2)
+                    .build()
+                    .signAndAddSignature(key)
+                    .finish();
+  auto block3 = getBaseBlockBuilder()
+                    .height(3)
+                    .build()
+                    .signAndAddSignature(key)
+                    .finish();
+
+  EXPECT_CALL(*storage, getTopBlockHeight()).WillRepeatedly(Return(3));
+  EXPECT_CALL(*storage, getSerializedBlock(2))
+      .WillOnce(Return(iroha::expected::makeValue(
+          shared_model::crypto::toBinaryString(block2.blob()))));
+  EXPECT_CALL(*storage, getSerializedBlock(3))
+      .WillOnce(Return(iroha::expected::makeError(BlockQuery::GetBlockError{
+          BlockQuery::GetBlockError::Code::kInternalError, "broken"})))
+      .WillOnce(Return(iroha::expected::makeValue(
+          shared_model::crypto::toBinaryString(block3.blob()))));
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<wPeer>{peer}));
+
+  auto wrapper =
+      make_test_subscriber<CallExact>(loader->retrieveBlocks(1, peer_key), 2);
+  shared_model::interface::types::HeightType height = 2;
+  wrapper.subscribe(
+      [&height](auto block) { ASSERT_EQ(block->height(), height++); });
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
+/**
+ * @given block loader requesting one block per range @and two peers, one of
+ * which is unreachable
+ * @when retrieveBlockRanges is called
+ * @then the ranges failed by the unreachable peer are retrieved from the other
+ * one @and the blocks are returned in the order of their heights
+ */
+TEST_F(BlockLoaderTest, ValidWhenBlockRangesFromSeveralPeers) {
+  auto range_loader = std::make_shared<BlockLoaderImpl>(
+      peer_query_factory,
+      shared_model::proto::ProtoBlockFactory(
+          std::make_unique<MockValidator<shared_model::interface::Block>>(),
+          std::make_unique<MockValidator<iroha::protocol::Block>>()),
+      getTestLogger("BlockLoader"),
+      1);
+  auto unreachable_key =
+      DefaultCryptoAlgorithmType::generateKeypair().publicKey();
+  auto unreachable_peer = makePeer("0.0.0.0:1", unreachable_key);
+
+  const shared_model::interface::types::HeightType top_height = 5;
+  EXPECT_CALL(*storage, getTopBlockHeight())
+      .WillRepeatedly(Return(top_height));
+  for (shared_model::interface::types::HeightType i = 2; i <= top_height;
+       ++i) {
+    auto blk = getBaseBlockBuilder()
+                   .height(i)
+                   .build()
+                   .signAndAddSignature(key)
+                   .finish();
+    EXPECT_CALL(*storage, getSerializedBlock(i))
+        .WillRepeatedly(Return(iroha::expected::makeValue(
+            shared_model::crypto::toBinaryString(blk.blob()))));
+  }
+
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<wPeer>{peer, unreachable_peer}));
+  auto wrapper = make_test_subscriber<CallExact>(
+      range_loader->retrieveBlockRanges(
+          1, top_height, {unreachable_key, peer_key}),
+      top_height - 1);
+  shared_model::interface::types::HeightType height = 2;
+  wrapper.subscribe(
+      [&height](auto block) { ASSERT_EQ(block->height(), height++); });
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
+/**
+ * @given two peers, one of which is unreachable
+ * @when retrieveBlocksFromFastest is called
+ * @then the blocks are retrieved from the reachable peer in the order of
+ * their heights
+ */
+TEST_F(BlockLoaderTest, ValidWhenBlocksFromFastestPeer) {
+  auto unreachable_key =
+      DefaultCryptoAlgorithmType::generateKeypair().publicKey();
+  auto unreachable_peer = makePeer("0.0.0.0:1", unreachable_key);
+
+  const shared_model::interface::types::HeightType top_height = 4;
+  EXPECT_CALL(*storage, getTopBlockHeight())
+      .WillRepeatedly(Return(top_height));
+  for (shared_model::interface::types::HeightType i = 2; i <= top_height;
+       ++i) {
+    auto blk = getBaseBlockBuilder()
+                   .height(i)
+                   .build()
+                   .signAndAddSignature(key)
+                   .finish();
+    EXPECT_CALL(*storage, getSerializedBlock(i))
+        .WillRepeatedly(Return(iroha::expected::makeValue(
+            shared_model::crypto::toBinaryString(blk.blob()))));
+  }
+
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<wPeer>{peer, unreachable_peer}));
+  auto wrapper = make_test_subscriber<CallExact>(
+      loader->retrieveBlocksFromFastest(
+          1, top_height, {unreachable_key, peer_key}),
+      top_height - 1);
+  shared_model::interface::types::HeightType height = 2;
+  wrapper.subscribe(
+      [&height](auto block) { ASSERT_EQ(block->height(), height++); });
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
+/**
+ * @given block loader service with a block in storage
+ * @when the block is streamed twice
+ * @then it is read from the storage once @and served from the cache then
+ */
+TEST_F(BlockLoaderTest, StreamedBlocksAreCached) {
+  auto block = getBaseBlockBuilder()
+                   .height(2)
+                   .build()
+                   .signAndAddSignature(key)
+                   .finish();
+
+  EXPECT_CALL(*storage, getTopBlockHeight()).WillRepeatedly(Return(2));
+  EXPECT_CALL(*storage, getSerializedBlock(2))
+      .WillOnce(Return(iroha::expected::makeValue(
+          shared_model::crypto::toBinaryString(block.blob()))));
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<wPeer>{peer}));
+
+  for (int i = 0; i < 2; ++i) {
+    auto wrapper =
+        make_test_subscriber<CallExact>(loader->retrieveBlocks(1, peer_key), 1);
+    wrapper.subscribe([&block](auto loaded) { ASSERT_EQ(*loaded, block); });
+    ASSERT_TRUE(wrapper.validate());
+  }
+  EXPECT_EQ(1, service->cachedBlockHits().value());
+}
+
 MATCHER_P(RefAndPointerEq, arg1, "") {
   return arg == *arg1;
 }
@@ -237,7 +395,7 @@ TEST_F(BlockLoaderTest, ValidWhenBlockPresent) {
       .WillOnce(Return(std::vector<wPeer>{peer}));
   EXPECT_CALL(*validator, validate(RefAndPointerEq(block)))
       .WillOnce(Return(Answer{}));
-  EXPECT_CALL(*storage, getBlock(_)).Times(0);
+  EXPECT_CALL(*storage, getSerializedBlock(_)).Times(0);
   auto retrieved_block = loader->retrieveBlock(peer_key, block->height());
 
   ASSERT_TRUE(retrieved_block);
@@ -263,9 +421,9 @@ TEST_F(BlockLoaderTest, ValidWhenBlockMissing) {
 
   EXPECT_CALL(*peer_query, getLedgerPeers())
       .WillOnce(Return(std::vector<wPeer>{peer}));
-  EXPECT_CALL(*storage, getBlock(prev_block->height()))
-      .WillOnce(Return(ByMove(iroha::expected::makeValue(
-          clone<shared_model::interface::Block>(*prev_block)))));
+  EXPECT_CALL(*storage, getSerializedBlock(prev_block->height()))
+      .WillOnce(Return(iroha::expected::makeValue(
+          shared_model::crypto::toBinaryString(prev_block->blob()))));
 
   auto block = loader->retrieveBlock(peer_key, prev_block->height());
   ASSERT_TRUE(block);
@@ -289,9 +447,9 @@ TEST_F(BlockLoaderTest, ValidWithEmptyCache) {
 
   EXPECT_CALL(*peer_query, getLedgerPeers())
       .WillOnce(Return(std::vector<wPeer>{peer}));
-  EXPECT_CALL(*storage, getBlock(prev_block->height()))
-      .WillOnce(Return(ByMove(iroha::expected::makeValue(
-          clone<shared_model::interface::Block>(*prev_block)))));
+  EXPECT_CALL(*storage, getSerializedBlock(prev_block->height()))
+      .WillOnce(Return(iroha::expected::makeValue(
+          shared_model::crypto::toBinaryString(prev_block->blob()))));
 
   auto block = loader->retrieveBlock(peer_key, prev_block->height());
   ASSERT_TRUE(block);
@@ -307,11 +465,55 @@ TEST_F(BlockLoaderTest, ValidWithEmptyCache) {
 TEST_F(BlockLoaderTest, NoBlocksInStorage) {
   EXPECT_CALL(*peer_query, getLedgerPeers())
       .WillOnce(Return(std::vector<wPeer>{peer}));
-  EXPECT_CALL(*storage, getBlock(1))
-      .WillOnce(
-          Return(ByMove(iroha::expected::makeError(BlockQuery::GetBlockError{
-              BlockQuery::GetBlockError::Code::kNoBlock, "no block"}))));
+  EXPECT_CALL(*storage, getSerializedBlock(1))
+      .WillOnce(Return(iroha::expected::makeError(BlockQuery::GetBlockError{
+          BlockQuery::GetBlockError::Code::kNoBlock, "no block"})));
 
   auto block = loader->retrieveBlock(peer_key, 1);
   ASSERT_FALSE(block);
 }
+
+/**
+ * @given block loader @and storage which creates a WSV snapshot
+ * @when retrieveWsvSnapshot is called
+ * @then the snapshot is transferred with all its rows @and its digest matches
+ */
+TEST_F(BlockLoaderTest, WsvSnapshotIsTransferred) {
+  WsvSnapshot snapshot{
+      3,
+      Hash(std::string(DefaultCryptoAlgorithmType::kHashLength, '3')),
+      {{"domain", R"([{"domain_id":"test","default_role":"user"}])"},
+       {"account", R"([{"account_id":"admin@test","domain_id":"test"}])"}},
+      "12345"};
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillOnce(Return(std::vector<wPeer>{peer}));
+  EXPECT_CALL(*wsv_snapshot_factory, createWsvSnapshot())
+      .WillOnce(Return(iroha::expected::makeValue(snapshot)));
+
+  auto retrieved = loader->retrieveWsvSnapshot(peer_key);
+  ASSERT_TRUE(retrieved);
+  EXPECT_EQ(snapshot.height, retrieved->height);
+  EXPECT_EQ(snapshot.block_hash, retrieved->block_hash);
+  EXPECT_EQ(snapshot.state_digest, retrieved->state_digest);
+  ASSERT_EQ(snapshot.rows.size(), retrieved->rows.size());
+  for (size_t i = 0; i < snapshot.rows.size(); ++i) {
+    EXPECT_EQ(snapshot.rows[i].table, retrieved->rows[i].table);
+    EXPECT_EQ(snapshot.rows[i].rows, retrieved->rows[i].rows);
+  }
+  EXPECT_EQ(snapshot.digest(), retrieved->digest());
+}
+
+/**
+ * @given block loader @and storage which fails to create a WSV snapshot
+ * @when retrieveWsvSnapshot is called
+ * @then block loader returns nothing
+ */
+TEST_F(BlockLoaderTest, WsvSnapshotCreationFails) {
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillOnce(Return(std::vector<wPeer>{peer}));
+  EXPECT_CALL(*wsv_snapshot_factory, createWsvSnapshot())
+      .WillOnce(
+          Return(iroha::expected::makeError(std::string("no connection"))));
+
+  ASSERT_FALSE(loader->retrieveWsvSnapshot(peer_key));
+}
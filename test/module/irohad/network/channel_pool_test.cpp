@@ -0,0 +1,93 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/channel_pool.hpp"
+
+#include <gtest/gtest.h>
+#include <grpc++/generic/async_generic_service.h>
+
+using namespace iroha::network;
+
+class ChannelPoolTest : public ::testing::Test {
+ public:
+  ChannelPool pool{{"iroha.test.First", "iroha.test.Second"}};
+};
+
+/**
+ * @given channel pool
+ * @when the channel to the same peer is requested twice
+ * @then the same channel is returned
+ */
+TEST_F(ChannelPoolTest, SharesChannelOfPeer) {
+  auto first = pool.getChannel("127.0.0.1:10001");
+  auto second = pool.getChannel("127.0.0.1:10001");
+
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(pool.size(), 1);
+}
+
+/**
+ * @given channel pool
+ * @when the channels to the different peers, and to the same peer with the
+ * different compression are requested
+ * @then separate channels are returned
+ */
+TEST_F(ChannelPoolTest, SeparatesPeersAndCompression) {
+  auto first = pool.getChannel("127.0.0.1:10001");
+  auto second = pool.getChannel("127.0.0.1:10002");
+  auto compressed = pool.getChannel("127.0.0.1:10001", GRPC_COMPRESS_GZIP);
+
+  EXPECT_NE(first, second);
+  EXPECT_NE(first, compressed);
+  EXPECT_EQ(pool.size(), 3);
+}
+
+/**
+ * @given channel pool
+ * @when the peers are warmed up
+ * @then the uncompressed channels to them are created and reused later
+ */
+TEST_F(ChannelPoolTest, WarmUpCreatesChannels) {
+  pool.warmUp({"127.0.0.1:10001", "127.0.0.1:10002"});
+
+  EXPECT_EQ(pool.size(), 2);
+  pool.getChannel("127.0.0.1:10001");
+  EXPECT_EQ(pool.size(), 2);
+}
+
+/**
+ * @given channel pool and a server
+ * @when the channel to the server connects
+ * @then the connection is counted once
+ */
+TEST_F(ChannelPoolTest, CountsConnections) {
+  int port = 0;
+  // the server does not start without a service
+  grpc::AsyncGenericService service;
+  grpc::ServerBuilder builder;
+  builder.RegisterAsyncGenericService(&service);
+  auto queue = builder.AddCompletionQueue();
+  builder.AddListeningPort(
+      "127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+  auto server = builder.BuildAndStart();
+  ASSERT_NE(port, 0);
+
+  auto channel = pool.getChannel("127.0.0.1:" + std::to_string(port));
+  ASSERT_TRUE(channel->WaitForConnected(std::chrono::system_clock::now()
+                                        + std::chrono::seconds(5)));
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (pool.connections().value() == 0
+         and std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  EXPECT_EQ(pool.connections().value(), 1);
+  server->Shutdown();
+  queue->Shutdown();
+  void *tag;
+  bool ok;
+  while (queue->Next(&tag, &ok)) {
+  }
+}
@@ -0,0 +1,68 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/compression_policy.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/optional/optional_io.hpp>
+
+using namespace iroha::network;
+
+/**
+ * @given names of the algorithms
+ * @when they are parsed
+ * @then the known ones are recognized @and the others are rejected
+ */
+TEST(CompressionPolicyTest, ParseAlgorithm) {
+  EXPECT_EQ(GRPC_COMPRESS_NONE, CompressionPolicy::parseAlgorithm("none"));
+  EXPECT_EQ(GRPC_COMPRESS_GZIP, CompressionPolicy::parseAlgorithm("gzip"));
+  EXPECT_EQ(GRPC_COMPRESS_DEFLATE,
+            CompressionPolicy::parseAlgorithm("deflate"));
+  EXPECT_FALSE(CompressionPolicy::parseAlgorithm("zstd"));
+}
+
+/**
+ * @given gzip policy with a threshold
+ * @when the messages below and above the threshold are sent
+ * @then only the larger ones are compressed @and their sizes are counted
+ */
+TEST(CompressionPolicyTest, Threshold) {
+  CompressionPolicy policy(GRPC_COMPRESS_GZIP, 1024);
+
+  EXPECT_EQ(GRPC_COMPRESS_NONE, policy.select(100));
+  EXPECT_EQ(GRPC_COMPRESS_GZIP, policy.select(1024));
+  EXPECT_EQ(GRPC_COMPRESS_GZIP, policy.select(5000));
+
+  EXPECT_EQ(100, policy.uncompressedBytes().value());
+  EXPECT_EQ(6024, policy.compressedBytes().value());
+}
+
+/**
+ * @given policy without the compression
+ * @when a large message is sent
+ * @then it is not compressed
+ */
+TEST(CompressionPolicyTest, None) {
+  CompressionPolicy policy(GRPC_COMPRESS_NONE, 0);
+
+  EXPECT_EQ(GRPC_COMPRESS_NONE, policy.select(1 << 20));
+  EXPECT_EQ(1 << 20, policy.uncompressedBytes().value());
+  EXPECT_EQ(0, policy.compressedBytes().value());
+}
+
+/**
+ * @given gzip policy with a threshold
+ * @when the options of the stream messages below and above the threshold
+ * are selected
+ * @then the compression is disabled for the smaller ones only
+ */
+TEST(CompressionPolicyTest, StreamMessages) {
+  CompressionPolicy policy(GRPC_COMPRESS_GZIP, 1024);
+
+  EXPECT_TRUE(policy.writeOptions(100).get_no_compression());
+  EXPECT_FALSE(policy.writeOptions(2048).get_no_compression());
+  EXPECT_EQ(100, policy.uncompressedBytes().value());
+  EXPECT_EQ(2048, policy.compressedBytes().value());
+}
@@ -51,11 +51,26 @@ namespace iroha {
           rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>(
               const shared_model::interface::types::HeightType,
               const shared_model::crypto::PublicKey &));
+      MOCK_METHOD3(
+          retrieveBlockRanges,
+          rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>(
+              const shared_model::interface::types::HeightType,
+              const shared_model::interface::types::HeightType,
+              const shared_model::interface::types::PublicKeyCollectionType &));
+      MOCK_METHOD3(
+          retrieveBlocksFromFastest,
+          rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>(
+              const shared_model::interface::types::HeightType,
+              const shared_model::interface::types::HeightType,
+              const shared_model::interface::types::PublicKeyCollectionType &));
       MOCK_METHOD2(
           retrieveBlock,
           boost::optional<std::shared_ptr<shared_model::interface::Block>>(
               const shared_model::crypto::PublicKey &,
               shared_model::interface::types::HeightType));
+      MOCK_METHOD1(retrieveWsvSnapshot,
+                   boost::optional<ametsuchi::WsvSnapshot>(
+                       const shared_model::crypto::PublicKey &));
     };
 
     class MockOrderingGate : public OrderingGate {
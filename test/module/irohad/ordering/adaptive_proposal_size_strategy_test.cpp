@@ -0,0 +1,126 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/adaptive_proposal_size_strategy.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "module/irohad/ordering/mock_proposal_creation_strategy.hpp"
+
+using namespace iroha::ordering;
+using namespace std::chrono_literals;
+
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+
+class AdaptiveProposalSizeStrategyTest : public testing::Test {
+ public:
+  void SetUp() override {
+    strategy_ = std::make_shared<NiceMock<MockProposalCreationStrategy>>();
+    adaptive_strategy_ = std::make_shared<AdaptiveProposalSizeStrategy>(
+        strategy_, kMinSize, kMaxSize, 100ms, [this] { return now_; });
+  }
+
+  /**
+   * Start the round after the given time
+   */
+  void startRound(ProposalCreationStrategy::RoundType round,
+                  std::chrono::milliseconds elapsed) {
+    now_ += elapsed;
+    adaptive_strategy_->onCollaborationOutcome(round, kPeers);
+  }
+
+  static constexpr size_t kMinSize = 10;
+  static constexpr size_t kMaxSize = 1000;
+  static constexpr size_t kPeers = 4;
+
+  std::shared_ptr<NiceMock<MockProposalCreationStrategy>> strategy_;
+  std::shared_ptr<AdaptiveProposalSizeStrategy> adaptive_strategy_;
+  AdaptiveProposalSizeStrategy::ClockType::time_point now_;
+};
+
+constexpr size_t AdaptiveProposalSizeStrategyTest::kMinSize;
+constexpr size_t AdaptiveProposalSizeStrategyTest::kMaxSize;
+constexpr size_t AdaptiveProposalSizeStrategyTest::kPeers;
+
+/**
+ * @given adaptive strategy without measurements
+ * @when proposal size limit is requested
+ * @then the configured limit is returned
+ */
+TEST_F(AdaptiveProposalSizeStrategyTest, InitialLimit) {
+  startRound({1, 0}, 0ms);
+
+  ASSERT_EQ(kMaxSize, adaptive_strategy_->proposalSizeLimit({2, 0}, kMaxSize));
+  ASSERT_EQ(50, adaptive_strategy_->proposalSizeLimit({2, 0}, 50));
+}
+
+/**
+ * @given adaptive strategy with target round time of 100ms
+ * @when round with 500 transactions is committed in 1000ms
+ * @then the limit is set to the number of transactions committed in 100ms
+ */
+TEST_F(AdaptiveProposalSizeStrategyTest, CommittedRound) {
+  startRound({1, 0}, 0ms);
+  adaptive_strategy_->onProposalPacked({2, 0}, 500);
+  startRound({2, 0}, 10ms);
+  startRound({3, 0}, 1000ms);
+
+  ASSERT_EQ(50, adaptive_strategy_->proposalSizeLimit({4, 0}, kMaxSize));
+}
+
+/**
+ * @given adaptive strategy
+ * @when round with a proposal is rejected
+ * @then the limit is halved
+ */
+TEST_F(AdaptiveProposalSizeStrategyTest, RejectedRound) {
+  startRound({1, 0}, 0ms);
+  adaptive_strategy_->onProposalPacked({2, 0}, 500);
+  startRound({2, 0}, 10ms);
+  startRound({2, 1}, 1000ms);
+
+  ASSERT_EQ(kMaxSize / 2,
+            adaptive_strategy_->proposalSizeLimit({2, 2}, kMaxSize));
+}
+
+/**
+ * @given adaptive strategy
+ * @when round is committed much slower than the target round time
+ * @then the limit is not less than the min size
+ */
+TEST_F(AdaptiveProposalSizeStrategyTest, MinLimit) {
+  startRound({1, 0}, 0ms);
+  adaptive_strategy_->onProposalPacked({2, 0}, 10);
+  startRound({2, 0}, 10ms);
+  startRound({3, 0}, 100s);
+
+  ASSERT_EQ(kMinSize, adaptive_strategy_->proposalSizeLimit({4, 0}, kMaxSize));
+}
+
+/**
+ * @given adaptive strategy
+ * @when round without a proposal passes
+ * @then the limit is not changed
+ */
+TEST_F(AdaptiveProposalSizeStrategyTest, EmptyRound) {
+  startRound({1, 0}, 0ms);
+  startRound({1, 1}, 100s);
+  startRound({2, 0}, 100s);
+
+  ASSERT_EQ(kMaxSize, adaptive_strategy_->proposalSizeLimit({3, 0}, kMaxSize));
+}
+
+/**
+ * @given adaptive strategy
+ * @when shouldCreateRound is called
+ * @then the decision is delegated to the underlying strategy
+ */
+TEST_F(AdaptiveProposalSizeStrategyTest, Delegation) {
+  EXPECT_CALL(*strategy_, shouldCreateRound(_)).WillOnce(Return(false));
+
+  ASSERT_FALSE(adaptive_strategy_->shouldCreateRound({2, 0}));
+}
@@ -0,0 +1,139 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/batch_send_queue.hpp"
+
+#include <limits>
+
+#include <gtest/gtest.h>
+#include "builders/protobuf/transaction.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "datetime/time.hpp"
+#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
+#include "module/irohad/ordering/mock_on_demand_os_notification.hpp"
+
+using namespace iroha;
+using namespace iroha::ordering;
+using namespace std::chrono_literals;
+
+using ::testing::_;
+using ::testing::SaveArg;
+
+class BatchSendQueueTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    connection = std::make_shared<transport::MockOdOsNotification>();
+  }
+
+  std::unique_ptr<BatchSendQueue> makeQueue(size_t flush_bytes) {
+    auto queue = std::make_unique<BatchSendQueue>(
+        1h, flush_bytes, time_in_queue, bytes_per_flush, [this] {
+          ++windows_started;
+        });
+    queue->setConnection(connection);
+    return queue;
+  }
+
+  transport::OdOsNotification::TransactionBatchType makeBatch(
+      shared_model::interface::types::TimestampType created_time) {
+    return std::make_shared<shared_model::interface::TransactionBatchImpl>(
+        shared_model::interface::types::SharedTxsCollectionType{
+            std::make_shared<shared_model::proto::Transaction>(
+                shared_model::proto::TransactionBuilder()
+                    .createdTime(created_time)
+                    .creatorAccountId("foo@bar")
+                    .createAsset("asset", "domain", 1)
+                    .quorum(1)
+                    .build()
+                    .signAndAddSignature(
+                        shared_model::crypto::DefaultCryptoAlgorithmType::
+                            generateKeypair())
+                    .finish())});
+  }
+
+  std::shared_ptr<transport::MockOdOsNotification> connection;
+  std::shared_ptr<Histogram> time_in_queue =
+      std::make_shared<Histogram>(Histogram::exponentialBounds(1, 2, 10));
+  std::shared_ptr<Histogram> bytes_per_flush =
+      std::make_shared<Histogram>(Histogram::exponentialBounds(64, 2, 10));
+  size_t windows_started = 0;
+  const shared_model::interface::types::TimestampType now = iroha::time::now();
+};
+
+/**
+ * @given queue with a large flush size
+ * @when several collections are pushed @and queue is flushed
+ * @then batches are sent with a single request in push order
+ * @and histograms are updated
+ */
+TEST_F(BatchSendQueueTest, Coalesce) {
+  auto queue = makeQueue(std::numeric_limits<size_t>::max());
+  auto first = makeBatch(now), second = makeBatch(now + 1);
+
+  EXPECT_CALL(*connection, onBatches(_)).Times(0);
+  queue->push({first});
+  queue->push({second});
+  ASSERT_TRUE(queue->deadline());
+  EXPECT_EQ(1, windows_started);
+
+  transport::OdOsNotification::CollectionType sent;
+  EXPECT_CALL(*connection, onBatches(_)).WillOnce(SaveArg<0>(&sent));
+  queue->flush();
+
+  ASSERT_EQ(2, sent.size());
+  EXPECT_EQ(first, sent.at(0));
+  EXPECT_EQ(second, sent.at(1));
+  EXPECT_FALSE(queue->deadline());
+  EXPECT_EQ(2, time_in_queue->count());
+  EXPECT_EQ(1, bytes_per_flush->count());
+}
+
+/**
+ * @given queue with a large flush size
+ * @when the same batch is pushed twice @and queue is flushed
+ * @then batch is sent once
+ */
+TEST_F(BatchSendQueueTest, Deduplication) {
+  auto queue = makeQueue(std::numeric_limits<size_t>::max());
+  auto batch = makeBatch(now);
+
+  queue->push({batch});
+  queue->push({batch});
+
+  transport::OdOsNotification::CollectionType sent;
+  EXPECT_CALL(*connection, onBatches(_)).WillOnce(SaveArg<0>(&sent));
+  queue->flush();
+
+  EXPECT_EQ(1, sent.size());
+}
+
+/**
+ * @given queue with a small flush size
+ * @when a batch is pushed
+ * @then batch is sent without waiting for the flush delay
+ */
+TEST_F(BatchSendQueueTest, FlushOnSize) {
+  auto queue = makeQueue(1);
+
+  EXPECT_CALL(*connection, onBatches(_)).Times(1);
+  queue->push({makeBatch(now)});
+
+  EXPECT_FALSE(queue->deadline());
+  EXPECT_EQ(0, windows_started);
+}
+
+/**
+ * @given empty queue
+ * @when queue is flushed
+ * @then nothing is sent
+ */
+TEST_F(BatchSendQueueTest, FlushEmpty) {
+  auto queue = makeQueue(1);
+
+  EXPECT_CALL(*connection, onBatches(_)).Times(0);
+  queue->flush();
+
+  EXPECT_EQ(0, bytes_per_flush->count());
+}
@@ -5,6 +5,9 @@
 
 #include "ordering/impl/kick_out_proposal_creation_strategy.hpp"
 
+#include <thread>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "module/irohad/consensus/yac/mock_yac_supermajority_checker.hpp"
@@ -72,3 +75,58 @@ TEST_F(KickOutProposalCreationStrategyTest, OnMaliciousCase) {
       .WillOnce(Return(true));
   ASSERT_FALSE(strategy_->shouldCreateRound({2, 0}));
 }
+
+/**
+ * @given initialized kickOutStrategy with requests for several rounds
+ * @when  onCollaborationOutcome is invoked for a later round
+ * @then  the requests for the passed rounds are dropped
+ *        @and the requests for the following rounds are kept
+ */
+TEST_F(KickOutProposalCreationStrategyTest, PassedRoundsDropped) {
+  strategy_->onCollaborationOutcome({1, 0}, number_of_peers);
+
+  strategy_->onProposalRequest({2, 0});
+  strategy_->onProposalRequest({2, 1});
+  strategy_->onProposalRequest({3, 0});
+
+  strategy_->onCollaborationOutcome({2, 0}, number_of_peers);
+
+  EXPECT_CALL(*supermajority_checker_, isTolerated(0, number_of_peers))
+      .WillOnce(Return(false));
+  ASSERT_TRUE(strategy_->shouldCreateRound(
+      {2 + KickOutProposalCreationStrategy::kBlockRounds, 0}));
+
+  EXPECT_CALL(*supermajority_checker_, isTolerated(1, number_of_peers))
+      .Times(2)
+      .WillRepeatedly(Return(false));
+  ASSERT_TRUE(strategy_->shouldCreateRound({2, 1}));
+  ASSERT_TRUE(strategy_->shouldCreateRound({3, 0}));
+}
+
+/**
+ * @given initialized kickOutStrategy
+ * @when  onProposal is called for the same round from several threads
+ * @then  all the requests are counted
+ */
+TEST_F(KickOutProposalCreationStrategyTest, ConcurrentRequestsCounted) {
+  strategy_->onCollaborationOutcome({1, 0}, number_of_peers);
+
+  constexpr size_t kThreads = 4;
+  constexpr size_t kRequests = 1000;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kThreads; ++i) {
+    threads.emplace_back([this] {
+      for (size_t j = 0; j < kRequests; ++j) {
+        strategy_->onProposalRequest({2, 0});
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_CALL(*supermajority_checker_,
+              isTolerated(kThreads * kRequests, number_of_peers))
+      .WillOnce(Return(true));
+  ASSERT_FALSE(strategy_->shouldCreateRound({2, 0}));
+}
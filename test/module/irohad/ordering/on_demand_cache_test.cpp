@@ -16,8 +16,21 @@ using ::testing::IsEmpty;
 using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::ReturnRef;
+using ::testing::ReturnRefOfCopy;
 using ::testing::UnorderedElementsAre;
 
+/**
+ * @return mock transaction with the hash and the serialized form of the size
+ */
+auto createMockTransaction(const std::string &hash, size_t size = 0) {
+  auto tx = createMockTransactionWithHash(
+      shared_model::interface::types::HashType(hash));
+  ON_CALL(*tx, blob())
+      .WillByDefault(ReturnRefOfCopy(
+          shared_model::interface::types::BlobType(std::string(size, 'x'))));
+  return tx;
+}
+
 /**
  * @given empty cache
  * @when add to back is invoked with batch1 and batch2
@@ -26,11 +39,8 @@ using ::testing::UnorderedElementsAre;
 TEST(OnDemandCacheTest, TestAddToBack) {
   OnDemandCache cache;
 
-  shared_model::interface::types::HashType hash1("hash1");
-  auto batch1 = createMockBatchWithHash(hash1);
-
-  shared_model::interface::types::HashType hash2("hash2");
-  auto batch2 = createMockBatchWithHash(hash2);
+  auto batch1 = createMockBatchWithTransactions({}, "hash1");
+  auto batch2 = createMockBatchWithTransactions({}, "hash2");
 
   cache.addToBack({batch1, batch2});
 
@@ -47,13 +57,9 @@ TEST(OnDemandCacheTest, TestAddToBack) {
 TEST(OnDemandCache, Pop) {
   OnDemandCache cache;
 
-  shared_model::interface::types::HashType hash1("hash1");
-  shared_model::interface::types::HashType hash2("hash2");
-  shared_model::interface::types::HashType hash3("hash3");
-
-  auto batch1 = createMockBatchWithHash(hash1);
-  auto batch2 = createMockBatchWithHash(hash2);
-  auto batch3 = createMockBatchWithHash(hash3);
+  auto batch1 = createMockBatchWithTransactions({}, "hash1");
+  auto batch2 = createMockBatchWithTransactions({}, "hash2");
+  auto batch3 = createMockBatchWithTransactions({}, "hash3");
 
   cache.addToBack({batch1});
   /**
@@ -112,12 +118,10 @@ TEST(OnDemandCache, Remove) {
   OnDemandCache cache;
 
   shared_model::interface::types::HashType hash1("hash1");
-  shared_model::interface::types::HashType hash2("hash2");
-  shared_model::interface::types::HashType hash3("hash3");
 
-  auto tx1 = createMockTransactionWithHash(hash1);
-  auto tx2 = createMockTransactionWithHash(hash2);
-  auto tx3 = createMockTransactionWithHash(hash3);
+  auto tx1 = createMockTransaction("hash1");
+  auto tx2 = createMockTransaction("hash2");
+  auto tx3 = createMockTransaction("hash3");
 
   auto batch1 = createMockBatchWithTransactions({tx1, tx2}, "abc");
   auto batch2 = createMockBatchWithTransactions({tx3}, "123");
@@ -140,3 +144,61 @@ TEST(OnDemandCache, Remove) {
    */
   ASSERT_THAT(cache.head(), ElementsAre(batch2));
 }
+
+/**
+ * @given cache with a batch in the tail
+ * @when the same batch is added to the back after a pop
+ * @then the batch is kept only in its first slot
+ */
+TEST(OnDemandCache, AddsBatchOnce) {
+  OnDemandCache cache;
+  auto batch = createMockBatchWithTransactions({createMockTransaction("tx")},
+                                               "batch");
+  auto same_batch = createMockBatchWithTransactions(
+      {createMockTransaction("tx")}, "batch");
+
+  cache.addToBack({batch});
+  cache.pop();
+  cache.addToBack({same_batch});
+  /**
+   * 1. {}
+   * 2. {batch}
+   * 3. {}
+   */
+  ASSERT_THAT(cache.tail(), IsEmpty());
+  ASSERT_THAT(cache.pop(), IsEmpty());
+  ASSERT_THAT(cache.pop(), ElementsAre(batch));
+  ASSERT_THAT(cache.pop(), IsEmpty());
+}
+
+/**
+ * @given cache with batches in the middle and in the tail
+ * @when the transaction of the middle batch is removed
+ * @then the middle batch is removed from its slot, and the size of the cache
+ * is the size of the remaining batch
+ */
+TEST(OnDemandCache, RemoveFromAnySlot) {
+  OnDemandCache cache;
+  auto batch1 = createMockBatchWithTransactions(
+      {createMockTransaction("hash1", 100), createMockTransaction("hash2", 50)},
+      "abc");
+  auto batch2 = createMockBatchWithTransactions(
+      {createMockTransaction("hash3", 30)}, "123");
+
+  cache.addToBack({batch1});
+  cache.pop();
+  cache.addToBack({batch2});
+  ASSERT_EQ(180, cache.sizeInBytes());
+
+  cache.remove({shared_model::interface::types::HashType("hash2")});
+  /**
+   * 1. {}
+   * 2. {}
+   * 3. {batch2}
+   */
+  EXPECT_EQ(30, cache.sizeInBytes());
+  ASSERT_THAT(cache.pop(), IsEmpty());
+  ASSERT_THAT(cache.pop(), IsEmpty());
+  ASSERT_THAT(cache.pop(), ElementsAre(batch2));
+  EXPECT_EQ(0, cache.sizeInBytes());
+}
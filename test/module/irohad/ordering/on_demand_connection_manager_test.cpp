@@ -17,6 +17,7 @@ using namespace iroha;
 using namespace iroha::ordering;
 using namespace iroha::ordering::transport;
 
+using ::testing::_;
 using ::testing::ByMove;
 using ::testing::Ref;
 using ::testing::Return;
@@ -114,6 +115,30 @@ TEST_F(OnDemandConnectionManagerTest, onRequestProposal) {
   ASSERT_EQ(result.value().get(), proposal);
 }
 
+/**
+ * @given initialized OnDemandConnectionManager
+ * @when onRequestNextCommitProposal is called
+ * @then the consumer of the next commit round is requested
+ * AND return data is forwarded
+ */
+TEST_F(OnDemandConnectionManagerTest, onRequestNextCommitProposal) {
+  consensus::Round round{2, 0};
+  auto oproposal = boost::make_optional<
+      std::shared_ptr<const OnDemandConnectionManager::ProposalType>>({});
+  auto proposal = oproposal.value().get();
+  EXPECT_CALL(*connections[OnDemandConnectionManager::kRejectCommitConsumer],
+              onRequestProposal(round))
+      .WillOnce(Return(ByMove(std::move(oproposal))));
+  EXPECT_CALL(*connections[OnDemandConnectionManager::kIssuer],
+              onRequestProposal(_))
+      .Times(0);
+
+  auto result = manager->onRequestNextCommitProposal(round);
+
+  ASSERT_TRUE(result);
+  ASSERT_EQ(result.value().get(), proposal);
+}
+
 /**
  * @given initialized OnDemandConnectionManager
  * @when onRequestProposal is called
@@ -28,6 +28,7 @@ using ::testing::_;
 using ::testing::AtMost;
 using ::testing::ByMove;
 using ::testing::get;
+using ::testing::Invoke;
 using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::ReturnRefOfCopy;
@@ -35,6 +36,19 @@ using ::testing::Truly;
 using ::testing::UnorderedElementsAre;
 using ::testing::UnorderedElementsAreArray;
 
+using Hashes = std::vector<shared_model::crypto::Hash>;
+
+/// @return cache statuses of type Status for each hash
+template <typename Status>
+boost::optional<ametsuchi::TxPresenceCache::BatchStatusCollectionType>
+statusesOf(const Hashes &hashes) {
+  ametsuchi::TxPresenceCache::BatchStatusCollectionType statuses;
+  for (const auto &hash : hashes) {
+    statuses.push_back(Status(hash));
+  }
+  return statuses;
+}
+
 class OnDemandOrderingGateTest : public ::testing::Test {
  public:
   void SetUp() override {
@@ -46,11 +60,9 @@ class OnDemandOrderingGateTest : public ::testing::Test {
     tx_cache = std::make_shared<ametsuchi::MockTxPresenceCache>();
     proposal_creation_strategy =
         std::make_shared<MockProposalCreationStrategy>();
-    ON_CALL(*tx_cache,
-            check(testing::Matcher<const shared_model::crypto::Hash &>(_)))
-        .WillByDefault(
-            Return(boost::make_optional<ametsuchi::TxCacheStatusType>(
-                iroha::ametsuchi::tx_cache_status_responses::Missing())));
+    ON_CALL(*tx_cache, check(testing::Matcher<const Hashes &>(_)))
+        .WillByDefault(Invoke(
+            statusesOf<iroha::ametsuchi::tx_cache_status_responses::Missing>));
     ordering_gate = std::make_shared<OnDemandOrderingGate>(
         ordering_service,
         notification,
@@ -268,10 +280,9 @@ TEST_F(OnDemandOrderingGateTest, ReplayedTransactionInProposal) {
   EXPECT_CALL(*ordering_service, onCollaborationOutcome(round)).Times(1);
   EXPECT_CALL(*notification, onRequestProposal(round))
       .WillOnce(Return(ByMove(std::move(arriving_proposal))));
-  EXPECT_CALL(*tx_cache,
-              check(testing::Matcher<const shared_model::crypto::Hash &>(_)))
-      .WillOnce(Return(boost::make_optional<ametsuchi::TxCacheStatusType>(
-          iroha::ametsuchi::tx_cache_status_responses::Committed())));
+  EXPECT_CALL(*tx_cache, check(testing::Matcher<const Hashes &>(_)))
+      .WillOnce(Invoke(
+          statusesOf<iroha::ametsuchi::tx_cache_status_responses::Committed>));
   // expect proposal to be created without any transactions because it was
   // removed by tx cache
   auto ufactory_proposal = std::make_unique<MockProposal>();
@@ -325,10 +336,9 @@ TEST_F(OnDemandOrderingGateTest, RepeatedTransactionInProposal) {
   EXPECT_CALL(*ordering_service, onCollaborationOutcome(round)).Times(1);
   EXPECT_CALL(*notification, onRequestProposal(round))
       .WillOnce(Return(ByMove(std::move(arriving_proposal))));
-  EXPECT_CALL(*tx_cache,
-              check(testing::Matcher<const shared_model::crypto::Hash &>(_)))
-      .WillRepeatedly(Return(boost::make_optional<ametsuchi::TxCacheStatusType>(
-          iroha::ametsuchi::tx_cache_status_responses::Missing())));
+  EXPECT_CALL(*tx_cache, check(testing::Matcher<const Hashes &>(_)))
+      .WillRepeatedly(Invoke(
+          statusesOf<iroha::ametsuchi::tx_cache_status_responses::Missing>));
 
   auto ufactory_proposal = std::make_unique<MockProposal>();
   auto factory_proposal = ufactory_proposal.get();
@@ -350,6 +360,77 @@ TEST_F(OnDemandOrderingGateTest, RepeatedTransactionInProposal) {
   ASSERT_TRUE(gate_wrapper.validate());
 }
 
+/**
+ * @given ordering gate with the processed transactions filter
+ * @when a block with the first transaction is committed @and a proposal
+ * with both transactions arrives
+ * @then only the first transaction is checked in the cache @and the
+ * resulting proposal contains only the second transaction
+ */
+TEST_F(OnDemandOrderingGateTest, ProcessedTxFilter) {
+  ordering_gate.reset();
+  auto ufactory = std::make_unique<NiceMock<MockUnsafeProposalFactory>>();
+  factory = ufactory.get();
+  ordering_gate = std::make_shared<OnDemandOrderingGate>(
+      ordering_service,
+      notification,
+      processed_tx_hashes.get_observable(),
+      rounds.get_observable(),
+      cache,
+      std::move(ufactory),
+      tx_cache,
+      proposal_creation_strategy,
+      1000,
+      getTestLogger("OrderingGate"),
+      std::make_shared<ProcessedTxFilter>(100, 0.001, [] { return 0; }));
+
+  auto tx1 = generateTx();
+  auto tx2 = TestUnsignedTransactionBuilder()
+                 .creatorAccountId("account@domain")
+                 .setAccountQuorum("account@domain", 2)
+                 .createdTime(iroha::time::now())
+                 .quorum(1)
+                 .build()
+                 .signAndAddSignature(
+                     shared_model::crypto::DefaultCryptoAlgorithmType::
+                         generateKeypair())
+                 .finish();
+  std::vector<shared_model::proto::Transaction> txs{tx1, tx2};
+
+  auto proposal = std::make_shared<MockProposal>();
+  ON_CALL(*proposal, transactions()).WillByDefault(Return(txs));
+  auto arriving_proposal = boost::make_optional(
+      std::static_pointer_cast<const shared_model::interface::Proposal>(
+          std::move(proposal)));
+
+  EXPECT_CALL(*cache, remove(_)).Times(1);
+  processed_tx_hashes.get_subscriber().on_next(
+      std::make_shared<cache::OrderingGateCache::HashesSetType>(
+          cache::OrderingGateCache::HashesSetType{tx1.hash()}));
+
+  EXPECT_CALL(*ordering_service, onCollaborationOutcome(round)).Times(1);
+  EXPECT_CALL(*notification, onRequestProposal(round))
+      .WillOnce(Return(ByMove(std::move(arriving_proposal))));
+  EXPECT_CALL(*tx_cache,
+              check(testing::Matcher<const Hashes &>(Hashes{tx1.hash()})))
+      .WillOnce(Invoke(
+          statusesOf<iroha::ametsuchi::tx_cache_status_responses::Committed>));
+
+  auto ufactory_proposal = std::make_unique<MockProposal>();
+  std::vector<shared_model::proto::Transaction> etxs{tx2};
+  ON_CALL(*ufactory_proposal, transactions()).WillByDefault(Return(etxs));
+  EXPECT_CALL(*factory, unsafeCreateProposal(_, _, hashEq(tx2.hash().hex())))
+      .WillOnce(Return(ByMove(std::move(ufactory_proposal))));
+
+  auto gate_wrapper =
+      make_test_subscriber<CallExact>(ordering_gate->onProposal(), 1);
+  gate_wrapper.subscribe([&](auto proposal) {});
+  rounds.get_subscriber().on_next(
+      OnDemandOrderingGate::RoundSwitch(round, ledger_state));
+
+  ASSERT_TRUE(gate_wrapper.validate());
+}
+
 /**
  * @given initialized ordering gate
  * @when block event with no batches is emitted @and cache contains batch1 and
@@ -424,3 +505,96 @@ TEST_F(OnDemandOrderingGateTest, BatchesRemoveFromCache) {
   rounds.get_subscriber().on_next(
       OnDemandOrderingGate::RoundSwitch(round, ledger_state));
 }
+
+class OnDemandOrderingGatePrefetchTest : public OnDemandOrderingGateTest {
+ public:
+  void SetUp() override {
+    OnDemandOrderingGateTest::SetUp();
+    ordering_gate.reset();
+    auto ufactory = std::make_unique<NiceMock<MockUnsafeProposalFactory>>();
+    factory = ufactory.get();
+    ordering_gate = std::make_shared<OnDemandOrderingGate>(
+        ordering_service,
+        notification,
+        processed_tx_hashes.get_observable(),
+        rounds.get_observable(),
+        cache,
+        std::move(ufactory),
+        tx_cache,
+        proposal_creation_strategy,
+        1000,
+        getTestLogger("OrderingGate"),
+        nullptr,
+        prefetch_events.get_observable(),
+        [this](consensus::Round round) {
+          EXPECT_EQ(this->round, round);
+          return std::move(prefetched_proposal);
+        });
+
+    auto mproposal = std::make_unique<MockProposal>();
+    proposal = mproposal.get();
+    txs.push_back(std::make_shared<MockTransaction>());
+    ON_CALL(*txs[0], hash())
+        .WillByDefault(ReturnRefOfCopy(shared_model::crypto::Hash("tx")));
+    ON_CALL(*proposal, transactions())
+        .WillByDefault(Return(txs | boost::adaptors::indirected));
+    prefetched_proposal = std::move(mproposal);
+
+    prefetch_events.get_subscriber().on_next(
+        OnDemandOrderingGate::PrefetchEvent{
+            round, ledger_state->top_block_info.top_hash, ledger_state});
+  }
+
+  rxcpp::subjects::subject<OnDemandOrderingGate::PrefetchEvent>
+      prefetch_events;
+  boost::optional<std::shared_ptr<const OdOsNotification::ProposalType>>
+      prefetched_proposal;
+  MockProposal *proposal;
+  std::vector<std::shared_ptr<MockTransaction>> txs;
+};
+
+/**
+ * @given ordering gate with the proposal prefetched on the consensus commit
+ * @when the round switch with the assumed ledger state is received
+ * @then the prefetched proposal is passed without requesting the network
+ */
+TEST_F(OnDemandOrderingGatePrefetchTest, PrefetchedProposalUsed) {
+  EXPECT_CALL(*ordering_service, onCollaborationOutcome(round)).Times(1);
+  EXPECT_CALL(*notification, onRequestProposal(_)).Times(0);
+
+  auto gate_wrapper =
+      make_test_subscriber<CallExact>(ordering_gate->onProposal(), 1);
+  gate_wrapper.subscribe([&](auto val) {
+    ASSERT_EQ(proposal, getProposalUnsafe(val).get());
+  });
+
+  rounds.get_subscriber().on_next(
+      OnDemandOrderingGate::RoundSwitch(round, ledger_state));
+
+  ASSERT_TRUE(gate_wrapper.validate());
+}
+
+/**
+ * @given ordering gate with the proposal prefetched on the consensus commit
+ * @when the round switch with another top block is received
+ * @then the prefetched proposal is dropped @and the proposal is requested
+ */
+TEST_F(OnDemandOrderingGatePrefetchTest, PrefetchedProposalDropped) {
+  auto other_state = std::make_shared<LedgerState>(
+      ledger_state->ledger_peers,
+      round.block_round,
+      shared_model::crypto::Hash{"other"});
+
+  EXPECT_CALL(*ordering_service, onCollaborationOutcome(round)).Times(1);
+  EXPECT_CALL(*notification, onRequestProposal(round))
+      .WillOnce(Return(ByMove(boost::none)));
+
+  auto gate_wrapper =
+      make_test_subscriber<CallExact>(ordering_gate->onProposal(), 1);
+  gate_wrapper.subscribe([&](auto val) { EXPECT_FALSE(val.proposal); });
+
+  rounds.get_subscriber().on_next(
+      OnDemandOrderingGate::RoundSwitch(round, other_state));
+
+  ASSERT_TRUE(gate_wrapper.validate());
+}
@@ -5,6 +5,8 @@
 
 #include "ordering/impl/on_demand_os_client_grpc.hpp"
 
+#include <future>
+
 #include <gtest/gtest.h>
 #include "backend/protobuf/proposal.hpp"
 #include "backend/protobuf/proto_transport_factory.hpp"
@@ -124,12 +126,13 @@ TEST_F(OnDemandOsClientGrpcTest, onRequestProposal) {
   std::chrono::system_clock::time_point deadline;
   proto::ProposalRequest request;
   auto creator = "test";
-  proto::ProposalResponse response;
-  response.mutable_proposal()
-      ->add_transactions()
+  protocol::Proposal proposal_transport;
+  proposal_transport.add_transactions()
       ->mutable_payload()
       ->mutable_reduced_payload()
       ->set_creator_account_id(creator);
+  proto::ProposalResponse response;
+  response.set_proposal(proposal_transport.SerializeAsString());
   EXPECT_CALL(*stub, RequestProposal(_, _, _))
       .WillOnce(DoAll(SaveClientContextDeadline(&deadline),
                       SaveArg<1>(&request),
@@ -169,3 +172,100 @@ TEST_F(OnDemandOsClientGrpcTest, onRequestProposalNone) {
   ASSERT_EQ(request.round().reject_round(), round.reject_round);
   ASSERT_FALSE(proposal);
 }
+
+/**
+ * @given client with proposal stream
+ * @when proposal is pushed to the stream
+ * AND onRequestProposal is called
+ * @then pushed proposal is returned without a request
+ */
+TEST_F(OnDemandOsClientGrpcTest, onRequestProposalPushed) {
+  auto creator = "test";
+  protocol::Proposal proposal_transport;
+  proposal_transport.add_transactions()
+      ->mutable_payload()
+      ->mutable_reduced_payload()
+      ->set_creator_account_id(creator);
+  proto::RoundProposal message;
+  message.mutable_round()->set_block_round(round.block_round);
+  message.mutable_round()->set_reject_round(round.reject_round);
+  message.set_proposal(proposal_transport.SerializeAsString());
+
+  std::promise<void> received, released;
+  auto reader =
+      std::make_unique<grpc::testing::MockClientReader<proto::RoundProposal>>();
+  EXPECT_CALL(*reader, Read(_))
+      .WillOnce(DoAll(SetArgPointee<0>(message), Return(true)))
+      .WillOnce(::testing::InvokeWithoutArgs([&] {
+        received.set_value();
+        released.get_future().wait();
+        return false;
+      }));
+  EXPECT_CALL(*reader, Finish()).WillOnce(Return(grpc::Status::CANCELLED));
+
+  auto stream_stub = std::make_unique<proto::MockOnDemandOrderingStub>();
+  EXPECT_CALL(*stream_stub, SubscribeProposalsRaw(_, _))
+      .WillOnce(Return(reader.release()));
+  auto stream =
+      std::make_shared<OnDemandOsProposalStream>(std::move(stream_stub),
+                                                 proposal_factory,
+                                                 std::chrono::hours(1),
+                                                 getTestLogger("OdOsStream"));
+  auto ustub = std::make_unique<proto::MockOnDemandOrderingStub>();
+  EXPECT_CALL(*ustub, RequestProposal(_, _, _)).Times(0);
+  client =
+      std::make_shared<OnDemandOsClientGrpc>(std::move(ustub),
+                                             async_call,
+                                             proposal_factory,
+                                             [&] { return timepoint; },
+                                             timeout,
+                                             getTestLogger("OdOsClientGrpc"),
+                                             stream);
+
+  received.get_future().wait();
+  auto proposal = client->onRequestProposal(round);
+  released.set_value();
+
+  ASSERT_TRUE(proposal);
+  ASSERT_EQ(proposal.value()->transactions()[0].creatorAccountId(), creator);
+}
+
+/**
+ * @given client with the hedge of the proposal requests which has observed
+ * latencies of 10 ms
+ * @when onRequestProposal is called
+ * AND the request exceeds its deadline
+ * @then the deadline is derived from the latencies instead of the timeout
+ * AND the request is counted as given up
+ */
+TEST_F(OnDemandOsClientGrpcTest, onRequestProposalHedged) {
+  timeout = std::chrono::seconds(5);
+  auto hedge = std::make_shared<ProposalRequestHedge>(
+      99, std::chrono::milliseconds(1));
+  for (size_t i = 0; i < ProposalRequestHedge::kMinSamples; ++i) {
+    hedge->observe(std::chrono::milliseconds(10));
+  }
+  auto ustub = std::make_unique<proto::MockOnDemandOrderingStub>();
+  std::chrono::system_clock::time_point deadline;
+  EXPECT_CALL(*ustub, RequestProposal(_, _, _))
+      .WillOnce(DoAll(SaveClientContextDeadline(&deadline),
+                      Return(grpc::Status(grpc::StatusCode::DEADLINE_EXCEEDED,
+                                          "deadline"))));
+  client =
+      std::make_shared<OnDemandOsClientGrpc>(std::move(ustub),
+                                             async_call,
+                                             proposal_factory,
+                                             [&] { return timepoint; },
+                                             timeout,
+                                             getTestLogger("OdOsClientGrpc"),
+                                             nullptr,
+                                             std::string{},
+                                             hedge);
+
+  auto proposal = client->onRequestProposal(round);
+
+  ASSERT_EQ(timepoint + hedge->delay(timeout), deadline);
+  ASSERT_LT(hedge->delay(timeout), timeout);
+  ASSERT_FALSE(proposal);
+  ASSERT_EQ(hedge->givenUp().value(), 1);
+}
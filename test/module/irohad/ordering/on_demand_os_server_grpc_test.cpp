@@ -38,23 +38,27 @@ struct OnDemandOsServerGrpcTest : public ::testing::Test {
         shared_model::validation::AbstractValidator<protocol::Transaction>>
         proto_transaction_validator = std::make_unique<
             shared_model::validation::MockValidator<protocol::Transaction>>();
-    auto transaction_factory =
+    transaction_factory =
         std::make_shared<shared_model::proto::ProtoTransportFactory<
             shared_model::interface::Transaction,
             shared_model::proto::Transaction>>(
             std::move(interface_transaction_validator),
             std::move(proto_transaction_validator));
-    auto batch_parser =
+    batch_parser =
         std::make_shared<shared_model::interface::TransactionBatchParserImpl>();
     batch_factory = std::make_shared<MockTransactionBatchFactory>();
     server =
         std::make_shared<OnDemandOsServerGrpc>(notification,
-                                               std::move(transaction_factory),
-                                               std::move(batch_parser),
+                                               transaction_factory,
+                                               batch_parser,
                                                batch_factory,
                                                getTestLogger("OdOsServerGrpc"));
   }
 
+  std::shared_ptr<OnDemandOsServerGrpc::TransportFactoryType>
+      transaction_factory;
+  std::shared_ptr<shared_model::interface::TransactionBatchParser>
+      batch_parser;
   std::shared_ptr<MockOdOsNotification> notification;
   std::shared_ptr<MockTransactionBatchFactory> batch_factory;
   std::shared_ptr<OnDemandOsServerGrpc> server;
@@ -68,6 +72,18 @@ ACTION_P(SaveArg0Move, var) {
   *var = std::move(arg0);
 }
 
+/**
+ * Create a batch from the candidate without validation
+ */
+shared_model::interface::TransactionBatchFactory::FactoryResult<
+    std::unique_ptr<shared_model::interface::TransactionBatch>>
+createBatch(
+    const shared_model::interface::types::SharedTxsCollectionType &cand) {
+  return iroha::expected::makeValue<
+      std::unique_ptr<shared_model::interface::TransactionBatch>>(
+      std::make_unique<shared_model::interface::TransactionBatchImpl>(cand));
+}
+
 /**
  * @given server
  * @when collection is received from the network
@@ -106,6 +122,47 @@ TEST_F(OnDemandOsServerGrpcTest, SendBatches) {
             creator);
 }
 
+/**
+ * @given server with several validation workers
+ * @when collection of many transactions is received from the network
+ * @then all transactions are deserialized and passed in the request order
+ */
+TEST_F(OnDemandOsServerGrpcTest, SendBatchesParallel) {
+  server = std::make_shared<OnDemandOsServerGrpc>(
+      notification,
+      transaction_factory,
+      batch_parser,
+      batch_factory,
+      getTestLogger("OdOsServerGrpc"),
+      boost::none,
+      std::make_shared<iroha::validation::ValidationPool>(4));
+  const int kTransactions = 100;
+  OdOsNotification::CollectionType collection;
+
+  EXPECT_CALL(
+      *batch_factory,
+      createTransactionBatch(
+          A<const shared_model::interface::types::SharedTxsCollectionType &>()))
+      .Times(kTransactions)
+      .WillRepeatedly(Invoke(createBatch));
+  EXPECT_CALL(*notification, onBatches(_)).WillOnce(SaveArg0Move(&collection));
+  proto::BatchesRequest request;
+  for (int i = 0; i < kTransactions; ++i) {
+    request.add_transactions()
+        ->mutable_payload()
+        ->mutable_reduced_payload()
+        ->set_creator_account_id("test" + std::to_string(i));
+  }
+
+  server->SendBatches(nullptr, &request, nullptr);
+
+  ASSERT_EQ(kTransactions, collection.size());
+  for (int i = 0; i < kTransactions; ++i) {
+    EXPECT_EQ("test" + std::to_string(i),
+              collection.at(i)->transactions().at(0)->creatorAccountId());
+  }
+}
+
 /**
  * @given server
  * @when proposal is requested
@@ -132,8 +189,9 @@ TEST_F(OnDemandOsServerGrpcTest, RequestProposal) {
   server->RequestProposal(nullptr, &request, &response);
 
   ASSERT_TRUE(response.has_proposal());
-  ASSERT_EQ(response.proposal()
-                .transactions()
+  protocol::Proposal response_proposal;
+  ASSERT_TRUE(response_proposal.ParseFromString(response.proposal()));
+  ASSERT_EQ(response_proposal.transactions()
                 .Get(0)
                 .payload()
                 .reduced_payload()
@@ -159,3 +217,16 @@ TEST_F(OnDemandOsServerGrpcTest, RequestProposalNone) {
 
   ASSERT_FALSE(response.has_proposal());
 }
+
+/**
+ * @given server without created proposals observable
+ * @when proposals are subscribed
+ * @then subscription is rejected, so the client keeps requesting proposals
+ */
+TEST_F(OnDemandOsServerGrpcTest, SubscribeProposalsDisabled) {
+  google::protobuf::Empty request;
+
+  auto status = server->SubscribeProposals(nullptr, &request, nullptr);
+
+  ASSERT_EQ(grpc::StatusCode::UNIMPLEMENTED, status.error_code());
+}
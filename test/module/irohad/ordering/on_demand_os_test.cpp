@@ -154,7 +154,6 @@ TEST_F(OnDemandOsTest, NormalRound) {
  * @when  send number of transactions greater that limit
  * AND initiate next round
  * @then  check that previous round has only limit of transactions
- * AND the rest of transactions isn't appeared in next after next round
  */
 TEST_F(OnDemandOsTest, OverflowRound) {
   generateTransactionsAndInsert({1, transaction_limit * 2});
@@ -166,6 +165,48 @@ TEST_F(OnDemandOsTest, OverflowRound) {
             (*os->onRequestProposal(target_round))->transactions().size());
 }
 
+/**
+ * @given initialized on-demand OS
+ * @when  send number of transactions greater that limit
+ * AND initiate two commit rounds
+ * @then  the rest of transactions is carried over to the round after next
+ */
+TEST_F(OnDemandOsTest, CarryOverRound) {
+  generateTransactionsAndInsert({1, transaction_limit + 5});
+
+  os->onCollaborationOutcome(commit_round);
+  ASSERT_EQ(transaction_limit,
+            (*os->onRequestProposal(target_round))->transactions().size());
+
+  os->onCollaborationOutcome({target_round.block_round, kFirstRejectRound});
+  auto proposal = os->onRequestProposal(
+      {target_round.block_round + 1, kFirstRejectRound});
+  ASSERT_TRUE(proposal);
+  ASSERT_EQ(4, boost::size((*proposal)->transactions()));
+}
+
+/**
+ * @given initialized on-demand OS with transactions which did not fit into
+ * the proposal
+ * @when  the transactions are committed by another peer
+ * @then  the transactions are not carried over to the next round
+ */
+TEST_F(OnDemandOsTest, CommittedTransactionsNotCarriedOver) {
+  generateTransactionsAndInsert({1, transaction_limit + 5});
+  EXPECT_CALL(
+      *mock_cache,
+      check(testing::Matcher<const shared_model::interface::TransactionBatch &>(
+          _)))
+      .WillRepeatedly(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
+          iroha::ametsuchi::tx_cache_status_responses::Committed()}));
+
+  os->onCollaborationOutcome(commit_round);
+  os->onCollaborationOutcome({target_round.block_round, kFirstRejectRound});
+
+  ASSERT_FALSE(os->onRequestProposal(
+      {target_round.block_round + 1, kFirstRejectRound}));
+}
+
 /**
  * @given initialized on-demand OS
  * @when  insert commit round and then proposal_limit + 2 reject rounds
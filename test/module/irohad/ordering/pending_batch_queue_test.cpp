@@ -0,0 +1,229 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/pending_batch_queue.hpp"
+
+#include <gtest/gtest.h>
+#include "builders/protobuf/transaction.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "datetime/time.hpp"
+#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
+#include "interfaces/transaction.hpp"
+
+using namespace iroha::ordering;
+
+class PendingBatchQueueTest : public ::testing::Test {
+ public:
+  /**
+   * Create a batch of a single transaction
+   * @param created_time - time of transaction creation, determines the hash
+   * @param creator - creator account of the transaction
+   */
+  PendingBatchQueue::TransactionBatchType makeBatch(
+      shared_model::interface::types::TimestampType created_time,
+      const std::string &creator = "foo@bar") {
+    return std::make_shared<shared_model::interface::TransactionBatchImpl>(
+        shared_model::interface::types::SharedTxsCollectionType{
+            std::make_shared<shared_model::proto::Transaction>(
+                shared_model::proto::TransactionBuilder()
+                    .createdTime(created_time)
+                    .creatorAccountId(creator)
+                    .createAsset("asset", "domain", 1)
+                    .quorum(1)
+                    .build()
+                    .signAndAddSignature(
+                        shared_model::crypto::DefaultCryptoAlgorithmType::
+                            generateKeypair())
+                    .finish())});
+  }
+
+  PendingBatchQueue queue;
+  const shared_model::interface::types::TimestampType now = iroha::time::now();
+};
+
+/**
+ * @given queue with several batches
+ * @when transactions are requested
+ * @then transactions are returned in arrival order
+ */
+TEST_F(PendingBatchQueueTest, ArrivalOrder) {
+  queue.push(makeBatch(now + 2));
+  queue.push(makeBatch(now));
+  queue.push(makeBatch(now + 1));
+
+  size_t discarded;
+  auto txs = queue.getTransactions(3, discarded);
+
+  ASSERT_EQ(3, txs.size());
+  EXPECT_EQ(now + 2, txs.at(0)->createdTime());
+  EXPECT_EQ(now, txs.at(1)->createdTime());
+  EXPECT_EQ(now + 1, txs.at(2)->createdTime());
+  EXPECT_EQ(0, discarded);
+}
+
+/**
+ * @given queue with more transactions than requested
+ * @when transactions are requested
+ * @then the oldest transactions are returned
+ * @and the rest is reported as discarded
+ */
+TEST_F(PendingBatchQueueTest, Limit) {
+  for (auto i = 0; i < 5; ++i) {
+    queue.push(makeBatch(now + i));
+  }
+
+  size_t discarded;
+  auto txs = queue.getTransactions(2, discarded);
+
+  ASSERT_EQ(2, txs.size());
+  EXPECT_EQ(now, txs.at(0)->createdTime());
+  EXPECT_EQ(now + 1, txs.at(1)->createdTime());
+  EXPECT_EQ(3, discarded);
+}
+
+/**
+ * @given queue with the same batch pushed twice
+ * @when transactions are requested
+ * @then the batch is returned once
+ */
+TEST_F(PendingBatchQueueTest, Deduplication) {
+  queue.push(makeBatch(now));
+  queue.push(makeBatch(now));
+
+  size_t discarded;
+  auto txs = queue.getTransactions(10, discarded);
+
+  EXPECT_EQ(1, txs.size());
+  EXPECT_EQ(0, discarded);
+}
+
+/**
+ * @given queue with some batches
+ * @when transactions are requested @and queue is cleared
+ * @then queue is empty
+ * @and previously seen batch can be pushed again
+ */
+TEST_F(PendingBatchQueueTest, Clear) {
+  queue.push(makeBatch(now));
+
+  size_t discarded;
+  queue.getTransactions(10, discarded);
+  queue.clear();
+  ASSERT_TRUE(queue.empty());
+
+  queue.push(makeBatch(now));
+  ASSERT_FALSE(queue.empty());
+  EXPECT_EQ(1, queue.getTransactions(10, discarded).size());
+}
+
+/**
+ * @given queue with more transactions than requested
+ * @when transactions are requested @and queue is carried over
+ * @then only the transactions which were not taken are left in the queue
+ */
+TEST_F(PendingBatchQueueTest, CarryOver) {
+  for (auto i = 0; i < 5; ++i) {
+    queue.push(makeBatch(now + i));
+  }
+
+  size_t discarded;
+  queue.getTransactions(2, discarded);
+  queue.carryOver(10, [](const auto &) { return false; });
+
+  ASSERT_EQ(3, queue.size());
+  auto txs = queue.getTransactions(10, discarded);
+  ASSERT_EQ(3, txs.size());
+  EXPECT_EQ(now + 2, txs.at(0)->createdTime());
+}
+
+/**
+ * @given queue with transactions which were not taken
+ * @when queue is carried over with a limit @and one batch is processed
+ * @then processed batch is evicted @and the oldest batches within the limit
+ * are kept
+ */
+TEST_F(PendingBatchQueueTest, CarryOverEvictionAndLimit) {
+  for (auto i = 0; i < 5; ++i) {
+    queue.push(makeBatch(now + i));
+  }
+
+  size_t discarded;
+  queue.getTransactions(1, discarded);
+  auto processed_time = now + 1;
+  queue.carryOver(2, [processed_time](const auto &batch) {
+    return batch.transactions().front()->createdTime() == processed_time;
+  });
+
+  auto txs = queue.getTransactions(10, discarded);
+  ASSERT_EQ(2, txs.size());
+  EXPECT_EQ(now + 2, txs.at(0)->createdTime());
+  EXPECT_EQ(now + 3, txs.at(1)->createdTime());
+}
+
+/**
+ * @given queue with the fair queuing @and several batches of one creator
+ * followed by a batch of another creator
+ * @when less transactions are requested than there are pending
+ * @then the batches of both creators are taken in arrival order
+ * @and the batches which are not taken are carried over
+ */
+TEST_F(PendingBatchQueueTest, FairQueuingByCreator) {
+  PendingBatchQueue fair_queue(std::make_shared<FairQueuing>(
+      std::vector<FairQueuing::Group>{}));
+  for (auto i = 0; i < 4; ++i) {
+    fair_queue.push(makeBatch(now + i, "heavy@bar"));
+  }
+  fair_queue.push(makeBatch(now + 4, "small@bar"));
+
+  size_t discarded;
+  auto txs = fair_queue.getTransactions(2, discarded);
+
+  ASSERT_EQ(2, txs.size());
+  EXPECT_EQ(now, txs.at(0)->createdTime());
+  EXPECT_EQ(now + 4, txs.at(1)->createdTime());
+  EXPECT_EQ(3, discarded);
+
+  fair_queue.carryOver(10, [](const auto &) { return false; });
+  txs = fair_queue.getTransactions(10, discarded);
+  ASSERT_EQ(3, txs.size());
+  EXPECT_EQ(now + 1, txs.at(0)->createdTime());
+}
+
+/**
+ * @given fair queuing with a group of a domain of weight 2
+ * @and batches of the group accounts and of another account
+ * @when transactions are requested
+ * @then the group takes twice the transactions of the other account
+ * @and the statistics of the group and of the other accounts are updated
+ */
+TEST_F(PendingBatchQueueTest, FairQueuingGroupWeight) {
+  auto fair_queuing = std::make_shared<FairQueuing>(
+      std::vector<FairQueuing::Group>{{"exchange", 2, {"exchange"}}});
+  PendingBatchQueue fair_queue(fair_queuing);
+  for (auto i = 0; i < 4; ++i) {
+    fair_queue.push(makeBatch(now + i, "client@bar"));
+  }
+  for (auto i = 0; i < 4; ++i) {
+    fair_queue.push(makeBatch(
+        now + 4 + i, i % 2 == 0 ? "hot@exchange" : "cold@exchange"));
+  }
+
+  size_t discarded;
+  auto txs = fair_queue.getTransactions(3, discarded);
+
+  ASSERT_EQ(3, txs.size());
+  EXPECT_EQ(now, txs.at(0)->createdTime());
+  EXPECT_EQ(now + 4, txs.at(1)->createdTime());
+  EXPECT_EQ(now + 5, txs.at(2)->createdTime());
+
+  auto stats = fair_queuing->stats();
+  ASSERT_EQ(2, stats.size());
+  EXPECT_EQ("exchange", stats.at(0).name);
+  EXPECT_EQ(2, stats.at(0).pending_txs);
+  EXPECT_EQ(2, stats.at(0).packed_txs);
+  EXPECT_EQ(FairQueuing::kOtherGroup, stats.at(1).name);
+  EXPECT_EQ(3, stats.at(1).pending_txs);
+  EXPECT_EQ(1, stats.at(1).packed_txs);
+}
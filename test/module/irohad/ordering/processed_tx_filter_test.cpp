@@ -0,0 +1,117 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/processed_tx_filter.hpp"
+
+#include <random>
+
+#include <gtest/gtest.h>
+#include "cryptography/hash.hpp"
+
+using namespace iroha::ordering;
+using shared_model::interface::types::HashType;
+using shared_model::interface::types::TimestampType;
+
+class ProcessedTxFilterTest : public ::testing::Test {
+ public:
+  std::unique_ptr<ProcessedTxFilter> makeFilter(size_t capacity) {
+    return std::make_unique<ProcessedTxFilter>(
+        capacity, 0.001, [this] { return now; });
+  }
+
+  /// random hash, as produced by the hash function
+  HashType makeHash() {
+    std::string bytes(32, 0);
+    for (auto &byte : bytes) {
+      byte = static_cast<char>(random_engine());
+    }
+    return HashType(bytes);
+  }
+
+  /// creation time of a transaction covered by the filter created at start
+  TimestampType covered() const {
+    return start + ProcessedTxFilter::kFutureGap + 1;
+  }
+
+  const TimestampType start = 1000000000;
+  TimestampType now = start;
+  std::mt19937 random_engine{42};
+};
+
+/**
+ * @given filter with a processed hash
+ * @when processed and not processed hashes are looked up
+ * @then processed hash may be processed @and other one is not processed
+ */
+TEST_F(ProcessedTxFilterTest, Lookup) {
+  auto filter = makeFilter(100);
+  auto processed = makeHash();
+  filter->insert(processed);
+
+  EXPECT_EQ(ProcessedTxFilter::Lookup::kMaybeProcessed,
+            filter->lookup(processed, covered()));
+  EXPECT_EQ(ProcessedTxFilter::Lookup::kNotProcessed,
+            filter->lookup(makeHash(), covered()));
+}
+
+/**
+ * @given filter
+ * @when transaction created before the filter could see its commit is
+ * looked up
+ * @then the filter does not cover it
+ */
+TEST_F(ProcessedTxFilterTest, NotCovered) {
+  auto filter = makeFilter(100);
+
+  EXPECT_EQ(ProcessedTxFilter::Lookup::kNotCovered,
+            filter->lookup(makeHash(), covered() - 1));
+}
+
+/**
+ * @given filter with the generation capacity of one hash
+ * @when three hashes are inserted at different times
+ * @then the first hash is dropped @and the coverage moves past the time
+ * when its generation was filled
+ */
+TEST_F(ProcessedTxFilterTest, Rotation) {
+  auto filter = makeFilter(1);
+  auto first = makeHash(), second = makeHash(), third = makeHash();
+
+  filter->insert(first);
+  now += 10;
+  filter->insert(second);
+  EXPECT_EQ(ProcessedTxFilter::Lookup::kMaybeProcessed,
+            filter->lookup(first, covered()));
+
+  now += 10;
+  filter->insert(third);
+  EXPECT_EQ(ProcessedTxFilter::Lookup::kNotCovered,
+            filter->lookup(first, covered() + 9));
+  EXPECT_NE(ProcessedTxFilter::Lookup::kNotCovered,
+            filter->lookup(first, covered() + 10));
+  EXPECT_EQ(ProcessedTxFilter::Lookup::kMaybeProcessed,
+            filter->lookup(second, covered() + 10));
+  EXPECT_EQ(ProcessedTxFilter::Lookup::kMaybeProcessed,
+            filter->lookup(third, covered() + 10));
+}
+
+/**
+ * @given filter
+ * @when exact checks of positive lookups are reported
+ * @then false positive rate is the share of not processed results
+ */
+TEST_F(ProcessedTxFilterTest, FalsePositiveRate) {
+  auto filter = makeFilter(100);
+  auto processed = makeHash();
+  filter->insert(processed);
+  EXPECT_EQ(0., filter->falsePositiveRate());
+
+  for (int i = 0; i < 4; ++i) {
+    filter->lookup(processed, covered());
+    filter->onExactCheck(i != 0);
+  }
+
+  EXPECT_EQ(0.25, filter->falsePositiveRate());
+}
@@ -0,0 +1,71 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/proposal_request_hedge.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace iroha::ordering;
+using namespace std::chrono_literals;
+
+class ProposalRequestHedgeTest : public ::testing::Test {
+ protected:
+  ProposalRequestHedge hedge{90, 5ms};
+  std::chrono::milliseconds timeout{1000};
+};
+
+/**
+ * @given hedge with less latencies than required
+ * @when the delay is requested
+ * @then it is the timeout
+ */
+TEST_F(ProposalRequestHedgeTest, TimeoutWithoutSamples) {
+  for (size_t i = 1; i < ProposalRequestHedge::kMinSamples; ++i) {
+    hedge.observe(10ms);
+  }
+  EXPECT_EQ(hedge.delay(timeout), timeout);
+}
+
+/**
+ * @given hedge with latencies from 1 to 100 ms
+ * @when the delay is requested
+ * @then it is the 90th percentile with the margin
+ * @and it is bounded by the timeout
+ */
+TEST_F(ProposalRequestHedgeTest, DelayOfPercentile) {
+  for (int i = 100; i > 0; --i) {
+    hedge.observe(std::chrono::milliseconds(i));
+  }
+  EXPECT_EQ(hedge.delay(timeout), 180ms);
+  EXPECT_EQ(hedge.delay(100ms), 100ms);
+}
+
+/**
+ * @given hedge with the small latencies
+ * @when the delay is requested
+ * @then it is the minimal delay
+ */
+TEST_F(ProposalRequestHedgeTest, MinimalDelay) {
+  for (size_t i = 0; i < ProposalRequestHedge::kMinSamples; ++i) {
+    hedge.observe(1ms);
+  }
+  EXPECT_EQ(hedge.delay(timeout), 5ms);
+}
+
+/**
+ * @given hedge with the latencies of 100 ms
+ * @when the window is filled with the latencies of 10 ms
+ * @then the delay is derived from the recent latencies only
+ */
+TEST_F(ProposalRequestHedgeTest, RecentLatencies) {
+  for (size_t i = 0; i < ProposalRequestHedge::kWindow; ++i) {
+    hedge.observe(100ms);
+  }
+  EXPECT_EQ(hedge.delay(timeout), 200ms);
+  for (size_t i = 0; i < ProposalRequestHedge::kWindow; ++i) {
+    hedge.observe(10ms);
+  }
+  EXPECT_EQ(hedge.delay(timeout), 20ms);
+}
@@ -0,0 +1,95 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/proposal_ring.hpp"
+
+#include <gtest/gtest.h>
+#include "module/shared_model/interface_mocks.hpp"
+#include "ordering/impl/on_demand_common.hpp"
+
+using namespace iroha;
+using namespace iroha::ordering;
+
+class ProposalRingTest : public ::testing::Test {
+ public:
+  std::shared_ptr<const ProposalRing::ProposalType> makeProposal() {
+    return std::make_shared<MockProposal>();
+  }
+
+  std::vector<consensus::Round> erased;
+  std::function<void(const consensus::Round &)> on_erase =
+      [this](const auto &round) { erased.push_back(round); };
+};
+
+/**
+ * @given ring with a proposal
+ * @when proposals of the stored and missing rounds are requested
+ * @then the stored proposal is returned only for its round
+ */
+TEST_F(ProposalRingTest, Get) {
+  ProposalRing ring(3);
+  auto proposal = makeProposal();
+  ring.set({1, kFirstRejectRound}, proposal);
+
+  auto stored = ring.get({1, kFirstRejectRound});
+  ASSERT_TRUE(stored);
+  EXPECT_EQ(proposal, *stored);
+  EXPECT_FALSE(ring.get({1, kFirstRejectRound + 1}));
+  EXPECT_FALSE(ring.get({2, kFirstRejectRound}));
+}
+
+/**
+ * @given ring with a proposal
+ * @when another proposal is stored for the same round
+ * @then the proposal is replaced
+ */
+TEST_F(ProposalRingTest, Replace) {
+  ProposalRing ring(1);
+  ring.set({1, kFirstRejectRound}, makeProposal());
+  auto proposal = makeProposal();
+  ring.set({1, kFirstRejectRound}, proposal);
+
+  auto stored = ring.get({1, kFirstRejectRound});
+  ASSERT_TRUE(stored);
+  EXPECT_EQ(proposal, *stored);
+}
+
+/**
+ * @given full ring
+ * @when a proposal of a new round is stored
+ * @then the proposal of the oldest round is evicted
+ */
+TEST_F(ProposalRingTest, EvictOldest) {
+  ProposalRing ring(2);
+  ring.set({2, kFirstRejectRound}, makeProposal());
+  ring.set({1, kFirstRejectRound}, makeProposal());
+  ring.set({3, kFirstRejectRound}, makeProposal());
+
+  EXPECT_FALSE(ring.get({1, kFirstRejectRound}));
+  EXPECT_TRUE(ring.get({2, kFirstRejectRound}));
+  EXPECT_TRUE(ring.get({3, kFirstRejectRound}));
+}
+
+/**
+ * @given ring with proposals of several rounds
+ * @when rounds before the current one are erased keeping one of them
+ * @then only the latest of the older rounds and later rounds are kept
+ */
+TEST_F(ProposalRingTest, EraseBefore) {
+  ProposalRing ring(5);
+  for (consensus::RejectRoundType i = 0; i < 4; ++i) {
+    ring.set({1, i}, makeProposal());
+  }
+  ring.set({2, kFirstRejectRound}, makeProposal());
+
+  ring.eraseBefore({1, 3}, 1, on_erase);
+
+  EXPECT_EQ((std::vector<consensus::Round>{{1, 1}, {1, 0}}), erased);
+  EXPECT_FALSE(ring.get({1, 0}));
+  EXPECT_FALSE(ring.get({1, 1}));
+  EXPECT_TRUE(ring.get({1, 2}));
+  EXPECT_TRUE(ring.get({1, 3}));
+  EXPECT_TRUE(ring.get({2, kFirstRejectRound}));
+}
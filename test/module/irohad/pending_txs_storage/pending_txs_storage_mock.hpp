@@ -25,6 +25,8 @@ namespace iroha {
                 page_size,
             const boost::optional<shared_model::interface::types::HashType>
                 &first_tx_hash));
+    MOCK_CONST_METHOD0(batchEvents, rxcpp::observable<BatchEvent>());
+    MOCK_CONST_METHOD0(memoryUsage, size_t());
   };
 
 }  // namespace iroha
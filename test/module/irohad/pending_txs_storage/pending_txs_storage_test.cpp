@@ -688,3 +688,43 @@ TEST_F(PendingTxsStorageFixture, QueryAllTheBatches) {
         errorResponseHandler);
   }
 }
+
+/**
+ * @given storage with a subscription to its batch events
+ * @when a batch of two creators is added, receives a signature, and expires
+ * @then the added, updated and removed events are emitted in order with the
+ * creators of the batch
+ */
+TEST_F(PendingTxsStorageFixture, BatchEvents) {
+  using BatchEvent = iroha::PendingTransactionStorage::BatchEvent;
+  auto batch = twoTransactionsBatch();
+  auto state1 = emptyState();
+  *state1 += batch;
+  auto state2 = emptyState();
+  *state2 += addSignatures(batch, 0, makeSignature("2", "pub_key_2"));
+
+  rxcpp::subjects::subject<std::shared_ptr<iroha::MstState>> updates_subject;
+  rxcpp::subjects::subject<std::shared_ptr<Batch>> expired_batches_subject;
+  iroha::PendingTransactionStorageImpl storage(
+      updates_subject.get_observable(),
+      dummyObservable(),
+      expired_batches_subject.get_observable(),
+      dummyPreparedTxsObservable());
+  std::vector<BatchEvent> events;
+  storage.batchEvents().subscribe(
+      [&events](const auto &event) { events.push_back(event); });
+
+  updates_subject.get_subscriber().on_next(state1);
+  updates_subject.get_subscriber().on_next(state2);
+  expired_batches_subject.get_subscriber().on_next(batch);
+
+  ASSERT_EQ(3, events.size());
+  EXPECT_EQ(BatchEvent::Type::kAdded, events[0].type);
+  EXPECT_EQ(BatchEvent::Type::kUpdated, events[1].type);
+  EXPECT_EQ(BatchEvent::Type::kRemoved, events[2].type);
+  for (const auto &event : events) {
+    EXPECT_EQ(batch->reducedHash(), event.batch->reducedHash());
+    EXPECT_EQ((std::vector<std::string>{"alice@iroha", "bob@iroha"}),
+              event.creators);
+  }
+}
@@ -5,6 +5,7 @@
 
 #include "simulator/impl/simulator.hpp"
 
+#include <future>
 #include <vector>
 
 #include <boost/range/adaptor/transformed.hpp>
@@ -40,6 +41,7 @@ using ::testing::Invoke;
 using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::ReturnArg;
+using ::testing::ReturnRef;
 
 using wBlock = std::shared_ptr<shared_model::interface::Block>;
 
@@ -63,13 +65,34 @@ class SimulatorTest : public ::testing::Test {
     EXPECT_CALL(*ordering_gate, onProposal())
         .WillOnce(Return(ordering_events.get_observable()));
 
-    simulator = std::make_shared<Simulator>(std::move(command_executor),
-                                            ordering_gate,
-                                            validator,
-                                            factory,
-                                            crypto_signer,
-                                            std::move(block_factory),
-                                            getTestLogger("Simulator"));
+    simulator = std::make_shared<Simulator>(
+        std::move(command_executor),
+        ordering_gate,
+        validator,
+        factory,
+        crypto_signer,
+        std::move(block_factory),
+        getTestLogger("Simulator"),
+        speculative_proposals.get_observable(),
+        committed_blocks.get_observable());
+  }
+
+  /// make the block committed to the storage with the given hash
+  void commitBlock(const shared_model::crypto::Hash &hash) {
+    auto block = std::make_shared<NiceMock<MockBlock>>();
+    ON_CALL(*block, hash()).WillByDefault(ReturnRef(hash));
+    committed_blocks.get_subscriber().on_next(block);
+  }
+
+  /// @return validation result of the proposal which keeps all transactions
+  auto makeValidationResult(
+      const shared_model::interface::Proposal &proposal) {
+    auto result = std::make_unique<VerifiedProposalAndErrors>();
+    result->verified_proposal =
+        std::make_unique<shared_model::proto::Proposal>(
+            static_cast<const shared_model::proto::Proposal &>(proposal)
+                .getTransport());
+    return result;
   }
 
   std::shared_ptr<MockStatefulValidator> validator;
@@ -78,6 +101,9 @@ class SimulatorTest : public ::testing::Test {
   std::shared_ptr<CryptoSignerType> crypto_signer;
   std::unique_ptr<shared_model::interface::UnsafeBlockFactory> block_factory;
   rxcpp::subjects::subject<OrderingEvent> ordering_events;
+  rxcpp::subjects::subject<Simulator::SpeculativeProposal>
+      speculative_proposals;
+  rxcpp::subjects::subject<Simulator::CommittedBlock> committed_blocks;
 
   std::shared_ptr<Simulator> simulator;
   shared_model::interface::types::PeerList ledger_peers{
@@ -228,6 +254,7 @@ TEST_F(SimulatorTest, SomeFailingTxs) {
 
   auto verification_result = simulator->processProposal(*proposal);
   ASSERT_TRUE(verification_result);
+  EXPECT_EQ(1, simulator->validationTime().count());
   auto verified_proposal = verification_result->verified_proposal;
 
   // ensure that txs in verified proposal do not include failed ones
@@ -247,3 +274,82 @@ TEST_F(SimulatorTest, SomeFailingTxs) {
         << rejected_tx->toString() << " missing in rejected transactions.";
   }
 }
+
+/**
+ * @given proposal of the next round prefetched before the block it follows
+ * @when the block is committed and the round starts on top of it with the
+ * same proposal
+ * @then the proposal is validated once before the round
+ * @and the round takes the result of that validation
+ */
+TEST_F(SimulatorTest, ReusesSpeculativeValidation) {
+  auto proposal = makeProposal(2);
+  const consensus::Round round{2, 0};
+  const shared_model::crypto::Hash top_hash{"hash"};
+
+  std::promise<void> validated;
+  EXPECT_CALL(*factory, createTemporaryWsv(_)).Times(1);
+  EXPECT_CALL(*validator, validate(_, _))
+      .WillOnce(Invoke([&](const auto &p, auto &) {
+        validated.set_value();
+        return this->makeValidationResult(p);
+      }));
+
+  speculative_proposals.get_subscriber().on_next(
+      Simulator::SpeculativeProposal{proposal, round, top_hash});
+  commitBlock(top_hash);
+  ASSERT_EQ(validated.get_future().wait_for(std::chrono::seconds(5)),
+            std::future_status::ready);
+
+  auto proposal_wrapper =
+      make_test_subscriber<CallExact>(simulator->onVerifiedProposal(), 1);
+  proposal_wrapper.subscribe([&](auto event) {
+    EXPECT_EQ(getVerifiedProposalUnsafe(event)->verified_proposal->hash(),
+              proposal->hash());
+  });
+  EXPECT_CALL(*crypto_signer, sign(A<shared_model::interface::Block &>()));
+  ordering_events.get_subscriber().on_next(OrderingEvent{
+      proposal,
+      round,
+      std::make_shared<LedgerState>(ledger_peers, 1, top_hash)});
+
+  EXPECT_TRUE(proposal_wrapper.validate());
+  EXPECT_EQ(simulator->speculationsReused().value(), 1);
+}
+
+/**
+ * @given proposal of the next round validated before the round
+ * @when the round starts on top of another block
+ * @then the proposal is validated again
+ */
+TEST_F(SimulatorTest, DiscardsSpeculationOnAnotherBlock) {
+  auto proposal = makeProposal(2);
+  const consensus::Round round{2, 0};
+  const shared_model::crypto::Hash top_hash{"hash"};
+
+  std::promise<void> validated;
+  EXPECT_CALL(*factory, createTemporaryWsv(_)).Times(2);
+  EXPECT_CALL(*validator, validate(_, _))
+      .WillOnce(Invoke([&](const auto &p, auto &) {
+        validated.set_value();
+        return this->makeValidationResult(p);
+      }))
+      .WillOnce(Invoke([&](const auto &p, auto &) {
+        return this->makeValidationResult(p);
+      }));
+
+  speculative_proposals.get_subscriber().on_next(
+      Simulator::SpeculativeProposal{proposal, round, top_hash});
+  commitBlock(top_hash);
+  ASSERT_EQ(validated.get_future().wait_for(std::chrono::seconds(5)),
+            std::future_status::ready);
+
+  EXPECT_CALL(*crypto_signer, sign(A<shared_model::interface::Block &>()));
+  ordering_events.get_subscriber().on_next(OrderingEvent{
+      proposal,
+      round,
+      std::make_shared<LedgerState>(
+          ledger_peers, 1, shared_model::crypto::Hash{"another_hash"})});
+
+  EXPECT_EQ(simulator->speculationsReused().value(), 0);
+}
@@ -95,7 +95,7 @@ class SynchronizerTest : public ::testing::Test {
             std::make_shared<LedgerState>(ledger_peers,
                                           commit_message->height(),
                                           commit_message->hash())))));
-    EXPECT_CALL(*mutable_factory, preparedCommitEnabled())
+    EXPECT_CALL(*mutable_factory, preparedCommitEnabled(_))
         .WillRepeatedly(Return(false));
     EXPECT_CALL(*mutable_factory, commitPrepared(_)).Times(0);
 
@@ -225,7 +225,7 @@ void mutableStorageExpectChain(
  * @then Successful commit
  */
 TEST_F(SynchronizerTest, ValidWhenSingleCommitSynchronized) {
-  EXPECT_CALL(*mutable_factory, preparedCommitEnabled())
+  EXPECT_CALL(*mutable_factory, preparedCommitEnabled(_))
       .WillRepeatedly(Return(false));
   EXPECT_CALL(*mutable_factory, commitPrepared(_)).Times(0);
   mutableStorageExpectChain(*mutable_factory, {commit_message});
@@ -243,6 +243,8 @@ TEST_F(SynchronizerTest, ValidWhenSingleCommitSynchronized) {
       consensus::Round{kHeight, 1}, ledger_state, commit_message));
 
   ASSERT_TRUE(wrapper.validate());
+  EXPECT_EQ(1, synchronizer->commitTime().count());
+  EXPECT_EQ(0, synchronizer->synchronizationTime().count());
 }
 
 /**
@@ -276,10 +278,59 @@ TEST_F(SynchronizerTest, ValidWhenValidChain) {
   ASSERT_TRUE(wrapper.validate());
 }
 
+/**
+ * @given synchronizer downloading any missing blocks from several peers
+ * @when gate have voted for other block
+ * @then the blocks are retrieved by ranges from all the peers
+ * @and successful commit
+ */
+TEST_F(SynchronizerTest, ValidWhenValidChainFromSeveralPeers) {
+  DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
+      SetFactory(&createMockMutableStorage);
+  consensus::Round round{kHeight, 1};
+
+  synchronizer.reset();
+  EXPECT_CALL(*consensus_gate, onOutcome())
+      .WillOnce(Return(gate_outcome.get_observable()));
+  synchronizer = std::make_shared<SynchronizerImpl>(
+      std::make_unique<MockCommandExecutor>(),
+      consensus_gate,
+      chain_validator,
+      mutable_factory,
+      block_query_factory,
+      block_loader,
+      getTestLogger("Synchronizer"),
+      SynchronizerImpl::kDefaultPrefetchedBlocks,
+      1);
+
+  EXPECT_CALL(*mutable_factory, createMutableStorage(_)).Times(1);
+
+  EXPECT_CALL(*chain_validator, validateAndApply(ChainEq({commit_message}), _))
+      .WillOnce(Return(true));
+  EXPECT_CALL(*block_loader,
+              retrieveBlockRanges(
+                  ledger_state->top_block_info.height, kHeight, public_keys))
+      .WillOnce(Return(rxcpp::observable<>::just(commit_message)));
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _)).Times(0);
+
+  auto wrapper =
+      make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 1);
+  wrapper.subscribe([round](auto commit_event) {
+    ASSERT_EQ(commit_event.sync_outcome, SynchronizationOutcomeType::kCommit);
+    ASSERT_EQ(commit_event.round, round);
+  });
+
+  gate_outcome.get_subscriber().on_next(
+      consensus::VoteOther(round, ledger_state, public_keys, hash));
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
 /**
  * @given A commit from consensus and initialized components
  * @when gate have voted for other block and multiple blocks are loaded
  * @then Successful commit
+ * @and all the downloaded blocks are taken from the prefetch buffer
  */
 TEST_F(SynchronizerTest, ValidWhenValidChainMultipleBlocks) {
   DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
@@ -311,6 +362,139 @@ TEST_F(SynchronizerTest, ValidWhenValidChainMultipleBlocks) {
       consensus::Round{kHeight, 1}, ledger_state, public_keys, hash));
 
   ASSERT_TRUE(wrapper.validate());
+  EXPECT_EQ(commits.size(), synchronizer->downloadedBlocks().value());
+  EXPECT_EQ(0, synchronizer->prefetchedBlocks());
+}
+
+/**
+ * @given synchronizer committing one downloaded block at once
+ * @when gate have voted for other block and two blocks are loaded
+ * @then each block is applied to its own mutable storage and committed
+ */
+TEST_F(SynchronizerTest, CommitsDownloadedBlocksInChunks) {
+  DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
+      SetFactory(&createMockMutableStorage);
+
+  synchronizer.reset();
+  EXPECT_CALL(*consensus_gate, onOutcome())
+      .WillOnce(Return(gate_outcome.get_observable()));
+  synchronizer = std::make_shared<SynchronizerImpl>(
+      std::make_unique<MockCommandExecutor>(),
+      consensus_gate,
+      chain_validator,
+      mutable_factory,
+      block_query_factory,
+      block_loader,
+      getTestLogger("Synchronizer"),
+      SynchronizerImpl::kDefaultPrefetchedBlocks,
+      SynchronizerImpl::kDefaultRangeDownloadThreshold,
+      nullptr,
+      1);
+
+  EXPECT_CALL(*mutable_factory, createMutableStorage(_)).Times(2);
+
+  const auto target_height = kHeight + 1;
+  auto target_commit = makeCommit(target_height);
+  {
+    InSequence s;
+    EXPECT_CALL(*chain_validator,
+                validateAndApply(ChainEq({commit_message}), _))
+        .WillOnce(Return(true));
+    EXPECT_CALL(*mutable_factory, commit_(_))
+        .WillOnce(Return(ByMove(expected::makeValue(
+            std::make_shared<LedgerState>(ledger_peers,
+                                          commit_message->height(),
+                                          commit_message->hash())))));
+    EXPECT_CALL(*chain_validator,
+                validateAndApply(ChainEq({target_commit}), _))
+        .WillOnce(Return(true));
+    EXPECT_CALL(*mutable_factory, commit_(_))
+        .WillOnce(Return(ByMove(expected::makeValue(
+            std::make_shared<LedgerState>(
+                ledger_peers, target_height, target_commit->hash())))));
+  }
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _))
+      .WillOnce(Return(rxcpp::observable<>::iterate(
+          std::vector<std::shared_ptr<shared_model::interface::Block>>{
+              commit_message, target_commit})));
+
+  auto wrapper =
+      make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 1);
+  wrapper.subscribe([target_height](auto commit_event) {
+    ASSERT_EQ(commit_event.round.block_round, target_height);
+    ASSERT_EQ(commit_event.sync_outcome, SynchronizationOutcomeType::kCommit);
+  });
+
+  gate_outcome.get_subscriber().on_next(consensus::VoteOther(
+      consensus::Round{kHeight, 1}, ledger_state, public_keys, hash));
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
+/**
+ * @given synchronizer committing one downloaded block at once
+ * @when the second of the blocks loaded from the first peer is invalid @and
+ * the other peers have no more blocks
+ * @then the first block stays committed @and the other peers are asked for
+ * the blocks following it @and the commit of the first block is emitted
+ */
+TEST_F(SynchronizerTest, KeepsCommittedChunksOnFailure) {
+  DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
+      SetFactory(&createMockMutableStorage);
+
+  synchronizer.reset();
+  EXPECT_CALL(*consensus_gate, onOutcome())
+      .WillOnce(Return(gate_outcome.get_observable()));
+  synchronizer = std::make_shared<SynchronizerImpl>(
+      std::make_unique<MockCommandExecutor>(),
+      consensus_gate,
+      chain_validator,
+      mutable_factory,
+      block_query_factory,
+      block_loader,
+      getTestLogger("Synchronizer"),
+      SynchronizerImpl::kDefaultPrefetchedBlocks,
+      SynchronizerImpl::kDefaultRangeDownloadThreshold,
+      nullptr,
+      1);
+
+  EXPECT_CALL(*mutable_factory, createMutableStorage(_)).Times(4);
+  EXPECT_CALL(*mutable_factory, commit_(_)).Times(1);
+
+  auto invalid_commit = makeCommit(kHeight + 1);
+  {
+    InSequence s;
+    EXPECT_CALL(*chain_validator,
+                validateAndApply(ChainEq({commit_message}), _))
+        .WillOnce(Return(true));
+    EXPECT_CALL(*chain_validator,
+                validateAndApply(ChainEq({invalid_commit}), _))
+        .WillOnce(Return(false));
+    EXPECT_CALL(*chain_validator, validateAndApply(ChainEq({}), _))
+        .Times(2)
+        .WillRepeatedly(Return(true));
+  }
+  EXPECT_CALL(*block_loader, retrieveBlocks(kHeight - 1, _))
+      .WillOnce(Return(rxcpp::observable<>::iterate(
+          std::vector<std::shared_ptr<shared_model::interface::Block>>{
+              commit_message, invalid_commit})));
+  EXPECT_CALL(*block_loader, retrieveBlocks(kHeight, _))
+      .Times(2)
+      .WillRepeatedly(Return(
+          rxcpp::observable<>::empty<
+              std::shared_ptr<shared_model::interface::Block>>()));
+
+  auto wrapper =
+      make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 1);
+  wrapper.subscribe([](auto commit_event) {
+    ASSERT_EQ(commit_event.round, (consensus::Round{kHeight, 0}));
+    ASSERT_EQ(commit_event.sync_outcome, SynchronizationOutcomeType::kCommit);
+  });
+
+  gate_outcome.get_subscriber().on_next(consensus::Future(
+      consensus::Round{kHeight + 2, 1}, ledger_state, public_keys));
+
+  ASSERT_TRUE(wrapper.validate());
 }
 
 /**
@@ -446,7 +630,7 @@ TEST_F(SynchronizerTest, NoneOutcome) {
  * @then commitPrepared is called @and commit is not called
  */
 TEST_F(SynchronizerTest, VotedForBlockCommitPrepared) {
-  EXPECT_CALL(*mutable_factory, preparedCommitEnabled())
+  EXPECT_CALL(*mutable_factory, preparedCommitEnabled(_))
       .WillRepeatedly(Return(true));
   EXPECT_CALL(*mutable_factory, commitPrepared(_))
       .WillOnce(Return(
@@ -466,6 +650,9 @@ TEST_F(SynchronizerTest, VotedForBlockCommitPrepared) {
 
   gate_outcome.get_subscriber().on_next(consensus::PairValid(
       consensus::Round{kHeight, 1}, ledger_state, commit_message));
+
+  EXPECT_EQ(1, synchronizer->preparedCommits().value());
+  EXPECT_EQ(0, synchronizer->appliedCommits().value());
 }
 
 /**
@@ -477,7 +664,7 @@ TEST_F(SynchronizerTest, VotedForOtherCommitPrepared) {
   DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
       SetFactory(&createMockMutableStorage);
 
-  EXPECT_CALL(*mutable_factory, preparedCommitEnabled()).Times(0);
+  EXPECT_CALL(*mutable_factory, preparedCommitEnabled(_)).Times(0);
   EXPECT_CALL(*mutable_factory, commitPrepared(_)).Times(0);
 
   EXPECT_CALL(*mutable_factory, createMutableStorage(_)).Times(1);
@@ -498,13 +685,61 @@ TEST_F(SynchronizerTest, VotedForOtherCommitPrepared) {
       consensus::Round{kHeight, 1}, ledger_state, public_keys, hash));
 }
 
+/**
+ * @given synchronizer with the block fetcher @and the fetch of the agreed
+ * block started by the consensus gate
+ * @when synchronizer processes the commit of the other block
+ * @then the fetched block is committed without requesting the peers again
+ */
+TEST_F(SynchronizerTest, VotedForOtherFetchedBlock) {
+  DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
+      SetFactory(&createMockMutableStorage);
+  auto block_fetcher =
+      std::make_shared<BlockFetcher>(block_loader, getTestLogger("Fetcher"));
+  auto gate = std::make_shared<MockConsensusGate>();
+  rxcpp::subjects::subject<ConsensusGate::GateObject> outcome;
+  EXPECT_CALL(*gate, onOutcome()).WillOnce(Return(outcome.get_observable()));
+  synchronizer = std::make_shared<SynchronizerImpl>(
+      std::make_unique<MockCommandExecutor>(),
+      gate,
+      chain_validator,
+      mutable_factory,
+      block_query_factory,
+      block_loader,
+      getTestLogger("Synchronizer"),
+      SynchronizerImpl::kDefaultPrefetchedBlocks,
+      SynchronizerImpl::kDefaultRangeDownloadThreshold,
+      block_fetcher);
+
+  EXPECT_CALL(*mutable_factory, createMutableStorage(_)).Times(1);
+  EXPECT_CALL(*block_loader, retrieveBlocksFromFastest(kHeight - 1, kHeight, _))
+      .WillOnce(Return(rxcpp::observable<>::just(commit_message)));
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _)).Times(0);
+  EXPECT_CALL(*chain_validator, validateAndApply(ChainEq({commit_message}), _))
+      .WillOnce(Return(true));
+
+  block_fetcher->fetch(kHeight - 1, kHeight, public_keys);
+
+  auto wrapper =
+      make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 1);
+  wrapper.subscribe([](auto commit_event) {
+    ASSERT_EQ(commit_event.sync_outcome, SynchronizationOutcomeType::kCommit);
+  });
+
+  outcome.get_subscriber().on_next(consensus::VoteOther(
+      consensus::Round{kHeight, 1}, ledger_state, public_keys, hash));
+
+  ASSERT_TRUE(wrapper.validate());
+  EXPECT_EQ(synchronizer->fetchedCommits().value(), 1);
+}
+
 /**
  * @given commit with the block peer voted for
  * @when synchronizer processes the commit @and commit prepared is unsuccessful
  * @then commit is called and synchronizer works as expected
  */
 TEST_F(SynchronizerTest, VotedForThisCommitPreparedFailure) {
-  EXPECT_CALL(*mutable_factory, preparedCommitEnabled())
+  EXPECT_CALL(*mutable_factory, preparedCommitEnabled(_))
       .WillRepeatedly(Return(false));
   EXPECT_CALL(*mutable_factory, commitPrepared(_)).Times(0);
 
@@ -530,7 +765,7 @@ TEST_F(SynchronizerTest, VotedForThisCommitPreparedFailure) {
  * @then no commit event is emitted
  */
 TEST_F(SynchronizerTest, CommitFailureVoteSameBlock) {
-  EXPECT_CALL(*mutable_factory, preparedCommitEnabled())
+  EXPECT_CALL(*mutable_factory, preparedCommitEnabled(_))
       .WillRepeatedly(Return(false));
   EXPECT_CALL(*mutable_factory, commitPrepared(_)).Times(0);
   mutableStorageExpectChain(*mutable_factory, {commit_message});
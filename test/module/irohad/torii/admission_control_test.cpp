@@ -0,0 +1,92 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/admission_control.hpp"
+
+#include <gtest/gtest.h>
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha::torii;
+using namespace std::chrono_literals;
+using ::testing::ReturnRefOfCopy;
+
+class AdmissionControlTest : public ::testing::Test {
+ public:
+  std::shared_ptr<AdmissionControl> makeAdmissionControl(
+      AdmissionControl::Limits limits) {
+    return std::make_shared<AdmissionControl>(
+        limits, [this] { return pending_txs; }, [this] { return now; });
+  }
+
+  /// @return batch of a transaction for each of the creators
+  std::shared_ptr<shared_model::interface::TransactionBatch> batch(
+      std::vector<std::string> creators) {
+    shared_model::interface::types::SharedTxsCollectionType txs;
+    for (const auto &creator : creators) {
+      auto tx = createMockTransactionWithHash(
+          shared_model::crypto::Hash(creator + std::to_string(txs.size())));
+      ON_CALL(*tx, creatorAccountId()).WillByDefault(ReturnRefOfCopy(creator));
+      txs.push_back(tx);
+    }
+    return createMockBatchWithTransactions(txs, "batch");
+  }
+
+  size_t pending_txs = 0;
+  AdmissionControl::Clock::time_point now{};
+};
+
+/**
+ * @given admission control with a global rate limit
+ * @when the batches are sent faster than the rate
+ * @then the batches over the limit are rejected until the bucket is refilled
+ */
+TEST_F(AdmissionControlTest, GlobalRate) {
+  auto admission = makeAdmissionControl({2, 0, 0});
+
+  EXPECT_TRUE(admission->admit(*batch({"a@domain"})));
+  EXPECT_TRUE(admission->admit(*batch({"b@domain"})));
+  EXPECT_FALSE(admission->admit(*batch({"c@domain"})));
+  EXPECT_EQ(1, admission->rejectedTxs().value());
+
+  now += 500ms;
+  EXPECT_TRUE(admission->admit(*batch({"c@domain"})));
+  EXPECT_FALSE(admission->admit(*batch({"c@domain"})));
+}
+
+/**
+ * @given admission control with a rate limit per account
+ * @when an account exceeds its rate
+ * @then its transactions are rejected while other accounts are admitted
+ */
+TEST_F(AdmissionControlTest, AccountRate) {
+  auto admission = makeAdmissionControl({0, 1, 0});
+
+  EXPECT_TRUE(admission->admit(*batch({"a@domain"})));
+  EXPECT_FALSE(admission->admit(*batch({"a@domain"})));
+  EXPECT_TRUE(admission->admit(*batch({"b@domain"})));
+  EXPECT_FALSE(admission->admit(*batch({"b@domain", "c@domain"})));
+  EXPECT_TRUE(admission->admit(*batch({"c@domain"})));
+}
+
+/**
+ * @given admission control with a limit of the pending transactions
+ * @when the ordering service fills up
+ * @then the rate decreases, and nothing is admitted at the limit
+ */
+TEST_F(AdmissionControlTest, AdaptsToPendingTransactions) {
+  auto admission = makeAdmissionControl({2, 0, 10});
+
+  EXPECT_TRUE(admission->admit(*batch({"a@domain", "b@domain"})));
+
+  pending_txs = 5;
+  now += 1s;
+  // the bucket is refilled at the half of the rate
+  EXPECT_TRUE(admission->admit(*batch({"a@domain"})));
+  EXPECT_FALSE(admission->admit(*batch({"a@domain"})));
+
+  pending_txs = 10;
+  now += 10s;
+  EXPECT_FALSE(admission->admit(*batch({"a@domain"})));
+}
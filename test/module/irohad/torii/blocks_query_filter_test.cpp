@@ -0,0 +1,175 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/blocks_query_filter.hpp"
+
+#include <gtest/gtest.h>
+#include "backend/protobuf/transaction.hpp"
+#include "datetime/time.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::torii;
+
+class BlocksQueryFilterTest : public testing::Test {
+ public:
+  void SetUp() override {
+    auto payload = block.mutable_payload();
+    payload->set_height(3);
+    payload->set_prev_block_hash("prev");
+    payload->set_created_time(created_time);
+    payload->set_tx_number(2);
+    *payload->add_transactions() =
+        TestTransactionBuilder()
+            .creatorAccountId("a@domain")
+            .createdTime(created_time)
+            .transferAsset("a@domain", "b@domain", "coin#domain", "", "1.0")
+            .build()
+            .getTransport();
+    *payload->add_transactions() =
+        TestTransactionBuilder()
+            .creatorAccountId("c@domain")
+            .createdTime(created_time)
+            .setAccountQuorum("c@domain", 2)
+            .build()
+            .getTransport();
+  }
+
+  uint64_t created_time = iroha::time::now();
+  iroha::protocol::Block_v1 block;
+  iroha::protocol::BlocksQueryFilter filter;
+};
+
+/**
+ * @given a filter without criteria
+ * @when it is checked
+ * @then it passes the blocks as they are
+ */
+TEST_F(BlocksQueryFilterTest, EmptyFilter) {
+  EXPECT_TRUE(BlocksQueryFilter(filter).empty());
+}
+
+/**
+ * @given filters with the same criteria in a different order
+ * @when their keys are compared
+ * @then the keys are equal
+ */
+TEST_F(BlocksQueryFilterTest, KeyDoesNotDependOnOrder) {
+  filter.add_account_ids("a@domain");
+  filter.add_account_ids("b@domain");
+  iroha::protocol::BlocksQueryFilter other;
+  other.add_account_ids("b@domain");
+  other.add_account_ids("a@domain");
+
+  EXPECT_EQ(BlocksQueryFilter(filter).key(), BlocksQueryFilter(other).key());
+}
+
+/**
+ * @given a filter by an account which is a destination of a transfer
+ * @when the block is filtered
+ * @then the whole block is passed
+ */
+TEST_F(BlocksQueryFilterTest, MatchesCommandAccount) {
+  filter.add_account_ids("b@domain");
+
+  auto response = BlocksQueryFilter(filter).apply(block);
+  ASSERT_TRUE(response);
+  ASSERT_TRUE(response->has_block_response());
+  EXPECT_EQ(2,
+            response->block_response()
+                .block()
+                .block_v1()
+                .payload()
+                .transactions_size());
+}
+
+/**
+ * @given a filter by an asset and a command type which no transaction has
+ * together
+ * @when the block is filtered
+ * @then the block is skipped
+ */
+TEST_F(BlocksQueryFilterTest, SkipsBlockWithoutMatches) {
+  filter.add_asset_ids("coin#domain");
+  filter.add_command_types("set_account_quorum");
+
+  EXPECT_FALSE(BlocksQueryFilter(filter).apply(block));
+}
+
+/**
+ * @given a summary filter by a command type
+ * @when the block is filtered
+ * @then the header of the block and the matching transaction are passed
+ */
+TEST_F(BlocksQueryFilterTest, Summary) {
+  filter.add_command_types("set_account_quorum");
+  filter.set_summary(true);
+
+  auto response = BlocksQueryFilter(filter).apply(block);
+  ASSERT_TRUE(response);
+  ASSERT_TRUE(response->has_block_summary_response());
+  const auto &summary = response->block_summary_response();
+  EXPECT_EQ(3, summary.height());
+  EXPECT_EQ("prev", summary.prev_block_hash());
+  EXPECT_EQ(created_time, summary.created_time());
+  EXPECT_EQ(2, summary.tx_number());
+  ASSERT_EQ(1, summary.transactions_size());
+  EXPECT_EQ("c@domain",
+            summary.transactions(0).payload().reduced_payload()
+                .creator_account_id());
+}
+
+/**
+ * @given a summary filter and the block with the root of its transactions
+ * @when the block is filtered
+ * @then the matching transaction is passed with its proof, which is valid
+ * against the root of the block
+ */
+TEST_F(BlocksQueryFilterTest, SummaryProvesTransactions) {
+  std::vector<shared_model::crypto::Hash> hashes;
+  for (const auto &transaction : block.payload().transactions()) {
+    hashes.push_back(shared_model::proto::Transaction(transaction).hash());
+  }
+  shared_model::crypto::MerkleTree tree(hashes);
+  auto root = block.mutable_payload()->mutable_transactions_root();
+  root->set_version(shared_model::crypto::MerkleTree::kVersion);
+  root->set_root(tree.root().hex());
+  filter.add_command_types("set_account_quorum");
+  filter.set_summary(true);
+
+  auto response = BlocksQueryFilter(filter).apply(block);
+  ASSERT_TRUE(response);
+  const auto &summary = response->block_summary_response();
+  EXPECT_EQ(tree.root().hex(), summary.transactions_root().root());
+  ASSERT_EQ(1, summary.proofs_size());
+  const auto &proof = summary.proofs(0);
+  EXPECT_EQ(1, proof.index());
+  std::vector<shared_model::crypto::Hash> siblings;
+  for (const auto &sibling : proof.siblings()) {
+    siblings.push_back(shared_model::crypto::Hash::fromHexString(sibling));
+  }
+  EXPECT_TRUE(shared_model::crypto::MerkleTree::verify(
+      hashes[1], proof.index(), summary.tx_number(), siblings, tree.root()));
+}
+
+/**
+ * @given a summary filter and the block with a root which does not match its
+ * transactions
+ * @when the block is filtered
+ * @then the matching transaction is passed without the root and the proof
+ */
+TEST_F(BlocksQueryFilterTest, SummarySkipsWrongRoot) {
+  auto root = block.mutable_payload()->mutable_transactions_root();
+  root->set_version(shared_model::crypto::MerkleTree::kVersion);
+  root->set_root(std::string(64, '0'));
+  filter.add_command_types("set_account_quorum");
+  filter.set_summary(true);
+
+  auto response = BlocksQueryFilter(filter).apply(block);
+  ASSERT_TRUE(response);
+  const auto &summary = response->block_summary_response();
+  EXPECT_EQ(1, summary.transactions_size());
+  EXPECT_FALSE(summary.has_transactions_root());
+  EXPECT_EQ(0, summary.proofs_size());
+}
@@ -37,7 +37,7 @@ class CommandServiceTest : public Test {
     log_ = getTestLogger("CommandServiceTest");
   }
 
-  void initCommandService() {
+  void initCommandService(bool accept_transactions = true) {
     command_service_ = std::make_shared<iroha::torii::CommandServiceImpl>(
         transaction_processor_,
         storage_,
@@ -45,7 +45,9 @@ class CommandServiceTest : public Test {
         tx_status_factory_,
         cache_,
         tx_presence_cache_,
-        log_);
+        log_,
+        nullptr,
+        accept_transactions);
   }
 
   std::shared_ptr<iroha::torii::MockTransactionProcessor>
@@ -81,6 +83,9 @@ TEST_F(CommandServiceTest, getStatusStreamWithAbsentHash) {
   EXPECT_CALL(*status_bus_, statuses())
       .WillRepeatedly(Return(
           rxcpp::observable<>::empty<iroha::torii::StatusBus::Objects>()));
+  EXPECT_CALL(*status_bus_, statuses(hash))
+      .WillOnce(Return(
+          rxcpp::observable<>::empty<iroha::torii::StatusBus::Objects>()));
 
   initCommandService();
   auto wrapper = framework::test_subscriber::make_test_subscriber<
@@ -120,3 +125,75 @@ TEST_F(CommandServiceTest, ProcessBatchOn) {
   initCommandService();
   command_service_->handleTransactionBatch(batch);
 }
+
+/**
+ * @given command service of an observer peer
+ * @when  invoke processBatch
+ * @then  tx_processor batchHandle is not invoked
+ *        @and the stateless failed status of the transaction is published
+ */
+TEST_F(CommandServiceTest, ObserverRejectsBatch) {
+  auto hash = shared_model::crypto::Hash("a");
+  auto batch = createMockBatchWithTransactions(
+      {createMockTransactionWithHash(hash)}, "a");
+  EXPECT_CALL(*status_bus_, statuses())
+      .WillRepeatedly(Return(
+          rxcpp::observable<>::empty<iroha::torii::StatusBus::Objects>()));
+
+  EXPECT_CALL(*transaction_processor_, batchHandle(_)).Times(0);
+  EXPECT_CALL(*status_bus_, publish(_)).WillOnce(Invoke([&](auto response) {
+    EXPECT_EQ(response->transactionHash(), hash);
+    iroha::visit_in_place(
+        response->get(),
+        [](const shared_model::interface::StatelessFailedTxResponse &) {},
+        [](const auto &) { FAIL() << "Wrong response!"; });
+  }));
+
+  initCommandService(false);
+  command_service_->handleTransactionBatch(batch);
+}
+
+/**
+ * @given initialized command service with a status in the runtime cache
+ * @when  invoke getStatuses for the cached hash and two absent ones
+ * @then  the absent hashes are checked in the storage with a single query
+ *        @and the statuses are returned in the order of the hashes
+ */
+TEST_F(CommandServiceTest, getStatusesChecksStorageOnce) {
+  using HashType = shared_model::crypto::Hash;
+  HashType cached_hash("a"), committed_hash("b"), missing_hash("c");
+  cache_->addItem(cached_hash,
+                  tx_status_factory_->makeEnoughSignaturesCollected(
+                      cached_hash, {}));
+
+  auto block_query = std::make_shared<iroha::ametsuchi::MockBlockQuery>();
+  EXPECT_CALL(*storage_, getBlockQuery()).WillOnce(Return(block_query));
+  EXPECT_CALL(*block_query,
+              checkTxsPresence(std::vector<HashType>{committed_hash,
+                                                     missing_hash}))
+      .WillOnce(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
+          iroha::ametsuchi::tx_cache_status_responses::Committed{
+              committed_hash},
+          iroha::ametsuchi::tx_cache_status_responses::Missing{
+              missing_hash}}));
+  EXPECT_CALL(*status_bus_, statuses())
+      .WillRepeatedly(Return(
+          rxcpp::observable<>::empty<iroha::torii::StatusBus::Objects>()));
+
+  initCommandService();
+  auto statuses = command_service_->getStatuses(
+      {cached_hash, committed_hash, missing_hash});
+
+  auto status_of = [&statuses](size_t i) {
+    return std::static_pointer_cast<shared_model::proto::TransactionResponse>(
+               statuses[i])
+        ->getTransport()
+        .tx_status();
+  };
+  ASSERT_EQ(3, statuses.size());
+  EXPECT_EQ(iroha::protocol::TxStatus::ENOUGH_SIGNATURES_COLLECTED,
+            status_of(0));
+  EXPECT_EQ(iroha::protocol::TxStatus::COMMITTED, status_of(1));
+  EXPECT_EQ(iroha::protocol::TxStatus::NOT_RECEIVED, status_of(2));
+  EXPECT_TRUE(cache_->findItem(committed_hash));
+}
@@ -20,10 +20,17 @@ namespace iroha {
                    std::unique_ptr<shared_model::interface::QueryResponse>(
                        const shared_model::interface::Query &));
       MOCK_METHOD1(
+          queryBatchHandle,
+          std::vector<std::unique_ptr<shared_model::interface::QueryResponse>>(
+              const std::vector<std::unique_ptr<shared_model::interface::Query>>
+                  &));
+      MOCK_METHOD3(
           blocksQueryHandle,
           rxcpp::observable<
               std::shared_ptr<shared_model::interface::BlockQueryResponse>>(
-              const shared_model::interface::BlocksQuery &));
+              const shared_model::interface::BlocksQuery &,
+              shared_model::interface::types::HeightType,
+              size_t));
     };
 
   }  // namespace torii
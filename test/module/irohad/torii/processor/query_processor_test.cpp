@@ -39,6 +39,7 @@ class QueryProcessorTest : public ::testing::Test {
  public:
   void SetUp() override {
     qry_exec = std::make_shared<MockQueryExecutor>();
+    block_queries = std::make_shared<MockBlockQuery>();
     storage = std::make_shared<MockStorage>();
     query_response_factory =
         std::make_shared<shared_model::proto::ProtoQueryResponseFactory>();
@@ -55,6 +56,13 @@ class QueryProcessorTest : public ::testing::Test {
             boost::make_optional(std::shared_ptr<QueryExecutor>(qry_exec))));
   }
 
+  static auto makeBlock(shared_model::interface::types::HeightType height) {
+    return clone(TestBlockBuilder()
+                     .height(height)
+                     .prevHash(shared_model::crypto::Hash(std::string(32, '0')))
+                     .build());
+  }
+
   auto getBlocksQuery(const std::string &creator_account_id) {
     return TestUnsignedBlocksQueryBuilder()
         .createdTime(kCreatedTime)
@@ -153,7 +161,7 @@ TEST_F(QueryProcessorTest, GetBlocksQuery) {
   EXPECT_CALL(*qry_exec, validate(_, _)).WillOnce(Return(true));
 
   auto wrapper = make_test_subscriber<CallExact>(
-      qpi->blocksQueryHandle(block_query), block_number);
+      qpi->blocksQueryHandle(block_query, 0, 0), block_number);
   wrapper.subscribe([](auto response) {
     ASSERT_NO_THROW({
       boost::get<const shared_model::interface::BlockResponse &>(
@@ -178,8 +186,8 @@ TEST_F(QueryProcessorTest, GetBlocksQueryNoPerms) {
 
   EXPECT_CALL(*qry_exec, validate(_, _)).WillOnce(Return(false));
 
-  auto wrapper =
-      make_test_subscriber<CallExact>(qpi->blocksQueryHandle(block_query), 1);
+  auto wrapper = make_test_subscriber<CallExact>(
+      qpi->blocksQueryHandle(block_query, 0, 0), 1);
   wrapper.subscribe([](auto response) {
     ASSERT_NO_THROW({
       boost::get<const shared_model::interface::BlockErrorResponse &>(
@@ -195,3 +203,146 @@ TEST_F(QueryProcessorTest, GetBlocksQueryNoPerms) {
   }
   ASSERT_TRUE(wrapper.validate());
 }
+
+/**
+ * @given committed blocks 1 to 3
+ * @when a valid block query from height 2 is sent, and the blocks 3 and 4
+ * are committed while the block 3 is read from the storage
+ * @then the blocks 2, 3 and 4 are emitted in order, without a duplicate
+ */
+TEST_F(QueryProcessorTest, GetBlocksQueryFromHeight) {
+  auto block_query = getBlocksQuery(kAccountId);
+
+  EXPECT_CALL(*qry_exec, validate(_, _)).WillOnce(Return(true));
+  EXPECT_CALL(*block_queries, getTopBlockHeight()).WillOnce(Return(3));
+  EXPECT_CALL(*block_queries, getBlock(2)).WillOnce(Invoke([](auto height) {
+    return BlockQuery::BlockResult(iroha::expected::makeValue(
+        std::unique_ptr<shared_model::interface::Block>(makeBlock(height))));
+  }));
+  EXPECT_CALL(*block_queries, getBlock(3)).WillOnce(Invoke([this](auto height) {
+    storage->notifier.get_subscriber().on_next(makeBlock(3));
+    storage->notifier.get_subscriber().on_next(makeBlock(4));
+    return BlockQuery::BlockResult(iroha::expected::makeValue(
+        std::unique_ptr<shared_model::interface::Block>(makeBlock(height))));
+  }));
+
+  std::vector<shared_model::interface::types::HeightType> heights;
+  auto on_block = [&heights](auto response) {
+    heights.push_back(
+        boost::get<const shared_model::interface::BlockResponse &>(
+            response->get())
+            .block()
+            .height());
+  };
+  qpi->blocksQueryHandle(block_query, 2, 0).subscribe(on_block);
+  storage->notifier.get_subscriber().on_next(makeBlock(5));
+
+  EXPECT_EQ(heights,
+            (std::vector<shared_model::interface::types::HeightType>{
+                2, 3, 4, 5}));
+}
+
+/**
+ * @given committed blocks 1 to 10
+ * @when a block query from height 2 is sent with the backlog limit of 5
+ * @then the error response is emitted and no block is read
+ */
+TEST_F(QueryProcessorTest, GetBlocksQueryFromHeightTooFarBehind) {
+  auto block_query = getBlocksQuery(kAccountId);
+
+  EXPECT_CALL(*qry_exec, validate(_, _)).WillOnce(Return(true));
+  EXPECT_CALL(*block_queries, getTopBlockHeight()).WillOnce(Return(10));
+  EXPECT_CALL(*block_queries, getBlock(_)).Times(0);
+
+  auto wrapper = make_test_subscriber<CallExact>(
+      qpi->blocksQueryHandle(block_query, 2, 5), 1);
+  wrapper.subscribe([](auto response) {
+    ASSERT_NO_THROW({
+      boost::get<const shared_model::interface::BlockErrorResponse &>(
+          response->get());
+    });
+  });
+  ASSERT_TRUE(wrapper.validate());
+}
+
+/**
+ * @given QueryProcessorImpl with the response cache
+ * @when the same GetAccountDetail query is sent twice
+ * @then it is executed once @and the second response is made for the second
+ * query @and the signatories of the second query are validated
+ */
+TEST_F(QueryProcessorTest, CachedQueryResponse) {
+  auto cache = std::make_shared<torii::QueryResponseCache>(10);
+  qpi = std::make_shared<torii::QueryProcessorImpl>(
+      storage,
+      storage,
+      nullptr,
+      query_response_factory,
+      getTestLogger("QueryProcessor"),
+      cache);
+  auto make_query = [this](auto created_time) {
+    return TestUnsignedQueryBuilder()
+        .createdTime(created_time)
+        .creatorAccountId(kAccountId)
+        .getAccountDetail(kMaxPageSize, kAccountId)
+        .build()
+        .signAndAddSignature(keypair)
+        .finish();
+  };
+  auto first_query = make_query(kCreatedTime);
+  auto second_query = make_query(kCreatedTime + 1);
+  auto *qry_resp = query_response_factory
+                       ->createAccountDetailResponse(
+                           "{}", 1, boost::none, first_query.hash())
+                       .release();
+
+  EXPECT_CALL(*qry_exec, validateAndExecute_(_)).WillOnce(Return(qry_resp));
+  EXPECT_CALL(*qry_exec, validateSignatories(_)).WillOnce(Return(true));
+
+  ASSERT_TRUE(qpi->queryHandle(first_query));
+  auto response = qpi->queryHandle(second_query);
+  ASSERT_TRUE(response);
+  EXPECT_EQ(second_query.hash(), response->queryHash());
+  ASSERT_NO_THROW(
+      boost::get<const shared_model::interface::AccountDetailResponse &>(
+          response->get()));
+  EXPECT_EQ(1, cache->hits()->value());
+  EXPECT_EQ(1, cache->misses()->value());
+}
+
+/**
+ * @given QueryProcessorImpl with the cached response
+ * @when a block is committed @and the query is sent again
+ * @then the query is executed again
+ */
+TEST_F(QueryProcessorTest, CachedQueryResponseInvalidatedOnCommit) {
+  auto cache = std::make_shared<torii::QueryResponseCache>(10);
+  qpi = std::make_shared<torii::QueryProcessorImpl>(
+      storage,
+      storage,
+      nullptr,
+      query_response_factory,
+      getTestLogger("QueryProcessor"),
+      cache);
+  auto query = TestUnsignedQueryBuilder()
+                   .creatorAccountId(kAccountId)
+                   .getAccountDetail(kMaxPageSize, kAccountId)
+                   .build()
+                   .signAndAddSignature(keypair)
+                   .finish();
+
+  EXPECT_CALL(*qry_exec, validateAndExecute_(_))
+      .Times(2)
+      .WillRepeatedly(Invoke([this, &query](const auto &) {
+        return query_response_factory
+            ->createAccountDetailResponse("{}", 1, boost::none, query.hash())
+            .release();
+      }));
+
+  ASSERT_TRUE(qpi->queryHandle(query));
+  EXPECT_EQ(1, cache->size());
+  storage->notifier.get_subscriber().on_next(
+      clone(TestBlockBuilder().build()));
+  EXPECT_EQ(0, cache->size());
+  ASSERT_TRUE(qpi->queryHandle(query));
+}
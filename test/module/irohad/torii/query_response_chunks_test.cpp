@@ -0,0 +1,111 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/query_response_chunks.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace iroha::torii;
+
+class QueryResponseChunksTest : public ::testing::Test {
+ public:
+  /// @return chunks of the response split by the limit
+  std::vector<iroha::protocol::QueryResponse> split(
+      iroha::protocol::QueryResponse response, size_t max_bytes) {
+    std::vector<iroha::protocol::QueryResponse> chunks;
+    EXPECT_TRUE(splitQueryResponse(
+        std::move(response), max_bytes, [&chunks](const auto &chunk) {
+          chunks.push_back(chunk);
+          return true;
+        }));
+    return chunks;
+  }
+
+  /// @return response with the account assets of the given number
+  static iroha::protocol::QueryResponse makeAssetsResponse(size_t assets) {
+    iroha::protocol::QueryResponse response;
+    response.set_query_hash("hash");
+    auto &assets_response = *response.mutable_account_assets_response();
+    assets_response.set_total_number(assets);
+    for (size_t i = 0; i < assets; ++i) {
+      auto &asset = *assets_response.add_account_assets();
+      asset.set_asset_id("coin" + std::to_string(i) + "#domain");
+      asset.set_account_id("account@domain");
+      asset.set_balance("100.0");
+    }
+    return response;
+  }
+};
+
+/**
+ * @given response with 100 account assets
+ * @when it is split with a limit of a few assets
+ * @then every chunk fits the limit @and repeats the other fields @and the
+ * chunks have all the assets in their order
+ */
+TEST_F(QueryResponseChunksTest, CollectionIsSplit) {
+  auto response = makeAssetsResponse(100);
+  const size_t max_bytes = 200;
+
+  auto chunks = split(response, max_bytes);
+
+  ASSERT_GT(chunks.size(), 1);
+  iroha::protocol::AccountAssetResponse assets;
+  for (const auto &chunk : chunks) {
+    EXPECT_LE(chunk.ByteSizeLong(), max_bytes);
+    EXPECT_EQ("hash", chunk.query_hash());
+    ASSERT_TRUE(chunk.has_account_assets_response());
+    EXPECT_EQ(100, chunk.account_assets_response().total_number());
+    assets.MergeFrom(chunk.account_assets_response());
+  }
+  EXPECT_EQ(response.account_assets_response().SerializeAsString(),
+            assets.SerializeAsString());
+}
+
+/**
+ * @given response with the elements larger than the limit
+ * @when it is split
+ * @then every element is sent in a chunk of its own
+ */
+TEST_F(QueryResponseChunksTest, LargeElementIsSentAlone) {
+  auto chunks = split(makeAssetsResponse(3), 1);
+
+  ASSERT_EQ(3, chunks.size());
+  for (const auto &chunk : chunks) {
+    EXPECT_EQ(1, chunk.account_assets_response().account_assets_size());
+  }
+}
+
+/**
+ * @given response without a collection @and one with an empty collection
+ * @when they are split
+ * @then each of them is sent as a single chunk
+ */
+TEST_F(QueryResponseChunksTest, ResponseWithoutCollectionIsNotSplit) {
+  iroha::protocol::QueryResponse error;
+  error.mutable_error_response()->set_message("error");
+  auto chunks = split(error, 1);
+  ASSERT_EQ(1, chunks.size());
+  EXPECT_EQ(error.SerializeAsString(), chunks.front().SerializeAsString());
+
+  chunks = split(makeAssetsResponse(0), 1);
+  ASSERT_EQ(1, chunks.size());
+  EXPECT_TRUE(chunks.front().has_account_assets_response());
+}
+
+/**
+ * @given response split into several chunks
+ * @when the writer fails on the first chunk
+ * @then the split stops
+ */
+TEST_F(QueryResponseChunksTest, StopsWhenWriterFails) {
+  size_t written = 0;
+  EXPECT_FALSE(splitQueryResponse(
+      makeAssetsResponse(10), 1, [&written](const auto &) {
+        ++written;
+        return false;
+      }));
+  EXPECT_EQ(1, written);
+}
@@ -7,8 +7,13 @@
 #include "backend/protobuf/proto_query_response_factory.hpp"
 #include "backend/protobuf/proto_transport_factory.hpp"
 #include "backend/protobuf/query_responses/proto_query_response.hpp"
+#include "backend/protobuf/util.hpp"
 #include "builders/protobuf/queries.hpp"
+#include "cryptography/default_hash_provider.hpp"
+#include "cryptography/merkle_tree.hpp"
 #include "framework/test_logger.hpp"
+#include "module/irohad/ametsuchi/mock_block_query.hpp"
+#include "module/irohad/ametsuchi/mock_block_query_factory.hpp"
 #include "module/irohad/common/validators_config.hpp"
 #include "module/irohad/torii/processor/mock_query_processor.hpp"
 #include "utils/query_error_response_visitor.hpp"
@@ -137,3 +142,66 @@ TEST_F(QueryServiceTest, InvalidWhenDuplicateHash) {
           shared_model::interface::StatelessFailedErrorResponse>(),
       resp.get()));
 }
+
+/**
+ * @given committed block with the root of its transactions
+ * @when the proofs of its transaction and of an unknown one are requested
+ * @then the proof of the transaction is valid against the root of the block
+ * @and the unknown transaction is not found
+ */
+TEST_F(QueryServiceTest, ProvesTransaction) {
+  iroha::protocol::Block_v1 block;
+  std::vector<shared_model::crypto::Hash> hashes;
+  for (auto i = 0; i < 3; ++i) {
+    auto transaction = block.mutable_payload()->add_transactions();
+    transaction->mutable_payload()->mutable_reduced_payload()->set_created_time(
+        i);
+    hashes.push_back(shared_model::crypto::DefaultHashProvider::makeHash(
+        shared_model::proto::makeBlob(transaction->payload())));
+  }
+  shared_model::crypto::MerkleTree tree(hashes);
+  auto root = block.mutable_payload()->mutable_transactions_root();
+  root->set_version(shared_model::crypto::MerkleTree::kVersion);
+  root->set_root(tree.root().hex());
+
+  auto block_query = std::make_shared<ametsuchi::MockBlockQuery>();
+  EXPECT_CALL(*block_query, getSerializedBlock(2))
+      .WillRepeatedly(Return(
+          iroha::expected::makeValue(block.SerializeAsString())));
+  auto block_query_factory =
+      std::make_shared<ametsuchi::MockBlockQueryFactory>();
+  EXPECT_CALL(*block_query_factory, createBlockQuery())
+      .WillRepeatedly(Return(
+          boost::make_optional<std::shared_ptr<ametsuchi::BlockQuery>>(
+              block_query)));
+  QueryService service(query_processor,
+                       query_factory,
+                       blocks_query_factory,
+                       getTestLogger("QueryService"),
+                       false,
+                       rxcpp::observable<>::never<
+                           PendingTransactionStorage::BatchEvent>(),
+                       block_query_factory);
+
+  protocol::TransactionProofRequest request;
+  request.set_height(2);
+  request.set_tx_hash(hashes[2].hex());
+  protocol::TransactionProofResponse response;
+  ASSERT_TRUE(service.GetTransactionProof(nullptr, &request, &response).ok());
+  std::vector<shared_model::crypto::Hash> siblings;
+  for (const auto &sibling : response.proof().siblings()) {
+    siblings.push_back(shared_model::crypto::Hash::fromHexString(sibling));
+  }
+  EXPECT_TRUE(shared_model::crypto::MerkleTree::verify(
+      hashes[2],
+      response.proof().index(),
+      response.tx_number(),
+      siblings,
+      shared_model::crypto::Hash::fromHexString(
+          response.transactions_root().root())));
+
+  request.set_tx_hash(std::string(64, '0'));
+  EXPECT_EQ(grpc::StatusCode::NOT_FOUND,
+            service.GetTransactionProof(nullptr, &request, &response)
+                .error_code());
+}
@@ -0,0 +1,123 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/status_bus_impl.hpp"
+
+#include <condition_variable>
+#include <mutex>
+
+#include <gtest/gtest.h>
+#include <rxcpp/operators/rx-take.hpp>
+#include "backend/protobuf/proto_tx_status_factory.hpp"
+
+using namespace iroha::torii;
+
+class StatusBusTest : public ::testing::Test {
+ public:
+  StatusBus::Objects notReceived(const shared_model::crypto::Hash &hash) {
+    return status_factory.makeNotReceived(hash, {});
+  }
+
+  shared_model::proto::ProtoTxStatusFactory status_factory;
+  StatusBusImpl status_bus{
+      rxcpp::observe_on_one_worker(rxcpp::schedulers::make_current_thread())};
+};
+
+/**
+ * @given status bus with subscribers to the statuses of two transactions
+ * @when statuses of both transactions are published
+ * @then every subscriber receives only the statuses of its transaction
+ * @and all statuses are delivered to the subscribers of all statuses
+ */
+TEST_F(StatusBusTest, RoutesStatusesByHash) {
+  shared_model::crypto::Hash hash1("1"), hash2("2");
+  std::vector<shared_model::crypto::Hash> received1, received2, received_all;
+  auto subscription1 = status_bus.statuses(hash1).subscribe(
+      [&](auto status) { received1.push_back(status->transactionHash()); });
+  auto subscription2 = status_bus.statuses(hash2).subscribe(
+      [&](auto status) { received2.push_back(status->transactionHash()); });
+  auto subscription_all = status_bus.statuses().subscribe(
+      [&](auto status) { received_all.push_back(status->transactionHash()); });
+  EXPECT_EQ(2, status_bus.transactionSubscribers());
+
+  status_bus.publish(notReceived(hash1));
+  status_bus.publish(notReceived(hash2));
+  status_bus.publish(notReceived(hash1));
+
+  using Hashes = std::vector<shared_model::crypto::Hash>;
+  EXPECT_EQ((Hashes{hash1, hash1}), received1);
+  EXPECT_EQ((Hashes{hash2}), received2);
+  EXPECT_EQ((Hashes{hash1, hash2, hash1}), received_all);
+  EXPECT_EQ(3, status_bus.deliveryLag().count());
+
+  subscription1.unsubscribe();
+  subscription2.unsubscribe();
+  subscription_all.unsubscribe();
+}
+
+/**
+ * @given status bus with a subscriber to the statuses of a transaction
+ * @when the subscriber unsubscribes
+ * @then it is removed from the subscribers of the transaction
+ * @and does not receive the statuses published after that
+ */
+TEST_F(StatusBusTest, UnsubscribedAreRemoved) {
+  shared_model::crypto::Hash hash("1");
+  size_t received = 0;
+  auto subscription =
+      status_bus.statuses(hash).take(1).subscribe([&](auto) { ++received; });
+
+  status_bus.publish(notReceived(hash));
+  status_bus.publish(notReceived(hash));
+
+  EXPECT_EQ(1, received);
+  EXPECT_EQ(0, status_bus.transactionSubscribers());
+}
+
+/**
+ * @given status bus with several workers
+ * @when the statuses of several transactions are published
+ * @then the subscriber of each transaction receives all its statuses
+ * in the order of publication
+ */
+TEST(StatusBusShardsTest, KeepsOrderOfTransactionStatuses) {
+  constexpr size_t kTransactions = 8;
+  constexpr size_t kStatuses = 100;
+  shared_model::proto::ProtoTxStatusFactory status_factory;
+  StatusBusImpl status_bus(4);
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  size_t completed = 0;
+  std::vector<std::vector<StatusBus::Objects>> published(kTransactions),
+      received(kTransactions);
+  std::vector<rxcpp::composite_subscription> subscriptions;
+  for (size_t i = 0; i < kTransactions; ++i) {
+    subscriptions.push_back(
+        status_bus.statuses(shared_model::crypto::Hash(std::to_string(i)))
+            .take(kStatuses)
+            .subscribe(
+                [&received, i](auto status) { received[i].push_back(status); },
+                [&] {
+                  std::lock_guard<std::mutex> lock(mutex);
+                  ++completed;
+                  cv.notify_one();
+                }));
+  }
+
+  for (size_t n = 0; n < kStatuses; ++n) {
+    for (size_t i = 0; i < kTransactions; ++i) {
+      published[i].push_back(status_factory.makeNotReceived(
+          shared_model::crypto::Hash(std::to_string(i)), {}));
+      status_bus.publish(published[i].back());
+    }
+  }
+
+  std::unique_lock<std::mutex> lock(mutex);
+  ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(10), [&] {
+    return completed == kTransactions;
+  }));
+  EXPECT_EQ(published, received);
+}
@@ -25,6 +25,9 @@ namespace iroha {
      public:
       MOCK_METHOD1(publish, void(StatusBus::Objects));
       MOCK_METHOD0(statuses, rxcpp::observable<StatusBus::Objects>());
+      MOCK_METHOD1(statuses,
+                   rxcpp::observable<StatusBus::Objects>(
+                       const shared_model::crypto::Hash &));
     };
 
     class MockCommandService : public iroha::torii::CommandService {
@@ -36,6 +39,11 @@ namespace iroha {
           getStatus,
           std::shared_ptr<shared_model::interface::TransactionResponse>(
               const shared_model::crypto::Hash &request));
+      MOCK_METHOD1(
+          getStatuses,
+          std::vector<
+              std::shared_ptr<shared_model::interface::TransactionResponse>>(
+              const std::vector<shared_model::crypto::Hash> &));
       MOCK_METHOD1(
           getStatusStream,
           rxcpp::observable<
@@ -10,7 +10,9 @@
 #include "backend/protobuf/proto_transport_factory.hpp"
 #include "backend/protobuf/query_responses/proto_block_query_response.hpp"
 #include "backend/protobuf/query_responses/proto_query_response.hpp"
+#include "backend/protobuf/util.hpp"
 #include "builders/protobuf/queries.hpp"
+#include "cryptography/default_hash_provider.hpp"
 #include "framework/test_logger.hpp"
 #include "main/server_runner.hpp"
 #include "module/irohad/common/validators_config.hpp"
@@ -125,8 +127,10 @@ TEST_F(ToriiQueryServiceTest, FetchBlocksWhenValidQuery) {
 
   EXPECT_CALL(*query_processor,
               blocksQueryHandle(Truly([&blocks_query](auto &query) {
-                return query == *blocks_query;
-              })))
+                                  return query == *blocks_query;
+                                }),
+                                0,
+                                0))
       .WillOnce(Return(rxcpp::observable<>::just(block_response)));
 
   auto client = torii_utils::QuerySyncClient(ip, port);
@@ -147,7 +151,7 @@ TEST_F(ToriiQueryServiceTest, FetchBlocksWhenValidQuery) {
  * @then block error response is received
  */
 TEST_F(ToriiQueryServiceTest, FetchBlocksWhenInvalidQuery) {
-  EXPECT_CALL(*query_processor, blocksQueryHandle(_)).Times(0);
+  EXPECT_CALL(*query_processor, blocksQueryHandle(_, _, _)).Times(0);
 
   auto blocks_query = std::make_shared<shared_model::proto::BlocksQuery>(
       TestUnsignedBlocksQueryBuilder()
@@ -169,3 +173,230 @@ TEST_F(ToriiQueryServiceTest, FetchBlocksWhenInvalidQuery) {
   auto response = responses.at(0);
   ASSERT_TRUE(response.has_block_error_response());
 }
+
+/**
+ * @given query service with the asynchronous block streams
+ * @when two clients fetch the same committed block
+ * @then both of them receive the block, serialized once for both streams
+ */
+TEST_F(ToriiQueryServiceTest, FetchBlocksAsynchronouslyByTwoClients) {
+  auto async_runner = std::make_unique<iroha::network::ServerRunner>(
+      ip + ":0", getTestLogger("ServerRunner"));
+  int async_port = 0;
+  async_runner
+      ->append(std::make_unique<iroha::torii::QueryService>(
+          query_processor,
+          query_factory,
+          blocks_query_factory,
+          getTestLogger("QueryService"),
+          true))
+      .run()
+      .match([&async_port](auto port) { async_port = port.value; },
+             [](const auto &err) { FAIL() << err.error; });
+  async_runner->waitForServersReady();
+
+  iroha::protocol::Block block;
+  block.mutable_block_v1()->mutable_payload()->set_height(123);
+  std::shared_ptr<shared_model::interface::BlockQueryResponse> block_response =
+      shared_model::proto::ProtoQueryResponseFactory().createBlockQueryResponse(
+          std::make_unique<shared_model::proto::Block>(block.block_v1()));
+  EXPECT_CALL(*query_processor, blocksQueryHandle(_, 0, _))
+      .Times(2)
+      .WillRepeatedly(Return(rxcpp::observable<>::just(block_response)));
+
+  auto client = torii_utils::QuerySyncClient(ip, async_port);
+  for (auto counter : {1, 2}) {
+    auto blocks_query = shared_model::proto::BlocksQueryBuilder()
+                            .creatorAccountId("user@domain")
+                            .createdTime(iroha::time::now())
+                            .queryCounter(counter)
+                            .build()
+                            .signAndAddSignature(keypair)
+                            .finish();
+    auto responses = client.FetchCommits(blocks_query.getTransport());
+
+    ASSERT_EQ(responses.size(), 1);
+    ASSERT_TRUE(responses.at(0).has_block_response());
+    ASSERT_EQ(responses.at(0).block_response().block().SerializeAsString(),
+              block.SerializeAsString());
+  }
+}
+
+/**
+ * @given query service with a small size limit of the streamed messages
+ * @and query whose response has many roles
+ * @when the query is executed by FindStream
+ * @then the response is received in several chunks, which have all the roles
+ * in their order
+ */
+TEST_F(ToriiQueryServiceTest, FindStreamSplitsResponse) {
+  auto stream_runner = std::make_unique<iroha::network::ServerRunner>(
+      ip + ":0", getTestLogger("ServerRunner"));
+  int stream_port = 0;
+  stream_runner
+      ->append(std::make_unique<iroha::torii::QueryService>(
+          query_processor,
+          query_factory,
+          blocks_query_factory,
+          getTestLogger("QueryService"),
+          false,
+          rxcpp::observable<>::never<
+              iroha::PendingTransactionStorage::BatchEvent>(),
+          nullptr,
+          64))
+      .run()
+      .match([&stream_port](auto port) { stream_port = port.value; },
+             [](const auto &err) { FAIL() << err.error; });
+  stream_runner->waitForServersReady();
+
+  auto query = shared_model::proto::QueryBuilder()
+                   .creatorAccountId("user@domain")
+                   .createdTime(iroha::time::now())
+                   .queryCounter(1)
+                   .getRoles()
+                   .build()
+                   .signAndAddSignature(keypair)
+                   .finish();
+  std::vector<shared_model::interface::types::RoleIdType> roles;
+  for (auto i = 0; i < 20; ++i) {
+    roles.push_back("role" + std::to_string(i));
+  }
+  EXPECT_CALL(*query_processor, queryHandle(_))
+      .WillOnce(Invoke([&roles, &query](auto &) {
+        return shared_model::proto::ProtoQueryResponseFactory()
+            .createRolesResponse(roles, query.hash());
+      }));
+
+  auto client = torii_utils::QuerySyncClient(ip, stream_port);
+  auto responses = client.FindStream(query.getTransport());
+
+  ASSERT_GT(responses.size(), 1);
+  std::vector<std::string> received;
+  for (const auto &response : responses) {
+    ASSERT_TRUE(response.has_roles_response());
+    EXPECT_EQ(query.hash().hex(), response.query_hash());
+    received.insert(received.end(),
+                    response.roles_response().roles().begin(),
+                    response.roles_response().roles().end());
+  }
+  EXPECT_EQ(roles, received);
+}
+
+/**
+ * Query service which serves the query batches
+ */
+class ToriiQueryBatchTest : public ToriiQueryServiceTest {
+ public:
+  void SetUp() override {
+    ToriiQueryServiceTest::SetUp();
+    batch_runner = std::make_unique<iroha::network::ServerRunner>(
+        ip + ":0", getTestLogger("ServerRunner"));
+    batch_runner
+        ->append(std::make_unique<iroha::torii::QueryService>(
+            query_processor,
+            query_factory,
+            blocks_query_factory,
+            getTestLogger("QueryService"),
+            false,
+            rxcpp::observable<>::never<
+                iroha::PendingTransactionStorage::BatchEvent>(),
+            nullptr,
+            iroha::torii::QueryService::kDefaultStreamChunkBytes,
+            std::make_shared<shared_model::proto::ProtoTransportFactory<
+                shared_model::interface::Query,
+                shared_model::proto::Query>>(
+                std::make_unique<
+                    shared_model::validation::DefaultUnsignedQueryValidator>(
+                    iroha::test::kTestsValidatorsConfig),
+                std::make_unique<
+                    shared_model::validation::ProtoQueryValidator>())))
+        .run()
+        .match([this](auto port) { batch_port = port.value; },
+               [](const auto &err) { FAIL() << err.error; });
+    batch_runner->waitForServersReady();
+  }
+
+  /// @return batch of the queries of the creator, signed by the keypair
+  iroha::protocol::QueryBatch makeBatch(const std::string &creator,
+                                        size_t size) {
+    iroha::protocol::QueryBatch batch;
+    for (size_t i = 0; i < size; ++i) {
+      *batch.mutable_payload()->add_queries() =
+          TestQueryBuilder()
+              .creatorAccountId(creator)
+              .createdTime(iroha::time::now())
+              .queryCounter(i + 1)
+              .getAccountAssets(creator, 10, boost::none)
+              .build()
+              .getTransport()
+              .payload();
+    }
+    auto signed_data = shared_model::crypto::DefaultCryptoAlgorithmType::sign(
+        shared_model::proto::makeBlob(batch.payload()), keypair);
+    batch.mutable_signature()->set_public_key(keypair.publicKey().hex());
+    batch.mutable_signature()->set_signature(signed_data.hex());
+    return batch;
+  }
+
+  std::unique_ptr<iroha::network::ServerRunner> batch_runner;
+  int batch_port = 0;
+};
+
+/**
+ * @given batch of the queries of the same creator signed together
+ * @when the batch is executed by FindBatch
+ * @then the queries are executed together with the signature of the batch
+ * @and their responses are received in the order of the queries
+ */
+TEST_F(ToriiQueryBatchTest, FindBatchExecutesQueries) {
+  auto batch = makeBatch("user@domain", 3);
+  EXPECT_CALL(*query_processor, queryBatchHandle(_))
+      .WillOnce(Invoke([this](const auto &queries) {
+        std::vector<std::unique_ptr<shared_model::interface::QueryResponse>>
+            responses;
+        for (const auto &query : queries) {
+          EXPECT_EQ(keypair.publicKey(),
+                    query->signatures().front().publicKey());
+          responses.push_back(
+              shared_model::proto::ProtoQueryResponseFactory()
+                  .createRolesResponse({"role"}, query->hash()));
+        }
+        return responses;
+      }));
+
+  iroha::protocol::QueryBatchResponse response;
+  auto status = torii_utils::QuerySyncClient(ip, batch_port)
+                    .FindBatch(batch, response);
+
+  ASSERT_TRUE(status.ok());
+  ASSERT_EQ(3, response.responses_size());
+  for (int i = 0; i < response.responses_size(); ++i) {
+    auto hash = shared_model::crypto::DefaultHashProvider::makeHash(
+        shared_model::proto::makeBlob(batch.payload().queries(i)));
+    EXPECT_EQ(hash.hex(), response.responses(i).query_hash());
+  }
+}
+
+/**
+ * @given batch whose queries have different creators
+ * @and batch whose signature does not match its payload
+ * @when the batches are executed by FindBatch
+ * @then they are rejected without execution
+ */
+TEST_F(ToriiQueryBatchTest, FindBatchRejectsInvalidBatch) {
+  EXPECT_CALL(*query_processor, queryBatchHandle(_)).Times(0);
+  auto client = torii_utils::QuerySyncClient(ip, batch_port);
+
+  auto mixed = makeBatch("user@domain", 2);
+  *mixed.mutable_payload()->add_queries() =
+      makeBatch("admin@domain", 1).payload().queries(0);
+  iroha::protocol::QueryBatchResponse response;
+  EXPECT_EQ(grpc::StatusCode::INVALID_ARGUMENT,
+            client.FindBatch(mixed, response).error_code());
+
+  auto forged = makeBatch("user@domain", 2);
+  forged.mutable_payload()->mutable_queries(0)->mutable_meta()
+      ->set_query_counter(10);
+  EXPECT_EQ(grpc::StatusCode::UNAUTHENTICATED,
+            client.FindBatch(forged, response).error_code());
+}
@@ -21,11 +21,14 @@
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory_impl.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
+#include "main/server_runner.hpp"
 #include "module/irohad/network/network_mocks.hpp"
 #include "module/irohad/torii/torii_mocks.hpp"
 #include "module/shared_model/interface/mock_transaction_batch_factory.hpp"
 #include "module/shared_model/validators/validators.hpp"
 #include "module/vendor/grpc_mocks.hpp"
+#include "network/impl/grpc_channel_builder.hpp"
+#include "torii/command_client.hpp"
 #include "torii/impl/status_bus_impl.hpp"
 #include "validators/protobuf/proto_transaction_validator.hpp"
 
@@ -140,6 +143,37 @@ TEST_F(CommandServiceTransportGrpcTest, Status) {
             iroha::protocol::TxStatus::ENOUGH_SIGNATURES_COLLECTED);
 }
 
+/**
+ * @given torii service
+ * @when the statuses of several transactions are requested at once
+ * @then the statuses of all transactions are returned in the requested order
+ */
+TEST_F(CommandServiceTransportGrpcTest, StatusList) {
+  grpc::ServerContext context;
+
+  const shared_model::crypto::Hash hash1(std::string(kHashLength, '1'));
+  const shared_model::crypto::Hash hash2(std::string(kHashLength, '2'));
+  iroha::protocol::TxStatusListRequest request;
+  request.add_tx_hashes(hash1.hex());
+  request.add_tx_hashes(hash2.hex());
+
+  std::vector<std::shared_ptr<shared_model::interface::TransactionResponse>>
+      responses{status_factory->makeEnoughSignaturesCollected(hash1, {}),
+                status_factory->makeCommitted(hash2, {})};
+  std::vector<shared_model::crypto::Hash> hashes{hash1, hash2};
+  EXPECT_CALL(*command_service, getStatuses(hashes))
+      .WillOnce(Return(responses));
+
+  iroha::protocol::TxStatusList statuses;
+  transport_grpc->StatusList(&context, &request, &statuses);
+
+  ASSERT_EQ(2, statuses.statuses_size());
+  EXPECT_EQ(iroha::protocol::TxStatus::ENOUGH_SIGNATURES_COLLECTED,
+            statuses.statuses(0).tx_status());
+  EXPECT_EQ(iroha::protocol::TxStatus::COMMITTED,
+            statuses.statuses(1).tx_status());
+}
+
 /**
  * @given torii service and number of transactions
  * @when calling ListTorii
@@ -170,6 +204,46 @@ TEST_F(CommandServiceTransportGrpcTest, ListTorii) {
   transport_grpc->ListTorii(&context, &request, &response);
 }
 
+/**
+ * @given torii service and number of transactions
+ * @when the transactions are sent by TransactionStream
+ * @then ensure that CommandService called handleTransactionBatch as the tx num
+ */
+TEST_F(CommandServiceTransportGrpcTest, TransactionStream) {
+  EXPECT_CALL(*proto_tx_validator, validate(_))
+      .Times(kTimes)
+      .WillRepeatedly(Return(shared_model::validation::Answer{}));
+  EXPECT_CALL(*tx_validator, validate(_))
+      .Times(kTimes)
+      .WillRepeatedly(Return(shared_model::validation::Answer{}));
+  EXPECT_CALL(
+      *batch_factory,
+      createTransactionBatch(
+          A<const shared_model::interface::types::SharedTxsCollectionType &>()))
+      .Times(kTimes);
+  EXPECT_CALL(*command_service, handleTransactionBatch(_)).Times(kTimes);
+
+  iroha::network::ServerRunner runner("127.0.0.1:0",
+                                      getTestLogger("ServerRunner"));
+  int port = 0;
+  runner.append(transport_grpc)
+      .run()
+      .match([&port](auto value) { port = value.value; },
+             [](const auto &error) { FAIL() << error.error; });
+  runner.waitForServersReady();
+
+  auto stub = iroha::network::createClient<iroha::protocol::CommandService_v1>(
+      "127.0.0.1:" + std::to_string(port));
+  grpc::ClientContext context;
+  google::protobuf::Empty response;
+  auto writer = stub->TransactionStream(&context, &response);
+  for (size_t i = 0; i < kTimes; ++i) {
+    ASSERT_TRUE(writer->Write(iroha::protocol::Transaction{}));
+  }
+  writer->WritesDone();
+  ASSERT_TRUE(writer->Finish().ok());
+}
+
 /**
  * @given torii service and number of invalid transactions
  * @when calling ListTorii
@@ -294,3 +368,129 @@ TEST_F(CommandServiceTransportGrpcTest, StatusStreamOnNotReceived) {
                           &response_writer))
                   .ok());
 }
+
+/**
+ * @given torii service and a status stream of a committed transaction
+ * @when calling StatusStream with the final only coalescing
+ * @then only the committed status is written
+ */
+TEST_F(CommandServiceTransportGrpcTest, StatusStreamFinalOnly) {
+  grpc::ServerContext context;
+  iroha::protocol::TxStatusRequest request;
+  request.set_coalescing(iroha::protocol::TxStatusRequest::FINAL_ONLY);
+  iroha::MockServerWriter<iroha::protocol::ToriiResponse> response_writer;
+
+  shared_model::crypto::Hash hash("1");
+  std::vector<std::shared_ptr<shared_model::interface::TransactionResponse>>
+      responses{status_factory->makeStatelessValid(hash),
+                status_factory->makeStatefulValid(hash),
+                status_factory->makeCommitted(hash)};
+  EXPECT_CALL(*command_service, getStatusStream(_))
+      .WillOnce(Return(rxcpp::observable<>::iterate(responses)));
+  EXPECT_CALL(response_writer,
+              Write(Property(&iroha::protocol::ToriiResponse::tx_status,
+                             iroha::protocol::TxStatus::COMMITTED),
+                    _))
+      .WillOnce(Return(true));
+
+  ASSERT_TRUE(transport_grpc
+                  ->StatusStream(
+                      &context,
+                      &request,
+                      reinterpret_cast<
+                          grpc::ServerWriter<iroha::protocol::ToriiResponse> *>(
+                          &response_writer))
+                  .ok());
+}
+
+/**
+ * @given torii service and a status stream of several changes of the status
+ * @when calling StatusStream with the minimal interval longer than the stream
+ * @then the first status is written at once
+ * @and the last one is written when the stream completes, while the changes
+ * between them are not written
+ */
+TEST_F(CommandServiceTransportGrpcTest, StatusStreamMinInterval) {
+  grpc::ServerContext context;
+  iroha::protocol::TxStatusRequest request;
+  request.set_min_interval_ms(3600 * 1000);
+  iroha::MockServerWriter<iroha::protocol::ToriiResponse> response_writer;
+
+  shared_model::crypto::Hash hash("1");
+  std::vector<std::shared_ptr<shared_model::interface::TransactionResponse>>
+      responses{status_factory->makeStatelessValid(hash),
+                status_factory->makeMstPending(hash),
+                status_factory->makeEnoughSignaturesCollected(hash)};
+  EXPECT_CALL(*command_service, getStatusStream(_))
+      .WillOnce(Return(rxcpp::observable<>::iterate(responses)));
+  ::testing::InSequence sequence;
+  EXPECT_CALL(
+      response_writer,
+      Write(Property(&iroha::protocol::ToriiResponse::tx_status,
+                     iroha::protocol::TxStatus::STATELESS_VALIDATION_SUCCESS),
+            _))
+      .WillOnce(Return(true));
+  EXPECT_CALL(
+      response_writer,
+      Write(Property(&iroha::protocol::ToriiResponse::tx_status,
+                     iroha::protocol::TxStatus::ENOUGH_SIGNATURES_COLLECTED),
+            _))
+      .WillOnce(Return(true));
+
+  ASSERT_TRUE(transport_grpc
+                  ->StatusStream(
+                      &context,
+                      &request,
+                      reinterpret_cast<
+                          grpc::ServerWriter<iroha::protocol::ToriiResponse> *>(
+                          &response_writer))
+                  .ok());
+}
+
+/**
+ * @given torii service handling the status streams asynchronously
+ *        and a status stream with one NotReceived status
+ * @when a client calls StatusStream
+ * @then the client receives the status and the stream is finished
+ */
+TEST_F(CommandServiceTransportGrpcTest, AsyncStatusStream) {
+  auto async_transport = std::make_shared<CommandServiceTransportGrpc>(
+      command_service,
+      status_bus,
+      status_factory,
+      transaction_factory,
+      batch_parser,
+      batch_factory,
+      rxcpp::observable<>::iterate(gate_objects),
+      gate_objects.size(),
+      getTestLogger("CommandServiceTransportGrpc"),
+      true);
+
+  std::vector<std::shared_ptr<shared_model::interface::TransactionResponse>>
+      responses;
+  shared_model::crypto::Hash hash("1");
+  responses.emplace_back(status_factory->makeNotReceived(hash, {}));
+  EXPECT_CALL(*command_service, getStatusStream(_))
+      .WillOnce(Return(rxcpp::observable<>::iterate(responses)));
+
+  iroha::network::ServerRunner runner("127.0.0.1:0",
+                                      getTestLogger("ServerRunner"));
+  int port = 0;
+  runner.append(async_transport)
+      .run()
+      .match([&port](auto value) { port = value.value; },
+             [](const auto &error) { FAIL() << error.error; });
+  runner.waitForServersReady();
+
+  torii::CommandSyncClient client(
+      iroha::network::createClient<iroha::protocol::CommandService_v1>(
+          "127.0.0.1:" + std::to_string(port)),
+      getTestLogger("CommandSyncClient"));
+  iroha::protocol::TxStatusRequest request;
+  request.set_tx_hash(hash.hex());
+  std::vector<iroha::protocol::ToriiResponse> statuses;
+  client.StatusStream(request, statuses);
+
+  ASSERT_EQ(1, statuses.size());
+  EXPECT_EQ(hash.hex(), statuses.front().tx_hash());
+}
@@ -132,3 +132,32 @@ TEST_F(ChainValidationTest, FailWhenNoSupermajority) {
   ASSERT_FALSE(validator->validateAndApply(blocks, *storage));
   ASSERT_EQ(boost::size(block->signatures()), block_signatures_amount);
 }
+
+/**
+ * @given validator verifying the signatures on a worker thread
+ * @and block signed by peers with invalid signatures
+ * @when apply block
+ * @then block is not validated before checking its peers
+ */
+TEST_F(ChainValidationTest, FailWhenInvalidSignatures) {
+  validator = std::make_shared<ChainValidatorImpl>(
+      supermajority_checker, getTestLogger("ChainValidator"), 1);
+  EXPECT_CALL(static_cast<MockSignature &>(*signatures.front()), signedData())
+      .WillRepeatedly(ReturnRefOfCopy(
+          shared_model::crypto::Signed(std::string(64, '0'))));
+
+  EXPECT_CALL(*supermajority_checker, hasSupermajority(_, _)).Times(0);
+
+  EXPECT_CALL(*storage, apply(_, _))
+      .WillOnce(testing::Invoke([&](auto verified_blocks, auto predicate) {
+        bool applied = true;
+        verified_blocks.as_blocking().subscribe([&](auto verified_block) {
+          applied = applied
+              and predicate(verified_block,
+                            LedgerState{peers, prev_height, prev_hash});
+        });
+        return applied;
+      }));
+
+  ASSERT_FALSE(validator->validateAndApply(blocks, *storage));
+}
@@ -13,7 +13,6 @@
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
 #include "framework/test_logger.hpp"
 #include "interfaces/iroha_internal/batch_meta.hpp"
-#include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
 #include "interfaces/transaction.hpp"
 #include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
 #include "module/irohad/common/validators_config.hpp"
@@ -103,12 +102,8 @@ class Validator : public testing::Test {
     factory = std::make_unique<shared_model::proto::ProtoProposalFactory<
         shared_model::validation::DefaultProposalValidator>>(
         iroha::test::kTestsValidatorsConfig);
-    parser =
-        std::make_shared<shared_model::interface::TransactionBatchParserImpl>();
     sfv = std::make_shared<StatefulValidatorImpl>(
-        std::move(factory),
-        std::move(parser),
-        getTestLogger("StatefulValidator"));
+        std::move(factory), getTestLogger("StatefulValidator"));
     temp_wsv_mock = std::make_shared<iroha::ametsuchi::MockTemporaryWsv>();
   }
 
@@ -143,7 +138,6 @@ class Validator : public testing::Test {
   std::shared_ptr<StatefulValidator> sfv;
   std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory;
   std::shared_ptr<iroha::ametsuchi::MockTemporaryWsv> temp_wsv_mock;
-  std::shared_ptr<shared_model::interface::TransactionBatchParser> parser;
 
   const uint32_t sample_error_code = 2;
   const std::string sample_error_extra = "account_id: doge@account";
@@ -340,3 +334,68 @@ TEST_F(Validator, Batches) {
   EXPECT_EQ(verified_proposal_and_errors->rejected_transactions[1].tx_hash,
             txs[4].hash());
 }
+
+/**
+ * @given an atomic batch with a transfer A->B @and independent transfers B->C
+ * and D->E, the first of which depends on the batch
+ * @when statefully validating them with the worker WSVs
+ * @then the independent transfers are validated on the WSV of the proposal,
+ * which contains the changes of the batch, @and no worker WSV is created
+ */
+TEST_F(Validator, IndependentTxsAfterAtomicBatch) {
+  auto created_time = iroha::time::now();
+  auto transfer = [&created_time](const std::string &src,
+                                  const std::string &dest) {
+    return TestTransactionBuilder()
+        .creatorAccountId(src)
+        .createdTime(created_time++)
+        .quorum(1)
+        .transferAsset(src, dest, "coin#domain", "", "1.0");
+  };
+  auto batch_tx = transfer("a@domain", "b@domain");
+  auto batch_hash = batch_tx.build().reducedHash();
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(
+      batch_tx
+          .batchMeta(shared_model::interface::types::BatchType::ATOMIC,
+                     {batch_hash})
+          .build());
+  txs.push_back(transfer("b@domain", "c@domain").build());
+  txs.push_back(transfer("d@domain", "e@domain").build());
+
+  auto proposal = TestProposalBuilder()
+                      .createdTime(iroha::time::now())
+                      .height(1)
+                      .transactions(txs)
+                      .build();
+
+  size_t worker_wsvs = 0;
+  sfv = std::make_shared<StatefulValidatorImpl>(
+      std::make_unique<shared_model::proto::ProtoProposalFactory<
+          shared_model::validation::DefaultProposalValidator>>(
+          iroha::test::kTestsValidatorsConfig),
+      getTestLogger("StatefulValidator"),
+      [&worker_wsvs]() -> std::unique_ptr<iroha::ametsuchi::TemporaryWsv> {
+        ++worker_wsvs;
+        return std::make_unique<iroha::ametsuchi::MockTemporaryWsv>();
+      },
+      2);
+
+  EXPECT_CALL(*temp_wsv_mock, createSavepoint("batch_" + txs[0].hash().hex()))
+      .WillOnce(Return(
+          ByMove(std::make_unique<
+                 iroha::ametsuchi::MockTemporaryWsvSavepointWrapper>())));
+  EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(txs[0]))))
+      .WillOnce(Return(iroha::expected::Value<void>({})));
+  EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(txs[1]))))
+      .WillOnce(Return(iroha::expected::Value<void>({})));
+  EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(txs[2]))))
+      .WillOnce(Return(iroha::expected::Value<void>({})));
+
+  auto verified_proposal_and_errors = sfv->validate(proposal, *temp_wsv_mock);
+  EXPECT_EQ(worker_wsvs, 0);
+  ASSERT_EQ(
+      verified_proposal_and_errors->verified_proposal->transactions().size(),
+      3);
+  ASSERT_TRUE(verified_proposal_and_errors->rejected_transactions.empty());
+}
@@ -0,0 +1,103 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validation/impl/transaction_conflicts.hpp"
+
+#include <gtest/gtest.h>
+#include "datetime/time.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::validation;
+
+class TransactionConflictsTest : public testing::Test {
+ public:
+  auto transfer(const std::string &src, const std::string &dest) {
+    return TestTransactionBuilder()
+        .creatorAccountId(src)
+        .createdTime(created_time++)
+        .transferAsset(src, dest, "coin#domain", "", "1.0")
+        .build();
+  }
+
+  auto setDetail(const std::string &creator, const std::string &account) {
+    return TestTransactionBuilder()
+        .creatorAccountId(creator)
+        .createdTime(created_time++)
+        .setAccountDetail(account, "key", "value")
+        .build();
+  }
+
+  auto setQuorum(const std::string &account) {
+    return TestTransactionBuilder()
+        .creatorAccountId(account)
+        .createdTime(created_time++)
+        .setAccountQuorum(account, 2)
+        .build();
+  }
+
+  template <typename... Transactions>
+  auto partition(const Transactions &... transactions) {
+    return partitionConflictingTransactions(
+        iroha::ametsuchi::TemporaryWsv::TransactionRefs{transactions...});
+  }
+
+  uint64_t created_time = iroha::time::now();
+};
+
+/**
+ * @given transfers between disjoint pairs of accounts
+ * @when the transactions are partitioned
+ * @then every transfer is in its own group
+ */
+TEST_F(TransactionConflictsTest, DisjointTransfers) {
+  auto tx1 = transfer("a@domain", "b@domain");
+  auto tx2 = transfer("c@domain", "d@domain");
+  auto tx3 = transfer("e@domain", "f@domain");
+
+  std::vector<std::vector<size_t>> expected{{0}, {1}, {2}};
+  EXPECT_EQ(expected, partition(tx1, tx2, tx3));
+}
+
+/**
+ * @given transfers, two of which change the balance of the same account
+ * @when the transactions are partitioned
+ * @then the transfers sharing the account are in one group in their order
+ */
+TEST_F(TransactionConflictsTest, SharedBalance) {
+  auto tx1 = transfer("a@domain", "b@domain");
+  auto tx2 = transfer("c@domain", "d@domain");
+  auto tx3 = transfer("b@domain", "e@domain");
+
+  std::vector<std::vector<size_t>> expected{{0, 2}, {1}};
+  EXPECT_EQ(expected, partition(tx1, tx2, tx3));
+}
+
+/**
+ * @given a transaction reading an account and a later one changing its
+ * quorum, and details set on the accounts read by no other transaction
+ * @when the transactions are partitioned
+ * @then the reading and the writing transactions are in one group
+ */
+TEST_F(TransactionConflictsTest, ReadBeforeWrite) {
+  auto tx1 = setDetail("a@domain", "b@domain");
+  auto tx2 = setDetail("c@domain", "c@domain");
+  auto tx3 = setQuorum("b@domain");
+
+  std::vector<std::vector<size_t>> expected{{0, 2}, {1}};
+  EXPECT_EQ(expected, partition(tx1, tx2, tx3));
+}
+
+/**
+ * @given transactions which only read the same accounts
+ * @when the transactions are partitioned
+ * @then they are in separate groups
+ */
+TEST_F(TransactionConflictsTest, SharedReads) {
+  auto tx1 = setDetail("a@domain", "b@domain");
+  auto tx2 = setDetail("a@domain", "c@domain");
+
+  std::vector<std::vector<size_t>> expected{{0}, {1}};
+  EXPECT_EQ(expected, partition(tx1, tx2));
+}
@@ -0,0 +1,49 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validation/validation_pool.hpp"
+
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace iroha::validation;
+
+/**
+ * @given pool of several workers
+ * @when a collection is mapped
+ * @then results are in the order of the collection
+ */
+TEST(ValidationPoolTest, MapKeepsOrder) {
+  ValidationPool pool(4);
+  const size_t kSize = 1000;
+
+  auto results = pool.map(kSize, [](size_t i) { return i * i; });
+
+  ASSERT_EQ(kSize, results.size());
+  for (size_t i = 0; i < kSize; ++i) {
+    EXPECT_EQ(i * i, results[i]);
+  }
+}
+
+/**
+ * @given pool of a single worker
+ * @when a collection is mapped
+ * @then every element is processed on the calling thread
+ */
+TEST(ValidationPoolTest, SingleWorkerUsesCallingThread) {
+  ValidationPool pool(1);
+  std::mutex mutex;
+  std::set<std::thread::id> threads;
+
+  pool.parallelFor(100, [&](size_t) {
+    std::lock_guard<std::mutex> lock(mutex);
+    threads.insert(std::this_thread::get_id());
+  });
+
+  EXPECT_EQ(std::set<std::thread::id>{std::this_thread::get_id()}, threads);
+}
@@ -0,0 +1,149 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "cache/sharded_cache.hpp"
+
+using namespace iroha::cache;
+
+/**
+ * @given full clock cache, one item of which has been found
+ * @when a new item is inserted
+ * @then the found item stays in the cache, and the oldest of the other ones
+ * are evicted until the low limit
+ */
+TEST(ClockCacheTest, KeepsRecentlyFound) {
+  ClockCache<int, int> cache(4, 2);
+  for (int i = 0; i < 4; ++i) {
+    cache.addItem(i, i);
+  }
+  ASSERT_EQ(0, *cache.findItem(0));
+
+  cache.addItem(4, 4);
+
+  ASSERT_EQ(cache.getIndexSizeLow(), cache.getCacheItemCount());
+  EXPECT_EQ(0, *cache.findItem(0));
+  EXPECT_FALSE(cache.findItem(1));
+  EXPECT_FALSE(cache.findItem(2));
+}
+
+/**
+ * @given clock cache
+ * @when an item is inserted with the key of a cached one
+ * @then the value is replaced and the amount of items does not change
+ */
+TEST(ClockCacheTest, InsertSameKey) {
+  ClockCache<int, int> cache(4, 2);
+  cache.addItem(1, 1);
+  cache.addItem(1, 2);
+
+  ASSERT_EQ(1, cache.getCacheItemCount());
+  ASSERT_EQ(2, *cache.findItem(1));
+}
+
+/**
+ * @given clock cache
+ * @when more items than the high limit are inserted many times
+ * @then the amount of items never exceeds the high limit, and the last
+ * inserted item is found
+ */
+TEST(ClockCacheTest, ReusesSlots) {
+  ClockCache<int, int> cache(8, 4);
+  for (int i = 0; i < 100; ++i) {
+    cache.addItem(i, i);
+    ASSERT_LE(cache.getCacheItemCount(), cache.getIndexSizeHigh());
+    ASSERT_EQ(i, *cache.findItem(i));
+  }
+}
+
+/**
+ * @given sharded cache
+ * @when more items than the high limit are inserted
+ * @then the amount of items does not exceed the high limit
+ * @and the cached items are found
+ */
+TEST(ShardedCacheTest, InsertMoreThanLimit) {
+  ShardedCache<int, int> cache(64, 32, 4);
+  for (int i = 0; i < 1000; ++i) {
+    cache.addItem(i, i);
+  }
+  ASSERT_LE(cache.getCacheItemCount(), cache.getIndexSizeHigh());
+  ASSERT_EQ(999, *cache.findItem(999));
+}
+
+/**
+ * @given sharded cache
+ * @when several threads insert and find items concurrently
+ * @then every thread finds the items it has just inserted
+ */
+TEST(ShardedCacheTest, ConcurrentAccess) {
+  constexpr int kThreads = 4;
+  constexpr int kItems = 10000;
+  // the limits leave room for uneven shards, so nothing is evicted
+  ShardedCache<int, int> cache(kThreads * kItems * 2, kThreads * kItems);
+  std::vector<std::thread> threads;
+  std::atomic<int> found{0};
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&cache, &found, t] {
+      for (int i = 0; i < kItems; ++i) {
+        auto key = t * kItems + i;
+        cache.addItem(key, key);
+        if (cache.findItem(key) == key) {
+          ++found;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(kThreads * kItems, found);
+}
+
+/**
+ * @given full clock cache
+ * @when its limit is lowered and then restored
+ * @then the items over the lowered limit are evicted, the low limit is scaled
+ * along, and the restored limit does not exceed the constructed one
+ */
+TEST(ClockCacheTest, LimitItems) {
+  ClockCache<int, int> cache(8, 4);
+  for (int i = 0; i < 8; ++i) {
+    cache.addItem(i, i);
+  }
+
+  cache.limitItems(2);
+  ASSERT_EQ(2, cache.getCacheItemCount());
+  ASSERT_EQ(2, cache.getIndexSizeHigh());
+  ASSERT_EQ(1, cache.getIndexSizeLow());
+
+  cache.limitItems(100);
+  ASSERT_EQ(8, cache.getIndexSizeHigh());
+  ASSERT_EQ(4, cache.getIndexSizeLow());
+}
+
+/**
+ * @given sharded cache filled with the items owning heap memory
+ * @when its memory is limited to a half of the used one
+ * @then the cache takes at most the limited memory
+ */
+TEST(ShardedCacheTest, LimitMemory) {
+  const size_t kItemHeapBytes = 100;
+  ShardedCache<int, int> cache(1000, 900, 4);
+  for (int i = 0; i < 1000; ++i) {
+    cache.addItem(i, i);
+  }
+  auto usage = cache.memoryUsage(kItemHeapBytes);
+  ASSERT_GT(usage, cache.memoryUsage());
+
+  cache.limitMemory(usage / 2, kItemHeapBytes);
+
+  ASSERT_LE(cache.memoryUsage(kItemHeapBytes), usage / 2);
+  ASSERT_GT(cache.getCacheItemCount(), 0);
+}
@@ -0,0 +1,88 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/allocation_tracking.hpp"
+
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace iroha;
+
+/**
+ * @given allocations made under nested tags
+ * @when the counters are read
+ * @then every allocation is attributed to the innermost tag of its scope, and
+ * nothing is counted if the build does not track the allocations
+ */
+TEST(AllocationTrackingTest, CountsAllocationsOfInnermostTag) {
+  auto mst = allocationCounters(AllocationTag::kMst);
+  auto torii = allocationCounters(AllocationTag::kTorii);
+  {
+    ScopedAllocationTag tag(AllocationTag::kMst);
+    auto outer = std::make_unique<char[]>(100);
+    {
+      ScopedAllocationTag inner(AllocationTag::kTorii);
+      auto first = std::make_unique<char[]>(10);
+      auto second = std::make_unique<char[]>(10);
+    }
+    auto after_inner = std::make_unique<char[]>(50);
+  }
+  auto mst_made = allocationCounters(AllocationTag::kMst);
+  auto torii_made = allocationCounters(AllocationTag::kTorii);
+
+  if (kAllocationTracking) {
+    EXPECT_EQ(mst_made.allocations - mst.allocations, 2);
+    EXPECT_EQ(mst_made.bytes - mst.bytes, 150);
+    EXPECT_EQ(torii_made.allocations - torii.allocations, 2);
+    EXPECT_EQ(torii_made.bytes - torii.bytes, 20);
+  } else {
+    EXPECT_EQ(mst_made.allocations, 0);
+    EXPECT_EQ(torii_made.allocations, 0);
+  }
+}
+
+/**
+ * @given a tag set on another thread
+ * @when the current thread allocates
+ * @then the allocations are not attributed to the tag, and are counted for the
+ * current thread only
+ */
+TEST(AllocationTrackingTest, TagsAndCountersArePerThread) {
+  auto mst = allocationCounters(AllocationTag::kMst);
+  AllocationCounters other_thread;
+  std::thread([&other_thread] {
+    ScopedAllocationTag tag(AllocationTag::kMst);
+    auto before = threadAllocationCounters();
+    auto data = std::make_unique<char[]>(8);
+    auto after = threadAllocationCounters();
+    other_thread.allocations = after.allocations - before.allocations;
+  }).join();
+  auto before = threadAllocationCounters();
+  auto data = std::make_unique<char[]>(8);
+  auto after = threadAllocationCounters();
+
+  if (kAllocationTracking) {
+    EXPECT_EQ(other_thread.allocations, 1);
+    EXPECT_EQ(after.allocations - before.allocations, 1);
+    EXPECT_EQ(allocationCounters(AllocationTag::kMst).allocations
+                  - mst.allocations,
+              1);
+  } else {
+    EXPECT_EQ(after.allocations, 0);
+  }
+}
+
+/**
+ * @given the tags
+ * @when their names are requested
+ * @then the names used as the metric labels are returned
+ */
+TEST(AllocationTrackingTest, TagNames) {
+  EXPECT_STREQ(allocationTagName(AllocationTag::kOther), "other");
+  EXPECT_STREQ(allocationTagName(AllocationTag::kConsensus), "consensus");
+  EXPECT_STREQ(allocationTagName(AllocationTag::kMst), "mst");
+}
@@ -242,6 +242,22 @@ TEST(ResultTest, MapErrorBlank) {
              makeFailCase<Error<int>>(kErrorCaseMessage));
 }
 
+/**
+ * @given Result with a move-only value
+ * @when the value is converted to another value type and then bound with
+ * the rvalue bind operator
+ * @then the value is moved through the chain without copies
+ */
+TEST(ResultTest, MoveOnlyValueChain) {
+  Result<std::unique_ptr<const int>, std::string> result =
+      Value<std::unique_ptr<int>>(std::make_unique<int>(5));
+  auto chained = std::move(result) | [](std::unique_ptr<const int> p) {
+    return *p * 2;
+  };
+  chained.match([](const auto &v) { ASSERT_EQ(10, v.value); },
+                makeFailCase<Error<std::string>>(kErrorCaseMessage));
+}
+
 /// Polymorphic result tests
 
 /// Base and Derived are classes, which can be used to test polymorphic behavior
@@ -0,0 +1,102 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/stage_executor.hpp"
+
+#include <future>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace iroha;
+
+/**
+ * @given stage executor with a queue of two tasks, which runs a blocked task
+ * @when a producer posts three more tasks
+ * @then the third post waits till the stage takes a task from the queue
+ * @and the tasks run in the order they are posted
+ */
+TEST(StageExecutorTest, ProducerWaitsForFullQueue) {
+  StageExecutor executor("test-stage", 2);
+  std::promise<void> unblock;
+  auto blocked = unblock.get_future().share();
+  std::promise<void> started;
+  std::vector<int> order;
+  executor.post([blocked, &started] {
+    started.set_value();
+    blocked.wait();
+  });
+  started.get_future().wait();
+
+  auto producer = std::async(std::launch::async, [&] {
+    for (int i = 0; i < 3; ++i) {
+      executor.post([&order, i] { order.push_back(i); });
+    }
+  });
+  EXPECT_EQ(producer.wait_for(std::chrono::milliseconds(100)),
+            std::future_status::timeout);
+  EXPECT_EQ(executor.depth(), 2);
+  EXPECT_EQ(executor.blockedPosts().value(), 1);
+
+  unblock.set_value();
+  producer.wait();
+  std::promise<void> done;
+  executor.post([&done] { done.set_value(); });
+  done.get_future().wait();
+  EXPECT_EQ(order, (std::vector<int>{0, 1, 2}));
+  // the time of the last task is observed after it completes the promise
+  EXPECT_EQ(executor.waitTime().count(), 5);
+  EXPECT_GE(executor.runTime().count(), 4);
+}
+
+/**
+ * @given stage executor with a queue of one task
+ * @when a task of the stage posts more tasks than the queue has space for
+ * @then the stage does not wait for itself and runs all of them
+ */
+TEST(StageExecutorTest, StagePostsWithoutWaiting) {
+  StageExecutor executor("test-stage", 1);
+  std::promise<size_t> done;
+  size_t runs = 0;
+  executor.post([&] {
+    EXPECT_TRUE(executor.isStageThread());
+    for (int i = 0; i < 3; ++i) {
+      executor.post([&runs] { ++runs; });
+    }
+    executor.post([&] { done.set_value(runs); });
+  });
+  EXPECT_EQ(done.get_future().get(), 3);
+  EXPECT_FALSE(executor.isStageThread());
+  EXPECT_EQ(executor.blockedPosts().value(), 0);
+}
+
+/**
+ * @given stage executor
+ * @when a task is delayed and another one is posted after it
+ * @then the posted task runs first, the delayed one runs after its time
+ * @and the queued tasks run on destruction, while the delayed ones are
+ * dropped
+ */
+TEST(StageExecutorTest, DelaysTasks) {
+  std::vector<int> order;
+  std::promise<void> done;
+  {
+    StageExecutor executor("test-stage", 4);
+    auto start = StageExecutor::Clock::now();
+    executor.postAt(start + std::chrono::milliseconds(50), [&] {
+      EXPECT_GE(StageExecutor::Clock::now() - start,
+                std::chrono::milliseconds(50));
+      order.push_back(1);
+      done.set_value();
+    });
+    executor.post([&order] { order.push_back(0); });
+    done.get_future().wait();
+
+    executor.postAt(StageExecutor::Clock::now() + std::chrono::hours(1),
+                    [&order] { order.push_back(3); });
+    executor.post([&order] { order.push_back(2); });
+  }
+  EXPECT_EQ(order, (std::vector<int>{0, 1, 2}));
+}
@@ -0,0 +1,103 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/thread_placement.hpp"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <boost/optional/optional_io.hpp>
+#include "common/thread_name.hpp"
+
+using namespace iroha;
+
+namespace {
+  /// @return the CPUs of the valid list
+  CpuSet parse(const std::string &list) {
+    auto result = parseCpuList(list);
+    EXPECT_TRUE(expected::hasValue(result)) << list;
+    if (auto cpus = expected::resultToOptionalValue(std::move(result))) {
+      return *cpus;
+    }
+    return {};
+  }
+}  // namespace
+
+/**
+ * @given lists of CPUs with single CPUs, ranges, duplicates and any order
+ * @when they are parsed and formatted back
+ * @then the sorted sets of the CPUs are parsed and the ranges are formatted
+ */
+TEST(ThreadPlacementTest, ParsesCpuLists) {
+  EXPECT_EQ(parse("3"), (CpuSet{3}));
+  EXPECT_EQ(parse("8,0-2,10-11,1"), (CpuSet{0, 1, 2, 8, 10, 11}));
+  EXPECT_EQ(formatCpuList(parse("8,0-2,10-11,1")), "0-2,8,10-11");
+  EXPECT_EQ(formatCpuList(parse("4,6")), "4,6");
+}
+
+/**
+ * @given invalid lists of CPUs
+ * @when they are parsed
+ * @then the errors are returned
+ */
+TEST(ThreadPlacementTest, RejectsInvalidCpuLists) {
+  for (const auto &list :
+       {"", "a", "1,", ",1", "3-1", "1-", "1--2", "0 1", "99999"}) {
+    EXPECT_TRUE(expected::hasError(parseCpuList(list))) << list;
+  }
+}
+
+/**
+ * @given placement of the consensus subsystem on one of the CPUs the
+ * process may run on
+ * @when threads are named by consensus and by no subsystem
+ * @then the consensus thread is bound to the CPU and the other one is not
+ * @and the scoped placement binds the calling thread and its new threads
+ * till it is destroyed
+ */
+TEST(ThreadPlacementTest, BindsThreadsOfSubsystems) {
+  auto all_cpus = currentThreadCpus();
+  ASSERT_FALSE(all_cpus.empty());
+  CpuSet consensus_cpus{all_cpus.back()};
+  configureThreadPlacement({{placement::kConsensus, consensus_cpus}});
+
+  EXPECT_EQ(subsystemOfThread("yac-timer"),
+            std::string(placement::kConsensus));
+  EXPECT_EQ(subsystemOfThread("grpc-cq-0"), boost::none);
+
+  CpuSet yac_cpus, other_cpus, inherited_cpus;
+  std::thread([&] {
+    setThreadName("yac");
+    yac_cpus = currentThreadCpus();
+  }).join();
+  std::thread([&] {
+    setThreadName("other");
+    other_cpus = currentThreadCpus();
+  }).join();
+  EXPECT_EQ(yac_cpus, consensus_cpus);
+  EXPECT_EQ(other_cpus, all_cpus);
+
+  {
+    ScopedThreadPlacement scoped(placement::kConsensus);
+    EXPECT_EQ(currentThreadCpus(), consensus_cpus);
+    std::thread([&] { inherited_cpus = currentThreadCpus(); }).join();
+  }
+  EXPECT_EQ(inherited_cpus, consensus_cpus);
+  EXPECT_EQ(currentThreadCpus(), all_cpus);
+  configureThreadPlacement({});
+}
+
+/**
+ * @given sets of CPUs
+ * @when they are split into parts
+ * @then the parts are of adjacent CPUs and of nearly equal sizes
+ * @and the parts share the CPUs if there are less of them than parts
+ */
+TEST(ThreadPlacementTest, SplitsCpus) {
+  EXPECT_EQ(splitCpus({0, 1, 2, 3, 4, 5, 6}, 3),
+            (std::vector<CpuSet>{{0, 1, 2}, {3, 4}, {5, 6}}));
+  EXPECT_EQ(splitCpus({4, 5}, 3), (std::vector<CpuSet>{{4}, {5}, {4}}));
+  EXPECT_EQ(splitCpus({}, 2), (std::vector<CpuSet>{{}, {}}));
+}
@@ -3,6 +3,11 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
+#include <sstream>
+
 #include <gtest/gtest.h>
 #include "common/byteutils.hpp"
 
@@ -54,3 +59,43 @@ TEST(StringConverterTest, ConvertHexToBinaryAndBack) {
   ASSERT_EQ(ss.str(),
             bytestringToHexstring(hexstringToBytestring(ss.str()).value()));
 }
+
+/**
+ * @given byte strings of the lengths around the widths of the vector
+ * registers
+ * @when they are converted to hex strings and back
+ * @then the hex strings match the ones of the stream formatting
+ * @and both cases of the hex digits are decoded
+ */
+TEST(StringConverterTest, ConvertLongStrings) {
+  for (size_t size = 1; size < 100; ++size) {
+    std::string bin;
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0');
+    for (size_t i = 0; i < size; ++i) {
+      bin.push_back(static_cast<char>(i * 37 + size));
+      ss << std::setw(2) << (static_cast<int>(bin.back()) & 0xff);
+    }
+    auto hex = bytestringToHexstring(bin);
+    ASSERT_EQ(ss.str(), hex) << size;
+    ASSERT_EQ(bin, hexstringToBytestring(hex).value()) << size;
+    std::transform(hex.begin(), hex.end(), hex.begin(), ::toupper);
+    ASSERT_EQ(bin, hexstringToBytestring(hex).value()) << size;
+  }
+}
+
+/**
+ * @given a long hex string
+ * @when any of its characters is replaced with a non hex digit
+ * @then boost::none is returned
+ */
+TEST(StringConverterTest, InvalidCharacterOfLongHex) {
+  const std::string hex(130, 'a');
+  for (size_t i = 0; i < hex.size(); ++i) {
+    for (char c : {'g', 'G', '/', ':', '@', '`', ' ', '\0', '\xe1'}) {
+      auto invalid = hex;
+      invalid[i] = c;
+      ASSERT_FALSE(hexstringToBytestring(invalid)) << i << " " << c;
+    }
+  }
+}
@@ -0,0 +1,80 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "backend/protobuf/json_proto_reader.hpp"
+
+#include <limits>
+
+#include <google/protobuf/util/json_util.h>
+#include <google/protobuf/util/message_differencer.h>
+#include <gtest/gtest.h>
+#include "block.pb.h"
+
+using namespace iroha;
+using namespace shared_model::proto;
+using google::protobuf::util::MessageDifferencer;
+
+class JsonProtoReaderTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    auto payload = block.mutable_block_v1()->mutable_payload();
+    payload->set_height(std::numeric_limits<uint64_t>::max());
+    payload->set_prev_block_hash("prev \"hash\"");
+    payload->add_rejected_transactions_hashes("rejected");
+    auto tx_payload = payload->add_transactions()->mutable_payload();
+    auto reduced_payload = tx_payload->mutable_reduced_payload();
+    reduced_payload->set_creator_account_id("account@domain");
+    reduced_payload->set_quorum(2);
+    auto create_role =
+        reduced_payload->add_commands()->mutable_create_role();
+    create_role->set_role_name("role");
+    create_role->add_permissions(protocol::RolePermission::can_add_peer);
+    create_role->add_permissions(protocol::RolePermission::can_transfer);
+    tx_payload->mutable_batch()->set_type(
+        protocol::Transaction::Payload::BatchMeta::ORDERED);
+    block.mutable_block_v1()->add_signatures()->set_signature("signature");
+  }
+
+  protocol::Block block;
+};
+
+/**
+ * @given a block printed to JSON with JSON or original field names
+ * @when the JSON is parsed
+ * @then the parsed block is equal to the original one
+ */
+TEST_F(JsonProtoReaderTest, RoundTrip) {
+  for (bool preserve_names : {false, true}) {
+    google::protobuf::util::JsonPrintOptions options;
+    options.preserve_proto_field_names = preserve_names;
+    std::string json;
+    ASSERT_TRUE(
+        google::protobuf::util::MessageToJsonString(block, &json, options)
+            .ok());
+
+    protocol::Block parsed;
+    auto result = parseJson(json, parsed);
+    ASSERT_FALSE(expected::hasError(result))
+        << expected::resultToOptionalError(result).value();
+    EXPECT_TRUE(MessageDifferencer::Equals(block, parsed));
+  }
+}
+
+/**
+ * @given JSON not matching the block schema
+ * @when the JSON is parsed
+ * @then an error is returned
+ */
+TEST_F(JsonProtoReaderTest, InvalidJson) {
+  for (std::string json : {R"({"blockV1":{"unknown":1}})",
+                           R"({"blockV1":{"payload":{"height":"-1"}}})",
+                           R"({"blockV1":{"payload":{"height":"one"}}})",
+                           R"({"blockV1":1})",
+                           R"([{"blockV1":{}}])",
+                           R"({"blockV1":{})"}) {
+    protocol::Block parsed;
+    EXPECT_TRUE(expected::hasError(parseJson(json, parsed))) << json;
+  }
+}
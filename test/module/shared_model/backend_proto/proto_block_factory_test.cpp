@@ -4,7 +4,9 @@
  */
 
 #include <gtest/gtest.h>
+#include <thread>
 
+#include "backend/protobuf/block.hpp"
 #include "backend/protobuf/proto_block_factory.hpp"
 #include "datetime/time.hpp"
 #include "module/shared_model/validators/validators.hpp"
@@ -50,3 +52,102 @@ TEST_F(ProtoBlockFactoryTest, UnsafeBlockCreation) {
   ASSERT_EQ(block->prevHash().hex(), prev_hash.hex());
   ASSERT_EQ(block->transactions(), txs);
 }
+
+/**
+ * @given serialized block
+ * @when the block is created from the serialized data
+ * @then it is the same as the original block @and garbage is not parsed
+ */
+TEST_F(ProtoBlockFactoryTest, CreateFromSerialized) {
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.emplace_back(iroha::protocol::Transaction{});
+  auto block = factory->unsafeCreateBlock(
+      1, crypto::Hash::fromHexString("123456"), iroha::time::now(), txs, {});
+  auto serialized = static_cast<const proto::Block &>(*block)
+                        .getTransport()
+                        .SerializeAsString();
+
+  auto parsed = iroha::expected::resultToOptionalValue(
+      factory->createBlock(serialized.data(), serialized.size()));
+
+  ASSERT_TRUE(parsed);
+  EXPECT_EQ(**parsed, *block);
+  EXPECT_EQ((*parsed)->transactions(), txs);
+
+  std::string garbage("\xff\xff\xff", 3);
+  EXPECT_TRUE(iroha::expected::hasError(
+      factory->createBlock(garbage.data(), garbage.size())));
+}
+
+/**
+ * @given block parsed into an arena
+ * @when another block is created of its transactions
+ * @then the transactions are referenced instead of being copied @and they
+ * outlive the parsed block
+ */
+TEST_F(ProtoBlockFactoryTest, ReferencesArenaTransactions) {
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.emplace_back(iroha::protocol::Transaction{});
+  auto serialized =
+      static_cast<const proto::Block &>(
+          *factory->unsafeCreateBlock(
+              1, crypto::Hash::fromHexString("123456"), 0, txs, {}))
+          .getTransport()
+          .SerializeAsString();
+  auto parsed = iroha::expected::resultToOptionalValue(
+      factory->createBlock(serialized.data(), serialized.size()));
+  ASSERT_TRUE(parsed);
+
+  auto block = factory->unsafeCreateBlock(
+      2, (*parsed)->hash(), 0, (*parsed)->transactions(), {});
+  auto transport = [](const interface::Transaction &tx) {
+    return &static_cast<const proto::Transaction &>(tx).getTransport();
+  };
+  EXPECT_EQ(transport(block->transactions().front()),
+            transport((*parsed)->transactions().front()));
+
+  parsed->reset();
+  EXPECT_EQ(block->transactions(), txs);
+}
+
+/**
+ * @given factory which serializes the transactions on several threads
+ * @when a block of many transactions is created
+ * @then the block is serialized and hashed the same as a block serialized
+ * by protobuf
+ */
+TEST_F(ProtoBlockFactoryTest, ParallelSerialization) {
+  proto::ProtoBlockFactory parallel_factory(
+      std::make_unique<validation::MockValidator<interface::Block>>(),
+      std::make_unique<validation::MockValidator<iroha::protocol::Block>>(),
+      [](size_t size, const std::function<void(size_t)> &f) {
+        std::thread half([&] {
+          for (size_t i = 0; i < size / 2; ++i) {
+            f(i);
+          }
+        });
+        for (size_t i = size / 2; i < size; ++i) {
+          f(i);
+        }
+        half.join();
+      });
+  std::vector<shared_model::proto::Transaction> txs;
+  for (int i = 0; i < 1000; ++i) {
+    iroha::protocol::Transaction tx;
+    tx.mutable_payload()->mutable_reduced_payload()->set_created_time(i);
+    txs.emplace_back(std::move(tx));
+  }
+  std::vector<shared_model::crypto::Hash> rejected_txs{
+      shared_model::crypto::Hash::fromHexString("rubble_devaluation")};
+
+  auto block = parallel_factory.unsafeCreateBlock(
+      1, crypto::Hash::fromHexString("123456"), 2, txs, rejected_txs);
+  // serialized by protobuf on the calling thread
+  proto::Block expected(
+      static_cast<const proto::Block &>(*block).getTransport());
+
+  EXPECT_EQ(block->payload(), expected.payload());
+  EXPECT_EQ(block->blob(), expected.blob());
+  EXPECT_EQ(block->hash(), expected.hash());
+  EXPECT_EQ(block->transactions(), txs);
+}
@@ -7,6 +7,7 @@
 
 #include "backend/protobuf/proto_proposal_factory.hpp"
 #include "backend/protobuf/transaction.hpp"
+#include "framework/batch_helper.hpp"
 #include "framework/result_fixture.hpp"
 #include "module/irohad/common/validators_config.hpp"
 #include "module/shared_model/validators/validators.hpp"
@@ -73,3 +74,91 @@ TEST_F(ProposalFactoryTest, InvalidProposalTest) {
   proposal.match([&](const auto &) { FAIL() << "unexpected value case"; },
                  [](const auto &) { SUCCEED(); });
 }
+
+/**
+ * @given transactions of two batches separated by a single transaction
+ * @when proposal is created of them
+ * @then its batch boundaries are the index ranges of the batches
+ */
+TEST_F(ProposalFactoryTest, BatchBoundaries) {
+  std::vector<proto::Transaction> txs;
+  auto add_batch = [&txs](auto type, uint32_t size) {
+    for (const auto &tx :
+         framework::batch::createUnsignedBatchTransactions(type, size)) {
+      txs.push_back(*std::static_pointer_cast<proto::Transaction>(tx));
+    }
+  };
+  add_batch(interface::types::BatchType::ATOMIC, 2);
+  txs.emplace_back(iroha::protocol::Transaction{});
+  add_batch(interface::types::BatchType::ORDERED, 3);
+
+  auto boundaries =
+      valid_factory.unsafeCreateProposal(height, time, txs)->batchBoundaries();
+
+  ASSERT_EQ(3, boundaries.size());
+  EXPECT_EQ(0, boundaries[0].begin);
+  EXPECT_EQ(2, boundaries[0].end);
+  EXPECT_EQ(2, boundaries[1].begin);
+  EXPECT_EQ(3, boundaries[1].end);
+  EXPECT_EQ(3, boundaries[2].begin);
+  EXPECT_EQ(6, boundaries[2].end);
+}
+
+/**
+ * @given proposal of several transactions
+ * @when its transactions span is iterated
+ * @then it has the transactions of the proposal in their order
+ */
+TEST_F(ProposalFactoryTest, TransactionsSpan) {
+  std::vector<proto::Transaction> txs;
+  for (const auto &tx : framework::batch::createUnsignedBatchTransactions(
+           interface::types::BatchType::ORDERED, 3)) {
+    txs.push_back(*std::static_pointer_cast<proto::Transaction>(tx));
+  }
+
+  auto proposal = valid_factory.unsafeCreateProposal(height, time, txs);
+  auto span = proposal->transactionsSpan();
+
+  ASSERT_EQ(txs.size(), span.size());
+  EXPECT_TRUE(std::equal(span.begin(),
+                         span.end(),
+                         proposal->transactions().begin(),
+                         [](const auto &lhs, const auto &rhs) {
+                           return &lhs == &rhs;
+                         }));
+  EXPECT_EQ(txs[2].hash(), span[2].hash());
+}
+
+/**
+ * @given proposal of several transactions
+ * @when proposals of the same contents are derived from it for other heights
+ * @then they are equal to the proposals created from scratch
+ * @and they reference the transactions of the given proposal
+ */
+TEST_F(ProposalFactoryTest, ProposalAtHeight) {
+  std::vector<proto::Transaction> txs;
+  for (const auto &tx : framework::batch::createUnsignedBatchTransactions(
+           interface::types::BatchType::ORDERED, 3)) {
+    txs.push_back(*std::static_pointer_cast<proto::Transaction>(tx));
+  }
+  auto proposal = valid_factory.unsafeCreateProposal(height, time, txs);
+
+  for (interface::types::HeightType other_height :
+       {height + 1, height + 200, interface::types::HeightType{0}}) {
+    auto derived =
+        valid_factory.unsafeCreateProposalAtHeight(*proposal, other_height);
+    auto expected = valid_factory.unsafeCreateProposal(other_height, time, txs);
+
+    EXPECT_EQ(other_height, derived->height());
+    EXPECT_EQ(time, derived->createdTime());
+    EXPECT_EQ(expected->blob(), derived->blob());
+    EXPECT_EQ(expected->hash(), derived->hash());
+    EXPECT_EQ(
+        &static_cast<const proto::Proposal &>(*proposal)
+             .getTransport()
+             .transactions(1),
+        &static_cast<const proto::Proposal &>(*derived)
+             .getTransport()
+             .transactions(1));
+  }
+}
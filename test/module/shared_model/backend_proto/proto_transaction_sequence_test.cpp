@@ -130,3 +130,29 @@ TEST_F(TransactionSequenceTestFixture, CreateBatches) {
   ASSERT_EQ(total_transactions,
             batches_number * txs_in_batch + single_transactions);
 }
+
+/**
+ * @given transactions of two batches interleaved with each other
+ * @when create transaction sequence
+ * @then the transactions are grouped into their batches
+ * @and the batches follow in the order of their first transactions
+ */
+TEST_F(TransactionSequenceTestFixture, InterleavedBatches) {
+  auto now = iroha::time::now();
+  auto first = framework::batch::createValidBatch(2, now)->transactions();
+  auto second = framework::batch::createValidBatch(2, now + 1)->transactions();
+
+  auto tx_sequence_opt =
+      interface::TransactionSequenceFactory::createTransactionSequence(
+          {first[0], second[0], first[1], second[1]},
+          txs_collection_validator,
+          field_validator);
+
+  auto tx_sequence = framework::expected::val(tx_sequence_opt);
+  ASSERT_TRUE(tx_sequence)
+      << framework::expected::err(tx_sequence_opt).value().error;
+  const auto &batches = tx_sequence->value.batches();
+  ASSERT_EQ(2, boost::size(batches));
+  EXPECT_EQ(first, batches[0]->transactions());
+  EXPECT_EQ(second, batches[1]->transactions());
+}
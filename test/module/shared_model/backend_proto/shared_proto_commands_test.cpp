@@ -4,6 +4,7 @@
  */
 
 #include "backend/protobuf/commands/proto_command.hpp"
+#include "backend/protobuf/commands/proto_flat_command.hpp"
 
 #include <gtest/gtest.h>
 
@@ -28,3 +29,48 @@ TEST(ProtoCommand, CommandLoad) {
     ASSERT_EQ(i, shared_model::proto::Command(command).get().which());
   });
 }
+
+/**
+ * For each protobuf command type
+ * @given protobuf command object
+ * @when create flat command
+ * @then the flat command of the corresponding type is created
+ */
+TEST(ProtoCommand, FlatCommandLoad) {
+  iroha::protocol::Command command;
+  EXPECT_EQ(0, shared_model::proto::makeFlatCommand(command).which());
+
+  auto refl = command.GetReflection();
+  auto desc = command.GetDescriptor();
+  boost::for_each(boost::irange(0, desc->field_count()), [&](auto i) {
+    auto field = desc->field(i);
+    refl->SetAllocatedMessage(
+        &command, refl->GetMessage(command, field).New(), field);
+    // the first type of the flat command is blank
+    ASSERT_EQ(i + 1, shared_model::proto::makeFlatCommand(command).which());
+  });
+}
+
+/**
+ * @given transfer asset command
+ * @when create flat command
+ * @then its fields are the views of the command strings
+ */
+TEST(ProtoCommand, FlatCommandRefersToMessage) {
+  iroha::protocol::Command command;
+  auto transfer = command.mutable_transfer_asset();
+  transfer->set_src_account_id("a@domain");
+  transfer->set_dest_account_id("b@domain");
+  transfer->set_asset_id("coin#domain");
+  transfer->set_amount("1.00");
+
+  auto flat = boost::get<shared_model::interface::flat::TransferAsset>(
+      shared_model::proto::makeFlatCommand(command));
+
+  EXPECT_EQ("a@domain", flat.src_account_id);
+  EXPECT_EQ("b@domain", flat.dest_account_id);
+  EXPECT_EQ("coin#domain", flat.asset_id);
+  EXPECT_EQ("1.00", flat.amount);
+  EXPECT_TRUE(flat.description.empty());
+  EXPECT_EQ(transfer->asset_id().data(), flat.asset_id.data());
+}
@@ -8,6 +8,7 @@
 #include "builders/protobuf/transaction.hpp"
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
 #include "cryptography/crypto_provider/crypto_signer.hpp"
+#include "cryptography/default_hash_provider.hpp"
 
 // common data for tests
 auto created_time = iroha::time::now();
@@ -101,3 +102,24 @@ TEST(ProtoTransaction, BuilderWithInvalidTx) {
                    .build(),
                std::invalid_argument);
 }
+
+/**
+ * @given transaction
+ * @when it is copied and cloned before and after its hashes are computed
+ * @then the copies share the hashes of the original
+ */
+TEST(ProtoTransaction, CopiesShareHashes) {
+  shared_model::proto::Transaction tx(generateEmptyTransaction());
+  shared_model::proto::Transaction early_copy(tx);
+
+  const auto &hash = tx.hash();
+  const auto &reduced_hash = tx.reducedHash();
+  auto late_clone = clone(tx);
+
+  EXPECT_EQ(&hash, &early_copy.hash());
+  EXPECT_EQ(&reduced_hash, &early_copy.reducedHash());
+  EXPECT_EQ(&hash, &late_clone->hash());
+  EXPECT_EQ(&reduced_hash, &late_clone->reducedHash());
+  EXPECT_EQ(shared_model::crypto::DefaultHashProvider::makeHash(tx.payload()),
+            hash);
+}
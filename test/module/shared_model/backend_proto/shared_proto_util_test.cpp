@@ -25,3 +25,20 @@ TEST(UtilTest, StringFromMakeBlob) {
   ASSERT_TRUE(deserialized.ParseFromString(toBinaryString(blob)));
   ASSERT_EQ(deserialized.quorum(), base.quorum());
 }
+
+/**
+ * @given protobuf message with a oneof
+ * @when the indices of the fields are looked up by their numbers
+ * @then they are the indices of the fields in the oneof
+ * @and the numbers without a field of the oneof have no index
+ */
+TEST(UtilTest, OneofIndex) {
+  const auto *oneof =
+      protocol::Command::descriptor()->FindOneofByName("command");
+  for (int i = 0; i < oneof->field_count(); ++i) {
+    EXPECT_EQ(i, oneofIndex<protocol::Command>(oneof->field(i)->number()));
+  }
+  EXPECT_EQ(-1, oneofIndex<protocol::Command>(0));
+  EXPECT_EQ(-1, oneofIndex<protocol::Command>(-1));
+  EXPECT_EQ(-1, oneofIndex<protocol::Command>(1 << 20));
+}
@@ -6,6 +6,8 @@
 #include "cryptography/blob.hpp"
 #include <gtest/gtest.h>
 #include <memory>
+#include <thread>
+#include <vector>
 
 using namespace shared_model::crypto;
 using namespace std::literals::string_literals;
@@ -43,3 +45,28 @@ TEST_F(BlobMock, BlobIsString) {
     ASSERT_EQ(binary[i], bin_str[i]);
   }
 }
+
+/**
+ * @given blob which is copied before and after its hex is made
+ * @when the hex is requested from several threads
+ * @then all of them get the same representation
+ */
+TEST_F(BlobMock, LazyHex) {
+  Blob before(*blob);
+  std::vector<std::thread> threads;
+  std::vector<std::string> hexes(4);
+  for (size_t i = 0; i < hexes.size(); ++i) {
+    threads.emplace_back([&, i] { hexes[i] = blob->hex(); });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  Blob after(*blob);
+  before = Blob::fromHexString(hexes.front());
+
+  for (const auto &hex : hexes) {
+    ASSERT_EQ("48656c6c6f2000576f726c64", hex);
+  }
+  ASSERT_EQ(&blob->hex(), &after.hex());
+  ASSERT_EQ(blob->hex(), before.hex());
+}
@@ -89,6 +89,20 @@ TEST_F(CryptoUsageTest, RawSignAndVerifyTest) {
   ASSERT_TRUE(verified);
 }
 
+/**
+ * @given signature of the data and public key of wrong size
+ * @when verify the signature
+ * @then the signature is not verified
+ */
+TEST_F(CryptoUsageTest, RawVerifyWithMalformedKey) {
+  auto signed_blob =
+      shared_model::crypto::DefaultCryptoAlgorithmType::sign(data, keypair);
+  const auto &key = keypair.publicKey().blob();
+  PublicKey truncated(Blob(Blob::Bytes(key.begin(), key.end() - 1)));
+  ASSERT_FALSE(
+      DefaultCryptoAlgorithmType::verify(signed_blob, data, truncated));
+}
+
 /**
  * @given unsigned block
  * @when verify block
@@ -0,0 +1,73 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cryptography/merkle_tree.hpp"
+
+#include <gtest/gtest.h>
+#include "cryptography/hash_providers/sha3_256.hpp"
+
+using namespace shared_model::crypto;
+
+class MerkleTreeTest : public ::testing::Test {
+ public:
+  /// @return hashes of the given number of transactions
+  static std::vector<Hash> transactions(size_t size) {
+    std::vector<Hash> hashes;
+    for (size_t i = 0; i < size; ++i) {
+      hashes.push_back(Sha3_256::makeHash(Blob(std::to_string(i))));
+    }
+    return hashes;
+  }
+};
+
+/**
+ * @given trees of different numbers of transactions, including odd levels
+ * @when the proofs of all the transactions are verified
+ * @then they are valid against the root of the tree
+ */
+TEST_F(MerkleTreeTest, ProvesEveryTransaction) {
+  for (size_t size = 1; size <= 9; ++size) {
+    auto hashes = transactions(size);
+    MerkleTree tree(hashes);
+    ASSERT_EQ(tree.size(), size);
+    for (size_t i = 0; i < size; ++i) {
+      EXPECT_TRUE(MerkleTree::verify(
+          hashes[i], i, size, tree.proof(i), tree.root()))
+          << "transaction " << i << " of " << size;
+    }
+  }
+}
+
+/**
+ * @given tree of several transactions
+ * @when a proof is verified with another transaction, index, size or root
+ * @then it is invalid
+ */
+TEST_F(MerkleTreeTest, RejectsWrongProof) {
+  auto hashes = transactions(5);
+  MerkleTree tree(hashes);
+  auto proof = tree.proof(2);
+
+  EXPECT_FALSE(MerkleTree::verify(hashes[3], 2, 5, proof, tree.root()));
+  EXPECT_FALSE(MerkleTree::verify(hashes[2], 3, 5, proof, tree.root()));
+  EXPECT_FALSE(MerkleTree::verify(hashes[2], 2, 3, proof, tree.root()));
+  EXPECT_FALSE(MerkleTree::verify(hashes[2], 5, 5, proof, tree.root()));
+  EXPECT_FALSE(MerkleTree::verify(hashes[2], 2, 5, proof, hashes[2]));
+  proof.pop_back();
+  EXPECT_FALSE(MerkleTree::verify(hashes[2], 2, 5, proof, tree.root()));
+}
+
+/**
+ * @given a tree of one transaction and a tree of two
+ * @when the root of the first is passed as a leaf of the second
+ * @then the roots differ, as the leaves and the nodes are hashed apart
+ */
+TEST_F(MerkleTreeTest, SeparatesLeavesFromNodes) {
+  auto hashes = transactions(2);
+  MerkleTree pair(hashes);
+  MerkleTree single({pair.root()});
+  EXPECT_NE(single.root(), pair.root());
+  EXPECT_EQ(MerkleTree({}).size(), 0);
+}
@@ -0,0 +1,62 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cryptography/crypto_provider/pipelined_signer.hpp"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <future>
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
+
+using namespace shared_model::crypto;
+using namespace std::chrono_literals;
+
+class PipelinedSignerTest : public ::testing::Test {
+ public:
+  /// signing function of a device, which takes some time per request
+  PipelinedSigner::SignFunction device() {
+    return [this](const Blob &blob) {
+      auto in_flight = ++in_flight_;
+      auto max = max_in_flight_.load();
+      while (in_flight > max
+             and not max_in_flight_.compare_exchange_weak(max, in_flight)) {
+      }
+      std::this_thread::sleep_for(10ms);
+      --in_flight_;
+      return DefaultCryptoAlgorithmType::sign(blob, keypair);
+    };
+  }
+
+  Keypair keypair = DefaultCryptoAlgorithmType::generateKeypair();
+  std::atomic<size_t> in_flight_{0};
+  std::atomic<size_t> max_in_flight_{0};
+};
+
+/**
+ * @given pipelined signer of depth 4
+ * @when 8 blobs are signed at once
+ * @then all of the signatures are valid, and 4 requests were in flight
+ */
+TEST_F(PipelinedSignerTest, SignsConcurrently) {
+  constexpr size_t kRequests = 8;
+  std::vector<Blob> blobs;
+  std::vector<std::promise<Signed>> signatures(kRequests);
+  {
+    PipelinedSigner signer(keypair.publicKey(), device(), 4);
+    for (size_t i = 0; i < kRequests; ++i) {
+      blobs.emplace_back("blob " + std::to_string(i));
+      signer.sign(blobs.back(), [&signatures, i](Signed signature) {
+        signatures[i].set_value(std::move(signature));
+      });
+    }
+  }
+
+  for (size_t i = 0; i < kRequests; ++i) {
+    EXPECT_TRUE(CryptoVerifier<>::verify(
+        signatures[i].get_future().get(), blobs[i], keypair.publicKey()));
+  }
+  EXPECT_EQ(4, max_in_flight_);
+}
@@ -0,0 +1,107 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cryptography/verified_signature_cache.hpp"
+
+#include <gtest/gtest.h>
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
+
+using namespace shared_model::crypto;
+
+class VerifiedSignatureCacheTest : public ::testing::Test {
+ public:
+  Keypair keypair = DefaultCryptoAlgorithmType::generateKeypair();
+  Blob data{"raw data for signing"};
+  Signed signature = DefaultCryptoAlgorithmType::sign(data, keypair);
+};
+
+/**
+ * @given cache with a verified signature
+ * @when the signature is looked up with the same or other data
+ * @then it is found only for the data it was verified with
+ */
+TEST_F(VerifiedSignatureCacheTest, KeyedByData) {
+  VerifiedSignatureCache cache;
+  auto digest = VerifiedSignatureCache::digest(data);
+  cache.insert(digest, keypair.publicKey(), signature);
+
+  EXPECT_TRUE(cache.contains(digest, keypair.publicKey(), signature));
+  EXPECT_FALSE(cache.contains(VerifiedSignatureCache::digest(Blob("other")),
+                              keypair.publicKey(),
+                              signature));
+}
+
+/**
+ * @given cache with a verified signature
+ * @when it is looked up with a public key extended by the first bytes of the
+ * signature and the rest of the signature
+ * @then it is not found
+ */
+TEST_F(VerifiedSignatureCacheTest, KeyedBySplitOfKeyAndSignature) {
+  VerifiedSignatureCache cache;
+  auto digest = VerifiedSignatureCache::digest(data);
+  cache.insert(digest, keypair.publicKey(), signature);
+
+  const size_t shift = 8;
+  auto shifted_key_bytes = keypair.publicKey().blob();
+  const auto &signature_bytes = signature.blob();
+  shifted_key_bytes.insert(shifted_key_bytes.end(),
+                           signature_bytes.begin(),
+                           signature_bytes.begin() + shift);
+  PublicKey shifted_key{Blob{shifted_key_bytes}};
+  Signed shifted_signature{Blob::Bytes(signature_bytes.begin() + shift,
+                                       signature_bytes.end())};
+
+  EXPECT_FALSE(cache.contains(digest, shifted_key, shifted_signature));
+  EXPECT_FALSE(CryptoVerifier<>::verify(shifted_signature, data, shifted_key));
+}
+
+/**
+ * @given a valid and an invalid signature
+ * @when they are verified
+ * @then only the valid one is remembered by the cache of the process
+ */
+TEST_F(VerifiedSignatureCacheTest, VerifierRemembersValidSignatures) {
+  auto wrong_signature =
+      DefaultCryptoAlgorithmType::sign(Blob("wrong payload"), keypair);
+  auto digest = VerifiedSignatureCache::digest(data);
+  auto &cache = VerifiedSignatureCache::instance();
+
+  EXPECT_TRUE(CryptoVerifier<>::verify(signature, data, keypair.publicKey()));
+  EXPECT_TRUE(cache.contains(digest, keypair.publicKey(), signature));
+
+  EXPECT_FALSE(
+      CryptoVerifier<>::verify(wrong_signature, data, keypair.publicKey()));
+  EXPECT_FALSE(cache.contains(digest, keypair.publicKey(), wrong_signature));
+  EXPECT_FALSE(CryptoVerifier<>::verifyBatch(
+      data,
+      {SignatureRef{signature, keypair.publicKey()},
+       SignatureRef{wrong_signature, keypair.publicKey()}}));
+}
+
+/**
+ * @given signatures of different data, one of which is invalid
+ * @when they are verified in one batch
+ * @then the batch fails and the invalid signature is found, while the valid
+ * ones are remembered by the cache of the process
+ */
+TEST_F(VerifiedSignatureCacheTest, BatchOfDifferentData) {
+  Blob other_data{"other raw data for signing"};
+  auto other_signature = DefaultCryptoAlgorithmType::sign(other_data, keypair);
+  auto wrong_signature =
+      DefaultCryptoAlgorithmType::sign(Blob("wrong payload"), keypair);
+
+  auto valid = CryptoVerifier<>::verifyBatch(
+      {SignedMessageRef{data, signature, keypair.publicKey()},
+       SignedMessageRef{other_data, wrong_signature, keypair.publicKey()},
+       SignedMessageRef{other_data, other_signature, keypair.publicKey()}});
+
+  EXPECT_EQ((std::vector<bool>{true, false, true}), valid);
+  EXPECT_TRUE(VerifiedSignatureCache::instance().contains(
+      VerifiedSignatureCache::digest(other_data),
+      keypair.publicKey(),
+      other_signature));
+}
@@ -58,3 +58,62 @@ TEST_F(AmountTest, Invalid) {
   checkInvalid(Amount{"1."});
   checkInvalid(Amount{"."});
 }
+
+/// the greatest 256-bit value
+static const std::string kMaxAmount =
+    "11579208923731619542357098500868790785326998466564056403945758400791312"
+    "9639935";
+
+TEST_F(AmountTest, TooLarge) {
+  checkValid(Amount{kMaxAmount}, 1, 0, kMaxAmount);
+  checkInvalid(Amount{
+      "11579208923731619542357098500868790785326998466564056403945758400791312"
+      "9639936"});
+}
+
+/**
+ * @given amounts of different precisions
+ * @when they are added and subtracted
+ * @then the results are in the greater precision
+ * @and the carries and borrows cross the words of the value
+ */
+TEST_F(AmountTest, Arithmetic) {
+  checkValid(*Amount{"18446744073709551615"}.add(Amount{"1.5"}),
+             1,
+             1,
+             "18446744073709551616.5");
+  checkValid(*Amount{"18446744073709551616"}.subtract(Amount{"0.01"}),
+             1,
+             2,
+             "18446744073709551615.99");
+  checkValid(*Amount{"1.00"}.subtract(Amount{"1"}), 0, 2, "0.00");
+}
+
+/**
+ * @given amounts
+ * @when the results do not fit or are negative
+ * @then the operations fail
+ */
+TEST_F(AmountTest, ArithmeticFailures) {
+  EXPECT_FALSE(Amount{kMaxAmount}.add(Amount{"1"}));
+  EXPECT_FALSE(Amount{kMaxAmount}.add(Amount{"0.1"}));
+  EXPECT_FALSE(Amount{"1"}.subtract(Amount{"1.01"}));
+  EXPECT_FALSE(Amount{"1"}.add(Amount{"NaN"}));
+}
+
+/**
+ * @given amount
+ * @when it is encoded and decoded
+ * @then the decoded amount equals the original one
+ */
+TEST_F(AmountTest, Encoding) {
+  Amount amount{"340282366920938463463374607431768211456.25"};
+  auto encoded = amount.encode();
+  ASSERT_EQ(encoded.size(), Amount::kEncodedSize);
+  EXPECT_EQ(encoded[0], 2);
+  auto decoded = Amount::decode(encoded);
+  ASSERT_TRUE(decoded);
+  EXPECT_EQ(*decoded, amount);
+  EXPECT_EQ(decoded->toStringRepr(), amount.toStringRepr());
+  EXPECT_FALSE(Amount::decode(encoded.substr(1)));
+}
@@ -26,6 +26,8 @@ struct MockBlock : public shared_model::interface::Block {
   MOCK_CONST_METHOD0(
       transactions,
       shared_model::interface::types::TransactionsCollectionType());
+  MOCK_CONST_METHOD0(transactionsSpan,
+                     shared_model::interface::types::TransactionsSpanType());
   MOCK_CONST_METHOD0(rejected_transactions_hashes,
                      shared_model::interface::types::HashCollectionType());
   MOCK_CONST_METHOD0(height, shared_model::interface::types::HeightType());
@@ -50,6 +52,9 @@ struct MockTransaction : public shared_model::interface::Transaction {
                      const shared_model::interface::types::AccountIdType &());
   MOCK_CONST_METHOD0(quorum, shared_model::interface::types::QuorumType());
   MOCK_CONST_METHOD0(commands, CommandsType());
+  MOCK_CONST_METHOD0(commandsSpan, CommandsSpanType());
+  MOCK_CONST_METHOD0(flatCommands,
+                     const shared_model::interface::FlatCommandsType &());
   MOCK_CONST_METHOD0(reducedHash,
                      const shared_model::interface::types::HashType &());
   MOCK_CONST_METHOD0(hash, const shared_model::interface::types::HashType &());
@@ -170,6 +175,8 @@ struct MockProposal : public shared_model::interface::Proposal {
   MOCK_CONST_METHOD0(
       transactions,
       shared_model::interface::types::TransactionsCollectionType());
+  MOCK_CONST_METHOD0(transactionsSpan,
+                     shared_model::interface::types::TransactionsSpanType());
   MOCK_CONST_METHOD0(height, shared_model::interface::types::HeightType());
   MOCK_CONST_METHOD0(createdTime,
                      shared_model::interface::types::TimestampType());
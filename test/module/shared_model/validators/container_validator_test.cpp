@@ -3,6 +3,9 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <atomic>
+#include <thread>
+
 #include <gtest/gtest.h>
 #include "cryptography/default_hash_provider.hpp"
 #include "module/irohad/common/validators_config.hpp"
@@ -127,3 +130,51 @@ TEST_F(ContainerValidatorTest, OldBlockNewTransaction) {
   ASSERT_THAT(result.reason(),
               HasSubstr("Transaction: [[bad timestamp: sent from future"));
 }
+
+/**
+ * @given proposal of valid and invalid transactions
+ * @when it is validated with the config which validates the transactions
+ * concurrently
+ * @then the validation runs on the threads of the config
+ * @and the errors are the same as the ones of the sequential validation
+ */
+TEST_F(ContainerValidatorTest, ParallelValidation) {
+  std::atomic<size_t> calls{0};
+  auto config = std::make_shared<shared_model::validation::ValidatorsConfig>(
+      iroha::test::getTestsMaxBatchSize(),
+      shared_model::validation::getDefaultSettings(),
+      false,
+      false,
+      [&calls](size_t size, const std::function<void(size_t)> &f) {
+        ++calls;
+        std::vector<std::thread> threads;
+        for (size_t i = size; i > 0; --i) {
+          threads.emplace_back(f, i - 1);
+        }
+        for (auto &thread : threads) {
+          thread.join();
+        }
+      });
+  std::vector<shared_model::proto::Transaction> txs;
+  for (size_t i = 0; i < 8; ++i) {
+    txs.push_back(makeTransaction(i % 3 == 0 ? current_timestamp + i
+                                             : old_timestamp + i));
+  }
+  auto proposal = TestProposalBuilder()
+                      .height(1)
+                      .createdTime(old_timestamp)
+                      .transactions(txs)
+                      .build();
+
+  auto parallel_result =
+      shared_model::validation::DefaultProposalValidator(config).validate(
+          proposal);
+  auto sequential_result =
+      shared_model::validation::DefaultProposalValidator(
+          iroha::test::kTestsValidatorsConfig)
+          .validate(proposal);
+
+  EXPECT_GT(calls, 0);
+  ASSERT_TRUE(parallel_result.hasErrors());
+  EXPECT_EQ(parallel_result.reason(), sequential_result.reason());
+}
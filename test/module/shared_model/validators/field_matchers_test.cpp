@@ -0,0 +1,77 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validators/field_matchers.hpp"
+
+#include <gtest/gtest.h>
+#include <random>
+#include <regex>
+
+using namespace shared_model::validation::matchers;
+
+namespace {
+  // the grammars of the fields as they were defined by the regexes
+  const std::string kName = R"#([a-z_0-9]{1,32})#";
+  const std::string kDomain =
+      R"#(([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?\.)*)#"
+      R"#([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?)#";
+  const std::string kIpV4 =
+      R"#(((([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])\.){3})#"
+      R"#(([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])))#";
+  const std::string kPort =
+      R"#((6553[0-5]|655[0-2]\d|65[0-4]\d\d|6[0-4]\d{3}|[1-5]\d{4})#"
+      R"#(|[1-9]\d{0,3}|0))#";
+}  // namespace
+
+/**
+ * @given host:port strings
+ * @when they are matched as peer addresses
+ * @then only IPv4 addresses and domains with the ports in range match
+ */
+TEST(FieldMatchersTest, PeerAddress) {
+  EXPECT_TRUE(isPeerAddress("1.1.1.1:0"));
+  EXPECT_TRUE(isPeerAddress("255.255.255.255:65535"));
+  EXPECT_TRUE(isPeerAddress("a-b.c:80"));
+  EXPECT_FALSE(isPeerAddress("256.1.1.1:1"));
+  EXPECT_FALSE(isPeerAddress("01.1.1.1:1"));
+  EXPECT_FALSE(isPeerAddress("a-.c:80"));
+  EXPECT_FALSE(isPeerAddress("1.1.1.1:065"));
+  EXPECT_FALSE(isPeerAddress("host:65536"));
+  EXPECT_FALSE(isPeerAddress("host:1:1"));
+}
+
+/**
+ * @given random strings over the alphabets of the fields
+ * @when they are matched by the matchers and by the regexes
+ * @then the results are the same
+ */
+TEST(FieldMatchersTest, SameAsRegex) {
+  const std::vector<std::pair<std::function<bool(const std::string &)>,
+                              std::regex>>
+      matchers{
+          {isName, std::regex(kName)},
+          {isDetailKey, std::regex(R"([A-Za-z0-9_]{1,64})")},
+          {isDomain, std::regex(kDomain)},
+          {isIpV4, std::regex(kIpV4)},
+          {isPeerAddress,
+           std::regex("((" + kIpV4 + ")|(" + kDomain + ")):" + kPort)},
+          {isAccountId, std::regex(kName + R"#(\@)#" + kDomain)},
+          {isAssetId, std::regex(kName + R"#(\#)#" + kDomain)},
+      };
+  const std::vector<std::string> alphabets{"aZ09_-.@#:5", "0123456789.:a"};
+
+  std::mt19937 generator(1);
+  for (size_t i = 0; i < 20000; ++i) {
+    const auto &alphabet = alphabets[i % alphabets.size()];
+    std::string str(generator() % (i % 10 == 0 ? 80 : 14), ' ');
+    for (auto &c : str) {
+      c = alphabet[generator() % alphabet.size()];
+    }
+    for (const auto &matcher : matchers) {
+      EXPECT_EQ(std::regex_match(str, matcher.second), matcher.first(str))
+          << str;
+    }
+  }
+}